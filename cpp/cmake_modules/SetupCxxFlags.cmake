@@ -20,6 +20,39 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 check_cxx_compiler_flag("-msse4.2" CXX_SUPPORTS_SSE4_2)
+# Instruction sets used by kernels selected at runtime
+if(MSVC)
+  set(ARROW_SSE4_2_FLAG "")
+  set(ARROW_AVX2_FLAG "/arch:AVX2")
+  set(ARROW_AVX512_FLAG "/arch:AVX512")
+  set(CXX_SUPPORTS_SSE4_2_FLAG TRUE)
+else()
+  set(ARROW_SSE4_2_FLAG "-msse4.2")
+  set(ARROW_AVX2_FLAG "-mavx2")
+  set(ARROW_AVX512_FLAG "-mavx512f")
+  set(CXX_SUPPORTS_SSE4_2_FLAG ${CXX_SUPPORTS_SSE4_2})
+endif()
+check_cxx_compiler_flag(${ARROW_AVX2_FLAG} CXX_SUPPORTS_AVX2)
+check_cxx_compiler_flag(${ARROW_AVX512_FLAG} CXX_SUPPORTS_AVX512)
+
+# Which of them to compile kernels for, up to ARROW_RUNTIME_SIMD_LEVEL.  Each
+# ARROW_HAVE_RUNTIME_<level> variable enables the translation units built with
+# the corresponding flag, and defines the macro of the same name.
+set(ARROW_HAVE_RUNTIME_SSE4_2 OFF)
+set(ARROW_HAVE_RUNTIME_AVX2 OFF)
+set(ARROW_HAVE_RUNTIME_AVX512 OFF)
+if(ARROW_USE_SIMD)
+  if(ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(SSE4_2|AVX2|AVX512|MAX)$"
+     AND CXX_SUPPORTS_SSE4_2_FLAG)
+    set(ARROW_HAVE_RUNTIME_SSE4_2 ON)
+  endif()
+  if(ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX2|AVX512|MAX)$" AND CXX_SUPPORTS_AVX2)
+    set(ARROW_HAVE_RUNTIME_AVX2 ON)
+  endif()
+  if(ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX512|MAX)$" AND CXX_SUPPORTS_AVX512)
+    set(ARROW_HAVE_RUNTIME_AVX512 ON)
+  endif()
+endif()
 # power compiler flags
 check_cxx_compiler_flag("-maltivec" CXX_SUPPORTS_ALTIVEC)
 # Arm64 compiler flags
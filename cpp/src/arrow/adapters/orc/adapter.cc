@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <deque>
 #include <list>
 #include <memory>
 #include <sstream>
@@ -32,6 +33,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -40,9 +42,12 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/Exceptions.hh"
@@ -106,6 +111,33 @@ class ArrowInputFile : public liborc::InputStream {
   std::shared_ptr<io::RandomAccessFile> file_;
 };
 
+class ArrowOutputStream : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputStream(io::OutputStream* output_stream)
+      : output_stream_(output_stream), length_(0) {}
+
+  uint64_t getLength() const override { return length_; }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(output_stream_->Write(buf, static_cast<int64_t>(length)));
+    length_ += static_cast<uint64_t>(length);
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputFile");
+    return filename;
+  }
+
+  // The output stream belongs to the caller
+  void close() override {}
+
+ private:
+  io::OutputStream* output_stream_;
+  uint64_t length_;
+};
+
 struct StripeInformation {
   uint64_t offset;
   uint64_t length;
@@ -116,6 +148,103 @@ struct StripeInformation {
 // The number of rows to read in a ColumnVectorBatch
 constexpr int64_t kReadRowsBatch = 1000;
 
+// Convert the liborc statistics of a column. Min and max are only set for
+// the types whose statistics map exactly to Arrow values.
+static Status GetColumnStatistics(const liborc::Type* type,
+                                  const liborc::ColumnStatistics* stats,
+                                  ORCColumnStatistics* out) {
+  *out = ORCColumnStatistics();
+  if (stats == nullptr) {
+    return Status::OK();
+  }
+  out->num_values = static_cast<int64_t>(stats->getNumberOfValues());
+  out->has_null = stats->hasNull();
+
+  switch (type->getKind()) {
+    case liborc::BOOLEAN: {
+      auto bool_stats = dynamic_cast<const liborc::BooleanColumnStatistics*>(stats);
+      if (bool_stats != nullptr && bool_stats->hasCount() && out->num_values > 0) {
+        out->min = std::make_shared<BooleanScalar>(bool_stats->getFalseCount() == 0);
+        out->max = std::make_shared<BooleanScalar>(bool_stats->getTrueCount() > 0);
+      }
+      break;
+    }
+    case liborc::BYTE:
+    case liborc::SHORT:
+    case liborc::INT:
+    case liborc::LONG: {
+      auto int_stats = dynamic_cast<const liborc::IntegerColumnStatistics*>(stats);
+      if (int_stats == nullptr || !int_stats->hasMinimum() || !int_stats->hasMaximum()) {
+        break;
+      }
+      // The bounds fit in the column type, which may be narrower than int64
+      const int64_t min = int_stats->getMinimum();
+      const int64_t max = int_stats->getMaximum();
+      switch (type->getKind()) {
+        case liborc::BYTE:
+          out->min = std::make_shared<Int8Scalar>(static_cast<int8_t>(min));
+          out->max = std::make_shared<Int8Scalar>(static_cast<int8_t>(max));
+          break;
+        case liborc::SHORT:
+          out->min = std::make_shared<Int16Scalar>(static_cast<int16_t>(min));
+          out->max = std::make_shared<Int16Scalar>(static_cast<int16_t>(max));
+          break;
+        case liborc::INT:
+          out->min = std::make_shared<Int32Scalar>(static_cast<int32_t>(min));
+          out->max = std::make_shared<Int32Scalar>(static_cast<int32_t>(max));
+          break;
+        default:
+          out->min = std::make_shared<Int64Scalar>(min);
+          out->max = std::make_shared<Int64Scalar>(max);
+          break;
+      }
+      break;
+    }
+    case liborc::FLOAT:
+    case liborc::DOUBLE: {
+      auto double_stats = dynamic_cast<const liborc::DoubleColumnStatistics*>(stats);
+      if (double_stats == nullptr || !double_stats->hasMinimum() ||
+          !double_stats->hasMaximum()) {
+        break;
+      }
+      if (type->getKind() == liborc::FLOAT) {
+        out->min =
+            std::make_shared<FloatScalar>(static_cast<float>(double_stats->getMinimum()));
+        out->max =
+            std::make_shared<FloatScalar>(static_cast<float>(double_stats->getMaximum()));
+      } else {
+        out->min = std::make_shared<DoubleScalar>(double_stats->getMinimum());
+        out->max = std::make_shared<DoubleScalar>(double_stats->getMaximum());
+      }
+      break;
+    }
+    case liborc::STRING:
+    case liborc::VARCHAR: {
+      auto string_stats = dynamic_cast<const liborc::StringColumnStatistics*>(stats);
+      if (string_stats != nullptr && string_stats->hasMinimum() &&
+          string_stats->hasMaximum()) {
+        out->min = std::make_shared<StringScalar>(string_stats->getMinimum());
+        out->max = std::make_shared<StringScalar>(string_stats->getMaximum());
+      }
+      break;
+    }
+    case liborc::DATE: {
+      auto date_stats = dynamic_cast<const liborc::DateColumnStatistics*>(stats);
+      if (date_stats != nullptr && date_stats->hasMinimum() &&
+          date_stats->hasMaximum()) {
+        out->min = std::make_shared<Date32Scalar>(date_stats->getMinimum());
+        out->max = std::make_shared<Date32Scalar>(date_stats->getMaximum());
+      }
+      break;
+    }
+    default:
+      // Timestamps are stored in milliseconds, CHAR values are padded and
+      // decimals and nested types don't have usable bounds
+      break;
+  }
+  return Status::OK();
+}
+
 class OrcStripeReader : public RecordBatchReader {
  public:
   OrcStripeReader(std::unique_ptr<liborc::RowReader> row_reader,
@@ -136,9 +265,14 @@ class OrcStripeReader : public RecordBatchReader {
     }
 
     const liborc::Type& type = row_reader_->getSelectedType();
-    if (!row_reader_->next(*batch)) {
-      out->reset();
-      return Status::OK();
+    // Don't let exceptions escape, this may run on a thread pool
+    try {
+      if (!row_reader_->next(*batch)) {
+        out->reset();
+        return Status::OK();
+      }
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
     }
 
     std::unique_ptr<RecordBatchBuilder> builder;
@@ -163,9 +297,82 @@ class OrcStripeReader : public RecordBatchReader {
   int64_t batch_size_;
 };
 
+// Reads a sequence of stripes, decoding up to `num_prefetch` of them ahead of the
+// consumer on the CPU thread pool. Each stripe has its own row reader, created
+// beforehand as liborc doesn't guarantee that createRowReader is thread-safe.
+class OrcPrefetchingReader : public RecordBatchReader {
+ public:
+  using StripeBatches = std::vector<std::shared_ptr<RecordBatch>>;
+
+  OrcPrefetchingReader(std::vector<std::unique_ptr<liborc::RowReader>> row_readers,
+                       std::shared_ptr<Schema> schema, int64_t batch_size,
+                       int num_prefetch, MemoryPool* pool)
+      : row_readers_(std::move(row_readers)),
+        schema_(std::move(schema)),
+        batch_size_(batch_size),
+        num_prefetch_(static_cast<size_t>(num_prefetch)),
+        pool_(pool) {}
+
+  ~OrcPrefetchingReader() override {
+    // The stripes being decoded allocate from pool_
+    for (const auto& stripe : pending_stripes_) {
+      stripe.Wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (next_batch_ >= current_batches_.size()) {
+      RETURN_NOT_OK(Prefetch());
+      if (pending_stripes_.empty()) {
+        out->reset();
+        return Status::OK();
+      }
+      Future<StripeBatches> stripe = std::move(pending_stripes_.front());
+      pending_stripes_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(current_batches_, stripe.result());
+      next_batch_ = 0;
+    }
+    // Decode the next stripe while this one is consumed
+    RETURN_NOT_OK(Prefetch());
+    *out = std::move(current_batches_[next_batch_++]);
+    return Status::OK();
+  }
+
+ private:
+  Status Prefetch() {
+    while (pending_stripes_.size() < num_prefetch_ &&
+           next_stripe_ < row_readers_.size()) {
+      auto stripe_reader = std::make_shared<OrcStripeReader>(
+          std::move(row_readers_[next_stripe_++]), schema_, batch_size_, pool_);
+      ARROW_ASSIGN_OR_RAISE(
+          auto stripe, internal::GetCpuThreadPool()->Submit(
+                           [stripe_reader]() -> Result<StripeBatches> {
+                             StripeBatches batches;
+                             RETURN_NOT_OK(stripe_reader->ReadAll(&batches));
+                             return batches;
+                           }));
+      pending_stripes_.push_back(std::move(stripe));
+    }
+    return Status::OK();
+  }
+
+  std::vector<std::unique_ptr<liborc::RowReader>> row_readers_;
+  std::shared_ptr<Schema> schema_;
+  int64_t batch_size_;
+  size_t num_prefetch_;
+  MemoryPool* pool_;
+
+  size_t next_stripe_ = 0;
+  std::deque<Future<StripeBatches>> pending_stripes_;
+  StripeBatches current_batches_;
+  size_t next_batch_ = 0;
+};
+
 class ORCFileReader::Impl {
  public:
-  Impl() {}
+  Impl() : use_threads_(false) {}
   ~Impl() {}
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool) {
@@ -202,6 +409,72 @@ class ORCFileReader::Impl {
 
   int64_t NumberOfRows() { return reader_->getNumberOfRows(); }
 
+  int64_t NumberOfRowsInStripe(int64_t stripe) {
+    if (stripe < 0 || stripe >= NumberOfStripes()) {
+      return 0;
+    }
+    return static_cast<int64_t>(stripes_[stripe].num_rows);
+  }
+
+  int64_t RowIndexStride() {
+    return static_cast<int64_t>(reader_->getRowIndexStride());
+  }
+
+  Status ReadStripeStatistics(int64_t stripe, std::vector<ORCColumnStatistics>* out) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    std::unique_ptr<liborc::StripeStatistics> stats;
+    try {
+      stats = reader_->getStripeStatistics(stripe);
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    const liborc::Type& type = reader_->getType();
+    out->resize(type.getSubtypeCount());
+    for (uint64_t i = 0; i < type.getSubtypeCount(); ++i) {
+      const liborc::Type* field_type = type.getSubtype(i);
+      RETURN_NOT_OK(GetColumnStatistics(
+          field_type,
+          stats->getColumnStatistics(static_cast<uint32_t>(field_type->getColumnId())),
+          &(*out)[i]));
+    }
+    return Status::OK();
+  }
+
+  Status ReadRowGroupStatistics(int64_t stripe,
+                                std::vector<std::vector<ORCColumnStatistics>>* out) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    out->clear();
+    const liborc::Type& type = reader_->getType();
+    if (RowIndexStride() == 0 || type.getSubtypeCount() == 0) {
+      return Status::OK();
+    }
+    std::unique_ptr<liborc::StripeStatistics> stats;
+    try {
+      stats = reader_->getStripeStatistics(stripe);
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    const auto first_column = static_cast<uint32_t>(type.getSubtype(0)->getColumnId());
+    const uint32_t num_row_groups = stats->getNumberOfRowIndexStats(first_column);
+    out->resize(num_row_groups);
+    for (uint32_t group = 0; group < num_row_groups; ++group) {
+      auto& group_stats = (*out)[group];
+      group_stats.resize(type.getSubtypeCount());
+      for (uint64_t i = 0; i < type.getSubtypeCount(); ++i) {
+        const liborc::Type* field_type = type.getSubtype(i);
+        const auto column = static_cast<uint32_t>(field_type->getColumnId());
+        const liborc::ColumnStatistics* column_stats =
+            group < stats->getNumberOfRowIndexStats(column)
+                ? stats->getRowIndexStatistics(column, group)
+                : nullptr;
+        RETURN_NOT_OK(GetColumnStatistics(field_type, column_stats, &group_stats[i]));
+      }
+    }
+    return Status::OK();
+  }
+
   Status ReadSchema(std::shared_ptr<Schema>* out) {
     const liborc::Type& type = reader_->getType();
     return GetArrowSchema(type, out);
@@ -290,6 +563,84 @@ class ORCFileReader::Impl {
     return ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
   }
 
+  Status ReadStripeRowGroups(int64_t stripe, const std::vector<int>& row_groups,
+                             const std::vector<int>& include_indices,
+                             std::shared_ptr<RecordBatch>* out) {
+    liborc::RowReaderOptions opts;
+    if (!include_indices.empty()) {
+      RETURN_NOT_OK(SelectIndices(&opts, include_indices));
+    }
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+
+    // Without a row index, the whole stripe is a single row group
+    const StripeInformation& info = stripes_[stripe];
+    const auto num_rows = static_cast<int64_t>(info.num_rows);
+    const int64_t stride = RowIndexStride() > 0 ? RowIndexStride() : num_rows;
+    int64_t total_rows = 0;
+    int64_t end = 0;
+    for (int row_group : row_groups) {
+      const int64_t start = row_group * stride;
+      ARROW_RETURN_IF(row_group < 0 || start >= num_rows,
+                      Status::Invalid("Out of bounds row group: ", row_group));
+      ARROW_RETURN_IF(start < end, Status::Invalid("Row groups must be increasing"));
+      end = std::min(start + stride, num_rows);
+      total_rows += end - start;
+    }
+
+    std::unique_ptr<liborc::RowReader> row_reader;
+    RETURN_NOT_OK(CreateRowReader(opts, &row_reader));
+    std::unique_ptr<RecordBatchBuilder> builder;
+    RETURN_NOT_OK(RecordBatchBuilder::Make(schema, pool_, total_rows, &builder));
+
+    int64_t position = 0;
+    for (int row_group : row_groups) {
+      const int64_t start = row_group * stride;
+      if (start != position) {
+        try {
+          row_reader->seekToRow(info.first_row_of_stripe + start);
+        } catch (const liborc::ParseError& e) {
+          return Status::Invalid(e.what());
+        }
+      }
+      const int64_t length = std::min(stride, num_rows - start);
+      RETURN_NOT_OK(AppendRows(row_reader.get(), length, builder.get()));
+      position = start + length;
+    }
+    return builder->Flush(out);
+  }
+
+  // Append the next nrows rows of the row reader, which must be in the
+  // current stripe
+  Status AppendRows(liborc::RowReader* row_reader, int64_t nrows,
+                    RecordBatchBuilder* builder) {
+    const liborc::Type& type = row_reader->getSelectedType();
+    std::unique_ptr<liborc::ColumnVectorBatch> batch;
+    while (nrows > 0) {
+      // Reading stops at the end of the batch capacity
+      const int64_t batch_size = std::min(nrows, kReadRowsBatch);
+      try {
+        if (batch == nullptr || static_cast<int64_t>(batch->capacity) != batch_size) {
+          batch = row_reader->createRowBatch(batch_size);
+        }
+        if (!row_reader->next(*batch)) {
+          return Status::IOError("Unexpected end of ORC stripe");
+        }
+      } catch (const liborc::ParseError& e) {
+        return Status::Invalid(e.what());
+      }
+      // The top-level type must be a struct to read into an arrow table
+      const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
+      for (int i = 0; i < builder->num_fields(); i++) {
+        RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
+                                  batch->numElements, builder->GetField(i)));
+      }
+      nrows -= static_cast<int64_t>(batch->numElements);
+    }
+    return Status::OK();
+  }
+
   Status SelectStripe(liborc::RowReaderOptions* opts, int64_t stripe) {
     ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
                     Status::Invalid("Out of bounds stripe: ", stripe));
@@ -329,21 +680,46 @@ class ORCFileReader::Impl {
   Status ReadTable(const liborc::RowReaderOptions& row_opts,
                    const std::shared_ptr<Schema>& schema, std::shared_ptr<Table>* out) {
     liborc::RowReaderOptions opts(row_opts);
-    std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
-    for (size_t stripe = 0; stripe < stripes_.size(); stripe++) {
+    const int num_stripes = static_cast<int>(stripes_.size());
+    // Each stripe has its own row reader, so that stripes can be decoded and
+    // converted concurrently. The row readers are created serially as liborc
+    // doesn't guarantee that createRowReader is thread-safe.
+    std::vector<std::unique_ptr<liborc::RowReader>> row_readers(num_stripes);
+    for (int stripe = 0; stripe < num_stripes; stripe++) {
       opts.range(stripes_[stripe].offset, stripes_[stripe].length);
-      RETURN_NOT_OK(ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]));
+      RETURN_NOT_OK(CreateRowReader(opts, &row_readers[stripe]));
     }
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_stripes);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        use_threads_, num_stripes, [&](int stripe) {
+          return ReadBatch(row_readers[stripe].get(), schema, stripes_[stripe].num_rows,
+                           &batches[stripe]);
+        }));
     return Table::FromRecordBatches(schema, batches, out);
   }
 
+  Status CreateRowReader(const liborc::RowReaderOptions& opts,
+                         std::unique_ptr<liborc::RowReader>* out) {
+    try {
+      *out = reader_->createRowReader(opts);
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+    return Status::OK();
+  }
+
   Status ReadBatch(const liborc::RowReaderOptions& opts,
                    const std::shared_ptr<Schema>& schema, int64_t nrows,
                    std::shared_ptr<RecordBatch>* out) {
     std::unique_ptr<liborc::RowReader> row_reader;
+    RETURN_NOT_OK(CreateRowReader(opts, &row_reader));
+    return ReadBatch(row_reader.get(), schema, nrows, out);
+  }
+
+  Status ReadBatch(liborc::RowReader* row_reader, const std::shared_ptr<Schema>& schema,
+                   int64_t nrows, std::shared_ptr<RecordBatch>* out) {
     std::unique_ptr<liborc::ColumnVectorBatch> batch;
     try {
-      row_reader = reader_->createRowReader(opts);
       batch = row_reader->createRowBatch(std::min(nrows, kReadRowsBatch));
     } catch (const liborc::ParseError& e) {
       return Status::Invalid(e.what());
@@ -355,7 +731,15 @@ class ORCFileReader::Impl {
     const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
 
     const liborc::Type& type = row_reader->getSelectedType();
-    while (row_reader->next(*batch)) {
+    while (true) {
+      // Don't let exceptions escape, this may run on a thread pool
+      try {
+        if (!row_reader->next(*batch)) {
+          break;
+        }
+      } catch (const liborc::ParseError& e) {
+        return Status::Invalid(e.what());
+      }
       for (int i = 0; i < builder->num_fields(); i++) {
         RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
                                   batch->numElements, builder->GetField(i)));
@@ -406,8 +790,48 @@ class ORCFileReader::Impl {
     return NextStripeReader(batch_size, {}, out);
   }
 
+  Status GetPrefetchingReader(int64_t batch_size, int num_prefetch_stripes,
+                              const std::vector<int>& include_indices,
+                              std::shared_ptr<RecordBatchReader>* out) {
+    ARROW_RETURN_IF(num_prefetch_stripes < 1,
+                    Status::Invalid("At least one stripe must be prefetched"));
+    liborc::RowReaderOptions opts;
+    if (!include_indices.empty()) {
+      RETURN_NOT_OK(SelectIndices(&opts, include_indices));
+    }
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+
+    std::vector<std::unique_ptr<liborc::RowReader>> row_readers;
+    for (const auto& stripe : stripes_) {
+      const int64_t first_row = static_cast<int64_t>(stripe.first_row_of_stripe);
+      if (first_row + static_cast<int64_t>(stripe.num_rows) <= current_row_) {
+        continue;
+      }
+      opts.range(stripe.offset, stripe.length);
+      std::unique_ptr<liborc::RowReader> row_reader;
+      RETURN_NOT_OK(CreateRowReader(opts, &row_reader));
+      if (current_row_ > first_row) {
+        try {
+          row_reader->seekToRow(current_row_);
+        } catch (const liborc::ParseError& e) {
+          return Status::Invalid(e.what());
+        }
+      }
+      row_readers.push_back(std::move(row_reader));
+    }
+    current_row_ = NumberOfRows();
+
+    *out = std::make_shared<OrcPrefetchingReader>(
+        std::move(row_readers), schema, batch_size, num_prefetch_stripes, pool_);
+    return Status::OK();
+  }
+
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
  private:
   MemoryPool* pool_;
+  bool use_threads_;
   std::unique_ptr<liborc::Reader> reader_;
   std::vector<StripeInformation> stripes_;
   int64_t current_row_;
@@ -456,6 +880,23 @@ Status ORCFileReader::ReadStripe(int64_t stripe, const std::vector<int>& include
   return impl_->ReadStripe(stripe, include_indices, out);
 }
 
+Status ORCFileReader::ReadStripeRowGroups(int64_t stripe,
+                                          const std::vector<int>& row_groups,
+                                          const std::vector<int>& include_indices,
+                                          std::shared_ptr<RecordBatch>* out) {
+  return impl_->ReadStripeRowGroups(stripe, row_groups, include_indices, out);
+}
+
+Status ORCFileReader::ReadStripeStatistics(int64_t stripe,
+                                           std::vector<ORCColumnStatistics>* out) {
+  return impl_->ReadStripeStatistics(stripe, out);
+}
+
+Status ORCFileReader::ReadRowGroupStatistics(
+    int64_t stripe, std::vector<std::vector<ORCColumnStatistics>>* out) {
+  return impl_->ReadRowGroupStatistics(stripe, out);
+}
+
 Status ORCFileReader::Seek(int64_t row_number) { return impl_->Seek(row_number); }
 
 Status ORCFileReader::NextStripeReader(int64_t batch_sizes,
@@ -469,10 +910,172 @@ Status ORCFileReader::NextStripeReader(int64_t batch_size,
   return impl_->NextStripeReader(batch_size, include_indices, out);
 }
 
+Status ORCFileReader::GetPrefetchingReader(int64_t batch_size,
+                                           int num_prefetch_stripes,
+                                           const std::vector<int>& include_indices,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  return impl_->GetPrefetchingReader(batch_size, num_prefetch_stripes, include_indices,
+                                     out);
+}
+
+void ORCFileReader::set_use_threads(bool use_threads) {
+  impl_->set_use_threads(use_threads);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+int64_t ORCFileReader::NumberOfRowsInStripe(int64_t stripe) {
+  return impl_->NumberOfRowsInStripe(stripe);
+}
+
+int64_t ORCFileReader::RowIndexStride() { return impl_->RowIndexStride(); }
+
+static Status GetORCCompression(Compression::type compression,
+                                liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    case Compression::LZO:
+      *out = liborc::CompressionKind_LZO;
+      break;
+    default:
+      return Status::NotImplemented("Compression ", static_cast<int>(compression),
+                                    " is not supported by ORC");
+  }
+  return Status::OK();
+}
+
+class ORCFileWriter::Impl {
+ public:
+  Status Open(io::OutputStream* output_stream, const std::shared_ptr<Schema>& schema,
+              const ORCWriteOptions& options) {
+    ARROW_RETURN_IF(options.batch_size <= 0,
+                    Status::Invalid("ORC write batch size must be positive"));
+    std::unique_ptr<liborc::Type> type;
+    RETURN_NOT_OK(GetORCType(*struct_(schema->fields()), &type));
+
+    liborc::WriterOptions orc_options;
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetORCCompression(options.compression, &compression));
+    orc_options.setCompression(compression);
+    orc_options.setStripeSize(static_cast<uint64_t>(options.stripe_size));
+    orc_options.setCompressionBlockSize(
+        static_cast<uint64_t>(options.compression_block_size));
+    orc_options.setRowIndexStride(static_cast<uint64_t>(options.row_index_stride));
+
+    // The liborc writer keeps references to the type and the stream
+    type_ = std::move(type);
+    output_stream_.reset(new ArrowOutputStream(output_stream));
+    try {
+      writer_ = liborc::createWriter(*type_, output_stream_.get(), orc_options);
+      batch_ = writer_->createRowBatch(static_cast<uint64_t>(options.batch_size));
+    } catch (const liborc::NotImplementedYet& e) {
+      return Status::NotImplemented(e.what());
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    schema_ = schema;
+    options_ = options;
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    ARROW_RETURN_IF(!batch.schema()->Equals(*schema_, /*check_metadata=*/false),
+                    Status::Invalid("Record batch schema does not match the schema of "
+                                    "the ORC writer"));
+    auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch_);
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      const int64_t length = std::min(options_.batch_size, batch.num_rows() - offset);
+      // Each column has its own child batch, so they are converted independently
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          options_.use_threads, batch.num_columns(), [&](int i) {
+            return WriteBatch(*batch.column(i)->Slice(offset, length),
+                              struct_batch.fields[i]);
+          }));
+      struct_batch.numElements = static_cast<uint64_t>(length);
+      struct_batch.hasNulls = false;
+      try {
+        writer_->add(*batch_);
+      } catch (const liborc::NotImplementedYet& e) {
+        return Status::NotImplemented(e.what());
+      } catch (const liborc::ParseError& e) {
+        return Status::IOError(e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Write(const Table& table) {
+    ARROW_RETURN_IF(!table.schema()->Equals(*schema_, /*check_metadata=*/false),
+                    Status::Invalid("Table schema does not match the schema of the ORC "
+                                    "writer"));
+    TableBatchReader reader(table);
+    reader.set_chunksize(options_.batch_size);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(Write(*batch));
+    }
+  }
+
+  Status Close() {
+    try {
+      writer_->close();
+    } catch (const liborc::NotImplementedYet& e) {
+      return Status::NotImplemented(e.what());
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  ORCWriteOptions options_;
+  std::unique_ptr<liborc::Type> type_;
+  std::unique_ptr<ArrowOutputStream> output_stream_;
+  std::unique_ptr<liborc::Writer> writer_;
+  std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(io::OutputStream* output_stream,
+                           const std::shared_ptr<Schema>& schema,
+                           const ORCWriteOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(output_stream, schema, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Write(const Table& table) { return impl_->Write(table); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
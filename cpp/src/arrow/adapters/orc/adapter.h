@@ -25,8 +25,10 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -35,6 +37,18 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief Statistics of a top-level field in a stripe or a row group
+struct ARROW_EXPORT ORCColumnStatistics {
+  /// The number of non-null values
+  int64_t num_values = 0;
+  /// Whether there are null values
+  bool has_null = true;
+  /// The minimum and maximum values, null if unknown or not supported for the
+  /// field's type
+  std::shared_ptr<Scalar> min;
+  std::shared_ptr<Scalar> max;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -102,6 +116,34 @@ class ARROW_EXPORT ORCFileReader {
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
                     std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Read some row groups of a single stripe as a RecordBatch
+  ///
+  /// Row groups are the runs of RowIndexStride() rows of a stripe. Only the
+  /// selected row groups are decoded, using the row index to seek to them.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] row_groups the indices of the row groups to read, increasing
+  /// \param[in] include_indices the selected field indices to read, all if empty
+  /// \param[out] out the returned RecordBatch
+  Status ReadStripeRowGroups(int64_t stripe, const std::vector<int>& row_groups,
+                             const std::vector<int>& include_indices,
+                             std::shared_ptr<RecordBatch>* out);
+
+  /// \brief Read the statistics of the top-level fields in a stripe
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[out] out the statistics, one per top-level field of the file schema
+  Status ReadStripeStatistics(int64_t stripe, std::vector<ORCColumnStatistics>* out);
+
+  /// \brief Read the statistics of the top-level fields in each row group of a
+  /// stripe, from its row index
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[out] out the statistics of each row group, one per top-level field
+  /// of the file schema. Empty if the file has no row index.
+  Status ReadRowGroupStatistics(int64_t stripe,
+                                std::vector<std::vector<ORCColumnStatistics>>* out);
+
   /// \brief Seek to designated row. Invoke NextStripeReader() after seek
   ///        will return stripe reader starting from designated row.
   ///
@@ -131,18 +173,106 @@ class ARROW_EXPORT ORCFileReader {
   Status NextStripeReader(int64_t batch_size, const std::vector<int>& include_indices,
                           std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Get a record batch iterator over the rows from the current row to
+  ///        the end of the file, which decodes stripes ahead on the CPU thread
+  ///        pool.
+  ///
+  /// Up to num_prefetch_stripes stripes are decoded concurrently ahead of the
+  /// consumer, so that reading overlaps with the processing of the batches.
+  /// The decoded stripes are held in memory until consumed. The current row
+  /// is moved to the end of the file.
+  ///
+  /// \param[in] batch_size the number of rows each record batch contains
+  /// \param[in] num_prefetch_stripes the number of stripes decoded ahead
+  /// \param[in] include_indices the selected field indices to read, all if empty
+  /// \param[out] out the returned reader
+  Status GetPrefetchingReader(int64_t batch_size, int num_prefetch_stripes,
+                              const std::vector<int>& include_indices,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Set whether to read the stripes concurrently in the Read methods
+  ///
+  /// Each stripe is then decoded and converted on the CPU thread pool. The
+  /// resulting Table still has one chunk per stripe, in file order. By default
+  /// stripes are read serially.
+  void set_use_threads(bool use_threads);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
   /// \brief The number of rows in the file
   int64_t NumberOfRows();
 
+  /// \brief The number of rows in a stripe
+  int64_t NumberOfRowsInStripe(int64_t stripe);
+
+  /// \brief The number of rows in each row group of a stripe, 0 if the file has
+  /// no row index
+  int64_t RowIndexStride();
+
  private:
   class Impl;
   std::unique_ptr<Impl> impl_;
   ORCFileReader();
 };
 
+/// \brief Options for writing ORC files
+struct ARROW_EXPORT ORCWriteOptions {
+  /// The number of rows converted and handed to liborc at a time
+  int64_t batch_size = 64 * 1024;
+  /// The size of a stripe in bytes, before compression
+  int64_t stripe_size = 64 * 1024 * 1024;
+  /// The compression of the file: UNCOMPRESSED, GZIP (ORC's ZLIB), SNAPPY, LZ4,
+  /// ZSTD or LZO, as far as supported by liborc
+  Compression::type compression = Compression::GZIP;
+  /// The size of a compression block in bytes
+  int64_t compression_block_size = 64 * 1024;
+  /// The number of rows between the entries of the row index, 0 for no index
+  int64_t row_index_stride = 10000;
+  /// Whether to convert the columns of each batch concurrently on the CPU
+  /// thread pool
+  bool use_threads = false;
+
+  static ORCWriteOptions Defaults() { return ORCWriteOptions(); }
+};
+
+/// \class ORCFileWriter
+/// \brief Write an Arrow Table or RecordBatch to an ORC file.
+///
+/// The values of the columns are converted to liborc batches. String and
+/// binary values are passed to liborc without being copied.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Creates a new ORC writer.
+  ///
+  /// \param[in] output_stream the destination, which must stay open until
+  /// Close() returns. It isn't closed by the writer.
+  /// \param[in] schema the schema of the written data
+  /// \param[in] options the options of the file
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(io::OutputStream* output_stream,
+                     const std::shared_ptr<Schema>& schema,
+                     const ORCWriteOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Write a RecordBatch with the schema of the writer
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write a Table with the schema of the writer
+  Status Write(const Table& table);
+
+  /// \brief Flush the last stripe and write the file footer
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
@@ -20,6 +20,8 @@
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/array.h"
 #include "arrow/io/api.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
 
 #include <gtest/gtest.h>
 #include <orc/OrcFile.hh>
@@ -156,5 +158,104 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     }
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
+
+  // read the whole file, serially and with stripes read concurrently
+  std::shared_ptr<Table> table, threaded_table;
+  ASSERT_TRUE(reader->Read(&table).ok());
+  reader->set_use_threads(true);
+  ASSERT_TRUE(reader->Read(&threaded_table).ok());
+  ASSERT_EQ(stripe_row_count * stripe_count, threaded_table->num_rows());
+  ASSERT_EQ(stripe_count, threaded_table->column(0)->num_chunks());
+  ASSERT_TRUE(threaded_table->Equals(*table));
+
+  // read from a row to the end of the file, with stripes decoded ahead
+  const int64_t first_row = stripe_row_count + 830;
+  for (int num_prefetch_stripes : {1, 4}) {
+    ASSERT_OK(reader->Seek(first_row));
+    std::shared_ptr<RecordBatchReader> prefetching_reader;
+    ASSERT_OK(reader->GetPrefetchingReader(reader_batch_size, num_prefetch_stripes, {},
+                                           &prefetching_reader));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    ASSERT_OK(prefetching_reader->ReadAll(&batches));
+    for (const auto& prefetched_batch : batches) {
+      ASSERT_LE(prefetched_batch->num_rows(), static_cast<int64_t>(reader_batch_size));
+    }
+    std::shared_ptr<Table> prefetched;
+    ASSERT_OK(Table::FromRecordBatches(table->schema(), batches, &prefetched));
+    ASSERT_TRUE(prefetched->Equals(*table->Slice(first_row)));
+
+    // the whole file was consumed
+    ASSERT_OK(reader->NextStripeReader(reader_batch_size, &stripe_reader));
+    ASSERT_EQ(stripe_reader, nullptr);
+  }
+}
+
+TEST(TestAdapterWrite, RoundTrip) {
+  auto table_schema = schema({field("bool", boolean()),
+                              field("int8", int8()),
+                              field("int16", int16()),
+                              field("int32", int32()),
+                              field("int64", int64()),
+                              field("float", float32()),
+                              field("double", float64()),
+                              field("string", utf8()),
+                              field("binary", binary()),
+                              field("date32", date32()),
+                              field("timestamp", timestamp(TimeUnit::NANO)),
+                              field("decimal64", decimal(10, 2)),
+                              field("decimal128", decimal(25, 3)),
+                              field("list", list(int32())),
+                              field("struct", struct_({field("a", int64()),
+                                                       field("b", utf8())}))});
+  auto table = TableFromJSON(table_schema, {R"([
+    {"bool": true, "int8": 1, "int16": -2, "int32": 3, "int64": -4, "float": 1.5,
+     "double": -2.25, "string": "a", "binary": "b", "date32": 1, "timestamp": 1,
+     "decimal64": "1.25", "decimal128": "-12345678901234567890.123",
+     "list": [1, null], "struct": {"a": 1, "b": "x"}},
+    {"bool": null, "int8": null, "int16": null, "int32": null, "int64": null,
+     "float": null, "double": null, "string": null, "binary": null, "date32": null,
+     "timestamp": null, "decimal64": null, "decimal128": null, "list": null,
+     "struct": null}
+  ])",
+                                            R"([
+    {"bool": false, "int8": -128, "int16": 32767, "int32": -7, "int64": 8,
+     "float": -0.5, "double": 1e100, "string": "", "binary": "bytes", "date32": -1,
+     "timestamp": 1500000000123456789, "decimal64": "-0.01", "decimal128": "0.001",
+     "list": [], "struct": {"a": null, "b": "y"}}
+  ])"});
+
+  adapters::orc::ORCWriteOptions options;
+  // Convert the batches in several steps, on the thread pool
+  options.batch_size = 2;
+  options.use_threads = true;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+  ASSERT_OK(
+      adapters::orc::ORCFileWriter::Open(sink.get(), table_schema, options, &writer));
+  ASSERT_OK(writer->Write(*table));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_OK(adapters::orc::ORCFileReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                              default_memory_pool(), &reader));
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(reader->Read(&actual));
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(TestAdapterWrite, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+  auto options = adapters::orc::ORCWriteOptions::Defaults();
+  ASSERT_RAISES(NotImplemented,
+                adapters::orc::ORCFileWriter::Open(
+                    sink.get(), schema({field("u", uint8())}), options, &writer));
+
+  auto table_schema = schema({field("i", int32())});
+  ASSERT_OK(
+      adapters::orc::ORCFileWriter::Open(sink.get(), table_schema, options, &writer));
+  auto batch = RecordBatchFromJSON(schema({field("i", int64())}), "[[1]]");
+  ASSERT_RAISES(Invalid, writer->Write(*batch));
 }
 }  // namespace arrow
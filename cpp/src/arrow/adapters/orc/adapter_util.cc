@@ -15,10 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 #include "arrow/adapters/orc/adapter_util.h"
+#include "arrow/array.h"
 #include "arrow/array/builder_base.h"
 #include "arrow/builder.h"
 #include "arrow/status.h"
@@ -43,6 +45,9 @@ using internal::checked_cast;
 // The numer of nanoseconds in a second
 constexpr int64_t kOneSecondNanos = 1000000000LL;
 
+// The number of milliseconds in a day
+constexpr int64_t kOneDayMillis = 86400000LL;
+
 Status AppendStructBatch(const liborc::Type* type, liborc::ColumnVectorBatch* cbatch,
                          int64_t offset, int64_t length, ArrayBuilder* abuilder) {
   auto builder = checked_cast<StructBuilder*>(abuilder);
@@ -423,6 +428,300 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   return Status::OK();
 }
 
+// Arrow to ORC conversion
+
+// Grow batch to the length of array and set its validity
+void PrepareBatch(const Array& array, liborc::ColumnVectorBatch* batch) {
+  const auto length = static_cast<uint64_t>(array.length());
+  if (batch->capacity < length) {
+    batch->resize(length);
+  }
+  batch->numElements = length;
+  batch->hasNulls = array.null_count() > 0;
+  if (batch->hasNulls) {
+    for (int64_t i = 0; i < array.length(); i++) {
+      batch->notNull[i] = array.IsValid(i);
+    }
+  }
+}
+
+template <class array_type, class batch_type>
+Status WriteNumericBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& numeric_array = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<batch_type*>(cbatch);
+  // A plain memory copy when the layouts match, e.g. for int64 and double
+  const auto* values = numeric_array.raw_values();
+  std::copy(values, values + array.length(), batch->data.data());
+  return Status::OK();
+}
+
+Status WriteBoolBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& bool_array = checked_cast<const BooleanArray&>(array);
+  auto batch = checked_cast<liborc::LongVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < array.length(); i++) {
+    batch->data[i] = bool_array.Value(i);
+  }
+  return Status::OK();
+}
+
+Status WriteDate64Batch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& date_array = checked_cast<const Date64Array&>(array);
+  auto batch = checked_cast<liborc::LongVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < array.length(); i++) {
+    batch->data[i] = date_array.Value(i) / kOneDayMillis;
+  }
+  return Status::OK();
+}
+
+Status WriteTimestampBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& timestamp_array = checked_cast<const TimestampArray&>(array);
+  auto batch = checked_cast<liborc::TimestampVectorBatch*>(cbatch);
+
+  int64_t units_per_second = 1;
+  switch (checked_cast<const TimestampType&>(*array.type()).unit()) {
+    case TimeUnit::SECOND:
+      units_per_second = 1;
+      break;
+    case TimeUnit::MILLI:
+      units_per_second = 1000;
+      break;
+    case TimeUnit::MICRO:
+      units_per_second = 1000000;
+      break;
+    case TimeUnit::NANO:
+      units_per_second = kOneSecondNanos;
+      break;
+  }
+
+  for (int64_t i = 0; i < array.length(); i++) {
+    const int64_t value = timestamp_array.Value(i);
+    int64_t seconds = value / units_per_second;
+    int64_t units = value % units_per_second;
+    // The nanoseconds are positive, even before the epoch
+    if (units < 0) {
+      seconds -= 1;
+      units += units_per_second;
+    }
+    batch->data[i] = seconds;
+    batch->nanoseconds[i] = units * (kOneSecondNanos / units_per_second);
+  }
+  return Status::OK();
+}
+
+template <class array_type>
+Status WriteBinaryBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& binary_array = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < array.length(); i++) {
+    typename array_type::offset_type length = 0;
+    const uint8_t* value = binary_array.GetValue(i, &length);
+    batch->data[i] = reinterpret_cast<char*>(const_cast<uint8_t*>(value));
+    batch->length[i] = length;
+  }
+  return Status::OK();
+}
+
+Status WriteFixedBinaryBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& binary_array = checked_cast<const FixedSizeBinaryArray&>(array);
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < array.length(); i++) {
+    const uint8_t* value = binary_array.GetValue(i);
+    batch->data[i] = reinterpret_cast<char*>(const_cast<uint8_t*>(value));
+    batch->length[i] = binary_array.byte_width();
+  }
+  return Status::OK();
+}
+
+Status WriteDecimalBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& decimal_array = checked_cast<const Decimal128Array&>(array);
+  const auto& type = checked_cast<const Decimal128Type&>(*array.type());
+  if (type.precision() > 18) {
+    auto batch = checked_cast<liborc::Decimal128VectorBatch*>(cbatch);
+    batch->precision = type.precision();
+    batch->scale = type.scale();
+    for (int64_t i = 0; i < array.length(); i++) {
+      const Decimal128 value(decimal_array.GetValue(i));
+      batch->values[i] = liborc::Int128(value.high_bits(), value.low_bits());
+    }
+  } else {
+    auto batch = checked_cast<liborc::Decimal64VectorBatch*>(cbatch);
+    batch->precision = type.precision();
+    batch->scale = type.scale();
+    for (int64_t i = 0; i < array.length(); i++) {
+      const Decimal128 value(decimal_array.GetValue(i));
+      batch->values[i] = static_cast<int64_t>(value.low_bits());
+    }
+  }
+  return Status::OK();
+}
+
+Status WriteStructBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& struct_array = checked_cast<const StructArray&>(array);
+  auto batch = checked_cast<liborc::StructVectorBatch*>(cbatch);
+  for (int i = 0; i < struct_array.num_fields(); i++) {
+    RETURN_NOT_OK(WriteBatch(*struct_array.field(i), batch->fields[i]));
+  }
+  return Status::OK();
+}
+
+// Set the offsets of a list or map batch, relative to the first offset of the
+// array, and return the range of the values
+template <class array_type>
+void WriteOffsets(const array_type& array, liborc::DataBuffer<int64_t>* offsets,
+                  int64_t* values_offset, int64_t* values_length) {
+  *values_offset = array.length() > 0 ? array.value_offset(0) : 0;
+  for (int64_t i = 0; i <= array.length(); i++) {
+    (*offsets)[i] = array.length() > 0 ? array.value_offset(i) - *values_offset : 0;
+  }
+  *values_length = (*offsets)[array.length()];
+}
+
+template <class array_type>
+Status WriteListBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& list_array = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<liborc::ListVectorBatch*>(cbatch);
+  int64_t values_offset, values_length;
+  WriteOffsets(list_array, &batch->offsets, &values_offset, &values_length);
+  return WriteBatch(*list_array.values()->Slice(values_offset, values_length),
+                    batch->elements.get());
+}
+
+Status WriteMapBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& map_array = checked_cast<const MapArray&>(array);
+  auto batch = checked_cast<liborc::MapVectorBatch*>(cbatch);
+  int64_t values_offset, values_length;
+  WriteOffsets(map_array, &batch->offsets, &values_offset, &values_length);
+  RETURN_NOT_OK(WriteBatch(*map_array.keys()->Slice(values_offset, values_length),
+                           batch->keys.get()));
+  return WriteBatch(*map_array.items()->Slice(values_offset, values_length),
+                    batch->elements.get());
+}
+
+Status WriteBatch(const Array& array, liborc::ColumnVectorBatch* batch) {
+  PrepareBatch(array, batch);
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return WriteBoolBatch(array, batch);
+    case Type::INT8:
+      return WriteNumericBatch<Int8Array, liborc::LongVectorBatch>(array, batch);
+    case Type::INT16:
+      return WriteNumericBatch<Int16Array, liborc::LongVectorBatch>(array, batch);
+    case Type::INT32:
+      return WriteNumericBatch<Int32Array, liborc::LongVectorBatch>(array, batch);
+    case Type::INT64:
+      return WriteNumericBatch<Int64Array, liborc::LongVectorBatch>(array, batch);
+    case Type::FLOAT:
+      return WriteNumericBatch<FloatArray, liborc::DoubleVectorBatch>(array, batch);
+    case Type::DOUBLE:
+      return WriteNumericBatch<DoubleArray, liborc::DoubleVectorBatch>(array, batch);
+    case Type::DATE32:
+      return WriteNumericBatch<Date32Array, liborc::LongVectorBatch>(array, batch);
+    case Type::DATE64:
+      return WriteDate64Batch(array, batch);
+    case Type::TIMESTAMP:
+      return WriteTimestampBatch(array, batch);
+    case Type::STRING:
+      return WriteBinaryBatch<StringArray>(array, batch);
+    case Type::LARGE_STRING:
+      return WriteBinaryBatch<LargeStringArray>(array, batch);
+    case Type::BINARY:
+      return WriteBinaryBatch<BinaryArray>(array, batch);
+    case Type::LARGE_BINARY:
+      return WriteBinaryBatch<LargeBinaryArray>(array, batch);
+    case Type::FIXED_SIZE_BINARY:
+      return WriteFixedBinaryBatch(array, batch);
+    case Type::DECIMAL:
+      return WriteDecimalBatch(array, batch);
+    case Type::STRUCT:
+      return WriteStructBatch(array, batch);
+    case Type::LIST:
+      return WriteListBatch<ListArray>(array, batch);
+    case Type::LARGE_LIST:
+      return WriteListBatch<LargeListArray>(array, batch);
+    case Type::MAP:
+      return WriteMapBatch(array, batch);
+    default:
+      return Status::NotImplemented("Cannot write array of type ", *array.type(),
+                                    " to ORC");
+  }
+}
+
+Status GetORCType(const DataType& type, std::unique_ptr<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::DATE32:
+    case Type::DATE64:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::STRING:
+    case Type::LARGE_STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+    case Type::LARGE_BINARY:
+    case Type::FIXED_SIZE_BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(static_cast<uint64_t>(decimal_type.precision()),
+                                       static_cast<uint64_t>(decimal_type.scale()));
+      break;
+    }
+    case Type::STRUCT: {
+      *out = liborc::createStructType();
+      for (const auto& field : type.children()) {
+        std::unique_ptr<liborc::Type> field_type;
+        RETURN_NOT_OK(GetORCType(*field->type(), &field_type));
+        (*out)->addStructField(field->name(), std::move(field_type));
+      }
+      break;
+    }
+    case Type::LIST:
+    case Type::LARGE_LIST: {
+      std::unique_ptr<liborc::Type> value_type;
+      RETURN_NOT_OK(GetORCType(*type.child(0)->type(), &value_type));
+      *out = liborc::createListType(std::move(value_type));
+      break;
+    }
+    case Type::MAP: {
+      const auto& map_type = checked_cast<const MapType&>(type);
+      std::unique_ptr<liborc::Type> key_type;
+      std::unique_ptr<liborc::Type> item_type;
+      RETURN_NOT_OK(GetORCType(*map_type.key_type(), &key_type));
+      RETURN_NOT_OK(GetORCType(*map_type.item_type(), &item_type));
+      *out = liborc::createMapType(std::move(key_type), std::move(item_type));
+      break;
+    }
+    default:
+      return Status::NotImplemented("Unsupported Arrow type for ORC: ", type);
+  }
+  return Status::OK();
+}
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
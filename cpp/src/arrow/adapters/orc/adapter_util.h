@@ -36,6 +36,16 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out);
 
 Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
                    int64_t offset, int64_t length, ArrayBuilder* builder);
+
+/// \brief Get the ORC type of an Arrow type
+Status GetORCType(const DataType& type, std::unique_ptr<liborc::Type>* out);
+
+/// \brief Fill a ColumnVectorBatch of the ORC type of the array with its values
+///
+/// The batch is grown to the length of the array if needed. String and binary
+/// values aren't copied: the batch points to the array's data, which must stay
+/// alive until the batch has been written.
+Status WriteBatch(const Array& array, liborc::ColumnVectorBatch* batch);
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
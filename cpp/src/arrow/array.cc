@@ -93,6 +93,80 @@ std::shared_ptr<ArrayData> ArrayData::Make(const std::shared_ptr<DataType>& type
   return std::make_shared<ArrayData>(type, length, null_count, offset);
 }
 
+namespace internal {
+
+// Counts of the set bits in the whole blocks of a range of a bitmap, each
+// computed the first time it's needed
+class ValidityBlockCounts {
+ public:
+  static constexpr int64_t kBlockBits = 4096;
+
+  ValidityBlockCounts(const std::shared_ptr<Buffer>& bitmap, int64_t offset,
+                      int64_t length)
+      : bitmap_buffer_(bitmap),
+        bitmap_(bitmap->data()),
+        begin_(offset),
+        end_(offset + length),
+        first_block_(BitUtil::CeilDiv(offset, kBlockBits)),
+        end_block_(std::max(first_block_, end_ / kBlockBits)),
+        counts_(new std::atomic<int32_t>[end_block_ - first_block_]) {
+    for (int64_t i = 0; i < end_block_ - first_block_; ++i) {
+      counts_[i].store(-1, std::memory_order_relaxed);
+    }
+  }
+
+  // Whether these are counts of the bitmap covering the given range.  The buffer
+  // is compared by ownership rather than by address, as a new bitmap may be
+  // allocated where a freed one was
+  bool Covers(const std::shared_ptr<Buffer>& bitmap, int64_t offset,
+              int64_t length) const {
+    return !bitmap_buffer_.owner_before(bitmap) && !bitmap.owner_before(bitmap_buffer_) &&
+           bitmap->data() == bitmap_ && offset >= begin_ && offset + length <= end_;
+  }
+
+  // Count the set bits in a covered range
+  int64_t Count(int64_t offset, int64_t length) {
+    const int64_t end = offset + length;
+    int64_t block = BitUtil::CeilDiv(offset, kBlockBits);
+    const int64_t end_block = end / kBlockBits;
+    if (block >= end_block) {
+      return CountSetBits(bitmap_, offset, length);
+    }
+    int64_t count = CountSetBits(bitmap_, offset, block * kBlockBits - offset) +
+                    CountSetBits(bitmap_, end_block * kBlockBits,
+                                 end - end_block * kBlockBits);
+    for (; block < end_block; ++block) {
+      count += BlockCount(block);
+    }
+    return count;
+  }
+
+ private:
+  int32_t BlockCount(int64_t block) {
+    std::atomic<int32_t>& slot = counts_[block - first_block_];
+    int32_t count = slot.load(std::memory_order_relaxed);
+    if (count < 0) {
+      count = static_cast<int32_t>(
+          CountSetBits(bitmap_, block * kBlockBits, kBlockBits));
+      slot.store(count, std::memory_order_relaxed);
+    }
+    return count;
+  }
+
+  // Not owning, so that the counts don't keep a replaced bitmap alive
+  const std::weak_ptr<Buffer> bitmap_buffer_;
+  const uint8_t* bitmap_;
+  const int64_t begin_, end_;
+  const int64_t first_block_, end_block_;
+  std::unique_ptr<std::atomic<int32_t>[]> counts_;
+};
+
+}  // namespace internal
+
+// Slices of arrays at least this long share counts of their validity bitmap
+static constexpr int64_t kMinBlockCountedLength =
+    16 * internal::ValidityBlockCounts::kBlockBits;
+
 ArrayData ArrayData::Slice(int64_t off, int64_t len) const {
   ARROW_CHECK_LE(off, length) << "Slice offset greater than array length";
   len = std::min(length - off, len);
@@ -102,6 +176,17 @@ ArrayData ArrayData::Slice(int64_t off, int64_t len) const {
   copy.length = len;
   copy.offset = off;
   copy.null_count = null_count != 0 ? kUnknownNullCount : 0;
+
+  if (null_count != 0 && length >= kMinBlockCountedLength && !buffers.empty() &&
+      buffers[0]) {
+    const auto& bitmap = buffers[0];
+    auto counts = internal::atomic_load(&validity_counts);
+    if (!counts || !counts->Covers(bitmap, offset, length)) {
+      counts = std::make_shared<internal::ValidityBlockCounts>(bitmap, offset, length);
+      internal::atomic_store(&validity_counts, counts);
+    }
+    copy.validity_counts = std::move(counts);
+  }
   return copy;
 }
 
@@ -109,8 +194,13 @@ int64_t ArrayData::GetNullCount() const {
   int64_t precomputed = this->null_count.load();
   if (ARROW_PREDICT_FALSE(precomputed == kUnknownNullCount)) {
     if (this->buffers[0]) {
-      precomputed = this->length -
-                    CountSetBits(this->buffers[0]->data(), this->offset, this->length);
+      const uint8_t* bitmap = this->buffers[0]->data();
+      auto counts = internal::atomic_load(&this->validity_counts);
+      if (counts && counts->Covers(this->buffers[0], this->offset, this->length)) {
+        precomputed = this->length - counts->Count(this->offset, this->length);
+      } else {
+        precomputed = this->length - CountSetBits(bitmap, this->offset, this->length);
+      }
     } else {
       precomputed = 0;
     }
@@ -390,10 +480,7 @@ void ListArray::SetData(const std::shared_ptr<ArrayData>& data,
   ARROW_CHECK_EQ(data->type->id(), expected_type_id);
   list_type_ = checked_cast<const ListType*>(data->type.get());
 
-  auto value_offsets = data->buffers[1];
-  raw_value_offsets_ = value_offsets == nullptr
-                           ? nullptr
-                           : reinterpret_cast<const offset_type*>(value_offsets->data());
+  raw_value_offsets_ = data->GetValuesSafe<offset_type>(1, /*offset=*/0);
 
   ARROW_CHECK_EQ(data_->child_data.size(), 1);
   ARROW_CHECK_EQ(list_type_->value_type()->id(), data->child_data[0]->type->id());
@@ -407,10 +494,7 @@ void LargeListArray::SetData(const std::shared_ptr<ArrayData>& data) {
   ARROW_CHECK_EQ(data->type->id(), Type::LARGE_LIST);
   list_type_ = checked_cast<const LargeListType*>(data->type.get());
 
-  auto value_offsets = data->buffers[1];
-  raw_value_offsets_ = value_offsets == nullptr
-                           ? nullptr
-                           : reinterpret_cast<const offset_type*>(value_offsets->data());
+  raw_value_offsets_ = data->GetValuesSafe<offset_type>(1, /*offset=*/0);
 
   ARROW_CHECK_EQ(data_->child_data.size(), 1);
   ARROW_CHECK_EQ(list_type_->value_type()->id(), data->child_data[0]->type->id());
@@ -819,14 +903,8 @@ void UnionArray::SetData(const std::shared_ptr<ArrayData>& data) {
   ARROW_CHECK_EQ(data->buffers.size(), 3);
   union_type_ = checked_cast<const UnionType*>(data_->type.get());
 
-  auto type_codes = data_->buffers[1];
-  auto value_offsets = data_->buffers[2];
-  raw_type_codes_ = type_codes == nullptr
-                        ? nullptr
-                        : reinterpret_cast<const int8_t*>(type_codes->data());
-  raw_value_offsets_ = value_offsets == nullptr
-                           ? nullptr
-                           : reinterpret_cast<const int32_t*>(value_offsets->data());
+  raw_type_codes_ = data->GetValuesSafe<int8_t>(1, /*offset=*/0);
+  raw_value_offsets_ = data->GetValuesSafe<int32_t>(2, /*offset=*/0);
   boxed_fields_.resize(data->child_data.size());
 }
 
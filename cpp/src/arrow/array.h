@@ -30,6 +30,7 @@
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/macros.h"
@@ -50,6 +51,12 @@ constexpr int64_t kUnknownNullCount = -1;
 class MemoryPool;
 class Status;
 
+namespace internal {
+
+class ValidityBlockCounts;
+
+}  // namespace internal
+
 // ----------------------------------------------------------------------
 // Generic array data container
 
@@ -150,7 +157,8 @@ struct ARROW_EXPORT ArrayData {
         offset(other.offset),
         buffers(std::move(other.buffers)),
         child_data(std::move(other.child_data)),
-        dictionary(std::move(other.dictionary)) {
+        dictionary(std::move(other.dictionary)),
+        validity_counts(std::move(other.validity_counts)) {
     SetNullCount(other.null_count);
   }
 
@@ -161,7 +169,8 @@ struct ARROW_EXPORT ArrayData {
         offset(other.offset),
         buffers(other.buffers),
         child_data(other.child_data),
-        dictionary(other.dictionary) {
+        dictionary(other.dictionary),
+        validity_counts(internal::atomic_load(&other.validity_counts)) {
     SetNullCount(other.null_count);
   }
 
@@ -174,6 +183,7 @@ struct ARROW_EXPORT ArrayData {
     buffers = std::move(other.buffers);
     child_data = std::move(other.child_data);
     dictionary = std::move(other.dictionary);
+    validity_counts = std::move(other.validity_counts);
     return *this;
   }
 
@@ -186,6 +196,7 @@ struct ARROW_EXPORT ArrayData {
     buffers = other.buffers;
     child_data = other.child_data;
     dictionary = other.dictionary;
+    validity_counts = internal::atomic_load(&other.validity_counts);
     return *this;
   }
 
@@ -206,6 +217,17 @@ struct ARROW_EXPORT ArrayData {
     return GetValues<T>(i, offset);
   }
 
+  // Like GetValues, but returns null for a buffer not located on the CPU
+  // (e.g. on a CUDA device), whose data can't be accessed directly
+  template <typename T>
+  inline const T* GetValuesSafe(int i, int64_t absolute_offset) const {
+    if (buffers[i] && buffers[i]->is_cpu()) {
+      return reinterpret_cast<const T*>(buffers[i]->data()) + absolute_offset;
+    } else {
+      return NULLPTR;
+    }
+  }
+
   // Access a buffer's data as a typed C pointer
   template <typename T>
   inline T* GetMutableValues(int i, int64_t absolute_offset) {
@@ -241,6 +263,11 @@ struct ARROW_EXPORT ArrayData {
   // The dictionary for this Array, if any. Only used for dictionary
   // type
   std::shared_ptr<Array> dictionary;
+
+  // Counts of set bits in the blocks of a large validity bitmap, shared with
+  // slices so their null counts needn't rescan blocks already counted.
+  // Attached by Slice(), and ignored once buffers[0] is replaced by another buffer
+  mutable std::shared_ptr<internal::ValidityBlockCounts> validity_counts;
 };
 
 /// \brief Create a strongly-typed Array instance from generic ArrayData
@@ -426,8 +453,8 @@ class ARROW_EXPORT Array {
 
   /// Protected method for constructors
   inline void SetData(const std::shared_ptr<ArrayData>& data) {
-    if (data->buffers.size() > 0 && data->buffers[0]) {
-      null_bitmap_data_ = data->buffers[0]->data();
+    if (data->buffers.size() > 0) {
+      null_bitmap_data_ = data->GetValuesSafe<uint8_t>(0, /*offset=*/0);
     } else {
       null_bitmap_data_ = NULLPTR;
     }
@@ -493,9 +520,8 @@ class ARROW_EXPORT PrimitiveArray : public FlatArray {
   PrimitiveArray() : raw_values_(NULLPTR) {}
 
   inline void SetData(const std::shared_ptr<ArrayData>& data) {
-    auto values = data->buffers[1];
     this->Array::SetData(data);
-    raw_values_ = values == NULLPTR ? NULLPTR : values->data();
+    raw_values_ = data->GetValuesSafe<uint8_t>(1, /*offset=*/0);
   }
 
   explicit inline PrimitiveArray(const std::shared_ptr<ArrayData>& data) {
@@ -855,14 +881,9 @@ class BaseBinaryArray : public FlatArray {
 
   // Protected method for constructors
   void SetData(const std::shared_ptr<ArrayData>& data) {
-    auto value_offsets = data->buffers[1];
-    auto value_data = data->buffers[2];
     this->Array::SetData(data);
-    raw_data_ = value_data == NULLPTR ? NULLPTR : value_data->data();
-    raw_value_offsets_ =
-        value_offsets == NULLPTR
-            ? NULLPTR
-            : reinterpret_cast<const offset_type*>(value_offsets->data());
+    raw_data_ = data->GetValuesSafe<uint8_t>(2, /*offset=*/0);
+    raw_value_offsets_ = data->GetValuesSafe<offset_type>(1, /*offset=*/0);
   }
 
   const offset_type* raw_value_offsets_;
@@ -82,6 +82,21 @@ Status ArrayBuilder::Advance(int64_t elements) {
   return null_bitmap_builder_.Advance(elements);
 }
 
+Status ArrayBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                      int64_t length) {
+  if (offset < 0 || length < 0 || offset > array.length - length) {
+    return Status::IndexError("Slice [", offset, ", ", offset + length,
+                              ") out of bounds of array of length ", array.length);
+  }
+  return AppendArraySliceInternal(array, offset, length);
+}
+
+Status ArrayBuilder::AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                              int64_t length) {
+  return Status::NotImplemented("AppendArraySlice for builder of type ",
+                                type()->ToString());
+}
+
 Status ArrayBuilder::Finish(std::shared_ptr<Array>* out) {
   std::shared_ptr<ArrayData> internal_data;
   RETURN_NOT_OK(FinishInternal(&internal_data));
@@ -106,6 +121,18 @@ void ArrayBuilder::UnsafeAppendToBitmap(const std::vector<bool>& is_valid) {
   }
 }
 
+void ArrayBuilder::UnsafeAppendToBitmap(const ArrayData& array, int64_t offset,
+                                        int64_t length) {
+  const Buffer* bitmap = array.buffers.empty() ? nullptr : array.buffers[0].get();
+  if (bitmap == nullptr || array.null_count == 0) {
+    UnsafeSetNotNull(length);
+    return;
+  }
+  null_bitmap_builder_.UnsafeAppendBitmap(bitmap->data(), array.offset + offset, length);
+  length_ += length;
+  null_count_ = null_bitmap_builder_.false_count();
+}
+
 void ArrayBuilder::UnsafeSetNotNull(int64_t length) {
   length_ += length;
   null_bitmap_builder_.UnsafeAppend(length, true);
@@ -103,6 +103,20 @@ class ARROW_EXPORT ArrayBuilder {
   virtual Status AppendNull() = 0;
   virtual Status AppendNulls(int64_t length) = 0;
 
+  /// \brief Append a range of values of an existing array
+  ///
+  /// Values, offsets and validity bitmaps are copied in bulk rather than value
+  /// by value.  The array must have the type of the built array; dictionary
+  /// builders also accept arrays of their value type.  Not all builders
+  /// support this (NotImplemented is returned then).
+  ///
+  /// \param[in] array the array to append values from
+  /// \param[in] offset the index of the first value to append, relative to
+  /// array.offset
+  /// \param[in] length the number of values to append
+  /// \return Status
+  Status AppendArraySlice(const ArrayData& array, int64_t offset, int64_t length);
+
   /// For cases where raw data was memcpy'd into the internal buffers, allows us
   /// to advance the length of the builder. It is your responsibility to use
   /// this function responsibly.
@@ -127,6 +141,10 @@ class ARROW_EXPORT ArrayBuilder {
   virtual std::shared_ptr<DataType> type() const = 0;
 
  protected:
+  /// Append a range of values of an array whose bounds were checked
+  virtual Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                          int64_t length);
+
   /// Append to null bitmap
   Status AppendToBitmap(bool is_valid);
 
@@ -173,6 +191,10 @@ class ARROW_EXPORT ArrayBuilder {
 
   void UnsafeAppendToBitmap(const std::vector<bool>& is_valid);
 
+  // Append the validity bitmap of a range of an array (see AppendArraySlice),
+  // update the length.
+  void UnsafeAppendToBitmap(const ArrayData& array, int64_t offset, int64_t length);
+
   // Set the next validity bits to not null (i.e. valid).
   void UnsafeSetNotNull(int64_t length);
 
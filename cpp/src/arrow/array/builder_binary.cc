@@ -29,6 +29,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
@@ -73,6 +74,15 @@ Status FixedSizeBinaryBuilder::AppendNulls(int64_t length) {
   return Status::OK();
 }
 
+Status FixedSizeBinaryBuilder::AppendArraySliceInternal(const ArrayData& array,
+                                                        int64_t offset, int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(array, offset, length);
+  return byte_builder_.Append(array.GetValues<uint8_t>(1, (array.offset + offset) *
+                                                              byte_width_),
+                              length * byte_width_);
+}
+
 void FixedSizeBinaryBuilder::Reset() {
   ArrayBuilder::Reset();
   byte_builder_.Reset();
@@ -134,6 +144,13 @@ Status ChunkedBinaryBuilder::Finish(ArrayVector* out) {
   return Status::OK();
 }
 
+Status ChunkedBinaryBuilder::Finish(std::shared_ptr<ChunkedArray>* out) {
+  ArrayVector chunks;
+  RETURN_NOT_OK(Finish(&chunks));
+  *out = std::make_shared<ChunkedArray>(std::move(chunks), type());
+  return Status::OK();
+}
+
 Status ChunkedBinaryBuilder::NextChunk() {
   std::shared_ptr<Array> chunk;
   RETURN_NOT_OK(builder_->Finish(&chunk));
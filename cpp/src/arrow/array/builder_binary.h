@@ -253,6 +253,29 @@ class BaseBinaryBuilder : public ArrayBuilder {
                                           : Status::OK();
   }
 
+  /// \brief Ensures there is enough allocated capacity to append the indicated
+  /// number of bytes to the value data buffer, without growing it beyond
+  /// max_capacity bytes in total
+  ///
+  /// ReserveData(elements) grows the buffer geometrically to amortize repeated
+  /// calls.  When the total size of the value data is known or bounded up
+  /// front, e.g. from file metadata, passing it as max_capacity allocates no
+  /// more than needed, so the buffer isn't reallocated while appending up to
+  /// that size nor trimmed when the builder is finished.
+  Status ReserveData(int64_t elements, int64_t max_capacity) {
+    const int64_t size = value_data_length() + elements;
+    ARROW_RETURN_IF(size > memory_limit(),
+                    Status::CapacityError("Cannot reserve capacity larger than ",
+                                          memory_limit(), " bytes"));
+    if (size <= value_data_capacity()) {
+      return Status::OK();
+    }
+    const int64_t new_capacity =
+        std::min(BufferBuilder::GrowByFactor(value_data_capacity(), size),
+                 std::max(size, max_capacity));
+    return value_data_builder_.Resize(new_capacity, false);
+  }
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override {
     // Write final offset (values length)
     ARROW_RETURN_NOT_OK(AppendNextOffset());
@@ -313,6 +336,28 @@ class BaseBinaryBuilder : public ArrayBuilder {
   TypedBufferBuilder<offset_type> offsets_builder_;
   TypedBufferBuilder<uint8_t> value_data_builder_;
 
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override {
+    const offset_type* offsets = array.GetValues<offset_type>(1) + offset;
+    const int64_t data_start = offsets[0];
+    const int64_t data_length = offsets[length] - data_start;
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(data_length));
+
+    // Copy the offsets, then rebase them onto the end of the value data
+    const int64_t delta = value_data_builder_.length() - data_start;
+    offset_type* out_offsets =
+        offsets_builder_.mutable_data() + offsets_builder_.length();
+    offsets_builder_.UnsafeAppend(offsets, length);
+    for (int64_t i = 0; i < length; ++i) {
+      out_offsets[i] = static_cast<offset_type>(out_offsets[i] + delta);
+    }
+    value_data_builder_.UnsafeAppend(array.GetValues<uint8_t>(2, data_start),
+                                     data_length);
+    UnsafeAppendToBitmap(array, offset, length);
+    return Status::OK();
+  }
+
   Status AppendOverflow(int64_t num_bytes) {
     return Status::CapacityError("array cannot contain more than ", memory_limit(),
                                  " bytes, have ", num_bytes);
@@ -504,6 +549,9 @@ class ARROW_EXPORT FixedSizeBinaryBuilder : public ArrayBuilder {
   }
 
   void CheckValueSize(int64_t size);
+
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override;
 };
 
 // ----------------------------------------------------------------------
@@ -563,6 +611,12 @@ class ARROW_EXPORT ChunkedBinaryBuilder {
 
   virtual Status Finish(ArrayVector* out);
 
+  /// \brief Finish the chunks as a ChunkedArray of type()
+  Status Finish(std::shared_ptr<ChunkedArray>* out);
+
+  /// \brief Return the type of the built chunks
+  virtual std::shared_ptr<DataType> type() const { return binary(); }
+
  protected:
   Status NextChunk();
 
@@ -584,7 +638,10 @@ class ARROW_EXPORT ChunkedStringBuilder : public ChunkedBinaryBuilder {
  public:
   using ChunkedBinaryBuilder::ChunkedBinaryBuilder;
 
+  using ChunkedBinaryBuilder::Finish;
   Status Finish(ArrayVector* out) override;
+
+  std::shared_ptr<DataType> type() const override { return utf8(); }
 };
 
 }  // namespace internal
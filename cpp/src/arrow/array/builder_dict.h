@@ -19,12 +19,17 @@
 
 #include <algorithm>
 #include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "arrow/array/builder_adaptive.h"   // IWYU pragma: export
 #include "arrow/array/builder_base.h"       // IWYU pragma: export
 #include "arrow/array/builder_primitive.h"  // IWYU pragma: export
 
 #include "arrow/array.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 
@@ -84,6 +89,17 @@ class ARROW_EXPORT DictionaryMemoTable {
   std::unique_ptr<DictionaryMemoTableImpl> impl_;
 };
 
+// Whether values of type T can be inserted in a DictionaryMemoTable
+template <typename T, typename = void>
+struct IsDictionaryMemoizable : std::false_type {};
+
+template <typename T>
+struct IsDictionaryMemoizable<
+    T, decltype(std::declval<DictionaryMemoTable&>().GetOrInsert(
+                    std::declval<typename DictionaryScalar<T>::type>(),
+                    std::declval<int32_t*>()),
+                void())> : std::true_type {};
+
 /// \brief Array builder for created encoded DictionaryArray from
 /// dense array
 ///
@@ -277,6 +293,96 @@ class DictionaryBuilderBase : public ArrayBuilder {
   }
 
  protected:
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override {
+    return AppendArraySliceImpl<T>(array, offset, length);
+  }
+
+  template <typename T1>
+  enable_if_t<!IsDictionaryMemoizable<T1>::value, Status> AppendArraySliceImpl(
+      const ArrayData& array, int64_t offset, int64_t length) {
+    return ArrayBuilder::AppendArraySliceInternal(array, offset, length);
+  }
+
+  template <typename T1>
+  enable_if_t<IsDictionaryMemoizable<T1>::value, Status> AppendArraySliceImpl(
+      const ArrayData& array, int64_t offset, int64_t length) {
+    if (array.type->Equals(*value_type_)) {
+      // A dense array of the value type
+      return AppendArray(*MakeArray(array.Copy())->Slice(offset, length));
+    }
+    if (array.type->id() != Type::DICTIONARY) {
+      return Status::TypeError("Cannot append array of type ", array.type->ToString(),
+                               " to builder of ", type()->ToString());
+    }
+    const auto& dict_type = checked_cast<const DictionaryType&>(*array.type);
+    if (!dict_type.value_type()->Equals(*value_type_)) {
+      return Status::TypeError("Cannot append dictionary array of value type ",
+                               dict_type.value_type()->ToString(), " to builder of ",
+                               value_type_->ToString());
+    }
+    switch (dict_type.index_type()->id()) {
+      case Type::INT8:
+        return AppendIndicesSlice<int8_t>(array, offset, length);
+      case Type::INT16:
+        return AppendIndicesSlice<int16_t>(array, offset, length);
+      case Type::INT32:
+        return AppendIndicesSlice<int32_t>(array, offset, length);
+      case Type::INT64:
+        return AppendIndicesSlice<int64_t>(array, offset, length);
+      default:
+        return Status::TypeError("Invalid dictionary index type: ",
+                                 dict_type.index_type()->ToString());
+    }
+  }
+
+  // Append a slice of a dictionary array: the dictionary values referenced by
+  // the slice are memoized once each, then the indices are transposed to memo
+  // indices and appended a chunk at a time.
+  template <typename IndexCType>
+  Status AppendIndicesSlice(const ArrayData& array, int64_t offset, int64_t length) {
+    using DictionaryArrayType = typename TypeTraits<T>::ArrayType;
+    using MemoIndexType = typename BuilderType::value_type;
+    constexpr int64_t kChunkSize = 1024;
+
+    const auto& dictionary = checked_cast<const DictionaryArrayType&>(*array.dictionary);
+    const IndexCType* indices = array.GetValues<IndexCType>(1) + offset;
+    const uint8_t* bitmap =
+        array.null_count != 0 ? array.GetValues<uint8_t>(0, /*offset=*/0) : NULLPTR;
+    // Memo index of each dictionary value, -1 if not memoized yet
+    std::vector<int32_t> memo_indices(dictionary.length(), -1);
+    MemoIndexType chunk_indices[kChunkSize];
+    uint8_t chunk_valid[kChunkSize];
+
+    const int64_t null_count_before = indices_builder_.null_count();
+    for (int64_t start = 0; start < length; start += kChunkSize) {
+      const int64_t chunk_length = std::min(kChunkSize, length - start);
+      for (int64_t i = 0; i < chunk_length; ++i) {
+        const int64_t index = indices[start + i];
+        chunk_valid[i] =
+            (bitmap == NULLPTR ||
+             BitUtil::GetBit(bitmap, array.offset + offset + start + i)) &&
+            dictionary.IsValid(index);
+        if (!chunk_valid[i]) {
+          chunk_indices[i] = 0;
+          continue;
+        }
+        int32_t& memo_index = memo_indices[index];
+        if (memo_index < 0) {
+          ARROW_RETURN_NOT_OK(memo_table_->GetOrInsert(dictionary.GetView(index),
+                                                       &memo_index));
+        }
+        chunk_indices[i] = static_cast<MemoIndexType>(memo_index);
+      }
+      ARROW_RETURN_NOT_OK(
+          indices_builder_.AppendValues(chunk_indices, chunk_length, chunk_valid));
+    }
+    capacity_ = indices_builder_.capacity();
+    length_ += length;
+    null_count_ += indices_builder_.null_count() - null_count_before;
+    return Status::OK();
+  }
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override {
     std::shared_ptr<Array> dictionary;
     ARROW_RETURN_NOT_OK(FinishWithDictOffset(/*offset=*/0, out, &dictionary));
@@ -383,6 +489,11 @@ class DictionaryBuilderBase<BuilderType, NullType> : public ArrayBuilder {
   }
 
  protected:
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override {
+    return AppendNulls(length);
+  }
+
   BuilderType indices_builder_;
 };
 
@@ -115,6 +115,17 @@ Status MapBuilder::AppendNulls(int64_t length) {
   return Status::OK();
 }
 
+Status MapBuilder::AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                            int64_t length) {
+  DCHECK_EQ(item_builder_->length(), key_builder_->length());
+  RETURN_NOT_OK(AdjustStructBuilderLength());
+  // A map array is laid out as a list of key-item structs
+  RETURN_NOT_OK(list_builder_->AppendArraySlice(array, offset, length));
+  length_ = list_builder_->length();
+  null_count_ = list_builder_->null_count();
+  return Status::OK();
+}
+
 Status MapBuilder::AdjustStructBuilderLength() {
   // If key/item builders have been appended, adjust struct builder length
   // to match. Struct and key are non-nullable, append all valid values.
@@ -174,6 +185,15 @@ Status FixedSizeListBuilder::AppendNulls(int64_t length) {
   return value_builder_->AppendNulls(list_size_ * length);
 }
 
+Status FixedSizeListBuilder::AppendArraySliceInternal(const ArrayData& array,
+                                                      int64_t offset, int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(array, offset, length);
+  return value_builder_->AppendArraySlice(*array.child_data[0],
+                                          (array.offset + offset) * list_size_,
+                                          length * list_size_);
+}
+
 Status FixedSizeListBuilder::Resize(int64_t capacity) {
   RETURN_NOT_OK(CheckCapacity(capacity, capacity_));
   return ArrayBuilder::Resize(capacity);
@@ -217,6 +237,18 @@ Status StructBuilder::AppendNulls(int64_t length) {
   return Status::OK();
 }
 
+Status StructBuilder::AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                               int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(array, offset, length);
+  // The offset of a struct array applies to its children
+  for (size_t i = 0; i < children_.size(); ++i) {
+    RETURN_NOT_OK(children_[i]->AppendArraySlice(*array.child_data[i],
+                                                 array.offset + offset, length));
+  }
+  return Status::OK();
+}
+
 Status StructBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> null_bitmap;
   RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
@@ -140,6 +140,31 @@ class BaseListBuilder : public ArrayBuilder {
   std::shared_ptr<ArrayBuilder> value_builder_;
   std::shared_ptr<Field> value_field_;
 
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override {
+    const offset_type* offsets = array.GetValues<offset_type>(1) + offset;
+    const int64_t values_start = offsets[0];
+    const int64_t values_length = offsets[length] - values_start;
+    const int64_t num_values = value_builder_->length();
+    ARROW_RETURN_IF(
+        num_values + values_length > maximum_elements(),
+        Status::CapacityError("List array cannot contain more than ", maximum_elements(),
+                              " child elements,", " have ", num_values + values_length));
+    ARROW_RETURN_NOT_OK(Reserve(length));
+
+    // Copy the offsets, then rebase them onto the end of the child values
+    const int64_t delta = num_values - values_start;
+    offset_type* out_offsets =
+        offsets_builder_.mutable_data() + offsets_builder_.length();
+    offsets_builder_.UnsafeAppend(offsets, length);
+    for (int64_t i = 0; i < length; ++i) {
+      out_offsets[i] = static_cast<offset_type>(out_offsets[i] + delta);
+    }
+    UnsafeAppendToBitmap(array, offset, length);
+    return value_builder_->AppendArraySlice(*array.child_data[0], values_start,
+                                            values_length);
+  }
+
   Status CheckNextOffset() const {
     const int64_t num_values = value_builder_->length();
     ARROW_RETURN_IF(
@@ -272,6 +297,9 @@ class ARROW_EXPORT MapBuilder : public ArrayBuilder {
  protected:
   inline Status AdjustStructBuilderLength();
 
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override;
+
  protected:
   bool keys_sorted_ = false;
   std::shared_ptr<ListBuilder> list_builder_;
@@ -346,6 +374,9 @@ class ARROW_EXPORT FixedSizeListBuilder : public ArrayBuilder {
   std::shared_ptr<Field> value_field_;
   const int32_t list_size_;
   std::shared_ptr<ArrayBuilder> value_builder_;
+
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override;
 };
 
 // ----------------------------------------------------------------------
@@ -400,6 +431,10 @@ class ARROW_EXPORT StructBuilder : public ArrayBuilder {
 
   std::shared_ptr<DataType> type() const override;
 
+ protected:
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override;
+
  private:
   std::shared_ptr<DataType> type_;
 };
@@ -128,6 +128,15 @@ Status BooleanBuilder::AppendValues(const std::vector<bool>& values) {
   return Status::OK();
 }
 
+Status BooleanBuilder::AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                                int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  data_builder_.UnsafeAppendBitmap(array.buffers[1]->data(), array.offset + offset,
+                                   length);
+  UnsafeAppendToBitmap(array, offset, length);
+  return Status::OK();
+}
+
 Status BooleanBuilder::AppendValues(int64_t length, bool value) {
   RETURN_NOT_OK(Reserve(length));
   data_builder_.UnsafeAppend(length, value);
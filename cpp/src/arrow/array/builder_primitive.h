@@ -53,6 +53,12 @@ class ARROW_EXPORT NullBuilder : public ArrayBuilder {
   std::shared_ptr<DataType> type() const override { return null(); }
 
   Status Finish(std::shared_ptr<NullArray>* out) { return FinishTyped(out); }
+
+ protected:
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override {
+    return AppendNulls(length);
+  }
 };
 
 /// Base class for all Builders that emit an Array of a scalar numerical type.
@@ -249,6 +255,14 @@ class NumericBuilder : public ArrayBuilder {
   std::shared_ptr<DataType> type() const override { return type_; }
 
  protected:
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override {
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    data_builder_.UnsafeAppend(array.GetValues<value_type>(1) + offset, length);
+    UnsafeAppendToBitmap(array, offset, length);
+    return Status::OK();
+  }
+
   std::shared_ptr<DataType> type_;
   TypedBufferBuilder<value_type> data_builder_;
 };
@@ -434,6 +448,9 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
   std::shared_ptr<DataType> type() const override { return boolean(); }
 
  protected:
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override;
+
   TypedBufferBuilder<bool> data_builder_;
 };
 
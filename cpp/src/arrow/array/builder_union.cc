@@ -17,9 +17,12 @@
 
 #include "arrow/array/builder_union.h"
 
+#include <algorithm>
 #include <limits>
 #include <utility>
+#include <vector>
 
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
@@ -43,6 +46,19 @@ Status BasicUnionBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   return Status::OK();
 }
 
+Status BasicUnionBuilder::CheckAppendedType(const ArrayData& array) const {
+  if (array.type->id() != Type::UNION) {
+    return Status::TypeError("Cannot append array of type ", array.type->ToString(),
+                             " to union builder");
+  }
+  const auto& union_type = checked_cast<const UnionType&>(*array.type);
+  if (union_type.mode() != mode_ || union_type.type_codes() != type_codes_) {
+    return Status::TypeError("Cannot append array of type ", union_type.ToString(),
+                             " to builder of ", type()->ToString());
+  }
+  return Status::OK();
+}
+
 BasicUnionBuilder::BasicUnionBuilder(
     MemoryPool* pool, UnionMode::type mode,
     const std::vector<std::shared_ptr<ArrayBuilder>>& children,
@@ -118,4 +134,71 @@ int8_t BasicUnionBuilder::NextTypeId() {
   return dense_type_id_++;
 }
 
+Status DenseUnionBuilder::AppendArraySliceInternal(const ArrayData& array,
+                                                   int64_t offset, int64_t length) {
+  RETURN_NOT_OK(CheckAppendedType(array));
+  const auto& child_ids = checked_cast<const UnionType&>(*array.type).child_ids();
+  const int8_t* types = array.GetValues<int8_t>(1) + offset;
+  const int32_t* offsets = array.GetValues<int32_t>(2) + offset;
+  const uint8_t* bitmap =
+      array.null_count != 0 ? array.GetValues<uint8_t>(0, /*offset=*/0) : nullptr;
+  auto is_valid = [&](int64_t i) {
+    return bitmap == nullptr || BitUtil::GetBit(bitmap, array.offset + offset + i);
+  };
+
+  // The range of values referenced in each child, by type code
+  const size_t num_type_codes = type_id_to_children_.size();
+  std::vector<int64_t> child_starts(num_type_codes, std::numeric_limits<int64_t>::max());
+  std::vector<int64_t> child_ends(num_type_codes, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    if (is_valid(i)) {
+      child_starts[types[i]] = std::min<int64_t>(child_starts[types[i]], offsets[i]);
+      child_ends[types[i]] = std::max<int64_t>(child_ends[types[i]], offsets[i] + 1);
+    }
+  }
+
+  // Append each range to its child, then rebase the offsets onto the ends of
+  // the children
+  std::vector<int64_t> deltas(num_type_codes, 0);
+  for (size_t code = 0; code < num_type_codes; ++code) {
+    if (child_starts[code] >= child_ends[code]) {
+      continue;
+    }
+    ArrayBuilder* child = type_id_to_children_[code];
+    const int64_t child_length = child_ends[code] - child_starts[code];
+    if (child->length() + child_length > kListMaximumElements) {
+      return Status::CapacityError(
+          "a dense UnionArray cannot contain more than 2^31 - 1 elements from a single "
+          "child");
+    }
+    deltas[code] = child->length() - child_starts[code];
+    RETURN_NOT_OK(child->AppendArraySlice(*array.child_data[child_ids[code]],
+                                          child_starts[code], child_length));
+  }
+
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(types_builder_.Append(types, length));
+  RETURN_NOT_OK(offsets_builder_.Reserve(length));
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_builder_.UnsafeAppend(
+        is_valid(i) ? static_cast<int32_t>(offsets[i] + deltas[types[i]]) : 0);
+  }
+  UnsafeAppendToBitmap(array, offset, length);
+  return Status::OK();
+}
+
+Status SparseUnionBuilder::AppendArraySliceInternal(const ArrayData& array,
+                                                    int64_t offset, int64_t length) {
+  RETURN_NOT_OK(CheckAppendedType(array));
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(types_builder_.Append(array.GetValues<int8_t>(1) + offset, length));
+  UnsafeAppendToBitmap(array, offset, length);
+  // The children of a sparse union are as long as the union, and share its offset
+  for (size_t i = 0; i < children_.size(); ++i) {
+    RETURN_NOT_OK(children_[i]->AppendArraySlice(*array.child_data[i],
+                                                 array.offset + offset, length));
+  }
+  return Status::OK();
+}
+
 }  // namespace arrow
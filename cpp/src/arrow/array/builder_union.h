@@ -65,6 +65,9 @@ class ARROW_EXPORT BasicUnionBuilder : public ArrayBuilder {
 
   int8_t NextTypeId();
 
+  /// Check that an array has the union mode and type codes of the builder
+  Status CheckAppendedType(const ArrayData& array) const;
+
   std::vector<std::shared_ptr<Field>> child_fields_;
   std::vector<int8_t> type_codes_;
   UnionMode::type mode_;
@@ -130,6 +133,10 @@ class ARROW_EXPORT DenseUnionBuilder : public BasicUnionBuilder {
     return offsets_builder_.Finish(&(*out)->buffers[2]);
   }
 
+ protected:
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override;
+
  private:
   TypedBufferBuilder<int32_t> offsets_builder_;
 };
@@ -173,6 +180,10 @@ class ARROW_EXPORT SparseUnionBuilder : public BasicUnionBuilder {
     ARROW_RETURN_NOT_OK(types_builder_.Append(next_type));
     return AppendToBitmap(true);
   }
+
+ protected:
+  Status AppendArraySliceInternal(const ArrayData& array, int64_t offset,
+                                  int64_t length) override;
 };
 
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #include "arrow/array/concatenate.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -26,7 +27,12 @@
 #include "arrow/array.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 #include "arrow/visitor_inline.h"
 
@@ -82,70 +88,124 @@ static Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool*
   return Status::OK();
 }
 
-// Write offsets in src into dst, adjusting them such that first_offset
-// will be the first offset written.
-template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range);
+// Copies of at least this many bytes are split into tasks on the CPU thread pool
+static constexpr int64_t kMinParallelBytes = 1 << 20;
+static constexpr int64_t kMinTaskBytes = 1 << 18;
+
+// Call func(i, begin, end) for the intersection [begin, end) of each piece
+// [positions[i], positions[i + 1]) with the elements covered by a task.  The
+// elements of all pieces are split evenly into tasks on the CPU thread pool
+// if use_threads is true and they are large enough, so that a task may copy
+// many small pieces or part of a large one.
+template <typename Func>
+static Status ForEachPiece(bool use_threads, int64_t byte_width,
+                           const std::vector<int64_t>& positions, Func&& func) {
+  const int64_t length = positions.back();
+  int num_tasks = 1;
+  if (use_threads && length * byte_width >= kMinParallelBytes) {
+    num_tasks = static_cast<int>(std::min<int64_t>(
+        internal::GetCpuThreadPool()->GetCapacity(),
+        length * byte_width / kMinTaskBytes));
+  }
+  auto run_task = [&](int64_t begin, int64_t end) {
+    // the last piece starting at or before begin
+    auto i = std::upper_bound(positions.begin(), positions.end(), begin) -
+             positions.begin() - 1;
+    for (; positions[i] < end; ++i) {
+      func(i, std::max(begin, positions[i]), std::min(end, positions[i + 1]));
+    }
+  };
+  if (num_tasks <= 1) {
+    if (length > 0) {
+      run_task(0, length);
+    }
+    return Status::OK();
+  }
+  const int64_t task_length = (length + num_tasks - 1) / num_tasks;
+  return internal::ParallelFor(num_tasks, [&](int task) {
+    const int64_t begin = task * task_length;
+    if (begin < length) {
+      run_task(begin, std::min(length, begin + task_length));
+    }
+    return Status::OK();
+  });
+}
+
+// The position of each buffer's first element in the concatenation of the
+// buffers, followed by their total number of elements.
+static std::vector<int64_t> BufferPositions(const BufferVector& buffers,
+                                            int64_t byte_width = 1) {
+  std::vector<int64_t> positions(buffers.size() + 1, 0);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    positions[i + 1] = positions[i] + buffers[i]->size() / byte_width;
+  }
+  return positions;
+}
+
+// Allocate a buffer and copy the buffers into it, one after the other.
+static Status ConcatenateBuffers(const BufferVector& buffers, bool use_threads,
+                                 MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  const auto positions = BufferPositions(buffers);
+  RETURN_NOT_OK(AllocateBuffer(pool, positions.back(), out));
+  uint8_t* dst = (*out)->mutable_data();
+  return ForEachPiece(use_threads, 1, positions,
+                      [&](size_t i, int64_t begin, int64_t end) {
+                        std::memcpy(dst + begin,
+                                    buffers[i]->data() + (begin - positions[i]),
+                                    end - begin);
+                      });
+}
 
 // Concatenate buffers holding offsets into a single buffer of offsets,
 // also computing the ranges of values spanned by each buffer of offsets.
 template <typename Offset>
-static Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
-                                 std::shared_ptr<Buffer>* out,
+static Status ConcatenateOffsets(const BufferVector& buffers, bool use_threads,
+                                 MemoryPool* pool, std::shared_ptr<Buffer>* out,
                                  std::vector<Range>* values_ranges) {
   values_ranges->resize(buffers.size());
 
-  // allocate output buffer
-  int64_t out_length = 0;
+  // Compute the range of values spanned by each buffer of offsets, and the
+  // adjustment which makes its first offset the cumulative length of values
+  // spanned by the offsets in previous buffers
+  std::vector<Offset> adjustments(buffers.size());
+  Offset values_length = 0;
   for (size_t i = 0; i < buffers.size(); ++i) {
-    out_length += buffers[i]->size() / sizeof(Offset);
+    auto src_begin = reinterpret_cast<const Offset*>(buffers[i]->data());
+    auto src_end =
+        reinterpret_cast<const Offset*>(buffers[i]->data() + buffers[i]->size());
+    Range* values_range = &values_ranges->at(i);
+    values_range->offset = src_begin[0];
+    values_range->length = *src_end - values_range->offset;
+    if (values_length > std::numeric_limits<Offset>::max() - values_range->length) {
+      return Status::Invalid("offset overflow while concatenating arrays");
+    }
+    adjustments[i] = values_length - src_begin[0];
+    values_length += static_cast<Offset>(values_range->length);
   }
+
+  // allocate the output buffer, then write the adjusted offsets into it
+  const auto positions = BufferPositions(buffers, sizeof(Offset));
+  const int64_t out_length = positions.back();
   RETURN_NOT_OK(AllocateBuffer(pool, (out_length + 1) * sizeof(Offset), out));
   auto dst = reinterpret_cast<Offset*>((*out)->mutable_data());
-
-  int64_t elements_length = 0;
-  Offset values_length = 0;
-  for (size_t i = 0; i < buffers.size(); ++i) {
-    // the first offset from buffers[i] will be adjusted to values_length
-    // (the cumulative length of values spanned by offsets in previous buffers)
-    RETURN_NOT_OK(PutOffsets<Offset>(buffers[i], values_length, &dst[elements_length],
-                                     &values_ranges->at(i)));
-    elements_length += buffers[i]->size() / sizeof(Offset);
-    values_length += static_cast<Offset>(values_ranges->at(i).length);
-  }
+  RETURN_NOT_OK(ForEachPiece(
+      use_threads, sizeof(Offset), positions, [&](size_t i, int64_t begin, int64_t end) {
+        auto src = reinterpret_cast<const Offset*>(buffers[i]->data()) +
+                   (begin - positions[i]);
+        const Offset adjustment = adjustments[i];
+        std::transform(src, src + (end - begin), dst + begin,
+                       [adjustment](Offset offset) { return offset + adjustment; });
+      }));
 
   // the final element in dst is the length of all values spanned by the offsets
   dst[out_length] = values_length;
   return Status::OK();
 }
 
-template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range) {
-  // Get the range of offsets to transfer from src
-  auto src_begin = reinterpret_cast<const Offset*>(src->data());
-  auto src_end = reinterpret_cast<const Offset*>(src->data() + src->size());
-
-  // Compute the range of values which is spanned by this range of offsets
-  values_range->offset = src_begin[0];
-  values_range->length = *src_end - values_range->offset;
-  if (first_offset > std::numeric_limits<Offset>::max() - values_range->length) {
-    return Status::Invalid("offset overflow while concatenating arrays");
-  }
-
-  // Write offsets into dst, ensuring that the first offset written is
-  // first_offset
-  auto adjustment = first_offset - src_begin[0];
-  std::transform(src_begin, src_end, dst,
-                 [adjustment](Offset offset) { return offset + adjustment; });
-  return Status::OK();
-}
-
 class ConcatenateImpl {
  public:
-  ConcatenateImpl(const std::vector<ArrayData>& in, MemoryPool* pool)
-      : in_(in), pool_(pool) {
+  ConcatenateImpl(const std::vector<ArrayData>& in, MemoryPool* pool, bool use_threads)
+      : in_(in), pool_(pool), use_threads_(use_threads) {
     out_.type = in[0].type;
     for (size_t i = 0; i < in_.size(); ++i) {
       out_.length += in[i].length;
@@ -179,47 +239,51 @@ class ConcatenateImpl {
 
   Status Visit(const FixedWidthType& fixed) {
     // handles numbers, decimal128, fixed_size_binary
-    return ConcatenateBuffers(Buffers(1, fixed), pool_, &out_.buffers[1]);
+    return ConcatenateBuffers(Buffers(1, fixed), use_threads_, pool_,
+                              &out_.buffers[1]);
   }
 
   Status Visit(const BinaryType&) {
     std::vector<Range> value_ranges;
-    RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateBuffers(Buffers(2, value_ranges), pool_, &out_.buffers[2]);
+    RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), use_threads_,
+                                              pool_, &out_.buffers[1], &value_ranges));
+    return ConcatenateBuffers(Buffers(2, value_ranges), use_threads_, pool_,
+                              &out_.buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
     std::vector<Range> value_ranges;
-    RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateBuffers(Buffers(2, value_ranges), pool_, &out_.buffers[2]);
+    RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), use_threads_,
+                                              pool_, &out_.buffers[1], &value_ranges));
+    return ConcatenateBuffers(Buffers(2, value_ranges), use_threads_, pool_,
+                              &out_.buffers[2]);
   }
 
   Status Visit(const ListType&) {
     std::vector<Range> value_ranges;
-    RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateImpl(ChildData(0, value_ranges), pool_)
+    RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), use_threads_,
+                                              pool_, &out_.buffers[1], &value_ranges));
+    return ConcatenateImpl(ChildData(0, value_ranges), pool_, use_threads_)
         .Concatenate(out_.child_data[0].get());
   }
 
   Status Visit(const LargeListType&) {
     std::vector<Range> value_ranges;
-    RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateImpl(ChildData(0, value_ranges), pool_)
+    RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), use_threads_,
+                                              pool_, &out_.buffers[1], &value_ranges));
+    return ConcatenateImpl(ChildData(0, value_ranges), pool_, use_threads_)
         .Concatenate(out_.child_data[0].get());
   }
 
   Status Visit(const FixedSizeListType&) {
-    return ConcatenateImpl(ChildData(0), pool_).Concatenate(out_.child_data[0].get());
+    return ConcatenateImpl(ChildData(0), pool_, use_threads_)
+        .Concatenate(out_.child_data[0].get());
   }
 
   Status Visit(const StructType& s) {
     for (int i = 0; i < s.num_children(); ++i) {
-      RETURN_NOT_OK(
-          ConcatenateImpl(ChildData(i), pool_).Concatenate(out_.child_data[i].get()));
+      RETURN_NOT_OK(ConcatenateImpl(ChildData(i), pool_, use_threads_)
+                        .Concatenate(out_.child_data[i].get()));
     }
     return Status::OK();
   }
@@ -232,7 +296,8 @@ class ConcatenateImpl {
     bool dictionaries_same = true;
     const Array& dictionary0 = *in_[0].dictionary;
     for (size_t i = 1; i < in_.size(); ++i) {
-      if (!in_[i].dictionary->Equals(dictionary0)) {
+      if (in_[i].dictionary != in_[0].dictionary &&
+          !in_[i].dictionary->Equals(dictionary0)) {
         dictionaries_same = false;
         break;
       }
@@ -240,9 +305,75 @@ class ConcatenateImpl {
 
     if (dictionaries_same) {
       out_.dictionary = in_[0].dictionary;
-      return ConcatenateBuffers(Buffers(1, *fixed), pool_, &out_.buffers[1]);
-    } else {
-      return Status::NotImplemented("Concat with dictionary unification NYI");
+      return ConcatenateBuffers(Buffers(1, *fixed), use_threads_, pool_,
+                                &out_.buffers[1]);
+    }
+    return ConcatenateUnifiedIndices(d);
+  }
+
+  // Unify the dictionaries, then transpose the indices of each input straight
+  // into the output buffer, keeping the index type
+  Status ConcatenateUnifiedIndices(const DictionaryType& d) {
+    std::unique_ptr<DictionaryUnifier> unifier;
+    RETURN_NOT_OK(DictionaryUnifier::Make(pool_, d.value_type(), &unifier));
+    std::vector<std::shared_ptr<Buffer>> transpose_maps(in_.size());
+    for (size_t i = 0; i < in_.size(); ++i) {
+      RETURN_NOT_OK(unifier->Unify(*in_[i].dictionary, &transpose_maps[i]));
+    }
+    std::shared_ptr<DataType> unified_type;
+    RETURN_NOT_OK(unifier->GetResult(&unified_type, &out_.dictionary));
+
+    const auto& index_type = internal::checked_cast<const IntegerType&>(*d.index_type());
+    const int byte_width = index_type.bit_width() / 8;
+    if (byte_width < 8 &&
+        out_.dictionary->length() > (int64_t(1) << (index_type.bit_width() - 1))) {
+      return Status::Invalid("Unified dictionary of ", out_.dictionary->length(),
+                             " values can't be indexed with ", index_type);
+    }
+
+    RETURN_NOT_OK(AllocateBuffer(pool_, out_.length * byte_width, &out_.buffers[1]));
+    uint8_t* out_indices = out_.buffers[1]->mutable_data();
+    for (size_t i = 0; i < in_.size(); ++i) {
+      const auto transpose_map =
+          reinterpret_cast<const int32_t*>(transpose_maps[i]->data());
+      const int64_t map_length = in_[i].dictionary->length();
+      switch (index_type.id()) {
+        case Type::INT8:
+          TransposeIndices<int8_t>(in_[i], transpose_map, map_length, out_indices);
+          break;
+        case Type::INT16:
+          TransposeIndices<int16_t>(in_[i], transpose_map, map_length, out_indices);
+          break;
+        case Type::INT32:
+          TransposeIndices<int32_t>(in_[i], transpose_map, map_length, out_indices);
+          break;
+        case Type::INT64:
+          TransposeIndices<int64_t>(in_[i], transpose_map, map_length, out_indices);
+          break;
+        default:
+          return Status::NotImplemented("Concatenation of dictionaries with ",
+                                        index_type, " indices");
+      }
+      out_indices += in_[i].length * byte_width;
+    }
+    return Status::OK();
+  }
+
+  template <typename IndexCType>
+  static void TransposeIndices(const ArrayData& in, const int32_t* transpose_map,
+                               int64_t map_length, uint8_t* out) {
+    const IndexCType* in_indices = in.GetValues<IndexCType>(1);
+    auto out_indices = reinterpret_cast<IndexCType*>(out);
+    if (in.GetNullCount() == 0) {
+      internal::TransposeInts(in_indices, out_indices, in.length, transpose_map);
+      return;
+    }
+    // The indices of null slots may be out of bounds
+    for (int64_t i = 0; i < in.length; ++i) {
+      const auto index = static_cast<uint64_t>(in_indices[i]);
+      out_indices[i] = index < static_cast<uint64_t>(map_length)
+                           ? static_cast<IndexCType>(transpose_map[index])
+                           : 0;
     }
   }
 
@@ -353,11 +484,17 @@ class ConcatenateImpl {
 
   const std::vector<ArrayData>& in_;
   MemoryPool* pool_;
+  bool use_threads_;
   ArrayData out_;
 };
 
 Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
                    std::shared_ptr<Array>* out) {
+  return Concatenate(arrays, pool, /*use_threads=*/false, out);
+}
+
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool, bool use_threads,
+                   std::shared_ptr<Array>* out) {
   if (arrays.size() == 0) {
     return Status::Invalid("Must pass at least one array");
   }
@@ -374,7 +511,7 @@ Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
   }
 
   ArrayData out_data;
-  RETURN_NOT_OK(ConcatenateImpl(data, pool).Concatenate(&out_data));
+  RETURN_NOT_OK(ConcatenateImpl(data, pool, use_threads).Concatenate(&out_data));
   *out = MakeArray(std::make_shared<ArrayData>(std::move(out_data)));
   return Status::OK();
 }
@@ -36,4 +36,19 @@ ARROW_EXPORT
 Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
                    std::shared_ptr<Array>* out);
 
+/// \brief Concatenate arrays, copying large inputs in parallel
+///
+/// If use_threads is true, the buffers of large inputs are copied by tasks on
+/// the global CPU thread pool.  As this waits for those tasks, it must not be
+/// called from a task of that thread pool with use_threads set.
+///
+/// \param[in] arrays a vector of arrays to be concatenated
+/// \param[in] pool memory to store the result will be allocated from this memory pool
+/// \param[in] use_threads whether to copy large inputs in parallel
+/// \param[out] out the resulting concatenated array
+/// \return Status
+ARROW_EXPORT
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool, bool use_threads,
+                   std::shared_ptr<Array>* out);
+
 }  // namespace arrow
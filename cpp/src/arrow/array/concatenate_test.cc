@@ -211,6 +211,44 @@ TEST_F(ConcatenateTest, DictionaryType) {
   });
 }
 
+TEST_F(ConcatenateTest, DictionaryTypeDifferentDictionaries) {
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict_one = ArrayFromJSON(utf8(), R"(["A", "B", "C"])");
+  auto dict_two = ArrayFromJSON(utf8(), R"(["C", "D", "A"])");
+  auto indices_one = ArrayFromJSON(int8(), "[0, 1, 2, null]");
+  // The index of a null slot may be out of bounds
+  indices_one->data()->GetMutableValues<int8_t>(1)[3] = 100;
+  auto indices_two = ArrayFromJSON(int8(), "[2, 1, 0, null]");
+  auto one = std::make_shared<DictionaryArray>(dict_type, indices_one, dict_one);
+  auto two = std::make_shared<DictionaryArray>(dict_type, indices_two, dict_two);
+
+  std::shared_ptr<Array> concatenated;
+  ASSERT_OK(Concatenate({one, two->Slice(1)}, default_memory_pool(), &concatenated));
+  ASSERT_OK(concatenated->ValidateFull());
+  auto expected = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int8(), "[0, 1, 2, null, 3, 2, null]"),
+      ArrayFromJSON(utf8(), R"(["A", "B", "C", "D"])"));
+  AssertArraysEqual(*expected, *concatenated);
+}
+
+TEST_F(ConcatenateTest, DictionaryTypeIndexOverflow) {
+  // Two dictionaries of 100 distinct values can't be unified with int8 indices
+  auto dict_type = dictionary(int8(), int32());
+  auto indices = ArrayFromJSON(int8(), "[0, 99]");
+  ArrayVector arrays;
+  for (int32_t start : {0, 100}) {
+    Int32Builder builder;
+    for (int32_t i = start; i < start + 100; ++i) {
+      ASSERT_OK(builder.Append(i));
+    }
+    std::shared_ptr<Array> dict;
+    ASSERT_OK(builder.Finish(&dict));
+    arrays.push_back(std::make_shared<DictionaryArray>(dict_type, indices, dict));
+  }
+  std::shared_ptr<Array> concatenated;
+  ASSERT_RAISES(Invalid, Concatenate(arrays, default_memory_pool(), &concatenated));
+}
+
 TEST_F(ConcatenateTest, DISABLED_UnionType) {
   // sparse mode
   Check([this](int32_t size, double null_probability, std::shared_ptr<Array>* out) {
@@ -231,6 +269,33 @@ TEST_F(ConcatenateTest, DISABLED_UnionType) {
   });
 }
 
+TEST_F(ConcatenateTest, UseThreads) {
+  // Large enough for the buffers to be copied in parallel, in uneven chunks
+  const int32_t size = 1 << 18;
+  auto ints = this->GeneratePrimitive<Int64Type>(size, 0.1);
+  auto strings = rng_.String(size, /*min_length =*/0, /*max_length =*/15, 0.1);
+  auto values = this->GeneratePrimitive<Int8Type>(size * 4, 0.1);
+  auto offsets_vector = this->Offsets<int32_t>(size * 4, size);
+  offsets_vector.front() = 0;
+  offsets_vector.back() = size * 4;
+  std::shared_ptr<Array> offsets, lists;
+  ArrayFromVector<Int32Type>(offsets_vector, &offsets);
+  ASSERT_OK(ListArray::FromArrays(*offsets, *values, default_memory_pool(), &lists));
+  auto array = std::make_shared<StructArray>(
+      struct_({field("ints", int64()), field("strings", utf8()),
+               field("lists", list(int8()))}),
+      size, ArrayVector{ints, strings, lists});
+
+  auto slice_offsets = this->Offsets<int32_t>(size, 100);
+  auto expected = array->Slice(slice_offsets.front(),
+                               slice_offsets.back() - slice_offsets.front());
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(Concatenate(this->Slices(array, slice_offsets), default_memory_pool(),
+                        /*use_threads=*/true, &actual));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*expected, *actual);
+}
+
 TEST_F(ConcatenateTest, OffsetOverflow) {
   auto fake_long = ArrayFromJSON(utf8(), "[\"\"]");
   fake_long->data()->GetMutableValues<int32_t>(1)[1] =
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <limits>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -63,21 +64,32 @@ class DictionaryUnifierImpl : public DictionaryUnifier {
                              dictionary.type()->ToString());
     }
     const ArrayType& values = checked_cast<const ArrayType&>(dictionary);
+    int32_t* result_raw = nullptr;
     if (out != nullptr) {
-      std::shared_ptr<Buffer> result;
-      RETURN_NOT_OK(
-          AllocateBuffer(pool_, dictionary.length() * sizeof(int32_t), &result));
-      auto result_raw = reinterpret_cast<int32_t*>(result->mutable_data());
-      for (int64_t i = 0; i < values.length(); ++i) {
-        RETURN_NOT_OK(memo_table_.GetOrInsert(values.GetView(i), &result_raw[i]));
-      }
-      *out = result;
-    } else {
-      for (int64_t i = 0; i < values.length(); ++i) {
-        int32_t unused_memo_index;
-        RETURN_NOT_OK(memo_table_.GetOrInsert(values.GetView(i), &unused_memo_index));
+      RETURN_NOT_OK(AllocateBuffer(pool_, dictionary.length() * sizeof(int32_t), out));
+      result_raw = reinterpret_cast<int32_t*>((*out)->mutable_data());
+    }
+
+    // The leading values already in the memo table, in the same order, are not
+    // hashed again.  This is the common case of chunks sharing a dictionary or
+    // extending the dictionary of the previous chunk.
+    const int64_t known_length = KnownPrefixLength(dictionary);
+    const int32_t memo_size = memo_table_.size();
+    if (result_raw != nullptr) {
+      std::iota(result_raw, result_raw + known_length, 0);
+    }
+    for (int64_t i = known_length; i < values.length(); ++i) {
+      int32_t memo_index;
+      RETURN_NOT_OK(memo_table_.GetOrInsert(values.GetView(i), &memo_index));
+      if (result_raw != nullptr) {
+        result_raw[i] = memo_index;
       }
     }
+
+    // Remember the dictionary if its values are now the memo table, in order
+    if (known_length == memo_size && memo_table_.size() == values.length()) {
+      reference_ = MakeArray(dictionary.data());
+    }
     return Status::OK();
   }
 
@@ -108,9 +120,25 @@ class DictionaryUnifierImpl : public DictionaryUnifier {
   }
 
  private:
+  // The length of the prefix of the dictionary which is known to hold the first
+  // values of the memo table
+  int64_t KnownPrefixLength(const Array& dictionary) const {
+    if (reference_ == nullptr) {
+      return 0;
+    }
+    if (dictionary.data() == reference_->data()) {
+      return dictionary.length();
+    }
+    const int64_t length = std::min(dictionary.length(), reference_->length());
+    return dictionary.RangeEquals(0, length, 0, *reference_) ? length : 0;
+  }
+
   MemoryPool* pool_;
   std::shared_ptr<DataType> value_type_;
   MemoTableType memo_table_;
+  // A unified dictionary whose values are the first values of the memo table,
+  // in the same order
+  std::shared_ptr<Array> reference_;
 };
 
 struct MakeUnifier {
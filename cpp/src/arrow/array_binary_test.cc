@@ -29,6 +29,7 @@
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -473,6 +474,25 @@ class TestStringBuilder : public TestBuilder {
     ASSERT_EQ(reps * 40, result_->value_data()->size());
   }
 
+  void TestCapacityReserveCapped() {
+    ASSERT_OK(builder_->ReserveData(600));
+    ASSERT_OK(builder_->Append(std::string(600, 'a')));
+    ASSERT_EQ(BitUtil::RoundUpToMultipleOf64(600), builder_->value_data_capacity());
+
+    // Growth is capped at the given total capacity
+    ASSERT_OK(builder_->ReserveData(100, /*max_capacity=*/1000));
+    ASSERT_EQ(BitUtil::RoundUpToMultipleOf64(1000), builder_->value_data_capacity());
+    ASSERT_OK(builder_->ReserveData(400, /*max_capacity=*/1000));
+    ASSERT_EQ(BitUtil::RoundUpToMultipleOf64(1000), builder_->value_data_capacity());
+
+    // but never below what is needed
+    ASSERT_OK(builder_->ReserveData(2000, /*max_capacity=*/0));
+    ASSERT_EQ(BitUtil::RoundUpToMultipleOf64(2600), builder_->value_data_capacity());
+
+    Done();
+    ASSERT_EQ(600, result_->value_data()->size());
+  }
+
   void TestZeroLength() {
     // All buffers are null
     Done();
@@ -503,6 +523,10 @@ TYPED_TEST(TestStringBuilder, TestAppendCStringsWithoutValidBytes) {
 
 TYPED_TEST(TestStringBuilder, TestCapacityReserve) { this->TestCapacityReserve(); }
 
+TYPED_TEST(TestStringBuilder, TestCapacityReserveCapped) {
+  this->TestCapacityReserveCapped();
+}
+
 TYPED_TEST(TestStringBuilder, TestZeroLength) { this->TestZeroLength(); }
 
 // ----------------------------------------------------------------------
@@ -661,6 +685,29 @@ TEST(TestChunkedStringBuilder, BasicOperation) {
   }
 }
 
+TEST(TestChunkedStringBuilder, FinishChunkedArray) {
+  internal::ChunkedStringBuilder builder(/*max_chunk_value_length=*/25);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(builder.Append("0123456789"));
+    ASSERT_OK(builder.AppendNull());
+  }
+
+  std::shared_ptr<ChunkedArray> chunked;
+  ASSERT_OK(builder.Finish(&chunked));
+  ASSERT_OK(chunked->ValidateFull());
+  ASSERT_TRUE(chunked->type()->Equals(utf8()));
+  ASSERT_EQ(5, chunked->num_chunks());
+  ASSERT_EQ(20, chunked->length());
+  ASSERT_EQ(10, chunked->null_count());
+
+  // An empty builder yields a single empty chunk
+  internal::ChunkedBinaryBuilder empty_builder(25);
+  ASSERT_OK(empty_builder.Finish(&chunked));
+  ASSERT_TRUE(chunked->type()->Equals(binary()));
+  ASSERT_EQ(1, chunked->num_chunks());
+  ASSERT_EQ(0, chunked->length());
+}
+
 // ----------------------------------------------------------------------
 // ArrayDataVisitor<binary-like> tests
 
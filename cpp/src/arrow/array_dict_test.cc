@@ -904,6 +904,54 @@ TEST(TestDecimalDictionaryBuilder, DoubleTableSize) {
   ASSERT_TRUE(expected.Equals(result));
 }
 
+TEST(TestDictionaryBuilder, AppendArraySlice) {
+  // The last dictionary value is null
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b", "c", null])");
+  auto indices = ArrayFromJSON(int16(), "[2, 0, null, 2, 1, 3, null, 0]");
+  auto array = std::make_shared<DictionaryArray>(dictionary(int16(), utf8()), indices,
+                                                 dict);
+  auto dense = ArrayFromJSON(utf8(), R"(["d", "a", null])");
+
+  StringDictionaryBuilder builder;
+  ASSERT_OK(builder.AppendArraySlice(*array->data(), 1, 6));
+  ASSERT_OK(builder.AppendArraySlice(*dense->data(), 0, 3));
+  ASSERT_EQ(builder.length(), 9);
+  ASSERT_EQ(builder.null_count(), 4);
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+  ASSERT_OK(result->ValidateFull());
+
+  // Only the referenced dictionary values were memoized, in order of appearance
+  auto expected_dict = ArrayFromJSON(utf8(), R"(["a", "c", "b", "d"])");
+  auto expected_indices =
+      ArrayFromJSON(int8(), "[0, null, 1, 2, null, null, 3, 0, null]");
+  DictionaryArray expected(dictionary(int8(), utf8()), expected_indices, expected_dict);
+  AssertArraysEqual(expected, *result);
+
+  auto other = std::make_shared<DictionaryArray>(
+      dictionary(int16(), binary()), indices,
+      ArrayFromJSON(binary(), R"(["a", "b", "c", "d"])"));
+  ASSERT_RAISES(TypeError, builder.AppendArraySlice(*other->data(), 0, 1));
+}
+
+TEST(TestDictionaryBuilder, AppendArraySliceInt32Indices) {
+  auto dict = ArrayFromJSON(int64(), "[10, 20, 30]");
+  auto indices = ArrayFromJSON(int8(), "[1, 1, null, 0, 2, 0]");
+  auto array = std::make_shared<DictionaryArray>(dictionary(int8(), int64()), indices,
+                                                 dict)->Slice(1);
+
+  Dictionary32Builder<Int64Type> builder;
+  ASSERT_OK(builder.Append(30));
+  ASSERT_OK(builder.AppendArraySlice(*array->data(), 0, array->length()));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+
+  auto expected_dict = ArrayFromJSON(int64(), "[30, 20, 10]");
+  auto expected_indices = ArrayFromJSON(int32(), "[0, 1, null, 2, 0, 2]");
+  DictionaryArray expected(dictionary(int32(), int64()), expected_indices, expected_dict);
+  AssertArraysEqual(expected, *result);
+}
+
 // ----------------------------------------------------------------------
 // DictionaryArray tests
 
@@ -170,6 +170,50 @@ TEST_F(TestArray, SliceRecomputeNullCount) {
   ASSERT_EQ(0, arr->null_count());
 }
 
+TEST_F(TestArray, SliceNullCountLargeArray) {
+  // Slices of large arrays share block counts of the validity bitmap
+  const int64_t length = 1 << 18;
+  random::RandomArrayGenerator rand(0x5a1ce);
+  auto array = rand.Int8(length, 0, 10, /*null_probability=*/0.3);
+  const auto& valid_bytes = array->null_bitmap_data();
+
+  auto expected_null_count = [&](int64_t offset, int64_t slice_length) {
+    int64_t nulls = 0;
+    for (int64_t i = offset; i < offset + slice_length; ++i) {
+      nulls += !BitUtil::GetBit(valid_bytes, i);
+    }
+    return nulls;
+  };
+
+  for (int64_t offset : {0, 1, 4095, 4096, 10000, 100003}) {
+    for (int64_t slice_length : std::vector<int64_t>{0, 1, 4096, 5000, 70000, length}) {
+      auto slice = array->Slice(offset, slice_length);
+      ASSERT_NE(nullptr, slice->data()->validity_counts);
+      ASSERT_EQ(expected_null_count(offset, slice->length()), slice->null_count());
+
+      // Slices of slices share them too
+      auto sub_slice = slice->Slice(slice->length() / 3, slice->length() / 2);
+      ASSERT_EQ(expected_null_count(offset + slice->length() / 3, sub_slice->length()),
+                sub_slice->null_count());
+    }
+  }
+
+  // The counts are ignored once the bitmap is replaced
+  auto slice_data = array->Slice(4096, 70000)->data()->Copy();
+  ASSERT_OK(AllocateEmptyBitmap(length, &slice_data->buffers[0]));
+  slice_data->null_count = kUnknownNullCount;
+  ASSERT_EQ(70000, slice_data->GetNullCount());
+
+  // ... even when the new bitmap is at the address of the old one
+  std::shared_ptr<Buffer> bitmap;
+  ASSERT_OK(AllocateEmptyBitmap(length, &bitmap));
+  auto data = ArrayData::Make(int8(), length, {bitmap, array->data()->buffers[1]});
+  ASSERT_EQ(70000, data->Slice(4096, 70000).GetNullCount());
+  std::memset(bitmap->mutable_data(), 0xff, bitmap->size());
+  data->buffers[0] = std::make_shared<Buffer>(bitmap->data(), bitmap->size());
+  ASSERT_EQ(0, data->Slice(4096, 70000).GetNullCount());
+}
+
 TEST_F(TestArray, NullArraySliceNullCount) {
   auto null_arr = std::make_shared<NullArray>(10);
   auto null_arr_sliced = null_arr->Slice(3, 6);
@@ -2175,4 +2219,92 @@ TEST(TestRechunkArraysConsistently, Plain) {
   }
 }
 
+// ----------------------------------------------------------------------
+// AppendArraySlice tests
+
+// Append a sliced array (so that bitmaps and offsets are unaligned) to a
+// builder in several pieces, and compare the result with the sliced array
+void CheckAppendArraySlice(const std::shared_ptr<Array>& array) {
+  const auto sliced = array->Slice(3);
+  const auto& data = *sliced->data();
+  const int64_t length = sliced->length();
+
+  std::unique_ptr<ArrayBuilder> builder;
+  ASSERT_OK(MakeBuilder(default_memory_pool(), array->type(), &builder));
+  ASSERT_OK(builder->AppendArraySlice(data, 0, 0));
+  ASSERT_OK(builder->AppendArraySlice(data, 0, length / 3));
+  ASSERT_OK(builder->AppendArraySlice(data, length / 3, length - length / 3));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder->Finish(&result));
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*sliced, *result, /*verbose=*/true);
+}
+
+void CheckAppendArraySlice(const std::shared_ptr<DataType>& type,
+                           const std::string& json) {
+  CheckAppendArraySlice(ArrayFromJSON(type, json));
+}
+
+TEST(TestAppendArraySlice, Primitive) {
+  CheckAppendArraySlice(null(), "[null, null, null, null, null, null]");
+  CheckAppendArraySlice(int8(), "[1, 2, null, 4, 5, null, 7, 8]");
+  CheckAppendArraySlice(float64(), "[1.5, null, 2.5, null, 3.5, 4.5, 5.5]");
+  CheckAppendArraySlice(boolean(), "[true, false, null, true, true, null, false]");
+  CheckAppendArraySlice(date32(), "[0, 1, null, 3, 4, 5]");
+
+  random::RandomArrayGenerator rand(0x5eed);
+  CheckAppendArraySlice(rand.Int64(1000, -100, 100, 0.1));
+  CheckAppendArraySlice(rand.Int32(1000, -100, 100, 0));
+  CheckAppendArraySlice(rand.Boolean(1000, 0.5, 0.1));
+}
+
+TEST(TestAppendArraySlice, Binary) {
+  for (const auto& type : {utf8(), binary(), large_utf8(), large_binary()}) {
+    CheckAppendArraySlice(type, R"(["a", "bc", null, "", "def", null, "gh", "ijk"])");
+  }
+  CheckAppendArraySlice(fixed_size_binary(3),
+                        R"(["abc", "def", null, "ghi", null, "jkl", "mno"])");
+  CheckAppendArraySlice(decimal(5, 2), R"(["1.23", "-4.56", null, "7.89", "0.00"])");
+
+  random::RandomArrayGenerator rand(0x5eed);
+  CheckAppendArraySlice(rand.String(1000, 0, 10, 0.1));
+}
+
+TEST(TestAppendArraySlice, Nested) {
+  CheckAppendArraySlice(list(int32()),
+                        "[[1, 2], null, [], [3], [4, null, 5], null, [6, 7, 8]]");
+  CheckAppendArraySlice(large_list(utf8()),
+                        R"([["a"], null, [], ["b", null], ["c", "d"], ["e"]])");
+  CheckAppendArraySlice(fixed_size_list(int16(), 2),
+                        "[[1, 2], null, [3, null], [4, 5], null, [6, 7], [8, 9]]");
+  CheckAppendArraySlice(map(utf8(), int32()),
+                        R"([[["a", 1]], null, [], [["b", 2], ["c", null]], [["d", 4]],
+                            [["e", 5], ["f", 6]]])");
+  CheckAppendArraySlice(struct_({field("a", int32()), field("b", list(utf8()))}),
+                        R"([{"a": 1, "b": ["x"]}, null, {"a": null, "b": []},
+                            {"a": 3, "b": null}, {"a": 4, "b": ["y", "z"]},
+                            null, {"a": 6, "b": ["w"]}])");
+}
+
+TEST(TestAppendArraySlice, Union) {
+  const auto fields = {field("a", int32()), field("b", utf8())};
+  for (const auto mode : {UnionMode::SPARSE, UnionMode::DENSE}) {
+    CheckAppendArraySlice(union_(fields, {4, 8}, mode),
+                          R"([[4, 1], [8, "x"], null, [4, null], [8, "yz"], [4, 5],
+                              [4, 6], null, [8, ""], [4, 7]])");
+  }
+}
+
+TEST(TestAppendArraySlice, Errors) {
+  auto array = ArrayFromJSON(int32(), "[1, 2, 3]");
+  Int32Builder builder;
+  ASSERT_RAISES(IndexError, builder.AppendArraySlice(*array->data(), 2, 2));
+  ASSERT_RAISES(IndexError, builder.AppendArraySlice(*array->data(), -1, 1));
+  ASSERT_RAISES(IndexError, builder.AppendArraySlice(*array->data(), 0, -1));
+  ASSERT_EQ(builder.length(), 0);
+
+  AdaptiveIntBuilder adaptive_builder;
+  ASSERT_RAISES(NotImplemented, adaptive_builder.AppendArraySlice(*array->data(), 0, 1));
+}
+
 }  // namespace arrow
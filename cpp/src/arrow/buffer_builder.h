@@ -277,6 +277,12 @@ class TypedBufferBuilder<bool> {
     return Status::OK();
   }
 
+  Status AppendBitmap(const uint8_t* bitmap, int64_t offset, int64_t num_elements) {
+    ARROW_RETURN_NOT_OK(Reserve(num_elements));
+    UnsafeAppendBitmap(bitmap, offset, num_elements);
+    return Status::OK();
+  }
+
   void UnsafeAppend(bool value) {
     BitUtil::SetBitTo(mutable_data(), bit_length_, value);
     if (!value) {
@@ -302,6 +308,14 @@ class TypedBufferBuilder<bool> {
     bit_length_ += num_copies;
   }
 
+  /// \brief Append a range of bits of an existing bitmap, a word at a time
+  void UnsafeAppendBitmap(const uint8_t* bitmap, int64_t offset, int64_t num_elements) {
+    if (num_elements == 0) return;
+    internal::CopyBitmap(bitmap, offset, num_elements, mutable_data(), bit_length_);
+    false_count_ += num_elements - internal::CountSetBits(bitmap, offset, num_elements);
+    bit_length_ += num_elements;
+  }
+
   template <bool count_falses, typename Generator>
   void UnsafeAppend(const int64_t num_elements, Generator&& gen) {
     if (num_elements == 0) return;
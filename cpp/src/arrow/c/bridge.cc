@@ -0,0 +1,1588 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/c/bridge.h"
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/c/helpers.h"
+#include "arrow/extension_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parsing.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace {
+
+// Nesting depth beyond which imported structs are deemed malformed
+constexpr int kMaxImportRecursionLevel = 64;
+
+Status ExportingNotImplemented(const DataType& type) {
+  return Status::NotImplemented("Exporting ", type.ToString(), " array not supported");
+}
+
+//////////////////////////////////////////////////////////////////////////
+// C schema export
+
+// Custom metadata is encoded as an int32 number of key-value pairs, followed
+// by each key and value as an int32 length and the (non null-terminated) bytes,
+// all integers being in native endianness
+std::string EncodeMetadata(const KeyValueMetadata& metadata) {
+  std::string encoded;
+  auto append_int32 = [&](int32_t v) {
+    encoded.append(reinterpret_cast<const char*>(&v), sizeof(int32_t));
+  };
+  auto append_string = [&](const std::string& s) {
+    append_int32(static_cast<int32_t>(s.size()));
+    encoded.append(s);
+  };
+  append_int32(static_cast<int32_t>(metadata.size()));
+  for (int64_t i = 0; i < metadata.size(); ++i) {
+    append_string(metadata.key(i));
+    append_string(metadata.value(i));
+  }
+  return encoded;
+}
+
+struct ExportedSchemaPrivateData {
+  std::string format_;
+  std::string name_;
+  std::string metadata_;
+  struct ArrowSchema dictionary_;
+  std::vector<struct ArrowSchema> children_;
+  std::vector<struct ArrowSchema*> child_pointers_;
+
+  ExportedSchemaPrivateData() = default;
+  ARROW_DEFAULT_MOVE_AND_ASSIGN(ExportedSchemaPrivateData);
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ExportedSchemaPrivateData);
+};
+
+void ReleaseExportedSchema(struct ArrowSchema* schema) {
+  if (ArrowSchemaIsReleased(schema)) {
+    return;
+  }
+  // Children and dictionary may have been moved out by the consumer
+  for (int64_t i = 0; i < schema->n_children; ++i) {
+    ArrowSchemaRelease(schema->children[i]);
+  }
+  if (schema->dictionary != nullptr) {
+    ArrowSchemaRelease(schema->dictionary);
+  }
+  delete reinterpret_cast<ExportedSchemaPrivateData*>(schema->private_data);
+  ArrowSchemaMarkReleased(schema);
+}
+
+class SchemaExporter {
+ public:
+  Status ExportField(const Field& field) {
+    export_.name_ = field.name();
+    flags_ = field.nullable() ? ARROW_FLAG_NULLABLE : 0;
+    RETURN_NOT_OK(ExportDataType(*field.type()));
+    return ExportMetadata(field.metadata().get());
+  }
+
+  Status ExportType(const DataType& type) {
+    flags_ = ARROW_FLAG_NULLABLE;
+    RETURN_NOT_OK(ExportDataType(type));
+    return ExportMetadata(nullptr);
+  }
+
+  Status ExportSchema(const Schema& schema) {
+    flags_ = 0;
+    export_.format_ = "+s";
+    RETURN_NOT_OK(ExportChildren(schema.fields()));
+    return ExportMetadata(schema.metadata().get());
+  }
+
+  // Finalize exporting by setting C struct fields and allocating
+  // autonomous private data for each schema node.
+  //
+  // This function can't fail, as properly reclaiming memory in case of error
+  // would be too fragile.  After this function returns, memory is reclaimed
+  // by calling the release() pointer in the top level ArrowSchema struct.
+  void Finish(struct ArrowSchema* c_struct) {
+    // First, create permanent ExportedSchemaPrivateData
+    auto pdata = new ExportedSchemaPrivateData(std::move(export_));
+
+    // Second, finish dictionary and children.
+    if (dict_exporter_) {
+      dict_exporter_->Finish(&pdata->dictionary_);
+    }
+    pdata->children_.resize(child_exporters_.size());
+    pdata->child_pointers_.resize(child_exporters_.size(), nullptr);
+    for (size_t i = 0; i < child_exporters_.size(); ++i) {
+      auto ptr = pdata->child_pointers_[i] = &pdata->children_[i];
+      child_exporters_[i].Finish(ptr);
+    }
+
+    // Third, fill C struct.
+    DCHECK_NE(c_struct, nullptr);
+    memset(c_struct, 0, sizeof(*c_struct));
+
+    c_struct->format = pdata->format_.c_str();
+    c_struct->name = pdata->name_.c_str();
+    c_struct->metadata = pdata->metadata_.empty() ? nullptr : pdata->metadata_.c_str();
+    c_struct->flags = flags_;
+
+    c_struct->n_children = static_cast<int64_t>(child_exporters_.size());
+    c_struct->children = pdata->child_pointers_.data();
+    c_struct->dictionary = dict_exporter_ ? &pdata->dictionary_ : nullptr;
+    c_struct->private_data = pdata;
+    c_struct->release = ReleaseExportedSchema;
+  }
+
+  // Type-specific visitors, setting the format string and flags
+
+  Status Visit(const DataType& type) { return ExportingNotImplemented(type); }
+
+  Status Visit(const NullType& type) { return SetFormat("n"); }
+
+  Status Visit(const BooleanType& type) { return SetFormat("b"); }
+
+  Status Visit(const Int8Type& type) { return SetFormat("c"); }
+
+  Status Visit(const UInt8Type& type) { return SetFormat("C"); }
+
+  Status Visit(const Int16Type& type) { return SetFormat("s"); }
+
+  Status Visit(const UInt16Type& type) { return SetFormat("S"); }
+
+  Status Visit(const Int32Type& type) { return SetFormat("i"); }
+
+  Status Visit(const UInt32Type& type) { return SetFormat("I"); }
+
+  Status Visit(const Int64Type& type) { return SetFormat("l"); }
+
+  Status Visit(const UInt64Type& type) { return SetFormat("L"); }
+
+  Status Visit(const HalfFloatType& type) { return SetFormat("e"); }
+
+  Status Visit(const FloatType& type) { return SetFormat("f"); }
+
+  Status Visit(const DoubleType& type) { return SetFormat("g"); }
+
+  Status Visit(const FixedSizeBinaryType& type) {
+    return SetFormat("w:" + std::to_string(type.byte_width()));
+  }
+
+  Status Visit(const Decimal128Type& type) {
+    return SetFormat("d:" + std::to_string(type.precision()) + "," +
+                     std::to_string(type.scale()));
+  }
+
+  Status Visit(const BinaryType& type) { return SetFormat("z"); }
+
+  Status Visit(const LargeBinaryType& type) { return SetFormat("Z"); }
+
+  Status Visit(const StringType& type) { return SetFormat("u"); }
+
+  Status Visit(const LargeStringType& type) { return SetFormat("U"); }
+
+  Status Visit(const Date32Type& type) { return SetFormat("tdD"); }
+
+  Status Visit(const Date64Type& type) { return SetFormat("tdm"); }
+
+  Status Visit(const Time32Type& type) {
+    switch (type.unit()) {
+      case TimeUnit::SECOND:
+        return SetFormat("tts");
+      case TimeUnit::MILLI:
+        return SetFormat("ttm");
+      default:
+        return Status::Invalid("Invalid time unit for Time32: ", type.unit());
+    }
+  }
+
+  Status Visit(const Time64Type& type) {
+    switch (type.unit()) {
+      case TimeUnit::MICRO:
+        return SetFormat("ttu");
+      case TimeUnit::NANO:
+        return SetFormat("ttn");
+      default:
+        return Status::Invalid("Invalid time unit for Time64: ", type.unit());
+    }
+  }
+
+  Status Visit(const TimestampType& type) {
+    return SetFormat("ts" + UnitFormat(type.unit()) + ":" + type.timezone());
+  }
+
+  Status Visit(const DurationType& type) {
+    return SetFormat("tD" + UnitFormat(type.unit()));
+  }
+
+  Status Visit(const MonthIntervalType& type) { return SetFormat("tiM"); }
+
+  Status Visit(const DayTimeIntervalType& type) { return SetFormat("tiD"); }
+
+  Status Visit(const ListType& type) { return SetFormat("+l"); }
+
+  Status Visit(const LargeListType& type) { return SetFormat("+L"); }
+
+  Status Visit(const FixedSizeListType& type) {
+    return SetFormat("+w:" + std::to_string(type.list_size()));
+  }
+
+  Status Visit(const StructType& type) { return SetFormat("+s"); }
+
+  Status Visit(const MapType& type) {
+    if (type.keys_sorted()) {
+      flags_ |= ARROW_FLAG_MAP_KEYS_SORTED;
+    }
+    return SetFormat("+m");
+  }
+
+  Status Visit(const UnionType& type) {
+    std::string format = type.mode() == UnionMode::SPARSE ? "+us:" : "+ud:";
+    bool first = true;
+    for (const auto code : type.type_codes()) {
+      if (!first) {
+        format += ",";
+      }
+      format += std::to_string(code);
+      first = false;
+    }
+    return SetFormat(std::move(format));
+  }
+
+  Status Visit(const DictionaryType& type) {
+    if (type.ordered()) {
+      flags_ |= ARROW_FLAG_DICTIONARY_ORDERED;
+    }
+    // Dictionary type is exported as its index type, pointing to the value type
+    dict_exporter_.reset(new SchemaExporter());
+    RETURN_NOT_OK(dict_exporter_->ExportType(*type.value_type()));
+    return VisitTypeInline(*type.index_type(), this);
+  }
+
+ protected:
+  Status ExportDataType(const DataType& type) {
+    const DataType* storage_type = &type;
+    if (type.id() == Type::EXTENSION) {
+      // Extension types are exported as their storage type, the extension
+      // being described in the field metadata as in the IPC format
+      const auto& ext_type = checked_cast<const ExtensionType&>(type);
+      extension_ = &ext_type;
+      storage_type = ext_type.storage_type().get();
+    }
+    RETURN_NOT_OK(VisitTypeInline(*storage_type, this));
+    return ExportChildren(storage_type->children());
+  }
+
+  Status ExportChildren(const std::vector<std::shared_ptr<Field>>& fields) {
+    child_exporters_.resize(fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+      RETURN_NOT_OK(child_exporters_[i].ExportField(*fields[i]));
+    }
+    return Status::OK();
+  }
+
+  Status ExportMetadata(const KeyValueMetadata* metadata) {
+    if (extension_ != nullptr) {
+      auto ext_metadata = metadata != nullptr ? metadata->Copy()
+                                              : std::make_shared<KeyValueMetadata>();
+      ext_metadata->Append(kExtensionTypeKeyName, extension_->extension_name());
+      ext_metadata->Append(kExtensionMetadataKeyName, extension_->Serialize());
+      export_.metadata_ = EncodeMetadata(*ext_metadata);
+    } else if (metadata != nullptr && metadata->size() > 0) {
+      export_.metadata_ = EncodeMetadata(*metadata);
+    }
+    return Status::OK();
+  }
+
+  Status SetFormat(std::string s) {
+    export_.format_ = std::move(s);
+    return Status::OK();
+  }
+
+  static std::string UnitFormat(TimeUnit::type unit) {
+    switch (unit) {
+      case TimeUnit::SECOND:
+        return "s";
+      case TimeUnit::MILLI:
+        return "m";
+      case TimeUnit::MICRO:
+        return "u";
+      case TimeUnit::NANO:
+        return "n";
+    }
+    return "";
+  }
+
+  ExportedSchemaPrivateData export_;
+  int64_t flags_ = 0;
+  const ExtensionType* extension_ = nullptr;
+  std::unique_ptr<SchemaExporter> dict_exporter_;
+  std::vector<SchemaExporter> child_exporters_;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// C data export
+
+struct ExportedArrayPrivateData {
+  // The buffers and the children are kept alive by the ArrayData
+  std::shared_ptr<ArrayData> data_;
+  std::vector<const void*> buffers_;
+  struct ArrowArray dictionary_;
+  std::vector<struct ArrowArray> children_;
+  std::vector<struct ArrowArray*> child_pointers_;
+
+  ExportedArrayPrivateData() = default;
+  ARROW_DEFAULT_MOVE_AND_ASSIGN(ExportedArrayPrivateData);
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ExportedArrayPrivateData);
+};
+
+void ReleaseExportedArray(struct ArrowArray* array) {
+  if (ArrowArrayIsReleased(array)) {
+    return;
+  }
+  // Children and dictionary may have been moved out by the consumer
+  for (int64_t i = 0; i < array->n_children; ++i) {
+    ArrowArrayRelease(array->children[i]);
+  }
+  if (array->dictionary != nullptr) {
+    ArrowArrayRelease(array->dictionary);
+  }
+  delete reinterpret_cast<ExportedArrayPrivateData*>(array->private_data);
+  ArrowArrayMarkReleased(array);
+}
+
+class ArrayExporter {
+ public:
+  Status Export(const std::shared_ptr<ArrayData>& data) {
+    // Store buffer pointers, leaving out the buffers which the C data interface
+    // doesn't represent (the sole buffer of null arrays, the offsets of sparse
+    // unions).  The memory must be addressable by the consumer.
+    const auto layout = data->type->layout();
+    for (size_t i = 0; i < data->buffers.size(); ++i) {
+      if (i < layout.buffers.size() &&
+          layout.buffers[i].kind == DataTypeLayout::ALWAYS_NULL) {
+        continue;
+      }
+      const auto& buffer = data->buffers[i];
+      if (buffer != nullptr && !buffer->is_cpu()) {
+        return Status::NotImplemented("Exporting ", data->type->ToString(),
+                                      " array with non-CPU buffer");
+      }
+      export_.buffers_.push_back(buffer ? buffer->data() : nullptr);
+    }
+
+    // Export dictionary
+    if (data->type->id() == Type::DICTIONARY ||
+        (data->type->id() == Type::EXTENSION &&
+         checked_cast<const ExtensionType&>(*data->type).storage_type()->id() ==
+             Type::DICTIONARY)) {
+      if (data->dictionary == nullptr) {
+        return Status::Invalid("Dictionary array has no dictionary");
+      }
+      dict_exporter_.reset(new ArrayExporter());
+      RETURN_NOT_OK(dict_exporter_->Export(data->dictionary->data()));
+    }
+
+    // Export children
+    child_exporters_.resize(data->child_data.size());
+    for (size_t i = 0; i < data->child_data.size(); ++i) {
+      RETURN_NOT_OK(child_exporters_[i].Export(data->child_data[i]));
+    }
+
+    export_.data_ = data;
+    return Status::OK();
+  }
+
+  // Finalize exporting by setting C struct fields and allocating
+  // autonomous private data for each array node.
+  //
+  // This function can't fail, as properly reclaiming memory in case of error
+  // would be too fragile.  After this function returns, memory is reclaimed
+  // by calling the release() pointer in the top level ArrowArray struct.
+  void Finish(struct ArrowArray* c_struct) {
+    // First, create permanent ExportedArrayPrivateData, to make sure that
+    // child ArrayData pointers don't get invalidated.
+    auto pdata = new ExportedArrayPrivateData(std::move(export_));
+    const ArrayData& data = *pdata->data_;
+
+    // Second, finish dictionary and children.
+    if (dict_exporter_) {
+      dict_exporter_->Finish(&pdata->dictionary_);
+    }
+    pdata->children_.resize(child_exporters_.size());
+    pdata->child_pointers_.resize(child_exporters_.size(), nullptr);
+    for (size_t i = 0; i < child_exporters_.size(); ++i) {
+      auto ptr = pdata->child_pointers_[i] = &pdata->children_[i];
+      child_exporters_[i].Finish(ptr);
+    }
+
+    // Third, fill C struct.
+    DCHECK_NE(c_struct, nullptr);
+    memset(c_struct, 0, sizeof(*c_struct));
+
+    c_struct->length = data.length;
+    c_struct->null_count = data.null_count.load();
+    c_struct->offset = data.offset;
+    c_struct->n_buffers = static_cast<int64_t>(pdata->buffers_.size());
+    c_struct->n_children = static_cast<int64_t>(pdata->child_pointers_.size());
+    c_struct->buffers = pdata->buffers_.data();
+    c_struct->children = pdata->child_pointers_.data();
+    c_struct->dictionary = dict_exporter_ ? &pdata->dictionary_ : nullptr;
+    c_struct->private_data = pdata;
+    c_struct->release = ReleaseExportedArray;
+  }
+
+ protected:
+  ExportedArrayPrivateData export_;
+  std::unique_ptr<ArrayExporter> dict_exporter_;
+  std::vector<ArrayExporter> child_exporters_;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// C stream export
+
+class ExportedArrayStream {
+ public:
+  struct PrivateData {
+    explicit PrivateData(std::shared_ptr<RecordBatchReader> reader)
+        : reader_(std::move(reader)) {}
+
+    std::shared_ptr<RecordBatchReader> reader_;
+    std::string last_error_;
+  };
+
+  explicit ExportedArrayStream(struct ArrowArrayStream* stream) : stream_(stream) {}
+
+  Status GetSchema(struct ArrowSchema* out_schema) {
+    return ExportSchema(*reader()->schema(), out_schema);
+  }
+
+  Status GetNext(struct ArrowArray* out_array) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader()->ReadNext(&batch));
+    if (batch == nullptr) {
+      // End of stream
+      ArrowArrayMarkReleased(out_array);
+      return Status::OK();
+    }
+    return ExportRecordBatch(*batch, out_array);
+  }
+
+  const char* GetLastError() {
+    const auto& last_error = private_data()->last_error_;
+    return last_error.empty() ? nullptr : last_error.c_str();
+  }
+
+  void Release() {
+    if (ArrowArrayStreamIsReleased(stream_)) {
+      return;
+    }
+    DCHECK_NE(private_data(), nullptr);
+    delete private_data();
+    ArrowArrayStreamMarkReleased(stream_);
+  }
+
+  // C-compatible callbacks
+
+  static int StaticGetSchema(struct ArrowArrayStream* stream,
+                             struct ArrowSchema* out_schema) {
+    ExportedArrayStream self{stream};
+    return self.ToCError(self.GetSchema(out_schema));
+  }
+
+  static int StaticGetNext(struct ArrowArrayStream* stream,
+                           struct ArrowArray* out_array) {
+    ExportedArrayStream self{stream};
+    return self.ToCError(self.GetNext(out_array));
+  }
+
+  static void StaticRelease(struct ArrowArrayStream* stream) {
+    ExportedArrayStream{stream}.Release();
+  }
+
+  static const char* StaticGetLastError(struct ArrowArrayStream* stream) {
+    return ExportedArrayStream{stream}.GetLastError();
+  }
+
+ private:
+  int ToCError(const Status& status) {
+    if (ARROW_PREDICT_TRUE(status.ok())) {
+      private_data()->last_error_.clear();
+      return 0;
+    }
+    private_data()->last_error_ = status.ToString();
+    switch (status.code()) {
+      case StatusCode::IOError:
+        return EIO;
+      case StatusCode::NotImplemented:
+        return ENOSYS;
+      case StatusCode::OutOfMemory:
+        return ENOMEM;
+      default:
+        return EINVAL;  // Fallback for Invalid, TypeError, etc.
+    }
+  }
+
+  PrivateData* private_data() {
+    return reinterpret_cast<PrivateData*>(stream_->private_data);
+  }
+
+  const std::shared_ptr<RecordBatchReader>& reader() { return private_data()->reader_; }
+
+  struct ArrowArrayStream* stream_;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// C schema import
+
+class FormatStringParser {
+ public:
+  FormatStringParser() {}
+
+  explicit FormatStringParser(util::string_view v) : view_(v), index_(0) {}
+
+  bool AtEnd() const { return index_ >= view_.length(); }
+
+  char Next() { return view_[index_++]; }
+
+  util::string_view Rest() { return view_.substr(index_); }
+
+  Status CheckNext(char c) {
+    if (AtEnd() || Next() != c) {
+      return Invalid();
+    }
+    return Status::OK();
+  }
+
+  Status CheckHasNext() {
+    if (AtEnd()) {
+      return Invalid();
+    }
+    return Status::OK();
+  }
+
+  Status CheckAtEnd() {
+    if (!AtEnd()) {
+      return Invalid();
+    }
+    return Status::OK();
+  }
+
+  template <typename IntType = int32_t>
+  Result<IntType> ParseInt(util::string_view v) {
+    using ArrowIntType = typename CTypeTraits<IntType>::ArrowType;
+    IntType value;
+    if (!internal::StringConverter<ArrowIntType>()(v.data(), v.size(), &value)) {
+      return Invalid();
+    }
+    return value;
+  }
+
+  Result<TimeUnit::type> ParseTimeUnit() {
+    RETURN_NOT_OK(CheckHasNext());
+    switch (Next()) {
+      case 's':
+        return TimeUnit::SECOND;
+      case 'm':
+        return TimeUnit::MILLI;
+      case 'u':
+        return TimeUnit::MICRO;
+      case 'n':
+        return TimeUnit::NANO;
+      default:
+        return Invalid();
+    }
+  }
+
+  std::vector<util::string_view> Split(util::string_view v, char delim = ',') {
+    std::vector<util::string_view> parts;
+    size_t start = 0, end;
+    while (true) {
+      end = v.find_first_of(delim, start);
+      parts.push_back(v.substr(start, end - start));
+      if (end == util::string_view::npos) {
+        break;
+      }
+      start = end + 1;
+    }
+    return parts;
+  }
+
+  template <typename IntType = int32_t>
+  Result<std::vector<IntType>> ParseInts(util::string_view v) {
+    std::vector<IntType> result;
+    for (const auto& part : Split(v)) {
+      ARROW_ASSIGN_OR_RAISE(auto i, ParseInt<IntType>(part));
+      result.push_back(i);
+    }
+    return result;
+  }
+
+  Status Invalid() {
+    return Status::Invalid("Invalid or unsupported format string: '", view_, "'");
+  }
+
+ protected:
+  util::string_view view_;
+  size_t index_;
+};
+
+Result<std::shared_ptr<KeyValueMetadata>> DecodeMetadata(const char* metadata) {
+  auto read_int32 = [&](int32_t* out) -> Status {
+    int32_t v;
+    memcpy(&v, metadata, sizeof(int32_t));
+    metadata += sizeof(int32_t);
+    *out = v;
+    if (*out < 0) {
+      return Status::Invalid("Invalid encoded metadata string");
+    }
+    return Status::OK();
+  };
+
+  auto read_string = [&](std::string* out) -> Status {
+    int32_t len;
+    RETURN_NOT_OK(read_int32(&len));
+    out->resize(len);
+    if (len > 0) {
+      memcpy(&(*out)[0], metadata, len);
+      metadata += len;
+    }
+    return Status::OK();
+  };
+
+  if (metadata == nullptr) {
+    return nullptr;
+  }
+  int32_t npairs;
+  RETURN_NOT_OK(read_int32(&npairs));
+  if (npairs == 0) {
+    return nullptr;
+  }
+  std::vector<std::string> keys(npairs);
+  std::vector<std::string> values(npairs);
+  for (int32_t i = 0; i < npairs; ++i) {
+    RETURN_NOT_OK(read_string(&keys[i]));
+    RETURN_NOT_OK(read_string(&values[i]));
+  }
+  return std::make_shared<KeyValueMetadata>(std::move(keys), std::move(values));
+}
+
+class SchemaImporter {
+ public:
+  SchemaImporter() : c_struct_(nullptr) {}
+
+  Status Import(struct ArrowSchema* src) {
+    if (ArrowSchemaIsReleased(src)) {
+      return Status::Invalid("Cannot import released ArrowSchema");
+    }
+    recursion_level_ = 0;
+    c_struct_ = src;
+    // Everything is copied out of the C struct, which can be released
+    // right after importing, whether it succeeded or not
+    Status st = DoImport();
+    ArrowSchemaRelease(src);
+    c_struct_ = nullptr;
+    return st;
+  }
+
+  Result<std::shared_ptr<Field>> MakeField() const {
+    const bool nullable = (flags_ & ARROW_FLAG_NULLABLE) != 0;
+    return field(name_, type_, nullable, metadata_);
+  }
+
+  Result<std::shared_ptr<Schema>> MakeSchema() const {
+    if (type_->id() != Type::STRUCT) {
+      return Status::Invalid(
+          "Cannot import schema: ArrowSchema describes non-struct type ",
+          type_->ToString());
+    }
+    return schema(type_->children(), metadata_);
+  }
+
+  Result<std::shared_ptr<DataType>> MakeType() const { return type_; }
+
+ protected:
+  Status ImportChild(const SchemaImporter* parent, struct ArrowSchema* src) {
+    if (ArrowSchemaIsReleased(src)) {
+      return Status::Invalid("Cannot import released ArrowSchema");
+    }
+    recursion_level_ = parent->recursion_level_ + 1;
+    if (recursion_level_ >= kMaxImportRecursionLevel) {
+      return Status::Invalid("Recursion level in ArrowSchema struct exceeded");
+    }
+    // The ArrowSchema is owned by its parent, so it's not moved
+    c_struct_ = src;
+    return DoImport();
+  }
+
+  Status DoImport() {
+    if (c_struct_->format == nullptr) {
+      return Status::Invalid("Cannot import ArrowSchema with null format string");
+    }
+    if (c_struct_->name != nullptr) {
+      name_ = c_struct_->name;
+    }
+    flags_ = c_struct_->flags;
+
+    // First import children (required for reconstituting parent type)
+    child_importers_.resize(c_struct_->n_children);
+    for (int64_t i = 0; i < c_struct_->n_children; ++i) {
+      DCHECK_NE(c_struct_->children[i], nullptr);
+      RETURN_NOT_OK(child_importers_[i].ImportChild(this, c_struct_->children[i]));
+    }
+
+    // Import main type
+    RETURN_NOT_OK(ProcessFormat());
+    DCHECK_NE(type_, nullptr);
+
+    // Import dictionary type
+    if (c_struct_->dictionary != nullptr) {
+      // Check this index type
+      if (!is_integer(type_->id())) {
+        return Status::Invalid(
+            "ArrowSchema struct has a dictionary but is not an integer type: ",
+            type_->ToString());
+      }
+      SchemaImporter dict_importer;
+      RETURN_NOT_OK(dict_importer.ImportChild(this, c_struct_->dictionary));
+      const bool ordered = (flags_ & ARROW_FLAG_DICTIONARY_ORDERED) != 0;
+      ARROW_ASSIGN_OR_RAISE(type_,
+                            DictionaryType::Make(type_, dict_importer.type_, ordered));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(metadata_, DecodeMetadata(c_struct_->metadata));
+    return ImportExtension();
+  }
+
+  // Wrap the imported type in the registered extension type named in the
+  // metadata, if any.  Unknown extension types are imported as their storage
+  // type, keeping the metadata intact as the IPC reader does.
+  Status ImportExtension() {
+    if (metadata_ == nullptr) {
+      return Status::OK();
+    }
+    int name_index = metadata_->FindKey(kExtensionTypeKeyName);
+    if (name_index == -1) {
+      return Status::OK();
+    }
+    std::shared_ptr<ExtensionType> ext_type =
+        GetExtensionType(metadata_->value(name_index));
+    if (ext_type == nullptr) {
+      return Status::OK();
+    }
+    int data_index = metadata_->FindKey(kExtensionMetadataKeyName);
+    std::string serialized = data_index == -1 ? "" : metadata_->value(data_index);
+    return ext_type->Deserialize(type_, serialized, &type_);
+  }
+
+  Status ProcessFormat() {
+    f_parser_ = FormatStringParser(c_struct_->format);
+    RETURN_NOT_OK(f_parser_.CheckHasNext());
+    switch (f_parser_.Next()) {
+      case 'n':
+        return ProcessPrimitive(null());
+      case 'b':
+        return ProcessPrimitive(boolean());
+      case 'c':
+        return ProcessPrimitive(int8());
+      case 'C':
+        return ProcessPrimitive(uint8());
+      case 's':
+        return ProcessPrimitive(int16());
+      case 'S':
+        return ProcessPrimitive(uint16());
+      case 'i':
+        return ProcessPrimitive(int32());
+      case 'I':
+        return ProcessPrimitive(uint32());
+      case 'l':
+        return ProcessPrimitive(int64());
+      case 'L':
+        return ProcessPrimitive(uint64());
+      case 'e':
+        return ProcessPrimitive(float16());
+      case 'f':
+        return ProcessPrimitive(float32());
+      case 'g':
+        return ProcessPrimitive(float64());
+      case 'u':
+        return ProcessPrimitive(utf8());
+      case 'U':
+        return ProcessPrimitive(large_utf8());
+      case 'z':
+        return ProcessPrimitive(binary());
+      case 'Z':
+        return ProcessPrimitive(large_binary());
+      case 'w':
+        return ProcessFixedSizeBinary();
+      case 'd':
+        return ProcessDecimal();
+      case 't':
+        return ProcessTemporal();
+      case '+':
+        return ProcessNested();
+    }
+    return f_parser_.Invalid();
+  }
+
+  Status ProcessTemporal() {
+    RETURN_NOT_OK(f_parser_.CheckHasNext());
+    switch (f_parser_.Next()) {
+      case 'd':
+        return ProcessDate();
+      case 't':
+        return ProcessTime();
+      case 'D':
+        return ProcessDuration();
+      case 'i':
+        return ProcessInterval();
+      case 's':
+        return ProcessTimestamp();
+    }
+    return f_parser_.Invalid();
+  }
+
+  Status ProcessNested() {
+    RETURN_NOT_OK(f_parser_.CheckHasNext());
+    switch (f_parser_.Next()) {
+      case 'l':
+        return ProcessListLike<ListType>();
+      case 'L':
+        return ProcessListLike<LargeListType>();
+      case 'w':
+        return ProcessFixedSizeList();
+      case 's':
+        return ProcessStruct();
+      case 'm':
+        return ProcessMap();
+      case 'u':
+        return ProcessUnion();
+    }
+    return f_parser_.Invalid();
+  }
+
+  Status ProcessDate() {
+    RETURN_NOT_OK(f_parser_.CheckHasNext());
+    switch (f_parser_.Next()) {
+      case 'D':
+        return ProcessPrimitive(date32());
+      case 'm':
+        return ProcessPrimitive(date64());
+    }
+    return f_parser_.Invalid();
+  }
+
+  Status ProcessInterval() {
+    RETURN_NOT_OK(f_parser_.CheckHasNext());
+    switch (f_parser_.Next()) {
+      case 'D':
+        return ProcessPrimitive(day_time_interval());
+      case 'M':
+        return ProcessPrimitive(month_interval());
+    }
+    return f_parser_.Invalid();
+  }
+
+  Status ProcessTime() {
+    ARROW_ASSIGN_OR_RAISE(auto unit, f_parser_.ParseTimeUnit());
+    if (unit == TimeUnit::SECOND || unit == TimeUnit::MILLI) {
+      return ProcessPrimitive(time32(unit));
+    } else {
+      return ProcessPrimitive(time64(unit));
+    }
+  }
+
+  Status ProcessDuration() {
+    ARROW_ASSIGN_OR_RAISE(auto unit, f_parser_.ParseTimeUnit());
+    return ProcessPrimitive(duration(unit));
+  }
+
+  Status ProcessTimestamp() {
+    ARROW_ASSIGN_OR_RAISE(auto unit, f_parser_.ParseTimeUnit());
+    RETURN_NOT_OK(f_parser_.CheckNext(':'));
+    type_ = timestamp(unit, std::string(f_parser_.Rest()));
+    return Status::OK();
+  }
+
+  Status ProcessFixedSizeBinary() {
+    RETURN_NOT_OK(f_parser_.CheckNext(':'));
+    ARROW_ASSIGN_OR_RAISE(auto byte_width, f_parser_.ParseInt(f_parser_.Rest()));
+    if (byte_width < 0) {
+      return f_parser_.Invalid();
+    }
+    type_ = fixed_size_binary(byte_width);
+    return Status::OK();
+  }
+
+  Status ProcessDecimal() {
+    RETURN_NOT_OK(f_parser_.CheckNext(':'));
+    ARROW_ASSIGN_OR_RAISE(auto prec_scale, f_parser_.ParseInts(f_parser_.Rest()));
+    // A third component, if any, is the bit width, and only 128 is supported
+    if (prec_scale.size() == 3 && prec_scale[2] == 128) {
+      prec_scale.pop_back();
+    }
+    if (prec_scale.size() != 2) {
+      return f_parser_.Invalid();
+    }
+    if (prec_scale[0] <= 0 || prec_scale[1] < 0) {
+      return f_parser_.Invalid();
+    }
+    type_ = decimal(prec_scale[0], prec_scale[1]);
+    return Status::OK();
+  }
+
+  Status ProcessPrimitive(const std::shared_ptr<DataType>& type) {
+    RETURN_NOT_OK(f_parser_.CheckAtEnd());
+    type_ = type;
+    return CheckNoChildren(type);
+  }
+
+  template <typename ListType>
+  Status ProcessListLike() {
+    RETURN_NOT_OK(f_parser_.CheckAtEnd());
+    RETURN_NOT_OK(CheckNumChildren(1));
+    ARROW_ASSIGN_OR_RAISE(auto field, MakeChildField(0));
+    type_ = std::make_shared<ListType>(field);
+    return Status::OK();
+  }
+
+  Status ProcessMap() {
+    RETURN_NOT_OK(f_parser_.CheckAtEnd());
+    RETURN_NOT_OK(CheckNumChildren(1));
+    ARROW_ASSIGN_OR_RAISE(auto field, MakeChildField(0));
+    const auto& value_type = field->type();
+    if (value_type->id() != Type::STRUCT || value_type->num_children() != 2) {
+      return Status::Invalid("Imported map array has unexpected child field type: ",
+                             field->ToString());
+    }
+    const bool keys_sorted = (flags_ & ARROW_FLAG_MAP_KEYS_SORTED) != 0;
+    type_ = map(value_type->child(0)->type(), value_type->child(1), keys_sorted);
+    return Status::OK();
+  }
+
+  Status ProcessFixedSizeList() {
+    RETURN_NOT_OK(f_parser_.CheckNext(':'));
+    ARROW_ASSIGN_OR_RAISE(auto list_size, f_parser_.ParseInt(f_parser_.Rest()));
+    if (list_size < 0) {
+      return f_parser_.Invalid();
+    }
+    RETURN_NOT_OK(CheckNumChildren(1));
+    ARROW_ASSIGN_OR_RAISE(auto field, MakeChildField(0));
+    type_ = fixed_size_list(field, list_size);
+    return Status::OK();
+  }
+
+  Status ProcessStruct() {
+    RETURN_NOT_OK(f_parser_.CheckAtEnd());
+    ARROW_ASSIGN_OR_RAISE(auto fields, MakeChildFields());
+    type_ = struct_(std::move(fields));
+    return Status::OK();
+  }
+
+  Status ProcessUnion() {
+    RETURN_NOT_OK(f_parser_.CheckHasNext());
+    UnionMode::type mode;
+    switch (f_parser_.Next()) {
+      case 'd':
+        mode = UnionMode::DENSE;
+        break;
+      case 's':
+        mode = UnionMode::SPARSE;
+        break;
+      default:
+        return f_parser_.Invalid();
+    }
+    RETURN_NOT_OK(f_parser_.CheckNext(':'));
+    std::vector<int8_t> type_codes;
+    if (!f_parser_.AtEnd()) {
+      ARROW_ASSIGN_OR_RAISE(type_codes, f_parser_.ParseInts<int8_t>(f_parser_.Rest()));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto fields, MakeChildFields());
+    if (fields.size() != type_codes.size()) {
+      return Status::Invalid(
+          "ArrowSchema struct: number of type codes in union format string "
+          "does not match number of children");
+    }
+    ARROW_ASSIGN_OR_RAISE(type_, UnionType::Make(fields, type_codes, mode));
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Field>> MakeChildField(int64_t child_id) {
+    const auto& child = child_importers_[child_id];
+    if (child.c_struct_->name == nullptr) {
+      return Status::Invalid("Expected non-null name in imported array child");
+    }
+    return child.MakeField();
+  }
+
+  Result<std::vector<std::shared_ptr<Field>>> MakeChildFields() {
+    std::vector<std::shared_ptr<Field>> fields(child_importers_.size());
+    for (int64_t i = 0; i < static_cast<int64_t>(child_importers_.size()); ++i) {
+      ARROW_ASSIGN_OR_RAISE(fields[i], MakeChildField(i));
+    }
+    return fields;
+  }
+
+  Status CheckNoChildren(const std::shared_ptr<DataType>& type) {
+    return CheckNumChildren(type, 0);
+  }
+
+  Status CheckNumChildren(const std::shared_ptr<DataType>& type, int64_t n_children) {
+    if (c_struct_->n_children != n_children) {
+      return Status::Invalid("Expected ", n_children, " children for imported type ",
+                             type->ToString(), ", ArrowSchema struct has ",
+                             c_struct_->n_children);
+    }
+    return Status::OK();
+  }
+
+  Status CheckNumChildren(int64_t n_children) {
+    if (c_struct_->n_children != n_children) {
+      return Status::Invalid("Expected ", n_children, " children for imported format '",
+                             c_struct_->format, "', ArrowSchema struct has ",
+                             c_struct_->n_children);
+    }
+    return Status::OK();
+  }
+
+  struct ArrowSchema* c_struct_;
+  FormatStringParser f_parser_;
+  int recursion_level_ = 0;
+  std::vector<SchemaImporter> child_importers_;
+
+  std::string name_;
+  int64_t flags_ = 0;
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<KeyValueMetadata> metadata_;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// C data import
+
+// The ArrowArray struct of an import, released when the last of the imported
+// buffers is destroyed.
+class ImportedArrayData {
+ public:
+  ImportedArrayData() { ArrowArrayMarkReleased(&array_); }
+
+  ~ImportedArrayData() { ArrowArrayRelease(&array_); }
+
+  struct ArrowArray array_;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ImportedArrayData);
+};
+
+// A wrapper of memory owned by an ArrowArray struct, without copying it
+class ImportedBuffer : public Buffer {
+ public:
+  ImportedBuffer(const uint8_t* data, int64_t size,
+                 std::shared_ptr<ImportedArrayData> import)
+      : Buffer(data, size), import_(std::move(import)) {}
+
+  ~ImportedBuffer() override {}
+
+ protected:
+  std::shared_ptr<ImportedArrayData> import_;
+};
+
+class ArrayImporter {
+ public:
+  explicit ArrayImporter(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  Status Import(struct ArrowArray* src) {
+    if (ArrowArrayIsReleased(src)) {
+      return Status::Invalid("Cannot import released ArrowArray");
+    }
+    recursion_level_ = 0;
+    import_ = std::make_shared<ImportedArrayData>();
+    c_struct_ = &import_->array_;
+    ArrowArrayMove(src, c_struct_);
+    return DoImport();
+  }
+
+  Result<std::shared_ptr<Array>> MakeArray() {
+    DCHECK_NE(data_, nullptr);
+    return ::arrow::MakeArray(data_);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> MakeRecordBatch(std::shared_ptr<Schema> schema) {
+    DCHECK_NE(data_, nullptr);
+    if (data_->GetNullCount() != 0) {
+      return Status::Invalid(
+          "ArrowArray struct has non-zero null count, "
+          "cannot be imported as RecordBatch");
+    }
+    if (data_->offset != 0) {
+      return Status::Invalid(
+          "ArrowArray struct has non-zero offset, "
+          "cannot be imported as RecordBatch");
+    }
+    return RecordBatch::Make(std::move(schema), data_->length,
+                             std::move(data_->child_data));
+  }
+
+  // Type-specific visitors, importing the buffers
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Cannot import array of type ", type_->ToString());
+  }
+
+  Status Visit(const FixedWidthType& type) { return ImportFixedSizePrimitive(type); }
+
+  Status Visit(const NullType& type) {
+    RETURN_NOT_OK(CheckNoChildren());
+    RETURN_NOT_OK(CheckNumBuffers(0));
+    // Null arrays have a single, null buffer in C++
+    RETURN_NOT_OK(AllocateArrayData(1));
+    data_->SetNullCount(data_->length);
+    return Status::OK();
+  }
+
+  Status Visit(const StringType& type) { return ImportStringLike<int32_t>(); }
+
+  Status Visit(const BinaryType& type) { return ImportStringLike<int32_t>(); }
+
+  Status Visit(const LargeStringType& type) { return ImportStringLike<int64_t>(); }
+
+  Status Visit(const LargeBinaryType& type) { return ImportStringLike<int64_t>(); }
+
+  Status Visit(const ListType& type) { return ImportListLike<int32_t>(); }
+
+  Status Visit(const LargeListType& type) { return ImportListLike<int64_t>(); }
+
+  Status Visit(const FixedSizeListType& type) {
+    RETURN_NOT_OK(CheckNumChildren(1));
+    RETURN_NOT_OK(CheckNumBuffers(1));
+    RETURN_NOT_OK(AllocateArrayData());
+    return ImportNullBitmap();
+  }
+
+  Status Visit(const StructType& type) {
+    RETURN_NOT_OK(CheckNumBuffers(1));
+    RETURN_NOT_OK(AllocateArrayData());
+    return ImportNullBitmap();
+  }
+
+  Status Visit(const UnionType& type) {
+    if (type.mode() == UnionMode::SPARSE) {
+      // Sparse unions have no offsets buffer in C
+      RETURN_NOT_OK(CheckNumBuffers(2));
+      RETURN_NOT_OK(AllocateArrayData(3));
+      RETURN_NOT_OK(ImportNullBitmap());
+      return ImportFixedSizeBuffer(1, sizeof(int8_t));
+    }
+    RETURN_NOT_OK(CheckNumBuffers(3));
+    RETURN_NOT_OK(AllocateArrayData());
+    RETURN_NOT_OK(ImportNullBitmap());
+    RETURN_NOT_OK(ImportFixedSizeBuffer(1, sizeof(int8_t)));
+    return ImportFixedSizeBuffer(2, sizeof(int32_t));
+  }
+
+ protected:
+  Status ImportChild(const ArrayImporter* parent, struct ArrowArray* src) {
+    if (ArrowArrayIsReleased(src)) {
+      return Status::Invalid("Cannot import released ArrowArray");
+    }
+    recursion_level_ = parent->recursion_level_ + 1;
+    if (recursion_level_ >= kMaxImportRecursionLevel) {
+      return Status::Invalid("Recursion level in ArrowArray struct exceeded");
+    }
+    // Child buffers keep the entire parent import alive, as the child
+    // ArrowArray structs are owned by their parent and aren't moved
+    import_ = parent->import_;
+    c_struct_ = src;
+    return DoImport();
+  }
+
+  Status DoImport() {
+    // Extension arrays are imported as their storage, with the extension type
+    const DataType* storage_type = type_.get();
+    if (type_->id() == Type::EXTENSION) {
+      storage_type = checked_cast<const ExtensionType&>(*type_).storage_type().get();
+    }
+
+    // First import children (required for reconstituting parent array data)
+    const auto& fields = storage_type->children();
+    if (c_struct_->n_children != static_cast<int64_t>(fields.size())) {
+      return Status::Invalid("ArrowArray struct has ", c_struct_->n_children,
+                             " children, expected ", fields.size(), " for type ",
+                             type_->ToString());
+    }
+    child_importers_.reserve(fields.size());
+    for (int64_t i = 0; i < c_struct_->n_children; ++i) {
+      DCHECK_NE(c_struct_->children[i], nullptr);
+      child_importers_.emplace_back(fields[i]->type());
+      RETURN_NOT_OK(child_importers_.back().ImportChild(this, c_struct_->children[i]));
+    }
+
+    // Import main data
+    RETURN_NOT_OK(VisitTypeInline(*storage_type, this));
+
+    // Import dictionary values
+    const bool is_dict_type = storage_type->id() == Type::DICTIONARY;
+    if (c_struct_->dictionary != nullptr) {
+      if (!is_dict_type) {
+        return Status::Invalid("Import type is ", type_->ToString(),
+                               " but dictionary field in ArrowArray struct is not null");
+      }
+      const auto& dict_type = checked_cast<const DictionaryType&>(*storage_type);
+      ArrayImporter dict_importer(dict_type.value_type());
+      RETURN_NOT_OK(dict_importer.ImportChild(this, c_struct_->dictionary));
+      ARROW_ASSIGN_OR_RAISE(data_->dictionary, dict_importer.MakeArray());
+    } else if (is_dict_type) {
+      return Status::Invalid("Import type is ", type_->ToString(),
+                             " but dictionary field in ArrowArray struct is null");
+    }
+    return Status::OK();
+  }
+
+  Status ImportFixedSizePrimitive(const FixedWidthType& type) {
+    RETURN_NOT_OK(CheckNoChildren());
+    RETURN_NOT_OK(CheckNumBuffers(2));
+    RETURN_NOT_OK(AllocateArrayData());
+    RETURN_NOT_OK(ImportNullBitmap());
+    const int64_t bit_length = type.bit_width() * (c_struct_->length + c_struct_->offset);
+    return ImportBuffer(1, BitUtil::BytesForBits(bit_length));
+  }
+
+  template <typename OffsetType>
+  Status ImportStringLike() {
+    RETURN_NOT_OK(CheckNoChildren());
+    RETURN_NOT_OK(CheckNumBuffers(3));
+    RETURN_NOT_OK(AllocateArrayData());
+    RETURN_NOT_OK(ImportNullBitmap());
+    RETURN_NOT_OK(ImportOffsetsBuffer<OffsetType>(1));
+    return ImportStringValuesBuffer<OffsetType>(1, 2);
+  }
+
+  template <typename OffsetType>
+  Status ImportListLike() {
+    RETURN_NOT_OK(CheckNumChildren(1));
+    RETURN_NOT_OK(CheckNumBuffers(2));
+    RETURN_NOT_OK(AllocateArrayData());
+    RETURN_NOT_OK(ImportNullBitmap());
+    return ImportOffsetsBuffer<OffsetType>(1);
+  }
+
+  Status CheckNoChildren() { return CheckNumChildren(0); }
+
+  Status CheckNumChildren(int64_t n_children) {
+    if (c_struct_->n_children != n_children) {
+      return Status::Invalid("Expected ", n_children, " children for imported type ",
+                             type_->ToString(), ", ArrowArray struct has ",
+                             c_struct_->n_children);
+    }
+    return Status::OK();
+  }
+
+  Status CheckNumBuffers(int64_t n_buffers) {
+    if (n_buffers != c_struct_->n_buffers) {
+      return Status::Invalid("Expected ", n_buffers, " buffers for imported type ",
+                             type_->ToString(), ", ArrowArray struct has ",
+                             c_struct_->n_buffers);
+    }
+    return Status::OK();
+  }
+
+  Status AllocateArrayData() { return AllocateArrayData(c_struct_->n_buffers); }
+
+  Status AllocateArrayData(int64_t n_buffers) {
+    DCHECK_EQ(data_, nullptr);
+    if (c_struct_->length < 0 || c_struct_->offset < 0) {
+      return Status::Invalid("ArrowArray struct has negative length or offset");
+    }
+    data_ = std::make_shared<ArrayData>(type_, c_struct_->length, c_struct_->null_count,
+                                        c_struct_->offset);
+    data_->buffers.resize(static_cast<size_t>(n_buffers));
+    data_->child_data.resize(child_importers_.size());
+    for (size_t i = 0; i < child_importers_.size(); ++i) {
+      data_->child_data[i] = child_importers_[i].data_;
+    }
+    return Status::OK();
+  }
+
+  Status ImportNullBitmap(int32_t buffer_id = 0) {
+    const int64_t bit_length = c_struct_->length + c_struct_->offset;
+    RETURN_NOT_OK(ImportBuffer(buffer_id, BitUtil::BytesForBits(bit_length)));
+    if (data_->null_count > 0 && data_->buffers[buffer_id] == nullptr) {
+      return Status::Invalid(
+          "ArrowArray struct has no null bitmap buffer but non-zero null_count ",
+          data_->null_count.load());
+    }
+    return Status::OK();
+  }
+
+  Status ImportFixedSizeBuffer(int32_t buffer_id, int64_t byte_width) {
+    return ImportBuffer(buffer_id, byte_width * (c_struct_->length + c_struct_->offset));
+  }
+
+  template <typename OffsetType>
+  Status ImportOffsetsBuffer(int32_t buffer_id) {
+    if (c_struct_->length > 0 && c_struct_->buffers[buffer_id] == nullptr) {
+      return Status::Invalid("ArrowArray struct of type ", type_->ToString(),
+                             " has null offsets buffer");
+    }
+    // Compute visible size of buffer
+    int64_t buffer_size =
+        sizeof(OffsetType) * (c_struct_->length + c_struct_->offset + 1);
+    return ImportBuffer(buffer_id, buffer_size);
+  }
+
+  template <typename OffsetType>
+  Status ImportStringValuesBuffer(int32_t offsets_buffer_id, int32_t buffer_id) {
+    int64_t buffer_size = 0;
+    if (c_struct_->length > 0) {
+      // Compute visible size of buffer from the last offset
+      auto offsets = data_->GetValues<OffsetType>(offsets_buffer_id);
+      buffer_size = offsets[c_struct_->length];
+    }
+    return ImportBuffer(buffer_id, buffer_size);
+  }
+
+  Status ImportBuffer(int32_t buffer_id, int64_t buffer_size) {
+    std::shared_ptr<Buffer>* out = &data_->buffers[buffer_id];
+    auto data = reinterpret_cast<const uint8_t*>(c_struct_->buffers[buffer_id]);
+    if (data != nullptr) {
+      *out = std::make_shared<ImportedBuffer>(data, buffer_size, import_);
+    } else {
+      out->reset();
+    }
+    return Status::OK();
+  }
+
+  struct ArrowArray* c_struct_ = nullptr;
+  int recursion_level_ = 0;
+  std::shared_ptr<DataType> type_;
+
+  std::shared_ptr<ImportedArrayData> import_;
+  std::shared_ptr<ArrayData> data_;
+  std::vector<ArrayImporter> child_importers_;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// C stream import
+
+class ArrayStreamBatchReader : public RecordBatchReader {
+ public:
+  explicit ArrayStreamBatchReader(struct ArrowArrayStream* stream) {
+    ArrowArrayStreamMove(stream, &stream_);
+  }
+
+  ~ArrayStreamBatchReader() override { ArrowArrayStreamRelease(&stream_); }
+
+  Status Init() {
+    struct ArrowSchema c_schema;
+    RETURN_NOT_OK(StatusFromCError(stream_.get_schema(&stream_, &c_schema)));
+    ARROW_ASSIGN_OR_RAISE(schema_, ImportSchema(&c_schema));
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    struct ArrowArray c_array;
+    RETURN_NOT_OK(StatusFromCError(stream_.get_next(&stream_, &c_array)));
+    if (ArrowArrayIsReleased(&c_array)) {
+      // End of stream
+      batch->reset();
+      return Status::OK();
+    }
+    return ImportRecordBatch(&c_array, schema_).Value(batch);
+  }
+
+ private:
+  Status StatusFromCError(int errno_like) {
+    if (ARROW_PREDICT_TRUE(errno_like == 0)) {
+      return Status::OK();
+    }
+    StatusCode code;
+    switch (errno_like) {
+      case EDOM:
+      case EINVAL:
+      case ERANGE:
+        code = StatusCode::Invalid;
+        break;
+      case ENOMEM:
+        code = StatusCode::OutOfMemory;
+        break;
+      case ENOSYS:
+        code = StatusCode::NotImplemented;
+        break;
+      default:
+        code = StatusCode::IOError;
+        break;
+    }
+    const char* last_error = stream_.get_last_error(&stream_);
+    return Status(code, last_error != nullptr ? std::string(last_error)
+                                              : std::string(std::strerror(errno_like)));
+  }
+
+  struct ArrowArrayStream stream_;
+  std::shared_ptr<Schema> schema_;
+};
+
+}  // namespace
+
+Status ExportType(const DataType& type, struct ArrowSchema* out) {
+  SchemaExporter exporter;
+  RETURN_NOT_OK(exporter.ExportType(type));
+  exporter.Finish(out);
+  return Status::OK();
+}
+
+Status ExportField(const Field& field, struct ArrowSchema* out) {
+  SchemaExporter exporter;
+  RETURN_NOT_OK(exporter.ExportField(field));
+  exporter.Finish(out);
+  return Status::OK();
+}
+
+Status ExportSchema(const Schema& schema, struct ArrowSchema* out) {
+  SchemaExporter exporter;
+  RETURN_NOT_OK(exporter.ExportSchema(schema));
+  exporter.Finish(out);
+  return Status::OK();
+}
+
+Status ExportArray(const Array& array, struct ArrowArray* out,
+                   struct ArrowSchema* out_schema) {
+  SchemaExporter schema_exporter;
+  if (out_schema != nullptr) {
+    RETURN_NOT_OK(schema_exporter.ExportType(*array.type()));
+  }
+  ArrayExporter exporter;
+  RETURN_NOT_OK(exporter.Export(array.data()));
+  // Nothing can fail past this point
+  exporter.Finish(out);
+  if (out_schema != nullptr) {
+    schema_exporter.Finish(out_schema);
+  }
+  return Status::OK();
+}
+
+Status ExportRecordBatch(const RecordBatch& batch, struct ArrowArray* out,
+                         struct ArrowSchema* out_schema) {
+  std::vector<std::shared_ptr<ArrayData>> child_data(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    child_data[i] = batch.column_data(i);
+  }
+  auto data = ArrayData::Make(struct_(batch.schema()->fields()), batch.num_rows(),
+                              {nullptr}, std::move(child_data), /*null_count=*/0);
+
+  SchemaExporter schema_exporter;
+  if (out_schema != nullptr) {
+    RETURN_NOT_OK(schema_exporter.ExportSchema(*batch.schema()));
+  }
+  ArrayExporter exporter;
+  RETURN_NOT_OK(exporter.Export(data));
+  // Nothing can fail past this point
+  exporter.Finish(out);
+  if (out_schema != nullptr) {
+    schema_exporter.Finish(out_schema);
+  }
+  return Status::OK();
+}
+
+Status ExportRecordBatchReader(std::shared_ptr<RecordBatchReader> reader,
+                               struct ArrowArrayStream* out) {
+  out->get_schema = ExportedArrayStream::StaticGetSchema;
+  out->get_next = ExportedArrayStream::StaticGetNext;
+  out->get_last_error = ExportedArrayStream::StaticGetLastError;
+  out->release = ExportedArrayStream::StaticRelease;
+  out->private_data = new ExportedArrayStream::PrivateData{std::move(reader)};
+  return Status::OK();
+}
+
+Result<std::shared_ptr<DataType>> ImportType(struct ArrowSchema* schema) {
+  SchemaImporter importer;
+  RETURN_NOT_OK(importer.Import(schema));
+  return importer.MakeType();
+}
+
+Result<std::shared_ptr<Field>> ImportField(struct ArrowSchema* schema) {
+  SchemaImporter importer;
+  RETURN_NOT_OK(importer.Import(schema));
+  return importer.MakeField();
+}
+
+Result<std::shared_ptr<Schema>> ImportSchema(struct ArrowSchema* schema) {
+  SchemaImporter importer;
+  RETURN_NOT_OK(importer.Import(schema));
+  return importer.MakeSchema();
+}
+
+Result<std::shared_ptr<Array>> ImportArray(struct ArrowArray* array,
+                                           std::shared_ptr<DataType> type) {
+  ArrayImporter importer(type);
+  RETURN_NOT_OK(importer.Import(array));
+  return importer.MakeArray();
+}
+
+Result<std::shared_ptr<Array>> ImportArray(struct ArrowArray* array,
+                                           struct ArrowSchema* type) {
+  auto maybe_type = ImportType(type);
+  if (!maybe_type.ok()) {
+    ArrowArrayRelease(array);
+    return maybe_type.status();
+  }
+  return ImportArray(array, *maybe_type);
+}
+
+Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
+                                                       std::shared_ptr<Schema> schema) {
+  auto type = struct_(schema->fields());
+  ArrayImporter importer(type);
+  RETURN_NOT_OK(importer.Import(array));
+  return importer.MakeRecordBatch(std::move(schema));
+}
+
+Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
+                                                       struct ArrowSchema* schema) {
+  auto maybe_schema = ImportSchema(schema);
+  if (!maybe_schema.ok()) {
+    ArrowArrayRelease(array);
+    return maybe_schema.status();
+  }
+  return ImportRecordBatch(array, *maybe_schema);
+}
+
+Result<std::shared_ptr<RecordBatchReader>> ImportRecordBatchReader(
+    struct ArrowArrayStream* stream) {
+  if (ArrowArrayStreamIsReleased(stream)) {
+    return Status::Invalid("Cannot import released ArrowArrayStream");
+  }
+  auto reader = std::make_shared<ArrayStreamBatchReader>(stream);
+  RETURN_NOT_OK(reader->Init());
+  return reader;
+}
+
+}  // namespace arrow
@@ -0,0 +1,657 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/c/bridge.h"
+#include "arrow/c/helpers.h"
+#include "arrow/extension_type.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/extension_type.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/key_value_metadata.h"
+
+namespace arrow {
+
+// Encode metadata the way the C data interface specifies it
+std::string EncodeMetadata(const std::vector<std::pair<std::string, std::string>>& kv) {
+  std::string encoded;
+  auto append_int32 = [&](int32_t v) {
+    encoded.append(reinterpret_cast<const char*>(&v), sizeof(int32_t));
+  };
+  append_int32(static_cast<int32_t>(kv.size()));
+  for (const auto& pair : kv) {
+    append_int32(static_cast<int32_t>(pair.first.size()));
+    encoded += pair.first;
+    append_int32(static_cast<int32_t>(pair.second.size()));
+    encoded += pair.second;
+  }
+  return encoded;
+}
+
+std::shared_ptr<Array> ListOfInt8() {
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(ListArray::FromArrays(*ArrayFromJSON(int32(), "[0, 2, 2, 5]"),
+                                     *ArrayFromJSON(int8(), "[1, 2, 3, null, 5]"),
+                                     default_memory_pool(), &out));
+  return out;
+}
+
+std::shared_ptr<Array> StructOfIntAndString() {
+  auto maybe_array = StructArray::Make({ArrayFromJSON(int32(), "[1, null, 3]"),
+                                        ArrayFromJSON(utf8(), "[\"a\", \"b\", null]")},
+                                       std::vector<std::string>{"ints", "strs"});
+  ABORT_NOT_OK(maybe_array.status());
+  return *maybe_array;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Schema export tests
+
+class TestSchemaExport : public ::testing::Test {
+ public:
+  void CheckExportedType(const std::shared_ptr<DataType>& type, const char* format,
+                         int64_t n_children = 0) {
+    struct ArrowSchema c_schema;
+    ASSERT_OK(ExportType(*type, &c_schema));
+    ASSERT_FALSE(ArrowSchemaIsReleased(&c_schema));
+    ASSERT_STREQ(c_schema.format, format);
+    ASSERT_STREQ(c_schema.name, "");
+    ASSERT_EQ(c_schema.metadata, nullptr);
+    ASSERT_EQ(c_schema.flags, ARROW_FLAG_NULLABLE);
+    ASSERT_EQ(c_schema.n_children, n_children);
+    ASSERT_EQ(c_schema.dictionary, nullptr);
+    ArrowSchemaRelease(&c_schema);
+    ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+  }
+};
+
+TEST_F(TestSchemaExport, Primitive) {
+  CheckExportedType(null(), "n");
+  CheckExportedType(boolean(), "b");
+  CheckExportedType(int8(), "c");
+  CheckExportedType(uint8(), "C");
+  CheckExportedType(int16(), "s");
+  CheckExportedType(uint16(), "S");
+  CheckExportedType(int32(), "i");
+  CheckExportedType(uint32(), "I");
+  CheckExportedType(int64(), "l");
+  CheckExportedType(uint64(), "L");
+  CheckExportedType(float16(), "e");
+  CheckExportedType(float32(), "f");
+  CheckExportedType(float64(), "g");
+
+  CheckExportedType(fixed_size_binary(3), "w:3");
+  CheckExportedType(binary(), "z");
+  CheckExportedType(large_binary(), "Z");
+  CheckExportedType(utf8(), "u");
+  CheckExportedType(large_utf8(), "U");
+
+  CheckExportedType(decimal(16, 4), "d:16,4");
+}
+
+TEST_F(TestSchemaExport, Temporal) {
+  CheckExportedType(date32(), "tdD");
+  CheckExportedType(date64(), "tdm");
+  CheckExportedType(time32(TimeUnit::SECOND), "tts");
+  CheckExportedType(time32(TimeUnit::MILLI), "ttm");
+  CheckExportedType(time64(TimeUnit::MICRO), "ttu");
+  CheckExportedType(time64(TimeUnit::NANO), "ttn");
+  CheckExportedType(duration(TimeUnit::SECOND), "tDs");
+  CheckExportedType(duration(TimeUnit::NANO), "tDn");
+  CheckExportedType(month_interval(), "tiM");
+  CheckExportedType(day_time_interval(), "tiD");
+  CheckExportedType(timestamp(TimeUnit::MILLI), "tsm:");
+  CheckExportedType(timestamp(TimeUnit::MICRO, "Europe/Paris"), "tsu:Europe/Paris");
+}
+
+TEST_F(TestSchemaExport, Nested) {
+  struct ArrowSchema c_schema;
+
+  ASSERT_OK(ExportType(*list(field("values", int8(), /*nullable=*/false)), &c_schema));
+  ASSERT_STREQ(c_schema.format, "+l");
+  ASSERT_EQ(c_schema.n_children, 1);
+  ASSERT_STREQ(c_schema.children[0]->format, "c");
+  ASSERT_STREQ(c_schema.children[0]->name, "values");
+  ASSERT_EQ(c_schema.children[0]->flags, 0);
+  ArrowSchemaRelease(&c_schema);
+
+  ASSERT_OK(ExportType(*fixed_size_list(int16(), 3), &c_schema));
+  ASSERT_STREQ(c_schema.format, "+w:3");
+  ASSERT_EQ(c_schema.n_children, 1);
+  ArrowSchemaRelease(&c_schema);
+
+  ASSERT_OK(ExportType(
+      *struct_({field("ints", int32()), field("strs", utf8(), /*nullable=*/false)}),
+      &c_schema));
+  ASSERT_STREQ(c_schema.format, "+s");
+  ASSERT_EQ(c_schema.n_children, 2);
+  ASSERT_STREQ(c_schema.children[0]->format, "i");
+  ASSERT_STREQ(c_schema.children[0]->name, "ints");
+  ASSERT_EQ(c_schema.children[0]->flags, ARROW_FLAG_NULLABLE);
+  ASSERT_STREQ(c_schema.children[1]->format, "u");
+  ASSERT_STREQ(c_schema.children[1]->name, "strs");
+  ASSERT_EQ(c_schema.children[1]->flags, 0);
+  ArrowSchemaRelease(&c_schema);
+
+  ASSERT_OK(ExportType(*map(utf8(), int32(), /*keys_sorted=*/true), &c_schema));
+  ASSERT_STREQ(c_schema.format, "+m");
+  ASSERT_EQ(c_schema.flags, ARROW_FLAG_NULLABLE | ARROW_FLAG_MAP_KEYS_SORTED);
+  ASSERT_EQ(c_schema.n_children, 1);
+  ASSERT_STREQ(c_schema.children[0]->format, "+s");
+  ASSERT_EQ(c_schema.children[0]->n_children, 2);
+  ArrowSchemaRelease(&c_schema);
+
+  ASSERT_OK(ExportType(*union_({field("a", int8()), field("b", utf8())}, {43, 42},
+                               UnionMode::DENSE),
+                       &c_schema));
+  ASSERT_STREQ(c_schema.format, "+ud:43,42");
+  ASSERT_EQ(c_schema.n_children, 2);
+  ArrowSchemaRelease(&c_schema);
+}
+
+TEST_F(TestSchemaExport, Dictionary) {
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportType(*dictionary(int32(), utf8(), /*ordered=*/true), &c_schema));
+  ASSERT_STREQ(c_schema.format, "i");
+  ASSERT_EQ(c_schema.flags, ARROW_FLAG_NULLABLE | ARROW_FLAG_DICTIONARY_ORDERED);
+  ASSERT_NE(c_schema.dictionary, nullptr);
+  ASSERT_STREQ(c_schema.dictionary->format, "u");
+  ArrowSchemaRelease(&c_schema);
+}
+
+TEST_F(TestSchemaExport, FieldAndSchema) {
+  auto metadata = key_value_metadata({"key"}, {"value"});
+  struct ArrowSchema c_schema;
+
+  ASSERT_OK(ExportField(*field("f", int64(), /*nullable=*/false, metadata), &c_schema));
+  ASSERT_STREQ(c_schema.format, "l");
+  ASSERT_STREQ(c_schema.name, "f");
+  ASSERT_EQ(c_schema.flags, 0);
+  const auto expected_metadata = EncodeMetadata({{"key", "value"}});
+  ASSERT_EQ(std::string(c_schema.metadata, expected_metadata.size()), expected_metadata);
+  ArrowSchemaRelease(&c_schema);
+
+  ASSERT_OK(ExportSchema(*schema({field("a", int8()), field("b", utf8())}, metadata),
+                         &c_schema));
+  ASSERT_STREQ(c_schema.format, "+s");
+  ASSERT_EQ(c_schema.flags, 0);
+  ASSERT_EQ(c_schema.n_children, 2);
+  ASSERT_STREQ(c_schema.children[1]->name, "b");
+  ASSERT_EQ(std::string(c_schema.metadata, expected_metadata.size()), expected_metadata);
+  ArrowSchemaRelease(&c_schema);
+}
+
+TEST_F(TestSchemaExport, MoveChild) {
+  struct ArrowSchema c_schema, c_child;
+  ASSERT_OK(ExportType(*struct_({field("ints", int32()), field("strs", utf8())}),
+                       &c_schema));
+  ArrowSchemaMove(c_schema.children[1], &c_child);
+  ArrowSchemaRelease(&c_schema);
+  // The moved child outlives its parent
+  ASSERT_STREQ(c_child.format, "u");
+  ASSERT_STREQ(c_child.name, "strs");
+  ArrowSchemaRelease(&c_child);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Schema import tests
+
+TEST(TestSchemaImport, Invalid) {
+  struct ArrowSchema c_schema;
+
+  // Invalid format strings
+  for (const char* format : {"", "X", "w", "w:x", "d:16", "tdX", "tsX:", "+w", "+ux:1"}) {
+    ASSERT_OK(ExportType(*int8(), &c_schema));
+    c_schema.format = format;
+    auto maybe_type = ImportType(&c_schema);
+    // The struct is released even though importing failed
+    ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+    ASSERT_RAISES(Invalid, maybe_type.status());
+  }
+
+  // Already released
+  ASSERT_RAISES(Invalid, ImportType(&c_schema).status());
+
+  // Schema of a non-struct type
+  ASSERT_OK(ExportType(*int8(), &c_schema));
+  ASSERT_RAISES(Invalid, ImportSchema(&c_schema).status());
+  ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+}
+
+class TestSchemaRoundtrip : public ::testing::Test {
+ public:
+  void CheckTypeRoundtrip(const std::shared_ptr<DataType>& type) {
+    struct ArrowSchema c_schema;
+    ASSERT_OK(ExportType(*type, &c_schema));
+    ASSERT_OK_AND_ASSIGN(auto actual, ImportType(&c_schema));
+    ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+    AssertTypeEqual(*type, *actual);
+  }
+};
+
+TEST_F(TestSchemaRoundtrip, Types) {
+  for (const auto& type :
+       {null(), boolean(), int8(), uint16(), int32(), uint64(), float16(), float64(),
+        fixed_size_binary(7), binary(), large_utf8(), decimal(19, 3), date32(),
+        time64(TimeUnit::NANO), timestamp(TimeUnit::SECOND, "UTC"),
+        duration(TimeUnit::MILLI), day_time_interval()}) {
+    CheckTypeRoundtrip(type);
+  }
+  CheckTypeRoundtrip(list(int8()));
+  CheckTypeRoundtrip(large_list(field("values", utf8(), /*nullable=*/false)));
+  CheckTypeRoundtrip(fixed_size_list(int16(), 4));
+  CheckTypeRoundtrip(struct_({field("a", int8()), field("b", list(utf8()), false)}));
+  CheckTypeRoundtrip(map(utf8(), int32()));
+  CheckTypeRoundtrip(map(utf8(), field("v", int32(), false), /*keys_sorted=*/true));
+  CheckTypeRoundtrip(
+      union_({field("a", int8()), field("b", utf8())}, {5, 3}, UnionMode::SPARSE));
+  CheckTypeRoundtrip(
+      union_({field("a", int8()), field("b", utf8())}, {0, 1}, UnionMode::DENSE));
+  CheckTypeRoundtrip(dictionary(int16(), utf8()));
+  CheckTypeRoundtrip(dictionary(int8(), list(int32()), /*ordered=*/true));
+}
+
+TEST_F(TestSchemaRoundtrip, Extension) {
+  ASSERT_OK(RegisterExtensionType(std::make_shared<UUIDType>()));
+  CheckTypeRoundtrip(uuid());
+  ASSERT_OK(UnregisterExtensionType("uuid"));
+
+  // Unregistered extension types are imported as their storage type
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportType(*uuid(), &c_schema));
+  ASSERT_OK_AND_ASSIGN(auto actual, ImportType(&c_schema));
+  AssertTypeEqual(*fixed_size_binary(16), *actual);
+}
+
+TEST_F(TestSchemaRoundtrip, FieldAndSchema) {
+  auto metadata = key_value_metadata({"key1", "key2"}, {"value1", ""});
+  struct ArrowSchema c_schema;
+
+  auto f = field("f", list(int8()), /*nullable=*/false, metadata);
+  ASSERT_OK(ExportField(*f, &c_schema));
+  ASSERT_OK_AND_ASSIGN(auto actual_field, ImportField(&c_schema));
+  AssertFieldEqual(*f, *actual_field, /*check_metadata=*/true);
+
+  auto s = schema({field("a", int8()), field("b", utf8(), false, metadata)}, metadata);
+  ASSERT_OK(ExportSchema(*s, &c_schema));
+  ASSERT_OK_AND_ASSIGN(auto actual_schema, ImportSchema(&c_schema));
+  AssertSchemaEqual(*s, *actual_schema, /*check_metadata=*/true);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Array export tests
+
+TEST(TestArrayExport, Primitive) {
+  auto arr = ArrayFromJSON(int32(), "[1, null, 3, 4]")->Slice(1, 2);
+  struct ArrowArray c_array;
+  // An unknown null count is exported as such
+  ASSERT_OK(ExportArray(*arr, &c_array));
+  ASSERT_EQ(c_array.null_count, -1);
+  ArrowArrayRelease(&c_array);
+
+  ASSERT_EQ(arr->null_count(), 1);
+  ASSERT_OK(ExportArray(*arr, &c_array));
+
+  ASSERT_EQ(c_array.length, 2);
+  ASSERT_EQ(c_array.offset, 1);
+  ASSERT_EQ(c_array.null_count, 1);
+  ASSERT_EQ(c_array.n_buffers, 2);
+  ASSERT_EQ(c_array.n_children, 0);
+  ASSERT_EQ(c_array.dictionary, nullptr);
+  // No copy was made
+  ASSERT_EQ(c_array.buffers[0], arr->data()->buffers[0]->data());
+  ASSERT_EQ(c_array.buffers[1], arr->data()->buffers[1]->data());
+
+  // The exported struct keeps the data alive
+  std::weak_ptr<ArrayData> weak_data = arr->data();
+  arr.reset();
+  ASSERT_FALSE(weak_data.expired());
+  ArrowArrayRelease(&c_array);
+  ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+  ASSERT_TRUE(weak_data.expired());
+}
+
+TEST(TestArrayExport, NullAndSparseUnion) {
+  struct ArrowArray c_array;
+  ASSERT_OK(ExportArray(NullArray(3), &c_array));
+  // Null arrays have no buffers in the C data interface
+  ASSERT_EQ(c_array.length, 3);
+  ASSERT_EQ(c_array.null_count, 3);
+  ASSERT_EQ(c_array.n_buffers, 0);
+  ArrowArrayRelease(&c_array);
+
+  std::shared_ptr<Array> arr;
+  ASSERT_OK(UnionArray::MakeSparse(*ArrayFromJSON(int8(), "[0, 1]"),
+                                   {ArrayFromJSON(int8(), "[1, null]"),
+                                    ArrayFromJSON(utf8(), "[null, \"x\"]")},
+                                   &arr));
+  ASSERT_OK(ExportArray(*arr, &c_array));
+  // Nor do sparse unions have offsets
+  ASSERT_EQ(c_array.n_buffers, 2);
+  ASSERT_EQ(c_array.n_children, 2);
+  ArrowArrayRelease(&c_array);
+}
+
+TEST(TestArrayExport, MoveChild) {
+  auto arr = StructOfIntAndString();
+  std::weak_ptr<ArrayData> weak_child = arr->data()->child_data[1];
+  struct ArrowArray c_array, c_child;
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportArray(*arr, &c_array, &c_schema));
+  ASSERT_EQ(c_array.n_children, 2);
+  ArrowArrayMove(c_array.children[1], &c_child);
+  ArrowArrayRelease(&c_array);
+  ArrowSchemaRelease(&c_schema);
+  arr.reset();
+
+  // The moved child keeps its own data alive
+  ASSERT_FALSE(weak_child.expired());
+  ASSERT_EQ(c_child.length, 3);
+  ASSERT_EQ(c_child.n_buffers, 3);
+  ArrowArrayRelease(&c_child);
+  ASSERT_TRUE(weak_child.expired());
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Array import tests
+
+// A C array produced without the help of the bridge
+class TestArrayImport : public ::testing::Test {
+ public:
+  void SetUp() override {
+    memset(&c_array_, 0, sizeof(c_array_));
+    c_array_.length = 3;
+    c_array_.null_count = 1;
+    c_array_.offset = 0;
+    c_array_.n_buffers = 2;
+    c_array_.buffers = buffers_;
+    c_array_.release = Release;
+    c_array_.private_data = &released_;
+    released_ = false;
+  }
+
+  static void Release(struct ArrowArray* array) {
+    *reinterpret_cast<bool*>(array->private_data) = true;
+    ArrowArrayMarkReleased(array);
+  }
+
+ protected:
+  const uint8_t bitmap_[1] = {0x05};
+  const int16_t values_[3] = {1, 0, 3};
+  const void* buffers_[2] = {bitmap_, values_};
+  struct ArrowArray c_array_;
+  bool released_;
+};
+
+TEST_F(TestArrayImport, ZeroCopy) {
+  ASSERT_OK_AND_ASSIGN(auto arr, ImportArray(&c_array_, int16()));
+  ASSERT_OK(arr->ValidateFull());
+  // The C struct was moved into the imported array
+  ASSERT_TRUE(ArrowArrayIsReleased(&c_array_));
+  ASSERT_FALSE(released_);
+
+  AssertArraysEqual(*ArrayFromJSON(int16(), "[1, null, 3]"), *arr);
+  ASSERT_EQ(arr->data()->buffers[1]->data(), reinterpret_cast<const uint8_t*>(values_));
+  ASSERT_EQ(arr->data()->buffers[1]->size(), 6);
+
+  // Slices keep the import alive
+  auto slice = arr->Slice(1);
+  arr.reset();
+  ASSERT_FALSE(released_);
+  slice.reset();
+  ASSERT_TRUE(released_);
+}
+
+TEST_F(TestArrayImport, Invalid) {
+  // Wrong number of buffers
+  c_array_.n_buffers = 3;
+  ASSERT_RAISES(Invalid, ImportArray(&c_array_, int16()).status());
+  // The C struct is released on error too
+  ASSERT_TRUE(released_);
+
+  // Already released
+  ASSERT_RAISES(Invalid, ImportArray(&c_array_, int16()).status());
+
+  // Null count without null bitmap
+  SetUp();
+  buffers_[0] = nullptr;
+  ASSERT_RAISES(Invalid, ImportArray(&c_array_, int16()).status());
+  ASSERT_TRUE(released_);
+
+  // Dictionary type without dictionary
+  SetUp();
+  ASSERT_RAISES(Invalid, ImportArray(&c_array_, dictionary(int16(), utf8())).status());
+  ASSERT_TRUE(released_);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Array roundtrip tests
+
+class TestArrayRoundtrip : public ::testing::Test {
+ public:
+  void CheckRoundtrip(const std::shared_ptr<Array>& arr) {
+    struct ArrowArray c_array;
+    struct ArrowSchema c_schema;
+    ASSERT_OK(ExportArray(*arr, &c_array, &c_schema));
+    ASSERT_OK_AND_ASSIGN(auto actual, ImportArray(&c_array, &c_schema));
+    ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+    ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*arr, *actual, /*verbose=*/true);
+
+    // The imported array shares the exported array's memory
+    for (size_t i = 0; i < arr->data()->buffers.size(); ++i) {
+      const auto& expected_buffer = arr->data()->buffers[i];
+      const auto& actual_buffer = actual->data()->buffers[i];
+      if (expected_buffer != nullptr && actual_buffer != nullptr) {
+        ASSERT_EQ(expected_buffer->data(), actual_buffer->data());
+      }
+    }
+
+    // And keeps it alive
+    std::weak_ptr<ArrayData> weak_data = arr->data();
+    const auto expected = arr->ToString();
+    auto slice = actual->Slice(0);
+    actual.reset();
+    ASSERT_FALSE(weak_data.expired());
+    ASSERT_EQ(slice->ToString(), expected);
+  }
+
+  void CheckRoundtrip(const std::shared_ptr<DataType>& type, const std::string& json) {
+    auto arr = ArrayFromJSON(type, json);
+    CheckRoundtrip(arr);
+    CheckRoundtrip(arr->Slice(1, 2));
+  }
+};
+
+TEST_F(TestArrayRoundtrip, Primitive) {
+  CheckRoundtrip(std::make_shared<NullArray>(3));
+  CheckRoundtrip(boolean(), "[true, null, false, true]");
+  CheckRoundtrip(int8(), "[1, null, -3, 4]");
+  CheckRoundtrip(uint64(), "[1, 2, null, 18446744073709551615]");
+  CheckRoundtrip(float64(), "[1.5, null, 3.0, -0.5]");
+  CheckRoundtrip(utf8(), "[\"foo\", null, \"\", \"quux\"]");
+  CheckRoundtrip(large_binary(), "[\"foo\", \"bar\", null, \"\"]");
+  CheckRoundtrip(fixed_size_binary(3), "[\"foo\", null, \"bar\", \"baz\"]");
+  CheckRoundtrip(decimal(16, 4), "[\"1234.5670\", null, \"-0.0001\", \"0.0000\"]");
+  CheckRoundtrip(timestamp(TimeUnit::MICRO, "UTC"), "[1, null, 3, 4]");
+}
+
+TEST_F(TestArrayRoundtrip, Nested) {
+  auto list_arr = ListOfInt8();
+  CheckRoundtrip(list_arr);
+  CheckRoundtrip(list_arr->Slice(1, 2));
+
+  auto struct_arr = StructOfIntAndString();
+  CheckRoundtrip(struct_arr);
+  CheckRoundtrip(struct_arr->Slice(1));
+
+  auto fsl_type = fixed_size_list(int16(), 2);
+  CheckRoundtrip(std::make_shared<FixedSizeListArray>(
+      fsl_type, 2, ArrayFromJSON(int16(), "[1, 2, null, 4]")));
+
+  std::shared_ptr<Array> map_arr;
+  ASSERT_OK(MapArray::FromArrays(ArrayFromJSON(int32(), "[0, 1, 3]"),
+                                 ArrayFromJSON(utf8(), "[\"a\", \"b\", \"c\"]"),
+                                 ArrayFromJSON(int64(), "[1, null, 3]"),
+                                 default_memory_pool(), &map_arr));
+  CheckRoundtrip(map_arr);
+
+  std::shared_ptr<Array> union_arr;
+  ASSERT_OK(UnionArray::MakeSparse(*ArrayFromJSON(int8(), "[0, 1, 1]"),
+                                   {ArrayFromJSON(int8(), "[1, null, 3]"),
+                                    ArrayFromJSON(utf8(), "[null, \"x\", \"y\"]")},
+                                   &union_arr));
+  CheckRoundtrip(union_arr);
+  ASSERT_OK(UnionArray::MakeDense(*ArrayFromJSON(int8(), "[0, 1, 1]"),
+                                  *ArrayFromJSON(int32(), "[0, 0, 1]"),
+                                  {ArrayFromJSON(int8(), "[1]"),
+                                   ArrayFromJSON(utf8(), "[\"x\", \"y\"]")},
+                                  &union_arr));
+  CheckRoundtrip(union_arr);
+}
+
+TEST_F(TestArrayRoundtrip, Dictionary) {
+  std::shared_ptr<Array> arr;
+  ASSERT_OK(DictionaryArray::FromArrays(dictionary(int32(), utf8(), /*ordered=*/true),
+                                        ArrayFromJSON(int32(), "[1, null, 0, 1]"),
+                                        ArrayFromJSON(utf8(), "[\"foo\", \"bar\"]"),
+                                        &arr));
+  CheckRoundtrip(arr);
+  CheckRoundtrip(arr->Slice(1, 2));
+}
+
+TEST_F(TestArrayRoundtrip, Extension) {
+  ASSERT_OK(RegisterExtensionType(std::make_shared<UUIDType>()));
+  auto storage = ArrayFromJSON(fixed_size_binary(16),
+                               "[\"0123456789abcdef\", null, \"fedcba9876543210\"]");
+  CheckRoundtrip(std::make_shared<UUIDArray>(uuid(), storage));
+  ASSERT_OK(UnregisterExtensionType("uuid"));
+}
+
+TEST_F(TestArrayRoundtrip, RecordBatch) {
+  auto metadata = key_value_metadata({"key"}, {"value"});
+  auto batch_schema =
+      schema({field("ints", int32()), field("lists", list(int8()), false)}, metadata);
+  auto batch = RecordBatch::Make(
+      batch_schema, 3, {ArrayFromJSON(int32(), "[1, null, 3]"), ListOfInt8()});
+
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportRecordBatch(*batch, &c_array, &c_schema));
+  ASSERT_EQ(c_array.length, 3);
+  ASSERT_EQ(c_array.n_children, 2);
+  ASSERT_EQ(c_array.null_count, 0);
+  ASSERT_OK_AND_ASSIGN(auto actual, ImportRecordBatch(&c_array, &c_schema));
+  ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+  ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+  AssertSchemaEqual(*batch_schema, *actual->schema(), /*check_metadata=*/true);
+  AssertBatchesEqual(*batch, *actual);
+
+  // Importing with a known schema
+  ASSERT_OK(ExportRecordBatch(*batch, &c_array));
+  ASSERT_OK_AND_ASSIGN(actual, ImportRecordBatch(&c_array, batch_schema));
+  AssertBatchesEqual(*batch, *actual);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Array stream tests
+
+class FailingRecordBatchReader : public RecordBatchReader {
+ public:
+  explicit FailingRecordBatchReader(std::shared_ptr<Schema> schema)
+      : schema_(std::move(schema)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    return Status::IOError("Expected error");
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+};
+
+TEST(TestArrayStreamRoundtrip, Batches) {
+  auto batch_schema = schema({field("ints", int32()), field("strs", utf8())});
+  std::vector<std::shared_ptr<RecordBatch>> batches = {
+      RecordBatch::Make(batch_schema, 2,
+                        {ArrayFromJSON(int32(), "[1, 2]"),
+                         ArrayFromJSON(utf8(), "[\"a\", null]")}),
+      RecordBatch::Make(batch_schema, 1,
+                        {ArrayFromJSON(int32(), "[null]"),
+                         ArrayFromJSON(utf8(), "[\"c\"]")})};
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(MakeRecordBatchReader(batches, batch_schema, &reader));
+
+  struct ArrowArrayStream c_stream;
+  ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+  ASSERT_OK_AND_ASSIGN(auto imported, ImportRecordBatchReader(&c_stream));
+  ASSERT_TRUE(ArrowArrayStreamIsReleased(&c_stream));
+  AssertSchemaEqual(*batch_schema, *imported->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> actual;
+  ASSERT_OK(imported->ReadAll(&actual));
+  ASSERT_EQ(actual.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    AssertBatchesEqual(*batches[i], *actual[i]);
+  }
+  // End of stream is sticky
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(imported->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST(TestArrayStreamRoundtrip, Errors) {
+  auto reader =
+      std::make_shared<FailingRecordBatchReader>(schema({field("ints", int32())}));
+  struct ArrowArrayStream c_stream;
+  ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+
+  // Errors are reported as errno-like codes to C consumers
+  struct ArrowArray c_array;
+  ASSERT_EQ(c_stream.get_next(&c_stream, &c_array), EIO);
+  ASSERT_NE(std::string(c_stream.get_last_error(&c_stream)).find("Expected error"),
+            std::string::npos);
+
+  // And as Status to C++ consumers
+  ASSERT_OK_AND_ASSIGN(auto imported, ImportRecordBatchReader(&c_stream));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_RAISES_WITH_MESSAGE(IOError, "IOError: IOError: Expected error",
+                             imported->ReadNext(&batch));
+
+  // The exported reader is kept alive until the imported one is destroyed
+  std::weak_ptr<RecordBatchReader> weak_reader = reader;
+  reader.reset();
+  ASSERT_FALSE(weak_reader.expired());
+  imported.reset();
+  ASSERT_TRUE(weak_reader.expired());
+
+  ASSERT_RAISES(Invalid, ImportRecordBatchReader(&c_stream).status());
+}
+
+}  // namespace arrow
@@ -70,10 +70,19 @@ class ARROW_EXPORT FunctionContext {
 
   internal::CpuInfo* cpu_info() const { return cpu_info_; }
 
+  /// \brief Whether kernels may process the chunks of a ChunkedArray input
+  /// in parallel on the CPU thread pool (default false)
+  ///
+  /// Per-chunk outputs are assembled in chunk order and aggregate states are
+  /// merged in chunk order, so results do not depend on this setting.
+  bool use_threads() const { return use_threads_; }
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
  private:
   Status status_;
   MemoryPool* pool_;
   internal::CpuInfo* cpu_info_;
+  bool use_threads_ = false;
 };
 
 }  // namespace compute
@@ -0,0 +1,417 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/executor.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/add.h"
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/column.h"
+#include "arrow/compute/operations/elementwise.h"
+#include "arrow/compute/operations/literal.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::OptionalParallelFor;
+
+namespace compute {
+
+namespace {
+
+// Bounds of the automatic morsel size, in rows
+constexpr int64_t kMinMorselSize = 1024;
+constexpr int64_t kMaxMorselSize = 1 << 20;
+
+enum class StepKind { COLUMN, LITERAL, CAST, ADD, COMPARE, AND, OR };
+
+// One kernel call of a compiled expression graph.  Steps are stored in
+// topological order and refer to their inputs by index.
+struct Step {
+  StepKind kind;
+  std::shared_ptr<DataType> type;
+  std::vector<int> inputs;
+  // COLUMN: the index of the column in the input schema
+  int column_index = -1;
+  // LITERAL: the value
+  std::shared_ptr<Scalar> scalar;
+  // COMPARE: the comparison
+  CompareOperator compare_op = CompareOperator::EQUAL;
+  // The steps whose results are last used by this one
+  std::vector<int> release;
+};
+
+Status AsArray(MemoryPool* pool, const Datum& value, int64_t length,
+               std::shared_ptr<Array>* out) {
+  if (value.is_array()) {
+    *out = value.make_array();
+    return Status::OK();
+  }
+  return MakeArrayFromScalar(pool, *value.scalar(), length, out);
+}
+
+// An estimate of the bytes per row of a value of the given type
+int64_t RowWidth(const DataType& type) {
+  const auto* fixed_width = dynamic_cast<const FixedWidthType*>(&type);
+  if (fixed_width == nullptr) {
+    // Offsets plus a few bytes of data
+    return 16;
+  }
+  return std::max<int64_t>(1, fixed_width->bit_width() / 8);
+}
+
+}  // namespace
+
+class ExpressionExecutor::Impl : public std::enable_shared_from_this<Impl> {
+ public:
+  Impl(MemoryPool* pool, std::shared_ptr<Schema> input_schema,
+       const ExecutorOptions& options)
+      : pool_(pool), input_schema_(std::move(input_schema)), options_(options) {}
+
+  Status Compile(const std::vector<std::shared_ptr<Expr>>& exprs,
+                 const std::vector<std::string>& names) {
+    if (exprs.size() != names.size()) {
+      return Status::Invalid("Expected ", exprs.size(), " output names, got ",
+                             names.size());
+    }
+    std::vector<std::shared_ptr<Field>> fields;
+    for (size_t i = 0; i < exprs.size(); ++i) {
+      int root;
+      RETURN_NOT_OK(AddStep(*exprs[i], &root));
+      roots_.push_back(root);
+      fields.push_back(field(names[i], steps_[root].type));
+    }
+    output_schema_ = schema(std::move(fields));
+
+    // Release each intermediate result after its last use
+    std::vector<int> last_use(steps_.size(), -1);
+    for (int i = 0; i < static_cast<int>(steps_.size()); ++i) {
+      for (int input : steps_[i].inputs) {
+        last_use[input] = i;
+      }
+    }
+    for (int root : roots_) {
+      last_use[root] = -1;
+    }
+    for (int i = 0; i < static_cast<int>(steps_.size()); ++i) {
+      if (last_use[i] >= 0) {
+        steps_[last_use[i]].release.push_back(i);
+      }
+    }
+
+    if (options_.morsel_size == ExecutorOptions::kAutoMorselSize) {
+      int64_t row_width = 0;
+      for (const auto& step : steps_) {
+        if (step.kind != StepKind::LITERAL) {
+          row_width += RowWidth(*step.type);
+        }
+      }
+      const int64_t cache_size =
+          internal::CpuInfo::GetInstance()->CacheSize(internal::CpuInfo::L2_CACHE);
+      morsel_size_ = cache_size / std::max<int64_t>(1, row_width);
+      morsel_size_ = std::min(kMaxMorselSize, std::max(kMinMorselSize, morsel_size_));
+      // Keep morsel boundaries aligned to whole bitmap words
+      morsel_size_ = BitUtil::RoundDown(morsel_size_, 64);
+    } else if (options_.morsel_size < 0) {
+      return Status::Invalid("Invalid morsel size: ", options_.morsel_size);
+    } else {
+      morsel_size_ = options_.morsel_size;
+    }
+    return Status::OK();
+  }
+
+  Status Execute(const RecordBatch& batch, std::shared_ptr<RecordBatch>* out) const {
+    if (!batch.schema()->Equals(*input_schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Batch schema does not match the executor's: ",
+                             batch.schema()->ToString());
+    }
+    const int64_t num_rows = batch.num_rows();
+    const int num_morsels =
+        std::max(1, static_cast<int>(BitUtil::CeilDiv(num_rows, morsel_size_)));
+    std::vector<ArrayVector> results(num_morsels);
+    auto execute_morsel = [&](int i) {
+      const int64_t offset = i * morsel_size_;
+      const int64_t length = std::min(morsel_size_, num_rows - offset);
+      FunctionContext ctx(pool_);
+      return ExecuteMorsel(&ctx, batch, offset, length, &results[i]);
+    };
+    RETURN_NOT_OK(OptionalParallelFor(options_.use_threads && num_morsels > 1,
+                                      num_morsels, execute_morsel));
+
+    ArrayVector columns(roots_.size());
+    for (size_t j = 0; j < roots_.size(); ++j) {
+      if (num_morsels == 1) {
+        columns[j] = std::move(results[0][j]);
+        continue;
+      }
+      ArrayVector chunks;
+      for (auto& result : results) {
+        chunks.push_back(std::move(result[j]));
+      }
+      RETURN_NOT_OK(Concatenate(chunks, pool_, options_.use_threads, &columns[j]));
+    }
+    *out = RecordBatch::Make(output_schema_, num_rows, std::move(columns));
+    return Status::OK();
+  }
+
+  Status Execute(std::shared_ptr<RecordBatchReader> input,
+                 std::shared_ptr<RecordBatchReader>* out) const {
+    if (!input->schema()->Equals(*input_schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Reader schema does not match the executor's: ",
+                             input->schema()->ToString());
+    }
+    *out = std::make_shared<ExecutingReader>(shared_from_this(), std::move(input));
+    return Status::OK();
+  }
+
+  const std::shared_ptr<Schema>& output_schema() const { return output_schema_; }
+  int64_t morsel_size() const { return morsel_size_; }
+
+ private:
+  class ExecutingReader : public RecordBatchReader {
+   public:
+    ExecutingReader(std::shared_ptr<const Impl> impl,
+                    std::shared_ptr<RecordBatchReader> input)
+        : impl_(std::move(impl)), input_(std::move(input)) {}
+
+    std::shared_ptr<Schema> schema() const override { return impl_->output_schema(); }
+
+    Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+      std::shared_ptr<RecordBatch> input_batch;
+      RETURN_NOT_OK(input_->ReadNext(&input_batch));
+      if (input_batch == nullptr) {
+        *batch = nullptr;
+        return Status::OK();
+      }
+      return impl_->Execute(*input_batch, batch);
+    }
+
+   private:
+    std::shared_ptr<const Impl> impl_;
+    std::shared_ptr<RecordBatchReader> input_;
+  };
+
+  // Add the steps computing an expression, returning the index of its last step
+  Status AddStep(const Expr& expr, int* out) {
+    const Operation* op = expr.op().get();
+    auto it = step_of_op_.find(op);
+    if (it != step_of_op_.end()) {
+      *out = it->second;
+      return Status::OK();
+    }
+    if (!InheritsFrom<ValueExpr>(expr)) {
+      return Status::Invalid("Cannot evaluate expression of kind ", expr.kind());
+    }
+
+    Step step;
+    RETURN_NOT_OK(checked_cast<const ValueExpr&>(expr).type()->ToArrow(&step.type));
+    if (auto column = dynamic_cast<const ops::Column*>(op)) {
+      step.kind = StepKind::COLUMN;
+      step.column_index = input_schema_->GetFieldIndex(column->name());
+      if (step.column_index < 0) {
+        return Status::KeyError("No unique column named '", column->name(),
+                                "' in input schema");
+      }
+      const auto& type = input_schema_->field(step.column_index)->type();
+      if (!type->Equals(*column->type())) {
+        return Status::TypeError("Column '", column->name(), "' has type ",
+                                 type->ToString(), ", expected ",
+                                 column->type()->ToString());
+      }
+      step.type = type;
+    } else if (auto literal = dynamic_cast<const ops::Literal*>(op)) {
+      step.kind = StepKind::LITERAL;
+      step.scalar = literal->value();
+      step.type = step.scalar->type;
+    } else if (auto cast = dynamic_cast<const ops::Cast*>(op)) {
+      int input;
+      RETURN_NOT_OK(AddStep(*cast->value(), &input));
+      if (steps_[input].kind == StepKind::LITERAL) {
+        // Fold the cast of a constant
+        step.kind = StepKind::LITERAL;
+        ARROW_ASSIGN_OR_RAISE(step.scalar, steps_[input].scalar->CastTo(step.type));
+      } else {
+        step.kind = StepKind::CAST;
+        step.inputs = {input};
+      }
+    } else if (auto binary = dynamic_cast<const ops::BinaryOperation*>(op)) {
+      int left, right;
+      RETURN_NOT_OK(AddStep(*binary->left(), &left));
+      RETURN_NOT_OK(AddStep(*binary->right(), &right));
+      step.inputs = {left, right};
+      if (dynamic_cast<const ops::Add*>(op)) {
+        step.kind = StepKind::ADD;
+      } else if (auto compare = dynamic_cast<const ops::Compare*>(op)) {
+        step.kind = StepKind::COMPARE;
+        step.compare_op = compare->op();
+      } else if (dynamic_cast<const ops::And*>(op)) {
+        step.kind = StepKind::AND;
+      } else if (dynamic_cast<const ops::Or*>(op)) {
+        step.kind = StepKind::OR;
+      } else {
+        return Status::NotImplemented("Cannot evaluate binary operation");
+      }
+    } else {
+      return Status::NotImplemented("Cannot evaluate operation of expression of kind ",
+                                    expr.kind());
+    }
+
+    *out = static_cast<int>(steps_.size());
+    steps_.push_back(std::move(step));
+    step_of_op_[op] = *out;
+    return Status::OK();
+  }
+
+  Status ExecuteStep(FunctionContext* ctx, const Step& step, const RecordBatch& batch,
+                     int64_t offset, int64_t length, std::vector<Datum>* values) const {
+    Datum* out = &(*values)[&step - steps_.data()];
+    switch (step.kind) {
+      case StepKind::COLUMN:
+        *out = batch.column(step.column_index)->Slice(offset, length);
+        return Status::OK();
+      case StepKind::LITERAL:
+        *out = step.scalar;
+        return Status::OK();
+      case StepKind::CAST:
+        return Cast(ctx, (*values)[step.inputs[0]], step.type, CastOptions(), out);
+      default:
+        break;
+    }
+
+    const Datum* left = &(*values)[step.inputs[0]];
+    const Datum* right = &(*values)[step.inputs[1]];
+    std::shared_ptr<Array> left_array, right_array;
+    switch (step.kind) {
+      case StepKind::ADD: {
+        // Addition is commutative: keep an array on the left
+        if (left->is_scalar()) {
+          std::swap(left, right);
+        }
+        RETURN_NOT_OK(AsArray(pool_, *left, length, &left_array));
+        std::shared_ptr<Array> result;
+        if (right->is_scalar()) {
+          RETURN_NOT_OK(Add(ctx, *left_array, *right->scalar(), &result));
+        } else {
+          RETURN_NOT_OK(Add(ctx, *left_array, *right->make_array(), &result));
+        }
+        *out = std::move(result);
+        return Status::OK();
+      }
+      case StepKind::COMPARE:
+        if (left->is_scalar() && right->is_scalar()) {
+          RETURN_NOT_OK(AsArray(pool_, *left, length, &left_array));
+          return Compare(ctx, left_array, *right, CompareOptions(step.compare_op), out);
+        }
+        return Compare(ctx, *left, *right, CompareOptions(step.compare_op), out);
+      default:
+        break;
+    }
+
+    RETURN_NOT_OK(AsArray(pool_, *left, length, &left_array));
+    RETURN_NOT_OK(AsArray(pool_, *right, length, &right_array));
+    if (step.kind == StepKind::AND) {
+      return And(ctx, left_array, right_array, out);
+    }
+    return Or(ctx, left_array, right_array, out);
+  }
+
+  Status ExecuteMorsel(FunctionContext* ctx, const RecordBatch& batch, int64_t offset,
+                       int64_t length, ArrayVector* out) const {
+    std::vector<Datum> values(steps_.size());
+    for (const auto& step : steps_) {
+      RETURN_NOT_OK(ExecuteStep(ctx, step, batch, offset, length, &values));
+      for (int input : step.release) {
+        values[input] = Datum();
+      }
+    }
+    for (int root : roots_) {
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(AsArray(pool_, values[root], length, &column));
+      out->push_back(std::move(column));
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<Schema> input_schema_;
+  std::shared_ptr<Schema> output_schema_;
+  ExecutorOptions options_;
+  int64_t morsel_size_;
+  std::vector<Step> steps_;
+  std::unordered_map<const Operation*, int> step_of_op_;
+  // The steps computing the output columns
+  std::vector<int> roots_;
+};
+
+ExpressionExecutor::ExpressionExecutor(std::shared_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+ExpressionExecutor::~ExpressionExecutor() {}
+
+Status ExpressionExecutor::Make(FunctionContext* ctx,
+                                std::shared_ptr<Schema> input_schema,
+                                const std::vector<std::shared_ptr<Expr>>& exprs,
+                                const std::vector<std::string>& names,
+                                const ExecutorOptions& options,
+                                std::unique_ptr<ExpressionExecutor>* out) {
+  auto impl =
+      std::make_shared<Impl>(ctx->memory_pool(), std::move(input_schema), options);
+  RETURN_NOT_OK(impl->Compile(exprs, names));
+  out->reset(new ExpressionExecutor(std::move(impl)));
+  return Status::OK();
+}
+
+const std::shared_ptr<Schema>& ExpressionExecutor::output_schema() const {
+  return impl_->output_schema();
+}
+
+int64_t ExpressionExecutor::morsel_size() const { return impl_->morsel_size(); }
+
+Status ExpressionExecutor::Execute(const RecordBatch& batch,
+                                   std::shared_ptr<RecordBatch>* out) const {
+  return impl_->Execute(batch, out);
+}
+
+Status ExpressionExecutor::Execute(std::shared_ptr<RecordBatchReader> input,
+                                   std::shared_ptr<RecordBatchReader>* out) const {
+  return impl_->Execute(std::move(input), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
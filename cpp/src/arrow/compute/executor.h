@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Evaluation of expression graphs over record batches.
+//
+// An expression graph built from operations (see arrow/compute/operations)
+// is compiled once into a list of kernel calls.  Each input batch is then cut
+// into cache-sized morsels, and every morsel goes through the whole list
+// before the next one is started, so that intermediate results stay in cache
+// instead of being materialized for the whole batch.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
+
+namespace compute {
+
+class Expr;
+class FunctionContext;
+
+/// \brief Options for ExpressionExecutor
+struct ARROW_EXPORT ExecutorOptions {
+  static constexpr int64_t kAutoMorselSize = 0;
+
+  /// The number of rows evaluated at a time, or kAutoMorselSize to choose a
+  /// number of rows whose intermediate results fit in the L2 cache
+  int64_t morsel_size = kAutoMorselSize;
+
+  /// Whether the morsels of a batch may be evaluated in parallel on the CPU
+  /// thread pool
+  bool use_threads = true;
+};
+
+/// \brief Evaluate expressions on record batches, a morsel at a time
+///
+/// The supported operations are ops::Column, ops::Literal, ops::Cast, ops::Add,
+/// ops::Compare, ops::And and ops::Or.  Common subexpressions (operations
+/// shared by several expressions) are evaluated once, casts of literals are
+/// folded, and each intermediate result is released after its last use.
+///
+/// An executor is immutable once made, and may be used from several threads.
+class ARROW_EXPORT ExpressionExecutor {
+ public:
+  ~ExpressionExecutor();
+
+  /// \brief Compile expressions for evaluation
+  ///
+  /// \param[in] ctx the FunctionContext, whose memory pool results are
+  /// allocated from
+  /// \param[in] input_schema the schema of the batches evaluated on; the
+  /// ops::Column operations refer to its fields
+  /// \param[in] exprs the value expressions to evaluate
+  /// \param[in] names the names of the output columns, one per expression
+  /// \param[in] options morsel size and parallelism
+  /// \param[out] out the created executor
+  static Status Make(FunctionContext* ctx, std::shared_ptr<Schema> input_schema,
+                     const std::vector<std::shared_ptr<Expr>>& exprs,
+                     const std::vector<std::string>& names,
+                     const ExecutorOptions& options,
+                     std::unique_ptr<ExpressionExecutor>* out);
+
+  /// \brief The schema of the output batches
+  const std::shared_ptr<Schema>& output_schema() const;
+
+  /// \brief The number of rows evaluated at a time
+  int64_t morsel_size() const;
+
+  /// \brief Evaluate the expressions on a batch, one output column each
+  ///
+  /// Scalar expressions are broadcast to the length of the batch.
+  Status Execute(const RecordBatch& batch, std::shared_ptr<RecordBatch>* out) const;
+
+  /// \brief Evaluate the expressions lazily on a stream of batches
+  ///
+  /// Each batch read from the returned reader is the result of evaluating the
+  /// expressions on the next batch of the input.
+  Status Execute(std::shared_ptr<RecordBatchReader> input,
+                 std::shared_ptr<RecordBatchReader>* out) const;
+
+ private:
+  class Impl;
+  explicit ExpressionExecutor(std::shared_ptr<Impl> impl);
+
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
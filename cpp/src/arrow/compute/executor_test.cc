@@ -0,0 +1,222 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/executor.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/kernels/add.h"
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/column.h"
+#include "arrow/compute/operations/elementwise.h"
+#include "arrow/compute/operations/literal.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+std::shared_ptr<Expr> ToExpr(const std::shared_ptr<Operation>& op) {
+  std::shared_ptr<Expr> expr;
+  ABORT_NOT_OK(op->ToExpr(&expr));
+  return expr;
+}
+
+std::shared_ptr<Expr> Column(const std::string& name, std::shared_ptr<DataType> type) {
+  return ToExpr(std::make_shared<ops::Column>(name, std::move(type)));
+}
+
+std::shared_ptr<Expr> Literal(std::shared_ptr<Scalar> value) {
+  return ToExpr(std::make_shared<ops::Literal>(std::move(value)));
+}
+
+class TestExpressionExecutor : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    random::RandomArrayGenerator rand(0x5eed);
+    schema_ = schema({field("a", int32()), field("b", int16()), field("c", boolean())});
+    const int64_t length = 5000;
+    batch_ = RecordBatch::Make(schema_, length,
+                               {rand.Int32(length, -1000, 1000, 0.1),
+                                rand.Int16(length, -1000, 1000, 0.1),
+                                rand.Boolean(length, 0.5, 0.1)});
+
+    // x = a + cast(b as int32)
+    // out0 = (x > 10 and c) or (a < 0)
+    // out1 = x + 7
+    auto a = Column("a", int32());
+    auto x = ToExpr(std::make_shared<ops::Add>(
+        a, ToExpr(std::make_shared<ops::Cast>(Column("b", int16()), type::int32()))));
+    auto greater = ToExpr(std::make_shared<ops::Compare>(
+        x, Literal(std::make_shared<Int32Scalar>(10)), CompareOperator::GREATER));
+    auto less = ToExpr(std::make_shared<ops::Compare>(
+        a, Literal(std::make_shared<Int32Scalar>(0)), CompareOperator::LESS));
+    auto out0 = ToExpr(std::make_shared<ops::Or>(
+        ToExpr(std::make_shared<ops::And>(greater, Column("c", boolean()))), less));
+    auto out1 =
+        ToExpr(std::make_shared<ops::Add>(x, Literal(std::make_shared<Int32Scalar>(7))));
+    exprs_ = {out0, out1};
+    names_ = {"out0", "out1"};
+  }
+
+  // Evaluate the expressions kernel by kernel on whole columns
+  std::shared_ptr<RecordBatch> Expected(const RecordBatch& batch) {
+    std::shared_ptr<Array> b, x, out1;
+    ABORT_NOT_OK(Cast(&ctx_, *batch.column(1), int32(), CastOptions(), &b));
+    ABORT_NOT_OK(Add(&ctx_, *batch.column(0), *b, &x));
+    ABORT_NOT_OK(Add(&ctx_, *x, Int32Scalar(7), &out1));
+    Datum greater, less, conj, out0;
+    ABORT_NOT_OK(Compare(&ctx_, x, Datum(std::make_shared<Int32Scalar>(10)),
+                         CompareOptions(CompareOperator::GREATER), &greater));
+    ABORT_NOT_OK(Compare(&ctx_, batch.column(0), Datum(std::make_shared<Int32Scalar>(0)),
+                         CompareOptions(CompareOperator::LESS), &less));
+    ABORT_NOT_OK(And(&ctx_, greater, batch.column(2), &conj));
+    ABORT_NOT_OK(Or(&ctx_, conj, less, &out0));
+    return RecordBatch::Make(schema({field("out0", boolean()), field("out1", int32())}),
+                             batch.num_rows(), {out0.make_array(), out1});
+  }
+
+  void CheckExecute(const ExecutorOptions& options) {
+    std::unique_ptr<ExpressionExecutor> executor;
+    ASSERT_OK(
+        ExpressionExecutor::Make(&ctx_, schema_, exprs_, names_, options, &executor));
+    std::shared_ptr<RecordBatch> out;
+    ASSERT_OK(executor->Execute(*batch_, &out));
+    ASSERT_OK(out->ValidateFull());
+    AssertBatchesEqual(*Expected(*batch_), *out);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> batch_;
+  std::vector<std::shared_ptr<Expr>> exprs_;
+  std::vector<std::string> names_;
+};
+
+TEST_F(TestExpressionExecutor, MorselSizes) {
+  for (bool use_threads : {false, true}) {
+    for (int64_t morsel_size : {0, 1, 7, 64, 1000, 100000}) {
+      SCOPED_TRACE("use_threads = " + std::to_string(use_threads) +
+                   ", morsel_size = " + std::to_string(morsel_size));
+      ExecutorOptions options;
+      options.use_threads = use_threads;
+      options.morsel_size = morsel_size;
+      CheckExecute(options);
+    }
+  }
+}
+
+TEST_F(TestExpressionExecutor, AutoMorselSize) {
+  std::unique_ptr<ExpressionExecutor> executor;
+  ASSERT_OK(ExpressionExecutor::Make(&ctx_, schema_, exprs_, names_, ExecutorOptions(),
+                                     &executor));
+  ASSERT_GE(executor->morsel_size(), 1024);
+  ASSERT_LE(executor->morsel_size(), 1 << 20);
+  ASSERT_EQ(executor->morsel_size() % 64, 0);
+  AssertSchemaEqual(*schema({field("out0", boolean()), field("out1", int32())}),
+                    *executor->output_schema());
+}
+
+TEST_F(TestExpressionExecutor, EmptyBatch) {
+  ExecutorOptions options;
+  options.morsel_size = 16;
+  batch_ = batch_->Slice(0, 0);
+  CheckExecute(options);
+}
+
+TEST_F(TestExpressionExecutor, ScalarExpressions) {
+  // A cast literal is folded, then broadcast to the batch length
+  auto folded = ToExpr(std::make_shared<ops::Cast>(
+      Literal(std::make_shared<Int8Scalar>(5)), type::int32()));
+  auto sum = ToExpr(std::make_shared<ops::Add>(folded, Column("a", int32())));
+  std::unique_ptr<ExpressionExecutor> executor;
+  ExecutorOptions options;
+  options.morsel_size = 3;
+  ASSERT_OK(ExpressionExecutor::Make(&ctx_, schema_, {folded, sum}, {"five", "sum"},
+                                     options, &executor));
+
+  auto batch = RecordBatch::Make(schema_, 4,
+                                 {ArrayFromJSON(int32(), "[1, null, 3, 4]"),
+                                  ArrayFromJSON(int16(), "[2, 2, 2, 2]"),
+                                  ArrayFromJSON(boolean(), "[true, true, true, true]")});
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(executor->Execute(*batch, &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[5, 5, 5, 5]"), *out->column(0));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[6, null, 8, 9]"), *out->column(1));
+}
+
+TEST_F(TestExpressionExecutor, Stream) {
+  ExecutorOptions options;
+  options.morsel_size = 100;
+  std::unique_ptr<ExpressionExecutor> executor;
+  ASSERT_OK(ExpressionExecutor::Make(&ctx_, schema_, exprs_, names_, options, &executor));
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch_->Slice(0, 1234), batch_->Slice(1234)},
+                                     &table));
+  auto input = std::make_shared<TableBatchReader>(*table);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(executor->Execute(input, &reader));
+  AssertSchemaEqual(*executor->output_schema(), *reader->schema());
+
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(reader->ReadNext(&out));
+  AssertBatchesEqual(*Expected(*batch_->Slice(0, 1234)), *out);
+  ASSERT_OK(reader->ReadNext(&out));
+  AssertBatchesEqual(*Expected(*batch_->Slice(1234)), *out);
+  ASSERT_OK(reader->ReadNext(&out));
+  ASSERT_EQ(out, nullptr);
+}
+
+TEST_F(TestExpressionExecutor, Errors) {
+  std::unique_ptr<ExpressionExecutor> executor;
+  ExecutorOptions options;
+  ASSERT_RAISES(Invalid, ExpressionExecutor::Make(&ctx_, schema_, exprs_, {"out0"},
+                                                  options, &executor));
+  ASSERT_RAISES(KeyError, ExpressionExecutor::Make(&ctx_, schema_, {Column("x", int32())},
+                                                   {"x"}, options, &executor));
+  ASSERT_RAISES(TypeError, ExpressionExecutor::Make(&ctx_, schema_,
+                                                    {Column("a", int64())}, {"a"},
+                                                    options, &executor));
+  options.morsel_size = -1;
+  ASSERT_RAISES(Invalid, ExpressionExecutor::Make(&ctx_, schema_, exprs_, names_,
+                                                  options, &executor));
+
+  ASSERT_OK(ExpressionExecutor::Make(&ctx_, schema_, exprs_, names_, ExecutorOptions(),
+                                     &executor));
+  std::shared_ptr<RecordBatch> other, out;
+  ASSERT_OK(batch_->RemoveColumn(2, &other));
+  ASSERT_RAISES(Invalid, executor->Execute(*other, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
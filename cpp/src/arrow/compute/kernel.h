@@ -58,6 +58,14 @@ class ARROW_EXPORT OpKernel {
   /// \brief EXPERIMENTAL The output data type of the kernel
   /// \return the output type
   virtual std::shared_ptr<DataType> out_type() const = 0;
+
+  /// \brief Whether Call may run concurrently on different inputs
+  ///
+  /// When true and FunctionContext::use_threads() is set, the chunks of a
+  /// ChunkedArray input are dispatched to the CPU thread pool.  Kernels keeping
+  /// state across calls (e.g. hash kernels building a dictionary) must leave
+  /// this false.
+  virtual bool parallelizable() const { return false; }
 };
 
 struct Datum;
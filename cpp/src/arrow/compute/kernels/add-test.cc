@@ -56,6 +56,23 @@ class TestArithmeticKernel : public ComputeFixture, public TestBase {
     AssertAddArrays(ArrayFromJSON(type, lhs), ArrayFromJSON(type, rhs),
                     ArrayFromJSON(type, expected));
   }
+
+  void AssertAddScalar(const std::shared_ptr<Array>& lhs,
+                       const std::shared_ptr<Scalar>& rhs, const std::string& expected) {
+    auto type = TypeTraits<ArrowType>::type_singleton();
+    auto expected_array = ArrayFromJSON(type, expected);
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(arrow::compute::Add(&this->ctx_, *lhs, *rhs, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected_array, *actual);
+
+    // The scalar may be either operand of the kernel
+    std::unique_ptr<AddKernel> kernel;
+    ASSERT_OK(AddKernel::Make(lhs->type(), &kernel));
+    Datum out;
+    ASSERT_OK(kernel->Call(&this->ctx_, Datum(rhs), Datum(lhs), &out));
+    AssertArraysEqual(*expected_array, *out.make_array());
+  }
 };
 
 template <typename ArrowType>
@@ -102,5 +119,26 @@ TYPED_TEST(TestArithmeticKernelForIntegral, SortIntegral) {
                   "[null, 5, 5, null, 2, 8]");
 }
 
+TYPED_TEST(TestArithmeticKernelForIntegral, AddScalar) {
+  using CType = typename TypeTraits<TypeParam>::CType;
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  auto two = std::make_shared<ScalarType>(static_cast<CType>(2));
+
+  this->AssertAddScalar(ArrayFromJSON(type, "[]"), two, "[]");
+  this->AssertAddScalar(ArrayFromJSON(type, "[3, 2, 6]"), two, "[5, 4, 8]");
+  auto array = ArrayFromJSON(type, "[null, 1, 3, null, 2, 5, 0, 1, 9, 4, null]");
+  this->AssertAddScalar(array, two, "[null, 3, 5, null, 4, 7, 2, 3, 11, 6, null]");
+  this->AssertAddScalar(array->Slice(3), two, "[null, 4, 7, 2, 3, 11, 6, null]");
+  this->AssertAddScalar(array->Slice(1, 2), two, "[3, 5]");
+  this->AssertAddScalar(array, std::make_shared<ScalarType>(),
+                        "[null, null, null, null, null, null, null, null, null, null, "
+                        "null]");
+
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES(Invalid, arrow::compute::Add(&this->ctx_, *array,
+                                             DoubleScalar(1.0), &actual));
+}
+
 }  // namespace compute
 }  // namespace arrow
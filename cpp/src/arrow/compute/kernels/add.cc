@@ -17,8 +17,12 @@
 
 #include "arrow/compute/kernels/add.h"
 #include "arrow/builder.h"
+#include "arrow/buffer.h"
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/selection.h"
+#include "arrow/scalar.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 
 namespace arrow {
 namespace compute {
@@ -27,6 +31,8 @@ template <typename ArrowType>
 class AddKernelImpl : public AddKernel {
  private:
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  using CType = typename TypeTraits<ArrowType>::CType;
   std::shared_ptr<DataType> result_type_;
 
   Status Add(FunctionContext* ctx, const std::shared_ptr<ArrayType>& lhs,
@@ -43,22 +49,75 @@ class AddKernelImpl : public AddKernel {
     return builder.Finish(result);
   }
 
+  Status Add(FunctionContext* ctx, const ArrayType& lhs, const ScalarType& rhs,
+             std::shared_ptr<Array>* result) {
+    const int64_t length = lhs.length();
+    if (!rhs.is_valid) {
+      return MakeArrayOfNull(ctx->memory_pool(), result_type_, length, result);
+    }
+
+    // Null slots are added too, which is cheaper than skipping them
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(CType), &values));
+    auto out_values = reinterpret_cast<CType*>(values->mutable_data());
+    const CType* lhs_values = lhs.raw_values();
+    const CType scalar = rhs.value;
+    for (int64_t i = 0; i < length; i++) {
+      out_values[i] = lhs_values[i] + scalar;
+    }
+
+    std::shared_ptr<Buffer> null_bitmap;
+    if (lhs.null_count() > 0) {
+      if (lhs.offset() == 0) {
+        null_bitmap = lhs.null_bitmap();
+      } else {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap,
+                              internal::CopyBitmap(ctx->memory_pool(),
+                                                   lhs.null_bitmap_data(), lhs.offset(),
+                                                   length));
+      }
+    }
+    *result = MakeArray(ArrayData::Make(result_type_, length, {null_bitmap, values},
+                                        lhs.null_count()));
+    return Status::OK();
+  }
+
+  Status Add(FunctionContext* ctx, const ArrayType& lhs, const ArrayType& rhs,
+             const SelectionVector& selection, std::shared_ptr<Array>* result) {
+    NumericBuilder<ArrowType> builder(ctx->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(selection.num_selected()));
+    selection.VisitSelected([&](int64_t i) {
+      if (lhs.IsNull(i) || rhs.IsNull(i)) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(lhs.Value(i) + rhs.Value(i));
+      }
+    });
+    return builder.Finish(result);
+  }
+
  public:
   explicit AddKernelImpl(std::shared_ptr<DataType> result_type)
       : result_type_(result_type) {}
 
   Status Call(FunctionContext* ctx, const Datum& lhs, const Datum& rhs,
               Datum* out) override {
-    if (!lhs.is_array() || !rhs.is_array()) {
-      return Status::Invalid("AddKernel expects array values");
-    }
-    if (lhs.length() != rhs.length()) {
-      return Status::Invalid("AddKernel expects arrays with the same length");
-    }
-    auto lhs_array = lhs.make_array();
-    auto rhs_array = rhs.make_array();
     std::shared_ptr<Array> result;
-    RETURN_NOT_OK(this->Add(ctx, lhs_array, rhs_array, &result));
+    if (lhs.is_array() && rhs.is_scalar()) {
+      RETURN_NOT_OK(this->Add(ctx, lhs.make_array(), *rhs.scalar(), &result));
+    } else if (lhs.is_scalar() && rhs.is_array()) {
+      RETURN_NOT_OK(this->Add(ctx, rhs.make_array(), *lhs.scalar(), &result));
+    } else {
+      if (!lhs.is_array() || !rhs.is_array()) {
+        return Status::Invalid("AddKernel expects array values");
+      }
+      if (lhs.length() != rhs.length()) {
+        return Status::Invalid("AddKernel expects arrays with the same length");
+      }
+      auto lhs_array = lhs.make_array();
+      auto rhs_array = rhs.make_array();
+      RETURN_NOT_OK(this->Add(ctx, lhs_array, rhs_array, &result));
+    }
     *out = result;
     return Status::OK();
   }
@@ -71,6 +130,22 @@ class AddKernelImpl : public AddKernel {
     auto rhs_array = std::static_pointer_cast<ArrayType>(rhs);
     return Add(ctx, lhs_array, rhs_array, result);
   }
+
+  Status Add(FunctionContext* ctx, const std::shared_ptr<Array>& lhs, const Scalar& rhs,
+             std::shared_ptr<Array>* result) override {
+    return Add(ctx, static_cast<const ArrayType&>(*lhs),
+               static_cast<const ScalarType&>(rhs), result);
+  }
+
+  Status Add(FunctionContext* ctx, const std::shared_ptr<Array>& lhs,
+             const std::shared_ptr<Array>& rhs, const SelectionVector& selection,
+             std::shared_ptr<Array>* result) override {
+    if (lhs->length() != selection.length() || rhs->length() != selection.length()) {
+      return Status::Invalid("AddKernel expects arrays with the length of the selection");
+    }
+    return Add(ctx, static_cast<const ArrayType&>(*lhs),
+               static_cast<const ArrayType&>(*rhs), selection, result);
+  }
 };
 
 Status AddKernel::Make(const std::shared_ptr<DataType>& value_type,
@@ -127,5 +202,27 @@ Status Add(FunctionContext* ctx, const Array& lhs, const Array& rhs,
   return Status::OK();
 }
 
+Status Add(FunctionContext* ctx, const Array& lhs, const Scalar& rhs,
+           std::shared_ptr<Array>* result) {
+  std::unique_ptr<AddKernel> kernel;
+  ARROW_RETURN_IF(
+      !lhs.type()->Equals(rhs.type),
+      Status::Invalid("Array and scalar types should be equal to use arithmetic "
+                      "kernels"));
+  RETURN_NOT_OK(AddKernel::Make(lhs.type(), &kernel));
+  return kernel->Add(ctx, MakeArray(lhs.data()), rhs, result);
+}
+
+Status Add(FunctionContext* ctx, const Array& lhs, const Array& rhs,
+           const SelectionVector& selection, std::shared_ptr<Array>* result) {
+  std::unique_ptr<AddKernel> kernel;
+  ARROW_RETURN_IF(
+      !lhs.type()->Equals(rhs.type()),
+      Status::Invalid("Array types should be equal to use arithmetic kernels"));
+  RETURN_NOT_OK(AddKernel::Make(lhs.type(), &kernel));
+  return kernel->Add(ctx, MakeArray(lhs.data()), MakeArray(rhs.data()), selection,
+                     result);
+}
+
 }  // namespace compute
 }  // namespace arrow
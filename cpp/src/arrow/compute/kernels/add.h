@@ -26,10 +26,12 @@
 namespace arrow {
 
 class Array;
+struct Scalar;
 
 namespace compute {
 
 class FunctionContext;
+class SelectionVector;
 
 /// \brief Summarizes two arrays.
 ///
@@ -49,6 +51,40 @@ ARROW_EXPORT
 Status Add(FunctionContext* ctx, const Array& lhs, const Array& rhs,
            std::shared_ptr<Array>* result);
 
+/// \brief Adds a scalar to every value of an array.
+///
+/// The scalar isn't broadcast to an array: it is added to the array values
+/// in a single pass, and the validity bitmap of the array is reused.
+/// The types of the array and the scalar should be equal.
+///
+/// For example given lhs = [1, null, 3] and rhs = 4, the output will be
+/// [5, null, 7]; if rhs is null, the output is all null
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] lhs the array
+/// \param[in] rhs the scalar
+/// \param[out] result the sums
+ARROW_EXPORT
+Status Add(FunctionContext* ctx, const Array& lhs, const Scalar& rhs,
+           std::shared_ptr<Array>* result);
+
+/// \brief Summarizes two arrays at the selected positions only.
+///
+/// The output has one value per selected position, so that only the final
+/// operation of a chain working on a selection materializes an array.
+///
+/// For example given lhs = [1, null, 3], rhs = [4, 5, 6] and the selected
+/// positions [1, 2], the output will be [null, 9]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] lhs the first array
+/// \param[in] rhs the second array
+/// \param[in] selection the positions to summarize, with the length of the arrays
+/// \param[out] result the sums at the selected positions
+ARROW_EXPORT
+Status Add(FunctionContext* ctx, const Array& lhs, const Array& rhs,
+           const SelectionVector& selection, std::shared_ptr<Array>* result);
+
 /// \brief BinaryKernel implementing Add operation
 class ARROW_EXPORT AddKernel : public BinaryKernel {
  public:
@@ -66,6 +102,15 @@ class ARROW_EXPORT AddKernel : public BinaryKernel {
                      const std::shared_ptr<Array>& rhs,
                      std::shared_ptr<Array>* result) = 0;
 
+  /// \brief array-scalar implementation
+  virtual Status Add(FunctionContext* ctx, const std::shared_ptr<Array>& lhs,
+                     const Scalar& rhs, std::shared_ptr<Array>* result) = 0;
+
+  /// \brief single-array implementation, at the selected positions only
+  virtual Status Add(FunctionContext* ctx, const std::shared_ptr<Array>& lhs,
+                     const std::shared_ptr<Array>& rhs, const SelectionVector& selection,
+                     std::shared_ptr<Array>* result) = 0;
+
   /// \brief factory for Add
   ///
   /// \param[in] value_type constructed AddKernel
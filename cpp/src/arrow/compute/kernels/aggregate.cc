@@ -16,9 +16,13 @@
 // under the License.
 
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace compute {
@@ -62,17 +66,24 @@ Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datu
     auto array = input.make_array();
     RETURN_NOT_OK(aggregate_function_->Consume(*array, state->mutable_data()));
   } else {
+    // Chunks are consumed into separate states, possibly in parallel, and the
+    // states merged in chunk order
     auto chunked_array = input.chunked_array();
-    for (int i = 0; i < chunked_array->num_chunks(); i++) {
-      auto tmp_state =
-          ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
-      if (!tmp_state) {
-        return Status::OutOfMemory("AggregateState allocation failed");
-      }
-      RETURN_NOT_OK(aggregate_function_->Consume(*chunked_array->chunk(i),
-                                                 tmp_state->mutable_data()));
+    const int num_chunks = chunked_array->num_chunks();
+    std::vector<std::shared_ptr<ManagedAggregateState>> chunk_states(num_chunks);
+    RETURN_NOT_OK(internal::OptionalParallelFor(
+        ctx->use_threads() && num_chunks > 1, num_chunks, [&](int i) -> Status {
+          chunk_states[i] =
+              ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
+          if (!chunk_states[i]) {
+            return Status::OutOfMemory("AggregateState allocation failed");
+          }
+          return aggregate_function_->Consume(*chunked_array->chunk(i),
+                                              chunk_states[i]->mutable_data());
+        }));
+    for (const auto& chunk_state : chunk_states) {
       RETURN_NOT_OK(
-          aggregate_function_->Merge(tmp_state->mutable_data(), state->mutable_data()));
+          aggregate_function_->Merge(chunk_state->mutable_data(), state->mutable_data()));
     }
   }
 
@@ -83,5 +94,24 @@ std::shared_ptr<DataType> AggregateUnaryKernel::out_type() const {
   return aggregate_function_->out_type();
 }
 
+static SimdLevel::type DetectSimdLevel() {
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (internal::IsDispatchLevelSupported(internal::DispatchLevel::AVX512)) {
+    return SimdLevel::AVX512;
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (internal::IsDispatchLevelSupported(internal::DispatchLevel::AVX2)) {
+    return SimdLevel::AVX2;
+  }
+#endif
+  return SimdLevel::NONE;
+}
+
+SimdLevel::type GetSimdLevel() {
+  static const SimdLevel::type level = DetectSimdLevel();
+  return level;
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,252 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with AVX2 enabled, its functions must only be called
+// after checking for AVX2 support at runtime.
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/minmax_internal.h"
+#include "arrow/compute/kernels/sum_internal.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Masks of 4 64-bit (resp. 8 32-bit) lanes from the low bits of valid_bits:
+// each lane is all ones if its bit is set, zero otherwise.
+inline __m256i ValidityMask64(uint64_t valid_bits) {
+  const __m256i lane_bits = _mm256_setr_epi64x(1, 2, 4, 8);
+  const __m256i bits = _mm256_set1_epi64x(static_cast<int64_t>(valid_bits));
+  return _mm256_cmpeq_epi64(_mm256_and_si256(bits, lane_bits), lane_bits);
+}
+
+inline __m256i ValidityMask32(uint64_t valid_bits) {
+  const __m256i lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+  const __m256i bits = _mm256_set1_epi32(static_cast<int32_t>(valid_bits));
+  return _mm256_cmpeq_epi32(_mm256_and_si256(bits, lane_bits), lane_bits);
+}
+
+// Load 4 values, widened to the accumulator type
+inline __m128i Load128(const void* values) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+}
+
+inline __m256i Load4(const int32_t* values) {
+  return _mm256_cvtepi32_epi64(Load128(values));
+}
+
+inline __m256i Load4(const uint32_t* values) {
+  return _mm256_cvtepu32_epi64(Load128(values));
+}
+
+inline __m256i Load4(const int64_t* values) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+}
+
+inline __m256i Load4(const uint64_t* values) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+}
+
+inline __m256d Load4(const float* values) {
+  return _mm256_cvtps_pd(_mm_loadu_ps(values));
+}
+
+inline __m256d Load4(const double* values) { return _mm256_loadu_pd(values); }
+
+template <typename SumCType, typename CType>
+SumCType MaskedSumScalar(const CType* values, int64_t i, int64_t length,
+                         uint64_t valid_bits) {
+  SumCType sum = 0;
+  for (; i < length; ++i) {
+    if ((valid_bits >> i) & 1) {
+      sum += values[i];
+    }
+  }
+  return sum;
+}
+
+// Null slots are cleared by and-ing the values with the validity mask
+template <typename SumCType, typename CType>
+SumCType MaskedSumInteger(const CType* values, int64_t length, uint64_t valid_bits) {
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const __m256i v0 = Load4(values + i);
+    const __m256i v1 = Load4(values + i + 4);
+    acc0 = _mm256_add_epi64(acc0, _mm256_and_si256(v0, ValidityMask64(valid_bits >> i)));
+    acc1 = _mm256_add_epi64(acc1,
+                            _mm256_and_si256(v1, ValidityMask64(valid_bits >> (i + 4))));
+  }
+  alignas(32) SumCType lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+         MaskedSumScalar<SumCType>(values, i, length, valid_bits);
+}
+
+template <typename CType>
+double MaskedSumFloating(const CType* values, int64_t length, uint64_t valid_bits) {
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const __m256d v0 = Load4(values + i);
+    const __m256d v1 = Load4(values + i + 4);
+    const __m256d mask0 = _mm256_castsi256_pd(ValidityMask64(valid_bits >> i));
+    const __m256d mask1 = _mm256_castsi256_pd(ValidityMask64(valid_bits >> (i + 4)));
+    acc0 = _mm256_add_pd(acc0, _mm256_and_pd(v0, mask0));
+    acc1 = _mm256_add_pd(acc1, _mm256_and_pd(v1, mask1));
+  }
+  alignas(32) double lanes[4];
+  _mm256_store_pd(lanes, _mm256_add_pd(acc0, acc1));
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+         MaskedSumScalar<double>(values, i, length, valid_bits);
+}
+
+template <typename CType>
+void MaskedMinMaxScalar(const CType* values, int64_t i, int64_t length,
+                        uint64_t valid_bits, CType* min, CType* max) {
+  using Block = MinMaxBlock<SimdLevel::NONE, CType>;
+  for (; i < length; ++i) {
+    if ((valid_bits >> i) & 1) {
+      *min = Block::Min(*min, values[i]);
+      *max = Block::Max(*max, values[i]);
+    }
+  }
+}
+
+template <typename CType, typename VectorType>
+void ReduceMinMaxLanes(VectorType min_acc, VectorType max_acc, CType* min,
+                       CType* max) {
+  using Block = MinMaxBlock<SimdLevel::NONE, CType>;
+  constexpr int kLanes = sizeof(VectorType) / sizeof(CType);
+  alignas(32) CType min_lanes[kLanes];
+  alignas(32) CType max_lanes[kLanes];
+  std::memcpy(min_lanes, &min_acc, sizeof(VectorType));
+  std::memcpy(max_lanes, &max_acc, sizeof(VectorType));
+  for (int j = 0; j < kLanes; ++j) {
+    *min = Block::Min(*min, min_lanes[j]);
+    *max = Block::Max(*max, max_lanes[j]);
+  }
+}
+
+}  // namespace
+
+// Masked sums
+
+#define SUM_BLOCK_MASKED(CTYPE, SUM_CTYPE, IMPL)                                       \
+  template <>                                                                          \
+  SUM_CTYPE SumBlock<SimdLevel::AVX2, CTYPE, SUM_CTYPE>::Masked(                       \
+      const CTYPE* values, int64_t length, uint64_t valid_bits) {                      \
+    return IMPL(values, length, valid_bits);                                           \
+  }
+
+SUM_BLOCK_MASKED(int32_t, int64_t, MaskedSumInteger<int64_t>)
+SUM_BLOCK_MASKED(uint32_t, uint64_t, MaskedSumInteger<uint64_t>)
+SUM_BLOCK_MASKED(int64_t, int64_t, MaskedSumInteger<int64_t>)
+SUM_BLOCK_MASKED(uint64_t, uint64_t, MaskedSumInteger<uint64_t>)
+SUM_BLOCK_MASKED(float, double, MaskedSumFloating)
+SUM_BLOCK_MASKED(double, double, MaskedSumFloating)
+
+#undef SUM_BLOCK_MASKED
+
+// Masked min/max: null slots are replaced with the identity of min (resp. max)
+// by blending
+
+template <>
+void MinMaxBlock<SimdLevel::AVX2, int32_t>::ScanMasked(const int32_t* values,
+                                                       int64_t length,
+                                                       uint64_t valid_bits,
+                                                       int32_t* min, int32_t* max) {
+  const __m256i min_identity = _mm256_set1_epi32(MinIdentity());
+  const __m256i max_identity = _mm256_set1_epi32(MaxIdentity());
+  __m256i min_acc = _mm256_set1_epi32(*min);
+  __m256i max_acc = _mm256_set1_epi32(*max);
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+    const __m256i mask = ValidityMask32(valid_bits >> i);
+    min_acc = _mm256_min_epi32(min_acc, _mm256_blendv_epi8(min_identity, v, mask));
+    max_acc = _mm256_max_epi32(max_acc, _mm256_blendv_epi8(max_identity, v, mask));
+  }
+  ReduceMinMaxLanes(min_acc, max_acc, min, max);
+  MaskedMinMaxScalar(values, i, length, valid_bits, min, max);
+}
+
+template <>
+void MinMaxBlock<SimdLevel::AVX2, int64_t>::ScanMasked(const int64_t* values,
+                                                       int64_t length,
+                                                       uint64_t valid_bits,
+                                                       int64_t* min, int64_t* max) {
+  // AVX2 has no 64-bit integer min/max instructions
+  __m256i min_acc = _mm256_set1_epi64x(*min);
+  __m256i max_acc = _mm256_set1_epi64x(*max);
+  int64_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m256i v = Load4(values + i);
+    const __m256i mask = ValidityMask64(valid_bits >> i);
+    const __m256i lt = _mm256_and_si256(mask, _mm256_cmpgt_epi64(min_acc, v));
+    const __m256i gt = _mm256_and_si256(mask, _mm256_cmpgt_epi64(v, max_acc));
+    min_acc = _mm256_blendv_epi8(min_acc, v, lt);
+    max_acc = _mm256_blendv_epi8(max_acc, v, gt);
+  }
+  ReduceMinMaxLanes(min_acc, max_acc, min, max);
+  MaskedMinMaxScalar(values, i, length, valid_bits, min, max);
+}
+
+template <>
+void MinMaxBlock<SimdLevel::AVX2, double>::ScanMasked(const double* values,
+                                                      int64_t length, uint64_t valid_bits,
+                                                      double* min, double* max) {
+  const __m256d min_identity = _mm256_set1_pd(MinIdentity());
+  const __m256d max_identity = _mm256_set1_pd(MaxIdentity());
+  __m256d min_acc = _mm256_set1_pd(*min);
+  __m256d max_acc = _mm256_set1_pd(*max);
+  int64_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m256d v = _mm256_loadu_pd(values + i);
+    const __m256d mask = _mm256_castsi256_pd(ValidityMask64(valid_bits >> i));
+    // When an operand is NaN, minpd / maxpd return the second one: NaN values
+    // are ignored.
+    min_acc = _mm256_min_pd(_mm256_blendv_pd(min_identity, v, mask), min_acc);
+    max_acc = _mm256_max_pd(_mm256_blendv_pd(max_identity, v, mask), max_acc);
+  }
+  ReduceMinMaxLanes(min_acc, max_acc, min, max);
+  MaskedMinMaxScalar(values, i, length, valid_bits, min, max);
+}
+
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunctionAvx2(const DataType& type) {
+  return MakeSumLikeAggregateFunction<SumState, SimdLevel::AVX2>(type);
+}
+
+std::shared_ptr<AggregateFunction> MakeMeanAggregateFunctionAvx2(const DataType& type) {
+  return MakeSumLikeAggregateFunction<MeanState, SimdLevel::AVX2>(type);
+}
+
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunctionAvx2(
+    const DataType& type, const MinMaxOptions& options) {
+  return MakeMinMaxAggregateFunctionImpl<SimdLevel::AVX2>(type, options);
+}
+
+}  // namespace compute
+}  // namespace arrow
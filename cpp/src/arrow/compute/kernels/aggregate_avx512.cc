@@ -0,0 +1,214 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with AVX-512 enabled, its functions must only be called
+// after checking for AVX-512 support at runtime.
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/minmax_internal.h"
+#include "arrow/compute/kernels/sum_internal.h"
+
+namespace arrow {
+namespace compute {
+
+// The validity bits are used directly as AVX-512 mask registers.  Since the
+// bits past the end of a block are zero, masked loads can read the whole
+// block, including its tail, without touching memory past its end.
+
+namespace {
+
+inline __m512i MaskedLoad8(const int64_t* values, __mmask8 mask) {
+  return _mm512_maskz_loadu_epi64(mask, values);
+}
+
+inline __m512i MaskedLoad8(const uint64_t* values, __mmask8 mask) {
+  return _mm512_maskz_loadu_epi64(mask, values);
+}
+
+inline __m512d MaskedLoad8(const double* values, __mmask8 mask) {
+  return _mm512_maskz_loadu_pd(mask, values);
+}
+
+// 32-bit values are loaded 16 at a time, and widened to two vectors of
+// 64-bit lanes
+inline void MaskedLoad16(const int32_t* values, __mmask16 mask, __m512i* lo,
+                         __m512i* hi) {
+  const __m512i v = _mm512_maskz_loadu_epi32(mask, values);
+  *lo = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v));
+  *hi = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1));
+}
+
+inline void MaskedLoad16(const uint32_t* values, __mmask16 mask, __m512i* lo,
+                         __m512i* hi) {
+  const __m512i v = _mm512_maskz_loadu_epi32(mask, values);
+  *lo = _mm512_cvtepu32_epi64(_mm512_castsi512_si256(v));
+  *hi = _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(v, 1));
+}
+
+inline void MaskedLoad16(const float* values, __mmask16 mask, __m512d* lo,
+                         __m512d* hi) {
+  const __m512 v = _mm512_maskz_loadu_ps(mask, values);
+  *lo = _mm512_cvtps_pd(_mm512_castps512_ps256(v));
+  *hi = _mm512_cvtps_pd(
+      _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1)));
+}
+
+inline __m512i Add(__m512i a, __m512i b) { return _mm512_add_epi64(a, b); }
+inline __m512d Add(__m512d a, __m512d b) { return _mm512_add_pd(a, b); }
+
+template <typename SumCType, typename VectorType>
+SumCType ReduceSumLanes(VectorType acc) {
+  SumCType lanes[8];
+  std::memcpy(lanes, &acc, sizeof(VectorType));
+  SumCType sum = 0;
+  for (int j = 0; j < 8; ++j) {
+    sum += lanes[j];
+  }
+  return sum;
+}
+
+template <typename SumCType, typename VectorType, typename CType>
+SumCType MaskedSum64(const CType* values, int64_t length, uint64_t valid_bits) {
+  VectorType acc0{}, acc1{};
+  for (int64_t i = 0; i < length; i += 16) {
+    acc0 = Add(acc0, MaskedLoad8(values + i, static_cast<__mmask8>(valid_bits >> i)));
+    acc1 = Add(acc1, MaskedLoad8(values + i + 8,
+                                 static_cast<__mmask8>(valid_bits >> (i + 8))));
+  }
+  return ReduceSumLanes<SumCType>(Add(acc0, acc1));
+}
+
+template <typename SumCType, typename VectorType, typename CType>
+SumCType MaskedSum32(const CType* values, int64_t length, uint64_t valid_bits) {
+  VectorType acc0{}, acc1{};
+  for (int64_t i = 0; i < length; i += 16) {
+    VectorType lo, hi;
+    MaskedLoad16(values + i, static_cast<__mmask16>(valid_bits >> i), &lo, &hi);
+    acc0 = Add(acc0, lo);
+    acc1 = Add(acc1, hi);
+  }
+  return ReduceSumLanes<SumCType>(Add(acc0, acc1));
+}
+
+template <typename CType, typename VectorType>
+void ReduceMinMaxLanes(VectorType min_acc, VectorType max_acc, CType* min,
+                       CType* max) {
+  using Block = MinMaxBlock<SimdLevel::NONE, CType>;
+  constexpr int kLanes = sizeof(VectorType) / sizeof(CType);
+  CType min_lanes[kLanes];
+  CType max_lanes[kLanes];
+  std::memcpy(min_lanes, &min_acc, sizeof(VectorType));
+  std::memcpy(max_lanes, &max_acc, sizeof(VectorType));
+  for (int j = 0; j < kLanes; ++j) {
+    *min = Block::Min(*min, min_lanes[j]);
+    *max = Block::Max(*max, max_lanes[j]);
+  }
+}
+
+}  // namespace
+
+// Masked sums: null slots are loaded as zeros.  The loop bound may overshoot
+// the block, the masks of lanes past its end are zero.
+
+#define SUM_BLOCK_MASKED(CTYPE, SUM_CTYPE, IMPL)                                       \
+  template <>                                                                          \
+  SUM_CTYPE SumBlock<SimdLevel::AVX512, CTYPE, SUM_CTYPE>::Masked(                     \
+      const CTYPE* values, int64_t length, uint64_t valid_bits) {                      \
+    return IMPL(values, length, valid_bits);                                           \
+  }
+
+SUM_BLOCK_MASKED(int32_t, int64_t, (MaskedSum32<int64_t, __m512i>))
+SUM_BLOCK_MASKED(uint32_t, uint64_t, (MaskedSum32<uint64_t, __m512i>))
+SUM_BLOCK_MASKED(int64_t, int64_t, (MaskedSum64<int64_t, __m512i>))
+SUM_BLOCK_MASKED(uint64_t, uint64_t, (MaskedSum64<uint64_t, __m512i>))
+SUM_BLOCK_MASKED(float, double, (MaskedSum32<double, __m512d>))
+SUM_BLOCK_MASKED(double, double, (MaskedSum64<double, __m512d>))
+
+#undef SUM_BLOCK_MASKED
+
+// Masked min/max: only the valid lanes of the accumulators are updated
+
+template <>
+void MinMaxBlock<SimdLevel::AVX512, int32_t>::ScanMasked(const int32_t* values,
+                                                         int64_t length,
+                                                         uint64_t valid_bits,
+                                                         int32_t* min, int32_t* max) {
+  __m512i min_acc = _mm512_set1_epi32(*min);
+  __m512i max_acc = _mm512_set1_epi32(*max);
+  for (int64_t i = 0; i < length; i += 16) {
+    const auto mask = static_cast<__mmask16>(valid_bits >> i);
+    const __m512i v = _mm512_maskz_loadu_epi32(mask, values + i);
+    min_acc = _mm512_mask_min_epi32(min_acc, mask, min_acc, v);
+    max_acc = _mm512_mask_max_epi32(max_acc, mask, max_acc, v);
+  }
+  ReduceMinMaxLanes(min_acc, max_acc, min, max);
+}
+
+template <>
+void MinMaxBlock<SimdLevel::AVX512, int64_t>::ScanMasked(const int64_t* values,
+                                                         int64_t length,
+                                                         uint64_t valid_bits,
+                                                         int64_t* min, int64_t* max) {
+  __m512i min_acc = _mm512_set1_epi64(*min);
+  __m512i max_acc = _mm512_set1_epi64(*max);
+  for (int64_t i = 0; i < length; i += 8) {
+    const auto mask = static_cast<__mmask8>(valid_bits >> i);
+    const __m512i v = _mm512_maskz_loadu_epi64(mask, values + i);
+    min_acc = _mm512_mask_min_epi64(min_acc, mask, min_acc, v);
+    max_acc = _mm512_mask_max_epi64(max_acc, mask, max_acc, v);
+  }
+  ReduceMinMaxLanes(min_acc, max_acc, min, max);
+}
+
+template <>
+void MinMaxBlock<SimdLevel::AVX512, double>::ScanMasked(const double* values,
+                                                        int64_t length,
+                                                        uint64_t valid_bits, double* min,
+                                                        double* max) {
+  __m512d min_acc = _mm512_set1_pd(*min);
+  __m512d max_acc = _mm512_set1_pd(*max);
+  for (int64_t i = 0; i < length; i += 8) {
+    const auto mask = static_cast<__mmask8>(valid_bits >> i);
+    const __m512d v = _mm512_maskz_loadu_pd(mask, values + i);
+    // When an operand is NaN, vminpd / vmaxpd return the second one: NaN values
+    // are ignored.
+    min_acc = _mm512_mask_min_pd(min_acc, mask, v, min_acc);
+    max_acc = _mm512_mask_max_pd(max_acc, mask, v, max_acc);
+  }
+  ReduceMinMaxLanes(min_acc, max_acc, min, max);
+}
+
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunctionAvx512(const DataType& type) {
+  return MakeSumLikeAggregateFunction<SumState, SimdLevel::AVX512>(type);
+}
+
+std::shared_ptr<AggregateFunction> MakeMeanAggregateFunctionAvx512(const DataType& type) {
+  return MakeSumLikeAggregateFunction<MeanState, SimdLevel::AVX512>(type);
+}
+
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunctionAvx512(
+    const DataType& type, const MinMaxOptions& options) {
+  return MakeMinMaxAggregateFunctionImpl<SimdLevel::AVX512>(type, options);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -23,7 +23,11 @@
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/minmax_internal.h"
 #include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/kernels/sum_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -43,10 +47,10 @@ namespace BitUtil = arrow::BitUtil;
 using arrow::internal::BitmapReader;
 
 template <typename T>
-struct SumState {
+struct ReferenceSumState {
   using ValueType = T;
 
-  SumState() : total(0), valid_count(0) {}
+  ReferenceSumState() : total(0), valid_count(0) {}
 
   T total = 0;
   int64_t valid_count = 0;
@@ -85,8 +89,8 @@ template <typename T>
 struct SumNoNulls : public Summer<T> {
   using ArrayType = typename CTypeTraits<T>::ArrayType;
 
-  static void Sum(const ArrayType& array, SumState<T>* state) {
-    SumState<T> local;
+  static void Sum(const ArrayType& array, ReferenceSumState<T>* state) {
+    ReferenceSumState<T> local;
 
     const auto values = array.raw_values();
     for (int64_t i = 0; i < array.length(); ++i) {
@@ -102,8 +106,8 @@ template <typename T>
 struct SumNoNullsUnrolled : public Summer<T> {
   using ArrayType = typename CTypeTraits<T>::ArrayType;
 
-  static void Sum(const ArrayType& array, SumState<T>* state) {
-    SumState<T> local;
+  static void Sum(const ArrayType& array, ReferenceSumState<T>* state) {
+    ReferenceSumState<T> local;
 
     const auto values = array.raw_values();
     const auto length = array.length();
@@ -127,8 +131,8 @@ template <typename T>
 struct SumSentinel : public Summer<T> {
   using ArrayType = typename CTypeTraits<T>::ArrayType;
 
-  static void Sum(const ArrayType& array, SumState<T>* state) {
-    SumState<T> local;
+  static void Sum(const ArrayType& array, ReferenceSumState<T>* state) {
+    ReferenceSumState<T> local;
 
     const auto values = array.raw_values();
     const auto length = array.length();
@@ -146,8 +150,8 @@ template <typename T>
 struct SumSentinelUnrolled : public Summer<T> {
   using ArrayType = typename CTypeTraits<T>::ArrayType;
 
-  static void Sum(const ArrayType& array, SumState<T>* state) {
-    SumState<T> local;
+  static void Sum(const ArrayType& array, ReferenceSumState<T>* state) {
+    ReferenceSumState<T> local;
 
 #define SUM_NOT_NULL(ITEM)                                                  \
   do {                                                                      \
@@ -184,8 +188,8 @@ template <typename T>
 struct SumBitmapNaive : public Summer<T> {
   using ArrayType = typename CTypeTraits<T>::ArrayType;
 
-  static void Sum(const ArrayType& array, SumState<T>* state) {
-    SumState<T> local;
+  static void Sum(const ArrayType& array, ReferenceSumState<T>* state) {
+    ReferenceSumState<T> local;
 
     const auto values = array.raw_values();
     const auto bitmap = array.null_bitmap_data();
@@ -206,8 +210,8 @@ template <typename T>
 struct SumBitmapReader : public Summer<T> {
   using ArrayType = typename CTypeTraits<T>::ArrayType;
 
-  static void Sum(const ArrayType& array, SumState<T>* state) {
-    SumState<T> local;
+  static void Sum(const ArrayType& array, ReferenceSumState<T>* state) {
+    ReferenceSumState<T> local;
 
     const auto values = array.raw_values();
     const auto bitmap = array.null_bitmap_data();
@@ -230,8 +234,8 @@ template <typename T>
 struct SumBitmapVectorizeUnroll : public Summer<T> {
   using ArrayType = typename CTypeTraits<T>::ArrayType;
 
-  static void Sum(const ArrayType& array, SumState<T>* state) {
-    SumState<T> local;
+  static void Sum(const ArrayType& array, ReferenceSumState<T>* state) {
+    ReferenceSumState<T> local;
 
     const auto values = array.raw_values();
     const auto bitmap = array.null_bitmap_data();
@@ -287,7 +291,7 @@ void ReferenceSum(benchmark::State& state) {
   Traits<T>::FixSentinel(array);
 
   for (auto _ : state) {
-    SumState<T> sum_state;
+    ReferenceSumState<T> sum_state;
     Functor::Sum(*array, &sum_state);
     benchmark::DoNotOptimize(sum_state);
   }
@@ -307,26 +311,66 @@ BENCHMARK_TEMPLATE(ReferenceSum, SumBitmapVectorizeUnroll<int64_t>)
     ->Apply(BenchmarkSetArgs);
 #endif  // ARROW_WITH_BENCHMARKS_REFERENCE
 
-static void SumKernel(benchmark::State& state) {
-  const int64_t array_size = state.range(0) / sizeof(int64_t);
+// Kernels specialized for each SIMD level, over null densities from 0% to 99%
+static void AggregateKernelArgs(benchmark::internal::Benchmark* bench) {
+  bench->Unit(benchmark::kMicrosecond);
+  bench->ArgNames({"size", "null_percent", "simd_level"});
+
+  for (int level = SimdLevel::NONE; level <= SimdLevel::AVX512; ++level) {
+    for (auto nulls : std::vector<ArgsType>({0, 1, 10, 50, 90, 99})) {
+      bench->Args({static_cast<ArgsType>(kL1Size), nulls, static_cast<ArgsType>(level)});
+    }
+  }
+}
+
+template <typename ArrowType>
+static void AggregateKernel(benchmark::State& state,  // NOLINT non-const reference
+                            std::shared_ptr<AggregateFunction> function) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  if (state.range(2) > GetSimdLevel()) {
+    state.SkipWithError("SIMD level not supported by the CPU");
+    return;
+  }
+  const int64_t array_size = state.range(0) / sizeof(CType);
   const double null_percent = static_cast<double>(state.range(1)) / 100.0;
   auto rand = random::RandomArrayGenerator(1923);
-  auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
-      rand.Int64(array_size, -100, 100, null_percent));
+  auto array = rand.Numeric<ArrowType>(array_size, -100, 100, null_percent);
 
   FunctionContext ctx;
+  AggregateUnaryKernel kernel(function);
   for (auto _ : state) {
     Datum out;
-    ABORT_NOT_OK(Sum(&ctx, Datum(array), &out));
+    ABORT_NOT_OK(kernel.Call(&ctx, Datum(array), &out));
     benchmark::DoNotOptimize(out);
   }
 
   state.counters["size"] = static_cast<double>(state.range(0));
   state.counters["null_percent"] = static_cast<double>(state.range(1));
-  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(CType));
+}
+
+template <typename ArrowType>
+static void SumKernel(benchmark::State& state) {
+  const auto level = static_cast<SimdLevel::type>(state.range(2));
+  AggregateKernel<ArrowType>(
+      state, MakeSumAggregateFunction(*TypeTraits<ArrowType>::type_singleton(), level));
+}
+
+template <typename ArrowType>
+static void MinMaxKernel(benchmark::State& state) {
+  const auto level = static_cast<SimdLevel::type>(state.range(2));
+  AggregateKernel<ArrowType>(
+      state, MakeMinMaxAggregateFunction(*TypeTraits<ArrowType>::type_singleton(),
+                                         MinMaxOptions(), level));
 }
 
-BENCHMARK(SumKernel)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(SumKernel, Int32Type)->Apply(AggregateKernelArgs);
+BENCHMARK_TEMPLATE(SumKernel, Int64Type)->Apply(AggregateKernelArgs);
+BENCHMARK_TEMPLATE(SumKernel, DoubleType)->Apply(AggregateKernelArgs);
+BENCHMARK_TEMPLATE(MinMaxKernel, Int32Type)->Apply(AggregateKernelArgs);
+BENCHMARK_TEMPLATE(MinMaxKernel, Int64Type)->Apply(AggregateKernelArgs);
+BENCHMARK_TEMPLATE(MinMaxKernel, DoubleType)->Apply(AggregateKernelArgs);
 
 }  // namespace compute
 }  // namespace arrow
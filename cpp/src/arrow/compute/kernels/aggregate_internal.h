@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+/// \brief Instruction sets aggregate kernels can be specialized for
+///
+/// Kernels are class templates parameterized by the SIMD level, so that the
+/// instantiations compiled with different instruction set flags (see
+/// aggregate_avx2.cc and aggregate_avx512.cc) don't collide at link time.
+struct SimdLevel {
+  enum type { NONE, AVX2, AVX512 };
+};
+
+/// \brief Return the most capable SIMD level supported by both the build and
+/// the running CPU
+ARROW_EXPORT
+SimdLevel::type GetSimdLevel();
+
+/// \brief Visit a validity bitmap 64 bits at a time
+///
+/// `visit(position, block_length, word)` is called for consecutive blocks of
+/// (at most) 64 values, position being relative to `offset`.  Bit i of `word`
+/// is the validity of value `position + i`; bits past `block_length` are zero.
+template <typename Visitor>
+void VisitValidityWords(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        Visitor&& visit) {
+  int64_t position = 0;
+  for (; position + 64 <= length; position += 64) {
+    const int64_t bit_offset = offset + position;
+    const uint8_t* bytes = bitmap + bit_offset / 8;
+    const int shift = static_cast<int>(bit_offset % 8);
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    if (shift != 0) {
+      // The block spans 9 bytes
+      word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+    }
+    visit(position, 64, word);
+  }
+  if (position < length) {
+    uint64_t word = 0;
+    for (int64_t i = position; i < length; ++i) {
+      const uint64_t bit = BitUtil::GetBit(bitmap, offset + i) ? 1 : 0;
+      word |= bit << (i - position);
+    }
+    visit(position, length - position, word);
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
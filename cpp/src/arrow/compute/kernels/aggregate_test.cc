@@ -17,16 +17,20 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/count.h"
 #include "arrow/compute/kernels/mean.h"
 #include "arrow/compute/kernels/minmax.h"
+#include "arrow/compute/kernels/minmax_internal.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
 #include "arrow/compute/test_util.h"
@@ -40,6 +44,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace compute {
@@ -199,6 +204,20 @@ TYPED_TEST(TestRandomNumericSumKernel, RandomSliceArraySum) {
   }
 }
 
+TYPED_TEST(TestRandomNumericSumKernel, ParallelChunks) {
+  auto rand = random::RandomArrayGenerator(0x2b7e1516);
+  ArrayVector chunks;
+  for (int64_t length : {0, 1, 100, 1000, 4096, 33, 10000, 7}) {
+    chunks.push_back(rand.Numeric<TypeParam>(length, 0, 100, 0.1));
+  }
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+  Datum expected;
+  ASSERT_OK(Sum(&this->ctx_, chunked, &expected));
+  this->ctx_.set_use_threads(true);
+  ValidateSum<TypeParam>(&this->ctx_, chunked, expected);
+}
+
 ///
 /// Mean
 ///
@@ -397,5 +416,112 @@ TYPED_TEST(TestFloatingMinMaxKernel, Floats) {
   this->AssertMinMaxIs("[5, -Inf, 2, 3, 4]", -INFINITY, 5, options);
 }
 
+///
+/// Specialized kernels for all SIMD levels supported by the CPU
+///
+
+static std::vector<SimdLevel::type> SupportedSimdLevels() {
+  std::vector<SimdLevel::type> levels = {SimdLevel::NONE};
+  if (GetSimdLevel() >= SimdLevel::AVX2) levels.push_back(SimdLevel::AVX2);
+  if (GetSimdLevel() >= SimdLevel::AVX512) levels.push_back(SimdLevel::AVX512);
+  return levels;
+}
+
+// Random slices of various lengths, offsets and null densities
+template <typename ArrowType>
+static std::vector<std::shared_ptr<Array>> SimdTestArrays() {
+  auto rand = random::RandomArrayGenerator(0x3ea1f04);
+  std::vector<std::shared_ptr<Array>> arrays;
+  for (auto null_probability : {0.0, 0.01, 0.5, 0.99, 1.0}) {
+    auto array = rand.Numeric<ArrowType>(1100, 0, 100, null_probability);
+    for (int64_t offset : {0, 3, 69}) {
+      for (int64_t length : {0, 1, 7, 63, 64, 65, 1000}) {
+        arrays.push_back(array->Slice(offset, length));
+      }
+    }
+  }
+  return arrays;
+}
+
+TYPED_TEST(TestRandomNumericSumKernel, SimdLevels) {
+  using SumType = typename FindAccumulatorType<TypeParam>::Type;
+
+  for (auto level : SupportedSimdLevels()) {
+    SCOPED_TRACE(level);
+    const auto& type = *TypeTraits<TypeParam>::type_singleton();
+    auto sum_function = MakeSumAggregateFunction(type, level);
+    auto mean_function = MakeMeanAggregateFunction(type, level);
+    AggregateUnaryKernel sum(sum_function);
+    AggregateUnaryKernel mean(mean_function);
+    for (const auto& array : SimdTestArrays<TypeParam>()) {
+      Datum out;
+      ASSERT_OK(sum.Call(&this->ctx_, array, &out));
+      DatumEqual<SumType>::EnsureEqual(out, NaiveSum<TypeParam>(*array));
+      ASSERT_OK(mean.Call(&this->ctx_, array, &out));
+      DatumEqual<DoubleType>::EnsureEqual(out, NaiveMean<TypeParam>(*array));
+    }
+  }
+}
+
+template <typename ArrowType>
+static std::pair<Datum, Datum> NaiveMinMax(const Array& array) {
+  using c_type = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  const auto& typed = checked_cast<const ArrayType&>(array);
+  MinMaxState<ArrowType> state;
+  for (int64_t i = 0; i < array.length(); i++) {
+    if (array.IsValid(i)) {
+      state.MergeOne(typed.Value(i));
+    }
+  }
+  return {Datum(std::make_shared<ScalarType>(static_cast<c_type>(state.min))),
+          Datum(std::make_shared<ScalarType>(static_cast<c_type>(state.max)))};
+}
+
+TYPED_TEST(TestNumericMinMaxKernel, SimdLevels) {
+  for (auto level : SupportedSimdLevels()) {
+    SCOPED_TRACE(level);
+    const auto& type = *TypeTraits<TypeParam>::type_singleton();
+    auto function = MakeMinMaxAggregateFunction(type, MinMaxOptions(), level);
+    AggregateUnaryKernel min_max(function);
+    for (const auto& array : SimdTestArrays<TypeParam>()) {
+      Datum out;
+      ASSERT_OK(min_max.Call(&this->ctx_, array, &out));
+      auto expected = NaiveMinMax<TypeParam>(*array);
+      AssertDatumsEqual(out.collection()[0], expected.first);
+      AssertDatumsEqual(out.collection()[1], expected.second);
+    }
+  }
+}
+
+TYPED_TEST(TestFloatingMinMaxKernel, SimdLevels) {
+  // NaNs are ignored, whether in valid or null slots
+  std::string json = "[";
+  for (int i = 0; i < 100; i++) {
+    json += (i > 0 ? ", " : "");
+    json += i % 7 == 0 ? "NaN" : (i % 5 == 0 ? "null" : std::to_string(i));
+  }
+  json += "]";
+  auto arrays = SimdTestArrays<TypeParam>();
+  arrays.push_back(ArrayFromJSON(TypeTraits<TypeParam>::type_singleton(), json));
+
+  for (auto level : SupportedSimdLevels()) {
+    SCOPED_TRACE(level);
+    const auto& type = *TypeTraits<TypeParam>::type_singleton();
+    auto function = MakeMinMaxAggregateFunction(type, MinMaxOptions(), level);
+    AggregateUnaryKernel min_max(function);
+    for (const auto& array : arrays) {
+      Datum out;
+      ASSERT_OK(min_max.Call(&this->ctx_, array, &out));
+      auto expected = NaiveMinMax<TypeParam>(*array);
+      AssertDatumsEqual(out.collection()[0], expected.first);
+      AssertDatumsEqual(out.collection()[1], expected.second);
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,363 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/approx_count_distinct.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+constexpr int HyperLogLogSketch::kMinPrecision;
+constexpr int HyperLogLogSketch::kMaxPrecision;
+constexpr int HyperLogLogSketch::kDefaultPrecision;
+
+namespace {
+
+constexpr uint8_t kSerializationVersion = 1;
+
+// The hashes from hashing.h are tuned for hash table lookups: for integers,
+// the high bits only depend on the low bits of the value.  Mix them again
+// (with the MurmurHash3 finalizer) before splitting them into a register
+// index and a rank.
+inline uint64_t Avalanche(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+Status CheckPrecision(int precision) {
+  if (precision < HyperLogLogSketch::kMinPrecision ||
+      precision > HyperLogLogSketch::kMaxPrecision) {
+    return Status::Invalid("HyperLogLog precision must be between ",
+                           HyperLogLogSketch::kMinPrecision, " and ",
+                           HyperLogLogSketch::kMaxPrecision, ", got ", precision);
+  }
+  return Status::OK();
+}
+
+// Call `on_hash(hash_t)` for each non-null value and `on_null()` for each null
+template <typename OnHash, typename OnNull>
+struct HashVisitor {
+  Status VisitNull() {
+    on_null();
+    return Status::OK();
+  }
+
+  template <typename Value>
+  Status VisitValue(const Value& value) {
+    on_hash(internal::ScalarHelper<Value, 0>::ComputeHash(value));
+    return Status::OK();
+  }
+
+  OnHash& on_hash;
+  OnNull& on_null;
+};
+
+// Call `on_index(int64_t)` for each non-null dictionary index
+template <typename OnIndex>
+struct IndexVisitor {
+  Status VisitNull() { return Status::OK(); }
+
+  template <typename Index>
+  Status VisitValue(Index index) {
+    on_index(static_cast<int64_t>(index));
+    return Status::OK();
+  }
+
+  OnIndex& on_index;
+};
+
+template <typename OnIndex>
+Status VisitIndices(const ArrayData& indices, OnIndex&& on_index) {
+  IndexVisitor<OnIndex> visitor{on_index};
+  switch (indices.type->id()) {
+#define INDEX_CASE(IndexType) \
+  case IndexType::type_id:    \
+    return ArrayDataVisitor<IndexType>::Visit(indices, &visitor);
+
+    INDEX_CASE(Int8Type)
+    INDEX_CASE(UInt8Type)
+    INDEX_CASE(Int16Type)
+    INDEX_CASE(UInt16Type)
+    INDEX_CASE(Int32Type)
+    INDEX_CASE(UInt32Type)
+    INDEX_CASE(Int64Type)
+    INDEX_CASE(UInt64Type)
+#undef INDEX_CASE
+    default:
+      return Status::TypeError("Invalid dictionary index type ", *indices.type);
+  }
+}
+
+// Hash each dictionary entry (a non-template function, to stop the
+// instantiation of VisitHashes from recursing)
+Status HashDictionary(const Array& dictionary, std::vector<internal::hash_t>* hashes,
+                      std::vector<bool>* is_valid);
+
+template <typename OnHash>
+Status VisitDictionaryHashes(const DictionaryArray& values, OnHash&& on_hash) {
+  // Hash each dictionary entry once, then look the hashes up by index
+  std::vector<internal::hash_t> hashes;
+  std::vector<bool> is_valid;
+  RETURN_NOT_OK(HashDictionary(*values.dictionary(), &hashes, &is_valid));
+  return VisitIndices(*values.indices()->data(), [&](int64_t index) {
+    if (is_valid[index]) {
+      on_hash(hashes[index]);
+    }
+  });
+}
+
+template <typename OnHash, typename OnNull>
+Status VisitHashes(const Array& values, OnHash&& on_hash, OnNull&& on_null) {
+  HashVisitor<OnHash, OnNull> visitor{on_hash, on_null};
+  const ArrayData& data = *values.data();
+  switch (values.type_id()) {
+    case Type::NA:
+      for (int64_t i = 0; i < values.length(); ++i) {
+        on_null();
+      }
+      return Status::OK();
+    case Type::DICTIONARY:
+      return VisitDictionaryHashes(checked_cast<const DictionaryArray&>(values),
+                                   on_hash);
+#define HASH_CASE(InType) \
+  case InType::type_id:   \
+    return ArrayDataVisitor<InType>::Visit(data, &visitor);
+
+      HASH_CASE(BooleanType)
+      HASH_CASE(UInt8Type)
+      HASH_CASE(Int8Type)
+      HASH_CASE(UInt16Type)
+      HASH_CASE(Int16Type)
+      HASH_CASE(UInt32Type)
+      HASH_CASE(Int32Type)
+      HASH_CASE(UInt64Type)
+      HASH_CASE(Int64Type)
+      HASH_CASE(FloatType)
+      HASH_CASE(DoubleType)
+      HASH_CASE(Date32Type)
+      HASH_CASE(Date64Type)
+      HASH_CASE(Time32Type)
+      HASH_CASE(Time64Type)
+      HASH_CASE(TimestampType)
+      HASH_CASE(BinaryType)
+      HASH_CASE(StringType)
+      HASH_CASE(LargeBinaryType)
+      HASH_CASE(LargeStringType)
+      HASH_CASE(FixedSizeBinaryType)
+      HASH_CASE(Decimal128Type)
+#undef HASH_CASE
+    default:
+      return Status::NotImplemented("ApproxCountDistinct is not implemented for ",
+                                    *values.type());
+  }
+}
+
+Status HashDictionary(const Array& dictionary, std::vector<internal::hash_t>* hashes,
+                      std::vector<bool>* is_valid) {
+  hashes->reserve(dictionary.length());
+  is_valid->reserve(dictionary.length());
+  return VisitHashes(
+      dictionary,
+      [&](internal::hash_t hash) {
+        hashes->push_back(hash);
+        is_valid->push_back(true);
+      },
+      [&]() {
+        hashes->push_back(0);
+        is_valid->push_back(false);
+      });
+}
+
+}  // namespace
+
+HyperLogLogSketch::HyperLogLogSketch(int precision)
+    : precision_(precision), registers_(static_cast<size_t>(1) << precision, 0) {
+  DCHECK_OK(CheckPrecision(precision));
+}
+
+void HyperLogLogSketch::Update(uint64_t hash) {
+  hash = Avalanche(hash);
+  // The high bits select the register, the rank is one plus the number of
+  // leading zeros of the remaining bits
+  const uint64_t index = hash >> (64 - precision_);
+  const uint64_t rest = hash << precision_;
+  const int max_rank = 64 - precision_ + 1;
+  const int rank =
+      rest == 0 ? max_rank : std::min(BitUtil::CountLeadingZeros(rest) + 1, max_rank);
+  registers_[index] = std::max(registers_[index], static_cast<uint8_t>(rank));
+}
+
+Status HyperLogLogSketch::Consume(const Array& values) {
+  return VisitHashes(
+      values, [this](internal::hash_t hash) { Update(hash); }, []() {});
+}
+
+Status HyperLogLogSketch::Merge(const HyperLogLogSketch& other) {
+  if (other.precision_ != precision_) {
+    return Status::Invalid("Cannot merge HyperLogLog sketches of precision ", precision_,
+                           " and ", other.precision_);
+  }
+  for (size_t i = 0; i < registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+  return Status::OK();
+}
+
+int64_t HyperLogLogSketch::Estimate() const {
+  const double m = static_cast<double>(registers_.size());
+  double alpha;
+  switch (precision_) {
+    case 4:
+      alpha = 0.673;
+      break;
+    case 5:
+      alpha = 0.697;
+      break;
+    case 6:
+      alpha = 0.709;
+      break;
+    default:
+      alpha = 0.7213 / (1.0 + 1.079 / m);
+      break;
+  }
+
+  double sum = 0.0;
+  int64_t zeros = 0;
+  for (uint8_t rank : registers_) {
+    sum += std::ldexp(1.0, -rank);
+    zeros += rank == 0;
+  }
+  double estimate = alpha * m * m / sum;
+  // Small range correction: fall back to linear counting while registers
+  // remain empty.  The 64-bit hashes make a large range correction unneeded.
+  if (estimate <= 2.5 * m && zeros > 0) {
+    estimate = m * std::log(m / static_cast<double>(zeros));
+  }
+  return static_cast<int64_t>(std::llround(estimate));
+}
+
+Status HyperLogLogSketch::Serialize(MemoryPool* pool,
+                                    std::shared_ptr<Buffer>* out) const {
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(
+      AllocateBuffer(pool, static_cast<int64_t>(2 + registers_.size()), &buffer));
+  uint8_t* data = buffer->mutable_data();
+  data[0] = kSerializationVersion;
+  data[1] = static_cast<uint8_t>(precision_);
+  std::memcpy(data + 2, registers_.data(), registers_.size());
+  *out = std::move(buffer);
+  return Status::OK();
+}
+
+Status HyperLogLogSketch::Deserialize(const Buffer& buffer, HyperLogLogSketch* out) {
+  if (buffer.size() < 2 || buffer.data()[0] != kSerializationVersion) {
+    return Status::Invalid("Not a serialized HyperLogLog sketch");
+  }
+  const int precision = buffer.data()[1];
+  RETURN_NOT_OK(CheckPrecision(precision));
+  const int64_t num_registers = static_cast<int64_t>(1) << precision;
+  if (buffer.size() != 2 + num_registers) {
+    return Status::Invalid("Serialized HyperLogLog sketch of precision ", precision,
+                           " should have ", 2 + num_registers, " bytes, got ",
+                           buffer.size());
+  }
+  const uint8_t* registers = buffer.data() + 2;
+  const int max_rank = 64 - precision + 1;
+  if (std::any_of(registers, registers + num_registers,
+                  [&](uint8_t rank) { return rank > max_rank; })) {
+    return Status::Invalid("Serialized HyperLogLog sketch has out of range registers");
+  }
+  out->precision_ = precision;
+  out->registers_.assign(registers, registers + num_registers);
+  return Status::OK();
+}
+
+// The state is a HyperLogLogSketch constructed in place with the configured
+// precision, hence AggregateFunctionStaticState (which requires a default
+// constructible state) isn't used.
+class ApproxCountDistinctAggregateFunction final : public AggregateFunction {
+ public:
+  explicit ApproxCountDistinctAggregateFunction(int precision) : precision_(precision) {}
+
+  Status Consume(const Array& input, void* state) const override {
+    return static_cast<HyperLogLogSketch*>(state)->Consume(input);
+  }
+
+  Status Merge(const void* src, void* dst) const override {
+    return static_cast<HyperLogLogSketch*>(dst)->Merge(
+        *static_cast<const HyperLogLogSketch*>(src));
+  }
+
+  Status Finalize(const void* src, Datum* output) const override {
+    const auto& sketch = *static_cast<const HyperLogLogSketch*>(src);
+    *output = Datum(std::make_shared<Int64Scalar>(sketch.Estimate()));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+  int64_t Size() const override { return sizeof(HyperLogLogSketch); }
+
+  void New(void* ptr) const override { new (ptr) HyperLogLogSketch(precision_); }
+
+  void Delete(void* ptr) const override {
+    static_cast<HyperLogLogSketch*>(ptr)->~HyperLogLogSketch();
+  }
+
+ private:
+  int precision_;
+};
+
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinct(
+    FunctionContext* context, const ApproxCountDistinctOptions& options) {
+  return std::make_shared<ApproxCountDistinctAggregateFunction>(options.precision);
+}
+
+Status ApproxCountDistinct(FunctionContext* context,
+                           const ApproxCountDistinctOptions& options, const Datum& value,
+                           Datum* out) {
+  RETURN_NOT_OK(CheckPrecision(options.precision));
+  auto aggregate = MakeApproxCountDistinct(context, options);
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+
+  return kernel->Call(context, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
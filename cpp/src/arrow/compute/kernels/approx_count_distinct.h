@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class Buffer;
+class MemoryPool;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \class HyperLogLogSketch
+/// \brief A mergeable, serializable estimate of the number of distinct values
+///
+/// The sketch keeps 2^precision one-byte registers, regardless of the number
+/// of values consumed, and estimates the number of distinct non-null values
+/// with a standard error of about 1.04 / sqrt(2^precision) (1.6% for the
+/// default precision of 12).  Values are hashed with the hash functions used
+/// by the hash kernels, so that equal values of any supported type always
+/// land in the same register.
+///
+/// Sketches built with the same precision on different partitions of a
+/// dataset can be merged into the sketch of their union.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT HyperLogLogSketch {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+  static constexpr int kDefaultPrecision = 12;
+
+  /// \brief Create an empty sketch
+  ///
+  /// \param[in] precision the base-2 logarithm of the number of registers,
+  /// between kMinPrecision and kMaxPrecision
+  explicit HyperLogLogSketch(int precision = kDefaultPrecision);
+
+  int precision() const { return precision_; }
+
+  /// \brief Add the non-null values of an array to the sketch
+  ///
+  /// Primitive, temporal, binary-like, decimal and dictionary arrays are
+  /// supported.  A dictionary array counts the distinct values it refers to.
+  Status Consume(const Array& values);
+
+  /// \brief Add a value given its hash (as computed by arrow/util/hashing.h)
+  void Update(uint64_t hash);
+
+  /// \brief Merge another sketch into this one
+  ///
+  /// Both sketches must have the same precision.
+  Status Merge(const HyperLogLogSketch& other);
+
+  /// \brief Return the estimated number of distinct values consumed
+  int64_t Estimate() const;
+
+  /// \brief Serialize the sketch into a buffer of 2 + 2^precision bytes
+  Status Serialize(MemoryPool* pool, std::shared_ptr<Buffer>* out) const;
+
+  /// \brief Deserialize a sketch written by Serialize
+  static Status Deserialize(const Buffer& buffer, HyperLogLogSketch* out);
+
+ private:
+  int precision_;
+  std::vector<uint8_t> registers_;
+};
+
+/// \class ApproxCountDistinctOptions
+///
+/// Control the precision, and therefore the memory use and accuracy, of the
+/// ApproxCountDistinct kernel.
+struct ARROW_EXPORT ApproxCountDistinctOptions {
+  explicit ApproxCountDistinctOptions(
+      int precision = HyperLogLogSketch::kDefaultPrecision)
+      : precision(precision) {}
+
+  /// The base-2 logarithm of the number of sketch registers
+  int precision;
+};
+
+/// \brief Return ApproxCountDistinct function aggregate
+///
+/// The aggregate state is a HyperLogLogSketch.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinct(
+    FunctionContext* context, const ApproxCountDistinctOptions& options);
+
+/// \brief Estimate the number of distinct non-null values in an array-like
+/// object
+///
+/// Unlike counting the output of Unique(), memory use does not depend on the
+/// number of distinct values.  Chunks are consumed into separate sketches and
+/// merged, so they can be processed in parallel (see
+/// FunctionContext::use_threads()).
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options see ApproxCountDistinctOptions
+/// \param[in] value array-like input
+/// \param[out] out resulting datum, an Int64Scalar
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxCountDistinct(FunctionContext* context,
+                           const ApproxCountDistinctOptions& options, const Datum& value,
+                           Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/kernels/approx_count_distinct.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestApproxCountDistinct : public ComputeFixture, public TestBase {
+ protected:
+  int64_t Estimate(const Datum& value,
+                   ApproxCountDistinctOptions options = ApproxCountDistinctOptions()) {
+    Datum out;
+    ARROW_EXPECT_OK(ApproxCountDistinct(&this->ctx_, options, value, &out));
+    return checked_cast<const Int64Scalar&>(*out.scalar()).value;
+  }
+
+  // Within four standard errors of the exact count
+  void AssertClose(int64_t expected, int64_t actual, int precision) {
+    const double error = 4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    ASSERT_LE(std::abs(static_cast<double>(actual - expected)), error * expected)
+        << "expected about " << expected << ", got " << actual;
+  }
+
+  std::shared_ptr<Array> Integers(int64_t start, int64_t length) {
+    std::vector<int64_t> values(length);
+    for (int64_t i = 0; i < length; ++i) {
+      values[i] = start + i;
+    }
+    std::shared_ptr<Array> array;
+    ArrayFromVector<Int64Type, int64_t>(values, &array);
+    return array;
+  }
+};
+
+TEST_F(TestApproxCountDistinct, Small) {
+  ASSERT_EQ(0, Estimate(ArrayFromJSON(int32(), "[]")));
+  ASSERT_EQ(0, Estimate(ArrayFromJSON(int32(), "[null, null]")));
+  ASSERT_EQ(0, Estimate(ArrayFromJSON(null(), "[null, null]")));
+  ASSERT_EQ(3, Estimate(ArrayFromJSON(int32(), "[1, 2, null, 2, 3, 1]")));
+  ASSERT_EQ(2, Estimate(ArrayFromJSON(boolean(), "[true, false, true, null]")));
+  ASSERT_EQ(3, Estimate(ArrayFromJSON(utf8(), R"(["a", "bb", "", "a", null])")));
+  ASSERT_EQ(2, Estimate(ArrayFromJSON(float64(), "[1.5, 2.5, 1.5]")));
+  ASSERT_EQ(2, Estimate(ArrayFromJSON(fixed_size_binary(2), R"(["ab", "cd", "ab"])")));
+}
+
+TEST_F(TestApproxCountDistinct, Large) {
+  for (int precision : {HyperLogLogSketch::kMinPrecision + 6,
+                        HyperLogLogSketch::kDefaultPrecision,
+                        HyperLogLogSketch::kMaxPrecision}) {
+    for (int64_t count : {100, 5000, 200000}) {
+      // Every value appears twice
+      auto values = std::make_shared<ChunkedArray>(
+          ArrayVector{Integers(0, count), Integers(count / 2, count / 2),
+                      Integers(0, count / 2)});
+      AssertClose(count, Estimate(values, ApproxCountDistinctOptions(precision)),
+                  precision);
+    }
+  }
+
+  StringBuilder builder;
+  for (int i = 0; i < 50000; ++i) {
+    ASSERT_OK(builder.Append("value-" + std::to_string(i % 20000)));
+  }
+  std::shared_ptr<Array> strings;
+  ASSERT_OK(builder.Finish(&strings));
+  AssertClose(20000, Estimate(strings), HyperLogLogSketch::kDefaultPrecision);
+}
+
+TEST_F(TestApproxCountDistinct, Dictionary) {
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b", null, "c", "d"])");
+  auto indices = ArrayFromJSON(int8(), "[0, 2, 1, null, 0, 3, 1]");
+  std::shared_ptr<Array> values;
+  ASSERT_OK(DictionaryArray::FromArrays(dictionary(int8(), utf8()), indices, dict,
+                                        &values));
+  // "d" isn't referenced, the null dictionary entry isn't counted
+  ASSERT_EQ(3, Estimate(values));
+}
+
+TEST_F(TestApproxCountDistinct, MergeAndSerialize) {
+  // Sketches of overlapping partitions merge into the sketch of their union
+  HyperLogLogSketch left, right, all;
+  ASSERT_OK(left.Consume(*Integers(0, 60000)));
+  ASSERT_OK(right.Consume(*Integers(40000, 60000)));
+  ASSERT_OK(all.Consume(*Integers(0, 100000)));
+  ASSERT_OK(left.Merge(right));
+  ASSERT_EQ(all.Estimate(), left.Estimate());
+  AssertClose(100000, left.Estimate(), left.precision());
+
+  std::shared_ptr<Buffer> serialized;
+  ASSERT_OK(left.Serialize(default_memory_pool(), &serialized));
+  ASSERT_EQ(2 + (1 << HyperLogLogSketch::kDefaultPrecision), serialized->size());
+  HyperLogLogSketch deserialized(HyperLogLogSketch::kMinPrecision);
+  ASSERT_OK(HyperLogLogSketch::Deserialize(*serialized, &deserialized));
+  ASSERT_EQ(left.precision(), deserialized.precision());
+  ASSERT_EQ(left.Estimate(), deserialized.Estimate());
+
+  ASSERT_RAISES(Invalid, HyperLogLogSketch::Deserialize(*SliceBuffer(serialized, 0, 100),
+                                                        &deserialized));
+  ASSERT_RAISES(Invalid,
+                HyperLogLogSketch::Deserialize(Buffer("garbage"), &deserialized));
+
+  HyperLogLogSketch other_precision(HyperLogLogSketch::kMinPrecision);
+  ASSERT_RAISES(Invalid, left.Merge(other_precision));
+}
+
+TEST_F(TestApproxCountDistinct, Errors) {
+  Datum out;
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(&this->ctx_, ApproxCountDistinctOptions(3),
+                                             values, &out));
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(&this->ctx_, ApproxCountDistinctOptions(19),
+                                             values, &out));
+
+  std::vector<int32_t> offsets = {0, 2};
+  auto list_values =
+      std::make_shared<ListArray>(list(int32()), 1, Buffer::Wrap(offsets), values);
+  ASSERT_RAISES(NotImplemented,
+                ApproxCountDistinct(&this->ctx_, ApproxCountDistinctOptions(),
+                                    list_values, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,265 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/batch_hash.h"
+
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+template <bool kCombine>
+inline void StoreHash(uint64_t hash, uint64_t* out) {
+  *out = kCombine ? CombineHashes(*out, hash) : hash;
+}
+
+// Store hash_at(i) for each slot i of `data`, or kNullHash for null slots.
+// The values behind nulls are undefined, so null slots are masked before the
+// hashes are combined.  Masks are blended rather than branched on, as nulls
+// are unpredictable, and the validity bitmap is read a byte at a time.
+template <bool kCombine, typename HashAt>
+void HashSlots(const ArrayData& data, HashAt&& hash_at, uint64_t* hashes) {
+  const int64_t length = data.length;
+  if (data.GetNullCount() == 0) {
+    for (int64_t i = 0; i < length; ++i) {
+      StoreHash<kCombine>(hash_at(i), hashes + i);
+    }
+    return;
+  }
+
+  const uint8_t* bitmap = data.buffers[0]->data();
+  const int shift = static_cast<int>(data.offset % 8);
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const int64_t byte_index = (data.offset + i) / 8;
+    uint32_t bits = bitmap[byte_index] >> shift;
+    if (shift != 0) {
+      bits |= static_cast<uint32_t>(bitmap[byte_index + 1]) << (8 - shift);
+    }
+    for (int j = 0; j < 8; ++j) {
+      const uint64_t valid = 0 - static_cast<uint64_t>((bits >> j) & 1);
+      StoreHash<kCombine>((hash_at(i + j) & valid) | (kNullHash & ~valid),
+                          hashes + i + j);
+    }
+  }
+  for (; i < length; ++i) {
+    StoreHash<kCombine>(
+        BitUtil::GetBit(bitmap, data.offset + i) ? hash_at(i) : kNullHash, hashes + i);
+  }
+}
+
+// The values are read as unsigned integers of their width, so that floating
+// point values are hashed as their bit pattern; the hash is a multiplication
+// and a byte swap, which vectorizes
+template <bool kCombine, typename UInt>
+void HashFixedWidth(const ArrayData& data, uint64_t* hashes) {
+  const UInt* values = data.GetValues<UInt>(1);
+  HashSlots<kCombine>(
+      data,
+      [values](int64_t i) {
+        return internal::ScalarHelper<uint64_t, 0>::ComputeHash(values[i]);
+      },
+      hashes);
+}
+
+template <bool kCombine>
+void HashBooleans(const ArrayData& data, uint64_t* hashes) {
+  const uint8_t* bitmap = data.buffers[1]->data();
+  const int64_t offset = data.offset;
+  const uint64_t hash_false = internal::ScalarHelper<uint64_t, 0>::ComputeHash(0);
+  const uint64_t hash_true = internal::ScalarHelper<uint64_t, 0>::ComputeHash(1);
+  HashSlots<kCombine>(
+      data,
+      [&](int64_t i) {
+        return BitUtil::GetBit(bitmap, offset + i) ? hash_true : hash_false;
+      },
+      hashes);
+}
+
+template <bool kCombine, typename Offset>
+void HashBinary(const ArrayData& data, uint64_t* hashes) {
+  const Offset* offsets = data.GetValues<Offset>(1);
+  const uint8_t* chars = data.buffers[2] ? data.buffers[2]->data() : nullptr;
+  HashSlots<kCombine>(
+      data,
+      [&](int64_t i) {
+        return internal::ComputeStringHash<0>(chars + offsets[i],
+                                              offsets[i + 1] - offsets[i]);
+      },
+      hashes);
+}
+
+template <bool kCombine>
+void HashFixedSizeBinary(const ArrayData& data, uint64_t* hashes) {
+  const int32_t byte_width =
+      checked_cast<const FixedSizeBinaryType&>(*data.type).byte_width();
+  const uint8_t* values = data.GetValues<uint8_t>(1, data.offset * byte_width);
+  HashSlots<kCombine>(
+      data,
+      [&](int64_t i) {
+        return internal::ComputeStringHash<0>(values + i * byte_width, byte_width);
+      },
+      hashes);
+}
+
+template <bool kCombine, typename Index>
+void GatherHashes(const ArrayData& indices,
+                  const std::vector<uint64_t>& dictionary_hashes, uint64_t* hashes) {
+  // The indices of null slots are undefined: clamp them to the last entry
+  // rather than reading out of bounds
+  const Index* values = indices.GetValues<Index>(1);
+  const uint64_t last = dictionary_hashes.size() - 1;
+  HashSlots<kCombine>(
+      indices,
+      [&](int64_t i) {
+        const uint64_t index = static_cast<uint64_t>(values[i]);
+        return dictionary_hashes[index < last ? index : last];
+      },
+      hashes);
+}
+
+template <bool kCombine>
+Status HashDictionary(const DictionaryArray& values, uint64_t* hashes) {
+  // Hash each dictionary entry once, then gather the hashes by index
+  const Array& dictionary = *values.dictionary();
+  std::vector<uint64_t> dictionary_hashes(dictionary.length() + 1, kNullHash);
+  RETURN_NOT_OK(HashInto(dictionary, /*combine=*/false, dictionary_hashes.data()));
+
+  const ArrayData& indices = *values.indices()->data();
+  switch (indices.type->id()) {
+#define GATHER_CASE(IndexType)                                                           \
+  case IndexType::type_id:                                                               \
+    GatherHashes<kCombine, IndexType::c_type>(indices, dictionary_hashes, hashes);       \
+    return Status::OK();
+
+    GATHER_CASE(Int8Type)
+    GATHER_CASE(UInt8Type)
+    GATHER_CASE(Int16Type)
+    GATHER_CASE(UInt16Type)
+    GATHER_CASE(Int32Type)
+    GATHER_CASE(UInt32Type)
+    GATHER_CASE(Int64Type)
+    GATHER_CASE(UInt64Type)
+#undef GATHER_CASE
+    default:
+      return Status::TypeError("Invalid dictionary index type ", *indices.type);
+  }
+}
+
+template <bool kCombine>
+Status HashValues(const Array& values, uint64_t* hashes) {
+  const ArrayData& data = *values.data();
+  switch (values.type_id()) {
+    case Type::NA:
+      for (int64_t i = 0; i < data.length; ++i) {
+        StoreHash<kCombine>(kNullHash, hashes + i);
+      }
+      return Status::OK();
+    case Type::BOOL:
+      HashBooleans<kCombine>(data, hashes);
+      return Status::OK();
+    case Type::BINARY:
+    case Type::STRING:
+      HashBinary<kCombine, int32_t>(data, hashes);
+      return Status::OK();
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      HashBinary<kCombine, int64_t>(data, hashes);
+      return Status::OK();
+    case Type::FIXED_SIZE_BINARY:
+    case Type::DECIMAL:
+      HashFixedSizeBinary<kCombine>(data, hashes);
+      return Status::OK();
+    case Type::DICTIONARY:
+      return HashDictionary<kCombine>(checked_cast<const DictionaryArray&>(values),
+                                      hashes);
+    default:
+      break;
+  }
+
+  if (is_primitive(values.type_id())) {
+    switch (checked_cast<const FixedWidthType&>(*values.type()).bit_width()) {
+      case 8:
+        HashFixedWidth<kCombine, uint8_t>(data, hashes);
+        return Status::OK();
+      case 16:
+        HashFixedWidth<kCombine, uint16_t>(data, hashes);
+        return Status::OK();
+      case 32:
+        HashFixedWidth<kCombine, uint32_t>(data, hashes);
+        return Status::OK();
+      case 64:
+        HashFixedWidth<kCombine, uint64_t>(data, hashes);
+        return Status::OK();
+      default:
+        break;
+    }
+  }
+  return Status::NotImplemented("Hashing is not implemented for ", *values.type());
+}
+
+}  // namespace
+
+Status HashInto(const Array& values, bool combine, uint64_t* hashes) {
+  return combine ? HashValues<true>(values, hashes) : HashValues<false>(values, hashes);
+}
+
+Status HashArray(FunctionContext* ctx, const Array& values, std::shared_ptr<Array>* out) {
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(ctx->Allocate(values.length() * sizeof(uint64_t), &buffer));
+  RETURN_NOT_OK(HashInto(values, /*combine=*/false,
+                         reinterpret_cast<uint64_t*>(buffer->mutable_data())));
+  *out = std::make_shared<UInt64Array>(values.length(), buffer);
+  return Status::OK();
+}
+
+Status HashRows(FunctionContext* ctx, const std::vector<std::shared_ptr<Array>>& columns,
+                std::shared_ptr<Array>* out) {
+  if (columns.empty()) {
+    return Status::Invalid("HashRows needs at least one column");
+  }
+  const int64_t length = columns[0]->length();
+  for (const auto& column : columns) {
+    if (column->length() != length) {
+      return Status::Invalid("HashRows columns must have equal lengths");
+    }
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(ctx->Allocate(length * sizeof(uint64_t), &buffer));
+  auto hashes = reinterpret_cast<uint64_t*>(buffer->mutable_data());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    RETURN_NOT_OK(HashInto(*columns[i], /*combine=*/i > 0, hashes));
+  }
+  *out = std::make_shared<UInt64Array>(length, buffer);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief The hash of a null value
+constexpr uint64_t kNullHash = 0x9e3779b97f4a7c15ULL;
+
+/// \brief Combine the hash of a column value into the hash of a row
+inline uint64_t CombineHashes(uint64_t row_hash, uint64_t value_hash) {
+  return row_hash ^ (value_hash + 0x9e3779b97f4a7c15ULL + (row_hash << 6) +
+                     (row_hash >> 2));
+}
+
+/// \brief Hash each value of an array into `hashes`
+///
+/// This is the batch counterpart of the per-value hashes of
+/// arrow/util/hashing.h: fixed-width values are hashed as their bit pattern
+/// with the integer multiply-and-byteswap hash (in a loop the compiler
+/// vectorizes), binary-like values with the string hash.  Dictionary arrays
+/// hash like their decoded values and nulls hash to kNullHash.  Hashes depend
+/// only on the value bits, not the type: an int64 column and a timestamp
+/// column holding the same numbers hash identically.
+///
+/// \param[in] values the array to hash
+/// \param[in] combine if true, combine the hashes into the `values.length()`
+/// hashes already in `hashes` with CombineHashes, else overwrite them
+/// \param[in,out] hashes the hashes, one per value
+ARROW_EXPORT
+Status HashInto(const Array& values, bool combine, uint64_t* hashes);
+
+/// \brief Compute a uint64 array with the hash of each value of an array
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values the array to hash, see HashInto for supported types
+/// \param[out] out a UInt64Array without nulls
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashArray(FunctionContext* context, const Array& values,
+                 std::shared_ptr<Array>* out);
+
+/// \brief Compute a uint64 array with the hash of each row of several columns
+///
+/// Equal rows have equal hashes, so the result can key group-by, join and
+/// partitioning passes.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] columns the columns to hash, of equal lengths
+/// \param[out] out a UInt64Array without nulls
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashRows(FunctionContext* context,
+                const std::vector<std::shared_ptr<Array>>& columns,
+                std::shared_ptr<Array>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/kernels/batch_hash.h"
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+static void BatchHashBenchmark(benchmark::State& state,
+                               const std::vector<std::shared_ptr<Array>>& columns) {
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(HashRows(&ctx, columns, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void BatchHashInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -100, 100, args.null_proportion);
+
+  BatchHashBenchmark(state, {values});
+}
+
+// The per-value loop of the hash table kernels, as a baseline
+static void ScalarHashInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -100, 100, args.null_proportion);
+  const auto& array = checked_cast<const Int64Array&>(*values);
+
+  std::vector<uint64_t> hashes(array_size);
+  for (auto _ : state) {
+    for (int64_t i = 0; i < array_size; ++i) {
+      hashes[i] = array.IsNull(i) ? kNullHash
+                                  : internal::ScalarHelper<int64_t, 0>::ComputeHash(
+                                        array.Value(i));
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+}
+
+static void BatchHashString(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int32_t string_mean_length = 32;
+  const int64_t array_size = args.size / string_mean_length;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.String(array_size, 0, string_mean_length * 2, args.null_proportion);
+
+  BatchHashBenchmark(state, {values});
+}
+
+static void BatchHashRows(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  // Two int64 columns and a double column, each a third of the input size
+  const int64_t array_size = args.size / sizeof(int64_t) / 3;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto a = rand.Int64(array_size, -100, 100, args.null_proportion);
+  auto b = rand.Int64(array_size, 0, 1 << 20, args.null_proportion);
+  auto c = rand.Float64(array_size, -1, 1, args.null_proportion);
+
+  BatchHashBenchmark(state, {a, b, c});
+}
+
+BENCHMARK(BatchHashInt64)->Apply(RegressionSetArgs);
+BENCHMARK(ScalarHashInt64)->Apply(RegressionSetArgs);
+BENCHMARK(BatchHashString)->Apply(RegressionSetArgs);
+BENCHMARK(BatchHashRows)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/batch_hash.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestBatchHash : public ComputeFixture, public TestBase {
+ protected:
+  std::vector<uint64_t> Hashes(const std::shared_ptr<Array>& values) {
+    std::shared_ptr<Array> out;
+    ARROW_EXPECT_OK(HashArray(&this->ctx_, *values, &out));
+    return ToVector(out);
+  }
+
+  std::vector<uint64_t> RowHashes(const std::vector<std::shared_ptr<Array>>& columns) {
+    std::shared_ptr<Array> out;
+    ARROW_EXPECT_OK(HashRows(&this->ctx_, columns, &out));
+    return ToVector(out);
+  }
+
+  std::vector<uint64_t> ToVector(const std::shared_ptr<Array>& out) {
+    EXPECT_EQ(0, out->null_count());
+    const auto& hashes = checked_cast<const UInt64Array&>(*out);
+    return std::vector<uint64_t>(hashes.raw_values(),
+                                 hashes.raw_values() + hashes.length());
+  }
+
+  // Check that equal values have equal hashes and distinct values distinct
+  // hashes, given a JSON array with values equal to their index modulo 3
+  void CheckModulo3(const std::shared_ptr<DataType>& type, const std::string& json) {
+    auto values = ArrayFromJSON(type, json);
+    const auto hashes = Hashes(values);
+    ASSERT_EQ(values->length(), static_cast<int64_t>(hashes.size()));
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      for (size_t j = 0; j < hashes.size(); ++j) {
+        ASSERT_EQ(i % 3 == j % 3, hashes[i] == hashes[j])
+            << *type << " values " << i << " and " << j;
+      }
+    }
+    // Slices hash like the values they contain
+    const auto sliced = Hashes(values->Slice(1));
+    ASSERT_EQ(std::vector<uint64_t>(hashes.begin() + 1, hashes.end()), sliced);
+  }
+};
+
+TEST_F(TestBatchHash, Types) {
+  CheckModulo3(int8(), "[1, -2, 3, 1, -2, 3]");
+  CheckModulo3(uint16(), "[1, 2, 3, 1, 2, 3]");
+  CheckModulo3(int32(), "[1, 2, 3, 1, 2, 3]");
+  CheckModulo3(int64(), "[-1, 0, 1, -1, 0, 1]");
+  CheckModulo3(float32(), "[0.5, 1.5, 2.5, 0.5, 1.5, 2.5]");
+  CheckModulo3(float64(), "[0.5, 1.5, 2.5, 0.5, 1.5, 2.5]");
+  CheckModulo3(boolean(), "[true, false, null, true, false, null]");
+  CheckModulo3(utf8(), R"(["", "a", "bc", "", "a", "bc"])");
+  CheckModulo3(binary(), R"(["x", null, "xy", "x", null, "xy"])");
+  CheckModulo3(large_utf8(), R"(["a", "b", "c", "a", "b", "c"])");
+  CheckModulo3(fixed_size_binary(3), R"(["abc", "def", null, "abc", "def", null])");
+}
+
+TEST_F(TestBatchHash, Nulls) {
+  auto values = ArrayFromJSON(int32(), "[null, 1, null]");
+  const auto hashes = Hashes(values);
+  ASSERT_EQ(kNullHash, hashes[0]);
+  ASSERT_EQ(kNullHash, hashes[2]);
+  ASSERT_NE(kNullHash, hashes[1]);
+
+  auto nulls = std::make_shared<NullArray>(3);
+  ASSERT_EQ(std::vector<uint64_t>(3, kNullHash), Hashes(nulls));
+}
+
+TEST_F(TestBatchHash, Dictionary) {
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b", null])");
+  auto indices = ArrayFromJSON(int8(), "[2, 1, null, 0, 1]");
+  auto type = dictionary(int8(), utf8());
+  auto values = std::make_shared<DictionaryArray>(type, indices, dict);
+
+  auto decoded = ArrayFromJSON(utf8(), R"([null, "b", null, "a", "b"])");
+  ASSERT_EQ(Hashes(decoded), Hashes(values));
+}
+
+TEST_F(TestBatchHash, Rows) {
+  auto a = ArrayFromJSON(int64(), "[1, 1, 2, 1, null, null]");
+  auto b = ArrayFromJSON(utf8(), R"(["x", "y", "x", "x", "x", "x"])");
+  const auto hashes = RowHashes({a, b});
+  ASSERT_EQ(hashes[0], hashes[3]);
+  ASSERT_EQ(hashes[4], hashes[5]);
+  ASSERT_EQ(4u, std::unordered_set<uint64_t>(hashes.begin(), hashes.end()).size());
+
+  // The column order matters
+  ASSERT_NE(hashes, RowHashes({b, a}));
+  // A single column hashes like HashArray
+  ASSERT_EQ(Hashes(a), RowHashes({a}));
+
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, HashRows(&this->ctx_, {}, &out));
+  ASSERT_RAISES(Invalid, HashRows(&this->ctx_, {a, b->Slice(1)}, &out));
+}
+
+TEST_F(TestBatchHash, RowsIgnoreValuesBehindNulls) {
+  // Two arrays with the same validity but different values in null slots
+  auto rand = random::RandomArrayGenerator(0x5eed);
+  auto left = rand.Int32(1000, 0, 10, 0.3);
+  const auto& data = *left->data();
+  auto right = std::make_shared<Int32Array>(
+      data.length, rand.Int32(1000, 100, 200, 0)->data()->buffers[1],
+      data.buffers[0], data.null_count);
+  auto other = rand.Int64(1000, 0, 3, 0.1);
+
+  const auto left_hashes = RowHashes({other, left});
+  const auto right_hashes = RowHashes({other, right});
+  for (int64_t i = 0; i < 1000; ++i) {
+    if (left->IsNull(i)) {
+      ASSERT_EQ(left_hashes[i], right_hashes[i]);
+    }
+  }
+}
+
+TEST_F(TestBatchHash, Errors) {
+  std::shared_ptr<Array> out;
+  auto values = ArrayFromJSON(list(int32()), "[[1], []]");
+  ASSERT_RAISES(NotImplemented, HashArray(&this->ctx_, *values, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -45,6 +45,8 @@ namespace compute {
 class BooleanUnaryKernel : public UnaryKernel {
  public:
   std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  bool parallelizable() const override { return true; }
 };
 
 class InvertKernel : public BooleanUnaryKernel {
@@ -85,6 +87,8 @@ class BinaryBooleanKernel : public BinaryKernel {
  public:
   explicit BinaryBooleanKernel(ResolveNull resolve_null) : resolve_null_(resolve_null) {}
 
+  bool parallelizable() const override { return true; }
+
  protected:
   virtual Status Compute(FunctionContext* ctx, const ArrayData& left,
                          const ArrayData& right, ArrayData* out) = 0;
@@ -110,7 +114,7 @@ class BinaryBooleanKernel : public BinaryKernel {
   template <typename ComputeWord>
   Status ComputeKleene(ComputeWord&& compute_word, FunctionContext* ctx,
                        const ArrayData& left, const ArrayData& right, ArrayData* out) {
-    DCHECK(left.null_count != 0 || right.null_count != 0);
+    DCHECK(left.GetNullCount() != 0 || right.GetNullCount() != 0);
 
     Bitmap bitmaps[4];
     bitmaps[LEFT_VALID] = {left.buffers[0], left.offset, left.length};
@@ -138,8 +142,8 @@ class BinaryBooleanKernel : public BinaryKernel {
       ++i;
     };
 
-    if (right.null_count == 0 || left.null_count == 0) {
-      if (left.null_count == 0) {
+    if (right.GetNullCount() == 0 || left.GetNullCount() == 0) {
+      if (left.GetNullCount() == 0) {
         // ensure only bitmaps[RIGHT_VALID].buffer might be null
         std::swap(bitmaps[LEFT_VALID], bitmaps[RIGHT_VALID]);
         std::swap(bitmaps[LEFT_DATA], bitmaps[RIGHT_DATA]);
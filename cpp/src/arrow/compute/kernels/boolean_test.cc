@@ -62,17 +62,21 @@ class TestBooleanKernel : public ComputeFixture, public TestBase {
                               const std::shared_ptr<ChunkedArray>& left,
                               const std::shared_ptr<ChunkedArray>& right,
                               const std::shared_ptr<ChunkedArray>& expected) {
-    Datum result;
-
-    ASSERT_OK(kernel(&this->ctx_, left, right, &result));
-    ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
-    std::shared_ptr<ChunkedArray> result_ca = result.chunked_array();
-    ASSERT_TRUE(result_ca->Equals(expected));
-
-    ASSERT_OK(kernel(&this->ctx_, right, left, &result));
-    ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
-    result_ca = result.chunked_array();
-    ASSERT_TRUE(result_ca->Equals(expected));
+    for (bool use_threads : {false, true}) {
+      this->ctx_.set_use_threads(use_threads);
+      Datum result;
+
+      ASSERT_OK(kernel(&this->ctx_, left, right, &result));
+      ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+      std::shared_ptr<ChunkedArray> result_ca = result.chunked_array();
+      ASSERT_TRUE(result_ca->Equals(expected));
+
+      ASSERT_OK(kernel(&this->ctx_, right, left, &result));
+      ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+      result_ca = result.chunked_array();
+      ASSERT_TRUE(result_ca->Equals(expected));
+    }
+    this->ctx_.set_use_threads(false);
   }
 
   void TestBinaryKernel(const BinaryKernelFunc& kernel,
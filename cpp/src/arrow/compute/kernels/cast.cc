@@ -636,18 +636,22 @@ class CastKernelBase : public UnaryKernel {
 
   std::shared_ptr<DataType> out_type() const override { return out_type_; }
 
+  bool parallelizable() const override { return true; }
+
   virtual Status Init(const DataType& in_type) { return Status::OK(); }
 
+  /// \brief Whether the kernel writes into preallocated fixed-width values;
+  /// kernels sharing the input buffers must not have them allocated
+  virtual bool NeedToPreallocate() const { return is_fixed_width(out_type_->id()); }
+
  protected:
   std::shared_ptr<DataType> out_type_;
 };
 
-bool NeedToPreallocate(const DataType& type) { return is_fixed_width(type.id()); }
-
 Status InvokeWithAllocation(FunctionContext* ctx, UnaryKernel* func, const Datum& input,
                             Datum* out) {
   std::vector<Datum> result;
-  if (NeedToPreallocate(*func->out_type())) {
+  if (checked_cast<const CastKernelBase*>(func)->NeedToPreallocate()) {
     // Create wrapper that allocates output memory for primitive types
     detail::PrimitiveAllocatingUnaryKernel wrapper(func);
     RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &wrapper, input, &result));
@@ -1054,54 +1058,43 @@ struct CastFunctor<O, I,
 };
 
 // ----------------------------------------------------------------------
-// Binary to String
-//
-
-#if defined(_MSC_VER)
-// Silence warning: """'visitor': unreferenced local variable"""
-#pragma warning(push)
-#pragma warning(disable : 4101)
-#endif
+// Between binary types of different offset widths
 
-template <typename I, typename O>
-struct BinaryToStringSameWidthCastFunctor {
+template <typename O, typename I>
+struct CastFunctor<O, I,
+                   enable_if_t<is_base_binary_type<O>::value &&
+                               is_base_binary_type<I>::value &&
+                               !std::is_same<typename O::offset_type,
+                                             typename I::offset_type>::value>> {
   void operator()(FunctionContext* ctx, const CastOptions& options,
                   const ArrayData& input, ArrayData* output) {
-    if (!options.allow_invalid_utf8) {
-      util::InitializeUTF8();
-
-      ArrayDataVisitor<I> visitor;
-      Status st = visitor.Visit(input, this);
-      if (!st.ok()) {
-        ctx->SetStatus(st);
+    using in_offset_type = typename I::offset_type;
+    using out_offset_type = typename O::offset_type;
+
+    // The character data is shared, only the offsets are converted
+    std::shared_ptr<Buffer> offsets;
+    FUNC_RETURN_NOT_OK(
+        ctx->Allocate((input.length + 1) * sizeof(out_offset_type), &offsets));
+    auto out_offsets = reinterpret_cast<out_offset_type*>(offsets->mutable_data());
+    if (input.length == 0) {
+      out_offsets[0] = 0;
+    } else {
+      const in_offset_type* in_offsets = input.GetValues<in_offset_type>(1);
+      if (ARROW_PREDICT_FALSE(in_offsets[input.length] >
+                              std::numeric_limits<out_offset_type>::max())) {
+        ctx->SetStatus(Status::Invalid("Failed casting from ", input.type->ToString(),
+                                       " to ", output->type->ToString(),
+                                       ": input array too large"));
         return;
       }
+      std::copy(in_offsets, in_offsets + input.length + 1, out_offsets);
     }
-    ZeroCopyData(input, output);
-  }
-
-  Status VisitNull() { return Status::OK(); }
-
-  Status VisitValue(util::string_view str) {
-    if (ARROW_PREDICT_FALSE(!arrow::util::ValidateUTF8(str))) {
-      return Status::Invalid("Invalid UTF8 payload");
-    }
-    return Status::OK();
+    output->buffers.resize(3);
+    output->buffers[1] = std::move(offsets);
+    output->buffers[2] = input.length == 0 ? nullptr : input.buffers[2];
   }
 };
 
-template <>
-struct CastFunctor<StringType, BinaryType>
-    : public BinaryToStringSameWidthCastFunctor<StringType, BinaryType> {};
-
-template <>
-struct CastFunctor<LargeStringType, LargeBinaryType>
-    : public BinaryToStringSameWidthCastFunctor<LargeStringType, LargeBinaryType> {};
-
-#if defined(_MSC_VER)
-#pragma warning(pop)
-#endif
-
 // ----------------------------------------------------------------------
 
 typedef std::function<void(FunctionContext*, const CastOptions& options, const ArrayData&,
@@ -1112,6 +1105,8 @@ class IdentityCast : public CastKernelBase {
  public:
   using CastKernelBase::CastKernelBase;
 
+  bool NeedToPreallocate() const override { return false; }
+
   Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
     DCHECK_EQ(input.kind(), Datum::ARRAY);
     out->value = input.array()->Copy();
@@ -1119,17 +1114,112 @@ class IdentityCast : public CastKernelBase {
   }
 };
 
+// Cast between types with the same physical layout: the output references the
+// input buffers, only the type changes
 class ZeroCopyCast : public CastKernelBase {
  public:
   using CastKernelBase::CastKernelBase;
 
+  bool NeedToPreallocate() const override { return false; }
+
   Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
     DCHECK_EQ(input.kind(), Datum::ARRAY);
+    RETURN_NOT_OK(Validate(*input.array()));
     auto result = input.array()->Copy();
     result->type = out_type_;
     out->value = result;
     return Status::OK();
   }
+
+ protected:
+  // Check that the input values are valid values of the output type
+  virtual Status Validate(const ArrayData& input) { return Status::OK(); }
+};
+
+// ----------------------------------------------------------------------
+// Binary to String
+//
+
+#if defined(_MSC_VER)
+// Silence warning: """'visitor': unreferenced local variable"""
+#pragma warning(push)
+#pragma warning(disable : 4101)
+#endif
+
+template <typename I>
+class BinaryToStringCast : public ZeroCopyCast {
+ public:
+  BinaryToStringCast(const CastOptions& options, std::shared_ptr<DataType> out_type)
+      : ZeroCopyCast(std::move(out_type)), options_(options) {}
+
+  Status VisitNull() { return Status::OK(); }
+
+  Status VisitValue(util::string_view str) {
+    if (ARROW_PREDICT_FALSE(!arrow::util::ValidateUTF8(str))) {
+      return Status::Invalid("Invalid UTF8 payload");
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status Validate(const ArrayData& input) override {
+    if (options_.allow_invalid_utf8) {
+      return Status::OK();
+    }
+    util::InitializeUTF8();
+    return ArrayDataVisitor<I>::Visit(input, this);
+  }
+
+ private:
+  CastOptions options_;
+};
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+// ----------------------------------------------------------------------
+// Dictionary to Dictionary
+
+// Only the dictionary values are cast (and the indices, if the index type
+// changes), so the output stays dictionary-encoded
+class DictionaryToDictionaryCast : public CastKernelBase {
+ public:
+  DictionaryToDictionaryCast(std::unique_ptr<UnaryKernel> index_caster,
+                             std::unique_ptr<UnaryKernel> value_caster,
+                             std::shared_ptr<DataType> out_type)
+      : CastKernelBase(std::move(out_type)),
+        index_caster_(std::move(index_caster)),
+        value_caster_(std::move(value_caster)) {}
+
+  bool NeedToPreallocate() const override { return false; }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    const ArrayData& in_data = *input.array();
+
+    std::shared_ptr<ArrayData> result = in_data.Copy();
+    if (index_caster_ != nullptr) {
+      result->type = checked_cast<const DictionaryType&>(*in_data.type).index_type();
+      result->dictionary = nullptr;
+      Datum indices;
+      RETURN_NOT_OK(
+          InvokeWithAllocation(ctx, index_caster_.get(), Datum(result), &indices));
+      result = indices.array();
+    }
+
+    Datum dictionary;
+    RETURN_NOT_OK(InvokeWithAllocation(ctx, value_caster_.get(),
+                                       Datum(in_data.dictionary->data()), &dictionary));
+    result->type = out_type_;
+    result->dictionary = MakeArray(dictionary.array());
+    out->value = result;
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<UnaryKernel> index_caster_;
+  std::unique_ptr<UnaryKernel> value_caster_;
 };
 
 class CastKernel : public CastKernelBase {
@@ -1245,23 +1335,53 @@ Status GetListCastFunc(const DataType& in_type, std::shared_ptr<DataType> out_ty
   return Status::OK();
 }
 
+Status GetDictionaryCastFunc(const DataType& in_type, std::shared_ptr<DataType> out_type,
+                             const CastOptions& options,
+                             std::unique_ptr<UnaryKernel>* kernel) {
+  const auto& in_dict_type = checked_cast<const DictionaryType&>(in_type);
+  const auto& out_dict_type = checked_cast<const DictionaryType&>(*out_type);
+  std::unique_ptr<UnaryKernel> index_caster;
+  if (!in_dict_type.index_type()->Equals(out_dict_type.index_type())) {
+    RETURN_NOT_OK(GetCastFunction(*in_dict_type.index_type(),
+                                  out_dict_type.index_type(), options, &index_caster));
+  }
+  std::unique_ptr<UnaryKernel> value_caster;
+  RETURN_NOT_OK(GetCastFunction(*in_dict_type.value_type(), out_dict_type.value_type(),
+                                options, &value_caster));
+  kernel->reset(new DictionaryToDictionaryCast(
+      std::move(index_caster), std::move(value_caster), std::move(out_type)));
+  return Status::OK();
+}
+
 }  // namespace
 
-inline bool IsZeroCopyCast(Type::type in_type, Type::type out_type) {
-  switch (in_type) {
+// Whether every value of in_type is a value of out_type with the same physical
+// layout, so that casting only relabels the input buffers
+inline bool IsZeroCopyCast(const DataType& in_type, const DataType& out_type) {
+  switch (in_type.id()) {
     case Type::INT32:
-      return (out_type == Type::DATE32) || (out_type == Type::TIME32);
+      return (out_type.id() == Type::DATE32) || (out_type.id() == Type::TIME32);
     case Type::INT64:
-      return ((out_type == Type::DATE64) || (out_type == Type::TIME64) ||
-              (out_type == Type::TIMESTAMP) || (out_type == Type::DURATION));
+      return ((out_type.id() == Type::DATE64) || (out_type.id() == Type::TIME64) ||
+              (out_type.id() == Type::TIMESTAMP) || (out_type.id() == Type::DURATION));
     case Type::DATE32:
     case Type::TIME32:
-      return out_type == Type::INT32;
+      return out_type.id() == Type::INT32;
+    case Type::TIMESTAMP:
+      // Timestamps of the same unit only differ by their time zone
+      if (out_type.id() == Type::TIMESTAMP) {
+        return checked_cast<const TimestampType&>(in_type).unit() ==
+               checked_cast<const TimestampType&>(out_type).unit();
+      }
+      return out_type.id() == Type::INT64;
     case Type::DATE64:
     case Type::TIME64:
-    case Type::TIMESTAMP:
     case Type::DURATION:
-      return out_type == Type::INT64;
+      return out_type.id() == Type::INT64;
+    case Type::STRING:
+      return out_type.id() == Type::BINARY;
+    case Type::LARGE_STRING:
+      return out_type.id() == Type::LARGE_BINARY;
     default:
       break;
   }
@@ -1275,11 +1395,26 @@ Status GetCastFunction(const DataType& in_type, std::shared_ptr<DataType> out_ty
     return Status::OK();
   }
 
-  if (IsZeroCopyCast(in_type.id(), out_type->id())) {
+  if (IsZeroCopyCast(in_type, *out_type)) {
     kernel->reset(new ZeroCopyCast(std::move(out_type)));
     return Status::OK();
   }
 
+  if (in_type.id() == Type::BINARY && out_type->id() == Type::STRING) {
+    kernel->reset(new BinaryToStringCast<StringType>(options, std::move(out_type)));
+    return Status::OK();
+  }
+
+  if (in_type.id() == Type::LARGE_BINARY && out_type->id() == Type::LARGE_STRING) {
+    kernel->reset(
+        new BinaryToStringCast<LargeStringType>(options, std::move(out_type)));
+    return Status::OK();
+  }
+
+  if (in_type.id() == Type::DICTIONARY && out_type->id() == Type::DICTIONARY) {
+    return GetDictionaryCastFunc(in_type, std::move(out_type), options, kernel);
+  }
+
   if (in_type.id() == Type::NA) {
     kernel->reset(new FromNullCastKernel(std::move(out_type)));
     return Status::OK();
@@ -148,6 +148,7 @@ class TestCast : public ComputeFixture, public TestBase {
     // Should accept when invalid but null.
     ArrayFromVector<SourceType, std::string>(src_type, valid, strings, &array);
     CheckZeroCopy(*array, dest_type);
+    CheckZeroCopy(*array->Slice(1), dest_type);
 
     // Should refuse due to invalid utf8 payload
     CheckFails<SourceType, std::string>(src_type, strings, all, dest_type, options);
@@ -1068,6 +1069,27 @@ TEST_F(TestCast, DateTimeZeroCopy) {
   CheckZeroCopy(*arr, date64());
   CheckZeroCopy(*arr, timestamp(TimeUnit::NANO));
   CheckZeroCopy(*arr, duration(TimeUnit::MILLI));
+
+  // Sliced inputs keep sharing their validity bitmap
+  CheckZeroCopy(*arr->Slice(1), timestamp(TimeUnit::NANO));
+  CheckZeroCopy(*arr->Slice(3), int64());
+
+  // Only the time zone changes
+  auto timestamps = ArrayFromJSON(timestamp(TimeUnit::MILLI), "[0, null, 86400000]");
+  CheckZeroCopy(*timestamps, timestamp(TimeUnit::MILLI, "UTC"));
+  CheckZeroCopy(*timestamps->Slice(1), timestamp(TimeUnit::MILLI, "Europe/Paris"));
+}
+
+TEST_F(TestCast, StringToBinaryZeroCopy) {
+  auto strings = ArrayFromJSON(utf8(), R"(["foo", null, "", "bar"])");
+  CheckZeroCopy(*strings, binary());
+  CheckZeroCopy(*strings->Slice(1), binary());
+
+  strings = ArrayFromJSON(large_utf8(), R"(["foo", null, "", "bar"])");
+  CheckZeroCopy(*strings, large_binary());
+
+  std::shared_ptr<Array> result;
+  ASSERT_RAISES(NotImplemented, Cast(&this->ctx_, *strings, binary(), {}, &result));
 }
 
 TEST_F(TestCast, PreallocatedMemory) {
@@ -1241,6 +1263,20 @@ TEST_F(TestCast, LargeBinaryToLargeString) {
   TestCastBinaryToString<LargeBinaryType, LargeStringType>();
 }
 
+TEST_F(TestCast, BinaryOffsetWidths) {
+  const char* json = R"(["foo", null, "", "barbaz", null])";
+  CheckCaseJSON(binary(), large_binary(), json, json);
+  CheckCaseJSON(large_binary(), binary(), json, json);
+  CheckCaseJSON(utf8(), large_utf8(), json, json);
+  CheckCaseJSON(large_utf8(), utf8(), json, json);
+
+  // Only the offsets are converted, the character data is shared
+  auto input = ArrayFromJSON(utf8(), json)->Slice(1);
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Cast(&this->ctx_, *input, large_utf8(), {}, &result));
+  AssertBufferSame(*input, *result, 2);
+}
+
 TEST_F(TestCast, NumberToString) { TestCastNumberToString<StringType>(); }
 
 TEST_F(TestCast, NumberToLargeString) { TestCastNumberToString<LargeStringType>(); }
@@ -1350,6 +1386,46 @@ TEST_F(TestCast, IdentityCasts) {
   }
 }
 
+TEST_F(TestCast, DictionaryToDictionary) {
+  // Only the dictionary is cast, the indices are shared
+  auto dict_values = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])");
+  auto dict_indices = ArrayFromJSON(int32(), "[0, 1, 2, 0, null, 2, 1]");
+  auto dict_array = std::make_shared<DictionaryArray>(dictionary(int32(), utf8()),
+                                                      dict_indices, dict_values);
+  auto out_type = dictionary(int32(), large_utf8());
+
+  std::shared_ptr<Array> result;
+  for (const auto& input : ArrayVector{dict_array, dict_array->Slice(2)}) {
+    ASSERT_OK(Cast(&this->ctx_, *input, out_type, {}, &result));
+    ASSERT_OK(result->ValidateFull());
+    ASSERT_TRUE(result->type()->Equals(*out_type));
+    for (int i = 0; i < 2; ++i) {
+      AssertBufferSame(*input, *result, i);
+    }
+    const auto& out_array = checked_cast<const DictionaryArray&>(*result);
+    AssertArraysEqual(*ArrayFromJSON(large_utf8(), R"(["foo", "bar", "baz"])"),
+                      *out_array.dictionary());
+  }
+
+  // The indices are cast too if their type changes
+  dict_values = ArrayFromJSON(int8(), "[1, 2, 3]");
+  dict_indices = ArrayFromJSON(int8(), "[0, 1, 2, 0, null, 2]");
+  dict_array = std::make_shared<DictionaryArray>(dictionary(int8(), int8()),
+                                                 dict_indices, dict_values);
+  out_type = dictionary(int16(), float64());
+  ASSERT_OK(Cast(&this->ctx_, *dict_array, out_type, {}, &result));
+  ASSERT_OK(result->ValidateFull());
+  const auto& out_array = checked_cast<const DictionaryArray&>(*result);
+  ASSERT_TRUE(out_array.type()->Equals(*out_type));
+  AssertArraysEqual(*ArrayFromJSON(int16(), "[0, 1, 2, 0, null, 2]"),
+                    *out_array.indices());
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1, 2, 3]"), *out_array.dictionary());
+
+  ASSERT_RAISES(NotImplemented,
+                Cast(&this->ctx_, *dict_array, dictionary(int8(), list(int8())), {},
+                     &result));
+}
+
 TEST_F(TestCast, EmptyCasts) {
   // ARROW-4766: 0-length arrays should not segfault
   auto CheckEmptyCast = [this](std::shared_ptr<DataType> from,
@@ -17,10 +17,14 @@
 
 #include "arrow/compute/kernels/compare.h"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
+#include "arrow/buffer_builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/selection.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
@@ -114,22 +118,6 @@ struct ReadFromBitmap : internal::BitmapReader {
   }
 };
 
-template <typename T>
-struct DereferenceIncrementPointer {
-  T operator()() { return *ptr_++; }
-  const T* ptr_;
-};
-
-template <typename ArrayType>
-struct GetViewFromStringLikeArray {
-  explicit GetViewFromStringLikeArray(const ArrayType* array) : array_(array) {}
-
-  string_view operator()() { return array_->GetView(i_++); }
-
-  const ArrayType* array_;
-  int64_t i_ = 0;
-};
-
 template <typename T, typename RangeType = RepeatedValue<typename T::c_type>>
 RangeType MakeRange(const TemporalScalar<T>& scalar) {
   return RangeType{scalar.value};
@@ -149,15 +137,49 @@ ReadFromBitmap MakeRange(const BooleanArray& array) {
                         array.length());
 }
 
-template <typename T,
-          typename RangeType = DereferenceIncrementPointer<typename T::c_type>>
-RangeType MakeRange(const NumericArray<T>& array) {
-  return RangeType{array.raw_values()};
+// Random access to the compared values of non-boolean types, whose comparisons
+// are packed into bitmap words (see CompareWords)
+
+template <typename T>
+struct ValueAt {
+  T operator()(int64_t i) const { return values_[i]; }
+  const T* values_;
+};
+
+template <typename T>
+struct ScalarAt {
+  T operator()(int64_t) const { return value_; }
+  T value_;
+};
+
+template <typename ArrayType>
+struct ViewAt {
+  string_view operator()(int64_t i) const { return array_->GetView(i); }
+  const ArrayType* array_;
+};
+
+template <typename T>
+ValueAt<typename T::c_type> MakeAccessor(const NumericArray<T>& array) {
+  return {array.raw_values()};
+}
+
+template <typename T>
+ViewAt<BaseBinaryArray<T>> MakeAccessor(const BaseBinaryArray<T>& array) {
+  return {&array};
+}
+
+template <typename T>
+ScalarAt<typename T::c_type> MakeAccessor(const TemporalScalar<T>& scalar) {
+  return {scalar.value};
+}
+
+template <typename T>
+ScalarAt<typename T::c_type> MakeAccessor(const internal::PrimitiveScalar<T>& scalar) {
+  return {scalar.value};
 }
 
-template <typename T, typename RangeType = GetViewFromStringLikeArray<BaseBinaryArray<T>>>
-RangeType MakeRange(const BaseBinaryArray<T>& array) {
-  return RangeType{&array};
+ScalarAt<string_view> MakeAccessor(const BaseBinaryScalar& scalar) {
+  return {scalar.value ? string_view(*scalar.value) : string_view()};
 }
 
 inline Status AssignNulls(FunctionContext* ctx, const Array& array, const Scalar& scalar,
@@ -180,6 +202,57 @@ Status Compare(L&& get_left, R&& get_right, ArrayData* out) {
   return Status::OK();
 }
 
+// Pack 8 bytes of 0 or 1 into the bits of a byte
+inline uint64_t PackBytesToBits(const uint8_t* bytes) {
+  uint64_t x;
+  std::memcpy(&x, bytes, sizeof(x));
+  return (BitUtil::FromLittleEndian(x) * 0x0102040810204080ULL) >> 56;
+}
+
+// Compare 64 values at a time into bytes, then pack them into a bitmap word:
+// the comparisons have a fixed trip count and no loop-carried dependency, so
+// the compiler vectorizes them, and the output is written a word (rather than
+// a bit) at a time.
+template <CompareOperator Op, typename L, typename R>
+Status CompareWords(L&& left_at, R&& right_at, ArrayData* out) {
+  using T = decltype(left_at(0));
+  uint8_t* out_bitmap = out->buffers[1]->mutable_data();
+  const int64_t length = out->length;
+  uint8_t bytes[64];
+
+  for (int64_t i = 0; i < length; i += 64) {
+    const int64_t block_length = std::min<int64_t>(64, length - i);
+    if (block_length == 64) {
+      for (int64_t j = 0; j < 64; ++j) {
+        bytes[j] = Comparator<T, Op>::Compare(left_at(i + j), right_at(i + j));
+      }
+    } else {
+      std::memset(bytes, 0, sizeof(bytes));
+      for (int64_t j = 0; j < block_length; ++j) {
+        bytes[j] = Comparator<T, Op>::Compare(left_at(i + j), right_at(i + j));
+      }
+    }
+    uint64_t word = 0;
+    for (int k = 0; k < 8; ++k) {
+      word |= PackBytesToBits(bytes + 8 * k) << (8 * k);
+    }
+    word = BitUtil::ToLittleEndian(word);
+    std::memcpy(out_bitmap + i / 8, &word, BitUtil::BytesForBits(block_length));
+  }
+  return Status::OK();
+}
+
+// Booleans are read a bit at a time
+template <CompareOperator Op, typename R>
+Status CompareValues(const BooleanArray& left, const R& right, ArrayData* out) {
+  return Compare<Op>(MakeRange(left), MakeRange(right), out);
+}
+
+template <CompareOperator Op, typename L, typename R>
+Status CompareValues(const L& left, const R& right, ArrayData* out) {
+  return CompareWords<Op>(MakeAccessor(left), MakeAccessor(right), out);
+}
+
 template <typename ArrowType, CompareOperator Op>
 class CompareKernel final : public BinaryKernel {
  public:
@@ -198,12 +271,12 @@ class CompareKernel final : public BinaryKernel {
 
     if (left_array && right_array) {
       RETURN_NOT_OK(AssignNulls(ctx, *left_array, *right_array, out.get()));
-      return Compare<Op>(MakeRange(*left_array), MakeRange(*right_array), out.get());
+      return CompareValues<Op>(*left_array, *right_array, out.get());
     }
 
     if (left_array && right_scalar) {
       RETURN_NOT_OK(AssignNulls(ctx, *left_array, *right_scalar, out.get()));
-      return Compare<Op>(MakeRange(*left_array), MakeRange(*right_scalar), out.get());
+      return CompareValues<Op>(*left_array, *right_scalar, out.get());
     }
 
     return Status::Invalid("Invalid datum signature for CompareBinaryKernel::Call");
@@ -307,8 +380,42 @@ inline Status FinishCompare(FunctionContext* context, const Datum& left,
       .Call(context, left, right, out);
 }
 
+// Whether left is a dictionary array and right a scalar of its value type
+bool IsDictionaryComparison(const Datum& left, const Datum& right) {
+  if (!left.is_array() || left.type()->id() != Type::DICTIONARY || !right.is_scalar()) {
+    return false;
+  }
+  return checked_cast<const DictionaryType&>(*left.type())
+      .value_type()
+      ->Equals(right.type());
+}
+
+// Compare the dictionary with the scalar once per entry, then look up the
+// result of each slot through the indices
+Status CompareDictionary(FunctionContext* context, const Datum& left,
+                         const Datum& right, CompareOptions options,
+                         std::shared_ptr<ArrayData>* out) {
+  const auto dict_array = checked_pointer_cast<DictionaryArray>(left.make_array());
+  Datum dict_result;
+  RETURN_NOT_OK(FinishCompare(context, dict_array->dictionary(), right, options,
+                              &dict_result));
+  return detail::GatherDictionaryResult(context, *dict_array->indices()->data(),
+                                        *dict_result.array(), nullptr, out);
+}
+
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                CompareOptions options, Datum* out) {
+  if (IsDictionaryComparison(right, left)) {
+    options.op = FlippedCompareOperator(options.op);
+    return Compare(context, right, left, options, out);
+  }
+  if (IsDictionaryComparison(left, right)) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(CompareDictionary(context, left, right, options, &result));
+    *out = std::move(result);
+    return Status::OK();
+  }
+
   if (!left.type()->Equals(right.type())) {
     return Status::TypeError("Cannot compare data of differing type ", *left.type(),
                              " vs ", *right.type());
@@ -328,5 +435,164 @@ Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
   return FinishCompare(context, left, right, options, out);
 }
 
+// ----------------------------------------------------------------------
+// Comparisons narrowing a selection
+
+template <typename Predicate>
+Status SelectWhere(FunctionContext* ctx, const SelectionVector& selection,
+                   Predicate&& predicate, std::shared_ptr<SelectionVector>* out) {
+  TypedBufferBuilder<int64_t> builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.Reserve(selection.num_selected()));
+  selection.VisitSelected([&](int64_t i) {
+    if (predicate(i)) {
+      builder.UnsafeAppend(i);
+    }
+  });
+  const int64_t num_selected = builder.length();
+  std::shared_ptr<Buffer> indices;
+  RETURN_NOT_OK(builder.Finish(&indices));
+  return SelectionVector::FromIndices(std::make_shared<Int64Array>(num_selected, indices),
+                                      selection.length(), out);
+}
+
+template <typename ArrowType, CompareOperator Op>
+Status SelectCompared(FunctionContext* ctx, const Datum& left, const Datum& right,
+                      const SelectionVector& selection,
+                      std::shared_ptr<SelectionVector>* out) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  const auto left_array = checked_pointer_cast<ArrayType>(left.make_array());
+  if (right.is_scalar()) {
+    const auto& right_scalar = checked_cast<const ScalarType&>(*right.scalar());
+    if (!right_scalar.is_valid) {
+      return SelectWhere(ctx, selection, [](int64_t) { return false; }, out);
+    }
+    auto right_value = MakeRange(right_scalar)();
+    return SelectWhere(
+        ctx, selection,
+        [&](int64_t i) {
+          return left_array->IsValid(i) &&
+                 Comparator<decltype(right_value), Op>::Compare(left_array->GetView(i),
+                                                                right_value);
+        },
+        out);
+  }
+
+  const auto right_array = checked_pointer_cast<ArrayType>(right.make_array());
+  return SelectWhere(
+      ctx, selection,
+      [&](int64_t i) {
+        return left_array->IsValid(i) && right_array->IsValid(i) &&
+               Comparator<decltype(left_array->GetView(i)), Op>::Compare(
+                   left_array->GetView(i), right_array->GetView(i));
+      },
+      out);
+}
+
+struct SelectComparedVisitor {
+  Status Visit(const NullType&) {
+    return SelectWhere(ctx, selection, [](int64_t) { return false; }, out);
+  }
+
+  Status Visit(const BooleanType&) { return Unpack<BooleanType>(); }
+
+  template <typename Numeric>
+  enable_if_number<Numeric, Status> Visit(const Numeric&) {
+    return Unpack<Numeric>();
+  }
+
+  template <typename Temporal>
+  enable_if_temporal<Temporal, Status> Visit(const Temporal&) {
+    return Unpack<Temporal>();
+  }
+
+  template <typename StringLike>
+  enable_if_base_binary<StringLike, Status> Visit(const StringLike&) {
+    return Unpack<StringLike>();
+  }
+
+  Status Visit(const DayTimeIntervalType& t) { return NotImplemented(t); }
+  Status Visit(const MonthIntervalType& t) { return NotImplemented(t); }
+  Status Visit(const DurationType& t) { return NotImplemented(t); }
+  Status Visit(const DataType& t) { return NotImplemented(t); }
+
+  Status NotImplemented(const DataType& t) {
+    return Status::NotImplemented("Compare not implemented for type ", t);
+  }
+
+  template <typename ArrowType>
+  Status Unpack() {
+    switch (options.op) {
+      case CompareOperator::EQUAL:
+        return SelectCompared<ArrowType, CompareOperator::EQUAL>(ctx, left, right,
+                                                                 selection, out);
+      case CompareOperator::NOT_EQUAL:
+        return SelectCompared<ArrowType, CompareOperator::NOT_EQUAL>(ctx, left, right,
+                                                                     selection, out);
+      case CompareOperator::GREATER:
+        return SelectCompared<ArrowType, CompareOperator::GREATER>(ctx, left, right,
+                                                                   selection, out);
+      case CompareOperator::GREATER_EQUAL:
+        return SelectCompared<ArrowType, CompareOperator::GREATER_EQUAL>(
+            ctx, left, right, selection, out);
+      case CompareOperator::LESS:
+        return SelectCompared<ArrowType, CompareOperator::LESS>(ctx, left, right,
+                                                                selection, out);
+      case CompareOperator::LESS_EQUAL:
+        return SelectCompared<ArrowType, CompareOperator::LESS_EQUAL>(ctx, left, right,
+                                                                      selection, out);
+    }
+    return Status::Invalid("Unknown CompareOperator");
+  }
+
+  FunctionContext* ctx;
+  const Datum& left;
+  const Datum& right;
+  CompareOptions options;
+  const SelectionVector& selection;
+  std::shared_ptr<SelectionVector>* out;
+};
+
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               CompareOptions options, const SelectionVector& selection,
+               std::shared_ptr<SelectionVector>* out) {
+  if (IsDictionaryComparison(right, left)) {
+    options.op = FlippedCompareOperator(options.op);
+    return Compare(context, right, left, options, selection, out);
+  }
+  if (IsDictionaryComparison(left, right)) {
+    if (left.length() != selection.length()) {
+      return Status::Invalid("Compare expects arrays with the length of the selection");
+    }
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(CompareDictionary(context, left, right, options, &result));
+    const BooleanArray compared(result);
+    return SelectWhere(
+        context, selection,
+        [&](int64_t i) { return compared.IsValid(i) && compared.Value(i); }, out);
+  }
+
+  if (!left.type()->Equals(right.type())) {
+    return Status::TypeError("Cannot compare data of differing type ", *left.type(),
+                             " vs ", *right.type());
+  }
+  if (left.is_scalar()) {
+    // flip the comparison so that the scalar is the right hand side
+    options.op = FlippedCompareOperator(options.op);
+    return Compare(context, right, left, options, selection, out);
+  }
+  if (!left.is_array() || !(right.is_array() || right.is_scalar())) {
+    return Status::Invalid("Invalid datum signature for Compare");
+  }
+  if (left.length() != selection.length() ||
+      (right.is_array() && right.length() != left.length())) {
+    return Status::Invalid("Compare expects arrays with the length of the selection");
+  }
+
+  SelectComparedVisitor visitor{context, left, right, options, selection, out};
+  return VisitTypeInline(*left.type(), &visitor);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -30,6 +30,7 @@ class Status;
 namespace compute {
 
 class FunctionContext;
+class SelectionVector;
 
 enum CompareOperator {
   EQUAL,
@@ -62,11 +63,38 @@ Status MakeCompareKernel(const DataType& type, CompareOptions options,
 ///
 /// Note on floating point arrays, this uses ieee-754 compare semantics.
 ///
+/// A dictionary array may be compared with a scalar of its value type: the
+/// scalar is then compared with each dictionary entry once, and the results
+/// are looked up through the indices.
+///
 /// \since 0.14.0
 /// \note API not yet finalized
 ARROW_EXPORT
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                struct CompareOptions options, Datum* out);
 
+/// \brief Narrow a selection to the positions where a comparison is true.
+///
+/// The comparison is only evaluated at the positions of `selection`, and
+/// yields the selected positions where it is true (null comparisons are
+/// dropped) instead of a boolean array, so that comparisons can be chained
+/// without materializing filtered arrays.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left datum to compare, must be an Array
+/// \param[in] right datum to compare, an Array or a Scalar of the same type
+/// than left Datum
+/// \param[in] options compare options
+/// \param[in] selection the positions to compare, with the length of left
+/// \param[out] out the positions of selection where the comparison is true,
+/// with the INDICES representation
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               struct CompareOptions options, const SelectionVector& selection,
+               std::shared_ptr<SelectionVector>* out);
+
 }  // namespace compute
 }  // namespace arrow
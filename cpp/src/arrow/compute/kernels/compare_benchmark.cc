@@ -23,6 +23,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 
@@ -31,26 +32,54 @@ namespace compute {
 
 constexpr auto kSeed = 0x94378165;
 
-static void CompareArrayScalarKernel(benchmark::State& state) {
-  const int64_t memory_size = state.range(0);
-  const int64_t array_size = memory_size / sizeof(int64_t);
-  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
-  auto rand = random::RandomArrayGenerator(kSeed);
-  auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
-      rand.Int64(array_size, -100, 100, null_percent));
-
+template <typename ArrowType>
+static void CompareArrayScalarKernel(benchmark::State& state,
+                                     const std::shared_ptr<Array>& array,
+                                     const std::shared_ptr<Scalar>& scalar) {
   CompareOptions ge{GREATER_EQUAL};
 
   FunctionContext ctx;
   for (auto _ : state) {
     Datum out;
-    ABORT_NOT_OK(Compare(&ctx, Datum(array), Datum(int64_t(0)), ge, &out));
+    ABORT_NOT_OK(Compare(&ctx, Datum(array), Datum(scalar), ge, &out));
     benchmark::DoNotOptimize(out);
   }
 
-  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["size"] = static_cast<double>(state.range(0));
   state.counters["null_percent"] = static_cast<double>(state.range(1));
-  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void CompareArrayScalarKernel(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Int64(array_size, -100, 100, null_percent);
+
+  CompareArrayScalarKernel<Int64Type>(state, array, MakeScalar(int64_t(0)));
+}
+
+static void CompareArrayScalarKernelDouble(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(double);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Float64(array_size, -100, 100, null_percent);
+
+  CompareArrayScalarKernel<DoubleType>(state, array, MakeScalar(0.0));
+}
+
+static void CompareArrayScalarKernelString(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  // Strings of 0 to 16 characters, plus their 4-byte offset
+  const int64_t array_size = memory_size / 12;
+  auto array = rand.String(array_size, 0, 16, null_percent);
+
+  CompareArrayScalarKernel<StringType>(state, array,
+                                       std::make_shared<StringScalar>("M"));
 }
 
 static void CompareArrayArrayKernel(benchmark::State& state) {
@@ -78,6 +107,8 @@ static void CompareArrayArrayKernel(benchmark::State& state) {
 }
 
 BENCHMARK(CompareArrayScalarKernel)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarKernelDouble)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarKernelString)->Apply(RegressionSetArgs);
 BENCHMARK(CompareArrayArrayKernel)->Apply(RegressionSetArgs);
 
 }  // namespace compute
@@ -393,6 +393,28 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayScalar) {
   }
 }
 
+TYPED_TEST(TestNumericCompareKernel, RandomCompareSlicedArrays) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  // Lengths and offsets not multiple of the 64-bit output words
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  for (int64_t length : {1, 7, 63, 64, 65, 200}) {
+    for (auto null_probability : {0.0, 0.1}) {
+      for (auto op : {EQUAL, GREATER, LESS_EQUAL}) {
+        auto lhs = Datum(
+            rand.Numeric<TypeParam>(length + 3, 0, 100, null_probability)->Slice(3));
+        auto rhs = Datum(
+            rand.Numeric<TypeParam>(length + 5, 0, 100, null_probability)->Slice(5));
+        auto fifty = Datum(std::make_shared<ScalarType>(CType(50)));
+        auto options = CompareOptions(op);
+        ValidateCompare<TypeParam>(&this->ctx_, options, lhs, fifty);
+        ValidateCompare<TypeParam>(&this->ctx_, options, lhs, rhs);
+      }
+    }
+  }
+}
+
 TYPED_TEST(TestNumericCompareKernel, SimpleCompareArrayArray) {
   /* Ensure that null scalar broadcast to all null results. */
   CompareOptions eq(CompareOperator::EQUAL);
@@ -519,6 +541,39 @@ TEST_F(TestStringCompareKernel, SimpleCompareArrayScalar) {
                               "[null,0,1,1]");
 }
 
+TEST_F(TestStringCompareKernel, CompareDictionaryScalar) {
+  auto dict = ArrayFromJSON(utf8(), R"(["b", null, "a", "c"])");
+  auto indices = ArrayFromJSON(int16(), "[0, 2, null, 1, 3, 0, 2]");
+  std::shared_ptr<Array> values;
+  ASSERT_OK(DictionaryArray::FromArrays(dictionary(int16(), utf8()), indices, dict,
+                                        &values));
+  auto b = std::make_shared<StringScalar>("b");
+
+  Datum out;
+  ASSERT_OK(Compare(&this->ctx_, Datum(values), Datum(b), CompareOptions(EQUAL), &out));
+  AssertArraysEqual(
+      *ArrayFromJSON(boolean(), "[true, false, null, null, false, true, false]"),
+      *out.make_array());
+
+  // The scalar may be on the left hand side
+  ASSERT_OK(Compare(&this->ctx_, Datum(b), Datum(values), CompareOptions(GREATER), &out));
+  AssertArraysEqual(
+      *ArrayFromJSON(boolean(), "[false, true, null, null, false, false, true]"),
+      *out.make_array());
+
+  // Sliced
+  ASSERT_OK(Compare(&this->ctx_, Datum(values->Slice(3)), Datum(b),
+                    CompareOptions(NOT_EQUAL), &out));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[null, true, false, true]"),
+                    *out.make_array());
+
+  // Null scalar
+  ASSERT_OK(Compare(&this->ctx_, Datum(values), Datum(MakeNullScalar(utf8())),
+                    CompareOptions(EQUAL), &out));
+  ASSERT_EQ(out.make_array()->null_count(), values->length());
+}
+
 TEST_F(TestStringCompareKernel, RandomCompareArrayScalar) {
   using ScalarType = typename TypeTraits<StringType>::ScalarType;
 
@@ -19,6 +19,7 @@
 
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/selection.h"
 
 namespace arrow {
 namespace compute {
@@ -111,5 +112,24 @@ Status Count(FunctionContext* context, const CountOptions& options, const Array&
   return Count(context, options, array.data(), out);
 }
 
+Status Count(FunctionContext* context, const CountOptions& options, const Array& array,
+             const SelectionVector& selection, Datum* out) {
+  if (array.length() != selection.length()) {
+    return Status::Invalid("Count expects an array with the length of the selection");
+  }
+
+  CountState state(selection.num_selected(), 0);
+  if (array.null_count() > 0) {
+    selection.VisitSelected([&](int64_t i) {
+      if (array.IsNull(i)) {
+        ++state.nulls;
+      }
+    });
+    state.non_nulls -= state.nulls;
+  }
+
+  return CountAggregateFunction(options).Finalize(state, out);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -35,6 +35,7 @@ namespace compute {
 struct Datum;
 class FunctionContext;
 class AggregateFunction;
+class SelectionVector;
 
 /// \class CountOptions
 ///
@@ -84,5 +85,20 @@ ARROW_EXPORT
 Status Count(FunctionContext* context, const CountOptions& options, const Array& array,
              Datum* out);
 
+/// \brief Count non-null (or null) values in an array at the selected positions
+/// only.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options counting options, see CountOptions for more information
+/// \param[in] array to count
+/// \param[in] selection the positions to count, with the length of the array
+/// \param[out] out resulting datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Count(FunctionContext* context, const CountOptions& options, const Array& array,
+             const SelectionVector& selection, Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
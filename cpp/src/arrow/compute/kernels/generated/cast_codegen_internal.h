@@ -194,10 +194,10 @@
   TEMPLATE(DurationType, DurationType)
 
 #define BINARY_CASES(TEMPLATE) \
-  TEMPLATE(BinaryType, StringType)
+  TEMPLATE(BinaryType, LargeBinaryType)
 
 #define LARGEBINARY_CASES(TEMPLATE) \
-  TEMPLATE(LargeBinaryType, LargeStringType)
+  TEMPLATE(LargeBinaryType, BinaryType)
 
 #define STRING_CASES(TEMPLATE) \
   TEMPLATE(StringType, BooleanType) \
@@ -211,7 +211,8 @@
   TEMPLATE(StringType, Int64Type) \
   TEMPLATE(StringType, FloatType) \
   TEMPLATE(StringType, DoubleType) \
-  TEMPLATE(StringType, TimestampType)
+  TEMPLATE(StringType, TimestampType) \
+  TEMPLATE(StringType, LargeStringType)
 
 #define LARGESTRING_CASES(TEMPLATE) \
   TEMPLATE(LargeStringType, BooleanType) \
@@ -225,7 +226,8 @@
   TEMPLATE(LargeStringType, Int64Type) \
   TEMPLATE(LargeStringType, FloatType) \
   TEMPLATE(LargeStringType, DoubleType) \
-  TEMPLATE(LargeStringType, TimestampType)
+  TEMPLATE(LargeStringType, TimestampType) \
+  TEMPLATE(LargeStringType, StringType)
 
 #define DICTIONARY_CASES(TEMPLATE) \
   TEMPLATE(DictionaryType, UInt8Type) \
@@ -87,10 +87,10 @@ CAST_GENERATORS = [
     CastCodeGenerator('Timestamp', ['Date32', 'Date64', 'Timestamp'],
                       parametric=True),
     CastCodeGenerator('Duration', ['Duration'], parametric=True),
-    CastCodeGenerator('Binary', ['String']),
-    CastCodeGenerator('LargeBinary', ['LargeString']),
-    CastCodeGenerator('String', NUMERIC_TYPES + ['Timestamp']),
-    CastCodeGenerator('LargeString', NUMERIC_TYPES + ['Timestamp']),
+    CastCodeGenerator('Binary', ['LargeBinary']),
+    CastCodeGenerator('LargeBinary', ['Binary']),
+    CastCodeGenerator('String', NUMERIC_TYPES + ['Timestamp', 'LargeString']),
+    CastCodeGenerator('LargeString', NUMERIC_TYPES + ['Timestamp', 'String']),
     CastCodeGenerator('Dictionary',
                       INTEGER_TYPES + FLOATING_TYPES + DATE_TIME_TYPES +
                       ['Null', 'Binary', 'FixedSizeBinary', 'String',
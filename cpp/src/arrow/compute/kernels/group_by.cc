@@ -0,0 +1,666 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/group_by.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::DictionaryTraits;
+using internal::HashTraits;
+
+namespace compute {
+
+std::string GroupByAggregate::name() const {
+  static const char* kind_names[] = {"sum", "count", "min", "max", "mean"};
+  return std::string(kind_names[kind]) + "_" + std::to_string(value_index);
+}
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding: map the values of one key column to dense ids
+
+class KeyEncoder {
+ public:
+  virtual ~KeyEncoder() = default;
+
+  // Write one id per row of `data` into `ids`
+  virtual Status Encode(const ArrayData& data, int32_t* ids) = 0;
+
+  // The distinct values seen so far, in id order
+  virtual Status GetUniques(std::shared_ptr<ArrayData>* out) = 0;
+};
+
+template <typename Type, typename Scalar>
+class MemoKeyEncoder : public KeyEncoder {
+ public:
+  MemoKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool), memo_table_(pool, 0) {}
+
+  Status Encode(const ArrayData& data, int32_t* ids) override {
+    out_ids_ = ids;
+    return ArrayDataVisitor<Type>::Visit(data, this);
+  }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) override {
+    return DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_, memo_table_,
+                                                          0 /* start_offset */, out);
+  }
+
+  Status VisitNull() {
+    *out_ids_++ = memo_table_.GetOrInsertNull();
+    return Status::OK();
+  }
+
+  Status VisitValue(const Scalar& value) {
+    int32_t memo_index;
+    RETURN_NOT_OK(memo_table_.GetOrInsert(value, &memo_index));
+    *out_ids_++ = memo_index;
+    return Status::OK();
+  }
+
+ private:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  MemoTable memo_table_;
+  int32_t* out_ids_ = NULLPTR;
+};
+
+class NullKeyEncoder : public KeyEncoder {
+ public:
+  Status Encode(const ArrayData& data, int32_t* ids) override {
+    std::fill(ids, ids + data.length, 0);
+    seen_ = seen_ || data.length > 0;
+    return Status::OK();
+  }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) override {
+    *out = std::make_shared<NullArray>(seen_ ? 1 : 0)->data();
+    return Status::OK();
+  }
+
+ private:
+  bool seen_ = false;
+};
+
+template <typename Type, typename Enable = void>
+struct KeyEncoderTraits {};
+
+template <typename Type>
+struct KeyEncoderTraits<Type, enable_if_null<Type>> {
+  using EncoderType = NullKeyEncoder;
+};
+
+template <typename Type>
+struct KeyEncoderTraits<Type, enable_if_has_c_type<Type>> {
+  using EncoderType = MemoKeyEncoder<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct KeyEncoderTraits<Type, enable_if_has_string_view<Type>> {
+  using EncoderType = MemoKeyEncoder<Type, util::string_view>;
+};
+
+template <typename EncoderType>
+std::unique_ptr<KeyEncoder> MakeEncoder(const std::shared_ptr<DataType>& type,
+                                        MemoryPool* pool) {
+  return std::unique_ptr<KeyEncoder>(new EncoderType(type, pool));
+}
+
+template <>
+std::unique_ptr<KeyEncoder> MakeEncoder<NullKeyEncoder>(
+    const std::shared_ptr<DataType>& type, MemoryPool* pool) {
+  return std::unique_ptr<KeyEncoder>(new NullKeyEncoder());
+}
+
+#define PROCESS_SUPPORTED_KEY_TYPES(PROCESS) \
+  PROCESS(NullType)                          \
+  PROCESS(BooleanType)                       \
+  PROCESS(UInt8Type)                         \
+  PROCESS(Int8Type)                          \
+  PROCESS(UInt16Type)                        \
+  PROCESS(Int16Type)                         \
+  PROCESS(UInt32Type)                        \
+  PROCESS(Int32Type)                         \
+  PROCESS(UInt64Type)                        \
+  PROCESS(Int64Type)                         \
+  PROCESS(FloatType)                         \
+  PROCESS(DoubleType)                        \
+  PROCESS(Date32Type)                        \
+  PROCESS(Date64Type)                        \
+  PROCESS(Time32Type)                        \
+  PROCESS(Time64Type)                        \
+  PROCESS(TimestampType)                     \
+  PROCESS(BinaryType)                        \
+  PROCESS(StringType)                        \
+  PROCESS(FixedSizeBinaryType)               \
+  PROCESS(Decimal128Type)
+
+Status MakeKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                      std::unique_ptr<KeyEncoder>* out) {
+  switch (type->id()) {
+#define PROCESS(InType)                                                           \
+  case InType::type_id:                                                           \
+    *out = MakeEncoder<typename KeyEncoderTraits<InType>::EncoderType>(type, pool); \
+    return Status::OK();
+
+    PROCESS_SUPPORTED_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("group-by not implemented for key type ",
+                                type->ToString());
+}
+
+#undef PROCESS_SUPPORTED_KEY_TYPES
+
+// ----------------------------------------------------------------------
+// Per-group aggregate states
+
+class GroupedAggregator {
+ public:
+  virtual ~GroupedAggregator() = default;
+
+  // Grow the states to accommodate `num_groups` groups
+  virtual void Resize(int64_t num_groups) = 0;
+
+  // Update the states of the groups referenced by `group_ids`, one per row
+  virtual Status Consume(const ArrayData& values, const int32_t* group_ids) = 0;
+
+  // Merge the states of `other`, whose group i maps to group `group_ids[i]`
+  virtual Status Merge(const GroupedAggregator& other, const int32_t* group_ids) = 0;
+
+  virtual Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) = 0;
+};
+
+// Invoke `func(i)` for every non-null position of `data`
+template <typename Func>
+void VisitValidPositions(const ArrayData& data, Func&& func) {
+  if (data.GetNullCount() == 0) {
+    for (int64_t i = 0; i < data.length; ++i) {
+      func(i);
+    }
+  } else if (data.GetNullCount() < data.length) {
+    internal::BitmapReader reader(data.buffers[0]->data(), data.offset, data.length);
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (reader.IsSet()) {
+        func(i);
+      }
+      reader.Next();
+    }
+  }
+}
+
+class GroupedCount : public GroupedAggregator {
+ public:
+  void Resize(int64_t num_groups) override { counts_.resize(num_groups, 0); }
+
+  Status Consume(const ArrayData& values, const int32_t* group_ids) override {
+    if (values.type->id() == Type::NA) {
+      return Status::OK();
+    }
+    VisitValidPositions(values, [&](int64_t i) { ++counts_[group_ids[i]]; });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregator& other, const int32_t* group_ids) override {
+    const auto& other_counts = checked_cast<const GroupedCount&>(other).counts_;
+    for (size_t i = 0; i < other_counts.size(); ++i) {
+      counts_[group_ids[i]] += other_counts[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    Int64Builder builder(pool);
+    RETURN_NOT_OK(builder.AppendValues(counts_));
+    return builder.Finish(out);
+  }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
+// SUM and MEAN share the same state
+template <typename ArrowType>
+class GroupedSum : public GroupedAggregator {
+ public:
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+
+  explicit GroupedSum(bool mean) : mean_(mean) {}
+
+  void Resize(int64_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  Status Consume(const ArrayData& data, const int32_t* group_ids) override {
+    const CType* values = data.GetValues<CType>(1);
+    VisitValidPositions(data, [&](int64_t i) {
+      sums_[group_ids[i]] += values[i];
+      ++counts_[group_ids[i]];
+    });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregator& other, const int32_t* group_ids) override {
+    const auto& typed_other = checked_cast<const GroupedSum&>(other);
+    for (size_t i = 0; i < typed_other.sums_.size(); ++i) {
+      sums_[group_ids[i]] += typed_other.sums_[i];
+      counts_[group_ids[i]] += typed_other.counts_[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    std::vector<bool> is_valid(counts_.size());
+    for (size_t i = 0; i < counts_.size(); ++i) {
+      is_valid[i] = counts_[i] > 0;
+    }
+    if (mean_) {
+      std::vector<double> means(counts_.size(), 0);
+      for (size_t i = 0; i < counts_.size(); ++i) {
+        if (counts_[i] > 0) {
+          means[i] = static_cast<double>(sums_[i]) / static_cast<double>(counts_[i]);
+        }
+      }
+      DoubleBuilder builder(pool);
+      RETURN_NOT_OK(builder.AppendValues(means, is_valid));
+      return builder.Finish(out);
+    }
+    NumericBuilder<SumType> builder(pool);
+    RETURN_NOT_OK(builder.AppendValues(sums_, is_valid));
+    return builder.Finish(out);
+  }
+
+ private:
+  bool mean_;
+  std::vector<SumCType> sums_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename ArrowType>
+class GroupedMinMax : public GroupedAggregator {
+ public:
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  explicit GroupedMinMax(bool min) : min_(min) {}
+
+  void Resize(int64_t num_groups) override {
+    values_.resize(num_groups, 0);
+    has_values_.resize(num_groups, false);
+  }
+
+  Status Consume(const ArrayData& data, const int32_t* group_ids) override {
+    const CType* values = data.GetValues<CType>(1);
+    VisitValidPositions(data, [&](int64_t i) { Update(group_ids[i], values[i]); });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregator& other, const int32_t* group_ids) override {
+    const auto& typed_other = checked_cast<const GroupedMinMax&>(other);
+    for (size_t i = 0; i < typed_other.values_.size(); ++i) {
+      if (typed_other.has_values_[i]) {
+        Update(group_ids[i], typed_other.values_[i]);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    NumericBuilder<ArrowType> builder(pool);
+    RETURN_NOT_OK(builder.AppendValues(values_, has_values_));
+    return builder.Finish(out);
+  }
+
+ private:
+  void Update(int32_t group, CType value) {
+    if (!has_values_[group]) {
+      values_[group] = value;
+      has_values_[group] = true;
+    } else if (min_ ? value < values_[group] : value > values_[group]) {
+      values_[group] = value;
+    }
+  }
+
+  bool min_;
+  std::vector<CType> values_;
+  std::vector<bool> has_values_;
+};
+
+template <typename ArrowType>
+std::unique_ptr<GroupedAggregator> MakeNumericAggregator(GroupByAggregate::Kind kind) {
+  switch (kind) {
+    case GroupByAggregate::SUM:
+      return std::unique_ptr<GroupedAggregator>(new GroupedSum<ArrowType>(false));
+    case GroupByAggregate::MEAN:
+      return std::unique_ptr<GroupedAggregator>(new GroupedSum<ArrowType>(true));
+    case GroupByAggregate::MIN:
+      return std::unique_ptr<GroupedAggregator>(new GroupedMinMax<ArrowType>(true));
+    case GroupByAggregate::MAX:
+      return std::unique_ptr<GroupedAggregator>(new GroupedMinMax<ArrowType>(false));
+    default:
+      return NULLPTR;
+  }
+}
+
+Status MakeGroupedAggregator(const GroupByAggregate& aggregate,
+                             const std::shared_ptr<DataType>& type,
+                             std::unique_ptr<GroupedAggregator>* out) {
+  if (aggregate.kind == GroupByAggregate::COUNT) {
+    out->reset(new GroupedCount());
+    return Status::OK();
+  }
+
+  switch (type->id()) {
+#define NUMERIC_CASE(InType)                                  \
+  case InType::type_id:                                       \
+    *out = MakeNumericAggregator<InType>(aggregate.kind);     \
+    break;
+
+    NUMERIC_CASE(UInt8Type)
+    NUMERIC_CASE(Int8Type)
+    NUMERIC_CASE(UInt16Type)
+    NUMERIC_CASE(Int16Type)
+    NUMERIC_CASE(UInt32Type)
+    NUMERIC_CASE(Int32Type)
+    NUMERIC_CASE(UInt64Type)
+    NUMERIC_CASE(Int64Type)
+    NUMERIC_CASE(FloatType)
+    NUMERIC_CASE(DoubleType)
+#undef NUMERIC_CASE
+    default:
+      break;
+  }
+
+  if (*out == NULLPTR) {
+    return Status::NotImplemented("group-by ", aggregate.name(),
+                                  " not implemented for value type ",
+                                  type->ToString());
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// GroupByAggregator implementation
+
+class GroupByAggregatorImpl : public GroupByAggregator {
+ public:
+  GroupByAggregatorImpl(FunctionContext* ctx,
+                        const std::vector<std::shared_ptr<DataType>>& key_types,
+                        const std::vector<std::shared_ptr<DataType>>& value_types,
+                        const std::vector<GroupByAggregate>& aggregates)
+      : ctx_(ctx),
+        key_types_(key_types),
+        value_types_(value_types),
+        aggregates_(aggregates),
+        composite_memo_table_(ctx->memory_pool(), 0),
+        group_key_ids_(key_types.size()) {}
+
+  Status Init() {
+    if (key_types_.empty()) {
+      return Status::Invalid("group-by needs at least one key column");
+    }
+    for (const auto& type : key_types_) {
+      std::unique_ptr<KeyEncoder> encoder;
+      RETURN_NOT_OK(MakeKeyEncoder(type, ctx_->memory_pool(), &encoder));
+      encoders_.push_back(std::move(encoder));
+    }
+    for (const auto& aggregate : aggregates_) {
+      if (aggregate.value_index < 0 ||
+          aggregate.value_index >= static_cast<int>(value_types_.size())) {
+        return Status::IndexError("group-by aggregate ", aggregate.name(),
+                                  " refers to a non-existent value column");
+      }
+      std::unique_ptr<GroupedAggregator> impl;
+      RETURN_NOT_OK(
+          MakeGroupedAggregator(aggregate, value_types_[aggregate.value_index], &impl));
+      states_.push_back(std::move(impl));
+    }
+    return Status::OK();
+  }
+
+  Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                 const std::vector<std::shared_ptr<Array>>& values) override {
+    RETURN_NOT_OK(CheckColumns(keys, key_types_, "key"));
+    RETURN_NOT_OK(CheckColumns(values, value_types_, "value"));
+    const int64_t length = keys[0]->length();
+    for (const auto& value : values) {
+      if (value->length() != length) {
+        return Status::Invalid("group-by columns must have equal lengths");
+      }
+    }
+
+    std::vector<int32_t> group_ids;
+    RETURN_NOT_OK(MapGroups(keys, &group_ids));
+    for (size_t i = 0; i < states_.size(); ++i) {
+      states_[i]->Resize(num_groups_);
+      const auto& value = values[aggregates_[i].value_index];
+      RETURN_NOT_OK(states_[i]->Consume(*value->data(), group_ids.data()));
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const GroupByAggregator& other_base) override {
+    const auto& other = checked_cast<const GroupByAggregatorImpl&>(other_base);
+    if (other.key_types_.size() != key_types_.size() ||
+        other.aggregates_.size() != aggregates_.size()) {
+      return Status::Invalid("cannot merge group-by aggregators of different shapes");
+    }
+
+    std::vector<std::shared_ptr<Array>> other_keys;
+    RETURN_NOT_OK(other.MaterializeKeys(&other_keys));
+    RETURN_NOT_OK(CheckColumns(other_keys, key_types_, "key"));
+
+    std::vector<int32_t> group_ids;
+    RETURN_NOT_OK(MapGroups(other_keys, &group_ids));
+    for (size_t i = 0; i < states_.size(); ++i) {
+      if (other.aggregates_[i].kind != aggregates_[i].kind) {
+        return Status::Invalid("cannot merge group-by aggregators of different shapes");
+      }
+      states_[i]->Resize(num_groups_);
+      RETURN_NOT_OK(states_[i]->Merge(*other.states_[i], group_ids.data()));
+    }
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<StructArray>* out) override {
+    std::vector<std::shared_ptr<Array>> columns;
+    std::vector<std::string> names;
+    RETURN_NOT_OK(MaterializeKeys(&columns));
+    for (size_t i = 0; i < columns.size(); ++i) {
+      names.push_back("key_" + std::to_string(i));
+    }
+    for (size_t i = 0; i < states_.size(); ++i) {
+      std::shared_ptr<Array> column;
+      states_[i]->Resize(num_groups_);
+      RETURN_NOT_OK(states_[i]->Finish(ctx_->memory_pool(), &column));
+      columns.push_back(std::move(column));
+      names.push_back(aggregates_[i].name());
+    }
+    return StructArray::Make(columns, names).Value(out);
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
+ private:
+  static Status CheckColumns(const std::vector<std::shared_ptr<Array>>& columns,
+                             const std::vector<std::shared_ptr<DataType>>& types,
+                             const char* kind) {
+    if (columns.size() != types.size()) {
+      return Status::Invalid("group-by expected ", types.size(), " ", kind,
+                             " columns, got ", columns.size());
+    }
+    for (size_t i = 0; i < columns.size(); ++i) {
+      if (!columns[i]->type()->Equals(*types[i])) {
+        return Status::TypeError("group-by ", kind, " column ", i, " has type ",
+                                 columns[i]->type()->ToString(), ", expected ",
+                                 types[i]->ToString());
+      }
+      if (columns[i]->length() != columns[0]->length()) {
+        return Status::Invalid("group-by columns must have equal lengths");
+      }
+    }
+    return Status::OK();
+  }
+
+  // Compute the group id of every row, registering new groups as needed
+  Status MapGroups(const std::vector<std::shared_ptr<Array>>& keys,
+                   std::vector<int32_t>* group_ids) {
+    const int64_t length = keys[0]->length();
+    const size_t num_keys = keys.size();
+
+    if (num_keys == 1) {
+      group_ids->resize(length);
+      RETURN_NOT_OK(encoders_[0]->Encode(*keys[0]->data(), group_ids->data()));
+      for (int64_t i = 0; i < length; ++i) {
+        const int32_t id = (*group_ids)[i];
+        if (id >= num_groups_) {
+          // Ids are dense and assigned in order
+          DCHECK_EQ(id, num_groups_);
+          group_key_ids_[0].push_back(id);
+          ++num_groups_;
+        }
+      }
+      return Status::OK();
+    }
+
+    std::vector<int32_t> key_ids(length * num_keys);
+    for (size_t k = 0; k < num_keys; ++k) {
+      RETURN_NOT_OK(encoders_[k]->Encode(*keys[k]->data(), key_ids.data() + k * length));
+    }
+
+    group_ids->resize(length);
+    std::vector<int32_t> row_key(num_keys);
+    const auto row_key_size = static_cast<int32_t>(num_keys * sizeof(int32_t));
+    for (int64_t i = 0; i < length; ++i) {
+      for (size_t k = 0; k < num_keys; ++k) {
+        row_key[k] = key_ids[k * length + i];
+      }
+      int32_t group_id;
+      RETURN_NOT_OK(
+          composite_memo_table_.GetOrInsert(row_key.data(), row_key_size, &group_id));
+      if (group_id >= num_groups_) {
+        DCHECK_EQ(group_id, num_groups_);
+        for (size_t k = 0; k < num_keys; ++k) {
+          group_key_ids_[k].push_back(row_key[k]);
+        }
+        ++num_groups_;
+      }
+      (*group_ids)[i] = group_id;
+    }
+    return Status::OK();
+  }
+
+  // Materialize the key values of every group, in group id order
+  Status MaterializeKeys(std::vector<std::shared_ptr<Array>>* out) const {
+    out->clear();
+    for (size_t k = 0; k < encoders_.size(); ++k) {
+      std::shared_ptr<ArrayData> uniques;
+      RETURN_NOT_OK(encoders_[k]->GetUniques(&uniques));
+      if (encoders_.size() == 1) {
+        // Group ids are the key ids
+        out->push_back(MakeArray(uniques));
+        continue;
+      }
+      Int32Array indices(num_groups_, Buffer::Wrap(group_key_ids_[k]));
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(Take(ctx_, *MakeArray(uniques), indices, TakeOptions(), &column));
+      out->push_back(std::move(column));
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::vector<std::shared_ptr<DataType>> value_types_;
+  std::vector<GroupByAggregate> aggregates_;
+
+  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+  // Maps the tuple of key ids of a row to its group id
+  internal::BinaryMemoTable composite_memo_table_;
+  // For each key column, the key id of every group
+  std::vector<std::vector<int32_t>> group_key_ids_;
+  int32_t num_groups_ = 0;
+
+  std::vector<std::unique_ptr<GroupedAggregator>> states_;
+};
+
+}  // namespace
+
+Status GroupByAggregator::Make(FunctionContext* ctx,
+                               const std::vector<std::shared_ptr<DataType>>& key_types,
+                               const std::vector<std::shared_ptr<DataType>>& value_types,
+                               const std::vector<GroupByAggregate>& aggregates,
+                               std::unique_ptr<GroupByAggregator>* out) {
+  std::unique_ptr<GroupByAggregatorImpl> impl(
+      new GroupByAggregatorImpl(ctx, key_types, value_types, aggregates));
+  RETURN_NOT_OK(impl->Init());
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+Status GroupBy(FunctionContext* ctx, const std::vector<std::shared_ptr<Array>>& keys,
+               const std::vector<std::shared_ptr<Array>>& values,
+               const std::vector<GroupByAggregate>& aggregates,
+               std::shared_ptr<StructArray>* out) {
+  std::vector<std::shared_ptr<DataType>> key_types, value_types;
+  for (const auto& key : keys) {
+    key_types.push_back(key->type());
+  }
+  for (const auto& value : values) {
+    value_types.push_back(value->type());
+  }
+
+  std::unique_ptr<GroupByAggregator> aggregator;
+  RETURN_NOT_OK(
+      GroupByAggregator::Make(ctx, key_types, value_types, aggregates, &aggregator));
+  RETURN_NOT_OK(aggregator->Consume(keys, values));
+  return aggregator->Finish(out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class StructArray;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Aggregation computed for every group by GroupBy
+struct ARROW_EXPORT GroupByAggregate {
+  enum Kind {
+    /// Sum of the non-null values, null if the group has none
+    SUM = 0,
+    /// Number of non-null values (int64)
+    COUNT,
+    /// Minimum of the non-null values, null if the group has none
+    MIN,
+    /// Maximum of the non-null values, null if the group has none
+    MAX,
+    /// Mean of the non-null values (double), null if the group has none
+    MEAN,
+  };
+
+  GroupByAggregate(Kind kind, int value_index) : kind(kind), value_index(value_index) {}
+
+  /// Name of the output field for this aggregate, e.g. "sum_0"
+  std::string name() const;
+
+  Kind kind;
+  /// Index of the aggregated column in the value columns
+  int value_index;
+};
+
+/// \brief Streaming hash-based grouped aggregation
+///
+/// Key columns are hashed into dense group ids using the memo tables in
+/// arrow/util/hashing.h (one per key column, plus a composite table when there
+/// are several key columns); nulls form a group of their own.  Per-group
+/// aggregate states are updated in place for every consumed batch.
+///
+/// An aggregator is not thread-safe.  To aggregate in parallel, create one
+/// aggregator per thread with identical arguments, consume disjoint batches
+/// and Merge() the partial states into a single instance before calling
+/// Finish().
+class ARROW_EXPORT GroupByAggregator {
+ public:
+  virtual ~GroupByAggregator() = default;
+
+  /// \brief Create a grouped aggregator
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] key_types types of the key columns
+  /// \param[in] value_types types of the value columns
+  /// \param[in] aggregates the aggregates to compute, referring to value columns
+  /// \param[out] out the created aggregator
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     const std::vector<std::shared_ptr<DataType>>& value_types,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     std::unique_ptr<GroupByAggregator>* out);
+
+  /// \brief Update group states with one batch of equal-length columns
+  virtual Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                         const std::vector<std::shared_ptr<Array>>& values) = 0;
+
+  /// \brief Merge the partial states of another aggregator into this one
+  ///
+  /// The other aggregator must have been created with the same arguments.
+  virtual Status Merge(const GroupByAggregator& other) = 0;
+
+  /// \brief Emit one row per group
+  ///
+  /// The result is a struct array with fields "key_0" ... "key_N" holding the
+  /// group keys, followed by one field per aggregate (see GroupByAggregate::name).
+  /// Groups are emitted in order of first appearance.
+  virtual Status Finish(std::shared_ptr<StructArray>* out) = 0;
+
+  /// \brief Number of distinct groups seen so far
+  virtual int64_t num_groups() const = 0;
+};
+
+/// \brief Compute grouped aggregates over equal-length key and value columns
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] keys the key columns
+/// \param[in] values the value columns
+/// \param[in] aggregates the aggregates to compute
+/// \param[out] out struct array with one row per group, see
+/// GroupByAggregator::Finish
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const std::vector<std::shared_ptr<Array>>& keys,
+               const std::vector<std::shared_ptr<Array>>& values,
+               const std::vector<GroupByAggregate>& aggregates,
+               std::shared_ptr<StructArray>* out);
+
+}  // namespace compute
+}  // namespace arrow
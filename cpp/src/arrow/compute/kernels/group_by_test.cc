@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestGroupBy : public ComputeFixture, public TestBase {
+ protected:
+  void AssertGroupBy(const std::vector<std::shared_ptr<Array>>& keys,
+                     const std::vector<std::shared_ptr<Array>>& values,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     const std::string& expected_json) {
+    std::shared_ptr<StructArray> result;
+    ASSERT_OK(GroupBy(&this->ctx_, keys, values, aggregates, &result));
+    ASSERT_OK(result->ValidateFull());
+    auto expected = ArrayFromJSON(result->type(), expected_json);
+    AssertArraysEqual(*expected, *result);
+  }
+};
+
+TEST_F(TestGroupBy, SingleKey) {
+  auto keys = ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "b", "a", null])");
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3, 4, null, 6, null]");
+
+  AssertGroupBy({keys}, {values},
+                {{GroupByAggregate::SUM, 0},
+                 {GroupByAggregate::COUNT, 0},
+                 {GroupByAggregate::MIN, 0},
+                 {GroupByAggregate::MAX, 0},
+                 {GroupByAggregate::MEAN, 0}},
+                R"([{"key_0": "a", "sum_0": 10, "count_0": 3, "min_0": 1, "max_0": 6,
+                     "mean_0": 3.3333333333333335},
+                    {"key_0": "b", "sum_0": 2, "count_0": 1, "min_0": 2, "max_0": 2,
+                     "mean_0": 2.0},
+                    {"key_0": null, "sum_0": 4, "count_0": 1, "min_0": 4, "max_0": 4,
+                     "mean_0": 4.0}])");
+}
+
+TEST_F(TestGroupBy, AllNullGroup) {
+  auto keys = ArrayFromJSON(int64(), "[1, 2, 1]");
+  auto values = ArrayFromJSON(float64(), "[null, 1.5, null]");
+
+  AssertGroupBy({keys}, {values},
+                {{GroupByAggregate::SUM, 0}, {GroupByAggregate::COUNT, 0}},
+                R"([{"key_0": 1, "sum_0": null, "count_0": 0},
+                    {"key_0": 2, "sum_0": 1.5, "count_0": 1}])");
+}
+
+TEST_F(TestGroupBy, MultipleKeys) {
+  auto keys0 = ArrayFromJSON(int32(), "[1, 1, 2, 1, 2, null]");
+  auto keys1 = ArrayFromJSON(boolean(), "[true, false, true, true, true, false]");
+  auto values0 = ArrayFromJSON(int64(), "[10, 20, 30, 40, 50, 60]");
+  auto values1 = ArrayFromJSON(uint8(), "[1, 2, 3, 4, 5, 6]");
+
+  AssertGroupBy({keys0, keys1}, {values0, values1},
+                {{GroupByAggregate::SUM, 0}, {GroupByAggregate::MAX, 1}},
+                R"([{"key_0": 1, "key_1": true, "sum_0": 50, "max_1": 4},
+                    {"key_0": 1, "key_1": false, "sum_0": 20, "max_1": 2},
+                    {"key_0": 2, "key_1": true, "sum_0": 80, "max_1": 5},
+                    {"key_0": null, "key_1": false, "sum_0": 60, "max_1": 6}])");
+}
+
+TEST_F(TestGroupBy, ConsumeAndMerge) {
+  std::vector<std::shared_ptr<DataType>> key_types = {utf8(), int8()};
+  std::vector<std::shared_ptr<DataType>> value_types = {int16()};
+  std::vector<GroupByAggregate> aggregates = {{GroupByAggregate::SUM, 0},
+                                              {GroupByAggregate::COUNT, 0},
+                                              {GroupByAggregate::MIN, 0}};
+
+  std::unique_ptr<GroupByAggregator> left, right;
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, key_types, value_types, aggregates,
+                                    &left));
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, key_types, value_types, aggregates,
+                                    &right));
+
+  ASSERT_OK(left->Consume({ArrayFromJSON(utf8(), R"(["x", "y"])"),
+                           ArrayFromJSON(int8(), "[1, 1]")},
+                          {ArrayFromJSON(int16(), "[5, 7]")}));
+  ASSERT_OK(left->Consume({ArrayFromJSON(utf8(), R"(["x"])"),
+                           ArrayFromJSON(int8(), "[1]")},
+                          {ArrayFromJSON(int16(), "[-1]")}));
+  ASSERT_OK(right->Consume({ArrayFromJSON(utf8(), R"(["z", "x", "y"])"),
+                            ArrayFromJSON(int8(), "[2, 1, 2]")},
+                           {ArrayFromJSON(int16(), "[3, 4, null]")}));
+  ASSERT_EQ(2, left->num_groups());
+  ASSERT_EQ(3, right->num_groups());
+
+  ASSERT_OK(left->Merge(*right));
+  ASSERT_EQ(4, left->num_groups());
+
+  std::shared_ptr<StructArray> result;
+  ASSERT_OK(left->Finish(&result));
+  ASSERT_OK(result->ValidateFull());
+  auto expected = ArrayFromJSON(result->type(), R"([
+    {"key_0": "x", "key_1": 1, "sum_0": 8, "count_0": 3, "min_0": -1},
+    {"key_0": "y", "key_1": 1, "sum_0": 7, "count_0": 1, "min_0": 7},
+    {"key_0": "z", "key_1": 2, "sum_0": 3, "count_0": 1, "min_0": 3},
+    {"key_0": "y", "key_1": 2, "sum_0": null, "count_0": 0, "min_0": null}])");
+  AssertArraysEqual(*expected, *result);
+}
+
+TEST_F(TestGroupBy, Empty) {
+  AssertGroupBy({ArrayFromJSON(utf8(), "[]")}, {ArrayFromJSON(int32(), "[]")},
+                {{GroupByAggregate::SUM, 0}}, "[]");
+}
+
+TEST_F(TestGroupBy, Errors) {
+  std::shared_ptr<StructArray> result;
+  auto keys = ArrayFromJSON(int32(), "[1, 2]");
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b"])");
+
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {}, {values},
+                                 {{GroupByAggregate::COUNT, 0}}, &result));
+  ASSERT_RAISES(IndexError, GroupBy(&this->ctx_, {keys}, {values},
+                                    {{GroupByAggregate::COUNT, 1}}, &result));
+  ASSERT_RAISES(NotImplemented, GroupBy(&this->ctx_, {keys}, {values},
+                                        {{GroupByAggregate::SUM, 0}}, &result));
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {keys}, {ArrayFromJSON(int32(), "[1]")},
+                                 {{GroupByAggregate::SUM, 0}}, &result));
+
+  // String values can still be counted
+  ASSERT_OK(
+      GroupBy(&this->ctx_, {keys}, {values}, {{GroupByAggregate::COUNT, 0}}, &result));
+  ASSERT_EQ(2, result->length());
+}
+
+}  // namespace compute
+}  // namespace arrow
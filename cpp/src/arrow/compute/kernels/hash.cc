@@ -39,8 +39,10 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
+#include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string_view.h"
 #include "arrow/visitor_inline.h"
 
@@ -49,8 +51,10 @@ namespace arrow {
 class MemoryPool;
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 using internal::DictionaryTraits;
 using internal::HashTraits;
+using internal::ParallelFor;
 
 namespace compute {
 
@@ -221,6 +225,58 @@ class DictEncodeAction final : public ActionBase {
   Int32Builder indices_builder_;
 };
 
+// ----------------------------------------------------------------------
+// Memo index implementation, mapping each value (null included) to its index
+// in the memo table.  Used to merge hash tables built separately.
+
+class MemoIndexAction final : public ActionBase {
+ public:
+  using ActionBase::ActionBase;
+
+  MemoIndexAction(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : ActionBase(type, pool), indices_builder_(pool) {}
+
+  Status Reset() {
+    indices_builder_.Reset();
+    return Status::OK();
+  }
+
+  Status Reserve(const int64_t length) { return indices_builder_.Reserve(length); }
+
+  template <class Index>
+  void ObserveNullFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+  }
+
+  template <class Index>
+  void ObserveNullNotFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+  }
+
+  template <class Index>
+  void ObserveFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+  }
+
+  template <class Index>
+  void ObserveNotFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+  }
+
+  Status Flush(Datum* out) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(indices_builder_.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const { return int32(); }
+  Status FlushFinal(Datum* out) { return Status::OK(); }
+
+ private:
+  Int32Builder indices_builder_;
+};
+
 /// \brief Invoke hash table kernel on input array, returning any output
 /// values. Implementations should be thread-safe
 ///
@@ -532,6 +588,30 @@ Status GetValueCountsKernel(FunctionContext* ctx, const std::shared_ptr<DataType
   return Status::OK();
 }
 
+Status GetMemoIndexKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                          std::unique_ptr<HashKernel>* out) {
+  std::unique_ptr<HashKernel> kernel;
+
+  switch (type->id()) {
+#define PROCESS(InType)                                                                 \
+  case InType::type_id:                                                                 \
+    kernel.reset(                                                                       \
+        new typename HashKernelTraits<InType, MemoIndexAction, false,                   \
+                                      true>::HashKernelImpl(type, ctx->memory_pool())); \
+    break;
+
+    PROCESS_SUPPORTED_HASH_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+
+  CHECK_IMPLEMENTED(kernel, "memo-index", type);
+  RETURN_NOT_OK(kernel->Reset());
+  *out = std::move(kernel);
+  return Status::OK();
+}
+
 namespace {
 
 Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
@@ -545,9 +625,179 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Parallel hashing of chunked arrays
+//
+// Each chunk is hashed into a table of its own on the CPU thread pool.  The
+// partial dictionaries are then hashed, in chunk order, into a single table,
+// which maps the entries of each partial dictionary to the merged one, in the
+// same order as if the chunks had been hashed one after the other.
+
+using HashKernelGetter = Status (*)(FunctionContext*, const std::shared_ptr<DataType>&,
+                                    std::unique_ptr<HashKernel>*);
+
+bool UseParallelHash(FunctionContext* ctx, const Datum& value) {
+  return ctx->use_threads() && value.kind() == Datum::CHUNKED_ARRAY &&
+         value.chunked_array()->num_chunks() > 1 && value.type()->id() != Type::NA;
+}
+
+struct PartialHash {
+  // The distinct values of the chunk
+  std::shared_ptr<ArrayData> dictionary;
+  // The output of the kernel on the chunk (the indices for DictionaryEncode)
+  Datum output;
+  // The final output of the kernel (the counts for ValueCounts)
+  Datum final_output;
+  // The index of each entry of dictionary in the merged dictionary
+  std::shared_ptr<ArrayData> transpose_map;
+};
+
+Status HashChunksInParallel(FunctionContext* ctx, HashKernelGetter get_kernel,
+                            const ChunkedArray& values,
+                            std::vector<PartialHash>* partials) {
+  partials->resize(values.num_chunks());
+  return ParallelFor(values.num_chunks(), [&](int i) {
+    std::unique_ptr<HashKernel> kernel;
+    RETURN_NOT_OK(get_kernel(ctx, values.type(), &kernel));
+    PartialHash& partial = (*partials)[i];
+    RETURN_NOT_OK(kernel->Call(ctx, Datum(values.chunk(i)->data()), &partial.output));
+    RETURN_NOT_OK(kernel->FlushFinal(&partial.final_output));
+    return kernel->GetDictionary(&partial.dictionary);
+  });
+}
+
+Status MergePartialHashes(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                          std::vector<PartialHash>* partials,
+                          std::shared_ptr<ArrayData>* dictionary) {
+  std::unique_ptr<HashKernel> kernel;
+  RETURN_NOT_OK(GetMemoIndexKernel(ctx, type, &kernel));
+  for (auto& partial : *partials) {
+    Datum transpose_map;
+    RETURN_NOT_OK(kernel->Call(ctx, Datum(partial.dictionary), &transpose_map));
+    partial.transpose_map = transpose_map.array();
+  }
+  return kernel->GetDictionary(dictionary);
+}
+
+Status ParallelUnique(FunctionContext* ctx, const ChunkedArray& values,
+                      std::shared_ptr<Array>* out) {
+  std::vector<PartialHash> partials;
+  RETURN_NOT_OK(HashChunksInParallel(ctx, GetUniqueKernel, values, &partials));
+  std::shared_ptr<ArrayData> dictionary;
+  RETURN_NOT_OK(MergePartialHashes(ctx, values.type(), &partials, &dictionary));
+  *out = MakeArray(dictionary);
+  return Status::OK();
+}
+
+Status ParallelDictionaryEncode(FunctionContext* ctx, const ChunkedArray& values,
+                                Datum* out) {
+  std::vector<PartialHash> partials;
+  RETURN_NOT_OK(HashChunksInParallel(ctx, GetDictionaryEncodeKernel, values, &partials));
+  std::shared_ptr<ArrayData> dictionary_data;
+  RETURN_NOT_OK(MergePartialHashes(ctx, values.type(), &partials, &dictionary_data));
+  auto dictionary = MakeArray(dictionary_data);
+  auto dict_type = ::arrow::dictionary(int32(), values.type());
+
+  // Rewrite the indices of each chunk in terms of the merged dictionary
+  ArrayVector chunks(partials.size());
+  RETURN_NOT_OK(ParallelFor(static_cast<int>(partials.size()), [&](int i) {
+    const PartialHash& partial = partials[i];
+    std::shared_ptr<ArrayData> indices = partial.output.array();
+    // Chunks with no dictionary (only nulls) keep their indices
+    if (partial.dictionary->length > 0) {
+      std::shared_ptr<Buffer> transposed;
+      RETURN_NOT_OK(ctx->Allocate(indices->length * sizeof(int32_t), &transposed));
+      internal::TransposeInts(indices->GetValues<int32_t>(1),
+                              reinterpret_cast<int32_t*>(transposed->mutable_data()),
+                              indices->length,
+                              partial.transpose_map->GetValues<int32_t>(1));
+      indices = ArrayData::Make(int32(), indices->length,
+                                {indices->buffers[0], std::move(transposed)},
+                                indices->null_count, indices->offset);
+    }
+    chunks[i] = std::make_shared<DictionaryArray>(dict_type, MakeArray(indices),
+                                                  dictionary);
+    return Status::OK();
+  }));
+  *out = std::make_shared<ChunkedArray>(std::move(chunks), dict_type);
+  return Status::OK();
+}
+
+Status ParallelValueCounts(FunctionContext* ctx, const ChunkedArray& values,
+                           std::shared_ptr<Array>* uniques,
+                           std::shared_ptr<Array>* counts) {
+  std::vector<PartialHash> partials;
+  RETURN_NOT_OK(HashChunksInParallel(ctx, GetValueCountsKernel, values, &partials));
+  std::shared_ptr<ArrayData> dictionary;
+  RETURN_NOT_OK(MergePartialHashes(ctx, values.type(), &partials, &dictionary));
+
+  std::vector<int64_t> merged_counts(dictionary->length, 0);
+  for (const auto& partial : partials) {
+    const int64_t* partial_counts = partial.final_output.array()->GetValues<int64_t>(1);
+    const int32_t* transpose_map = partial.transpose_map->GetValues<int32_t>(1);
+    for (int64_t j = 0; j < partial.transpose_map->length; ++j) {
+      merged_counts[transpose_map[j]] += partial_counts[j];
+    }
+  }
+
+  Int64Builder counts_builder(ctx->memory_pool());
+  RETURN_NOT_OK(counts_builder.AppendValues(merged_counts));
+  RETURN_NOT_OK(counts_builder.Finish(counts));
+  *uniques = MakeArray(dictionary);
+  return Status::OK();
+}
+
 }  // namespace
 
+// The unique values of dictionary arrays are found from their indices, and
+// returned as a dictionary array with the same dictionary
+Status UniqueDictionary(FunctionContext* ctx, const Datum& value,
+                        std::shared_ptr<Array>* out) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*value.type());
+  std::shared_ptr<Array> dictionary;
+  Datum indices;
+  if (value.kind() == Datum::ARRAY) {
+    const auto dict_array = checked_pointer_cast<DictionaryArray>(value.make_array());
+    dictionary = dict_array->dictionary();
+    indices = dict_array->indices();
+  } else {
+    ArrayVector index_chunks;
+    for (const auto& chunk : value.chunked_array()->chunks()) {
+      const auto& dict_array = checked_cast<const DictionaryArray&>(*chunk);
+      if (dictionary == nullptr) {
+        dictionary = dict_array.dictionary();
+      } else if (dict_array.dictionary() != dictionary &&
+                 !dict_array.dictionary()->Equals(*dictionary)) {
+        return Status::NotImplemented(
+            "Unique of dictionary arrays with differing dictionaries");
+      }
+      index_chunks.push_back(dict_array.indices());
+    }
+    if (dictionary == nullptr) {
+      RETURN_NOT_OK(
+          MakeArrayOfNull(ctx->memory_pool(), dict_type.value_type(), 0, &dictionary));
+    }
+    indices = std::make_shared<ChunkedArray>(std::move(index_chunks),
+                                             dict_type.index_type());
+  }
+
+  std::unique_ptr<HashKernel> func;
+  RETURN_NOT_OK(GetUniqueKernel(ctx, dict_type.index_type(), &func));
+  std::vector<Datum> dummy_outputs;
+  std::shared_ptr<Array> unique_indices;
+  RETURN_NOT_OK(InvokeHash(ctx, func.get(), indices, &dummy_outputs, &unique_indices));
+  *out = std::make_shared<DictionaryArray>(value.type(), unique_indices, dictionary);
+  return Status::OK();
+}
+
 Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
+  if (value.type()->id() == Type::DICTIONARY) {
+    return UniqueDictionary(ctx, value, out);
+  }
+  if (UseParallelHash(ctx, value)) {
+    return ParallelUnique(ctx, *value.chunked_array(), out);
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
 
@@ -556,6 +806,10 @@ Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>*
 }
 
 Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
+  if (UseParallelHash(ctx, value)) {
+    return ParallelDictionaryEncode(ctx, *value.chunked_array(), out);
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
 
@@ -595,23 +849,29 @@ const int32_t kCountsFieldIndex = 1;
 
 Status ValueCounts(FunctionContext* ctx, const Datum& value,
                    std::shared_ptr<Array>* counts) {
-  std::unique_ptr<HashKernel> func;
-  RETURN_NOT_OK(GetValueCountsKernel(ctx, value.type(), &func));
+  std::shared_ptr<Array> uniques, value_counts;
+  if (UseParallelHash(ctx, value)) {
+    RETURN_NOT_OK(
+        ParallelValueCounts(ctx, *value.chunked_array(), &uniques, &value_counts));
+  } else {
+    std::unique_ptr<HashKernel> func;
+    RETURN_NOT_OK(GetValueCountsKernel(ctx, value.type(), &func));
 
-  // Calls return nothing for counts.
-  std::vector<Datum> unused_output;
-  std::shared_ptr<Array> uniques;
-  RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &unused_output, &uniques));
+    // Calls return nothing for counts.
+    std::vector<Datum> unused_output;
+    RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &unused_output, &uniques));
 
-  Datum value_counts;
-  RETURN_NOT_OK(func->FlushFinal(&value_counts));
+    Datum counts_datum;
+    RETURN_NOT_OK(func->FlushFinal(&counts_datum));
+    value_counts = MakeArray(counts_datum.array());
+  }
 
   auto data_type = std::make_shared<StructType>(std::vector<std::shared_ptr<Field>>{
       std::make_shared<Field>(kValuesFieldName, uniques->type()),
       std::make_shared<Field>(kCountsFieldName, int64())});
   *counts = std::make_shared<StructArray>(
       data_type, uniques->length(),
-      std::vector<std::shared_ptr<Array>>{uniques, MakeArray(value_counts.array())});
+      std::vector<std::shared_ptr<Array>>{uniques, value_counts});
   return Status::OK();
 }
 
@@ -34,10 +34,20 @@ namespace compute {
 
 class FunctionContext;
 
+// If the FunctionContext allows threads, the chunks of a ChunkedArray input to
+// Unique, ValueCounts and DictionaryEncode are hashed in parallel and the
+// partial hash tables merged afterwards.  The results are the same as with a
+// single thread, including the order of the unique values.
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
 ///
+/// Dictionary arrays are deduplicated on their indices, without looking at
+/// the dictionary values: the output is a dictionary array with the same
+/// dictionary. The chunks of a dictionary ChunkedArray must share their
+/// dictionary.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] datum array-like input
 /// \param[out] out result as Array
@@ -90,15 +100,6 @@ Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out)
 // Status DictionaryEncode(FunctionContext* context, const Datum& data,
 //                         const Array& prior_dictionary, Datum* out);
 
-// TODO(wesm): Implement these next
-// ARROW_EXPORT
-// Status Match(FunctionContext* context, const Datum& values, const Datum& member_set,
-//              Datum* out);
-
-// ARROW_EXPORT
-// Status IsIn(FunctionContext* context, const Datum& values, const Datum& member_set,
-//             Datum* out);
-
 }  // namespace compute
 }  // namespace arrow
 
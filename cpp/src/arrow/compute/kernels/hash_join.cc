@@ -0,0 +1,541 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash_join.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::HashTraits;
+using internal::kKeyNotFound;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding: map the values of one key column to dense ids
+
+class JoinKeyEncoder {
+ public:
+  virtual ~JoinKeyEncoder() = default;
+
+  // Write one id per row of `data` into `ids`, registering new values.
+  // Null values get kKeyNotFound.
+  virtual Status Insert(const ArrayData& data, int32_t* ids) = 0;
+
+  // Write one id per row of `data` into `ids`, kKeyNotFound for null values
+  // and values never inserted
+  virtual Status Lookup(const ArrayData& data, int32_t* ids) const = 0;
+};
+
+template <typename Type, typename Scalar>
+class MemoJoinKeyEncoder : public JoinKeyEncoder {
+ public:
+  explicit MemoJoinKeyEncoder(MemoryPool* pool) : memo_table_(pool, 0) {}
+
+  Status Insert(const ArrayData& data, int32_t* ids) override {
+    Inserter visitor{&memo_table_, ids};
+    return ArrayDataVisitor<Type>::Visit(data, &visitor);
+  }
+
+  Status Lookup(const ArrayData& data, int32_t* ids) const override {
+    Finder visitor{&memo_table_, ids};
+    return ArrayDataVisitor<Type>::Visit(data, &visitor);
+  }
+
+ private:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  struct Inserter {
+    Status VisitNull() {
+      *out_ids++ = kKeyNotFound;
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      return memo_table->GetOrInsert(value, out_ids++);
+    }
+
+    MemoTable* memo_table;
+    int32_t* out_ids;
+  };
+
+  struct Finder {
+    Status VisitNull() {
+      *out_ids++ = kKeyNotFound;
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      *out_ids++ = memo_table->Get(value);
+      return Status::OK();
+    }
+
+    const MemoTable* memo_table;
+    int32_t* out_ids;
+  };
+
+  MemoTable memo_table_;
+};
+
+// Null keys never match
+class NullJoinKeyEncoder : public JoinKeyEncoder {
+ public:
+  Status Insert(const ArrayData& data, int32_t* ids) override {
+    std::fill(ids, ids + data.length, kKeyNotFound);
+    return Status::OK();
+  }
+
+  Status Lookup(const ArrayData& data, int32_t* ids) const override {
+    std::fill(ids, ids + data.length, kKeyNotFound);
+    return Status::OK();
+  }
+};
+
+#define PROCESS_SUPPORTED_KEY_TYPES(PROCESS) \
+  PROCESS(BooleanType)                       \
+  PROCESS(UInt8Type)                         \
+  PROCESS(Int8Type)                          \
+  PROCESS(UInt16Type)                        \
+  PROCESS(Int16Type)                         \
+  PROCESS(UInt32Type)                        \
+  PROCESS(Int32Type)                         \
+  PROCESS(UInt64Type)                        \
+  PROCESS(Int64Type)                         \
+  PROCESS(FloatType)                         \
+  PROCESS(DoubleType)                        \
+  PROCESS(Date32Type)                        \
+  PROCESS(Date64Type)                        \
+  PROCESS(Time32Type)                        \
+  PROCESS(Time64Type)                        \
+  PROCESS(TimestampType)                     \
+  PROCESS(BinaryType)                        \
+  PROCESS(StringType)                        \
+  PROCESS(FixedSizeBinaryType)               \
+  PROCESS(Decimal128Type)
+
+template <typename Type, typename Enable = void>
+struct JoinKeyEncoderTraits {};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_has_c_type<Type>> {
+  using EncoderType = MemoJoinKeyEncoder<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_has_string_view<Type>> {
+  using EncoderType = MemoJoinKeyEncoder<Type, util::string_view>;
+};
+
+Status MakeJoinKeyEncoder(const DataType& type, MemoryPool* pool,
+                          std::unique_ptr<JoinKeyEncoder>* out) {
+  switch (type.id()) {
+    case Type::NA:
+      out->reset(new NullJoinKeyEncoder());
+      return Status::OK();
+#define PROCESS(InType)                                                     \
+  case InType::type_id:                                                     \
+    out->reset(new typename JoinKeyEncoderTraits<InType>::EncoderType(pool)); \
+    return Status::OK();
+
+      PROCESS_SUPPORTED_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("hash join not implemented for key type ",
+                                type.ToString());
+}
+
+#undef PROCESS_SUPPORTED_KEY_TYPES
+
+Status CheckKeyColumns(const std::vector<std::shared_ptr<Array>>& keys) {
+  if (keys.empty()) {
+    return Status::Invalid("hash join needs at least one key column");
+  }
+  for (const auto& key : keys) {
+    if (key->length() != keys[0]->length()) {
+      return Status::Invalid("hash join key columns must have equal lengths");
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// JoinHashTable implementation
+
+class JoinHashTableImpl : public JoinHashTable {
+ public:
+  explicit JoinHashTableImpl(FunctionContext* ctx)
+      : pool_(ctx->memory_pool()), composite_memo_table_(pool_, 0) {}
+
+  Status Build(const std::vector<std::shared_ptr<Array>>& keys) {
+    RETURN_NOT_OK(CheckKeyColumns(keys));
+    num_rows_ = keys[0]->length();
+    for (const auto& key : keys) {
+      key_types_.push_back(key->type());
+      std::unique_ptr<JoinKeyEncoder> encoder;
+      RETURN_NOT_OK(MakeJoinKeyEncoder(*key->type(), pool_, &encoder));
+      encoders_.push_back(std::move(encoder));
+    }
+
+    std::vector<int32_t> ids;
+    int32_t num_ids;
+    RETURN_NOT_OK(InsertKeys(keys, &ids, &num_ids));
+
+    // Chain the rows sharing a key id, in row order
+    TypedBufferBuilder<int64_t> first_rows(pool_);
+    TypedBufferBuilder<int64_t> next_rows(pool_);
+    RETURN_NOT_OK(first_rows.Append(num_ids, -1));
+    RETURN_NOT_OK(next_rows.Append(num_rows_, -1));
+    int64_t* first = first_rows.mutable_data();
+    int64_t* next = next_rows.mutable_data();
+    for (int64_t row = num_rows_ - 1; row >= 0; --row) {
+      const int32_t id = ids[row];
+      if (id != kKeyNotFound) {
+        next[row] = first[id];
+        first[id] = row;
+      }
+    }
+    RETURN_NOT_OK(first_rows.Finish(&first_rows_));
+    return next_rows.Finish(&next_rows_);
+  }
+
+  Status Probe(FunctionContext* ctx, const std::vector<std::shared_ptr<Array>>& keys,
+               HashJoinOptions::Type type, std::shared_ptr<Array>* probe_indices,
+               std::shared_ptr<Array>* build_indices) const override {
+    RETURN_NOT_OK(CheckKeyColumns(keys));
+    if (keys.size() != key_types_.size()) {
+      return Status::Invalid("hash join expected ", key_types_.size(),
+                             " probe key columns, got ", keys.size());
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (!keys[i]->type()->Equals(*key_types_[i])) {
+        return Status::TypeError("hash join key column ", i, " has type ",
+                                 keys[i]->type()->ToString(), " on the probe side, ",
+                                 key_types_[i]->ToString(), " on the build side");
+      }
+    }
+
+    std::vector<int32_t> ids;
+    RETURN_NOT_OK(LookupKeys(keys, &ids));
+
+    const auto first = reinterpret_cast<const int64_t*>(first_rows_->data());
+    const auto next = reinterpret_cast<const int64_t*>(next_rows_->data());
+    const int64_t length = keys[0]->length();
+    Int64Builder probe_builder(ctx->memory_pool());
+    Int64Builder build_builder(ctx->memory_pool());
+    if (type == HashJoinOptions::LEFT_SEMI || type == HashJoinOptions::LEFT_ANTI) {
+      const bool emit_matched = type == HashJoinOptions::LEFT_SEMI;
+      for (int64_t i = 0; i < length; ++i) {
+        const bool matched = ids[i] != kKeyNotFound && first[ids[i]] != -1;
+        if (matched == emit_matched) {
+          RETURN_NOT_OK(probe_builder.Append(i));
+        }
+      }
+      RETURN_NOT_OK(build_builder.AppendNulls(probe_builder.length()));
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        int64_t row = ids[i] == kKeyNotFound ? -1 : first[ids[i]];
+        if (row == -1 && type == HashJoinOptions::LEFT_OUTER) {
+          RETURN_NOT_OK(probe_builder.Append(i));
+          RETURN_NOT_OK(build_builder.AppendNull());
+        }
+        for (; row != -1; row = next[row]) {
+          RETURN_NOT_OK(probe_builder.Append(i));
+          RETURN_NOT_OK(build_builder.Append(row));
+        }
+      }
+    }
+    RETURN_NOT_OK(probe_builder.Finish(probe_indices));
+    return build_builder.Finish(build_indices);
+  }
+
+  int64_t num_rows() const override { return num_rows_; }
+
+ private:
+  // Compute the key id of every row, registering new keys.  Rows with a null
+  // key get kKeyNotFound.
+  Status InsertKeys(const std::vector<std::shared_ptr<Array>>& keys,
+                    std::vector<int32_t>* ids, int32_t* num_ids) {
+    const int64_t length = keys[0]->length();
+    ids->resize(length);
+    if (keys.size() == 1) {
+      RETURN_NOT_OK(encoders_[0]->Insert(*keys[0]->data(), ids->data()));
+      // Ids are dense and assigned in order
+      *num_ids = 0;
+      for (int32_t id : *ids) {
+        *num_ids = std::max(*num_ids, id + 1);
+      }
+      return Status::OK();
+    }
+
+    std::vector<int32_t> key_ids(length * keys.size());
+    for (size_t k = 0; k < keys.size(); ++k) {
+      RETURN_NOT_OK(encoders_[k]->Insert(*keys[k]->data(), key_ids.data() + k * length));
+    }
+    std::vector<int32_t> row_key(keys.size());
+    for (int64_t i = 0; i < length; ++i) {
+      int32_t id = kKeyNotFound;
+      if (GatherRowKey(key_ids, length, i, &row_key)) {
+        RETURN_NOT_OK(composite_memo_table_.GetOrInsert(
+            row_key.data(), static_cast<int32_t>(row_key.size() * sizeof(int32_t)),
+            &id));
+      }
+      (*ids)[i] = id;
+    }
+    *num_ids = composite_memo_table_.size();
+    return Status::OK();
+  }
+
+  // Compute the key id of every row, kKeyNotFound if any of its keys is null
+  // or unknown
+  Status LookupKeys(const std::vector<std::shared_ptr<Array>>& keys,
+                    std::vector<int32_t>* ids) const {
+    const int64_t length = keys[0]->length();
+    ids->resize(length);
+    if (keys.size() == 1) {
+      return encoders_[0]->Lookup(*keys[0]->data(), ids->data());
+    }
+
+    std::vector<int32_t> key_ids(length * keys.size());
+    for (size_t k = 0; k < keys.size(); ++k) {
+      RETURN_NOT_OK(encoders_[k]->Lookup(*keys[k]->data(), key_ids.data() + k * length));
+    }
+    std::vector<int32_t> row_key(keys.size());
+    for (int64_t i = 0; i < length; ++i) {
+      int32_t id = kKeyNotFound;
+      if (GatherRowKey(key_ids, length, i, &row_key)) {
+        id = composite_memo_table_.Get(
+            row_key.data(), static_cast<int32_t>(row_key.size() * sizeof(int32_t)));
+      }
+      (*ids)[i] = id;
+    }
+    return Status::OK();
+  }
+
+  // Gather the key ids of row i from the column-major `key_ids`, return false
+  // if any of them is kKeyNotFound
+  static bool GatherRowKey(const std::vector<int32_t>& key_ids, int64_t length,
+                           int64_t i, std::vector<int32_t>* row_key) {
+    for (size_t k = 0; k < row_key->size(); ++k) {
+      (*row_key)[k] = key_ids[k * length + i];
+      if ((*row_key)[k] == kKeyNotFound) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  MemoryPool* pool_;
+  int64_t num_rows_ = 0;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::vector<std::unique_ptr<JoinKeyEncoder>> encoders_;
+  // Maps the tuple of key ids of a row to its composite key id
+  internal::BinaryMemoTable composite_memo_table_;
+  // The first row of every key id, and the next row with the same key id of
+  // every row (-1 terminated)
+  std::shared_ptr<Buffer> first_rows_;
+  std::shared_ptr<Buffer> next_rows_;
+};
+
+// ----------------------------------------------------------------------
+// Record batch and table joins
+
+Status GetKeyIndices(const Schema& schema, const std::vector<std::string>& names,
+                     std::vector<int>* out) {
+  for (const auto& name : names) {
+    const int index = schema.GetFieldIndex(name);
+    if (index == -1) {
+      return Status::KeyError("hash join key column '", name, "' not found in ",
+                              schema.ToString());
+    }
+    out->push_back(index);
+  }
+  return Status::OK();
+}
+
+bool EmitsRightColumns(HashJoinOptions::Type type) {
+  return type == HashJoinOptions::INNER || type == HashJoinOptions::LEFT_OUTER;
+}
+
+std::shared_ptr<Schema> JoinedSchema(const Schema& left, const Schema& right,
+                                     HashJoinOptions::Type type) {
+  std::vector<std::shared_ptr<Field>> fields = left.fields();
+  if (EmitsRightColumns(type)) {
+    for (const auto& field : right.fields()) {
+      // Unmatched left rows get null right columns
+      fields.push_back(type == HashJoinOptions::LEFT_OUTER ? field->WithNullable(true)
+                                                           : field);
+    }
+  }
+  return schema(std::move(fields));
+}
+
+class HashJoinImpl {
+ public:
+  HashJoinImpl(FunctionContext* ctx, const HashJoinOptions& options)
+      : ctx_(ctx), options_(options) {}
+
+  // Build the hash table over the right columns
+  Status Init(const Schema& left_schema, const Schema& right_schema,
+              const std::vector<std::string>& left_keys,
+              const std::vector<std::string>& right_keys,
+              std::vector<std::shared_ptr<Array>> right_columns) {
+    if (left_keys.size() != right_keys.size()) {
+      return Status::Invalid("hash join needs as many left keys as right keys");
+    }
+    RETURN_NOT_OK(GetKeyIndices(left_schema, left_keys, &left_key_indices_));
+    std::vector<int> right_key_indices;
+    RETURN_NOT_OK(GetKeyIndices(right_schema, right_keys, &right_key_indices));
+
+    std::vector<std::shared_ptr<Array>> build_keys;
+    for (int index : right_key_indices) {
+      build_keys.push_back(right_columns[index]);
+    }
+    RETURN_NOT_OK(JoinHashTable::Make(ctx_, build_keys, &hash_table_));
+    right_columns_ = std::move(right_columns);
+    out_schema_ = JoinedSchema(left_schema, right_schema, options_.type);
+    return Status::OK();
+  }
+
+  // Join one left batch.  May be called concurrently.
+  Status Probe(FunctionContext* ctx, const RecordBatch& left,
+               std::shared_ptr<RecordBatch>* out) const {
+    std::vector<std::shared_ptr<Array>> probe_keys;
+    for (int index : left_key_indices_) {
+      probe_keys.push_back(left.column(index));
+    }
+    std::shared_ptr<Array> probe_indices, build_indices;
+    RETURN_NOT_OK(hash_table_->Probe(ctx, probe_keys, options_.type, &probe_indices,
+                                     &build_indices));
+
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < left.num_columns(); ++i) {
+      std::shared_ptr<Array> taken;
+      RETURN_NOT_OK(Take(ctx, *left.column(i), *probe_indices, TakeOptions(), &taken));
+      columns.push_back(std::move(taken));
+    }
+    if (EmitsRightColumns(options_.type)) {
+      for (const auto& column : right_columns_) {
+        std::shared_ptr<Array> taken;
+        RETURN_NOT_OK(Take(ctx, *column, *build_indices, TakeOptions(), &taken));
+        columns.push_back(std::move(taken));
+      }
+    }
+    *out = RecordBatch::Make(out_schema_, probe_indices->length(), std::move(columns));
+    return Status::OK();
+  }
+
+  const std::shared_ptr<Schema>& out_schema() const { return out_schema_; }
+
+ private:
+  FunctionContext* ctx_;
+  HashJoinOptions options_;
+  std::vector<int> left_key_indices_;
+  std::unique_ptr<JoinHashTable> hash_table_;
+  std::vector<std::shared_ptr<Array>> right_columns_;
+  std::shared_ptr<Schema> out_schema_;
+};
+
+}  // namespace
+
+Status JoinHashTable::Make(FunctionContext* ctx,
+                           const std::vector<std::shared_ptr<Array>>& keys,
+                           std::unique_ptr<JoinHashTable>* out) {
+  std::unique_ptr<JoinHashTableImpl> impl(new JoinHashTableImpl(ctx));
+  RETURN_NOT_OK(impl->Build(keys));
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+Status HashJoin(FunctionContext* ctx, const RecordBatch& left, const RecordBatch& right,
+                const std::vector<std::string>& left_keys,
+                const std::vector<std::string>& right_keys,
+                const HashJoinOptions& options, std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<Array>> right_columns;
+  for (int i = 0; i < right.num_columns(); ++i) {
+    right_columns.push_back(right.column(i));
+  }
+
+  HashJoinImpl impl(ctx, options);
+  RETURN_NOT_OK(impl.Init(*left.schema(), *right.schema(), left_keys, right_keys,
+                          std::move(right_columns)));
+  return impl.Probe(ctx, left, out);
+}
+
+Status HashJoin(FunctionContext* ctx, const Table& left, const Table& right,
+                const std::vector<std::string>& left_keys,
+                const std::vector<std::string>& right_keys,
+                const HashJoinOptions& options, std::shared_ptr<Table>* out) {
+  // The hash table indexes the rows of a single chunk
+  std::shared_ptr<Table> combined_right;
+  RETURN_NOT_OK(right.CombineChunks(ctx->memory_pool(), &combined_right));
+  std::vector<std::shared_ptr<Array>> right_columns;
+  for (const auto& column : combined_right->columns()) {
+    std::shared_ptr<Array> chunk;
+    if (column->num_chunks() == 0) {
+      RETURN_NOT_OK(MakeArrayOfNull(ctx->memory_pool(), column->type(), 0, &chunk));
+    } else {
+      chunk = column->chunk(0);
+    }
+    right_columns.push_back(std::move(chunk));
+  }
+
+  HashJoinImpl impl(ctx, options);
+  RETURN_NOT_OK(impl.Init(*left.schema(), *right.schema(), left_keys, right_keys,
+                          std::move(right_columns)));
+
+  std::vector<std::shared_ptr<RecordBatch>> left_batches;
+  TableBatchReader reader(left);
+  RETURN_NOT_OK(reader.ReadAll(&left_batches));
+
+  std::vector<std::shared_ptr<RecordBatch>> out_batches(left_batches.size());
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      options.use_threads, static_cast<int>(left_batches.size()), [&](int i) {
+        // Probes of different batches run concurrently, and the Take() calls
+        // gathering their output would all record errors in a shared `ctx`
+        FunctionContext batch_ctx(ctx->memory_pool());
+        return impl.Probe(&batch_ctx, *left_batches[i], &out_batches[i]);
+      }));
+  return Table::FromRecordBatches(impl.out_schema(), out_batches, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+struct ARROW_EXPORT HashJoinOptions {
+  enum Type {
+    /// Pairs of matching left and right rows, with the columns of both sides
+    INNER = 0,
+    /// Like INNER, plus the left rows without a match, with null right columns
+    LEFT_OUTER,
+    /// Left rows having at least one match, with the left columns only
+    LEFT_SEMI,
+    /// Left rows without a match, with the left columns only
+    LEFT_ANTI,
+  };
+
+  explicit HashJoinOptions(Type type = INNER, bool use_threads = true)
+      : type(type), use_threads(use_threads) {}
+
+  static HashJoinOptions Defaults() { return HashJoinOptions(); }
+
+  Type type;
+  /// Probe the batches of the left table in parallel on the CPU thread pool
+  bool use_threads;
+};
+
+/// \brief Hash table over the key columns of the build side of a join
+///
+/// Key columns are hashed into dense key ids using the memo tables in
+/// arrow/util/hashing.h (one per key column, plus a composite table when there
+/// are several key columns), and the rows sharing a key id are chained
+/// together.  Rows with a null key never match.
+///
+/// Once built, the table is immutable: Probe() may be called concurrently.
+/// Its memory is allocated from the memory pool of the FunctionContext it
+/// is built with.
+class ARROW_EXPORT JoinHashTable {
+ public:
+  virtual ~JoinHashTable() = default;
+
+  /// \brief Build a hash table over equal-length key columns
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] keys the key columns of the build side
+  /// \param[out] out the created hash table
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<Array>>& keys,
+                     std::unique_ptr<JoinHashTable>* out);
+
+  /// \brief Find the matches of the rows of probe-side key columns
+  ///
+  /// The key columns must have the same types as the build side ones.
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] keys the key columns of the probe side
+  /// \param[in] type the join type, deciding which rows are emitted
+  /// \param[out] probe_indices int64 indices of the emitted probe rows
+  /// \param[out] build_indices int64 indices of the matching build rows, in
+  /// the same order; null for unmatched LEFT_OUTER rows, and for LEFT_SEMI
+  /// and LEFT_ANTI joins
+  virtual Status Probe(FunctionContext* ctx,
+                       const std::vector<std::shared_ptr<Array>>& keys,
+                       HashJoinOptions::Type type, std::shared_ptr<Array>* probe_indices,
+                       std::shared_ptr<Array>* build_indices) const = 0;
+
+  /// \brief Number of rows of the build side
+  virtual int64_t num_rows() const = 0;
+};
+
+/// \brief Join two record batches on equality of key columns
+///
+/// A hash table is built over the right batch, and probed with the left
+/// batch.  The result has the columns of the left batch followed, unless the
+/// join type is LEFT_SEMI or LEFT_ANTI, by the columns of the right batch.
+/// Rows are emitted in left row order, then right row order.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the left (probe) side
+/// \param[in] right the right (build) side
+/// \param[in] left_keys names of the key columns of the left side
+/// \param[in] right_keys names of the key columns of the right side, matched
+/// positionally with left_keys
+/// \param[in] options the join options
+/// \param[out] out the joined record batch
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, const RecordBatch& left, const RecordBatch& right,
+                const std::vector<std::string>& left_keys,
+                const std::vector<std::string>& right_keys,
+                const HashJoinOptions& options, std::shared_ptr<RecordBatch>* out);
+
+/// \brief Join two tables on equality of key columns
+///
+/// Like the RecordBatch variant.  The right table is concatenated into a
+/// single hash table, the batches of the left table are probed independently
+/// (in parallel if options.use_threads is true) and yield one chunk each.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, const Table& left, const Table& right,
+                const std::vector<std::string>& left_keys,
+                const std::vector<std::string>& right_keys,
+                const HashJoinOptions& options, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
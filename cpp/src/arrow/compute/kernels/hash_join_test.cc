@@ -0,0 +1,182 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/hash_join.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    left_schema_ = schema({field("id", int32()), field("name", utf8())});
+    right_schema_ = schema({field("key", int32()), field("score", float64())});
+    left_ = RecordBatchFromJSON(left_schema_, R"([
+      {"id": 1, "name": "a"},
+      {"id": 2, "name": "b"},
+      {"id": null, "name": "c"},
+      {"id": 3, "name": "d"},
+      {"id": 1, "name": "e"}])");
+    right_ = RecordBatchFromJSON(right_schema_, R"([
+      {"key": 1, "score": 0.5},
+      {"key": 3, "score": 1.5},
+      {"key": null, "score": 2.5},
+      {"key": 1, "score": 3.5},
+      {"key": 4, "score": 4.5}])");
+  }
+
+  void AssertJoin(HashJoinOptions::Type type, const std::shared_ptr<Schema>& out_schema,
+                  const std::string& expected_json) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(HashJoin(&this->ctx_, *left_, *right_, {"id"}, {"key"},
+                       HashJoinOptions(type), &result));
+    ASSERT_OK(result->ValidateFull());
+    AssertBatchesEqual(*RecordBatchFromJSON(out_schema, expected_json), *result);
+  }
+
+  std::shared_ptr<Schema> left_schema_, right_schema_;
+  std::shared_ptr<RecordBatch> left_, right_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  auto out_schema = schema({field("id", int32()), field("name", utf8()),
+                            field("key", int32()), field("score", float64())});
+  AssertJoin(HashJoinOptions::INNER, out_schema, R"([
+    {"id": 1, "name": "a", "key": 1, "score": 0.5},
+    {"id": 1, "name": "a", "key": 1, "score": 3.5},
+    {"id": 3, "name": "d", "key": 3, "score": 1.5},
+    {"id": 1, "name": "e", "key": 1, "score": 0.5},
+    {"id": 1, "name": "e", "key": 1, "score": 3.5}])");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  auto out_schema = schema({field("id", int32()), field("name", utf8()),
+                            field("key", int32()), field("score", float64())});
+  AssertJoin(HashJoinOptions::LEFT_OUTER, out_schema, R"([
+    {"id": 1, "name": "a", "key": 1, "score": 0.5},
+    {"id": 1, "name": "a", "key": 1, "score": 3.5},
+    {"id": 2, "name": "b", "key": null, "score": null},
+    {"id": null, "name": "c", "key": null, "score": null},
+    {"id": 3, "name": "d", "key": 3, "score": 1.5},
+    {"id": 1, "name": "e", "key": 1, "score": 0.5},
+    {"id": 1, "name": "e", "key": 1, "score": 3.5}])");
+}
+
+TEST_F(TestHashJoin, LeftSemi) {
+  AssertJoin(HashJoinOptions::LEFT_SEMI, left_schema_, R"([
+    {"id": 1, "name": "a"},
+    {"id": 3, "name": "d"},
+    {"id": 1, "name": "e"}])");
+}
+
+TEST_F(TestHashJoin, LeftAnti) {
+  // Null keys never match
+  AssertJoin(HashJoinOptions::LEFT_ANTI, left_schema_, R"([
+    {"id": 2, "name": "b"},
+    {"id": null, "name": "c"}])");
+}
+
+TEST_F(TestHashJoin, MultipleKeys) {
+  auto left = RecordBatchFromJSON(
+      schema({field("a", utf8()), field("b", int64()), field("x", int8())}), R"([
+      {"a": "x", "b": 1, "x": 1},
+      {"a": "x", "b": 2, "x": 2},
+      {"a": "y", "b": 1, "x": 3},
+      {"a": "y", "b": null, "x": 4}])");
+  auto right = RecordBatchFromJSON(
+      schema({field("c", int64()), field("d", utf8()), field("y", int8())}), R"([
+      {"c": 1, "d": "y", "y": 10},
+      {"c": 2, "d": "y", "y": 20},
+      {"c": 2, "d": "x", "y": 30},
+      {"c": null, "d": "y", "y": 40}])");
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(HashJoin(&this->ctx_, *left, *right, {"a", "b"}, {"d", "c"},
+                     HashJoinOptions(HashJoinOptions::INNER), &result));
+  ASSERT_OK(result->ValidateFull());
+  auto expected = RecordBatchFromJSON(
+      schema({field("a", utf8()), field("b", int64()), field("x", int8()),
+              field("c", int64()), field("d", utf8()), field("y", int8())}),
+      R"([{"a": "x", "b": 2, "x": 2, "c": 2, "d": "x", "y": 30},
+          {"a": "y", "b": 1, "x": 3, "c": 1, "d": "y", "y": 10}])");
+  AssertBatchesEqual(*expected, *result);
+}
+
+TEST_F(TestHashJoin, ProbeIndices) {
+  std::unique_ptr<JoinHashTable> hash_table;
+  ASSERT_OK(JoinHashTable::Make(&this->ctx_, {right_->column(0)}, &hash_table));
+  ASSERT_EQ(5, hash_table->num_rows());
+
+  std::shared_ptr<Array> probe_indices, build_indices;
+  ASSERT_OK(hash_table->Probe(&this->ctx_, {ArrayFromJSON(int32(), "[4, 5, 1]")},
+                              HashJoinOptions::LEFT_OUTER, &probe_indices,
+                              &build_indices));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[0, 1, 2, 2]"), *probe_indices);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[4, null, 0, 3]"), *build_indices);
+}
+
+TEST_F(TestHashJoin, Tables) {
+  auto left = TableFromJSON(left_schema_, {R"([{"id": 1, "name": "a"},
+                                               {"id": 2, "name": "b"}])",
+                                           "[]", R"([{"id": 3, "name": "c"}])",
+                                           R"([{"id": 4, "name": "d"}])"});
+  auto right = TableFromJSON(right_schema_, {R"([{"key": 3, "score": 1.0}])",
+                                             R"([{"key": 1, "score": 2.0},
+                                                 {"key": 3, "score": 3.0}])"});
+  auto out_schema = schema({field("id", int32()), field("name", utf8()),
+                            field("key", int32()), field("score", float64())});
+  auto expected = TableFromJSON(out_schema, {R"([
+    {"id": 1, "name": "a", "key": 1, "score": 2.0},
+    {"id": 3, "name": "c", "key": 3, "score": 1.0},
+    {"id": 3, "name": "c", "key": 3, "score": 3.0}])"});
+
+  for (bool use_threads : {false, true}) {
+    std::shared_ptr<Table> result;
+    ASSERT_OK(HashJoin(&this->ctx_, *left, *right, {"id"}, {"key"},
+                       HashJoinOptions(HashJoinOptions::INNER, use_threads), &result));
+    ASSERT_OK(result->ValidateFull());
+    AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_F(TestHashJoin, Errors) {
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_RAISES(KeyError, HashJoin(&this->ctx_, *left_, *right_, {"id"}, {"missing"},
+                                   HashJoinOptions(), &result));
+  ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, *left_, *right_, {"id", "name"},
+                                  {"key"}, HashJoinOptions(), &result));
+  ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, *left_, *right_, {}, {},
+                                  HashJoinOptions(), &result));
+  ASSERT_RAISES(TypeError, HashJoin(&this->ctx_, *left_, *right_, {"name"}, {"key"},
+                                    HashJoinOptions(), &result));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -34,6 +34,7 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -581,6 +582,69 @@ TEST_F(TestHashKernel, ChunkedArrayInvoke) {
   AssertChunkedEqual(*dict_carr, *encoded_out.chunked_array());
 }
 
+TEST_F(TestHashKernel, UniqueDictionary) {
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b", "c"])");
+  std::shared_ptr<Array> values;
+  ASSERT_OK(DictionaryArray::FromArrays(
+      dict_type, ArrayFromJSON(int8(), "[2, 0, 2, null, 0, 2]"), dict, &values));
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Unique(&this->ctx_, values, &result));
+  ASSERT_OK(result->ValidateFull());
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(DictionaryArray::FromArrays(dict_type, ArrayFromJSON(int8(), "[2, 0, null]"),
+                                        dict, &expected));
+  AssertArraysEqual(*expected, *result);
+
+  // Chunked, sharing a dictionary
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 2), values->Slice(2)}, dict_type);
+  ASSERT_OK(Unique(&this->ctx_, chunked, &result));
+  AssertArraysEqual(*expected, *result);
+
+  std::shared_ptr<Array> other;
+  ASSERT_OK(DictionaryArray::FromArrays(dict_type, ArrayFromJSON(int8(), "[0]"),
+                                        ArrayFromJSON(utf8(), R"(["d"])"), &other));
+  chunked = std::make_shared<ChunkedArray>(ArrayVector{values, other}, dict_type);
+  ASSERT_RAISES(NotImplemented, Unique(&this->ctx_, chunked, &result));
+}
+
+TEST_F(TestHashKernel, ChunkedArrayParallel) {
+  random::RandomArrayGenerator rand(0x7a11);
+  ArrayVector chunks;
+  for (int i = 0; i < 8; ++i) {
+    chunks.push_back(rand.String(500, 0, 2, /*null_probability=*/0.1));
+  }
+  // A chunk of nulls only, and an empty chunk
+  chunks.push_back(ArrayFromJSON(utf8(), "[null, null]"));
+  chunks.push_back(ArrayFromJSON(utf8(), "[]"));
+  chunks.push_back(ArrayFromJSON(utf8(), R"(["new", null, "a"])"));
+  auto values = std::make_shared<ChunkedArray>(chunks);
+
+  std::shared_ptr<Array> serial_unique, serial_counts;
+  Datum serial_encoded;
+  ASSERT_OK(Unique(&this->ctx_, values, &serial_unique));
+  ASSERT_OK(ValueCounts(&this->ctx_, values, &serial_counts));
+  ASSERT_OK(DictionaryEncode(&this->ctx_, values, &serial_encoded));
+
+  this->ctx_.set_use_threads(true);
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Unique(&this->ctx_, values, &result));
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*serial_unique, *result);
+
+  ASSERT_OK(ValueCounts(&this->ctx_, values, &result));
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*serial_counts, *result);
+
+  Datum encoded;
+  ASSERT_OK(DictionaryEncode(&this->ctx_, values, &encoded));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, encoded.kind());
+  ASSERT_OK(encoded.chunked_array()->ValidateFull());
+  AssertChunkedEqual(*serial_encoded.chunked_array(), *encoded.chunked_array());
+}
+
 TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
   // ARROW-6857
   auto chunked_array = std::make_shared<ChunkedArray>(ArrayVector{}, utf8());
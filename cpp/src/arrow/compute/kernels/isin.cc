@@ -35,6 +35,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/memory_pool.h"
+#include "arrow/scalar.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
@@ -50,267 +51,578 @@ namespace arrow {
 using internal::checked_cast;
 using internal::DictionaryTraits;
 using internal::HashTraits;
+using internal::ScalarHelper;
 
 namespace compute {
 
-class IsInKernelImpl : public UnaryKernel {
-  virtual Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) = 0;
+// ----------------------------------------------------------------------
+// The value set, as a memo table of its distinct values
 
- public:
-  // \brief Check if value in both arrays or not and returns boolean values/null
-  Status Call(FunctionContext* ctx, const Datum& left, Datum* out) override {
-    DCHECK_EQ(Datum::ARRAY, left.kind());
-    RETURN_NOT_OK(Compute(ctx, left, out));
+template <typename Type, typename Scalar>
+struct ValueSet {
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  explicit ValueSet(MemoryPool* pool) : memo_table(new MemoTable(pool, 0)) {}
+
+  Status VisitNull() {
+    if (null_position == -1) {
+      null_position = static_cast<int32_t>(position);
+    }
+    ++position;
     return Status::OK();
   }
 
-  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+  Status VisitValue(const Scalar& value) {
+    int32_t memo_index;
+    RETURN_NOT_OK(memo_table->GetOrInsert(value, &memo_index));
+    if (memo_index == static_cast<int32_t>(positions.size())) {
+      positions.push_back(static_cast<int32_t>(position));
+    }
+    ++position;
+    return Status::OK();
+  }
 
-  virtual Status ConstructRight(FunctionContext* ctx, const Datum& right) = 0;
+  Status Append(const Datum& value_set) {
+    if (value_set.kind() == Datum::ARRAY) {
+      return ArrayDataVisitor<Type>::Visit(*value_set.array(), this);
+    }
+    if (value_set.kind() == Datum::CHUNKED_ARRAY) {
+      for (const auto& chunk : value_set.chunked_array()->chunks()) {
+        RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(*chunk->data(), this));
+      }
+      return Status::OK();
+    }
+    return Status::Invalid("Input Datum was not array-like");
+  }
+
+  std::unique_ptr<MemoTable> memo_table;
+  // The position in the value set of the first occurrence of each memo table entry
+  std::vector<int32_t> positions;
+  // The position of the first null in the value set, or -1
+  int32_t null_position = -1;
+  int64_t position = 0;
 };
 
 // ----------------------------------------------------------------------
-// Using a visitor create a memo_table_ for the right array
-// TODO: Implement for small lists
+// Lookup strategies, returning the position of a value in the value set or -1
 
-template <typename T, typename Scalar>
-struct MemoTableRight {
-  Status VisitNull() { return Status::OK(); }
+// Probe the memo table
+template <typename Type, typename Scalar>
+class HashLookup {
+ public:
+  explicit HashLookup(ValueSet<Type, Scalar>* value_set)
+      : memo_table_(std::move(value_set->memo_table)),
+        positions_(std::move(value_set->positions)) {}
 
-  Status VisitValue(const Scalar& value) {
-    int32_t unused_memo_index;
-    return memo_table_->GetOrInsert(value, &unused_memo_index);
+  int32_t Find(const Scalar& value) const {
+    const int32_t memo_index = memo_table_->Get(value);
+    return memo_index == -1 ? -1 : positions_[memo_index];
   }
 
-  Status Reset(MemoryPool* pool) {
-    memo_table_.reset(new MemoTable(pool, 0));
-    return Status::OK();
+ private:
+  std::unique_ptr<typename ValueSet<Type, Scalar>::MemoTable> memo_table_;
+  std::vector<int32_t> positions_;
+};
+
+// Compare with every value of a small set.  The loop has a fixed trip count and
+// no early exit, so that it compiles to branch-free compares; unused slots have
+// position -1 and never win.
+template <typename Type, typename T>
+class LinearLookup {
+ public:
+  static constexpr int32_t kMaxSize = 8;
+
+  explicit LinearLookup(const ValueSet<Type, T>& value_set) {
+    const int32_t size = value_set.memo_table->size();
+    DCHECK_LE(size, kMaxSize);
+    std::fill(values_, values_ + kMaxSize, T{});
+    std::fill(positions_, positions_ + kMaxSize, -1);
+    value_set.memo_table->CopyValues(values_);
+    std::copy(value_set.positions.begin(), value_set.positions.begin() + size,
+              positions_);
   }
 
-  Status Append(FunctionContext* ctx, const Datum& right) {
-    const ArrayData& right_data = *right.array();
-    right_null_count += right_data.GetNullCount();
-    return ArrayDataVisitor<T>::Visit(right_data, this);
+  int32_t Find(T value) const {
+    int32_t found = -1;
+    for (int32_t i = 0; i < kMaxSize; ++i) {
+      const bool equal = ScalarHelper<T, 0>::CompareScalars(values_[i], value);
+      found = std::max(found, equal ? positions_[i] : -1);
+    }
+    return found;
   }
 
-  using MemoTable = typename HashTraits<T>::MemoTableType;
-  std::unique_ptr<MemoTable> memo_table_;
-  int64_t right_null_count{};
+ private:
+  T values_[kMaxSize];
+  int32_t positions_[kMaxSize];
 };
 
-// ----------------------------------------------------------------------
-
-template <typename Type, typename Scalar>
-class IsInKernel : public IsInKernelImpl {
+// Index a table by the offset of the value from the set minimum, for integer sets
+// spanning a small range
+template <typename Type, typename T>
+class DirectLookup {
  public:
-  IsInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : type_(type), pool_(pool) {}
+  using Unsigned = typename std::make_unsigned<T>::type;
 
-  // \brief if left array has a null return true
-  Status VisitNull() {
-    writer->Set();
-    writer->Next();
-    return Status::OK();
+  static constexpr uint64_t kMaxRange = 1 << 12;
+
+  // Whether the distinct values span a small enough range
+  static bool Applies(const std::vector<T>& values, T* min) {
+    if (values.empty()) {
+      return false;
+    }
+    const auto minmax = std::minmax_element(values.begin(), values.end());
+    *min = *minmax.first;
+    return static_cast<Unsigned>(*minmax.second - *minmax.first) < kMaxRange;
   }
 
-  // \brief Iterate over the left array using another visitor.
-  // In VisitValue, use the memo_table_ (for right array) and check if value
-  // in left array is in the memo_table_. Return true if condition satisfied,
-  // else false.
-  Status VisitValue(const Scalar& value) {
-    if (memo_table_->Get(value) != -1) {
-      writer->Set();
-    } else {
-      writer->Clear();
+  DirectLookup(const ValueSet<Type, T>& value_set, const std::vector<T>& values, T min)
+      : min_(min) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      const Unsigned offset = Offset(values[i]);
+      if (offset >= table_.size()) {
+        table_.resize(offset + 1, -1);
+      }
+      table_[offset] = value_set.positions[i];
     }
-    writer->Next();
-    return Status::OK();
   }
 
-  Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
-    const ArrayData& left_data = *left.array();
+  int32_t Find(T value) const {
+    const Unsigned offset = Offset(value);
+    return offset < table_.size() ? table_[offset] : -1;
+  }
+
+ private:
+  // Wraps around for values below the minimum, so that they fail the range check
+  Unsigned Offset(T value) const {
+    return static_cast<Unsigned>(static_cast<Unsigned>(value) -
+                                 static_cast<Unsigned>(min_));
+  }
+
+  T min_;
+  std::vector<int32_t> table_;
+};
 
-    output = out->array();
-    output->type = boolean();
+// ----------------------------------------------------------------------
+// Kernels
 
-    writer = std::make_shared<internal::FirstTimeBitmapWriter>(
-        output.get()->buffers[1]->mutable_data(), output.get()->offset, left_data.length);
+// Computes IsIn (boolean output) or Match (int32 output) of an array, writing
+// to a preallocated output.  Subclasses look up all slots of the array, null or
+// not, then the null slots are fixed up here.
+class SetLookupKernelImpl : public UnaryKernel {
+ public:
+  explicit SetLookupKernelImpl(bool match) : match_(match) {}
+
+  Status Call(FunctionContext* ctx, const Datum& values, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, values.kind());
+    const ArrayData& input = *values.array();
+    ArrayData* output = out->array().get();
+    output->type = out_type();
+    output->buffers[0] = nullptr;
+    output->null_count = 0;
+    return match_ ? ComputeMatch(ctx, input, output) : ComputeIsIn(ctx, input, output);
+  }
 
-    RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(left_data, this));
-    writer->Finish();
+  std::shared_ptr<DataType> out_type() const override {
+    return match_ ? int32() : boolean();
+  }
+
+  void set_null_position(int32_t null_position) { null_position_ = null_position; }
+
+ protected:
+  virtual void LookupPositions(const ArrayData& input, int32_t* out) = 0;
+  virtual void LookupContains(const ArrayData& input, uint8_t* out_bitmap,
+                              int64_t out_offset) = 0;
+
+  // Call visit(i) for the index of each null slot of the input
+  template <typename Visit>
+  static void VisitNullSlots(const ArrayData& input, Visit&& visit) {
+    if (input.buffers[0] == nullptr) {
+      for (int64_t i = 0; i < input.length; ++i) {
+        visit(i);
+      }
+      return;
+    }
+    internal::BitmapReader reader(input.buffers[0]->data(), input.offset,
+                                  input.length);
+    for (int64_t i = 0; i < input.length; ++i) {
+      if (reader.IsNotSet()) {
+        visit(i);
+      }
+      reader.Next();
+    }
+  }
 
-    // if right null count is zero and left null count is not zero, propagate nulls
-    if (right_null_count_ == 0 && left_data.GetNullCount() != 0) {
-      RETURN_NOT_OK(detail::PropagateNulls(ctx, left_data, output.get()));
+  Status ComputeIsIn(FunctionContext* ctx, const ArrayData& input, ArrayData* output) {
+    uint8_t* out_bitmap = output->buffers[1]->mutable_data();
+    LookupContains(input, out_bitmap, output->offset);
+    if (input.GetNullCount() == 0) {
+      return Status::OK();
     }
+    if (null_position_ == -1) {
+      // Nulls are not in the value set
+      return detail::PropagateNulls(ctx, input, output);
+    }
+    VisitNullSlots(input,
+                   [&](int64_t i) { BitUtil::SetBit(out_bitmap, output->offset + i); });
     return Status::OK();
   }
 
-  Status ConstructRight(FunctionContext* ctx, const Datum& right) override {
-    MemoTableRight<Type, Scalar> func;
-    RETURN_NOT_OK(func.Reset(pool_));
+  Status ComputeMatch(FunctionContext* ctx, const ArrayData& input, ArrayData* output) {
+    int32_t* out_values = output->GetMutableValues<int32_t>(1);
+    LookupPositions(input, out_values);
+    if (input.GetNullCount() != 0) {
+      VisitNullSlots(input, [&](int64_t i) { out_values[i] = null_position_; });
+    }
 
-    if (right.kind() == Datum::ARRAY) {
-      RETURN_NOT_OK(func.Append(ctx, right));
-    } else if (right.kind() == Datum::CHUNKED_ARRAY) {
-      const ChunkedArray& right_array = *right.chunked_array();
-      for (int i = 0; i < right_array.num_chunks(); i++) {
-        RETURN_NOT_OK(func.Append(ctx, right_array.chunk(i)));
+    // Values not found in the value set are null
+    std::shared_ptr<Buffer> validity;
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(input.length), &validity));
+    const int32_t* positions = out_values;
+    internal::GenerateBitsUnrolled(validity->mutable_data(), 0, input.length,
+                                   [&]() { return *positions++ >= 0; });
+    const int64_t null_count =
+        input.length - internal::CountSetBits(validity->data(), 0, input.length);
+    if (null_count != 0) {
+      for (int64_t i = 0; i < input.length; ++i) {
+        out_values[i] = std::max(out_values[i], 0);
       }
-    } else {
-      return Status::Invalid("Input Datum was not array-like");
+      output->buffers[0] = std::move(validity);
+      output->null_count = null_count;
     }
-
-    memo_table_ = std::move(func.memo_table_);
-    right_null_count_ = func.right_null_count;
     return Status::OK();
   }
 
+ private:
+  bool match_;
+  // The position of the first null in the value set, or -1
+  int32_t null_position_ = -1;
+};
+
+// Looks up the raw values buffer of fixed-width types, without checking validity
+template <typename T, typename Lookup>
+class PrimitiveSetLookupKernel : public SetLookupKernelImpl {
+ public:
+  PrimitiveSetLookupKernel(bool match, Lookup lookup)
+      : SetLookupKernelImpl(match), lookup_(std::move(lookup)) {}
+
  protected:
-  using MemoTable = typename HashTraits<Type>::MemoTableType;
-  std::unique_ptr<MemoTable> memo_table_;
-  std::shared_ptr<DataType> type_;
-  MemoryPool* pool_;
+  void LookupPositions(const ArrayData& input, int32_t* out) override {
+    const T* values = input.GetValues<T>(1);
+    for (int64_t i = 0; i < input.length; ++i) {
+      out[i] = lookup_.Find(values[i]);
+    }
+  }
+
+  void LookupContains(const ArrayData& input, uint8_t* out_bitmap,
+                      int64_t out_offset) override {
+    const T* values = input.GetValues<T>(1);
+    internal::GenerateBitsUnrolled(out_bitmap, out_offset, input.length,
+                                   [&]() { return lookup_.Find(*values++) >= 0; });
+  }
 
  private:
-  // \brief Additional member "right_null_count" is used to check if
-  // null count in right is not 0
-  int64_t right_null_count_{};
-  std::shared_ptr<internal::FirstTimeBitmapWriter> writer;
-  std::shared_ptr<ArrayData> output;
+  Lookup lookup_;
 };
 
-// ----------------------------------------------------------------------
-// (NullType has a separate implementation)
+// Visits the values of other types, probing the memo table
+template <typename Type, typename Scalar>
+class HashSetLookupKernel : public SetLookupKernelImpl {
+ public:
+  HashSetLookupKernel(bool match, HashLookup<Type, Scalar> lookup)
+      : SetLookupKernelImpl(match), lookup_(std::move(lookup)) {}
 
-class NullIsInKernel : public IsInKernelImpl {
+ protected:
+  template <typename Emit>
+  struct Visitor {
+    Status VisitNull() {
+      emit(-1);
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      emit(lookup.Find(value));
+      return Status::OK();
+    }
+
+    const HashLookup<Type, Scalar>& lookup;
+    Emit emit;
+  };
+
+  template <typename Emit>
+  void Visit(const ArrayData& input, Emit&& emit) {
+    Visitor<Emit> visitor{lookup_, std::forward<Emit>(emit)};
+    DCHECK_OK(ArrayDataVisitor<Type>::Visit(input, &visitor));
+  }
+
+  void LookupPositions(const ArrayData& input, int32_t* out) override {
+    Visit(input, [&](int32_t position) { *out++ = position; });
+  }
+
+  void LookupContains(const ArrayData& input, uint8_t* out_bitmap,
+                      int64_t out_offset) override {
+    internal::FirstTimeBitmapWriter writer(out_bitmap, out_offset, input.length);
+    Visit(input, [&](int32_t position) {
+      if (position >= 0) {
+        writer.Set();
+      } else {
+        writer.Clear();
+      }
+      writer.Next();
+    });
+    writer.Finish();
+  }
+
+ private:
+  HashLookup<Type, Scalar> lookup_;
+};
+
+// All slots of a null array are null, so only the fix up of null slots applies
+class NullSetLookupKernel : public SetLookupKernelImpl {
  public:
-  NullIsInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool) {}
+  using SetLookupKernelImpl::SetLookupKernelImpl;
 
-  // \brief When array is NullType, based on the null count for the arrays,
-  // return true, else propagate to all nulls
-  Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
-    const ArrayData& left_data = *left.array();
-    left_null_count = left_data.GetNullCount();
+ protected:
+  void LookupPositions(const ArrayData& input, int32_t* out) override {}
+
+  void LookupContains(const ArrayData& input, uint8_t* out_bitmap,
+                      int64_t out_offset) override {
+    internal::FirstTimeBitmapWriter writer(out_bitmap, out_offset, input.length);
+    for (int64_t i = 0; i < input.length; ++i) {
+      writer.Clear();
+      writer.Next();
+    }
+    writer.Finish();
+  }
+};
 
-    output = out->array();
-    output->type = boolean();
+// ----------------------------------------------------------------------
+// Choose the lookup strategy from the value set
 
-    writer = std::make_shared<internal::FirstTimeBitmapWriter>(
-        output.get()->buffers[1]->mutable_data(), output.get()->offset, left_data.length);
+// Types whose values are looked up in the raw values buffer
+template <typename Type, typename Enable = void>
+struct IsArithmeticCType : std::false_type {};
+
+template <typename Type>
+struct IsArithmeticCType<
+    Type, enable_if_t<has_c_type<Type>::value && !is_boolean_type<Type>::value>>
+    : std::is_arithmetic<typename Type::c_type> {};
+
+template <typename Type, typename T>
+enable_if_t<std::is_integral<T>::value, bool> MakeDirectLookupKernel(
+    bool match, const ValueSet<Type, T>& value_set, const std::vector<T>& values,
+    std::unique_ptr<SetLookupKernelImpl>* out) {
+  T min;
+  if (!DirectLookup<Type, T>::Applies(values, &min)) {
+    return false;
+  }
+  out->reset(new PrimitiveSetLookupKernel<T, DirectLookup<Type, T>>(
+      match, DirectLookup<Type, T>(value_set, values, min)));
+  return true;
+}
+
+template <typename Type, typename T>
+enable_if_t<!std::is_integral<T>::value, bool> MakeDirectLookupKernel(
+    bool, const ValueSet<Type, T>&, const std::vector<T>&,
+    std::unique_ptr<SetLookupKernelImpl>*) {
+  return false;
+}
 
-    if (left_null_count != 0 && right_null_count == 0) {
-      RETURN_NOT_OK(detail::PropagateNulls(ctx, left_data, output.get()));
+struct SetLookupKernelMaker {
+  template <typename Type, typename T = typename Type::c_type>
+  static Status MakePrimitive(bool match, ValueSet<Type, T>* value_set,
+                              std::unique_ptr<SetLookupKernelImpl>* out) {
+    std::vector<T> values(value_set->memo_table->size());
+    value_set->memo_table->CopyValues(values.data());
+    if (MakeDirectLookupKernel(match, *value_set, values, out)) {
+      return Status::OK();
+    }
+    if (values.size() <= LinearLookup<Type, T>::kMaxSize) {
+      out->reset(new PrimitiveSetLookupKernel<T, LinearLookup<Type, T>>(
+          match, LinearLookup<Type, T>(*value_set)));
     } else {
-      for (int64_t i = 0; i < left_data.length; ++i) {
-        writer->Set();
-        writer->Next();
-      }
-      writer->Finish();
+      out->reset(new PrimitiveSetLookupKernel<T, HashLookup<Type, T>>(
+          match, HashLookup<Type, T>(value_set)));
     }
     return Status::OK();
   }
 
-  Status ConstructRight(FunctionContext* ctx, const Datum& right) override {
-    if (right.kind() == Datum::ARRAY) {
-      const ArrayData& right_data = *right.array();
-      right_null_count = right_data.GetNullCount();
-    } else if (right.kind() == Datum::CHUNKED_ARRAY) {
-      const ChunkedArray& right_array = *right.chunked_array();
-      for (int i = 0; i < right_array.num_chunks(); i++) {
-        right_null_count += right_array.chunk(i)->null_count();
+  template <typename Type>
+  enable_if_t<IsArithmeticCType<Type>::value, Status> Visit(const Type&) {
+    ValueSet<Type, typename Type::c_type> value_set(ctx->memory_pool());
+    RETURN_NOT_OK(value_set.Append(value_set_datum));
+    RETURN_NOT_OK(MakePrimitive<Type>(match, &value_set, &kernel));
+    kernel->set_null_position(value_set.null_position);
+    return Status::OK();
+  }
+
+  template <typename Type, typename Scalar>
+  Status MakeHash() {
+    ValueSet<Type, Scalar> value_set(ctx->memory_pool());
+    RETURN_NOT_OK(value_set.Append(value_set_datum));
+    const int32_t null_position = value_set.null_position;
+    kernel.reset(new HashSetLookupKernel<Type, Scalar>(
+        match, HashLookup<Type, Scalar>(&value_set)));
+    kernel->set_null_position(null_position);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) { return MakeHash<BooleanType, bool>(); }
+
+  template <typename Type>
+  enable_if_has_string_view<Type, Status> Visit(const Type&) {
+    return MakeHash<Type, util::string_view>();
+  }
+
+  Status Visit(const NullType&) {
+    int64_t position = 0;
+    int32_t null_position = -1;
+    auto append = [&](const Array& chunk) {
+      if (chunk.length() > 0 && null_position == -1) {
+        null_position = static_cast<int32_t>(position);
+      }
+      position += chunk.length();
+    };
+    if (value_set_datum.kind() == Datum::ARRAY) {
+      append(*value_set_datum.make_array());
+    } else if (value_set_datum.kind() == Datum::CHUNKED_ARRAY) {
+      for (const auto& chunk : value_set_datum.chunked_array()->chunks()) {
+        append(*chunk);
       }
     } else {
       return Status::Invalid("Input Datum was not array-like");
     }
+    kernel.reset(new NullSetLookupKernel(match));
+    kernel->set_null_position(null_position);
     return Status::OK();
   }
 
- private:
-  int64_t left_null_count{};
-  int64_t right_null_count{};
-  std::shared_ptr<internal::FirstTimeBitmapWriter> writer;
-  std::shared_ptr<ArrayData> output;
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented(match ? "Match" : "IsIn", " is not implemented for ",
+                                  type.ToString());
+  }
+
+  FunctionContext* ctx;
+  const Datum& value_set_datum;
+  bool match;
+  std::unique_ptr<SetLookupKernelImpl> kernel;
 };
 
-// ----------------------------------------------------------------------
-// Kernel wrapper for generic hash table kernels
+SetLookupKernel::SetLookupKernel(std::shared_ptr<DataType> value_type,
+                                 std::unique_ptr<UnaryKernel> impl)
+    : value_type_(std::move(value_type)), impl_(std::move(impl)) {}
 
-template <typename Type, typename Enable = void>
-struct IsInKernelTraits {};
+SetLookupKernel::~SetLookupKernel() = default;
 
-template <typename Type>
-struct IsInKernelTraits<Type, enable_if_null<Type>> {
-  using IsInKernelImpl = NullIsInKernel;
-};
+namespace {
 
-template <typename Type>
-struct IsInKernelTraits<Type, enable_if_has_c_type<Type>> {
-  using IsInKernelImpl = IsInKernel<Type, typename Type::c_type>;
-};
+// The value of a boolean or int32 array of length 1, as a scalar
+std::shared_ptr<Scalar> SingleValueScalar(const ArrayData& data) {
+  if (data.GetNullCount() > 0) {
+    return MakeNullScalar(data.type);
+  }
+  if (data.type->id() == Type::BOOL) {
+    return std::make_shared<BooleanScalar>(
+        BitUtil::GetBit(data.buffers[1]->data(), data.offset));
+  }
+  return std::make_shared<Int32Scalar>(data.GetValues<int32_t>(1)[0]);
+}
 
-template <typename Type>
-struct IsInKernelTraits<Type, enable_if_has_string_view<Type>> {
-  using IsInKernelImpl = IsInKernel<Type, util::string_view>;
-};
+}  // namespace
+
+Status SetLookupKernel::LookupDictionary(FunctionContext* ctx, const Datum& values,
+                                         Datum* out) {
+  // The output at null indices is that of a null value
+  std::shared_ptr<Array> null_value;
+  RETURN_NOT_OK(MakeArrayOfNull(ctx->memory_pool(), value_type_, 1, &null_value));
+  Datum null_lookup;
+  RETURN_NOT_OK(Call(ctx, null_value, &null_lookup));
+  const auto null_result = SingleValueScalar(*null_lookup.array());
+
+  std::vector<std::shared_ptr<Array>> chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.make_array());
+  } else {
+    chunks = values.chunked_array()->chunks();
+  }
 
-Status GetIsInKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
-                     const Datum& right, std::unique_ptr<IsInKernelImpl>* out) {
-  std::unique_ptr<IsInKernelImpl> kernel;
-
-#define ISIN_CASE(InType)                                               \
-  case InType::type_id:                                                 \
-    kernel.reset(new typename IsInKernelTraits<InType>::IsInKernelImpl( \
-        type, ctx->memory_pool()));                                     \
-    break
-
-  switch (type->id()) {
-    ISIN_CASE(NullType);
-    ISIN_CASE(BooleanType);
-    ISIN_CASE(UInt8Type);
-    ISIN_CASE(Int8Type);
-    ISIN_CASE(UInt16Type);
-    ISIN_CASE(Int16Type);
-    ISIN_CASE(UInt32Type);
-    ISIN_CASE(Int32Type);
-    ISIN_CASE(UInt64Type);
-    ISIN_CASE(Int64Type);
-    ISIN_CASE(FloatType);
-    ISIN_CASE(DoubleType);
-    ISIN_CASE(Date32Type);
-    ISIN_CASE(Date64Type);
-    ISIN_CASE(Time32Type);
-    ISIN_CASE(Time64Type);
-    ISIN_CASE(TimestampType);
-    ISIN_CASE(BinaryType);
-    ISIN_CASE(StringType);
-    ISIN_CASE(FixedSizeBinaryType);
-    ISIN_CASE(Decimal128Type);
-    default:
-      break;
-  }
-#undef ISIN_CASE
-
-  if (!kernel) {
-    return Status::NotImplemented("IsIn is not implemented for ", type->ToString());
-  }
-  RETURN_NOT_OK(kernel->ConstructRight(ctx, right));
-  *out = std::move(kernel);
+  // Look up each dictionary entry once (only once for chunks sharing a
+  // dictionary), then the output of each slot through its index
+  std::shared_ptr<Array> last_dictionary;
+  Datum dict_lookup;
+  std::vector<Datum> outputs;
+  for (const auto& chunk : chunks) {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*chunk);
+    if (dict_array.dictionary() != last_dictionary) {
+      last_dictionary = dict_array.dictionary();
+      RETURN_NOT_OK(Call(ctx, last_dictionary, &dict_lookup));
+    }
+    std::shared_ptr<ArrayData> output;
+    RETURN_NOT_OK(detail::GatherDictionaryResult(ctx, *dict_array.indices()->data(),
+                                                 *dict_lookup.array(), null_result.get(),
+                                                 &output));
+    outputs.emplace_back(std::move(output));
+  }
+
+  if (values.kind() == Datum::ARRAY) {
+    *out = std::move(outputs[0]);
+  } else if (outputs.empty()) {
+    *out = std::make_shared<ChunkedArray>(ArrayVector{}, out_type());
+  } else {
+    *out = detail::WrapDatumsLike(values, outputs);
+  }
   return Status::OK();
 }
 
-Status IsIn(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
-  DCHECK(left.type()->Equals(right.type()));
+Status SetLookupKernel::Call(FunctionContext* ctx, const Datum& values, Datum* out) {
+  if (values.type()->id() == Type::DICTIONARY &&
+      checked_cast<const DictionaryType&>(*values.type())
+          .value_type()
+          ->Equals(*value_type_)) {
+    return LookupDictionary(ctx, values, out);
+  }
+  if (!values.type()->Equals(*value_type_)) {
+    return Status::TypeError("Values of type ", *values.type(),
+                             " looked up in a value set of type ", *value_type_);
+  }
   std::vector<Datum> outputs;
-  std::unique_ptr<IsInKernelImpl> lkernel;
+  detail::PrimitiveAllocatingUnaryKernel kernel(impl_.get());
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, values, &outputs));
+  *out = detail::WrapDatumsLike(values, outputs);
+  return Status::OK();
+}
 
-  RETURN_NOT_OK(GetIsInKernel(ctx, left.type(), right, &lkernel));
-  detail::PrimitiveAllocatingUnaryKernel kernel(lkernel.get());
-  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, left, &outputs));
+std::shared_ptr<DataType> SetLookupKernel::out_type() const { return impl_->out_type(); }
 
-  *out = detail::WrapDatumsLike(left, outputs);
+Status SetLookupKernel::Make(FunctionContext* ctx, const Datum& value_set, bool match,
+                             std::unique_ptr<SetLookupKernel>* out) {
+  SetLookupKernelMaker maker{ctx, value_set, match, nullptr};
+  RETURN_NOT_OK(VisitTypeInline(*value_set.type(), &maker));
+  out->reset(new SetLookupKernel(value_set.type(), std::move(maker.kernel)));
   return Status::OK();
 }
 
+Status SetLookupKernel::MakeIsIn(FunctionContext* ctx, const Datum& value_set,
+                                 std::unique_ptr<SetLookupKernel>* out) {
+  return Make(ctx, value_set, /*match=*/false, out);
+}
+
+Status SetLookupKernel::MakeMatch(FunctionContext* ctx, const Datum& value_set,
+                                  std::unique_ptr<SetLookupKernel>* out) {
+  return Make(ctx, value_set, /*match=*/true, out);
+}
+
+Status IsIn(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
+  std::unique_ptr<SetLookupKernel> kernel;
+  RETURN_NOT_OK(SetLookupKernel::MakeIsIn(ctx, right, &kernel));
+  return kernel->Call(ctx, left, out);
+}
+
+Status Match(FunctionContext* ctx, const Datum& values, const Datum& value_set,
+             Datum* out) {
+  std::unique_ptr<SetLookupKernel> kernel;
+  RETURN_NOT_OK(SetLookupKernel::MakeMatch(ctx, value_set, &kernel));
+  return kernel->Call(ctx, values, out);
+}
+
 }  // namespace compute
 }  // namespace arrow
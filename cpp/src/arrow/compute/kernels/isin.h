@@ -35,6 +35,8 @@ namespace compute {
 /// If null occurs in left, if null count in right is not 0,
 /// it returns true, else returns null.
 ///
+/// left may also be a dictionary array whose value type is that of right.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] left array-like input
 /// \param[in] right array-like input
@@ -45,5 +47,65 @@ namespace compute {
 ARROW_EXPORT
 Status IsIn(FunctionContext* context, const Datum& left, const Datum& right, Datum* out);
 
+/// \brief Match returns the position in the value set of the first occurrence
+/// of each value, or null if the value doesn't occur in the value set.
+///
+/// A null value is matched with the first null of the value set, if any.
+///
+/// values may also be a dictionary array whose value type is that of value_set.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input
+/// \param[in] value_set array-like input, of the same type as values
+/// \param[out] out resulting int32 datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Match(FunctionContext* context, const Datum& values, const Datum& value_set,
+             Datum* out);
+
+/// \brief A kernel computing IsIn or Match against a value set prepared once,
+/// to look up several datums in the same value set.
+///
+/// The lookup strategy is chosen from the value set: numeric sets spanning a
+/// small integer range index a table, other sets of a few distinct values are
+/// compared with each of them without branching, and larger sets are hashed.
+/// Call() doesn't modify the kernel, so it may be called concurrently.
+class ARROW_EXPORT SetLookupKernel : public UnaryKernel {
+ public:
+  ~SetLookupKernel() override;
+
+  /// \brief Look up the values of an array-like datum of the value set type
+  ///
+  /// Dictionary arrays whose value type is that of the value set are also
+  /// accepted: each dictionary entry is then looked up once, and the results
+  /// are mapped through the indices.
+  Status Call(FunctionContext* ctx, const Datum& values, Datum* out) override;
+
+  /// \brief boolean for IsIn, int32 for Match
+  std::shared_ptr<DataType> out_type() const override;
+
+  /// \brief Make a kernel computing IsIn(values, value_set)
+  static Status MakeIsIn(FunctionContext* ctx, const Datum& value_set,
+                         std::unique_ptr<SetLookupKernel>* out);
+
+  /// \brief Make a kernel computing Match(values, value_set)
+  static Status MakeMatch(FunctionContext* ctx, const Datum& value_set,
+                          std::unique_ptr<SetLookupKernel>* out);
+
+ private:
+  SetLookupKernel(std::shared_ptr<DataType> value_type,
+                  std::unique_ptr<UnaryKernel> impl);
+
+  static Status Make(FunctionContext* ctx, const Datum& value_set, bool match,
+                     std::unique_ptr<SetLookupKernel>* out);
+
+  Status LookupDictionary(FunctionContext* ctx, const Datum& values, Datum* out);
+
+  std::shared_ptr<DataType> value_type_;
+  std::unique_ptr<UnaryKernel> impl_;
+};
+
 }  // namespace compute
 }  // namespace arrow
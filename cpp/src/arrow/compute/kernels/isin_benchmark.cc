@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/compute/kernels/isin.h"
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+static void IsInBenchmark(benchmark::State& state, const std::shared_ptr<Array>& values,
+                          const std::shared_ptr<Array>& value_set) {
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(IsIn(&ctx, values, value_set, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+// The value set has set_size values drawn from [min, max]
+static void IsInInt64(benchmark::State& state, int64_t set_size, int64_t min,
+                      int64_t max) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, min, max, args.null_proportion);
+  auto value_set = rand.Int64(set_size, min, max, 0);
+
+  IsInBenchmark(state, values, value_set);
+}
+
+static void IsInInt64SmallRange(benchmark::State& state) {
+  IsInInt64(state, 8, 0, 1000);
+}
+
+static void IsInInt64FewValues(benchmark::State& state) {
+  IsInInt64(state, 8, -1000000000, 1000000000);
+}
+
+static void IsInInt64ManyValues(benchmark::State& state) {
+  IsInInt64(state, 1000, -1000000000, 1000000000);
+}
+
+static void IsInString(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / 8;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.String(array_size, 0, 4, args.null_proportion);
+  auto value_set = rand.String(16, 0, 4, 0);
+
+  IsInBenchmark(state, values, value_set);
+}
+
+BENCHMARK(IsInInt64SmallRange)->Apply(RegressionSetArgs);
+BENCHMARK(IsInInt64FewValues)->Apply(RegressionSetArgs);
+BENCHMARK(IsInInt64ManyValues)->Apply(RegressionSetArgs);
+BENCHMARK(IsInString)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -38,12 +38,18 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace compute {
 
 // ----------------------------------------------------------------------
@@ -159,6 +165,45 @@ TEST_F(TestIsInKernel, IsInNull) {
   CheckIsIn<NullType, std::nullptr_t>(&this->ctx_, null(), {}, {}, {}, {}, {}, {});
 }
 
+TEST_F(TestIsInKernel, IsInDictionary) {
+  auto dict_type = dictionary(int32(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b", null, "c"])");
+  std::shared_ptr<Array> values;
+  ASSERT_OK(DictionaryArray::FromArrays(
+      dict_type, ArrayFromJSON(int32(), "[0, 1, null, 2, 3, 1, 0]"), dict, &values));
+
+  Datum out;
+  ASSERT_OK(IsIn(&this->ctx_, values, ArrayFromJSON(utf8(), R"(["b", "c"])"), &out));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(
+      *ArrayFromJSON(boolean(), "[false, true, null, null, true, true, false]"),
+      *out.make_array());
+
+  // Null indices and null dictionary entries are both null values
+  ASSERT_OK(IsIn(&this->ctx_, values, ArrayFromJSON(utf8(), R"(["a", null])"), &out));
+  AssertArraysEqual(
+      *ArrayFromJSON(boolean(), "[true, false, true, true, false, false, true]"),
+      *out.make_array());
+
+  ASSERT_OK(Match(&this->ctx_, values, ArrayFromJSON(utf8(), R"(["c", null, "a"])"),
+                  &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, null, 1, 1, 0, null, 2]"),
+                    *out.make_array());
+
+  // Chunked, sharing a dictionary
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 3), values->Slice(3)}, dict_type);
+  ASSERT_OK(IsIn(&this->ctx_, chunked, ArrayFromJSON(utf8(), R"(["b", "c"])"), &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(*out.chunked_array(),
+                     {ArrayFromJSON(boolean(), "[false, true, null]"),
+                      ArrayFromJSON(boolean(), "[null, true, true, false]")});
+
+  // The value type must match
+  ASSERT_RAISES(TypeError,
+                IsIn(&this->ctx_, values, ArrayFromJSON(int32(), "[1]"), &out));
+}
+
 TEST_F(TestIsInKernel, IsInTimeTimestamp) {
   CheckIsIn<Time32Type, int32_t>(
       &this->ctx_, time32(TimeUnit::SECOND), {2, 1, 5, 1}, {true, false, true, true},
@@ -411,5 +456,145 @@ TEST_F(TestIsInKernel, IsInChunkedArrayInvoke) {
   AssertChunkedEqual(*expected_carr, *encoded_out.chunked_array());
 }
 
+// ----------------------------------------------------------------------
+// Value set lookup strategies
+
+void CheckIsInJSON(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                   const std::string& values, const std::string& value_set,
+                   const std::string& expected) {
+  Datum out;
+  ASSERT_OK(IsIn(ctx, ArrayFromJSON(type, values), ArrayFromJSON(type, value_set), &out));
+  std::shared_ptr<Array> result = out.make_array();
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), expected), *result);
+}
+
+TEST_F(TestIsInKernel, SmallRangeIntegers) {
+  // Values below and above the range of the value set
+  CheckIsInJSON(&this->ctx_, int32(), "[-2147483648, -3, -2, 0, 1, 2, 3, 2147483647]",
+                "[-2, 1, 2]", "[false, false, true, false, true, true, false, false]");
+  CheckIsInJSON(&this->ctx_, uint64(), "[0, 999, 1000, 1001, 18446744073709551615]",
+                "[1000, 1001, 5000]", "[false, false, true, true, false]");
+  CheckIsInJSON(&this->ctx_, int64(),
+                "[-9223372036854775808, 0, 9223372036854775807, 1]",
+                "[9223372036854775807, -9223372036854775808]",
+                "[true, false, true, false]");
+  CheckIsInJSON(&this->ctx_, int8(), "[-128, 0, 127, 5]", "[127, -128, 0]",
+                "[true, true, true, false]");
+}
+
+TEST_F(TestIsInKernel, FewValues) {
+  CheckIsInJSON(&this->ctx_, int64(), "[0, 1000000, 2000000, 3000000, null]",
+                "[3000000, 0, null, 0]", "[true, false, false, true, true]");
+  CheckIsInJSON(&this->ctx_, float64(), "[0.0, -0.0, 1.5, NaN, 2.5]", "[-0.0, NaN, 2.5]",
+                "[true, true, false, true, true]");
+  CheckIsInJSON(&this->ctx_, float32(), "[0.0, 1.5, NaN]", "[1.5]",
+                "[false, true, false]");
+}
+
+TEST_F(TestIsInKernel, RandomIntegers) {
+  // Value sets of different sizes and ranges exercise the different strategies
+  auto rand = random::RandomArrayGenerator(0x15151);
+  for (int64_t set_size : {1, 5, 8, 9, 100}) {
+    for (int64_t range : std::vector<int64_t>{10, 10000, 1LL << 40}) {
+      auto value_set = rand.Int64(set_size, -range, range, 0.1);
+      auto values = rand.Int64(500, -range, range, 0.1);
+      Datum out;
+      ASSERT_OK(IsIn(&this->ctx_, values, value_set, &out));
+      std::shared_ptr<Array> result_array = out.make_array();
+      const auto& result = checked_cast<const BooleanArray&>(*result_array);
+      const auto& set_values = checked_cast<const Int64Array&>(*value_set);
+      const auto& in_values = checked_cast<const Int64Array&>(*values);
+      for (int64_t i = 0; i < values->length(); ++i) {
+        bool expected = false;
+        for (int64_t j = 0; j < value_set->length(); ++j) {
+          expected |= in_values.IsNull(i) ? set_values.IsNull(j)
+                                          : set_values.IsValid(j) &&
+                                                in_values.Value(i) == set_values.Value(j);
+        }
+        if (in_values.IsNull(i) && value_set->null_count() == 0) {
+          ASSERT_TRUE(result.IsNull(i));
+        } else {
+          ASSERT_EQ(expected, result.Value(i)) << "at " << i;
+        }
+      }
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// Match tests
+
+void CheckMatch(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                const std::string& values, const std::string& value_set,
+                const std::string& expected) {
+  Datum out;
+  ASSERT_OK(
+      Match(ctx, ArrayFromJSON(type, values), ArrayFromJSON(type, value_set), &out));
+  std::shared_ptr<Array> result = out.make_array();
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(int32(), expected), *result);
+}
+
+TEST_F(TestIsInKernel, Match) {
+  // Direct lookup
+  CheckMatch(&this->ctx_, int32(), "[1, 2, 3, null, 2, 7]", "[2, 1, 2, 7, 1]",
+             "[1, 0, null, null, 0, 3]");
+  CheckMatch(&this->ctx_, int32(), "[1, 2, 3, null]", "[2, null, 1, null]",
+             "[2, 0, null, 1]");
+  // Linear lookup
+  CheckMatch(&this->ctx_, int64(), "[1, 100000, null, 2]", "[null, 100000, 2, 100000]",
+             "[null, 1, 0, 2]");
+  CheckMatch(&this->ctx_, float64(), "[1.5, NaN, 3.0]", "[NaN, 3.0]", "[null, 0, 1]");
+  // Hash lookup
+  CheckMatch(&this->ctx_, int64(), "[90000, 0, 10000, 5]",
+             "[0, 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000]",
+             "[9, 0, 1, null]");
+  CheckMatch(&this->ctx_, utf8(), R"(["b", null, "c", "a"])", R"(["a", "b", "a"])",
+             "[1, null, null, 0]");
+  CheckMatch(&this->ctx_, boolean(), "[true, false, null]", "[null, true]",
+             "[1, null, 0]");
+  CheckMatch(&this->ctx_, null(), "[null, null]", "[]", "[null, null]");
+  CheckMatch(&this->ctx_, null(), "[null, null]", "[null]", "[0, 0]");
+
+  // Empty value set
+  CheckMatch(&this->ctx_, int32(), "[1, null]", "[]", "[null, null]");
+  CheckMatch(&this->ctx_, utf8(), R"(["a", null])", "[]", "[null, null]");
+}
+
+TEST_F(TestIsInKernel, MatchChunkedValueSet) {
+  auto value_set = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[5, 6]"), ArrayFromJSON(int32(), "[null, 7, 5]")});
+  Datum out;
+  ASSERT_OK(Match(&this->ctx_, ArrayFromJSON(int32(), "[7, 5, null, 8]"), value_set,
+                  &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3, 0, 2, null]"), *out.make_array());
+}
+
+TEST_F(TestIsInKernel, SetLookupKernel) {
+  std::unique_ptr<SetLookupKernel> kernel;
+  ASSERT_OK(
+      SetLookupKernel::MakeIsIn(&this->ctx_, ArrayFromJSON(utf8(), R"(["a", "b"])"),
+                                &kernel));
+  ASSERT_TRUE(kernel->out_type()->Equals(*boolean()));
+
+  // The kernel can be reused
+  for (const char* values : {R"(["a", "c"])", R"(["c", null, "b"])"}) {
+    Datum out, expected;
+    ASSERT_OK(kernel->Call(&this->ctx_, ArrayFromJSON(utf8(), values), &out));
+    ASSERT_OK(IsIn(&this->ctx_, ArrayFromJSON(utf8(), values),
+                   ArrayFromJSON(utf8(), R"(["a", "b"])"), &expected));
+    AssertArraysEqual(*expected.make_array(), *out.make_array());
+  }
+
+  Datum out;
+  ASSERT_RAISES(TypeError,
+                kernel->Call(&this->ctx_, ArrayFromJSON(binary(), "[]"), &out));
+
+  std::shared_ptr<Array> lists;
+  ASSERT_OK(MakeArrayOfNull(list(int32()), 1, &lists));
+  ASSERT_RAISES(NotImplemented, SetLookupKernel::MakeMatch(&this->ctx_, lists, &kernel));
+}
+
 }  // namespace compute
 }  // namespace arrow
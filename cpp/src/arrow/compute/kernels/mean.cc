@@ -24,64 +24,25 @@
 namespace arrow {
 namespace compute {
 
-template <typename ArrowType,
-          typename SumType = typename FindAccumulatorType<ArrowType>::Type>
-struct MeanState {
-  using ThisType = MeanState<ArrowType, SumType>;
-
-  ThisType operator+(const ThisType& rhs) const {
-    return ThisType(this->count + rhs.count, this->sum + rhs.sum);
-  }
-
-  ThisType& operator+=(const ThisType& rhs) {
-    this->count += rhs.count;
-    this->sum += rhs.sum;
-
-    return *this;
-  }
-
-  std::shared_ptr<Scalar> Finalize() const {
-    using ScalarType = typename TypeTraits<DoubleType>::ScalarType;
-
-    const bool is_valid = count > 0;
-    const double divisor = static_cast<double>(is_valid ? count : 1UL);
-    const double mean = static_cast<double>(sum) / divisor;
-
-    if (!is_valid) return std::make_shared<ScalarType>();
-    return std::make_shared<ScalarType>(mean);
-  }
-
-  static std::shared_ptr<DataType> out_type() {
-    return TypeTraits<DoubleType>::type_singleton();
-  }
-
-  size_t count = 0;
-  typename SumType::c_type sum = 0;
-};
-
-#define MEAN_AGG_FN_CASE(T)                             \
-  case T::type_id:                                      \
-    return std::static_pointer_cast<AggregateFunction>( \
-        std::make_shared<SumAggregateFunction<T, MeanState<T>>>());
-
-std::shared_ptr<AggregateFunction> MakeMeanAggregateFunction(const DataType& type,
-                                                             FunctionContext* ctx) {
-  switch (type.id()) {
-    MEAN_AGG_FN_CASE(UInt8Type);
-    MEAN_AGG_FN_CASE(Int8Type);
-    MEAN_AGG_FN_CASE(UInt16Type);
-    MEAN_AGG_FN_CASE(Int16Type);
-    MEAN_AGG_FN_CASE(UInt32Type);
-    MEAN_AGG_FN_CASE(Int32Type);
-    MEAN_AGG_FN_CASE(UInt64Type);
-    MEAN_AGG_FN_CASE(Int64Type);
-    MEAN_AGG_FN_CASE(FloatType);
-    MEAN_AGG_FN_CASE(DoubleType);
+std::shared_ptr<AggregateFunction> MakeMeanAggregateFunction(
+    const DataType& type, SimdLevel::type simd_level) {
+  switch (simd_level) {
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+    case SimdLevel::AVX512:
+      return MakeMeanAggregateFunctionAvx512(type);
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+    case SimdLevel::AVX2:
+      return MakeMeanAggregateFunctionAvx2(type);
+#endif
     default:
-      return nullptr;
+      return MakeSumLikeAggregateFunction<MeanState>(type);
   }
+}
 
-#undef MEAN_AGG_FN_CASE
+std::shared_ptr<AggregateFunction> MakeMeanAggregateFunction(const DataType& type,
+                                                            FunctionContext* ctx) {
+  return MakeMeanAggregateFunction(type, GetSimdLevel());
 }
 
 static Status GetMeanKernel(FunctionContext* ctx, const DataType& type,
@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/minmax.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename ArrowType, typename Enable = void>
+struct MinMaxState {};
+
+template <typename ArrowType>
+struct MinMaxState<ArrowType, enable_if_integer<ArrowType>> {
+  using ThisType = MinMaxState<ArrowType>;
+  using c_type = typename ArrowType::c_type;
+
+  ThisType& operator+=(const ThisType& rhs) {
+    this->min = std::min(this->min, rhs.min);
+    this->max = std::max(this->max, rhs.max);
+    return *this;
+  }
+
+  void MergeOne(c_type value) {
+    this->min = std::min(this->min, value);
+    this->max = std::max(this->max, value);
+  }
+
+  c_type min = std::numeric_limits<c_type>::max();
+  c_type max = std::numeric_limits<c_type>::min();
+};
+
+template <typename ArrowType>
+struct MinMaxState<ArrowType, enable_if_floating_point<ArrowType>> {
+  using ThisType = MinMaxState<ArrowType>;
+  using c_type = typename ArrowType::c_type;
+
+  ThisType& operator+=(const ThisType& rhs) {
+    this->min = std::fmin(this->min, rhs.min);
+    this->max = std::fmax(this->max, rhs.max);
+    return *this;
+  }
+
+  void MergeOne(c_type value) {
+    this->min = std::fmin(this->min, value);
+    this->max = std::fmax(this->max, value);
+  }
+
+  c_type min = std::numeric_limits<c_type>::infinity();
+  c_type max = -std::numeric_limits<c_type>::infinity();
+};
+
+/// \brief Min and max of blocks of (at most 64) values
+///
+/// See SumBlock.  ScanMasked() is specialized with explicit SIMD code for some
+/// types in aggregate_avx2.cc and aggregate_avx512.cc.
+template <SimdLevel::type SIMD_LEVEL, typename CType>
+struct MinMaxBlock {
+  static constexpr int kLanes = 8;
+
+  // Written as selections, which vectorize to min/max or blend instructions.
+  // A NaN value compares false and is ignored, like with std::fmin/fmax.
+  static CType Min(CType a, CType b) { return b < a ? b : a; }
+  static CType Max(CType a, CType b) { return b > a ? b : a; }
+
+  static void Scan(const CType* values, int64_t length, CType* min, CType* max) {
+    CType min_lanes[kLanes], max_lanes[kLanes];
+    std::fill(min_lanes, min_lanes + kLanes, *min);
+    std::fill(max_lanes, max_lanes + kLanes, *max);
+    int64_t i = 0;
+    for (; i + kLanes <= length; i += kLanes) {
+      for (int j = 0; j < kLanes; ++j) {
+        min_lanes[j] = Min(min_lanes[j], values[i + j]);
+        max_lanes[j] = Max(max_lanes[j], values[i + j]);
+      }
+    }
+    for (; i < length; ++i) {
+      min_lanes[0] = Min(min_lanes[0], values[i]);
+      max_lanes[0] = Max(max_lanes[0], values[i]);
+    }
+    ReduceLanes(min_lanes, max_lanes, min, max);
+  }
+
+  // Null slots are replaced with the identity of min (resp. max)
+  static void ScanMasked(const CType* values, int64_t length, uint64_t valid_bits,
+                         CType* min, CType* max) {
+    const CType min_identity = MinIdentity();
+    const CType max_identity = MaxIdentity();
+    CType min_lanes[kLanes], max_lanes[kLanes];
+    std::fill(min_lanes, min_lanes + kLanes, *min);
+    std::fill(max_lanes, max_lanes + kLanes, *max);
+    int64_t i = 0;
+    for (; i + kLanes <= length; i += kLanes) {
+      const auto valid_byte = static_cast<uint8_t>(valid_bits >> i);
+      for (int j = 0; j < kLanes; ++j) {
+        const bool valid = (valid_byte & (1 << j)) != 0;
+        min_lanes[j] = Min(min_lanes[j], valid ? values[i + j] : min_identity);
+        max_lanes[j] = Max(max_lanes[j], valid ? values[i + j] : max_identity);
+      }
+    }
+    for (; i < length; ++i) {
+      if ((valid_bits >> i) & 1) {
+        min_lanes[0] = Min(min_lanes[0], values[i]);
+        max_lanes[0] = Max(max_lanes[0], values[i]);
+      }
+    }
+    ReduceLanes(min_lanes, max_lanes, min, max);
+  }
+
+  static void ReduceLanes(const CType* min_lanes, const CType* max_lanes, CType* min,
+                          CType* max) {
+    for (int j = 0; j < kLanes; ++j) {
+      *min = Min(*min, min_lanes[j]);
+      *max = Max(*max, max_lanes[j]);
+    }
+  }
+
+  static CType MinIdentity() {
+    return std::numeric_limits<CType>::has_infinity
+               ? std::numeric_limits<CType>::infinity()
+               : std::numeric_limits<CType>::max();
+  }
+
+  static CType MaxIdentity() {
+    return std::numeric_limits<CType>::has_infinity
+               ? -std::numeric_limits<CType>::infinity()
+               : std::numeric_limits<CType>::lowest();
+  }
+};
+
+template <typename ArrowType, SimdLevel::type SIMD_LEVEL = SimdLevel::NONE>
+class MinMaxAggregateFunction final
+    : public AggregateFunctionStaticState<MinMaxState<ArrowType>> {
+  using c_type = typename ArrowType::c_type;
+  using Block = MinMaxBlock<SIMD_LEVEL, c_type>;
+
+ public:
+  using StateType = MinMaxState<ArrowType>;
+
+  explicit MinMaxAggregateFunction(const MinMaxOptions& options) : options_(options) {}
+
+  // The validity bitmap is consumed a 64-bit word at a time: blocks without
+  // nulls are scanned as dense ones, blocks without values are skipped.
+  Status Consume(const Array& array, StateType* state) const override {
+    StateType local;
+    const auto values =
+        internal::checked_cast<const typename TypeTraits<ArrowType>::ArrayType&>(array)
+            .raw_values();
+
+    if (array.null_count() == 0) {
+      Block::Scan(values, array.length(), &local.min, &local.max);
+    } else {
+      VisitValidityWords(
+          array.null_bitmap_data(), array.offset(), array.length(),
+          [&](int64_t position, int64_t block_length, uint64_t valid_bits) {
+            const int valid_count = BitUtil::PopCount(valid_bits);
+            if (valid_count == block_length) {
+              Block::Scan(values + position, block_length, &local.min, &local.max);
+            } else if (valid_count > 0) {
+              Block::ScanMasked(values + position, block_length, valid_bits,
+                                &local.min, &local.max);
+            }
+          });
+    }
+    *state = local;
+
+    return Status::OK();
+  }
+
+  Status Merge(const StateType& src, StateType* dst) const override {
+    *dst += src;
+    return Status::OK();
+  }
+
+  Status Finalize(const StateType& src, Datum* output) const override {
+    *output = Datum({Datum(src.min), Datum(src.max)});
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+ private:
+  MinMaxOptions options_;
+};
+
+/// \brief Instantiate MinMaxAggregateFunction for the given type and SIMD level
+template <SimdLevel::type SIMD_LEVEL = SimdLevel::NONE>
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunctionImpl(
+    const DataType& type, const MinMaxOptions& options) {
+#define MINMAX_AGG_FN_CASE(T)                           \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<MinMaxAggregateFunction<T, SIMD_LEVEL>>(options));
+
+  switch (type.id()) {
+    MINMAX_AGG_FN_CASE(UInt8Type);
+    MINMAX_AGG_FN_CASE(Int8Type);
+    MINMAX_AGG_FN_CASE(UInt16Type);
+    MINMAX_AGG_FN_CASE(Int16Type);
+    MINMAX_AGG_FN_CASE(UInt32Type);
+    MINMAX_AGG_FN_CASE(Int32Type);
+    MINMAX_AGG_FN_CASE(UInt64Type);
+    MINMAX_AGG_FN_CASE(Int64Type);
+    MINMAX_AGG_FN_CASE(FloatType);
+    MINMAX_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+
+#undef MINMAX_AGG_FN_CASE
+}
+
+/// \brief Return a Min/Max kernel specialized for the given SIMD level, which
+/// must be supported by the running CPU
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunction(
+    const DataType& type, const MinMaxOptions& options, SimdLevel::type simd_level);
+
+// Defined in translation units compiled with the matching instruction set
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunctionAvx2(
+    const DataType& type, const MinMaxOptions& options);
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunctionAvx512(
+    const DataType& type, const MinMaxOptions& options);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/selection.h"
+
+#include <utility>
+
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/context.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+Status SelectionVector::FromFilter(FunctionContext* ctx, const Array& filter,
+                                   std::shared_ptr<SelectionVector>* out) {
+  if (filter.type_id() != Type::BOOL) {
+    return Status::TypeError("selection filter must be a boolean array, got ",
+                             *filter.type());
+  }
+  const auto& data = *filter.data();
+  const int64_t length = filter.length();
+  std::shared_ptr<Buffer> bitmap;
+  if (filter.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        bitmap, internal::BitmapAnd(ctx->memory_pool(), data.buffers[0]->data(),
+                                    data.offset, data.buffers[1]->data(), data.offset,
+                                    length, 0));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(bitmap, internal::CopyBitmap(ctx->memory_pool(),
+                                                       data.buffers[1]->data(),
+                                                       data.offset, length));
+  }
+  const int64_t num_selected = internal::CountSetBits(bitmap->data(), 0, length);
+
+  out->reset(new SelectionVector(BITMAP, length, num_selected));
+  (*out)->bitmap_ = std::move(bitmap);
+  return Status::OK();
+}
+
+namespace {
+
+template <typename ArrayType>
+Status CheckSelectedIndices(const ArrayType& indices, int64_t length) {
+  const auto* values = indices.raw_values();
+  int64_t previous = -1;
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    const int64_t index = static_cast<int64_t>(values[i]);
+    if (index <= previous || index >= length) {
+      return Status::Invalid("selected indices must be strictly increasing and in [0, ",
+                             length, ")");
+    }
+    previous = index;
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SelectionVector::FromIndices(const std::shared_ptr<Array>& indices,
+                                    int64_t length,
+                                    std::shared_ptr<SelectionVector>* out) {
+  if (indices->null_count() > 0) {
+    return Status::Invalid("selected indices must not be null");
+  }
+  switch (indices->type_id()) {
+    case Type::INT32:
+      RETURN_NOT_OK(
+          CheckSelectedIndices(checked_cast<const Int32Array&>(*indices), length));
+      break;
+    case Type::INT64:
+      RETURN_NOT_OK(
+          CheckSelectedIndices(checked_cast<const Int64Array&>(*indices), length));
+      break;
+    default:
+      return Status::TypeError("selected indices must be int32 or int64, got ",
+                               *indices->type());
+  }
+
+  out->reset(new SelectionVector(INDICES, length, indices->length()));
+  (*out)->indices_ = indices;
+  return Status::OK();
+}
+
+Status SelectionVector::ToIndices(FunctionContext* ctx,
+                                  std::shared_ptr<Array>* out) const {
+  if (kind_ == INDICES && indices_->type_id() == Type::INT64) {
+    *out = indices_;
+    return Status::OK();
+  }
+  TypedBufferBuilder<int64_t> builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.Reserve(num_selected_));
+  VisitSelected([&](int64_t position) { builder.UnsafeAppend(position); });
+  std::shared_ptr<Buffer> values;
+  RETURN_NOT_OK(builder.Finish(&values));
+  *out = std::make_shared<Int64Array>(num_selected_, values);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
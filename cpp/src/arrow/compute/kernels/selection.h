@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+/// \brief The positions selected in arrays of a given length
+///
+/// A selection vector lets kernels (Compare, Add, Sum, Count, Take) operate on
+/// a subset of the rows of their inputs without materializing filtered
+/// arrays: a chain of comparisons narrows the selection, and only the final
+/// operation produces a compacted output.
+///
+/// A selection is represented either as a sorted list of int32 or int64
+/// indices (compact for sparse selections) or as a bitmap.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT SelectionVector {
+ public:
+  enum Kind { INDICES, BITMAP };
+
+  /// \brief Select the positions where a boolean filter is true
+  ///
+  /// Unlike Filter(), null filter slots are not selected.  The selection
+  /// takes the BITMAP representation.
+  static Status FromFilter(FunctionContext* ctx, const Array& filter,
+                           std::shared_ptr<SelectionVector>* out);
+
+  /// \brief Select the positions in an int32 or int64 array of indices
+  ///
+  /// The indices must be non-null, strictly increasing and less than
+  /// `length`.  The selection takes the INDICES representation.
+  static Status FromIndices(const std::shared_ptr<Array>& indices, int64_t length,
+                            std::shared_ptr<SelectionVector>* out);
+
+  Kind kind() const { return kind_; }
+
+  /// \brief The length of the arrays this selection applies to
+  int64_t length() const { return length_; }
+
+  /// \brief The number of selected positions
+  int64_t num_selected() const { return num_selected_; }
+
+  /// \brief The selected indices, for the INDICES representation
+  const std::shared_ptr<Array>& indices() const { return indices_; }
+
+  /// \brief The selection bitmap of `length()` bits, for the BITMAP
+  /// representation
+  const std::shared_ptr<Buffer>& bitmap() const { return bitmap_; }
+
+  /// \brief Return the selected positions as an int64 array
+  Status ToIndices(FunctionContext* ctx, std::shared_ptr<Array>* out) const;
+
+  /// \brief Call `visit(int64_t position)` for each selected position, in
+  /// increasing order
+  template <typename Visitor>
+  void VisitSelected(Visitor&& visit) const {
+    if (kind_ == BITMAP) {
+      VisitBitmap(std::forward<Visitor>(visit));
+    } else if (indices_->type_id() == Type::INT32) {
+      VisitIndices<Int32Array>(std::forward<Visitor>(visit));
+    } else {
+      VisitIndices<Int64Array>(std::forward<Visitor>(visit));
+    }
+  }
+
+ private:
+  SelectionVector(Kind kind, int64_t length, int64_t num_selected)
+      : kind_(kind), length_(length), num_selected_(num_selected) {}
+
+  template <typename Visitor>
+  void VisitBitmap(Visitor&& visit) const {
+    const uint8_t* bitmap = bitmap_->data();
+    int64_t position = 0;
+    for (; position + 64 <= length_; position += 64) {
+      uint64_t word;
+      std::memcpy(&word, bitmap + position / 8, sizeof(word));
+      word = BitUtil::FromLittleEndian(word);
+      while (word != 0) {
+        visit(position + BitUtil::CountTrailingZeros(word));
+        word &= word - 1;
+      }
+    }
+    for (; position < length_; ++position) {
+      if (BitUtil::GetBit(bitmap, position)) {
+        visit(position);
+      }
+    }
+  }
+
+  template <typename ArrayType, typename Visitor>
+  void VisitIndices(Visitor&& visit) const {
+    const auto& indices = internal::checked_cast<const ArrayType&>(*indices_);
+    const auto* values = indices.raw_values();
+    for (int64_t i = 0; i < indices.length(); ++i) {
+      visit(static_cast<int64_t>(values[i]));
+    }
+  }
+
+  Kind kind_;
+  int64_t length_;
+  int64_t num_selected_;
+  std::shared_ptr<Array> indices_;
+  std::shared_ptr<Buffer> bitmap_;
+};
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,190 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/add.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/count.h"
+#include "arrow/compute/kernels/selection.h"
+#include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestSelectionVector : public ComputeFixture, public TestBase {
+ protected:
+  std::vector<int64_t> Selected(const SelectionVector& selection) {
+    std::vector<int64_t> positions;
+    selection.VisitSelected([&](int64_t i) { positions.push_back(i); });
+    EXPECT_EQ(selection.num_selected(), static_cast<int64_t>(positions.size()));
+    return positions;
+  }
+
+  std::shared_ptr<SelectionVector> FromFilter(const std::string& filter_json) {
+    std::shared_ptr<SelectionVector> selection;
+    ARROW_EXPECT_OK(SelectionVector::FromFilter(
+        &this->ctx_, *ArrayFromJSON(boolean(), filter_json), &selection));
+    return selection;
+  }
+};
+
+TEST_F(TestSelectionVector, FromFilter) {
+  auto selection = FromFilter("[true, false, null, true, true]");
+  ASSERT_EQ(SelectionVector::BITMAP, selection->kind());
+  ASSERT_EQ(5, selection->length());
+  ASSERT_EQ(std::vector<int64_t>({0, 3, 4}), Selected(*selection));
+
+  // Longer than a bitmap word, with an offset
+  std::vector<bool> filter(150);
+  std::vector<int64_t> expected;
+  for (int64_t i = 0; i < 150; ++i) {
+    filter[i] = (i % 3 == 0) || (i > 64 && i < 80);
+  }
+  std::shared_ptr<Array> filter_array;
+  ArrayFromVector<BooleanType, bool>(filter, &filter_array);
+  filter_array = filter_array->Slice(5);
+  for (int64_t i = 0; i < filter_array->length(); ++i) {
+    if (filter[i + 5]) expected.push_back(i);
+  }
+  std::shared_ptr<SelectionVector> sliced;
+  ASSERT_OK(SelectionVector::FromFilter(&this->ctx_, *filter_array, &sliced));
+  ASSERT_EQ(expected, Selected(*sliced));
+
+  std::shared_ptr<Array> indices;
+  ASSERT_OK(sliced->ToIndices(&this->ctx_, &indices));
+  std::shared_ptr<Array> expected_indices;
+  ArrayFromVector<Int64Type, int64_t>(expected, &expected_indices);
+  AssertArraysEqual(*expected_indices, *indices);
+
+  ASSERT_RAISES(TypeError, SelectionVector::FromFilter(
+                               &this->ctx_, *ArrayFromJSON(int8(), "[1]"), &sliced));
+}
+
+TEST_F(TestSelectionVector, FromIndices) {
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(
+      SelectionVector::FromIndices(ArrayFromJSON(int32(), "[1, 4, 5]"), 6, &selection));
+  ASSERT_EQ(SelectionVector::INDICES, selection->kind());
+  ASSERT_EQ(std::vector<int64_t>({1, 4, 5}), Selected(*selection));
+
+  ASSERT_RAISES(Invalid, SelectionVector::FromIndices(ArrayFromJSON(int64(), "[1, 1]"),
+                                                      6, &selection));
+  ASSERT_RAISES(Invalid, SelectionVector::FromIndices(ArrayFromJSON(int64(), "[3, 6]"),
+                                                      6, &selection));
+  ASSERT_RAISES(Invalid, SelectionVector::FromIndices(
+                             ArrayFromJSON(int64(), "[0, null]"), 6, &selection));
+  ASSERT_RAISES(TypeError, SelectionVector::FromIndices(ArrayFromJSON(int8(), "[0]"), 6,
+                                                        &selection));
+}
+
+TEST_F(TestSelectionVector, ChainedKernels) {
+  auto x = ArrayFromJSON(int32(), "[5, 1, null, 7, 3, 9, 4]");
+  auto y = ArrayFromJSON(int32(), "[1, 2, 3, null, 5, 6, 7]");
+  auto names = ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", "e", "f", "g"])");
+  auto selection = FromFilter("[true, true, true, true, false, true, true]");
+
+  // x > 2 and x < y
+  std::shared_ptr<SelectionVector> narrowed;
+  ASSERT_OK(Compare(&this->ctx_, Datum(x), Datum(std::make_shared<Int32Scalar>(2)),
+                    CompareOptions(GREATER), *selection, &narrowed));
+  ASSERT_EQ(std::vector<int64_t>({0, 3, 5, 6}), Selected(*narrowed));
+  // The scalar may be on the left hand side
+  ASSERT_OK(Compare(&this->ctx_, Datum(std::make_shared<Int32Scalar>(2)), Datum(x),
+                    CompareOptions(LESS), *selection, &narrowed));
+  ASSERT_EQ(std::vector<int64_t>({0, 3, 5, 6}), Selected(*narrowed));
+  ASSERT_OK(Compare(&this->ctx_, Datum(x), Datum(y), CompareOptions(LESS), *narrowed,
+                    &narrowed));
+  ASSERT_EQ(std::vector<int64_t>({6}), Selected(*narrowed));
+
+  std::shared_ptr<SelectionVector> strings;
+  ASSERT_OK(Compare(&this->ctx_, Datum(names),
+                    Datum(std::make_shared<StringScalar>("c")),
+                    CompareOptions(GREATER_EQUAL), *selection, &strings));
+  ASSERT_EQ(std::vector<int64_t>({2, 3, 5, 6}), Selected(*strings));
+
+  // Dictionary-encoded strings are compared through their dictionary
+  std::shared_ptr<Array> dict_names;
+  ASSERT_OK(DictionaryArray::FromArrays(
+      dictionary(int8(), utf8()), ArrayFromJSON(int8(), "[0, 1, 2, null, 1, 3, 2]"),
+      ArrayFromJSON(utf8(), R"(["a", "e", "c", "f"])"), &dict_names));
+  ASSERT_OK(Compare(&this->ctx_, Datum(dict_names),
+                    Datum(std::make_shared<StringScalar>("c")),
+                    CompareOptions(GREATER_EQUAL), *selection, &strings));
+  ASSERT_EQ(std::vector<int64_t>({1, 2, 5, 6}), Selected(*strings));
+
+  std::shared_ptr<Array> sums;
+  ASSERT_OK(Add(&this->ctx_, *x, *y, *strings, &sums));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[null, null, 15, 11]"), *sums);
+
+  Datum sum;
+  ASSERT_OK(Sum(&this->ctx_, *x, *strings, &sum));
+  ASSERT_EQ(Int64Scalar(20), *sum.scalar());
+  ASSERT_OK(Sum(&this->ctx_, *x, *narrowed, &sum));
+  ASSERT_EQ(Int64Scalar(4), *sum.scalar());
+
+  Datum count;
+  ASSERT_OK(Count(&this->ctx_, CountOptions(CountOptions::COUNT_ALL), *x, *strings,
+                  &count));
+  ASSERT_EQ(Int64Scalar(3), *count.scalar());
+  ASSERT_OK(Count(&this->ctx_, CountOptions(CountOptions::COUNT_NULL), *x, *strings,
+                  &count));
+  ASSERT_EQ(Int64Scalar(1), *count.scalar());
+
+  std::shared_ptr<Array> taken;
+  ASSERT_OK(Take(&this->ctx_, *names, *strings, TakeOptions(), &taken));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["c", "d", "f", "g"])"), *taken);
+  ASSERT_OK(Take(&this->ctx_, *names, *selection, TakeOptions(), &taken));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", "f", "g"])"),
+                    *taken);
+
+  auto batch = RecordBatch::Make(schema({field("x", int32()), field("name", utf8())}),
+                                 7, {x, names});
+  std::shared_ptr<RecordBatch> taken_batch;
+  ASSERT_OK(Take(&this->ctx_, *batch, *narrowed, TakeOptions(), &taken_batch));
+  ASSERT_EQ(1, taken_batch->num_rows());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["g"])"), *taken_batch->column(1));
+}
+
+TEST_F(TestSelectionVector, LengthMismatch) {
+  auto x = ArrayFromJSON(int32(), "[1, 2, 3]");
+  auto selection = FromFilter("[true, false]");
+  std::shared_ptr<SelectionVector> narrowed;
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, Datum(x), Datum(x), CompareOptions(EQUAL),
+                                 *selection, &narrowed));
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, *x, *x, *selection, &out));
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, *x, *selection, TakeOptions(), &out));
+  Datum datum;
+  ASSERT_RAISES(Invalid, Sum(&this->ctx_, *x, *selection, &datum));
+  ASSERT_RAISES(Invalid, Count(&this->ctx_, CountOptions(CountOptions::COUNT_ALL), *x,
+                               *selection, &datum));
+}
+
+}  // namespace compute
+}  // namespace arrow
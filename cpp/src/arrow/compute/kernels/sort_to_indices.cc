@@ -19,13 +19,21 @@
 
 #include <algorithm>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/logical_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 
@@ -33,6 +41,8 @@ class Array;
 
 namespace compute {
 
+using internal::checked_cast;
+
 /// \brief UnaryKernel implementing SortToIndices operation
 class ARROW_EXPORT SortToIndicesKernel : public UnaryKernel {
  protected:
@@ -255,5 +265,346 @@ Status SortToIndices(FunctionContext* ctx, const Array& values,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Multi-column sort
+
+namespace {
+
+// Sorts a range of row indices by a single column.  Each run of rows with
+// equal values (including the run of nulls) is then sorted by the next
+// column, if any.  Comparisons are fully typed; virtual dispatch only happens
+// once per run.
+class ColumnSorter {
+ public:
+  virtual ~ColumnSorter() = default;
+
+  virtual void Sort(uint64_t* indices_begin, uint64_t* indices_end) = 0;
+};
+
+template <typename T>
+using is_sortable_type = std::integral_constant<
+    bool, ((is_number_type<T>::value && !is_half_float_type<T>::value) ||
+           is_boolean_type<T>::value ||
+           (is_temporal_type<T>::value && !is_interval_type<T>::value) ||
+           is_base_binary_type<T>::value ||
+           (is_fixed_size_binary_type<T>::value && !is_decimal_type<T>::value))>;
+
+template <typename ArrowType>
+class TypedColumnSorter : public ColumnSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  TypedColumnSorter(const Array& array, SortKey::Order order,
+                    SortOptions::NullPlacement null_placement, ColumnSorter* next)
+      : array_(checked_cast<const ArrayType&>(array)),
+        order_(order),
+        null_placement_(null_placement),
+        next_(next) {}
+
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end) override {
+    uint64_t* values_begin = indices_begin;
+    uint64_t* values_end = indices_end;
+    if (array_.null_count() > 0) {
+      if (null_placement_ == SortOptions::NULLS_AT_END) {
+        values_end = std::stable_partition(
+            indices_begin, indices_end,
+            [this](uint64_t ind) { return !array_.IsNull(ind); });
+        SortNext(values_end, indices_end);
+      } else {
+        values_begin = std::stable_partition(
+            indices_begin, indices_end,
+            [this](uint64_t ind) { return array_.IsNull(ind); });
+        SortNext(indices_begin, values_begin);
+      }
+    }
+
+    if (order_ == SortKey::ASCENDING) {
+      std::stable_sort(values_begin, values_end, [this](uint64_t left, uint64_t right) {
+        return array_.GetView(left) < array_.GetView(right);
+      });
+    } else {
+      std::stable_sort(values_begin, values_end, [this](uint64_t left, uint64_t right) {
+        return array_.GetView(right) < array_.GetView(left);
+      });
+    }
+
+    if (next_ == nullptr) {
+      return;
+    }
+    // Sort each run of equal values by the next column
+    uint64_t* run_begin = values_begin;
+    for (uint64_t* it = values_begin; it != values_end; ++it) {
+      if (array_.GetView(*it) != array_.GetView(*run_begin)) {
+        SortNext(run_begin, it);
+        run_begin = it;
+      }
+    }
+    SortNext(run_begin, values_end);
+  }
+
+ protected:
+  void SortNext(uint64_t* begin, uint64_t* end) {
+    if (next_ != nullptr && end - begin > 1) {
+      next_->Sort(begin, end);
+    }
+  }
+
+  const ArrayType& array_;
+  const SortKey::Order order_;
+  const SortOptions::NullPlacement null_placement_;
+  ColumnSorter* next_;
+};
+
+struct ColumnSorterFactory {
+  template <typename T>
+  enable_if_t<is_sortable_type<T>::value, Status> Visit(const T&) {
+    out.reset(new TypedColumnSorter<T>(*array, order, null_placement, next));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Sorting of ", type, " arrays");
+  }
+
+  const Array* array;
+  SortKey::Order order;
+  SortOptions::NullPlacement null_placement;
+  ColumnSorter* next;
+  std::unique_ptr<ColumnSorter> out;
+};
+
+Status SortColumnsToIndices(FunctionContext* ctx, int64_t length,
+                            const std::vector<std::shared_ptr<Array>>& columns,
+                            const SortOptions& options,
+                            std::shared_ptr<Array>* offsets) {
+  DCHECK_EQ(columns.size(), options.sort_keys.size());
+  if (columns.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+
+  // Make the sorters, from the least significant to the most significant key
+  std::vector<std::unique_ptr<ColumnSorter>> sorters(columns.size());
+  ColumnSorter* next = nullptr;
+  for (size_t i = columns.size(); i-- > 0;) {
+    ColumnSorterFactory factory{columns[i].get(), options.sort_keys[i].order,
+                                options.null_placement, next, nullptr};
+    RETURN_NOT_OK(VisitTypeInline(*columns[i]->type(), &factory));
+    sorters[i] = std::move(factory.out);
+    next = sorters[i].get();
+  }
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  auto indices_begin = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  auto indices_end = indices_begin + length;
+  std::iota(indices_begin, indices_end, 0);
+  sorters[0]->Sort(indices_begin, indices_end);
+
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets) {
+  std::vector<std::shared_ptr<Array>> columns;
+  for (const auto& key : options.sort_keys) {
+    auto column = batch.GetColumnByName(key.name);
+    if (column == nullptr) {
+      return Status::KeyError("No column named '", key.name, "' in record batch");
+    }
+    columns.push_back(std::move(column));
+  }
+  return SortColumnsToIndices(ctx, batch.num_rows(), columns, options, offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets) {
+  std::vector<std::shared_ptr<Array>> columns;
+  for (const auto& key : options.sort_keys) {
+    auto column = table.GetColumnByName(key.name);
+    if (column == nullptr) {
+      return Status::KeyError("No column named '", key.name, "' in table");
+    }
+    if (column->num_chunks() == 1) {
+      columns.push_back(column->chunk(0));
+    } else if (column->num_chunks() == 0) {
+      // Concatenate() needs at least one array
+      std::shared_ptr<Array> empty;
+      RETURN_NOT_OK(MakeArrayOfNull(ctx->memory_pool(), column->type(), 0, &empty));
+      columns.push_back(std::move(empty));
+    } else {
+      std::shared_ptr<Array> concatenated;
+      RETURN_NOT_OK(Concatenate(column->chunks(), ctx->memory_pool(), &concatenated));
+      columns.push_back(std::move(concatenated));
+    }
+  }
+  return SortColumnsToIndices(ctx, table.num_rows(), columns, options, offsets);
+}
+
+// ----------------------------------------------------------------------
+// Top-K selection
+
+namespace {
+
+// Use heap selection when k is small compared to the number of values, and
+// std::nth_element on the whole index range otherwise
+constexpr int64_t kHeapSelectRatio = 16;
+
+template <typename ArrowType>
+class TopKSelector {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ViewType = decltype(std::declval<ArrayType>().GetView(0));
+
+  struct Entry {
+    ViewType value;
+    uint64_t index;
+  };
+
+ public:
+  TopKSelector(int64_t k, SortKey::Order order) : k_(k), order_(order) {}
+
+  // Writes min(k, length) indices to `out`
+  void Select(const ArrayVector& chunks, int64_t length, uint64_t* out) {
+    if (chunks.size() == 1 && k_ * kHeapSelectRatio >= length) {
+      SelectNth(checked_cast<const ArrayType&>(*chunks[0]), out);
+    } else {
+      SelectHeap(chunks, out);
+    }
+  }
+
+ private:
+  // Ties are broken by index so that the result is the same as a stable sort
+  bool Before(const ViewType& lvalue, uint64_t lindex, const ViewType& rvalue,
+              uint64_t rindex) const {
+    if (order_ == SortKey::ASCENDING) {
+      if (lvalue < rvalue) return true;
+      if (rvalue < lvalue) return false;
+    } else {
+      if (rvalue < lvalue) return true;
+      if (lvalue < rvalue) return false;
+    }
+    return lindex < rindex;
+  }
+
+  void SelectNth(const ArrayType& values, uint64_t* out) {
+    std::vector<uint64_t> indices(values.length());
+    std::iota(indices.begin(), indices.end(), 0);
+    auto nulls_begin = indices.end();
+    if (values.null_count() > 0) {
+      nulls_begin =
+          std::stable_partition(indices.begin(), indices.end(),
+                                [&values](uint64_t ind) { return !values.IsNull(ind); });
+    }
+    auto before = [&values, this](uint64_t left, uint64_t right) {
+      return Before(values.GetView(left), left, values.GetView(right), right);
+    };
+    auto selected_end = indices.begin() + std::min<int64_t>(k_, values.length());
+    if (selected_end < nulls_begin) {
+      std::nth_element(indices.begin(), selected_end, nulls_begin, before);
+      std::sort(indices.begin(), selected_end, before);
+    } else {
+      std::sort(indices.begin(), nulls_begin, before);
+    }
+    std::copy(indices.begin(), selected_end, out);
+  }
+
+  void SelectHeap(const ArrayVector& chunks, uint64_t* out) {
+    // Max-heap of the k best entries seen so far: the top is the worst one
+    auto before = [this](const Entry& left, const Entry& right) {
+      return Before(left.value, left.index, right.value, right.index);
+    };
+    std::vector<Entry> heap;
+    heap.reserve(k_);
+    // Nulls are only output if there are less than k non-null values, and
+    // then in index order
+    std::vector<uint64_t> nulls;
+
+    uint64_t offset = 0;
+    for (const auto& chunk : chunks) {
+      const auto& values = checked_cast<const ArrayType&>(*chunk);
+      for (int64_t i = 0; i < values.length(); ++i) {
+        const uint64_t index = offset + i;
+        if (values.IsNull(i)) {
+          if (static_cast<int64_t>(nulls.size()) < k_) {
+            nulls.push_back(index);
+          }
+        } else if (static_cast<int64_t>(heap.size()) < k_) {
+          heap.push_back(Entry{values.GetView(i), index});
+          std::push_heap(heap.begin(), heap.end(), before);
+        } else if (k_ > 0 && Before(values.GetView(i), index, heap.front().value,
+                                    heap.front().index)) {
+          std::pop_heap(heap.begin(), heap.end(), before);
+          heap.back() = Entry{values.GetView(i), index};
+          std::push_heap(heap.begin(), heap.end(), before);
+        }
+      }
+      offset += values.length();
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), before);
+    for (const auto& entry : heap) {
+      *out++ = entry.index;
+    }
+    const size_t num_nulls = std::min(nulls.size(), k_ - heap.size());
+    std::copy(nulls.begin(), nulls.begin() + num_nulls, out);
+  }
+
+  const int64_t k_;
+  const SortKey::Order order_;
+};
+
+struct TopKVisitor {
+  template <typename T>
+  enable_if_t<is_sortable_type<T>::value, Status> Visit(const T&) {
+    TopKSelector<T>(k, order).Select(*chunks, length, out);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Top-K selection of ", type, " arrays");
+  }
+
+  const ArrayVector* chunks;
+  int64_t length;
+  int64_t k;
+  SortKey::Order order;
+  uint64_t* out;
+};
+
+Status TopKChunksToIndices(FunctionContext* ctx, const DataType& type,
+                           const ArrayVector& chunks, int64_t length, int64_t k,
+                           SortKey::Order order, std::shared_ptr<Array>* offsets) {
+  if (k < 0) {
+    return Status::Invalid("Top-K selection needs a non-negative k, got ", k);
+  }
+  const int64_t out_length = std::min(k, length);
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), out_length * sizeof(uint64_t), &indices_buf));
+  TopKVisitor visitor{&chunks, length, out_length, order,
+                      reinterpret_cast<uint64_t*>(indices_buf->mutable_data())};
+  RETURN_NOT_OK(VisitTypeInline(type, &visitor));
+  *offsets = std::make_shared<UInt64Array>(out_length, indices_buf);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status TopKToIndices(FunctionContext* ctx, const Array& values, int64_t k,
+                     SortKey::Order order, std::shared_ptr<Array>* offsets) {
+  ArrayVector chunks = {MakeArray(values.data())};
+  return TopKChunksToIndices(ctx, *values.type(), chunks, values.length(), k, order,
+                             offsets);
+}
+
+Status TopKToIndices(FunctionContext* ctx, const ChunkedArray& values, int64_t k,
+                     SortKey::Order order, std::shared_ptr<Array>* offsets) {
+  return TopKChunksToIndices(ctx, *values.type(), values.chunks(), values.length(), k,
+                             order, offsets);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
@@ -26,6 +29,9 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
+class RecordBatch;
+class Table;
 
 namespace compute {
 
@@ -47,5 +53,89 @@ ARROW_EXPORT
 Status SortToIndices(FunctionContext* ctx, const Array& values,
                      std::shared_ptr<Array>* offsets);
 
+/// \brief One of the keys of a multi-column sort
+struct ARROW_EXPORT SortKey {
+  enum Order {
+    ASCENDING = 0,
+    DESCENDING,
+  };
+
+  explicit SortKey(std::string name, Order order = ASCENDING)
+      : name(std::move(name)), order(order) {}
+
+  /// Name of the column to sort by
+  std::string name;
+  Order order;
+};
+
+/// \brief Options for sorting the rows of a RecordBatch or Table
+struct ARROW_EXPORT SortOptions {
+  enum NullPlacement {
+    /// Nulls sort after all non-null values, regardless of the order
+    NULLS_AT_END = 0,
+    /// Nulls sort before all non-null values, regardless of the order
+    NULLS_AT_START,
+  };
+
+  explicit SortOptions(std::vector<SortKey> sort_keys = {},
+                       NullPlacement null_placement = NULLS_AT_END)
+      : sort_keys(std::move(sort_keys)), null_placement(null_placement) {}
+
+  /// Columns to sort by, most significant first
+  std::vector<SortKey> sort_keys;
+  NullPlacement null_placement;
+};
+
+/// \brief Returns the indices that would sort the rows of a record batch.
+///
+/// Rows are ordered lexicographically by the sort keys.  The sort is stable:
+/// rows comparing equal on all the keys keep their relative order.
+///
+/// For example given a = [1, 2, 1, null] and b = [3, 4, 5, 6], sorting by
+/// ("a" ascending, "b" descending) will give [2, 0, 1, 3]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch the record batch to sort
+/// \param[in] options the sort keys and null placement
+/// \param[out] offsets indices that would sort the record batch
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort the rows of a table.
+///
+/// Same as the RecordBatch overload.  Chunked sort key columns are
+/// concatenated first.
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices of the k first values in sorted order.
+///
+/// The output is the same as the first k indices of a stable sort of the
+/// values in the given order, with nulls at the end, but is computed by
+/// partial selection in O(N log k) rather than O(N log N).  If k is larger
+/// than the number of values, all indices are returned.
+///
+/// For example given values = [null, 1, 3.3, null, 2, 5.3], k = 3 and
+/// descending order, the output will be [5, 2, 4]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to select from
+/// \param[in] k number of indices to return
+/// \param[in] order whether to select the smallest or the largest values
+/// \param[out] offsets indices of the k first values, in sorted order
+ARROW_EXPORT
+Status TopKToIndices(FunctionContext* ctx, const Array& values, int64_t k,
+                     SortKey::Order order, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices of the k first values in sorted order.
+///
+/// Same as the Array overload.  The returned indices are logical indices
+/// into the chunked array; chunks are not concatenated.
+ARROW_EXPORT
+Status TopKToIndices(FunctionContext* ctx, const ChunkedArray& values, int64_t k,
+                     SortKey::Order order, std::shared_ptr<Array>* offsets);
+
 }  // namespace compute
 }  // namespace arrow
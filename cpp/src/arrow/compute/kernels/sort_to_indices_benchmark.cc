@@ -20,6 +20,7 @@
 #include "arrow/compute/kernels/sort_to_indices.h"
 
 #include "arrow/compute/benchmark_util.h"
+#include "arrow/record_batch.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -60,6 +61,43 @@ static void SortToIndicesInt8(benchmark::State& state) {
   SortToIndicesBenchmark(state, values);
 }
 
+static void SortToIndicesRecordBatch(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  // Sort by a low-cardinality int64 key with many ties, then by a string key
+  const int64_t num_rows = args.size / (sizeof(int64_t) + 8);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto keys = rand.Int64(num_rows, 0, 100, args.null_proportion);
+  auto names = rand.String(num_rows, 0, 16, args.null_proportion);
+  auto batch = RecordBatch::Make(
+      schema({field("key", int64()), field("name", utf8())}), num_rows, {keys, names});
+  SortOptions options({SortKey("key"), SortKey("name", SortKey::DESCENDING)});
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(SortToIndices(&ctx, *batch, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void TopKToIndicesInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.Int64(array_size, -1000000, 1000000, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(TopKToIndices(&ctx, *values, 100, SortKey::DESCENDING, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
 BENCHMARK(SortToIndicesInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -76,5 +114,19 @@ BENCHMARK(SortToIndicesInt8)
     ->Args({1 << 23, 99})
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(TopKToIndicesInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesRecordBatch)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
 }  // namespace compute
 }  // namespace arrow
@@ -23,15 +23,20 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace compute {
 
+using internal::checked_cast;
+
 template <typename ArrowType>
 class TestSortToIndicesKernel : public ComputeFixture, public TestBase {
  private:
@@ -209,5 +214,237 @@ TYPED_TEST(TestSortToIndicesKernelRandom, SortRandomValues) {
   }
 }
 
+// ----------------------------------------------------------------------
+// Multi-column sort
+
+class TestSortToIndicesMultiKey : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortToIndices(const RecordBatch& batch, const SortOptions& options,
+                           const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, batch, options, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+
+  void AssertSortToIndices(const Table& table, const SortOptions& options,
+                           const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, table, options, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+TEST_F(TestSortToIndicesMultiKey, Basics) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", int64())}),
+                                   R"([{"a": 1, "b": 3},
+                                       {"a": 2, "b": 4},
+                                       {"a": 1, "b": 5},
+                                       {"a": null, "b": 6}])");
+  AssertSortToIndices(*batch, SortOptions({SortKey("a"), SortKey("b")}), "[0, 2, 1, 3]");
+  AssertSortToIndices(*batch,
+                      SortOptions({SortKey("a"), SortKey("b", SortKey::DESCENDING)}),
+                      "[2, 0, 1, 3]");
+  AssertSortToIndices(*batch, SortOptions({SortKey("b", SortKey::DESCENDING)}),
+                      "[3, 2, 1, 0]");
+  AssertSortToIndices(*batch,
+                      SortOptions({SortKey("a", SortKey::DESCENDING), SortKey("b")},
+                                  SortOptions::NULLS_AT_START),
+                      "[3, 1, 0, 2]");
+}
+
+TEST_F(TestSortToIndicesMultiKey, NullsAndTies) {
+  // Nulls compare equal to each other and are sorted by the next key;
+  // rows equal on all keys keep their original order
+  auto batch = RecordBatchFromJSON(
+      schema({field("s", utf8()), field("d", float64())}),
+      R"([{"s": "b", "d": null}, {"s": null, "d": 2.5}, {"s": "a", "d": 1.5},
+          {"s": null, "d": 1.5}, {"s": "b", "d": 0.5}, {"s": "a", "d": 1.5},
+          {"s": null, "d": null}])");
+  AssertSortToIndices(*batch, SortOptions({SortKey("s"), SortKey("d")}),
+                      "[2, 5, 4, 0, 3, 1, 6]");
+  AssertSortToIndices(*batch,
+                      SortOptions({SortKey("s", SortKey::DESCENDING), SortKey("d")},
+                                  SortOptions::NULLS_AT_START),
+                      "[6, 3, 1, 0, 4, 2, 5]");
+}
+
+TEST_F(TestSortToIndicesMultiKey, Table) {
+  auto table = TableFromJSON(schema({field("a", uint8()), field("b", utf8())}),
+                             {R"([{"a": 3, "b": "x"}, {"a": 1, "b": "y"}])",
+                              R"([{"a": 3, "b": "w"}, {"a": null, "b": "z"},
+                                  {"a": 1, "b": "v"}])"});
+  AssertSortToIndices(*table, SortOptions({SortKey("a"), SortKey("b")}),
+                      "[4, 1, 2, 0, 3]");
+  AssertSortToIndices(*table,
+                      SortOptions({SortKey("a", SortKey::DESCENDING)},
+                                  SortOptions::NULLS_AT_START),
+                      "[3, 0, 2, 1, 4]");
+}
+
+TEST_F(TestSortToIndicesMultiKey, EmptyTable) {
+  auto schm = schema({field("a", uint8()), field("b", utf8())});
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (const auto& field : schm->fields()) {
+    columns.push_back(std::make_shared<ChunkedArray>(ArrayVector{}, field->type()));
+  }
+  auto table = Table::Make(schm, columns, 0);
+  AssertSortToIndices(*table, SortOptions({SortKey("a"), SortKey("b")}), "[]");
+}
+
+TEST_F(TestSortToIndicesMultiKey, Errors) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("a", int32()), field("l", list(int32()))}), R"([{"a": 1, "l": []}])");
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *batch, SortOptions(), &out));
+  ASSERT_RAISES(KeyError,
+                SortToIndices(&this->ctx_, *batch, SortOptions({SortKey("x")}), &out));
+  ASSERT_RAISES(NotImplemented,
+                SortToIndices(&this->ctx_, *batch, SortOptions({SortKey("l")}), &out));
+}
+
+TEST_F(TestSortToIndicesMultiKey, Random) {
+  random::RandomArrayGenerator rand(0x61549225);
+  const int64_t length = 2000;
+  auto batch = RecordBatch::Make(
+      schema({field("a", int8()), field("b", utf8()), field("c", float64())}), length,
+      {rand.Int8(length, 0, 5, 0.1), rand.String(length, 0, 2, 0.2),
+       rand.Float64(length, -1, 1, 0.1)});
+  const auto& a = checked_cast<const Int8Array&>(*batch->column(0));
+  const auto& b = checked_cast<const StringArray&>(*batch->column(1));
+
+  for (auto null_placement : {SortOptions::NULLS_AT_END, SortOptions::NULLS_AT_START}) {
+    SortOptions options({SortKey("a", SortKey::DESCENDING), SortKey("b")},
+                        null_placement);
+    std::shared_ptr<Array> out;
+    ASSERT_OK(SortToIndices(&this->ctx_, *batch, options, &out));
+    const auto& indices = checked_cast<const UInt64Array&>(*out);
+    ASSERT_EQ(indices.length(), length);
+
+    // Returns -1, 0 or 1 depending on how rows i and j compare on a column
+    auto compare_nulls = [&](const Array& array, int64_t i, int64_t j) {
+      int64_t null_first = (null_placement == SortOptions::NULLS_AT_START) ? -1 : 1;
+      if (array.IsNull(i)) {
+        return array.IsNull(j) ? 0 : null_first;
+      }
+      return array.IsNull(j) ? -null_first : 2;
+    };
+    for (int64_t k = 1; k < length; ++k) {
+      const auto i = static_cast<int64_t>(indices.Value(k - 1));
+      const auto j = static_cast<int64_t>(indices.Value(k));
+      int64_t cmp = compare_nulls(a, i, j);
+      if (cmp == 2) {
+        cmp = (a.Value(i) > a.Value(j)) ? -1 : (a.Value(i) < a.Value(j)) ? 1 : 0;
+      }
+      ASSERT_LE(cmp, 0) << "at " << k;
+      if (cmp < 0) {
+        continue;
+      }
+      cmp = compare_nulls(b, i, j);
+      if (cmp == 2) {
+        cmp = b.GetView(i).compare(b.GetView(j));
+      }
+      ASSERT_LE(cmp, 0) << "at " << k;
+      if (cmp == 0) {
+        // Stable
+        ASSERT_LT(i, j) << "at " << k;
+      }
+    }
+  }
+}
+
+class TestTopKToIndices : public ComputeFixture, public TestBase {
+ protected:
+  void AssertTopK(const std::shared_ptr<DataType>& type, const std::string& values,
+                  int64_t k, SortKey::Order order, const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(
+        TopKToIndices(&this->ctx_, *ArrayFromJSON(type, values), k, order, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+
+  // The result should be the prefix of a full stable sort
+  void AssertSameAsSort(const std::shared_ptr<ChunkedArray>& values, int64_t k,
+                        SortKey::Order order) {
+    auto table = Table::Make(schema({field("a", values->type())}),
+                             std::vector<std::shared_ptr<ChunkedArray>>{values});
+    std::shared_ptr<Array> sorted;
+    ASSERT_OK(SortToIndices(&this->ctx_, *table, SortOptions({SortKey("a", order)}),
+                            &sorted));
+    auto expected = sorted->Slice(0, std::min(k, sorted->length()));
+
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(TopKToIndices(&this->ctx_, *values, k, order, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+
+    if (values->num_chunks() == 1) {
+      ASSERT_OK(TopKToIndices(&this->ctx_, *values->chunk(0), k, order, &actual));
+      AssertArraysEqual(*expected, *actual);
+    }
+  }
+};
+
+TEST_F(TestTopKToIndices, Basics) {
+  AssertTopK(float64(), "[]", 3, SortKey::ASCENDING, "[]");
+  AssertTopK(float64(), "[null, 1, 3.3, null, 2, 5.3]", 3, SortKey::DESCENDING,
+             "[5, 2, 4]");
+  AssertTopK(float64(), "[null, 1, 3.3, null, 2, 5.3]", 3, SortKey::ASCENDING,
+             "[1, 4, 2]");
+  AssertTopK(float64(), "[null, 1, 3.3, null, 2, 5.3]", 0, SortKey::ASCENDING, "[]");
+  // Nulls come last
+  AssertTopK(int32(), "[null, 1, 3, null, 2]", 4, SortKey::DESCENDING, "[2, 4, 1, 0]");
+  AssertTopK(int32(), "[null, 1, 3, null, 2]", 10, SortKey::ASCENDING, "[1, 4, 2, 0, 3]");
+  // Ties are broken by index
+  AssertTopK(int8(), "[2, 1, 2, 1, 2]", 2, SortKey::DESCENDING, "[0, 2]");
+  AssertTopK(utf8(), R"(["b", "a", null, "c", "a"])", 3, SortKey::ASCENDING,
+             "[1, 4, 0]");
+  AssertTopK(utf8(), R"(["b", "a", null, "c", "a"])", 3, SortKey::DESCENDING,
+             "[3, 0, 1]");
+}
+
+TEST_F(TestTopKToIndices, Chunked) {
+  auto values = ChunkedArrayFromJSON(int64(), {"[5, null, 1]", "[]", "[7, 1, null, 6]"});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(TopKToIndices(&this->ctx_, *values, 3, SortKey::DESCENDING, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[3, 6, 0]"), *actual);
+  ASSERT_OK(TopKToIndices(&this->ctx_, *values, 6, SortKey::ASCENDING, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 4, 0, 6, 3, 1]"), *actual);
+  AssertSameAsSort(values, 3, SortKey::ASCENDING);
+}
+
+TEST_F(TestTopKToIndices, Errors) {
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, TopKToIndices(&this->ctx_, *ArrayFromJSON(int32(), "[1]"), -1,
+                                       SortKey::ASCENDING, &out));
+  ASSERT_RAISES(NotImplemented,
+                TopKToIndices(&this->ctx_, *ArrayFromJSON(list(int32()), "[[1]]"), 1,
+                              SortKey::ASCENDING, &out));
+}
+
+TEST_F(TestTopKToIndices, Random) {
+  random::RandomArrayGenerator rand(0x7a3e51);
+  const int64_t length = 3000;
+  std::vector<std::shared_ptr<Array>> arrays = {
+      rand.Int8(length, -10, 10, 0.1), rand.Int64(length, -1000, 1000, 0.01),
+      rand.Float64(length, -1, 1, 0.2), rand.String(length, 0, 3, 0.1)};
+  for (const auto& array : arrays) {
+    for (int64_t k : {1, 10, 100, 1000, 2999, 5000}) {
+      for (auto order : {SortKey::ASCENDING, SortKey::DESCENDING}) {
+        SCOPED_TRACE("type = " + array->type()->ToString() +
+                     ", k = " + std::to_string(k));
+        // Heap selection and nth_element selection
+        AssertSameAsSort(std::make_shared<ChunkedArray>(ArrayVector{array}), k, order);
+        AssertSameAsSort(std::make_shared<ChunkedArray>(ArrayVector{
+                             array->Slice(0, 1000), array->Slice(1000, 1500),
+                             array->Slice(2500)}),
+                         k, order);
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
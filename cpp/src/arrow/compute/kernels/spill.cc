@@ -0,0 +1,814 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/spill.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/batch_hash.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+constexpr int64_t SpillOptions::kDefaultMemoryBudget;
+
+int64_t SpillOptions::DefaultMemoryBudget(MemoryPool* pool) {
+  auto limiting_pool = dynamic_cast<LimitingMemoryPool*>(pool);
+  if (limiting_pool != NULLPTR) {
+    return limiting_pool->limit() / 2;
+  }
+  return 256 * 1024 * 1024;
+}
+
+namespace {
+
+Status ValidateSpillOptions(const SpillOptions& options) {
+  if (options.filesystem == NULLPTR || options.directory.empty()) {
+    return Status::Invalid("Spilling needs a filesystem and a directory");
+  }
+  if (options.batch_size <= 0) {
+    return Status::Invalid("Spill batch size must be positive");
+  }
+  if (options.num_partitions <= 0) {
+    return Status::Invalid("Number of spill partitions must be positive");
+  }
+  return Status::OK();
+}
+
+int64_t GetMemoryBudget(const SpillOptions& options, MemoryPool* pool) {
+  if (options.memory_budget == SpillOptions::kDefaultMemoryBudget) {
+    return SpillOptions::DefaultMemoryBudget(pool);
+  }
+  return options.memory_budget;
+}
+
+// The number of bytes held by the buffers of an array
+int64_t TotalBufferSize(const ArrayData& data) {
+  int64_t total = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != NULLPTR) {
+      total += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    total += TotalBufferSize(*child);
+  }
+  if (data.dictionary != NULLPTR) {
+    total += TotalBufferSize(*data.dictionary->data());
+  }
+  return total;
+}
+
+int64_t TotalBufferSize(const RecordBatch& batch) {
+  int64_t total = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    total += TotalBufferSize(*batch.column_data(i));
+  }
+  return total;
+}
+
+std::string MakeRandomName(int num_chars) {
+  static const char chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  std::random_device gen;
+  std::uniform_int_distribution<int> dist(0, static_cast<int>(sizeof(chars)) - 2);
+  std::string name;
+  for (int i = 0; i < num_chars; ++i) {
+    name += chars[dist(gen)];
+  }
+  return name;
+}
+
+// A directory of spill files, created on first use and deleted on destruction
+class SpillDirectory {
+ public:
+  explicit SpillDirectory(const SpillOptions& options)
+      : filesystem_(options.filesystem), base_dir_(options.directory) {}
+
+  ~SpillDirectory() {
+    if (!path_.empty()) {
+      auto st = filesystem_->DeleteDir(path_);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed to delete spill directory '" << path_
+                           << "': " << st.ToString();
+      }
+    }
+  }
+
+  Result<std::shared_ptr<io::OutputStream>> OpenNewFile(std::string* file_path) {
+    if (path_.empty()) {
+      auto path = base_dir_ + "/arrow-spill-" + MakeRandomName(8);
+      RETURN_NOT_OK(filesystem_->CreateDir(path));
+      path_ = std::move(path);
+    }
+    *file_path = path_ + "/" + std::to_string(num_files_++) + ".arrows";
+    return filesystem_->OpenOutputStream(*file_path);
+  }
+
+  Result<std::shared_ptr<RecordBatchReader>> OpenFile(const std::string& file_path) {
+    ARROW_ASSIGN_OR_RAISE(auto stream, filesystem_->OpenInputStream(file_path));
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(ipc::RecordBatchStreamReader::Open(stream, &reader));
+    return reader;
+  }
+
+ private:
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  std::string base_dir_;
+  std::string path_;
+  int num_files_ = 0;
+};
+
+// An IPC stream file being written
+struct SpillWriter {
+  Status Open(SpillDirectory* directory, const std::shared_ptr<Schema>& schema) {
+    ARROW_ASSIGN_OR_RAISE(sink, directory->OpenNewFile(&path));
+    ARROW_ASSIGN_OR_RAISE(writer, ipc::RecordBatchStreamWriter::Open(sink.get(), schema));
+    return Status::OK();
+  }
+
+  Status Close() {
+    RETURN_NOT_OK(writer->Close());
+    return sink->Close();
+  }
+
+  std::string path;
+  std::shared_ptr<io::OutputStream> sink;
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+};
+
+// ----------------------------------------------------------------------
+// External sort
+
+template <typename T>
+using is_sortable_type = std::integral_constant<
+    bool, ((is_number_type<T>::value && !is_half_float_type<T>::value) ||
+           is_boolean_type<T>::value ||
+           (is_temporal_type<T>::value && !is_interval_type<T>::value) ||
+           is_base_binary_type<T>::value ||
+           (is_fixed_size_binary_type<T>::value && !is_decimal_type<T>::value))>;
+
+// Compares values of a sort key across the batches of different runs, in the
+// same order as SortToIndices
+class KeyComparator {
+ public:
+  virtual ~KeyComparator() = default;
+
+  virtual int Compare(const Array& left, int64_t i, const Array& right,
+                      int64_t j) const = 0;
+};
+
+template <typename ArrowType>
+class TypedKeyComparator : public KeyComparator {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  TypedKeyComparator(SortKey::Order order, SortOptions::NullPlacement null_placement)
+      : order_(order), null_placement_(null_placement) {}
+
+  int Compare(const Array& left, int64_t i, const Array& right,
+              int64_t j) const override {
+    const auto& left_values = checked_cast<const ArrayType&>(left);
+    const auto& right_values = checked_cast<const ArrayType&>(right);
+    const bool left_null = left_values.IsNull(i);
+    const bool right_null = right_values.IsNull(j);
+    if (left_null || right_null) {
+      if (left_null && right_null) {
+        return 0;
+      }
+      // Null placement doesn't depend on the order
+      const int cmp = left_null ? 1 : -1;
+      return null_placement_ == SortOptions::NULLS_AT_END ? cmp : -cmp;
+    }
+    const auto left_view = left_values.GetView(i);
+    const auto right_view = right_values.GetView(j);
+    const int cmp = left_view < right_view ? -1 : (right_view < left_view ? 1 : 0);
+    return order_ == SortKey::ASCENDING ? cmp : -cmp;
+  }
+
+ private:
+  const SortKey::Order order_;
+  const SortOptions::NullPlacement null_placement_;
+};
+
+struct KeyComparatorFactory {
+  template <typename T>
+  enable_if_t<is_sortable_type<T>::value, Status> Visit(const T&) {
+    out.reset(new TypedKeyComparator<T>(order, null_placement));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Sorting of ", type, " arrays");
+  }
+
+  SortKey::Order order;
+  SortOptions::NullPlacement null_placement;
+  std::unique_ptr<KeyComparator> out;
+};
+
+// Streams the k-way merge of sorted runs.  Ties are broken by run index, runs
+// being in input order, which keeps the merge stable.
+class MergingReader : public RecordBatchReader {
+ public:
+  MergingReader(FunctionContext* ctx, std::shared_ptr<Schema> schema,
+                std::vector<int> key_indices,
+                std::vector<std::unique_ptr<KeyComparator>> comparators,
+                int64_t batch_size, std::vector<std::shared_ptr<RecordBatchReader>> runs)
+      : ctx_(ctx),
+        schema_(std::move(schema)),
+        key_indices_(std::move(key_indices)),
+        comparators_(std::move(comparators)),
+        batch_size_(batch_size),
+        runs_(runs.size()) {
+    for (size_t i = 0; i < runs.size(); ++i) {
+      runs_[i].reader = std::move(runs[i]);
+    }
+  }
+
+  Status Init() {
+    for (int i = 0; i < static_cast<int>(runs_.size()); ++i) {
+      RETURN_NOT_OK(LoadNextBatch(&runs_[i]));
+      if (runs_[i].batch != NULLPTR) {
+        PushRun(i);
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (heap_.empty()) {
+      *out = NULLPTR;
+      return Status::OK();
+    }
+
+    // The output rows are taken from the current batches of the runs, seen as
+    // the chunks of a single chunked array
+    std::vector<std::shared_ptr<RecordBatch>> sources;
+    std::vector<int64_t> source_offsets;
+    int64_t sources_length = 0;
+    for (auto& run : runs_) {
+      run.source = -1;
+    }
+
+    std::vector<int64_t> indices;
+    indices.reserve(batch_size_);
+    while (!heap_.empty() && static_cast<int64_t>(indices.size()) < batch_size_) {
+      std::pop_heap(heap_.begin(), heap_.end(), RunGreater{this});
+      const int run_index = heap_.back();
+      heap_.pop_back();
+      Run& run = runs_[run_index];
+
+      if (run.source < 0) {
+        run.source = static_cast<int>(sources.size());
+        sources.push_back(run.batch);
+        source_offsets.push_back(sources_length);
+        sources_length += run.batch->num_rows();
+      }
+      indices.push_back(source_offsets[run.source] + run.row);
+
+      if (++run.row == run.batch->num_rows()) {
+        RETURN_NOT_OK(LoadNextBatch(&run));
+        run.source = -1;
+        if (run.batch == NULLPTR) {
+          continue;
+        }
+      }
+      PushRun(run_index);
+    }
+
+    const auto num_rows = static_cast<int64_t>(indices.size());
+    Int64Array indices_array(num_rows, Buffer::Wrap(indices));
+    std::vector<std::shared_ptr<Array>> columns(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      ArrayVector chunks;
+      for (const auto& source : sources) {
+        chunks.push_back(source->column(i));
+      }
+      ChunkedArray values(std::move(chunks), schema_->field(i)->type());
+      std::shared_ptr<ChunkedArray> taken;
+      RETURN_NOT_OK(Take(ctx_, values, indices_array, TakeOptions(), &taken));
+      if (taken->num_chunks() == 1) {
+        columns[i] = taken->chunk(0);
+      } else {
+        RETURN_NOT_OK(Concatenate(taken->chunks(), ctx_->memory_pool(), &columns[i]));
+      }
+    }
+    *out = RecordBatch::Make(schema_, num_rows, std::move(columns));
+    return Status::OK();
+  }
+
+ private:
+  struct Run {
+    std::shared_ptr<RecordBatchReader> reader;
+    std::shared_ptr<RecordBatch> batch;
+    // The sort key columns of the current batch
+    std::vector<const Array*> keys;
+    int64_t row = 0;
+    // The index of the current batch in the sources of the output batch
+    int source = -1;
+  };
+
+  // Heap ordering, putting the run with the smallest current row on top
+  struct RunGreater {
+    bool operator()(int left, int right) const {
+      const Run& left_run = reader->runs_[left];
+      const Run& right_run = reader->runs_[right];
+      for (size_t k = 0; k < reader->comparators_.size(); ++k) {
+        const int cmp = reader->comparators_[k]->Compare(
+            *left_run.keys[k], left_run.row, *right_run.keys[k], right_run.row);
+        if (cmp != 0) {
+          return cmp > 0;
+        }
+      }
+      return left > right;
+    }
+
+    const MergingReader* reader;
+  };
+
+  // Move to the next non-empty batch of a run, or to its end
+  Status LoadNextBatch(Run* run) {
+    do {
+      RETURN_NOT_OK(run->reader->ReadNext(&run->batch));
+    } while (run->batch != NULLPTR && run->batch->num_rows() == 0);
+    run->row = 0;
+    run->keys.clear();
+    if (run->batch != NULLPTR) {
+      for (int index : key_indices_) {
+        run->keys.push_back(run->batch->column(index).get());
+      }
+    }
+    return Status::OK();
+  }
+
+  void PushRun(int run_index) {
+    heap_.push_back(run_index);
+    std::push_heap(heap_.begin(), heap_.end(), RunGreater{this});
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> key_indices_;
+  std::vector<std::unique_ptr<KeyComparator>> comparators_;
+  int64_t batch_size_;
+  std::vector<Run> runs_;
+  std::vector<int> heap_;
+};
+
+class ExternalSorterImpl : public ExternalSorter {
+ public:
+  ExternalSorterImpl(FunctionContext* ctx, std::shared_ptr<Schema> schema,
+                     const SortOptions& options, const SpillOptions& spill_options)
+      : ctx_(ctx),
+        schema_(std::move(schema)),
+        options_(options),
+        batch_size_(spill_options.batch_size),
+        memory_budget_(GetMemoryBudget(spill_options, ctx->memory_pool())),
+        spill_directory_(spill_options) {}
+
+  Status Init() {
+    if (options_.sort_keys.empty()) {
+      return Status::Invalid("Must specify one or more sort keys");
+    }
+    for (const auto& key : options_.sort_keys) {
+      const int index = schema_->GetFieldIndex(key.name);
+      if (index < 0) {
+        return Status::KeyError("No column named '", key.name, "' in schema");
+      }
+      // Check the key type is sortable upfront
+      KeyComparatorFactory factory{key.order, options_.null_placement, NULLPTR};
+      RETURN_NOT_OK(VisitTypeInline(*schema_->field(index)->type(), &factory));
+      key_indices_.push_back(index);
+    }
+    return Status::OK();
+  }
+
+  Status Consume(const std::shared_ptr<RecordBatch>& batch) override {
+    if (!batch->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Record batch schema does not match the sorter schema");
+    }
+    if (batch->num_rows() == 0) {
+      return Status::OK();
+    }
+    buffered_.push_back(batch);
+    buffered_bytes_ += TotalBufferSize(*batch);
+    // Sorting the run makes a copy of it
+    if (buffered_bytes_ * 2 >= memory_budget_) {
+      return SpillRun();
+    }
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<RecordBatchReader>* out) override {
+    std::vector<std::shared_ptr<RecordBatchReader>> runs;
+    for (const auto& path : run_paths_) {
+      ARROW_ASSIGN_OR_RAISE(auto reader, spill_directory_.OpenFile(path));
+      runs.push_back(std::move(reader));
+    }
+    if (!buffered_.empty()) {
+      // The last run is merged from memory
+      std::shared_ptr<RecordBatchReader> reader;
+      RETURN_NOT_OK(SortBuffered(&reader));
+      runs.push_back(std::move(reader));
+    }
+
+    if (runs.empty()) {
+      return MakeRecordBatchReader({}, schema_, out);
+    }
+    if (runs.size() == 1) {
+      *out = std::move(runs[0]);
+      return Status::OK();
+    }
+
+    std::vector<std::unique_ptr<KeyComparator>> comparators;
+    for (size_t i = 0; i < key_indices_.size(); ++i) {
+      KeyComparatorFactory factory{options_.sort_keys[i].order, options_.null_placement,
+                                   NULLPTR};
+      RETURN_NOT_OK(
+          VisitTypeInline(*schema_->field(key_indices_[i])->type(), &factory));
+      comparators.push_back(std::move(factory.out));
+    }
+    std::shared_ptr<MergingReader> reader(
+        new MergingReader(ctx_, schema_, key_indices_, std::move(comparators),
+                          batch_size_, std::move(runs)));
+    RETURN_NOT_OK(reader->Init());
+    *out = std::move(reader);
+    return Status::OK();
+  }
+
+  int num_spilled_runs() const override { return static_cast<int>(run_paths_.size()); }
+
+ private:
+  // Sort the buffered rows, returning them as batches of at most batch_size_ rows
+  Status SortBuffered(std::shared_ptr<RecordBatchReader>* out) {
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(Table::FromRecordBatches(schema_, buffered_, &table));
+    buffered_.clear();
+    buffered_bytes_ = 0;
+
+    std::shared_ptr<Array> indices;
+    RETURN_NOT_OK(SortToIndices(ctx_, *table, options_, &indices));
+    std::shared_ptr<Table> sorted;
+    RETURN_NOT_OK(Take(ctx_, *table, *indices, TakeOptions(), &sorted));
+    table.reset();
+
+    TableBatchReader table_reader(*sorted);
+    table_reader.set_chunksize(batch_size_);
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    RETURN_NOT_OK(table_reader.ReadAll(&batches));
+    return MakeRecordBatchReader(batches, schema_, out);
+  }
+
+  Status SpillRun() {
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(SortBuffered(&reader));
+
+    SpillWriter writer;
+    RETURN_NOT_OK(writer.Open(&spill_directory_, schema_));
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == NULLPTR) {
+        break;
+      }
+      RETURN_NOT_OK(writer.writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer.Close());
+    run_paths_.push_back(writer.path);
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  SortOptions options_;
+  int64_t batch_size_;
+  int64_t memory_budget_;
+  SpillDirectory spill_directory_;
+  std::vector<int> key_indices_;
+
+  std::vector<std::shared_ptr<RecordBatch>> buffered_;
+  int64_t buffered_bytes_ = 0;
+  std::vector<std::string> run_paths_;
+};
+
+// ----------------------------------------------------------------------
+// External grouped aggregation
+
+ArrayVector GetColumns(const RecordBatch& batch, int begin, int end) {
+  ArrayVector columns;
+  for (int i = begin; i < end; ++i) {
+    columns.push_back(batch.column(i));
+  }
+  return columns;
+}
+
+// A rough size of the state of one aggregate for one group, which isn't
+// allocated from the memory pool
+constexpr int64_t kAggregateStateBytes = 16;
+
+// The mean of a group, from its sum and count
+template <typename SumArrayType>
+Status ComputeMeans(MemoryPool* pool, const SumArrayType& sums, const Int64Array& counts,
+                    std::shared_ptr<Array>* out) {
+  DoubleBuilder builder(pool);
+  RETURN_NOT_OK(builder.Reserve(sums.length()));
+  for (int64_t i = 0; i < sums.length(); ++i) {
+    if (sums.IsValid(i) && counts.Value(i) > 0) {
+      builder.UnsafeAppend(static_cast<double>(sums.Value(i)) /
+                           static_cast<double>(counts.Value(i)));
+    } else {
+      builder.UnsafeAppendNull();
+    }
+  }
+  return builder.Finish(out);
+}
+
+class ExternalGroupByAggregatorImpl : public ExternalGroupByAggregator {
+ public:
+  ExternalGroupByAggregatorImpl(FunctionContext* ctx,
+                                const std::vector<std::shared_ptr<DataType>>& key_types,
+                                const std::vector<std::shared_ptr<DataType>>& value_types,
+                                const std::vector<GroupByAggregate>& aggregates,
+                                const SpillOptions& spill_options)
+      : ctx_(ctx),
+        key_types_(key_types),
+        value_types_(value_types),
+        aggregates_(aggregates),
+        num_partitions_(spill_options.num_partitions),
+        memory_budget_(GetMemoryBudget(spill_options, ctx->memory_pool())),
+        spill_directory_(spill_options) {}
+
+  Status Init() {
+    // Every aggregate is computed from partial aggregates which can be
+    // aggregated again: a mean from a sum and a count, a count from the sum
+    // of the partial counts
+    for (const auto& aggregate : aggregates_) {
+      first_partials_.push_back(static_cast<int>(partial_aggregates_.size()));
+      switch (aggregate.kind) {
+        case GroupByAggregate::MEAN:
+          partial_aggregates_.emplace_back(GroupByAggregate::SUM, aggregate.value_index);
+          partial_aggregates_.emplace_back(GroupByAggregate::COUNT,
+                                           aggregate.value_index);
+          break;
+        default:
+          partial_aggregates_.push_back(aggregate);
+          break;
+      }
+    }
+    for (size_t i = 0; i < partial_aggregates_.size(); ++i) {
+      const auto kind = partial_aggregates_[i].kind;
+      const auto combine_kind = kind == GroupByAggregate::COUNT ? GroupByAggregate::SUM
+                                                                : kind;
+      combine_aggregates_.emplace_back(combine_kind, static_cast<int>(i));
+    }
+    return ResetAggregator();
+  }
+
+  Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                 const std::vector<std::shared_ptr<Array>>& values) override {
+    RETURN_NOT_OK(aggregator_->Consume(keys, values));
+    const int64_t pool_bytes = ctx_->memory_pool()->bytes_allocated() - baseline_bytes_;
+    const int64_t state_bytes = aggregator_->num_groups() * kAggregateStateBytes *
+                                static_cast<int64_t>(partial_aggregates_.size());
+    if (pool_bytes + state_bytes >= memory_budget_) {
+      return Spill();
+    }
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<StructArray>* out) override {
+    if (partitions_.empty()) {
+      std::shared_ptr<StructArray> partials;
+      RETURN_NOT_OK(aggregator_->Finish(&partials));
+      return FinishPartials(*partials, out);
+    }
+
+    if (aggregator_->num_groups() > 0) {
+      RETURN_NOT_OK(Spill());
+    }
+    aggregator_.reset();
+    for (auto& partition : partitions_) {
+      RETURN_NOT_OK(partition.Close());
+    }
+
+    // Aggregate each partition again, one at a time
+    const auto num_keys = static_cast<int>(key_types_.size());
+    std::vector<std::shared_ptr<DataType>> partial_types;
+    for (int i = num_keys; i < partials_schema_->num_fields(); ++i) {
+      partial_types.push_back(partials_schema_->field(i)->type());
+    }
+    ArrayVector results;
+    for (const auto& partition : partitions_) {
+      std::unique_ptr<GroupByAggregator> combiner;
+      RETURN_NOT_OK(GroupByAggregator::Make(ctx_, key_types_, partial_types,
+                                            combine_aggregates_, &combiner));
+      ARROW_ASSIGN_OR_RAISE(auto reader, spill_directory_.OpenFile(partition.path));
+      std::shared_ptr<RecordBatch> batch;
+      while (true) {
+        RETURN_NOT_OK(reader->ReadNext(&batch));
+        if (batch == NULLPTR) {
+          break;
+        }
+        const int num_columns = batch->num_columns();
+        RETURN_NOT_OK(combiner->Consume(GetColumns(*batch, 0, num_keys),
+                                        GetColumns(*batch, num_keys, num_columns)));
+      }
+      std::shared_ptr<StructArray> partials, result;
+      RETURN_NOT_OK(combiner->Finish(&partials));
+      RETURN_NOT_OK(FinishPartials(*partials, &result));
+      results.push_back(std::move(result));
+    }
+
+    std::shared_ptr<Array> result;
+    RETURN_NOT_OK(Concatenate(results, ctx_->memory_pool(), &result));
+    *out = std::static_pointer_cast<StructArray>(result);
+    return Status::OK();
+  }
+
+  int num_spills() const override { return num_spills_; }
+
+ private:
+  Status ResetAggregator() {
+    aggregator_.reset();
+    RETURN_NOT_OK(GroupByAggregator::Make(ctx_, key_types_, value_types_,
+                                          partial_aggregates_, &aggregator_));
+    baseline_bytes_ = ctx_->memory_pool()->bytes_allocated();
+    return Status::OK();
+  }
+
+  // Write the partial aggregates to the partition files of their keys
+  Status Spill() {
+    std::shared_ptr<StructArray> partials;
+    RETURN_NOT_OK(aggregator_->Finish(&partials));
+    RETURN_NOT_OK(ResetAggregator());
+
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(RecordBatch::FromStructArray(partials, &batch));
+    if (partitions_.empty()) {
+      partials_schema_ = batch->schema();
+      partitions_.resize(num_partitions_);
+      for (auto& partition : partitions_) {
+        RETURN_NOT_OK(partition.Open(&spill_directory_, partials_schema_));
+      }
+    }
+
+    const auto num_keys = static_cast<int>(key_types_.size());
+    std::shared_ptr<Array> hashes;
+    RETURN_NOT_OK(HashRows(ctx_, GetColumns(*batch, 0, num_keys), &hashes));
+    const uint64_t* hash_values = checked_cast<const UInt64Array&>(*hashes).raw_values();
+    std::vector<std::vector<int64_t>> partition_rows(num_partitions_);
+    for (int64_t i = 0; i < batch->num_rows(); ++i) {
+      partition_rows[hash_values[i] % num_partitions_].push_back(i);
+    }
+
+    for (int p = 0; p < num_partitions_; ++p) {
+      const auto& rows = partition_rows[p];
+      if (rows.empty()) {
+        continue;
+      }
+      Int64Array indices(static_cast<int64_t>(rows.size()), Buffer::Wrap(rows));
+      std::shared_ptr<RecordBatch> partition_batch;
+      RETURN_NOT_OK(Take(ctx_, *batch, indices, TakeOptions(), &partition_batch));
+      RETURN_NOT_OK(partitions_[p].writer->WriteRecordBatch(*partition_batch));
+    }
+    ++num_spills_;
+    return Status::OK();
+  }
+
+  // Compute the requested aggregates from the partial ones
+  Status FinishPartials(const StructArray& partials, std::shared_ptr<StructArray>* out) {
+    const auto num_keys = static_cast<int>(key_types_.size());
+    ArrayVector columns;
+    std::vector<std::string> names;
+    for (int i = 0; i < num_keys; ++i) {
+      columns.push_back(partials.field(i));
+      names.push_back("key_" + std::to_string(i));
+    }
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      const auto partial = partials.field(num_keys + first_partials_[i]);
+      if (aggregates_[i].kind == GroupByAggregate::MEAN) {
+        const auto& counts = checked_cast<const Int64Array&>(
+            *partials.field(num_keys + first_partials_[i] + 1));
+        std::shared_ptr<Array> means;
+        switch (partial->type_id()) {
+          case Type::INT64:
+            RETURN_NOT_OK(ComputeMeans(ctx_->memory_pool(),
+                                       checked_cast<const Int64Array&>(*partial), counts,
+                                       &means));
+            break;
+          case Type::UINT64:
+            RETURN_NOT_OK(ComputeMeans(ctx_->memory_pool(),
+                                       checked_cast<const UInt64Array&>(*partial),
+                                       counts, &means));
+            break;
+          default:
+            DCHECK_EQ(partial->type_id(), Type::DOUBLE);
+            RETURN_NOT_OK(ComputeMeans(ctx_->memory_pool(),
+                                       checked_cast<const DoubleArray&>(*partial),
+                                       counts, &means));
+            break;
+        }
+        columns.push_back(std::move(means));
+      } else {
+        columns.push_back(partial);
+      }
+      names.push_back(aggregates_[i].name());
+    }
+    return StructArray::Make(columns, names).Value(out);
+  }
+
+  FunctionContext* ctx_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::vector<std::shared_ptr<DataType>> value_types_;
+  std::vector<GroupByAggregate> aggregates_;
+  // The partial aggregates, computed on the input
+  std::vector<GroupByAggregate> partial_aggregates_;
+  // The index of the first partial aggregate of each aggregate
+  std::vector<int> first_partials_;
+  // The aggregates combining the partial aggregates of the same group
+  std::vector<GroupByAggregate> combine_aggregates_;
+  int num_partitions_;
+  int64_t memory_budget_;
+  SpillDirectory spill_directory_;
+
+  std::unique_ptr<GroupByAggregator> aggregator_;
+  // The bytes allocated from the memory pool when the aggregator was created
+  int64_t baseline_bytes_ = 0;
+
+  std::shared_ptr<Schema> partials_schema_;
+  std::vector<SpillWriter> partitions_;
+  int num_spills_ = 0;
+};
+
+}  // namespace
+
+Status ExternalSorter::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                            const SortOptions& options, const SpillOptions& spill_options,
+                            std::unique_ptr<ExternalSorter>* out) {
+  RETURN_NOT_OK(ValidateSpillOptions(spill_options));
+  std::unique_ptr<ExternalSorterImpl> impl(
+      new ExternalSorterImpl(ctx, schema, options, spill_options));
+  RETURN_NOT_OK(impl->Init());
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+Status ExternalGroupByAggregator::Make(
+    FunctionContext* ctx, const std::vector<std::shared_ptr<DataType>>& key_types,
+    const std::vector<std::shared_ptr<DataType>>& value_types,
+    const std::vector<GroupByAggregate>& aggregates, const SpillOptions& spill_options,
+    std::unique_ptr<ExternalGroupByAggregator>* out) {
+  RETURN_NOT_OK(ValidateSpillOptions(spill_options));
+  std::unique_ptr<ExternalGroupByAggregatorImpl> impl(new ExternalGroupByAggregatorImpl(
+      ctx, key_types, value_types, aggregates, spill_options));
+  RETURN_NOT_OK(impl->Init());
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
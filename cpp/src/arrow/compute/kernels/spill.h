@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Out-of-core sort and grouped aggregation.
+//
+// Inputs larger than a memory budget are processed in bounded runs which are
+// spilled as Arrow IPC streams through the FileSystem API, then merged.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class MemoryPool;
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
+class StructArray;
+
+namespace fs {
+class FileSystem;
+}  // namespace fs
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Options for spilling intermediate data to a filesystem
+struct ARROW_EXPORT SpillOptions {
+  static constexpr int64_t kDefaultMemoryBudget = -1;
+
+  /// The filesystem spill files are written to
+  std::shared_ptr<fs::FileSystem> filesystem;
+
+  /// The directory spill files are written under.  Each operation creates a
+  /// uniquely named subdirectory, removed when the operation is destroyed.
+  std::string directory;
+
+  /// The number of bytes an operation may use before spilling, or
+  /// kDefaultMemoryBudget to derive it from the context's memory pool (see
+  /// DefaultMemoryBudget)
+  int64_t memory_budget = kDefaultMemoryBudget;
+
+  /// The maximum number of rows of the record batches written and produced
+  int64_t batch_size = 64 * 1024;
+
+  /// The number of partitions ExternalGroupByAggregator spills to
+  int num_partitions = 16;
+
+  /// \brief The budget used when memory_budget is kDefaultMemoryBudget
+  ///
+  /// Half the limit of a LimitingMemoryPool, leaving room for the output, or
+  /// 256 MiB for other pools.
+  static int64_t DefaultMemoryBudget(MemoryPool* pool);
+};
+
+/// \brief Sort record batches larger than memory
+///
+/// Consumed batches are buffered until they reach half the memory budget
+/// (sorting a run makes a copy of it).  The buffered rows are then sorted
+/// with SortToIndices and spilled as a run.  Finish() merges the spilled runs
+/// and the last, in-memory run in a streaming k-way merge.
+///
+/// The sort is stable, as SortToIndices.  A sorter is not thread-safe.
+class ARROW_EXPORT ExternalSorter {
+ public:
+  virtual ~ExternalSorter() = default;
+
+  /// \brief Create an external sorter
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] schema the schema of the consumed batches
+  /// \param[in] options the sort keys and null placement
+  /// \param[in] spill_options where and when to spill
+  /// \param[out] out the created sorter
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                     const SortOptions& options, const SpillOptions& spill_options,
+                     std::unique_ptr<ExternalSorter>* out);
+
+  /// \brief Add a batch to the rows to sort
+  virtual Status Consume(const std::shared_ptr<RecordBatch>& batch) = 0;
+
+  /// \brief Return a reader of all the consumed rows, in sorted order
+  ///
+  /// The reader yields batches of at most SpillOptions::batch_size rows.  It
+  /// reads the spill files, so it must not outlive the sorter.
+  virtual Status Finish(std::shared_ptr<RecordBatchReader>* out) = 0;
+
+  /// \brief Number of runs spilled so far
+  virtual int num_spilled_runs() const = 0;
+};
+
+/// \brief Grouped aggregation of inputs with more groups than fit in memory
+///
+/// Batches are aggregated in memory with a GroupByAggregator.  When its
+/// memory use (the bytes allocated from the context's memory pool, plus an
+/// estimate of the aggregate states) reaches the budget, the partial
+/// aggregates are hash-partitioned on their keys and spilled, and aggregation
+/// restarts from scratch.  Finish() then re-aggregates each partition in turn,
+/// so that only the groups of one partition are in memory at a time.
+///
+/// The result is the same as GroupBy's, except that groups are emitted in
+/// order of first appearance within each partition once spilling happened,
+/// and that floating-point sums and means may differ in rounding.  An
+/// aggregator is not thread-safe.
+class ARROW_EXPORT ExternalGroupByAggregator {
+ public:
+  virtual ~ExternalGroupByAggregator() = default;
+
+  /// \brief Create an external grouped aggregator
+  ///
+  /// See GroupByAggregator::Make for the parameters.
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     const std::vector<std::shared_ptr<DataType>>& value_types,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     const SpillOptions& spill_options,
+                     std::unique_ptr<ExternalGroupByAggregator>* out);
+
+  /// \brief Update group states with one batch of equal-length columns
+  virtual Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                         const std::vector<std::shared_ptr<Array>>& values) = 0;
+
+  /// \brief Emit one row per group, see GroupByAggregator::Finish
+  virtual Status Finish(std::shared_ptr<StructArray>* out) = 0;
+
+  /// \brief Number of times the partial aggregates were spilled so far
+  virtual int num_spills() const = 0;
+};
+
+}  // namespace compute
+}  // namespace arrow
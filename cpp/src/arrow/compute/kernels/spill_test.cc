@@ -0,0 +1,234 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/spill.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestSpill : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    filesystem_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+    ASSERT_OK(filesystem_->CreateDir("spill"));
+    spill_options_.filesystem = filesystem_;
+    spill_options_.directory = "spill";
+  }
+
+  // Assert the spill directory was cleaned up
+  void AssertNoSpillFiles() {
+    fs::FileSelector selector;
+    selector.base_dir = "spill";
+    selector.recursive = true;
+    ASSERT_OK_AND_ASSIGN(auto stats, filesystem_->GetTargetStats(selector));
+    ASSERT_EQ(stats.size(), 0);
+  }
+
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  SpillOptions spill_options_;
+};
+
+class TestExternalSorter : public TestSpill {
+ protected:
+  void SetUp() override {
+    TestSpill::SetUp();
+    random::RandomArrayGenerator rand(0x5eed);
+    schema_ = schema({field("a", int16()), field("b", utf8()), field("id", int64())});
+    int64_t id = 0;
+    for (int i = 0; i < 20; ++i) {
+      const int64_t length = 100 + i;
+      std::vector<int64_t> ids(length);
+      std::iota(ids.begin(), ids.end(), id);
+      id += length;
+      std::shared_ptr<Array> id_array;
+      ArrayFromVector<Int64Type>(ids, &id_array);
+      batches_.push_back(RecordBatch::Make(
+          schema_, length,
+          {rand.Int16(length, 0, 10, 0.1), rand.String(length, 0, 2, 0.1), id_array}));
+    }
+  }
+
+  void CheckSort(const SortOptions& options, int expected_min_runs,
+                 int expected_max_runs) {
+    std::shared_ptr<Table> expected;
+    {
+      std::shared_ptr<Table> table;
+      ASSERT_OK(Table::FromRecordBatches(schema_, batches_, &table));
+      std::shared_ptr<Array> indices;
+      ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &indices));
+      ASSERT_OK(Take(&this->ctx_, *table, *indices, TakeOptions(), &expected));
+    }
+
+    {
+      std::unique_ptr<ExternalSorter> sorter;
+      ASSERT_OK(
+          ExternalSorter::Make(&this->ctx_, schema_, options, spill_options_, &sorter));
+      for (const auto& batch : batches_) {
+        ASSERT_OK(sorter->Consume(batch));
+      }
+      ASSERT_GE(sorter->num_spilled_runs(), expected_min_runs);
+      ASSERT_LE(sorter->num_spilled_runs(), expected_max_runs);
+
+      std::shared_ptr<RecordBatchReader> reader;
+      ASSERT_OK(sorter->Finish(&reader));
+      std::vector<std::shared_ptr<RecordBatch>> sorted_batches;
+      ASSERT_OK(reader->ReadAll(&sorted_batches));
+      for (const auto& batch : sorted_batches) {
+        ASSERT_OK(batch->ValidateFull());
+        ASSERT_LE(batch->num_rows(), spill_options_.batch_size);
+      }
+      std::shared_ptr<Table> sorted;
+      ASSERT_OK(Table::FromRecordBatches(schema_, sorted_batches, &sorted));
+      AssertTablesEqual(*expected, *sorted, /*same_chunk_layout=*/false);
+    }
+    AssertNoSpillFiles();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+};
+
+TEST_F(TestExternalSorter, InMemory) {
+  spill_options_.memory_budget = 1 << 30;
+  CheckSort(SortOptions({SortKey("a"), SortKey("b", SortKey::DESCENDING)}), 0, 0);
+}
+
+TEST_F(TestExternalSorter, SpillEveryBatch) {
+  spill_options_.memory_budget = 0;
+  spill_options_.batch_size = 37;
+  CheckSort(SortOptions({SortKey("a"), SortKey("b", SortKey::DESCENDING)}), 20, 20);
+  CheckSort(SortOptions({SortKey("b"), SortKey("a", SortKey::DESCENDING)},
+                        SortOptions::NULLS_AT_START),
+            20, 20);
+}
+
+TEST_F(TestExternalSorter, SpillSomeBatches) {
+  // A few batches per run, plus a last run merged from memory
+  spill_options_.memory_budget = 8000;
+  CheckSort(SortOptions({SortKey("a", SortKey::DESCENDING)}), 2, 19);
+}
+
+TEST_F(TestExternalSorter, Errors) {
+  std::unique_ptr<ExternalSorter> sorter;
+  ASSERT_RAISES(Invalid, ExternalSorter::Make(&this->ctx_, schema_,
+                                              SortOptions({SortKey("a")}),
+                                              SpillOptions(), &sorter));
+  ASSERT_RAISES(KeyError, ExternalSorter::Make(&this->ctx_, schema_,
+                                               SortOptions({SortKey("x")}),
+                                               spill_options_, &sorter));
+
+  ASSERT_OK(ExternalSorter::Make(&this->ctx_, schema_, SortOptions({SortKey("a")}),
+                                 spill_options_, &sorter));
+  auto other = RecordBatchFromJSON(schema({field("a", int16())}), R"([{"a": 1}])");
+  ASSERT_RAISES(Invalid, sorter->Consume(other));
+}
+
+class TestExternalGroupBy : public TestSpill {
+ protected:
+  // Sort the result of a group-by on its first key, for comparisons
+  std::shared_ptr<Array> SortByKey(const std::shared_ptr<StructArray>& result) {
+    std::shared_ptr<RecordBatch> batch;
+    ABORT_NOT_OK(RecordBatch::FromStructArray(result, &batch));
+    std::shared_ptr<Array> indices, sorted;
+    ABORT_NOT_OK(SortToIndices(&this->ctx_, *batch->column(0), &indices));
+    ABORT_NOT_OK(Take(&this->ctx_, *result, *indices, TakeOptions(), &sorted));
+    return sorted;
+  }
+};
+
+TEST_F(TestExternalGroupBy, SpillPartitions) {
+  random::RandomArrayGenerator rand(0x6b0f);
+  std::vector<GroupByAggregate> aggregates = {{GroupByAggregate::SUM, 0},
+                                              {GroupByAggregate::COUNT, 0},
+                                              {GroupByAggregate::MIN, 0},
+                                              {GroupByAggregate::MAX, 1},
+                                              {GroupByAggregate::MEAN, 0}};
+  ArrayVector keys, values0, values1;
+  for (int i = 0; i < 10; ++i) {
+    keys.push_back(rand.Int64(500, 0, 2000, 0.01));
+    values0.push_back(rand.Int32(500, -100, 100, 0.2));
+    values1.push_back(rand.Float64(500, -1, 1, 0.2));
+  }
+
+  std::shared_ptr<Array> all_keys, all_values0, all_values1;
+  ASSERT_OK(Concatenate(keys, default_memory_pool(), &all_keys));
+  ASSERT_OK(Concatenate(values0, default_memory_pool(), &all_values0));
+  ASSERT_OK(Concatenate(values1, default_memory_pool(), &all_values1));
+  std::shared_ptr<StructArray> expected;
+  ASSERT_OK(GroupBy(&this->ctx_, {all_keys}, {all_values0, all_values1}, aggregates,
+                    &expected));
+
+  spill_options_.memory_budget = 0;
+  spill_options_.num_partitions = 4;
+  {
+    std::unique_ptr<ExternalGroupByAggregator> aggregator;
+    ASSERT_OK(ExternalGroupByAggregator::Make(&this->ctx_, {int64()},
+                                              {int32(), float64()}, aggregates,
+                                              spill_options_, &aggregator));
+    for (size_t i = 0; i < keys.size(); ++i) {
+      ASSERT_OK(aggregator->Consume({keys[i]}, {values0[i], values1[i]}));
+    }
+    ASSERT_EQ(aggregator->num_spills(), 10);
+
+    std::shared_ptr<StructArray> result;
+    ASSERT_OK(aggregator->Finish(&result));
+    ASSERT_OK(result->ValidateFull());
+    ASSERT_EQ(result->length(), expected->length());
+    AssertArraysEqual(*SortByKey(expected), *SortByKey(result), /*verbose=*/true);
+  }
+  AssertNoSpillFiles();
+}
+
+TEST_F(TestExternalGroupBy, InMemory) {
+  auto keys = ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "b", "a", null])");
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3, 4, null, 6, null]");
+  std::vector<GroupByAggregate> aggregates = {{GroupByAggregate::COUNT, 0},
+                                              {GroupByAggregate::MEAN, 0}};
+
+  std::unique_ptr<ExternalGroupByAggregator> aggregator;
+  ASSERT_OK(ExternalGroupByAggregator::Make(&this->ctx_, {utf8()}, {int32()},
+                                            aggregates, spill_options_, &aggregator));
+  ASSERT_OK(aggregator->Consume({keys}, {values}));
+  ASSERT_EQ(aggregator->num_spills(), 0);
+
+  std::shared_ptr<StructArray> result, expected;
+  ASSERT_OK(aggregator->Finish(&result));
+  ASSERT_OK(GroupBy(&this->ctx_, {keys}, {values}, aggregates, &expected));
+  AssertArraysEqual(*expected, *result);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,546 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/string.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/utf8.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Case conversion
+
+// A table mapping the code points below 0x800, i.e. those of at most two
+// bytes in UTF8, to their lower or upper case.  Only the mappings between
+// two-byte code points are included, so that conversions keep the byte
+// length of strings.
+std::vector<uint16_t> MakeCaseTable(bool upper) {
+  std::vector<uint16_t> table(0x800);
+  for (uint32_t cp = 0; cp < 0x800; ++cp) {
+    table[cp] = static_cast<uint16_t>(cp);
+  }
+  auto map = [&](uint32_t upper_cp, uint32_t lower_cp) {
+    if (upper) {
+      table[lower_cp] = static_cast<uint16_t>(upper_cp);
+    } else {
+      table[upper_cp] = static_cast<uint16_t>(lower_cp);
+    }
+  };
+  // Latin-1 Supplement
+  for (uint32_t cp = 0xc0; cp <= 0xde; ++cp) {
+    if (cp != 0xd7) map(cp, cp + 0x20);
+  }
+  map(0x178, 0xff);
+  // Latin Extended-A, whose pairs alternate between even and odd code points
+  for (uint32_t cp = 0x100; cp <= 0x137; cp += 2) {
+    if (cp != 0x130) map(cp, cp + 1);
+  }
+  for (uint32_t cp = 0x139; cp <= 0x148; cp += 2) map(cp, cp + 1);
+  for (uint32_t cp = 0x14a; cp <= 0x177; cp += 2) map(cp, cp + 1);
+  for (uint32_t cp = 0x179; cp <= 0x17e; cp += 2) map(cp, cp + 1);
+  // Greek, where the final sigma only has an upper case
+  for (uint32_t cp = 0x391; cp <= 0x3ab; ++cp) {
+    if (cp != 0x3a2) map(cp, cp + 0x20);
+  }
+  if (upper) table[0x3c2] = 0x3a3;
+  // Cyrillic
+  for (uint32_t cp = 0x400; cp <= 0x40f; ++cp) map(cp, cp + 0x50);
+  for (uint32_t cp = 0x410; cp <= 0x42f; ++cp) map(cp, cp + 0x20);
+  return table;
+}
+
+template <bool kUpper>
+const uint16_t* CaseTable() {
+  static const std::vector<uint16_t> table = MakeCaseTable(kUpper);
+  return table.data();
+}
+
+template <bool kUpper>
+inline uint8_t ConvertAsciiCase(uint8_t c) {
+  constexpr uint8_t kFirst = kUpper ? 'a' : 'A';
+  constexpr uint8_t kLast = kUpper ? 'z' : 'Z';
+  return (c >= kFirst && c <= kLast) ? static_cast<uint8_t>(c ^ 0x20) : c;
+}
+
+// Convert the letters of eight ASCII bytes at once.  Adding to each byte sets
+// its high bit if it is at least the first letter (resp. above the last
+// letter); as the bytes are ASCII, the additions never carry into the next
+// byte.  The letters then get their case bit 0x20 flipped.
+template <bool kUpper>
+inline uint64_t ConvertAsciiCase(uint64_t word) {
+  constexpr uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr uint64_t kFirst = kUpper ? 'a' : 'A';
+  constexpr uint64_t kLast = kUpper ? 'z' : 'Z';
+  const uint64_t at_least_first = word + kOnes * (0x80 - kFirst);
+  const uint64_t above_last = word + kOnes * (0x7f - kLast);
+  const uint64_t is_letter = at_least_first & ~above_last & (kOnes * 0x80);
+  return word ^ (is_letter >> 2);
+}
+
+// Convert the case of `size` bytes of valid UTF8 data
+template <bool kUpper>
+void ConvertCase(const uint8_t* in, int64_t size, uint8_t* out) {
+  static constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+  const uint16_t* table = CaseTable<kUpper>();
+  int64_t i = 0;
+  while (i < size) {
+    if (i + 8 <= size) {
+      uint64_t word;
+      memcpy(&word, in + i, 8);
+      if ((word & kHighBits) == 0) {
+        word = ConvertAsciiCase<kUpper>(word);
+        memcpy(out + i, &word, 8);
+        i += 8;
+        continue;
+      }
+    }
+    // Convert a single code point, then go back to the ASCII fast path
+    const uint8_t c = in[i];
+    if (c < 0x80) {
+      out[i] = ConvertAsciiCase<kUpper>(c);
+      ++i;
+    } else if ((c & 0xe0) == 0xc0 && i + 1 < size) {
+      const uint32_t cp = (static_cast<uint32_t>(c & 0x1f) << 6) | (in[i + 1] & 0x3f);
+      const uint32_t converted = table[cp];
+      out[i] = static_cast<uint8_t>(0xc0 | (converted >> 6));
+      out[i + 1] = static_cast<uint8_t>(0x80 | (converted & 0x3f));
+      i += 2;
+    } else {
+      // Bytes of longer code points are copied as is
+      out[i] = c;
+      ++i;
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// Kernels
+
+class StringKernel : public UnaryKernel {
+ public:
+  explicit StringKernel(std::shared_ptr<DataType> out_type)
+      : out_type_(std::move(out_type)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+  bool parallelizable() const override { return true; }
+
+ protected:
+  std::shared_ptr<DataType> out_type_;
+};
+
+// The offsets and character data of a binary-like array
+template <typename offset_type>
+struct StringSlots {
+  explicit StringSlots(const ArrayData& data)
+      : length(data.length),
+        offsets(data.length > 0 ? data.GetValues<offset_type>(1) : &kZeroOffset),
+        chars(data.buffers.size() > 2 && data.buffers[2] ? data.buffers[2]->data()
+                                                         : NULLPTR) {}
+
+  int64_t begin(int64_t i) const { return static_cast<int64_t>(offsets[i]); }
+  int64_t end(int64_t i) const { return static_cast<int64_t>(offsets[i + 1]); }
+
+  const uint8_t* data(int64_t i) const { return chars + offsets[i]; }
+  int64_t size(int64_t i) const { return end(i) - begin(i); }
+
+  // The bytes spanned by all the strings
+  const uint8_t* all_data() const { return chars + offsets[0]; }
+  int64_t all_size() const { return length > 0 ? end(length - 1) - begin(0) : 0; }
+
+  static constexpr offset_type kZeroOffset = 0;
+
+  int64_t length;
+  const offset_type* offsets;
+  const uint8_t* chars;
+};
+
+template <typename offset_type>
+constexpr offset_type StringSlots<offset_type>::kZeroOffset;
+
+// Make the offsets of the output of a kernel that preserves string sizes,
+// reusing the input offsets if possible
+template <typename offset_type>
+Status MakeSameOffsets(FunctionContext* ctx, const ArrayData& input,
+                       const StringSlots<offset_type>& slots,
+                       std::shared_ptr<Buffer>* out) {
+  if (input.length > 0 && input.offset == 0 && slots.offsets[0] == 0) {
+    *out = input.buffers[1];
+    return Status::OK();
+  }
+  RETURN_NOT_OK(ctx->Allocate((input.length + 1) * sizeof(offset_type), out));
+  auto out_offsets = reinterpret_cast<offset_type*>((*out)->mutable_data());
+  const offset_type first = slots.offsets[0];
+  for (int64_t i = 0; i <= input.length; ++i) {
+    out_offsets[i] = static_cast<offset_type>(slots.offsets[i] - first);
+  }
+  return Status::OK();
+}
+
+template <typename offset_type, bool kUpper>
+class CaseKernel : public StringKernel {
+ public:
+  using StringKernel::StringKernel;
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    const StringSlots<offset_type> slots(in_data);
+
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    result->buffers.resize(3);
+    RETURN_NOT_OK(MakeSameOffsets(ctx, in_data, slots, &result->buffers[1]));
+
+    // The strings are contiguous, so they are all converted in one pass
+    const int64_t size = slots.all_size();
+    RETURN_NOT_OK(ctx->Allocate(size, &result->buffers[2]));
+    if (size > 0) {
+      ConvertCase<kUpper>(slots.all_data(), size, result->buffers[2]->mutable_data());
+    }
+    return Status::OK();
+  }
+};
+
+template <typename offset_type>
+using LowerKernel = CaseKernel<offset_type, false>;
+
+template <typename offset_type>
+using UpperKernel = CaseKernel<offset_type, true>;
+
+template <typename offset_type>
+class LengthKernel : public StringKernel {
+ public:
+  using StringKernel::StringKernel;
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    const StringSlots<offset_type> slots(in_data);
+
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    auto lengths = result->GetMutableValues<offset_type>(1);
+    if (util::IsAscii(slots.all_data(), slots.all_size())) {
+      // Code points are bytes
+      for (int64_t i = 0; i < slots.length; ++i) {
+        lengths[i] = slots.offsets[i + 1] - slots.offsets[i];
+      }
+    } else {
+      for (int64_t i = 0; i < slots.length; ++i) {
+        lengths[i] =
+            static_cast<offset_type>(util::UTF8Length(slots.data(i), slots.size(i)));
+      }
+    }
+    return Status::OK();
+  }
+};
+
+template <typename offset_type>
+class SubstringKernel : public StringKernel {
+ public:
+  SubstringKernel(std::shared_ptr<DataType> out_type, const SubstringOptions& options)
+      : StringKernel(std::move(out_type)), options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    const StringSlots<offset_type> slots(in_data);
+
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    result->buffers.resize(3);
+    RETURN_NOT_OK(
+        ctx->Allocate((in_data.length + 1) * sizeof(offset_type), &result->buffers[1]));
+    auto out_offsets = reinterpret_cast<offset_type*>(result->buffers[1]->mutable_data());
+    // The substrings are at most as large as the strings
+    std::shared_ptr<ResizableBuffer> chars;
+    RETURN_NOT_OK(AllocateResizableBuffer(ctx->memory_pool(), slots.all_size(), &chars));
+    uint8_t* out_chars = chars->mutable_data();
+
+    const bool ascii = util::IsAscii(slots.all_data(), slots.all_size());
+    offset_type out_size = 0;
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < slots.length; ++i) {
+      const uint8_t* begin = slots.data(i);
+      const uint8_t* end = begin + slots.size(i);
+      if (ascii) {
+        // Code points are bytes
+        const int64_t size = end - begin;
+        const int64_t start = options_.start >= 0
+                                  ? std::min(options_.start, size)
+                                  : std::max<int64_t>(size + options_.start, 0);
+        begin += start;
+        end = begin + std::min(options_.length, size - start);
+      } else {
+        int64_t start = options_.start;
+        if (start < 0) {
+          start = std::max<int64_t>(util::UTF8Length(begin, end - begin) + start, 0);
+        }
+        begin = util::UTF8Advance(begin, end, start);
+        end = util::UTF8Advance(begin, end, options_.length);
+      }
+      memcpy(out_chars + out_size, begin, end - begin);
+      out_size += static_cast<offset_type>(end - begin);
+      out_offsets[i + 1] = out_size;
+    }
+    RETURN_NOT_OK(chars->Resize(out_size));
+    result->buffers[2] = std::move(chars);
+    return Status::OK();
+  }
+
+ private:
+  SubstringOptions options_;
+};
+
+// Base class for kernels computing a boolean per string
+template <typename offset_type>
+class PredicateKernel : public StringKernel {
+ public:
+  PredicateKernel(const std::shared_ptr<DataType>&, std::string pattern)
+      : StringKernel(boolean()), pattern_(std::move(pattern)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    if (in_data.length > 0) {
+      Compute(StringSlots<offset_type>(in_data), result->buffers[1]->mutable_data());
+    }
+    return Status::OK();
+  }
+
+ protected:
+  // Write the predicate of each string as a bit of `bitmap`
+  virtual void Compute(const StringSlots<offset_type>& slots, uint8_t* bitmap) = 0;
+
+  std::string pattern_;
+};
+
+template <typename offset_type>
+class StartsWithKernel : public PredicateKernel<offset_type> {
+ public:
+  using PredicateKernel<offset_type>::PredicateKernel;
+
+ protected:
+  void Compute(const StringSlots<offset_type>& slots, uint8_t* bitmap) override {
+    const auto pattern = reinterpret_cast<const uint8_t*>(this->pattern_.data());
+    const int64_t pattern_size = static_cast<int64_t>(this->pattern_.size());
+    int64_t i = 0;
+    internal::GenerateBitsUnrolled(bitmap, 0, slots.length, [&]() {
+      const bool match = slots.size(i) >= pattern_size &&
+                         memcmp(slots.data(i), pattern, pattern_size) == 0;
+      ++i;
+      return match;
+    });
+  }
+};
+
+template <typename offset_type>
+class EndsWithKernel : public PredicateKernel<offset_type> {
+ public:
+  using PredicateKernel<offset_type>::PredicateKernel;
+
+ protected:
+  void Compute(const StringSlots<offset_type>& slots, uint8_t* bitmap) override {
+    const auto pattern = reinterpret_cast<const uint8_t*>(this->pattern_.data());
+    const int64_t pattern_size = static_cast<int64_t>(this->pattern_.size());
+    int64_t i = 0;
+    internal::GenerateBitsUnrolled(bitmap, 0, slots.length, [&]() {
+      const int64_t size = slots.size(i);
+      const bool match =
+          size >= pattern_size &&
+          memcmp(slots.data(i) + size - pattern_size, pattern, pattern_size) == 0;
+      ++i;
+      return match;
+    });
+  }
+};
+
+// Find the first occurrence of a non-empty pattern in [data, end), or end
+inline const uint8_t* FindPattern(const uint8_t* data, const uint8_t* end,
+                                  const uint8_t* pattern, int64_t pattern_size) {
+  while (end - data >= pattern_size) {
+    // Look for the first byte, then check the rest
+    const void* candidate = memchr(data, pattern[0], end - data - pattern_size + 1);
+    if (candidate == NULLPTR) {
+      break;
+    }
+    data = static_cast<const uint8_t*>(candidate);
+    if (memcmp(data + 1, pattern + 1, pattern_size - 1) == 0) {
+      return data;
+    }
+    ++data;
+  }
+  return end;
+}
+
+template <typename offset_type>
+class ContainsKernel : public PredicateKernel<offset_type> {
+ public:
+  using PredicateKernel<offset_type>::PredicateKernel;
+
+ protected:
+  // The character data of all the strings is searched at once, and the
+  // matches are then attributed to strings, which is much faster than
+  // searching each (typically short) string separately
+  void Compute(const StringSlots<offset_type>& slots, uint8_t* bitmap) override {
+    const auto pattern = reinterpret_cast<const uint8_t*>(this->pattern_.data());
+    const int64_t pattern_size = static_cast<int64_t>(this->pattern_.size());
+    if (pattern_size == 0) {
+      BitUtil::SetBitsTo(bitmap, 0, slots.length, true);
+      return;
+    }
+    BitUtil::SetBitsTo(bitmap, 0, slots.length, false);
+
+    const uint8_t* end = slots.all_data() + slots.all_size();
+    const uint8_t* data = slots.all_data();
+    int64_t i = 0;
+    while (true) {
+      const uint8_t* match = FindPattern(data, end, pattern, pattern_size);
+      if (match == end) {
+        break;
+      }
+      // Find the string where the match starts, and check that it also ends there
+      const int64_t match_offset = match - slots.chars;
+      while (slots.end(i) <= match_offset) {
+        ++i;
+      }
+      if (match_offset + pattern_size <= slots.end(i)) {
+        BitUtil::SetBit(bitmap, i);
+        data = slots.chars + slots.end(i);
+      } else {
+        data = match + 1;
+      }
+    }
+  }
+};
+
+// Invoke a kernel templated on the offset type of the input
+template <template <typename> class KernelType, typename... Args>
+Status InvokeStringKernel(FunctionContext* ctx, const char* name, bool allow_binary,
+                          const Datum& value, Datum* out, Args&&... args) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("Input Datum was not array-like");
+  }
+  std::unique_ptr<UnaryKernel> kernel;
+  switch (value.type()->id()) {
+    case Type::BINARY:
+      if (!allow_binary) break;
+      // fall through
+    case Type::STRING:
+      kernel.reset(new KernelType<int32_t>(value.type(), std::forward<Args>(args)...));
+      break;
+    case Type::LARGE_BINARY:
+      if (!allow_binary) break;
+      // fall through
+    case Type::LARGE_STRING:
+      kernel.reset(new KernelType<int64_t>(value.type(), std::forward<Args>(args)...));
+      break;
+    default:
+      break;
+  }
+  if (kernel == nullptr) {
+    return Status::NotImplemented(name, " not implemented for ", *value.type());
+  }
+
+  std::vector<Datum> result;
+  if (is_fixed_width(kernel->out_type()->id())) {
+    detail::PrimitiveAllocatingUnaryKernel allocating_kernel(kernel.get());
+    RETURN_NOT_OK(
+        detail::InvokeUnaryArrayKernel(ctx, &allocating_kernel, value, &result));
+  } else {
+    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, kernel.get(), value, &result));
+  }
+  *out = detail::WrapDatumsLike(value, result);
+  return Status::OK();
+}
+
+template <typename offset_type>
+std::shared_ptr<DataType> LengthType() {
+  return sizeof(offset_type) == 4 ? int32() : int64();
+}
+
+template <typename offset_type>
+class Utf8LengthKernel : public LengthKernel<offset_type> {
+ public:
+  explicit Utf8LengthKernel(const std::shared_ptr<DataType>&)
+      : LengthKernel<offset_type>(LengthType<offset_type>()) {}
+};
+
+}  // namespace
+
+Status Utf8Lower(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return InvokeStringKernel<LowerKernel>(ctx, "Utf8Lower", false, value, out);
+}
+
+Status Utf8Upper(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return InvokeStringKernel<UpperKernel>(ctx, "Utf8Upper", false, value, out);
+}
+
+Status Utf8Length(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return InvokeStringKernel<Utf8LengthKernel>(ctx, "Utf8Length", false, value, out);
+}
+
+Status Substring(FunctionContext* ctx, const Datum& value,
+                 const SubstringOptions& options, Datum* out) {
+  if (options.length < 0) {
+    return Status::Invalid("Substring length must be non-negative, got ",
+                           options.length);
+  }
+  return InvokeStringKernel<SubstringKernel>(ctx, "Substring", false, value, out,
+                                             options);
+}
+
+Status ContainsSubstring(FunctionContext* ctx, const Datum& value,
+                         const std::string& pattern, Datum* out) {
+  return InvokeStringKernel<ContainsKernel>(ctx, "ContainsSubstring", true, value, out,
+                                            pattern);
+}
+
+Status StartsWith(FunctionContext* ctx, const Datum& value, const std::string& prefix,
+                  Datum* out) {
+  return InvokeStringKernel<StartsWithKernel>(ctx, "StartsWith", true, value, out,
+                                              prefix);
+}
+
+Status EndsWith(FunctionContext* ctx, const Datum& value, const std::string& suffix,
+                Datum* out) {
+  return InvokeStringKernel<EndsWithKernel>(ctx, "EndsWith", true, value, out, suffix);
+}
+
+}  // namespace compute
+}  // namespace arrow
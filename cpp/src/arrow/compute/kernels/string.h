@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Convert each string of a utf8 datum to lower case
+///
+/// ASCII text is converted a machine word at a time.  Other code points are
+/// converted with the simple case mappings of the Latin-1 Supplement, Latin
+/// Extended-A, Greek and Cyrillic blocks, whose lower and upper cases have the
+/// same length in UTF8; code points of other scripts are left unchanged.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of utf8 or large_utf8 type
+/// \param[out] out resulting datum, of the input type
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Lower(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Convert each string of a utf8 datum to upper case
+///
+/// See Utf8Lower for the supported code points.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of utf8 or large_utf8 type
+/// \param[out] out resulting datum, of the input type
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Upper(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the number of code points of each string of a utf8 datum
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of utf8 or large_utf8 type
+/// \param[out] out resulting datum, of int32 type for utf8 input and int64
+/// type for large_utf8 input
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Length(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Options for Substring
+struct ARROW_EXPORT SubstringOptions {
+  explicit SubstringOptions(int64_t start = 0,
+                            int64_t length = std::numeric_limits<int64_t>::max())
+      : start(start), length(length) {}
+
+  /// The index of the first code point of the substrings, negative values
+  /// count from the end of each string
+  int64_t start;
+  /// The maximum number of code points of the substrings
+  int64_t length;
+};
+
+/// \brief Extract a substring of each string of a utf8 datum
+///
+/// Positions and lengths are counted in code points.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of utf8 or large_utf8 type
+/// \param[in] options the position and length of the substrings
+/// \param[out] out resulting datum, of the input type
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Substring(FunctionContext* context, const Datum& value,
+                 const SubstringOptions& options, Datum* out);
+
+/// \brief Compute whether each string of a datum contains a literal pattern
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of binary, utf8 or their large type
+/// \param[in] pattern the bytes to look for
+/// \param[out] out resulting boolean datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ContainsSubstring(FunctionContext* context, const Datum& value,
+                         const std::string& pattern, Datum* out);
+
+/// \brief Compute whether each string of a datum starts with a literal prefix
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of binary, utf8 or their large type
+/// \param[in] prefix the bytes to look for
+/// \param[out] out resulting boolean datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status StartsWith(FunctionContext* context, const Datum& value, const std::string& prefix,
+                  Datum* out);
+
+/// \brief Compute whether each string of a datum ends with a literal suffix
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of binary, utf8 or their large type
+/// \param[in] suffix the bytes to look for
+/// \param[out] out resulting boolean datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status EndsWith(FunctionContext* context, const Datum& value, const std::string& suffix,
+                Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
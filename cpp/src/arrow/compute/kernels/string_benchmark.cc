@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <functional>
+#include <string>
+
+#include "arrow/compute/kernels/string.h"
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+static void StringBenchmark(
+    benchmark::State& state,
+    const std::function<Status(FunctionContext*, const Datum&, Datum*)>& func) {
+  RegressionArgs args(state);
+
+  const int32_t string_mean_length = 32;
+  const int64_t array_size = args.size / string_mean_length;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.String(array_size, 0, string_mean_length * 2, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(func(&ctx, values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * args.size);
+}
+
+static void Utf8LowerAscii(benchmark::State& state) { StringBenchmark(state, Utf8Lower); }
+
+static void Utf8LengthAscii(benchmark::State& state) {
+  StringBenchmark(state, Utf8Length);
+}
+
+static void SubstringAscii(benchmark::State& state) {
+  StringBenchmark(state, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return Substring(ctx, value, SubstringOptions(2, 8), out);
+  });
+}
+
+static void ContainsSubstringAscii(benchmark::State& state) {
+  StringBenchmark(state, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return ContainsSubstring(ctx, value, "abc", out);
+  });
+}
+
+static void StartsWithAscii(benchmark::State& state) {
+  StringBenchmark(state, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return StartsWith(ctx, value, "ab", out);
+  });
+}
+
+BENCHMARK(Utf8LowerAscii)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8LengthAscii)->Apply(RegressionSetArgs);
+BENCHMARK(SubstringAscii)->Apply(RegressionSetArgs);
+BENCHMARK(ContainsSubstringAscii)->Apply(RegressionSetArgs);
+BENCHMARK(StartsWithAscii)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
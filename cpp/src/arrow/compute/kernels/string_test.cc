@@ -0,0 +1,239 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/string.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+using StringFunction = std::function<Status(FunctionContext*, const Datum&, Datum*)>;
+
+class TestStringKernels : public ComputeFixture, public TestBase {
+ protected:
+  void CheckCase(const StringFunction& func, const std::shared_ptr<DataType>& in_type,
+                 const std::string& in_json, const std::shared_ptr<DataType>& out_type,
+                 const std::string& expected_json) {
+    auto input = ArrayFromJSON(in_type, in_json);
+    auto expected = ArrayFromJSON(out_type, expected_json);
+    CheckCase(func, input, expected);
+    // Check sliced variants
+    if (input->length() > 1) {
+      CheckCase(func, input->Slice(1), expected->Slice(1));
+      CheckCase(func, input->Slice(0, input->length() - 1),
+                expected->Slice(0, input->length() - 1));
+    }
+  }
+
+  void CheckCase(const StringFunction& func, const std::shared_ptr<Array>& input,
+                 const std::shared_ptr<Array>& expected) {
+    Datum out;
+    ASSERT_OK(func(&this->ctx_, input, &out));
+    std::shared_ptr<Array> result = out.make_array();
+    ASSERT_OK(result->ValidateFull());
+    AssertArraysEqual(*expected, *result);
+  }
+
+  // Check a function with utf8 and large_utf8 input, and the same output type
+  void CheckStrings(const StringFunction& func, const std::string& in_json,
+                    const std::string& expected_json) {
+    CheckCase(func, utf8(), in_json, utf8(), expected_json);
+    CheckCase(func, large_utf8(), in_json, large_utf8(), expected_json);
+  }
+
+  // Check a predicate with all binary-like input types
+  void CheckPredicate(const StringFunction& func, const std::string& in_json,
+                      const std::string& expected_json) {
+    for (auto type : {binary(), utf8(), large_binary(), large_utf8()}) {
+      CheckCase(func, type, in_json, boolean(), expected_json);
+    }
+  }
+};
+
+TEST_F(TestStringKernels, LowerUpper) {
+  CheckStrings(Utf8Lower, "[]", "[]");
+  CheckStrings(Utf8Lower, R"(["", null, "aAbB09@[`{", "THE QUICK BROWN FOX", "ß"])",
+               R"(["", null, "aabb09@[`{", "the quick brown fox", "ß"])");
+  CheckStrings(Utf8Upper, R"(["", null, "aAbB09@[`{", "the quick brown fox", "ß"])",
+               R"(["", null, "AABB09@[`{", "THE QUICK BROWN FOX", "ß"])");
+
+  // Non-ASCII code points, between ASCII runs long enough for the fast path
+  CheckStrings(Utf8Lower,
+               R"(["ÀÉÎÕÜ ÿŸ Ā ĹŁ ŹŽ", "ΑΒΓ ΣΩ and ПРИВЕТ ЁЖ", "日本 ABCDEFGHI 語"])",
+               R"(["àéîõü ÿÿ ā ĺł źž", "αβγ σω and привет ёж", "日本 abcdefghi 語"])");
+  CheckStrings(Utf8Upper,
+               R"(["àéîõü ÿŸ ā ĺł źž", "αβγ σως and привет ёж", "日本 abcdefghi 語"])",
+               R"(["ÀÉÎÕÜ ŸŸ Ā ĹŁ ŹŽ", "ΑΒΓ ΣΩΣ AND ПРИВЕТ ЁЖ", "日本 ABCDEFGHI 語"])");
+  // Code points whose cases differ in length are left unchanged
+  CheckStrings(Utf8Lower, R"(["İ"])", R"(["İ"])");
+  CheckStrings(Utf8Upper, R"(["ı", "ſ"])", R"(["ı", "ſ"])");
+}
+
+TEST_F(TestStringKernels, Length) {
+  const char* json = R"(["", "abc", null, "héllo", "日本語", "an ASCII string 🎉"])";
+  const char* expected = "[0, 3, null, 5, 3, 17]";
+  CheckCase(Utf8Length, utf8(), json, int32(), expected);
+  CheckCase(Utf8Length, large_utf8(), json, int64(), expected);
+  CheckCase(Utf8Length, utf8(), R"(["", "abc", null, "abcdefghijk"])", int32(),
+            "[0, 3, null, 11]");
+}
+
+TEST_F(TestStringKernels, Substring) {
+  auto substring = [](int64_t start, int64_t length) {
+    return [=](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return Substring(ctx, value, SubstringOptions(start, length), out);
+    };
+  };
+  const char* ascii = R"(["", null, "a", "abc", "abcdefgh"])";
+  CheckStrings(substring(0, 2), ascii, R"(["", null, "a", "ab", "ab"])");
+  CheckStrings(substring(1, 3), ascii, R"(["", null, "", "bc", "bcd"])");
+  CheckStrings(substring(5, 0), ascii, R"(["", null, "", "", ""])");
+  CheckStrings(substring(-2, 1), ascii, R"(["", null, "a", "b", "g"])");
+  CheckStrings(substring(-10, 4), ascii, R"(["", null, "a", "abc", "abcd"])");
+  auto substring_from_3 = [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return Substring(ctx, value, SubstringOptions(3), out);
+  };
+  CheckStrings(substring_from_3, ascii, R"(["", null, "", "", "defgh"])");
+
+  const char* utf8_json = R"(["", null, "é", "aéb", "日本語テキスト"])";
+  CheckStrings(substring(0, 2), utf8_json, R"(["", null, "é", "aé", "日本"])");
+  CheckStrings(substring(1, 3), utf8_json, R"(["", null, "", "éb", "本語テ"])");
+  CheckStrings(substring(-2, 1), utf8_json, R"(["", null, "é", "é", "ス"])");
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Substring(&this->ctx_, ArrayFromJSON(utf8(), "[]"),
+                                   SubstringOptions(0, -1), &out));
+}
+
+TEST_F(TestStringKernels, StartsEndsWith) {
+  auto starts_with = [](const std::string& prefix) {
+    return [=](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return StartsWith(ctx, value, prefix, out);
+    };
+  };
+  auto ends_with = [](const std::string& suffix) {
+    return [=](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return EndsWith(ctx, value, suffix, out);
+    };
+  };
+  const char* json = R"(["", null, "a", "ab", "ba", "abab", "b"])";
+  CheckPredicate(starts_with("ab"), json,
+                 "[false, null, false, true, false, true, false]");
+  CheckPredicate(ends_with("ab"), json, "[false, null, false, true, false, true, false]");
+  CheckPredicate(starts_with("b"), json,
+                 "[false, null, false, false, true, false, true]");
+  CheckPredicate(ends_with("b"), json, "[false, null, false, true, false, true, true]");
+  CheckPredicate(starts_with(""), json, "[true, null, true, true, true, true, true]");
+}
+
+TEST_F(TestStringKernels, ContainsSubstring) {
+  auto contains = [](const std::string& pattern) {
+    return [=](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return ContainsSubstring(ctx, value, pattern, out);
+    };
+  };
+  // Matches must not straddle strings
+  const char* json = R"(["", null, "ab", "cd", "abcd", "aab", "xyzabc", "ba"])";
+  CheckPredicate(contains("ab"), json,
+                 "[false, null, true, false, true, true, true, false]");
+  CheckPredicate(contains("bc"), json,
+                 "[false, null, false, false, true, false, true, false]");
+  CheckPredicate(contains("a"), json,
+                 "[false, null, true, false, true, true, true, true]");
+  CheckPredicate(contains("abcde"), json,
+                 "[false, null, false, false, false, false, false, false]");
+  CheckPredicate(contains(""), json, "[true, null, true, true, true, true, true, true]");
+  CheckPredicate(contains("日本"), R"(["日本語", "本日", null])", "[true, false, null]");
+}
+
+TEST_F(TestStringKernels, ContainsSubstringRandom) {
+  // Compare with a naive search over random strings of a small alphabet
+  auto rand = random::RandomArrayGenerator(0x51a7);
+  auto lengths = rand.Int32(1000, 0, 12, 0);
+  std::vector<std::string> strings;
+  std::vector<bool> is_valid;
+  int64_t seed = 0;
+  for (int64_t i = 0; i < lengths->length(); ++i) {
+    const int32_t length = checked_cast<const Int32Array&>(*lengths).Value(i);
+    std::string s;
+    for (int32_t j = 0; j < length; ++j) {
+      s.push_back(static_cast<char>('a' + (++seed * 2654435761U >> 7) % 3));
+    }
+    strings.push_back(s);
+    is_valid.push_back(i % 10 != 0);
+  }
+  std::shared_ptr<Array> values;
+  ArrayFromVector<StringType, std::string>(is_valid, strings, &values);
+
+  for (const std::string pattern : {"a", "ab", "cab", "abca"}) {
+    std::vector<bool> expected;
+    for (const auto& s : strings) {
+      expected.push_back(s.find(pattern) != std::string::npos);
+    }
+    std::shared_ptr<Array> expected_array;
+    ArrayFromVector<BooleanType, bool>(is_valid, expected, &expected_array);
+
+    for (int64_t offset : {0, 1, 5}) {
+      Datum out;
+      ASSERT_OK(ContainsSubstring(&this->ctx_, values->Slice(offset), pattern, &out));
+      AssertArraysEqual(*expected_array->Slice(offset), *out.make_array());
+    }
+  }
+}
+
+TEST_F(TestStringKernels, ChunkedArray) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(utf8(), R"(["Ab", null])"),
+                  ArrayFromJSON(utf8(), R"(["cD"])")});
+  Datum out;
+  ASSERT_OK(Utf8Upper(&this->ctx_, chunked, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  ASSERT_EQ(2, out.chunked_array()->num_chunks());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["AB", null])"),
+                    *out.chunked_array()->chunk(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["CD"])"), *out.chunked_array()->chunk(1));
+}
+
+TEST_F(TestStringKernels, Errors) {
+  Datum out;
+  ASSERT_RAISES(NotImplemented,
+                Utf8Lower(&this->ctx_, ArrayFromJSON(binary(), "[]"), &out));
+  ASSERT_RAISES(NotImplemented,
+                Utf8Length(&this->ctx_, ArrayFromJSON(int32(), "[]"), &out));
+  ASSERT_RAISES(NotImplemented,
+                StartsWith(&this->ctx_, ArrayFromJSON(int32(), "[]"), "a", &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -17,69 +17,32 @@
 
 #include <utility>
 
+#include "arrow/compute/kernels/selection.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
 
 namespace arrow {
 namespace compute {
 
-template <typename ArrowType,
-          typename SumType = typename FindAccumulatorType<ArrowType>::Type>
-struct SumState {
-  using ThisType = SumState<ArrowType, SumType>;
-
-  ThisType operator+(const ThisType& rhs) const {
-    return ThisType(this->count + rhs.count, this->sum + rhs.sum);
-  }
-
-  ThisType& operator+=(const ThisType& rhs) {
-    this->count += rhs.count;
-    this->sum += rhs.sum;
-
-    return *this;
-  }
-
-  std::shared_ptr<Scalar> Finalize() const {
-    using ScalarType = typename TypeTraits<SumType>::ScalarType;
-
-    if (count == 0) {
-      return std::make_shared<ScalarType>();
-    }
-
-    return MakeScalar(sum);
-  }
-
-  static std::shared_ptr<DataType> out_type() {
-    return TypeTraits<SumType>::type_singleton();
-  }
-
-  size_t count = 0;
-  typename SumType::c_type sum = 0;
-};
-
-#define SUM_AGG_FN_CASE(T)                              \
-  case T::type_id:                                      \
-    return std::static_pointer_cast<AggregateFunction>( \
-        std::make_shared<SumAggregateFunction<T, SumState<T>>>());
-
 std::shared_ptr<AggregateFunction> MakeSumAggregateFunction(const DataType& type,
-                                                            FunctionContext* ctx) {
-  switch (type.id()) {
-    SUM_AGG_FN_CASE(UInt8Type);
-    SUM_AGG_FN_CASE(Int8Type);
-    SUM_AGG_FN_CASE(UInt16Type);
-    SUM_AGG_FN_CASE(Int16Type);
-    SUM_AGG_FN_CASE(UInt32Type);
-    SUM_AGG_FN_CASE(Int32Type);
-    SUM_AGG_FN_CASE(UInt64Type);
-    SUM_AGG_FN_CASE(Int64Type);
-    SUM_AGG_FN_CASE(FloatType);
-    SUM_AGG_FN_CASE(DoubleType);
+                                                            SimdLevel::type simd_level) {
+  switch (simd_level) {
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+    case SimdLevel::AVX512:
+      return MakeSumAggregateFunctionAvx512(type);
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+    case SimdLevel::AVX2:
+      return MakeSumAggregateFunctionAvx2(type);
+#endif
     default:
-      return nullptr;
+      return MakeSumLikeAggregateFunction<SumState>(type);
   }
+}
 
-#undef SUM_AGG_FN_CASE
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunction(const DataType& type,
+                                                            FunctionContext* ctx) {
+  return MakeSumAggregateFunction(type, GetSimdLevel());
 }
 
 static Status GetSumKernel(FunctionContext* ctx, const DataType& type,
@@ -110,5 +73,49 @@ Status Sum(FunctionContext* ctx, const Array& array, Datum* out) {
   return Sum(ctx, array.data(), out);
 }
 
+template <typename ArrowType>
+static Datum SumSelected(const Array& array, const SelectionVector& selection) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  const auto& values = static_cast<const ArrayType&>(array);
+
+  SumState<ArrowType> state;
+  selection.VisitSelected([&](int64_t i) {
+    if (values.IsValid(i)) {
+      state.sum += values.Value(i);
+      ++state.count;
+    }
+  });
+  return state.Finalize();
+}
+
+Status Sum(FunctionContext* ctx, const Array& array, const SelectionVector& selection,
+           Datum* out) {
+  if (array.length() != selection.length()) {
+    return Status::Invalid("Sum expects an array with the length of the selection");
+  }
+
+#define SUM_SELECTED_CASE(T)                 \
+  case T::type_id:                           \
+    *out = SumSelected<T>(array, selection); \
+    return Status::OK();
+
+  switch (array.type_id()) {
+    SUM_SELECTED_CASE(UInt8Type);
+    SUM_SELECTED_CASE(Int8Type);
+    SUM_SELECTED_CASE(UInt16Type);
+    SUM_SELECTED_CASE(Int16Type);
+    SUM_SELECTED_CASE(UInt32Type);
+    SUM_SELECTED_CASE(Int32Type);
+    SUM_SELECTED_CASE(UInt64Type);
+    SUM_SELECTED_CASE(Int64Type);
+    SUM_SELECTED_CASE(FloatType);
+    SUM_SELECTED_CASE(DoubleType);
+    default:
+      return Status::Invalid("No sum for type ", *array.type());
+  }
+
+#undef SUM_SELECTED_CASE
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -33,6 +33,7 @@ namespace compute {
 struct Datum;
 class FunctionContext;
 class AggregateFunction;
+class SelectionVector;
 
 /// \brief Return a Sum Kernel
 ///
@@ -67,5 +68,18 @@ Status Sum(FunctionContext* context, const Datum& value, Datum* out);
 ARROW_EXPORT
 Status Sum(FunctionContext* context, const Array& array, Datum* out);
 
+/// \brief Sum the values of a numeric array at the selected positions only.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] array to sum
+/// \param[in] selection the positions to sum, with the length of the array
+/// \param[out] out resulting datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Sum(FunctionContext* context, const Array& array, const SelectionVector& selection,
+           Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -22,11 +22,14 @@
 
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow {
 
@@ -54,17 +57,135 @@ struct FindAccumulatorType<I, enable_if_floating_point<I>> {
   using Type = DoubleType;
 };
 
-template <typename ArrowType, typename StateType>
+template <typename ArrowType,
+          typename SumType = typename FindAccumulatorType<ArrowType>::Type>
+struct SumState {
+  using ThisType = SumState<ArrowType, SumType>;
+
+  ThisType operator+(const ThisType& rhs) const {
+    return ThisType(this->count + rhs.count, this->sum + rhs.sum);
+  }
+
+  ThisType& operator+=(const ThisType& rhs) {
+    this->count += rhs.count;
+    this->sum += rhs.sum;
+
+    return *this;
+  }
+
+  std::shared_ptr<Scalar> Finalize() const {
+    using ScalarType = typename TypeTraits<SumType>::ScalarType;
+
+    if (count == 0) {
+      return std::make_shared<ScalarType>();
+    }
+
+    return MakeScalar(sum);
+  }
+
+  static std::shared_ptr<DataType> out_type() {
+    return TypeTraits<SumType>::type_singleton();
+  }
+
+  size_t count = 0;
+  typename SumType::c_type sum = 0;
+};
+
+template <typename ArrowType,
+          typename SumType = typename FindAccumulatorType<ArrowType>::Type>
+struct MeanState {
+  using ThisType = MeanState<ArrowType, SumType>;
+
+  ThisType operator+(const ThisType& rhs) const {
+    return ThisType(this->count + rhs.count, this->sum + rhs.sum);
+  }
+
+  ThisType& operator+=(const ThisType& rhs) {
+    this->count += rhs.count;
+    this->sum += rhs.sum;
+
+    return *this;
+  }
+
+  std::shared_ptr<Scalar> Finalize() const {
+    using ScalarType = typename TypeTraits<DoubleType>::ScalarType;
+
+    const bool is_valid = count > 0;
+    const double divisor = static_cast<double>(is_valid ? count : 1UL);
+    const double mean = static_cast<double>(sum) / divisor;
+
+    if (!is_valid) return std::make_shared<ScalarType>();
+    return std::make_shared<ScalarType>(mean);
+  }
+
+  static std::shared_ptr<DataType> out_type() {
+    return TypeTraits<DoubleType>::type_singleton();
+  }
+
+  size_t count = 0;
+  typename SumType::c_type sum = 0;
+};
+
+/// \brief Sums of blocks of (at most 64) values
+///
+/// Values are summed into independent accumulators, which lets the compiler
+/// vectorize the loops (floating point additions can't be reordered
+/// otherwise).  Masked() is specialized with explicit SIMD code for some types
+/// in aggregate_avx2.cc and aggregate_avx512.cc.
+template <SimdLevel::type SIMD_LEVEL, typename CType, typename SumCType>
+struct SumBlock {
+  static constexpr int kLanes = 8;
+
+  static SumCType Dense(const CType* values, int64_t length) {
+    SumCType lanes[kLanes] = {};
+    int64_t i = 0;
+    for (; i + kLanes <= length; i += kLanes) {
+      for (int j = 0; j < kLanes; ++j) {
+        lanes[j] += values[i + j];
+      }
+    }
+    for (; i < length; ++i) {
+      lanes[0] += values[i];
+    }
+    return ReduceLanes(lanes);
+  }
+
+  // Sum of the values whose bit is set in valid_bits.  Null slots are blended
+  // with zero rather than multiplied by their validity bit, as they may hold
+  // NaNs.
+  static SumCType Masked(const CType* values, int64_t length, uint64_t valid_bits) {
+    SumCType lanes[kLanes] = {};
+    int64_t i = 0;
+    for (; i + kLanes <= length; i += kLanes) {
+      const auto valid_byte = static_cast<uint8_t>(valid_bits >> i);
+      for (int j = 0; j < kLanes; ++j) {
+        const bool valid = (valid_byte & (1 << j)) != 0;
+        lanes[j] += valid ? static_cast<SumCType>(values[i + j]) : 0;
+      }
+    }
+    for (; i < length; ++i) {
+      const bool valid = (valid_bits >> i) & 1;
+      lanes[0] += valid ? static_cast<SumCType>(values[i]) : 0;
+    }
+    return ReduceLanes(lanes);
+  }
+
+  static SumCType ReduceLanes(const SumCType* lanes) {
+    SumCType sum = 0;
+    for (int j = 0; j < kLanes; ++j) {
+      sum += lanes[j];
+    }
+    return sum;
+  }
+};
+
+template <typename ArrowType, typename StateType,
+          SimdLevel::type SIMD_LEVEL = SimdLevel::NONE>
 class SumAggregateFunction final : public AggregateFunctionStaticState<StateType> {
   using CType = typename TypeTraits<ArrowType>::CType;
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
-
-  // A small number of elements rounded to the next cacheline. This should
-  // amount to a maximum of 4 cachelines when dealing with 8 bytes elements.
-  static constexpr int64_t kTinyThreshold = 32;
-  static_assert(kTinyThreshold >= (2 * CHAR_BIT) + 1,
-                "ConsumeSparse requires 3 bytes of null bitmap, and 17 is the"
-                "required minimum number of bits/elements to cover 3 bytes.");
+  using SumCType = typename FindAccumulatorType<ArrowType>::Type::c_type;
+  using Block = SumBlock<SIMD_LEVEL, CType, SumCType>;
 
  public:
   Status Consume(const Array& input, StateType* state) const override {
@@ -72,10 +193,6 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
 
     if (input.null_count() == 0) {
       *state = ConsumeDense(array);
-    } else if (input.length() <= kTinyThreshold) {
-      // In order to simplify ConsumeSparse implementation (requires at least 3
-      // bytes of bitmap data), small arrays are handled differently.
-      *state = ConsumeTiny(array);
     } else {
       *state = ConsumeSparse(array);
     }
@@ -98,110 +215,75 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
  private:
   StateType ConsumeDense(const ArrayType& array) const {
     StateType local;
-
-    const auto values = array.raw_values();
-    const int64_t length = array.length();
-    for (int64_t i = 0; i < length; i++) {
-      local.sum += values[i];
-    }
-
-    local.count = length;
-
+    local.sum = Block::Dense(array.raw_values(), array.length());
+    local.count = array.length();
     return local;
   }
 
-  StateType ConsumeTiny(const ArrayType& array) const {
+  // The validity bitmap is consumed a 64-bit word at a time: blocks without
+  // nulls are summed as dense ones, blocks without values are skipped.
+  StateType ConsumeSparse(const ArrayType& array) const {
     StateType local;
-
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
-                                  array.length());
-    const auto values = array.raw_values();
-    for (int64_t i = 0; i < array.length(); i++) {
-      if (reader.IsSet()) {
-        local.sum += values[i];
-        local.count++;
-      }
-      reader.Next();
-    }
+    const CType* values = array.raw_values();
+
+    VisitValidityWords(
+        array.null_bitmap_data(), array.offset(), array.length(),
+        [&](int64_t position, int64_t block_length, uint64_t valid_bits) {
+          const int valid_count = BitUtil::PopCount(valid_bits);
+          if (valid_count == block_length) {
+            local.sum += Block::Dense(values + position, block_length);
+          } else if (valid_count > 0) {
+            local.sum += Block::Masked(values + position, block_length, valid_bits);
+          }
+          local.count += valid_count;
+        });
 
     return local;
   }
+};
 
-  // While this is not branchless, gcc needs this to be in a different function
-  // for it to generate cmov which ends to be slightly faster than
-  // multiplication but safe for handling NaN with doubles.
-  inline CType MaskedValue(bool valid, CType value) const { return valid ? value : 0; }
-
-  inline StateType UnrolledSum(uint8_t bits, const CType* values) const {
-    StateType local;
-
-    if (bits < 0xFF) {
-      // Some nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += MaskedValue(bits & (1U << i), values[i]);
-      }
-      local.count += BitUtil::kBytePopcount[bits];
-    } else {
-      // No nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += values[i];
-      }
-      local.count += 8;
-    }
-
-    return local;
+/// \brief Instantiate SumAggregateFunction for the given type, state and
+/// SIMD level
+template <template <typename...> class StateType,
+          SimdLevel::type SIMD_LEVEL = SimdLevel::NONE>
+std::shared_ptr<AggregateFunction> MakeSumLikeAggregateFunction(const DataType& type) {
+#define SUM_LIKE_AGG_FN_CASE(T)                         \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<SumAggregateFunction<T, StateType<T>, SIMD_LEVEL>>());
+
+  switch (type.id()) {
+    SUM_LIKE_AGG_FN_CASE(UInt8Type);
+    SUM_LIKE_AGG_FN_CASE(Int8Type);
+    SUM_LIKE_AGG_FN_CASE(UInt16Type);
+    SUM_LIKE_AGG_FN_CASE(Int16Type);
+    SUM_LIKE_AGG_FN_CASE(UInt32Type);
+    SUM_LIKE_AGG_FN_CASE(Int32Type);
+    SUM_LIKE_AGG_FN_CASE(UInt64Type);
+    SUM_LIKE_AGG_FN_CASE(Int64Type);
+    SUM_LIKE_AGG_FN_CASE(FloatType);
+    SUM_LIKE_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
   }
 
-  StateType ConsumeSparse(const ArrayType& array) const {
-    StateType local;
-
-    // Sliced bitmaps on non-byte positions induce problem with the branchless
-    // unrolled technique. Thus extra padding is added on both left and right
-    // side of the slice such that both ends are byte-aligned. The first and
-    // last bitmap are properly masked to ignore extra values induced by
-    // padding.
-    //
-    // The execution is divided in 3 sections.
-    //
-    // 1. Compute the sum of the first masked byte.
-    // 2. Compute the sum of the middle bytes
-    // 3. Compute the sum of the last masked byte.
-
-    const int64_t length = array.length();
-    const int64_t offset = array.offset();
-
-    // The number of bytes covering the range, this includes partial bytes.
-    // This number bounded by `<= (length / 8) + 2`, e.g. a possible extra byte
-    // on the left, and on the right.
-    const int64_t covering_bytes = BitUtil::CoveringBytes(offset, length);
-    DCHECK_GE(covering_bytes, 3);
-
-    // Align values to the first batch of 8 elements. Note that raw_values() is
-    // already adjusted with the offset, thus we rewind a little to align to
-    // the closest 8-batch offset.
-    const auto values = array.raw_values() - (offset % 8);
-
-    // Align bitmap at the first consumable byte.
-    const auto bitmap = array.null_bitmap_data() + BitUtil::RoundDown(offset, 8) / 8;
-
-    // Consume the first (potentially partial) byte.
-    const uint8_t first_mask = BitUtil::kTrailingBitmask[offset % 8];
-    local += UnrolledSum(bitmap[0] & first_mask, values);
-
-    // Consume the (full) middle bytes. The loop iterates in unit of
-    // batches of 8 values and 1 byte of bitmap.
-    for (int64_t i = 1; i < covering_bytes - 1; i++) {
-      local += UnrolledSum(bitmap[i], &values[i * 8]);
-    }
-
-    // Consume the last (potentially partial) byte.
-    const int64_t last_idx = covering_bytes - 1;
-    const uint8_t last_mask = BitUtil::kPrecedingWrappingBitmask[(offset + length) % 8];
-    local += UnrolledSum(bitmap[last_idx] & last_mask, &values[last_idx * 8]);
-
-    return local;
-  }
-};  // namespace compute
+#undef SUM_LIKE_AGG_FN_CASE
+}
+
+/// \brief Return a Sum (resp. Mean) kernel specialized for the given SIMD
+/// level, which must be supported by the running CPU
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunction(const DataType& type,
+                                                            SimdLevel::type simd_level);
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeMeanAggregateFunction(const DataType& type,
+                                                             SimdLevel::type simd_level);
+
+// Defined in translation units compiled with the matching instruction set
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunctionAvx2(const DataType& type);
+std::shared_ptr<AggregateFunction> MakeMeanAggregateFunctionAvx2(const DataType& type);
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunctionAvx512(const DataType& type);
+std::shared_ptr<AggregateFunction> MakeMeanAggregateFunctionAvx512(const DataType& type);
 
 }  // namespace compute
 }  // namespace arrow
@@ -15,15 +15,19 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
-#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/kernels/selection.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/table.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -101,46 +105,241 @@ Status Take(FunctionContext* ctx, const Datum& values, const Datum& indices,
   return kernel->Call(ctx, values, indices, out);
 }
 
+// ----------------------------------------------------------------------
+// Taking from chunked values, without concatenating them
+
+namespace {
+
+// Whether values of this type are single fixed-size slots (not bits)
+bool HasFixedByteWidth(const DataType& type) {
+  return (is_primitive(type.id()) && type.id() != Type::NA && type.id() != Type::BOOL) ||
+         is_fixed_size_binary(type.id());
+}
+
+// The slots of one chunk of fixed-width values
+struct ChunkSlots {
+  // First slot of the chunk
+  const uint8_t* values;
+  // Nullptr if the chunk has no nulls
+  const uint8_t* null_bitmap;
+  int64_t offset;
+};
+
+// Gather fixed-width slots, kByteWidth is 0 if only known at runtime
+template <typename IndexType, int kByteWidth>
+Status GatherSlots(const std::vector<ChunkSlots>& chunks, ChunkResolver resolver,
+                   int byte_width, const Array& indices, uint8_t* out_values,
+                   uint8_t* out_null_bitmap, int64_t* out_null_count) {
+  const int width = kByteWidth > 0 ? kByteWidth : byte_width;
+  ArrayIndexSequence<IndexType> sequence(indices);
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    const auto index_valid = sequence.Next();
+    uint8_t* out_slot = out_values + i * width;
+    if (index_valid.second) {
+      const int64_t index = index_valid.first;
+      if (index < 0 || index >= resolver.length()) {
+        return Status::IndexError("take index out of bounds");
+      }
+      const auto location = resolver.Resolve(index);
+      const ChunkSlots& chunk = chunks[location.chunk_index];
+      if (chunk.null_bitmap == NULLPTR ||
+          BitUtil::GetBit(chunk.null_bitmap, chunk.offset + location.index_in_chunk)) {
+        std::memcpy(out_slot, chunk.values + location.index_in_chunk * width, width);
+        BitUtil::SetBit(out_null_bitmap, i);
+        continue;
+      }
+    }
+    std::memset(out_slot, 0, width);
+    ++null_count;
+  }
+  *out_null_count = null_count;
+  return Status::OK();
+}
+
+template <typename IndexType>
+Status TakeFixedWidth(FunctionContext* ctx, const ChunkedArray& values,
+                      const Array& indices, std::shared_ptr<Array>* out) {
+  const auto& type = values.type();
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  std::vector<ChunkSlots> chunks;
+  for (const auto& chunk : values.chunks()) {
+    const ArrayData& data = *chunk->data();
+    if (data.length == 0) {
+      // Never resolved to, and may lack buffers
+      chunks.push_back({NULLPTR, NULLPTR, 0});
+      continue;
+    }
+    chunks.push_back({data.buffers[1]->data() + data.offset * byte_width,
+                      data.GetNullCount() > 0 ? data.buffers[0]->data() : NULLPTR,
+                      data.offset});
+  }
+
+  const int64_t length = indices.length();
+  std::shared_ptr<Buffer> out_values, out_null_bitmap;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * byte_width, &out_values));
+  RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &out_null_bitmap));
+
+  ChunkResolver resolver(values.chunks());
+  int64_t null_count;
+  uint8_t* out_data = out_values->mutable_data();
+  uint8_t* out_bitmap = out_null_bitmap->mutable_data();
+  switch (byte_width) {
+#define GATHER_CASE(WIDTH)                                                           \
+  case WIDTH:                                                                        \
+    RETURN_NOT_OK((GatherSlots<IndexType, WIDTH>(chunks, resolver, byte_width,       \
+                                                 indices, out_data, out_bitmap,      \
+                                                 &null_count)));                     \
+    break;
+
+    GATHER_CASE(1)
+    GATHER_CASE(2)
+    GATHER_CASE(4)
+    GATHER_CASE(8)
+    GATHER_CASE(16)
+#undef GATHER_CASE
+    default:
+      RETURN_NOT_OK((GatherSlots<IndexType, 0>(chunks, resolver, byte_width, indices,
+                                               out_data, out_bitmap, &null_count)));
+      break;
+  }
+
+  *out = MakeArray(ArrayData::Make(
+      type, length, {null_count > 0 ? out_null_bitmap : NULLPTR, out_values},
+      null_count));
+  return Status::OK();
+}
+
+// Other types: the indices are translated to chunk-local indices, and the runs
+// of consecutive indices falling in the same chunk are taken from that chunk.
+// The Taker accumulates the values of all runs.
+template <typename IndexType>
+Status TakeRuns(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
+                std::shared_ptr<Array>* out) {
+  struct Run {
+    int64_t chunk_index;
+    int64_t end;
+  };
+  std::vector<Run> runs;
+  Int64Builder local_indices_builder(ctx->memory_pool());
+  RETURN_NOT_OK(local_indices_builder.Reserve(indices.length()));
+
+  ChunkResolver resolver(values.chunks());
+  ArrayIndexSequence<IndexType> sequence(indices);
+  int64_t chunk_index = 0;
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    const auto index_valid = sequence.Next();
+    if (!index_valid.second) {
+      // Null indices don't interrupt runs
+      local_indices_builder.UnsafeAppendNull();
+      continue;
+    }
+    const int64_t index = index_valid.first;
+    if (index < 0 || index >= resolver.length()) {
+      return Status::IndexError("take index out of bounds");
+    }
+    const auto location = resolver.Resolve(index);
+    if (location.chunk_index != chunk_index && i > 0) {
+      runs.push_back({chunk_index, i});
+    }
+    chunk_index = location.chunk_index;
+    local_indices_builder.UnsafeAppend(location.index_in_chunk);
+  }
+  runs.push_back({chunk_index, indices.length()});
+
+  if (values.num_chunks() == 0) {
+    // All indices are null
+    return MakeArrayOfNull(ctx->memory_pool(), values.type(), indices.length(), out);
+  }
+
+  std::shared_ptr<Array> local_indices;
+  RETURN_NOT_OK(local_indices_builder.Finish(&local_indices));
+  std::unique_ptr<Taker<ArrayIndexSequence<Int64Type>>> taker;
+  RETURN_NOT_OK(Taker<ArrayIndexSequence<Int64Type>>::Make(values.type(), &taker));
+  RETURN_NOT_OK(taker->SetContext(ctx));
+  int64_t start = 0;
+  for (const auto& run : runs) {
+    auto run_indices = local_indices->Slice(start, run.end - start);
+    ArrayIndexSequence<Int64Type> run_sequence(*run_indices);
+    run_sequence.set_never_out_of_bounds();
+    RETURN_NOT_OK(taker->Take(*values.chunk(static_cast<int>(run.chunk_index)),
+                              run_sequence));
+    start = run.end;
+  }
+  return taker->Finish(out);
+}
+
+struct TakeFromChunksImpl {
+  template <typename IndexType>
+  enable_if_integer<IndexType, Status> Visit(const IndexType&) {
+    if (HasFixedByteWidth(*values.type())) {
+      return TakeFixedWidth<IndexType>(ctx, values, indices, out);
+    }
+    return TakeRuns<IndexType>(ctx, values, indices, out);
+  }
+
+  Status Visit(const DataType& other) {
+    return Status::TypeError("index type not supported: ", other);
+  }
+
+  FunctionContext* ctx;
+  const ChunkedArray& values;
+  const Array& indices;
+  std::shared_ptr<Array>* out;
+};
+
+// Take one output chunk from chunked values
+Status TakeFromChunks(FunctionContext* ctx, const ChunkedArray& values,
+                      const Array& indices, const TakeOptions& options,
+                      std::shared_ptr<Array>* out) {
+  if (values.num_chunks() == 1) {
+    return Take(ctx, *values.chunk(0), indices, options, out);
+  }
+  TakeFromChunksImpl impl{ctx, values, indices, out};
+  return VisitTypeInline(*indices.type(), &impl);
+}
+
+// Take every chunk of indices from every column, the (column, index chunk)
+// pairs being independent tasks
+Status TakeColumns(FunctionContext* ctx, const std::vector<const ChunkedArray*>& columns,
+                   const ArrayVector& index_chunks, const TakeOptions& options,
+                   std::vector<std::shared_ptr<ChunkedArray>>* out) {
+  const size_t num_index_chunks = index_chunks.size();
+  std::vector<ArrayVector> out_chunks(columns.size(), ArrayVector(num_index_chunks));
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      options.use_threads, static_cast<int>(columns.size() * num_index_chunks),
+      [&](int task) {
+        const size_t column = task / num_index_chunks;
+        const size_t chunk = task % num_index_chunks;
+        // FunctionContext records errors and isn't thread-safe
+        FunctionContext task_ctx(ctx->memory_pool());
+        return TakeFromChunks(options.use_threads ? &task_ctx : ctx, *columns[column],
+                              *index_chunks[chunk], options, &out_chunks[column][chunk]);
+      }));
+
+  out->resize(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    (*out)[i] = std::make_shared<ChunkedArray>(std::move(out_chunks[i]),
+                                               columns[i]->type());
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
 Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
             const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
-  std::shared_ptr<Array> current_chunk;
-
-  // Case 1: `values` has a single chunk, so just use it
-  if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
-  } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
-
-    // Case 4: Else, concatenate chunks and call Array Take
-    RETURN_NOT_OK(Concatenate(values.chunks(), default_memory_pool(), &current_chunk));
-  }
-  // Call Array Take on our single chunk
-  RETURN_NOT_OK(Take(ctx, *current_chunk, indices, options, &new_chunks[0]));
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  std::shared_ptr<Array> taken;
+  RETURN_NOT_OK(TakeFromChunks(ctx, values, indices, options, &taken));
+  *out = std::make_shared<ChunkedArray>(ArrayVector{taken}, values.type());
   return Status::OK();
 }
 
 Status Take(FunctionContext* ctx, const ChunkedArray& values, const ChunkedArray& indices,
             const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = indices.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<ChunkedArray> current_chunk;
-
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
-    RETURN_NOT_OK(Take(ctx, values, *indices.chunk(i), options, &current_chunk));
-    // Concatenate the result to make a single array for this chunk
-    RETURN_NOT_OK(
-        Concatenate(current_chunk->chunks(), default_memory_pool(), &new_chunks[i]));
-  }
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(TakeColumns(ctx, {&values}, indices.chunks(), options, &columns));
+  *out = std::move(columns[0]);
   return Status::OK();
 }
 
@@ -171,26 +370,67 @@ Status Take(FunctionContext* ctx, const RecordBatch& batch, const Array& indices
   return Status::OK();
 }
 
-Status Take(FunctionContext* ctx, const Table& table, const Array& indices,
-            const TakeOptions& options, std::shared_ptr<Table>* out) {
-  auto ncols = table.num_columns();
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
+namespace {
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *table.column(j), indices, options, &columns[j]));
+// The indices of a selection, which Take accepts as is unless it's a bitmap
+Status SelectedIndices(FunctionContext* ctx, const SelectionVector& selection,
+                       std::shared_ptr<Array>* out) {
+  if (selection.kind() == SelectionVector::INDICES) {
+    *out = selection.indices();
+    return Status::OK();
+  }
+  return selection.ToIndices(ctx, out);
+}
+
+}  // namespace
+
+Status Take(FunctionContext* ctx, const Array& values, const SelectionVector& selection,
+            const TakeOptions& options, std::shared_ptr<Array>* out) {
+  if (values.length() != selection.length()) {
+    return Status::Invalid("Take expects values with the length of the selection");
+  }
+  std::shared_ptr<Array> indices;
+  RETURN_NOT_OK(SelectedIndices(ctx, selection, &indices));
+  return Take(ctx, values, *indices, options, out);
+}
+
+Status Take(FunctionContext* ctx, const RecordBatch& batch,
+            const SelectionVector& selection, const TakeOptions& options,
+            std::shared_ptr<RecordBatch>* out) {
+  if (batch.num_rows() != selection.length()) {
+    return Status::Invalid("Take expects a batch with the length of the selection");
+  }
+  std::shared_ptr<Array> indices;
+  RETURN_NOT_OK(SelectedIndices(ctx, selection, &indices));
+  return Take(ctx, batch, *indices, options, out);
+}
+
+namespace {
+
+std::vector<const ChunkedArray*> TableColumns(const Table& table) {
+  std::vector<const ChunkedArray*> columns;
+  for (int i = 0; i < table.num_columns(); ++i) {
+    columns.push_back(table.column(i).get());
   }
+  return columns;
+}
+
+}  // namespace
+
+Status Take(FunctionContext* ctx, const Table& table, const Array& indices,
+            const TakeOptions& options, std::shared_ptr<Table>* out) {
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(TakeColumns(ctx, TableColumns(table), {indices.Slice(0)}, options,
+                            &columns));
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
 
 Status Take(FunctionContext* ctx, const Table& table, const ChunkedArray& indices,
             const TakeOptions& options, std::shared_ptr<Table>* out) {
-  auto ncols = table.num_columns();
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
-
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *table.column(j), indices, options, &columns[j]));
-  }
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(
+      TakeColumns(ctx, TableColumns(table), indices.chunks(), options, &columns));
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
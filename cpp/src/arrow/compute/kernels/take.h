@@ -30,8 +30,13 @@ class Array;
 namespace compute {
 
 class FunctionContext;
+class SelectionVector;
 
-struct ARROW_EXPORT TakeOptions {};
+struct ARROW_EXPORT TakeOptions {
+  /// When taking from chunked values, compute the output chunks (and, for
+  /// tables, columns) in parallel on the CPU thread pool
+  bool use_threads = false;
+};
 
 /// \brief Take from an array of values at indices in another array
 ///
@@ -53,6 +58,20 @@ ARROW_EXPORT
 Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
             const TakeOptions& options, std::shared_ptr<Array>* out);
 
+/// \brief Take the values of an array at the positions of a selection
+///
+/// This materializes the result of operations chained on a selection
+/// vector, like Filter() does with a boolean filter.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array from which to take
+/// \param[in] selection which values to take, with the length of values
+/// \param[in] options options
+/// \param[out] out resulting array
+ARROW_EXPORT
+Status Take(FunctionContext* ctx, const Array& values, const SelectionVector& selection,
+            const TakeOptions& options, std::shared_ptr<Array>* out);
+
 /// \brief Take from a chunked array of values at indices in another array
 ///
 /// The output chunked array will be of the same type as the input values
@@ -64,6 +83,10 @@ Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
 /// = [values[2], values[1], null, values[3]]
 /// = ["c", "b", null, null]
 ///
+/// The chunks of `values` aren't concatenated: every index is resolved to
+/// its chunk by a binary search over the chunk offsets (short-circuited when
+/// consecutive indices fall in the same chunk).
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] values chunked array from which to take
 /// \param[in] indices which values to take
@@ -79,7 +102,8 @@ Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indic
 /// The output chunked array will be of the same type as the input values
 /// array, with elements taken from the values array at the given
 /// indices. If an index is null then the taken element will be null.
-/// The chunks in the output array will align with the chunks in the indices.
+/// The chunks in the output array will align with the chunks in the indices,
+/// and may be computed in parallel (see TakeOptions::use_threads).
 ///
 /// For example given values = ["a", "b", "c", null, "e", "f"] and
 /// indices = [2, 1, null, 3], the output will be
@@ -134,6 +158,19 @@ ARROW_EXPORT
 Status Take(FunctionContext* ctx, const RecordBatch& batch, const Array& indices,
             const TakeOptions& options, std::shared_ptr<RecordBatch>* out);
 
+/// \brief Take the rows of a record batch at the positions of a selection
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch from which to take
+/// \param[in] selection which rows to take, with the length of batch
+/// \param[in] options options
+/// \param[out] out resulting record batch
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status Take(FunctionContext* ctx, const RecordBatch& batch,
+            const SelectionVector& selection, const TakeOptions& options,
+            std::shared_ptr<RecordBatch>* out);
+
 /// \brief Take from a table at indices in an array
 ///
 /// The output table will have the same schema as the input table,
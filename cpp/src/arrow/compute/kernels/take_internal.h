@@ -118,6 +118,43 @@ Status VisitIndices(IndexSequence indices, const Array& values, Visitor&& vis) {
   return VisitIndices<true>(indices, values, std::forward<Visitor>(vis));
 }
 
+// Resolves logical indices into a sequence of chunks to (chunk, index in
+// chunk) locations, by binary search over the chunk offsets.  The last chunk
+// found is cached, so that runs of indices falling in the same chunk resolve
+// in constant time.  Not thread-safe, because of the cache.
+class ChunkResolver {
+ public:
+  struct Location {
+    int64_t chunk_index;
+    int64_t index_in_chunk;
+  };
+
+  explicit ChunkResolver(const ArrayVector& chunks) : offsets_(chunks.size() + 1, 0) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      offsets_[i + 1] = offsets_[i] + chunks[i]->length();
+    }
+  }
+
+  // Total length of the chunks
+  int64_t length() const { return offsets_.back(); }
+
+  // index must be in [0, length())
+  Location Resolve(int64_t index) {
+    DCHECK_GE(index, 0);
+    DCHECK_LT(index, length());
+    if (index < offsets_[cached_chunk_] || index >= offsets_[cached_chunk_ + 1]) {
+      // The last chunk starting at or before index (skipping empty chunks)
+      auto it = std::upper_bound(offsets_.begin(), offsets_.end(), index);
+      cached_chunk_ = static_cast<int64_t>(it - offsets_.begin()) - 1;
+    }
+    return {cached_chunk_, index - offsets_[cached_chunk_]};
+  }
+
+ private:
+  std::vector<int64_t> offsets_;
+  int64_t cached_chunk_ = 0;
+};
+
 // Helper class for gathering values from an array
 template <typename IndexSequence>
 class Taker {
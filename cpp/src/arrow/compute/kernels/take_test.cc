@@ -21,6 +21,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
@@ -640,6 +641,67 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeAcrossChunks) {
+  // Fixed-width values
+  this->AssertTake(int32(), {"[0, 1, null]", "[]", "[3]", "[4, null, 6]"},
+                   "[6, 0, null, 2, 3, 4, 5, 3]", {"[6, 0, null, null, 3, 4, null, 3]"});
+  this->AssertTake(fixed_size_binary(2), {R"(["aa", null])", R"(["cc"])"},
+                   "[2, 1, 0, null]", {R"(["cc", null, "aa", null])"});
+  // Other values
+  this->AssertTake(utf8(), {R"(["a", "b"])", "[]", R"([null, "d"])"},
+                   "[3, 3, null, 0, 2, 1]", {R"(["d", "d", null, "a", null, "b"])"});
+  this->AssertTake(boolean(), {"[true]", "[false, null]"}, "[2, 1, null, 0]",
+                   {"[null, false, null, true]"});
+  this->AssertChunkedTake(utf8(), {R"(["a"])", R"(["b", "c"])"},
+                          {"[2, 0]", "[]", "[null, 1]"},
+                          {R"(["c", "a"])", "[]", R"([null, "b"])"});
+
+  // All null indices into empty values
+  this->AssertTake(utf8(), {}, "[null, null]", {"[null, null]"});
+  this->AssertTake(int64(), {}, "[null]", {"[null]"});
+
+  std::shared_ptr<ChunkedArray> arr;
+  ASSERT_RAISES(IndexError, this->TakeWithArray(utf8(), {R"(["a"])", R"(["b"])"},
+                                                "[0, 2]", &arr));
+  ASSERT_RAISES(IndexError, this->TakeWithArray(int8(), {}, "[0]", &arr));
+  ASSERT_RAISES(IndexError, this->TakeWithArray(int8(), {"[7]", "[8]"}, "[-1]", &arr));
+}
+
+TEST_F(TestTakeKernelWithChunkedArray, UseThreads) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t chunk_length = 1000;
+  ArrayVector index_chunks;
+  for (int i = 0; i < 4; ++i) {
+    index_chunks.push_back(rand.Int32(500, 0, 5 * chunk_length - 1, 0.1));
+  }
+  ChunkedArray indices(index_chunks);
+
+  // A fixed-width column and a variable-width column
+  for (bool fixed_width : {true, false}) {
+    ArrayVector chunks;
+    for (int i = 0; i < 5; ++i) {
+      chunks.push_back(fixed_width ? rand.Int64(chunk_length, -100, 100, 0.1)
+                                   : rand.String(chunk_length, 0, 10, 0.1));
+    }
+    ChunkedArray values(chunks);
+    std::shared_ptr<Array> concatenated;
+    ASSERT_OK(Concatenate(chunks, default_memory_pool(), &concatenated));
+
+    TakeOptions options;
+    options.use_threads = true;
+    std::shared_ptr<ChunkedArray> actual;
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, values, indices, options, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    ASSERT_EQ(4, actual->num_chunks());
+    for (int i = 0; i < 4; ++i) {
+      std::shared_ptr<Array> expected;
+      ASSERT_OK(arrow::compute::Take(&this->ctx_, *concatenated, *index_chunks[i],
+                                     TakeOptions(), &expected));
+      AssertArraysEqual(*expected, *actual->chunk(i));
+    }
+  }
+}
+
 class TestTakeKernelWithTable : public TestTakeKernel<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
@@ -0,0 +1,280 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/tdigest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr uint32_t TDigest::kDefaultDelta;
+constexpr uint32_t TDigest::kDefaultBufferSize;
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// The k1 scale function maps a quantile to a centroid index, so that
+// centroids merged over one unit of k stay small near q = 0 and q = 1
+inline double ScaleK(double q, double delta) {
+  return delta / (2 * kPi) * std::asin(2 * q - 1);
+}
+
+inline double ScaleKInverse(double k, double delta) {
+  const double angle = k * 2 * kPi / delta;
+  if (angle >= kPi / 2) {
+    return 1.0;
+  }
+  return (std::sin(angle) + 1) / 2;
+}
+
+struct ValueAdder {
+  Status VisitNull() { return Status::OK(); }
+
+  template <typename Value>
+  Status VisitValue(Value value) {
+    const double v = static_cast<double>(value);
+    if (!std::isnan(v)) {
+      digest->Add(v);
+    }
+    return Status::OK();
+  }
+
+  TDigest* digest;
+};
+
+}  // namespace
+
+TDigest::TDigest(uint32_t delta, uint32_t buffer_size)
+    : delta_(delta),
+      buffer_size_(buffer_size),
+      min_(std::numeric_limits<double>::infinity()),
+      max_(-std::numeric_limits<double>::infinity()) {
+  DCHECK_GT(delta, 0);
+  DCHECK_GT(buffer_size, 0);
+  buffer_.reserve(buffer_size);
+}
+
+Status TDigest::Consume(const Array& values) {
+  ValueAdder adder{this};
+  const ArrayData& data = *values.data();
+  switch (values.type_id()) {
+#define ADD_CASE(InType) \
+  case InType::type_id:  \
+    return ArrayDataVisitor<InType>::Visit(data, &adder);
+
+    ADD_CASE(UInt8Type)
+    ADD_CASE(Int8Type)
+    ADD_CASE(UInt16Type)
+    ADD_CASE(Int16Type)
+    ADD_CASE(UInt32Type)
+    ADD_CASE(Int32Type)
+    ADD_CASE(UInt64Type)
+    ADD_CASE(Int64Type)
+    ADD_CASE(FloatType)
+    ADD_CASE(DoubleType)
+#undef ADD_CASE
+    default:
+      return Status::NotImplemented("TDigest is not implemented for ", *values.type());
+  }
+}
+
+void TDigest::Add(double value, double weight) {
+  buffer_.push_back({value, weight});
+  total_weight_ += weight;
+  min_ = std::min(min_, value);
+  max_ = std::max(max_, value);
+  if (buffer_.size() >= buffer_size_) {
+    Compress();
+  }
+}
+
+void TDigest::Merge(const TDigest& other) {
+  for (const Centroid& centroid : other.centroids_) {
+    Add(centroid.mean, centroid.weight);
+  }
+  for (const Centroid& centroid : other.buffer_) {
+    Add(centroid.mean, centroid.weight);
+  }
+  // Centroid means lie within [min, max], restore the exact extremes
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+}
+
+void TDigest::Compress() {
+  if (buffer_.empty()) {
+    return;
+  }
+  buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+  std::sort(buffer_.begin(), buffer_.end(),
+            [](const Centroid& l, const Centroid& r) { return l.mean < r.mean; });
+
+  // Greedily merge neighbouring centroids while the merged centroid spans
+  // less than one unit of the scale function
+  const double delta = static_cast<double>(delta_);
+  centroids_.clear();
+  Centroid current = buffer_[0];
+  double weight_so_far = 0;
+  double weight_limit = total_weight_ * ScaleKInverse(ScaleK(0, delta) + 1, delta);
+  for (size_t i = 1; i < buffer_.size(); ++i) {
+    const Centroid& next = buffer_[i];
+    if (weight_so_far + current.weight + next.weight <= weight_limit) {
+      current.weight += next.weight;
+      current.mean += (next.mean - current.mean) * next.weight / current.weight;
+    } else {
+      weight_so_far += current.weight;
+      centroids_.push_back(current);
+      const double q = weight_so_far / total_weight_;
+      weight_limit = total_weight_ * ScaleKInverse(ScaleK(q, delta) + 1, delta);
+      current = next;
+    }
+  }
+  centroids_.push_back(current);
+  buffer_.clear();
+}
+
+double TDigest::Quantile(double q) const {
+  if (!buffer_.empty()) {
+    TDigest compressed(*this);
+    compressed.Compress();
+    return compressed.Quantile(q);
+  }
+  if (is_empty()) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  if (q <= 0) {
+    return min_;
+  }
+  if (q >= 1) {
+    return max_;
+  }
+  if (centroids_.size() == 1) {
+    return centroids_[0].mean;
+  }
+
+  // Each centroid is taken to be centered on its cumulative weight, values
+  // are interpolated linearly between centers (and the extremes at both ends)
+  const double index = q * total_weight_;
+  const Centroid& first = centroids_.front();
+  if (index < first.weight / 2) {
+    return min_ + index / (first.weight / 2) * (first.mean - min_);
+  }
+  double weight_so_far = first.weight / 2;
+  for (size_t i = 0; i + 1 < centroids_.size(); ++i) {
+    const Centroid& left = centroids_[i];
+    const Centroid& right = centroids_[i + 1];
+    const double span = (left.weight + right.weight) / 2;
+    if (index < weight_so_far + span) {
+      return left.mean + (index - weight_so_far) / span * (right.mean - left.mean);
+    }
+    weight_so_far += span;
+  }
+  const Centroid& last = centroids_.back();
+  const double remaining = total_weight_ - weight_so_far;
+  if (remaining <= 0) {
+    return last.mean;
+  }
+  return last.mean + (index - weight_so_far) / remaining * (max_ - last.mean);
+}
+
+// The state is a TDigest constructed in place with the configured parameters,
+// hence AggregateFunctionStaticState (which requires a default constructible
+// state) isn't used.
+class TDigestAggregateFunction final : public AggregateFunction {
+ public:
+  TDigestAggregateFunction(const TDigestOptions& options, MemoryPool* pool)
+      : options_(options), pool_(pool) {}
+
+  Status Consume(const Array& input, void* state) const override {
+    return static_cast<TDigest*>(state)->Consume(input);
+  }
+
+  Status Merge(const void* src, void* dst) const override {
+    static_cast<TDigest*>(dst)->Merge(*static_cast<const TDigest*>(src));
+    return Status::OK();
+  }
+
+  Status Finalize(const void* src, Datum* output) const override {
+    TDigest digest = *static_cast<const TDigest*>(src);
+    digest.Compress();
+
+    DoubleBuilder builder(pool_);
+    RETURN_NOT_OK(builder.Reserve(options_.quantiles.size()));
+    for (double q : options_.quantiles) {
+      if (digest.is_empty()) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(digest.Quantile(q));
+      }
+    }
+    std::shared_ptr<Array> quantiles;
+    RETURN_NOT_OK(builder.Finish(&quantiles));
+    *output = quantiles;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+  int64_t Size() const override { return sizeof(TDigest); }
+
+  void New(void* ptr) const override {
+    new (ptr) TDigest(options_.delta, options_.buffer_size);
+  }
+
+  void Delete(void* ptr) const override { static_cast<TDigest*>(ptr)->~TDigest(); }
+
+ private:
+  TDigestOptions options_;
+  MemoryPool* pool_;
+};
+
+std::shared_ptr<AggregateFunction> MakeTDigest(FunctionContext* context,
+                                               const TDigestOptions& options) {
+  return std::make_shared<TDigestAggregateFunction>(options, context->memory_pool());
+}
+
+Status ApproxQuantiles(FunctionContext* context, const TDigestOptions& options,
+                       const Datum& value, Datum* out) {
+  for (double q : options.quantiles) {
+    if (!(q >= 0 && q <= 1)) {
+      return Status::Invalid("Quantiles must be between 0 and 1, got ", q);
+    }
+  }
+  if (options.delta == 0 || options.buffer_size == 0) {
+    return Status::Invalid("TDigest delta and buffer size must be positive");
+  }
+  auto aggregate = MakeTDigest(context, options);
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+
+  return kernel->Call(context, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \class TDigest
+/// \brief A mergeable sketch of a distribution, answering approximate
+/// quantile queries
+///
+/// This is the merging t-digest of Dunning and Ertl: values are buffered and
+/// periodically merged into at most about `delta` weighted centroids, sized so
+/// that centroids near the tails hold few values.  Quantiles close to 0 and 1
+/// are therefore much more accurate than a fixed-size histogram would give,
+/// and memory use is bounded by `delta` and `buffer_size` regardless of the
+/// number of values consumed.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT TDigest {
+ public:
+  static constexpr uint32_t kDefaultDelta = 100;
+  static constexpr uint32_t kDefaultBufferSize = 500;
+
+  /// \brief Create an empty digest
+  ///
+  /// \param[in] delta the compression parameter, bounding the number of
+  /// centroids; higher values are more accurate
+  /// \param[in] buffer_size the number of values buffered before merging
+  explicit TDigest(uint32_t delta = kDefaultDelta,
+                   uint32_t buffer_size = kDefaultBufferSize);
+
+  /// \brief Add the non-null values of a numeric array to the digest
+  ///
+  /// NaN values are ignored.
+  Status Consume(const Array& values);
+
+  /// \brief Add a single value to the digest
+  void Add(double value, double weight = 1.0);
+
+  /// \brief Merge another digest into this one
+  void Merge(const TDigest& other);
+
+  /// \brief Merge buffered values into the centroids
+  void Compress();
+
+  /// \brief Return the approximate value at quantile `q` (between 0 and 1),
+  /// or NaN if the digest is empty
+  double Quantile(double q) const;
+
+  bool is_empty() const { return total_weight_ == 0; }
+
+  /// \brief The number of values added
+  double total_weight() const { return total_weight_; }
+
+ private:
+  struct Centroid {
+    double mean;
+    double weight;
+  };
+
+  uint32_t delta_;
+  uint32_t buffer_size_;
+  double total_weight_ = 0;
+  double min_;
+  double max_;
+  std::vector<Centroid> centroids_;
+  std::vector<Centroid> buffer_;
+};
+
+/// \class TDigestOptions
+///
+/// The quantiles to compute and the accuracy of the TDigest kernel.
+struct ARROW_EXPORT TDigestOptions {
+  explicit TDigestOptions(std::vector<double> quantiles = {0.5},
+                          uint32_t delta = TDigest::kDefaultDelta,
+                          uint32_t buffer_size = TDigest::kDefaultBufferSize)
+      : quantiles(std::move(quantiles)), delta(delta), buffer_size(buffer_size) {}
+
+  /// The quantiles to compute, between 0 and 1
+  std::vector<double> quantiles;
+  /// See TDigest
+  uint32_t delta;
+  uint32_t buffer_size;
+};
+
+/// \brief Return TDigest function aggregate
+///
+/// The aggregate state is a TDigest.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeTDigest(FunctionContext* context,
+                                               const TDigestOptions& options);
+
+/// \brief Compute approximate quantiles of a numeric array-like object
+///
+/// Unlike sorting, memory use does not depend on the input size.  Chunks are
+/// consumed into separate digests and merged, so they can be processed in
+/// parallel (see FunctionContext::use_threads()).
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the quantiles to compute, see TDigestOptions
+/// \param[in] value array-like input
+/// \param[out] out resulting datum, a double array with one value per
+/// requested quantile; values are null if the input has no non-null values
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxQuantiles(FunctionContext* context, const TDigestOptions& options,
+                       const Datum& value, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/tdigest.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestTDigest : public ComputeFixture, public TestBase {
+ protected:
+  std::vector<double> Quantiles(const Datum& value, const std::vector<double>& q) {
+    Datum out;
+    ARROW_EXPECT_OK(ApproxQuantiles(&this->ctx_, TDigestOptions(q), value, &out));
+    const auto& array = checked_cast<const DoubleArray&>(*out.make_array());
+    return std::vector<double>(array.raw_values(), array.raw_values() + array.length());
+  }
+
+  // The exact quantile of the sorted non-null values of a double array, taken
+  // as the value at rank q * (n - 1)
+  double ExactQuantile(const std::vector<double>& sorted, double q) {
+    return sorted[static_cast<size_t>(q * static_cast<double>(sorted.size() - 1))];
+  }
+
+  std::vector<double> Sorted(const ArrayVector& chunks) {
+    std::vector<double> values;
+    for (const auto& chunk : chunks) {
+      const auto& array = checked_cast<const DoubleArray&>(*chunk);
+      for (int64_t i = 0; i < array.length(); ++i) {
+        if (array.IsValid(i)) {
+          values.push_back(array.Value(i));
+        }
+      }
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+};
+
+TEST_F(TestTDigest, Small) {
+  ASSERT_EQ(std::vector<double>({3, 1, 5}),
+            Quantiles(ArrayFromJSON(int32(), "[5, null, 1, 4, 2, 3]"), {0.5, 0, 1}));
+  ASSERT_EQ(std::vector<double>({2.5}),
+            Quantiles(ArrayFromJSON(float64(), "[4, 1, 3, 2]"), {0.5}));
+  ASSERT_EQ(std::vector<double>({7, 7}),
+            Quantiles(ArrayFromJSON(uint8(), "[7]"), {0.1, 0.9}));
+
+  Datum out;
+  ASSERT_OK(ApproxQuantiles(&this->ctx_, TDigestOptions({0.5, 0.9}),
+                            ArrayFromJSON(float64(), "[null]"), &out));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[null, null]"), *out.make_array());
+}
+
+TEST_F(TestTDigest, Accuracy) {
+  auto rand = random::RandomArrayGenerator(0x7d1a2b3c);
+  ArrayVector chunks;
+  for (int i = 0; i < 20; ++i) {
+    chunks.push_back(rand.Float64(10000 + 977 * i, -1000, 1000, 0.05));
+  }
+  auto values = std::make_shared<ChunkedArray>(chunks);
+  const auto sorted = Sorted(chunks);
+  const std::vector<double> q = {0.001, 0.01, 0.25, 0.5, 0.95, 0.99, 0.999};
+
+  for (bool use_threads : {false, true}) {
+    this->ctx_.set_use_threads(use_threads);
+    const auto approx = Quantiles(values, q);
+    for (size_t i = 0; i < q.size(); ++i) {
+      // The rank error is much smaller in the tails
+      const double rank_error = std::min(q[i], 1 - q[i]) < 0.05 ? 0.001 : 0.01;
+      ASSERT_GE(approx[i], ExactQuantile(sorted, std::max(q[i] - rank_error, 0.0)))
+          << "q = " << q[i];
+      ASSERT_LE(approx[i], ExactQuantile(sorted, std::min(q[i] + rank_error, 1.0)))
+          << "q = " << q[i];
+    }
+    ASSERT_EQ(sorted.front(), Quantiles(values, {0})[0]);
+    ASSERT_EQ(sorted.back(), Quantiles(values, {1})[0]);
+  }
+}
+
+TEST_F(TestTDigest, Merge) {
+  // Skewed partitions: the merged digest describes their union
+  TDigest left, right, empty;
+  for (int i = 0; i < 100000; ++i) {
+    left.Add(i % 1000);
+    right.Add(1000 + i % 9000);
+  }
+  left.Merge(right);
+  left.Merge(empty);
+  ASSERT_EQ(200000, left.total_weight());
+  ASSERT_EQ(0, left.Quantile(0));
+  ASSERT_EQ(9999, left.Quantile(1));
+  // Within 1% of rank: 2000 values, i.e. 20 units below 1000 and 180 above
+  ASSERT_GE(left.Quantile(0.5), 980);
+  ASSERT_LE(left.Quantile(0.5), 1180);
+  ASSERT_NEAR(5500, left.Quantile(0.75), 180);
+
+  ASSERT_TRUE(std::isnan(empty.Quantile(0.5)));
+}
+
+TEST_F(TestTDigest, Errors) {
+  Datum out;
+  auto values = ArrayFromJSON(float64(), "[1, 2]");
+  ASSERT_RAISES(Invalid,
+                ApproxQuantiles(&this->ctx_, TDigestOptions({1.5}), values, &out));
+  ASSERT_RAISES(Invalid,
+                ApproxQuantiles(&this->ctx_, TDigestOptions({NAN}), values, &out));
+  ASSERT_RAISES(Invalid,
+                ApproxQuantiles(&this->ctx_, TDigestOptions({0.5}, 0), values, &out));
+  ASSERT_RAISES(NotImplemented, ApproxQuantiles(&this->ctx_, TDigestOptions(),
+                                                ArrayFromJSON(utf8(), "[]"), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
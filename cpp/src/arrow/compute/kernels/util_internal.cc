@@ -24,11 +24,13 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -74,6 +76,24 @@ Status AllocateValueBuffer(FunctionContext* ctx, const DataType& type, int64_t l
   return Status::OK();
 }
 
+// Call `func(FunctionContext*, int chunk)` for each of `num_chunks` chunks, on the
+// CPU thread pool if both the context and the kernel allow it
+template <typename Function>
+Status ForEachChunk(FunctionContext* ctx, const OpKernel& kernel, int num_chunks,
+                    Function&& func) {
+  const bool use_threads =
+      ctx->use_threads() && kernel.parallelizable() && num_chunks > 1;
+  return internal::OptionalParallelFor(use_threads, num_chunks, [&](int chunk) -> Status {
+    if (!use_threads) {
+      return func(ctx, chunk);
+    }
+    // FunctionContext records errors and isn't thread-safe
+    FunctionContext chunk_ctx(ctx->memory_pool());
+    RETURN_NOT_OK(func(&chunk_ctx, chunk));
+    return chunk_ctx.status();
+  });
+}
+
 }  // namespace
 
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
@@ -85,12 +105,14 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
     outputs->push_back(out);
   } else if (value.kind() == Datum::CHUNKED_ARRAY) {
     const ChunkedArray& array = *value.chunked_array();
-    for (int i = 0; i < array.num_chunks(); i++) {
-      Datum out;
-      out.value = ArrayData::Make(kernel->out_type(), array.chunk(i)->length());
-      RETURN_NOT_OK(kernel->Call(ctx, array.chunk(i), &out));
-      outputs->push_back(out);
-    }
+    std::vector<Datum> chunk_outputs(array.num_chunks());
+    RETURN_NOT_OK(ForEachChunk(
+        ctx, *kernel, array.num_chunks(), [&](FunctionContext* chunk_ctx, int i) {
+          Datum* out = &chunk_outputs[i];
+          out->value = ArrayData::Make(kernel->out_type(), array.chunk(i)->length());
+          return kernel->Call(chunk_ctx, array.chunk(i), out);
+        }));
+    outputs->insert(outputs->end(), chunk_outputs.begin(), chunk_outputs.end());
   } else {
     return Status::Invalid("Input Datum was not array-like");
   }
@@ -128,6 +150,9 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
     return Status::Invalid("Right and left have different lengths");
   }
   // TODO: Remove duplication with ChunkedArray::Equals
+  // Split both sides into pairs of aligned slices first, so that the kernel
+  // invocations can be dispatched independently
+  std::vector<std::pair<std::shared_ptr<Array>, std::shared_ptr<Array>>> operands;
   int left_chunk_idx = 0;
   int64_t left_start_idx = 0;
   int right_chunk_idx = 0;
@@ -139,13 +164,8 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
     const std::shared_ptr<Array> right_array = right_arrays[right_chunk_idx];
     int64_t common_length = std::min(left_array->length() - left_start_idx,
                                      right_array->length() - right_start_idx);
-    std::shared_ptr<Array> left_op = left_array->Slice(left_start_idx, common_length);
-    std::shared_ptr<Array> right_op = right_array->Slice(right_start_idx, common_length);
-
-    Datum output;
-    output.value = ArrayData::Make(kernel->out_type(), common_length);
-    RETURN_NOT_OK(kernel->Call(ctx, left_op, right_op, &output));
-    outputs->push_back(output);
+    operands.emplace_back(left_array->Slice(left_start_idx, common_length),
+                          right_array->Slice(right_start_idx, common_length));
 
     elements_compared += common_length;
     // If we have exhausted the current chunk, proceed to the next one individually.
@@ -163,6 +183,18 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
       right_start_idx += common_length;
     }
   } while (elements_compared < left_length);
+
+  std::vector<Datum> chunk_outputs(operands.size());
+  RETURN_NOT_OK(ForEachChunk(
+      ctx, *kernel, static_cast<int>(operands.size()),
+      [&](FunctionContext* chunk_ctx, int i) {
+        const auto& left_op = operands[i].first;
+        const auto& right_op = operands[i].second;
+        Datum* output = &chunk_outputs[i];
+        output->value = ArrayData::Make(kernel->out_type(), left_op->length());
+        return kernel->Call(chunk_ctx, left_op, right_op, output);
+      }));
+  outputs->insert(outputs->end(), chunk_outputs.begin(), chunk_outputs.end());
   return Status::OK();
 }
 
@@ -295,6 +327,171 @@ Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
   return Status::OK();
 }
 
+namespace {
+
+// Read the value at slot i of a boolean or int32 array, and write it to slot i
+// of the output
+template <typename OutType>
+struct GatherValues;
+
+template <>
+struct GatherValues<BooleanType> {
+  static bool Get(const ArrayData& data, int64_t i) {
+    return BitUtil::GetBit(data.buffers[1]->data(), data.offset + i);
+  }
+
+  template <typename GetValue>
+  static void Generate(int64_t length, GetValue&& get_value, uint8_t* out) {
+    internal::GenerateBitsUnrolled(out, 0, length, std::forward<GetValue>(get_value));
+  }
+};
+
+template <>
+struct GatherValues<Int32Type> {
+  static int32_t Get(const ArrayData& data, int64_t i) {
+    return data.GetValues<int32_t>(1)[i];
+  }
+
+  template <typename GetValue>
+  static void Generate(int64_t length, GetValue&& get_value, uint8_t* out) {
+    auto out_values = reinterpret_cast<int32_t*>(out);
+    for (int64_t i = 0; i < length; ++i) {
+      out_values[i] = get_value();
+    }
+  }
+};
+
+template <typename OutType, typename IndexCType>
+Status GatherDictionaryResultImpl(FunctionContext* ctx, const ArrayData& indices,
+                                  const ArrayData& dictionary_result,
+                                  const Scalar* null_result, ArrayData* out) {
+  using OutScalarType = typename TypeTraits<OutType>::ScalarType;
+  using Values = GatherValues<OutType>;
+
+  const int64_t length = indices.length;
+  const IndexCType* index_values = indices.GetValues<IndexCType>(1);
+  const uint8_t* index_validity =
+      indices.GetNullCount() > 0 ? indices.buffers[0]->data() : nullptr;
+  const uint8_t* result_validity =
+      dictionary_result.GetNullCount() > 0 ? dictionary_result.buffers[0]->data()
+                                           : nullptr;
+  auto index_is_valid = [&](int64_t i) {
+    return index_validity == nullptr ||
+           BitUtil::GetBit(index_validity, indices.offset + i);
+  };
+
+  bool null_result_is_valid = false;
+  decltype(Values::Get(dictionary_result, 0)) null_value{};
+  if (null_result != nullptr && null_result->is_valid) {
+    null_result_is_valid = true;
+    null_value = checked_cast<const OutScalarType&>(*null_result).value;
+  }
+
+  RETURN_NOT_OK(AllocateValueBuffer(ctx, *out->type, length, &out->buffers[1]));
+  int64_t i = 0;
+  if (index_validity == nullptr) {
+    Values::Generate(
+        length,
+        [&] { return Values::Get(dictionary_result, index_values[i++]); },
+        out->buffers[1]->mutable_data());
+  } else {
+    // The indices at null slots may be out of bounds
+    Values::Generate(
+        length,
+        [&] {
+          const bool valid = index_is_valid(i);
+          const auto value = Values::Get(dictionary_result, valid ? index_values[i] : 0);
+          ++i;
+          return valid ? value : null_value;
+        },
+        out->buffers[1]->mutable_data());
+  }
+
+  if (result_validity == nullptr && (index_validity == nullptr || null_result_is_valid)) {
+    out->buffers[0] = nullptr;
+    out->null_count = 0;
+    return Status::OK();
+  }
+  std::shared_ptr<Buffer> validity;
+  RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &validity));
+  i = 0;
+  internal::GenerateBitsUnrolled(validity->mutable_data(), 0, length, [&] {
+    bool valid;
+    if (index_is_valid(i)) {
+      valid = result_validity == nullptr ||
+              BitUtil::GetBit(result_validity,
+                              dictionary_result.offset + index_values[i]);
+    } else {
+      valid = null_result_is_valid;
+    }
+    ++i;
+    return valid;
+  });
+  out->buffers[0] = std::move(validity);
+  out->null_count = kUnknownNullCount;
+  out->GetNullCount();
+  return Status::OK();
+}
+
+template <typename OutType>
+Status GatherDictionaryResultOfType(FunctionContext* ctx, const ArrayData& indices,
+                                    const ArrayData& dictionary_result,
+                                    const Scalar* null_result, ArrayData* out) {
+  switch (indices.type->id()) {
+    case Type::INT8:
+      return GatherDictionaryResultImpl<OutType, int8_t>(ctx, indices, dictionary_result,
+                                                         null_result, out);
+    case Type::UINT8:
+      return GatherDictionaryResultImpl<OutType, uint8_t>(
+          ctx, indices, dictionary_result, null_result, out);
+    case Type::INT16:
+      return GatherDictionaryResultImpl<OutType, int16_t>(
+          ctx, indices, dictionary_result, null_result, out);
+    case Type::UINT16:
+      return GatherDictionaryResultImpl<OutType, uint16_t>(
+          ctx, indices, dictionary_result, null_result, out);
+    case Type::INT32:
+      return GatherDictionaryResultImpl<OutType, int32_t>(
+          ctx, indices, dictionary_result, null_result, out);
+    case Type::UINT32:
+      return GatherDictionaryResultImpl<OutType, uint32_t>(
+          ctx, indices, dictionary_result, null_result, out);
+    case Type::INT64:
+      return GatherDictionaryResultImpl<OutType, int64_t>(
+          ctx, indices, dictionary_result, null_result, out);
+    case Type::UINT64:
+      return GatherDictionaryResultImpl<OutType, uint64_t>(
+          ctx, indices, dictionary_result, null_result, out);
+    default:
+      return Status::TypeError("Invalid dictionary index type ", *indices.type);
+  }
+}
+
+}  // namespace
+
+Status GatherDictionaryResult(FunctionContext* ctx, const ArrayData& indices,
+                              const ArrayData& dictionary_result,
+                              const Scalar* null_result,
+                              std::shared_ptr<ArrayData>* out) {
+  auto result = ArrayData::Make(dictionary_result.type, indices.length,
+                                {nullptr, nullptr});
+  switch (dictionary_result.type->id()) {
+    case Type::BOOL:
+      RETURN_NOT_OK(GatherDictionaryResultOfType<BooleanType>(
+          ctx, indices, dictionary_result, null_result, result.get()));
+      break;
+    case Type::INT32:
+      RETURN_NOT_OK(GatherDictionaryResultOfType<Int32Type>(
+          ctx, indices, dictionary_result, null_result, result.get()));
+      break;
+    default:
+      return Status::NotImplemented("Gathering dictionary results of type ",
+                                    *dictionary_result.type);
+  }
+  *out = std::move(result);
+  return Status::OK();
+}
+
 Status PrimitiveAllocatingUnaryKernel::Call(FunctionContext* ctx, const Datum& input,
                                             Datum* out) {
   DCHECK_EQ(out->kind(), Datum::ARRAY);
@@ -46,6 +46,9 @@ namespace detail {
 
 /// \brief Invoke the kernel on value using the ctx and store results in outputs.
 ///
+/// The chunks of a ChunkedArray value are processed on the CPU thread pool if
+/// ctx->use_threads() and kernel->parallelizable() are both true.
+///
 /// \param[in,out] ctx The function context to use when invoking the kernel.
 /// \param[in,out] kernel The kernel to execute.
 /// \param[in] value The input value to execute the kernel with.
@@ -103,6 +106,25 @@ ARROW_EXPORT
 Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
                               const ArrayData& right, ArrayData* output);
 
+/// \brief Map the result of a kernel over the dictionary of a dictionary array
+/// through its indices, so that the kernel is evaluated once per dictionary
+/// entry rather than once per slot.
+///
+/// Slot i of the output is slot indices[i] of dictionary_result, or null_result
+/// if indices[i] is null.
+///
+/// \param[in] ctx the kernel FunctionContext
+/// \param[in] indices the indices of the dictionary array
+/// \param[in] dictionary_result a boolean or int32 array, with a slot for each
+/// dictionary entry
+/// \param[in] null_result the output for null indices, a scalar of the type of
+/// dictionary_result; null outputs if nullptr
+/// \param[out] out the output array
+ARROW_EXPORT
+Status GatherDictionaryResult(FunctionContext* ctx, const ArrayData& indices,
+                              const ArrayData& dictionary_result,
+                              const Scalar* null_result, std::shared_ptr<ArrayData>* out);
+
 ARROW_EXPORT
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays);
@@ -124,6 +146,8 @@ class ARROW_EXPORT PrimitiveAllocatingUnaryKernel : public UnaryKernel {
 
   std::shared_ptr<DataType> out_type() const override;
 
+  bool parallelizable() const override { return delegate_->parallelizable(); }
+
  private:
   UnaryKernel* delegate_;
 };
@@ -144,6 +168,8 @@ class ARROW_EXPORT PrimitiveAllocatingBinaryKernel : public BinaryKernel {
 
   std::shared_ptr<DataType> out_type() const override;
 
+  bool parallelizable() const override { return delegate_->parallelizable(); }
+
  private:
   BinaryKernel* delegate_;
 };
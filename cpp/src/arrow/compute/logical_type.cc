@@ -85,6 +85,60 @@ Status LogicalType::FromArrow(const ::arrow::DataType& type, LogicalTypePtr* out
   return Status::OK();
 }
 
+Status LogicalType::ToArrow(std::shared_ptr<::arrow::DataType>* out) const {
+  switch (id_) {
+    case LogicalType::NULL_:
+      *out = ::arrow::null();
+      break;
+    case LogicalType::BOOL:
+      *out = ::arrow::boolean();
+      break;
+    case LogicalType::UINT8:
+      *out = ::arrow::uint8();
+      break;
+    case LogicalType::INT8:
+      *out = ::arrow::int8();
+      break;
+    case LogicalType::UINT16:
+      *out = ::arrow::uint16();
+      break;
+    case LogicalType::INT16:
+      *out = ::arrow::int16();
+      break;
+    case LogicalType::UINT32:
+      *out = ::arrow::uint32();
+      break;
+    case LogicalType::INT32:
+      *out = ::arrow::int32();
+      break;
+    case LogicalType::UINT64:
+      *out = ::arrow::uint64();
+      break;
+    case LogicalType::INT64:
+      *out = ::arrow::int64();
+      break;
+    case LogicalType::FLOAT16:
+      *out = ::arrow::float16();
+      break;
+    case LogicalType::FLOAT32:
+      *out = ::arrow::float32();
+      break;
+    case LogicalType::FLOAT64:
+      *out = ::arrow::float64();
+      break;
+    case LogicalType::BINARY:
+      *out = ::arrow::binary();
+      break;
+    case LogicalType::UTF8:
+      *out = ::arrow::utf8();
+      break;
+    default:
+      return Status::NotImplemented("No concrete Arrow type for logical type ",
+                                    ToString());
+  }
+  return Status::OK();
+}
+
 namespace type {
 
 bool Any::IsInstance(const Expr& expr) const { return InheritsFrom<ValueExpr>(expr); }
@@ -84,6 +84,11 @@ class ARROW_EXPORT LogicalType {
   /// array type
   static Status FromArrow(const ::arrow::DataType& type, LogicalTypePtr* out);
 
+  /// \brief Get the concrete Arrow in-memory array type of a logical type
+  ///
+  /// Only concrete logical types (e.g. int32, not integer) have one.
+  Status ToArrow(std::shared_ptr<::arrow::DataType>* out) const;
+
  protected:
   explicit LogicalType(Id id) : id_(id) {}
   Id id_;
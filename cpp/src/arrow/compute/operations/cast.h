@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "arrow/compute/operation.h"
 #include "arrow/util/visibility.h"
@@ -35,6 +36,10 @@ class ARROW_EXPORT Cast : public Operation {
  public:
   Cast(std::shared_ptr<Expr> value, std::shared_ptr<LogicalType> out_type);
   Status ToExpr(std::shared_ptr<Expr>* out) const override;
+  std::vector<std::shared_ptr<Expr>> input_args() const override;
+
+  const std::shared_ptr<Expr>& value() const { return value_; }
+  const std::shared_ptr<LogicalType>& out_type() const { return out_type_; }
 
  private:
   std::shared_ptr<Expr> value_;
@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/compute/operation.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace compute {
+namespace ops {
+
+/// \brief A column operation creates an array expression from a named column
+/// of the record batches an expression is evaluated on
+class ARROW_EXPORT Column : public Operation {
+ public:
+  Column(std::string name, std::shared_ptr<DataType> type);
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+
+  const std::string& name() const { return name_; }
+  const std::shared_ptr<DataType>& type() const { return type_; }
+
+ private:
+  std::string name_;
+  std::shared_ptr<DataType> type_;
+};
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/operations/elementwise.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/expression.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace compute {
+namespace ops {
+
+BinaryOperation::BinaryOperation(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right)
+    : left_(std::move(left)), right_(std::move(right)) {}
+
+std::vector<std::shared_ptr<Expr>> BinaryOperation::input_args() const {
+  return {left_, right_};
+}
+
+Status BinaryOperation::MakeExpr(const LogicalType& input_type,
+                                 std::shared_ptr<LogicalType> out_type,
+                                 std::shared_ptr<Expr>* out) const {
+  if (!input_type.IsInstance(*left_) || !input_type.IsInstance(*right_)) {
+    return Status::Invalid("Operation only applies to ", input_type.ToString(),
+                           " expressions");
+  }
+  const auto& left_expr = static_cast<const ValueExpr&>(*left_);
+  const auto& right_expr = static_cast<const ValueExpr&>(*right_);
+  if (left_expr.type()->id() != right_expr.type()->id()) {
+    return Status::TypeError("Operation inputs have differing types ",
+                             left_expr.type()->ToString(), " and ",
+                             right_expr.type()->ToString());
+  }
+
+  auto op = shared_from_this();
+  if (left_expr.rank() == ValueRank::SCALAR && right_expr.rank() == ValueRank::SCALAR) {
+    return GetScalarExpr(op, std::move(out_type), out);
+  } else {
+    return GetArrayExpr(op, std::move(out_type), out);
+  }
+}
+
+Add::Add(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right)
+    : BinaryOperation(std::move(left), std::move(right)) {}
+
+Status Add::ToExpr(std::shared_ptr<Expr>* out) const {
+  auto value_ty = type::number();
+  if (!value_ty->IsInstance(*left_)) {
+    return Status::Invalid("Add only applies to numeric expressions");
+  }
+  return MakeExpr(*value_ty, static_cast<const ValueExpr&>(*left_).type(), out);
+}
+
+Compare::Compare(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right,
+                 CompareOperator op)
+    : BinaryOperation(std::move(left), std::move(right)), op_(op) {}
+
+Status Compare::ToExpr(std::shared_ptr<Expr>* out) const {
+  return MakeExpr(*type::any(), type::boolean(), out);
+}
+
+And::And(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right)
+    : BinaryOperation(std::move(left), std::move(right)) {}
+
+Status And::ToExpr(std::shared_ptr<Expr>* out) const {
+  return MakeExpr(*type::boolean(), type::boolean(), out);
+}
+
+Or::Or(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right)
+    : BinaryOperation(std::move(left), std::move(right)) {}
+
+Status Or::ToExpr(std::shared_ptr<Expr>* out) const {
+  return MakeExpr(*type::boolean(), type::boolean(), out);
+}
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
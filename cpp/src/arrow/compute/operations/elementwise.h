@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/operation.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class LogicalType;
+
+namespace ops {
+
+/// \brief Base class for element-wise operations on two value expressions
+///
+/// The result is an array expression if either input is one, a scalar
+/// expression otherwise.
+class ARROW_EXPORT BinaryOperation : public Operation {
+ public:
+  std::vector<std::shared_ptr<Expr>> input_args() const override;
+
+  const std::shared_ptr<Expr>& left() const { return left_; }
+  const std::shared_ptr<Expr>& right() const { return right_; }
+
+ protected:
+  BinaryOperation(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right);
+
+  /// \brief Check that both inputs are values of the same logical type,
+  /// which is an instance of input_type, and create the output expression
+  Status MakeExpr(const LogicalType& input_type, std::shared_ptr<LogicalType> out_type,
+                  std::shared_ptr<Expr>* out) const;
+
+  std::shared_ptr<Expr> left_;
+  std::shared_ptr<Expr> right_;
+};
+
+/// \brief Sum of two numbers of the same type
+class ARROW_EXPORT Add : public BinaryOperation {
+ public:
+  Add(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right);
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+};
+
+/// \brief Comparison of two values of the same type, yielding a boolean
+class ARROW_EXPORT Compare : public BinaryOperation {
+ public:
+  Compare(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right,
+          CompareOperator op);
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+
+  CompareOperator op() const { return op_; }
+
+ private:
+  CompareOperator op_;
+};
+
+/// \brief Logical AND of two booleans, null if either is null
+class ARROW_EXPORT And : public BinaryOperation {
+ public:
+  And(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right);
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+};
+
+/// \brief Logical OR of two booleans, null if either is null
+class ARROW_EXPORT Or : public BinaryOperation {
+ public:
+  Or(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right);
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+};
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
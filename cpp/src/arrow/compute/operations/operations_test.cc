@@ -33,6 +33,8 @@
 #include "arrow/compute/logical_type.h"
 #include "arrow/compute/operation.h"
 #include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/column.h"
+#include "arrow/compute/operations/elementwise.h"
 #include "arrow/compute/operations/literal.h"
 
 namespace arrow {
@@ -60,5 +62,38 @@ TEST(Cast, Basics) {
   ASSERT_TRUE(InheritsFrom<array::Float64>(*out_expr));
 }
 
+TEST(Column, Basics) {
+  std::shared_ptr<Expr> expr;
+  ASSERT_OK(std::make_shared<ops::Column>("f", int16())->ToExpr(&expr));
+  ASSERT_TRUE(InheritsFrom<array::Int16>(*expr));
+}
+
+TEST(Elementwise, Basics) {
+  auto dummy_op = std::make_shared<DummyOp>();
+  auto ints = array::int32(dummy_op);
+  auto int_scalar = scalar::int32(dummy_op);
+  auto doubles = array::float64(dummy_op);
+  auto bools = array::boolean(dummy_op);
+  auto bool_scalar = scalar::boolean(dummy_op);
+  std::shared_ptr<Expr> out_expr;
+
+  ASSERT_OK(std::make_shared<ops::Add>(ints, int_scalar)->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<array::Int32>(*out_expr));
+  ASSERT_OK(std::make_shared<ops::Add>(int_scalar, int_scalar)->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<scalar::Int32>(*out_expr));
+  ASSERT_RAISES(TypeError, std::make_shared<ops::Add>(ints, doubles)->ToExpr(&out_expr));
+  ASSERT_RAISES(Invalid, std::make_shared<ops::Add>(bools, bools)->ToExpr(&out_expr));
+
+  ASSERT_OK(std::make_shared<ops::Compare>(doubles, doubles, CompareOperator::LESS)
+                ->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<array::Bool>(*out_expr));
+
+  ASSERT_OK(std::make_shared<ops::And>(bool_scalar, bools)->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<array::Bool>(*out_expr));
+  ASSERT_OK(std::make_shared<ops::Or>(bool_scalar, bool_scalar)->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<scalar::Bool>(*out_expr));
+  ASSERT_RAISES(Invalid, std::make_shared<ops::Or>(bools, ints)->ToExpr(&out_expr));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -230,6 +230,9 @@ class InferringColumnBuilder : public ColumnBuilder {
   Status TryConvertChunk(size_t chunk_index);
   // This must be called unlocked!
   void ScheduleConvertChunk(size_t chunk_index);
+  // These must be called locked
+  void ScheduleDeferredChunks(std::unique_lock<std::mutex>* lock);
+  void RescheduleStaleChunks(size_t except_index, std::unique_lock<std::mutex>* lock);
 
   std::mutex mutex_;
 
@@ -257,8 +260,18 @@ class InferringColumnBuilder : public ColumnBuilder {
   InferKind infer_kind_;
   bool can_loosen_type_;
 
+  // The first chunk is a sample that fixes the type up front: until it is
+  // converted, the following chunks are only recorded, so that they are
+  // converted once with the inferred type rather than tried with each type
+  // in turn.
+  enum class SampleState { NotStarted, InProgress, Done };
+  SampleState sample_state_ = SampleState::NotStarted;
+  std::vector<size_t> deferred_chunks_;
+
   // The parsers corresponding to each chunk (for reconverting)
   std::vector<std::shared_ptr<BlockParser>> parsers_;
+  // The type each chunk was converted with
+  std::vector<InferKind> chunk_kinds_;
 };
 
 Status InferringColumnBuilder::Init() {
@@ -362,60 +375,80 @@ void InferringColumnBuilder::ScheduleConvertChunk(size_t chunk_index) {
   task_group_->Append([=]() { return TryConvertChunk(chunk_index); });
 }
 
+void InferringColumnBuilder::ScheduleDeferredChunks(std::unique_lock<std::mutex>* lock) {
+  std::vector<size_t> deferred = std::move(deferred_chunks_);
+  deferred_chunks_.clear();
+  lock->unlock();
+  for (size_t chunk_index : deferred) {
+    ScheduleConvertChunk(chunk_index);
+  }
+  lock->lock();
+}
+
+void InferringColumnBuilder::RescheduleStaleChunks(size_t except_index,
+                                                   std::unique_lock<std::mutex>* lock) {
+  // Reconvert past finished chunks
+  // (unfinished chunks will notice by themselves if they need reconverting)
+  const size_t nchunks = chunks_.size();
+  for (size_t i = 0; i < nchunks; ++i) {
+    if (i != except_index && chunks_[i] && chunk_kinds_[i] != infer_kind_) {
+      chunks_[i].reset();
+      lock->unlock();
+      ScheduleConvertChunk(i);
+      lock->lock();
+    }
+  }
+}
+
 Status InferringColumnBuilder::TryConvertChunk(size_t chunk_index) {
   std::unique_lock<std::mutex> lock(mutex_);
-  std::shared_ptr<Converter> converter = converter_;
   std::shared_ptr<BlockParser> parser = parsers_[chunk_index];
-  InferKind kind = infer_kind_;
+  bool loosened = false;
 
   DCHECK_NE(parser, nullptr);
 
-  lock.unlock();
-  auto maybe_array = converter->Convert(*parser, col_index_);
-  lock.lock();
+  // Try converting with the current type, loosening it on failure.  This chunk
+  // is retried serially, other chunks are only reconverted once it succeeds.
+  while (true) {
+    std::shared_ptr<Converter> converter = converter_;
+    InferKind kind = infer_kind_;
 
-  if (kind != infer_kind_) {
-    // infer_kind_ was changed by another task, reconvert
     lock.unlock();
-    ScheduleConvertChunk(chunk_index);
-    return Status::OK();
-  }
+    auto maybe_array = converter->Convert(*parser, col_index_);
+    lock.lock();
 
-  if (maybe_array.ok()) {
-    // Conversion succeeded
-    chunks_[chunk_index] = std::move(*maybe_array);
+    if (kind != infer_kind_) {
+      // infer_kind_ was changed by another task, reconvert
+      continue;
+    }
+    if (maybe_array.ok()) {
+      // Conversion succeeded
+      chunks_[chunk_index] = std::move(*maybe_array);
+      chunk_kinds_[chunk_index] = kind;
+      if (!can_loosen_type_) {
+        // We won't try to reconvert anymore
+        parsers_[chunk_index].reset();
+      }
+      break;
+    }
     if (!can_loosen_type_) {
-      // We won't try to reconvert anymore
-      parsers_[chunk_index].reset();
+      // Conversion failed but cannot loosen more
+      return maybe_array.status();
     }
-    return Status::OK();
-  } else if (can_loosen_type_) {
     // Conversion failed, try another type
     RETURN_NOT_OK(LoosenType(maybe_array.status()));
+    loosened = true;
+  }
 
-    // Reconvert past finished chunks
-    // (unfinished chunks will notice by themselves if they need reconverting)
-    size_t nchunks = chunks_.size();
-    for (size_t i = 0; i < nchunks; ++i) {
-      if (i != chunk_index && chunks_[i]) {
-        // We're assuming the chunk was converted using the wrong type
-        // (which should be true unless the executor reorders tasks)
-        chunks_[i].reset();
-        lock.unlock();
-        ScheduleConvertChunk(i);
-        lock.lock();
-      }
-    }
-
-    // Reconvert this chunk
-    lock.unlock();
-    ScheduleConvertChunk(chunk_index);
-
-    return Status::OK();
-  } else {
-    // Conversion failed but cannot loosen more
-    return maybe_array.status();
+  if (loosened) {
+    RescheduleStaleChunks(chunk_index, &lock);
+  }
+  if (chunk_index == 0 && sample_state_ == SampleState::InProgress) {
+    // The type is inferred, convert the chunks that were waiting for it
+    sample_state_ = SampleState::Done;
+    ScheduleDeferredChunks(&lock);
   }
+  return Status::OK();
 }
 
 void InferringColumnBuilder::Insert(int64_t block_index,
@@ -428,6 +461,7 @@ void InferringColumnBuilder::Insert(int64_t block_index,
     DCHECK_NE(converter_, nullptr);
     if (chunks_.size() <= chunk_index) {
       chunks_.resize(chunk_index + 1);
+      chunk_kinds_.resize(chunk_index + 1);
     }
     if (parsers_.size() <= chunk_index) {
       parsers_.resize(chunk_index + 1);
@@ -435,6 +469,14 @@ void InferringColumnBuilder::Insert(int64_t block_index,
     // Should not insert an already converting chunk
     DCHECK_EQ(parsers_[chunk_index], nullptr);
     parsers_[chunk_index] = parser;
+
+    if (chunk_index == 0 && sample_state_ == SampleState::NotStarted) {
+      sample_state_ = SampleState::InProgress;
+    } else if (sample_state_ == SampleState::InProgress) {
+      // Wait for the sample to fix the type
+      deferred_chunks_.push_back(chunk_index);
+      return;
+    }
   }
 
   ScheduleConvertChunk(chunk_index);
@@ -456,6 +498,7 @@ Result<std::shared_ptr<ChunkedArray>> InferringColumnBuilder::Finish() {
   auto ptr = std::make_shared<ChunkedArray>(chunks_, infer_type_);
   chunks_.clear();
   parsers_.clear();
+  chunk_kinds_.clear();
   return ptr;
 }
 
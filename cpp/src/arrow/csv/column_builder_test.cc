@@ -424,6 +424,21 @@ TEST(InferringColumnBuilder, MultipleChunkIntegerParallel) {
   CheckInferred(tg, {{"1", "2"}, {"3"}, {"4", "5"}, {"6", "7"}}, options, expected);
 }
 
+TEST(InferringColumnBuilder, MultipleChunkLoosenedParallel) {
+  // The type inferred from the first chunk is loosened by later chunks
+  auto options = ConvertOptions::Defaults();
+  auto tg = TaskGroup::MakeThreaded(GetCpuThreadPool());
+
+  std::shared_ptr<ChunkedArray> expected;
+  ChunkedArrayFromVector<DoubleType>({{1, 2}, {3}, {4.5}, {6, 7}}, &expected);
+  CheckInferred(tg, {{"1", "2"}, {"3"}, {"4.5"}, {"6", "7"}}, options, expected);
+
+  tg = TaskGroup::MakeThreaded(GetCpuThreadPool());
+  ChunkedArrayFromVector<StringType, std::string>(
+      {{"1", "2"}, {"3"}, {"4.5"}, {"x"}, {"6"}}, &expected);
+  CheckInferred(tg, {{"1", "2"}, {"3"}, {"4.5"}, {"x"}, {"6"}}, options, expected);
+}
+
 void CheckAutoDictEncoded(const std::shared_ptr<TaskGroup>& tg, const ChunkData& csv_data,
                           const ConvertOptions& options,
                           std::vector<std::shared_ptr<Array>> expected_indices,
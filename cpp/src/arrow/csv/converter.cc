@@ -24,6 +24,8 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/csv/parser.h"
 #include "arrow/memory_pool.h"
@@ -31,6 +33,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/parsing.h"  // IWYU pragma: keep
 #include "arrow/util/trie.h"
 #include "arrow/util/utf8.h"
@@ -39,8 +42,7 @@ namespace arrow {
 namespace csv {
 
 using internal::StringConverter;
-using internal::Trie;
-using internal::TrieBuilder;
+using internal::TokenMatcher;
 
 namespace {
 
@@ -80,33 +82,29 @@ inline void TrimWhiteSpace(const uint8_t** data_inout, uint32_t* size_inout) {
   }
 }
 
-Status InitializeTrie(const std::vector<std::string>& inputs, Trie* trie) {
-  TrieBuilder builder;
-  for (const auto& s : inputs) {
-    RETURN_NOT_OK(builder.Append(s, true /* allow_duplicates */));
-  }
-  *trie = builder.Finish();
+Status InitializeMatcher(const std::vector<std::string>& inputs, TokenMatcher* matcher) {
+  ARROW_ASSIGN_OR_RAISE(*matcher, TokenMatcher::Make(inputs));
   return Status::OK();
 }
 
 class ConcreteConverterMixin {
  protected:
-  Status InitializeNullTrie(const ConvertOptions& options);
+  Status InitializeNullMatcher(const ConvertOptions& options);
 
   bool IsNull(const uint8_t* data, uint32_t size, bool quoted) {
     if (quoted) {
       return false;
     }
-    return null_trie_.Find(
+    return null_matcher_.Find(
                util::string_view(reinterpret_cast<const char*>(data), size)) >= 0;
   }
 
-  Trie null_trie_;
+  TokenMatcher null_matcher_;
 };
 
-Status ConcreteConverterMixin::InitializeNullTrie(const ConvertOptions& options) {
-  // TODO no need to build a separate Trie for each Converter instance
-  return InitializeTrie(options.null_values, &null_trie_);
+Status ConcreteConverterMixin::InitializeNullMatcher(const ConvertOptions& options) {
+  // TODO no need to build a separate matcher for each Converter instance
+  return InitializeMatcher(options.null_values, &null_matcher_);
 }
 
 class ConcreteConverter : public Converter, public ConcreteConverterMixin {
@@ -114,7 +112,7 @@ class ConcreteConverter : public Converter, public ConcreteConverterMixin {
   using Converter::Converter;
 
  protected:
-  Status Initialize() override { return InitializeNullTrie(options_); }
+  Status Initialize() override { return InitializeNullMatcher(options_); }
 };
 
 class ConcreteDictionaryConverter : public DictionaryConverter,
@@ -123,7 +121,7 @@ class ConcreteDictionaryConverter : public DictionaryConverter,
   using DictionaryConverter::DictionaryConverter;
 
  protected:
-  Status Initialize() override { return InitializeNullTrie(options_); }
+  Status Initialize() override { return InitializeNullMatcher(options_); }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -161,6 +159,14 @@ class BinaryConverter : public ConcreteConverter {
 
   Result<std::shared_ptr<Array>> Convert(const BlockParser& parser,
                                          int32_t col_index) override {
+    if (parser.num_cols() == 1) {
+      // The values are contiguous in the parsed data, no need to copy them
+      ARROW_ASSIGN_OR_RAISE(auto array, ConvertContiguous(parser));
+      if (array) {
+        return array;
+      }
+    }
+
     using BuilderType = typename TypeTraits<T>::BuilderType;
     BuilderType builder(pool_);
 
@@ -173,8 +179,15 @@ class BinaryConverter : public ConcreteConverter {
       return Status::OK();
     };
 
+    // Size the value data for this column, rather than the whole block
+    int64_t data_length = 0;
+    RETURN_NOT_OK(
+        parser.VisitColumn(col_index, [&](const uint8_t*, uint32_t size, bool) -> Status {
+          data_length += size;
+          return Status::OK();
+        }));
     RETURN_NOT_OK(builder.Resize(parser.num_rows()));
-    RETURN_NOT_OK(builder.ReserveData(parser.num_bytes()));
+    RETURN_NOT_OK(builder.ReserveData(data_length));
 
     if (options_.strings_can_be_null) {
       auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
@@ -200,6 +213,52 @@ class BinaryConverter : public ConcreteConverter {
     util::InitializeUTF8();
     return ConcreteConverter::Initialize();
   }
+
+  // Make an array pointing to the parsed data, which only holds the values
+  // of a single column.  Returns null if the column has null values, as those
+  // must have empty slots.
+  Result<std::shared_ptr<Array>> ConvertContiguous(const BlockParser& parser) {
+    using offset_type = typename T::offset_type;
+    const int64_t length = parser.num_rows();
+    const auto& parsed_buffer = parser.parsed_buffer();
+
+    std::shared_ptr<Buffer> offsets_buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, (length + 1) * sizeof(offset_type),
+                                 &offsets_buffer));
+    auto offsets = reinterpret_cast<offset_type*>(offsets_buffer->mutable_data());
+    offsets[0] = 0;
+
+    int64_t i = 0;
+    bool has_nulls = false;
+    RETURN_NOT_OK(
+        parser.VisitColumn(0, [&](const uint8_t* data, uint32_t size, bool) -> Status {
+          if (options_.strings_can_be_null && IsNull(data, size, false /* quoted */)) {
+            has_nulls = true;
+          }
+          if (CheckUTF8 && ARROW_PREDICT_FALSE(!util::ValidateUTF8(data, size))) {
+            return Status::Invalid("CSV conversion error to ", type_->ToString(),
+                                   ": invalid UTF8 data");
+          }
+          offsets[i + 1] = static_cast<offset_type>(offsets[i] + size);
+          ++i;
+          return Status::OK();
+        }));
+    DCHECK_EQ(i, length);
+    if (has_nulls) {
+      return nullptr;
+    }
+
+    std::shared_ptr<Buffer> data_buffer;
+    if (parsed_buffer) {
+      DCHECK_EQ(offsets[length], static_cast<offset_type>(parser.num_bytes()));
+      data_buffer = SliceBuffer(parsed_buffer, 0, offsets[length]);
+    } else {
+      RETURN_NOT_OK(AllocateBuffer(pool_, 0, &data_buffer));
+    }
+    return MakeArray(ArrayData::Make(
+        type_, length, {nullptr, std::move(offsets_buffer), std::move(data_buffer)},
+        /*null_count=*/0));
+  }
 };
 
 template <typename T, bool CheckUTF8>
@@ -304,13 +363,12 @@ class BooleanConverter : public ConcreteConverter {
         builder.UnsafeAppendNull();
         return Status::OK();
       }
-      if (false_trie_.Find(
-              util::string_view(reinterpret_cast<const char*>(data), size)) >= 0) {
+      const util::string_view value(reinterpret_cast<const char*>(data), size);
+      if (false_matcher_.Find(value) >= 0) {
         builder.UnsafeAppend(false);
         return Status::OK();
       }
-      if (true_trie_.Find(util::string_view(reinterpret_cast<const char*>(data), size)) >=
-          0) {
+      if (true_matcher_.Find(value) >= 0) {
         builder.UnsafeAppend(true);
         return Status::OK();
       }
@@ -326,14 +384,14 @@ class BooleanConverter : public ConcreteConverter {
 
  protected:
   Status Initialize() override {
-    // TODO no need to build separate Tries for each BooleanConverter instance
-    RETURN_NOT_OK(InitializeTrie(options_.true_values, &true_trie_));
-    RETURN_NOT_OK(InitializeTrie(options_.false_values, &false_trie_));
+    // TODO no need to build separate matchers for each BooleanConverter instance
+    RETURN_NOT_OK(InitializeMatcher(options_.true_values, &true_matcher_));
+    RETURN_NOT_OK(InitializeMatcher(options_.false_values, &false_matcher_));
     return ConcreteConverter::Initialize();
   }
 
-  Trie true_trie_;
-  Trie false_trie_;
+  TokenMatcher true_matcher_;
+  TokenMatcher false_matcher_;
 };
 
 /////////////////////////////////////////////////////////////////////////
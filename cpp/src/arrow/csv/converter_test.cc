@@ -222,6 +222,42 @@ TEST(StringConversion, Errors) { TestStringConversionErrors<StringType>(); }
 
 TEST(LargeStringConversion, Errors) { TestStringConversionErrors<LargeStringType>(); }
 
+TEST(StringConversion, SingleColumn) {
+  // A single column's values are converted without copying the parsed data
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<Array> array, expected_array;
+  MakeColumnParser({"ab", "", "cdé", "N/A", "\"f,g\""}, &parser);
+
+  ASSERT_OK_AND_ASSIGN(auto converter,
+                       Converter::Make(utf8(), ConvertOptions::Defaults()));
+  ASSERT_OK_AND_ASSIGN(array, converter->Convert(*parser, 0));
+  ASSERT_OK(array->ValidateFull());
+  ArrayFromVector<StringType, std::string>(utf8(), {"ab", "", "cdé", "N/A", "f,g"},
+                                           &expected_array);
+  AssertArraysEqual(*expected_array, *array);
+  ASSERT_EQ(parser->parsed_buffer()->data(), array->data()->buffers[2]->data());
+
+  // Null values are copied as empty slots
+  auto options = ConvertOptions::Defaults();
+  options.strings_can_be_null = true;
+  ASSERT_OK_AND_ASSIGN(converter, Converter::Make(utf8(), options));
+  ASSERT_OK_AND_ASSIGN(array, converter->Convert(*parser, 0));
+  ASSERT_OK(array->ValidateFull());
+  ArrayFromVector<StringType, std::string>(utf8(), {true, false, true, false, true},
+                                           {"ab", "", "cdé", "", "f,g"},
+                                           &expected_array);
+  AssertArraysEqual(*expected_array, *array);
+
+  MakeColumnParser({"ab", "\xff"}, &parser);
+  ASSERT_OK_AND_ASSIGN(converter, Converter::Make(utf8(), ConvertOptions::Defaults()));
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 0));
+  ASSERT_OK_AND_ASSIGN(converter, Converter::Make(binary(), ConvertOptions::Defaults()));
+  ASSERT_OK_AND_ASSIGN(array, converter->Convert(*parser, 0));
+  ASSERT_OK(array->ValidateFull());
+  ArrayFromVector<BinaryType, std::string>(binary(), {"ab", "\xff"}, &expected_array);
+  AssertArraysEqual(*expected_array, *array);
+}
+
 TEST(FixedSizeBinaryConversion, Basics) {
   AssertConversion<FixedSizeBinaryType, std::string>(
       fixed_size_binary(2), {"ab,cd\n", "gh,ij\n"}, {{"ab", "gh"}, {"cd", "ij"}});
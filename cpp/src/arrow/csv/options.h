@@ -24,12 +24,19 @@
 #include <unordered_map>
 #include <vector>
 
+#include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
 class DataType;
 
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace csv {
 
 // Silly workaround for https://github.com/michaeljones/breathe/issues/453
@@ -111,6 +118,9 @@ struct ARROW_EXPORT ReadOptions {
 
   /// Whether to use the global CPU thread pool
   bool use_threads = true;
+  /// Thread pool, e.g. a logical executor (see ThreadPool::MakeExecutor), to
+  /// use instead of the global CPU thread pool when use_threads is true
+  internal::ThreadPool* thread_pool = NULLPTR;
   /// Block size we request from the IO layer; also determines the size of
   /// chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
@@ -129,6 +139,21 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// Whether to write a first row with the column names
+  bool include_header = true;
+  /// Whether to use the global CPU thread pool
+  bool use_threads = true;
+  /// Maximum number of rows formatted at once; also determines the size of
+  /// the units formatted in parallel when use_threads is true
+  int32_t batch_size = 1024;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
 
@@ -19,12 +19,20 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
 
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/neon_util.h"
+#include "arrow/util/sse_util.h"
+
+#ifdef ARROW_HAVE_NEON
+#include <arm_neon.h>
+#endif
 
 namespace arrow {
 namespace csv {
@@ -74,19 +82,116 @@ class SpecializedOptions {
   static constexpr bool escaping = Escaping;
 };
 
+// A helper class finding runs of ordinary field characters, i.e. characters
+// that don't need any special handling by the parsing state machine, several
+// bytes at a time.  The state machine then only needs to be run on the special
+// characters (delimiters, quotes, escapes and control characters).
+#if defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
+#define ARROW_CSV_BULK_SCAN 1
+
+template <typename SpecializedOptions>
+class BulkFieldScanner {
+ public:
+  static constexpr int32_t kBatchSize = 16;
+
+  explicit BulkFieldScanner(const ParseOptions& options)
+#ifdef ARROW_HAVE_SSE4_2
+      : delimiter_(_mm_set1_epi8(options.delimiter)),
+        quote_(_mm_set1_epi8(options.quote_char)),
+        escape_(_mm_set1_epi8(options.escape_char)),
+        max_control_(_mm_set1_epi8(' ' - 1)) {
+  }
+#else
+      : delimiter_(vdupq_n_u8(static_cast<uint8_t>(options.delimiter))),
+        quote_(vdupq_n_u8(static_cast<uint8_t>(options.quote_char))),
+        escape_(vdupq_n_u8(static_cast<uint8_t>(options.escape_char))),
+        max_control_(vdupq_n_u8(' ' - 1)) {
+  }
+#endif
+
+  // Return the number of leading ordinary characters in the kBatchSize bytes at
+  // `data`, for a non-quoted field (the delimiter, escape and control
+  // characters are special).
+  int32_t ScanUnquoted(const char* data) const {
+#ifdef ARROW_HAVE_SSE4_2
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    __m128i special = _mm_cmpeq_epi8(v, delimiter_);
+    // Unsigned v <= max_control_
+    special = _mm_or_si128(special, _mm_cmpeq_epi8(_mm_min_epu8(v, max_control_), v));
+    if (SpecializedOptions::escaping) {
+      special = _mm_or_si128(special, _mm_cmpeq_epi8(v, escape_));
+    }
+    return FirstSpecial(special);
+#else
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data));
+    uint8x16_t special = vceqq_u8(v, delimiter_);
+    special = vorrq_u8(special, vcleq_u8(v, max_control_));
+    if (SpecializedOptions::escaping) {
+      special = vorrq_u8(special, vceqq_u8(v, escape_));
+    }
+    return FirstSpecial(special);
+#endif
+  }
+
+  // Same as ScanUnquoted(), but for a quoted field (only the quote and escape
+  // characters are special).
+  int32_t ScanQuoted(const char* data) const {
+#ifdef ARROW_HAVE_SSE4_2
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    __m128i special = _mm_cmpeq_epi8(v, quote_);
+    if (SpecializedOptions::escaping) {
+      special = _mm_or_si128(special, _mm_cmpeq_epi8(v, escape_));
+    }
+    return FirstSpecial(special);
+#else
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data));
+    uint8x16_t special = vceqq_u8(v, quote_);
+    if (SpecializedOptions::escaping) {
+      special = vorrq_u8(special, vceqq_u8(v, escape_));
+    }
+    return FirstSpecial(special);
+#endif
+  }
+
+ protected:
+#ifdef ARROW_HAVE_SSE4_2
+  static int32_t FirstSpecial(__m128i special) {
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+    return mask == 0 ? kBatchSize : BitUtil::CountTrailingZeros(mask);
+  }
+
+  const __m128i delimiter_, quote_, escape_, max_control_;
+#else
+  static int32_t FirstSpecial(uint8x16_t special) {
+    // Narrow each byte of the comparison result to a nibble
+    const uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(special), 4)), 0);
+    return mask == 0 ? kBatchSize : BitUtil::CountTrailingZeros(mask) / 4;
+  }
+
+  const uint8x16_t delimiter_, quote_, escape_, max_control_;
+#endif
+};
+
+#endif  // defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
+
 // A helper class allocating the buffer for parsed values and writing into it
 // without any further resizes, except at the end.
 class BlockParser::PresizedParsedWriter {
  public:
   PresizedParsedWriter(MemoryPool* pool, uint32_t size)
-      : parsed_size_(0), parsed_capacity_(size) {
-    ARROW_CHECK_OK(AllocateResizableBuffer(pool, parsed_capacity_, &parsed_buffer_));
+      : pool_(pool), parsed_size_(0), parsed_capacity_(size) {}
+
+  Status Init() {
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, parsed_capacity_, &parsed_buffer_));
     parsed_ = parsed_buffer_->mutable_data();
+    return Status::OK();
   }
 
-  void Finish(std::shared_ptr<Buffer>* out_parsed) {
-    ARROW_CHECK_OK(parsed_buffer_->Resize(parsed_size_));
+  Status Finish(std::shared_ptr<Buffer>* out_parsed) {
+    RETURN_NOT_OK(parsed_buffer_->Resize(parsed_size_));
     *out_parsed = parsed_buffer_;
+    return Status::OK();
   }
 
   void BeginLine() { saved_parsed_size_ = parsed_size_; }
@@ -96,12 +201,24 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Push the first `size` chars of the kBatchSize chars at `data`.
+  // The parsed buffer never holds more bytes than were consumed from the CSV
+  // data, so there is always room for a whole batch if it is readable.
+  template <int32_t kBatchSize>
+  void PushFieldBatch(const char* data, int32_t size) {
+    DCHECK_LE(size, kBatchSize);
+    DCHECK_LE(parsed_size_ + kBatchSize, parsed_capacity_);
+    memcpy(parsed_ + parsed_size_, data, kBatchSize);
+    parsed_size_ += size;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
   int64_t size() { return parsed_size_; }
 
  protected:
+  MemoryPool* pool_;
   std::shared_ptr<ResizableBuffer> parsed_buffer_;
   uint8_t* parsed_;
   int64_t parsed_size_;
@@ -116,10 +233,13 @@ class BlockParser::PresizedParsedWriter {
 class BlockParser::ResizableValuesWriter {
  public:
   explicit ResizableValuesWriter(MemoryPool* pool)
-      : values_size_(0), values_capacity_(256) {
-    ARROW_CHECK_OK(AllocateResizableBuffer(pool, values_capacity_ * sizeof(*values_),
-                                           &values_buffer_));
+      : pool_(pool), values_size_(0), values_capacity_(256) {}
+
+  Status Init() {
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, values_capacity_ * sizeof(*values_),
+                                          &values_buffer_));
     values_ = reinterpret_cast<ValueDesc*>(values_buffer_->mutable_data());
+    return Status::OK();
   }
 
   template <typename ParsedWriter>
@@ -127,11 +247,16 @@ class BlockParser::ResizableValuesWriter {
     PushValue({static_cast<uint32_t>(parsed_writer.size()) & 0x7fffffffU, false});
   }
 
-  void Finish(std::shared_ptr<Buffer>* out_values) {
-    ARROW_CHECK_OK(values_buffer_->Resize(values_size_ * sizeof(*values_)));
+  Status Finish(std::shared_ptr<Buffer>* out_values) {
+    RETURN_NOT_OK(status_);
+    RETURN_NOT_OK(values_buffer_->Resize(values_size_ * sizeof(*values_)));
     *out_values = values_buffer_;
+    return Status::OK();
   }
 
+  // The error of a failed resize, if any
+  const Status& status() const { return status_; }
+
   void BeginLine() { saved_values_size_ = values_size_; }
 
   void StartField(bool quoted) { quoted_ = quoted; }
@@ -147,13 +272,22 @@ class BlockParser::ResizableValuesWriter {
  protected:
   void PushValue(ValueDesc v) {
     if (ARROW_PREDICT_FALSE(values_size_ == values_capacity_)) {
+      // A failed resize is remembered and reported at the end of the line,
+      // further values are dropped in the meantime
+      if (status_.ok()) {
+        status_ = values_buffer_->Resize(values_capacity_ * 2 * sizeof(*values_));
+      }
+      if (!status_.ok()) {
+        return;
+      }
       values_capacity_ = values_capacity_ * 2;
-      ARROW_CHECK_OK(values_buffer_->Resize(values_capacity_ * sizeof(*values_)));
       values_ = reinterpret_cast<ValueDesc*>(values_buffer_->mutable_data());
     }
     values_[values_size_++] = v;
   }
 
+  MemoryPool* pool_;
+  Status status_;
   std::shared_ptr<ResizableBuffer> values_buffer_;
   ValueDesc* values_;
   int64_t values_size_;
@@ -170,10 +304,13 @@ class BlockParser::ResizableValuesWriter {
 class BlockParser::PresizedValuesWriter {
  public:
   PresizedValuesWriter(MemoryPool* pool, int32_t num_rows, int32_t num_cols)
-      : values_size_(0), values_capacity_(1 + num_rows * num_cols) {
-    ARROW_CHECK_OK(AllocateResizableBuffer(pool, values_capacity_ * sizeof(*values_),
-                                           &values_buffer_));
+      : pool_(pool), values_size_(0), values_capacity_(1 + num_rows * num_cols) {}
+
+  Status Init() {
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, values_capacity_ * sizeof(*values_),
+                                          &values_buffer_));
     values_ = reinterpret_cast<ValueDesc*>(values_buffer_->mutable_data());
+    return Status::OK();
   }
 
   template <typename ParsedWriter>
@@ -181,11 +318,14 @@ class BlockParser::PresizedValuesWriter {
     PushValue({static_cast<uint32_t>(parsed_writer.size()) & 0x7fffffffU, false});
   }
 
-  void Finish(std::shared_ptr<Buffer>* out_values) {
-    ARROW_CHECK_OK(values_buffer_->Resize(values_size_ * sizeof(*values_)));
+  Status Finish(std::shared_ptr<Buffer>* out_values) {
+    RETURN_NOT_OK(values_buffer_->Resize(values_size_ * sizeof(*values_)));
     *out_values = values_buffer_;
+    return Status::OK();
   }
 
+  Status status() const { return Status::OK(); }
+
   void BeginLine() { saved_values_size_ = values_size_; }
 
   void StartField(bool quoted) { quoted_ = quoted; }
@@ -204,6 +344,7 @@ class BlockParser::PresizedValuesWriter {
     values_[values_size_++] = v;
   }
 
+  MemoryPool* pool_;
   std::shared_ptr<ResizableBuffer> values_buffer_;
   ValueDesc* values_;
   int64_t values_size_;
@@ -224,6 +365,11 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
   auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
 
+#ifdef ARROW_CSV_BULK_SCAN
+  using Scanner = BulkFieldScanner<SpecializedOptions>;
+  const Scanner scanner(options_);
+#endif
+
   values_writer->BeginLine();
   parsed_writer->BeginLine();
 
@@ -259,6 +405,16 @@ FieldStart:
 
 InField:
   // Inside a non-quoted part of a field
+#ifdef ARROW_CSV_BULK_SCAN
+  while (data_end - data >= Scanner::kBatchSize) {
+    const int32_t n = scanner.ScanUnquoted(data);
+    parsed_writer->template PushFieldBatch<Scanner::kBatchSize>(data, n);
+    data += n;
+    if (n < Scanner::kBatchSize) {
+      break;
+    }
+  }
+#endif
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -291,6 +447,16 @@ InField:
 
 InQuotedField:
   // Inside a quoted part of a field
+#ifdef ARROW_CSV_BULK_SCAN
+  while (data_end - data >= Scanner::kBatchSize) {
+    const int32_t n = scanner.ScanQuoted(data);
+    parsed_writer->template PushFieldBatch<Scanner::kBatchSize>(data, n);
+    data += n;
+    if (n < Scanner::kBatchSize) {
+      break;
+    }
+  }
+#endif
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -329,6 +495,8 @@ LineEnd:
   // At the end of line
   FinishField();
   ++num_cols;
+  // The values may have been truncated by an allocation failure
+  RETURN_NOT_OK(values_writer->status());
   if (ARROW_PREDICT_FALSE(num_cols != num_cols_)) {
     if (num_cols_ == -1) {
       num_cols_ = num_cols;
@@ -345,6 +513,7 @@ AbortLine:
   if (is_final) {
     FinishField();
     ++num_cols;
+    RETURN_NOT_OK(values_writer->status());
     if (num_cols_ == -1) {
       num_cols_ = num_cols;
     } else if (num_cols != num_cols_) {
@@ -396,7 +565,7 @@ Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed
   }
   // Append new buffers and update size
   std::shared_ptr<Buffer> values_buffer;
-  values_writer->Finish(&values_buffer);
+  RETURN_NOT_OK(values_writer->Finish(&values_buffer));
   if (values_buffer->size() > 0) {
     values_size_ += static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc) - 1);
     values_buffers_.push_back(std::move(values_buffer));
@@ -424,6 +593,7 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
   }
 
   PresizedParsedWriter parsed_writer(pool_, static_cast<uint32_t>(total_view_length));
+  RETURN_NOT_OK(parsed_writer.Init());
   uint32_t total_parsed_length = 0;
 
   for (const auto& view : views) {
@@ -436,6 +606,7 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       // a single line
       const int32_t rows_in_chunk = 1;
       ResizableValuesWriter values_writer(pool_);
+      RETURN_NOT_OK(values_writer.Init());
       values_writer.Start(parsed_writer);
 
       RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
@@ -461,6 +632,7 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       }
 
       PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
+      RETURN_NOT_OK(values_writer.Init());
       values_writer.Start(parsed_writer);
 
       RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
@@ -477,7 +649,7 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
     }
   }
 
-  parsed_writer.Finish(&parsed_buffer_);
+  RETURN_NOT_OK(parsed_writer.Finish(&parsed_buffer_));
   parsed_size_ = static_cast<int32_t>(parsed_buffer_->size());
   parsed_ = parsed_buffer_->data();
 
@@ -91,6 +91,11 @@ class ARROW_EXPORT BlockParser {
   int32_t num_cols() const { return num_cols_; }
   /// \brief Return the total size in bytes of parsed data
   uint32_t num_bytes() const { return parsed_size_; }
+  /// \brief Return the buffer holding parsed data
+  ///
+  /// Values passed to VisitColumn() and VisitLastRow() point into this buffer,
+  /// where they are laid out row after row.
+  const std::shared_ptr<Buffer>& parsed_buffer() const { return parsed_buffer_; }
 
   /// \brief Visit parsed values in a column
   ///
@@ -25,6 +25,7 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/csv/test_common.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -605,6 +606,17 @@ TEST(BlockParser, LotsOfColumns) {
   AssertParseOk(parser, MakeLotsOfCsvColumns(1024 * 100));
 }
 
+TEST(BlockParser, LotsOfColumnsOutOfMemory) {
+  // Growing the values of the first line fails: the allocation error is
+  // reported, not an error about the truncated line
+  auto csv = MakeLotsOfCsvColumns(300);
+  LimitingMemoryPool pool(default_memory_pool(),
+                          /*limit=*/static_cast<int64_t>(csv.size()) + 4096);
+  BlockParser parser(&pool, ParseOptions::Defaults());
+  uint32_t out_size;
+  ASSERT_RAISES(OutOfMemory, parser.Parse(util::string_view(csv), &out_size));
+}
+
 TEST(BlockParser, QuotedEscape) {
   auto options = ParseOptions::Defaults();
   options.escaping = true;
@@ -623,5 +635,32 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Exercise the bulk scanning of field contents, with special characters
+  // at various offsets
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+
+  for (int32_t length = 0; length < 40; ++length) {
+    const std::string head(length / 2, 'x');
+    const std::string tail(length - length / 2, 'y');
+    std::vector<std::string> lines;
+    std::vector<std::string> unquoted, quoted, escaped;
+    for (int32_t row = 0; row < 3; ++row) {
+      const char* eol = (row == 1) ? "\r\n" : "\n";
+      lines.push_back(head + tail + ",\"" + head + ",\"\"" + tail + "\"," + head +
+                      "\\," + tail + eol);
+      unquoted.push_back(head + tail);
+      quoted.push_back(head + ",\"" + tail);
+      escaped.push_back(head + "," + tail);
+    }
+    auto csv = MakeCSVData(lines);
+    BlockParser parser(options);
+    ASSERT_NO_FATAL_FAILURE(AssertParseOk(parser, csv)) << "length = " << length;
+    ASSERT_NO_FATAL_FAILURE(AssertColumnsEq(parser, {unquoted, quoted, escaped}))
+        << "length = " << length;
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
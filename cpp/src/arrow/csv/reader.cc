@@ -17,8 +17,10 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -27,9 +29,11 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/csv/chunker.h"
 #include "arrow/csv/column_builder.h"
+#include "arrow/csv/converter.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/io/interfaces.h"
@@ -37,9 +41,12 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/make_unique.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/utf8.h"
@@ -56,25 +63,24 @@ class InputStream;
 
 namespace csv {
 
+using internal::checked_cast;
 using internal::GetCpuThreadPool;
 using internal::ThreadPool;
 
 /////////////////////////////////////////////////////////////////////////
 // Base class for common functionality
 
-class BaseTableReader : public csv::TableReader {
+class ReaderMixin {
  public:
-  BaseTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
-                  const ReadOptions& read_options, const ParseOptions& parse_options,
-                  const ConvertOptions& convert_options)
+  ReaderMixin(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+              const ReadOptions& read_options, const ParseOptions& parse_options,
+              const ConvertOptions& convert_options)
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
         convert_options_(convert_options),
         input_(std::move(input)) {}
 
-  virtual Status Init() = 0;
-
  protected:
   Status ReadNextBlock(bool first_block, std::shared_ptr<Buffer>* out) {
     ARROW_ASSIGN_OR_RAISE(auto buf, block_iterator_.Next());
@@ -183,6 +189,7 @@ class BaseTableReader : public csv::TableReader {
       ARROW_ASSIGN_OR_RAISE(auto builder, MakeCSVColumnBuilder(col_name, col_index));
       column_builders_.push_back(builder);
       builder_names_.push_back(col_name);
+      builder_csv_indices_.push_back(col_index);
     }
     return Status::OK();
   }
@@ -199,9 +206,10 @@ class BaseTableReader : public csv::TableReader {
     // For each column name in include_columns, build the corresponding ColumnBuilder
     for (const auto& col_name : include_columns) {
       std::shared_ptr<ColumnBuilder> builder;
+      int32_t col_index = -1;
       auto it = col_indices.find(col_name);
       if (it != col_indices.end()) {
-        auto col_index = it->second;
+        col_index = it->second;
         ARROW_ASSIGN_OR_RAISE(builder, MakeCSVColumnBuilder(col_name, col_index));
       } else {
         // Column not in the CSV file
@@ -215,6 +223,7 @@ class BaseTableReader : public csv::TableReader {
       }
       column_builders_.push_back(builder);
       builder_names_.push_back(col_name);
+      builder_csv_indices_.push_back(col_index);
     }
     return Status::OK();
   }
@@ -257,10 +266,12 @@ class BaseTableReader : public csv::TableReader {
     return res;
   }
 
-  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
-                        const std::shared_ptr<Buffer>& completion,
-                        const std::shared_ptr<Buffer>& block, int64_t block_index,
-                        bool is_final, uint32_t* out_parsed_size = nullptr) {
+  // Parse the rows in `partial + completion + block`
+  Result<std::shared_ptr<BlockParser>> Parse(const std::shared_ptr<Buffer>& partial,
+                                             const std::shared_ptr<Buffer>& completion,
+                                             const std::shared_ptr<Buffer>& block,
+                                             bool is_final,
+                                             uint32_t* out_parsed_size = nullptr) const {
     static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
     auto parser =
         std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_, max_num_rows);
@@ -288,6 +299,15 @@ class BaseTableReader : public csv::TableReader {
     if (out_parsed_size) {
       *out_parsed_size = parsed_size;
     }
+    return parser;
+  }
+
+  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
+                        const std::shared_ptr<Buffer>& completion,
+                        const std::shared_ptr<Buffer>& block, int64_t block_index,
+                        bool is_final, uint32_t* out_parsed_size = nullptr) {
+    ARROW_ASSIGN_OR_RAISE(auto parser,
+                          Parse(partial, completion, block, is_final, out_parsed_size));
     return ProcessData(parser, block_index);
   }
 
@@ -326,6 +346,9 @@ class BaseTableReader : public csv::TableReader {
   std::vector<std::shared_ptr<ColumnBuilder>> column_builders_;
   // Names of columns, in same order as column_builders_
   std::vector<std::string> builder_names_;
+  // Indices of columns in the CSV file (-1 if missing), in same order as
+  // column_builders_
+  std::vector<int32_t> builder_csv_indices_;
 
   std::shared_ptr<io::InputStream> input_;
   Iterator<std::shared_ptr<Buffer>> block_iterator_;
@@ -335,6 +358,13 @@ class BaseTableReader : public csv::TableReader {
   bool trailing_cr_ = false;
 };
 
+class BaseTableReader : public ReaderMixin, public csv::TableReader {
+ public:
+  using ReaderMixin::ReaderMixin;
+
+  virtual Status Init() = 0;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
@@ -441,6 +471,12 @@ class ThreadedTableReader : public BaseTableReader {
     }
     RETURN_NOT_OK(ProcessHeader(block, &block));
 
+    if (parse_options_.newlines_in_values) {
+      RETURN_NOT_OK(ParseSpeculatively(std::move(block)));
+      RETURN_NOT_OK(task_group_->Finish());
+      return MakeTable();
+    }
+
     auto chunker = MakeChunker(parse_options_);
     auto empty = std::make_shared<Buffer>("");
     auto partial = empty;
@@ -482,9 +518,347 @@ class ThreadedTableReader : public BaseTableReader {
   }
 
  protected:
+  // A chunk of data parsed on the assumption that it starts at a CSV row boundary
+  struct SpeculativeChunk {
+    std::shared_ptr<Buffer> block, partial, completion, whole;
+    bool is_final;
+    Status status;
+    std::shared_ptr<BlockParser> parser;
+    uint32_t parsed_size = 0;
+  };
+
+  // With newlines_in_values, the end of the last row in a block can only be found
+  // by lexing the whole block, which would serialize the read.  Instead, each block
+  // is cut at its last newline, assuming it ends a row, and batches of chunks are
+  // parsed in parallel.  The assumption is then checked while committing the
+  // chunks in order: a chunk whose partial row doesn't start where the previous
+  // chunk actually ended is re-chunked and re-parsed serially.
+  Status ParseSpeculatively(std::shared_ptr<Buffer> block) {
+    auto chunker = MakeChunker(parse_options_);
+    Chunker newline_chunker(MakeNewlineBoundaryFinder());
+    auto empty = std::make_shared<Buffer>("");
+    auto partial = empty;
+    // The actual partial row preceding the next chunk to commit
+    auto actual_partial = empty;
+    int64_t block_index = 0;
+    const size_t batch_size = std::max(1, thread_pool_->GetCapacity());
+
+    while (block) {
+      // (declared first so that pending parse tasks are waited for before
+      //  the chunks are destroyed)
+      std::vector<SpeculativeChunk> chunks;
+      chunks.reserve(batch_size);
+      auto parse_group = internal::TaskGroup::MakeThreaded(thread_pool_);
+
+      while (block && chunks.size() < batch_size) {
+        SpeculativeChunk chunk;
+        std::shared_ptr<Buffer> next_block, starts_with_whole, next_partial;
+
+        ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+        chunk.block = block;
+        chunk.partial = partial;
+        chunk.is_final = (next_block == nullptr);
+        // Completing the partial row only lexes a single row, and is exact
+        // unless the partial row itself is wrong
+        if (chunk.is_final) {
+          chunk.status =
+              chunker->ProcessFinal(partial, block, &chunk.completion, &chunk.whole);
+        } else {
+          chunk.status = chunker->ProcessWithPartial(partial, block, &chunk.completion,
+                                                     &starts_with_whole);
+          if (!chunk.status.ok()) {
+            chunk.completion = SliceBuffer(block, 0, 0);
+            starts_with_whole = block;
+          }
+          RETURN_NOT_OK(
+              newline_chunker.Process(starts_with_whole, &chunk.whole, &next_partial));
+        }
+        chunks.push_back(std::move(chunk));
+
+        SpeculativeChunk* pending = &chunks.back();
+        if (pending->status.ok()) {
+          parse_group->Append([this, pending] {
+            // Errors are only reported if the chunk is confirmed, see below
+            pending->status = Parse(pending->partial, pending->completion,
+                                    pending->whole, pending->is_final,
+                                    &pending->parsed_size)
+                                  .Value(&pending->parser);
+            return Status::OK();
+          });
+        }
+
+        partial = next_partial;
+        block = next_block;
+      }
+      RETURN_NOT_OK(parse_group->Finish());
+
+      for (auto& chunk : chunks) {
+        RETURN_NOT_OK(CommitSpeculativeChunk(chunker.get(), &chunk, &actual_partial,
+                                             block_index++));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Insert the parsed `chunk`, given the actual partial row preceding it.
+  // On return, `actual_partial` is updated for the next chunk.
+  Status CommitSpeculativeChunk(Chunker* chunker, SpeculativeChunk* chunk,
+                                std::shared_ptr<Buffer>* actual_partial,
+                                int64_t block_index) {
+    // Both partial rows end at the start of the chunk's block
+    if ((*actual_partial)->size() == chunk->partial->size()) {
+      RETURN_NOT_OK(chunk->status);
+    } else {
+      // Misprediction: re-chunk and re-parse from the actual row start
+      chunk->partial = *actual_partial;
+      if (chunk->is_final) {
+        RETURN_NOT_OK(chunker->ProcessFinal(chunk->partial, chunk->block,
+                                            &chunk->completion, &chunk->whole));
+      } else {
+        std::shared_ptr<Buffer> starts_with_whole, next_partial;
+        RETURN_NOT_OK(chunker->ProcessWithPartial(chunk->partial, chunk->block,
+                                                  &chunk->completion,
+                                                  &starts_with_whole));
+        RETURN_NOT_OK(chunker->Process(starts_with_whole, &chunk->whole, &next_partial));
+      }
+      ARROW_ASSIGN_OR_RAISE(chunk->parser,
+                            Parse(chunk->partial, chunk->completion, chunk->whole,
+                                  chunk->is_final, &chunk->parsed_size));
+    }
+    RETURN_NOT_OK(ProcessData(chunk->parser, block_index));
+
+    auto offset = static_cast<int64_t>(chunk->parsed_size) - chunk->partial->size();
+    DCHECK_GE(offset, chunk->completion->size());  // Ensured by chunker
+    *actual_partial = SliceBuffer(chunk->block, offset);
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+};
+
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader implementation
+
+class StreamingReaderImpl : public ReaderMixin, public csv::StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      const ReadOptions& read_options, const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : ReaderMixin(pool, input, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool) {}
+
+  ~StreamingReaderImpl() override {
+    // Pending tasks refer to this object
+    for (auto& fut : pending_batches_) {
+      fut.Wait();
+    }
+  }
+
+  Status Init() {
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+
+    // Bound the number of blocks in memory, both read ahead and being converted
+    max_pending_batches_ = thread_pool_ ? thread_pool_->GetCapacity() : 1;
+    ARROW_ASSIGN_OR_RAISE(
+        block_iterator_,
+        MakeReadaheadIterator(std::move(block_iterator_),
+                              static_cast<int32_t>(max_pending_batches_)));
+
+    // Read first block and process header serially.  The first block is
+    // converted using the column builders, so as to infer the schema.
+    task_group_ = internal::TaskGroup::MakeSerial();
+    RETURN_NOT_OK(ReadFirstBlock(&block_));
+    if (!block_) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(block_, &block_));
+
+    chunker_ = MakeChunker(parse_options_);
+    partial_ = std::make_shared<Buffer>("");
+
+    ChunkedBlock chunk;
+    ARROW_ASSIGN_OR_RAISE(bool has_chunk, ChunkNextBlock(&chunk));
+    DCHECK(has_chunk);
+    RETURN_NOT_OK(ParseAndInsert(chunk.partial, chunk.completion, chunk.whole, 0,
+                                 chunk.is_final));
+    RETURN_NOT_OK(task_group_->Finish());
+    ARROW_ASSIGN_OR_RAISE(auto table, MakeTable());
+    schema_ = table->schema();
+
+    ArrayVector columns;
+    for (const auto& column : table->columns()) {
+      DCHECK_EQ(column->num_chunks(), 1);
+      columns.push_back(column->chunk(0));
+    }
+    first_batch_ = RecordBatch::Make(schema_, table->num_rows(), std::move(columns));
+    column_builders_.clear();
+
+    return MakeConverters();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (first_batch_) {
+      *batch = std::move(first_batch_);
+      if ((*batch)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+    while (true) {
+      RETURN_NOT_OK(SchedulePendingBatches());
+      if (pending_batches_.empty()) {
+        // EOF
+        batch->reset();
+        return Status::OK();
+      }
+      auto fut = std::move(pending_batches_.front());
+      pending_batches_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(*batch, fut.result());
+      // Skip blocks without any complete row
+      if ((*batch)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+  }
+
+ protected:
+  // A block split at row boundaries, with the rows straddling the previous block
+  struct ChunkedBlock {
+    std::shared_ptr<Buffer> partial;
+    std::shared_ptr<Buffer> completion;
+    std::shared_ptr<Buffer> whole;
+    bool is_final;
+  };
+
+  // Fixed-type conversion of a column, once the schema is known
+  struct ColumnDecoder {
+    std::shared_ptr<DataType> type;
+    // Index of the column in the CSV file, or -1 if missing
+    int32_t col_index;
+    std::shared_ptr<Converter> converter;
+  };
+
+  // Split the next block at row boundaries.  Return false at EOF.
+  Result<bool> ChunkNextBlock(ChunkedBlock* out) {
+    if (!block_) {
+      return false;
+    }
+    std::shared_ptr<Buffer> next_block, starts_with_whole, next_partial;
+    ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+    out->is_final = (next_block == nullptr);
+    out->partial = partial_;
+
+    if (out->is_final) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(
+          chunker_->ProcessFinal(partial_, block_, &out->completion, &out->whole));
+    } else {
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &out->completion,
+                                                 &starts_with_whole));
+      // Get a complete CSV block inside `partial + block`, and keep
+      // the rest for the next iteration.
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &out->whole, &next_partial));
+    }
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return true;
+  }
+
+  Status MakeConverters() {
+    const int num_fields = schema_->num_fields();
+    DCHECK_EQ(static_cast<size_t>(num_fields), builder_csv_indices_.size());
+    column_decoders_.resize(num_fields);
+    for (int i = 0; i < num_fields; ++i) {
+      auto& decoder = column_decoders_[i];
+      decoder.type = schema_->field(i)->type();
+      decoder.col_index = builder_csv_indices_[i];
+      if (decoder.col_index < 0) {
+        continue;
+      }
+      if (decoder.type->id() == Type::DICTIONARY) {
+        // Inferred dictionary-encoded column; don't enforce the cardinality
+        // limit anymore, as the type cannot be changed from now on
+        const auto& dict_type = checked_cast<const DictionaryType&>(*decoder.type);
+        ARROW_ASSIGN_OR_RAISE(decoder.converter,
+                              DictionaryConverter::Make(dict_type.value_type(),
+                                                        convert_options_, pool_));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(decoder.converter,
+                              Converter::Make(decoder.type, convert_options_, pool_));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Chunk more blocks and launch their conversion, up to max_pending_batches_
+  Status SchedulePendingBatches() {
+    while (pending_batches_.size() < max_pending_batches_) {
+      ChunkedBlock chunk;
+      ARROW_ASSIGN_OR_RAISE(bool has_chunk, ChunkNextBlock(&chunk));
+      if (!has_chunk) {
+        break;
+      }
+      if (thread_pool_) {
+        ARROW_ASSIGN_OR_RAISE(auto fut, thread_pool_->Submit([this, chunk]() {
+          return ParseAndConvert(chunk);
+        }));
+        pending_batches_.push_back(std::move(fut));
+      } else {
+        pending_batches_.push_back(
+            Future<std::shared_ptr<RecordBatch>>::MakeFinished(ParseAndConvert(chunk)));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Parse and convert a block to a record batch (may be called from any thread)
+  Result<std::shared_ptr<RecordBatch>> ParseAndConvert(const ChunkedBlock& chunk) const {
+    ARROW_ASSIGN_OR_RAISE(auto parser, Parse(chunk.partial, chunk.completion, chunk.whole,
+                                             chunk.is_final));
+    const int64_t num_rows = parser->num_rows();
+    ArrayVector columns(column_decoders_.size());
+    for (size_t i = 0; i < column_decoders_.size(); ++i) {
+      const auto& decoder = column_decoders_[i];
+      if (decoder.converter == nullptr) {
+        RETURN_NOT_OK(MakeArrayOfNull(pool_, decoder.type, num_rows, &columns[i]));
+        continue;
+      }
+      auto maybe_array = decoder.converter->Convert(*parser, decoder.col_index);
+      if (!maybe_array.ok()) {
+        std::stringstream ss;
+        ss << "In CSV column #" << decoder.col_index << ": "
+           << maybe_array.status().message();
+        return maybe_array.status().WithMessage(ss.str());
+      }
+      columns[i] = *std::move(maybe_array);
+    }
+    return RecordBatch::Make(schema_, num_rows, std::move(columns));
+  }
+
   ThreadPool* thread_pool_;
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> first_batch_;
+  std::vector<ColumnDecoder> column_decoders_;
+
+  std::unique_ptr<Chunker> chunker_;
+  // Next block to be chunked, and leftover of the previous block
+  std::shared_ptr<Buffer> block_;
+  std::shared_ptr<Buffer> partial_;
+
+  // Batches being parsed and converted, in file order
+  std::deque<Future<std::shared_ptr<RecordBatch>>> pending_batches_;
+  size_t max_pending_batches_ = 1;
 };
 
+static ThreadPool* GetThreadPool(const ReadOptions& read_options) {
+  return read_options.thread_pool != nullptr ? read_options.thread_pool
+                                             : GetCpuThreadPool();
+}
+
 /////////////////////////////////////////////////////////////////////////
 // TableReader factory function
 
@@ -494,8 +868,9 @@ Result<std::shared_ptr<TableReader>> TableReader::Make(
     const ConvertOptions& convert_options) {
   std::shared_ptr<BaseTableReader> reader;
   if (read_options.use_threads) {
-    reader = std::make_shared<ThreadedTableReader>(
-        pool, input, read_options, parse_options, convert_options, GetCpuThreadPool());
+    reader = std::make_shared<ThreadedTableReader>(pool, input, read_options,
+                                                   parse_options, convert_options,
+                                                   GetThreadPool(read_options));
   } else {
     reader = std::make_shared<SerialTableReader>(pool, input, read_options, parse_options,
                                                  convert_options);
@@ -504,6 +879,21 @@ Result<std::shared_ptr<TableReader>> TableReader::Make(
   return reader;
 }
 
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader factory function
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options,
+    const ConvertOptions& convert_options) {
+  ThreadPool* thread_pool = read_options.use_threads ? GetThreadPool(read_options)
+                                                    : nullptr;
+  auto reader = std::make_shared<StreamingReaderImpl>(
+      pool, input, read_options, parse_options, convert_options, thread_pool);
+  RETURN_NOT_OK(reader->Init());
+  return reader;
+}
+
 /////////////////////////////////////////////////////////////////////////
 // Deprecated API(s)
 
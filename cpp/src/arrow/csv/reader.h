@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
@@ -55,5 +56,27 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a CSV file incrementally
+///
+/// Each call to ReadNext() yields the record batch for one parsed block.
+/// Column types are inferred from the first block and then fixed for the
+/// remainder of the file: if a later block cannot be converted to the
+/// inferred type, an error is returned.  Explicit types in
+/// `ConvertOptions::column_types` avoid this.
+///
+/// If `ReadOptions::use_threads` is true, blocks following the current one
+/// are parsed and converted in parallel on the CPU thread pool.  At most
+/// a few blocks per thread are held in memory at any time.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  /// Create a StreamingReader instance
+  ///
+  /// The header and the first block are read and parsed (in order to
+  /// infer the schema) before this function returns.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+      const ReadOptions&, const ParseOptions&, const ConvertOptions&);
+};
+
 }  // namespace csv
 }  // namespace arrow
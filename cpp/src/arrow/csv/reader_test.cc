@@ -0,0 +1,264 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/test_common.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace csv {
+
+class TestStreamingReader : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    read_options_ = ReadOptions::Defaults();
+    read_options_.use_threads = GetParam();
+    parse_options_ = ParseOptions::Defaults();
+    convert_options_ = ConvertOptions::Defaults();
+  }
+
+  std::shared_ptr<io::InputStream> MakeInput(std::string csv) {
+    return std::make_shared<io::BufferReader>(Buffer::FromString(std::move(csv)));
+  }
+
+  Result<std::shared_ptr<StreamingReader>> MakeReader(const std::string& csv) {
+    return StreamingReader::Make(default_memory_pool(), MakeInput(csv), read_options_,
+                                 parse_options_, convert_options_);
+  }
+
+  Result<std::shared_ptr<Table>> ReadTable(const std::string& csv) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader, TableReader::Make(default_memory_pool(), MakeInput(csv),
+                                       read_options_, parse_options_, convert_options_));
+    return reader->Read();
+  }
+
+  void ReadBatches(const std::string& csv,
+                   std::vector<std::shared_ptr<RecordBatch>>* out) {
+    ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(csv));
+    out->clear();
+    ASSERT_OK(reader->ReadAll(out));
+    for (const auto& batch : *out) {
+      ASSERT_OK(batch->ValidateFull());
+      AssertSchemaEqual(reader->schema(), batch->schema());
+    }
+  }
+
+  // The concatenation of all batches should give the same result as TableReader
+  void AssertSameAsTableReader(const std::string& csv) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    ASSERT_NO_FATAL_FAILURE(ReadBatches(csv, &batches));
+    ASSERT_OK_AND_ASSIGN(auto expected, ReadTable(csv));
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(Table::FromRecordBatches(expected->schema(), batches, &actual));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+ protected:
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+};
+
+TEST_P(TestStreamingReader, Basics) {
+  auto csv = MakeCSVData({"a,b,c\n", "1,foo,true\n", "2,,false\n", "3,\"bar\",\n"});
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_NO_FATAL_FAILURE(ReadBatches(csv, &batches));
+  ASSERT_EQ(batches.size(), 1);
+  AssertSchemaEqual(*schema({field("a", int64()), field("b", utf8()),
+                             field("c", boolean())}),
+                    *batches[0]->schema());
+  ASSERT_EQ(batches[0]->num_rows(), 3);
+  AssertSameAsTableReader(csv);
+}
+
+TEST_P(TestStreamingReader, ManyBlocks) {
+  std::vector<std::string> lines = {"a,b\n"};
+  for (int i = 0; i < 1000; ++i) {
+    lines.push_back(std::to_string(i) + ",\"x" + std::to_string(i % 7) + "\"\n");
+  }
+  auto csv = MakeCSVData(lines);
+  read_options_.block_size = 64;
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_NO_FATAL_FAILURE(ReadBatches(csv, &batches));
+  ASSERT_GT(batches.size(), 10);
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    ASSERT_GT(batch->num_rows(), 0);
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 1000);
+  AssertSameAsTableReader(csv);
+
+  // Same with dictionary-encoded strings
+  convert_options_.auto_dict_encode = true;
+  ASSERT_NO_FATAL_FAILURE(ReadBatches(csv, &batches));
+  AssertSchemaEqual(
+      *schema({field("a", int64()), field("b", dictionary(int32(), utf8()))}),
+      *batches[0]->schema());
+  num_rows = 0;
+  for (const auto& batch : batches) {
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 1000);
+}
+
+TEST_P(TestStreamingReader, NewlinesInValues) {
+  // Many blocks end inside a quoted value, so that the threaded TableReader's
+  // speculative chunking is often mistaken
+  std::vector<std::string> lines = {"a,b\n"};
+  std::shared_ptr<Array> expected_a, expected_b;
+  std::vector<int64_t> a_values;
+  std::vector<std::string> b_values;
+  for (int i = 0; i < 500; ++i) {
+    const std::string value = "x" + std::string(i % 13, '\n') + std::to_string(i);
+    lines.push_back(std::to_string(i) + ",\"" + value + "\"\n");
+    a_values.push_back(i);
+    b_values.push_back(value);
+  }
+  ArrayFromVector<Int64Type>(a_values, &expected_a);
+  ArrayFromVector<StringType, std::string>(b_values, &expected_b);
+  auto csv = MakeCSVData(lines);
+  read_options_.block_size = 64;
+  parse_options_.newlines_in_values = true;
+
+  ASSERT_OK_AND_ASSIGN(auto table, ReadTable(csv));
+  ASSERT_OK(table->ValidateFull());
+  AssertChunkedEqual(ChunkedArray({expected_a}), *table->column(0));
+  AssertChunkedEqual(ChunkedArray({expected_b}), *table->column(1));
+  AssertSameAsTableReader(csv);
+
+  // Invalid data is still reported
+  lines.push_back("1,2,3\n");
+  lines.push_back("4,\"x\ny\"\n");
+  ASSERT_RAISES(Invalid, ReadTable(MakeCSVData(lines)));
+}
+
+TEST_P(TestStreamingReader, IncludeColumns) {
+  auto csv = MakeCSVData({"a,b,c\n", "1,2,3\n", "4,5,6\n"});
+  convert_options_.include_columns = {"c", "d", "a"};
+  convert_options_.include_missing_columns = true;
+  convert_options_.column_types["d"] = float32();
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_NO_FATAL_FAILURE(ReadBatches(csv, &batches));
+  ASSERT_EQ(batches.size(), 1);
+  AssertSchemaEqual(*schema({field("c", int64()), field("d", float32()),
+                             field("a", int64())}),
+                    *batches[0]->schema());
+  ASSERT_EQ(batches[0]->column(1)->null_count(), 2);
+  AssertSameAsTableReader(csv);
+}
+
+TEST_P(TestStreamingReader, InferredTypeIsFixed) {
+  // Types are inferred from the first block only
+  std::vector<std::string> lines = {"a\n"};
+  for (int i = 0; i < 100; ++i) {
+    lines.push_back(std::to_string(i) + "\n");
+  }
+  lines.push_back("xyz\n");
+  read_options_.block_size = 64;
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(MakeCSVData(lines)));
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader->schema());
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  auto st = reader->ReadAll(&batches);
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_NE(st.message().find("In CSV column #0"), std::string::npos) << st.ToString();
+}
+
+TEST_P(TestStreamingReader, HeaderOnly) {
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader("a,b\n"));
+  AssertSchemaEqual(*schema({field("a", null()), field("b", null())}), *reader->schema());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(TestStreamingReader, Errors) {
+  ASSERT_RAISES(Invalid, MakeReader(""));
+
+  convert_options_.include_columns = {"d"};
+  ASSERT_RAISES(KeyError, MakeReader("a,b\n1,2\n"));
+}
+
+TEST_P(TestStreamingReader, MemoryLimit) {
+  std::vector<std::string> lines = {"a,b\n"};
+  for (int i = 0; i < 1000; ++i) {
+    lines.push_back(std::to_string(i) + ",\"x" + std::to_string(i) + "\"\n");
+  }
+  auto csv = MakeCSVData(lines);
+
+  // Allocation failures are reported as errors, not crashes
+  LimitingMemoryPool pool(default_memory_pool(), /*limit=*/256);
+  auto maybe_reader = StreamingReader::Make(&pool, MakeInput(csv), read_options_,
+                                            parse_options_, convert_options_);
+  ASSERT_RAISES(OutOfMemory, maybe_reader);
+
+  LimitingMemoryPool large_pool(default_memory_pool(), /*limit=*/1 << 20);
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       StreamingReader::Make(&large_pool, MakeInput(csv), read_options_,
+                                             parse_options_, convert_options_));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_LE(large_pool.max_memory(), large_pool.limit());
+}
+
+TEST_P(TestStreamingReader, ThreadPool) {
+  std::vector<std::string> lines = {"a,b\n"};
+  for (int i = 0; i < 1000; ++i) {
+    lines.push_back(std::to_string(i) + ",\"x" + std::to_string(i) + "\"\n");
+  }
+  auto csv = MakeCSVData(lines);
+  read_options_.block_size = 256;
+
+  // Tasks are run on the given pool (if threaded)
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(2));
+  ASSERT_OK_AND_ASSIGN(auto executor, thread_pool->MakeExecutor(1));
+  thread_pool->SetInstrumentationEnabled(true);
+  read_options_.thread_pool = executor.get();
+  AssertSameAsTableReader(csv);
+  if (read_options_.use_threads) {
+    ASSERT_GT(thread_pool->GetStats().tasks_submitted, 0);
+  } else {
+    ASSERT_EQ(thread_pool->GetStats().tasks_submitted, 0);
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(Serial, TestStreamingReader, ::testing::Values(false));
+INSTANTIATE_TEST_CASE_P(Threaded, TestStreamingReader, ::testing::Values(true));
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,478 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace csv {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+using internal::StringFormatter;
+using internal::ThreadPool;
+
+namespace {
+
+constexpr char kDelimiter = ',';
+constexpr char kQuote = '"';
+
+inline bool NeedsQuoting(util::string_view value) {
+  for (const char c : value) {
+    if (c == kDelimiter || c == kQuote || c == '\n' || c == '\r') {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Append a string value, quoting it only if necessary
+Status AppendString(util::string_view value, BufferBuilder* out) {
+  if (ARROW_PREDICT_TRUE(!NeedsQuoting(value))) {
+    return out->Append(value.data(), static_cast<int64_t>(value.size()));
+  }
+  const auto num_quotes = std::count(value.begin(), value.end(), kQuote);
+  RETURN_NOT_OK(out->Reserve(static_cast<int64_t>(value.size() + num_quotes) + 2));
+  out->UnsafeAppend(1, static_cast<uint8_t>(kQuote));
+  for (const char c : value) {
+    if (c == kQuote) {
+      out->UnsafeAppend(1, static_cast<uint8_t>(kQuote));
+    }
+    out->UnsafeAppend(1, static_cast<uint8_t>(c));
+  }
+  out->UnsafeAppend(1, static_cast<uint8_t>(kQuote));
+  return Status::OK();
+}
+
+/////////////////////////////////////////////////////////////////////////
+// Per-column formatting
+
+// Formats all values of an array into a contiguous text buffer, recording
+// the end position of each value.  Null values are formatted as empty.
+class ColumnFormatter {
+ public:
+  virtual ~ColumnFormatter() = default;
+
+  /// `ends` must have room for array.length() values
+  virtual Status Format(const Array& array, BufferBuilder* out, int64_t* ends) = 0;
+
+  static Result<std::unique_ptr<ColumnFormatter>> Make(
+      const std::shared_ptr<DataType>& type, MemoryPool* pool);
+};
+
+class NullFormatter : public ColumnFormatter {
+ public:
+  Status Format(const Array& array, BufferBuilder* out, int64_t* ends) override {
+    std::fill(ends, ends + array.length(), out->length());
+    return Status::OK();
+  }
+};
+
+// Formats values using the StringFormatter for type T (numbers and booleans)
+template <typename T>
+class PrimitiveFormatter : public ColumnFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  explicit PrimitiveFormatter(const std::shared_ptr<DataType>& type)
+      : formatter_(type) {}
+
+  Status Format(const Array& array, BufferBuilder* out, int64_t* ends) override {
+    const auto& values = checked_cast<const ArrayType&>(array);
+    auto append = [out](util::string_view formatted) {
+      return out->Append(formatted.data(), static_cast<int64_t>(formatted.size()));
+    };
+    const int64_t length = values.length();
+    if (values.null_count() == 0) {
+      for (int64_t i = 0; i < length; ++i) {
+        RETURN_NOT_OK(formatter_(values.GetView(i), append));
+        ends[i] = out->length();
+      }
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        if (values.IsValid(i)) {
+          RETURN_NOT_OK(formatter_(values.GetView(i), append));
+        }
+        ends[i] = out->length();
+      }
+    }
+    return Status::OK();
+  }
+
+ protected:
+  StringFormatter<T> formatter_;
+};
+
+// Formats string-like values (binary, string, fixed-size binary)
+template <typename T>
+class BinaryFormatter : public ColumnFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  Status Format(const Array& array, BufferBuilder* out, int64_t* ends) override {
+    const auto& values = checked_cast<const ArrayType&>(array);
+    const int64_t length = values.length();
+    for (int64_t i = 0; i < length; ++i) {
+      if (values.IsValid(i)) {
+        RETURN_NOT_OK(AppendString(values.GetView(i), out));
+      }
+      ends[i] = out->length();
+    }
+    return Status::OK();
+  }
+};
+
+class DecimalFormatter : public ColumnFormatter {
+ public:
+  Status Format(const Array& array, BufferBuilder* out, int64_t* ends) override {
+    const auto& values = checked_cast<const Decimal128Array&>(array);
+    const int32_t scale = checked_cast<const Decimal128Type&>(*values.type()).scale();
+    const int64_t length = values.length();
+    char buffer[Decimal128::kMaxStringLength];
+    for (int64_t i = 0; i < length; ++i) {
+      if (values.IsValid(i)) {
+        const int32_t size = Decimal128(values.GetValue(i)).ToString(scale, buffer);
+        RETURN_NOT_OK(out->Append(buffer, size));
+      }
+      ends[i] = out->length();
+    }
+    return Status::OK();
+  }
+};
+
+// Formats the dictionary once per batch, then copies the formatted text of
+// each index
+class DictionaryFormatter : public ColumnFormatter {
+ public:
+  DictionaryFormatter(std::unique_ptr<ColumnFormatter> value_formatter,
+                      MemoryPool* pool)
+      : value_formatter_(std::move(value_formatter)), dict_text_(pool) {}
+
+  Status Format(const Array& array, BufferBuilder* out, int64_t* ends) override {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(array);
+    const Array& dictionary = *dict_array.dictionary();
+    dict_text_.Rewind(0);
+    dict_ends_.resize(dictionary.length());
+    RETURN_NOT_OK(value_formatter_->Format(dictionary, &dict_text_, dict_ends_.data()));
+
+    const Array& indices = *dict_array.indices();
+    switch (indices.type_id()) {
+      case Type::INT8:
+        return FormatIndices<Int8Type>(indices, out, ends);
+      case Type::INT16:
+        return FormatIndices<Int16Type>(indices, out, ends);
+      case Type::INT32:
+        return FormatIndices<Int32Type>(indices, out, ends);
+      case Type::INT64:
+        return FormatIndices<Int64Type>(indices, out, ends);
+      case Type::UINT8:
+        return FormatIndices<UInt8Type>(indices, out, ends);
+      case Type::UINT16:
+        return FormatIndices<UInt16Type>(indices, out, ends);
+      case Type::UINT32:
+        return FormatIndices<UInt32Type>(indices, out, ends);
+      case Type::UINT64:
+        return FormatIndices<UInt64Type>(indices, out, ends);
+      default:
+        return Status::TypeError("Invalid dictionary index type: ",
+                                 indices.type()->ToString());
+    }
+  }
+
+ protected:
+  template <typename IndexType>
+  Status FormatIndices(const Array& array, BufferBuilder* out, int64_t* ends) {
+    const auto& indices = checked_cast<const NumericArray<IndexType>&>(array);
+    const uint8_t* text = dict_text_.data();
+    const int64_t length = indices.length();
+    for (int64_t i = 0; i < length; ++i) {
+      if (indices.IsValid(i)) {
+        const auto index = static_cast<int64_t>(indices.Value(i));
+        const int64_t start = index > 0 ? dict_ends_[index - 1] : 0;
+        RETURN_NOT_OK(out->Append(text + start, dict_ends_[index] - start));
+      }
+      ends[i] = out->length();
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<ColumnFormatter> value_formatter_;
+  BufferBuilder dict_text_;
+  std::vector<int64_t> dict_ends_;
+};
+
+Result<std::unique_ptr<ColumnFormatter>> ColumnFormatter::Make(
+    const std::shared_ptr<DataType>& type, MemoryPool* pool) {
+  std::unique_ptr<ColumnFormatter> formatter;
+
+  switch (type->id()) {
+#define FORMATTER_CASE(TYPE_ID, FORMATTER_TYPE) \
+  case TYPE_ID:                                 \
+    formatter.reset(new FORMATTER_TYPE);        \
+    break;
+
+#define PRIMITIVE_FORMATTER_CASE(TYPE_ID, ARROW_TYPE)         \
+  case TYPE_ID:                                               \
+    formatter.reset(new PrimitiveFormatter<ARROW_TYPE>(type)); \
+    break;
+
+    FORMATTER_CASE(Type::NA, NullFormatter)
+    PRIMITIVE_FORMATTER_CASE(Type::BOOL, BooleanType)
+    PRIMITIVE_FORMATTER_CASE(Type::INT8, Int8Type)
+    PRIMITIVE_FORMATTER_CASE(Type::INT16, Int16Type)
+    PRIMITIVE_FORMATTER_CASE(Type::INT32, Int32Type)
+    PRIMITIVE_FORMATTER_CASE(Type::INT64, Int64Type)
+    PRIMITIVE_FORMATTER_CASE(Type::UINT8, UInt8Type)
+    PRIMITIVE_FORMATTER_CASE(Type::UINT16, UInt16Type)
+    PRIMITIVE_FORMATTER_CASE(Type::UINT32, UInt32Type)
+    PRIMITIVE_FORMATTER_CASE(Type::UINT64, UInt64Type)
+    PRIMITIVE_FORMATTER_CASE(Type::FLOAT, FloatType)
+    PRIMITIVE_FORMATTER_CASE(Type::DOUBLE, DoubleType)
+    FORMATTER_CASE(Type::BINARY, BinaryFormatter<BinaryType>)
+    FORMATTER_CASE(Type::STRING, BinaryFormatter<StringType>)
+    FORMATTER_CASE(Type::LARGE_BINARY, BinaryFormatter<LargeBinaryType>)
+    FORMATTER_CASE(Type::LARGE_STRING, BinaryFormatter<LargeStringType>)
+    FORMATTER_CASE(Type::FIXED_SIZE_BINARY, BinaryFormatter<FixedSizeBinaryType>)
+    FORMATTER_CASE(Type::DECIMAL, DecimalFormatter)
+
+    case Type::DICTIONARY: {
+      const auto& dict_type = checked_cast<const DictionaryType&>(*type);
+      ARROW_ASSIGN_OR_RAISE(auto value_formatter,
+                            ColumnFormatter::Make(dict_type.value_type(), pool));
+      formatter.reset(new DictionaryFormatter(std::move(value_formatter), pool));
+      break;
+    }
+
+    default: {
+      return Status::NotImplemented("CSV writing of ", type->ToString(),
+                                    " is not supported");
+    }
+
+#undef FORMATTER_CASE
+#undef PRIMITIVE_FORMATTER_CASE
+  }
+  return std::move(formatter);
+}
+
+/////////////////////////////////////////////////////////////////////////
+// Per-batch formatting
+
+// Formats record batches into CSV rows.  All buffers are kept across calls
+// to Format(), so that a BatchFormatter can be reused without reallocating.
+class BatchFormatter {
+ public:
+  static Result<std::unique_ptr<BatchFormatter>> Make(const Schema& schema,
+                                                      MemoryPool* pool) {
+    std::unique_ptr<BatchFormatter> result(new BatchFormatter(pool));
+    for (const auto& field : schema.fields()) {
+      ARROW_ASSIGN_OR_RAISE(auto formatter, ColumnFormatter::Make(field->type(), pool));
+      result->formatters_.push_back(std::move(formatter));
+      result->column_text_.emplace_back(pool);
+    }
+    result->column_ends_.resize(schema.num_fields());
+    return std::move(result);
+  }
+
+  /// Format the batch's rows; the result is available from text()
+  Status Format(const RecordBatch& batch) {
+    const int num_columns = batch.num_columns();
+    const int64_t num_rows = batch.num_rows();
+    DCHECK_EQ(num_columns, static_cast<int>(formatters_.size()));
+    text_.Rewind(0);
+    if (num_columns == 0) {
+      return Status::OK();
+    }
+
+    // First format each column separately...
+    int64_t text_size = num_rows * num_columns;  // delimiters and newlines
+    for (int col = 0; col < num_columns; ++col) {
+      auto& column_text = column_text_[col];
+      auto& column_ends = column_ends_[col];
+      column_text.Rewind(0);
+      column_ends.resize(num_rows);
+      RETURN_NOT_OK(formatters_[col]->Format(*batch.column(col), &column_text,
+                                             column_ends.data()));
+      text_size += column_text.length();
+    }
+
+    // ...then interleave them into rows
+    RETURN_NOT_OK(text_.Reserve(text_size));
+    uint8_t* out = text_.mutable_data();
+    for (int64_t row = 0; row < num_rows; ++row) {
+      for (int col = 0; col < num_columns; ++col) {
+        const int64_t* ends = column_ends_[col].data();
+        const int64_t start = row > 0 ? ends[row - 1] : 0;
+        const int64_t size = ends[row] - start;
+        std::memcpy(out, column_text_[col].data() + start, static_cast<size_t>(size));
+        out += size;
+        *out++ = kDelimiter;
+      }
+      out[-1] = '\n';
+    }
+    DCHECK_EQ(out - text_.data(), text_size);
+    text_.UnsafeAdvance(text_size);
+    return Status::OK();
+  }
+
+  util::string_view text() const {
+    return util::string_view(reinterpret_cast<const char*>(text_.data()),
+                             static_cast<size_t>(text_.length()));
+  }
+
+ protected:
+  explicit BatchFormatter(MemoryPool* pool) : text_(pool) {}
+
+  std::vector<std::unique_ptr<ColumnFormatter>> formatters_;
+  std::vector<BufferBuilder> column_text_;
+  std::vector<std::vector<int64_t>> column_ends_;
+  BufferBuilder text_;
+};
+
+Status WriteHeader(const Schema& schema, MemoryPool* pool, io::OutputStream* output) {
+  if (schema.num_fields() == 0) {
+    return Status::OK();
+  }
+  BufferBuilder header(pool);
+  for (const auto& field : schema.fields()) {
+    RETURN_NOT_OK(AppendString(field->name(), &header));
+    RETURN_NOT_OK(header.Append(1, static_cast<uint8_t>(kDelimiter)));
+  }
+  header.mutable_data()[header.length() - 1] = '\n';
+  return output->Write(header.data(), header.length());
+}
+
+// Yields slices of at most `batch_size` rows from a RecordBatchReader
+class BatchSlicer {
+ public:
+  BatchSlicer(RecordBatchReader* reader, int64_t batch_size)
+      : reader_(reader), batch_size_(batch_size) {}
+
+  Status Next(std::shared_ptr<RecordBatch>* out) {
+    while (!batch_ || offset_ >= batch_->num_rows()) {
+      RETURN_NOT_OK(reader_->ReadNext(&batch_));
+      offset_ = 0;
+      if (!batch_) {
+        out->reset();
+        return Status::OK();
+      }
+    }
+    if (offset_ == 0 && batch_->num_rows() <= batch_size_) {
+      *out = batch_;
+    } else {
+      *out = batch_->Slice(offset_, batch_size_);
+    }
+    offset_ += batch_size_;
+    return Status::OK();
+  }
+
+ protected:
+  RecordBatchReader* reader_;
+  const int64_t batch_size_;
+  std::shared_ptr<RecordBatch> batch_;
+  int64_t offset_ = 0;
+};
+
+}  // namespace
+
+Status WriteCSV(RecordBatchReader* reader, const WriteOptions& options,
+                MemoryPool* pool, io::OutputStream* output) {
+  if (options.batch_size <= 0) {
+    return Status::Invalid("WriteOptions: batch_size must be at least 1");
+  }
+  const auto schema = reader->schema();
+  if (options.include_header) {
+    RETURN_NOT_OK(WriteHeader(*schema, pool, output));
+  }
+
+  // Up to one batch per thread is formatted in parallel, then all of them
+  // are written in order.  Formatters (and their buffers) are reused from
+  // one round to the next.
+  ThreadPool* thread_pool = options.use_threads ? GetCpuThreadPool() : nullptr;
+  const int num_formatters = thread_pool ? std::max(1, thread_pool->GetCapacity()) : 1;
+  std::vector<std::unique_ptr<BatchFormatter>> formatters(num_formatters);
+  for (auto& formatter : formatters) {
+    ARROW_ASSIGN_OR_RAISE(formatter, BatchFormatter::Make(*schema, pool));
+  }
+  std::vector<std::shared_ptr<RecordBatch>> batches(num_formatters);
+
+  BatchSlicer slicer(reader, options.batch_size);
+  while (true) {
+    int num_batches = 0;
+    for (; num_batches < num_formatters; ++num_batches) {
+      RETURN_NOT_OK(slicer.Next(&batches[num_batches]));
+      if (!batches[num_batches]) {
+        break;
+      }
+    }
+    if (num_batches == 0) {
+      break;
+    }
+
+    if (num_batches > 1) {
+      auto task_group = internal::TaskGroup::MakeThreaded(thread_pool);
+      for (int i = 0; i < num_batches; ++i) {
+        BatchFormatter* formatter = formatters[i].get();
+        RecordBatch* batch = batches[i].get();
+        task_group->Append([formatter, batch] { return formatter->Format(*batch); });
+      }
+      RETURN_NOT_OK(task_group->Finish());
+    } else {
+      RETURN_NOT_OK(formatters[0]->Format(*batches[0]));
+    }
+    for (int i = 0; i < num_batches; ++i) {
+      const auto text = formatters[i]->text();
+      RETURN_NOT_OK(output->Write(text.data(), static_cast<int64_t>(text.size())));
+      batches[i].reset();
+    }
+    if (num_batches < num_formatters) {
+      break;
+    }
+  }
+  return Status::OK();
+}
+
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  TableBatchReader reader(table);
+  reader.set_chunksize(options.batch_size);
+  return WriteCSV(&reader, options, pool, output);
+}
+
+}  // namespace csv
+}  // namespace arrow
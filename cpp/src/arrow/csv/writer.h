@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+class OutputStream;
+}  // namespace io
+
+namespace csv {
+
+/// \brief Write a Table as CSV
+///
+/// Values are separated by commas and rows are terminated by a newline.
+/// Nulls are written as empty values.  String and binary values are quoted
+/// only if they contain a comma, a quote or a line break; quotes inside
+/// them are doubled.
+///
+/// Null, boolean, numeric, decimal, string, binary and dictionary-encoded
+/// columns are supported.
+///
+/// If `WriteOptions::use_threads` is true, slices of `WriteOptions::batch_size`
+/// rows are formatted in parallel on the CPU thread pool, and written in order.
+ARROW_EXPORT
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+/// \brief Write all record batches from a RecordBatchReader as CSV
+///
+/// See the Table overload for the output format.
+ARROW_EXPORT
+Status WriteCSV(RecordBatchReader* reader, const WriteOptions& options,
+                MemoryPool* pool, io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace csv {
+
+constexpr int64_t kNumRows = 100000;
+
+// A table of integers, floats and strings (some of them needing quotes)
+static std::shared_ptr<Table> BuildTable() {
+  auto rand = random::RandomArrayGenerator(0x9af4);
+  std::shared_ptr<Array> strings;
+  {
+    StringBuilder builder;
+    const char* values[] = {"abc", "d,f", "some longer text value", "", "\"quoted\""};
+    for (int64_t i = 0; i < kNumRows; ++i) {
+      ABORT_NOT_OK(builder.Append(values[i % 5]));
+    }
+    ABORT_NOT_OK(builder.Finish(&strings));
+  }
+  return Table::Make(::arrow::schema({field("i", int64()), field("f", float64()),
+                                      field("s", utf8()), field("j", int32())}),
+                     {rand.Int64(kNumRows, -1000000000, 1000000000, 0.05),
+                      rand.Float64(kNumRows, -1e6, 1e6, 0.05), strings,
+                      rand.Int32(kNumRows, 0, 1000, 0)});
+}
+
+static std::shared_ptr<Buffer> WriteTable(const Table& table,
+                                          const WriteOptions& options) {
+  auto output = *io::BufferOutputStream::Create();
+  ABORT_NOT_OK(WriteCSV(table, options, default_memory_pool(), output.get()));
+  return *output->Finish();
+}
+
+static void BenchmarkWriteCSV(benchmark::State& state,  // NOLINT non-const reference
+                              bool use_threads) {
+  auto table = BuildTable();
+  auto options = WriteOptions::Defaults();
+  options.use_threads = use_threads;
+  int64_t csv_size = 0;
+
+  while (state.KeepRunning()) {
+    csv_size = WriteTable(*table, options)->size();
+  }
+
+  state.SetBytesProcessed(state.iterations() * csv_size);
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+// Reads back the same data, for comparing write and parse rates
+static void BenchmarkReadCSV(benchmark::State& state,  // NOLINT non-const reference
+                             bool use_threads) {
+  auto table = BuildTable();
+  auto csv = WriteTable(*table, WriteOptions::Defaults());
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = use_threads;
+
+  while (state.KeepRunning()) {
+    auto reader =
+        *TableReader::Make(default_memory_pool(), std::make_shared<io::BufferReader>(csv),
+                           read_options, ParseOptions::Defaults(),
+                           ConvertOptions::Defaults());
+    auto result = *reader->Read();
+    benchmark::DoNotOptimize(result->num_rows());
+  }
+
+  state.SetBytesProcessed(state.iterations() * csv->size());
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void WriteCSVSerial(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkWriteCSV(state, false);
+}
+
+static void WriteCSVThreaded(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkWriteCSV(state, true);
+}
+
+static void ReadCSVSerial(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadCSV(state, false);
+}
+
+static void ReadCSVThreaded(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadCSV(state, true);
+}
+
+BENCHMARK(WriteCSVSerial);
+BENCHMARK(WriteCSVThreaded)->UseRealTime();
+BENCHMARK(ReadCSVSerial);
+BENCHMARK(ReadCSVThreaded)->UseRealTime();
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,197 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+class TestWriter : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    write_options_ = WriteOptions::Defaults();
+    write_options_.use_threads = GetParam();
+  }
+
+  Result<std::string> WriteTable(const Table& table) {
+    ARROW_ASSIGN_OR_RAISE(auto output, io::BufferOutputStream::Create());
+    RETURN_NOT_OK(WriteCSV(table, write_options_, default_memory_pool(), output.get()));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, output->Finish());
+    return buffer->ToString();
+  }
+
+  void AssertWrite(const std::shared_ptr<Schema>& schema,
+                   const std::vector<std::string>& columns_json,
+                   const std::string& expected) {
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      columns.push_back(ArrayFromJSON(schema->field(i)->type(), columns_json[i]));
+    }
+    ASSERT_OK_AND_ASSIGN(auto csv, WriteTable(*Table::Make(schema, columns)));
+    ASSERT_EQ(expected, csv);
+  }
+
+ protected:
+  WriteOptions write_options_;
+};
+
+TEST_P(TestWriter, Basics) {
+  auto schema = ::arrow::schema({field("i", int32()), field("f", float64()),
+                                 field("b", boolean()), field("s", utf8()),
+                                 field("n", null())});
+  AssertWrite(schema,
+              {"[1, -2, null]", "[1.5, null, -0.25]", "[true, false, null]",
+               R"(["ab", null, ""])", "[null, null, null]"},
+              "i,f,b,s,n\n1,1.5,true,ab,\n-2,,false,,\n,-0.25,,,\n");
+
+  write_options_.include_header = false;
+  AssertWrite(schema, {"[7]", "[1e100]", "[true]", R"(["x y"])", "[null]"},
+              "7,1e+100,true,x y,\n");
+
+  // Empty table
+  write_options_.include_header = true;
+  AssertWrite(schema, {"[]", "[]", "[]", "[]", "[]"}, "i,f,b,s,n\n");
+}
+
+TEST_P(TestWriter, Decimal) {
+  auto schema = ::arrow::schema({field("d", decimal(7, 3)), field("e", decimal(38, 0))});
+  AssertWrite(schema,
+              {R"(["1.500", null, "-0.005", "1234.567"])",
+               R"(["-99999999999999999999999999999999999999", "0", null, "7"])"},
+              "d,e\n1.500,-99999999999999999999999999999999999999\n,0\n-0.005,\n"
+              "1234.567,7\n");
+}
+
+TEST_P(TestWriter, Quoting) {
+  // Only values containing a delimiter, a quote or a line break are quoted
+  std::shared_ptr<Array> strings, binaries;
+  ArrayFromVector<StringType, std::string>(
+      {"x,y", "say \"hi\"", "two\nlines", "cr\r", "plain"}, &strings);
+  ArrayFromVector<BinaryType, std::string>({true, true, true, true, false},
+                                           {"", "\"", "a b", "'", ""}, &binaries);
+  auto table = Table::Make(::arrow::schema({field("a,b", utf8()), field("c", binary())}),
+                           {strings, binaries});
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteTable(*table));
+  ASSERT_EQ(
+      "\"a,b\",c\n\"x,y\",\n\"say \"\"hi\"\"\",\"\"\"\"\n"
+      "\"two\nlines\",a b\n\"cr\r\",'\nplain,\n",
+      csv);
+}
+
+TEST_P(TestWriter, Dictionary) {
+  auto dict_type = dictionary(int8(), utf8());
+  auto indices = ArrayFromJSON(int8(), "[1, null, 0, 1, 2]");
+  auto dict = ArrayFromJSON(utf8(), R"(["a,b", "cd", ""])");
+  std::shared_ptr<Array> dict_array;
+  ASSERT_OK(DictionaryArray::FromArrays(dict_type, indices, dict, &dict_array));
+  auto table = Table::Make(::arrow::schema({field("d", dict_type)}), {dict_array});
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteTable(*table));
+  ASSERT_EQ("d\ncd\n\n\"a,b\"\ncd\n\n", csv);
+}
+
+TEST_P(TestWriter, MultipleBatches) {
+  // Batches are sliced to batch_size and written in order
+  auto schema = ::arrow::schema({field("i", int64()), field("s", utf8())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  std::string expected = "i,s\n";
+  int64_t value = 0;
+  for (const int64_t length : {5, 0, 23, 1, 40}) {
+    Int64Builder int_builder;
+    StringBuilder string_builder;
+    for (int64_t i = 0; i < length; ++i, ++value) {
+      ASSERT_OK(int_builder.Append(value));
+      ASSERT_OK(string_builder.Append("v" + std::to_string(value)));
+      expected += std::to_string(value) + ",v" + std::to_string(value) + "\n";
+    }
+    std::shared_ptr<Array> ints, strings;
+    ASSERT_OK(int_builder.Finish(&ints));
+    ASSERT_OK(string_builder.Finish(&strings));
+    batches.push_back(RecordBatch::Make(schema, length, {ints, strings}));
+  }
+
+  for (const int32_t batch_size : {1, 7, 1000}) {
+    write_options_.batch_size = batch_size;
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(MakeRecordBatchReader(batches, schema, &reader));
+    ASSERT_OK_AND_ASSIGN(auto output, io::BufferOutputStream::Create());
+    ASSERT_OK(WriteCSV(reader.get(), write_options_, default_memory_pool(),
+                       output.get()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, output->Finish());
+    ASSERT_EQ(expected, buffer->ToString());
+  }
+}
+
+TEST_P(TestWriter, RoundTrip) {
+  // What is written is read back identically
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  const int64_t length = 3000;
+  auto table = Table::Make(
+      ::arrow::schema({field("i", int64()), field("f", float64()),
+                       field("s", utf8())}),
+      {rand.Int64(length, -1000000, 1000000, 0.1),
+       rand.Float64(length, -1e10, 1e10, 0.1), rand.String(length, 1, 20, 0)});
+  write_options_.batch_size = 100;
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteTable(*table));
+
+  auto convert_options = ConvertOptions::Defaults();
+  convert_options.column_types = {{"i", int64()}, {"f", float64()}, {"s", utf8()}};
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(std::move(csv)));
+  ASSERT_OK_AND_ASSIGN(auto reader, TableReader::Make(default_memory_pool(), input,
+                                                      ReadOptions::Defaults(),
+                                                      ParseOptions::Defaults(),
+                                                      convert_options));
+  ASSERT_OK_AND_ASSIGN(auto actual, reader->Read());
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestWriter, Errors) {
+  write_options_.batch_size = 0;
+  auto table = Table::Make(::arrow::schema({field("i", int32())}),
+                           {ArrayFromJSON(int32(), "[1]")});
+  ASSERT_RAISES(Invalid, WriteTable(*table));
+
+  write_options_ = WriteOptions::Defaults();
+  auto type = timestamp(TimeUnit::SECOND);
+  table =
+      Table::Make(::arrow::schema({field("t", type)}), {ArrayFromJSON(type, "[0]")});
+  ASSERT_RAISES(NotImplemented, WriteTable(*table));
+}
+
+INSTANTIATE_TEST_CASE_P(SerialWriter, TestWriter, ::testing::Values(false));
+INSTANTIATE_TEST_CASE_P(ThreadedWriter, TestWriter, ::testing::Values(true));
+
+}  // namespace csv
+}  // namespace arrow
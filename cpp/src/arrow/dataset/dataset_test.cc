@@ -234,6 +234,59 @@ TEST(TestProjector, NonTrivial) {
   AssertBatchesEqual(*expected_batch, *reconciled_batch);
 }
 
+TEST(TestProjector, HeterogeneousSchemas) {
+  auto schema_a = schema({field("f64", float64())});
+  auto schema_b = schema({field("i32", int32()), field("b", boolean())});
+  auto to_schema = schema({field("i32", int32()), field("f64", float64())});
+
+  RecordBatchProjector projector(to_schema);
+  ASSERT_OK(projector.SetDefaultValue(to_schema->GetFieldIndex("f64"),
+                                      std::make_shared<DoubleScalar>(1.5)));
+
+  auto expect_projection = [&](const std::shared_ptr<Schema>& from, int64_t length) {
+    auto batch = ConstantArrayGenerator::Zeroes(length, from);
+    ASSERT_OK_AND_ASSIGN(auto projected, projector.Project(*batch));
+    ASSERT_OK(projected->ValidateFull());
+    ASSERT_EQ(projected->num_rows(), length);
+
+    std::shared_ptr<Array> expected_i32, expected_f64;
+    if (from->GetFieldIndex("i32") == -1) {
+      ASSERT_OK(MakeArrayOfNull(int32(), length, &expected_i32));
+    } else {
+      expected_i32 = batch->GetColumnByName("i32");
+    }
+    if (from->GetFieldIndex("f64") == -1) {
+      ASSERT_OK(MakeArrayFromScalar(DoubleScalar(1.5), length, &expected_f64));
+    } else {
+      expected_f64 = batch->GetColumnByName("f64");
+    }
+    auto expected = RecordBatch::Make(to_schema, length, {expected_i32, expected_f64});
+    AssertBatchesEqual(*expected, *projected);
+  };
+
+  // Alternate between input schemas, with growing and shrinking batches
+  expect_projection(schema_a, 10);
+  expect_projection(schema_b, 5);
+  expect_projection(schema_a, 20);
+  expect_projection(schema_b, 30);
+  expect_projection(schema_a, 3);
+  expect_projection(schema({field("f64", float64())}), 0);
+}
+
+TEST(TestProjector, ReuseMissingColumns) {
+  auto from_schema = schema({field("f64", float64())});
+  auto to_schema = schema({field("i32", int32()), field("f64", float64())});
+  RecordBatchProjector projector(to_schema);
+
+  auto batch = ConstantArrayGenerator::Zeroes(100, from_schema);
+  ASSERT_OK_AND_ASSIGN(auto first, projector.Project(*batch));
+  ASSERT_OK_AND_ASSIGN(auto second, projector.Project(*batch->Slice(0, 40)));
+
+  // The null column of the second batch is a slice of that of the first one
+  ASSERT_EQ(second->column(0)->length(), 40);
+  ASSERT_EQ(first->column(0)->data()->buffers, second->column(0)->data()->buffers);
+}
+
 class TestEndToEnd : public TestDataset {
   void SetUp() {
     bool nullable = false;
@@ -30,12 +30,33 @@
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/util/future.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
 
 SourceFactory::SourceFactory() : root_partition_(scalar(true)) {}
 
+namespace {
+
+// Unify schemas, skipping those equal to the one before. Files written by the
+// same producer usually share a schema, which then needn't be merged field by
+// field once per file.
+Result<std::shared_ptr<Schema>> UnifyDistinctSchemas(
+    const std::vector<std::shared_ptr<Schema>>& schemas) {
+  std::vector<std::shared_ptr<Schema>> distinct;
+  for (const auto& schema : schemas) {
+    if (distinct.empty() || !distinct.back()->Equals(*schema, /*check_metadata=*/false)) {
+      distinct.push_back(schema);
+    }
+  }
+  return UnifySchemas(distinct);
+}
+
+}  // namespace
+
 Result<std::shared_ptr<Schema>> SourceFactory::Inspect() {
   ARROW_ASSIGN_OR_RAISE(auto schemas, InspectSchemas());
 
@@ -43,7 +64,7 @@ Result<std::shared_ptr<Schema>> SourceFactory::Inspect() {
     schemas.push_back(arrow::schema({}));
   }
 
-  return UnifySchemas(schemas);
+  return UnifyDistinctSchemas(schemas);
 }
 
 DatasetFactory::DatasetFactory(std::vector<std::shared_ptr<SourceFactory>> factories)
@@ -79,7 +100,7 @@ Result<std::shared_ptr<Schema>> DatasetFactory::Inspect() {
     return arrow::schema({});
   }
 
-  return UnifySchemas(schemas);
+  return UnifyDistinctSchemas(schemas);
 }
 
 Result<std::shared_ptr<Dataset>> DatasetFactory::Finish(
@@ -186,11 +207,45 @@ Result<std::shared_ptr<SourceFactory>> FileSystemSourceFactory::Make(
 Result<std::shared_ptr<SourceFactory>> FileSystemSourceFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetTargetStats(selector));
+  // Files are checked with FileFormat::IsSupported on the I/O thread pool as soon
+  // as they are listed, while the listing continues
+  ARROW_ASSIGN_OR_RAISE(auto batches, filesystem->GetTargetStatsBatches(selector));
+  fs::FileStatsVector files;
+  std::vector<Future<bool>> checks;
+  for (auto maybe_batch : batches) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+    for (auto& stats : batch) {
+      if (options.exclude_invalid_files && stats.IsFile() &&
+          !StartsWithAnyOf(options.ignore_prefixes, stats.path())) {
+        auto path = stats.path();
+        ARROW_ASSIGN_OR_RAISE(auto check, io::internal::GetIOThreadPool()->Submit(
+                                              [filesystem, format, path] {
+                                                return format->IsSupported(
+                                                    FileSource(path, filesystem.get()));
+                                              }));
+        checks.push_back(std::move(check));
+      } else {
+        checks.push_back(Future<bool>::MakeFinished(true));
+      }
+      files.push_back(std::move(stats));
+    }
+  }
 
-  ARROW_ASSIGN_OR_RAISE(auto forest, fs::PathForest::Make(std::move(files)));
+  fs::FileStatsVector supported_files;
+  for (size_t i = 0; i < files.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto supported, checks[i].result());
+    if (supported) {
+      supported_files.push_back(std::move(files[i]));
+    }
+  }
 
-  ARROW_ASSIGN_OR_RAISE(forest, Filter(filesystem, format, options, std::move(forest)));
+  ARROW_ASSIGN_OR_RAISE(auto forest, fs::PathForest::Make(std::move(supported_files)));
+
+  // The files were already checked
+  auto filter_options = options;
+  filter_options.exclude_invalid_files = false;
+  ARROW_ASSIGN_OR_RAISE(forest,
+                        Filter(filesystem, format, filter_options, std::move(forest)));
 
   // By automatically setting the options base_dir to the selector's base_dir,
   // we provide a better experience for user providing Partitioning that are
@@ -220,13 +275,46 @@ Result<std::shared_ptr<Schema>> FileSystemSourceFactory::PartitionSchema() {
 }
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemSourceFactory::InspectSchemas() {
-  std::vector<std::shared_ptr<Schema>> schemas;
-
+  std::vector<std::string> paths;
   for (const auto& f : forest_.stats()) {
     if (!f.IsFile()) continue;
-    FileSource src(f.path(), fs_.get());
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect(src));
-    schemas.push_back(schema);
+    if (options_.inspect_files >= 0 &&
+        paths.size() >= static_cast<size_t>(options_.inspect_files)) {
+      break;
+    }
+    paths.push_back(f.path());
+  }
+
+  std::vector<std::shared_ptr<Schema>> schemas;
+  if (options_.inspect_concurrency <= 1) {
+    for (const auto& path : paths) {
+      ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect(FileSource(path, fs_.get())));
+      schemas.push_back(std::move(schema));
+    }
+  } else {
+    // Keep at most inspect_concurrency files open at once, consuming the
+    // schemas in order as they come
+    const size_t max_pending = static_cast<size_t>(options_.inspect_concurrency);
+    auto filesystem = fs_;
+    auto format = format_;
+    std::vector<Future<std::shared_ptr<Schema>>> inspections;
+    for (const auto& path : paths) {
+      if (inspections.size() - schemas.size() == max_pending) {
+        ARROW_ASSIGN_OR_RAISE(auto schema, inspections[schemas.size()].result());
+        schemas.push_back(std::move(schema));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto inspection,
+                            io::internal::GetIOThreadPool()->Submit(
+                                [filesystem, format, path] {
+                                  return format->Inspect(
+                                      FileSource(path, filesystem.get()));
+                                }));
+      inspections.push_back(std::move(inspection));
+    }
+    while (schemas.size() < inspections.size()) {
+      ARROW_ASSIGN_OR_RAISE(auto schema, inspections[schemas.size()].result());
+      schemas.push_back(std::move(schema));
+    }
   }
 
   ARROW_ASSIGN_OR_RAISE(auto partition_schema, PartitionSchema());
@@ -248,6 +336,13 @@ Result<std::shared_ptr<Source>> FileSystemSourceFactory::Finish(
     RETURN_NOT_OK(SchemaBuilder::AreCompatible({schema, s}));
   }
 
+  ARROW_ASSIGN_OR_RAISE(auto partitions, ApplyPartitioning(schema));
+  return FileSystemSource::Make(schema, root_partition_, format_, fs_, forest_,
+                                std::move(partitions));
+}
+
+Result<ExpressionVector> FileSystemSourceFactory::ApplyPartitioning(
+    const std::shared_ptr<Schema>& schema) {
   ExpressionVector partitions(forest_.size(), scalar(true));
   std::shared_ptr<Partitioning> partitioning = options_.partitioning.partitioning();
   if (partitioning == nullptr) {
@@ -272,9 +367,7 @@ Result<std::shared_ptr<Source>> FileSystemSourceFactory::Finish(
   };
 
   RETURN_NOT_OK(forest_.Visit(apply_partitioning));
-
-  return FileSystemSource::Make(schema, root_partition_, format_, fs_, forest_,
-                                std::move(partitions));
+  return partitions;
 }
 
 }  // namespace dataset
@@ -127,9 +127,10 @@ struct FileSystemFactoryOptions {
   std::string partition_base_dir;
 
   // Invalid files (via selector or explicitly) will be excluded by checking
-  // with the FileFormat::IsSupported method.  This will incur IO for each files
-  // in a serial and single threaded fashion. Disabling this feature will skip the
-  // IO, but unsupported files may be present in the Source
+  // with the FileFormat::IsSupported method.  This will incur IO for each files.
+  // Files discovered via a selector are checked on the I/O thread pool while the
+  // listing proceeds; explicit paths are checked serially. Disabling this feature
+  // will skip the IO, but unsupported files may be present in the Source
   // (resulting in an error at scan time).
   bool exclude_invalid_files = true;
 
@@ -146,6 +147,20 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  static constexpr int kInspectAllFiles = -1;
+
+  // Number of files whose schema is read by InspectSchemas(), in the order
+  // of the discovered paths. A negative value means all of them.
+  //
+  // When the files are known to share a schema, inspecting a single one is
+  // enough and avoids opening every file of the dataset. Finish() then only
+  // validates the requested schema against the inspected files.
+  int inspect_files = kInspectAllFiles;
+
+  // Maximum number of files inspected at once, on the I/O thread pool.
+  // A value of 1 inspects the files serially on the calling thread.
+  int inspect_concurrency = 8;
 };
 
 /// \brief FileSystemSourceFactory creates a Source from a vector of
@@ -196,6 +211,9 @@ class ARROW_DS_EXPORT FileSystemSourceFactory : public SourceFactory {
 
   Result<std::shared_ptr<Schema>> PartitionSchema();
 
+  /// \brief Return the partition expression of each node of forest_
+  Result<ExpressionVector> ApplyPartitioning(const std::shared_ptr<Schema>& schema);
+
   std::shared_ptr<fs::FileSystem> fs_;
   fs::PathForest forest_;
   std::shared_ptr<FileFormat> format_;
@@ -250,6 +250,32 @@ TEST_F(FileSystemSourceFactoryTest, Inspect) {
   AssertInspect(s->fields());
 }
 
+TEST_F(FileSystemSourceFactoryTest, InspectSample) {
+  auto s = schema({field("f64", float64())});
+  format_ = std::make_shared<DummyFileFormat>(s);
+  std::vector<fs::FileStats> files;
+  for (int i = 0; i < 10; ++i) {
+    files.push_back(fs::File("file" + std::to_string(i)));
+  }
+
+  for (int concurrency : {1, 3}) {
+    factory_options_.inspect_concurrency = concurrency;
+
+    // The schemas of the files, then of the partitioning
+    factory_options_.inspect_files = FileSystemFactoryOptions::kInspectAllFiles;
+    MakeFactory(files);
+    ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas());
+    ASSERT_EQ(schemas.size(), files.size() + 1);
+    AssertInspect(s->fields());
+
+    factory_options_.inspect_files = 2;
+    MakeFactory(files);
+    ASSERT_OK_AND_ASSIGN(schemas, factory_->InspectSchemas());
+    ASSERT_EQ(schemas.size(), 3U);
+    AssertInspect(s->fields());
+  }
+}
+
 TEST_F(FileSystemSourceFactoryTest, FinishWithIncompatibleSchemaShouldFail) {
   auto s = schema({field("f64", float64())});
   format_ = std::make_shared<DummyFileFormat>(s);
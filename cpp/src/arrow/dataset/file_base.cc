@@ -18,31 +18,56 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner_internal.h"
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 namespace dataset {
 
 Result<std::shared_ptr<arrow::io::RandomAccessFile>> FileSource::Open() const {
+  std::shared_ptr<arrow::io::RandomAccessFile> file;
   if (type() == PATH) {
-    return filesystem()->OpenInputFile(path());
+    ARROW_ASSIGN_OR_RAISE(file, filesystem()->OpenInputFile(path()));
+  } else {
+    file = std::make_shared<::arrow::io::BufferReader>(buffer());
   }
 
-  return std::make_shared<::arrow::io::BufferReader>(buffer());
+  // Files opened while scanning with ScanContext::metrics record their reads
+  return MeterReads(std::move(file));
 }
 
 Result<ScanTaskIterator> FileFragment::Scan(std::shared_ptr<ScanContext> context) {
   return format_->ScanFile(source_, scan_options_, context);
 }
 
+Result<std::shared_ptr<FileWriter>> FileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema) const {
+  return Status::NotImplemented("writing files of format ", type_name());
+}
+
 FileSystemSource::FileSystemSource(std::shared_ptr<Schema> schema,
                                    std::shared_ptr<Expression> root_partition,
                                    std::shared_ptr<FileFormat> format,
@@ -53,7 +78,8 @@ FileSystemSource::FileSystemSource(std::shared_ptr<Schema> schema,
       format_(std::move(format)),
       filesystem_(std::move(filesystem)),
       forest_(std::move(forest)),
-      partitions_(std::move(file_partitions)) {
+      partitions_(std::move(file_partitions)),
+      partition_index_(partitions_) {
   DCHECK_EQ(static_cast<size_t>(forest_.size()), partitions_.size());
 }
 
@@ -135,7 +161,14 @@ FragmentIterator FileSystemSource::GetFragmentsImpl(
   FragmentVector fragments;
   std::vector<std::shared_ptr<ScanOptions>> options(forest_.size());
 
+  // exclude the partitions whose keys contradict the filter before simplifying it
+  auto selection = partition_index_.Select(*root_options->filter);
+
   auto collect_fragments = [&](fs::PathForest::Ref ref) -> fs::PathForest::MaybePrune {
+    if (!selection.Contains(ref.i)) {
+      return fs::PathForest::Prune;
+    }
+
     auto partition = partitions_[ref.i];
 
     // if available, copy parent's filter and projector
@@ -182,5 +215,341 @@ FragmentIterator FileSystemSource::GetFragmentsImpl(
   return MakeVectorIterator(std::move(fragments));
 }
 
+namespace {
+
+using internal::checked_cast;
+
+/// \brief Format the value at index of an array of partition keys
+class PartitionValueFormatter {
+ public:
+  PartitionValueFormatter(const Array& values, int64_t index, std::string* out)
+      : values_(values), index_(index), out_(out) {}
+
+  template <typename T, typename Formatter = internal::StringFormatter<T>,
+            typename Value = typename Formatter::value_type>
+  Status Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    Formatter formatter(values_.type());
+    return formatter(checked_cast<const ArrayType&>(values_).Value(index_),
+                     [this](util::string_view repr) {
+                       *out_ = repr.to_string();
+                       return Status::OK();
+                     });
+  }
+
+  Status Visit(const BinaryType&) {
+    *out_ = checked_cast<const BinaryArray&>(values_).GetString(index_);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("writing partition keys of type ", type);
+  }
+
+ private:
+  const Array& values_;
+  int64_t index_;
+  std::string* out_;
+};
+
+/// \brief Rows of a batch which belong to the same partition directory
+struct PartitionGroup {
+  std::string directory;
+  std::shared_ptr<RecordBatch> batch;
+};
+
+/// \brief A file being written, keyed by its partition directory
+struct OpenFile {
+  std::shared_ptr<FileWriter> writer;
+  int64_t num_rows = 0;
+  uint64_t last_used = 0;
+};
+
+class DatasetWriter {
+ public:
+  explicit DatasetWriter(const WriteOptions& options) : options_(options) {}
+
+  Status Init(const std::shared_ptr<Schema>& schema) {
+    if (options_.format == nullptr || options_.filesystem == nullptr) {
+      return Status::Invalid("writing a dataset requires a format and a filesystem");
+    }
+    if (options_.max_open_files <= 0 || options_.max_rows_per_file < 0) {
+      return Status::Invalid("max_open_files must be positive and max_rows_per_file ",
+                             "must not be negative");
+    }
+
+    const auto& partitioning = options_.partitioning;
+    if (partitioning != nullptr && partitioning->schema()->num_fields() > 0) {
+      key_value_partitioning_ = dynamic_cast<KeyValuePartitioning*>(partitioning.get());
+      if (key_value_partitioning_ == nullptr) {
+        return Status::NotImplemented("writing a dataset with a partitioning of type ",
+                                      partitioning->type_name());
+      }
+    }
+
+    std::unordered_set<int> key_indices;
+    if (key_value_partitioning_ != nullptr) {
+      for (const auto& field : partitioning->schema()->fields()) {
+        auto index = schema->GetFieldIndex(field->name());
+        if (index == -1) {
+          return Status::Invalid("no field named '", field->name(),
+                                 "' to partition by in schema ", *schema);
+        }
+        key_indices_.push_back(index);
+        key_indices.insert(index);
+      }
+    }
+
+    std::vector<std::shared_ptr<Field>> data_fields;
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      if (key_indices.count(i) == 0) {
+        data_indices_.push_back(i);
+        data_fields.push_back(schema->field(i));
+      }
+    }
+
+    schema_ = schema;
+    data_schema_ = ::arrow::schema(std::move(data_fields), schema->metadata());
+
+    basename_template_ = options_.basename_template;
+    if (basename_template_.empty()) {
+      basename_template_ = "part-{i}." + options_.format->type_name();
+    }
+    if (basename_template_.find("{i}") == std::string::npos) {
+      return Status::Invalid("basename_template '", basename_template_,
+                             "' does not contain {i}");
+    }
+
+    task_group_ = MakeTaskGroup();
+    return Status::OK();
+  }
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) {
+    if (schema_ == nullptr) {
+      RETURN_NOT_OK(Init(batch->schema()));
+    } else if (!batch->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("batch schema ", *batch->schema(),
+                             " differs from the schema of the written dataset ",
+                             *schema_);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto groups, Split(batch));
+
+    // Groups go to distinct files, so their writes are independent
+    const int64_t max_rows = options_.max_rows_per_file;
+    for (auto& group : groups) {
+      int64_t offset = 0;
+      while (offset < group.batch->num_rows()) {
+        ARROW_ASSIGN_OR_RAISE(auto file, GetFile(group.directory));
+
+        int64_t length = group.batch->num_rows() - offset;
+        if (max_rows > 0) {
+          length = std::min(length, max_rows - file->num_rows);
+        }
+        auto slice = group.batch->Slice(offset, length);
+        offset += length;
+
+        file->num_rows += length;
+        if (max_rows > 0 && file->num_rows == max_rows) {
+          // finished once its pending writes are done
+          full_files_.push_back(file);
+          open_files_.erase(group.directory);
+        }
+
+        task_group_->Append([file, slice] { return file->writer->Write(slice); });
+      }
+    }
+
+    return FinishPendingWrites();
+  }
+
+  Result<std::vector<std::string>> Finish() {
+    if (schema_ == nullptr) {
+      // nothing was written
+      return std::vector<std::string>{};
+    }
+
+    RETURN_NOT_OK(FinishPendingWrites());
+    for (const auto& directory_file : open_files_) {
+      RETURN_NOT_OK(directory_file.second->writer->Finish());
+    }
+    open_files_.clear();
+    return std::move(paths_);
+  }
+
+ private:
+  std::shared_ptr<internal::TaskGroup> MakeTaskGroup() const {
+    if (options_.use_threads) {
+      return internal::TaskGroup::MakeThreaded(internal::GetCpuThreadPool());
+    }
+    return internal::TaskGroup::MakeSerial();
+  }
+
+  Status FinishPendingWrites() {
+    auto status = task_group_->Finish();
+    task_group_ = MakeTaskGroup();
+    RETURN_NOT_OK(status);
+
+    for (const auto& file : full_files_) {
+      RETURN_NOT_OK(file->writer->Finish());
+    }
+    full_files_.clear();
+    return Status::OK();
+  }
+
+  Result<std::vector<PartitionGroup>> Split(const std::shared_ptr<RecordBatch>& batch) {
+    std::vector<std::shared_ptr<Array>> data_columns;
+    for (int i : data_indices_) {
+      data_columns.push_back(batch->column(i));
+    }
+    auto data = RecordBatch::Make(data_schema_, batch->num_rows(), data_columns);
+
+    if (key_value_partitioning_ == nullptr) {
+      return std::vector<PartitionGroup>{{"", std::move(data)}};
+    }
+
+    // Dictionary encode the keys, so that rows are grouped by the tuple of
+    // their dictionary indices
+    compute::FunctionContext ctx(options_.pool);
+    const size_t num_keys = key_indices_.size();
+    std::vector<std::shared_ptr<DictionaryArray>> encoded_keys(num_keys);
+    std::vector<const int32_t*> key_codes(num_keys);
+    for (size_t k = 0; k < num_keys; ++k) {
+      const auto& column = batch->column(key_indices_[k]);
+      if (column->null_count() != 0) {
+        return Status::Invalid("partition field '",
+                               schema_->field(key_indices_[k])->name(),
+                               "' has null values, which cannot be written");
+      }
+
+      compute::Datum encoded;
+      RETURN_NOT_OK(compute::DictionaryEncode(&ctx, column, &encoded));
+      encoded_keys[k] = std::static_pointer_cast<DictionaryArray>(encoded.make_array());
+      key_codes[k] =
+          checked_cast<const Int32Array&>(*encoded_keys[k]->indices()).raw_values();
+    }
+
+    std::unordered_map<std::string, size_t> group_ids;
+    std::vector<int64_t> first_rows;
+    std::vector<std::unique_ptr<Int32Builder>> group_rows;
+    std::string tuple(num_keys * sizeof(int32_t), '\0');
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      for (size_t k = 0; k < num_keys; ++k) {
+        std::memcpy(&tuple[k * sizeof(int32_t)], key_codes[k] + row, sizeof(int32_t));
+      }
+
+      auto inserted = group_ids.emplace(tuple, first_rows.size());
+      if (inserted.second) {
+        first_rows.push_back(row);
+        group_rows.emplace_back(new Int32Builder(options_.pool));
+      }
+      auto group_id = inserted.first->second;
+      RETURN_NOT_OK(group_rows[group_id]->Append(static_cast<int32_t>(row)));
+    }
+
+    std::vector<PartitionGroup> groups(first_rows.size());
+    for (size_t g = 0; g < groups.size(); ++g) {
+      std::vector<KeyValuePartitioning::Key> keys(num_keys);
+      for (size_t k = 0; k < num_keys; ++k) {
+        keys[k].name = schema_->field(key_indices_[k])->name();
+        const auto& dictionary = *encoded_keys[k]->dictionary();
+        PartitionValueFormatter formatter(dictionary, key_codes[k][first_rows[g]],
+                                          &keys[k].value);
+        RETURN_NOT_OK(VisitTypeInline(*dictionary.type(), &formatter));
+      }
+      ARROW_ASSIGN_OR_RAISE(groups[g].directory, key_value_partitioning_->Format(keys));
+
+      if (groups.size() == 1) {
+        groups[g].batch = data;
+        break;
+      }
+
+      std::shared_ptr<Array> indices;
+      RETURN_NOT_OK(group_rows[g]->Finish(&indices));
+      RETURN_NOT_OK(compute::Take(&ctx, *data, *indices, compute::TakeOptions(),
+                                  &groups[g].batch));
+    }
+
+    return groups;
+  }
+
+  /// Return the open file of a directory, opening it if necessary
+  Result<std::shared_ptr<OpenFile>> GetFile(const std::string& directory) {
+    auto it = open_files_.find(directory);
+    if (it != open_files_.end()) {
+      it->second->last_used = ++clock_;
+      return it->second;
+    }
+
+    const size_t max_open_files = static_cast<size_t>(options_.max_open_files);
+    if (open_files_.size() + full_files_.size() >= max_open_files) {
+      // the files to be closed may have pending writes
+      RETURN_NOT_OK(FinishPendingWrites());
+    }
+    if (open_files_.size() >= max_open_files) {
+      auto least_recently_used = std::min_element(
+          open_files_.begin(), open_files_.end(),
+          [](const std::pair<const std::string, std::shared_ptr<OpenFile>>& l,
+             const std::pair<const std::string, std::shared_ptr<OpenFile>>& r) {
+            return l.second->last_used < r.second->last_used;
+          });
+      RETURN_NOT_OK(least_recently_used->second->writer->Finish());
+      open_files_.erase(least_recently_used);
+    }
+
+    auto dir = directory.empty()
+                   ? options_.base_dir
+                   : fs::internal::ConcatAbstractPath(options_.base_dir, directory);
+    if (!dir.empty() && created_dirs_.insert(dir).second) {
+      RETURN_NOT_OK(options_.filesystem->CreateDir(dir));
+    }
+
+    auto basename = basename_template_;
+    basename.replace(basename.find("{i}"), 3, std::to_string(paths_.size()));
+    auto path = dir.empty() ? basename : fs::internal::ConcatAbstractPath(dir, basename);
+
+    ARROW_ASSIGN_OR_RAISE(auto destination, options_.filesystem->OpenOutputStream(path));
+    auto file = std::make_shared<OpenFile>();
+    ARROW_ASSIGN_OR_RAISE(
+        file->writer, options_.format->MakeWriter(std::move(destination), data_schema_));
+    file->last_used = ++clock_;
+
+    paths_.push_back(std::move(path));
+    open_files_.emplace(directory, file);
+    return file;
+  }
+
+  const WriteOptions& options_;
+  KeyValuePartitioning* key_value_partitioning_ = nullptr;
+  std::shared_ptr<Schema> schema_, data_schema_;
+  std::vector<int> key_indices_, data_indices_;
+  std::string basename_template_;
+
+  std::shared_ptr<internal::TaskGroup> task_group_;
+  std::unordered_map<std::string, std::shared_ptr<OpenFile>> open_files_;
+  std::vector<std::shared_ptr<OpenFile>> full_files_;
+  std::unordered_set<std::string> created_dirs_;
+  std::vector<std::string> paths_;
+  uint64_t clock_ = 0;
+};
+
+}  // namespace
+
+Result<std::vector<std::string>> WriteDataset(RecordBatchIterator batches,
+                                              const WriteOptions& options) {
+  DatasetWriter writer(options);
+  for (auto maybe_batch : batches) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+    RETURN_NOT_OK(writer.Write(batch));
+  }
+  return writer.Finish();
+}
+
+Result<std::vector<std::string>> WriteDataset(Scanner* scanner,
+                                              const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto batches, scanner->ScanBatches());
+  return WriteDataset(std::move(batches), options);
+}
+
 }  // namespace dataset
 }  // namespace arrow
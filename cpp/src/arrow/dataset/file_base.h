@@ -25,6 +25,7 @@
 
 #include "arrow/buffer.h"
 #include "arrow/dataset/dataset.h"
+#include "arrow/dataset/filter.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/dataset/type_fwd.h"
@@ -109,6 +110,18 @@ class ARROW_DS_EXPORT FileSource {
   Compression::type compression_;
 };
 
+/// \brief Writer of the record batches of a single file
+class ARROW_DS_EXPORT FileWriter {
+ public:
+  virtual ~FileWriter() = default;
+
+  /// \brief Append a batch, whose schema must be that of the writer
+  virtual Status Write(const std::shared_ptr<RecordBatch>& batch) = 0;
+
+  /// \brief Write any buffered data and the file footer, then close the file
+  virtual Status Finish() = 0;
+};
+
 /// \brief Base class for file format implementation
 class ARROW_DS_EXPORT FileFormat {
  public:
@@ -131,6 +144,14 @@ class ARROW_DS_EXPORT FileFormat {
   /// \brief Open a fragment
   virtual Result<std::shared_ptr<Fragment>> MakeFragment(
       const FileSource& location, std::shared_ptr<ScanOptions> options) = 0;
+
+  /// \brief Open a writer of files of this format with the given schema.
+  ///
+  /// The destination is closed by FileWriter::Finish. Formats which cannot be
+  /// written return NotImplemented.
+  virtual Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const;
 };
 
 /// \brief A Fragment that is stored in a file with a known format
@@ -229,7 +250,62 @@ class ARROW_DS_EXPORT FileSystemSource : public Source {
   std::shared_ptr<fs::FileSystem> filesystem_;
   fs::PathForest forest_;
   ExpressionVector partitions_;
+
+  // Index of the keys in partitions_, reused by every scan of this source
+  PartitionIndex partition_index_;
 };
 
+/// \brief Options for writing a partitioned dataset with WriteDataset
+struct ARROW_DS_EXPORT WriteOptions {
+  /// Format of the written files, which must support FileFormat::MakeWriter.
+  std::shared_ptr<FileFormat> format;
+
+  /// Filesystem the files are written to.
+  std::shared_ptr<fs::FileSystem> filesystem;
+
+  /// Directory under which the partition directories are created.
+  std::string base_dir;
+
+  /// Partitioning of the rows into directories, either the default
+  /// partitioning (all files are written to base_dir) or a
+  /// KeyValuePartitioning such as DirectoryPartitioning or HivePartitioning.
+  /// The partition fields are looked up by name in the written batches and
+  /// are not written to the files, since they are recovered from the paths.
+  std::shared_ptr<Partitioning> partitioning = Partitioning::Default();
+
+  /// Template of the names of the written files, in which "{i}" is replaced
+  /// by a counter unique to the whole write. If empty, "part-{i}.<format>" is
+  /// used, where <format> is the type_name() of the format.
+  std::string basename_template;
+
+  /// Maximum number of files kept open at once. When reached, the least
+  /// recently written file is finished, and further rows of its partition go
+  /// to a new file.
+  int max_open_files = 1024;
+
+  /// Maximum number of rows written to a single file, or 0 for no limit.
+  int64_t max_rows_per_file = 0;
+
+  /// Whether the groups of rows of each batch are written to their files in
+  /// parallel, using the CPU thread pool.
+  bool use_threads = true;
+
+  /// Pool from which the grouped rows are allocated.
+  MemoryPool* pool = default_memory_pool();
+};
+
+/// \brief Write batches to files of options.format, split into directories by
+/// options.partitioning.
+///
+/// The rows of each batch are grouped by their values of the partition fields,
+/// and each group is appended to an open file of its partition directory.
+/// Returns the paths of the written files, in the order they were opened.
+ARROW_DS_EXPORT Result<std::vector<std::string>> WriteDataset(
+    RecordBatchIterator batches, const WriteOptions& options);
+
+/// \brief Write the batches of a scan, as produced by Scanner::ScanBatches.
+ARROW_DS_EXPORT Result<std::vector<std::string>> WriteDataset(
+    Scanner* scanner, const WriteOptions& options);
+
 }  // namespace dataset
 }  // namespace arrow
@@ -25,7 +25,11 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/dataset/scanner_internal.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/file.h"
 #include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
@@ -33,6 +37,19 @@
 namespace arrow {
 namespace dataset {
 
+/// \brief Open source, memory-mapping it if use_mmap and it is a file of a
+/// LocalFileSystem.
+static Result<std::shared_ptr<io::RandomAccessFile>> OpenInput(const FileSource& source,
+                                                               bool use_mmap) {
+  if (use_mmap && source.type() == FileSource::PATH &&
+      dynamic_cast<fs::LocalFileSystem*>(source.filesystem()) != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(auto file,
+                          io::MemoryMappedFile::Open(source.path(), io::FileMode::READ));
+    return MeterReads(std::move(file));
+  }
+  return source.Open();
+}
+
 Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
     const FileSource& source, std::shared_ptr<io::RandomAccessFile> input = nullptr) {
   if (input == nullptr) {
@@ -49,12 +66,42 @@ Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
   return reader;
 }
 
+/// \brief Options for reading the fields of a file with the given schema which
+/// are materialized by the scan, so that the buffers of the other fields are
+/// neither read nor mapped.
+static ipc::IpcOptions MaterializedReadOptions(const Schema& schema,
+                                               const ScanOptions& scan_options) {
+  std::vector<bool> materialized(schema.num_fields(), false);
+  for (const auto& name : scan_options.MaterializedFields()) {
+    auto i = schema.GetFieldIndex(name);
+    if (i != -1) {
+      materialized[i] = true;
+    }
+  }
+
+  auto options = ipc::IpcOptions::Defaults();
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    if (materialized[i]) {
+      options.included_fields.push_back(i);
+    }
+  }
+
+  // Read whole record batches when every field is included (an empty selection
+  // also includes every field)
+  if (static_cast<int>(options.included_fields.size()) == schema.num_fields()) {
+    options.included_fields.clear();
+  }
+  return options;
+}
+
 /// \brief A ScanTask backed by an Ipc file.
 class IpcScanTask : public ScanTask {
  public:
-  IpcScanTask(FileSource source, std::shared_ptr<ScanOptions> options,
+  IpcScanTask(FileSource source, bool use_mmap, std::shared_ptr<ScanOptions> options,
               std::shared_ptr<ScanContext> context)
-      : ScanTask(std::move(options), std::move(context)), source_(std::move(source)) {}
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        use_mmap_(use_mmap) {}
 
   Result<RecordBatchIterator> Execute() override {
     struct {
@@ -64,30 +111,36 @@ class IpcScanTask : public ScanTask {
         }
 
         std::shared_ptr<RecordBatch> batch;
-        RETURN_NOT_OK(reader_->ReadRecordBatch(i_++, &batch));
+        RETURN_NOT_OK(reader_->ReadRecordBatch(i_++, options_, &batch));
         return batch;
       }
 
       std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+      ipc::IpcOptions options_;
       int i_ = 0;
     } batch_it;
 
-    ARROW_ASSIGN_OR_RAISE(batch_it.reader_, OpenReader(source_));
+    // The fields to read are only known from the schema in the file footer, so
+    // they are selected per record batch rather than when opening the file
+    ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source_, use_mmap_));
+    ARROW_ASSIGN_OR_RAISE(batch_it.reader_, OpenReader(source_, std::move(input)));
+    batch_it.options_ = MaterializedReadOptions(*batch_it.reader_->schema(), *options_);
 
     return RecordBatchIterator(std::move(batch_it));
   }
 
  private:
   FileSource source_;
+  bool use_mmap_;
 };
 
 class IpcScanTaskIterator {
  public:
   static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
                                        std::shared_ptr<ScanContext> context,
-                                       FileSource source) {
-    return ScanTaskIterator(
-        IpcScanTaskIterator(std::move(options), std::move(context), std::move(source)));
+                                       FileSource source, bool use_mmap) {
+    return ScanTaskIterator(IpcScanTaskIterator(std::move(options), std::move(context),
+                                                std::move(source), use_mmap));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -97,20 +150,24 @@ class IpcScanTaskIterator {
     }
 
     once_ = true;
-    return std::shared_ptr<ScanTask>(new IpcScanTask(source_, options_, context_));
+    return std::shared_ptr<ScanTask>(
+        new IpcScanTask(source_, use_mmap_, options_, context_));
   }
 
  private:
   IpcScanTaskIterator(std::shared_ptr<ScanOptions> options,
-                      std::shared_ptr<ScanContext> context, FileSource source)
+                      std::shared_ptr<ScanContext> context, FileSource source,
+                      bool use_mmap)
       : options_(std::move(options)),
         context_(std::move(context)),
-        source_(std::move(source)) {}
+        source_(std::move(source)),
+        use_mmap_(use_mmap) {}
 
   bool once_ = false;
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   FileSource source_;
+  bool use_mmap_;
 };
 
 Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
@@ -126,12 +183,41 @@ Result<std::shared_ptr<Schema>> IpcFileFormat::Inspect(const FileSource& source)
 Result<ScanTaskIterator> IpcFileFormat::ScanFile(
     const FileSource& source, std::shared_ptr<ScanOptions> options,
     std::shared_ptr<ScanContext> context) const {
-  return IpcScanTaskIterator::Make(options, context, source);
+  return IpcScanTaskIterator::Make(options, context, source, use_mmap);
 }
 
 Result<std::shared_ptr<Fragment>> IpcFileFormat::MakeFragment(
     const FileSource& source, std::shared_ptr<ScanOptions> options) {
-  return std::make_shared<IpcFragment>(source, options);
+  return std::make_shared<IpcFragment>(source, std::make_shared<IpcFileFormat>(*this),
+                                       options);
+}
+
+class IpcFileWriter : public FileWriter {
+ public:
+  IpcFileWriter(std::shared_ptr<io::OutputStream> destination,
+                std::shared_ptr<ipc::RecordBatchWriter> writer)
+      : destination_(std::move(destination)), writer_(std::move(writer)) {}
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    return writer_->WriteRecordBatch(*batch);
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+};
+
+Result<std::shared_ptr<FileWriter>> IpcFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination,
+    std::shared_ptr<Schema> schema) const {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::RecordBatchFileWriter::Open(destination.get(), schema));
+  return std::make_shared<IpcFileWriter>(std::move(destination), std::move(writer));
 }
 
 }  // namespace dataset
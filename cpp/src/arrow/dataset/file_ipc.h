@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
@@ -44,6 +45,16 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
 
   Result<std::shared_ptr<Fragment>> MakeFragment(
       const FileSource& source, std::shared_ptr<ScanOptions> options) override;
+
+  /// \brief Open a writer of an Ipc file
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const override;
+
+  /// \brief Memory-map the files of a LocalFileSystem instead of reading them,
+  /// so that scanned record batches are zero-copy slices of the mapping and only
+  /// the pages of the materialized columns are faulted in. False by default.
+  bool use_mmap = false;
 };
 
 class ARROW_DS_EXPORT IpcFragment : public FileFragment {
@@ -51,6 +62,10 @@ class ARROW_DS_EXPORT IpcFragment : public FileFragment {
   IpcFragment(const FileSource& source, std::shared_ptr<ScanOptions> options)
       : FileFragment(source, std::make_shared<IpcFileFormat>(), options) {}
 
+  IpcFragment(const FileSource& source, std::shared_ptr<IpcFileFormat> format,
+              std::shared_ptr<ScanOptions> options)
+      : FileFragment(source, std::move(format), options) {}
+
   bool splittable() const override { return true; }
 };
 
@@ -18,18 +18,25 @@
 #include "arrow/dataset/file_ipc.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
+#include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/mockfs.h"
 #include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
 
 namespace arrow {
 namespace dataset {
@@ -135,6 +142,67 @@ TEST_F(TestIpcFileFormat, ScanRecordBatchReader) {
   ASSERT_EQ(row_count, kNumRows);
 }
 
+TEST_F(TestIpcFileFormat, ScanMetrics) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  auto fragment = std::make_shared<IpcFragment>(*source, opts_);
+  Scanner scanner({std::make_shared<InMemorySource>(opts_->schema(),
+                                                    FragmentVector{fragment})},
+                  opts_, ctx_);
+
+  ctx_->metrics = std::make_shared<ScanMetrics>();
+  ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+  ASSERT_EQ(table->num_rows(), kNumRows);
+
+  auto fragments = ctx_->metrics->fragments();
+  ASSERT_EQ(fragments.size(), 1);
+  ASSERT_EQ(fragments[0].fragment_path, "<Buffer>");
+  ASSERT_EQ(fragments[0].rows_in, kNumRows);
+  ASSERT_EQ(fragments[0].rows_out, kNumRows);
+  ASSERT_GT(fragments[0].read_calls, 0);
+  ASSERT_GT(fragments[0].bytes_read, 0);
+  ASSERT_EQ(fragments[0].sequential_reads + fragments[0].random_reads,
+            fragments[0].read_calls);
+}
+
+TEST_F(TestIpcFileFormat, ScanMemoryMapped) {
+  auto batch =
+      RecordBatchFromJSON(schema({field("i32", int32()), field("f64", float64())}),
+                          R"([{"i32": 1, "f64": 1.5}, {"i32": 2, "f64": 2.5}])");
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &table));
+  auto buffer = Write(*table);
+
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, internal::TemporaryDir::Make("test-dataset-ipc-"));
+  auto path = temp_dir->path().ToString() + "data.arrow";
+  fs::LocalFileSystem localfs;
+  ASSERT_OK_AND_ASSIGN(auto out, localfs.OpenOutputStream(path));
+  ASSERT_OK(out->Write(buffer));
+  ASSERT_OK(out->Close());
+
+  // Only f64 is materialized
+  opts_ = ScanOptions::Make(schema({field("f64", float64())}));
+  auto expected = RecordBatchFromJSON(opts_->schema(), R"([{"f64": 1.5}, {"f64": 2.5}])");
+
+  for (bool use_mmap : {false, true}) {
+    auto format = std::make_shared<IpcFileFormat>();
+    format->use_mmap = use_mmap;
+    ASSERT_OK_AND_ASSIGN(auto fragment,
+                         format->MakeFragment(FileSource(path, &localfs), opts_));
+
+    ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+    ASSERT_OK_AND_ASSIGN(auto task, scan_task_it.Next());
+    ASSERT_OK_AND_ASSIGN(auto batch_it, task->Execute());
+    ASSERT_OK_AND_ASSIGN(auto actual, batch_it.Next());
+    // The unmaterialized i32 column isn't read
+    AssertBatchesEqual(*expected, *actual);
+    ASSERT_OK_AND_ASSIGN(actual, batch_it.Next());
+    ASSERT_EQ(actual, nullptr);
+  }
+}
+
 TEST_F(TestIpcFileFormat, OpenFailureWithRelevantError) {
   auto format = IpcFileFormat();
 
@@ -183,5 +251,173 @@ TEST_F(TestIpcFileFormat, IsSupported) {
   EXPECT_EQ(supported, true);
 }
 
+TEST_F(TestIpcFileFormat, WriteRoundTrip) {
+  auto reader = GetRecordBatchReader();
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+
+  IpcFileFormat format;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, format.MakeWriter(sink, schema_));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->Write(batch));
+  }
+  ASSERT_OK(writer->Finish());
+  ASSERT_TRUE(sink->closed());
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  std::shared_ptr<ipc::RecordBatchFileReader> file_reader;
+  ASSERT_OK(ipc::RecordBatchFileReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                             &file_reader));
+  AssertSchemaEqual(file_reader->schema(), schema_);
+  ASSERT_EQ(file_reader->num_record_batches(), kBatchRepetitions);
+}
+
+class TestWriteDataset : public ::testing::Test {
+ public:
+  void SetUp() override {
+    filesystem_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+    options_.format = std::make_shared<IpcFileFormat>();
+    options_.filesystem = filesystem_;
+    options_.base_dir = "out";
+  }
+
+  Result<std::vector<std::string>> Write(
+      const std::vector<std::shared_ptr<RecordBatch>>& batches) {
+    return WriteDataset(MakeVectorIterator(batches), options_);
+  }
+
+  std::shared_ptr<Table> ReadFile(const std::string& path) {
+    EXPECT_OK_AND_ASSIGN(auto input, filesystem_->OpenInputFile(path));
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    ARROW_EXPECT_OK(ipc::RecordBatchFileReader::Open(input, &reader));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      ARROW_EXPECT_OK(reader->ReadRecordBatch(i, &batch));
+      batches.push_back(batch);
+    }
+    std::shared_ptr<Table> table;
+    ARROW_EXPECT_OK(Table::FromRecordBatches(reader->schema(), batches, &table));
+    return table;
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ =
+      schema({field("part", utf8()), field("value", int32())});
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  WriteOptions options_;
+};
+
+TEST_F(TestWriteDataset, Unpartitioned) {
+  auto batch = RecordBatchFromJSON(schema_, R"([["a", 1], ["b", 2], ["a", 3]])");
+  ASSERT_OK_AND_ASSIGN(auto paths, Write({batch, batch}));
+  ASSERT_EQ(paths, std::vector<std::string>{"out/part-0.ipc"});
+  AssertTablesEqual(*ReadFile(paths[0]),
+                    *TableFromJSON(schema_, {R"([["a", 1], ["b", 2], ["a", 3]])",
+                                             R"([["a", 1], ["b", 2], ["a", 3]])"}));
+}
+
+TEST_F(TestWriteDataset, HivePartitioned) {
+  options_.partitioning =
+      std::make_shared<HivePartitioning>(schema({field("part", utf8())}));
+
+  auto value_schema = schema({field("value", int32())});
+  ASSERT_OK_AND_ASSIGN(
+      auto paths,
+      Write({RecordBatchFromJSON(schema_, R"([["a", 1], ["b", 2], ["a", 3]])"),
+             RecordBatchFromJSON(schema_, R"([["c", 4], ["a", 5]])")}));
+  ASSERT_EQ(paths, (std::vector<std::string>{"out/part=a/part-0.ipc",
+                                             "out/part=b/part-1.ipc",
+                                             "out/part=c/part-2.ipc"}));
+
+  // partition fields are not written to the files
+  AssertTablesEqual(*ReadFile(paths[0]),
+                    *TableFromJSON(value_schema, {"[[1], [3]]", "[[5]]"}));
+  AssertTablesEqual(*ReadFile(paths[1]), *TableFromJSON(value_schema, {"[[2]]"}));
+  AssertTablesEqual(*ReadFile(paths[2]), *TableFromJSON(value_schema, {"[[4]]"}));
+
+  ASSERT_OK_AND_ASSIGN(auto partition, options_.partitioning->Parse("part=a"));
+  ASSERT_TRUE(partition->Equals("part"_ == "a"));
+}
+
+TEST_F(TestWriteDataset, DirectoryPartitionedByIntegers) {
+  auto schema = ::arrow::schema(
+      {field("year", int16()), field("month", int8()), field("value", int32())});
+  options_.partitioning = std::make_shared<DirectoryPartitioning>(
+      ::arrow::schema({field("year", int16()), field("month", int8())}));
+  options_.basename_template = "data{i}.arrow";
+
+  ASSERT_OK_AND_ASSIGN(auto paths, Write({RecordBatchFromJSON(schema, R"([
+    [2019, 12, 1], [2020, 1, 2], [2019, 12, 3], [2020, 2, 4]
+  ])")}));
+  ASSERT_EQ(paths, (std::vector<std::string>{"out/2019/12/data0.arrow",
+                                             "out/2020/1/data1.arrow",
+                                             "out/2020/2/data2.arrow"}));
+}
+
+TEST_F(TestWriteDataset, MaxRowsPerFile) {
+  options_.partitioning =
+      std::make_shared<HivePartitioning>(schema({field("part", utf8())}));
+  options_.max_rows_per_file = 2;
+
+  auto value_schema = schema({field("value", int32())});
+  ASSERT_OK_AND_ASSIGN(
+      auto paths,
+      Write({RecordBatchFromJSON(schema_, R"([["a", 1], ["a", 2], ["a", 3], ["b", 4]])"),
+             RecordBatchFromJSON(schema_, R"([["b", 5], ["b", 6], ["a", 7]])")}));
+  ASSERT_EQ(paths, (std::vector<std::string>{
+                       "out/part=a/part-0.ipc", "out/part=a/part-1.ipc",
+                       "out/part=b/part-2.ipc", "out/part=b/part-3.ipc"}));
+  AssertTablesEqual(*ReadFile(paths[0]), *TableFromJSON(value_schema, {"[[1], [2]]"}));
+  AssertTablesEqual(*ReadFile(paths[1]),
+                    *TableFromJSON(value_schema, {"[[3]]", "[[7]]"}));
+  AssertTablesEqual(*ReadFile(paths[2]),
+                    *TableFromJSON(value_schema, {"[[4]]", "[[5]]"}));
+  AssertTablesEqual(*ReadFile(paths[3]), *TableFromJSON(value_schema, {"[[6]]"}));
+}
+
+TEST_F(TestWriteDataset, MaxOpenFiles) {
+  options_.partitioning =
+      std::make_shared<HivePartitioning>(schema({field("part", utf8())}));
+  options_.max_open_files = 1;
+
+  auto value_schema = schema({field("value", int32())});
+  ASSERT_OK_AND_ASSIGN(
+      auto paths,
+      Write({RecordBatchFromJSON(schema_, R"([["a", 1], ["b", 2], ["a", 3]])"),
+             RecordBatchFromJSON(schema_, R"([["b", 4], ["a", 5]])")}));
+  // the file of a partition is finished when another one must be opened
+  ASSERT_EQ(paths, (std::vector<std::string>{"out/part=a/part-0.ipc",
+                                             "out/part=b/part-1.ipc",
+                                             "out/part=a/part-2.ipc"}));
+  AssertTablesEqual(*ReadFile(paths[0]), *TableFromJSON(value_schema, {"[[1], [3]]"}));
+  AssertTablesEqual(*ReadFile(paths[1]),
+                    *TableFromJSON(value_schema, {"[[2]]", "[[4]]"}));
+  AssertTablesEqual(*ReadFile(paths[2]), *TableFromJSON(value_schema, {"[[5]]"}));
+}
+
+TEST_F(TestWriteDataset, Errors) {
+  options_.partitioning =
+      std::make_shared<HivePartitioning>(schema({field("missing", utf8())}));
+  auto batch = RecordBatchFromJSON(schema_, R"([["a", 1]])");
+  ASSERT_RAISES(Invalid, Write({batch}));
+
+  options_.partitioning =
+      std::make_shared<HivePartitioning>(schema({field("part", utf8())}));
+  ASSERT_RAISES(Invalid, Write({RecordBatchFromJSON(schema_, R"([[null, 1]])")}));
+
+  options_.partitioning = std::make_shared<FunctionPartitioning>(
+      schema({field("part", utf8())}),
+      [](const std::string&, int) -> Result<std::shared_ptr<Expression>> {
+        return scalar(true);
+      });
+  ASSERT_RAISES(NotImplemented, Write({batch}));
+
+  options_.partitioning = Partitioning::Default();
+  options_.format = std::make_shared<DummyFileFormat>();
+  ASSERT_RAISES(NotImplemented, Write({batch}));
+}
+
 }  // namespace dataset
 }  // namespace arrow
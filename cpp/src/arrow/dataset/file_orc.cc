@@ -0,0 +1,267 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+using adapters::orc::ORCColumnStatistics;
+using adapters::orc::ORCFileReader;
+
+static Result<std::unique_ptr<ORCFileReader>> OpenReader(const FileSource& source,
+                                                         MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  std::unique_ptr<ORCFileReader> reader;
+  auto status = ORCFileReader::Open(input, pool, &reader);
+  if (!status.ok()) {
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
+  }
+  return std::move(reader);
+}
+
+/// \brief The ORC type ids of the fields of schema which are materialized by
+/// the scan, or an empty vector to read all the fields.
+static std::vector<int> InferIncludeIndices(const Schema& schema,
+                                            const ScanOptions& scan_options) {
+  auto fields_name = scan_options.MaterializedFields();
+  std::unordered_set<std::string> materialized_fields{fields_name.cbegin(),
+                                                      fields_name.cend()};
+
+  // The type ids number the type tree in pre-order, the file schema being the
+  // root. A nested field spans several ids, which can't be derived from its
+  // Arrow type for maps, so all the fields are read past a nested field.
+  std::vector<int> include_indices;
+  int type_id = 1;
+  bool after_nested = false;
+  for (const auto& field : schema.fields()) {
+    if (materialized_fields.find(field->name()) != materialized_fields.end()) {
+      if (after_nested) {
+        return {};
+      }
+      include_indices.push_back(type_id);
+    }
+    after_nested = after_nested || field->type()->num_children() > 0;
+    ++type_id;
+  }
+
+  if (static_cast<int>(include_indices.size()) == schema.num_fields()) {
+    return {};
+  }
+  return include_indices;
+}
+
+static std::shared_ptr<Expression> ColumnStatisticsAsExpression(
+    const Field& field, const ORCColumnStatistics& statistics) {
+  auto field_expr = field_ref(field.name());
+
+  // Optimize for corner case where all values are nulls
+  if (statistics.num_values == 0 && statistics.has_null) {
+    return equal(field_expr, scalar(MakeNullScalar(field.type())));
+  }
+
+  // In case of missing statistics, or of statistics of another type than the
+  // field, return nothing
+  if (statistics.min == nullptr || statistics.max == nullptr ||
+      !statistics.min->type->Equals(*field.type())) {
+    return scalar(true);
+  }
+
+  return and_(greater_equal(field_expr, scalar(statistics.min)),
+              less_equal(field_expr, scalar(statistics.max)));
+}
+
+static std::shared_ptr<Expression> StatisticsAsExpression(
+    const Schema& schema, const std::vector<ORCColumnStatistics>& statistics) {
+  ExpressionVector expressions;
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    if (i < static_cast<int>(statistics.size())) {
+      expressions.emplace_back(
+          ColumnStatisticsAsExpression(*schema.field(i), statistics[i]));
+    }
+  }
+
+  return expressions.empty() ? scalar(true) : and_(expressions);
+}
+
+/// \brief A ScanTask backed by a stripe of an ORC file, or by some of its row
+/// groups.
+class OrcScanTask : public ScanTask {
+ public:
+  OrcScanTask(FileSource source, int64_t stripe, std::vector<int> row_groups,
+              std::vector<int> include_indices, std::shared_ptr<ScanOptions> options,
+              std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        stripe_(stripe),
+        row_groups_(std::move(row_groups)),
+        include_indices_(std::move(include_indices)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // ORCFileReader isn't thread-safe, so each task reads with its own reader
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source_, context_->pool));
+
+    std::shared_ptr<RecordBatch> batch;
+    if (!row_groups_.empty()) {
+      RETURN_NOT_OK(
+          reader->ReadStripeRowGroups(stripe_, row_groups_, include_indices_, &batch));
+    } else if (!include_indices_.empty()) {
+      RETURN_NOT_OK(reader->ReadStripe(stripe_, include_indices_, &batch));
+    } else {
+      RETURN_NOT_OK(reader->ReadStripe(stripe_, &batch));
+    }
+    return MakeVectorIterator<std::shared_ptr<RecordBatch>>({std::move(batch)});
+  }
+
+ private:
+  FileSource source_;
+  int64_t stripe_;
+  // The selected row groups, all if empty
+  std::vector<int> row_groups_;
+  std::vector<int> include_indices_;
+};
+
+class OrcScanTaskIterator {
+ public:
+  static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
+                                       std::shared_ptr<ScanContext> context,
+                                       FileSource source) {
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(reader->ReadSchema(&schema));
+    auto include_indices = InferIncludeIndices(*schema, *options);
+
+    return ScanTaskIterator(OrcScanTaskIterator(
+        std::move(options), std::move(context), std::move(source), std::move(reader),
+        std::move(schema), std::move(include_indices)));
+  }
+
+  Result<std::shared_ptr<ScanTask>> Next() {
+    while (stripe_ < reader_->NumberOfStripes()) {
+      const int64_t stripe = stripe_++;
+      std::vector<int> row_groups;
+      ARROW_ASSIGN_OR_RAISE(bool skip, SkipRowGroups(stripe, &row_groups));
+      if (!skip) {
+        return std::shared_ptr<ScanTask>(new OrcScanTask(source_, stripe,
+                                                         std::move(row_groups),
+                                                         include_indices_, options_,
+                                                         context_));
+      }
+    }
+
+    // Iteration is done.
+    return nullptr;
+  }
+
+ private:
+  OrcScanTaskIterator(std::shared_ptr<ScanOptions> options,
+                      std::shared_ptr<ScanContext> context, FileSource source,
+                      std::unique_ptr<ORCFileReader> reader,
+                      std::shared_ptr<Schema> schema, std::vector<int> include_indices)
+      : options_(std::move(options)),
+        context_(std::move(context)),
+        source_(std::move(source)),
+        reader_(std::move(reader)),
+        schema_(std::move(schema)),
+        include_indices_(std::move(include_indices)) {}
+
+  bool CanSkip(const std::vector<ORCColumnStatistics>& statistics) const {
+    auto expr = options_->filter->Assume(StatisticsAsExpression(*schema_, statistics));
+    return expr->IsNull() || expr->Equals(false);
+  }
+
+  // Return whether the whole stripe can be skipped, otherwise set row_groups
+  // to the row groups which can't be skipped, or leave it empty if none can.
+  // Errors with statistics are ignored and post-filtering will apply.
+  Result<bool> SkipRowGroups(int64_t stripe, std::vector<int>* row_groups) {
+    if (options_->filter->Equals(true)) {
+      return false;
+    }
+
+    std::vector<ORCColumnStatistics> stripe_statistics;
+    if (reader_->ReadStripeStatistics(stripe, &stripe_statistics).ok() &&
+        CanSkip(stripe_statistics)) {
+      return true;
+    }
+
+    std::vector<std::vector<ORCColumnStatistics>> row_group_statistics;
+    if (!reader_->ReadRowGroupStatistics(stripe, &row_group_statistics).ok()) {
+      return false;
+    }
+    for (size_t i = 0; i < row_group_statistics.size(); ++i) {
+      if (!CanSkip(row_group_statistics[i])) {
+        row_groups->push_back(static_cast<int>(i));
+      }
+    }
+
+    if (row_groups->empty() && !row_group_statistics.empty()) {
+      return true;
+    }
+    if (row_groups->size() == row_group_statistics.size()) {
+      row_groups->clear();
+    }
+    return false;
+  }
+
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+  FileSource source_;
+  std::unique_ptr<ORCFileReader> reader_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> include_indices_;
+  int64_t stripe_ = 0;
+};
+
+Result<bool> OrcFileFormat::IsSupported(const FileSource& source) const {
+  return OpenReader(source, default_memory_pool()).ok();
+}
+
+Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, default_memory_pool()));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+  return schema;
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  return OrcScanTaskIterator::Make(std::move(options), std::move(context), source);
+}
+
+Result<std::shared_ptr<Fragment>> OrcFileFormat::MakeFragment(
+    const FileSource& source, std::shared_ptr<ScanOptions> options) {
+  return std::make_shared<OrcFragment>(source, std::make_shared<OrcFileFormat>(*this),
+                                       options);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,189 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <orc/OrcFile.hh>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace liborc = orc;
+
+namespace arrow {
+namespace dataset {
+
+// Stripe s holds the ids [s * kRowsPerStripe, (s + 1) * kRowsPerStripe)
+constexpr int64_t kNumStripes = 4;
+constexpr int64_t kRowsPerStripe = 4000;
+constexpr int64_t kRowIndexStride = 1000;
+constexpr int64_t kNumRows = kNumStripes * kRowsPerStripe;
+
+class StringOutputStream : public liborc::OutputStream {
+ public:
+  uint64_t getLength() const override { return data_.size(); }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t size) override {
+    data_.append(reinterpret_cast<const char*>(buf), size);
+  }
+
+  const std::string& getName() const override { return name_; }
+
+  void close() override {}
+
+  const std::string& data() const { return data_; }
+
+ private:
+  std::string data_;
+  std::string name_ = "StringOutputStream";
+};
+
+class TestOrcFileFormat : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ORC_UNIQUE_PTR<liborc::Type> type(
+        liborc::Type::buildTypeFromString("struct<i64:bigint,i32:int>"));
+    StringOutputStream stream;
+    liborc::WriterOptions options;
+    // A stripe is flushed after each added batch
+    options.setStripeSize(1024);
+    options.setRowIndexStride(kRowIndexStride);
+    auto writer = liborc::createWriter(*type, &stream, options);
+
+    auto batch = writer->createRowBatch(kRowsPerStripe);
+    auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+    auto i64_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+    auto i32_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[1]);
+    for (int64_t stripe = 0; stripe < kNumStripes; ++stripe) {
+      for (int64_t i = 0; i < kRowsPerStripe; ++i) {
+        i64_batch->data[i] = stripe * kRowsPerStripe + i;
+        i32_batch->data[i] = i % 7;
+      }
+      struct_batch->numElements = kRowsPerStripe;
+      i64_batch->numElements = kRowsPerStripe;
+      i32_batch->numElements = kRowsPerStripe;
+      writer->add(*batch);
+    }
+    writer->close();
+
+    std::string data = stream.data();
+    source_ = std::make_shared<FileSource>(Buffer::FromString(std::move(data)));
+    opts_ = ScanOptions::Make(schema({field("i64", int64()), field("i32", int32())}));
+  }
+
+ protected:
+  void CountRowsAndBatchesInScan(Fragment& fragment, int64_t expected_rows,
+                                 int64_t expected_batches) {
+    int64_t actual_rows = 0;
+    int64_t actual_batches = 0;
+
+    ASSERT_OK_AND_ASSIGN(auto it, fragment.Scan(ctx_));
+    for (auto maybe_scan_task : it) {
+      ASSERT_OK_AND_ASSIGN(auto scan_task, std::move(maybe_scan_task));
+      ASSERT_OK_AND_ASSIGN(auto rb_it, scan_task->Execute());
+      for (auto maybe_record_batch : rb_it) {
+        ASSERT_OK_AND_ASSIGN(auto record_batch, std::move(maybe_record_batch));
+        actual_rows += record_batch->num_rows();
+        actual_batches++;
+      }
+    }
+
+    EXPECT_EQ(actual_rows, expected_rows);
+    EXPECT_EQ(actual_batches, expected_batches);
+  }
+
+  std::shared_ptr<FileSource> source_;
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestOrcFileFormat, Inspect) {
+  OrcFileFormat format;
+
+  ASSERT_OK_AND_ASSIGN(bool supported, format.IsSupported(*source_));
+  ASSERT_TRUE(supported);
+  ASSERT_OK_AND_ASSIGN(auto actual, format.Inspect(*source_));
+  AssertSchemaEqual(*opts_->schema(), *actual);
+
+  FileSource not_orc(Buffer::FromString("not an ORC file"));
+  ASSERT_OK_AND_ASSIGN(supported, format.IsSupported(not_orc));
+  ASSERT_FALSE(supported);
+}
+
+TEST_F(TestOrcFileFormat, PushDown) {
+  auto fragment = std::make_shared<OrcFragment>(*source_, opts_);
+
+  CountRowsAndBatchesInScan(*fragment, kNumRows, kNumStripes);
+
+  // Only the row group holding the id is read
+  opts_->filter = ("i64"_ == int64_t(5)).Copy();
+  CountRowsAndBatchesInScan(*fragment, kRowIndexStride, 1);
+  opts_->filter = ("i64"_ >= int64_t(kNumRows - kRowIndexStride - 1)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 2 * kRowIndexStride, 1);
+
+  // Row groups of consecutive stripes
+  opts_->filter = ("i64"_ >= int64_t(kRowsPerStripe - 1) and
+                   "i64"_ < int64_t(kRowsPerStripe + 1))
+                      .Copy();
+  CountRowsAndBatchesInScan(*fragment, 2 * kRowIndexStride, 2);
+
+  // Whole stripes
+  opts_->filter = ("i64"_ < int64_t(2 * kRowsPerStripe)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 2 * kRowsPerStripe, 2);
+
+  // Out of bound filters should skip all stripes
+  opts_->filter = scalar(false);
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+  opts_->filter = ("i64"_ == int64_t(-1)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+  opts_->filter = ("i32"_ > int32_t(6)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+}
+
+TEST_F(TestOrcFileFormat, ScanProjected) {
+  opts_->projector = RecordBatchProjector(schema({field("i32", int32())}));
+  auto fragment = std::make_shared<OrcFragment>(*source_, opts_);
+
+  ASSERT_OK_AND_ASSIGN(auto it, fragment->Scan(ctx_));
+  int64_t row_count = 0;
+  for (auto maybe_scan_task : it) {
+    ASSERT_OK_AND_ASSIGN(auto scan_task, std::move(maybe_scan_task));
+    ASSERT_OK_AND_ASSIGN(auto rb_it, scan_task->Execute());
+    for (auto maybe_batch : rb_it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      // Only the materialized field is read from the file
+      ASSERT_EQ(batch->num_columns(), 1);
+      ASSERT_EQ(batch->schema()->field(0)->name(), "i32");
+      row_count += batch->num_rows();
+    }
+  }
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,7 +17,11 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -25,12 +29,21 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/array.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
 #include "parquet/file_reader.h"
+#include "parquet/metadata_cache.h"
+#include "parquet/properties.h"
 #include "parquet/statistics.h"
 
 namespace arrow {
@@ -40,19 +53,27 @@ using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
+using internal::checked_cast;
+
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(int row_group, std::vector<int> column_projection,
+                  std::vector<int> filter_columns,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
                   std::shared_ptr<ScanOptions> options,
                   std::shared_ptr<ScanContext> context)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(row_group),
         column_projection_(std::move(column_projection)),
+        filter_columns_(std::move(filter_columns)),
         reader_(std::move(reader)) {}
 
   Result<RecordBatchIterator> Execute() override {
+    if (!filter_columns_.empty()) {
+      return ExecuteFilterFirst();
+    }
+
     // The construction of parquet's RecordBatchReader is deferred here to
     // control the memory usage of consumers who materialize all ScanTasks
     // before dispatching them, e.g. for scheduling purposes.
@@ -68,36 +89,359 @@ class ParquetScanTask : public ScanTask {
   }
 
  private:
+  // Decode the filter columns first, then only decode the rows of the other
+  // projected columns which satisfy the filter, skipping the others.
+  Result<RecordBatchIterator> ExecuteFilterFirst() {
+    std::shared_ptr<Table> filter_table;
+    RETURN_NOT_OK(reader_->ReadRowGroup(row_group_, filter_columns_, &filter_table));
+    if (filter_table->num_rows() == 0) {
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto filter_batch, CombineToRecordBatch(*filter_table));
+
+    std::vector<bool> is_filter_column;
+    std::vector<int> other_columns;
+    for (int column : column_projection_) {
+      is_filter_column.push_back(std::find(filter_columns_.begin(), filter_columns_.end(),
+                                           column) != filter_columns_.end());
+      if (!is_filter_column.back()) {
+        other_columns.push_back(column);
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto selection,
+                          options_->evaluator->Evaluate(*options_->filter, *filter_batch,
+                                                        context_->pool));
+    std::shared_ptr<Table> other_table;
+    if (selection.is_array()) {
+      const auto& mask = checked_cast<const BooleanArray&>(*selection.make_array());
+      std::vector<parquet::arrow::RowRange> ranges;
+      for (int64_t i = 0; i < mask.length();) {
+        if (!mask.IsValid(i) || !mask.Value(i)) {
+          ++i;
+          continue;
+        }
+        const int64_t offset = i;
+        while (i < mask.length() && mask.IsValid(i) && mask.Value(i)) {
+          ++i;
+        }
+        ranges.push_back({offset, i - offset});
+      }
+      if (ranges.empty()) {
+        return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+      }
+      RETURN_NOT_OK(
+          reader_->ReadRowGroupRanges(row_group_, other_columns, ranges, &other_table));
+      ARROW_ASSIGN_OR_RAISE(filter_batch, options_->evaluator->Filter(
+                                              selection, filter_batch, context_->pool));
+    } else {
+      // The whole row group is selected or rejected; the scanner's filter
+      // takes care of it
+      RETURN_NOT_OK(reader_->ReadRowGroup(row_group_, other_columns, &other_table));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto other_batch, CombineToRecordBatch(*other_table));
+
+    // Interleave the columns of both phases back in projection order
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> columns;
+    int filter_index = 0, other_index = 0;
+    for (bool in_filter : is_filter_column) {
+      const auto& batch = in_filter ? filter_batch : other_batch;
+      const int i = in_filter ? filter_index++ : other_index++;
+      fields.push_back(batch->schema()->field(i));
+      columns.push_back(batch->column(i));
+    }
+    std::vector<std::shared_ptr<RecordBatch>> batches = {RecordBatch::Make(
+        schema(std::move(fields)), filter_batch->num_rows(), std::move(columns))};
+    return MakeVectorIterator(std::move(batches));
+  }
+
+  Result<std::shared_ptr<RecordBatch>> CombineToRecordBatch(const Table& table) {
+    std::shared_ptr<Table> combined;
+    RETURN_NOT_OK(table.CombineChunks(context_->pool, &combined));
+    std::shared_ptr<RecordBatch> batch;
+    TableBatchReader batch_reader(*combined);
+    batch_reader.set_chunksize(combined->num_rows());
+    RETURN_NOT_OK(batch_reader.ReadNext(&batch));
+    return batch;
+  }
+
   int row_group_;
   std::vector<int> column_projection_;
+  // Leaf columns of the filter when the row group is read in two phases, see
+  // ExecuteFilterFirst; empty otherwise
+  std::vector<int> filter_columns_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
   std::shared_ptr<parquet::arrow::FileReader> reader_;
 };
 
+template <typename M>
+static Result<SchemaManifest> GetSchemaManifest(const M& metadata) {
+  SchemaManifest manifest;
+  RETURN_NOT_OK(SchemaManifest::Make(
+      metadata.schema(), nullptr, parquet::default_arrow_reader_properties(), &manifest));
+  return manifest;
+}
+
+template <typename ArrowType>
+static void AppendIntegers(const Array& values, std::vector<int64_t>* out) {
+  const auto& array = checked_cast<const NumericArray<ArrowType>&>(values);
+  for (int64_t i = 0; i < array.length(); ++i) {
+    // Unsigned values keep their bit pattern, as when they are written
+    out->push_back(static_cast<int64_t>(array.Value(i)));
+  }
+}
+
+template <typename ArrowType, typename CType = typename ArrowType::c_type>
+static bool HashFloatingPoint(const parquet::BloomFilter& bloom_filter,
+                              const Array& values, std::vector<uint64_t>* hashes) {
+  const auto& array = checked_cast<const NumericArray<ArrowType>&>(values);
+  for (int64_t i = 0; i < array.length(); ++i) {
+    const CType value = array.Value(i);
+    // -0.0 equals 0.0 and NaN equals nothing, but neither hash the same way
+    if (value == 0 || std::isnan(value)) {
+      return false;
+    }
+    hashes->push_back(bloom_filter.Hash(value));
+  }
+  return true;
+}
+
+// Hash the (non-null) values the way the Parquet writer hashes a column of
+// the given Arrow type. Returns false if it is not known how values of that
+// type are stored, e.g. because the writer coerces them.
+static bool HashValues(const parquet::BloomFilter& bloom_filter,
+                       const DataType& field_type, parquet::Type::type physical_type,
+                       const Array& values, std::vector<uint64_t>* hashes) {
+  if (field_type.id() == Type::DICTIONARY) {
+    const auto& dict_type = checked_cast<const DictionaryType&>(field_type);
+    return HashValues(bloom_filter, *dict_type.value_type(), physical_type, values,
+                      hashes);
+  }
+
+  const bool integral_field = is_integer(field_type.id());
+  if ((integral_field && !is_integer(values.type_id())) ||
+      (!integral_field && !field_type.Equals(*values.type()) &&
+       !(is_binary_like(field_type.id()) && is_binary_like(values.type_id())))) {
+    return false;
+  }
+
+  std::vector<int64_t> integers;
+  switch (values.type_id()) {
+    case Type::INT8:
+      AppendIntegers<Int8Type>(values, &integers);
+      break;
+    case Type::INT16:
+      AppendIntegers<Int16Type>(values, &integers);
+      break;
+    case Type::INT32:
+      AppendIntegers<Int32Type>(values, &integers);
+      break;
+    case Type::INT64:
+      AppendIntegers<Int64Type>(values, &integers);
+      break;
+    case Type::UINT8:
+      AppendIntegers<UInt8Type>(values, &integers);
+      break;
+    case Type::UINT16:
+      AppendIntegers<UInt16Type>(values, &integers);
+      break;
+    case Type::UINT32:
+      AppendIntegers<UInt32Type>(values, &integers);
+      break;
+    case Type::UINT64:
+      AppendIntegers<UInt64Type>(values, &integers);
+      break;
+    case Type::DATE32:
+      AppendIntegers<Date32Type>(values, &integers);
+      break;
+    case Type::FLOAT:
+      return physical_type == parquet::Type::FLOAT &&
+             HashFloatingPoint<FloatType>(bloom_filter, values, hashes);
+    case Type::DOUBLE:
+      return physical_type == parquet::Type::DOUBLE &&
+             HashFloatingPoint<DoubleType>(bloom_filter, values, hashes);
+    case Type::STRING:
+    case Type::BINARY: {
+      if (physical_type != parquet::Type::BYTE_ARRAY) {
+        return false;
+      }
+      const auto& array = checked_cast<const BinaryArray&>(values);
+      for (int64_t i = 0; i < array.length(); ++i) {
+        const parquet::ByteArray value(array.GetView(i));
+        hashes->push_back(bloom_filter.Hash(&value));
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+
+  for (int64_t value : integers) {
+    if (physical_type == parquet::Type::INT32) {
+      hashes->push_back(bloom_filter.Hash(static_cast<int32_t>(value)));
+    } else if (physical_type == parquet::Type::INT64) {
+      hashes->push_back(bloom_filter.Hash(value));
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Evaluate equality and membership predicates against the Bloom filters of
+// the column chunks of a row group, which are read on first use.
+class RowGroupBloomFilters {
+ public:
+  RowGroupBloomFilters(std::shared_ptr<parquet::RowGroupReader> row_group,
+                       const SchemaManifest* manifest)
+      : row_group_(std::move(row_group)), manifest_(manifest) {}
+
+  // Returns true if no row of the row group can satisfy expr
+  bool Excludes(const Expression& expr) {
+    switch (expr.type()) {
+      case ExpressionType::AND: {
+        const auto& and_expr = checked_cast<const AndExpression&>(expr);
+        return Excludes(*and_expr.left_operand()) || Excludes(*and_expr.right_operand());
+      }
+      case ExpressionType::OR: {
+        const auto& or_expr = checked_cast<const OrExpression&>(expr);
+        return Excludes(*or_expr.left_operand()) && Excludes(*or_expr.right_operand());
+      }
+      case ExpressionType::COMPARISON: {
+        const auto& cmp = checked_cast<const ComparisonExpression&>(expr);
+        if (cmp.op() != compute::CompareOperator::EQUAL) {
+          return false;
+        }
+        const Expression* field = cmp.left_operand().get();
+        const Expression* value = cmp.right_operand().get();
+        if (field->type() == ExpressionType::SCALAR) {
+          std::swap(field, value);
+        }
+        if (field->type() != ExpressionType::FIELD ||
+            value->type() != ExpressionType::SCALAR) {
+          return false;
+        }
+        const auto& scalar = checked_cast<const ScalarExpression&>(*value).value();
+        std::shared_ptr<Array> values;
+        if (!scalar->is_valid || !MakeArrayFromScalar(*scalar, 1, &values).ok()) {
+          return false;
+        }
+        return ExcludesAll(checked_cast<const FieldExpression&>(*field).name(), *values);
+      }
+      case ExpressionType::IN: {
+        const auto& in_expr = checked_cast<const InExpression&>(expr);
+        if (in_expr.operand()->type() != ExpressionType::FIELD) {
+          return false;
+        }
+        // Nulls are not recorded in Bloom filters
+        if (in_expr.set()->null_count() != 0) {
+          return false;
+        }
+        const auto& operand = checked_cast<const FieldExpression&>(*in_expr.operand());
+        return ExcludesAll(operand.name(), *in_expr.set());
+      }
+      default:
+        return false;
+    }
+  }
+
+ private:
+  // Returns true if the column is known not to contain any of the values
+  bool ExcludesAll(const std::string& field_name, const Array& values) {
+    const SchemaField* schema_field = nullptr;
+    for (const auto& candidate : manifest_->schema_fields) {
+      if (candidate.field->name() == field_name) {
+        schema_field = &candidate;
+        break;
+      }
+    }
+    if (schema_field == nullptr || !schema_field->is_leaf()) {
+      return false;
+    }
+
+    const int column_index = schema_field->column_index;
+    const parquet::BloomFilter* bloom_filter = GetBloomFilter(column_index);
+    if (bloom_filter == nullptr) {
+      return false;
+    }
+
+    const auto physical_type =
+        row_group_->metadata()->schema()->Column(column_index)->physical_type();
+    std::vector<uint64_t> hashes;
+    if (!HashValues(*bloom_filter, *schema_field->field->type(), physical_type, values,
+                    &hashes)) {
+      return false;
+    }
+    for (uint64_t hash : hashes) {
+      if (bloom_filter->FindHash(hash)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const parquet::BloomFilter* GetBloomFilter(int column_index) {
+    auto it = bloom_filters_.find(column_index);
+    if (it == bloom_filters_.end()) {
+      std::unique_ptr<parquet::BloomFilter> bloom_filter;
+      try {
+        bloom_filter = row_group_->GetBloomFilter(column_index);
+      } catch (const ::parquet::ParquetException&) {
+        // Unreadable Bloom filters are ignored, like statistics
+      }
+      it = bloom_filters_.emplace(column_index, std::move(bloom_filter)).first;
+    }
+    return it->second.get();
+  }
+
+  std::shared_ptr<parquet::RowGroupReader> row_group_;
+  const SchemaManifest* manifest_;
+  std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters_;
+};
+
 // Skip RowGroups with a filter and metadata
 class RowGroupSkipper {
  public:
   static constexpr int kIterationDone = -1;
 
   RowGroupSkipper(std::shared_ptr<parquet::FileMetaData> metadata,
-                  std::shared_ptr<Expression> filter)
-      : metadata_(std::move(metadata)), filter_(std::move(filter)), row_group_idx_(0) {
+                  std::shared_ptr<Expression> filter,
+                  parquet::ParquetFileReader* reader = nullptr, int64_t limit = -1)
+      : metadata_(std::move(metadata)),
+        filter_(std::move(filter)),
+        reader_(reader),
+        row_group_idx_(0),
+        rows_skipped_(0),
+        rows_selected_(0) {
+    // Without a filter every row of the selected row groups is yielded, so the
+    // row groups past the limit aren't needed
+    limit_ = filter_->Equals(true) ? limit : -1;
     num_row_groups_ = metadata_->num_row_groups();
+    auto maybe_manifest = GetSchemaManifest(*metadata_);
+    if (maybe_manifest.ok()) {
+      manifest_.reset(new SchemaManifest(std::move(maybe_manifest).ValueOrDie()));
+    }
   }
 
   int Next() {
     while (row_group_idx_ < num_row_groups_) {
+      if (limit_ >= 0 && rows_selected_ >= limit_) {
+        break;
+      }
+
       const auto row_group_idx = row_group_idx_++;
       const auto row_group = metadata_->RowGroup(row_group_idx);
 
       const auto num_rows = row_group->num_rows();
-      if (CanSkip(*row_group)) {
+      if (CanSkip(row_group_idx, *row_group)) {
         rows_skipped_ += num_rows;
         continue;
       }
 
+      rows_selected_ += num_rows;
       return row_group_idx;
     }
 
@@ -105,7 +449,7 @@ class RowGroupSkipper {
   }
 
  private:
-  bool CanSkip(const parquet::RowGroupMetaData& metadata) const {
+  bool CanSkip(int row_group_idx, const parquet::RowGroupMetaData& metadata) const {
     auto maybe_stats_expr = RowGroupStatisticsAsExpression(metadata);
     // Errors with statistics are ignored and post-filtering will apply.
     if (!maybe_stats_expr.ok()) {
@@ -114,24 +458,31 @@ class RowGroupSkipper {
 
     auto stats_expr = maybe_stats_expr.ValueOrDie();
     auto expr = filter_->Assume(stats_expr);
-    return (expr->IsNull() || expr->Equals(false));
+    if (expr->IsNull() || expr->Equals(false)) {
+      return true;
+    }
+
+    // Statistics only exclude value ranges; Bloom filters can also rule out
+    // point lookups within the range
+    if (reader_ == nullptr || manifest_ == nullptr) {
+      return false;
+    }
+    RowGroupBloomFilters bloom_filters(reader_->RowGroup(row_group_idx),
+                                       manifest_.get());
+    return bloom_filters.Excludes(*expr);
   }
 
   std::shared_ptr<parquet::FileMetaData> metadata_;
   std::shared_ptr<Expression> filter_;
+  parquet::ParquetFileReader* reader_;
+  std::unique_ptr<SchemaManifest> manifest_;
   int row_group_idx_;
   int num_row_groups_;
   int64_t rows_skipped_;
+  int64_t rows_selected_;
+  int64_t limit_;
 };
 
-template <typename M>
-static Result<SchemaManifest> GetSchemaManifest(const M& metadata) {
-  SchemaManifest manifest;
-  RETURN_NOT_OK(SchemaManifest::Make(
-      metadata.schema(), nullptr, parquet::default_arrow_reader_properties(), &manifest));
-  return manifest;
-}
-
 class ParquetScanTaskIterator {
  public:
   static Result<ScanTaskIterator> Make(
@@ -140,6 +491,7 @@ class ParquetScanTaskIterator {
     auto metadata = reader->metadata();
 
     auto column_projection = InferColumnProjection(*metadata, options);
+    auto filter_columns = InferFilterColumns(*metadata, options);
 
     std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
     RETURN_NOT_OK(parquet::arrow::FileReader::Make(context->pool, std::move(reader),
@@ -147,7 +499,7 @@ class ParquetScanTaskIterator {
 
     return ScanTaskIterator(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(column_projection),
-        std::move(metadata), std::move(arrow_reader)));
+        std::move(filter_columns), std::move(metadata), std::move(arrow_reader)));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -158,8 +510,8 @@ class ParquetScanTaskIterator {
       return nullptr;
     }
 
-    return std::shared_ptr<ScanTask>(
-        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
+    return std::shared_ptr<ScanTask>(new ParquetScanTask(
+        row_group, column_projection_, filter_columns_, reader_, options_, context_));
   }
 
  private:
@@ -196,6 +548,55 @@ class ParquetScanTaskIterator {
     return columns_selection;
   }
 
+  // Return the leaf columns referenced by the filter if the other projected
+  // columns can be read in a second phase, only for the rows which satisfy the
+  // filter. This requires all the involved fields to be flat and the filter
+  // fields to be present in the file.
+  static std::vector<int> InferFilterColumns(
+      const parquet::FileMetaData& metadata,
+      const std::shared_ptr<ScanOptions>& options) {
+    if (options->filter->Equals(true)) {
+      return {};
+    }
+    auto maybe_manifest = GetSchemaManifest(metadata);
+    if (!maybe_manifest.ok()) {
+      return {};
+    }
+    auto manifest = std::move(maybe_manifest).ValueOrDie();
+
+    auto filter_names = FieldsInExpression(options->filter);
+    std::unordered_set<std::string> filter_fields{filter_names.cbegin(),
+                                                  filter_names.cend()};
+    auto fields_name = options->MaterializedFields();
+    std::unordered_set<std::string> materialized_fields{fields_name.cbegin(),
+                                                        fields_name.cend()};
+
+    std::vector<int> filter_columns;
+    bool has_other_columns = false;
+    for (const auto& schema_field : manifest.schema_fields) {
+      const auto& name = schema_field.field->name();
+      const bool in_filter = filter_fields.erase(name) > 0;
+      if (!in_filter && materialized_fields.find(name) == materialized_fields.end()) {
+        continue;
+      }
+      if (!schema_field.is_leaf() ||
+          metadata.schema()->Column(schema_field.column_index)->max_repetition_level() >
+              0) {
+        return {};
+      }
+      if (in_filter) {
+        filter_columns.push_back(schema_field.column_index);
+      } else {
+        has_other_columns = true;
+      }
+    }
+
+    if (!filter_fields.empty() || !has_other_columns) {
+      return {};
+    }
+    return filter_columns;
+  }
+
   static void AddColumnIndices(const SchemaField& schema_field,
                                std::vector<int>* column_projection) {
     if (schema_field.is_leaf()) {
@@ -211,19 +612,23 @@ class ParquetScanTaskIterator {
   ParquetScanTaskIterator(std::shared_ptr<ScanOptions> options,
                           std::shared_ptr<ScanContext> context,
                           std::vector<int> column_projection,
+                          std::vector<int> filter_columns,
                           std::shared_ptr<parquet::FileMetaData> metadata,
                           std::unique_ptr<parquet::arrow::FileReader> reader)
       : options_(std::move(options)),
         context_(std::move(context)),
         column_projection_(std::move(column_projection)),
-        skipper_(std::move(metadata), options_->filter),
-        reader_(std::move(reader)) {}
+        filter_columns_(std::move(filter_columns)),
+        reader_(std::move(reader)),
+        skipper_(std::move(metadata), options_->filter, reader_->parquet_reader(),
+                 options_->limit) {}
 
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   std::vector<int> column_projection_;
-  RowGroupSkipper skipper_;
+  std::vector<int> filter_columns_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  RowGroupSkipper skipper_;
 };
 
 Result<bool> ParquetFileFormat::IsSupported(const FileSource& source) const {
@@ -265,14 +670,69 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
 
 Result<std::shared_ptr<Fragment>> ParquetFileFormat::MakeFragment(
     const FileSource& source, std::shared_ptr<ScanOptions> options) {
-  return std::make_shared<ParquetFragment>(source, options);
+  // The fragment's format shares the metadata cache of this one
+  return std::make_shared<ParquetFragment>(
+      source, std::make_shared<ParquetFileFormat>(*this), options);
+}
+
+class ParquetFileWriter : public FileWriter {
+ public:
+  ParquetFileWriter(std::shared_ptr<io::OutputStream> destination,
+                    std::unique_ptr<parquet::arrow::FileWriter> writer)
+      : destination_(std::move(destination)), writer_(std::move(writer)) {}
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    return writer_->WriteRecordBatch(*batch);
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::unique_ptr<parquet::arrow::FileWriter> writer_;
+};
+
+Result<std::shared_ptr<FileWriter>> ParquetFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination,
+    std::shared_ptr<Schema> schema) const {
+  auto properties = writer_properties;
+  if (properties == nullptr) {
+    properties = parquet::default_writer_properties();
+  }
+
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*schema, default_memory_pool(),
+                                                 destination, properties, &writer));
+  return std::make_shared<ParquetFileWriter>(std::move(destination), std::move(writer));
 }
 
 Result<std::unique_ptr<parquet::ParquetFileReader>> ParquetFileFormat::OpenReader(
     const FileSource& source, MemoryPool* pool) const {
+  parquet::FileMetaDataCache::Key key = {};
+  bool use_cache = false;
+  if (metadata_cache != nullptr && source.type() == FileSource::PATH) {
+    ARROW_ASSIGN_OR_RAISE(auto stats, source.filesystem()->GetTargetStats(source.path()));
+    // Without a modification time, a rewritten file can't be told apart
+    use_cache = stats.mtime() != fs::kNoTime && stats.size() >= 0;
+    key = {source.filesystem()->type_name() + ":" + source.path(), stats.size(),
+           stats.mtime().time_since_epoch().count()};
+  }
+
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   try {
-    return parquet::ParquetFileReader::Open(input);
+    std::shared_ptr<parquet::FileMetaData> metadata;
+    if (use_cache) {
+      metadata = metadata_cache->Get(key);
+    }
+    auto reader = parquet::ParquetFileReader::Open(
+        input, parquet::default_reader_properties(), metadata);
+    if (use_cache && metadata == nullptr) {
+      metadata_cache->Put(key, reader->metadata());
+    }
+    return std::move(reader);
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
@@ -333,5 +793,121 @@ Result<std::shared_ptr<Expression>> RowGroupStatisticsAsExpression(
   return expressions.empty() ? scalar(true) : and_(expressions);
 }
 
+// The expression holding for all the rows of the given row groups of a summary
+static std::shared_ptr<Expression> RowGroupsStatisticsAsExpression(
+    const parquet::FileMetaData& metadata, const std::vector<int>& row_groups) {
+  ExpressionVector expressions;
+  for (int row_group : row_groups) {
+    auto maybe_stats_expr = RowGroupStatisticsAsExpression(*metadata.RowGroup(row_group));
+    // As for RowGroupSkipper, errors with statistics are ignored
+    if (!maybe_stats_expr.ok() || maybe_stats_expr.ValueOrDie()->Equals(true)) {
+      return scalar(true);
+    }
+    expressions.push_back(std::move(maybe_stats_expr).ValueOrDie());
+  }
+
+  return expressions.empty() ? scalar(true) : or_(expressions);
+}
+
+ParquetSourceFactory::ParquetSourceFactory(
+    std::shared_ptr<fs::FileSystem> filesystem, fs::PathForest forest,
+    std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options,
+    std::shared_ptr<Schema> physical_schema, ExpressionVector statistics)
+    : FileSystemSourceFactory(std::move(filesystem), std::move(forest),
+                              std::move(format), std::move(options)),
+      physical_schema_(std::move(physical_schema)),
+      statistics_(std::move(statistics)) {}
+
+Result<std::shared_ptr<SourceFactory>> ParquetSourceFactory::Make(
+    std::shared_ptr<fs::FileSystem> filesystem, const std::string& metadata_path,
+    std::shared_ptr<ParquetFileFormat> format, FileSystemFactoryOptions options) {
+  auto pool = default_memory_pool();
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        format->OpenReader(FileSource(metadata_path, filesystem.get()),
+                                           pool));
+  auto metadata = reader->metadata();
+
+  std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
+  RETURN_NOT_OK(parquet::arrow::FileReader::Make(pool, std::move(reader), &arrow_reader));
+  std::shared_ptr<Schema> physical_schema;
+  RETURN_NOT_OK(arrow_reader->GetSchema(&physical_schema));
+
+  const std::string base_dir = fs::internal::GetAbstractPathParent(metadata_path).first;
+  if (options.partition_base_dir.empty()) {
+    options.partition_base_dir = base_dir;
+  }
+
+  // Group the row groups of the summary by data file
+  std::unordered_map<std::string, std::vector<int>> row_groups;
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    auto row_group = metadata->RowGroup(i);
+    const std::string file_path =
+        row_group->num_columns() > 0 ? row_group->ColumnChunk(0)->file_path() : "";
+    if (file_path.empty()) {
+      return Status::Invalid("Row group ", i, " of Parquet summary file '",
+                             metadata_path, "' doesn't have a file path");
+    }
+    row_groups[fs::internal::ConcatAbstractPath(base_dir, file_path)].push_back(i);
+  }
+
+  // The directories between the partition base directory and the files are
+  // needed for partitioning, but aren't looked up on the filesystem
+  fs::FileStatsVector files;
+  std::unordered_set<std::string> directories;
+  for (const auto& path_row_groups : row_groups) {
+    const auto& path = path_row_groups.first;
+    for (auto&& directory :
+         fs::internal::AncestorsFromBasePath(options.partition_base_dir, path)) {
+      if (directories.insert(directory).second) {
+        files.emplace_back();
+        files.back().set_path(std::move(directory));
+        files.back().set_type(fs::FileType::Directory);
+      }
+    }
+    files.emplace_back();
+    files.back().set_path(path);
+    files.back().set_type(fs::FileType::File);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto forest, fs::PathForest::Make(std::move(files)));
+
+  ExpressionVector statistics(forest.size(), scalar(true));
+  RETURN_NOT_OK(forest.Visit([&](fs::PathForest::Ref ref) {
+    if (ref.stats().IsFile()) {
+      statistics[ref.i] =
+          RowGroupsStatisticsAsExpression(*metadata, row_groups[ref.stats().path()]);
+    }
+    return Status::OK();
+  }));
+
+  return std::shared_ptr<SourceFactory>(new ParquetSourceFactory(
+      std::move(filesystem), std::move(forest), std::move(format), std::move(options),
+      std::move(physical_schema), std::move(statistics)));
+}
+
+Result<std::vector<std::shared_ptr<Schema>>> ParquetSourceFactory::InspectSchemas() {
+  ARROW_ASSIGN_OR_RAISE(auto partition_schema, PartitionSchema());
+  return std::vector<std::shared_ptr<Schema>>{physical_schema_, partition_schema};
+}
+
+Result<std::shared_ptr<Source>> ParquetSourceFactory::Finish(
+    const std::shared_ptr<Schema>& schema) {
+  ARROW_ASSIGN_OR_RAISE(auto schemas, InspectSchemas());
+  for (const auto& s : schemas) {
+    RETURN_NOT_OK(SchemaBuilder::AreCompatible({schema, s}));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto partitions, ApplyPartitioning(schema));
+  for (size_t i = 0; i < partitions.size(); ++i) {
+    if (statistics_[i]->Equals(true)) {
+      continue;
+    }
+    partitions[i] = partitions[i]->Equals(true) ? statistics_[i]
+                                                : and_(partitions[i], statistics_[i]);
+  }
+
+  return FileSystemSource::Make(schema, root_partition_, format_, fs_, forest_,
+                                std::move(partitions));
+}
+
 }  // namespace dataset
 }  // namespace arrow
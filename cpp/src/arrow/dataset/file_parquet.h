@@ -19,7 +19,10 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "arrow/dataset/discovery.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
@@ -28,6 +31,8 @@ namespace parquet {
 class ParquetFileReader;
 class RowGroupMetaData;
 class FileMetaData;
+class FileMetaDataCache;
+class WriterProperties;
 }  // namespace parquet
 
 namespace arrow {
@@ -51,7 +56,23 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
   Result<std::shared_ptr<Fragment>> MakeFragment(
       const FileSource& source, std::shared_ptr<ScanOptions> options) override;
 
+  /// \brief Open a writer of a Parquet file, using writer_properties
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const override;
+
+  /// \brief Properties of the written files. Defaults to
+  /// parquet::default_writer_properties() if not set.
+  std::shared_ptr<parquet::WriterProperties> writer_properties;
+
+  /// \brief Cache of the footers of the files read through this format, keyed
+  /// by path, size and modification time. Only used for files of filesystems
+  /// reporting modification times. Not set by default.
+  std::shared_ptr<parquet::FileMetaDataCache> metadata_cache;
+
  private:
+  friend class ParquetSourceFactory;
+
   Result<std::unique_ptr<::parquet::ParquetFileReader>> OpenReader(
       const FileSource& source, MemoryPool* pool) const;
 };
@@ -61,9 +82,53 @@ class ARROW_DS_EXPORT ParquetFragment : public FileFragment {
   ParquetFragment(const FileSource& source, std::shared_ptr<ScanOptions> options)
       : FileFragment(source, std::make_shared<ParquetFileFormat>(), options) {}
 
+  ParquetFragment(const FileSource& source, std::shared_ptr<ParquetFileFormat> format,
+                  std::shared_ptr<ScanOptions> options)
+      : FileFragment(source, std::move(format), options) {}
+
   bool splittable() const override { return true; }
 };
 
+/// \brief ParquetSourceFactory creates a Source from the summary file of a
+/// Parquet dataset, such as the _metadata file written by Spark or Dask, instead
+/// of listing and opening every data file.
+///
+/// The schema is read from the summary file, and the statistics of its row
+/// groups are added to the partition expression of their data file, so that
+/// files with no row group matching a filter are pruned without being opened.
+class ARROW_DS_EXPORT ParquetSourceFactory : public FileSystemSourceFactory {
+ public:
+  /// \brief Build a ParquetSourceFactory from a summary file.
+  ///
+  /// The file paths of the summary's column chunks are relative to its
+  /// directory, which is also the default options.partition_base_dir. The data
+  /// files are neither filtered with options.ignore_prefixes nor checked with
+  /// options.exclude_invalid_files, as either would require touching them.
+  ///
+  /// \param[in] filesystem from which the summary and data files are read
+  /// \param[in] metadata_path path of the summary file
+  /// \param[in] format passed to FileSystemSource
+  /// \param[in] options see FileSystemFactoryOptions for more information.
+  static Result<std::shared_ptr<SourceFactory>> Make(
+      std::shared_ptr<fs::FileSystem> filesystem, const std::string& metadata_path,
+      std::shared_ptr<ParquetFileFormat> format, FileSystemFactoryOptions options);
+
+  Result<std::vector<std::shared_ptr<Schema>>> InspectSchemas() override;
+
+  Result<std::shared_ptr<Source>> Finish(const std::shared_ptr<Schema>& schema) override;
+
+ protected:
+  ParquetSourceFactory(std::shared_ptr<fs::FileSystem> filesystem, fs::PathForest forest,
+                       std::shared_ptr<FileFormat> format,
+                       FileSystemFactoryOptions options,
+                       std::shared_ptr<Schema> physical_schema,
+                       ExpressionVector statistics);
+
+  std::shared_ptr<Schema> physical_schema_;
+  // The disjunction of the row group statistics of each node of forest_
+  ExpressionVector statistics_;
+};
+
 Result<std::shared_ptr<Expression>> RowGroupStatisticsAsExpression(
     const parquet::RowGroupMetaData& metadata);
 
@@ -17,13 +17,18 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/builder.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
@@ -31,6 +36,9 @@
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/metadata_cache.h"
 
 namespace arrow {
 namespace dataset {
@@ -40,18 +48,18 @@ constexpr int64_t kBatchRepetitions = 1 << 5;
 constexpr int64_t kNumRows = kBatchSize * kBatchRepetitions;
 
 using parquet::ArrowWriterProperties;
+using parquet::BloomFilterOptions;
 using parquet::default_arrow_writer_properties;
 
 using parquet::default_writer_properties;
 using parquet::WriterProperties;
 
 using parquet::CreateOutputStream;
-using parquet::arrow::FileWriter;
 using parquet::arrow::WriteTable;
 
 using testing::Pointee;
 
-Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
+Status WriteRecordBatch(const RecordBatch& batch, parquet::arrow::FileWriter* writer) {
   auto schema = batch.schema();
   auto size = batch.num_rows();
 
@@ -69,7 +77,8 @@ Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
   return Status::OK();
 }
 
-Status WriteRecordBatchReader(RecordBatchReader* reader, FileWriter* writer) {
+Status WriteRecordBatchReader(RecordBatchReader* reader,
+                              parquet::arrow::FileWriter* writer) {
   auto schema = reader->schema();
 
   if (!schema->Equals(*writer->schema(), false)) {
@@ -90,9 +99,9 @@ Status WriteRecordBatchReader(
     const std::shared_ptr<WriterProperties>& properties = default_writer_properties(),
     const std::shared_ptr<ArrowWriterProperties>& arrow_properties =
         default_arrow_writer_properties()) {
-  std::unique_ptr<FileWriter> writer;
-  RETURN_NOT_OK(FileWriter::Open(*reader->schema(), pool, sink, properties,
-                                 arrow_properties, &writer));
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*reader->schema(), pool, sink,
+                                                 properties, arrow_properties, &writer));
   RETURN_NOT_OK(WriteRecordBatchReader(reader, writer.get()));
   return writer->Close();
 }
@@ -282,6 +291,33 @@ TEST_F(TestParquetFileFormat, Inspect) {
   EXPECT_EQ(*actual, *schema_);
 }
 
+TEST_F(TestParquetFileFormat, MetaDataCache) {
+  auto reader = GetRecordBatchReader();
+  auto buffer = Write(reader.get());
+  auto fs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(42)));
+  ASSERT_OK(fs->CreateFile("data.parquet", buffer->ToString()));
+  FileSource source("data.parquet", fs.get());
+
+  auto format = std::make_shared<ParquetFileFormat>();
+  format->metadata_cache = std::make_shared<parquet::FileMetaDataCache>();
+  ASSERT_OK(format->Inspect(source).status());
+  ASSERT_OK(format->Inspect(source).status());
+  ASSERT_EQ(1, format->metadata_cache->misses());
+  ASSERT_EQ(1, format->metadata_cache->hits());
+
+  // Fragments share the cache of their format
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format->MakeFragment(source, opts_));
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+  ASSERT_EQ(2, format->metadata_cache->hits());
+
+  // Buffers are not cached
+  ASSERT_OK(format->Inspect(FileSource(buffer)).status());
+  ASSERT_EQ(1, format->metadata_cache->misses());
+  ASSERT_EQ(1, format->metadata_cache->num_entries());
+}
+
 TEST_F(TestParquetFileFormat, IsSupported) {
   auto reader = GetRecordBatchReader();
   auto source = GetFileSource(reader.get());
@@ -320,6 +356,74 @@ void CountRowsInScan(ScanTaskIterator& it, int64_t expected_rows,
   EXPECT_EQ(actual_batches, expected_batches);
 }
 
+TEST_F(TestParquetFileFormat, SourceFactoryFromSummaryFile) {
+  // i64 spans [1, 2] in the first file and [1, 4] in the second one
+  std::vector<std::string> paths = {"part=1/data.parquet", "part=2/data.parquet"};
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::vector<std::shared_ptr<parquet::FileMetaData>> footers;
+  for (int n : {2, 4}) {
+    auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(n);
+    buffers.push_back(Write(reader.get()));
+    auto input = std::make_shared<io::BufferReader>(buffers.back());
+    footers.push_back(parquet::ParquetFileReader::Open(input)->metadata());
+  }
+  auto sink = CreateOutputStream();
+  parquet::WriteMetaDataFile(paths, footers, sink.get());
+  ASSERT_OK_AND_ASSIGN(auto summary, sink->Finish());
+
+  // Only the summary exists until the fragments are scanned
+  auto fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  ASSERT_OK(fs->CreateFile("ds/_metadata", summary->ToString()));
+
+  FileSystemFactoryOptions options;
+  options.partitioning = HivePartitioning::MakeFactory();
+  ASSERT_OK_AND_ASSIGN(auto factory,
+                       ParquetSourceFactory::Make(fs, "ds/_metadata",
+                                                  std::make_shared<ParquetFileFormat>(),
+                                                  options));
+  ASSERT_OK_AND_ASSIGN(auto schema, factory->Inspect());
+  ASSERT_EQ(schema->num_fields(), ArithmeticDatasetFixture::schema()->num_fields() + 1);
+  ASSERT_NE(schema->GetFieldIndex("part"), -1);
+  ASSERT_OK_AND_ASSIGN(auto source, factory->Finish(schema));
+
+  auto fragment_paths = [&](std::shared_ptr<Expression> filter) {
+    opts_ = ScanOptions::Make(schema);
+    opts_->filter = std::move(filter);
+    std::vector<std::string> actual;
+    for (auto maybe_fragment : source->GetFragments(opts_)) {
+      EXPECT_OK_AND_ASSIGN(auto fragment, std::move(maybe_fragment));
+      actual.push_back(std::static_pointer_cast<FileFragment>(fragment)->source().path());
+    }
+    return actual;
+  };
+  EXPECT_THAT(fragment_paths(scalar(true)),
+              testing::UnorderedElementsAre("ds/part=1/data.parquet",
+                                            "ds/part=2/data.parquet"));
+  EXPECT_THAT(fragment_paths(("i64"_ >= int64_t(3)).Copy()),
+              testing::ElementsAre("ds/part=2/data.parquet"));
+  EXPECT_THAT(fragment_paths(("i64"_ > int64_t(4)).Copy()), testing::ElementsAre());
+  EXPECT_THAT(fragment_paths(("part"_ == int32_t(1) and "i64"_ >= int64_t(3)).Copy()),
+              testing::ElementsAre());
+
+  // The fragments read the data files themselves
+  for (size_t i = 0; i < paths.size(); ++i) {
+    ASSERT_OK(fs->CreateFile("ds/" + paths[i], buffers[i]->ToString()));
+  }
+  opts_ = ScanOptions::Make(ArithmeticDatasetFixture::schema());
+  opts_->filter = ("i64"_ >= int64_t(3)).Copy();
+  for (auto maybe_fragment : source->GetFragments(opts_)) {
+    ASSERT_OK_AND_ASSIGN(auto fragment, std::move(maybe_fragment));
+    ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+    CountRowsInScan(scan_task_it, 3 + 4, 2);
+  }
+
+  // Summaries must point at their data files
+  ASSERT_OK(fs->CreateFile("ds/_common_metadata", buffers[0]->ToString()));
+  ASSERT_RAISES(Invalid, ParquetSourceFactory::Make(
+                             fs, "ds/_common_metadata",
+                             std::make_shared<ParquetFileFormat>(), options));
+}
+
 class TestParquetFileFormatPushDown : public TestParquetFileFormat {
  public:
   void CountRowsAndBatchesInScan(Fragment& fragment, int64_t expected_rows,
@@ -395,5 +499,160 @@ TEST_F(TestParquetFileFormatPushDown, Basic) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormatPushDown, Limit) {
+  // Row group i holds i rows, as in Basic
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  auto fragment = std::make_shared<ParquetFragment>(*source, opts_);
+
+  // Without a filter, the row groups past the limit are skipped
+  opts_->limit = 6;
+  CountRowsAndBatchesInScan(*fragment, 1 + 2 + 3, 3);
+  opts_->limit = 7;
+  CountRowsAndBatchesInScan(*fragment, 1 + 2 + 3 + 4, 4);
+  opts_->limit = 0;
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+  opts_->limit = kTotalNumRows + 1;
+  CountRowsAndBatchesInScan(*fragment, kTotalNumRows, kNumRowGroups);
+
+  // Otherwise it is unknown how many rows of a row group match
+  opts_->limit = 1;
+  opts_->filter = ("i64"_ >= int64_t(6)).Copy();
+  CountRowsAndBatchesInScan(*fragment, kTotalNumRows - (5 * (5 + 1) / 2),
+                            kNumRowGroups - 5);
+}
+
+TEST_F(TestParquetFileFormatPushDown, BloomFilter) {
+  // Every row group spans the same range of ids, so statistics alone can't
+  // exclude any of them: row group `rg` holds the ids rg, rg + 8, rg + 16, ...
+  constexpr int64_t kNumRowGroups = 8;
+  constexpr int64_t kRowsPerRowGroup = 64;
+
+  auto schm = schema({field("id", int64()), field("name", utf8())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t rg = 0; rg < kNumRowGroups; ++rg) {
+    Int64Builder ids;
+    StringBuilder names;
+    for (int64_t j = 0; j < kRowsPerRowGroup; ++j) {
+      const int64_t id = rg + kNumRowGroups * j;
+      ASSERT_OK(ids.Append(id));
+      ASSERT_OK(names.Append("name" + std::to_string(id)));
+    }
+    std::shared_ptr<Array> id_array, name_array;
+    ASSERT_OK(ids.Finish(&id_array));
+    ASSERT_OK(names.Finish(&name_array));
+    batches.push_back(
+        RecordBatch::Make(schm, kRowsPerRowGroup, {id_array, name_array}));
+  }
+  BatchIterator reader(schm, batches);
+
+  auto pool = default_memory_pool();
+  auto sink = CreateOutputStream(pool);
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter(BloomFilterOptions(1024, 0.0001))
+                        ->build();
+  ASSERT_OK(WriteRecordBatchReader(&reader, pool, sink, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(schm);
+  auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+  opts_->filter = scalar(true);
+  CountRowsAndBatchesInScan(*fragment, kNumRowGroups * kRowsPerRowGroup, kNumRowGroups);
+
+  opts_->filter = ("id"_ == int64_t(37)).Copy();
+  CountRowsAndBatchesInScan(*fragment, kRowsPerRowGroup, 1);
+
+  opts_->filter = ("name"_ == "name42").Copy();
+  CountRowsAndBatchesInScan(*fragment, kRowsPerRowGroup, 1);
+
+  // Within the range of the statistics, but absent from the data
+  opts_->filter = ("name"_ == "name1000").Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+
+  opts_->filter = ("id"_.In(ArrayFromJSON(int64(), "[3, 12]"))).Copy();
+  CountRowsAndBatchesInScan(*fragment, 2 * kRowsPerRowGroup, 2);
+
+  opts_->filter = ("id"_ == int64_t(1) or "name"_ == "name2").Copy();
+  CountRowsAndBatchesInScan(*fragment, 2 * kRowsPerRowGroup, 2);
+
+  // Bloom filters can't exclude ranges
+  opts_->filter = ("id"_ > int64_t(0)).Copy();
+  CountRowsAndBatchesInScan(*fragment, kNumRowGroups * kRowsPerRowGroup, kNumRowGroups);
+}
+
+TEST_F(TestParquetFileFormatPushDown, FilterColumnsFirst) {
+  // The filter columns are decoded first, and only the rows of the other
+  // columns which satisfy the filter are materialized
+  constexpr int64_t kNumIds = 10;
+  constexpr int64_t kRows = 1000;
+
+  auto schm = schema({field("id", int64()), field("value", float64()),
+                      field("name", utf8())});
+  auto make_batch = [&](std::function<bool(int64_t)> predicate) {
+    Int64Builder ids;
+    DoubleBuilder values;
+    StringBuilder names;
+    for (int64_t i = 0; i < kRows; ++i) {
+      if (predicate(i)) {
+        ARROW_EXPECT_OK(ids.Append(i % kNumIds));
+        ARROW_EXPECT_OK(values.Append(static_cast<double>(i)));
+        ARROW_EXPECT_OK(names.Append("name" + std::to_string(i)));
+      }
+    }
+    std::shared_ptr<Array> id_array, value_array, name_array;
+    ARROW_EXPECT_OK(ids.Finish(&id_array));
+    ARROW_EXPECT_OK(values.Finish(&value_array));
+    ARROW_EXPECT_OK(names.Finish(&name_array));
+    return RecordBatch::Make(schm, id_array->length(),
+                             {id_array, value_array, name_array});
+  };
+  auto all_rows = make_batch([](int64_t) { return true; });
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({all_rows}, &table));
+  FileSource source(Write(*table));
+
+  opts_ = ScanOptions::Make(schm);
+  opts_->evaluator = std::make_shared<TreeEvaluator>();
+  auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+  auto check_scan = [&](const std::shared_ptr<RecordBatch>& expected) {
+    ASSERT_OK_AND_ASSIGN(auto it, fragment->Scan(ctx_));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (auto maybe_scan_task : it) {
+      ASSERT_OK_AND_ASSIGN(auto scan_task, std::move(maybe_scan_task));
+      ASSERT_OK_AND_ASSIGN(auto rb_it, scan_task->Execute());
+      for (auto maybe_record_batch : rb_it) {
+        ASSERT_OK_AND_ASSIGN(auto record_batch, std::move(maybe_record_batch));
+        batches.push_back(record_batch);
+      }
+    }
+    ASSERT_EQ(1, static_cast<int>(batches.size()));
+    AssertBatchesEqual(*expected, *batches[0]);
+  };
+
+  opts_->filter = ("id"_ == int64_t(3)).Copy();
+  check_scan(make_batch([](int64_t i) { return i % kNumIds == 3; }));
+
+  opts_->filter = ("id"_ == int64_t(3) and "value"_ > 500.0).Copy();
+  check_scan(make_batch([](int64_t i) { return i % kNumIds == 3 && i > 500; }));
+
+  opts_->filter = ("value"_ >= 100.0 and "value"_ < 120.0).Copy();
+  check_scan(make_batch([](int64_t i) { return i >= 100 && i < 120; }));
+
+  opts_->filter = ("name"_ == "name42").Copy();
+  check_scan(make_batch([](int64_t i) { return i == 42; }));
+
+  // No row satisfies the filter although the statistics can't tell
+  opts_->filter = ("value"_ > 2.25 and "value"_ < 2.75).Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -154,6 +154,14 @@ TEST_F(TestFileSystemSource, TreePartitionPruning) {
   // apply to inner partitions.
   options_->filter = ("city"_ == "Franklin").Copy();
   AssertFragmentsAreFromPath(source_->GetFragments(options_), franklins);
+
+  // Range and IN filters on partition keys
+  options_->filter = ("state"_ < "NY").Copy();
+  AssertFragmentsAreFromPath(source_->GetFragments(options_), ca_cities);
+  options_->filter = ("city"_ >= "New York" and "state"_ != "CA").Copy();
+  AssertFragmentsAreFromPath(source_->GetFragments(options_), {"NY/New York"});
+  options_->filter = ("city"_).In(ArrayFromJSON(utf8(), R"(["Franklin"])")).Copy();
+  AssertFragmentsAreFromPath(source_->GetFragments(options_), franklins);
 }
 
 }  // namespace dataset
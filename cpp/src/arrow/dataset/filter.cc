@@ -20,12 +20,14 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/context.h"
@@ -39,6 +41,7 @@
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -556,6 +559,28 @@ std::shared_ptr<Expression> NotExpression::Assume(const Expression& given) const
   return Copy();
 }
 
+struct InExpression::SetLookupCache {
+  std::once_flag once;
+  Status status;
+  std::unique_ptr<compute::SetLookupKernel> kernel;
+};
+
+InExpression::InExpression(std::shared_ptr<Expression> operand,
+                           std::shared_ptr<Array> set)
+    : ExpressionImpl(std::move(operand)),
+      set_(std::move(set)),
+      set_lookup_cache_(std::make_shared<SetLookupCache>()) {}
+
+Result<compute::SetLookupKernel*> InExpression::set_lookup() const {
+  SetLookupCache* cache = set_lookup_cache_.get();
+  std::call_once(cache->once, [&] {
+    compute::FunctionContext ctx;
+    cache->status = compute::SetLookupKernel::MakeIsIn(&ctx, set_, &cache->kernel);
+  });
+  RETURN_NOT_OK(cache->status);
+  return cache->kernel.get();
+}
+
 std::shared_ptr<Expression> InExpression::Assume(const Expression& given) const {
   auto operand = operand_->Assume(given);
   if (operand->type() != ExpressionType::SCALAR) {
@@ -1076,6 +1101,139 @@ std::shared_ptr<ExpressionEvaluator> ExpressionEvaluator::Null() {
   return std::make_shared<Impl>();
 }
 
+namespace {
+
+using BooleanKernel = Status(compute::FunctionContext* context,
+                             const compute::Datum& left, const compute::Datum& right,
+                             compute::Datum* out);
+
+// Return whether every slot of a boolean Datum is valid and equal to value
+bool AllEqual(const Datum& datum, bool value) {
+  if (datum.is_scalar()) {
+    return datum.type()->id() == Type::BOOL && datum.scalar()->is_valid &&
+           checked_cast<const BooleanScalar&>(*datum.scalar()).value == value;
+  }
+
+  if (!datum.is_array() || datum.type()->id() != Type::BOOL) {
+    return false;
+  }
+  const auto& data = *datum.array();
+  if (data.length == 0 || data.GetNullCount() != 0) {
+    return false;
+  }
+  auto true_count =
+      internal::CountSetBits(data.buffers[1]->data(), data.offset, data.length);
+  return true_count == (value ? data.length : 0);
+}
+
+// The operations of the expression nodes, given their evaluated operands. They are
+// shared by TreeEvaluator and the plans of ChunkedEvaluator.
+
+Result<Datum> ApplyKleene(compute::FunctionContext* ctx, BooleanKernel* kernel,
+                          Datum lhs, Datum rhs, int64_t length) {
+  if (lhs.is_scalar()) {
+    // A null operand may have null type, but the kernel needs boolean arrays
+    std::shared_ptr<Scalar> lhs_scalar =
+        IsNullDatum(lhs) ? std::make_shared<BooleanScalar>() : lhs.scalar();
+    std::shared_ptr<Array> lhs_array;
+    RETURN_NOT_OK(MakeArrayFromScalar(ctx->memory_pool(), *lhs_scalar, length,
+                                      &lhs_array));
+    lhs = Datum(std::move(lhs_array));
+  }
+
+  if (rhs.is_scalar()) {
+    std::shared_ptr<Scalar> rhs_scalar =
+        IsNullDatum(rhs) ? std::make_shared<BooleanScalar>() : rhs.scalar();
+    std::shared_ptr<Array> rhs_array;
+    RETURN_NOT_OK(MakeArrayFromScalar(ctx->memory_pool(), *rhs_scalar, length,
+                                      &rhs_array));
+    rhs = Datum(std::move(rhs_array));
+  }
+
+  Datum out;
+  RETURN_NOT_OK(kernel(ctx, lhs, rhs, &out));
+  return std::move(out);
+}
+
+Result<Datum> ApplyNot(compute::FunctionContext* ctx, const Datum& to_invert) {
+  if (IsNullDatum(to_invert)) {
+    return NullDatum();
+  }
+
+  if (to_invert.is_scalar()) {
+    bool trivial_condition =
+        checked_cast<const BooleanScalar&>(*to_invert.scalar()).value;
+    return Datum(std::make_shared<BooleanScalar>(!trivial_condition));
+  }
+
+  DCHECK(to_invert.is_array());
+  Datum out;
+  RETURN_NOT_OK(arrow::compute::Invert(ctx, to_invert, &out));
+  return std::move(out);
+}
+
+Result<Datum> ApplyIn(compute::FunctionContext* ctx, const InExpression& expr,
+                      const Datum& operand_values) {
+  if (IsNullDatum(operand_values)) {
+    return Datum(expr.set()->null_count() != 0);
+  }
+
+  DCHECK(operand_values.is_array());
+  ARROW_ASSIGN_OR_RAISE(auto set_lookup, expr.set_lookup());
+  Datum out;
+  RETURN_NOT_OK(set_lookup->Call(ctx, operand_values, &out));
+  return std::move(out);
+}
+
+Result<Datum> ApplyIsValid(const Datum& operand_values) {
+  if (IsNullDatum(operand_values)) {
+    return Datum(false);
+  }
+
+  if (operand_values.is_scalar()) {
+    return Datum(true);
+  }
+
+  DCHECK(operand_values.is_array());
+  if (operand_values.array()->GetNullCount() == 0) {
+    return Datum(true);
+  }
+
+  const auto& data = *operand_values.array();
+  return Datum(std::make_shared<BooleanArray>(data.length, data.buffers[0], nullptr, 0,
+                                              data.offset));
+}
+
+Result<Datum> ApplyCast(compute::FunctionContext* ctx, const CastExpression& expr,
+                        const std::shared_ptr<DataType>& to_type, const Datum& to_cast) {
+  if (to_cast.is_scalar()) {
+    return to_cast.scalar()->CastTo(to_type);
+  }
+
+  DCHECK(to_cast.is_array());
+  Datum out;
+  RETURN_NOT_OK(arrow::compute::Cast(ctx, to_cast, to_type, expr.options(), &out));
+  return std::move(out);
+}
+
+Result<Datum> ApplyComparison(compute::FunctionContext* ctx,
+                              const ComparisonExpression& expr, const Datum& lhs,
+                              const Datum& rhs) {
+  if (IsNullDatum(lhs) || IsNullDatum(rhs)) {
+    return Datum(std::make_shared<BooleanScalar>());
+  }
+
+  // A literal operand is compared as a scalar, on either side
+  DCHECK(lhs.is_array() || rhs.is_array());
+
+  Datum out;
+  RETURN_NOT_OK(arrow::compute::Compare(
+      ctx, lhs, rhs, arrow::compute::CompareOptions(expr.op()), &out));
+  return std::move(out);
+}
+
+}  // namespace
+
 struct TreeEvaluator::Impl {
   Result<Datum> operator()(const ScalarExpression& expr) const {
     return Datum(expr.value());
@@ -1089,117 +1247,51 @@ struct TreeEvaluator::Impl {
   }
 
   Result<Datum> operator()(const AndExpression& expr) const {
-    return EvaluateBoolean(expr, compute::KleeneAnd);
+    return EvaluateBoolean(expr, compute::KleeneAnd, false);
   }
 
   Result<Datum> operator()(const OrExpression& expr) const {
-    return EvaluateBoolean(expr, compute::KleeneOr);
+    return EvaluateBoolean(expr, compute::KleeneOr, true);
   }
 
-  Result<Datum> EvaluateBoolean(const BinaryExpression& expr,
-                                Status kernel(compute::FunctionContext* context,
-                                              const compute::Datum& left,
-                                              const compute::Datum& right,
-                                              compute::Datum* out)) const {
+  Result<Datum> EvaluateBoolean(const BinaryExpression& expr, BooleanKernel* kernel,
+                                bool absorbing_value) const {
     ARROW_ASSIGN_OR_RAISE(auto lhs, Evaluate(*expr.left_operand()));
-    ARROW_ASSIGN_OR_RAISE(auto rhs, Evaluate(*expr.right_operand()));
 
-    if (lhs.is_scalar()) {
-      std::shared_ptr<Array> lhs_array;
-      RETURN_NOT_OK(MakeArrayFromScalar(ctx_.memory_pool(), *lhs.scalar(),
-                                        batch_.num_rows(), &lhs_array));
-      lhs = Datum(std::move(lhs_array));
+    // false AND x is false, true OR x is true, even if x is null
+    if (AllEqual(lhs, absorbing_value)) {
+      return Datum(absorbing_value);
     }
 
-    if (rhs.is_scalar()) {
-      std::shared_ptr<Array> rhs_array;
-      RETURN_NOT_OK(MakeArrayFromScalar(ctx_.memory_pool(), *rhs.scalar(),
-                                        batch_.num_rows(), &rhs_array));
-      rhs = Datum(std::move(rhs_array));
-    }
-
-    Datum out;
-    RETURN_NOT_OK(kernel(&ctx_, lhs, rhs, &out));
-    return std::move(out);
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Evaluate(*expr.right_operand()));
+    return ApplyKleene(&ctx_, kernel, std::move(lhs), std::move(rhs), batch_.num_rows());
   }
 
   Result<Datum> operator()(const NotExpression& expr) const {
     ARROW_ASSIGN_OR_RAISE(auto to_invert, Evaluate(*expr.operand()));
-    if (IsNullDatum(to_invert)) {
-      return NullDatum();
-    }
-
-    if (to_invert.is_scalar()) {
-      bool trivial_condition =
-          checked_cast<const BooleanScalar&>(*to_invert.scalar()).value;
-      return Datum(std::make_shared<BooleanScalar>(!trivial_condition));
-    }
-
-    DCHECK(to_invert.is_array());
-    Datum out;
-    RETURN_NOT_OK(arrow::compute::Invert(&ctx_, to_invert, &out));
-    return std::move(out);
+    return ApplyNot(&ctx_, to_invert);
   }
 
   Result<Datum> operator()(const InExpression& expr) const {
     ARROW_ASSIGN_OR_RAISE(auto operand_values, Evaluate(*expr.operand()));
-    if (IsNullDatum(operand_values)) {
-      return Datum(expr.set()->null_count() != 0);
-    }
-
-    DCHECK(operand_values.is_array());
-    Datum out;
-    RETURN_NOT_OK(arrow::compute::IsIn(&ctx_, operand_values, expr.set(), &out));
-    return std::move(out);
+    return ApplyIn(&ctx_, expr, operand_values);
   }
 
   Result<Datum> operator()(const IsValidExpression& expr) const {
     ARROW_ASSIGN_OR_RAISE(auto operand_values, Evaluate(*expr.operand()));
-    if (IsNullDatum(operand_values)) {
-      return Datum(false);
-    }
-
-    if (operand_values.is_scalar()) {
-      return Datum(true);
-    }
-
-    DCHECK(operand_values.is_array());
-    if (operand_values.array()->GetNullCount() == 0) {
-      return Datum(true);
-    }
-
-    return Datum(std::make_shared<BooleanArray>(operand_values.array()->length,
-                                                operand_values.array()->buffers[0]));
+    return ApplyIsValid(operand_values);
   }
 
   Result<Datum> operator()(const CastExpression& expr) const {
     ARROW_ASSIGN_OR_RAISE(auto to_type, expr.Validate(*batch_.schema()));
-
     ARROW_ASSIGN_OR_RAISE(auto to_cast, Evaluate(*expr.operand()));
-    if (to_cast.is_scalar()) {
-      return to_cast.scalar()->CastTo(to_type);
-    }
-
-    DCHECK(to_cast.is_array());
-    Datum out;
-    RETURN_NOT_OK(arrow::compute::Cast(&ctx_, to_cast, to_type, expr.options(), &out));
-    return std::move(out);
+    return ApplyCast(&ctx_, expr, to_type, to_cast);
   }
 
   Result<Datum> operator()(const ComparisonExpression& expr) const {
     ARROW_ASSIGN_OR_RAISE(auto lhs, Evaluate(*expr.left_operand()));
     ARROW_ASSIGN_OR_RAISE(auto rhs, Evaluate(*expr.right_operand()));
-
-    if (IsNullDatum(lhs) || IsNullDatum(rhs)) {
-      return Datum(std::make_shared<BooleanScalar>());
-    }
-
-    DCHECK(lhs.is_array());
-
-    Datum out;
-    RETURN_NOT_OK(arrow::compute::Compare(
-        &ctx_, lhs, rhs, arrow::compute::CompareOptions(expr.op()), &out));
-    return std::move(out);
+    return ApplyComparison(&ctx_, expr, lhs, rhs);
   }
 
   Result<Datum> operator()(const Expression& expr) const {
@@ -1220,6 +1312,291 @@ Result<Datum> TreeEvaluator::Evaluate(const Expression& expr, const RecordBatch&
   return VisitExpression(expr, Impl{this, batch, compute::FunctionContext{pool}});
 }
 
+// An expression bound to a schema: its nodes are flattened in post order, fields are
+// resolved to column indices and the targets of casts are computed, so executing the
+// plan against a slice only dispatches to the kernels.
+struct ChunkedEvaluator::Plan {
+  struct Node {
+    const Expression* expr;
+    // Indices of the operands in nodes
+    int operands[2] = {-1, -1};
+    // Column index of a FieldExpression, -1 if the schema has no such field
+    int field_index = -1;
+    // Target type of a CastExpression
+    std::shared_ptr<DataType> to_type;
+  };
+
+  static Result<std::shared_ptr<Plan>> Make(const Expression& expr,
+                                            std::shared_ptr<Schema> schema) {
+    auto plan = std::make_shared<Plan>();
+    plan->expr = expr.Copy();
+    plan->schema = std::move(schema);
+    ARROW_ASSIGN_OR_RAISE(plan->type, plan->expr->Validate(*plan->schema));
+    RETURN_NOT_OK(plan->Bind(*plan->expr).status());
+    return plan;
+  }
+
+  Result<int> Bind(const Expression& expr) {
+    Node node;
+    node.expr = &expr;
+    switch (expr.type()) {
+      case ExpressionType::FIELD:
+        node.field_index =
+            schema->GetFieldIndex(checked_cast<const FieldExpression&>(expr).name());
+        break;
+      case ExpressionType::CAST: {
+        const auto& cast = checked_cast<const CastExpression&>(expr);
+        ARROW_ASSIGN_OR_RAISE(node.to_type, cast.Validate(*schema));
+        ARROW_ASSIGN_OR_RAISE(node.operands[0], Bind(*cast.operand()));
+        break;
+      }
+      case ExpressionType::NOT:
+      case ExpressionType::IN:
+      case ExpressionType::IS_VALID: {
+        const auto& unary = checked_cast<const UnaryExpression&>(expr);
+        ARROW_ASSIGN_OR_RAISE(node.operands[0], Bind(*unary.operand()));
+        break;
+      }
+      case ExpressionType::AND:
+      case ExpressionType::OR:
+      case ExpressionType::COMPARISON: {
+        const auto& binary = checked_cast<const BinaryExpression&>(expr);
+        ARROW_ASSIGN_OR_RAISE(node.operands[0], Bind(*binary.left_operand()));
+        ARROW_ASSIGN_OR_RAISE(node.operands[1], Bind(*binary.right_operand()));
+        break;
+      }
+      default:
+        break;
+    }
+    nodes.push_back(std::move(node));
+    return static_cast<int>(nodes.size()) - 1;
+  }
+
+  Result<Datum> Execute(const RecordBatch& batch, compute::FunctionContext* ctx) const {
+    return Execute(static_cast<int>(nodes.size()) - 1, batch, ctx);
+  }
+
+  Result<Datum> Execute(int i, const RecordBatch& batch,
+                        compute::FunctionContext* ctx) const {
+    const Node& node = nodes[i];
+    const Expression& expr = *node.expr;
+    switch (expr.type()) {
+      case ExpressionType::SCALAR:
+        return Datum(checked_cast<const ScalarExpression&>(expr).value());
+      case ExpressionType::FIELD:
+        if (node.field_index == -1) {
+          return NullDatum();
+        }
+        return Datum(batch.column(node.field_index));
+      case ExpressionType::AND:
+      case ExpressionType::OR: {
+        bool absorbing_value = expr.type() == ExpressionType::OR;
+        ARROW_ASSIGN_OR_RAISE(auto lhs, Execute(node.operands[0], batch, ctx));
+        if (AllEqual(lhs, absorbing_value)) {
+          return Datum(absorbing_value);
+        }
+        ARROW_ASSIGN_OR_RAISE(auto rhs, Execute(node.operands[1], batch, ctx));
+        return ApplyKleene(ctx, absorbing_value ? compute::KleeneOr : compute::KleeneAnd,
+                           std::move(lhs), std::move(rhs), batch.num_rows());
+      }
+      case ExpressionType::NOT: {
+        ARROW_ASSIGN_OR_RAISE(auto to_invert, Execute(node.operands[0], batch, ctx));
+        return ApplyNot(ctx, to_invert);
+      }
+      case ExpressionType::IN: {
+        ARROW_ASSIGN_OR_RAISE(auto operand_values, Execute(node.operands[0], batch, ctx));
+        return ApplyIn(ctx, checked_cast<const InExpression&>(expr), operand_values);
+      }
+      case ExpressionType::IS_VALID: {
+        ARROW_ASSIGN_OR_RAISE(auto operand_values, Execute(node.operands[0], batch, ctx));
+        return ApplyIsValid(operand_values);
+      }
+      case ExpressionType::CAST: {
+        ARROW_ASSIGN_OR_RAISE(auto to_cast, Execute(node.operands[0], batch, ctx));
+        return ApplyCast(ctx, checked_cast<const CastExpression&>(expr), node.to_type,
+                         to_cast);
+      }
+      case ExpressionType::COMPARISON: {
+        ARROW_ASSIGN_OR_RAISE(auto lhs, Execute(node.operands[0], batch, ctx));
+        ARROW_ASSIGN_OR_RAISE(auto rhs, Execute(node.operands[1], batch, ctx));
+        return ApplyComparison(ctx, checked_cast<const ComparisonExpression&>(expr), lhs,
+                               rhs);
+      }
+      default:
+        return Status::NotImplemented("evaluation of ", expr.ToString());
+    }
+  }
+
+  // Owns the nodes, which may outlive the expression the plan was made from
+  std::shared_ptr<Expression> expr;
+  std::shared_ptr<Schema> schema;
+  // The type expr evaluates to
+  std::shared_ptr<DataType> type;
+  std::vector<Node> nodes;
+};
+
+namespace {
+
+constexpr size_t kMaxCachedPlans = 8;
+
+// Writes the boolean results of consecutive slices into a single array
+class BooleanSliceWriter {
+ public:
+  BooleanSliceWriter(MemoryPool* pool, int64_t length) : pool_(pool), length_(length) {}
+
+  Status Init() { return AllocateEmptyBitmap(pool_, length_, &values_); }
+
+  Status Write(const Datum& slice, int64_t offset, int64_t length) {
+    if (slice.is_scalar()) {
+      const auto& scalar = *slice.scalar();
+      if (!scalar.is_valid) {
+        RETURN_NOT_OK(InitValidity());
+        BitUtil::SetBitsTo(validity_->mutable_data(), offset, length, false);
+        null_count_ += length;
+        return Status::OK();
+      }
+      BitUtil::SetBitsTo(values_->mutable_data(), offset, length,
+                         checked_cast<const BooleanScalar&>(scalar).value);
+      return Status::OK();
+    }
+
+    if (!slice.is_array() || slice.type()->id() != Type::BOOL) {
+      return Status::NotImplemented("writing DatumKind::", slice.kind(), " of type ",
+                                    *slice.type(), " into a boolean array");
+    }
+    const auto& data = *slice.array();
+    internal::CopyBitmap(data.buffers[1]->data(), data.offset, length,
+                         values_->mutable_data(), offset);
+    if (data.GetNullCount() != 0) {
+      RETURN_NOT_OK(InitValidity());
+      internal::CopyBitmap(data.buffers[0]->data(), data.offset, length,
+                           validity_->mutable_data(), offset);
+      null_count_ += data.GetNullCount();
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Array> Finish() {
+    return std::make_shared<BooleanArray>(length_, values_, validity_, null_count_);
+  }
+
+ private:
+  // The validity bitmap is only allocated once a slice has nulls
+  Status InitValidity() {
+    if (validity_ == nullptr) {
+      RETURN_NOT_OK(AllocateBitmap(pool_, length_, &validity_));
+      BitUtil::SetBitsTo(validity_->mutable_data(), 0, length_, true);
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  int64_t length_;
+  std::shared_ptr<Buffer> values_, validity_;
+  int64_t null_count_ = 0;
+};
+
+}  // namespace
+
+constexpr int64_t ChunkedEvaluator::kDefaultChunkSize;
+
+Result<std::shared_ptr<const ChunkedEvaluator::Plan>> ChunkedEvaluator::GetPlan(
+    const Expression& expr, const std::shared_ptr<Schema>& schema) const {
+  std::lock_guard<std::mutex> lock(plans_mutex_);
+  for (const auto& plan : plans_) {
+    if (plan->schema->Equals(*schema) && plan->expr->Equals(expr)) {
+      return plan;
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto plan, Plan::Make(expr, schema));
+  if (plans_.size() == kMaxCachedPlans) {
+    plans_.erase(plans_.begin());
+  }
+  plans_.push_back(plan);
+  return plan;
+}
+
+Result<Datum> ChunkedEvaluator::Evaluate(const Expression& expr,
+                                         const RecordBatch& batch,
+                                         MemoryPool* pool) const {
+  ARROW_ASSIGN_OR_RAISE(auto plan, GetPlan(expr, batch.schema()));
+  compute::FunctionContext ctx{pool};
+  if (batch.num_rows() <= chunk_size_) {
+    return plan->Execute(batch, &ctx);
+  }
+
+  if (plan->type->id() != Type::BOOL) {
+    return ConcatenateSlices(*plan, batch, &ctx);
+  }
+
+  // The writer is only needed once a slice's result differs from the first one's
+  Datum first;
+  std::unique_ptr<BooleanSliceWriter> writer;
+  for (int64_t offset = 0; offset < batch.num_rows(); offset += chunk_size_) {
+    auto slice = batch.Slice(offset, chunk_size_);
+    ARROW_ASSIGN_OR_RAISE(auto chunk, plan->Execute(*slice, &ctx));
+    if (offset == 0) {
+      first = std::move(chunk);
+      continue;
+    }
+
+    if (writer == nullptr) {
+      if (first.is_scalar() && chunk.is_scalar() &&
+          chunk.scalar()->Equals(*first.scalar())) {
+        continue;
+      }
+      writer.reset(new BooleanSliceWriter(pool, batch.num_rows()));
+      RETURN_NOT_OK(writer->Init());
+      RETURN_NOT_OK(writer->Write(first, 0, offset));
+    }
+    RETURN_NOT_OK(writer->Write(chunk, offset, slice->num_rows()));
+  }
+
+  if (writer == nullptr) {
+    return std::move(first);
+  }
+  return Datum(writer->Finish());
+}
+
+Result<Datum> ChunkedEvaluator::ConcatenateSlices(const Plan& plan,
+                                                  const RecordBatch& batch,
+                                                  compute::FunctionContext* ctx) const {
+  std::vector<Datum> chunks;
+  bool uniform = true;
+  for (int64_t offset = 0; offset < batch.num_rows(); offset += chunk_size_) {
+    auto slice = batch.Slice(offset, chunk_size_);
+    ARROW_ASSIGN_OR_RAISE(auto chunk, plan.Execute(*slice, ctx));
+    uniform = uniform && chunk.is_scalar() &&
+              (chunks.empty() || chunk.scalar()->Equals(*chunks[0].scalar()));
+    chunks.push_back(std::move(chunk));
+  }
+
+  if (uniform) {
+    return std::move(chunks[0]);
+  }
+
+  MemoryPool* pool = ctx->memory_pool();
+  ArrayVector arrays(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    if (chunks[i].is_array()) {
+      arrays[i] = chunks[i].make_array();
+      continue;
+    }
+
+    if (!chunks[i].is_scalar()) {
+      return Status::NotImplemented("concatenation of DatumKind::", chunks[i].kind());
+    }
+    const int64_t offset = static_cast<int64_t>(i) * chunk_size_;
+    const int64_t length = std::min(chunk_size_, batch.num_rows() - offset);
+    RETURN_NOT_OK(MakeArrayFromScalar(pool, *chunks[i].scalar(), length, &arrays[i]));
+  }
+
+  std::shared_ptr<Array> out;
+  RETURN_NOT_OK(Concatenate(arrays, pool, &out));
+  return Datum(std::move(out));
+}
+
 Result<std::shared_ptr<RecordBatch>> TreeEvaluator::Filter(
     const compute::Datum& selection, const std::shared_ptr<RecordBatch>& batch,
     MemoryPool* pool) const {
@@ -1243,5 +1620,350 @@ Result<std::shared_ptr<RecordBatch>> TreeEvaluator::Filter(
   return batch->Slice(0, 0);
 }
 
+namespace {
+
+// flatten nested AndExpressions into their operands
+void CollectConjuncts(const Expression& expr, std::vector<const Expression*>* out) {
+  if (expr.type() == ExpressionType::AND) {
+    const auto& and_ = checked_cast<const AndExpression&>(expr);
+    CollectConjuncts(*and_.left_operand(), out);
+    CollectConjuncts(*and_.right_operand(), out);
+    return;
+  }
+  out->push_back(&expr);
+}
+
+// extract (field name, scalar, op) from a comparison between a field and a scalar,
+// swapping the operands if necessary so that the field is on the left
+bool GetFieldComparison(const Expression& expr, std::string* name,
+                        std::shared_ptr<Scalar>* value, compute::CompareOperator* op) {
+  using compute::CompareOperator;
+
+  if (expr.type() != ExpressionType::COMPARISON) {
+    return false;
+  }
+  const auto& cmp = checked_cast<const ComparisonExpression&>(expr);
+  const Expression* field = cmp.left_operand().get();
+  const Expression* literal = cmp.right_operand().get();
+  *op = cmp.op();
+
+  if (field->type() == ExpressionType::SCALAR &&
+      literal->type() == ExpressionType::FIELD) {
+    std::swap(field, literal);
+    switch (*op) {
+      case CompareOperator::LESS:
+        *op = CompareOperator::GREATER;
+        break;
+      case CompareOperator::LESS_EQUAL:
+        *op = CompareOperator::GREATER_EQUAL;
+        break;
+      case CompareOperator::GREATER:
+        *op = CompareOperator::LESS;
+        break;
+      case CompareOperator::GREATER_EQUAL:
+        *op = CompareOperator::LESS_EQUAL;
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (field->type() != ExpressionType::FIELD ||
+      literal->type() != ExpressionType::SCALAR) {
+    return false;
+  }
+  *name = checked_cast<const FieldExpression&>(*field).name();
+  *value = checked_cast<const ScalarExpression&>(*literal).value();
+  return true;
+}
+
+// Construct a Scalar from a slot of an Array. Only the types which are commonly used
+// as partition keys are supported.
+struct ArrayValueVisitor {
+  template <typename T>
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  template <typename T>
+  using ScalarType = typename TypeTraits<T>::ScalarType;
+
+  Status Visit(const BooleanType&) {
+    out_ = std::make_shared<BooleanScalar>(
+        checked_cast<const BooleanArray&>(array_).Value(i_), array_.type());
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    out_ = std::make_shared<ScalarType<T>>(
+        checked_cast<const ArrayType<T>&>(array_).Value(i_), array_.type());
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    auto value = checked_cast<const ArrayType<T>&>(array_).GetString(i_);
+    out_ = std::make_shared<ScalarType<T>>(Buffer::FromString(std::move(value)),
+                                           array_.type());
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("extracting scalars of type ", type);
+  }
+
+  const Array& array_;
+  int64_t i_;
+  std::shared_ptr<Scalar> out_;
+};
+
+Result<std::shared_ptr<Scalar>> GetArrayValue(const Array& array, int64_t i) {
+  ArrayValueVisitor visitor{array, i, nullptr};
+  RETURN_NOT_OK(VisitTypeInline(*array.type(), &visitor));
+  return std::move(visitor.out_);
+}
+
+bool ScalarLess(const std::shared_ptr<Scalar>& lhs, const std::shared_ptr<Scalar>& rhs) {
+  auto cmp = Compare(*lhs, *rhs);
+  return cmp.ok() && *cmp == Comparison::LESS;
+}
+
+using PositionRanges = std::vector<std::pair<int, int>>;
+
+// sort ranges and merge the overlapping ones, dropping empty ranges
+PositionRanges Normalize(PositionRanges ranges) {
+  std::sort(ranges.begin(), ranges.end());
+  PositionRanges out;
+  for (const auto& range : ranges) {
+    if (range.first >= range.second) {
+      continue;
+    }
+    if (!out.empty() && range.first <= out.back().second) {
+      out.back().second = std::max(out.back().second, range.second);
+      continue;
+    }
+    out.push_back(range);
+  }
+  return out;
+}
+
+PositionRanges Intersect(const PositionRanges& lhs, const PositionRanges& rhs) {
+  PositionRanges out;
+  auto l = lhs.begin(), r = rhs.begin();
+  while (l != lhs.end() && r != rhs.end()) {
+    int begin = std::max(l->first, r->first);
+    int end = std::min(l->second, r->second);
+    if (begin < end) {
+      out.emplace_back(begin, end);
+    }
+    if (l->second < r->second) {
+      ++l;
+    } else {
+      ++r;
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+PartitionIndex::PartitionIndex(const ExpressionVector& partitions)
+    : keys_(partitions.size()) {
+  struct Entry {
+    int partition;
+    std::shared_ptr<Scalar> value;
+  };
+  std::vector<std::string> names;
+  std::vector<std::vector<Entry>> entries;
+  std::unordered_map<std::string, size_t> name_to_entries;
+
+  std::vector<const Expression*> conjuncts;
+  for (size_t i = 0; i < partitions.size(); ++i) {
+    conjuncts.clear();
+    CollectConjuncts(*partitions[i], &conjuncts);
+
+    std::string name;
+    std::shared_ptr<Scalar> value;
+    compute::CompareOperator op;
+    for (auto conjunct : conjuncts) {
+      if (!GetFieldComparison(*conjunct, &name, &value, &op) ||
+          op != compute::CompareOperator::EQUAL) {
+        continue;
+      }
+      auto it_inserted = name_to_entries.emplace(name, entries.size());
+      if (it_inserted.second) {
+        names.push_back(name);
+        entries.emplace_back();
+      }
+      entries[it_inserted.first->second].push_back({static_cast<int>(i), value});
+    }
+  }
+
+  for (size_t f = 0; f < entries.size(); ++f) {
+    auto& field_entries = entries[f];
+
+    // only index fields whose values are valid and can be ordered
+    const auto& first = *field_entries[0].value;
+    bool orderable = Compare(first, first).ok() &&
+                     std::all_of(field_entries.begin(), field_entries.end(),
+                                 [&](const Entry& entry) {
+                                   return entry.value->is_valid &&
+                                          entry.value->type->Equals(*first.type);
+                                 });
+    if (!orderable) {
+      continue;
+    }
+
+    std::stable_sort(field_entries.begin(), field_entries.end(),
+                     [](const Entry& l, const Entry& r) {
+                       return ScalarLess(l.value, r.value);
+                     });
+
+    const int field_index = static_cast<int>(fields_.size());
+    KeyField field{names[f], {}};
+    field.values.reserve(field_entries.size());
+    for (const auto& entry : field_entries) {
+      keys_[entry.partition].emplace_back(field_index,
+                                          static_cast<int>(field.values.size()));
+      field.values.push_back(entry.value);
+    }
+    fields_.push_back(std::move(field));
+  }
+}
+
+PartitionIndex::Selection PartitionIndex::Select(const Expression& filter) const {
+  using compute::CompareOperator;
+
+  Selection selection(this);
+  if (fields_.empty()) {
+    return selection;
+  }
+
+  std::unordered_map<std::string, int> name_to_field;
+  for (size_t f = 0; f < fields_.size(); ++f) {
+    name_to_field.emplace(fields_[f].name, static_cast<int>(f));
+  }
+
+  std::vector<const Expression*> conjuncts;
+  CollectConjuncts(filter, &conjuncts);
+
+  for (auto conjunct : conjuncts) {
+    std::string name;
+    std::vector<std::shared_ptr<Scalar>> values;
+    CompareOperator op = CompareOperator::EQUAL;
+
+    std::shared_ptr<Scalar> value;
+    if (GetFieldComparison(*conjunct, &name, &value, &op)) {
+      values.push_back(std::move(value));
+    } else if (conjunct->type() == ExpressionType::IN) {
+      const auto& in = checked_cast<const InExpression&>(*conjunct);
+      if (in.operand()->type() != ExpressionType::FIELD) {
+        continue;
+      }
+      name = checked_cast<const FieldExpression&>(*in.operand()).name();
+
+      // null set elements can't equal any key
+      bool supported = true;
+      for (int64_t i = 0; i < in.set()->length() && supported; ++i) {
+        if (in.set()->IsNull(i)) {
+          continue;
+        }
+        auto maybe_value = GetArrayValue(*in.set(), i);
+        supported = maybe_value.ok();
+        if (supported) {
+          values.push_back(std::move(maybe_value).ValueOrDie());
+        }
+      }
+      if (!supported) {
+        continue;
+      }
+    } else {
+      continue;
+    }
+
+    auto field_it = name_to_field.find(name);
+    if (field_it == name_to_field.end()) {
+      continue;
+    }
+    const auto& sorted = fields_[field_it->second].values;
+    const int num_values = static_cast<int>(sorted.size());
+
+    if (std::any_of(values.begin(), values.end(),
+                    [&](const std::shared_ptr<Scalar>& value) {
+                      return !value->is_valid || !value->type->Equals(*sorted[0]->type);
+                    })) {
+      // comparisons to null are handled by Assume, and differing types might
+      // compare equal after casting
+      continue;
+    }
+
+    PositionRanges ranges;
+    for (const auto& value : values) {
+      auto lower = static_cast<int>(
+          std::lower_bound(sorted.begin(), sorted.end(), value, ScalarLess) -
+          sorted.begin());
+      auto upper = static_cast<int>(
+          std::upper_bound(sorted.begin(), sorted.end(), value, ScalarLess) -
+          sorted.begin());
+
+      switch (op) {
+        case CompareOperator::EQUAL:
+          ranges.emplace_back(lower, upper);
+          break;
+        case CompareOperator::NOT_EQUAL:
+          ranges.emplace_back(0, lower);
+          ranges.emplace_back(upper, num_values);
+          break;
+        case CompareOperator::LESS:
+          ranges.emplace_back(0, lower);
+          break;
+        case CompareOperator::LESS_EQUAL:
+          ranges.emplace_back(0, upper);
+          break;
+        case CompareOperator::GREATER:
+          ranges.emplace_back(upper, num_values);
+          break;
+        case CompareOperator::GREATER_EQUAL:
+          ranges.emplace_back(lower, num_values);
+          break;
+      }
+    }
+    ranges = Normalize(std::move(ranges));
+
+    auto& field_ranges = selection.ranges_[field_it->second];
+    if (field_ranges.first) {
+      field_ranges.second = Intersect(field_ranges.second, ranges);
+    } else {
+      field_ranges = {true, std::move(ranges)};
+    }
+  }
+
+  return selection;
+}
+
+bool PartitionIndex::Selection::Contains(int i) const {
+  if (i < 0 || i >= index_->size()) {
+    return true;
+  }
+
+  for (const auto& key : index_->keys_[i]) {
+    const auto& field_ranges = ranges_[key.first];
+    if (!field_ranges.first) {
+      continue;
+    }
+
+    // find the last range beginning at or before this key's position
+    const auto& ranges = field_ranges.second;
+    auto it = std::upper_bound(
+        ranges.begin(), ranges.end(), key.second,
+        [](int position, const std::pair<int, int>& range) {
+          return position < range.first;
+        });
+    if (it == ranges.begin() || key.second >= std::prev(it)->second) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace dataset
 }  // namespace arrow
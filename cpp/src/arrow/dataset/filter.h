@@ -19,6 +19,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -27,6 +28,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/isin.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 #include "arrow/result.h"
@@ -335,8 +337,7 @@ class ARROW_DS_EXPORT IsValidExpression final
 class ARROW_DS_EXPORT InExpression final
     : public ExpressionImpl<UnaryExpression, InExpression, ExpressionType::IN> {
  public:
-  InExpression(std::shared_ptr<Expression> operand, std::shared_ptr<Array> set)
-      : ExpressionImpl(std::move(operand)), set_(std::move(set)) {}
+  InExpression(std::shared_ptr<Expression> operand, std::shared_ptr<Array> set);
 
   std::string ToString() const override;
 
@@ -347,8 +348,16 @@ class ARROW_DS_EXPORT InExpression final
   /// The set against which the operand will be compared
   const std::shared_ptr<Array>& set() const { return set_; }
 
+  /// A kernel computing IsIn against the set, prepared on first use and shared by
+  /// copies of this expression, so that evaluating it against several batches
+  /// doesn't rebuild the lookup structure each time.
+  Result<compute::SetLookupKernel*> set_lookup() const;
+
  private:
+  struct SetLookupCache;
+
   std::shared_ptr<Array> set_;
+  std::shared_ptr<SetLookupCache> set_lookup_cache_;
 };
 
 /// Explicitly cast an expression to a different type
@@ -608,5 +617,92 @@ class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
   struct Impl;
 };
 
+/// construct an Evaluator which evaluates expressions like TreeEvaluator, one slice
+/// of chunk_size rows of the record batch at a time. The intermediate arrays of a slice
+/// are small enough to stay in cache, and the right operand of AND (OR) is skipped in
+/// slices where the left one is all false (true).
+///
+/// An expression is bound to the schema of the batch once: its fields are resolved to
+/// column indices and the result is cached for later batches of the same schema. The
+/// boolean results of the slices are written into a single array.
+class ARROW_DS_EXPORT ChunkedEvaluator : public TreeEvaluator {
+ public:
+  static constexpr int64_t kDefaultChunkSize = 1 << 14;
+
+  explicit ChunkedEvaluator(int64_t chunk_size = kDefaultChunkSize)
+      : chunk_size_(chunk_size) {}
+
+  Result<compute::Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
+                                  MemoryPool* pool) const override;
+
+  int64_t chunk_size() const { return chunk_size_; }
+
+ private:
+  struct Plan;
+
+  Result<std::shared_ptr<const Plan>> GetPlan(
+      const Expression& expr, const std::shared_ptr<Schema>& schema) const;
+
+  Result<compute::Datum> ConcatenateSlices(const Plan& plan, const RecordBatch& batch,
+                                           compute::FunctionContext* ctx) const;
+
+  int64_t chunk_size_;
+  mutable std::mutex plans_mutex_;
+  mutable std::vector<std::shared_ptr<const Plan>> plans_;
+};
+
+/// \brief An index over the keys (`field == scalar` terms of a conjunction) of a
+/// vector of partition expressions.
+///
+/// The values of each key field are kept sorted, so that the equality, range and IN
+/// constraints of a filter select the partitions which may satisfy it in logarithmic
+/// time instead of simplifying the filter against each partition expression. Key
+/// fields whose values are null or can't be ordered are not indexed.
+class ARROW_DS_EXPORT PartitionIndex {
+ public:
+  PartitionIndex() = default;
+
+  explicit PartitionIndex(const ExpressionVector& partitions);
+
+  /// \brief The partitions which may satisfy a filter
+  class ARROW_DS_EXPORT Selection {
+   public:
+    /// Return false if partitions[i] is known not to satisfy the filter
+    bool Contains(int i) const;
+
+   private:
+    friend class PartitionIndex;
+
+    explicit Selection(const PartitionIndex* index)
+        : index_(index), ranges_(index->fields_.size()) {}
+
+    const PartitionIndex* index_;
+
+    // For each key field, whether the filter constrains it and the sorted disjoint
+    // [begin, end) ranges of positions into its sorted values which it admits
+    std::vector<std::pair<bool, std::vector<std::pair<int, int>>>> ranges_;
+  };
+
+  /// \brief Select the partitions which may satisfy the conjunction `filter`.
+  /// Terms of the filter which aren't constraints on a key field are ignored.
+  Selection Select(const Expression& filter) const;
+
+  /// The number of indexed partition expressions
+  int size() const { return static_cast<int>(keys_.size()); }
+
+ private:
+  struct KeyField {
+    std::string name;
+    // values of the field in the partition expressions, sorted
+    std::vector<std::shared_ptr<Scalar>> values;
+  };
+
+  std::vector<KeyField> fields_;
+
+  // For each partition, the (field, position into the field's sorted values) of its
+  // indexed keys
+  std::vector<std::vector<std::pair<int, int>>> keys_;
+};
+
 }  // namespace dataset
 }  // namespace arrow
@@ -32,6 +32,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/checked_cast.h"
@@ -269,6 +270,15 @@ TEST_F(FilterTest, Basics) {
   ])");
 }
 
+TEST_F(FilterTest, LiteralOnTheLeft) {
+  AssertFilter(greater(scalar(0.1), field_ref("b")), {field("b", float64())}, R"([
+      {"b": -0.1, "in": 1},
+      {"b":  0.3, "in": 0},
+      {"b":  0.1, "in": 0},
+      {"b": null, "in": null}
+  ])");
+}
+
 TEST_F(FilterTest, InExpression) {
   auto hello_world = ArrayFromJSON(utf8(), R"(["hello", "world"])");
 
@@ -411,6 +421,101 @@ TEST_F(FilterTest, KleeneTruthTables) {
   ])");
 }
 
+TEST_F(FilterTest, ChunkedEvaluator) {
+  evaluator_ = std::make_shared<ChunkedEvaluator>(2);
+
+  AssertFilter("a"_ == 0 and "b"_ > 0.0 and "b"_ < 1.0,
+               {field("a", int32()), field("b", float64())}, R"([
+      {"a": 0, "b": -0.1, "in": 0},
+      {"a": 0, "b":  0.3, "in": 1},
+      {"a": 1, "b":  0.2, "in": 0},
+      {"a": 2, "b": -0.1, "in": 0},
+      {"a": 0, "b":  0.1, "in": 1},
+      {"a": 0, "b": null, "in": null},
+      {"a": 0, "b":  1.0, "in": 0}
+  ])");
+
+  // The right operand is skipped in the slices where the left one decides
+  AssertFilter("a"_ == 0 and "absent"_ == 0, {field("a", int32())}, R"([
+      {"a": 1, "in": false},
+      {"a": 2, "in": false},
+      {"a": 0, "in": null},
+      {"a": 1, "in": false},
+      {"a": 3, "in": false}
+  ])");
+
+  AssertFilter("a"_ != 0 or "b"_ > 0.5, {field("a", int32()), field("b", float64())},
+               R"([
+      {"a": 1, "b": null, "in": 1},
+      {"a": 2, "b": -0.1, "in": 1},
+      {"a": 0, "b":  0.7, "in": 1},
+      {"a": 0, "b": null, "in": null},
+      {"a": 0, "b":  0.1, "in": 0}
+  ])");
+
+  // Uniform slices yield a scalar
+  AssertFilter("a"_ == 0 and "b"_ > 0.0, {field("a", int32()), field("b", float64())},
+               R"([
+      {"a": 1, "b": -0.1, "in": 0},
+      {"a": 2, "b":  0.3, "in": 0},
+      {"a": 3, "b":  0.2, "in": 0}
+  ])");
+  auto batch = RecordBatchFromJSON(schema({field("a", int32())}), "[[1], [2], [3]]");
+  ASSERT_OK_AND_ASSIGN(auto mask, evaluator_->Evaluate("a"_ == 0 and "a"_ > 1, *batch));
+  ASSERT_TRUE(mask.is_scalar());
+}
+
+TEST_F(FilterTest, ChunkedEvaluatorMatchesTreeEvaluator) {
+  auto fields = {field("a", int32()), field("b", float64())};
+  random::RandomArrayGenerator rng(0);
+  constexpr int64_t kNumRows = 1000;
+  auto batch = RecordBatch::Make(schema(fields), kNumRows,
+                                 {rng.Int32(kNumRows, 0, 4, 0.1),
+                                  rng.Float64(kNumRows, -1.0, 1.0, 0.1)});
+
+  auto pool = default_memory_pool();
+  TreeEvaluator tree;
+  for (int64_t chunk_size : {1, 7, 64, 999, 1000, 4096}) {
+    ChunkedEvaluator chunked(chunk_size);
+    for (auto expr : {("a"_ == 0 and "b"_ > 0.0).Copy(), ("a"_ < 2 or "b"_ < 0.0).Copy(),
+                      (not("a"_ == 3) and "b"_.IsValid()).Copy()}) {
+      ASSERT_OK_AND_ASSIGN(auto expected, tree.Evaluate(*expr, *batch, pool));
+      ASSERT_OK_AND_ASSIGN(auto actual, chunked.Evaluate(*expr, *batch, pool));
+      AssertArraysEqual(*expected.make_array(), *actual.make_array());
+    }
+  }
+}
+
+TEST_F(FilterTest, ChunkedEvaluatorBindsEachSchema) {
+  evaluator_ = std::make_shared<ChunkedEvaluator>(2);
+  auto expr = "a"_ == 0 and "b"_ > 0.0;
+
+  AssertFilter(expr, {field("a", int32()), field("b", float64())}, R"([
+      {"a": 0, "b":  0.3, "in": 1},
+      {"a": 1, "b":  0.2, "in": 0},
+      {"a": 0, "b": -0.1, "in": 0},
+      {"a": 0, "b": null, "in": null},
+      {"a": 0, "b":  0.1, "in": 1}
+  ])");
+
+  // The plan bound to the schema above must not be reused for these
+  AssertFilter(expr, {field("b", float64()), field("a", int32())}, R"([
+      {"a": 0, "b":  0.3, "in": 1},
+      {"a": 1, "b":  0.2, "in": 0},
+      {"a": 0, "b": -0.1, "in": 0},
+      {"a": 0, "b": null, "in": null},
+      {"a": 0, "b":  0.1, "in": 1}
+  ])");
+
+  AssertFilter(expr, {field("a", int32())}, R"([
+      {"a": 0, "in": null},
+      {"a": 1, "in": 0},
+      {"a": 2, "in": 0},
+      {"a": 0, "in": null},
+      {"a": 0, "in": null}
+  ])");
+}
+
 class TakeExpression : public CustomExpression {
  public:
   TakeExpression(std::shared_ptr<Expression> operand, std::shared_ptr<Array> dictionary)
@@ -541,5 +646,70 @@ TEST(FieldsInExpressionTest, Basic) {
                            {"a", "b", "c"});
 }
 
+
+class PartitionIndexTest : public ::testing::Test {
+ public:
+  void AssertSelects(const Expression& filter, std::vector<int> expected) {
+    auto selection = index_.Select(filter);
+    std::vector<int> selected;
+    for (int i = 0; i < index_.size(); ++i) {
+      if (selection.Contains(i)) {
+        selected.push_back(i);
+      }
+    }
+    EXPECT_THAT(selected, testing::ContainerEq(expected)) << filter.ToString();
+  }
+
+ protected:
+  PartitionIndex index_;
+};
+
+TEST_F(PartitionIndexTest, Basic) {
+  index_ = PartitionIndex({
+      ("year"_ == 2018 and "country"_ == "FR").Copy(),  // 0
+      ("year"_ == 2019 and "country"_ == "US").Copy(),  // 1
+      ("year"_ == 2019 and "country"_ == "FR").Copy(),  // 2
+      ("year"_ == 2020).Copy(),                         // 3
+      ("country"_ == "US").Copy(),                      // 4
+      scalar(true),                                     // 5
+  });
+  ASSERT_EQ(index_.size(), 6);
+
+  AssertSelects(*scalar(true), {0, 1, 2, 3, 4, 5});
+  AssertSelects("year"_ == 2019, {1, 2, 4, 5});
+  AssertSelects("year"_ == 2017, {4, 5});
+  AssertSelects("year"_ != 2019, {0, 3, 4, 5});
+  AssertSelects("year"_ > 2018, {1, 2, 3, 4, 5});
+  AssertSelects("year"_ >= 2019 and "year"_ < 2020, {1, 2, 4, 5});
+  AssertSelects("year"_ <= 2018, {0, 4, 5});
+  AssertSelects(*scalar(2019) < "year"_, {3, 4, 5});
+  AssertSelects("year"_ == 2019 and "country"_ == "FR", {2, 5});
+  AssertSelects("year"_ > 2019 and "year"_ < 2019, {4, 5});
+
+  // IN filters select the union of the matching keys, ignoring null set elements
+  auto in_years = ArrayFromJSON(int32(), "[2020, null, 2018]");
+  AssertSelects("year"_.In(in_years), {0, 3, 4, 5});
+  AssertSelects("country"_ == "US" and "year"_.In(in_years), {3, 4, 5});
+
+  // Terms which aren't constraints on key fields don't exclude anything
+  AssertSelects("year"_ == 2019 or "country"_ == "US", {0, 1, 2, 3, 4, 5});
+  AssertSelects("alpha"_ == 3, {0, 1, 2, 3, 4, 5});
+  AssertSelects("year"_ == int64_t(2019), {0, 1, 2, 3, 4, 5});
+}
+
+TEST_F(PartitionIndexTest, UnorderableKeys) {
+  // Null keys are not indexed
+  index_ = PartitionIndex({
+      ("a"_ == 1 and "b"_ == 1).Copy(),
+      ("a"_ == 2 and "b"_ == MakeNullScalar(int32())).Copy(),
+  });
+  AssertSelects("a"_ == 1, {0});
+  AssertSelects("b"_ == 2, {0, 1});
+
+  // Keys of differing types are not indexed
+  index_ = PartitionIndex({("a"_ == 1).Copy(), ("a"_ == "1").Copy()});
+  AssertSelects("a"_ == 1, {0, 1});
+}
+
 }  // namespace dataset
 }  // namespace arrow
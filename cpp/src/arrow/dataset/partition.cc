@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -89,6 +90,24 @@ Result<std::shared_ptr<Expression>> KeyValuePartitioning::Parse(
   return scalar(true);
 }
 
+Result<std::string> KeyValuePartitioning::Format(const std::vector<Key>& keys) const {
+  if (static_cast<int>(keys.size()) != schema_->num_fields()) {
+    return Status::Invalid("expected ", schema_->num_fields(),
+                           " partition keys but got ", keys.size());
+  }
+
+  std::vector<std::string> segments(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (keys[i].value.empty() || keys[i].value.find('/') != std::string::npos) {
+      return Status::Invalid("partition key value '", keys[i].value, "' for field '",
+                             keys[i].name, "' cannot be formatted as a path segment");
+    }
+    segments[i] = FormatKey(keys[i], static_cast<int>(i));
+  }
+
+  return fs::internal::JoinAbstractPath(segments);
+}
+
 util::optional<KeyValuePartitioning::Key> DirectoryPartitioning::ParseKey(
     const std::string& segment, int i) const {
   if (i >= schema_->num_fields()) {
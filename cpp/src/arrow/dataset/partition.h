@@ -155,6 +155,13 @@ class ARROW_DS_EXPORT KeyValuePartitioning : public Partitioning {
   Result<std::shared_ptr<Expression>> Parse(const std::string& segment,
                                             int i) const override;
 
+  /// Format a partition key as the i-th segment of a path.
+  virtual std::string FormatKey(const Key& key, int i) const = 0;
+
+  /// Format the keys of each field of the schema, in order, as a path relative
+  /// to the root of the partition. This is the inverse of Parse.
+  Result<std::string> Format(const std::vector<Key>& keys) const;
+
  protected:
   using Partitioning::Partitioning;
 };
@@ -174,6 +181,8 @@ class ARROW_DS_EXPORT DirectoryPartitioning : public KeyValuePartitioning {
 
   util::optional<Key> ParseKey(const std::string& segment, int i) const override;
 
+  std::string FormatKey(const Key& key, int i) const override { return key.value; }
+
   static std::shared_ptr<PartitioningFactory> MakeFactory(
       std::vector<std::string> field_names);
 };
@@ -200,6 +209,10 @@ class ARROW_DS_EXPORT HivePartitioning : public KeyValuePartitioning {
 
   static util::optional<Key> ParseKey(const std::string& segment);
 
+  std::string FormatKey(const Key& key, int i) const override {
+    return key.name + "=" + key.value;
+  }
+
   static std::shared_ptr<PartitioningFactory> MakeFactory();
 };
 
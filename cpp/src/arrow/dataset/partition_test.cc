@@ -161,6 +161,27 @@ TEST_F(TestPartitioning, HivePartitioning) {
   AssertParseError("/alpha=0.0/beta=3.25");  // conversion of "0.0" to int32 fails
 }
 
+TEST_F(TestPartitioning, FormatKeys) {
+  using Key = KeyValuePartitioning::Key;
+  auto partitioning_schema = schema({field("alpha", int32()), field("beta", utf8())});
+  std::vector<Key> keys = {{"alpha", "0"}, {"beta", "hello"}};
+
+  DirectoryPartitioning directory(partitioning_schema);
+  ASSERT_OK_AND_EQ("0/hello", directory.Format(keys));
+
+  HivePartitioning hive(partitioning_schema);
+  ASSERT_OK_AND_ASSIGN(auto path, hive.Format(keys));
+  ASSERT_EQ(path, "alpha=0/beta=hello");
+
+  // formatted paths parse back to the same keys
+  partitioning_ = std::make_shared<HivePartitioning>(partitioning_schema);
+  AssertParse(path, "alpha"_ == int32_t(0) and "beta"_ == "hello");
+
+  ASSERT_RAISES(Invalid, hive.Format({{"alpha", "0"}}));
+  ASSERT_RAISES(Invalid, hive.Format({{"alpha", "0"}, {"beta", "a/b"}}));
+  ASSERT_RAISES(Invalid, directory.Format({{"alpha", ""}, {"beta", "hello"}}));
+}
+
 TEST_F(TestPartitioning, DiscoverHiveSchema) {
   factory_ = HivePartitioning::MakeFactory();
 
@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/projector.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -34,10 +35,17 @@
 namespace arrow {
 namespace dataset {
 
+namespace {
+
+// Plans kept for the input schemas seen last. Datasets seldom have many
+// distinct file schemas, but their number isn't bounded.
+constexpr size_t kMaxCachedPlans = 16;
+
+}  // namespace
+
 RecordBatchProjector::RecordBatchProjector(std::shared_ptr<Schema> to)
     : to_(std::move(to)),
       missing_columns_(to_->num_fields(), nullptr),
-      column_indices_(to_->num_fields(), kNoMatch),
       scalars_(to_->num_fields(), nullptr) {}
 
 Status RecordBatchProjector::SetDefaultValue(int index, std::shared_ptr<Scalar> scalar) {
@@ -51,78 +59,94 @@ Status RecordBatchProjector::SetDefaultValue(int index, std::shared_ptr<Scalar>
   }
 
   scalars_[index] = std::move(scalar);
+  missing_columns_[index] = nullptr;
   return Status::OK();
 }
 
 Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
     const RecordBatch& batch, MemoryPool* pool) {
-  if (from_ == nullptr || !batch.schema()->Equals(*from_)) {
-    RETURN_NOT_OK(SetInputSchema(batch.schema(), pool));
-  }
-
-  if (missing_columns_length_ < batch.num_rows()) {
-    RETURN_NOT_OK(ResizeMissingColumns(batch.num_rows(), pool));
-  }
+  ARROW_ASSIGN_OR_RAISE(auto plan, GetPlan(batch.schema()));
 
+  const int64_t length = batch.num_rows();
   std::vector<std::shared_ptr<Array>> columns(to_->num_fields());
 
   for (int i = 0; i < to_->num_fields(); ++i) {
-    if (column_indices_[i] != kNoMatch) {
-      columns[i] = batch.column(column_indices_[i]);
+    if (plan->column_indices[i] != kNoMatch) {
+      columns[i] = batch.column(plan->column_indices[i]);
+      continue;
+    }
+    if (missing_columns_[i] == nullptr || missing_columns_[i]->length() < length) {
+      RETURN_NOT_OK(ResizeMissingColumn(i, length, pool));
+    }
+    if (missing_columns_[i]->length() == length) {
+      columns[i] = missing_columns_[i];
     } else {
-      columns[i] = missing_columns_[i]->Slice(0, batch.num_rows());
+      columns[i] = missing_columns_[i]->Slice(0, length);
     }
   }
 
-  return RecordBatch::Make(to_, batch.num_rows(), std::move(columns));
+  return RecordBatch::Make(to_, length, std::move(columns));
 }
 
 Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
                                             MemoryPool* pool) {
-  from_ = std::move(from);
+  return GetPlan(from).status();
+}
 
-  for (int i = 0; i < to_->num_fields(); ++i) {
-    const auto& field = to_->field(i);
-    int matching_index = from_->GetFieldIndex(field->name());
+Result<const RecordBatchProjector::Plan*> RecordBatchProjector::GetPlan(
+    const std::shared_ptr<Schema>& from) {
+  // Batches of a fragment usually share their schema instance
+  if (!plans_.empty() && plans_.back().from == from) {
+    return &plans_.back();
+  }
 
-    if (matching_index != kNoMatch) {
-      if (!from_->field(matching_index)->Equals(field)) {
-        return Status::TypeError("fields had matching names but were not equivalent ",
-                                 from_->field(matching_index)->ToString(), " vs ",
-                                 field->ToString());
+  for (auto it = plans_.begin(); it != plans_.end(); ++it) {
+    if (it->from->Equals(*from)) {
+      if (it != plans_.end() - 1) {
+        std::rotate(it, it + 1, plans_.end());
       }
+      return &plans_.back();
+    }
+  }
 
-      // Mark column i as not missing by setting missing_columns_[i] to nullptr
-      missing_columns_[i] = nullptr;
-    } else {
-      // Mark column i as missing by setting missing_columns_[i]
-      // to a non-null placeholder.
-      RETURN_NOT_OK(
-          MakeArrayOfNull(pool, to_->field(i)->type(), 0, &missing_columns_[i]));
+  ARROW_ASSIGN_OR_RAISE(auto plan, MakePlan(from));
+  if (plans_.size() == kMaxCachedPlans) {
+    plans_.erase(plans_.begin());
+  }
+  plans_.push_back(std::move(plan));
+  return &plans_.back();
+}
+
+Result<RecordBatchProjector::Plan> RecordBatchProjector::MakePlan(
+    std::shared_ptr<Schema> from) const {
+  Plan plan;
+  plan.column_indices.resize(to_->num_fields());
+
+  for (int i = 0; i < to_->num_fields(); ++i) {
+    const auto& field = to_->field(i);
+    int matching_index = from->GetFieldIndex(field->name());
+
+    if (matching_index != kNoMatch && !from->field(matching_index)->Equals(field)) {
+      return Status::TypeError("fields had matching names but were not equivalent ",
+                               from->field(matching_index)->ToString(), " vs ",
+                               field->ToString());
     }
 
-    column_indices_[i] = matching_index;
+    plan.column_indices[i] = matching_index;
   }
-  return Status::OK();
+
+  plan.from = std::move(from);
+  return plan;
 }
 
-Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool* pool) {
+Status RecordBatchProjector::ResizeMissingColumn(int i, int64_t new_length,
+                                                 MemoryPool* pool) {
   // TODO(bkietz) MakeArrayOfNull could use fewer buffers by reusing a single zeroed
   // buffer for every buffer in every column which is null
-  for (int i = 0; i < to_->num_fields(); ++i) {
-    if (missing_columns_[i] == nullptr) {
-      continue;
-    }
-    if (scalars_[i] == nullptr) {
-      RETURN_NOT_OK(MakeArrayOfNull(pool, missing_columns_[i]->type(), new_length,
-                                    &missing_columns_[i]));
-      continue;
-    }
-    RETURN_NOT_OK(
-        MakeArrayFromScalar(pool, *scalars_[i], new_length, &missing_columns_[i]));
+  if (scalars_[i] == nullptr) {
+    return MakeArrayOfNull(pool, to_->field(i)->type(), new_length, &missing_columns_[i]);
   }
-  missing_columns_length_ = new_length;
-  return Status::OK();
+  return MakeArrayFromScalar(pool, *scalars_[i], new_length, &missing_columns_[i]);
 }
 
 constexpr int RecordBatchProjector::kNoMatch;
@@ -59,12 +59,23 @@ class ARROW_DS_EXPORT RecordBatchProjector {
                         MemoryPool* pool = default_memory_pool());
 
  private:
-  Status ResizeMissingColumns(int64_t new_length, MemoryPool* pool);
+  /// \brief How to project batches of a given schema
+  struct Plan {
+    std::shared_ptr<Schema> from;
+    /// The index of each projected column in the input batches, or kNoMatch
+    std::vector<int> column_indices;
+  };
 
-  std::shared_ptr<Schema> from_, to_;
-  int64_t missing_columns_length_ = 0;
+  Result<const Plan*> GetPlan(const std::shared_ptr<Schema>& from);
+  Result<Plan> MakePlan(std::shared_ptr<Schema> from) const;
+  Status ResizeMissingColumn(int i, int64_t new_length, MemoryPool* pool);
+
+  std::shared_ptr<Schema> to_;
+  /// Plans of the input schemas seen so far, the most recently used one last
+  std::vector<Plan> plans_;
+  /// Arrays filled with null or with the default value of each field, shared by all
+  /// projected batches lacking the field (sliced to their length). Allocated lazily.
   std::vector<std::shared_ptr<Array>> missing_columns_;
-  std::vector<int> column_indices_;
   std::vector<std::shared_ptr<Scalar>> scalars_;
 };
 
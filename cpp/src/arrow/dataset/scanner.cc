@@ -18,18 +18,33 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner_internal.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/table.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/stopwatch.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
 
+#ifdef _WIN32
+#include "arrow/util/windows_compatibility.h"
+#else
+#include <time.h>
+#endif
+
 namespace arrow {
 namespace dataset {
 
@@ -42,6 +57,10 @@ std::shared_ptr<ScanOptions> ScanOptions::ReplaceSchema(
     std::shared_ptr<Schema> schema) const {
   auto copy = ScanOptions::Make(std::move(schema));
   copy->use_threads = use_threads;
+  copy->fragment_readahead = fragment_readahead;
+  copy->batch_readahead = batch_readahead;
+  copy->ordered = ordered;
+  copy->limit = limit;
   copy->filter = filter;
   copy->evaluator = evaluator;
   return copy;
@@ -65,13 +84,344 @@ Result<RecordBatchIterator> InMemoryScanTask::Execute() {
   return MakeVectorIterator(record_batches_);
 }
 
+void ScanTaskMetrics::Merge(const ScanTaskMetrics& other) {
+  bytes_read += other.bytes_read;
+  read_calls += other.read_calls;
+  sequential_reads += other.sequential_reads;
+  random_reads += other.random_reads;
+  io += other.io;
+  decode += other.decode;
+  filter += other.filter;
+  project += other.project;
+  rows_in += other.rows_in;
+  rows_out += other.rows_out;
+}
+
+void ScanMetrics::Record(ScanTaskMetrics metrics) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  tasks_.push_back(std::move(metrics));
+}
+
+void ScanMetrics::Finish() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  fragments_.clear();
+  total_ = ScanTaskMetrics();
+  for (const auto& metrics : tasks_) {
+    if (metrics.fragment_index >= static_cast<int>(fragments_.size())) {
+      fragments_.resize(metrics.fragment_index + 1);
+    }
+    if (metrics.fragment_index >= 0) {
+      auto& fragment = fragments_[metrics.fragment_index];
+      fragment.fragment_index = metrics.fragment_index;
+      fragment.fragment_path = metrics.fragment_path;
+      fragment.Merge(metrics);
+    }
+    total_.Merge(metrics);
+  }
+}
+
+std::vector<ScanTaskMetrics> ScanMetrics::tasks() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return tasks_;
+}
+
+std::vector<ScanTaskMetrics> ScanMetrics::fragments() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return fragments_;
+}
+
+ScanTaskMetrics ScanMetrics::total() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return total_;
+}
+
+/// \brief The CPU time consumed by the calling thread, in nanoseconds.
+static int64_t ThreadCpuNanos() {
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+  if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+    return 0;
+  }
+  auto to_nanos = [](FILETIME t) {
+    return ((static_cast<int64_t>(t.dwHighDateTime) << 32) | t.dwLowDateTime) * 100;
+  };
+  return to_nanos(kernel) + to_nanos(user);
+#else
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    return 0;
+  }
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/// \brief Measures the wall and CPU time of the calling thread from its
+/// construction.
+class ScanTimer {
+ public:
+  ScanTimer() : cpu_start_(ThreadCpuNanos()) { wall_.Start(); }
+
+  ScanTiming Stop() {
+    ScanTiming timing;
+    timing.wall_nanos = static_cast<int64_t>(wall_.Stop());
+    timing.cpu_nanos = ThreadCpuNanos() - cpu_start_;
+    return timing;
+  }
+
+ private:
+  internal::StopWatch wall_;
+  int64_t cpu_start_;
+};
+
+/// \brief Call fn, adding the time it spends to metrics->decode except for the
+/// reads, which are already recorded in metrics->io.
+template <typename Fn>
+static Status MeasureDecode(ScanTaskMetrics* metrics, Fn&& fn) {
+  ScanTaskMetricsScope scope(metrics);
+  auto io = metrics->io;
+  ScanTimer timer;
+  Status status = fn();
+  auto timing = timer.Stop();
+  timing.wall_nanos -= metrics->io.wall_nanos - io.wall_nanos;
+  timing.cpu_nanos -= metrics->io.cpu_nanos - io.cpu_nanos;
+  metrics->decode += timing;
+  return status;
+}
+
+template <typename Fn>
+static Status Measure(ScanTiming* timing, Fn&& fn) {
+  ScanTimer timer;
+  Status status = fn();
+  *timing += timer.Stop();
+  return status;
+}
+
+static thread_local ScanTaskMetrics* current_task_metrics = NULLPTR;
+
+ScanTaskMetrics* CurrentScanTaskMetrics() { return current_task_metrics; }
+
+ScanTaskMetricsScope::ScanTaskMetricsScope(ScanTaskMetrics* metrics)
+    : previous_(current_task_metrics) {
+  current_task_metrics = metrics;
+}
+
+ScanTaskMetricsScope::~ScanTaskMetricsScope() { current_task_metrics = previous_; }
+
+/// \brief A RandomAccessFile recording its reads to the ScanTaskMetrics of the
+/// reading thread, if any.
+class MeteredFile : public io::RandomAccessFile {
+ public:
+  explicit MeteredFile(std::shared_ptr<io::RandomAccessFile> file)
+      : file_(std::move(file)), position_(0), last_read_end_(0) {}
+
+  Status Close() override { return file_->Close(); }
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(file_->Seek(position));
+    position_.store(position);
+    return Status::OK();
+  }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+  bool supports_zero_copy() const override { return file_->supports_zero_copy(); }
+
+  Result<util::string_view> Peek(int64_t nbytes) override {
+    return file_->Peek(nbytes);
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return Metered(&position_, [&] { return file_->Read(nbytes, out); });
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return Metered(&position_, [&] { return file_->Read(nbytes); });
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    std::atomic<int64_t> start(position);
+    return Metered(&start, [&] { return file_->ReadAt(position, nbytes, out); });
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    std::atomic<int64_t> start(position);
+    return Metered(&start, [&] { return file_->ReadAt(position, nbytes); });
+  }
+
+ private:
+  static int64_t BytesRead(const Result<int64_t>& result) { return *result; }
+
+  static int64_t BytesRead(const Result<std::shared_ptr<Buffer>>& result) {
+    return (*result)->size();
+  }
+
+  // Call fn, a read starting at *position, and advance *position past the
+  // bytes read.
+  template <typename Fn>
+  auto Metered(std::atomic<int64_t>* position, Fn&& fn) -> decltype(fn()) {
+    auto metrics = CurrentScanTaskMetrics();
+    if (metrics == NULLPTR) {
+      auto result = fn();
+      if (result.ok()) {
+        Advance(position, BytesRead(result));
+      }
+      return result;
+    }
+
+    ScanTimer timer;
+    auto result = fn();
+    metrics->io += timer.Stop();
+    ++metrics->read_calls;
+    if (result.ok()) {
+      const int64_t bytes_read = BytesRead(result);
+      metrics->bytes_read += bytes_read;
+      if (Advance(position, bytes_read)) {
+        ++metrics->sequential_reads;
+      } else {
+        ++metrics->random_reads;
+      }
+    }
+    return result;
+  }
+
+  // Return whether the read continued the previous one.
+  bool Advance(std::atomic<int64_t>* position, int64_t bytes_read) {
+    const int64_t start = position->fetch_add(bytes_read);
+    return last_read_end_.exchange(start + bytes_read) == start;
+  }
+
+  std::shared_ptr<io::RandomAccessFile> file_;
+  // Position of the next Read(), and end of the latest read
+  std::atomic<int64_t> position_;
+  std::atomic<int64_t> last_read_end_;
+};
+
+std::shared_ptr<io::RandomAccessFile> MeterReads(
+    std::shared_ptr<io::RandomAccessFile> file) {
+  if (CurrentScanTaskMetrics() == NULLPTR) {
+    return file;
+  }
+  return std::make_shared<MeteredFile>(std::move(file));
+}
+
+/// \brief A RecordBatchIterator executing a ScanTask and filtering and projecting
+/// its record batches, measuring each stage. The metrics are recorded once the
+/// batches are exhausted or the iterator is destroyed.
+class MeteredBatchIterator {
+ public:
+  MeteredBatchIterator(std::shared_ptr<ScanTask> task, ScanTaskMetrics metrics)
+      : task_(std::move(task)), state_(new State{std::move(metrics), {}, false}) {}
+
+  ~MeteredBatchIterator() { Finish(); }
+
+  MeteredBatchIterator(MeteredBatchIterator&&) = default;
+  MeteredBatchIterator& operator=(MeteredBatchIterator&&) = default;
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (state_ == nullptr) {
+      return nullptr;
+    }
+
+    auto metrics = &state_->metrics;
+    if (!state_->executed) {
+      state_->executed = true;
+      RETURN_NOT_OK(MeasureDecode(
+          metrics, [&] { return task_->Execute().Value(&state_->batches); }));
+    }
+
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(
+        MeasureDecode(metrics, [&] { return state_->batches.Next().Value(&batch); }));
+    if (batch == nullptr) {
+      Finish();
+      return nullptr;
+    }
+    metrics->rows_in += batch->num_rows();
+
+    auto& options = *task_->options();
+    auto pool = task_->context()->pool;
+    RETURN_NOT_OK(Measure(&metrics->filter, [&] {
+      ARROW_ASSIGN_OR_RAISE(auto selection,
+                            options.evaluator->Evaluate(*options.filter, *batch, pool));
+      return options.evaluator->Filter(selection, batch).Value(&batch);
+    }));
+    metrics->rows_out += batch->num_rows();
+
+    RETURN_NOT_OK(Measure(&metrics->project, [&] {
+      return options.projector.Project(*batch, pool).Value(&batch);
+    }));
+    return batch;
+  }
+
+ private:
+  struct State {
+    ScanTaskMetrics metrics;
+    RecordBatchIterator batches;
+    bool executed;
+  };
+
+  void Finish() {
+    if (state_ != nullptr) {
+      task_->context()->metrics->Record(std::move(state_->metrics));
+      state_.reset();
+    }
+  }
+
+  std::shared_ptr<ScanTask> task_;
+  std::unique_ptr<State> state_;
+};
+
+Result<RecordBatchIterator> FilterAndProjectScanTask::ExecuteMetered() {
+  return RecordBatchIterator(MeteredBatchIterator(task_, metrics_));
+}
+
+/// \brief Return the path of a FileFragment's file, or an empty string.
+static std::string FragmentPath(const Fragment& fragment) {
+  auto file_fragment = dynamic_cast<const FileFragment*>(&fragment);
+  if (file_fragment == NULLPTR) {
+    return "";
+  }
+  return file_fragment->source().path();
+}
+
+/// \brief Scan a Fragment into FilterAndProjectScanTasks. If the context has a
+/// ScanMetrics, the Fragment's scan is measured and recorded to it.
+static Result<ScanTaskIterator> ScanFragment(
+    const std::shared_ptr<Fragment>& fragment, int fragment_index,
+    const std::shared_ptr<ScanContext>& context) {
+  ScanTaskMetrics fragment_metrics;
+  fragment_metrics.fragment_index = fragment_index;
+
+  ScanTaskIterator scan_task_it;
+  if (context->metrics == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(scan_task_it, fragment->Scan(context));
+  } else {
+    fragment_metrics.fragment_path = FragmentPath(*fragment);
+    ScanTaskMetrics metrics = fragment_metrics;
+    auto status = MeasureDecode(
+        &metrics, [&] { return fragment->Scan(context).Value(&scan_task_it); });
+    context->metrics->Record(std::move(metrics));
+    RETURN_NOT_OK(status);
+  }
+
+  auto task_index = std::make_shared<int>(0);
+  auto wrap_scan_task = [fragment_metrics, task_index](
+                            std::shared_ptr<ScanTask> task) -> std::shared_ptr<ScanTask> {
+    auto metrics = fragment_metrics;
+    metrics.task_index = (*task_index)++;
+    return std::make_shared<FilterAndProjectScanTask>(std::move(task),
+                                                      std::move(metrics));
+  };
+  return MakeMapIterator(wrap_scan_task, std::move(scan_task_it));
+}
+
 /// \brief GetScanTaskIterator transforms an Iterator<Fragment> in a
 /// flattened Iterator<ScanTask>.
 static ScanTaskIterator GetScanTaskIterator(FragmentIterator fragments,
                                             std::shared_ptr<ScanContext> context) {
   // Fragment -> ScanTaskIterator
-  auto fn = [context](std::shared_ptr<Fragment> fragment) {
-    return fragment->Scan(context);
+  auto fragment_index = std::make_shared<int>(0);
+  auto fn = [context, fragment_index](std::shared_ptr<Fragment> fragment) {
+    return ScanFragment(fragment, (*fragment_index)++, context);
   };
 
   // Iterator<Iterator<ScanTask>>
@@ -90,12 +440,238 @@ Result<ScanTaskIterator> Scanner::Scan() {
   // Iterator<ScanTask>. The first Iterator::Next invocation is going to do
   // all the work of unwinding the chained iterators.
   auto scan_task_it = GetScanTaskIterator(std::move(fragments_it), context_);
-  // Third, apply the filter and/or projection to incoming RecordBatches by
-  // wrapping the ScanTask with a FilterAndProjectScanTask
-  auto wrap_scan_task = [](std::shared_ptr<ScanTask> task) -> std::shared_ptr<ScanTask> {
-    return std::make_shared<FilterAndProjectScanTask>(std::move(task));
+  // Every ScanTask is wrapped with a FilterAndProjectScanTask which applies the
+  // filter and/or projection to incoming RecordBatches.
+  return scan_task_it;
+}
+
+using RecordBatchVector = std::vector<std::shared_ptr<RecordBatch>>;
+
+/// \brief A RecordBatchIterator scanning Fragments on the I/O thread pool and
+/// executing their (filtered and projected) ScanTasks on the ScanContext's
+/// thread pool, ahead of the consumer. Fragments are always consumed in order.
+class ReadaheadBatchIterator {
+ public:
+  ReadaheadBatchIterator(FragmentIterator fragments, std::shared_ptr<ScanContext> context,
+                         const ScanOptions& options)
+      : fragments_(std::move(fragments)),
+        context_(std::move(context)),
+        fragment_readahead_(options.fragment_readahead),
+        batch_readahead_(options.batch_readahead),
+        ordered_(options.ordered),
+        completion_(std::make_shared<Completion>()),
+        cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+  ~ReadaheadBatchIterator() {
+    // Pending scans and tasks which haven't started yet are skipped, the others
+    // may reference the filesystems of fragments
+    if (cancelled_ != nullptr) {
+      cancelled_->store(true);
+    }
+    for (const auto& fragment_scan : fragment_scans_) {
+      fragment_scan.Wait();
+    }
+    for (const auto& task_future : task_futures_) {
+      task_future.Wait();
+    }
+  }
+
+  ARROW_DEFAULT_MOVE_AND_ASSIGN(ReadaheadBatchIterator);
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ReadaheadBatchIterator);
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    while (batches_.empty()) {
+      RETURN_NOT_OK(Pump());
+      if (task_futures_.empty()) {
+        return nullptr;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto batches, PopCompletedTask());
+      batches_.assign(batches.begin(), batches.end());
+    }
+
+    auto batch = std::move(batches_.front());
+    batches_.pop_front();
+    return batch;
+  }
+
+ private:
+  // Signaled whenever a task completes, for unordered consumption
+  struct Completion {
+    std::mutex mutex;
+    std::condition_variable cv;
   };
-  return MakeMapIterator(wrap_scan_task, std::move(scan_task_it));
+
+  // Start scanning fragments and executing tasks up to the readahead limits
+  Status Pump() {
+    RETURN_NOT_OK(ScanFragmentsAhead());
+    while (static_cast<int>(task_futures_.size()) < batch_readahead_) {
+      if (!tasks_.empty()) {
+        RETURN_NOT_OK(ExecuteAhead(std::move(tasks_.front())));
+        tasks_.pop_front();
+        continue;
+      }
+      // Only block on a fragment's scan if there is nothing else to consume
+      if (fragment_scans_.empty() ||
+          (!task_futures_.empty() && !fragment_scans_.front().is_finished())) {
+        break;
+      }
+      auto fragment_scan = std::move(fragment_scans_.front());
+      fragment_scans_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto tasks, fragment_scan.MoveResult());
+      tasks_.insert(tasks_.end(), tasks.begin(), tasks.end());
+      RETURN_NOT_OK(ScanFragmentsAhead());
+    }
+    return Status::OK();
+  }
+
+  Status ScanFragmentsAhead() {
+    while (!fragments_done_ &&
+           static_cast<int>(fragment_scans_.size()) < fragment_readahead_) {
+      ARROW_ASSIGN_OR_RAISE(auto fragment, fragments_.Next());
+      if (fragment == nullptr) {
+        fragments_done_ = true;
+        break;
+      }
+
+      auto context = context_;
+      auto cancelled = cancelled_;
+      auto fragment_index = fragment_index_++;
+      ARROW_ASSIGN_OR_RAISE(
+          auto fragment_scan,
+          io::internal::GetIOThreadPool()->Submit(
+              [fragment, fragment_index, context, cancelled]() -> Result<ScanTaskVector> {
+                if (cancelled->load()) {
+                  return ScanTaskVector{};
+                }
+                ARROW_ASSIGN_OR_RAISE(auto scan_task_it,
+                                      ScanFragment(fragment, fragment_index, context));
+                ScanTaskVector tasks;
+                for (auto maybe_task : scan_task_it) {
+                  ARROW_ASSIGN_OR_RAISE(auto task, std::move(maybe_task));
+                  tasks.push_back(std::move(task));
+                }
+                return tasks;
+              }));
+      fragment_scans_.push_back(std::move(fragment_scan));
+    }
+    return Status::OK();
+  }
+
+  Status ExecuteAhead(std::shared_ptr<ScanTask> task) {
+    auto cancelled = cancelled_;
+    ARROW_ASSIGN_OR_RAISE(
+        auto task_future,
+        context_->thread_pool->Submit([task, cancelled]() -> Result<RecordBatchVector> {
+          if (cancelled->load()) {
+            return RecordBatchVector{};
+          }
+          ARROW_ASSIGN_OR_RAISE(auto batch_it, task->Execute());
+          RecordBatchVector batches;
+          for (auto maybe_batch : batch_it) {
+            ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+            batches.push_back(std::move(batch));
+          }
+          return batches;
+        }));
+
+    if (!ordered_) {
+      auto completion = completion_;
+      task_future.AddCallback([completion](const Result<RecordBatchVector>&) {
+        std::lock_guard<std::mutex> lock(completion->mutex);
+        completion->cv.notify_one();
+      });
+    }
+    task_futures_.push_back(std::move(task_future));
+    return Status::OK();
+  }
+
+  Result<RecordBatchVector> PopCompletedTask() {
+    auto it = task_futures_.begin();
+    if (!ordered_) {
+      auto is_finished = [](const Future<RecordBatchVector>& task_future) {
+        return task_future.is_finished();
+      };
+      std::unique_lock<std::mutex> lock(completion_->mutex);
+      completion_->cv.wait(lock, [&] {
+        it = std::find_if(task_futures_.begin(), task_futures_.end(), is_finished);
+        return it != task_futures_.end();
+      });
+    }
+
+    auto task_future = std::move(*it);
+    task_futures_.erase(it);
+    return task_future.MoveResult();
+  }
+
+  FragmentIterator fragments_;
+  bool fragments_done_ = false;
+  int fragment_index_ = 0;
+  std::shared_ptr<ScanContext> context_;
+  int fragment_readahead_;
+  int batch_readahead_;
+  bool ordered_;
+  std::shared_ptr<Completion> completion_;
+  std::shared_ptr<std::atomic<bool>> cancelled_;
+
+  std::deque<Future<ScanTaskVector>> fragment_scans_;
+  std::deque<std::shared_ptr<ScanTask>> tasks_;
+  std::deque<Future<RecordBatchVector>> task_futures_;
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+};
+
+/// \brief A RecordBatchIterator yielding the first rows of another one, which is
+/// released as soon as they are yielded so that none of its work is left running.
+class LimitBatchIterator {
+ public:
+  LimitBatchIterator(RecordBatchIterator batches, int64_t limit)
+      : batches_(std::move(batches)), remaining_(limit) {}
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (remaining_ == 0) {
+      return nullptr;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto batch, batches_.Next());
+    if (batch == nullptr) {
+      Release();
+      return nullptr;
+    }
+
+    if (batch->num_rows() >= remaining_) {
+      batch = batch->Slice(0, remaining_);
+      Release();
+    } else {
+      remaining_ -= batch->num_rows();
+    }
+    return batch;
+  }
+
+ private:
+  void Release() {
+    remaining_ = 0;
+    batches_ = RecordBatchIterator();
+  }
+
+  RecordBatchIterator batches_;
+  int64_t remaining_;
+};
+
+Result<RecordBatchIterator> Scanner::ScanBatches() {
+  RecordBatchIterator batches;
+  if (options_->use_threads) {
+    auto fragments_it = GetFragmentsFromSources(sources_, options_);
+    batches = RecordBatchIterator(
+        ReadaheadBatchIterator(std::move(fragments_it), context_, *options_));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto scan_task_it, Scan());
+    auto execute = [](std::shared_ptr<ScanTask> task) { return task->Execute(); };
+    batches = MakeFlattenIterator(MakeMaybeMapIterator(execute, std::move(scan_task_it)));
+  }
+
+  if (options_->limit < 0) {
+    return batches;
+  }
+  return RecordBatchIterator(LimitBatchIterator(std::move(batches), options_->limit));
 }
 
 Result<ScanTaskIterator> ScanTaskIteratorFromRecordBatch(
@@ -133,6 +709,29 @@ Status ScannerBuilder::UseThreads(bool use_threads) {
   return Status::OK();
 }
 
+Status ScannerBuilder::Readahead(int fragment_readahead, int batch_readahead) {
+  if (fragment_readahead <= 0 || batch_readahead <= 0) {
+    return Status::Invalid("Readahead must be positive, got ", fragment_readahead,
+                           " fragments and ", batch_readahead, " batches");
+  }
+  options_->fragment_readahead = fragment_readahead;
+  options_->batch_readahead = batch_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::Ordered(bool ordered) {
+  options_->ordered = ordered;
+  return Status::OK();
+}
+
+Status ScannerBuilder::Limit(int64_t limit) {
+  if (limit < 0) {
+    return Status::Invalid("Limit must not be negative, got ", limit);
+  }
+  options_->limit = limit;
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   std::shared_ptr<ScanOptions> options;
   if (has_projection_ && !project_columns_.empty()) {
@@ -142,7 +741,7 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   }
 
   if (!options->filter->Equals(true)) {
-    options->evaluator = std::make_shared<TreeEvaluator>();
+    options->evaluator = std::make_shared<ChunkedEvaluator>();
   }
 
   return std::make_shared<Scanner>(dataset_->sources(), std::move(options), context_);
@@ -187,18 +786,30 @@ struct ScanTaskPromise {
 };
 
 Result<std::shared_ptr<Table>> Scanner::ToTable() {
-  auto task_group = TaskGroup();
-
   TableAggregator aggregator;
-  ARROW_ASSIGN_OR_RAISE(auto it, Scan());
-  for (auto maybe_scan_task : it) {
-    ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
-    task_group->Append(ScanTaskPromise{aggregator, std::move(scan_task)});
-  }
+  if (options_->limit >= 0) {
+    // Scheduling every task up front would defeat the limit
+    ARROW_ASSIGN_OR_RAISE(auto batches, ScanBatches());
+    for (auto maybe_batch : batches) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+      aggregator.Append(std::move(batch));
+    }
+  } else {
+    auto task_group = TaskGroup();
+    ARROW_ASSIGN_OR_RAISE(auto it, Scan());
+    for (auto maybe_scan_task : it) {
+      ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+      task_group->Append(ScanTaskPromise{aggregator, std::move(scan_task)});
+    }
 
-  // Wait for all tasks to complete, or the first error.
-  RETURN_NOT_OK(task_group->Finish());
+    // Wait for all tasks to complete, or the first error.
+    RETURN_NOT_OK(task_group->Finish());
+  }
 
+  // The ScanTasks recorded their metrics as their batches were exhausted
+  if (context_->metrics != nullptr) {
+    context_->metrics->Finish();
+  }
   return aggregator.Finish(options_->schema());
 }
 
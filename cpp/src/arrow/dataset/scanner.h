@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -41,10 +43,97 @@ class TaskGroup;
 
 namespace dataset {
 
+/// \brief Wall and CPU time spent in a stage of a scan, in nanoseconds.
+struct ARROW_DS_EXPORT ScanTiming {
+  int64_t wall_nanos = 0;
+  int64_t cpu_nanos = 0;
+
+  ScanTiming& operator+=(const ScanTiming& other) {
+    wall_nanos += other.wall_nanos;
+    cpu_nanos += other.cpu_nanos;
+    return *this;
+  }
+};
+
+/// \brief Metrics of executing a single ScanTask, or of scanning a Fragment into
+/// its ScanTasks.
+struct ARROW_DS_EXPORT ScanTaskMetrics {
+  // Position of the Fragment among the scanned Fragments, and the path of its
+  // file if it is a FileFragment.
+  int fragment_index = -1;
+  std::string fragment_path;
+
+  // Position of the ScanTask among those of its Fragment, or -1 for the scan of
+  // the Fragment itself, e.g. opening its file and reading its metadata.
+  int task_index = -1;
+
+  // Bytes read from files of the Fragment and the number of calls reading them.
+  // Only reads made on the thread executing the ScanTask are counted.
+  int64_t bytes_read = 0;
+  int64_t read_calls = 0;
+
+  // Successful reads starting where the previous read of the same file ended,
+  // and other successful reads. See io::IOStats.
+  int64_t sequential_reads = 0;
+  int64_t random_reads = 0;
+
+  // Time spent reading files, decoding record batches (excluding the reads),
+  // evaluating the filter and projecting the filtered record batches.
+  ScanTiming io;
+  ScanTiming decode;
+  ScanTiming filter;
+  ScanTiming project;
+
+  // Rows decoded, and rows left once filtered.
+  int64_t rows_in = 0;
+  int64_t rows_out = 0;
+
+  /// \brief Add the counters and timings of other to these.
+  void Merge(const ScanTaskMetrics& other);
+};
+
+/// \brief An opt-in sink of the ScanTaskMetrics of a scan, set with
+/// ScanContext::metrics.
+///
+/// ScanTasks record their metrics once their record batches are exhausted or
+/// abandoned. Scanner::ToTable aggregates the recorded metrics with Finish when
+/// the scan completes, consumers of Scanner::ScanBatches call it themselves.
+class ARROW_DS_EXPORT ScanMetrics {
+ public:
+  /// \brief Record the metrics of a ScanTask or Fragment. Thread safe.
+  void Record(ScanTaskMetrics metrics);
+
+  /// \brief Aggregate the recorded metrics per Fragment and in total.
+  void Finish();
+
+  /// \brief The recorded metrics, in order of recording.
+  std::vector<ScanTaskMetrics> tasks() const;
+
+  /// \brief The metrics of each Fragment, ordered by fragment_index, as of the
+  /// last call to Finish.
+  std::vector<ScanTaskMetrics> fragments() const;
+
+  /// \brief The metrics of the whole scan, as of the last call to Finish.
+  ScanTaskMetrics total() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<ScanTaskMetrics> tasks_;
+  std::vector<ScanTaskMetrics> fragments_;
+  ScanTaskMetrics total_;
+};
+
 /// \brief Shared state for a Scan operation
 struct ARROW_DS_EXPORT ScanContext {
   MemoryPool* pool = arrow::default_memory_pool();
+  // Thread pool running the scan tasks when use_threads is set.  A logical
+  // executor (see ThreadPool::MakeExecutor) can be given to share the CPU
+  // fairly with other workloads.
   internal::ThreadPool* thread_pool = arrow::internal::GetCpuThreadPool();
+
+  // Sink of the metrics of each Fragment and ScanTask, or null to skip
+  // measuring them.
+  std::shared_ptr<ScanMetrics> metrics;
 };
 
 class ARROW_DS_EXPORT ScanOptions {
@@ -62,6 +151,25 @@ class ARROW_DS_EXPORT ScanOptions {
   // ScanContext.
   bool use_threads = false;
 
+  // Number of Fragments which Scanner::ScanBatches starts scanning ahead of the
+  // consumer on the I/O thread pool, e.g. opening files and reading their
+  // metadata. Only used with use_threads.
+  int fragment_readahead = 4;
+
+  // Number of ScanTasks which Scanner::ScanBatches executes ahead of the
+  // consumer on the ScanContext's thread pool. The record batches of these
+  // tasks are held in memory until consumed. Only used with use_threads.
+  int batch_readahead = 8;
+
+  // Indicate if Scanner::ScanBatches yields record batches in the order of
+  // the ScanTasks. Otherwise the batches of the first completed task come first.
+  bool ordered = true;
+
+  // Maximum number of rows yielded by Scanner::ScanBatches and Scanner::ToTable,
+  // or -1 for no limit. Once reached, no more ScanTasks are scheduled. Without
+  // a filter, Fragments may also use it to skip parts of their data.
+  int64_t limit = -1;
+
   // Filter
   std::shared_ptr<Expression> filter;
 
@@ -158,10 +266,25 @@ class ARROW_DS_EXPORT Scanner {
   /// in a concurrent fashion and outlive the iterator.
   Result<ScanTaskIterator> Scan();
 
+  /// \brief Return a stream of the filtered and projected record batches.
+  ///
+  /// With ScanOptions::use_threads, fragments are scanned and scan tasks
+  /// executed ahead of the consumer, as bounded by the readahead options, and
+  /// batches are yielded in task order unless ScanOptions::ordered is false.
+  /// Otherwise the scan tasks are executed serially by the consumer.
+  ///
+  /// With ScanOptions::limit, the iteration ends once that many rows are
+  /// yielded, and the scans and tasks started ahead are cancelled.
+  Result<RecordBatchIterator> ScanBatches();
+
   /// \brief Convert a Scanner into a Table.
   ///
   /// Use this convenience utility with care. This will serially materialize the
-  /// Scan result in memory before creating the Table.
+  /// Scan result in memory before creating the Table. With ScanOptions::limit,
+  /// the batches are read from ScanBatches instead.
+  ///
+  /// With ScanContext::metrics, the metrics recorded by the scan are aggregated
+  /// once it completes.
   Result<std::shared_ptr<Table>> ToTable();
 
   std::shared_ptr<Schema> schema() const { return options_->schema(); }
@@ -212,6 +335,21 @@ class ARROW_DS_EXPORT ScannerBuilder {
   ///        ThreadPool found in ScanContext;
   Status UseThreads(bool use_threads = true);
 
+  /// \brief Set the number of Fragments and ScanTasks which
+  ///        Scanner::ScanBatches processes ahead of the consumer.
+  ///
+  /// \return Failure if either is not positive.
+  Status Readahead(int fragment_readahead, int batch_readahead);
+
+  /// \brief Indicate if Scanner::ScanBatches must yield record batches in the
+  ///        order of the ScanTasks.
+  Status Ordered(bool ordered = true);
+
+  /// \brief Set the maximum number of rows to scan, as in SQL's LIMIT.
+  ///
+  /// \return Failure if the limit is negative.
+  Status Limit(int64_t limit);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish() const;
 
@@ -23,6 +23,7 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/io/interfaces.h"
 
 namespace arrow {
 namespace dataset {
@@ -48,12 +49,43 @@ static inline RecordBatchIterator ProjectRecordBatch(RecordBatchIterator it,
       std::move(it));
 }
 
+/// \brief The ScanTaskMetrics recording the reads made on the calling thread, or
+/// null if it isn't executing a measured ScanTask.
+ScanTaskMetrics* CurrentScanTaskMetrics();
+
+/// \brief Make metrics the ScanTaskMetrics of the calling thread for the
+/// lifetime of the scope.
+class ScanTaskMetricsScope {
+ public:
+  explicit ScanTaskMetricsScope(ScanTaskMetrics* metrics);
+  ~ScanTaskMetricsScope();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ScanTaskMetricsScope);
+
+ private:
+  ScanTaskMetrics* previous_;
+};
+
+/// \brief If the calling thread is executing a measured ScanTask, wrap file so
+/// that its reads are recorded to the ScanTaskMetrics of the reading thread.
+std::shared_ptr<io::RandomAccessFile> MeterReads(
+    std::shared_ptr<io::RandomAccessFile> file);
+
 class FilterAndProjectScanTask : public ScanTask {
  public:
-  explicit FilterAndProjectScanTask(std::shared_ptr<ScanTask> task)
-      : ScanTask(task->options(), task->context()), task_(std::move(task)) {}
+  /// \param[in] task the ScanTask to filter and project
+  /// \param[in] metrics the fragment and task indices of task, identifying the
+  ///            ScanTaskMetrics recorded if the context has a ScanMetrics
+  FilterAndProjectScanTask(std::shared_ptr<ScanTask> task, ScanTaskMetrics metrics)
+      : ScanTask(task->options(), task->context()),
+        task_(std::move(task)),
+        metrics_(std::move(metrics)) {}
 
   Result<RecordBatchIterator> Execute() override {
+    if (context_->metrics != nullptr) {
+      return ExecuteMetered();
+    }
+
     ARROW_ASSIGN_OR_RAISE(auto it, task_->Execute());
     auto filter_it = FilterRecordBatch(std::move(it), *options_->evaluator,
                                        *options_->filter, context_->pool);
@@ -62,7 +94,10 @@ class FilterAndProjectScanTask : public ScanTask {
   }
 
  private:
+  Result<RecordBatchIterator> ExecuteMetered();
+
   std::shared_ptr<ScanTask> task_;
+  ScanTaskMetrics metrics_;
 };
 
 }  // namespace dataset
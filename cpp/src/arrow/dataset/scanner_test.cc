@@ -17,7 +17,10 @@
 
 #include "arrow/dataset/scanner.h"
 
+#include <atomic>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/dataset/test_util.h"
@@ -142,6 +145,176 @@ TEST_F(TestScanner, ToTable) {
   AssertTablesEqual(*expected, *actual);
 }
 
+TEST_F(TestScanner, ScanBatches) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  const int64_t total_batches = kNumberSources * kNumberBatches * kNumberFragments;
+  auto scanner = MakeScanner(batch);
+
+  options_->fragment_readahead = 2;
+  options_->batch_readahead = 3;
+  for (bool use_threads : {false, true}) {
+    for (bool ordered : {false, true}) {
+      options_->use_threads = use_threads;
+      options_->ordered = ordered;
+      ASSERT_OK_AND_ASSIGN(auto it, scanner.ScanBatches());
+      int64_t num_batches = 0;
+      for (auto maybe_batch : it) {
+        ASSERT_OK_AND_ASSIGN(auto actual, std::move(maybe_batch));
+        AssertBatchesEqual(*batch, *actual);
+        ++num_batches;
+      }
+      ASSERT_EQ(num_batches, total_batches);
+    }
+  }
+}
+
+TEST_F(TestScanner, ScanBatchesOrdered) {
+  SetSchema({field("i32", int32())});
+  std::vector<int32_t> expected;
+  FragmentVector fragments;
+  for (int32_t i = 0; i < 2 * kNumberFragments; ++i) {
+    // Each fragment yields one ScanTask of two batches
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (int32_t j = 0; j < 2; ++j) {
+      expected.push_back(2 * i + j);
+      batches.push_back(RecordBatchFromJSON(
+          schema_, "[{\"i32\": " + std::to_string(expected.back()) + "}]"));
+    }
+    fragments.push_back(std::make_shared<InMemoryFragment>(batches, options_));
+  }
+  Scanner scanner({std::make_shared<InMemorySource>(schema_, fragments)}, options_,
+                  ctx_);
+
+  options_->use_threads = true;
+  options_->fragment_readahead = 3;
+  options_->batch_readahead = 2;
+  for (bool ordered : {false, true}) {
+    options_->ordered = ordered;
+    ASSERT_OK_AND_ASSIGN(auto it, scanner.ScanBatches());
+    std::vector<int32_t> actual;
+    for (auto maybe_batch : it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      ASSERT_EQ(batch->num_rows(), 1);
+      actual.push_back(std::static_pointer_cast<Int32Array>(batch->column(0))->Value(0));
+    }
+    if (ordered) {
+      ASSERT_EQ(actual, expected);
+    } else {
+      EXPECT_THAT(actual, testing::UnorderedElementsAreArray(expected));
+    }
+  }
+}
+
+/// \brief An InMemoryFragment counting its scans
+class CountingFragment : public InMemoryFragment {
+ public:
+  CountingFragment(std::vector<std::shared_ptr<RecordBatch>> batches,
+                   std::shared_ptr<ScanOptions> options, std::atomic<int>* num_scans)
+      : InMemoryFragment(std::move(batches), std::move(options)),
+        num_scans_(num_scans) {}
+
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override {
+    ++*num_scans_;
+    return InMemoryFragment::Scan(std::move(context));
+  }
+
+ private:
+  std::atomic<int>* num_scans_;
+};
+
+TEST_F(TestScanner, ScanBatchesLimit) {
+  constexpr int kNumFragments = 32;
+  SetSchema({field("i32", int32())});
+  std::atomic<int> num_scans(0);
+  FragmentVector fragments;
+  for (int32_t i = 0; i < kNumFragments; ++i) {
+    // Each fragment yields one batch of two rows
+    auto batch = RecordBatchFromJSON(schema_, "[{\"i32\": " + std::to_string(2 * i) +
+                                                  "}, {\"i32\": " +
+                                                  std::to_string(2 * i + 1) + "}]");
+    fragments.push_back(std::make_shared<CountingFragment>(
+        std::vector<std::shared_ptr<RecordBatch>>{batch}, options_, &num_scans));
+  }
+  Scanner scanner({std::make_shared<InMemorySource>(schema_, fragments)}, options_,
+                  ctx_);
+
+  options_->limit = 5;
+  options_->fragment_readahead = 2;
+  options_->batch_readahead = 1;
+  for (bool use_threads : {false, true}) {
+    num_scans = 0;
+    options_->use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto it, scanner.ScanBatches());
+    std::vector<int32_t> actual;
+    for (auto maybe_batch : it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      auto values = std::static_pointer_cast<Int32Array>(batch->column(0));
+      for (int64_t i = 0; i < values->length(); ++i) {
+        actual.push_back(values->Value(i));
+      }
+    }
+    ASSERT_EQ(actual, (std::vector<int32_t>{0, 1, 2, 3, 4}));
+    if (use_threads) {
+      // Only the fragments scanned ahead are scanned past the limit
+      ASSERT_LT(num_scans.load(), kNumFragments);
+    } else {
+      ASSERT_EQ(num_scans.load(), 3);
+    }
+
+    num_scans = 0;
+    ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+    ASSERT_EQ(table->num_rows(), 5);
+    ASSERT_LT(num_scans.load(), kNumFragments);
+  }
+
+  options_->limit = 0;
+  ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+  ASSERT_EQ(table->num_rows(), 0);
+}
+
+TEST_F(TestScanner, Metrics) {
+  SetSchema({field("i32", int32())});
+  FragmentVector fragments;
+  for (int32_t i = 0; i < kNumberFragments; ++i) {
+    // Each fragment yields one ScanTask of two batches of two rows
+    auto batch = RecordBatchFromJSON(schema_, "[{\"i32\": 0}, {\"i32\": 1}]");
+    fragments.push_back(std::make_shared<InMemoryFragment>(
+        std::vector<std::shared_ptr<RecordBatch>>{batch, batch}, options_));
+  }
+  Scanner scanner({std::make_shared<InMemorySource>(schema_, fragments)}, options_,
+                  ctx_);
+  options_->filter = ("i32"_ > 0).Copy();
+  options_->evaluator = std::make_shared<TreeEvaluator>();
+
+  for (bool use_threads : {false, true}) {
+    ctx_->metrics = std::make_shared<ScanMetrics>();
+    options_->use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+    ASSERT_EQ(table->num_rows(), kNumberFragments * 2);
+
+    // One record for the scan of each fragment, and one for its ScanTask
+    ASSERT_EQ(ctx_->metrics->tasks().size(), 2 * kNumberFragments);
+    auto fragment_metrics = ctx_->metrics->fragments();
+    ASSERT_EQ(fragment_metrics.size(), kNumberFragments);
+    for (int i = 0; i < kNumberFragments; ++i) {
+      ASSERT_EQ(fragment_metrics[i].fragment_index, i);
+      ASSERT_EQ(fragment_metrics[i].fragment_path, "");
+      ASSERT_EQ(fragment_metrics[i].rows_in, 4);
+      ASSERT_EQ(fragment_metrics[i].rows_out, 2);
+    }
+
+    auto total = ctx_->metrics->total();
+    ASSERT_EQ(total.rows_in, kNumberFragments * 4);
+    ASSERT_EQ(total.rows_out, kNumberFragments * 2);
+    // In memory fragments are not read from files
+    ASSERT_EQ(total.bytes_read, 0);
+    ASSERT_EQ(total.read_calls, 0);
+    ASSERT_GT(total.filter.wall_nanos, 0);
+  }
+  ctx_->metrics = nullptr;
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() {
     SourceVector sources;
@@ -189,6 +362,27 @@ TEST_F(TestScannerBuilder, TestFilter) {
                 builder.Filter("i64"_ == int64_t(10) || "not_a_column"_ == true));
 }
 
+TEST_F(TestScannerBuilder, TestReadahead) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.Readahead(1, 16));
+  ASSERT_OK(builder.Ordered(false));
+  ASSERT_OK(builder.Finish().status());
+
+  ASSERT_RAISES(Invalid, builder.Readahead(0, 16));
+  ASSERT_RAISES(Invalid, builder.Readahead(4, -1));
+}
+
+TEST_F(TestScannerBuilder, TestLimit) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.Limit(0));
+  ASSERT_OK(builder.Limit(10));
+  ASSERT_OK(builder.Finish().status());
+
+  ASSERT_RAISES(Invalid, builder.Limit(-1));
+}
+
 using testing::ElementsAre;
 using testing::IsEmpty;
 
@@ -75,6 +75,9 @@ class PartitioningOrFactory;
 
 struct ScanContext;
 
+class ScanMetrics;
+struct ScanTaskMetrics;
+
 class ScanOptions;
 
 class Scanner;
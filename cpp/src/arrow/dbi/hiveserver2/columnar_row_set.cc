@@ -17,12 +17,21 @@
 
 #include "arrow/dbi/hiveserver2/columnar_row_set.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <string>
 #include <vector>
 
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
+#include "arrow/dbi/hiveserver2/types.h"
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
@@ -96,5 +105,151 @@ std::unique_ptr<BinaryColumn> ColumnarRowSet::GetBinaryCol(int i) const {
   return GetCol<BinaryColumn>(i);
 }
 
+namespace {
+
+// Converts a Thrift null bitmap, in which the set bits are the nulls, into an
+// Arrow validity bitmap, or leaves 'out' null if there are no nulls.
+Status MakeValidityBitmap(const std::string& nulls, int64_t length, MemoryPool* pool,
+                          std::shared_ptr<Buffer>* out, int64_t* null_count) {
+  // As for Column, the bitmap may be shorter than expected (HUE-2722): the
+  // missing bytes are for non-null values
+  const int64_t num_bytes = BitUtil::BytesForBits(length);
+  const int64_t nulls_size = std::min(static_cast<int64_t>(nulls.size()), num_bytes);
+  const auto null_bytes = reinterpret_cast<const uint8_t*>(nulls.data());
+  *null_count = internal::CountSetBits(null_bytes, 0, std::min(length, nulls_size * 8));
+  if (*null_count == 0) {
+    out->reset();
+    return Status::OK();
+  }
+
+  RETURN_NOT_OK(AllocateBuffer(pool, num_bytes, out));
+  uint8_t* bitmap = (*out)->mutable_data();
+  for (int64_t i = 0; i < nulls_size; ++i) {
+    bitmap[i] = static_cast<uint8_t>(~null_bytes[i]);
+  }
+  std::memset(bitmap + nulls_size, 0xFF, static_cast<size_t>(num_bytes - nulls_size));
+  return Status::OK();
+}
+
+template <typename T>
+Status CopyValues(const std::vector<T>& values, MemoryPool* pool,
+                  std::shared_ptr<Buffer>* out) {
+  const auto size = static_cast<int64_t>(values.size() * sizeof(T));
+  RETURN_NOT_OK(AllocateBuffer(pool, size, out));
+  if (size > 0) {
+    std::memcpy((*out)->mutable_data(), values.data(), static_cast<size_t>(size));
+  }
+  return Status::OK();
+}
+
+// std::vector<bool> is packed in an unspecified way, so it is copied bitwise
+Status CopyValues(const std::vector<bool>& values, MemoryPool* pool,
+                  std::shared_ptr<Buffer>* out) {
+  const auto length = static_cast<int64_t>(values.size());
+  RETURN_NOT_OK(AllocateBuffer(pool, BitUtil::BytesForBits(length), out));
+  auto it = values.begin();
+  internal::GenerateBitsUnrolled((*out)->mutable_data(), 0, length,
+                                 [&it]() -> bool { return *it++; });
+  return Status::OK();
+}
+
+template <typename TColumnType>
+Status MakeFixedWidthArray(const std::shared_ptr<DataType>& type,
+                           const TColumnType& column, MemoryPool* pool,
+                           std::shared_ptr<ArrayData>* out) {
+  const auto length = static_cast<int64_t>(column.values.size());
+  std::shared_ptr<Buffer> validity, values;
+  int64_t null_count;
+  RETURN_NOT_OK(MakeValidityBitmap(column.nulls, length, pool, &validity, &null_count));
+  RETURN_NOT_OK(CopyValues(column.values, pool, &values));
+  *out = ArrayData::Make(type, length, {validity, values}, null_count);
+  return Status::OK();
+}
+
+template <typename TColumnType>
+Status MakeBinaryArray(const std::shared_ptr<DataType>& type, const TColumnType& column,
+                       MemoryPool* pool, std::shared_ptr<ArrayData>* out) {
+  const auto length = static_cast<int64_t>(column.values.size());
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  RETURN_NOT_OK(MakeValidityBitmap(column.nulls, length, pool, &validity, &null_count));
+
+  int64_t data_size = 0;
+  for (const auto& value : column.values) {
+    data_size += static_cast<int64_t>(value.size());
+  }
+  if (data_size > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("HiveServer2 column of ", data_size,
+                                 " bytes is too large for a ", *type, " array");
+  }
+
+  std::shared_ptr<Buffer> offsets, data;
+  RETURN_NOT_OK(AllocateBuffer(pool, (length + 1) * sizeof(int32_t), &offsets));
+  RETURN_NOT_OK(AllocateBuffer(pool, data_size, &data));
+  auto raw_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+  uint8_t* raw_data = data->mutable_data();
+  int32_t position = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    const std::string& value = column.values[i];
+    raw_offsets[i] = position;
+    std::memcpy(raw_data + position, value.data(), value.size());
+    position += static_cast<int32_t>(value.size());
+  }
+  raw_offsets[length] = position;
+
+  *out = ArrayData::Make(type, length, {validity, offsets, data}, null_count);
+  return Status::OK();
+}
+
+Status MakeArrayData(const hs2::TColumn& column, MemoryPool* pool,
+                     std::shared_ptr<ArrayData>* out) {
+  if (column.__isset.boolVal) {
+    return MakeFixedWidthArray(boolean(), column.boolVal, pool, out);
+  } else if (column.__isset.byteVal) {
+    return MakeFixedWidthArray(int8(), column.byteVal, pool, out);
+  } else if (column.__isset.i16Val) {
+    return MakeFixedWidthArray(int16(), column.i16Val, pool, out);
+  } else if (column.__isset.i32Val) {
+    return MakeFixedWidthArray(int32(), column.i32Val, pool, out);
+  } else if (column.__isset.i64Val) {
+    return MakeFixedWidthArray(int64(), column.i64Val, pool, out);
+  } else if (column.__isset.doubleVal) {
+    return MakeFixedWidthArray(float64(), column.doubleVal, pool, out);
+  } else if (column.__isset.stringVal) {
+    return MakeBinaryArray(utf8(), column.stringVal, pool, out);
+  } else if (column.__isset.binaryVal) {
+    return MakeBinaryArray(binary(), column.binaryVal, pool, out);
+  }
+  return Status::IOError("HiveServer2 column without values");
+}
+
+}  // namespace
+
+Status ColumnarRowSet::ToRecordBatch(const std::vector<ColumnDesc>& column_descs,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<RecordBatch>* out) const {
+  const auto& columns = impl_->resp.results.columns;
+  if (column_descs.size() != columns.size()) {
+    return Status::Invalid("Expected ", columns.size(), " column descriptions, got ",
+                           column_descs.size());
+  }
+
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ArrayData>> arrays(columns.size());
+  int64_t num_rows = 0;
+  for (size_t i = 0; i < columns.size(); ++i) {
+    RETURN_NOT_OK(MakeArrayData(columns[i], pool, &arrays[i]));
+    if (i == 0) {
+      num_rows = arrays[i]->length;
+    } else if (arrays[i]->length != num_rows) {
+      return Status::IOError("HiveServer2 columns have different lengths");
+    }
+    fields.push_back(field(column_descs[i].column_name(), arrays[i]->type));
+  }
+
+  *out = RecordBatch::Make(schema(fields), num_rows, std::move(arrays));
+  return Status::OK();
+}
+
 }  // namespace hiveserver2
 }  // namespace arrow
@@ -22,12 +22,20 @@
 #include <string>
 #include <vector>
 
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+class RecordBatch;
+
 namespace hiveserver2 {
 
+class ColumnDesc;
+
 // The Column class is used to access data that was fetched in columnar format.
 // The contents of the data can be accessed through the data() fn, which returns
 // a ptr to a vector containing the contents of this column in the fetched
@@ -137,6 +145,20 @@ class ARROW_EXPORT ColumnarRowSet {
   template <typename T>
   std::unique_ptr<T> GetCol(int i) const;
 
+  // Converts the fetched columns into a RecordBatch, without going through
+  // per-value accessors: fixed-width values are copied in bulk, the null
+  // bitmaps are inverted bytewise and the strings of a column are gathered in a
+  // single data buffer.
+  //
+  // The fields are named after 'column_descs', as returned by
+  // Operation::GetResultSetMetadata(). Their types follow the columnar format of
+  // the results: BOOLEAN, TINYINT, SMALLINT, INT, BIGINT and DOUBLE columns map
+  // to the Arrow types of the same width, FLOAT columns are sent as doubles,
+  // BINARY columns map to binary, and the columns of other types map to the type
+  // they are sent as, e.g. utf8 for DECIMAL.
+  Status ToRecordBatch(const std::vector<ColumnDesc>& column_descs, MemoryPool* pool,
+                       std::shared_ptr<RecordBatch>* out) const;
+
  private:
   // Hides Thrift objects from the header.
   struct ColumnarRowSetImpl;
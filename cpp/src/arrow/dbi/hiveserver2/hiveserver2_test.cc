@@ -28,6 +28,7 @@
 #include "arrow/dbi/hiveserver2/session.h"
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -279,6 +280,61 @@ TEST_F(OperationTest, TestIsNull) {
   ASSERT_OK(select_nulls_op->Close());
 }
 
+TEST_F(OperationTest, TestFetchRecordBatch) {
+  CreateTestTable();
+  InsertIntoTestTable(std::vector<int>({1, 2, 3, NULL_INT_VALUE}),
+                      std::vector<std::string>({"a", "NULL", "", "d"}));
+
+  std::unique_ptr<Operation> select_op;
+  ASSERT_OK(session_->ExecuteStatement("select * from " + TEST_TBL + " order by int_col",
+                                       &select_op));
+
+  std::unique_ptr<ColumnarRowSet> results;
+  bool has_more_rows = false;
+  ASSERT_OK(select_op->Fetch(&results, &has_more_rows));
+  std::vector<ColumnDesc> column_descs;
+  ASSERT_OK(select_op->GetResultSetMetadata(&column_descs));
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(results->ToRecordBatch(column_descs, default_memory_pool(), &batch));
+  auto expected = RecordBatchFromJSON(
+      schema({field(TEST_COL1, int32()), field(TEST_COL2, utf8())}),
+      R"([[1, "a"], [2, null], [3, ""], [null, "d"]])");
+  ASSERT_BATCHES_EQUAL(*expected, *batch);
+
+  ASSERT_OK(select_op->Close());
+}
+
+TEST_F(OperationTest, TestFetchIterator) {
+  CreateTestTable();
+  InsertIntoTestTable(std::vector<int>({1, 2, 3, 4, 5}),
+                      std::vector<std::string>({"a", "b", "c", "d", "e"}));
+
+  for (int depth : {0, 1, 3}) {
+    std::unique_ptr<Operation> select_op;
+    ASSERT_OK(session_->ExecuteStatement(
+        "select * from " + TEST_TBL + " order by int_col", &select_op));
+
+    FetchOptions options;
+    options.batch_size = 2;
+    options.depth = depth;
+    std::vector<int> values;
+    {
+      RowSetIterator it;
+      ASSERT_OK(select_op->MakeFetchIterator(options, &it));
+      for (auto maybe_results : it) {
+        ASSERT_OK_AND_ASSIGN(auto results, maybe_results);
+        std::unique_ptr<Int32Column> int_col = results->GetInt32Col(0);
+        ASSERT_LE(int_col->length(), options.batch_size);
+        values.insert(values.end(), int_col->data().begin(), int_col->data().end());
+      }
+    }
+    ASSERT_EQ(values, std::vector<int>({1, 2, 3, 4, 5}));
+
+    ASSERT_OK(select_op->Close());
+  }
+}
+
 TEST_F(OperationTest, TestCancel) {
   CreateTestTable();
   InsertIntoTestTable(std::vector<int>({1, 2, 3, 4}),
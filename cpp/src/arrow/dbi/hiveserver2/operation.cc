@@ -17,6 +17,9 @@
 
 #include "arrow/dbi/hiveserver2/operation.h"
 
+#include <memory>
+#include <utility>
+
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
 #include "arrow/dbi/hiveserver2/ImpalaService_types.h"
@@ -113,6 +116,53 @@ Status Operation::Fetch(int max_rows, FetchOrientation orientation,
   return status;
 }
 
+namespace {
+
+// Fetches the row sets of an operation until there are no more rows.
+class FetchRowSetIterator {
+ public:
+  FetchRowSetIterator(const Operation* operation, int batch_size)
+      : operation_(operation), batch_size_(batch_size) {}
+
+  Result<std::shared_ptr<ColumnarRowSet>> Next() {
+    if (done_) {
+      return nullptr;
+    }
+    // Don't fetch again after an error
+    done_ = true;
+    unique_ptr<ColumnarRowSet> results;
+    bool has_more_rows = false;
+    RETURN_NOT_OK(
+        operation_->Fetch(batch_size_, FetchOrientation::NEXT, &results, &has_more_rows));
+    done_ = !has_more_rows;
+    return std::shared_ptr<ColumnarRowSet>(std::move(results));
+  }
+
+ private:
+  const Operation* operation_;
+  int batch_size_;
+  bool done_ = false;
+};
+
+}  // namespace
+
+Status Operation::MakeFetchIterator(const FetchOptions& options,
+                                    RowSetIterator* out) const {
+  if (options.batch_size <= 0) {
+    return Status::Invalid("Fetch batch size must be positive");
+  }
+  if (options.depth < 0) {
+    return Status::Invalid("Fetch depth must not be negative");
+  }
+
+  RowSetIterator it(FetchRowSetIterator(this, options.batch_size));
+  if (options.depth == 0) {
+    *out = std::move(it);
+    return Status::OK();
+  }
+  return MakeReadaheadIterator(std::move(it), options.depth).Value(out);
+}
+
 Status Operation::Cancel() const {
   hs2::TCancelOperationReq req;
   req.__set_operationHandle(impl_->handle);
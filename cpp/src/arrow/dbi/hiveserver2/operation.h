@@ -24,6 +24,7 @@
 #include "arrow/dbi/hiveserver2/columnar_row_set.h"
 #include "arrow/dbi/hiveserver2/types.h"
 
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -45,6 +46,17 @@ enum class FetchOrientation {
   LAST       // not supported
 };
 
+// Options of Operation::MakeFetchIterator().
+struct ARROW_EXPORT FetchOptions {
+  // The maximum number of rows requested by each FetchResults call.
+  int batch_size = 1024;
+  // The number of row sets fetched ahead of the one being consumed, on a background
+  // thread. With 0, each row set is fetched when it is requested.
+  int depth = 1;
+};
+
+using RowSetIterator = Iterator<std::shared_ptr<ColumnarRowSet>>;
+
 // Represents a single HiveServer2 operation. Used to monitor the status of an operation
 // and to retrieve its results. The only Operation function that will block is Fetch,
 // which blocks if there aren't any results ready yet.
@@ -91,6 +103,16 @@ class ARROW_EXPORT Operation {
   Status Fetch(int max_rows, FetchOrientation orientation,
                std::unique_ptr<ColumnarRowSet>* results, bool* has_more_rows) const;
 
+  // Returns an iterator over the remaining results, one row set per FetchResults call,
+  // which ends after the last row set. Row sets are fetched ahead on a background
+  // thread, so that the round trip of the next FetchResults call overlaps with the
+  // processing of the current row set.
+  //
+  // The iterator must be destroyed before this operation, and no other function of
+  // this operation or of its session may be called meanwhile, since they share the
+  // same connection.
+  Status MakeFetchIterator(const FetchOptions& options, RowSetIterator* out) const;
+
   // May be called after successfully creating the operation and before calling Close.
   Status Cancel() const;
 
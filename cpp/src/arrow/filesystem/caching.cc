@@ -0,0 +1,564 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/caching.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace fs {
+
+CachingFileSystemOptions CachingFileSystemOptions::Defaults() {
+  return CachingFileSystemOptions();
+}
+
+// Cache bookkeeping.  Blocks are stored as flat files named after the cached
+// file's id and the block index.  Each validated version of a file gets a new
+// id, so that blocks of stale versions are never served.
+class CachingFileSystem::Impl {
+ public:
+  class CachedFile;
+
+  Impl(std::shared_ptr<FileSystem> cache_fs, const CachingFileSystemOptions& options)
+      : cache_fs_(std::move(cache_fs)), options_(options) {}
+
+  Status Init() {
+    if (options_.block_size <= 0) {
+      return Status::Invalid("Cache block size must be strictly positive");
+    }
+    // Blocks left by a previous instance can't be validated
+    return cache_fs_->DeleteDirContents("");
+  }
+
+  const CachingFileSystemOptions& options() const { return options_; }
+
+  CacheStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  // Return the id of the cached version of a file, dropping the blocks of
+  // any previous version that doesn't match the given stats
+  Result<int64_t> Validate(const FileStats& st) {
+    std::vector<std::string> dropped;
+    int64_t id;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = files_.find(st.path());
+      if (it != files_.end()) {
+        if (it->second.size == st.size() && it->second.mtime == st.mtime()) {
+          return it->second.id;
+        }
+        DropFileLocked(it->second, &dropped);
+        ++stats_.invalidations;
+      }
+      id = next_id_++;
+      files_[st.path()] = FileEntry{id, st.size(), st.mtime()};
+    }
+    RETURN_NOT_OK(DeleteBlocks(dropped));
+    return id;
+  }
+
+  // Drop the cached blocks of a path and any path below it
+  Status Invalidate(const std::string& path) {
+    std::vector<std::string> dropped;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = files_.lower_bound(path);
+      while (it != files_.end() && IsSameOrBelow(path, it->first)) {
+        DropFileLocked(it->second, &dropped);
+        it = files_.erase(it);
+      }
+    }
+    return DeleteBlocks(dropped);
+  }
+
+  // Copy the [offset, offset + nbytes) range of a cached block into `out`.
+  // Return false if the block is not cached.
+  Result<bool> ReadCached(int64_t file_id, int64_t index, int64_t offset,
+                          int64_t nbytes, uint8_t* out) {
+    const auto name = BlockName(file_id, index);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = blocks_.find(name);
+      if (it == blocks_.end()) {
+        return false;
+      }
+      lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    }
+    // The block may be evicted concurrently, in which case it is fetched again
+    auto maybe_file = cache_fs_->OpenInputFile(name);
+    if (!maybe_file.ok()) {
+      return false;
+    }
+    auto file = std::move(maybe_file).ValueOrDie();
+    auto maybe_read = file->ReadAt(offset, nbytes, out);
+    ARROW_UNUSED(file->Close());
+    if (!maybe_read.ok() || *maybe_read != nbytes) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.hits;
+    stats_.bytes_from_cache += nbytes;
+    return true;
+  }
+
+  // Fetch a block from the base filesystem and add it to the cache
+  Result<std::shared_ptr<Buffer>> FetchBlock(io::RandomAccessFile* base_file,
+                                             const std::string& path, int64_t file_id,
+                                             int64_t file_size, int64_t index) {
+    const int64_t offset = index * options_.block_size;
+    const int64_t nbytes = std::min(options_.block_size, file_size - offset);
+    ARROW_ASSIGN_OR_RAISE(auto block, base_file->ReadAt(offset, nbytes));
+    if (block->size() != nbytes) {
+      return Status::IOError("Cached file '", path, "' was truncated while reading");
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++stats_.misses;
+      stats_.bytes_fetched += nbytes;
+    }
+    RETURN_NOT_OK(Insert(path, file_id, index, *block));
+    return block;
+  }
+
+ protected:
+  struct FileEntry {
+    int64_t id;
+    int64_t size;
+    TimePoint mtime;
+  };
+
+  struct BlockEntry {
+    std::list<std::string>::iterator lru_position;
+    int64_t size;
+  };
+
+  static std::string BlockName(int64_t file_id, int64_t index) {
+    return std::to_string(file_id) + "_" + std::to_string(index);
+  }
+
+  static bool IsSameOrBelow(const std::string& dir, const std::string& path) {
+    if (dir.empty()) {
+      return true;
+    }
+    if (path.compare(0, dir.size(), dir) != 0) {
+      return false;
+    }
+    return path.size() == dir.size() || path[dir.size()] == '/';
+  }
+
+  Status Insert(const std::string& path, int64_t file_id, int64_t index,
+                const Buffer& block) {
+    const auto name = BlockName(file_id, index);
+    std::string temp_name;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      temp_name = "tmp_" + std::to_string(next_temp_id_++);
+    }
+    // Write under a temporary name, so that readers never see a partial block
+    ARROW_ASSIGN_OR_RAISE(auto out, cache_fs_->OpenOutputStream(temp_name));
+    RETURN_NOT_OK(out->Write(block.data(), block.size()));
+    RETURN_NOT_OK(out->Close());
+    RETURN_NOT_OK(cache_fs_->Move(temp_name, name));
+
+    std::vector<std::string> dropped;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto file_it = files_.find(path);
+      if (file_it == files_.end() || file_it->second.id != file_id) {
+        // The file was invalidated while the block was fetched
+        dropped.push_back(name);
+      } else if (blocks_.find(name) == blocks_.end()) {
+        lru_.push_front(name);
+        blocks_[name] = BlockEntry{lru_.begin(), block.size()};
+        stats_.cached_bytes += block.size();
+        while (stats_.cached_bytes > options_.capacity) {
+          auto block_it = blocks_.find(lru_.back());
+          DCHECK(block_it != blocks_.end());
+          stats_.cached_bytes -= block_it->second.size;
+          ++stats_.evictions;
+          dropped.push_back(std::move(lru_.back()));
+          blocks_.erase(block_it);
+          lru_.pop_back();
+        }
+      }
+    }
+    return DeleteBlocks(dropped);
+  }
+
+  void DropFileLocked(const FileEntry& file, std::vector<std::string>* dropped) {
+    const int64_t num_blocks =
+        (file.size + options_.block_size - 1) / options_.block_size;
+    for (int64_t index = 0; index < num_blocks; ++index) {
+      auto name = BlockName(file.id, index);
+      auto it = blocks_.find(name);
+      if (it != blocks_.end()) {
+        stats_.cached_bytes -= it->second.size;
+        lru_.erase(it->second.lru_position);
+        blocks_.erase(it);
+        dropped->push_back(std::move(name));
+      }
+    }
+  }
+
+  Status DeleteBlocks(const std::vector<std::string>& names) {
+    for (const auto& name : names) {
+      auto st = cache_fs_->DeleteFile(name);
+      if (!st.ok()) {
+        // A block evicted and cached again concurrently may be deleted twice
+        ARROW_ASSIGN_OR_RAISE(auto stats, cache_fs_->GetTargetStats(name));
+        if (stats.type() != FileType::NonExistent) {
+          return st;
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<FileSystem> cache_fs_;
+  const CachingFileSystemOptions options_;
+
+  mutable std::mutex mutex_;
+  // Validated files by path
+  std::map<std::string, FileEntry> files_;
+  // Cached block names, most recently used first
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, BlockEntry> blocks_;
+  CacheStats stats_;
+  int64_t next_id_ = 0;
+  int64_t next_temp_id_ = 0;
+};
+
+// A file reading cached blocks and fetching missing ones from the base filesystem
+class CachingFileSystem::Impl::CachedFile : public io::RandomAccessFile {
+ public:
+  CachedFile(std::shared_ptr<Impl> impl, std::shared_ptr<FileSystem> base_fs,
+             std::string path, int64_t file_id, int64_t size)
+      : impl_(std::move(impl)),
+        base_fs_(std::move(base_fs)),
+        path_(std::move(path)),
+        file_id_(file_id),
+        size_(size) {}
+
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed stream");
+    }
+    return Status::OK();
+  }
+
+  Status CheckPosition(int64_t position, const char* action) const {
+    if (position < 0) {
+      return Status::Invalid("Cannot ", action, " from negative position");
+    }
+    if (position > size_) {
+      return Status::IOError("Cannot ", action, " past end of file");
+    }
+    return Status::OK();
+  }
+
+  // RandomAccessFile APIs
+
+  Status Close() override {
+    std::lock_guard<std::mutex> lock(base_mutex_);
+    closed_ = true;
+    if (base_file_) {
+      RETURN_NOT_OK(base_file_->Close());
+      base_file_.reset();
+    }
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return size_;
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "seek"));
+
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, size_ - position);
+    if (nbytes == 0) {
+      return 0;
+    }
+
+    const int64_t block_size = impl_->options().block_size;
+    const int64_t end = position + nbytes;
+    auto dest = reinterpret_cast<uint8_t*>(out);
+
+    std::vector<int64_t> missing;
+    for (int64_t index = position / block_size; index * block_size < end; ++index) {
+      const int64_t start = std::max(position, index * block_size);
+      const int64_t stop = std::min(end, (index + 1) * block_size);
+      ARROW_ASSIGN_OR_RAISE(bool hit,
+                            impl_->ReadCached(file_id_, index, start - index * block_size,
+                                              stop - start, dest + (start - position)));
+      if (!hit) {
+        missing.push_back(index);
+      }
+    }
+    if (missing.empty()) {
+      return nbytes;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto blocks, FetchBlocks(std::move(missing)));
+    for (const auto& block : blocks) {
+      const int64_t block_start = block.first * block_size;
+      const int64_t start = std::max(position, block_start);
+      const int64_t stop = std::min(end, block_start + block.second->size());
+      std::memcpy(dest + (start - position), block.second->data() + (start - block_start),
+                  static_cast<size_t>(stop - start));
+    }
+    return nbytes;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    // No need to allocate more than the remaining number of bytes
+    nbytes = std::min(nbytes, size_ - position);
+
+    std::shared_ptr<ResizableBuffer> buf;
+    RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buf));
+    if (nbytes > 0) {
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                            ReadAt(position, nbytes, buf->mutable_data()));
+      DCHECK_EQ(bytes_read, nbytes);
+      RETURN_NOT_OK(buf->Resize(bytes_read));
+    }
+    return buf;
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return buffer;
+  }
+
+ protected:
+  using FetchedBlock = std::pair<int64_t, std::shared_ptr<Buffer>>;
+
+  // Blocks being fetched by a ReadAt call.  Workers claim blocks in turn, so the
+  // reading thread never waits on a worker that hasn't started.
+  struct FetchState {
+    std::vector<FetchedBlock> blocks;
+    size_t next_block = 0;
+    size_t num_done = 0;
+    Status status;
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+
+  Result<std::shared_ptr<io::RandomAccessFile>> BaseFile() {
+    std::lock_guard<std::mutex> lock(base_mutex_);
+    RETURN_NOT_OK(CheckClosed());
+    if (!base_file_) {
+      ARROW_ASSIGN_OR_RAISE(base_file_, base_fs_->OpenInputFile(path_));
+    }
+    return base_file_;
+  }
+
+  Result<std::vector<FetchedBlock>> FetchBlocks(std::vector<int64_t> indices) {
+    ARROW_ASSIGN_OR_RAISE(auto base_file, BaseFile());
+
+    auto state = std::make_shared<FetchState>();
+    for (int64_t index : indices) {
+      state->blocks.emplace_back(index, nullptr);
+    }
+
+    auto impl = impl_;
+    auto path = path_;
+    auto file_id = file_id_;
+    auto size = size_;
+    auto work = [state, impl, base_file, path, file_id, size] {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      while (state->next_block < state->blocks.size()) {
+        auto& block = state->blocks[state->next_block++];
+        lock.unlock();
+        auto maybe_block =
+            impl->FetchBlock(base_file.get(), path, file_id, size, block.first);
+        lock.lock();
+        if (maybe_block.ok()) {
+          block.second = std::move(maybe_block).ValueOrDie();
+        } else {
+          state->status &= maybe_block.status();
+        }
+        ++state->num_done;
+      }
+      state->cv.notify_all();
+    };
+
+    const auto num_workers =
+        std::min<int64_t>(impl_->options().max_concurrent_fetches,
+                          static_cast<int64_t>(indices.size())) -
+        1;
+    auto pool = io::internal::GetIOThreadPool();
+    for (int64_t i = 0; i < num_workers; ++i) {
+      RETURN_NOT_OK(pool->Spawn(work));
+    }
+    work();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&] { return state->num_done == state->blocks.size(); });
+    RETURN_NOT_OK(state->status);
+    return std::move(state->blocks);
+  }
+
+  std::shared_ptr<Impl> impl_;
+  std::shared_ptr<FileSystem> base_fs_;
+  const std::string path_;
+  const int64_t file_id_;
+  const int64_t size_;
+
+  bool closed_ = false;
+  int64_t pos_ = 0;
+
+  std::mutex base_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+};
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     std::shared_ptr<FileSystem> cache_fs,
+                                     const CachingFileSystemOptions& options)
+    : base_fs_(std::move(base_fs)),
+      impl_(std::make_shared<Impl>(std::move(cache_fs), options)) {}
+
+CachingFileSystem::~CachingFileSystem() {}
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, std::shared_ptr<FileSystem> cache_fs,
+    const CachingFileSystemOptions& options) {
+  std::shared_ptr<CachingFileSystem> ptr(
+      new CachingFileSystem(std::move(base_fs), std::move(cache_fs), options));
+  RETURN_NOT_OK(ptr->impl_->Init());
+  return ptr;
+}
+
+CacheStats CachingFileSystem::stats() const { return impl_->stats(); }
+
+Result<FileStats> CachingFileSystem::GetTargetStats(const std::string& path) {
+  return base_fs_->GetTargetStats(path);
+}
+
+Result<std::vector<FileStats>> CachingFileSystem::GetTargetStats(
+    const FileSelector& selector) {
+  return base_fs_->GetTargetStats(selector);
+}
+
+Result<Iterator<FileStatsVector>> CachingFileSystem::GetTargetStatsBatches(
+    const FileSelector& selector) {
+  return base_fs_->GetTargetStatsBatches(selector);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  RETURN_NOT_OK(impl_->Invalidate(path));
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path) {
+  RETURN_NOT_OK(impl_->Invalidate(path));
+  return base_fs_->DeleteDirContents(path);
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  RETURN_NOT_OK(impl_->Invalidate(path));
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  RETURN_NOT_OK(impl_->Invalidate(src));
+  RETURN_NOT_OK(impl_->Invalidate(dest));
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  RETURN_NOT_OK(impl_->Invalidate(dest));
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  return OpenInputFile(path);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto st, base_fs_->GetTargetStats(path));
+  if (st.type() != FileType::File || st.size() == kNoSize) {
+    // Let the base filesystem report errors, or read files of unknown size directly
+    return base_fs_->OpenInputFile(path);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto file_id, impl_->Validate(st));
+  return std::make_shared<Impl::CachedFile>(impl_, base_fs_, path, file_id, st.size());
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path) {
+  RETURN_NOT_OK(impl_->Invalidate(path));
+  return base_fs_->OpenOutputStream(path);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path) {
+  RETURN_NOT_OK(impl_->Invalidate(path));
+  return base_fs_->OpenAppendStream(path);
+}
+
+}  // namespace fs
+}  // namespace arrow
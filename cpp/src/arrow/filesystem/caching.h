@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/result.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for the CachingFileSystem implementation.
+struct ARROW_EXPORT CachingFileSystemOptions {
+  /// Size of the blocks remote files are cached in
+  int64_t block_size = 4 * 1024 * 1024;
+
+  /// Upper bound on the number of bytes kept in the cache.  Least recently
+  /// used blocks are evicted once it is exceeded.
+  int64_t capacity = 1024LL * 1024 * 1024;
+
+  /// Maximum number of missing blocks fetched concurrently by a single read
+  int32_t max_concurrent_fetches = 8;
+
+  static CachingFileSystemOptions Defaults();
+};
+
+/// Cache counters, in blocks and bytes.
+struct ARROW_EXPORT CacheStats {
+  /// Blocks served from the cache
+  int64_t hits = 0;
+  /// Blocks fetched from the base filesystem
+  int64_t misses = 0;
+  /// Bytes read from cached blocks
+  int64_t bytes_from_cache = 0;
+  /// Bytes fetched from the base filesystem
+  int64_t bytes_fetched = 0;
+  /// Blocks dropped to stay within the capacity
+  int64_t evictions = 0;
+  /// Files whose cached blocks were dropped because they changed
+  int64_t invalidations = 0;
+  /// Bytes currently held by the cache
+  int64_t cached_bytes = 0;
+
+  /// Fraction of blocks served from the cache, 0 if nothing was read
+  double hit_rate() const {
+    return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / (hits + misses);
+  }
+};
+
+/// \brief A FileSystem implementation caching another filesystem's files
+///
+/// Files opened for reading are cached in fixed-size blocks on another
+/// filesystem, typically a local directory on fast storage wrapped in a
+/// SubTreeFileSystem.  Reads are served from cached blocks, and missing blocks
+/// are fetched from the base filesystem concurrently, then cached.
+///
+/// Cached blocks of a file are validated against its size and modification time
+/// when it is opened, and dropped if either changed.  Files whose size is unknown
+/// are not cached.  Writes, deletions and moves made through this filesystem drop
+/// the affected cached blocks as well.
+///
+/// The cache is not persistent: the cache directory is cleared when the
+/// CachingFileSystem is created and must not be shared with other instances.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  std::string type_name() const override { return "caching"; }
+
+  /// Return the cache counters
+  CacheStats stats() const;
+
+  using FileSystem::GetTargetStats;
+  Result<FileStats> GetTargetStats(const std::string& path) override;
+  Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<Iterator<FileStatsVector>> GetTargetStatsBatches(
+      const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path) override;
+
+  /// \brief Create a CachingFileSystem instance
+  ///
+  /// \param[in] base_fs the filesystem whose files are cached
+  /// \param[in] cache_fs the filesystem cached blocks are stored on.  Its root
+  ///            must exist and is reserved for the cache.
+  /// \param[in] options caching options
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, std::shared_ptr<FileSystem> cache_fs,
+      const CachingFileSystemOptions& options = CachingFileSystemOptions::Defaults());
+
+ protected:
+  class Impl;
+
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                    std::shared_ptr<FileSystem> cache_fs,
+                    const CachingFileSystemOptions& options);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace fs
+}  // namespace arrow
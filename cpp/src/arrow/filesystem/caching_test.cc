@@ -0,0 +1,207 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/caching.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+namespace internal {
+
+using ::arrow::internal::TemporaryDir;
+
+class CachingFSTestMixin : public ::testing::Test {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    base_fs_ = std::make_shared<MockFileSystem>(time_);
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("test-caching-fs-"));
+    cache_fs_ = std::make_shared<SubTreeFileSystem>(temp_dir_->path().ToString(),
+                                                    std::make_shared<LocalFileSystem>());
+    ASSERT_OK_AND_ASSIGN(fs_, CachingFileSystem::Make(base_fs_, cache_fs_, options()));
+  }
+
+ protected:
+  virtual CachingFileSystemOptions options() {
+    auto options = CachingFileSystemOptions::Defaults();
+    options.block_size = 16;
+    options.capacity = 64;
+    options.max_concurrent_fetches = 3;
+    return options;
+  }
+
+  int64_t NumCachedBlocks() {
+    FileSelector selector;
+    auto stats = cache_fs_->GetTargetStats(selector).ValueOrDie();
+    return static_cast<int64_t>(stats.size());
+  }
+
+  TimePoint time_;
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::shared_ptr<MockFileSystem> base_fs_;
+  std::shared_ptr<FileSystem> cache_fs_;
+  std::shared_ptr<CachingFileSystem> fs_;
+};
+
+////////////////////////////////////////////////////////////////////////////
+// Generic CachingFileSystem tests
+
+class TestCachingFSGeneric : public CachingFSTestMixin, public GenericFileSystemTest {
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return fs_; }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestCachingFSGeneric);
+
+////////////////////////////////////////////////////////////////////////////
+// Concrete CachingFileSystem tests
+
+class TestCachingFS : public CachingFSTestMixin {
+ public:
+  void AssertReadAt(io::RandomAccessFile* file, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(position, nbytes));
+    ASSERT_EQ(buffer->ToString(), expected);
+  }
+
+ protected:
+  // 100 bytes, i.e. 6 full blocks and a partial one
+  std::string data_ =
+      "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"
+      "0123456789abcdefghijklmnopqrstuvwxyzAB";
+};
+
+TEST_F(TestCachingFS, ReadThrough) {
+  CreateFile(base_fs_.get(), "AB/data", data_);
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/data"));
+  ASSERT_OK_AND_ASSIGN(auto size, file->GetSize());
+  ASSERT_EQ(size, 100);
+
+  // Spans blocks 0 to 2
+  AssertReadAt(file.get(), 10, 30, data_.substr(10, 30));
+  auto stats = fs_->stats();
+  ASSERT_EQ(stats.hits, 0);
+  ASSERT_EQ(stats.misses, 3);
+  ASSERT_EQ(stats.bytes_fetched, 48);
+  ASSERT_EQ(stats.cached_bytes, 48);
+  ASSERT_EQ(NumCachedBlocks(), 3);
+
+  // Blocks 1 and 2 are cached, block 3 is not
+  AssertReadAt(file.get(), 20, 40, data_.substr(20, 40));
+  stats = fs_->stats();
+  ASSERT_EQ(stats.hits, 2);
+  ASSERT_EQ(stats.misses, 4);
+  ASSERT_EQ(stats.bytes_from_cache, 28);
+  ASSERT_DOUBLE_EQ(stats.hit_rate(), 2.0 / 6.0);
+
+  // Another handle on the same file shares the cache
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("AB/data"));
+  ASSERT_OK_AND_ASSIGN(auto buffer, stream->Read(16));
+  ASSERT_EQ(buffer->ToString(), data_.substr(0, 16));
+  ASSERT_EQ(fs_->stats().hits, 3);
+
+  // Reads are clamped to the end of file, the last block being partial
+  AssertReadAt(file.get(), 90, 50, data_.substr(90));
+  ASSERT_EQ(fs_->stats().bytes_fetched, 84);
+
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 1));
+}
+
+TEST_F(TestCachingFS, Eviction) {
+  CreateFile(base_fs_.get(), "data", data_);
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("data"));
+
+  // The capacity holds 4 blocks.  Read them in turn to get a known LRU order.
+  for (int64_t position = 0; position < 64; position += 16) {
+    AssertReadAt(file.get(), position, 16, data_.substr(position, 16));
+  }
+  ASSERT_EQ(fs_->stats().evictions, 0);
+  AssertReadAt(file.get(), 0, 16, data_.substr(0, 16));
+  ASSERT_EQ(fs_->stats().hits, 1);
+
+  // Blocks 1 and 2 are least recently used
+  AssertReadAt(file.get(), 64, 32, data_.substr(64, 32));
+  auto stats = fs_->stats();
+  ASSERT_EQ(stats.evictions, 2);
+  ASSERT_EQ(stats.cached_bytes, 64);
+  ASSERT_EQ(NumCachedBlocks(), 4);
+
+  AssertReadAt(file.get(), 0, 16, data_.substr(0, 16));
+  ASSERT_EQ(fs_->stats().hits, 2);
+  AssertReadAt(file.get(), 16, 16, data_.substr(16, 16));
+  ASSERT_EQ(fs_->stats().hits, 2);
+}
+
+TEST_F(TestCachingFS, Validation) {
+  CreateFile(base_fs_.get(), "data", data_);
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("data"));
+  AssertReadAt(file.get(), 0, 32, data_.substr(0, 32));
+
+  // Unchanged file
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("data"));
+  AssertReadAt(file.get(), 0, 32, data_.substr(0, 32));
+  ASSERT_EQ(fs_->stats().hits, 2);
+  ASSERT_EQ(fs_->stats().invalidations, 0);
+
+  // Changed behind the cache's back
+  CreateFile(base_fs_.get(), "data", "other contents");
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("data"));
+  AssertReadAt(file.get(), 0, 32, "other contents");
+  auto stats = fs_->stats();
+  ASSERT_EQ(stats.hits, 2);
+  ASSERT_EQ(stats.invalidations, 1);
+  ASSERT_EQ(stats.cached_bytes, 14);
+  ASSERT_EQ(NumCachedBlocks(), 1);
+
+  // Changed through the cache
+  CreateFile(fs_.get(), "data", data_);
+  ASSERT_EQ(fs_->stats().cached_bytes, 0);
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("data"));
+  AssertReadAt(file.get(), 0, 16, data_.substr(0, 16));
+
+  ASSERT_OK(fs_->DeleteDirContents(""));
+  ASSERT_EQ(fs_->stats().cached_bytes, 0);
+  ASSERT_EQ(NumCachedBlocks(), 0);
+}
+
+TEST_F(TestCachingFS, Errors) {
+  ASSERT_OK(base_fs_->CreateDir("AB"));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("AB"));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("CD"));
+
+  auto options = CachingFileSystemOptions::Defaults();
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, cache_fs_, options));
+}
+
+}  // namespace internal
+}  // namespace fs
+}  // namespace arrow
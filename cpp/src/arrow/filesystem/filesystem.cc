@@ -29,6 +29,7 @@
 #include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/util_internal.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/slow.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -125,6 +126,16 @@ Result<std::vector<FileStats>> FileSystem::GetTargetStats(
   return res;
 }
 
+Result<Iterator<FileStatsVector>> FileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
+  ARROW_ASSIGN_OR_RAISE(auto stats, GetTargetStats(select));
+  std::vector<FileStatsVector> batches;
+  if (!stats.empty()) {
+    batches.push_back(std::move(stats));
+  }
+  return MakeVectorIterator(std::move(batches));
+}
+
 Status FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
   Status st = Status::OK();
   for (const auto& path : paths) {
@@ -198,6 +209,20 @@ Result<std::vector<FileStats>> SubTreeFileSystem::GetTargetStats(
   return stats;
 }
 
+Result<Iterator<FileStatsVector>> SubTreeFileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
+  auto selector = select;
+  selector.base_dir = PrependBase(selector.base_dir);
+  ARROW_ASSIGN_OR_RAISE(auto batches, base_fs_->GetTargetStatsBatches(selector));
+  auto fix_stats = [this](FileStatsVector stats) -> Result<FileStatsVector> {
+    for (auto& st : stats) {
+      RETURN_NOT_OK(FixStats(&st));
+    }
+    return stats;
+  };
+  return MakeMaybeMapIterator(std::move(fix_stats), std::move(batches));
+}
+
 Status SubTreeFileSystem::CreateDir(const std::string& path, bool recursive) {
   auto s = path;
   RETURN_NOT_OK(PrependBaseNonEmpty(&s));
@@ -291,6 +316,12 @@ Result<std::vector<FileStats>> SlowFileSystem::GetTargetStats(
   return base_fs_->GetTargetStats(selector);
 }
 
+Result<Iterator<FileStatsVector>> SlowFileSystem::GetTargetStatsBatches(
+    const FileSelector& selector) {
+  latencies_->Sleep();
+  return base_fs_->GetTargetStatsBatches(selector);
+}
+
 Status SlowFileSystem::CreateDir(const std::string& path, bool recursive) {
   latencies_->Sleep();
   return base_fs_->CreateDir(path, recursive);
@@ -348,6 +379,80 @@ Result<std::shared_ptr<io::OutputStream>> SlowFileSystem::OpenAppendStream(
   return base_fs_->OpenAppendStream(path);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// InstrumentedFileSystem implementation
+
+InstrumentedFileSystem::InstrumentedFileSystem(std::shared_ptr<FileSystem> base_fs)
+    : InstrumentedFileSystem(std::move(base_fs),
+                             std::make_shared<io::IOStatsCollector>()) {}
+
+InstrumentedFileSystem::InstrumentedFileSystem(
+    std::shared_ptr<FileSystem> base_fs, std::shared_ptr<io::IOStatsCollector> collector)
+    : base_fs_(std::move(base_fs)), collector_(std::move(collector)) {}
+
+Result<FileStats> InstrumentedFileSystem::GetTargetStats(const std::string& path) {
+  return base_fs_->GetTargetStats(path);
+}
+
+Result<std::vector<FileStats>> InstrumentedFileSystem::GetTargetStats(
+    const FileSelector& selector) {
+  return base_fs_->GetTargetStats(selector);
+}
+
+Result<Iterator<FileStatsVector>> InstrumentedFileSystem::GetTargetStatsBatches(
+    const FileSelector& selector) {
+  return base_fs_->GetTargetStatsBatches(selector);
+}
+
+Status InstrumentedFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status InstrumentedFileSystem::DeleteDir(const std::string& path) {
+  return base_fs_->DeleteDir(path);
+}
+
+Status InstrumentedFileSystem::DeleteDirContents(const std::string& path) {
+  return base_fs_->DeleteDirContents(path);
+}
+
+Status InstrumentedFileSystem::DeleteFile(const std::string& path) {
+  return base_fs_->DeleteFile(path);
+}
+
+Status InstrumentedFileSystem::Move(const std::string& src, const std::string& dest) {
+  return base_fs_->Move(src, dest);
+}
+
+Status InstrumentedFileSystem::CopyFile(const std::string& src,
+                                        const std::string& dest) {
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> InstrumentedFileSystem::OpenInputStream(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto stream, base_fs_->OpenInputStream(path));
+  return std::make_shared<io::InstrumentedInputStream>(stream, collector_);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> InstrumentedFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(path));
+  return std::make_shared<io::InstrumentedRandomAccessFile>(file, collector_);
+}
+
+Result<std::shared_ptr<io::OutputStream>> InstrumentedFileSystem::OpenOutputStream(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto stream, base_fs_->OpenOutputStream(path));
+  return std::make_shared<io::InstrumentedOutputStream>(stream, collector_);
+}
+
+Result<std::shared_ptr<io::OutputStream>> InstrumentedFileSystem::OpenAppendStream(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto stream, base_fs_->OpenAppendStream(path));
+  return std::make_shared<io::InstrumentedOutputStream>(stream, collector_);
+}
+
 namespace {
 
 struct FileSystemUri {
@@ -27,6 +27,7 @@
 
 #include "arrow/type_fwd.h"
 #include "arrow/util/compare.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 #include "arrow/util/windows_fixup.h"
@@ -36,6 +37,7 @@ namespace arrow {
 namespace io {
 
 class InputStream;
+class IOStatsCollector;
 class LatencyGenerator;
 class OutputStream;
 class RandomAccessFile;
@@ -138,6 +140,18 @@ struct ARROW_EXPORT FileStats : public util::EqualityComparable<FileStats> {
 
 ARROW_EXPORT std::ostream& operator<<(std::ostream& os, const FileStats&);
 
+using FileStatsVector = std::vector<FileStats>;
+
+}  // namespace fs
+
+/// \brief Iteration over batches of FileStats ends with an empty batch.
+template <>
+struct IterationTraits<fs::FileStatsVector> {
+  static fs::FileStatsVector End() { return {}; }
+};
+
+namespace fs {
+
 /// \brief File selector for filesystem APIs
 struct ARROW_EXPORT FileSelector {
   /// The directory in which to select files.
@@ -177,6 +191,14 @@ class ARROW_EXPORT FileSystem {
   /// it exists.
   /// If it doesn't exist, see `FileSelector::allow_non_existent`.
   virtual Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) = 0;
+  /// Same, but yielding the stats in batches as they are listed, e.g. one batch
+  /// per directory, so that they can be processed while the listing continues.
+  ///
+  /// The batches are yielded in no particular order, and are never empty.
+  /// The filesystem must outlive the iterator. The default implementation
+  /// yields the result of GetTargetStats(select).
+  virtual Result<Iterator<FileStatsVector>> GetTargetStatsBatches(
+      const FileSelector& select);
 
   /// Create a directory and subdirectories.
   ///
@@ -256,6 +278,8 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
   /// \endcond
   Result<FileStats> GetTargetStats(const std::string& path) override;
   Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<Iterator<FileStatsVector>> GetTargetStatsBatches(
+      const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -302,6 +326,8 @@ class ARROW_EXPORT SlowFileSystem : public FileSystem {
   using FileSystem::GetTargetStats;
   Result<FileStats> GetTargetStats(const std::string& path) override;
   Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<Iterator<FileStatsVector>> GetTargetStatsBatches(
+      const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -328,6 +354,53 @@ class ARROW_EXPORT SlowFileSystem : public FileSystem {
   std::shared_ptr<io::LatencyGenerator> latencies_;
 };
 
+/// \brief A FileSystem implementation that delegates to another
+/// implementation and records I/O statistics of the files it opens.
+///
+/// All streams and files opened through this filesystem report to the same
+/// io::IOStatsCollector.
+class ARROW_EXPORT InstrumentedFileSystem : public FileSystem {
+ public:
+  explicit InstrumentedFileSystem(std::shared_ptr<FileSystem> base_fs);
+  InstrumentedFileSystem(std::shared_ptr<FileSystem> base_fs,
+                         std::shared_ptr<io::IOStatsCollector> collector);
+
+  std::string type_name() const override { return "instrumented"; }
+
+  /// \brief The collector the opened files report to
+  const std::shared_ptr<io::IOStatsCollector>& collector() const { return collector_; }
+
+  using FileSystem::GetTargetStats;
+  Result<FileStats> GetTargetStats(const std::string& path) override;
+  Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<Iterator<FileStatsVector>> GetTargetStatsBatches(
+      const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path) override;
+
+ protected:
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<io::IOStatsCollector> collector_;
+};
+
 /// \defgroup filesystem-factories Functions for creating FileSystem instances
 ///
 /// @{
@@ -0,0 +1,208 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Concurrent ReadAt() workloads against a filesystem backend.
+//
+// The backend is given by environment variables:
+// - ARROW_FILESYSTEM_BENCHMARK_URI: a URI accepted by FileSystemFromUri(),
+//   e.g. "s3://bucket/prefix" or "mock:///".  The benchmark file is written
+//   under its path and deleted on exit.  Defaults to a local temporary dir.
+// - ARROW_FILESYSTEM_BENCHMARK_LATENCY: if set, the backend is wrapped in a
+//   SlowFileSystem with this average latency, in seconds.
+//
+// Each benchmark issues reads of a given block size from a given number of
+// concurrent readers (the queue depth), and reports the aggregate bandwidth
+// as well as the median and 99th percentile latency of the reads.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace fs {
+
+using internal::GetEnvVar;
+using internal::TemporaryDir;
+
+static constexpr int64_t kFileSize = 64 * 1024 * 1024;
+static constexpr int64_t kWriteChunkSize = 1024 * 1024;
+// Bound the reads of an iteration, so that high-latency backends complete
+// in reasonable time.
+static constexpr int64_t kMaxReadsPerReader = 64;
+
+/// \brief The file read by the benchmarks, written once per process.
+class BenchmarkFile {
+ public:
+  ~BenchmarkFile() {
+    if (fs_ != nullptr && temp_dir_ == nullptr) {
+      // Best effort: don't leave the file behind on remote backends
+      ARROW_UNUSED(fs_->DeleteFile(path_));
+    }
+  }
+
+  static const BenchmarkFile& Get() {
+    static BenchmarkFile instance;
+    return instance;
+  }
+
+  std::shared_ptr<io::RandomAccessFile> Open() const {
+    ASSIGN_OR_ABORT(auto file, fs_->OpenInputFile(path_));
+    return file;
+  }
+
+ private:
+  BenchmarkFile() {
+    std::string base_dir;
+    auto maybe_uri = GetEnvVar("ARROW_FILESYSTEM_BENCHMARK_URI");
+    if (maybe_uri.ok()) {
+      ASSIGN_OR_ABORT(fs_, FileSystemFromUri(*maybe_uri, &base_dir));
+    } else {
+      ASSIGN_OR_ABORT(temp_dir_, TemporaryDir::Make("arrow-filesystem-benchmark-"));
+      base_dir = temp_dir_->path().ToString();
+      fs_ = std::make_shared<LocalFileSystem>();
+    }
+
+    auto maybe_latency = GetEnvVar("ARROW_FILESYSTEM_BENCHMARK_LATENCY");
+    if (maybe_latency.ok()) {
+      const double average_latency = std::atof(maybe_latency.ValueOrDie().c_str());
+      fs_ = std::make_shared<SlowFileSystem>(fs_, average_latency);
+    }
+
+    if (!base_dir.empty() && base_dir.back() != '/') {
+      base_dir += '/';
+    }
+    path_ = base_dir + "arrow-filesystem-benchmark.bin";
+    Write();
+  }
+
+  void Write() {
+    std::vector<uint8_t> chunk(kWriteChunkSize);
+    ASSIGN_OR_ABORT(auto stream, fs_->OpenOutputStream(path_));
+    for (int64_t offset = 0; offset < kFileSize; offset += kWriteChunkSize) {
+      random_bytes(kWriteChunkSize, static_cast<uint32_t>(offset), chunk.data());
+      ABORT_NOT_OK(stream->Write(chunk.data(), kWriteChunkSize));
+    }
+    ABORT_NOT_OK(stream->Close());
+  }
+
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::shared_ptr<FileSystem> fs_;
+  std::string path_;
+};
+
+enum class AccessPattern { SEQUENTIAL, RANDOM };
+
+static double Percentile(const std::vector<int64_t>& sorted, double p) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  const auto index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+  return static_cast<double>(sorted[index]);
+}
+
+static void ReadAtWorkload(benchmark::State& state, AccessPattern pattern) {
+  using clock = std::chrono::steady_clock;
+
+  const int64_t block_size = state.range(0);
+  const int queue_depth = static_cast<int>(state.range(1));
+  const int64_t num_blocks = kFileSize / block_size;
+  const int64_t reads_per_reader =
+      std::max<int64_t>(1, std::min(kMaxReadsPerReader, num_blocks / queue_depth));
+
+  auto file = BenchmarkFile::Get().Open();
+  // Latencies of all reads, in nanoseconds
+  std::vector<int64_t> latencies;
+
+  for (auto _ : state) {
+    std::vector<std::vector<int64_t>> reader_latencies(queue_depth);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < queue_depth; ++i) {
+      readers.emplace_back([&, i] {
+        // Sequential readers scan disjoint regions of the file, random readers
+        // pick blocks anywhere.
+        const int64_t first_block = i * num_blocks / queue_depth;
+        std::default_random_engine rng(static_cast<uint32_t>(i));
+        std::uniform_int_distribution<int64_t> random_block(0, num_blocks - 1);
+        auto& out = reader_latencies[i];
+        out.reserve(reads_per_reader);
+        for (int64_t j = 0; j < reads_per_reader; ++j) {
+          const int64_t block = pattern == AccessPattern::SEQUENTIAL
+                                    ? (first_block + j) % num_blocks
+                                    : random_block(rng);
+          const auto start = clock::now();
+          ABORT_NOT_OK(file->ReadAt(block * block_size, block_size));
+          const auto end = clock::now();
+          out.push_back(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        }
+      });
+    }
+    for (auto& reader : readers) {
+      reader.join();
+    }
+    for (const auto& reader_latency : reader_latencies) {
+      latencies.insert(latencies.end(), reader_latency.begin(), reader_latency.end());
+    }
+  }
+  ABORT_NOT_OK(file->Close());
+
+  state.SetBytesProcessed(state.iterations() * queue_depth * reads_per_reader *
+                          block_size);
+  std::sort(latencies.begin(), latencies.end());
+  state.counters["p50_us"] = Percentile(latencies, 0.5) / 1000;
+  state.counters["p99_us"] = Percentile(latencies, 0.99) / 1000;
+}
+
+static void SequentialReadAt(benchmark::State& state) {
+  ReadAtWorkload(state, AccessPattern::SEQUENTIAL);
+}
+
+static void RandomReadAt(benchmark::State& state) {
+  ReadAtWorkload(state, AccessPattern::RANDOM);
+}
+
+static void ReadAtArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"block_size", "queue_depth"});
+  for (int64_t block_size : {4 * 1024, 64 * 1024, 1024 * 1024, 8 * 1024 * 1024}) {
+    for (int64_t queue_depth : {1, 4, 16, 64}) {
+      bench->Args({block_size, queue_depth});
+    }
+  }
+}
+
+BENCHMARK(SequentialReadAt)->Apply(ReadAtArgs)->UseRealTime();
+BENCHMARK(RandomReadAt)->Apply(ReadAtArgs)->UseRealTime();
+
+}  // namespace fs
+}  // namespace arrow
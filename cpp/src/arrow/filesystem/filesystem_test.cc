@@ -26,6 +26,7 @@
 #include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -748,6 +749,51 @@ class TestSlowFSGeneric : public ::testing::Test, public GenericFileSystemTest {
 
 GENERIC_FS_TEST_FUNCTIONS(TestSlowFSGeneric);
 
+////////////////////////////////////////////////////////////////////////////
+// InstrumentedFileSystem tests
+
+class TestInstrumentedFSGeneric : public ::testing::Test, public GenericFileSystemTest {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    instrumented_fs_ = std::make_shared<InstrumentedFileSystem>(fs_);
+  }
+
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return instrumented_fs_; }
+
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> fs_;
+  std::shared_ptr<InstrumentedFileSystem> instrumented_fs_;
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestInstrumentedFSGeneric);
+
+TEST_F(TestInstrumentedFSGeneric, Stats) {
+  ASSERT_OK_AND_ASSIGN(auto out, instrumented_fs_->OpenOutputStream("ab"));
+  ASSERT_OK(out->Write("some data", 9));
+  ASSERT_OK(out->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto file, instrumented_fs_->OpenInputFile("ab"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(5, 4));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 4));
+  ASSERT_OK(file->Close());
+  ASSERT_OK_AND_ASSIGN(auto stream, instrumented_fs_->OpenInputStream("ab"));
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(9));
+  ASSERT_OK(stream->Close());
+
+  auto stats = instrumented_fs_->collector()->stats();
+  ASSERT_EQ(stats.write.calls, 1);
+  ASSERT_EQ(stats.write.bytes, 9);
+  ASSERT_EQ(stats.read_at.calls, 2);
+  ASSERT_EQ(stats.read_at.bytes, 8);
+  ASSERT_EQ(stats.read.calls, 1);
+  ASSERT_EQ(stats.read.bytes, 9);
+  ASSERT_EQ(stats.sequential_reads, 1);
+  ASSERT_EQ(stats.random_reads, 2);
+}
+
 }  // namespace internal
 }  // namespace fs
 }  // namespace arrow
@@ -22,6 +22,7 @@
 
 #include "arrow/filesystem/hdfs.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/filesystem/util_internal.h"
 #include "arrow/io/hdfs.h"
 #include "arrow/io/hdfs_internal.h"
 #include "arrow/util/logging.h"
@@ -81,20 +82,20 @@ class HadoopFileSystem::Impl {
     return st;
   }
 
-  Status StatSelector(const std::string& wd, const std::string& path,
-                      const FileSelector& select, int nesting_depth,
-                      std::vector<FileStats>* out) {
+  Result<FileStatsVector> StatDirectory(const std::string& wd, const std::string& path,
+                                        const FileSelector& select) {
     std::vector<io::HdfsPathInfo> children;
     Status st = client_->ListDirectory(path, &children);
     if (!st.ok()) {
       if (select.allow_non_existent) {
         ARROW_ASSIGN_OR_RAISE(auto stat, GetTargetStats(path));
         if (stat.type() == FileType::NonExistent) {
-          return Status::OK();
+          return FileStatsVector{};
         }
       }
       return st;
     }
+    FileStatsVector out;
     for (const auto& child_info : children) {
       // HDFS returns an absolute URI here, need to extract path relative to wd
       Uri uri;
@@ -107,18 +108,13 @@ class HadoopFileSystem::Impl {
       FileStats stat;
       stat.set_path(child_path);
       PathInfoToFileStats(child_info, &stat);
-      const bool is_dir = stat.type() == FileType::Directory;
-      out->push_back(std::move(stat));
-      if (is_dir && select.recursive && nesting_depth < select.max_recursion) {
-        RETURN_NOT_OK(StatSelector(wd, child_path, select, nesting_depth + 1, out));
-      }
+      out.push_back(std::move(stat));
     }
-    return Status::OK();
+    return out;
   }
 
-  Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) {
-    std::vector<FileStats> results;
-
+  Result<Iterator<std::shared_ptr<internal::DirectoryListing>>> WalkSelector(
+      const FileSelector& select) {
     std::string wd;
     if (select.base_dir.empty() || select.base_dir.front() != '/') {
       // Fetch working directory, because we need to trim it from the start
@@ -135,8 +131,22 @@ class HadoopFileSystem::Impl {
           "GetTargetStates expects base_dir of selector to be a directory, while '",
           select.base_dir, "' is a file");
     }
-    RETURN_NOT_OK(StatSelector(wd, select.base_dir, select, 0, &results));
-    return results;
+
+    auto list_dir = [this, wd, select](const std::string& path, int32_t) {
+      return StatDirectory(wd, path, select);
+    };
+    return internal::WalkConcurrently(std::move(list_dir), select,
+                                      options_.max_concurrent_listings);
+  }
+
+  Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) {
+    ARROW_ASSIGN_OR_RAISE(auto listings, WalkSelector(select));
+    return internal::CollectDepthFirst(std::move(listings), select.base_dir);
+  }
+
+  Result<Iterator<FileStatsVector>> GetTargetStatsBatches(const FileSelector& select) {
+    ARROW_ASSIGN_OR_RAISE(auto listings, WalkSelector(select));
+    return internal::ListingEntries(std::move(listings));
   }
 
   Status CreateDir(const std::string& path, bool recursive) {
@@ -282,6 +292,10 @@ void HdfsOptions::ConfigureHdfsBlockSize(int64_t default_block_size) {
   this->default_block_size = default_block_size;
 }
 
+void HdfsOptions::ConfigureHdfsZeroCopyReads(bool zero_copy_reads) {
+  connection_config.zero_copy_reads = zero_copy_reads;
+}
+
 Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
   HdfsOptions options;
 
@@ -341,6 +355,20 @@ Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
     const auto& v = it->second;
     options.ConfigureHdfsUser(v);
   }
+  it = options_map.find("zero_copy_reads");
+  if (it != options_map.end()) {
+    const auto& v = it->second;
+    if (v == "1") {
+      options.ConfigureHdfsZeroCopyReads(true);
+    } else if (v == "0") {
+      options.ConfigureHdfsZeroCopyReads(false);
+    } else {
+      return Status::Invalid(
+          "Invalid value for option 'zero_copy_reads' (allowed values are '0' and "
+          "'1'): '",
+          v, "'");
+    }
+  }
   return options;
 }
 
@@ -371,6 +399,11 @@ Result<std::vector<FileStats>> HadoopFileSystem::GetTargetStats(
   return impl_->GetTargetStats(select);
 }
 
+Result<Iterator<FileStatsVector>> HadoopFileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
+  return impl_->GetTargetStatsBatches(select);
+}
+
 Status HadoopFileSystem::CreateDir(const std::string& path, bool recursive) {
   return impl_->CreateDir(path, recursive);
 }
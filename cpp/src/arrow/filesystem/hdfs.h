@@ -41,6 +41,10 @@ struct ARROW_EXPORT HdfsOptions {
   int16_t replication = 3;
   int64_t default_block_size = 0;
 
+  /// Maximum number of directories listed at a time by a recursive
+  /// GetTargetStats(FileSelector), the additional ones on the I/O thread pool.
+  int max_concurrent_listings = 8;
+
   void ConfigureEndPoint(const std::string& host, int port);
   /// Be cautious that libhdfs3 is a unmaintained project
   void ConfigureHdfsDriver(bool use_hdfs3);
@@ -48,6 +52,8 @@ struct ARROW_EXPORT HdfsOptions {
   void ConfigureHdfsUser(const std::string& user_name);
   void ConfigureHdfsBufferSize(int32_t buffer_size);
   void ConfigureHdfsBlockSize(int64_t default_block_size);
+  /// See io::HdfsConnectionConfig::zero_copy_reads
+  void ConfigureHdfsZeroCopyReads(bool zero_copy_reads);
 
   static Result<HdfsOptions> FromUri(const ::arrow::internal::Uri& uri);
   static Result<HdfsOptions> FromUri(const std::string& uri);
@@ -68,6 +74,8 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
   /// \endcond
   Result<FileStats> GetTargetStats(const std::string& path) override;
   Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<Iterator<FileStatsVector>> GetTargetStatsBatches(
+      const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
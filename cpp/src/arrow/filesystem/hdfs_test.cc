@@ -61,6 +61,13 @@ TEST(TestHdfsOptions, FromUri) {
   ASSERT_EQ(options.connection_config.port, 9999);
   ASSERT_EQ(options.connection_config.user, "stevereich");
   ASSERT_EQ(options.connection_config.driver, HdfsDriver::LIBHDFS3);
+  ASSERT_FALSE(options.connection_config.zero_copy_reads);
+
+  ASSERT_OK(uri.Parse("hdfs://otherhost:9999/?zero_copy_reads=1"));
+  ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
+  ASSERT_TRUE(options.connection_config.zero_copy_reads);
+  ASSERT_OK(uri.Parse("hdfs://otherhost:9999/?zero_copy_reads=yes"));
+  ASSERT_RAISES(Invalid, HdfsOptions::FromUri(uri));
 
   ASSERT_OK(uri.Parse("viewfs://other-nn/mypath/myfile"));
   ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
@@ -167,32 +167,39 @@ Result<FileStats> StatFile(const std::string& path) {
 
 #endif
 
-Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
-                    int32_t nesting_depth, std::vector<FileStats>* out) {
+Result<FileStatsVector> StatDirectory(const std::string& path,
+                                      const FileSelector& select) {
+  ARROW_ASSIGN_OR_RAISE(auto dir_fn, PlatformFilename::FromString(path));
   auto result = ListDir(dir_fn);
   if (!result.ok()) {
     auto status = result.status();
     if (select.allow_non_existent && status.IsIOError()) {
       ARROW_ASSIGN_OR_RAISE(bool exists, FileExists(dir_fn));
       if (!exists) {
-        return Status::OK();
+        return FileStatsVector{};
       }
     }
     return status;
   }
 
+  FileStatsVector out;
   for (const auto& child_fn : *result) {
     PlatformFilename full_fn = dir_fn.Join(child_fn);
     ARROW_ASSIGN_OR_RAISE(FileStats st, StatFile(full_fn.ToNative()));
     if (st.type() != FileType::NonExistent) {
-      out->push_back(std::move(st));
-    }
-    if (nesting_depth < select.max_recursion && select.recursive &&
-        st.type() == FileType::Directory) {
-      RETURN_NOT_OK(StatSelector(full_fn, select, nesting_depth + 1, out));
+      out.push_back(std::move(st));
     }
   }
-  return Status::OK();
+  return out;
+}
+
+Iterator<std::shared_ptr<internal::DirectoryListing>> WalkSelector(
+    const FileSelector& select, int max_concurrent_listings) {
+  auto list_dir = [select](const std::string& path, int32_t) {
+    return StatDirectory(path, select);
+  };
+  return internal::WalkConcurrently(std::move(list_dir), select,
+                                    max_concurrent_listings);
 }
 
 }  // namespace
@@ -215,10 +222,13 @@ Result<FileStats> LocalFileSystem::GetTargetStats(const std::string& path) {
 
 Result<std::vector<FileStats>> LocalFileSystem::GetTargetStats(
     const FileSelector& select) {
-  ARROW_ASSIGN_OR_RAISE(auto fn, PlatformFilename::FromString(select.base_dir));
-  std::vector<FileStats> results;
-  RETURN_NOT_OK(StatSelector(fn, select, 0, &results));
-  return results;
+  return internal::CollectDepthFirst(
+      WalkSelector(select, options_.max_concurrent_listings), select.base_dir);
+}
+
+Result<Iterator<FileStatsVector>> LocalFileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
+  return internal::ListingEntries(WalkSelector(select, options_.max_concurrent_listings));
 }
 
 Status LocalFileSystem::CreateDir(const std::string& path, bool recursive) {
@@ -310,7 +320,9 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
   } else {
-    return io::ReadableFile::Open(path);
+    io::ReadableFileOptions file_options;
+    file_options.direct_io = options.use_direct_io;
+    return io::ReadableFile::Open(path, file_options);
   }
 }
 
@@ -32,6 +32,16 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// Whether files opened by OpenInputStream and OpenInputFile bypass the
+  /// operating system's page cache (see io::ReadableFileOptions::direct_io).
+  /// Ignored if use_mmap is true.
+  bool use_direct_io = false;
+
+  /// Maximum number of directories listed at a time by a recursive
+  /// GetTargetStats(FileSelector), the additional ones on the I/O thread pool.
+  /// Raising it mostly helps with network mounts.
+  int max_concurrent_listings = 1;
+
   /// \brief Initialize with defaults
   static LocalFileSystemOptions Defaults();
 };
@@ -55,6 +65,8 @@ class ARROW_EXPORT LocalFileSystem : public FileSystem {
   /// \endcond
   Result<FileStats> GetTargetStats(const std::string& path) override;
   Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<Iterator<FileStatsVector>> GetTargetStatsBatches(
+      const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -103,6 +103,18 @@ class TestLocalFSGenericMMap : public TestLocalFSGeneric<CommonPathFormatter> {
 
 GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericMMap);
 
+class TestLocalFSGenericConcurrentListing
+    : public TestLocalFSGeneric<CommonPathFormatter> {
+ protected:
+  LocalFileSystemOptions options() override {
+    auto options = LocalFileSystemOptions::Defaults();
+    options.max_concurrent_listings = 4;
+    return options;
+  }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericConcurrentListing);
+
 ////////////////////////////////////////////////////////////////////////////
 // Concrete LocalFileSystem tests
 
@@ -253,6 +265,46 @@ TYPED_TEST(TestLocalFS, FileMTime) {
   AssertDurationBetween(t2 - stats[1].mtime(), -kTimeSlack, kTimeSlack);
 }
 
+TYPED_TEST(TestLocalFS, ConcurrentListing) {
+  for (const std::string dir : {"a", "a/b", "a/b/c", "a/d", "e"}) {
+    ASSERT_OK(this->fs_->CreateDir(dir));
+    for (int i = 0; i < 3; ++i) {
+      CreateFile(this->fs_.get(), dir + "/f" + std::to_string(i), "");
+    }
+  }
+  FileSelector selector;
+  selector.recursive = true;
+
+  ASSERT_OK_AND_ASSIGN(auto expected, this->fs_->GetTargetStats(selector));
+  ASSERT_EQ(expected.size(), 20);
+
+  auto options = LocalFileSystemOptions::Defaults();
+  options.max_concurrent_listings = 3;
+  auto concurrent_fs = std::make_shared<SubTreeFileSystem>(
+      this->local_path_, std::make_shared<LocalFileSystem>(options));
+
+  // Recursive listing keeps the serial depth-first order
+  ASSERT_OK_AND_ASSIGN(auto actual, concurrent_fs->GetTargetStats(selector));
+  ASSERT_EQ(actual, expected);
+
+  // Batches are not ordered, but cover every entry exactly once
+  ASSERT_OK_AND_ASSIGN(auto batches, concurrent_fs->GetTargetStatsBatches(selector));
+  std::vector<FileStats> streamed;
+  for (auto maybe_batch : batches) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    ASSERT_FALSE(batch.empty());
+    streamed.insert(streamed.end(), batch.begin(), batch.end());
+  }
+  SortStats(&streamed);
+  SortStats(&expected);
+  ASSERT_EQ(streamed, expected);
+
+  // Dropping the iterator early cancels the remaining listings
+  ASSERT_OK_AND_ASSIGN(batches, concurrent_fs->GetTargetStatsBatches(selector));
+  ASSERT_OK_AND_ASSIGN(auto first, batches.Next());
+  ASSERT_FALSE(first.empty());
+}
+
 // TODO Should we test backslash paths on Windows?
 // SubTreeFileSystem isn't compatible with them.
 
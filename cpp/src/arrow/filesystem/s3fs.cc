@@ -18,8 +18,11 @@
 #include "arrow/filesystem/s3fs.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
@@ -40,6 +43,7 @@
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/utils/logging/ConsoleLogSystem.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/AbortMultipartUploadRequest.h>
@@ -64,12 +68,14 @@
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/s3_internal.h"
+#include "arrow/filesystem/util_internal.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/windows_fixup.h"
 
 namespace arrow {
@@ -94,6 +100,8 @@ using ::arrow::fs::internal::ToURLEncodedAwsString;
 
 const char* kS3DefaultRegion = "us-east-1";
 
+constexpr int S3Metrics::kNumLatencyBuckets;
+
 static const char kSep = '/';
 
 namespace {
@@ -332,7 +340,158 @@ std::string FormatRange(int64_t start, int64_t length) {
   return ss.str();
 }
 
-Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t start,
+// Counters backing S3FileSystem::metrics()
+class S3MetricsCollector {
+ public:
+  S3MetricsCollector() {
+    for (auto& count : latency_histogram_) {
+      count.store(0);
+    }
+  }
+
+  template <typename Call>
+  auto Measure(Call&& call) -> decltype(call()) {
+    const auto start = std::chrono::steady_clock::now();
+    auto outcome = call();
+    RecordRequest(start, outcome.IsSuccess());
+    return outcome;
+  }
+
+  void RecordRequest(std::chrono::steady_clock::time_point start, bool success) {
+    const int64_t latency_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count();
+    ++requests_;
+    if (!success) {
+      ++failed_requests_;
+    }
+    total_latency_us_ += latency_us;
+    int bucket = 0;
+    for (int64_t ms = latency_us / 1000;
+         ms > 0 && bucket < S3Metrics::kNumLatencyBuckets - 1; ms >>= 1) {
+      ++bucket;
+    }
+    ++latency_histogram_[bucket];
+  }
+
+  void RecordRetry() { ++retries_; }
+  void RecordBytesReceived(int64_t nbytes) { bytes_received_ += nbytes; }
+  void RecordBytesSent(int64_t nbytes) { bytes_sent_ += nbytes; }
+
+  S3Metrics Snapshot() const {
+    S3Metrics metrics;
+    metrics.requests = requests_.load();
+    metrics.failed_requests = failed_requests_.load();
+    metrics.retries = retries_.load();
+    metrics.bytes_received = bytes_received_.load();
+    metrics.bytes_sent = bytes_sent_.load();
+    metrics.total_latency_us = total_latency_us_.load();
+    for (int i = 0; i < S3Metrics::kNumLatencyBuckets; ++i) {
+      metrics.latency_histogram[i] = latency_histogram_[i].load();
+    }
+    return metrics;
+  }
+
+ protected:
+  std::atomic<int64_t> requests_{0};
+  std::atomic<int64_t> failed_requests_{0};
+  std::atomic<int64_t> retries_{0};
+  std::atomic<int64_t> bytes_received_{0};
+  std::atomic<int64_t> bytes_sent_{0};
+  std::atomic<int64_t> total_latency_us_{0};
+  std::array<std::atomic<int64_t>, S3Metrics::kNumLatencyBuckets> latency_histogram_;
+};
+
+// The AWS S3 client, recording the requests it issues in the filesystem metrics.
+// Metered operations hide the base class ones, so that calls through a S3Client
+// pointer are measured.
+class S3Client : public Aws::S3::S3Client {
+ public:
+  template <typename... Args>
+  explicit S3Client(std::shared_ptr<S3MetricsCollector> metrics, Args&&... args)
+      : Aws::S3::S3Client(std::forward<Args>(args)...), metrics(std::move(metrics)) {}
+
+#define METERED_OPERATION(NAME)                                                  \
+  template <typename... Args>                                                    \
+  auto NAME(Args&&... args) const -> decltype(                                 \
+      std::declval<const Aws::S3::S3Client&>().NAME(std::forward<Args>(args)...)) { \
+    return metrics->Measure(                                                     \
+        [&] { return Aws::S3::S3Client::NAME(std::forward<Args>(args)...); });   \
+  }
+
+  METERED_OPERATION(AbortMultipartUpload)
+  METERED_OPERATION(CompleteMultipartUpload)
+  METERED_OPERATION(CopyObject)
+  METERED_OPERATION(CreateBucket)
+  METERED_OPERATION(CreateMultipartUpload)
+  METERED_OPERATION(DeleteBucket)
+  METERED_OPERATION(DeleteObject)
+  METERED_OPERATION(DeleteObjects)
+  METERED_OPERATION(GetObject)
+  METERED_OPERATION(HeadBucket)
+  METERED_OPERATION(HeadObject)
+  METERED_OPERATION(ListBuckets)
+  METERED_OPERATION(ListObjectsV2)
+  METERED_OPERATION(PutObject)
+  METERED_OPERATION(UploadPart)
+
+#undef METERED_OPERATION
+
+  std::shared_ptr<S3MetricsCollector> metrics;
+};
+
+// Counts the bytes transferred by the AWS HTTP client, without limiting its rate
+class ByteCountingRateLimiter : public Aws::Utils::RateLimits::RateLimiterInterface {
+ public:
+  ByteCountingRateLimiter(std::shared_ptr<S3MetricsCollector> metrics, bool sent)
+      : metrics_(std::move(metrics)), sent_(sent) {}
+
+  DelayType ApplyCost(int64_t cost) override {
+    if (sent_) {
+      metrics_->RecordBytesSent(cost);
+    } else {
+      metrics_->RecordBytesReceived(cost);
+    }
+    return DelayType(0);
+  }
+
+  void ApplyAndPayForCost(int64_t cost) override { ApplyCost(cost); }
+
+  void SetRate(int64_t rate, bool reset_accumulator) override {}
+
+ protected:
+  std::shared_ptr<S3MetricsCollector> metrics_;
+  const bool sent_;
+};
+
+// Delegates to another retry strategy, counting the retries
+class MeteredRetryStrategy : public Aws::Client::RetryStrategy {
+ public:
+  MeteredRetryStrategy(std::shared_ptr<Aws::Client::RetryStrategy> base,
+                       std::shared_ptr<S3MetricsCollector> metrics)
+      : base_(std::move(base)), metrics_(std::move(metrics)) {}
+
+  bool ShouldRetry(const Aws::Client::AWSError<Aws::Client::CoreErrors>& error,
+                   long attempted_retries) const override {  // NOLINT
+    if (!base_->ShouldRetry(error, attempted_retries)) {
+      return false;
+    }
+    metrics_->RecordRetry();
+    return true;
+  }
+
+  long CalculateDelayBeforeNextRetry(  // NOLINT
+      const Aws::Client::AWSError<Aws::Client::CoreErrors>& error,
+      long attempted_retries) const override {  // NOLINT
+    return base_->CalculateDelayBeforeNextRetry(error, attempted_retries);
+  }
+
+ protected:
+  std::shared_ptr<Aws::Client::RetryStrategy> base_;
+  std::shared_ptr<S3MetricsCollector> metrics_;
+};
+
+Status GetObjectRange(S3Client* client, const S3Path& path, int64_t start,
                       int64_t length, S3Model::GetObjectResult* out) {
   S3Model::GetObjectRequest req;
   req.SetBucket(ToAwsString(path.bucket));
@@ -342,11 +501,117 @@ Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t sta
   return Status::OK();
 }
 
+// Bytes prefetched by all input files of a filesystem, bounded by
+// S3Options::readahead_memory_limit
+class ReadaheadBudget {
+ public:
+  explicit ReadaheadBudget(int64_t limit) : limit_(limit) {}
+
+  bool Acquire(int64_t nbytes) {
+    int64_t used = used_.load();
+    do {
+      if (used + nbytes > limit_) {
+        return false;
+      }
+    } while (!used_.compare_exchange_weak(used, used + nbytes));
+    return true;
+  }
+
+  void Release(int64_t nbytes) { used_ -= nbytes; }
+
+ protected:
+  const int64_t limit_;
+  std::atomic<int64_t> used_{0};
+};
+
+Result<int64_t> ReadObjectRange(S3Client* client, const S3Path& path,
+                                int64_t position, int64_t nbytes, void* out) {
+  S3Model::GetObjectResult result;
+  RETURN_NOT_OK(GetObjectRange(client, path, position, nbytes, &result));
+
+  auto& stream = result.GetBody();
+  stream.read(reinterpret_cast<char*>(out), nbytes);
+  // NOTE: the stream is a stringstream by default, there is no actual error
+  // to check for.  However, stream.fail() may return true if EOF is reached.
+  return stream.gcount();
+}
+
+// A range prefetched ahead of a sequential reader.  The range is fetched by
+// whoever comes first of the I/O thread pool task and the reader, so that the
+// reader never waits on a task that hasn't started.
+class PrefetchedRange {
+ public:
+  PrefetchedRange(int64_t offset, int64_t nbytes) : offset_(offset), nbytes_(nbytes) {}
+
+  int64_t offset() const { return offset_; }
+  int64_t nbytes() const { return nbytes_; }
+  int64_t end() const { return offset_ + nbytes_; }
+
+  void Fetch(S3Client* client, const S3Path& path) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (started_) {
+        return;
+      }
+      started_ = true;
+    }
+    std::shared_ptr<ResizableBuffer> buf;
+    Status st = AllocateResizableBuffer(nbytes_, &buf);
+    if (st.ok()) {
+      auto maybe_read =
+          ReadObjectRange(client, path, offset_, nbytes_, buf->mutable_data());
+      st = maybe_read.status();
+      if (st.ok()) {
+        st = buf->Resize(*maybe_read);
+      }
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    status_ = std::move(st);
+    buffer_ = std::move(buf);
+    done_ = true;
+    cv_.notify_all();
+  }
+
+  Result<std::shared_ptr<Buffer>> Wait(S3Client* client, const S3Path& path) {
+    Fetch(client, path);
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return done_; });
+    RETURN_NOT_OK(status_);
+    return buffer_;
+  }
+
+  // Make a pending pool task a no-op
+  void Cancel() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    started_ = true;
+  }
+
+ protected:
+  const int64_t offset_;
+  const int64_t nbytes_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool started_ = false;
+  bool done_ = false;
+  Status status_;
+  std::shared_ptr<Buffer> buffer_;
+};
+
 // A RandomAccessFile that reads from a S3 object
+//
+// Sequential reads trigger readahead: ranges following the last read are
+// prefetched on the I/O thread pool, with a window growing on every further
+// sequential read.  Any other read discards the prefetched ranges.
 class ObjectInputFile : public io::RandomAccessFile {
  public:
-  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path)
-      : client_(client), path_(path) {}
+  ObjectInputFile(S3Client* client, const S3Path& path,
+                  const S3Options& options, std::shared_ptr<ReadaheadBudget> budget)
+      : client_(client), path_(path), options_(options), budget_(std::move(budget)) {}
+
+  ~ObjectInputFile() override {
+    std::unique_lock<std::mutex> lock(readahead_mutex_);
+    DiscardPrefetches();
+  }
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -391,6 +656,8 @@ class ObjectInputFile : public io::RandomAccessFile {
   // RandomAccessFile APIs
 
   Status Close() override {
+    std::unique_lock<std::mutex> lock(readahead_mutex_);
+    DiscardPrefetches();
     closed_ = true;
     return Status::OK();
   }
@@ -423,16 +690,58 @@ class ObjectInputFile : public io::RandomAccessFile {
     if (nbytes == 0) {
       return 0;
     }
+    if (options_.readahead_initial_size <= 0) {
+      return ReadObjectRange(client_, path_, position, nbytes, out);
+    }
 
-    // Read the desired range of bytes
-    S3Model::GetObjectResult result;
-    RETURN_NOT_OK(GetObjectRange(client_, path_, position, nbytes, &result));
-
-    auto& stream = result.GetBody();
-    stream.read(reinterpret_cast<char*>(out), nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    return stream.gcount();
+    std::unique_lock<std::mutex> lock(readahead_mutex_);
+    if (position != sequential_end_) {
+      // Random access, read the desired range of bytes directly
+      DiscardPrefetches();
+      sequential_reads_ = 0;
+      readahead_window_ = 0;
+      sequential_end_ = position + nbytes;
+      lock.unlock();
+      return ReadObjectRange(client_, path_, position, nbytes, out);
+    }
+    ++sequential_reads_;
+    sequential_end_ = position + nbytes;
+
+    // Serve the read from the prefetched ranges, which follow each other
+    // from `position` onwards
+    auto dest = reinterpret_cast<uint8_t*>(out);
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes && !prefetches_.empty()) {
+      auto range = prefetches_.front();
+      const int64_t offset = position + bytes_read;
+      DCHECK_LE(range->offset(), offset);
+      auto maybe_buffer = range->Wait(client_, path_);
+      if (!maybe_buffer.ok()) {
+        DiscardPrefetches();
+        return maybe_buffer.status();
+      }
+      const auto& buffer = *maybe_buffer;
+      const int64_t available = range->offset() + buffer->size() - offset;
+      const int64_t n = std::min(nbytes - bytes_read, std::max<int64_t>(available, 0));
+      memcpy(dest + bytes_read, buffer->data() + (offset - range->offset()), n);
+      bytes_read += n;
+      if (offset + n < range->end()) {
+        break;
+      }
+      budget_->Release(range->nbytes());
+      prefetches_.pop_front();
+    }
+    if (bytes_read < nbytes) {
+      // Not prefetched, read the rest directly
+      ARROW_ASSIGN_OR_RAISE(int64_t n,
+                            ReadObjectRange(client_, path_, position + bytes_read,
+                                            nbytes - bytes_read, dest + bytes_read));
+      bytes_read += n;
+    }
+    if (sequential_reads_ >= kMinSequentialReads) {
+      RETURN_NOT_OK(Readahead());
+    }
+    return bytes_read;
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -453,6 +762,23 @@ class ObjectInputFile : public io::RandomAccessFile {
     return buf;
   }
 
+  Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes) override {
+    // Fail fast without bouncing through the I/O thread pool
+    Status st = CheckClosed();
+    if (st.ok()) {
+      st = CheckPosition(position, "read");
+    }
+    if (!st.ok()) {
+      return Future<std::shared_ptr<Buffer>>::MakeFinished(st);
+    }
+    nbytes = std::min(nbytes, content_length_ - position);
+    if (nbytes == 0) {
+      return Future<std::shared_ptr<Buffer>>::MakeFinished(ReadAt(position, nbytes));
+    }
+    // Each GET request is independent, so many can be in flight concurrently
+    return io::RandomAccessFile::ReadAsync(position, nbytes);
+  }
+
   Result<int64_t> Read(int64_t nbytes, void* out) override {
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
     pos_ += bytes_read;
@@ -466,13 +792,65 @@ class ObjectInputFile : public io::RandomAccessFile {
   }
 
  protected:
-  Aws::S3::S3Client* client_;
+  // Number of consecutive sequential reads before readahead kicks in
+  static constexpr int32_t kMinSequentialReads = 2;
+
+  // Grow the readahead window and prefetch ranges until it is covered.
+  // Must be called with readahead_mutex_ held.
+  Status Readahead() {
+    readahead_window_ =
+        readahead_window_ == 0
+            ? options_.readahead_initial_size
+            : std::min(readahead_window_ * 2, options_.readahead_max_size);
+    // Fetch the window in a few ranges, so that several GETs run concurrently
+    const int64_t range_size =
+        std::max(options_.readahead_initial_size, readahead_window_ / 4);
+
+    int64_t start = prefetches_.empty() ? sequential_end_ : prefetches_.back()->end();
+    auto pool = io::internal::GetIOThreadPool();
+    while (start - sequential_end_ < readahead_window_ && start < content_length_) {
+      const int64_t nbytes = std::min(range_size, content_length_ - start);
+      if (!budget_->Acquire(nbytes)) {
+        // Other files hold the memory limit, read without prefetching
+        break;
+      }
+      auto range = std::make_shared<PrefetchedRange>(start, nbytes);
+      prefetches_.push_back(range);
+      auto client = client_;
+      auto path = path_;
+      RETURN_NOT_OK(pool->Spawn([range, client, path] { range->Fetch(client, path); }));
+      start += nbytes;
+    }
+    return Status::OK();
+  }
+
+  // Must be called with readahead_mutex_ held
+  void DiscardPrefetches() {
+    for (const auto& range : prefetches_) {
+      range->Cancel();
+      budget_->Release(range->nbytes());
+    }
+    prefetches_.clear();
+  }
+
+  S3Client* client_;
   S3Path path_;
+  const S3Options& options_;
+  std::shared_ptr<ReadaheadBudget> budget_;
   bool closed_ = false;
   int64_t pos_ = 0;
   int64_t content_length_ = -1;
+
+  std::mutex readahead_mutex_;
+  std::deque<std::shared_ptr<PrefetchedRange>> prefetches_;
+  // End of the last read, where a sequential read would start
+  int64_t sequential_end_ = 0;
+  int32_t sequential_reads_ = 0;
+  int64_t readahead_window_ = 0;
 };
 
+constexpr int32_t ObjectInputFile::kMinSequentialReads;
+
 // A non-copying istream.
 // See https://stackoverflow.com/questions/35322033/aws-c-sdk-uploadpart-times-out
 // https://stackoverflow.com/questions/13059091/creating-an-input-stream-from-constant-memory
@@ -498,9 +876,12 @@ class ObjectOutputStream : public io::OutputStream {
   struct UploadState;
 
  public:
-  ObjectOutputStream(Aws::S3::S3Client* client, const S3Path& path,
+  ObjectOutputStream(S3Client* client, const S3Path& path,
                      const S3Options& options)
-      : client_(client), path_(path), options_(options) {}
+      : client_(client),
+        path_(path),
+        options_(options),
+        part_upload_threshold_(options.part_upload_size) {}
 
   ~ObjectOutputStream() override {
     // For compliance with the rest of the IO stack, Close rather than Abort,
@@ -619,7 +1000,8 @@ class ObjectOutputStream : public io::OutputStream {
 
     // With up to 10000 parts in an upload (S3 limit), a stream writing chunks
     // of exactly 5MB would be limited to 50GB total.  To avoid that, we bump
-    // the upload threshold every 100 parts.  So the pattern is:
+    // the upload threshold every 100 parts.  So the pattern is (with the
+    // default part_upload_size of 5MB):
     // - part 1 to 99: 5MB threshold
     // - part 100 to 199: 10MB threshold
     // - part 200 to 299: 15MB threshold
@@ -629,7 +1011,7 @@ class ObjectOutputStream : public io::OutputStream {
     // chunk sizes and avoiding too much buffering in the common case of a small-ish
     // stream.  If the limit's not enough, we can revisit.
     if (part_number_ % 100 == 0) {
-      part_upload_threshold_ += kMinimumPartUpload;
+      part_upload_threshold_ += options_.part_upload_size;
     }
 
     if (!current_part_ && nbytes >= part_upload_threshold_) {
@@ -703,6 +1085,14 @@ class ObjectOutputStream : public io::OutputStream {
       auto state = upload_state_;  // Keep upload state alive in closure
       auto part_number = part_number_;
 
+      // Bound the number of parts buffered in memory
+      const int64_t max_uploads = options_.max_concurrent_part_uploads;
+      upload_state_->cv.wait(lock, [&]() {
+        return upload_state_->parts_in_progress < max_uploads;
+      });
+      // Fail early if a previous part failed to upload
+      RETURN_NOT_OK(upload_state_->status);
+
       // If the data isn't owned, make an immutable copy for the lifetime of the closure
       if (owned_buffer == nullptr) {
         RETURN_NOT_OK(AllocateBuffer(nbytes, &owned_buffer));
@@ -714,21 +1104,24 @@ class ObjectOutputStream : public io::OutputStream {
       req.SetBody(
           std::make_shared<StringViewStream>(owned_buffer->data(), owned_buffer->size()));
 
+      auto metrics = client_->metrics;
+      auto start = std::chrono::steady_clock::now();
       auto handler =
-          [state, owned_buffer, part_number](
+          [state, owned_buffer, part_number, metrics, start](
               const Aws::S3::S3Client*, const S3Model::UploadPartRequest& req,
               const S3Model::UploadPartOutcome& outcome,
               const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) -> void {
+        metrics->RecordRequest(start, outcome.IsSuccess());
         std::unique_lock<std::mutex> lock(state->mutex);
         if (!outcome.IsSuccess()) {
           state->status &= UploadPartError(req, outcome);
         } else {
           AddCompletedPart(state, part_number, outcome.GetResult());
         }
-        // Notify completion, regardless of success / error status
-        if (--state->parts_in_progress == 0) {
-          state->cv.notify_all();
-        }
+        // Notify completion, regardless of success / error status.
+        // Both Flush() and writers waiting for an upload slot are interested.
+        --state->parts_in_progress;
+        state->cv.notify_all();
       };
       ++upload_state_->parts_in_progress;
       client_->UploadPartAsync(req, handler);
@@ -761,7 +1154,7 @@ class ObjectOutputStream : public io::OutputStream {
   }
 
  protected:
-  Aws::S3::S3Client* client_;
+  S3Client* client_;
   S3Path path_;
   const S3Options& options_;
   Aws::String upload_id_;
@@ -770,7 +1163,7 @@ class ObjectOutputStream : public io::OutputStream {
   int32_t part_number_ = 1;
   std::shared_ptr<io::BufferOutputStream> current_part_;
   int64_t current_part_size_ = 0;
-  int64_t part_upload_threshold_ = kMinimumPartUpload;
+  int64_t part_upload_threshold_;
 
   // This struct is kept alive through background writes to avoid problems
   // in the completion handler.
@@ -806,7 +1199,9 @@ class S3FileSystem::Impl {
   S3Options options_;
   Aws::Client::ClientConfiguration client_config_;
   Aws::Auth::AWSCredentials credentials_;
-  std::unique_ptr<Aws::S3::S3Client> client_;
+  std::shared_ptr<S3MetricsCollector> metrics_ = std::make_shared<S3MetricsCollector>();
+  std::unique_ptr<S3Client> client_;
+  std::shared_ptr<ReadaheadBudget> readahead_budget_;
 
   const int32_t kListObjectsMaxKeys = 1000;
   // At most 1000 keys per multiple-delete request
@@ -827,12 +1222,51 @@ class S3FileSystem::Impl {
     } else {
       return Status::Invalid("Invalid S3 connection scheme '", options_.scheme, "'");
     }
-    client_config_.retryStrategy = std::make_shared<ConnectRetryStrategy>();
+    if (options_.part_upload_size < kMinimumPartUpload) {
+      return Status::Invalid("S3 part upload size must be at least ", kMinimumPartUpload,
+                             " bytes, got ", options_.part_upload_size);
+    }
+    if (options_.max_concurrent_part_uploads < 1) {
+      return Status::Invalid("S3 max concurrent part uploads must be at least 1, got ",
+                             options_.max_concurrent_part_uploads);
+    }
+    if (options_.readahead_initial_size > options_.readahead_max_size) {
+      return Status::Invalid("S3 readahead initial size (",
+                             options_.readahead_initial_size,
+                             ") must not exceed the readahead max size (",
+                             options_.readahead_max_size, ")");
+    }
+    readahead_budget_ =
+        std::make_shared<ReadaheadBudget>(options_.readahead_memory_limit);
+    if (options_.max_connections < 1) {
+      return Status::Invalid("S3 max connections must be at least 1, got ",
+                             options_.max_connections);
+    }
+    client_config_.maxConnections = static_cast<unsigned>(options_.max_connections);
+    if (options_.connect_timeout > 0) {
+      client_config_.connectTimeoutMs =
+          static_cast<long>(options_.connect_timeout * 1000);  // NOLINT
+    }
+    if (options_.request_timeout > 0) {
+      client_config_.requestTimeoutMs =
+          static_cast<long>(options_.request_timeout * 1000);  // NOLINT
+    }
+    std::shared_ptr<Aws::Client::RetryStrategy> retry_strategy =
+        options_.retry_strategy;
+    if (!retry_strategy) {
+      retry_strategy = std::make_shared<ConnectRetryStrategy>();
+    }
+    client_config_.retryStrategy =
+        std::make_shared<MeteredRetryStrategy>(std::move(retry_strategy), metrics_);
+    client_config_.readRateLimiter =
+        std::make_shared<ByteCountingRateLimiter>(metrics_, /*sent=*/false);
+    client_config_.writeRateLimiter =
+        std::make_shared<ByteCountingRateLimiter>(metrics_, /*sent=*/true);
     bool use_virtual_addressing = options_.endpoint_override.empty();
     client_.reset(
-        new Aws::S3::S3Client(credentials_, client_config_,
-                              Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy::Never,
-                              use_virtual_addressing));
+        new S3Client(metrics_, credentials_, client_config_,
+                     Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy::Never,
+                     use_virtual_addressing));
     return Status::OK();
   }
 
@@ -969,23 +1403,18 @@ class S3FileSystem::Impl {
     return Status::OK();
   }
 
-  // Recursive workhorse for GetTargetStats(FileSelector...)
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, std::vector<FileStats>* out) {
-    int32_t nesting_depth = 0;
-    return Walk(select, bucket, key, nesting_depth, out);
-  }
-
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, int32_t nesting_depth,
-              std::vector<FileStats>* out) {
+  // List the objects and "directories" directly under a key, for
+  // GetTargetStats(FileSelector...)
+  Result<FileStatsVector> ListDirectory(const FileSelector& select,
+                                        const std::string& bucket,
+                                        const std::string& key, int32_t nesting_depth) {
     if (nesting_depth >= kMaxNestingDepth) {
       return Status::IOError("S3 filesystem tree exceeds maximum nesting depth (",
                              kMaxNestingDepth, ")");
     }
 
     bool is_empty = true;
-    std::vector<std::string> child_keys;
+    FileStatsVector out;
 
     auto handle_results = [&](const S3Model::ListObjectsV2Result& result) -> Status {
       // Walk "files"
@@ -1001,7 +1430,7 @@ class S3FileSystem::Impl {
         child_path << bucket << kSep << child_key;
         st.set_path(child_path.str());
         FileObjectToStats(obj, &st);
-        out->push_back(std::move(st));
+        out.push_back(std::move(st));
       }
       // Walk "directories"
       for (const auto& prefix : result.GetCommonPrefixes()) {
@@ -1013,10 +1442,7 @@ class S3FileSystem::Impl {
         FileStats st;
         st.set_path(ss.str());
         st.set_type(FileType::Directory);
-        out->push_back(std::move(st));
-        if (select.recursive) {
-          child_keys.emplace_back(child_key);
-        }
+        out.push_back(std::move(st));
       }
       return Status::OK();
     };
@@ -1033,13 +1459,6 @@ class S3FileSystem::Impl {
     RETURN_NOT_OK(
         ListObjectsV2(bucket, key, std::move(handle_results), std::move(handle_error)));
 
-    // Recurse
-    if (select.recursive && nesting_depth < select.max_recursion) {
-      for (const auto& child_key : child_keys) {
-        RETURN_NOT_OK(Walk(select, bucket, child_key, nesting_depth + 1, out));
-      }
-    }
-
     // If no contents were found, perhaps it's an empty "directory",
     // or perhaps it's a non-existent entry.  Check.
     if (is_empty && !select.allow_non_existent) {
@@ -1048,7 +1467,45 @@ class S3FileSystem::Impl {
         return PathNotFound(bucket, key);
       }
     }
-    return Status::OK();
+    return out;
+  }
+
+  // Walk the tree below select.base_dir for GetTargetStats(FileSelector...),
+  // listing up to max_concurrent_listings directories at a time
+  Iterator<std::shared_ptr<internal::DirectoryListing>> Walk(const FileSelector& select) {
+    S3Path base_path;
+    // Buckets listed at the root don't count as nesting
+    auto walk_select = select;
+    int32_t root_depth = 0;
+    if (S3Path::FromString(select.base_dir, &base_path).ok() && base_path.empty()) {
+      root_depth = -1;
+      if (walk_select.max_recursion < INT32_MAX) {
+        ++walk_select.max_recursion;
+      }
+    }
+
+    auto list_dir = [this, select, root_depth](const std::string& path,
+                                               int32_t depth) -> Result<FileStatsVector> {
+      S3Path s3_path;
+      RETURN_NOT_OK(S3Path::FromString(path, &s3_path));
+      if (!s3_path.empty()) {
+        return ListDirectory(select, s3_path.bucket, s3_path.key, root_depth + depth);
+      }
+
+      // List all buckets
+      std::vector<std::string> buckets;
+      RETURN_NOT_OK(ListBuckets(&buckets));
+      FileStatsVector out;
+      for (const auto& bucket : buckets) {
+        FileStats st;
+        st.set_path(bucket);
+        st.set_type(FileType::Directory);
+        out.push_back(std::move(st));
+      }
+      return out;
+    };
+    return internal::WalkConcurrently(std::move(list_dir), walk_select,
+                                      options_.max_concurrent_listings);
   }
 
   Status WalkForDeleteDir(const std::string& bucket, const std::string& key,
@@ -1189,6 +1646,8 @@ Result<std::shared_ptr<S3FileSystem>> S3FileSystem::Make(const S3Options& option
   return ptr;
 }
 
+S3Metrics S3FileSystem::metrics() const { return impl_->metrics_->Snapshot(); }
+
 Result<FileStats> S3FileSystem::GetTargetStats(const std::string& s) {
   S3Path path;
   RETURN_NOT_OK(S3Path::FromString(s, &path));
@@ -1258,28 +1717,14 @@ Result<FileStats> S3FileSystem::GetTargetStats(const std::string& s) {
 Result<std::vector<FileStats>> S3FileSystem::GetTargetStats(const FileSelector& select) {
   S3Path base_path;
   RETURN_NOT_OK(S3Path::FromString(select.base_dir, &base_path));
+  return internal::CollectDepthFirst(impl_->Walk(select), select.base_dir);
+}
 
-  std::vector<FileStats> results;
-
-  if (base_path.empty()) {
-    // List all buckets
-    std::vector<std::string> buckets;
-    RETURN_NOT_OK(impl_->ListBuckets(&buckets));
-    for (const auto& bucket : buckets) {
-      FileStats st;
-      st.set_path(bucket);
-      st.set_type(FileType::Directory);
-      results.push_back(std::move(st));
-      if (select.recursive) {
-        RETURN_NOT_OK(impl_->Walk(select, bucket, "", &results));
-      }
-    }
-    return results;
-  }
-
-  // Nominal case -> walk a single bucket
-  RETURN_NOT_OK(impl_->Walk(select, base_path.bucket, base_path.key, &results));
-  return results;
+Result<Iterator<FileStatsVector>> S3FileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
+  S3Path base_path;
+  RETURN_NOT_OK(S3Path::FromString(select.base_dir, &base_path));
+  return internal::ListingEntries(impl_->Walk(select));
 }
 
 Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
@@ -1425,7 +1870,8 @@ Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
+  auto ptr = std::make_shared<ObjectInputFile>(
+      impl_->client_.get(), path, impl_->options_, impl_->readahead_budget_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
@@ -1436,7 +1882,8 @@ Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
+  auto ptr = std::make_shared<ObjectInputFile>(
+      impl_->client_.get(), path, impl_->options_, impl_->readahead_budget_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -31,6 +33,11 @@ namespace Auth {
 class AWSCredentialsProvider;
 
 }  // namespace Auth
+namespace Client {
+
+class RetryStrategy;
+
+}  // namespace Client
 }  // namespace Aws
 
 namespace arrow {
@@ -52,9 +59,58 @@ struct ARROW_EXPORT S3Options {
   /// AWS credentials provider
   std::shared_ptr<Aws::Auth::AWSCredentialsProvider> credentials_provider;
 
+  /// Maximum number of HTTP connections opened by the client at once
+  int max_connections = 25;
+  /// Socket connect timeout in seconds, or -1 for the AWS SDK default
+  double connect_timeout = -1;
+  /// Socket read timeout in seconds, or -1 for the AWS SDK default
+  double request_timeout = -1;
+  /// \brief Strategy for retrying failed requests
+  ///
+  /// If null, connection errors are retried for a few seconds and other errors
+  /// are not retried.
+  std::shared_ptr<Aws::Client::RetryStrategy> retry_strategy;
+
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// \brief Size in bytes of the parts uploaded by OutputStream writes
+  ///
+  /// Must be at least 5 MiB (the S3 minimum part size).  Every 100 parts,
+  /// the part size is increased by this amount so as to stay within the
+  /// S3 limit of 10000 parts per object.
+  int64_t part_upload_size = 5 * 1024 * 1024;
+
+  /// \brief Maximum number of part uploads in flight per OutputStream
+  ///
+  /// Only used with background writes.  Writes block once this many parts
+  /// are being uploaded, which bounds the memory used for buffered parts to
+  /// about `max_concurrent_part_uploads * part_upload_size`.
+  int max_concurrent_part_uploads = 8;
+
+  /// \brief Maximum number of directories listed at a time by a recursive
+  /// GetTargetStats(FileSelector)
+  ///
+  /// Every listed "directory" spawns the listing of its children, the
+  /// additional listings running on the I/O thread pool.
+  int max_concurrent_listings = 16;
+
+  /// \brief Initial size in bytes of the readahead window of input files
+  ///
+  /// After two consecutive sequential reads, the bytes following the last read
+  /// are prefetched on the I/O thread pool.  The window doubles on every further
+  /// sequential read, up to `readahead_max_size`, and any other read resets it.
+  /// 0 disables readahead.
+  int64_t readahead_initial_size = 1024 * 1024;
+
+  /// Maximum size in bytes of the readahead window of an input file
+  int64_t readahead_max_size = 32 * 1024 * 1024;
+
+  /// \brief Maximum number of bytes prefetched at once by all input files
+  ///
+  /// Reads proceed without readahead once the limit is reached.
+  int64_t readahead_memory_limit = 256 * 1024 * 1024;
+
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
 
@@ -76,6 +132,29 @@ struct ARROW_EXPORT S3Options {
                                    std::string* out_path = NULLPTR);
 };
 
+/// Request counters of a S3FileSystem.
+struct ARROW_EXPORT S3Metrics {
+  static constexpr int kNumLatencyBuckets = 16;
+
+  /// Requests issued, retries excluded
+  int64_t requests = 0;
+  /// Requests that failed, after any retries
+  int64_t failed_requests = 0;
+  /// Retries of failed requests
+  int64_t retries = 0;
+  /// Bytes of response bodies received, retried transfers included
+  int64_t bytes_received = 0;
+  /// Bytes of request bodies sent, retried transfers included
+  int64_t bytes_sent = 0;
+  /// Sum of the request latencies in microseconds, retries included
+  int64_t total_latency_us = 0;
+  /// \brief Histogram of the request latencies
+  ///
+  /// Bucket 0 counts requests taking less than 1 ms, and bucket i > 0 those
+  /// taking between 2^(i-1) and 2^i ms.  The last bucket has no upper bound.
+  std::array<int64_t, kNumLatencyBuckets> latency_histogram{};
+};
+
 /// S3-backed FileSystem implementation.
 ///
 /// Some implementation notes:
@@ -92,6 +171,8 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// \endcond
   Result<FileStats> GetTargetStats(const std::string& path) override;
   Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<Iterator<FileStatsVector>> GetTargetStatsBatches(
+      const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -133,6 +214,9 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// Create a S3FileSystem instance from the given options.
   static Result<std::shared_ptr<S3FileSystem>> Make(const S3Options& options);
 
+  /// Return the counters of the requests issued by this filesystem
+  S3Metrics metrics() const;
+
  protected:
   explicit S3FileSystem(const S3Options& options);
 
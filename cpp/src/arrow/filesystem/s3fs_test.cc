@@ -45,6 +45,7 @@
 #include <aws/core/Aws.h>
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/utils/logging/ConsoleLogSystem.h>
 #include <aws/s3/S3Client.h>
@@ -782,6 +783,54 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileReadahead) {
+  options_.readahead_initial_size = 16 * 1024;
+  options_.readahead_max_size = 64 * 1024;
+  MakeFileSystem();
+
+  const auto data = random_string(300 * 1024, /*seed =*/42);
+  std::shared_ptr<io::OutputStream> stream;
+  ASSERT_OK_AND_ASSIGN(stream, fs_->OpenOutputStream("bucket/readahead"));
+  ASSERT_OK(stream->Write(data));
+  ASSERT_OK(stream->Close());
+
+  auto check_reads = [&]() {
+    std::shared_ptr<io::RandomAccessFile> file;
+    std::shared_ptr<Buffer> buf;
+    ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/readahead"));
+    // Sequential reads, served from prefetched ranges after the first two
+    int64_t pos = 0;
+    for (; pos < 100 * 1024; pos += 10000) {
+      ASSERT_OK_AND_ASSIGN(buf, file->Read(10000));
+      AssertBufferEqual(*buf, data.substr(pos, 10000));
+    }
+    // A random read discards the readahead, then sequential reads resume
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(250 * 1024, 100));
+    AssertBufferEqual(*buf, data.substr(250 * 1024, 100));
+    std::string rest;
+    do {
+      ASSERT_OK_AND_ASSIGN(buf, file->Read(7000));
+      rest += buf->ToString();
+    } while (buf->size() > 0);
+    ASSERT_EQ(rest, data.substr(pos));
+    ASSERT_OK(file->Close());
+  };
+
+  check_reads();
+
+  // Readahead beyond the memory limit is skipped
+  options_.readahead_memory_limit = 20 * 1024;
+  MakeFileSystem();
+  check_reads();
+
+  options_.readahead_initial_size = 0;
+  MakeFileSystem();
+  check_reads();
+
+  options_.readahead_initial_size = 128 * 1024;
+  ASSERT_RAISES(Invalid, S3FileSystem::Make(options_));
+}
+
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
 
 TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
@@ -790,6 +839,73 @@ TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
   TestOpenOutputStream();
 }
 
+TEST_F(TestS3FS, OpenOutputStreamConcurrentPartUploads) {
+  options_.max_concurrent_part_uploads = 1;
+  MakeFileSystem();
+  TestOpenOutputStream();
+
+  options_.max_concurrent_part_uploads = 3;
+  options_.part_upload_size = 6 * 1024 * 1024;
+  MakeFileSystem();
+  TestOpenOutputStream();
+
+  // Many parts, more than the number of concurrent uploads
+  std::string expected;
+  std::shared_ptr<io::OutputStream> stream;
+  ASSERT_OK_AND_ASSIGN(stream, fs_->OpenOutputStream("bucket/newfile5"));
+  for (int i = 0; i < 8; ++i) {
+    auto part = random_string(options_.part_upload_size, /*seed =*/i);
+    ASSERT_OK(stream->Write(part));
+    expected += part;
+  }
+  ASSERT_OK(stream->Close());
+  AssertObjectContents(client_.get(), "bucket", "newfile5", expected);
+}
+
+TEST_F(TestS3FS, InvalidOutputOptions) {
+  options_.part_upload_size = 1024;
+  ASSERT_RAISES(Invalid, S3FileSystem::Make(options_));
+  options_.part_upload_size = 5 * 1024 * 1024;
+  options_.max_concurrent_part_uploads = 0;
+  ASSERT_RAISES(Invalid, S3FileSystem::Make(options_));
+}
+
+TEST_F(TestS3FS, ClientOptions) {
+  options_.max_connections = 0;
+  ASSERT_RAISES(Invalid, S3FileSystem::Make(options_));
+
+  options_.max_connections = 64;
+  options_.connect_timeout = 2.5;
+  options_.request_timeout = 10;
+  options_.retry_strategy = std::make_shared<Aws::Client::DefaultRetryStrategy>(3);
+  MakeFileSystem();
+  AssertFileStats(fs_.get(), "bucket/somefile", FileType::File, 9);
+}
+
+TEST_F(TestS3FS, Metrics) {
+  auto before = fs_->metrics();
+
+  // One HEAD request
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+  // One GET request
+  std::shared_ptr<Buffer> buf;
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 9));
+  // A failed HEAD request
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("bucket/zzzt"));
+
+  auto after = fs_->metrics();
+  ASSERT_EQ(after.requests - before.requests, 3);
+  ASSERT_EQ(after.failed_requests - before.failed_requests, 1);
+  ASSERT_GE(after.bytes_received - before.bytes_received, 9);
+  ASSERT_GT(after.total_latency_us, before.total_latency_us);
+  int64_t histogram_total = 0;
+  for (auto count : after.latency_histogram) {
+    histogram_total += count;
+  }
+  ASSERT_EQ(histogram_total, after.requests);
+}
+
 TEST_F(TestS3FS, OpenOutputStreamAbortBackgroundWrites) { TestOpenOutputStreamAbort(); }
 
 TEST_F(TestS3FS, OpenOutputStreamAbortSyncWrites) {
@@ -16,9 +16,18 @@
 // under the License.
 
 #include "arrow/filesystem/util_internal.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
 #include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace fs {
@@ -48,6 +57,206 @@ Status CopyStream(const std::shared_ptr<io::InputStream>& src,
   return Status::OK();
 }
 
+namespace {
+
+/// \brief The state of a WalkConcurrently, shared by its consumer and the
+/// listings running on the I/O thread pool.
+class ConcurrentWalk : public std::enable_shared_from_this<ConcurrentWalk> {
+ public:
+  ConcurrentWalk(ListDirectoryFn list_dir, const FileSelector& select,
+                 int max_concurrency)
+      : list_dir_(std::move(list_dir)),
+        select_(select),
+        max_concurrency_(max_concurrency) {
+    pending_.emplace_back(select_.base_dir, 0);
+  }
+
+  Result<std::shared_ptr<DirectoryListing>> Next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      RETURN_NOT_OK(status_);
+      if (!ready_.empty()) {
+        auto listing = std::move(ready_.front());
+        ready_.pop_front();
+        return listing;
+      }
+      if (!pending_.empty()) {
+        // List a directory ourselves instead of waiting for a queued listing,
+        // which may be stuck behind other work on the I/O thread pool
+        ListPending(&lock);
+        continue;
+      }
+      if (active_ == 0) {
+        return nullptr;
+      }
+      cv_.wait(lock);
+    }
+  }
+
+  /// \brief Stop listing and wait for the running listings, which may reference
+  /// the filesystem.
+  void Cancel() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    cv_.wait(lock, [this] { return active_ == 0; });
+  }
+
+ private:
+  // Called with the lock held, which is released while listing
+  void ListPending(std::unique_lock<std::mutex>* lock) {
+    auto dir = std::move(pending_.front());
+    pending_.pop_front();
+    ++active_;
+    lock->unlock();
+    auto maybe_entries = list_dir_(dir.first, dir.second);
+    lock->lock();
+    --active_;
+
+    if (!maybe_entries.ok()) {
+      status_ &= maybe_entries.status();
+    } else if (status_.ok() && !cancelled_) {
+      auto listing = std::make_shared<DirectoryListing>();
+      listing->path = std::move(dir.first);
+      listing->entries = std::move(maybe_entries).ValueOrDie();
+      if (select_.recursive && dir.second < select_.max_recursion) {
+        for (const auto& entry : listing->entries) {
+          if (entry.IsDirectory()) {
+            pending_.emplace_back(entry.path(), dir.second + 1);
+          }
+        }
+      }
+      ready_.push_back(std::move(listing));
+      SpawnListers();
+    }
+    cv_.notify_all();
+  }
+
+  // Called with the lock held. The consumer is one of the max_concurrency_
+  // listers, the others drain pending_ on the I/O thread pool.
+  void SpawnListers() {
+    while (spawned_ < max_concurrency_ - 1 &&
+           spawned_ < static_cast<int>(pending_.size())) {
+      auto self = shared_from_this();
+      auto status =
+          io::internal::GetIOThreadPool()->Spawn([self] { self->RunLister(); });
+      if (!status.ok()) {
+        // The consumer lists the pending directories
+        break;
+      }
+      ++spawned_;
+    }
+  }
+
+  void RunLister() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!pending_.empty() && status_.ok() && !cancelled_) {
+      ListPending(&lock);
+    }
+    --spawned_;
+  }
+
+  ListDirectoryFn list_dir_;
+  FileSelector select_;
+  int max_concurrency_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  // Directories to list and their nesting depth
+  std::deque<std::pair<std::string, int32_t>> pending_;
+  std::deque<std::shared_ptr<DirectoryListing>> ready_;
+  // Number of listers on the I/O thread pool, and of directories being listed
+  int spawned_ = 0;
+  int active_ = 0;
+  Status status_;
+  bool cancelled_ = false;
+};
+
+/// \brief The consumer's handle on a ConcurrentWalk, cancelling it once destroyed.
+class ConcurrentWalkIterator {
+ public:
+  explicit ConcurrentWalkIterator(std::shared_ptr<ConcurrentWalk> walk)
+      : walk_(std::move(walk)) {}
+
+  ~ConcurrentWalkIterator() {
+    if (walk_ != nullptr) {
+      walk_->Cancel();
+    }
+  }
+
+  ConcurrentWalkIterator(ConcurrentWalkIterator&&) = default;
+  ConcurrentWalkIterator& operator=(ConcurrentWalkIterator&&) = default;
+
+  Result<std::shared_ptr<DirectoryListing>> Next() { return walk_->Next(); }
+
+ private:
+  std::shared_ptr<ConcurrentWalk> walk_;
+};
+
+using ListingMap = std::unordered_map<std::string, FileStatsVector>;
+
+void AppendDepthFirst(const std::string& path, ListingMap* listings,
+                      FileStatsVector* out) {
+  auto it = listings->find(path);
+  if (it == listings->end()) {
+    return;
+  }
+  auto entries = std::move(it->second);
+  listings->erase(it);
+  for (auto& entry : entries) {
+    auto is_dir = entry.IsDirectory();
+    auto entry_path = entry.path();
+    out->push_back(std::move(entry));
+    if (is_dir) {
+      AppendDepthFirst(entry_path, listings, out);
+    }
+  }
+}
+
+}  // namespace
+
+Iterator<std::shared_ptr<DirectoryListing>> WalkConcurrently(ListDirectoryFn list_dir,
+                                                             const FileSelector& select,
+                                                             int max_concurrency) {
+  auto walk =
+      std::make_shared<ConcurrentWalk>(std::move(list_dir), select, max_concurrency);
+  return Iterator<std::shared_ptr<DirectoryListing>>(
+      ConcurrentWalkIterator(std::move(walk)));
+}
+
+Result<FileStatsVector> CollectDepthFirst(
+    Iterator<std::shared_ptr<DirectoryListing>> listings, const std::string& base_dir) {
+  ListingMap by_path;
+  for (auto maybe_listing : listings) {
+    ARROW_ASSIGN_OR_RAISE(auto listing, std::move(maybe_listing));
+    by_path.emplace(std::move(listing->path), std::move(listing->entries));
+  }
+
+  FileStatsVector out;
+  AppendDepthFirst(base_dir, &by_path, &out);
+  return out;
+}
+
+Iterator<FileStatsVector> ListingEntries(
+    Iterator<std::shared_ptr<DirectoryListing>> listings) {
+  struct {
+    Result<FileStatsVector> Next() {
+      while (true) {
+        ARROW_ASSIGN_OR_RAISE(auto listing, listings_.Next());
+        if (listing == nullptr) {
+          return FileStatsVector{};
+        }
+        if (!listing->entries.empty()) {
+          return std::move(listing->entries);
+        }
+      }
+    }
+
+    Iterator<std::shared_ptr<DirectoryListing>> listings_;
+  } entries_it{std::move(listings)};
+
+  return Iterator<FileStatsVector>(std::move(entries_it));
+}
+
 }  // namespace internal
 }  // namespace fs
 }  // namespace arrow
@@ -18,11 +18,15 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
 
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -36,6 +40,41 @@ ARROW_EXPORT
 Status CopyStream(const std::shared_ptr<io::InputStream>& src,
                   const std::shared_ptr<io::OutputStream>& dest, int64_t chunk_size);
 
+/// \brief List the entries of a single directory, given its path and its
+/// nesting depth below the base directory of a FileSelector.
+using ListDirectoryFn =
+    std::function<Result<FileStatsVector>(const std::string& path, int32_t depth)>;
+
+/// \brief The entries of a directory listed by ListDirectoryFn.
+struct DirectoryListing {
+  std::string path;
+  FileStatsVector entries;
+};
+
+/// \brief Walk the tree below select.base_dir, listing each directory with
+/// list_dir and yielding the listings as they complete.
+///
+/// Every listed directory spawns the listing of its subdirectories, as allowed
+/// by select.recursive and select.max_recursion. Up to max_concurrency
+/// directories are listed at a time: the consumer lists directories itself, and
+/// the others are listed on the I/O thread pool. list_dir must be thread safe.
+ARROW_EXPORT
+Iterator<std::shared_ptr<DirectoryListing>> WalkConcurrently(ListDirectoryFn list_dir,
+                                                             const FileSelector& select,
+                                                             int max_concurrency);
+
+/// \brief Collect the entries of the listings of WalkConcurrently, in the
+/// order of a serial depth-first walk from base_dir.
+ARROW_EXPORT
+Result<FileStatsVector> CollectDepthFirst(
+    Iterator<std::shared_ptr<DirectoryListing>> listings, const std::string& base_dir);
+
+/// \brief Yield the entries of the listings of WalkConcurrently, skipping empty
+/// directories.
+ARROW_EXPORT
+Iterator<FileStatsVector> ListingEntries(
+    Iterator<std::shared_ptr<DirectoryListing>> listings);
+
 }  // namespace internal
 }  // namespace fs
 }  // namespace arrow
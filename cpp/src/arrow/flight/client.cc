@@ -20,11 +20,19 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 
 #ifdef GRPCPP_PP_INCLUDE
@@ -40,7 +48,9 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 
 #include "arrow/flight/client_auth.h"
@@ -49,6 +59,7 @@
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/middleware_internal.h"
 #include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 namespace pb = arrow::flight::protocol;
@@ -59,10 +70,54 @@ class MemoryPool;
 
 namespace flight {
 
-FlightCallOptions::FlightCallOptions() : timeout(-1) {}
+FlightCallOptions::FlightCallOptions()
+    : timeout(-1),
+      compression(Compression::UNCOMPRESSED),
+      compression_level(util::kUseDefaultCompressionLevel),
+      put_window(0),
+      put_window_blocking(true) {}
+
+namespace {
+
+// Check that the codec in the call options can compress IPC bodies
+Status CheckCompression(const FlightCallOptions& options) {
+  if (options.compression == Compression::UNCOMPRESSED) {
+    return Status::OK();
+  }
+  if (options.compression != Compression::LZ4 &&
+      options.compression != Compression::ZSTD) {
+    return Status::Invalid("Unsupported Flight compression: ",
+                           util::Codec::GetCodecAsString(options.compression));
+  }
+  if (!util::Codec::IsAvailable(options.compression)) {
+    return Status::NotImplemented("Support for codec '",
+                                  util::Codec::GetCodecAsString(options.compression),
+                                  "' not built");
+  }
+  return Status::OK();
+}
+
+// The IPC options for the record batches written by a call
+ipc::IpcOptions GetWriteOptions(const FlightCallOptions& options) {
+  auto ipc_options = ipc::IpcOptions::Defaults();
+  ipc_options.compression = options.compression;
+  ipc_options.compression_level = options.compression_level;
+  return ipc_options;
+}
+
+}  // namespace
+
+// The context of a call, through which its interceptor finds the metrics of
+// the call
+class FlightClientContext : public grpc::ClientContext {
+ public:
+  // Only collected when there is middleware to report them to
+  std::unique_ptr<CallMetrics> metrics;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
 
 struct ClientRpc {
-  grpc::ClientContext context;
+  FlightClientContext context;
 
   explicit ClientRpc(const FlightCallOptions& options) {
     if (options.timeout.count() >= 0) {
@@ -88,6 +143,16 @@ struct ClientRpc {
     }
     return Status::OK();
   }
+
+  /// \brief Ask the server to compress the record batches it sends
+  Status RequestCompression(const FlightCallOptions& options) {
+    RETURN_NOT_OK(CheckCompression(options));
+    if (options.compression != Compression::UNCOMPRESSED) {
+      context.AddMetadata(internal::kGrpcCompressionHeader,
+                          util::Codec::GetCodecAsString(options.compression));
+    }
+    return Status::OK();
+  }
 };
 
 class GrpcAddCallHeaders : public AddCallHeaders {
@@ -106,9 +171,9 @@ class GrpcAddCallHeaders : public AddCallHeaders {
 
 class GrpcClientInterceptorAdapter : public grpc::experimental::Interceptor {
  public:
-  explicit GrpcClientInterceptorAdapter(
-      std::vector<std::unique_ptr<ClientMiddleware>> middleware)
-      : middleware_(std::move(middleware)) {}
+  GrpcClientInterceptorAdapter(std::vector<std::unique_ptr<ClientMiddleware>> middleware,
+                               FlightClientContext* context)
+      : middleware_(std::move(middleware)), context_(context) {}
 
   void Intercept(grpc::experimental::InterceptorBatchMethods* methods) {
     using InterceptionHookPoints = grpc::experimental::InterceptionHookPoints;
@@ -138,7 +203,14 @@ class GrpcClientInterceptorAdapter : public grpc::experimental::Interceptor {
       DCHECK_NE(nullptr, methods->GetRecvStatus());
       const Status status = internal::FromGrpcStatus(*methods->GetRecvStatus());
 
+      CallMetrics* metrics = context_->metrics.get();
+      if (metrics) {
+        metrics->duration_nanos = internal::ElapsedNanos(context_->start);
+      }
       for (const auto& middleware : middleware_) {
+        if (metrics) {
+          middleware->CallMetricsAvailable(*metrics);
+        }
         middleware->CallCompleted(status);
       }
     }
@@ -148,6 +220,7 @@ class GrpcClientInterceptorAdapter : public grpc::experimental::Interceptor {
 
  private:
   std::vector<std::unique_ptr<ClientMiddleware>> middleware_;
+  FlightClientContext* context_;
 };
 
 class GrpcClientInterceptorAdapterFactory
@@ -175,6 +248,8 @@ class GrpcClientInterceptorAdapterFactory
       flight_method = FlightMethod::DoGet;
     } else if (method.ends_with("/DoPut")) {
       flight_method = FlightMethod::DoPut;
+    } else if (method.ends_with("/DoExchange")) {
+      flight_method = FlightMethod::DoExchange;
     } else if (method.ends_with("/DoAction")) {
       flight_method = FlightMethod::DoAction;
     } else if (method.ends_with("/ListActions")) {
@@ -191,7 +266,12 @@ class GrpcClientInterceptorAdapterFactory
         middleware.push_back(std::move(instance));
       }
     }
-    return new GrpcClientInterceptorAdapter(std::move(middleware));
+    // All calls of the client are made with a ClientRpc
+    auto context = static_cast<FlightClientContext*>(info->client_context());
+    if (!middleware.empty()) {
+      context->metrics.reset(new CallMetrics());
+    }
+    return new GrpcClientInterceptorAdapter(std::move(middleware), context);
   }
 
  private:
@@ -242,6 +322,63 @@ class GrpcClientAuthReader : public ClientAuthReader {
       stream_;
 };
 
+// A gRPC stream along with its RPC context, shared by the objects reading
+// from and writing to the stream. The final status of the call is only
+// retrieved once, by whichever of them gets to the end of the call first.
+template <typename Stream>
+class FinishableStream {
+ public:
+  FinishableStream(std::shared_ptr<ClientRpc> rpc, std::shared_ptr<Stream> stream)
+      : rpc_(std::move(rpc)), stream_(std::move(stream)), finished_(false) {}
+
+  const std::shared_ptr<ClientRpc>& rpc() const { return rpc_; }
+  Stream* stream() const { return stream_.get(); }
+
+  /// \brief Reads must be serialized, so that the stream can be drained
+  /// before being finished
+  std::mutex* read_mutex() { return &read_mutex_; }
+
+  bool finished() {
+    std::lock_guard<std::mutex> guard(finish_mutex_);
+    return finished_;
+  }
+
+  /// \brief Get the final status of the call. All messages must have been
+  /// read beforehand.
+  Status Finish() {
+    std::lock_guard<std::mutex> guard(finish_mutex_);
+    if (!finished_) {
+      finished_ = true;
+      status_ = internal::FromGrpcStatus(stream_->Finish());
+    }
+    return status_;
+  }
+
+ private:
+  // The RPC context lifetime must be coupled to the stream
+  std::shared_ptr<ClientRpc> rpc_;
+  std::shared_ptr<Stream> stream_;
+  std::mutex read_mutex_;
+  std::mutex finish_mutex_;
+  bool finished_;
+  Status status_;
+};
+
+namespace {
+
+// Read and discard the next message, returning false at the end of the stream
+bool DiscardMessage(grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* stream) {
+  pb::PutResult message;
+  return stream->Read(&message);
+}
+
+bool DiscardMessage(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* stream) {
+  internal::FlightData data;
+  return internal::ReadPayload(stream, &data);
+}
+
+}  // namespace
+
 // The next two classes are intertwined. To get the application
 // metadata while avoiding reimplementing RecordBatchStreamReader, we
 // create an ipc::MessageReader that is tied to the
@@ -251,33 +388,54 @@ class GrpcClientAuthReader : public ClientAuthReader {
 // additional method to get both the record batch and application
 // metadata.
 
+template <typename Stream>
 class GrpcIpcMessageReader;
 class GrpcStreamReader : public FlightStreamReader {
  public:
-  GrpcStreamReader();
+  explicit GrpcStreamReader(std::shared_ptr<ClientRpc> rpc);
+
+  /// \brief Make a reader for a stream, resolving message bodies through the
+  /// shared memory ring if given and accepted by the server
+  template <typename Stream>
+  static std::unique_ptr<GrpcStreamReader> Make(
+      std::shared_ptr<FinishableStream<Stream>> stream,
+      std::unique_ptr<internal::SharedMemoryRing> ring = nullptr) {
+    std::unique_ptr<GrpcStreamReader> reader(new GrpcStreamReader(stream->rpc()));
+    reader->message_reader_.reset(new GrpcIpcMessageReader<Stream>(
+        reader.get(), std::move(stream), std::move(ring)));
+    return reader;
+  }
+
+  /// \brief Read the schema sent by the server, if not done yet
+  Status EnsureOpen() const;
 
-  static Status Open(std::unique_ptr<ClientRpc> rpc,
-                     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
-                     std::unique_ptr<GrpcStreamReader>* out);
   std::shared_ptr<Schema> schema() const override;
   Status Next(FlightStreamChunk* out) override;
   void Cancel() override;
 
  private:
+  template <typename Stream>
   friend class GrpcIpcMessageReader;
-  std::unique_ptr<ipc::RecordBatchReader> batch_reader_;
+  // The reader is opened on first use for DoExchange, where the server may
+  // wait for data from the client before sending its schema
+  mutable std::unique_ptr<ipc::MessageReader> message_reader_;
+  mutable std::unique_ptr<ipc::RecordBatchReader> batch_reader_;
+  mutable Status open_status_;
   std::shared_ptr<Buffer> last_app_metadata_;
   std::shared_ptr<ClientRpc> rpc_;
 };
 
+template <typename Stream>
 class GrpcIpcMessageReader : public ipc::MessageReader {
  public:
-  GrpcIpcMessageReader(GrpcStreamReader* reader, std::shared_ptr<ClientRpc> rpc,
-                       std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream)
+  GrpcIpcMessageReader(GrpcStreamReader* reader,
+                       std::shared_ptr<FinishableStream<Stream>> stream,
+                       std::unique_ptr<internal::SharedMemoryRing> ring)
       : flight_reader_(reader),
-        rpc_(rpc),
         stream_(std::move(stream)),
-        stream_finished_(false) {}
+        ring_(std::move(ring)),
+        stream_finished_(false),
+        ring_checked_(false) {}
 
   Status ReadNextMessage(std::unique_ptr<ipc::Message>* out) override {
     if (stream_finished_) {
@@ -286,57 +444,88 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
       return Status::OK();
     }
     internal::FlightData data;
-    if (!internal::ReadPayload(stream_.get(), &data)) {
-      // Stream is completed
-      stream_finished_ = true;
-      *out = nullptr;
-      flight_reader_->last_app_metadata_ = nullptr;
-      return OverrideWithServerError(Status::OK());
+    {
+      std::lock_guard<std::mutex> guard(*stream_->read_mutex());
+      if (!internal::ReadPayload(stream_->stream(), &data, metrics())) {
+        // Stream is completed
+        stream_finished_ = true;
+        *out = nullptr;
+        flight_reader_->last_app_metadata_ = nullptr;
+        return OverrideWithServerError(Status::OK());
+      }
+    }
+    if (ring_ && !ring_checked_) {
+      // The server's initial metadata is available once a message was read
+      ring_checked_ = true;
+      const auto& server_metadata = stream_->rpc()->context.GetServerInitialMetadata();
+      if (server_metadata.find(internal::kSharedMemoryAcceptedHeader) ==
+          server_metadata.end()) {
+        ring_.reset();
+      }
+    }
+    Status st;
+    if (ring_) {
+      // Shared bodies are small references, only bodies sent inline when the
+      // ring is full may be split across slices
+      st = data.ConsolidateBody();
+      if (st.ok()) {
+        st = ring_->ResolveBody(default_memory_pool(), &data.body);
+      }
     }
     // Validate IPC message
-    auto st = data.OpenMessage(out);
+    if (st.ok()) {
+      st = data.OpenMessage(out);
+    }
     if (!st.ok()) {
       flight_reader_->last_app_metadata_ = nullptr;
       return OverrideWithServerError(std::move(st));
     }
+    if (metrics() && (*out)->type() == ipc::Message::RECORD_BATCH) {
+      ++metrics()->batches_received;
+    }
     flight_reader_->last_app_metadata_ = data.app_metadata;
     return Status::OK();
   }
 
  protected:
+  CallMetrics* metrics() const { return stream_->rpc()->context.metrics.get(); }
+
   Status OverrideWithServerError(Status&& st) {
     // Get the gRPC status if not OK, to propagate any server error message
-    RETURN_NOT_OK(internal::FromGrpcStatus(stream_->Finish()));
+    RETURN_NOT_OK(stream_->Finish());
     return std::move(st);
   }
 
  private:
   GrpcStreamReader* flight_reader_;
-  // The RPC context lifetime must be coupled to the ClientReader
-  std::shared_ptr<ClientRpc> rpc_;
-  std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream_;
+  std::shared_ptr<FinishableStream<Stream>> stream_;
+  // Only set for DoGet calls over a grpc+shm location
+  std::unique_ptr<internal::SharedMemoryRing> ring_;
   bool stream_finished_;
+  bool ring_checked_;
 };
 
-GrpcStreamReader::GrpcStreamReader() {}
-
-Status GrpcStreamReader::Open(std::unique_ptr<ClientRpc> rpc,
-                              std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
-                              std::unique_ptr<GrpcStreamReader>* out) {
-  *out = std::unique_ptr<GrpcStreamReader>(new GrpcStreamReader);
-  out->get()->rpc_ = std::move(rpc);
-  std::unique_ptr<GrpcIpcMessageReader> message_reader(
-      new GrpcIpcMessageReader(out->get(), out->get()->rpc_, std::move(stream)));
-  return ipc::RecordBatchStreamReader::Open(std::move(message_reader),
-                                            &(*out)->batch_reader_);
+GrpcStreamReader::GrpcStreamReader(std::shared_ptr<ClientRpc> rpc)
+    : rpc_(std::move(rpc)) {}
+
+Status GrpcStreamReader::EnsureOpen() const {
+  if (message_reader_) {
+    open_status_ = ipc::RecordBatchStreamReader::Open(std::move(message_reader_),
+                                                      &batch_reader_);
+  }
+  return open_status_;
 }
 
 std::shared_ptr<Schema> GrpcStreamReader::schema() const {
+  if (!EnsureOpen().ok()) {
+    return nullptr;
+  }
   return batch_reader_->schema();
 }
 
 Status GrpcStreamReader::Next(FlightStreamChunk* out) {
   out->app_metadata = nullptr;
+  RETURN_NOT_OK(EnsureOpen());
   RETURN_NOT_OK(batch_reader_->ReadNext(&out->data));
   out->app_metadata = std::move(last_app_metadata_);
   return Status::OK();
@@ -344,43 +533,126 @@ Status GrpcStreamReader::Next(FlightStreamChunk* out) {
 
 void GrpcStreamReader::Cancel() { rpc_->context.TryCancel(); }
 
+// Credit-based flow control for DoPut: each record batch written takes a
+// credit, and each metadata message from the server gives one back.
+// Acknowledgements read while waiting for a credit are queued for the
+// GrpcMetadataReader. Both sides hold the read mutex of the stream.
+class PutWindow {
+ public:
+  using Stream = grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>;
+
+  PutWindow(std::shared_ptr<FinishableStream<Stream>> stream, int64_t size,
+            bool blocking)
+      : stream_(std::move(stream)), size_(size), blocking_(blocking) {}
+
+  /// \brief Take a credit before writing a record batch
+  Status Acquire() {
+    std::lock_guard<std::mutex> guard(*stream_->read_mutex());
+    while (outstanding_ >= size_) {
+      if (!blocking_) {
+        return Status::CapacityError("DoPut window is full: ", outstanding_,
+                                     " record batches are not acknowledged");
+      }
+      std::shared_ptr<Buffer> ack;
+      if (!ReadNext(&ack)) {
+        RETURN_NOT_OK(stream_->Finish());
+        return Status::IOError("Server finished DoPut with ", outstanding_,
+                               " record batches not acknowledged");
+      }
+      acks_.push_back(std::move(ack));
+    }
+    ++outstanding_;
+    return Status::OK();
+  }
+
+  /// \brief Give back the credit of a record batch that wasn't written
+  void Release() {
+    std::lock_guard<std::mutex> guard(*stream_->read_mutex());
+    --outstanding_;
+  }
+
+  Status ReadMetadata(std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(*stream_->read_mutex());
+    if (!acks_.empty()) {
+      *out = std::move(acks_.front());
+      acks_.pop_front();
+    } else if (!ReadNext(out)) {
+      // Stream finished
+      *out = nullptr;
+    }
+    return Status::OK();
+  }
+
+ private:
+  bool ReadNext(std::shared_ptr<Buffer>* out) {
+    pb::PutResult message;
+    if (ended_ || !stream_->stream()->Read(&message)) {
+      ended_ = true;
+      return false;
+    }
+    *out = Buffer::FromString(std::move(*message.mutable_app_metadata()));
+    if (outstanding_ > 0) {
+      --outstanding_;
+    }
+    return true;
+  }
+
+  std::shared_ptr<FinishableStream<Stream>> stream_;
+  const int64_t size_;
+  const bool blocking_;
+  int64_t outstanding_ = 0;
+  bool ended_ = false;
+  std::deque<std::shared_ptr<Buffer>> acks_;
+};
+
 // Similarly, the next two classes are intertwined. In order to get
 // application-specific metadata to the IpcPayloadWriter,
-// DoPutPayloadWriter takes a pointer to
+// GrpcPayloadWriter takes a pointer to
 // GrpcStreamWriter. GrpcStreamWriter updates a metadata field on
-// write; DoPutPayloadWriter reads that metadata field to determine
-// what to write.
+// write; GrpcPayloadWriter reads that metadata field to determine
+// what to write. Both are used for DoPut (ReadT = pb::PutResult) and
+// DoExchange (ReadT = pb::FlightData).
 
-class DoPutPayloadWriter;
+template <typename ReadT>
+class GrpcPayloadWriter;
+template <typename ReadT>
 class GrpcStreamWriter : public FlightStreamWriter {
  public:
+  using Stream = grpc::ClientReaderWriter<pb::FlightData, ReadT>;
+
   ~GrpcStreamWriter() override = default;
 
-  explicit GrpcStreamWriter(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer)
-      : app_metadata_(nullptr), batch_writer_(nullptr), writer_(writer) {}
+  explicit GrpcStreamWriter(std::shared_ptr<FinishableStream<Stream>> stream)
+      : app_metadata_(nullptr), batch_writer_(nullptr), stream_(std::move(stream)) {}
 
-  static Status Open(
-      const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-      std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-      std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      std::unique_ptr<FlightStreamWriter>* out);
+  static Status Open(const FlightDescriptor& descriptor,
+                     const std::shared_ptr<Schema>& schema,
+                     const ipc::IpcOptions& options,
+                     std::shared_ptr<FinishableStream<Stream>> stream,
+                     std::shared_ptr<PutWindow> window,
+                     std::unique_ptr<FlightStreamWriter>* out);
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
     return WriteWithMetadata(batch, nullptr);
   }
   Status WriteWithMetadata(const RecordBatch& batch,
                            std::shared_ptr<Buffer> app_metadata) override {
+    if (window_) {
+      RETURN_NOT_OK(window_->Acquire());
+    }
     app_metadata_ = app_metadata;
-    return batch_writer_->WriteRecordBatch(batch);
+    Status st = batch_writer_->WriteRecordBatch(batch);
+    if (!st.ok() && window_) {
+      window_->Release();
+    }
+    return st;
   }
   Status DoneWriting() override {
     if (done_writing_) {
       return Status::OK();
     }
     done_writing_ = true;
-    if (!writer_->WritesDone()) {
+    if (!stream_->stream()->WritesDone()) {
       return Status::IOError("Could not flush pending record batches.");
     }
     return Status::OK();
@@ -391,30 +663,30 @@ class GrpcStreamWriter : public FlightStreamWriter {
   Status Close() override { return batch_writer_->Close(); }
 
  private:
-  friend class DoPutPayloadWriter;
+  friend class GrpcPayloadWriter<ReadT>;
   std::shared_ptr<Buffer> app_metadata_;
   std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<FinishableStream<Stream>> stream_;
+  // Only set for DoPut calls with a window
+  std::shared_ptr<PutWindow> window_;
   bool done_writing_ = false;
 };
 
-/// A IpcPayloadWriter implementation that writes to a DoPut stream
-class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
+/// A IpcPayloadWriter implementation that writes to a DoPut or DoExchange stream
+template <typename ReadT>
+class GrpcPayloadWriter : public ipc::internal::IpcPayloadWriter {
  public:
-  DoPutPayloadWriter(
-      const FlightDescriptor& descriptor, std::unique_ptr<ClientRpc> rpc,
-      std::unique_ptr<pb::PutResult> response, std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      GrpcStreamWriter* stream_writer)
+  using Stream = grpc::ClientReaderWriter<pb::FlightData, ReadT>;
+
+  GrpcPayloadWriter(const FlightDescriptor& descriptor,
+                    std::shared_ptr<FinishableStream<Stream>> stream,
+                    GrpcStreamWriter<ReadT>* stream_writer)
       : descriptor_(descriptor),
-        rpc_(std::move(rpc)),
-        response_(std::move(response)),
-        read_mutex_(read_mutex),
-        writer_(std::move(writer)),
+        stream_(std::move(stream)),
         first_payload_(true),
         stream_writer_(stream_writer) {}
 
-  ~DoPutPayloadWriter() override = default;
+  ~GrpcPayloadWriter() override = default;
 
   Status Start() override { return Status::OK(); }
 
@@ -442,23 +714,26 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
       payload.app_metadata = std::move(stream_writer_->app_metadata_);
     }
 
-    if (!internal::WritePayload(payload, writer_.get())) {
-      return rpc_->IOError("Could not write record batch to stream: ");
+    if (!internal::WritePayload(payload, stream_->stream(),
+                                stream_->rpc()->context.metrics.get())) {
+      return stream_->rpc()->IOError("Could not write record batch to stream: ");
     }
     return Status::OK();
   }
 
   Status Close() override {
-    bool finished_writes = stream_writer_->done_writing_ ? true : writer_->WritesDone();
+    bool finished_writes =
+        stream_writer_->done_writing_ ? true : stream_->stream()->WritesDone();
     // Drain the read side to avoid hanging
-    std::unique_lock<std::mutex> guard(*read_mutex_, std::try_to_lock);
+    std::unique_lock<std::mutex> guard(*stream_->read_mutex(), std::try_to_lock);
     if (!guard.owns_lock()) {
       return Status::IOError("Cannot close stream with pending read operation.");
     }
-    pb::PutResult message;
-    while (writer_->Read(&message)) {
+    if (!stream_->finished()) {
+      while (DiscardMessage(stream_->stream())) {
+      }
     }
-    RETURN_NOT_OK(internal::FromGrpcStatus(writer_->Finish()));
+    RETURN_NOT_OK(stream_->Finish());
     if (!finished_writes) {
       return Status::UnknownError(
           "Could not finish writing record batches before closing");
@@ -469,25 +744,33 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
  protected:
   // TODO: there isn't a way to access this as a user.
   const FlightDescriptor descriptor_;
-  std::unique_ptr<ClientRpc> rpc_;
-  std::unique_ptr<pb::PutResult> response_;
-  std::shared_ptr<std::mutex> read_mutex_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<FinishableStream<Stream>> stream_;
   bool first_payload_;
-  GrpcStreamWriter* stream_writer_;
+  GrpcStreamWriter<ReadT>* stream_writer_;
 };
 
-Status GrpcStreamWriter::Open(
-    const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-    std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-    std::shared_ptr<std::mutex> read_mutex,
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-    std::unique_ptr<FlightStreamWriter>* out) {
-  std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(writer));
-  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(new DoPutPayloadWriter(
-      descriptor, std::move(rpc), std::move(response), read_mutex, writer, result.get()));
-  RETURN_NOT_OK(ipc::internal::OpenRecordBatchWriter(std::move(payload_writer), schema,
-                                                     &result->batch_writer_));
+template <typename ReadT>
+Status GrpcStreamWriter<ReadT>::Open(const FlightDescriptor& descriptor,
+                                     const std::shared_ptr<Schema>& schema,
+                                     const ipc::IpcOptions& options,
+                                     std::shared_ptr<FinishableStream<Stream>> stream,
+                                     std::shared_ptr<PutWindow> window,
+                                     std::unique_ptr<FlightStreamWriter>* out) {
+  std::unique_ptr<GrpcStreamWriter<ReadT>> result(new GrpcStreamWriter<ReadT>(stream));
+  result->window_ = std::move(window);
+  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+      new GrpcPayloadWriter<ReadT>(descriptor, stream, result.get()));
+  if (std::is_same<ReadT, pb::FlightData>::value) {
+    // DoExchange sends the descriptor and schema right away, so that the server
+    // can start processing the call before the first record batch is written
+    ARROW_ASSIGN_OR_RAISE(result->batch_writer_,
+                          ipc::internal::StartRecordBatchWriter(std::move(payload_writer),
+                                                                schema, options));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(result->batch_writer_,
+                          ipc::internal::OpenRecordBatchWriter(std::move(payload_writer),
+                                                               schema, options));
+  }
   *out = std::move(result);
   return Status::OK();
 }
@@ -496,15 +779,19 @@ FlightMetadataReader::~FlightMetadataReader() = default;
 
 class GrpcMetadataReader : public FlightMetadataReader {
  public:
-  explicit GrpcMetadataReader(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> reader,
-      std::shared_ptr<std::mutex> read_mutex)
-      : reader_(reader), read_mutex_(read_mutex) {}
+  using Stream = grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>;
+
+  GrpcMetadataReader(std::shared_ptr<FinishableStream<Stream>> stream,
+                     std::shared_ptr<PutWindow> window)
+      : stream_(std::move(stream)), window_(std::move(window)) {}
 
   Status ReadMetadata(std::shared_ptr<Buffer>* out) override {
-    std::lock_guard<std::mutex> guard(*read_mutex_);
+    if (window_) {
+      return window_->ReadMetadata(out);
+    }
+    std::lock_guard<std::mutex> guard(*stream_->read_mutex());
     pb::PutResult message;
-    if (reader_->Read(&message)) {
+    if (stream_->stream()->Read(&message)) {
       *out = Buffer::FromString(std::move(*message.mutable_app_metadata()));
     } else {
       // Stream finished
@@ -514,14 +801,298 @@ class GrpcMetadataReader : public FlightMetadataReader {
   }
 
  private:
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> reader_;
-  std::shared_ptr<std::mutex> read_mutex_;
+  std::shared_ptr<FinishableStream<Stream>> stream_;
+  std::shared_ptr<PutWindow> window_;
+};
+
+// A RecordBatchReader over all the endpoints of a flight, read concurrently
+// by a pool of workers. Workers take endpoints in order, so that the first
+// endpoint not fully read is always being read, which lets the ordered mode
+// make progress even though each endpoint only buffers a few batches.
+class EndpointsReader : public RecordBatchReader {
+ public:
+  EndpointsReader(FlightClient* client, std::shared_ptr<Schema> schema,
+                  std::vector<FlightEndpoint> endpoints,
+                  const FlightEndpointsReadOptions& options)
+      : client_(client),
+        schema_(std::move(schema)),
+        endpoints_(std::move(endpoints)),
+        options_(options),
+        queues_(endpoints_.size()),
+        streams_(endpoints_.size(), nullptr) {}
+
+  ~EndpointsReader() override { Stop(); }
+
+  Status Start() {
+    if (options_.max_concurrency <= 0) {
+      return Status::Invalid("max_concurrency must be positive");
+    }
+    if (options_.max_queued_batches <= 0) {
+      return Status::Invalid("max_queued_batches must be positive");
+    }
+    const int num_workers = static_cast<int>(std::max<size_t>(
+        1, std::min<size_t>(options_.max_concurrency, endpoints_.size())));
+    ARROW_ASSIGN_OR_RAISE(pool_, arrow::internal::ThreadPool::Make(num_workers));
+    for (int i = 0; i < num_workers; ++i) {
+      RETURN_NOT_OK(pool_->Spawn([this] { RunWorker(); }));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      if (!status_.ok()) {
+        return status_;
+      }
+      bool finished = true;
+      if (options_.ordered) {
+        while (current_ < queues_.size() && queues_[current_].batches.empty() &&
+               queues_[current_].finished) {
+          ++current_;
+        }
+        if (current_ < queues_.size()) {
+          finished = false;
+          if (PopBatch(current_, batch)) {
+            return Status::OK();
+          }
+        }
+      } else {
+        // Round-robin over the endpoints with buffered batches
+        for (size_t i = 0; i < queues_.size(); ++i) {
+          const size_t index = (current_ + i) % queues_.size();
+          if (PopBatch(index, batch)) {
+            current_ = index + 1;
+            return Status::OK();
+          }
+          finished &= queues_[index].finished;
+        }
+      }
+      if (finished) {
+        *batch = nullptr;
+        return Status::OK();
+      }
+      cv_.wait(lock);
+    }
+  }
+
+ private:
+  struct EndpointQueue {
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    bool finished = false;
+  };
+
+  // Must be called with the mutex held
+  bool PopBatch(size_t index, std::shared_ptr<RecordBatch>* batch) {
+    auto& queue = queues_[index];
+    if (queue.batches.empty()) {
+      return false;
+    }
+    *batch = std::move(queue.batches.front());
+    queue.batches.pop_front();
+    cv_.notify_all();
+    return true;
+  }
+
+  void RunWorker() {
+    while (true) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_ || next_endpoint_ == endpoints_.size()) {
+          return;
+        }
+        index = next_endpoint_++;
+      }
+      Status status = ReadEndpoint(index);
+      std::lock_guard<std::mutex> lock(mutex_);
+      queues_[index].finished = true;
+      if (!status.ok() && !stopped_) {
+        status_ = status.WithMessage("Failed to read endpoint ", index, ": ",
+                                     status.message());
+        stopped_ = true;
+        CancelStreams();
+      }
+      cv_.notify_all();
+    }
+  }
+
+  Status ReadEndpoint(size_t index) {
+    const FlightEndpoint& endpoint = endpoints_[index];
+    FlightClient* client;
+    RETURN_NOT_OK(GetClient(endpoint, &client));
+    std::unique_ptr<FlightStreamReader> stream;
+    RETURN_NOT_OK(client->DoGet(options_.call_options, endpoint.ticket, &stream));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        stream->Cancel();
+        return Status::OK();
+      }
+      streams_[index] = stream.get();
+    }
+
+    Status status = CheckSchema(*stream);
+    FlightStreamChunk chunk;
+    while (status.ok()) {
+      status = stream->Next(&chunk);
+      if (!status.ok() || !chunk.data) {
+        break;
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto& queue = queues_[index];
+      cv_.wait(lock, [&] {
+        return stopped_ ||
+               queue.batches.size() < static_cast<size_t>(options_.max_queued_batches);
+      });
+      if (stopped_) {
+        break;
+      }
+      queue.batches.push_back(std::move(chunk.data));
+      cv_.notify_all();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_[index] = nullptr;
+    return status;
+  }
+
+  Status CheckSchema(FlightStreamReader& stream) {
+    if (!stream.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Endpoint schema ", stream.schema()->ToString(),
+                             " doesn't match flight schema ", schema_->ToString());
+    }
+    return Status::OK();
+  }
+
+  // Get the client for an endpoint, connecting to its location if needed
+  Status GetClient(const FlightEndpoint& endpoint, FlightClient** out) {
+    if (endpoint.locations.empty()) {
+      *out = client_;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(clients_mutex_);
+    const Location& location = endpoint.locations[0];
+    auto& client = clients_[location.ToString()];
+    if (!client) {
+      RETURN_NOT_OK(FlightClient::Connect(location, options_.client_options, &client));
+    }
+    *out = client.get();
+    return Status::OK();
+  }
+
+  // Must be called with the mutex held
+  void CancelStreams() {
+    for (auto stream : streams_) {
+      if (stream) {
+        stream->Cancel();
+      }
+    }
+  }
+
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+      CancelStreams();
+      cv_.notify_all();
+    }
+    if (pool_) {
+      ARROW_UNUSED(pool_->Shutdown());
+    }
+  }
+
+  FlightClient* client_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<FlightEndpoint> endpoints_;
+  FlightEndpointsReadOptions options_;
+  std::shared_ptr<arrow::internal::ThreadPool> pool_;
+
+  std::mutex clients_mutex_;
+  std::map<std::string, std::unique_ptr<FlightClient>> clients_;
+
+  // Protects the members below
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<EndpointQueue> queues_;
+  // The streams being read, to cancel them when stopping
+  std::vector<FlightStreamReader*> streams_;
+  size_t next_endpoint_ = 0;
+  // The next endpoint to return batches from
+  size_t current_ = 0;
+  bool stopped_ = false;
+  Status status_;
+};
+
+using ChannelVector = std::vector<std::shared_ptr<grpc::Channel>>;
+
+class FlightChannelPool::Impl {
+ public:
+  // Get the channels cached under a key, making them if needed
+  Status GetChannels(const std::string& key,
+                     const std::function<Status(ChannelVector*)>& make_channels,
+                     ChannelVector* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = channels_.find(key);
+    if (it == channels_.end()) {
+      ChannelVector channels;
+      RETURN_NOT_OK(make_channels(&channels));
+      it = channels_.emplace(key, std::move(channels)).first;
+    }
+    *out = it->second;
+    return Status::OK();
+  }
+
+  int64_t size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(channels_.size());
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    channels_.clear();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, ChannelVector> channels_;
 };
 
+FlightChannelPool::FlightChannelPool() : impl_(new Impl) {}
+
+FlightChannelPool::~FlightChannelPool() = default;
+
+int64_t FlightChannelPool::size() const { return impl_->size(); }
+
+void FlightChannelPool::Clear() { impl_->Clear(); }
+
+namespace {
+
+// The options which a channel of the pool must have been made with
+std::string GetChannelKey(const Location& location, const FlightClientOptions& options) {
+  std::stringstream key;
+  key << location.ToString() << '\n'
+      << options.tls_root_certs << '\n'
+      << options.override_hostname << '\n'
+      << options.num_channels;
+  // Middleware is attached to the channels
+  for (const auto& factory : options.middleware) {
+    key << '\n' << factory.get();
+  }
+  return key.str();
+}
+
+}  // namespace
+
 class FlightClient::FlightClientImpl {
  public:
   Status Connect(const Location& location, const FlightClientOptions& options) {
     const std::string& scheme = location.scheme();
+    if (options.num_channels <= 0) {
+      return Status::Invalid("num_channels must be positive");
+    }
 
     std::stringstream grpc_uri;
     std::shared_ptr<grpc::ChannelCredentials> creds;
@@ -537,9 +1108,12 @@ class FlightClient::FlightClientImpl {
       } else {
         creds = grpc::InsecureChannelCredentials();
       }
-    } else if (scheme == kSchemeGrpcUnix) {
+    } else if (scheme == kSchemeGrpcUnix || scheme == kSchemeGrpcShm) {
       grpc_uri << "unix://" << location.uri_->path();
       creds = grpc::InsecureChannelCredentials();
+      if (scheme == kSchemeGrpcShm) {
+        shared_memory_size_ = options.shared_memory_size;
+      }
     } else {
       return Status::NotImplemented("Flight scheme " + scheme + " is not supported.");
     }
@@ -553,16 +1127,33 @@ class FlightClient::FlightClientImpl {
     if (options.override_hostname != "") {
       args.SetSslTargetNameOverride(options.override_hostname);
     }
+    if (options.num_channels > 1) {
+      // Channels with the same arguments would share their connection
+      args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    }
 
-    std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
-        interceptors;
-    interceptors.emplace_back(
-        new GrpcClientInterceptorAdapterFactory(std::move(options.middleware)));
-
-    stub_ = pb::FlightService::NewStub(
-        grpc::experimental::CreateCustomChannelWithInterceptors(
+    auto make_channels = [&](ChannelVector* channels) {
+      for (int i = 0; i < options.num_channels; ++i) {
+        std::vector<
+            std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+            interceptors;
+        interceptors.emplace_back(
+            new GrpcClientInterceptorAdapterFactory(options.middleware));
+        channels->push_back(grpc::experimental::CreateCustomChannelWithInterceptors(
             grpc_uri.str(), creds, args, std::move(interceptors)));
-
+      }
+      return Status::OK();
+    };
+    ChannelVector channels;
+    if (options.channel_pool) {
+      RETURN_NOT_OK(options.channel_pool->impl_->GetChannels(
+          GetChannelKey(location, options), make_channels, &channels));
+    } else {
+      RETURN_NOT_OK(make_channels(&channels));
+    }
+    for (const auto& channel : channels) {
+      stubs_.push_back(pb::FlightService::NewStub(channel));
+    }
     return Status::OK();
   }
 
@@ -571,7 +1162,7 @@ class FlightClient::FlightClientImpl {
     auth_handler_ = std::move(auth_handler);
     ClientRpc rpc(options);
     std::shared_ptr<grpc::ClientReaderWriter<pb::HandshakeRequest, pb::HandshakeResponse>>
-        stream = stub_->Handshake(&rpc.context);
+        stream = stub()->Handshake(&rpc.context);
     GrpcClientAuthSender outgoing{stream};
     GrpcClientAuthReader incoming{stream};
     RETURN_NOT_OK(auth_handler_->Authenticate(&outgoing, &incoming));
@@ -592,7 +1183,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     std::unique_ptr<grpc::ClientReader<pb::FlightInfo>> stream(
-        stub_->ListFlights(&rpc.context, pb_criteria));
+        stub()->ListFlights(&rpc.context, pb_criteria));
 
     std::vector<FlightInfo> flights;
 
@@ -615,7 +1206,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     std::unique_ptr<grpc::ClientReader<pb::Result>> stream(
-        stub_->DoAction(&rpc.context, pb_action));
+        stub()->DoAction(&rpc.context, pb_action));
 
     pb::Result pb_result;
 
@@ -637,7 +1228,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     std::unique_ptr<grpc::ClientReader<pb::ActionType>> stream(
-        stub_->ListActions(&rpc.context, empty));
+        stub()->ListActions(&rpc.context, empty));
 
     pb::ActionType pb_type;
     ActionType type;
@@ -659,7 +1250,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     Status s = internal::FromGrpcStatus(
-        stub_->GetFlightInfo(&rpc.context, pb_descriptor, &pb_response));
+        stub()->GetFlightInfo(&rpc.context, pb_descriptor, &pb_response));
     RETURN_NOT_OK(s);
 
     FlightInfo::Data info_data;
@@ -678,7 +1269,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     Status s = internal::FromGrpcStatus(
-        stub_->GetSchema(&rpc.context, pb_descriptor, &pb_response));
+        stub()->GetSchema(&rpc.context, pb_descriptor, &pb_response));
     RETURN_NOT_OK(s);
 
     std::string str;
@@ -692,13 +1283,22 @@ class FlightClient::FlightClientImpl {
     pb::Ticket pb_ticket;
     internal::ToProto(ticket, &pb_ticket);
 
-    std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
+    auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream(
-        stub_->DoGet(&rpc->context, pb_ticket));
-
-    std::unique_ptr<GrpcStreamReader> reader;
-    RETURN_NOT_OK(GrpcStreamReader::Open(std::move(rpc), std::move(stream), &reader));
+    RETURN_NOT_OK(rpc->RequestCompression(options));
+    std::unique_ptr<internal::SharedMemoryRing> ring;
+    if (shared_memory_size_ > 0) {
+      RETURN_NOT_OK(internal::SharedMemoryRing::Create(shared_memory_size_, &ring));
+      rpc->context.AddMetadata(internal::kSharedMemoryHeader, ring->name());
+    }
+    std::shared_ptr<grpc::ClientReader<pb::FlightData>> stream(
+        stub()->DoGet(&rpc->context, pb_ticket));
+
+    auto reader = GrpcStreamReader::Make(
+        std::make_shared<FinishableStream<grpc::ClientReader<pb::FlightData>>>(
+            rpc, stream),
+        std::move(ring));
+    RETURN_NOT_OK(reader->EnsureOpen());
     *out = std::move(reader);
     return Status::OK();
   }
@@ -707,21 +1307,57 @@ class FlightClient::FlightClientImpl {
                const std::shared_ptr<Schema>& schema,
                std::unique_ptr<FlightStreamWriter>* out,
                std::unique_ptr<FlightMetadataReader>* reader) {
-    std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
+    using Stream = grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>;
+    RETURN_NOT_OK(CheckCompression(options));
+    if (options.put_window < 0) {
+      return Status::Invalid("put_window must not be negative");
+    }
+    auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<pb::PutResult> response(new pb::PutResult);
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer(
-        stub_->DoPut(&rpc->context));
+    std::shared_ptr<Stream> stream(stub()->DoPut(&rpc->context));
 
-    std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
-    *reader =
-        std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(writer, read_mutex));
-    return GrpcStreamWriter::Open(descriptor, schema, std::move(rpc), std::move(response),
-                                  read_mutex, writer, out);
+    auto finishable_stream = std::make_shared<FinishableStream<Stream>>(rpc, stream);
+    std::shared_ptr<PutWindow> window;
+    if (options.put_window > 0) {
+      window = std::make_shared<PutWindow>(finishable_stream, options.put_window,
+                                           options.put_window_blocking);
+    }
+    *reader = std::unique_ptr<FlightMetadataReader>(
+        new GrpcMetadataReader(finishable_stream, window));
+    return GrpcStreamWriter<pb::PutResult>::Open(
+        descriptor, schema, GetWriteOptions(options), finishable_stream, window, out);
+  }
+
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    using Stream = grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>;
+    auto rpc = std::make_shared<ClientRpc>(options);
+    RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    RETURN_NOT_OK(rpc->RequestCompression(options));
+    std::shared_ptr<Stream> stream(stub()->DoExchange(&rpc->context));
+
+    auto finishable_stream = std::make_shared<FinishableStream<Stream>>(rpc, stream);
+    RETURN_NOT_OK(GrpcStreamWriter<pb::FlightData>::Open(
+        descriptor, schema, GetWriteOptions(options), finishable_stream,
+        /*window=*/nullptr, writer));
+    // The server may not send anything before it reads data from the client,
+    // so the schema is only read once the reader is used
+    *reader = GrpcStreamReader::Make(finishable_stream);
+    return Status::OK();
   }
 
  private:
-  std::unique_ptr<pb::FlightService::Stub> stub_;
+  // Spread the calls over the channels of the client
+  pb::FlightService::Stub* stub() {
+    return stubs_[next_stub_.fetch_add(1) % stubs_.size()].get();
+  }
+
+  std::vector<std::unique_ptr<pb::FlightService::Stub>> stubs_;
+  std::atomic<size_t> next_stub_{0};
+  // Size of the shared memory ring for DoGet calls, zero if not enabled
+  int64_t shared_memory_size_ = 0;
   std::shared_ptr<ClientAuthHandler> auth_handler_;
 };
 
@@ -782,6 +1418,19 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::DoGetEndpoints(const FlightEndpointsReadOptions& options,
+                                    const FlightInfo& info,
+                                    std::shared_ptr<RecordBatchReader>* reader) {
+  ipc::DictionaryMemo memo;
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(info.GetSchema(&memo, &schema));
+  auto result =
+      std::make_shared<EndpointsReader>(this, schema, info.endpoints(), options);
+  RETURN_NOT_OK(result->Start());
+  *reader = std::move(result);
+  return Status::OK();
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
@@ -790,5 +1439,13 @@ Status FlightClient::DoPut(const FlightCallOptions& options,
   return impl_->DoPut(options, descriptor, schema, stream, reader);
 }
 
+Status FlightClient::DoExchange(const FlightCallOptions& options,
+                                const FlightDescriptor& descriptor,
+                                const std::shared_ptr<Schema>& schema,
+                                std::unique_ptr<FlightStreamWriter>* writer,
+                                std::unique_ptr<FlightStreamReader>* reader) {
+  return impl_->DoExchange(options, descriptor, schema, writer, reader);
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -29,6 +30,7 @@
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 #include "arrow/flight/types.h"  // IWYU pragma: keep
 #include "arrow/flight/visibility.h"
@@ -58,6 +60,53 @@ class ARROW_FLIGHT_EXPORT FlightCallOptions {
   /// mean an implementation-defined default behavior will be used
   /// instead. This is the default value.
   TimeoutDuration timeout;
+
+  /// \brief The codec used to compress the bodies of the record batches
+  /// written by this call (DoPut, DoExchange). It is also requested from
+  /// the server for the record batches it sends (DoGet, DoExchange), which
+  /// are sent uncompressed if the server doesn't accept it. Only LZ4 and
+  /// ZSTD are supported.
+  Compression::type compression;
+
+  /// \brief The compression level used for the record batches written by
+  /// this call
+  int compression_level;
+
+  /// \brief The maximum number of record batches written by a DoPut call
+  /// that the server hasn't acknowledged yet. The server acknowledges each
+  /// record batch by writing one metadata message for it. Zero (the
+  /// default) disables this window.
+  int64_t put_window;
+
+  /// \brief Whether writing a record batch waits when the DoPut window is
+  /// full. Otherwise, the write fails with CapacityError, and
+  /// acknowledgements are only consumed by FlightMetadataReader.
+  bool put_window_blocking;
+};
+
+/// \brief A cache of gRPC channels, shared by the clients connecting through
+/// it (see FlightClientOptions::channel_pool).
+///
+/// Clients connecting to the same location with the same options reuse the
+/// same channels, saving the connection setup and TLS handshake, and
+/// multiplexing their calls over the same HTTP/2 connections. Channels stay
+/// open as long as they are in the pool or used by a client.
+class ARROW_FLIGHT_EXPORT FlightChannelPool {
+ public:
+  FlightChannelPool();
+  ~FlightChannelPool();
+
+  /// \brief The number of locations and options with cached channels
+  int64_t size() const;
+
+  /// \brief Remove all channels from the pool. Clients using them keep them
+  /// open.
+  void Clear();
+
+ private:
+  friend class FlightClient;
+  class Impl;
+  std::unique_ptr<Impl> impl_;
 };
 
 class ARROW_FLIGHT_EXPORT FlightClientOptions {
@@ -69,6 +118,32 @@ class ARROW_FLIGHT_EXPORT FlightClientOptions {
   std::string override_hostname;
   /// \brief A list of client middleware to apply.
   std::vector<std::shared_ptr<ClientMiddlewareFactory>> middleware;
+  /// \brief The size of the shared memory ring allocated for each DoGet
+  /// call, with a grpc+shm location.
+  int64_t shared_memory_size = 64 << 20;
+  /// \brief The number of gRPC channels the calls of the client are spread
+  /// over, round-robin. Each channel has its own connection, which can
+  /// raise the aggregate throughput of concurrent streams.
+  int num_channels = 1;
+  /// \brief A pool to get the channels from, instead of creating new ones.
+  std::shared_ptr<FlightChannelPool> channel_pool;
+};
+
+/// \brief Options for reading all the endpoints of a flight with
+/// FlightClient::DoGetEndpoints
+struct ARROW_FLIGHT_EXPORT FlightEndpointsReadOptions {
+  /// \brief Per-RPC options for the DoGet call of each endpoint
+  FlightCallOptions call_options;
+  /// \brief Options for the connections made to the endpoint locations
+  FlightClientOptions client_options;
+  /// \brief The maximum number of endpoints read at the same time
+  int max_concurrency = 4;
+  /// \brief The maximum number of record batches buffered for each
+  /// endpoint being read
+  int max_queued_batches = 8;
+  /// \brief Whether to return the record batches in endpoint order.
+  /// Otherwise, they are returned as soon as they are received.
+  bool ordered = true;
 };
 
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
@@ -90,6 +165,11 @@ class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader
 /// application-defined metadata via the Flight protocol.
 class ARROW_FLIGHT_EXPORT FlightStreamWriter : public ipc::RecordBatchWriter {
  public:
+  /// \brief Write a record batch along with application metadata.
+  ///
+  /// With FlightCallOptions::put_window, a DoPut write waits for the
+  /// server to acknowledge a previous record batch when the window is
+  /// full, or fails with CapacityError if the window isn't blocking.
   virtual Status WriteWithMetadata(const RecordBatch& batch,
                                    std::shared_ptr<Buffer> app_metadata) = 0;
   /// \brief Indicate that the application is done writing to this stream.
@@ -109,7 +189,9 @@ class ARROW_FLIGHT_EXPORT FlightStreamWriter : public ipc::RecordBatchWriter {
 class ARROW_FLIGHT_EXPORT FlightMetadataReader {
  public:
   virtual ~FlightMetadataReader();
-  /// \brief Read a message from the server.
+  /// \brief Read a message from the server. This includes the
+  /// acknowledgements read by the writer while waiting for the DoPut
+  /// window to open.
   virtual Status ReadMetadata(std::shared_ptr<Buffer>* out) = 0;
 };
 
@@ -217,6 +299,23 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Read the record batches of all the endpoints of a flight,
+  /// fetching several endpoints concurrently.
+  ///
+  /// Endpoints without locations are read through this client, which
+  /// must outlive the returned reader. Other endpoints are read through a
+  /// new, unauthenticated connection to their first location, shared by
+  /// the endpoints with the same location. Reading stops at the first
+  /// error, and destroying the reader cancels the remaining calls.
+  ///
+  /// \param[in] options Per-RPC and concurrency options
+  /// \param[in] info the flight to read
+  /// \param[out] reader a reader for the record batches of all endpoints
+  /// \return Status
+  Status DoGetEndpoints(const FlightEndpointsReadOptions& options,
+                        const FlightInfo& info,
+                        std::shared_ptr<RecordBatchReader>* reader);
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
@@ -241,6 +340,34 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoPut({}, descriptor, schema, stream, reader);
   }
 
+  /// \brief Upload data to a Flight described by the given descriptor,
+  /// and read the data the server sends back on the same call. The
+  /// caller must call Close() on the returned writer once they are done
+  /// with both streams.
+  ///
+  /// The schema is sent to the server right away, while the reader
+  /// only waits for the server's schema when it is first used, so that
+  /// the server may read data before sending anything back. Reading and
+  /// writing can be interleaved, or done from separate threads. Use \a
+  /// DoneWriting to signal the end of the uploaded data.
+  ///
+  /// \param[in] options Per-RPC options
+  /// \param[in] descriptor the descriptor of the stream
+  /// \param[in] schema the schema for the data to upload
+  /// \param[out] writer a writer to write record batches to
+  /// \param[out] reader a reader for the record batches sent by the server
+  /// \return Status
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader);
+  Status DoExchange(const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    return DoExchange({}, descriptor, schema, writer, reader);
+  }
+
  private:
   FlightClient();
   class FlightClientImpl;
@@ -46,6 +46,10 @@ class ARROW_FLIGHT_EXPORT ClientMiddleware {
 
   /// \brief A callback after the call has completed.
   virtual void CallCompleted(const Status& status) = 0;
+
+  /// \brief A callback with the data transfer metrics of the call, right
+  /// before CallCompleted. The default implementation ignores them.
+  virtual void CallMetricsAvailable(const CallMetrics& metrics) {}
 };
 
 /// \brief A factory for new middleware instances.
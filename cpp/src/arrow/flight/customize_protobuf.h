@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "arrow/flight/platform.h"
+#include "arrow/flight/visibility.h"
 #include "arrow/util/config.h"
 
 // Silence protobuf warnings
@@ -70,11 +71,13 @@ struct FlightData;
 // Those two functions are defined in serialization-internal.cc
 
 // Write FlightData to a grpc::ByteBuffer without extra copying
+ARROW_FLIGHT_EXPORT
 grpc::Status FlightDataSerialize(const FlightPayload& msg, grpc::ByteBuffer* out,
                                  bool* own_buffer);
 
 // Read internal::FlightData from grpc::ByteBuffer containing FlightData
 // protobuf without copying
+ARROW_FLIGHT_EXPORT
 grpc::Status FlightDataDeserialize(grpc::ByteBuffer* buffer, FlightData* out);
 
 }  // namespace internal
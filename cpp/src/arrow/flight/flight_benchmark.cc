@@ -15,7 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
+#include <fstream>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -41,10 +43,25 @@ DEFINE_string(server_host, "",
 DEFINE_int32(server_port, 31337, "The port to connect to");
 DEFINE_int32(num_servers, 1, "Number of performance servers to run");
 DEFINE_int32(num_streams, 4, "Number of streams for each server");
-DEFINE_int32(num_threads, 4, "Number of concurrent gets");
+DEFINE_int32(num_threads, 4, "Number of concurrent streams");
 DEFINE_int32(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_bool(test_mixed, false,
+            "Test DoPut on half of the streams, alongside DoGet on the other half");
+DEFINE_string(schema, "int64",
+              "Schema of the data: int64 (4 int64 columns), wide (100 numeric columns), "
+              "string or nested (list and struct columns)");
+DEFINE_bool(share_client, false,
+            "Run all streams through a single client, instead of one client per stream");
+DEFINE_bool(tls, false,
+            "Connect with TLS (a spawned server uses the test certificates found under "
+            "ARROW_TEST_DATA)");
+DEFINE_string(cert_file, "",
+              "Root certificate to validate the server with TLS (defaults to the test "
+              "root certificate found under ARROW_TEST_DATA)");
+DEFINE_string(compression, "",
+              "Compress record batch bodies on the wire with this codec (lz4 or zstd)");
 
 namespace perf = arrow::flight::perf;
 
@@ -58,6 +75,8 @@ namespace flight {
 struct PerformanceResult {
   int64_t num_records;
   int64_t num_bytes;
+  // Time spent reading or writing each record batch
+  std::vector<int64_t> batch_nanos;
 };
 
 struct PerformanceStats {
@@ -65,11 +84,14 @@ struct PerformanceStats {
   std::mutex mutex;
   int64_t total_records;
   int64_t total_bytes;
+  std::vector<int64_t> batch_nanos;
 
-  void Update(const int64_t total_records, const int64_t total_bytes) {
+  void Update(const PerformanceResult& result) {
     std::lock_guard<std::mutex> lock(this->mutex);
-    this->total_records += total_records;
-    this->total_bytes += total_bytes;
+    this->total_records += result.num_records;
+    this->total_bytes += result.num_bytes;
+    this->batch_nanos.insert(this->batch_nanos.end(), result.batch_nanos.begin(),
+                             result.batch_nanos.end());
   }
 };
 
@@ -85,31 +107,54 @@ Status WaitForReady(FlightClient* client) {
   return Status::IOError("Server was not available after 10 attempts");
 }
 
+// The size of the buffers of an array, including its children
+int64_t GetBufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += GetBufferSize(*child);
+  }
+  return size;
+}
+
+int64_t GetBufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += GetBufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
 arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
+                                              const FlightCallOptions& call_options,
+                                              const std::shared_ptr<Schema>& schema,
                                               const perf::Token& token,
                                               const FlightEndpoint& endpoint) {
   std::unique_ptr<FlightStreamReader> reader;
-  RETURN_NOT_OK(client->DoGet(endpoint.ticket, &reader));
+  RETURN_NOT_OK(client->DoGet(call_options, endpoint.ticket, &reader));
 
   FlightStreamChunk batch;
 
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
-
   // This must also be set in perf_server.cc
   const bool verify = false;
 
-  int64_t num_bytes = 0;
-  int64_t num_records = 0;
+  PerformanceResult result{0, 0, {}};
+  StopWatch timer;
   while (true) {
+    timer.Start();
     RETURN_NOT_OK(reader->Next(&batch));
     if (!batch.data) {
       break;
     }
+    result.batch_nanos.push_back(static_cast<int64_t>(timer.Stop()));
 
     if (verify) {
       auto values = batch.data->column_data(0)->GetValues<int64_t>(1);
-      const int64_t start = token.start() + num_records;
+      const int64_t start = token.start() + result.num_records;
       for (int64_t i = 0; i < batch.data->num_rows(); ++i) {
         if (values[i] != start + i) {
           return Status::Invalid("verification failure");
@@ -117,76 +162,115 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
       }
     }
 
-    num_records += batch.data->num_rows();
-
-    // Hard-coded
-    num_bytes += batch.data->num_rows() * bytes_per_record;
+    result.num_records += batch.data->num_rows();
+    result.num_bytes += GetBufferSize(*batch.data);
   }
-  return PerformanceResult{num_records, num_bytes};
+  return result;
 }
 
 arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
+                                              const FlightCallOptions& call_options,
+                                              const std::shared_ptr<Schema>& schema,
                                               const perf::Token& token,
                                               const FlightEndpoint& endpoint) {
   std::unique_ptr<FlightStreamWriter> writer;
   std::unique_ptr<FlightMetadataReader> reader;
-  std::shared_ptr<Schema> schema =
-      arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                     field("d", int64())});
-  RETURN_NOT_OK(client->DoPut(FlightDescriptor{}, schema, &writer, &reader));
-
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
-
-  int64_t num_bytes = 0;
-  int64_t num_records = 0;
-
-  std::shared_ptr<ResizableBuffer> buffer;
-  std::vector<std::shared_ptr<Array>> arrays;
+  RETURN_NOT_OK(
+      client->DoPut(call_options, FlightDescriptor{}, schema, &writer, &reader));
 
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
-  }
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(MakePerfBatch(schema, length, /*seed=*/0, &batch));
+  const int64_t batch_bytes = GetBufferSize(*batch);
 
-  std::shared_ptr<RecordBatch> batch = RecordBatch::Make(schema, length, arrays);
-
-  int records_sent = 0;
-  const int total_records = token.definition().records_per_stream();
+  PerformanceResult result{0, 0, {}};
+  StopWatch timer;
+  int64_t records_sent = 0;
+  const int64_t total_records = token.definition().records_per_stream();
   while (records_sent < total_records) {
+    timer.Start();
     if (records_sent + length > total_records) {
-      const int last_length = total_records - records_sent;
+      const int64_t last_length = total_records - records_sent;
       RETURN_NOT_OK(writer->WriteRecordBatch(*(batch->Slice(0, last_length))));
-      num_records += last_length;
-      // Hard-coded
-      num_bytes += last_length * bytes_per_record;
+      result.num_records += last_length;
+      result.num_bytes += batch_bytes * last_length / length;
       records_sent += last_length;
     } else {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
-      num_records += length;
-      // Hard-coded
-      num_bytes += length * bytes_per_record;
+      result.num_records += length;
+      result.num_bytes += batch_bytes;
       records_sent += length;
     }
+    result.batch_nanos.push_back(static_cast<int64_t>(timer.Stop()));
   }
 
   RETURN_NOT_OK(writer->Close());
-  return PerformanceResult{num_records, num_bytes};
+  return result;
+}
+
+arrow::Result<Compression::type> GetCompression(const std::string& name) {
+  if (name.empty()) {
+    return Compression::UNCOMPRESSED;
+  } else if (name == "lz4") {
+    return Compression::LZ4;
+  } else if (name == "zstd") {
+    return Compression::ZSTD;
+  }
+  return Status::Invalid("Unsupported compression: ", name);
+}
+
+Status GetClientOptions(FlightClientOptions* options) {
+  if (!FLAGS_tls) {
+    return Status::OK();
+  }
+  if (FLAGS_cert_file.empty()) {
+    CertKeyPair root;
+    RETURN_NOT_OK(ExampleTlsCertificateRoot(&root));
+    options->tls_root_certs = root.pem_cert;
+    return Status::OK();
+  }
+  std::ifstream cert_file(FLAGS_cert_file);
+  if (!cert_file) {
+    return Status::IOError("Could not open certificate: ", FLAGS_cert_file);
+  }
+  std::stringstream cert;
+  cert << cert_file.rdbuf();
+  options->tls_root_certs = cert.str();
+  return Status::OK();
+}
+
+void PrintStats(const std::string& method, PerformanceStats* stats,
+                double time_elapsed) {
+  constexpr double kMegabyte = static_cast<double>(1 << 20);
+
+  std::cout << method << " bytes: " << stats->total_bytes << std::endl;
+  std::cout << method << " speed: "
+            << (static_cast<double>(stats->total_bytes) / kMegabyte / time_elapsed)
+            << " MB/s" << std::endl;
+
+  auto& nanos = stats->batch_nanos;
+  if (nanos.empty()) {
+    return;
+  }
+  std::sort(nanos.begin(), nanos.end());
+  auto percentile = [&nanos](double p) {
+    const auto index = static_cast<size_t>(p * static_cast<double>(nanos.size()));
+    return static_cast<double>(nanos[std::min(index, nanos.size() - 1)]) / 1000;
+  };
+  std::cout << method << " batch latency (us): p50 " << percentile(0.5) << ", p90 "
+            << percentile(0.9) << ", p99 " << percentile(0.99) << ", max "
+            << percentile(1.0) << std::endl;
 }
 
-Status RunPerformanceTest(FlightClient* client, bool test_put) {
+Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& options) {
   // TODO(wesm): Multiple servers
   // std::vector<std::unique_ptr<TestServer>> servers;
 
-  // schema not needed
   perf::Perf perf;
   perf.set_stream_count(FLAGS_num_streams);
   perf.set_records_per_stream(FLAGS_records_per_stream);
   perf.set_records_per_batch(FLAGS_records_per_batch);
+  perf.set_schema_name(FLAGS_schema);
 
   // Plan the query
   FlightDescriptor descriptor;
@@ -201,20 +285,28 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   ipc::DictionaryMemo dict_memo;
   RETURN_NOT_OK(plan->GetSchema(&dict_memo, &schema));
 
-  PerformanceStats stats;
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
-  auto ConsumeStream = [&stats, &test_loop](const FlightEndpoint& endpoint) {
+  FlightCallOptions call_options;
+  ARROW_ASSIGN_OR_RAISE(call_options.compression, GetCompression(FLAGS_compression));
+
+  PerformanceStats get_stats;
+  PerformanceStats put_stats;
+  auto ConsumeStream = [&](const FlightEndpoint& endpoint, bool test_put) {
     // TODO(wesm): Use location from endpoint, same host/port for now
-    std::unique_ptr<FlightClient> client;
-    RETURN_NOT_OK(FlightClient::Connect(endpoint.locations.front(), &client));
+    std::unique_ptr<FlightClient> stream_client;
+    if (!FLAGS_share_client) {
+      RETURN_NOT_OK(
+          FlightClient::Connect(endpoint.locations.front(), options, &stream_client));
+    }
 
     perf::Token token;
     token.ParseFromString(endpoint.ticket.ticket);
 
-    const auto& result = test_loop(client.get(), token, endpoint);
+    auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
+    const auto& result =
+        test_loop(FLAGS_share_client ? client : stream_client.get(), call_options,
+                  schema, token, endpoint);
     if (result.ok()) {
-      const PerformanceResult& perf = result.ValueOrDie();
-      stats.Update(perf.num_records, perf.num_bytes);
+      (test_put ? put_stats : get_stats).Update(result.ValueOrDie());
     }
     return result.status();
   };
@@ -224,19 +316,21 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
 
   // XXX(wesm): Serial version for debugging
   // for (const auto& endpoint : plan->endpoints()) {
-  //   RETURN_NOT_OK(ConsumeStream(endpoint));
+  //   RETURN_NOT_OK(ConsumeStream(endpoint, FLAGS_test_put));
   // }
 
   ARROW_ASSIGN_OR_RAISE(auto pool, ThreadPool::Make(FLAGS_num_threads));
-  std::vector<std::future<Status>> tasks;
-  for (const auto& endpoint : plan->endpoints()) {
-    ARROW_ASSIGN_OR_RAISE(auto task, pool->Submit(ConsumeStream, endpoint));
+  std::vector<Future<>> tasks;
+  for (size_t i = 0; i < plan->endpoints().size(); ++i) {
+    const bool test_put = FLAGS_test_mixed ? i % 2 == 1 : FLAGS_test_put;
+    ARROW_ASSIGN_OR_RAISE(auto task,
+                          pool->Submit(ConsumeStream, plan->endpoints()[i], test_put));
     tasks.push_back(std::move(task));
   }
 
   // Wait for tasks to finish
   for (auto&& task : tasks) {
-    RETURN_NOT_OK(task.get());
+    RETURN_NOT_OK(task.status());
   }
 
   // Elapsed time in seconds
@@ -244,23 +338,19 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   double time_elapsed =
       static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
 
-  constexpr double kMegabyte = static_cast<double>(1 << 20);
-
   // Check that number of rows read / written is as expected
-  if (stats.total_records != static_cast<int64_t>(plan->total_records())) {
+  if (get_stats.total_records + put_stats.total_records !=
+      static_cast<int64_t>(plan->total_records())) {
     return Status::Invalid("Did not consume expected number of records");
   }
 
-  if (FLAGS_test_put) {
-    std::cout << "Bytes written: " << stats.total_bytes << std::endl;
-  } else {
-    std::cout << "Bytes read: " << stats.total_bytes << std::endl;
-  }
-
   std::cout << "Nanos: " << elapsed_nanos << std::endl;
-  std::cout << "Speed: "
-            << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
-            << " MB/s" << std::endl;
+  if (FLAGS_test_mixed || !FLAGS_test_put) {
+    PrintStats("DoGet", &get_stats, time_elapsed);
+  }
+  if (FLAGS_test_mixed || FLAGS_test_put) {
+    PrintStats("DoPut", &put_stats, time_elapsed);
+  }
   return Status::OK();
 }
 
@@ -274,8 +364,12 @@ int main(int argc, char** argv) {
   std::string hostname = "localhost";
   if (FLAGS_server_host == "") {
     std::cout << "Using standalone server: false" << std::endl;
-    server.reset(
-        new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
+    std::vector<std::string> server_args;
+    if (FLAGS_tls) {
+      server_args.push_back("-tls");
+    }
+    server.reset(new arrow::flight::TestServer("arrow-flight-perf-server",
+                                               FLAGS_server_port, server_args));
     server->Start();
   } else {
     std::cout << "Using standalone server: true" << std::endl;
@@ -283,7 +377,9 @@ int main(int argc, char** argv) {
   }
 
   std::cout << "Testing method: ";
-  if (FLAGS_test_put) {
+  if (FLAGS_test_mixed) {
+    std::cout << "DoGet and DoPut";
+  } else if (FLAGS_test_put) {
     std::cout << "DoPut";
   } else {
     std::cout << "DoGet";
@@ -291,16 +387,30 @@ int main(int argc, char** argv) {
   std::cout << std::endl;
 
   std::cout << "Server host: " << hostname << std::endl
-            << "Server port: " << FLAGS_server_port << std::endl;
+            << "Server port: " << FLAGS_server_port << std::endl
+            << "Schema: " << FLAGS_schema << std::endl
+            << "Concurrent streams: " << FLAGS_num_threads
+            << (FLAGS_share_client ? " (shared client)" : "") << std::endl
+            << "TLS: " << (FLAGS_tls ? "on" : "off") << std::endl
+            << "Compression: "
+            << (FLAGS_compression.empty() ? "none" : FLAGS_compression) << std::endl;
+
+  arrow::flight::FlightClientOptions options;
+  ABORT_NOT_OK(arrow::flight::GetClientOptions(&options));
 
   std::unique_ptr<arrow::flight::FlightClient> client;
   arrow::flight::Location location;
-  ABORT_NOT_OK(
-      arrow::flight::Location::ForGrpcTcp(hostname, FLAGS_server_port, &location));
-  ABORT_NOT_OK(arrow::flight::FlightClient::Connect(location, &client));
+  if (FLAGS_tls) {
+    ABORT_NOT_OK(
+        arrow::flight::Location::ForGrpcTls(hostname, FLAGS_server_port, &location));
+  } else {
+    ABORT_NOT_OK(
+        arrow::flight::Location::ForGrpcTcp(hostname, FLAGS_server_port, &location));
+  }
+  ABORT_NOT_OK(arrow::flight::FlightClient::Connect(location, options, &client));
   ABORT_NOT_OK(arrow::flight::WaitForReady(client.get()));
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), FLAGS_test_put);
+  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), options);
 
   if (server) {
     server->Stop();
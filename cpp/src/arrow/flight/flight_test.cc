@@ -15,13 +15,17 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -34,7 +38,10 @@
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/flight/api.h"
 
@@ -44,8 +51,14 @@
 
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware_internal.h"
+#include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/test_util.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 namespace pb = arrow::flight::protocol;
 
 namespace arrow {
@@ -442,6 +455,260 @@ class MetadataTestServer : public FlightServerBase {
   }
 };
 
+class DoExchangeTestServer : public FlightServerBase {
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    const FlightDescriptor& descriptor = reader->descriptor();
+    if (descriptor.type != FlightDescriptor::CMD || descriptor.cmd != "echo") {
+      return Status::NotImplemented("Unknown command");
+    }
+    // Send each record batch back as soon as it is received
+    RETURN_NOT_OK(writer->Begin(reader->schema()));
+    FlightStreamChunk chunk;
+    int counter = 0;
+    while (true) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (chunk.data == nullptr) break;
+      RETURN_NOT_OK(writer->WriteWithMetadata(
+          *chunk.data, Buffer::FromString(std::to_string(counter))));
+      counter++;
+    }
+    return Status::OK();
+  }
+};
+
+// A RecordBatchStream recording the compression negotiated with the client
+class CompressionCheckingStream : public RecordBatchStream {
+ public:
+  CompressionCheckingStream(const std::shared_ptr<RecordBatchReader>& reader,
+                            Compression::type* codec)
+      : RecordBatchStream(reader), codec_(codec) {}
+
+  Status SetCompression(Compression::type codec, int compression_level) override {
+    *codec_ = codec;
+    return RecordBatchStream::SetCompression(codec, compression_level);
+  }
+
+ private:
+  Compression::type* codec_;
+};
+
+class CompressionTestServer : public FlightServerBase {
+ public:
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    BatchVector batches;
+    RETURN_NOT_OK(ExampleIntBatches(&batches));
+    std::shared_ptr<RecordBatchReader> batch_reader =
+        std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+    compression_ = Compression::UNCOMPRESSED;
+    *data_stream = std::unique_ptr<FlightDataStream>(
+        new CompressionCheckingStream(batch_reader, &compression_));
+    return Status::OK();
+  }
+
+  Status DoPut(const ServerCallContext& context,
+               std::unique_ptr<FlightMessageReader> reader,
+               std::unique_ptr<FlightMetadataWriter> writer) override {
+    return reader->ReadAll(&batches_);
+  }
+
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    RETURN_NOT_OK(writer->Begin(reader->schema()));
+    FlightStreamChunk chunk;
+    while (true) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (chunk.data == nullptr) break;
+      RETURN_NOT_OK(writer->WriteRecordBatch(*chunk.data));
+    }
+    return Status::OK();
+  }
+
+  Compression::type compression_ = Compression::UNCOMPRESSED;
+  BatchVector batches_;
+};
+
+// The batches of each endpoint hold the values 100 * endpoint + i
+Status MakeEndpointBatches(int endpoint, BatchVector* out) {
+  auto schema = ::arrow::schema({field("f0", int32())});
+  for (int i = 0; i < 3; ++i) {
+    auto array = ArrayFromJSON(int32(), "[" + std::to_string(100 * endpoint + i) + "]");
+    out->push_back(RecordBatch::Make(schema, 1, {array}));
+  }
+  return Status::OK();
+}
+
+class EndpointsTestServer : public FlightServerBase {
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    if (request.ticket == "error") {
+      return Status::IOError("Endpoint not available");
+    }
+    BatchVector batches;
+    RETURN_NOT_OK(MakeEndpointBatches(std::stoi(request.ticket), &batches));
+    std::shared_ptr<RecordBatchReader> batch_reader =
+        std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+    *data_stream = std::unique_ptr<FlightDataStream>(new RecordBatchStream(batch_reader));
+    return Status::OK();
+  }
+};
+
+class MetricsTestServer : public EndpointsTestServer {
+  Status DoPut(const ServerCallContext& context,
+               std::unique_ptr<FlightMessageReader> reader,
+               std::unique_ptr<FlightMetadataWriter> writer) override {
+    BatchVector batches;
+    return reader->ReadAll(&batches);
+  }
+};
+
+// Holds back the payloads of the streams until opened, then produces them on
+// a separate thread
+class PayloadGate {
+ public:
+  PayloadGate() : pool_(arrow::internal::ThreadPool::Make(1).ValueOrDie()) {}
+
+  void Submit(std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (open_) {
+      ARROW_EXPECT_OK(pool_->Spawn(std::move(task)));
+    } else {
+      pending_.push_back(std::move(task));
+    }
+  }
+
+  void Open() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    open_ = true;
+    for (auto& task : pending_) {
+      ARROW_EXPECT_OK(pool_->Spawn(std::move(task)));
+    }
+    pending_.clear();
+  }
+
+  size_t num_pending() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+  }
+
+ private:
+  std::shared_ptr<arrow::internal::ThreadPool> pool_;
+  std::mutex mutex_;
+  bool open_ = false;
+  std::vector<std::function<void()>> pending_;
+};
+
+// A stream whose payloads are produced through a PayloadGate
+class GatedStream : public FlightDataStream {
+ public:
+  GatedStream(const std::shared_ptr<RecordBatchReader>& reader, PayloadGate* gate,
+              bool fail)
+      : stream_(reader), gate_(gate), fail_(fail) {}
+
+  std::shared_ptr<Schema> schema() override { return stream_.schema(); }
+
+  Status GetSchemaPayload(FlightPayload* payload) override {
+    return stream_.GetSchemaPayload(payload);
+  }
+
+  Status Next(FlightPayload* payload) override {
+    return Status::NotImplemented("Only NextAsync should be called");
+  }
+
+  Future<FlightPayload> NextAsync() override {
+    auto future = Future<FlightPayload>::Make();
+    gate_->Submit([this, future]() mutable {
+      FlightPayload payload;
+      Status status = fail_ ? Status::IOError("Producer failed") : stream_.Next(&payload);
+      if (status.ok()) {
+        future.MarkFinished(std::move(payload));
+      } else {
+        future.MarkFinished(status);
+      }
+    });
+    return future;
+  }
+
+ private:
+  RecordBatchStream stream_;
+  PayloadGate* gate_;
+  bool fail_;
+};
+
+// Tickets are "error", "sync-<endpoint>" for a RecordBatchStream,
+// "<endpoint>" for a GatedStream and "fail" for a GatedStream failing
+class AsyncDoGetTestServer : public FlightServerBase {
+ public:
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    if (request.ticket == "error") {
+      return Status::IOError("Unknown ticket");
+    }
+    const bool sync = request.ticket.compare(0, 5, "sync-") == 0;
+    const bool fail = request.ticket == "fail";
+    BatchVector batches;
+    RETURN_NOT_OK(MakeEndpointBatches(
+        fail ? 0 : std::stoi(request.ticket.substr(sync ? 5 : 0)), &batches));
+    std::shared_ptr<RecordBatchReader> batch_reader =
+        std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+    if (sync) {
+      data_stream->reset(new RecordBatchStream(batch_reader));
+    } else {
+      data_stream->reset(new GatedStream(batch_reader, &gate_, fail));
+    }
+    return Status::OK();
+  }
+
+  PayloadGate gate_;
+};
+
+// Acknowledges each record batch written with DoPut by writing its index,
+// once allowed to
+class PutWindowTestServer : public FlightServerBase {
+ public:
+  Status DoPut(const ServerCallContext& context,
+               std::unique_ptr<FlightMessageReader> reader,
+               std::unique_ptr<FlightMetadataWriter> writer) override {
+    FlightStreamChunk chunk;
+    for (int index = 0;; ++index) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (!chunk.data) break;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return allowed_acks_ > 0; });
+        --allowed_acks_;
+      }
+      RETURN_NOT_OK(writer->WriteMetadata(*Buffer::FromString(std::to_string(index))));
+    }
+    return Status::OK();
+  }
+
+  void AllowAcks(int count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    allowed_acks_ += count;
+    cv_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  int allowed_acks_ = 0;
+};
+
+// Returns the address of the client with the "peer" action
+class PeerTestServer : public FlightServerBase {
+ public:
+  Status DoAction(const ServerCallContext& context, const Action& action,
+                  std::unique_ptr<ResultStream>* result) override {
+    std::string peer = context.peer();
+    result->reset(new SimpleResultStream({Result{Buffer::FromString(std::move(peer))}}));
+    return Status::OK();
+  }
+};
+
 class TestMetadata : public ::testing::Test {
  public:
   void SetUp() {
@@ -457,6 +724,66 @@ class TestMetadata : public ::testing::Test {
   std::unique_ptr<FlightServerBase> server_;
 };
 
+#ifndef _WIN32
+class TestSharedMemory : public ::testing::Test {
+ public:
+  void SetUp() {
+    std::stringstream path;
+    path << "/tmp/arrow-flight-shm-test-" << getpid() << ".sock";
+    socket_path_ = path.str();
+  }
+
+  void TearDown() {
+    if (server_) {
+      ASSERT_OK(server_->Shutdown());
+    }
+    std::remove(socket_path_.c_str());
+  }
+
+  void StartServer(bool shared_memory) {
+    Location location;
+    if (shared_memory) {
+      ASSERT_OK(Location::ForGrpcShm(socket_path_, &location));
+    } else {
+      ASSERT_OK(Location::ForGrpcUnix(socket_path_, &location));
+    }
+    server_.reset(new MetadataTestServer);
+    ASSERT_OK(server_->Init(FlightServerOptions(location)));
+  }
+
+  void ConnectClient(int64_t shared_memory_size) {
+    Location location;
+    ASSERT_OK(Location::ForGrpcShm(socket_path_, &location));
+    FlightClientOptions options;
+    options.shared_memory_size = shared_memory_size;
+    ASSERT_OK(FlightClient::Connect(location, options, &client_));
+  }
+
+  void CheckDoGet() {
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(Ticket{""}, &stream));
+
+    BatchVector expected_batches;
+    ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+    FlightStreamChunk chunk;
+    for (size_t i = 0; i < expected_batches.size(); ++i) {
+      ASSERT_OK(stream->Next(&chunk));
+      ASSERT_NE(nullptr, chunk.data);
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *chunk.data);
+      ASSERT_EQ(std::to_string(i), chunk.app_metadata->ToString());
+    }
+    ASSERT_OK(stream->Next(&chunk));
+    ASSERT_EQ(nullptr, chunk.data);
+  }
+
+ protected:
+  std::string socket_path_;
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+#endif
+
 class TestAuthHandler : public ::testing::Test {
  public:
   void SetUp() {
@@ -537,6 +864,227 @@ class TestDoPut : public ::testing::Test {
   DoPutTestServer* do_put_server_;
 };
 
+class TestDoExchange : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<DoExchangeTestServer>(
+        &server_, &client_, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+class TestCompression : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<CompressionTestServer>(
+        &server_, &client_,
+        [](FlightServerOptions* options) {
+          options->compression_codecs = {Compression::ZSTD};
+          return Status::OK();
+        },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+    compression_server_ = static_cast<CompressionTestServer*>(server_.get());
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+  void CheckDoGet(const FlightCallOptions& call_options) {
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(call_options, Ticket{""}, &stream));
+    BatchVector expected_batches, batches;
+    ASSERT_OK(ExampleIntBatches(&expected_batches));
+    ASSERT_OK(stream->ReadAll(&batches));
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+  CompressionTestServer* compression_server_;
+};
+
+class TestDoGetEndpoints : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<EndpointsTestServer>(
+        &server_, &client_, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+    ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location_));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+  // Endpoints with even indices are read through the test client, the
+  // others through a new connection
+  std::unique_ptr<FlightInfo> MakeInfo(const std::vector<std::string>& tickets) {
+    std::vector<FlightEndpoint> endpoints;
+    for (size_t i = 0; i < tickets.size(); ++i) {
+      FlightEndpoint endpoint{{tickets[i]}, {}};
+      if (i % 2 == 1) {
+        endpoint.locations.push_back(location_);
+      }
+      endpoints.push_back(endpoint);
+    }
+    FlightInfo::Data data;
+    ARROW_EXPECT_OK(MakeFlightInfo(*::arrow::schema({field("f0", int32())}),
+                                   FlightDescriptor{}, endpoints, -1, -1, &data));
+    return std::unique_ptr<FlightInfo>(new FlightInfo(data));
+  }
+
+  void ReadValues(const FlightEndpointsReadOptions& options, const FlightInfo& info,
+                  std::vector<int32_t>* values) {
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(client_->DoGetEndpoints(options, info, &reader));
+    BatchVector batches;
+    ASSERT_OK(reader->ReadAll(&batches));
+    for (const auto& batch : batches) {
+      values->push_back(
+          arrow::internal::checked_cast<const Int32Array&>(*batch->column(0)).Value(0));
+    }
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+  Location location_;
+};
+
+class TestCallMetrics : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<MetricsTestServer>(
+        &server_, &client_,
+        [this](FlightServerOptions* options) {
+          options->middleware.push_back(
+              {"metrics",
+               std::make_shared<ServerMetricsMiddlewareFactory>(server_sink_)});
+          return Status::OK();
+        },
+        [this](FlightClientOptions* options) {
+          options->middleware.push_back(
+              std::make_shared<ClientMetricsMiddlewareFactory>(client_sink_));
+          return Status::OK();
+        }));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+  std::shared_ptr<TotalCallMetricsSink> server_sink_ =
+      std::make_shared<TotalCallMetricsSink>();
+  std::shared_ptr<TotalCallMetricsSink> client_sink_ =
+      std::make_shared<TotalCallMetricsSink>();
+};
+
+class TestAsyncDoGet : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<AsyncDoGetTestServer>(
+        &server_, &client_,
+        [](FlightServerOptions* options) {
+          options->async_do_get = true;
+          options->async_do_get_threads = 1;
+          return Status::OK();
+        },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+    gate_ = &arrow::internal::checked_cast<AsyncDoGetTestServer*>(server_.get())->gate_;
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+  void CheckValues(int endpoint, FlightStreamReader* stream) {
+    BatchVector batches;
+    ASSERT_OK(stream->ReadAll(&batches));
+    ASSERT_EQ(3, batches.size());
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_EQ(100 * endpoint + i,
+                arrow::internal::checked_cast<const Int32Array&>(*batches[i]->column(0))
+                    .Value(0));
+    }
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+  PayloadGate* gate_;
+};
+
+class TestPutWindow : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<PutWindowTestServer>(
+        &server_, &client_, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+    ASSERT_OK(MakeEndpointBatches(0, &batches_));
+  }
+
+  void TearDown() {
+    AllowAcks(1000);
+    ASSERT_OK(server_->Shutdown());
+  }
+
+  void AllowAcks(int count) {
+    arrow::internal::checked_cast<PutWindowTestServer*>(server_.get())->AllowAcks(count);
+  }
+
+  void DoPut(const FlightCallOptions& options) {
+    ASSERT_OK(client_->DoPut(options, FlightDescriptor::Path({"window"}),
+                             batches_[0]->schema(), &writer_, &reader_));
+  }
+
+  void AssertNextAck(const std::string& expected) {
+    std::shared_ptr<Buffer> ack;
+    ASSERT_OK(reader_->ReadMetadata(&ack));
+    ASSERT_NE(nullptr, ack);
+    ASSERT_EQ(expected, ack->ToString());
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+  BatchVector batches_;
+  std::unique_ptr<FlightStreamWriter> writer_;
+  std::unique_ptr<FlightMetadataReader> reader_;
+};
+
+class TestChannelPool : public ::testing::Test {
+ public:
+  void SetUp() {
+    std::unique_ptr<FlightClient> client;
+    ASSERT_OK(MakeServer<PeerTestServer>(
+        &server_, &client, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+    ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location_));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+  void GetPeer(FlightClient* client, std::string* peer) {
+    std::unique_ptr<ResultStream> results;
+    ASSERT_OK(client->DoAction(Action{"peer", nullptr}, &results));
+    std::unique_ptr<Result> result;
+    ASSERT_OK(results->Next(&result));
+    ASSERT_NE(nullptr, result);
+    *peer = result->body->ToString();
+  }
+
+ protected:
+  std::unique_ptr<FlightServerBase> server_;
+  Location location_;
+  std::shared_ptr<FlightChannelPool> pool_ = std::make_shared<FlightChannelPool>();
+};
+
 class TestTls : public ::testing::Test {
  public:
   void SetUp() {
@@ -1055,6 +1603,92 @@ TEST_F(TestDoPut, DoPutDicts) {
   CheckDoPut(descr, schema, batches);
 }
 
+TEST_F(TestDoExchange, Pipelined) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"), batches[0]->schema(),
+                                &writer, &reader));
+
+  // Each batch is sent back before the next one is written
+  FlightStreamChunk chunk;
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batches[i]));
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*batches[i], *chunk.data);
+    ASSERT_NE(nullptr, chunk.app_metadata);
+    ASSERT_EQ(std::to_string(i), chunk.app_metadata->ToString());
+  }
+  AssertSchemaEqual(*batches[0]->schema(), *reader->schema());
+  ASSERT_OK(writer->DoneWriting());
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, Dicts) {
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"), batches[0]->schema(),
+                                &writer, &reader));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->DoneWriting());
+
+  BatchVector received;
+  ASSERT_OK(reader->ReadAll(&received));
+  ASSERT_EQ(batches.size(), received.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*batches[i], *received[i]);
+  }
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, NoBatches) {
+  auto schema = ExampleIntSchema();
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(
+      client_->DoExchange(FlightDescriptor::Command("echo"), schema, &writer, &reader));
+  ASSERT_OK(writer->DoneWriting());
+  // The server gets the schema without any record batch
+  AssertSchemaEqual(*schema, *reader->schema());
+  FlightStreamChunk chunk;
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, CloseWithoutReading) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"), batches[0]->schema(),
+                                &writer, &reader));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  // Unread batches are drained
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, ServerError) {
+  auto schema = ExampleIntSchema();
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("unknown"), schema, &writer,
+                                &reader));
+  FlightStreamChunk chunk;
+  ASSERT_RAISES(NotImplemented, reader->Next(&chunk));
+  ASSERT_RAISES(NotImplemented, writer->Close());
+}
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {},
@@ -1362,6 +1996,571 @@ TEST_F(TestMetadata, DoPutReadMetadata) {
   ASSERT_OK(writer->Close());
 }
 
+#ifndef _WIN32
+TEST_F(TestSharedMemory, DoGet) {
+  StartServer(true);
+  ConnectClient(1 << 20);
+  CheckDoGet();
+  // Streams can be read again with a new segment
+  CheckDoGet();
+}
+
+TEST_F(TestSharedMemory, SmallRing) {
+  // Bodies don't all fit, some are sent inline
+  StartServer(true);
+  ConnectClient(512);
+  CheckDoGet();
+}
+
+TEST_F(TestSharedMemory, ServerWithoutSharedMemory) {
+  StartServer(false);
+  ConnectClient(1 << 20);
+  CheckDoGet();
+}
+
+// Make a record batch payload with one body buffer of the given size
+FlightPayload MakeBodyPayload(int64_t size, uint8_t fill) {
+  FlightPayload payload;
+  payload.ipc_message.type = ipc::Message::RECORD_BATCH;
+  std::string body(static_cast<size_t>(size), static_cast<char>(fill));
+  payload.ipc_message.body_buffers.push_back(Buffer::FromString(std::move(body)));
+  payload.ipc_message.body_length = BitUtil::RoundUpToMultipleOf8(size);
+  return payload;
+}
+
+// Serialize a payload body as sent on a gRPC call
+std::shared_ptr<Buffer> SerializeBody(const FlightPayload& payload) {
+  std::string body;
+  for (const auto& buffer : payload.ipc_message.body_buffers) {
+    body += buffer->ToString();
+    body.resize(BitUtil::RoundUpToMultipleOf8(body.size()), '\0');
+  }
+  return Buffer::FromString(std::move(body));
+}
+
+TEST(TestSharedMemoryRing, ShareAndResolve) {
+  std::unique_ptr<internal::SharedMemoryRing> reader;
+  std::unique_ptr<internal::SharedMemoryRing> writer;
+  ASSERT_OK(internal::SharedMemoryRing::Create(256, &reader));
+  ASSERT_OK(internal::SharedMemoryRing::Open(reader->name(), &writer));
+  ASSERT_OK(writer->Unlink());
+  ASSERT_EQ(256, writer->capacity());
+
+  std::vector<std::shared_ptr<Buffer>> sent;
+  std::vector<std::shared_ptr<Buffer>> expected;
+  for (uint8_t i = 0; i < 3; ++i) {
+    auto payload = MakeBodyPayload(100, i);
+    expected.push_back(SerializeBody(payload));
+    ASSERT_OK(writer->ShareBody(&payload));
+    sent.push_back(SerializeBody(payload));
+  }
+  // The first two bodies fit in the ring, the third is sent inline
+  ASSERT_EQ(24, sent[0]->size());
+  ASSERT_EQ(24, sent[1]->size());
+  ASSERT_EQ(8 + 104, sent[2]->size());
+
+  for (size_t i = 0; i < sent.size(); ++i) {
+    ASSERT_OK(reader->ResolveBody(default_memory_pool(), &sent[i]));
+    AssertBufferEqual(*expected[i], *sent[i]);
+  }
+
+  // Released space is reused, wrapping around to the start of the ring
+  auto payload = MakeBodyPayload(100, 3);
+  auto expected_body = SerializeBody(payload);
+  ASSERT_OK(writer->ShareBody(&payload));
+  auto body = SerializeBody(payload);
+  ASSERT_EQ(24, body->size());
+  ASSERT_OK(reader->ResolveBody(default_memory_pool(), &body));
+  AssertBufferEqual(*expected_body, *body);
+
+  // Schema messages have no body
+  FlightPayload schema_payload;
+  schema_payload.ipc_message.type = ipc::Message::SCHEMA;
+  ASSERT_OK(writer->ShareBody(&schema_payload));
+  ASSERT_EQ(0, schema_payload.ipc_message.body_buffers.size());
+}
+
+TEST(TestSharedMemoryRing, InvalidBody) {
+  std::unique_ptr<internal::SharedMemoryRing> reader;
+  ASSERT_OK(internal::SharedMemoryRing::Create(256, &reader));
+
+  auto body = Buffer::FromString("abc");
+  ASSERT_RAISES(IOError, reader->ResolveBody(default_memory_pool(), &body));
+  const uint64_t reference[3] = {1, 200, 100};
+  body = Buffer::FromString(
+      std::string(reinterpret_cast<const char*>(reference), sizeof(reference)));
+  ASSERT_RAISES(IOError, reader->ResolveBody(default_memory_pool(), &body));
+
+  std::unique_ptr<internal::SharedMemoryRing> writer;
+  ASSERT_RAISES(IOError, internal::SharedMemoryRing::Open("/arrow-flight-missing",
+                                                          &writer));
+}
+
+// Serialize a record batch to a gRPC byte buffer, optionally re-split into
+// slices of the given size
+void SerializeBatch(const RecordBatch& batch, int64_t slice_size,
+                    grpc::ByteBuffer* out) {
+  FlightPayload payload;
+  ASSERT_OK(ipc::internal::GetRecordBatchPayload(batch, ipc::IpcOptions::Defaults(),
+                                                 default_memory_pool(),
+                                                 &payload.ipc_message));
+  bool own_buffer;
+  ASSERT_TRUE(internal::FlightDataSerialize(payload, out, &own_buffer).ok());
+  if (slice_size <= 0) {
+    return;
+  }
+  std::vector<grpc::Slice> slices;
+  ASSERT_TRUE(out->Dump(&slices).ok());
+  std::string data;
+  for (const auto& slice : slices) {
+    data.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+  }
+  slices.clear();
+  for (size_t pos = 0; pos < data.size(); pos += slice_size) {
+    slices.emplace_back(data.data() + pos,
+                        std::min(data.size() - pos, static_cast<size_t>(slice_size)));
+  }
+  *out = grpc::ByteBuffer(slices.data(), slices.size());
+}
+
+void DeserializeBatch(grpc::ByteBuffer* buffer, const std::shared_ptr<Schema>& schema,
+                      internal::FlightData* data, std::shared_ptr<RecordBatch>* out) {
+  ASSERT_TRUE(internal::FlightDataDeserialize(buffer, data).ok());
+  std::unique_ptr<ipc::Message> message;
+  ASSERT_OK(data->OpenMessage(&message));
+  ipc::DictionaryMemo memo;
+  ASSERT_OK(ipc::ReadRecordBatch(*message, schema, &memo, out));
+}
+
+TEST(TestFlightDataDeserialize, ReferenceSlices) {
+  std::shared_ptr<RecordBatch> batch, result;
+  ASSERT_OK(ipc::test::MakeIntBatchSized(1024, &batch));
+
+  // Each body buffer is sent in its own slice, without padding
+  grpc::ByteBuffer buffer;
+  SerializeBatch(*batch, 0, &buffer);
+  auto before = internal::GetReceiveStats();
+  internal::FlightData data;
+  DeserializeBatch(&buffer, batch->schema(), &data, &result);
+  auto after = internal::GetReceiveStats();
+  ASSERT_BATCHES_EQUAL(*batch, *result);
+  ASSERT_EQ(nullptr, data.body);
+  ASSERT_GT(data.body_chunks.size(), 1);
+  ASSERT_EQ(before.split_bodies + 1, after.split_bodies);
+  ASSERT_GT(after.zero_copy_buffers, before.zero_copy_buffers);
+  ASSERT_EQ(before.copied_buffers, after.copied_buffers);
+
+  // A single slice
+  SerializeBatch(*batch, 1 << 20, &buffer);
+  before = internal::GetReceiveStats();
+  internal::FlightData contiguous;
+  DeserializeBatch(&buffer, batch->schema(), &contiguous, &result);
+  after = internal::GetReceiveStats();
+  ASSERT_BATCHES_EQUAL(*batch, *result);
+  ASSERT_NE(nullptr, contiguous.body);
+  ASSERT_EQ(before.contiguous_bodies + 1, after.contiguous_bodies);
+}
+
+TEST(TestFlightDataDeserialize, StraddlingBuffers) {
+  std::shared_ptr<RecordBatch> batch, result;
+  ASSERT_OK(ipc::test::MakeIntBatchSized(1000, &batch));
+
+  grpc::ByteBuffer buffer;
+  SerializeBatch(*batch, 7, &buffer);
+  auto before = internal::GetReceiveStats();
+  internal::FlightData data;
+  DeserializeBatch(&buffer, batch->schema(), &data, &result);
+  auto after = internal::GetReceiveStats();
+  ASSERT_BATCHES_EQUAL(*batch, *result);
+  ASSERT_GT(after.copied_buffers, before.copied_buffers);
+  ASSERT_GT(after.copied_bytes, before.copied_bytes);
+
+  // The body can still be made contiguous
+  ASSERT_OK(data.ConsolidateBody());
+  ASSERT_TRUE(data.body_chunks.empty());
+  ASSERT_NE(nullptr, data.body);
+  std::unique_ptr<ipc::Message> message;
+  ASSERT_OK(data.OpenMessage(&message));
+  ipc::DictionaryMemo memo;
+  ASSERT_OK(ipc::ReadRecordBatch(*message, batch->schema(), &memo, &result));
+  ASSERT_BATCHES_EQUAL(*batch, *result);
+}
+#endif
+
+TEST_F(TestCompression, DoGet) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    return;
+  }
+  FlightCallOptions call_options;
+  call_options.compression = Compression::ZSTD;
+  CheckDoGet(call_options);
+  ASSERT_EQ(Compression::ZSTD, compression_server_->compression_);
+}
+
+TEST_F(TestCompression, DoGetDeclined) {
+  // The server doesn't accept this codec, and sends uncompressed data
+  if (!util::Codec::IsAvailable(Compression::LZ4)) {
+    return;
+  }
+  FlightCallOptions call_options;
+  call_options.compression = Compression::LZ4;
+  CheckDoGet(call_options);
+  ASSERT_EQ(Compression::UNCOMPRESSED, compression_server_->compression_);
+
+  CheckDoGet(FlightCallOptions());
+  ASSERT_EQ(Compression::UNCOMPRESSED, compression_server_->compression_);
+}
+
+TEST_F(TestCompression, DoPut) {
+  if (!util::Codec::IsAvailable(Compression::LZ4)) {
+    return;
+  }
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  FlightCallOptions call_options;
+  call_options.compression = Compression::LZ4;
+
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> reader;
+  ASSERT_OK(client_->DoPut(call_options, FlightDescriptor{}, batches[0]->schema(),
+                           &writer, &reader));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+
+  const auto& received = compression_server_->batches_;
+  ASSERT_EQ(batches.size(), received.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*batches[i], *received[i]);
+  }
+}
+
+TEST_F(TestCompression, DoExchange) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    return;
+  }
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  FlightCallOptions call_options;
+  call_options.compression = Compression::ZSTD;
+
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(call_options, FlightDescriptor{}, batches[0]->schema(),
+                                &writer, &reader));
+  FlightStreamChunk chunk;
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*batch, *chunk.data);
+  }
+  ASSERT_OK(writer->DoneWriting());
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestCompression, UnsupportedCodec) {
+  FlightCallOptions call_options;
+  call_options.compression = Compression::SNAPPY;
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_RAISES(Invalid, client_->DoGet(call_options, Ticket{""}, &stream));
+
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> reader;
+  ASSERT_RAISES(Invalid, client_->DoPut(call_options, FlightDescriptor{},
+                                        ExampleIntSchema(), &writer, &reader));
+}
+
+TEST_F(TestDoGetEndpoints, Ordered) {
+  auto info = MakeInfo({"0", "1", "2", "3", "4"});
+  FlightEndpointsReadOptions options;
+  options.max_concurrency = 2;
+  options.max_queued_batches = 1;
+
+  std::vector<int32_t> values;
+  ReadValues(options, *info, &values);
+  std::vector<int32_t> expected;
+  for (int32_t endpoint = 0; endpoint < 5; ++endpoint) {
+    for (int32_t i = 0; i < 3; ++i) {
+      expected.push_back(100 * endpoint + i);
+    }
+  }
+  ASSERT_EQ(expected, values);
+}
+
+TEST_F(TestDoGetEndpoints, Unordered) {
+  auto info = MakeInfo({"0", "1", "2", "3", "4"});
+  FlightEndpointsReadOptions options;
+  options.max_concurrency = 3;
+  options.ordered = false;
+
+  std::vector<int32_t> values;
+  ReadValues(options, *info, &values);
+  std::vector<int32_t> expected;
+  for (int32_t endpoint = 0; endpoint < 5; ++endpoint) {
+    for (int32_t i = 0; i < 3; ++i) {
+      expected.push_back(100 * endpoint + i);
+    }
+  }
+  std::sort(values.begin(), values.end());
+  ASSERT_EQ(expected, values);
+}
+
+TEST_F(TestDoGetEndpoints, NoEndpoints) {
+  auto info = MakeInfo({});
+  std::vector<int32_t> values;
+  ReadValues(FlightEndpointsReadOptions(), *info, &values);
+  ASSERT_TRUE(values.empty());
+}
+
+TEST_F(TestDoGetEndpoints, Error) {
+  auto info = MakeInfo({"0", "1", "error", "3"});
+  for (bool ordered : {true, false}) {
+    FlightEndpointsReadOptions options;
+    options.ordered = ordered;
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(client_->DoGetEndpoints(options, *info, &reader));
+    BatchVector batches;
+    const auto status = reader->ReadAll(&batches);
+    ASSERT_FALSE(status.ok());
+    ASSERT_THAT(status.message(), ::testing::HasSubstr("Failed to read endpoint 2"));
+    ASSERT_THAT(status.message(), ::testing::HasSubstr("Endpoint not available"));
+  }
+
+  FlightEndpointsReadOptions options;
+  options.max_concurrency = 0;
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_RAISES(Invalid, client_->DoGetEndpoints(options, *info, &reader));
+}
+
+TEST_F(TestDoGetEndpoints, StopEarly) {
+  // Destroying the reader cancels the calls in progress
+  auto info = MakeInfo({"0", "1", "2", "3", "4", "5", "6", "7"});
+  FlightEndpointsReadOptions options;
+  options.max_queued_batches = 1;
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(client_->DoGetEndpoints(options, *info, &reader));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_NE(nullptr, batch);
+  reader.reset();
+}
+
+TEST_F(TestCallMetrics, DoGet) {
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client_->DoGet(Ticket{"2"}, &stream));
+  BatchVector batches;
+  ASSERT_OK(stream->ReadAll(&batches));
+  ASSERT_EQ(3, batches.size());
+
+  ASSERT_EQ(1, client_sink_->num_calls(FlightMethod::DoGet));
+  ASSERT_EQ(1, server_sink_->num_calls(FlightMethod::DoGet));
+  const CallMetrics client = client_sink_->total(FlightMethod::DoGet);
+  const CallMetrics server = server_sink_->total(FlightMethod::DoGet);
+  // The schema and the record batches
+  ASSERT_EQ(4, client.messages_received);
+  ASSERT_EQ(3, client.batches_received);
+  ASSERT_EQ(0, client.messages_sent);
+  ASSERT_EQ(4, server.messages_sent);
+  ASSERT_EQ(3, server.batches_sent);
+  ASSERT_EQ(0, server.messages_received);
+  ASSERT_GT(client.bytes_received, 0);
+  ASSERT_EQ(server.bytes_sent, client.bytes_received);
+  ASSERT_GT(client.deserialize_nanos, 0);
+  ASSERT_GT(server.serialize_nanos, 0);
+  ASSERT_GT(server.produce_nanos, 0);
+  ASSERT_GE(client.duration_nanos, client.read_nanos + client.deserialize_nanos);
+  ASSERT_GE(server.duration_nanos,
+            server.write_nanos + server.serialize_nanos + server.produce_nanos);
+}
+
+TEST_F(TestCallMetrics, DoPut) {
+  BatchVector batches;
+  ASSERT_OK(MakeEndpointBatches(1, &batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> reader;
+  ASSERT_OK(client_->DoPut(FlightDescriptor::Path({"metrics"}), batches[0]->schema(),
+                           &writer, &reader));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+
+  ASSERT_EQ(1, client_sink_->num_calls(FlightMethod::DoPut));
+  ASSERT_EQ(1, server_sink_->num_calls(FlightMethod::DoPut));
+  const CallMetrics client = client_sink_->total(FlightMethod::DoPut);
+  const CallMetrics server = server_sink_->total(FlightMethod::DoPut);
+  ASSERT_EQ(4, client.messages_sent);
+  ASSERT_EQ(3, client.batches_sent);
+  ASSERT_EQ(4, server.messages_received);
+  ASSERT_EQ(3, server.batches_received);
+  ASSERT_GT(client.bytes_sent, 0);
+  ASSERT_EQ(client.bytes_sent, server.bytes_received);
+  ASSERT_GT(client.serialize_nanos, 0);
+  ASSERT_GT(server.deserialize_nanos, 0);
+}
+
+TEST_F(TestCallMetrics, FailedCall) {
+  std::unique_ptr<FlightInfo> info;
+  ASSERT_RAISES(NotImplemented,
+                client_->GetFlightInfo(FlightDescriptor::Command(""), &info));
+  ASSERT_EQ(1, client_sink_->num_calls(FlightMethod::GetFlightInfo));
+  ASSERT_EQ(1, server_sink_->num_calls(FlightMethod::GetFlightInfo));
+  const CallMetrics client = client_sink_->total(FlightMethod::GetFlightInfo);
+  ASSERT_EQ(0, client.messages_received);
+  ASSERT_GT(client.duration_nanos, 0);
+}
+
+TEST_F(TestAsyncDoGet, SyncStream) {
+  // The default NextAsync calls Next
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client_->DoGet(Ticket{"sync-3"}, &stream));
+  CheckValues(3, stream.get());
+}
+
+TEST_F(TestAsyncDoGet, IdleStreams) {
+  // Many more streams than polling threads wait for their payloads at once
+  constexpr int kNumStreams = 32;
+  std::vector<std::unique_ptr<FlightStreamReader>> streams(kNumStreams);
+  for (int i = 0; i < kNumStreams; ++i) {
+    ASSERT_OK(client_->DoGet(Ticket{std::to_string(i)}, &streams[i]));
+  }
+  for (int attempt = 0; attempt < 1000 && gate_->num_pending() < kNumStreams;
+       ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(kNumStreams, gate_->num_pending());
+
+  // Meanwhile, other calls are served
+  std::unique_ptr<FlightStreamReader> sync_stream;
+  ASSERT_OK(client_->DoGet(Ticket{"sync-100"}, &sync_stream));
+  CheckValues(100, sync_stream.get());
+
+  gate_->Open();
+  for (int i = 0; i < kNumStreams; ++i) {
+    CheckValues(i, streams[i].get());
+  }
+}
+
+TEST_F(TestAsyncDoGet, Errors) {
+  gate_->Open();
+  std::unique_ptr<FlightStreamReader> stream;
+  BatchVector batches;
+  Status status = client_->DoGet(Ticket{"error"}, &stream);
+  if (status.ok()) {
+    status = stream->ReadAll(&batches);
+  }
+  ASSERT_FALSE(status.ok());
+  ASSERT_THAT(status.message(), ::testing::HasSubstr("Unknown ticket"));
+
+  ASSERT_OK(client_->DoGet(Ticket{"fail"}, &stream));
+  status = stream->ReadAll(&batches);
+  ASSERT_FALSE(status.ok());
+  ASSERT_THAT(status.message(), ::testing::HasSubstr("Producer failed"));
+}
+
+TEST_F(TestPutWindow, Blocking) {
+  FlightCallOptions options;
+  options.put_window = 2;
+  DoPut(options);
+  ASSERT_OK(writer_->WriteRecordBatch(*batches_[0]));
+  ASSERT_OK(writer_->WriteRecordBatch(*batches_[1]));
+
+  // The window is full until the server acknowledges a record batch
+  std::atomic<bool> written(false);
+  std::thread write_thread([&] {
+    ASSERT_OK(writer_->WriteRecordBatch(*batches_[2]));
+    written = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  ASSERT_FALSE(written);
+  AllowAcks(1);
+  write_thread.join();
+  ASSERT_TRUE(written);
+
+  // Acknowledgements read by the writer are still returned
+  AllowAcks(2);
+  ASSERT_OK(writer_->DoneWriting());
+  AssertNextAck("0");
+  AssertNextAck("1");
+  AssertNextAck("2");
+  std::shared_ptr<Buffer> ack;
+  ASSERT_OK(reader_->ReadMetadata(&ack));
+  ASSERT_EQ(nullptr, ack);
+  ASSERT_OK(writer_->Close());
+}
+
+TEST_F(TestPutWindow, NonBlocking) {
+  FlightCallOptions options;
+  options.put_window = 1;
+  options.put_window_blocking = false;
+  DoPut(options);
+  ASSERT_OK(writer_->WriteRecordBatch(*batches_[0]));
+  ASSERT_RAISES(CapacityError, writer_->WriteRecordBatch(*batches_[1]));
+
+  AllowAcks(1);
+  AssertNextAck("0");
+  ASSERT_OK(writer_->WriteRecordBatch(*batches_[1]));
+  AllowAcks(1);
+  AssertNextAck("1");
+  ASSERT_OK(writer_->Close());
+}
+
+TEST_F(TestPutWindow, InvalidWindow) {
+  FlightCallOptions options;
+  options.put_window = -1;
+  ASSERT_RAISES(Invalid, client_->DoPut(options, FlightDescriptor::Path({"window"}),
+                                        batches_[0]->schema(), &writer_, &reader_));
+}
+
+TEST_F(TestChannelPool, SharedChannels) {
+  FlightClientOptions options;
+  options.channel_pool = pool_;
+  std::unique_ptr<FlightClient> client1, client2;
+  ASSERT_OK(FlightClient::Connect(location_, options, &client1));
+  ASSERT_OK(FlightClient::Connect(location_, options, &client2));
+  ASSERT_EQ(1, pool_->size());
+  std::string peer1, peer2;
+  GetPeer(client1.get(), &peer1);
+  GetPeer(client2.get(), &peer2);
+  ASSERT_EQ(peer1, peer2);
+
+  // Other options get other channels
+  options.override_hostname = "localhost";
+  std::unique_ptr<FlightClient> client3;
+  ASSERT_OK(FlightClient::Connect(location_, options, &client3));
+  ASSERT_EQ(2, pool_->size());
+
+  // Clients keep their channels after the pool is cleared
+  pool_->Clear();
+  ASSERT_EQ(0, pool_->size());
+  GetPeer(client1.get(), &peer2);
+  ASSERT_EQ(peer1, peer2);
+}
+
+TEST_F(TestChannelPool, NumChannels) {
+  FlightClientOptions options;
+  options.channel_pool = pool_;
+  options.num_channels = 2;
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location_, options, &client));
+
+  // Calls alternate between two connections
+  std::vector<std::string> peers(4);
+  for (auto& peer : peers) {
+    GetPeer(client.get(), &peer);
+  }
+  ASSERT_NE(peers[0], peers[1]);
+  ASSERT_EQ(peers[0], peers[2]);
+  ASSERT_EQ(peers[1], peers[3]);
+
+  options.num_channels = 0;
+  ASSERT_RAISES(Invalid, FlightClient::Connect(location_, options, &client));
+}
+
 TEST_F(TestRejectServerMiddleware, Rejected) {
   std::unique_ptr<FlightInfo> info;
   const auto& status = client_->GetFlightInfo(FlightDescriptor{}, &info);
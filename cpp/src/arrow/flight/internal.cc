@@ -45,6 +45,7 @@ namespace flight {
 namespace internal {
 
 const char* kGrpcAuthHeader = "auth-token-bin";
+const char* kGrpcCompressionHeader = "arrow-flight-compression";
 
 Status FromGrpcStatus(const grpc::Status& grpc_status) {
   if (grpc_status.ok()) {
@@ -67,6 +67,11 @@ namespace internal {
 ARROW_FLIGHT_EXPORT
 extern const char* kGrpcAuthHeader;
 
+/// The name of the header used to request compressed record batches from
+/// the server.
+ARROW_FLIGHT_EXPORT
+extern const char* kGrpcCompressionHeader;
+
 ARROW_FLIGHT_EXPORT
 Status SchemaToString(const Schema& schema, std::string* out);
 
@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/metrics.h"
+
+#include <string>
+#include <utility>
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+void AddMetrics(const CallMetrics& metrics, CallMetrics* total) {
+  total->messages_sent += metrics.messages_sent;
+  total->messages_received += metrics.messages_received;
+  total->batches_sent += metrics.batches_sent;
+  total->batches_received += metrics.batches_received;
+  total->bytes_sent += metrics.bytes_sent;
+  total->bytes_received += metrics.bytes_received;
+  total->serialize_nanos += metrics.serialize_nanos;
+  total->deserialize_nanos += metrics.deserialize_nanos;
+  total->write_nanos += metrics.write_nanos;
+  total->read_nanos += metrics.read_nanos;
+  total->produce_nanos += metrics.produce_nanos;
+  total->duration_nanos += metrics.duration_nanos;
+}
+
+// Keeps the metrics of the call until it completes
+class ServerMetricsMiddleware : public ServerMiddleware {
+ public:
+  ServerMetricsMiddleware(const CallInfo& info, std::shared_ptr<CallMetricsSink> sink)
+      : info_(info), sink_(std::move(sink)) {}
+
+  std::string name() const override { return "ServerMetricsMiddleware"; }
+
+  void SendingHeaders(AddCallHeaders* outgoing_headers) override {}
+
+  void CallMetricsAvailable(const CallMetrics& metrics) override { metrics_ = metrics; }
+
+  void CallCompleted(const Status& status) override {
+    sink_->Record(info_, metrics_, status);
+  }
+
+ private:
+  CallInfo info_;
+  std::shared_ptr<CallMetricsSink> sink_;
+  CallMetrics metrics_;
+};
+
+class ClientMetricsMiddleware : public ClientMiddleware {
+ public:
+  ClientMetricsMiddleware(const CallInfo& info, std::shared_ptr<CallMetricsSink> sink)
+      : info_(info), sink_(std::move(sink)) {}
+
+  void SendingHeaders(AddCallHeaders* outgoing_headers) override {}
+
+  void ReceivedHeaders(const CallHeaders& incoming_headers) override {}
+
+  void CallMetricsAvailable(const CallMetrics& metrics) override { metrics_ = metrics; }
+
+  void CallCompleted(const Status& status) override {
+    sink_->Record(info_, metrics_, status);
+  }
+
+ private:
+  CallInfo info_;
+  std::shared_ptr<CallMetricsSink> sink_;
+  CallMetrics metrics_;
+};
+
+}  // namespace
+
+CallMetricsSink::~CallMetricsSink() = default;
+
+void TotalCallMetricsSink::Record(const CallInfo& info, const CallMetrics& metrics,
+                                  const Status& status) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++num_calls_[info.method];
+  AddMetrics(metrics, &totals_[info.method]);
+}
+
+int64_t TotalCallMetricsSink::num_calls(FlightMethod method) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = num_calls_.find(method);
+  return it == num_calls_.end() ? 0 : it->second;
+}
+
+CallMetrics TotalCallMetricsSink::total(FlightMethod method) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = totals_.find(method);
+  return it == totals_.end() ? CallMetrics() : it->second;
+}
+
+ServerMetricsMiddlewareFactory::ServerMetricsMiddlewareFactory(
+    std::shared_ptr<CallMetricsSink> sink)
+    : sink_(std::move(sink)) {}
+
+Status ServerMetricsMiddlewareFactory::StartCall(
+    const CallInfo& info, const CallHeaders& incoming_headers,
+    std::shared_ptr<ServerMiddleware>* middleware) {
+  *middleware = std::make_shared<ServerMetricsMiddleware>(info, sink_);
+  return Status::OK();
+}
+
+ClientMetricsMiddlewareFactory::ClientMetricsMiddlewareFactory(
+    std::shared_ptr<CallMetricsSink> sink)
+    : sink_(std::move(sink)) {}
+
+void ClientMetricsMiddlewareFactory::StartCall(
+    const CallInfo& info, std::unique_ptr<ClientMiddleware>* middleware) {
+  middleware->reset(new ClientMetricsMiddleware(info, sink_));
+}
+
+}  // namespace flight
+}  // namespace arrow
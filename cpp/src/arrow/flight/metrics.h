@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Built-in middleware recording the data transfer metrics of Flight
+// calls. Currently experimental.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "arrow/flight/client_middleware.h"
+#include "arrow/flight/middleware.h"
+#include "arrow/flight/server_middleware.h"
+#include "arrow/flight/visibility.h"  // IWYU pragma: keep
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief A destination for the metrics of completed calls.
+class ARROW_FLIGHT_EXPORT CallMetricsSink {
+ public:
+  virtual ~CallMetricsSink();
+
+  /// \brief Record the metrics of a completed call.
+  ///
+  /// Called from the thread completing the call, possibly concurrently
+  /// for several calls.
+  virtual void Record(const CallInfo& info, const CallMetrics& metrics,
+                      const Status& status) = 0;
+};
+
+/// \brief A sink summing the metrics of the calls of each method.
+class ARROW_FLIGHT_EXPORT TotalCallMetricsSink : public CallMetricsSink {
+ public:
+  void Record(const CallInfo& info, const CallMetrics& metrics,
+              const Status& status) override;
+
+  /// \brief The number of calls of the method recorded so far.
+  int64_t num_calls(FlightMethod method) const;
+
+  /// \brief The sum of the metrics of the calls of the method recorded so
+  /// far.
+  CallMetrics total(FlightMethod method) const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<FlightMethod, int64_t> num_calls_;
+  std::map<FlightMethod, CallMetrics> totals_;
+};
+
+/// \brief Server middleware sending the metrics of every call to a sink.
+class ARROW_FLIGHT_EXPORT ServerMetricsMiddlewareFactory
+    : public ServerMiddlewareFactory {
+ public:
+  explicit ServerMetricsMiddlewareFactory(std::shared_ptr<CallMetricsSink> sink);
+
+  Status StartCall(const CallInfo& info, const CallHeaders& incoming_headers,
+                   std::shared_ptr<ServerMiddleware>* middleware) override;
+
+ private:
+  std::shared_ptr<CallMetricsSink> sink_;
+};
+
+/// \brief Client middleware sending the metrics of every call to a sink.
+class ARROW_FLIGHT_EXPORT ClientMetricsMiddlewareFactory
+    : public ClientMiddlewareFactory {
+ public:
+  explicit ClientMetricsMiddlewareFactory(std::shared_ptr<CallMetricsSink> sink);
+
+  void StartCall(const CallInfo& info,
+                 std::unique_ptr<ClientMiddleware>* middleware) override;
+
+ private:
+  std::shared_ptr<CallMetricsSink> sink_;
+};
+
+}  // namespace flight
+}  // namespace arrow
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -55,6 +56,7 @@ enum class FlightMethod : char {
   DoPut = 6,
   DoAction = 7,
   ListActions = 8,
+  DoExchange = 9,
 };
 
 /// \brief Information about an instance of a Flight RPC.
@@ -64,6 +66,41 @@ struct ARROW_FLIGHT_EXPORT CallInfo {
   FlightMethod method;
 };
 
+/// \brief Data transfer metrics of an instance of a Flight RPC, as seen by
+/// one side of the call.
+///
+/// Messages are the Flight data messages carrying the schema, dictionaries
+/// and record batches of DoGet, DoPut and DoExchange. The time not
+/// accounted for was spent by the application, e.g. consuming the record
+/// batches received.
+struct ARROW_FLIGHT_EXPORT CallMetrics {
+  /// \brief The number of messages sent and received.
+  int64_t messages_sent = 0;
+  int64_t messages_received = 0;
+  /// \brief The number of record batches among them.
+  int64_t batches_sent = 0;
+  int64_t batches_received = 0;
+  /// \brief The serialized size of the messages.
+  int64_t bytes_sent = 0;
+  int64_t bytes_received = 0;
+  /// \brief The time spent serializing messages into gRPC buffers, and
+  /// deserializing them.
+  int64_t serialize_nanos = 0;
+  int64_t deserialize_nanos = 0;
+  /// \brief The time blocked writing messages to gRPC (flow control,
+  /// network), excluding serialization.
+  int64_t write_nanos = 0;
+  /// \brief The time blocked waiting for messages from gRPC, excluding
+  /// deserialization.
+  int64_t read_nanos = 0;
+  /// \brief The time the messages to send were queued behind their
+  /// producer, i.e. the FlightDataStream of a DoGet on the server. For a
+  /// RecordBatchStream, this includes encoding record batches to IPC.
+  int64_t produce_nanos = 0;
+  /// \brief The time from the start of the call to its completion.
+  int64_t duration_nanos = 0;
+};
+
 }  // namespace flight
 
 }  // namespace arrow
@@ -40,6 +40,8 @@
 
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
 DEFINE_int32(port, 31337, "Server port to listen on");
+DEFINE_bool(tls, false,
+            "Enable TLS, with the test certificates found under ARROW_TEST_DATA");
 
 namespace perf = arrow::flight::perf;
 namespace proto = arrow::flight::protocol;
@@ -54,23 +56,19 @@ namespace flight {
     }                                                  \
   } while (0)
 
-using ArrayVector = std::vector<std::shared_ptr<Array>>;
-
 // Create record batches with a unique "a" column so we can verify on the
 // client side that the results are correct
 class PerfDataStream : public FlightDataStream {
  public:
   PerfDataStream(bool verify, const int64_t start, const int64_t total_records,
-                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays)
+                 const std::shared_ptr<RecordBatch>& batch)
       : start_(start),
         verify_(verify),
-        batch_length_(arrays[0]->length()),
+        batch_length_(batch->num_rows()),
         total_records_(total_records),
         records_sent_(0),
-        schema_(schema),
-        arrays_(arrays) {
-    batch_ = RecordBatch::Make(schema, batch_length_, arrays_);
-  }
+        schema_(batch->schema()),
+        batch_(batch) {}
 
   std::shared_ptr<Schema> schema() override { return schema_; }
 
@@ -89,7 +87,7 @@ class PerfDataStream : public FlightDataStream {
     if (verify_) {
       // mutate first array
       auto data =
-          reinterpret_cast<int64_t*>(arrays_[0]->data()->buffers[1]->mutable_data());
+          reinterpret_cast<int64_t*>(batch_->column_data(0)->buffers[1]->mutable_data());
       for (int64_t i = 0; i < batch_length_; ++i) {
         data[i] = start_ + records_sent_ + i;
       }
@@ -108,6 +106,12 @@ class PerfDataStream : public FlightDataStream {
         *batch, ipc_options_, default_memory_pool(), &payload->ipc_message);
   }
 
+  Status SetCompression(Compression::type codec, int compression_level) override {
+    ipc_options_.compression = codec;
+    ipc_options_.compression_level = compression_level;
+    return Status::OK();
+  }
+
  private:
   const int64_t start_;
   bool verify_;
@@ -118,35 +122,35 @@ class PerfDataStream : public FlightDataStream {
   ipc::DictionaryMemo dictionary_memo_;
   ipc::IpcOptions ipc_options_;
   std::shared_ptr<RecordBatch> batch_;
-  ArrayVector arrays_;
 };
 
-Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& schema,
-                      bool use_verifier, std::unique_ptr<FlightDataStream>* data_stream) {
-  std::shared_ptr<ResizableBuffer> buffer;
-  std::vector<std::shared_ptr<Array>> arrays;
-
-  const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
-  }
+Status GetPerfSchema(const perf::Perf& definition, std::shared_ptr<Schema>* schema) {
+  // The original benchmark didn't send a schema name
+  return PerfSchema(definition.schema_name().empty() ? "int64" : definition.schema_name(),
+                    schema);
+}
 
-  *data_stream = std::unique_ptr<FlightDataStream>(
-      new PerfDataStream(use_verifier, token.start(),
-                         token.definition().records_per_stream(), schema, arrays));
+Status GetPerfBatches(const perf::Token& token, bool use_verifier,
+                      std::unique_ptr<FlightDataStream>* data_stream) {
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(GetPerfSchema(token.definition(), &schema));
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(
+      MakePerfBatch(schema, token.definition().records_per_batch(), /*seed=*/0, &batch));
+
+  *data_stream = std::unique_ptr<FlightDataStream>(new PerfDataStream(
+      use_verifier, token.start(), token.definition().records_per_stream(), batch));
   return Status::OK();
 }
 
 class FlightPerfServer : public FlightServerBase {
  public:
   FlightPerfServer() : location_() {
-    DCHECK_OK(Location::ForGrpcTcp(FLAGS_server_host, FLAGS_port, &location_));
-    perf_schema_ = schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                           field("d", int64())});
+    if (FLAGS_tls) {
+      DCHECK_OK(Location::ForGrpcTls(FLAGS_server_host, FLAGS_port, &location_));
+    } else {
+      DCHECK_OK(Location::ForGrpcTcp(FLAGS_server_host, FLAGS_port, &location_));
+    }
   }
 
   Status GetFlightInfo(const ServerCallContext& context, const FlightDescriptor& request,
@@ -172,9 +176,12 @@ class FlightPerfServer : public FlightServerBase {
     uint64_t total_records =
         perf_request.stream_count() * perf_request.records_per_stream();
 
+    std::shared_ptr<Schema> perf_schema;
+    RETURN_NOT_OK(GetPerfSchema(perf_request, &perf_schema));
+
     FlightInfo::Data data;
     RETURN_NOT_OK(
-        MakeFlightInfo(*perf_schema_, request, endpoints, total_records, -1, &data));
+        MakeFlightInfo(*perf_schema, request, endpoints, total_records, -1, &data));
     *info = std::unique_ptr<FlightInfo>(new FlightInfo(data));
     return Status::OK();
   }
@@ -183,7 +190,7 @@ class FlightPerfServer : public FlightServerBase {
                std::unique_ptr<FlightDataStream>* data_stream) override {
     perf::Token token;
     CHECK_PARSE(token.ParseFromString(request.ticket));
-    return GetPerfBatches(token, perf_schema_, false, data_stream);
+    return GetPerfBatches(token, false, data_stream);
   }
 
   Status DoPut(const ServerCallContext& context,
@@ -212,7 +219,6 @@ class FlightPerfServer : public FlightServerBase {
 
  private:
   Location location_;
-  std::shared_ptr<Schema> perf_schema_;
 };
 
 }  // namespace flight
@@ -232,14 +238,26 @@ int main(int argc, char** argv) {
   g_server.reset(new arrow::flight::FlightPerfServer);
 
   arrow::flight::Location location;
-  ARROW_CHECK_OK(arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
+  if (FLAGS_tls) {
+    ARROW_CHECK_OK(
+        arrow::flight::Location::ForGrpcTls("0.0.0.0", FLAGS_port, &location));
+  } else {
+    ARROW_CHECK_OK(
+        arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
+  }
   arrow::flight::FlightServerOptions options(location);
+  if (FLAGS_tls) {
+    ARROW_CHECK_OK(arrow::flight::ExampleTlsCertificates(&options.tls_certificates));
+  }
+  // Compress record batches if requested by the benchmark client
+  options.compression_codecs = {arrow::Compression::LZ4, arrow::Compression::ZSTD};
 
   ARROW_CHECK_OK(g_server->Init(options));
   // Exit with a clean error code (0) on SIGTERM
   ARROW_CHECK_OK(g_server->SetShutdownOnSignals({SIGTERM}));
   std::cout << "Server host: " << FLAGS_server_host << std::endl;
   std::cout << "Server port: " << FLAGS_port << std::endl;
+  std::cout << "TLS: " << (FLAGS_tls ? "on" : "off") << std::endl;
   ARROW_CHECK_OK(g_server->Serve());
   return 0;
 }
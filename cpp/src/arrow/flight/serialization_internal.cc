@@ -17,9 +17,14 @@
 
 #include "arrow/flight/serialization_internal.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/flight/platform.h"
@@ -39,7 +44,11 @@
 
 #include "arrow/buffer.h"
 #include "arrow/flight/server.h"
+#include "arrow/io/concurrency.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
@@ -57,73 +66,302 @@ using google::protobuf::internal::WireFormatLite;
 using google::protobuf::io::ArrayOutputStream;
 using google::protobuf::io::CodedInputStream;
 using google::protobuf::io::CodedOutputStream;
+using google::protobuf::io::ZeroCopyInputStream;
 
 using grpc::ByteBuffer;
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  *out = SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
-  return input->Skip(static_cast<int>(length));
-}
-
 // Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
 // consumers with zero-copy
 class GrpcBuffer : public MutableBuffer {
  public:
   GrpcBuffer(grpc_slice slice, bool incref)
-      : MutableBuffer(GRPC_SLICE_START_PTR(slice),
-                      static_cast<int64_t>(GRPC_SLICE_LENGTH(slice))),
-        slice_(incref ? grpc_slice_ref(slice) : slice) {}
+      : MutableBuffer(nullptr, 0), slice_(incref ? grpc_slice_ref(slice) : slice) {
+    // Small slices store their data inline, so point into our own copy
+    data_ = mutable_data_ = GRPC_SLICE_START_PTR(slice_);
+    size_ = capacity_ = static_cast<int64_t>(GRPC_SLICE_LENGTH(slice_));
+  }
 
   ~GrpcBuffer() override {
     // Decref slice
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
+  // Reference each slice of the ByteBuffer, without copying unless it is
+  // compressed
+  static Status WrapSlices(ByteBuffer* cpp_buf,
+                           std::vector<std::shared_ptr<Buffer>>* out) {
     // These types are guaranteed by static assertions in gRPC to have the same
     // in-memory representation
-
     auto buffer = *reinterpret_cast<grpc_byte_buffer**>(cpp_buf);
 
-    // This part below is based on the Flatbuffers gRPC SerializationTraits in
-    // flatbuffers/grpc.h
-
-    // Check if this is a single uncompressed slice.
-    if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
-
-      // Increment reference count so this memory remains valid
-      *out = std::make_shared<GrpcBuffer>(slice, true);
-    } else {
-      // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
-      // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
-      // us back a new slice with the refcount already incremented.
-      grpc_byte_buffer_reader reader;
-      if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
-        return Status::IOError("Internal gRPC error reading from ByteBuffer");
+    grpc_byte_buffer_reader reader;
+    if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
+      return Status::IOError("Internal gRPC error reading from ByteBuffer");
+    }
+    // The gRPC reader gives us back slices with the refcount already
+    // incremented, steal the references
+    grpc_slice slice;
+    while (grpc_byte_buffer_reader_next(&reader, &slice)) {
+      out->push_back(std::make_shared<GrpcBuffer>(slice, false));
+    }
+    grpc_byte_buffer_reader_destroy(&reader);
+    return Status::OK();
+  }
+
+ private:
+  grpc_slice slice_;
+};
+
+// The metrics of the call whose message is being written or read by this
+// thread, if any
+static thread_local CallMetrics* current_metrics = nullptr;
+
+std::atomic<int64_t> contiguous_bodies(0);
+std::atomic<int64_t> split_bodies(0);
+std::atomic<int64_t> zero_copy_buffers(0);
+std::atomic<int64_t> copied_buffers(0);
+std::atomic<int64_t> copied_bytes(0);
+
+// The slices of a received message, making up a contiguous byte range
+class MessageSlices {
+ public:
+  explicit MessageSlices(std::vector<std::shared_ptr<Buffer>> slices)
+      : slices_(std::move(slices)) {
+    offsets_.reserve(slices_.size() + 1);
+    int64_t offset = 0;
+    for (const auto& slice : slices_) {
+      offsets_.push_back(offset);
+      offset += slice->size();
+    }
+    offsets_.push_back(offset);
+  }
+
+  int64_t size() const { return offsets_.back(); }
+
+  const std::vector<std::shared_ptr<Buffer>>& slices() const { return slices_; }
+
+  // Get the slices covering a range, sliced to its bounds
+  std::vector<std::shared_ptr<Buffer>> GetRange(int64_t position, int64_t length) const {
+    std::vector<std::shared_ptr<Buffer>> out;
+    size_t i = FindSlice(position);
+    while (length > 0) {
+      const int64_t offset = position - offsets_[i];
+      const int64_t chunk_length = std::min(length, slices_[i]->size() - offset);
+      if (chunk_length > 0) {
+        out.push_back(SliceBuffer(slices_[i], offset, chunk_length));
       }
-      grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
-      grpc_byte_buffer_reader_destroy(&reader);
+      position += chunk_length;
+      length -= chunk_length;
+      ++i;
+    }
+    return out;
+  }
 
-      // Steal the slice reference
-      *out = std::make_shared<GrpcBuffer>(slice, false);
+  // Get a range as a single buffer, copying it if it straddles slices
+  Status GetContiguous(int64_t position, int64_t length,
+                       std::shared_ptr<Buffer>* out) const {
+    auto chunks = GetRange(position, length);
+    if (chunks.size() == 1) {
+      *out = std::move(chunks[0]);
+      return Status::OK();
     }
+    return ConcatenateBuffers(chunks, default_memory_pool(), out);
+  }
 
-    return Status::OK();
+ private:
+  // The index of the slice containing a position, skipping empty slices
+  size_t FindSlice(int64_t position) const {
+    auto it = std::upper_bound(offsets_.begin(), offsets_.end(), position);
+    return static_cast<size_t>(it - offsets_.begin()) - 1;
+  }
+
+  std::vector<std::shared_ptr<Buffer>> slices_;
+  // The offset of each slice, followed by the total size
+  std::vector<int64_t> offsets_;
+};
+
+// A protobuf input stream over the slices of a received message
+class SliceInputStream : public ZeroCopyInputStream {
+ public:
+  explicit SliceInputStream(const MessageSlices& message)
+      : slices_(message.slices()), index_(0), offset_(0), position_(0) {}
+
+  bool Next(const void** data, int* size) override {
+    if (index_ == slices_.size()) {
+      return false;
+    }
+    *data = slices_[index_]->data() + offset_;
+    *size = static_cast<int>(slices_[index_]->size() - offset_);
+    position_ += *size;
+    offset_ = 0;
+    ++index_;
+    return true;
   }
 
+  void BackUp(int count) override {
+    --index_;
+    offset_ = slices_[index_]->size() - count;
+    position_ -= count;
+  }
+
+  bool Skip(int count) override {
+    while (count > 0) {
+      const void* data;
+      int size;
+      if (!Next(&data, &size)) {
+        return false;
+      }
+      if (size > count) {
+        BackUp(size - count);
+        return true;
+      }
+      count -= size;
+    }
+    return true;
+  }
+
+  google::protobuf::int64 ByteCount() const override { return position_; }
+
  private:
-  grpc_slice slice_;
+  const std::vector<std::shared_ptr<Buffer>>& slices_;
+  size_t index_;
+  int64_t offset_;
+  int64_t position_;
+};
+
+// Read a length-delimited field, referencing the message slices if it lies
+// within one
+bool ReadBytesZeroCopy(const MessageSlices& message, CodedInputStream* input,
+                       std::shared_ptr<Buffer>* out) {
+  uint32_t length;
+  if (!input->ReadVarint32(&length)) {
+    return false;
+  }
+  if (!message.GetContiguous(input->CurrentPosition(), length, out).ok()) {
+    return false;
+  }
+  return input->Skip(static_cast<int>(length));
+}
+
+// Read the message body, referencing the message slices. Buffers straddling
+// slices are copied when the body is decoded, see SliceBodyReader.
+bool ReadBodyZeroCopy(const MessageSlices& message, CodedInputStream* input,
+                      FlightData* out) {
+  uint32_t length;
+  if (!input->ReadVarint32(&length)) {
+    return false;
+  }
+  auto chunks = message.GetRange(input->CurrentPosition(), length);
+  if (chunks.size() == 1) {
+    out->body = std::move(chunks[0]);
+    contiguous_bodies.fetch_add(1, std::memory_order_relaxed);
+  } else if (chunks.size() > 1) {
+    out->body_chunks = std::move(chunks);
+    split_bodies.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    out->body = std::make_shared<Buffer>(nullptr, 0);
+  }
+  return input->Skip(static_cast<int>(length));
+}
+
+// A file over a body split across several gRPC slices, where reads lying
+// within a slice are zero-copy
+class SliceBodyReader
+    : public io::internal::RandomAccessFileConcurrencyWrapper<SliceBodyReader> {
+ public:
+  explicit SliceBodyReader(std::vector<std::shared_ptr<Buffer>> chunks)
+      : body_(std::move(chunks)), position_(0), is_open_(true) {}
+
+  bool closed() const override { return !is_open_; }
+
+  bool supports_zero_copy() const override { return true; }
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<SliceBodyReader>;
+
+  Status DoClose() {
+    is_open_ = false;
+    return Status::OK();
+  }
+
+  arrow::Result<int64_t> DoTell() const {
+    RETURN_NOT_OK(CheckClosed());
+    return position_;
+  }
+
+  Status DoSeek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || position > body_.size()) {
+      return Status::IOError("Seek out of bounds");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  arrow::Result<int64_t> DoGetSize() {
+    RETURN_NOT_OK(CheckClosed());
+    return body_.size();
+  }
+
+  arrow::Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(
+        nbytes, io::internal::ValidateReadRegion(position, nbytes, body_.size()));
+    if (nbytes == 0) {
+      return std::make_shared<Buffer>(nullptr, 0);
+    }
+    auto chunks = body_.GetRange(position, nbytes);
+    if (chunks.size() == 1) {
+      zero_copy_buffers.fetch_add(1, std::memory_order_relaxed);
+      return std::move(chunks[0]);
+    }
+    copied_buffers.fetch_add(1, std::memory_order_relaxed);
+    copied_bytes.fetch_add(nbytes, std::memory_order_relaxed);
+    std::shared_ptr<Buffer> out;
+    RETURN_NOT_OK(ConcatenateBuffers(chunks, default_memory_pool(), &out));
+    return out;
+  }
+
+  arrow::Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position, nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
+  arrow::Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+    position_ += buffer->size();
+    return buffer;
+  }
+
+  arrow::Result<int64_t> DoRead(int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+    position_ += bytes_read;
+    return bytes_read;
+  }
+
+  Status CheckClosed() const {
+    if (!is_open_) {
+      return Status::Invalid("Operation forbidden on closed SliceBodyReader");
+    }
+    return Status::OK();
+  }
+
+  MessageSlices body_;
+  int64_t position_;
+  bool is_open_;
 };
 
+ReceiveStats GetReceiveStats() {
+  ReceiveStats stats;
+  stats.contiguous_bodies = contiguous_bodies.load();
+  stats.split_bodies = split_bodies.load();
+  stats.zero_copy_buffers = zero_copy_buffers.load();
+  stats.copied_buffers = copied_buffers.load();
+  stats.copied_bytes = copied_bytes.load();
+  return stats;
+}
+
 // Destructor callback for grpc::Slice
 static void ReleaseBuffer(void* buf_ptr) {
   delete reinterpret_cast<std::shared_ptr<Buffer>*>(buf_ptr);
@@ -142,8 +380,8 @@ grpc::Slice SliceFromBuffer(const std::shared_ptr<Buffer>& buf) {
 
 static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 
-grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
-                                 bool* own_buffer) {
+static grpc::Status SerializeFlightData(const FlightPayload& msg, ByteBuffer* out,
+                                        bool* own_buffer) {
   size_t body_size = 0;
   size_t header_size = 0;
 
@@ -264,18 +502,37 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
   return grpc::Status::OK;
 }
 
+grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
+                                 bool* own_buffer) {
+  CallMetrics* metrics = current_metrics;
+  if (metrics == nullptr) {
+    return SerializeFlightData(msg, out, own_buffer);
+  }
+  const auto start = std::chrono::steady_clock::now();
+  grpc::Status status = SerializeFlightData(msg, out, own_buffer);
+  metrics->serialize_nanos += ElapsedNanos(start);
+  if (status.ok()) {
+    metrics->bytes_sent += static_cast<int64_t>(out->Length());
+  }
+  return status;
+}
+
 // Read internal::FlightData from grpc::ByteBuffer containing FlightData
 // protobuf without copying
-grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
+static grpc::Status DeserializeFlightData(ByteBuffer* buffer, FlightData* out) {
   if (!buffer) {
     return grpc::Status(grpc::StatusCode::INTERNAL, "No payload");
   }
 
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+  // gRPC may receive the message in several slices, keep referencing them
+  // rather than copying the message to contiguous memory
+  std::vector<std::shared_ptr<arrow::Buffer>> slices;
+  GRPC_RETURN_NOT_OK(GrpcBuffer::WrapSlices(buffer, &slices));
+  MessageSlices message(std::move(slices));
 
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
+  auto buffer_length = static_cast<int>(message.size());
+  SliceInputStream input(message);
+  CodedInputStream pb_stream(&input);
 
   pb_stream.SetTotalBytesLimit(buffer_length);
 
@@ -305,19 +562,19 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
         out->descriptor.reset(new arrow::flight::FlightDescriptor(descriptor));
       } break;
       case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+        if (!ReadBytesZeroCopy(message, &pb_stream, &out->metadata)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData metadata");
         }
       } break;
       case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
+        if (!ReadBytesZeroCopy(message, &pb_stream, &out->app_metadata)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData application metadata");
         }
       } break;
       case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+        if (!ReadBodyZeroCopy(message, &pb_stream, out)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData body");
         }
@@ -334,7 +591,31 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
   return grpc::Status::OK;
 }
 
+grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
+  CallMetrics* metrics = current_metrics;
+  if (metrics == nullptr || buffer == nullptr) {
+    return DeserializeFlightData(buffer, out);
+  }
+  metrics->bytes_received += static_cast<int64_t>(buffer->Length());
+  const auto start = std::chrono::steady_clock::now();
+  grpc::Status status = DeserializeFlightData(buffer, out);
+  metrics->deserialize_nanos += ElapsedNanos(start);
+  return status;
+}
+
+Status FlightData::ConsolidateBody() {
+  if (!body_chunks.empty()) {
+    RETURN_NOT_OK(ConcatenateBuffers(body_chunks, default_memory_pool(), &body));
+    body_chunks.clear();
+  }
+  return Status::OK();
+}
+
 Status FlightData::OpenMessage(std::unique_ptr<ipc::Message>* message) {
+  if (!body_chunks.empty()) {
+    return ipc::Message::OpenWithBodyFile(
+        metadata, std::make_shared<SliceBodyReader>(body_chunks), message);
+  }
   return ipc::Message::Open(metadata, body, message);
 }
 
@@ -353,29 +634,122 @@ Status FlightData::OpenMessage(std::unique_ptr<ipc::Message>* message) {
 // pointer argument whichever way we want, including cast it back to the original type.
 // (see customize_protobuf.h).
 
-bool WritePayload(const FlightPayload& payload,
-                  grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer) {
+namespace {
+
+// Sets the metrics to which SerializationTraits report, while this thread
+// writes or reads a message
+class MetricsScope {
+ public:
+  explicit MetricsScope(CallMetrics* metrics) : previous_(current_metrics) {
+    current_metrics = metrics;
+  }
+  ~MetricsScope() { current_metrics = previous_; }
+
+ private:
+  CallMetrics* previous_;
+};
+
+template <typename Writer>
+bool WriteFlightData(const FlightPayload& payload, Writer* writer,
+                     CallMetrics* metrics) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
-  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
-                       grpc::WriteOptions());
+  const auto& message = *reinterpret_cast<const pb::FlightData*>(&payload);
+  if (metrics == nullptr) {
+    return writer->Write(message, grpc::WriteOptions());
+  }
+  MetricsScope scope(metrics);
+  const int64_t serialize_nanos = metrics->serialize_nanos;
+  const auto start = std::chrono::steady_clock::now();
+  const bool ok = writer->Write(message, grpc::WriteOptions());
+  metrics->write_nanos +=
+      ElapsedNanos(start) - (metrics->serialize_nanos - serialize_nanos);
+  if (ok) {
+    ++metrics->messages_sent;
+    if (payload.ipc_message.type == ipc::Message::RECORD_BATCH) {
+      ++metrics->batches_sent;
+    }
+  }
+  return ok;
 }
 
-bool WritePayload(const FlightPayload& payload,
-                  grpc::ServerWriter<pb::FlightData>* writer) {
+template <typename Reader>
+bool ReadFlightData(Reader* reader, FlightData* data, CallMetrics* metrics) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
-  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
-                       grpc::WriteOptions());
+  auto message = reinterpret_cast<pb::FlightData*>(data);
+  if (metrics == nullptr) {
+    return reader->Read(message);
+  }
+  MetricsScope scope(metrics);
+  const int64_t deserialize_nanos = metrics->deserialize_nanos;
+  const auto start = std::chrono::steady_clock::now();
+  const bool ok = reader->Read(message);
+  metrics->read_nanos +=
+      ElapsedNanos(start) - (metrics->deserialize_nanos - deserialize_nanos);
+  if (ok) {
+    ++metrics->messages_received;
+  }
+  return ok;
 }
 
-bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data) {
-  // Pretend to be pb::FlightData and intercept in SerializationTraits
-  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+}  // namespace
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer,
+                  CallMetrics* metrics) {
+  return WriteFlightData(payload, writer, metrics);
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* writer,
+                  CallMetrics* metrics) {
+  return WriteFlightData(payload, writer, metrics);
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerWriter<pb::FlightData>* writer, CallMetrics* metrics) {
+  return WriteFlightData(payload, writer, metrics);
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer,
+                  CallMetrics* metrics) {
+  return WriteFlightData(payload, writer, metrics);
+}
+
+void WritePayload(const FlightPayload& payload,
+                  grpc::ServerAsyncWriter<pb::FlightData>* writer, void* tag,
+                  CallMetrics* metrics) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits. The
+  // message is serialized before Write returns.
+  MetricsScope scope(metrics);
+  writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload), grpc::WriteOptions(),
+                tag);
+  if (metrics != nullptr) {
+    ++metrics->messages_sent;
+    if (payload.ipc_message.type == ipc::Message::RECORD_BATCH) {
+      ++metrics->batches_sent;
+    }
+  }
+}
+
+bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data,
+                 CallMetrics* metrics) {
+  return ReadFlightData(reader, data, metrics);
+}
+
+bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data, CallMetrics* metrics) {
+  return ReadFlightData(reader, data, metrics);
 }
 
 bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
-                 FlightData* data) {
-  // Pretend to be pb::FlightData and intercept in SerializationTraits
-  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+                 FlightData* data, CallMetrics* metrics) {
+  return ReadFlightData(reader, data, metrics);
+}
+
+bool ReadPayload(grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data, CallMetrics* metrics) {
+  return ReadFlightData(reader, data, metrics);
 }
 
 #ifndef _WIN32
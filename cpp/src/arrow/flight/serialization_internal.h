@@ -20,9 +20,13 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/flight/internal.h"
+#include "arrow/flight/middleware.h"
 #include "arrow/flight/types.h"
 #include "arrow/ipc/message.h"
 #include "arrow/status.h"
@@ -46,25 +50,78 @@ struct FlightData {
   /// Application-defined metadata
   std::shared_ptr<Buffer> app_metadata;
 
-  /// Message body
+  /// Message body, if contiguous in memory
   std::shared_ptr<Buffer> body;
 
+  /// Message body, if split across several gRPC slices (body is null then).
+  /// Body buffers are only copied when they straddle slices.
+  std::vector<std::shared_ptr<Buffer>> body_chunks;
+
+  /// Copy a body split across slices to contiguous memory
+  Status ConsolidateBody();
+
   /// Open IPC message from the metadata and body
   Status OpenMessage(std::unique_ptr<ipc::Message>* message);
 };
 
+/// Process-wide counters of the FlightData messages received
+struct ReceiveStats {
+  /// Bodies received in a single gRPC slice
+  int64_t contiguous_bodies = 0;
+  /// Bodies split across several gRPC slices
+  int64_t split_bodies = 0;
+  /// Buffers of split bodies lying within a slice, read without copying
+  int64_t zero_copy_buffers = 0;
+  /// Buffers of split bodies straddling slices, copied to contiguous memory
+  int64_t copied_buffers = 0;
+  int64_t copied_bytes = 0;
+};
+
+ARROW_FLIGHT_EXPORT
+ReceiveStats GetReceiveStats();
+
+/// Nanoseconds elapsed since the given time point, for CallMetrics
+inline int64_t ElapsedNanos(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
 /// Write Flight message on gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if some error occurred (connection closed?).
+/// The message is accounted for in the call metrics, if given.
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer,
+                  CallMetrics* metrics = NULLPTR);
 bool WritePayload(const FlightPayload& payload,
-                  grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer);
+                  grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* writer,
+                  CallMetrics* metrics = NULLPTR);
 bool WritePayload(const FlightPayload& payload,
-                  grpc::ServerWriter<pb::FlightData>* writer);
+                  grpc::ServerWriter<pb::FlightData>* writer,
+                  CallMetrics* metrics = NULLPTR);
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer,
+                  CallMetrics* metrics = NULLPTR);
+
+/// Start writing Flight message on an asynchronous gRPC stream. The tag is
+/// returned by the completion queue once the write completes. Only the
+/// serialization is accounted for in the call metrics, if given.
+void WritePayload(const FlightPayload& payload,
+                  grpc::ServerAsyncWriter<pb::FlightData>* writer, void* tag,
+                  CallMetrics* metrics = NULLPTR);
 
 /// Read Flight message from gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if stream ended.
-bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data);
+/// The message is accounted for in the call metrics, if given, except for
+/// counting record batches, which is left to the caller.
+bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data,
+                 CallMetrics* metrics = NULLPTR);
+bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data, CallMetrics* metrics = NULLPTR);
 bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
-                 FlightData* data);
+                 FlightData* data, CallMetrics* metrics = NULLPTR);
+bool ReadPayload(grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data, CallMetrics* metrics = NULLPTR);
 
 }  // namespace internal
 }  // namespace flight
@@ -22,10 +22,13 @@
 
 #include <signal.h>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -43,6 +46,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/uri.h"
@@ -53,6 +57,7 @@
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/server_middleware.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 using FlightService = arrow::flight::protocol::FlightService;
@@ -91,13 +96,14 @@ namespace flight {
 
 namespace {
 
-// A MessageReader implementation that reads from a gRPC ServerReader
+// A MessageReader implementation that reads from a gRPC ServerReader, for
+// DoPut (WriteT = pb::PutResult) and DoExchange (WriteT = pb::FlightData)
+template <typename WriteT>
 class FlightIpcMessageReader : public ipc::MessageReader {
  public:
-  explicit FlightIpcMessageReader(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
-      std::shared_ptr<Buffer>* last_metadata)
-      : reader_(reader), app_metadata_(last_metadata) {}
+  FlightIpcMessageReader(grpc::ServerReaderWriter<WriteT, pb::FlightData>* reader,
+                         std::shared_ptr<Buffer>* last_metadata, CallMetrics* metrics)
+      : reader_(reader), app_metadata_(last_metadata), metrics_(metrics) {}
 
   Status ReadNextMessage(std::unique_ptr<ipc::Message>* out) override {
     if (stream_finished_) {
@@ -106,7 +112,7 @@ class FlightIpcMessageReader : public ipc::MessageReader {
       return Status::OK();
     }
     internal::FlightData data;
-    if (!internal::ReadPayload(reader_, &data)) {
+    if (!internal::ReadPayload(reader_, &data, metrics_)) {
       // Stream is finished
       stream_finished_ = true;
       if (first_message_) {
@@ -120,13 +126,16 @@ class FlightIpcMessageReader : public ipc::MessageReader {
 
     if (first_message_) {
       if (!data.descriptor) {
-        return Status::Invalid("DoPut must start with non-null descriptor");
+        return Status::Invalid("Client stream must start with non-null descriptor");
       }
       descriptor_ = *data.descriptor;
       first_message_ = false;
     }
 
     RETURN_NOT_OK(data.OpenMessage(out));
+    if (metrics_ && (*out)->type() == ipc::Message::RECORD_BATCH) {
+      ++metrics_->batches_received;
+    }
     *app_metadata_ = std::move(data.app_metadata);
     return Status::OK();
   }
@@ -134,21 +143,24 @@ class FlightIpcMessageReader : public ipc::MessageReader {
   const FlightDescriptor& descriptor() const { return descriptor_; }
 
  protected:
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
+  grpc::ServerReaderWriter<WriteT, pb::FlightData>* reader_;
   bool stream_finished_ = false;
   bool first_message_ = true;
   FlightDescriptor descriptor_;
   std::shared_ptr<Buffer>* app_metadata_;
+  CallMetrics* metrics_;
 };
 
+template <typename WriteT>
 class FlightMessageReaderImpl : public FlightMessageReader {
  public:
-  explicit FlightMessageReaderImpl(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader)
-      : reader_(reader) {}
+  FlightMessageReaderImpl(grpc::ServerReaderWriter<WriteT, pb::FlightData>* reader,
+                          CallMetrics* metrics)
+      : reader_(reader), metrics_(metrics) {}
 
   Status Init() {
-    message_reader_ = new FlightIpcMessageReader(reader_, &last_metadata_);
+    message_reader_ =
+        new FlightIpcMessageReader<WriteT>(reader_, &last_metadata_, metrics_);
     return ipc::RecordBatchStreamReader::Open(
         std::unique_ptr<ipc::MessageReader>(message_reader_), &batch_reader_);
   }
@@ -169,8 +181,9 @@ class FlightMessageReaderImpl : public FlightMessageReader {
  private:
   std::shared_ptr<Schema> schema_;
   std::unique_ptr<ipc::DictionaryMemo> dictionary_memo_;
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
-  FlightIpcMessageReader* message_reader_;
+  grpc::ServerReaderWriter<WriteT, pb::FlightData>* reader_;
+  CallMetrics* metrics_;
+  FlightIpcMessageReader<WriteT>* message_reader_;
   std::shared_ptr<Buffer> last_metadata_;
   std::shared_ptr<RecordBatchReader> batch_reader_;
 };
@@ -194,6 +207,78 @@ class GrpcMetadataWriter : public FlightMetadataWriter {
   grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* writer_;
 };
 
+// A IpcPayloadWriter implementation that writes to a DoExchange stream
+class DoExchangePayloadWriter : public ipc::internal::IpcPayloadWriter {
+ public:
+  DoExchangePayloadWriter(
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer,
+      std::shared_ptr<Buffer>* app_metadata, CallMetrics* metrics)
+      : writer_(writer), app_metadata_(app_metadata), metrics_(metrics) {}
+
+  Status Start() override { return Status::OK(); }
+
+  Status WritePayload(const ipc::internal::IpcPayload& ipc_payload) override {
+    FlightPayload payload;
+    payload.ipc_message = ipc_payload;
+    if (ipc_payload.type == ipc::Message::RECORD_BATCH && *app_metadata_) {
+      payload.app_metadata = std::move(*app_metadata_);
+    }
+    if (!internal::WritePayload(payload, writer_, metrics_)) {
+      return Status::IOError("Could not write record batch to stream");
+    }
+    return Status::OK();
+  }
+
+  // The stream is closed when the RPC handler returns
+  Status Close() override { return Status::OK(); }
+
+ private:
+  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer_;
+  std::shared_ptr<Buffer>* app_metadata_;
+  CallMetrics* metrics_;
+};
+
+class FlightMessageWriterImpl : public FlightMessageWriter {
+ public:
+  FlightMessageWriterImpl(
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer,
+      const ipc::IpcOptions& ipc_options, CallMetrics* metrics)
+      : writer_(writer), ipc_options_(ipc_options), metrics_(metrics) {}
+
+  Status Begin(const std::shared_ptr<Schema>& schema) override {
+    if (batch_writer_) {
+      return Status::Invalid("This writer has already been started.");
+    }
+    std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+        new DoExchangePayloadWriter(writer_, &app_metadata_, metrics_));
+    ARROW_ASSIGN_OR_RAISE(
+        batch_writer_,
+        ipc::internal::StartRecordBatchWriter(std::move(payload_writer), schema,
+                                              ipc_options_));
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    return WriteWithMetadata(batch, nullptr);
+  }
+
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override {
+    if (!batch_writer_) {
+      return Status::Invalid("This writer has not been started. Call Begin() first.");
+    }
+    app_metadata_ = std::move(app_metadata);
+    return batch_writer_->WriteRecordBatch(batch);
+  }
+
+ private:
+  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer_;
+  ipc::IpcOptions ipc_options_;
+  CallMetrics* metrics_;
+  std::shared_ptr<Buffer> app_metadata_;
+  std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
+};
+
 class GrpcServerAuthReader : public ServerAuthReader {
  public:
   explicit GrpcServerAuthReader(
@@ -232,9 +317,11 @@ class GrpcServerAuthSender : public ServerAuthSender {
   grpc::ServerReaderWriter<pb::HandshakeResponse, pb::HandshakeRequest>* stream_;
 };
 
+class AsyncDoGetCall;
 class FlightServiceImpl;
 class GrpcServerCallContext : public ServerCallContext {
   const std::string& peer_identity() const override { return peer_identity_; }
+  const std::string& peer() const override { return peer_; }
 
   // Helper method that runs interceptors given the result of an RPC,
   // then returns the final gRPC status to send to the client
@@ -245,12 +332,20 @@ class GrpcServerCallContext : public ServerCallContext {
   }
 
   grpc::Status FinishRequest(const arrow::Status& status) {
+    if (!middleware_.empty()) {
+      metrics_.duration_nanos = internal::ElapsedNanos(start_);
+    }
     for (const auto& instance : middleware_) {
+      instance->CallMetricsAvailable(metrics_);
       instance->CallCompleted(status);
     }
     return internal::ToGrpcStatus(status);
   }
 
+  // The metrics of the call, only collected when there is middleware to
+  // report them to
+  CallMetrics* metrics() { return middleware_.empty() ? nullptr : &metrics_; }
+
   ServerMiddleware* GetMiddleware(const std::string& key) const override {
     const auto& instance = middleware_map_.find(key);
     if (instance == middleware_map_.end()) {
@@ -260,11 +355,15 @@ class GrpcServerCallContext : public ServerCallContext {
   }
 
  private:
+  friend class AsyncDoGetCall;
   friend class FlightServiceImpl;
   ServerContext* context_;
   std::string peer_identity_;
+  std::string peer_;
   std::vector<std::shared_ptr<ServerMiddleware>> middleware_;
   std::unordered_map<std::string, std::shared_ptr<ServerMiddleware>> middleware_map_;
+  std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+  CallMetrics metrics_;
 };
 
 class GrpcAddCallHeaders : public AddCallHeaders {
@@ -288,8 +387,29 @@ class FlightServiceImpl : public FlightService::Service {
       std::shared_ptr<ServerAuthHandler> auth_handler,
       std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
           middleware,
-      FlightServerBase* server)
-      : auth_handler_(auth_handler), middleware_(middleware), server_(server) {}
+      FlightServerBase* server, bool shared_memory,
+      std::vector<Compression::type> compression_codecs, int compression_level,
+      bool async_do_get)
+      : auth_handler_(auth_handler),
+        middleware_(middleware),
+        server_(server),
+        shared_memory_(shared_memory),
+        compression_codecs_(std::move(compression_codecs)),
+        compression_level_(compression_level) {
+    if (async_do_get) {
+      // DoGet calls are then requested with RequestAsyncDoGet
+      MarkMethodAsync(kDoGetMethodIndex);
+    }
+  }
+
+  // Ask to be notified of the next DoGet call on the completion queue, for
+  // servers with asynchronous DoGet
+  void RequestAsyncDoGet(ServerContext* context, pb::Ticket* request,
+                         grpc::ServerAsyncWriter<pb::FlightData>* writer,
+                         grpc::ServerCompletionQueue* cq, void* tag) {
+    RequestAsyncServerStreaming(kDoGetMethodIndex, context, request, writer, cq, cq,
+                                tag);
+  }
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -355,6 +475,7 @@ class FlightServiceImpl : public FlightService::Service {
   // Authenticate the client (if applicable) and construct the call context
   grpc::Status MakeCallContext(const FlightMethod& method, ServerContext* context,
                                GrpcServerCallContext& flight_context) {
+    flight_context.peer_ = context->peer();
     // Run server middleware
     const CallInfo info{method};
     CallHeaders incoming_headers;
@@ -383,6 +504,45 @@ class FlightServiceImpl : public FlightService::Service {
     return grpc::Status::OK;
   }
 
+  // Map the shared memory segment offered by the client, if any. Clients fall
+  // back to reading bodies from the call if the server can't map it, e.g. when
+  // they don't share a shared memory namespace.
+  void OpenSharedMemory(ServerContext* context,
+                        std::unique_ptr<internal::SharedMemoryRing>* ring) {
+    const auto& client_metadata = context->client_metadata();
+    const auto header = client_metadata.find(internal::kSharedMemoryHeader);
+    if (header == client_metadata.end()) {
+      return;
+    }
+    const std::string name(header->second.data(), header->second.length());
+    if (!internal::SharedMemoryRing::Open(name, ring).ok()) {
+      return;
+    }
+    // Nothing else needs to open the segment, make sure it is released with
+    // the last mapping
+    ARROW_UNUSED((*ring)->Unlink());
+    context->AddInitialMetadata(internal::kSharedMemoryAcceptedHeader, "1");
+  }
+
+  // The codec requested by the client for the record batches sent by the
+  // server, if the server may use it
+  Compression::type NegotiateCompression(ServerContext* context) {
+    const auto& client_metadata = context->client_metadata();
+    const auto header = client_metadata.find(internal::kGrpcCompressionHeader);
+    if (header == client_metadata.end()) {
+      return Compression::UNCOMPRESSED;
+    }
+    const std::string name(header->second.data(), header->second.length());
+    for (const auto codec : compression_codecs_) {
+      if ((codec == Compression::LZ4 || codec == Compression::ZSTD) &&
+          util::Codec::GetCodecAsString(codec) == name &&
+          util::Codec::IsAvailable(codec)) {
+        return codec;
+      }
+    }
+    return Compression::UNCOMPRESSED;
+  }
+
   grpc::Status Handshake(
       ServerContext* context,
       grpc::ServerReaderWriter<pb::HandshakeResponse, pb::HandshakeRequest>* stream) {
@@ -475,9 +635,14 @@ class FlightServiceImpl : public FlightService::Service {
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
 
-  grpc::Status DoGet(ServerContext* context, const pb::Ticket* request,
-                     ServerWriter<pb::FlightData>* writer) {
-    GrpcServerCallContext flight_context;
+  // Authenticate a DoGet call, get its stream from the implementation and
+  // compute the schema payload. Middleware have already been run if this
+  // fails.
+  grpc::Status StartDoGet(ServerContext* context, const pb::Ticket* request,
+                          GrpcServerCallContext& flight_context,
+                          std::unique_ptr<FlightDataStream>* out,
+                          std::unique_ptr<internal::SharedMemoryRing>* ring,
+                          FlightPayload* schema_payload) {
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoGet, context, flight_context));
 
     CHECK_ARG_NOT_NULL(flight_context, request, "ticket cannot be null");
@@ -494,10 +659,36 @@ class FlightServiceImpl : public FlightService::Service {
                                                           "No data in this flight"));
     }
 
-    // Write the schema as the first message in the stream
+    const auto compression = NegotiateCompression(context);
+    if (compression != Compression::UNCOMPRESSED) {
+      const auto status = data_stream->SetCompression(compression, compression_level_);
+      if (!status.IsNotImplemented()) {
+        SERVICE_RETURN_NOT_OK(flight_context, status);
+      }
+    }
+
+    if (shared_memory_) {
+      OpenSharedMemory(context, ring);
+    }
+
+    SERVICE_RETURN_NOT_OK(flight_context, data_stream->GetSchemaPayload(schema_payload));
+    *out = std::move(data_stream);
+    return grpc::Status::OK;
+  }
+
+  grpc::Status DoGet(ServerContext* context, const pb::Ticket* request,
+                     ServerWriter<pb::FlightData>* writer) {
+    GrpcServerCallContext flight_context;
+    std::unique_ptr<FlightDataStream> data_stream;
+    std::unique_ptr<internal::SharedMemoryRing> ring;
     FlightPayload schema_payload;
-    SERVICE_RETURN_NOT_OK(flight_context, data_stream->GetSchemaPayload(&schema_payload));
-    if (!internal::WritePayload(schema_payload, writer)) {
+    GRPC_RETURN_NOT_GRPC_OK(StartDoGet(context, request, flight_context, &data_stream,
+                                       &ring, &schema_payload));
+
+    CallMetrics* metrics = flight_context.metrics();
+
+    // Write the schema as the first message in the stream
+    if (!internal::WritePayload(schema_payload, writer, metrics)) {
       // Connection terminated?  XXX return error code?
       RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
     }
@@ -505,12 +696,22 @@ class FlightServiceImpl : public FlightService::Service {
     // Consume data stream and write out payloads
     while (true) {
       FlightPayload payload;
+      const auto start = std::chrono::steady_clock::now();
       SERVICE_RETURN_NOT_OK(flight_context, data_stream->Next(&payload));
-      if (payload.ipc_message.metadata == nullptr ||
-          !internal::WritePayload(payload, writer))
-        // No more messages to write, or connection terminated for some other
-        // reason
+      if (metrics) {
+        metrics->produce_nanos += internal::ElapsedNanos(start);
+      }
+      if (payload.ipc_message.metadata == nullptr) {
+        // No more messages to write
+        break;
+      }
+      if (ring) {
+        SERVICE_RETURN_NOT_OK(flight_context, ring->ShareBody(&payload));
+      }
+      if (!internal::WritePayload(payload, writer, metrics)) {
+        // Connection terminated for some other reason
         break;
+      }
     }
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
@@ -520,8 +721,8 @@ class FlightServiceImpl : public FlightService::Service {
     GrpcServerCallContext flight_context;
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoPut, context, flight_context));
 
-    auto message_reader =
-        std::unique_ptr<FlightMessageReaderImpl>(new FlightMessageReaderImpl(reader));
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<pb::PutResult>>(
+        new FlightMessageReaderImpl<pb::PutResult>(reader, flight_context.metrics()));
     SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
     auto metadata_writer =
         std::unique_ptr<FlightMetadataWriter>(new GrpcMetadataWriter(reader));
@@ -530,6 +731,25 @@ class FlightServiceImpl : public FlightService::Service {
                                           std::move(metadata_writer)));
   }
 
+  grpc::Status DoExchange(
+      ServerContext* context,
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream) {
+    GrpcServerCallContext flight_context;
+    GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoExchange, context, flight_context));
+
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<pb::FlightData>>(
+        new FlightMessageReaderImpl<pb::FlightData>(stream, flight_context.metrics()));
+    SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
+    auto ipc_options = ipc::IpcOptions::Defaults();
+    ipc_options.compression = NegotiateCompression(context);
+    ipc_options.compression_level = compression_level_;
+    auto message_writer = std::unique_ptr<FlightMessageWriter>(
+        new FlightMessageWriterImpl(stream, ipc_options, flight_context.metrics()));
+    RETURN_WITH_MIDDLEWARE(flight_context,
+                           server_->DoExchange(flight_context, std::move(message_reader),
+                                               std::move(message_writer)));
+  }
+
   grpc::Status ListActions(ServerContext* context, const pb::Empty* request,
                            ServerWriter<pb::ActionType>* writer) {
     GrpcServerCallContext flight_context;
@@ -575,16 +795,148 @@ class FlightServiceImpl : public FlightService::Service {
   }
 
  private:
+  // The index of DoGet in the methods of the service definition
+  static constexpr int kDoGetMethodIndex = 4;
+
   std::shared_ptr<ServerAuthHandler> auth_handler_;
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware_;
   FlightServerBase* server_;
+  // Whether DoGet may send bodies through shared memory (grpc+shm locations)
+  bool shared_memory_;
+  // The codecs the client may request for the record batches sent by the server
+  std::vector<Compression::type> compression_codecs_;
+  int compression_level_;
+};
+
+// A DoGet call served with gRPC's asynchronous API, which deletes itself once
+// finished. A single operation is pending on the call at any time: waiting for
+// a new call, for the next payload of the stream, for a write or for the final
+// status to be sent.
+class AsyncDoGetCall {
+ public:
+  AsyncDoGetCall(FlightServiceImpl* service, grpc::ServerCompletionQueue* cq)
+      : service_(service), cq_(cq), writer_(&context_) {
+    service_->RequestAsyncDoGet(&context_, &request_, &writer_, cq_, this);
+  }
+
+  // Called by the polling threads when the pending gRPC operation completes
+  void Proceed(bool ok) {
+    switch (state_) {
+      case State::REQUESTED:
+        if (!ok) {
+          // The server is shutting down
+          delete this;
+          return;
+        }
+        // Wait for the next call
+        new AsyncDoGetCall(service_, cq_);
+        Start();
+        break;
+      case State::WRITING:
+        if (CallMetrics* metrics = flight_context_.metrics()) {
+          metrics->write_nanos += internal::ElapsedNanos(write_start_) -
+                                  (metrics->serialize_nanos - write_serialize_nanos_);
+        }
+        if (!ok) {
+          // Connection terminated
+          Finish(flight_context_.FinishRequest(grpc::Status::OK));
+          return;
+        }
+        ReadNext();
+        break;
+      case State::FINISHING:
+        delete this;
+        break;
+    }
+  }
+
+ private:
+  enum class State { REQUESTED, WRITING, FINISHING };
+
+  void Start() {
+    const grpc::Status status = service_->StartDoGet(
+        &context_, &request_, flight_context_, &data_stream_, &ring_, &payload_);
+    if (!status.ok()) {
+      Finish(status);
+      return;
+    }
+    // Write the schema as the first message in the stream
+    Write();
+  }
+
+  void ReadNext() {
+    next_start_ = std::chrono::steady_clock::now();
+    // The callback may run right away, or later in the thread producing the
+    // payload
+    data_stream_->NextAsync().AddCallback(
+        [this](const arrow::Result<FlightPayload>& result) { OnNext(result); });
+  }
+
+  void OnNext(const arrow::Result<FlightPayload>& result) {
+    if (CallMetrics* metrics = flight_context_.metrics()) {
+      metrics->produce_nanos += internal::ElapsedNanos(next_start_);
+    }
+    if (!result.ok()) {
+      Finish(flight_context_.FinishRequest(result.status()));
+      return;
+    }
+    payload_ = *result;
+    if (payload_.ipc_message.metadata == nullptr) {
+      // No more messages to write
+      Finish(flight_context_.FinishRequest(grpc::Status::OK));
+      return;
+    }
+    if (ring_) {
+      const Status status = ring_->ShareBody(&payload_);
+      if (!status.ok()) {
+        Finish(flight_context_.FinishRequest(status));
+        return;
+      }
+    }
+    Write();
+  }
+
+  void Write() {
+    state_ = State::WRITING;
+    CallMetrics* metrics = flight_context_.metrics();
+    if (metrics) {
+      // The write may complete before WritePayload returns
+      write_start_ = std::chrono::steady_clock::now();
+      write_serialize_nanos_ = metrics->serialize_nanos;
+    }
+    internal::WritePayload(payload_, &writer_, this, metrics);
+  }
+
+  void Finish(const grpc::Status& status) {
+    state_ = State::FINISHING;
+    writer_.Finish(status, this);
+  }
+
+  FlightServiceImpl* service_;
+  grpc::ServerCompletionQueue* cq_;
+  State state_ = State::REQUESTED;
+
+  ServerContext context_;
+  pb::Ticket request_;
+  grpc::ServerAsyncWriter<pb::FlightData> writer_;
+
+  GrpcServerCallContext flight_context_;
+  std::unique_ptr<FlightDataStream> data_stream_;
+  std::unique_ptr<internal::SharedMemoryRing> ring_;
+  // The payload being written
+  FlightPayload payload_;
+  std::chrono::steady_clock::time_point next_start_;
+  std::chrono::steady_clock::time_point write_start_;
+  int64_t write_serialize_nanos_ = 0;
 };
 
 }  // namespace
 
 FlightMetadataWriter::~FlightMetadataWriter() = default;
 
+FlightMessageWriter::~FlightMessageWriter() = default;
+
 //
 // gRPC server lifecycle
 //
@@ -600,6 +952,39 @@ struct FlightServerBase::Impl {
   std::unique_ptr<FlightServiceImpl> service_;
   std::unique_ptr<grpc::Server> server_;
   int port_;
+
+  // Asynchronous DoGet calls, polled by cq_threads_
+  std::unique_ptr<grpc::ServerCompletionQueue> cq_;
+  std::vector<std::thread> cq_threads_;
+  std::mutex cq_mutex_;
+
+  ~Impl() {
+    if (cq_) {
+      server_->Shutdown();
+      StopCompletionQueue();
+    }
+  }
+
+  // Drain the completion queue once the server has shut down
+  void StopCompletionQueue() {
+    std::lock_guard<std::mutex> lock(cq_mutex_);
+    if (!cq_ || cq_threads_.empty()) {
+      return;
+    }
+    cq_->Shutdown();
+    for (auto& thread : cq_threads_) {
+      thread.join();
+    }
+    cq_threads_.clear();
+  }
+
+  static void PollCompletionQueue(grpc::ServerCompletionQueue* cq) {
+    void* tag;
+    bool ok;
+    while (cq->Next(&tag, &ok)) {
+      static_cast<AsyncDoGetCall*>(tag)->Proceed(ok);
+    }
+  }
 #ifdef _WIN32
   // Signal handlers are executed in a separate thread on Windows, so getting
   // the current thread instance wouldn't make sense.  This means only a single
@@ -645,7 +1030,10 @@ FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(const FlightServerOptions& options) {
   impl_->service_.reset(
-      new FlightServiceImpl(options.auth_handler, options.middleware, this));
+      new FlightServiceImpl(options.auth_handler, options.middleware, this,
+                            options.location.scheme() == kSchemeGrpcShm,
+                            options.compression_codecs, options.compression_level,
+                            options.async_do_get));
 
   grpc::ServerBuilder builder;
   // Allow uploading messages of any length
@@ -669,7 +1057,7 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
     }
 
     builder.AddListeningPort(address.str(), creds, &impl_->port_);
-  } else if (scheme == kSchemeGrpcUnix) {
+  } else if (scheme == kSchemeGrpcUnix || scheme == kSchemeGrpcShm) {
     std::stringstream address;
     address << "unix:" << location.uri_->path();
     builder.AddListeningPort(address.str(), grpc::InsecureServerCredentials());
@@ -678,6 +1066,12 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
   }
 
   builder.RegisterService(impl_->service_.get());
+  if (options.async_do_get) {
+    if (options.async_do_get_threads <= 0) {
+      return Status::Invalid("async_do_get_threads must be positive");
+    }
+    impl_->cq_ = builder.AddCompletionQueue();
+  }
 
   // Disable SO_REUSEPORT - it makes debugging/testing a pain as
   // leftover processes can handle requests on accident
@@ -691,6 +1085,12 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
   if (!impl_->server_) {
     return Status::UnknownError("Server did not start properly");
   }
+  if (impl_->cq_) {
+    for (int i = 0; i < options.async_do_get_threads; ++i) {
+      new AsyncDoGetCall(impl_->service_.get(), impl_->cq_.get());
+      impl_->cq_threads_.emplace_back(&Impl::PollCompletionQueue, impl_->cq_.get());
+    }
+  }
   return Status::OK();
 }
 
@@ -720,6 +1120,7 @@ Status FlightServerBase::Serve() {
 
   impl_->server_->Wait();
   impl_->running_instance_ = nullptr;
+  impl_->StopCompletionQueue();
 
   // Restore signal handlers
   for (size_t i = 0; i < impl_->signals_.size(); ++i) {
@@ -744,6 +1145,7 @@ Status FlightServerBase::Shutdown() {
 Status FlightServerBase::Wait() {
   impl_->server_->Wait();
   impl_->running_instance_ = nullptr;
+  impl_->StopCompletionQueue();
   return Status::OK();
 }
 
@@ -770,6 +1172,12 @@ Status FlightServerBase::DoPut(const ServerCallContext& context,
   return Status::NotImplemented("NYI");
 }
 
+Status FlightServerBase::DoExchange(const ServerCallContext& context,
+                                    std::unique_ptr<FlightMessageReader> reader,
+                                    std::unique_ptr<FlightMessageWriter> writer) {
+  return Status::NotImplemented("NYI");
+}
+
 Status FlightServerBase::DoAction(const ServerCallContext& context, const Action& action,
                                   std::unique_ptr<ResultStream>* result) {
   return Status::NotImplemented("NYI");
@@ -809,6 +1217,12 @@ class RecordBatchStream::RecordBatchStreamImpl {
                                            &dictionary_memo_, &payload->ipc_message);
   }
 
+  Status SetCompression(Compression::type codec, int compression_level) {
+    ipc_options_.compression = codec;
+    ipc_options_.compression_level = compression_level;
+    return Status::OK();
+  }
+
   Status Next(FlightPayload* payload) {
     if (stage_ == Stage::NEW) {
       RETURN_NOT_OK(reader_->ReadNext(&current_batch_));
@@ -873,6 +1287,19 @@ class RecordBatchStream::RecordBatchStreamImpl {
 
 FlightDataStream::~FlightDataStream() {}
 
+Status FlightDataStream::SetCompression(Compression::type codec, int compression_level) {
+  return Status::NotImplemented("This stream does not support compression");
+}
+
+Future<FlightPayload> FlightDataStream::NextAsync() {
+  FlightPayload payload;
+  const Status status = Next(&payload);
+  if (!status.ok()) {
+    return Future<FlightPayload>::MakeFinished(status);
+  }
+  return Future<FlightPayload>::MakeFinished(std::move(payload));
+}
+
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
                                      MemoryPool* pool) {
   impl_.reset(new RecordBatchStreamImpl(reader, pool));
@@ -888,5 +1315,10 @@ Status RecordBatchStream::GetSchemaPayload(FlightPayload* payload) {
 
 Status RecordBatchStream::Next(FlightPayload* payload) { return impl_->Next(payload); }
 
+Status RecordBatchStream::SetCompression(Compression::type codec,
+                                         int compression_level) {
+  return impl_->SetCompression(codec, compression_level);
+}
+
 }  // namespace flight
 }  // namespace arrow
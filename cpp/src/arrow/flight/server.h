@@ -32,6 +32,8 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 
@@ -58,6 +60,24 @@ class ARROW_FLIGHT_EXPORT FlightDataStream {
   // When the stream is completed, the last payload written will have null
   // metadata
   virtual Status Next(FlightPayload* payload) = 0;
+
+  /// \brief Compress the bodies of the record batches in the following
+  /// payloads, as negotiated with the client
+  ///
+  /// Called by the server before GetSchemaPayload. The default
+  /// implementation returns NotImplemented, in which case the payloads are
+  /// sent as is.
+  virtual Status SetCompression(Compression::type codec, int compression_level);
+
+  /// \brief Compute the next payload asynchronously, for servers serving
+  /// DoGet asynchronously (see FlightServerOptions::async_do_get)
+  ///
+  /// The future completes with a payload with null metadata at the end of
+  /// the stream. The default implementation calls Next(), which blocks one
+  /// of the server's polling threads. Streams whose payloads are produced
+  /// elsewhere (another thread, an I/O callback...) should override it, so
+  /// that they don't hold any thread while waiting.
+  virtual Future<FlightPayload> NextAsync();
 };
 
 /// \brief A basic implementation of FlightDataStream that will provide
@@ -73,6 +93,7 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   std::shared_ptr<Schema> schema() override;
   Status GetSchemaPayload(FlightPayload* payload) override;
   Status Next(FlightPayload* payload) override;
+  Status SetCompression(Compression::type codec, int compression_level) override;
 
  private:
   class RecordBatchStreamImpl;
@@ -96,12 +117,32 @@ class ARROW_FLIGHT_EXPORT FlightMetadataWriter {
   virtual Status WriteMetadata(const Buffer& app_metadata) = 0;
 };
 
+/// \brief A writer for IPC payloads sent back to the client during an
+/// exchange. Also allows sending application-defined metadata via the Flight
+/// protocol.
+class ARROW_FLIGHT_EXPORT FlightMessageWriter {
+ public:
+  virtual ~FlightMessageWriter();
+  /// \brief Start the stream by sending the schema of the record batches.
+  ///
+  /// This must be called once, before writing any record batch.
+  virtual Status Begin(const std::shared_ptr<Schema>& schema) = 0;
+  /// \brief Send a record batch to the client.
+  virtual Status WriteRecordBatch(const RecordBatch& batch) = 0;
+  /// \brief Send a record batch to the client, along with application-defined
+  /// metadata.
+  virtual Status WriteWithMetadata(const RecordBatch& batch,
+                                   std::shared_ptr<Buffer> app_metadata) = 0;
+};
+
 /// \brief Call state/contextual data.
 class ARROW_FLIGHT_EXPORT ServerCallContext {
  public:
   virtual ~ServerCallContext() = default;
   /// \brief The name of the authenticated peer (may be the empty string)
   virtual const std::string& peer_identity() const = 0;
+  /// \brief The address of the peer, e.g. "ipv4:127.0.0.1:50000"
+  virtual const std::string& peer() const = 0;
   /// \brief Look up a middleware by key. Do not maintain a reference
   /// to the object beyond the request body.
   /// \return The middleware, or nullptr if not found.
@@ -130,6 +171,25 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware;
 
+  /// \brief The codecs the server may use to compress the bodies of the
+  /// record batches it sends, when the client requests one of them in its
+  /// call options. Empty (the default) to never compress.
+  std::vector<Compression::type> compression_codecs;
+
+  /// \brief The compression level used for the record batches sent by the
+  /// server
+  int compression_level = util::kUseDefaultCompressionLevel;
+
+  /// \brief Serve DoGet with gRPC's asynchronous API. The payloads of the
+  /// calls are then pulled with FlightDataStream::NextAsync by a few polling
+  /// threads, instead of holding a gRPC thread for the whole call, so that
+  /// many mostly idle streams can be served at once. The other calls are
+  /// unaffected.
+  bool async_do_get = false;
+
+  /// \brief The number of threads polling the asynchronous DoGet calls
+  int async_do_get_threads = 2;
+
   /// \brief A Flight implementation-specific callback to customize
   /// transport-specific options.
   ///
@@ -233,6 +293,20 @@ class ARROW_FLIGHT_EXPORT FlightServerBase {
                        std::unique_ptr<FlightMessageReader> reader,
                        std::unique_ptr<FlightMetadataWriter> writer);
 
+  /// \brief Process a stream of IPC payloads sent from a client, and send a
+  /// stream of IPC payloads back on the same call
+  ///
+  /// Reading and writing can be interleaved, so that the client receives
+  /// results while it is still sending data.
+  ///
+  /// \param[in] context The call context.
+  /// \param[in] reader a sequence of uploaded record batches
+  /// \param[in] writer send record batches and metadata back to the client
+  /// \return Status
+  virtual Status DoExchange(const ServerCallContext& context,
+                            std::unique_ptr<FlightMessageReader> reader,
+                            std::unique_ptr<FlightMessageWriter> writer);
+
   /// \brief Execute an action, return stream of zero or more results
   /// \param[in] context The call context.
   /// \param[in] action the action to execute, with type and body
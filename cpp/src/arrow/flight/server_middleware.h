@@ -48,6 +48,10 @@ class ARROW_FLIGHT_EXPORT ServerMiddleware {
 
   /// \brief A callback after the call has completed.
   virtual void CallCompleted(const Status& status) = 0;
+
+  /// \brief A callback with the data transfer metrics of the call, right
+  /// before CallCompleted. The default implementation ignores them.
+  virtual void CallMetricsAvailable(const CallMetrics& metrics) {}
 };
 
 /// \brief A factory for new middleware instances.
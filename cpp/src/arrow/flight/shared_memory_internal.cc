@@ -0,0 +1,294 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/shared_memory_internal.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/types.h"
+#include "arrow/ipc/message.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+using arrow::internal::IOErrorFromErrno;
+
+const char* kSharedMemoryHeader = "arrow-flight-shm-segment";
+const char* kSharedMemoryAcceptedHeader = "arrow-flight-shm-accepted";
+
+namespace {
+
+constexpr uint64_t kRingMagic = 0x4d48535448474c46ULL;  // "FLGHTSHM"
+
+// Tags at the start of each body sent on a shared memory call
+constexpr uint64_t kInlineBody = 0;
+constexpr uint64_t kSharedBody = 1;
+
+// Size of a shared body reference: tag, offset and length
+constexpr int64_t kReferenceSize = 3 * sizeof(uint64_t);
+
+// The ring data starts after the header, on its own cache line
+constexpr int64_t kHeaderSize = 64;
+
+static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+}  // namespace
+
+struct SharedMemoryRing::RingHeader {
+  uint64_t magic;
+  int64_t capacity;
+  // Total number of bytes released by the reader, the writer may reuse the
+  // space up to `released + capacity`
+  std::atomic<int64_t> released;
+};
+
+static_assert(sizeof(std::atomic<int64_t>) == sizeof(int64_t),
+              "Atomic counters must be plain integers to be shared across processes");
+
+SharedMemoryRing::SharedMemoryRing(std::string name, uint8_t* mapping, int64_t capacity,
+                                   bool owner)
+    : name_(std::move(name)),
+      mapping_(mapping),
+      capacity_(capacity),
+      owner_(owner),
+      position_(0) {}
+
+SharedMemoryRing::RingHeader* SharedMemoryRing::header() const {
+  return reinterpret_cast<RingHeader*>(mapping_);
+}
+
+uint8_t* SharedMemoryRing::data() const { return mapping_ + kHeaderSize; }
+
+#ifndef _WIN32
+
+namespace {
+
+std::string MakeSegmentName() {
+  static std::atomic<uint64_t> counter(0);
+  std::random_device random;
+  std::stringstream ss;
+  ss << "/arrow-flight-" << getpid() << "-" << counter++ << "-" << std::hex << random();
+  return ss.str();
+}
+
+}  // namespace
+
+SharedMemoryRing::~SharedMemoryRing() {
+  if (owner_) {
+    // The writer may already have removed the name
+    ARROW_UNUSED(Unlink());
+  }
+  if (munmap(mapping_, static_cast<size_t>(kHeaderSize + capacity_)) != 0) {
+    ARROW_LOG(WARNING) << "Failed to unmap shared memory segment " << name_;
+  }
+}
+
+Status SharedMemoryRing::Create(int64_t capacity,
+                                std::unique_ptr<SharedMemoryRing>* out) {
+  if (capacity <= 0) {
+    return Status::Invalid("Shared memory ring capacity must be positive");
+  }
+  capacity = BitUtil::RoundUpToMultipleOf64(capacity);
+  const std::string name = MakeSegmentName();
+  int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) {
+    return IOErrorFromErrno(errno, "Failed to create shared memory segment ", name);
+  }
+  const int64_t size = kHeaderSize + capacity;
+  void* mapping = MAP_FAILED;
+  if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+    mapping = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, fd, 0);
+  }
+  const int errnum = errno;
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return IOErrorFromErrno(errnum, "Failed to map shared memory segment ", name);
+  }
+
+  auto header = new (mapping) RingHeader;
+  header->magic = kRingMagic;
+  header->capacity = capacity;
+  header->released.store(0);
+  out->reset(new SharedMemoryRing(name, reinterpret_cast<uint8_t*>(mapping), capacity,
+                                  /*owner=*/true));
+  return Status::OK();
+}
+
+Status SharedMemoryRing::Open(const std::string& name,
+                              std::unique_ptr<SharedMemoryRing>* out) {
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    return IOErrorFromErrno(errno, "Failed to open shared memory segment ", name);
+  }
+  struct stat st;
+  void* mapping = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > kHeaderSize) {
+    mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, fd, 0);
+  }
+  const int errnum = errno;
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return IOErrorFromErrno(errnum, "Failed to map shared memory segment ", name);
+  }
+
+  auto header = reinterpret_cast<RingHeader*>(mapping);
+  if (header->magic != kRingMagic || header->capacity != st.st_size - kHeaderSize) {
+    munmap(mapping, static_cast<size_t>(st.st_size));
+    return Status::IOError("Not a Flight shared memory segment: ", name);
+  }
+  out->reset(new SharedMemoryRing(name, reinterpret_cast<uint8_t*>(mapping),
+                                  header->capacity, /*owner=*/false));
+  return Status::OK();
+}
+
+Status SharedMemoryRing::Unlink() {
+  if (shm_unlink(name_.c_str()) != 0) {
+    return IOErrorFromErrno(errno, "Failed to unlink shared memory segment ", name_);
+  }
+  return Status::OK();
+}
+
+#else
+
+SharedMemoryRing::~SharedMemoryRing() {}
+
+Status SharedMemoryRing::Create(int64_t capacity,
+                                std::unique_ptr<SharedMemoryRing>* out) {
+  return Status::NotImplemented("Flight shared memory is not supported on Windows");
+}
+
+Status SharedMemoryRing::Open(const std::string& name,
+                              std::unique_ptr<SharedMemoryRing>* out) {
+  return Status::NotImplemented("Flight shared memory is not supported on Windows");
+}
+
+Status SharedMemoryRing::Unlink() {
+  return Status::NotImplemented("Flight shared memory is not supported on Windows");
+}
+
+#endif
+
+Status SharedMemoryRing::ShareBody(FlightPayload* payload) {
+  ipc::internal::IpcPayload& ipc_msg = payload->ipc_message;
+  if (!ipc::Message::HasBody(ipc_msg.type)) {
+    return Status::OK();
+  }
+
+  int64_t body_size = 0;
+  for (const auto& buffer : ipc_msg.body_buffers) {
+    if (buffer) {
+      body_size += BitUtil::RoundUpToMultipleOf8(buffer->size());
+    }
+  }
+
+  // Bodies are contiguous in the ring, skip the end of the ring if needed
+  int64_t offset = position_;
+  if (offset % capacity_ + body_size > capacity_) {
+    offset += capacity_ - offset % capacity_;
+  }
+  const int64_t end = offset + body_size;
+  const int64_t released = header()->released.load(std::memory_order_acquire);
+
+  if (body_size == 0 || end - released > capacity_) {
+    std::shared_ptr<Buffer> tag;
+    RETURN_NOT_OK(AllocateBuffer(sizeof(uint64_t), &tag));
+    std::memcpy(tag->mutable_data(), &kInlineBody, sizeof(uint64_t));
+    ipc_msg.body_buffers.insert(ipc_msg.body_buffers.begin(), std::move(tag));
+    ipc_msg.body_length += sizeof(uint64_t);
+    return Status::OK();
+  }
+
+  uint8_t* dest = data() + offset % capacity_;
+  for (const auto& buffer : ipc_msg.body_buffers) {
+    if (!buffer) continue;
+    std::memcpy(dest, buffer->data(), static_cast<size_t>(buffer->size()));
+    dest += buffer->size();
+    const int64_t padding =
+        BitUtil::RoundUpToMultipleOf8(buffer->size()) - buffer->size();
+    std::memcpy(dest, kPaddingBytes, static_cast<size_t>(padding));
+    dest += padding;
+  }
+  position_ = end;
+
+  std::shared_ptr<Buffer> reference;
+  RETURN_NOT_OK(AllocateBuffer(kReferenceSize, &reference));
+  const uint64_t fields[3] = {kSharedBody, static_cast<uint64_t>(offset),
+                              static_cast<uint64_t>(body_size)};
+  std::memcpy(reference->mutable_data(), fields, kReferenceSize);
+  ipc_msg.body_buffers = {std::move(reference)};
+  ipc_msg.body_length = kReferenceSize;
+  return Status::OK();
+}
+
+Status SharedMemoryRing::ResolveBody(MemoryPool* pool, std::shared_ptr<Buffer>* body) {
+  if (!*body) {
+    return Status::OK();
+  }
+  uint64_t tag;
+  if ((*body)->size() < static_cast<int64_t>(sizeof(tag))) {
+    return Status::IOError("Shared memory call: missing body tag");
+  }
+  std::memcpy(&tag, (*body)->data(), sizeof(tag));
+  if (tag == kInlineBody) {
+    *body = SliceBuffer(*body, sizeof(tag));
+    return Status::OK();
+  }
+  if (tag != kSharedBody || (*body)->size() != kReferenceSize) {
+    return Status::IOError("Shared memory call: invalid body tag");
+  }
+
+  uint64_t fields[3];
+  std::memcpy(fields, (*body)->data(), kReferenceSize);
+  const auto offset = static_cast<int64_t>(fields[1]);
+  const auto length = static_cast<int64_t>(fields[2]);
+  if (offset < position_ || length < 0 || offset % capacity_ + length > capacity_) {
+    return Status::IOError("Shared memory call: body reference out of bounds");
+  }
+
+  std::shared_ptr<Buffer> result;
+  RETURN_NOT_OK(AllocateBuffer(pool, length, &result));
+  std::memcpy(result->mutable_data(), data() + offset % capacity_,
+              static_cast<size_t>(length));
+  position_ = offset + length;
+  header()->released.store(position_, std::memory_order_release);
+  *body = std::move(result);
+  return Status::OK();
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
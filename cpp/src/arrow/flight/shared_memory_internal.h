@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Shared memory data plane for co-located Flight clients and servers
+// (grpc+shm locations).
+//
+// Calls are still made with gRPC over a Unix domain socket. For DoGet, the
+// client creates a ring buffer in POSIX shared memory and passes its name in a
+// call header. If the server manages to map it, it acknowledges it in its
+// initial metadata, then copies record batch bodies into the ring and only
+// sends their offset and length in the FlightData body. The client copies each
+// body out of the ring, which releases the space for the server to reuse.
+//
+// On such a call, every body starts with an 8-byte tag. Bodies which don't fit
+// in the free space of the ring are sent inline after the tag, so that a slow
+// reader never blocks the server.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/flight/visibility.h"
+#include "arrow/status.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+
+namespace flight {
+
+struct FlightPayload;
+
+namespace internal {
+
+/// The name of the call header carrying the name of the client's segment.
+ARROW_FLIGHT_EXPORT
+extern const char* kSharedMemoryHeader;
+
+/// The name of the server initial metadata entry acknowledging the segment.
+ARROW_FLIGHT_EXPORT
+extern const char* kSharedMemoryAcceptedHeader;
+
+/// \brief A single-producer, single-consumer ring of message bodies in a
+/// POSIX shared memory segment
+class ARROW_FLIGHT_EXPORT SharedMemoryRing {
+ public:
+  ~SharedMemoryRing();
+
+  /// \brief Create and map a segment with a unique name, on the reading side.
+  /// The segment is unlinked when the ring is destroyed.
+  static Status Create(int64_t capacity, std::unique_ptr<SharedMemoryRing>* out);
+
+  /// \brief Map a segment created by the reading side, on the writing side
+  static Status Open(const std::string& name, std::unique_ptr<SharedMemoryRing>* out);
+
+  /// \brief Remove the name of the segment. Existing mappings stay valid.
+  Status Unlink();
+
+  const std::string& name() const { return name_; }
+  int64_t capacity() const { return capacity_; }
+
+  /// \brief Tag the body of an outgoing payload, replacing it with a reference
+  /// to a copy in the ring if there is enough free space
+  Status ShareBody(FlightPayload* payload);
+
+  /// \brief Strip the tag of a body written with ShareBody, copying it out of the
+  /// ring and releasing its space if it was shared. Bodies must be resolved in
+  /// the order they were written.
+  Status ResolveBody(MemoryPool* pool, std::shared_ptr<Buffer>* body);
+
+ private:
+  struct RingHeader;
+
+  SharedMemoryRing(std::string name, uint8_t* mapping, int64_t capacity, bool owner);
+
+  RingHeader* header() const;
+  uint8_t* data() const;
+
+  std::string name_;
+  uint8_t* mapping_;
+  int64_t capacity_;
+  // Whether the name must be unlinked on destruction
+  bool owner_;
+  // Total number of bytes reserved by the writer, or read by the reader
+  int64_t position_;
+};
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
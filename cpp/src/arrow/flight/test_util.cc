@@ -23,6 +23,7 @@
 #endif
 
 #include <cstdlib>
+#include <limits>
 #include <sstream>
 
 #include <boost/filesystem.hpp>
@@ -39,6 +40,7 @@
 
 #include "arrow/ipc/test_common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/flight/api.h"
@@ -104,9 +106,11 @@ void TestServer::Start() {
     ARROW_CHECK(st.IsNotImplemented()) << st.ToString();
   }
 
+  std::vector<std::string> args = {"-port", str_port};
+  args.insert(args.end(), args_.begin(), args_.end());
   try {
     server_process_ = std::make_shared<bp::child>(
-        bp::search_path(executable_name_, search_path), "-port", str_port);
+        bp::search_path(executable_name_, search_path), bp::args(args));
   } catch (...) {
     std::stringstream ss;
     ss << "Failed to launch test server '" << executable_name_ << "', looked in ";
@@ -271,6 +275,11 @@ Status NumberingStream::GetSchemaPayload(FlightPayload* payload) {
   return stream_->GetSchemaPayload(payload);
 }
 
+Status NumberingStream::SetCompression(Compression::type codec,
+                                       int compression_level) {
+  return stream_->SetCompression(codec, compression_level);
+}
+
 Status NumberingStream::Next(FlightPayload* payload) {
   RETURN_NOT_OK(stream_->Next(payload));
   if (payload && payload->ipc_message.type == ipc::Message::RECORD_BATCH) {
@@ -350,6 +359,78 @@ Status ExampleDictBatches(BatchVector* out) {
   return Status::OK();
 }
 
+Status PerfSchema(const std::string& name, std::shared_ptr<Schema>* out) {
+  std::vector<std::shared_ptr<Field>> fields = {field("a", int64())};
+  if (name == "int64") {
+    for (const char* column : {"b", "c", "d"}) {
+      fields.push_back(field(column, int64()));
+    }
+  } else if (name == "wide") {
+    for (int i = 1; i < 100; ++i) {
+      fields.push_back(field("f" + std::to_string(i), i % 2 ? float64() : int64()));
+    }
+  } else if (name == "string") {
+    fields.push_back(field("b", utf8()));
+    fields.push_back(field("c", utf8()));
+    fields.push_back(field("d", utf8()));
+  } else if (name == "nested") {
+    fields.push_back(field("b", list(int64())));
+    fields.push_back(field("c", struct_({field("x", float64()), field("y", utf8())})));
+    fields.push_back(field("d", list(utf8())));
+  } else {
+    return Status::Invalid("Unknown performance schema: ", name);
+  }
+  *out = ::arrow::schema(fields);
+  return Status::OK();
+}
+
+namespace {
+
+Status MakePerfArray(const std::shared_ptr<DataType>& type, int64_t length,
+                     random::RandomArrayGenerator* rand, std::shared_ptr<Array>* out) {
+  switch (type->id()) {
+    case Type::INT64:
+      *out = rand->Int64(length, 0, std::numeric_limits<int64_t>::max());
+      return Status::OK();
+    case Type::DOUBLE:
+      *out = rand->Float64(length, -1e9, 1e9);
+      return Status::OK();
+    case Type::STRING:
+      *out = rand->String(length, 0, 64);
+      return Status::OK();
+    case Type::LIST: {
+      // Lists of 4 values on average
+      std::shared_ptr<Array> values;
+      RETURN_NOT_OK(MakePerfArray(type->child(0)->type(), length * 4, rand, &values));
+      auto offsets = rand->Offsets(length + 1, 0, static_cast<int32_t>(length * 4));
+      return ListArray::FromArrays(*offsets, *values, default_memory_pool(), out);
+    }
+    case Type::STRUCT: {
+      std::vector<std::shared_ptr<Array>> children(type->num_children());
+      for (int i = 0; i < type->num_children(); ++i) {
+        RETURN_NOT_OK(MakePerfArray(type->child(i)->type(), length, rand, &children[i]));
+      }
+      ARROW_ASSIGN_OR_RAISE(*out, StructArray::Make(children, type->children()));
+      return Status::OK();
+    }
+    default:
+      return Status::NotImplemented("Performance data of type ", type->ToString());
+  }
+}
+
+}  // namespace
+
+Status MakePerfBatch(const std::shared_ptr<Schema>& schema, int64_t length, int32_t seed,
+                     std::shared_ptr<RecordBatch>* out) {
+  random::RandomArrayGenerator rand(seed);
+  std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    RETURN_NOT_OK(MakePerfArray(schema->field(i)->type(), length, &rand, &columns[i]));
+  }
+  *out = RecordBatch::Make(schema, length, std::move(columns));
+  return Status::OK();
+}
+
 std::vector<ActionType> ExampleActionTypes() {
   return {{"drop", "drop a dataset"}, {"cache", "cache a dataset"}};
 }
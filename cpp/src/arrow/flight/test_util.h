@@ -49,8 +49,9 @@ class ARROW_FLIGHT_EXPORT TestServer {
  public:
   explicit TestServer(const std::string& executable_name)
       : executable_name_(executable_name), port_(::arrow::GetListenPort()) {}
-  explicit TestServer(const std::string& executable_name, int port)
-      : executable_name_(executable_name), port_(port) {}
+  explicit TestServer(const std::string& executable_name, int port,
+                      std::vector<std::string> args = {})
+      : executable_name_(executable_name), port_(port), args_(std::move(args)) {}
 
   void Start();
 
@@ -63,6 +64,8 @@ class ARROW_FLIGHT_EXPORT TestServer {
  private:
   std::string executable_name_;
   int port_;
+  // Extra command line arguments for the server
+  std::vector<std::string> args_;
   std::shared_ptr<::boost::process::child> server_process_;
 };
 
@@ -118,6 +121,7 @@ class ARROW_FLIGHT_EXPORT NumberingStream : public FlightDataStream {
   std::shared_ptr<Schema> schema() override;
   Status GetSchemaPayload(FlightPayload* payload) override;
   Status Next(FlightPayload* payload) override;
+  Status SetCompression(Compression::type codec, int compression_level) override;
 
  private:
   int counter_;
@@ -144,6 +148,19 @@ Status ExampleIntBatches(BatchVector* out);
 ARROW_FLIGHT_EXPORT
 Status ExampleDictBatches(BatchVector* out);
 
+/// \brief The schemas of the data used by the performance benchmark:
+/// "int64" (4 int64 columns), "wide" (100 numeric columns), "string"
+/// (mostly strings) or "nested" (list and struct columns). The first
+/// column is always an int64 column named "a".
+ARROW_FLIGHT_EXPORT
+Status PerfSchema(const std::string& name, std::shared_ptr<Schema>* out);
+
+/// \brief Make a record batch of random data without nulls, for a
+/// schema returned by PerfSchema
+ARROW_FLIGHT_EXPORT
+Status MakePerfBatch(const std::shared_ptr<Schema>& schema, int64_t length, int32_t seed,
+                     std::shared_ptr<RecordBatch>* out);
+
 ARROW_FLIGHT_EXPORT
 std::vector<FlightInfo> ExampleFlightInfo();
 
@@ -36,6 +36,7 @@ const char* kSchemeGrpc = "grpc";
 const char* kSchemeGrpcTcp = "grpc+tcp";
 const char* kSchemeGrpcUnix = "grpc+unix";
 const char* kSchemeGrpcTls = "grpc+tls";
+const char* kSchemeGrpcShm = "grpc+shm";
 
 const char* kErrorDetailTypeId = "flight::FlightStatusDetail";
 
@@ -223,6 +224,12 @@ Status Location::ForGrpcUnix(const std::string& path, Location* location) {
   return Location::Parse(uri_string.str(), location);
 }
 
+Status Location::ForGrpcShm(const std::string& path, Location* location) {
+  std::stringstream uri_string;
+  uri_string << "grpc+shm://" << path;
+  return Location::Parse(uri_string.str(), location);
+}
+
 std::string Location::ToString() const { return uri_->ToString(); }
 std::string Location::scheme() const {
   std::string scheme = uri_->scheme();
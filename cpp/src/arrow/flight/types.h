@@ -251,6 +251,8 @@ ARROW_FLIGHT_EXPORT
 extern const char* kSchemeGrpcUnix;
 ARROW_FLIGHT_EXPORT
 extern const char* kSchemeGrpcTls;
+ARROW_FLIGHT_EXPORT
+extern const char* kSchemeGrpcShm;
 
 /// \brief A host location (a URI)
 struct ARROW_FLIGHT_EXPORT Location {
@@ -281,6 +283,13 @@ struct ARROW_FLIGHT_EXPORT Location {
   /// \param[out] location The resulting location
   static Status ForGrpcUnix(const std::string& path, Location* location);
 
+  /// \brief Initialize a location for a Flight service on the same host,
+  /// reached through a domain socket, with DoGet record batch bodies
+  /// transferred through shared memory
+  /// \param[in] path The path to the domain socket
+  /// \param[out] location The resulting location
+  static Status ForGrpcShm(const std::string& path, Location* location);
+
   /// \brief Get a representation of this URI as a string.
   std::string ToString() const;
 
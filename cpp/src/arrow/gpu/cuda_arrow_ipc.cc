@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include "arrow/buffer.h"
@@ -83,5 +84,108 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
   return ReadRecordBatch(schema, buffer, pool).Value(out);
 }
 
+// ----------------------------------------------------------------------
+// Stream reader
+
+namespace {
+
+// Same key as in ipc/metadata_internal.h
+constexpr const char* kCompressionMetadataKey = "ARROW:experimental_compression";
+
+// Reads messages from device memory, rejecting those which would need to be
+// processed on the host
+class CudaMessageReader : public ipc::MessageReader {
+ public:
+  CudaMessageReader(std::shared_ptr<CudaBufferReader> reader, MemoryPool* pool)
+      : reader_(std::move(reader)), pool_(pool) {}
+
+  Status ReadNextMessage(std::unique_ptr<ipc::Message>* message) override {
+    // The pool is only used for metadata allocation
+    ARROW_ASSIGN_OR_RAISE(*message, ipc::ReadMessage(reader_.get(), pool_));
+    if (*message == nullptr || (*message)->body() == nullptr) {
+      return Status::OK();
+    }
+    // The metadata was verified when reading the message
+    const auto fb_message = flatbuf::GetMessage((*message)->metadata()->data());
+    const auto fb_metadata = fb_message->custom_metadata();
+    if (fb_metadata != nullptr) {
+      for (const auto pair : *fb_metadata) {
+        if (pair->key() != nullptr && pair->key()->str() == kCompressionMetadataKey) {
+          return Status::NotImplemented(
+              "Reading compressed IPC bodies from CUDA device memory");
+        }
+      }
+    }
+    const auto dictionary_batch = fb_message->header_as_DictionaryBatch();
+    if (dictionary_batch != nullptr && dictionary_batch->isDelta()) {
+      return Status::NotImplemented("Reading dictionary deltas from CUDA device memory");
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<CudaBufferReader> reader_;
+  MemoryPool* pool_;
+};
+
+}  // namespace
+
+CudaRecordBatchStreamReader::CudaRecordBatchStreamReader(
+    std::shared_ptr<RecordBatchReader> reader)
+    : reader_(std::move(reader)) {}
+
+Result<std::shared_ptr<CudaRecordBatchStreamReader>> CudaRecordBatchStreamReader::Open(
+    std::shared_ptr<CudaBufferReader> reader, MemoryPool* pool) {
+  std::unique_ptr<ipc::MessageReader> message_reader(
+      new CudaMessageReader(std::move(reader), pool));
+  std::shared_ptr<RecordBatchReader> batch_reader;
+  RETURN_NOT_OK(
+      ipc::RecordBatchStreamReader::Open(std::move(message_reader), &batch_reader));
+  return std::shared_ptr<CudaRecordBatchStreamReader>(
+      new CudaRecordBatchStreamReader(std::move(batch_reader)));
+}
+
+std::shared_ptr<Schema> CudaRecordBatchStreamReader::schema() const {
+  return reader_->schema();
+}
+
+Status CudaRecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return reader_->ReadNext(batch);
+}
+
+// ----------------------------------------------------------------------
+// Stream writer
+
+CudaRecordBatchStreamWriter::CudaRecordBatchStreamWriter(
+    std::shared_ptr<CudaBufferWriter> sink,
+    std::shared_ptr<ipc::RecordBatchWriter> writer)
+    : sink_(std::move(sink)), writer_(std::move(writer)) {}
+
+Result<std::shared_ptr<CudaRecordBatchStreamWriter>> CudaRecordBatchStreamWriter::Open(
+    std::shared_ptr<CudaBufferWriter> sink, const std::shared_ptr<Schema>& schema,
+    const ipc::IpcOptions& options) {
+  if (options.compression != Compression::UNCOMPRESSED) {
+    return Status::NotImplemented("Compressing IPC bodies in CUDA device memory");
+  }
+  if (options.emit_dictionary_deltas) {
+    return Status::NotImplemented("Writing dictionary deltas to CUDA device memory");
+  }
+  // CudaBufferWriter copies device buffers device-to-device
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::RecordBatchStreamWriter::Open(sink.get(), schema, options));
+  return std::shared_ptr<CudaRecordBatchStreamWriter>(
+      new CudaRecordBatchStreamWriter(std::move(sink), std::move(writer)));
+}
+
+Status CudaRecordBatchStreamWriter::WriteRecordBatch(const RecordBatch& batch) {
+  return writer_->WriteRecordBatch(batch);
+}
+
+Status CudaRecordBatchStreamWriter::Close() { return writer_->Close(); }
+
+void CudaRecordBatchStreamWriter::set_memory_pool(MemoryPool* pool) {
+  writer_->set_memory_pool(pool);
+}
+
 }  // namespace cuda
 }  // namespace arrow
@@ -22,6 +22,9 @@
 #include <memory>
 
 #include "arrow/buffer.h"
+#include "arrow/ipc/options.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
 
@@ -92,6 +95,66 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
                        const std::shared_ptr<CudaBuffer>& buffer, MemoryPool* pool,
                        std::shared_ptr<RecordBatch>* out);
 
+/// \class CudaRecordBatchStreamReader
+/// \brief Read an Arrow IPC stream located on GPU device
+///
+/// The message metadata is copied to host memory, while the bodies are read
+/// zero-copy: the record batches returned point to device memory. Compressed
+/// bodies and dictionary deltas are not supported.
+class ARROW_EXPORT CudaRecordBatchStreamReader : public RecordBatchReader {
+ public:
+  /// \brief Open a stream reader, reading the schema message
+  /// \param[in] reader a CudaBufferReader positioned at the start of the stream
+  /// \param[in] pool a MemoryPool to allocate CPU memory for the metadata
+  /// \return the stream reader or Status
+  static Result<std::shared_ptr<CudaRecordBatchStreamReader>> Open(
+      std::shared_ptr<CudaBufferReader> reader, MemoryPool* pool = default_memory_pool());
+
+  std::shared_ptr<Schema> schema() const override;
+
+  /// \brief Read the next record batch, or nullptr at the end of the stream
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  explicit CudaRecordBatchStreamReader(std::shared_ptr<RecordBatchReader> reader);
+
+  std::shared_ptr<RecordBatchReader> reader_;
+};
+
+/// \class CudaRecordBatchStreamWriter
+/// \brief Write an Arrow IPC stream to GPU device memory
+///
+/// Bodies of record batches located on a device are copied device-to-device,
+/// those located on the host are copied from the host. The stream must fit in
+/// the buffer of the CudaBufferWriter. Arrays on a device must not be sliced,
+/// and the dictionaries of a field must be the same arrays in all the record
+/// batches. Body compression and dictionary deltas are not supported.
+class ARROW_EXPORT CudaRecordBatchStreamWriter : public ipc::RecordBatchWriter {
+ public:
+  /// \brief Open a stream writer, writing the schema message
+  /// \param[in] sink a CudaBufferWriter, which the caller must close
+  /// \param[in] schema the schema of the record batches to be written
+  /// \param[in] options IPC options
+  /// \return the stream writer or Status
+  static Result<std::shared_ptr<CudaRecordBatchStreamWriter>> Open(
+      std::shared_ptr<CudaBufferWriter> sink, const std::shared_ptr<Schema>& schema,
+      const ipc::IpcOptions& options = ipc::IpcOptions::Defaults());
+
+  Status WriteRecordBatch(const RecordBatch& batch) override;
+
+  /// \brief Write the end-of-stream marker
+  Status Close() override;
+
+  void set_memory_pool(MemoryPool* pool) override;
+
+ private:
+  CudaRecordBatchStreamWriter(std::shared_ptr<CudaBufferWriter> sink,
+                              std::shared_ptr<ipc::RecordBatchWriter> writer);
+
+  std::shared_ptr<CudaBufferWriter> sink_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+};
+
 }  // namespace cuda
 }  // namespace arrow
 
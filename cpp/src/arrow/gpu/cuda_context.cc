@@ -23,6 +23,7 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -30,6 +31,7 @@
 
 #include "arrow/gpu/cuda_internal.h"
 #include "arrow/gpu/cuda_memory.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 
 namespace arrow {
@@ -65,10 +67,143 @@ struct DeviceProperties {
 
 const char kCudaDeviceTypeName[] = "arrow::cuda::CudaDevice";
 
+// Smallest block handed out by the memory cache, which keeps blocks aligned
+// like cuMemAlloc does
+constexpr int64_t kMinBlockSize = 512;
+// Blocks smaller than this are sub-allocated from chunks of kChunkSize bytes
+constexpr int64_t kMaxSubAllocatedSize = 1 << 20;
+constexpr int64_t kChunkSize = 2 << 20;
+
+// Round an allocation size up to its size class. Classes are spaced by a
+// quarter of the previous power of two, which wastes at most 25% of a block.
+int64_t BlockSize(int64_t nbytes) {
+  if (nbytes <= kMinBlockSize) {
+    return kMinBlockSize;
+  }
+  const int64_t step = (static_cast<int64_t>(1) << BitUtil::Log2(nbytes)) / 8;
+  return BitUtil::RoundUp(nbytes, step);
+}
+
 }  // namespace
 
+// ----------------------------------------------------------------------
+// Device memory cache
+
+class CudaMemoryCache {
+ public:
+  explicit CudaMemoryCache(int64_t max_cached_bytes)
+      : max_cached_bytes_(max_cached_bytes) {}
+
+  ~CudaMemoryCache() {
+    // The context may already be gone at exit, errors are ignored
+    for (const auto& entry : free_blocks_) {
+      if (entry.first >= kMaxSubAllocatedSize) {
+        for (CUdeviceptr block : entry.second) {
+          cuMemFree(block);
+        }
+      }
+    }
+    for (CUdeviceptr chunk : chunks_) {
+      cuMemFree(chunk);
+    }
+  }
+
+  // Must be called with the device's primary context current
+  Status Allocate(int64_t nbytes, CUdeviceptr* out) {
+    const int64_t block_size = BlockSize(nbytes);
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.num_allocations;
+    auto& free_blocks = free_blocks_[block_size];
+    if (!free_blocks.empty()) {
+      ++stats_.num_cache_hits;
+      stats_.bytes_cached -= block_size;
+    } else if (block_size < kMaxSubAllocatedSize) {
+      CUdeviceptr chunk;
+      CU_RETURN_NOT_OK("cuMemAlloc", cuMemAlloc(&chunk, kChunkSize));
+      chunks_.push_back(chunk);
+      stats_.bytes_reserved += kChunkSize;
+      const int64_t num_blocks = kChunkSize / block_size;
+      for (int64_t i = num_blocks - 1; i >= 0; --i) {
+        free_blocks.push_back(chunk + i * block_size);
+      }
+      stats_.bytes_cached += (num_blocks - 1) * block_size;
+    } else {
+      CUdeviceptr block;
+      CU_RETURN_NOT_OK("cuMemAlloc",
+                       cuMemAlloc(&block, static_cast<size_t>(block_size)));
+      free_blocks.push_back(block);
+      stats_.bytes_reserved += block_size;
+    }
+    *out = free_blocks.back();
+    free_blocks.pop_back();
+    used_blocks_[*out] = block_size;
+    stats_.bytes_allocated += block_size;
+    return Status::OK();
+  }
+
+  // Return false if the memory wasn't allocated by this cache
+  Result<bool> Free(CUdeviceptr ptr) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = used_blocks_.find(ptr);
+    if (it == used_blocks_.end()) {
+      return false;
+    }
+    const int64_t block_size = it->second;
+    used_blocks_.erase(it);
+    stats_.bytes_allocated -= block_size;
+    if (block_size >= kMaxSubAllocatedSize &&
+        large_bytes_cached_ + block_size > max_cached_bytes_) {
+      stats_.bytes_reserved -= block_size;
+      CU_RETURN_NOT_OK("cuMemFree", cuMemFree(ptr));
+      return true;
+    }
+    if (block_size >= kMaxSubAllocatedSize) {
+      large_bytes_cached_ += block_size;
+    }
+    stats_.bytes_cached += block_size;
+    free_blocks_[block_size].push_back(ptr);
+    return true;
+  }
+
+  Status ReleaseLargeBlocks() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& entry : free_blocks_) {
+      if (entry.first < kMaxSubAllocatedSize) {
+        continue;
+      }
+      while (!entry.second.empty()) {
+        CU_RETURN_NOT_OK("cuMemFree", cuMemFree(entry.second.back()));
+        entry.second.pop_back();
+        large_bytes_cached_ -= entry.first;
+        stats_.bytes_cached -= entry.first;
+        stats_.bytes_reserved -= entry.first;
+      }
+    }
+    return Status::OK();
+  }
+
+  CudaMemoryCacheStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  const int64_t max_cached_bytes_;
+  mutable std::mutex mutex_;
+  // Free blocks by block size
+  std::unordered_map<int64_t, std::vector<CUdeviceptr>> free_blocks_;
+  // Sizes of the blocks in use
+  std::unordered_map<CUdeviceptr, int64_t> used_blocks_;
+  // Chunks the small blocks are sub-allocated from
+  std::vector<CUdeviceptr> chunks_;
+  int64_t large_bytes_cached_ = 0;
+  CudaMemoryCacheStats stats_;
+};
+
 struct CudaDevice::Impl {
   DeviceProperties props;
+  // Only accessed with the atomic functions for shared_ptr
+  std::shared_ptr<CudaMemoryCache> memory_cache;
 };
 
 // ----------------------------------------------------------------------
@@ -81,6 +216,7 @@ class CudaContext::Impl {
   Status Init(const std::shared_ptr<CudaDevice>& device) {
     mm_ = checked_pointer_cast<CudaMemoryManager>(device->default_memory_manager());
     props_ = &device->impl_->props;
+    device_impl_ = device->impl_.get();
     own_context_ = true;
     CU_RETURN_NOT_OK("cuDevicePrimaryCtxRetain",
                      cuDevicePrimaryCtxRetain(&context_, props_->handle_));
@@ -91,6 +227,7 @@ class CudaContext::Impl {
   Status InitShared(const std::shared_ptr<CudaDevice>& device, CUcontext ctx) {
     mm_ = checked_pointer_cast<CudaMemoryManager>(device->default_memory_manager());
     props_ = &device->impl_->props;
+    device_impl_ = device->impl_.get();
     own_context_ = false;
     context_ = ctx;
     is_open_ = true;
@@ -112,7 +249,12 @@ class CudaContext::Impl {
     if (nbytes > 0) {
       ContextSaver set_temporary(context_);
       CUdeviceptr data;
-      CU_RETURN_NOT_OK("cuMemAlloc", cuMemAlloc(&data, static_cast<size_t>(nbytes)));
+      auto cache = memory_cache();
+      if (cache) {
+        RETURN_NOT_OK(cache->Allocate(nbytes, &data));
+      } else {
+        CU_RETURN_NOT_OK("cuMemAlloc", cuMemAlloc(&data, static_cast<size_t>(nbytes)));
+      }
       bytes_allocated_ += nbytes;
       *out = reinterpret_cast<uint8_t*>(data);
     } else {
@@ -133,6 +275,22 @@ class CudaContext::Impl {
     return Status::OK();
   }
 
+  Status CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyHtoDAsync",
+                     cuMemcpyHtoDAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyDtoHAsync",
+                     cuMemcpyDtoHAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
   Status CopyDeviceToDevice(uintptr_t dst, uintptr_t src, int64_t nbytes) {
     ContextSaver set_temporary(context_);
     CU_RETURN_NOT_OK("cuMemcpyDtoD", cuMemcpyDtoD(dst, src, static_cast<size_t>(nbytes)));
@@ -155,7 +313,15 @@ class CudaContext::Impl {
   }
 
   Status Free(void* device_ptr, int64_t nbytes) {
-    CU_RETURN_NOT_OK("cuMemFree", cuMemFree(reinterpret_cast<CUdeviceptr>(device_ptr)));
+    auto data = reinterpret_cast<CUdeviceptr>(device_ptr);
+    auto cache = memory_cache();
+    bool cached = false;
+    if (cache) {
+      ARROW_ASSIGN_OR_RAISE(cached, cache->Free(data));
+    }
+    if (!cached) {
+      CU_RETURN_NOT_OK("cuMemFree", cuMemFree(data));
+    }
     bytes_allocated_ -= nbytes;
     return Status::OK();
   }
@@ -195,8 +361,17 @@ class CudaContext::Impl {
   void* context_handle() const { return reinterpret_cast<void*>(context_); }
 
  private:
+  // The memory cache of the device, which only serves primary contexts
+  std::shared_ptr<CudaMemoryCache> memory_cache() const {
+    if (!own_context_) {
+      return nullptr;
+    }
+    return std::atomic_load(&device_impl_->memory_cache);
+  }
+
   std::shared_ptr<CudaMemoryManager> mm_;
   const DeviceProperties* props_;
+  CudaDevice::Impl* device_impl_;
   CUcontext context_;
   bool is_open_;
 
@@ -268,6 +443,26 @@ Result<std::shared_ptr<CudaHostBuffer>> CudaDevice::AllocateHostBuffer(int64_t s
   return std::make_shared<CudaHostBuffer>(reinterpret_cast<uint8_t*>(ptr), size);
 }
 
+Status CudaDevice::EnableMemoryCache(int64_t max_cached_bytes) {
+  std::shared_ptr<CudaMemoryCache> expected;
+  if (!std::atomic_compare_exchange_strong(
+          &impl_->memory_cache, &expected,
+          std::make_shared<CudaMemoryCache>(max_cached_bytes))) {
+    return Status::Invalid("Memory cache already enabled for ", ToString());
+  }
+  return Status::OK();
+}
+
+CudaMemoryCacheStats CudaDevice::memory_cache_stats() const {
+  auto cache = std::atomic_load(&impl_->memory_cache);
+  return cache ? cache->stats() : CudaMemoryCacheStats();
+}
+
+Status CudaDevice::ReleaseCachedMemory() {
+  auto cache = std::atomic_load(&impl_->memory_cache);
+  return cache ? cache->ReleaseLargeBlocks() : Status::OK();
+}
+
 bool IsCudaDevice(const Device& device) {
   return device.type_name() == kCudaDeviceTypeName;
 }
@@ -587,6 +782,18 @@ Status CudaContext::CopyDeviceToHost(void* dst, const void* src, int64_t nbytes)
   return impl_->CopyDeviceToHost(dst, reinterpret_cast<uintptr_t>(src), nbytes);
 }
 
+Status CudaContext::CopyHostToDeviceAsync(uintptr_t dst, const void* src,
+                                          int64_t nbytes, void* stream) {
+  return impl_->CopyHostToDeviceAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream));
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                                          void* stream) {
+  return impl_->CopyDeviceToHostAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream));
+}
+
 Status CudaContext::CopyDeviceToDevice(uintptr_t dst, uintptr_t src, int64_t nbytes) {
   return impl_->CopyDeviceToDevice(dst, src, nbytes);
 }
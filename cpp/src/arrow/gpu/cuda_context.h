@@ -39,6 +39,20 @@ class CudaMemoryManager;
 
 // XXX Should CudaContext be merged into CudaMemoryManager?
 
+/// \brief Statistics of the device memory cache of a CudaDevice
+struct ARROW_EXPORT CudaMemoryCacheStats {
+  /// Bytes of the blocks in use by buffers, rounded up to their size class
+  int64_t bytes_allocated = 0;
+  /// Bytes of the free blocks kept for reuse
+  int64_t bytes_cached = 0;
+  /// Bytes of device memory obtained from the driver
+  int64_t bytes_reserved = 0;
+  /// Number of allocations served by the cache
+  int64_t num_allocations = 0;
+  /// Number of allocations served without allocating from the driver
+  int64_t num_cache_hits = 0;
+};
+
 class ARROW_EXPORT CudaDeviceManager {
  public:
   static Result<CudaDeviceManager*> Instance();
@@ -161,6 +175,26 @@ class ARROW_EXPORT CudaDevice : public Device {
   /// \param[in] size The buffer size in bytes
   Result<std::shared_ptr<CudaHostBuffer>> AllocateHostBuffer(int64_t size);
 
+  /// \brief Cache the device memory allocated on this device
+  ///
+  /// Once enabled, device memory allocated through the primary contexts of
+  /// this device is rounded up to a size class and kept for reuse when the
+  /// buffers are freed, instead of calling the driver for each allocation.
+  /// This applies to all CudaBuffers allocated by these contexts, including
+  /// by the CudaMemoryManager. Blocks smaller than 1 MiB are sub-allocated
+  /// from larger blocks, which are kept until the device is destroyed.
+  /// Larger free blocks are only kept up to max_cached_bytes.
+  ///
+  /// \param[in] max_cached_bytes the maximum size of the cached large blocks
+  Status EnableMemoryCache(int64_t max_cached_bytes = 1LL << 30);
+
+  /// \brief Return the statistics of the memory cache, or zeros if it isn't
+  /// enabled
+  CudaMemoryCacheStats memory_cache_stats() const;
+
+  /// \brief Return the cached large blocks to the driver
+  Status ReleaseCachedMemory();
+
  protected:
   struct Impl;
 
@@ -351,6 +385,9 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   Status CopyHostToDevice(uintptr_t dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, uintptr_t src, int64_t nbytes);
+  Status CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                               void* stream);
+  Status CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes, void* stream);
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToDevice(uintptr_t dst, uintptr_t src, int64_t nbytes);
   Status CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>& dst_ctx, void* dst,
@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <utility>
 
 #include <cuda.h>
@@ -188,6 +190,19 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(mutable_data_ + position, data, nbytes);
 }
 
+Status CudaBuffer::CopyToHostAsync(const int64_t position, const int64_t nbytes,
+                                   void* out, void* stream) const {
+  return context_->CopyDeviceToHostAsync(out, address() + position, nbytes, stream);
+}
+
+Status CudaBuffer::CopyFromHostAsync(const int64_t position, const void* data,
+                                     int64_t nbytes, void* stream) {
+  if (nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  return context_->CopyHostToDeviceAsync(address() + position, data, nbytes, stream);
+}
+
 Status CudaBuffer::CopyFromDevice(const int64_t position, const void* data,
                                   int64_t nbytes) {
   if (nbytes > size_ - position) {
@@ -230,6 +245,69 @@ Result<uintptr_t> CudaHostBuffer::GetDeviceAddress(
   return ::arrow::cuda::GetDeviceAddress(data(), ctx);
 }
 
+// ----------------------------------------------------------------------
+// CudaHostMemoryPool
+
+namespace {
+
+// Returned for zero-sized allocations, which cuMemHostAlloc rejects
+alignas(64) uint8_t zero_size_area[1];
+
+}  // namespace
+
+CudaHostMemoryPool::CudaHostMemoryPool(std::shared_ptr<CudaContext> context)
+    : context_(std::move(context)) {}
+
+Result<std::shared_ptr<CudaHostMemoryPool>> CudaHostMemoryPool::Make(int device_number) {
+  ARROW_ASSIGN_OR_RAISE(auto manager, CudaDeviceManager::Instance());
+  ARROW_ASSIGN_OR_RAISE(auto context, manager->GetContext(device_number));
+  return std::shared_ptr<CudaHostMemoryPool>(new CudaHostMemoryPool(std::move(context)));
+}
+
+Status CudaHostMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (size < 0) {
+    return Status::Invalid("negative malloc size");
+  }
+  if (size == 0) {
+    *out = zero_size_area;
+    return Status::OK();
+  }
+  ContextSaver set_temporary(*context_);
+  // Page-locked memory is page-aligned, which satisfies the Arrow alignment
+  CU_RETURN_NOT_OK("cuMemHostAlloc",
+                   cuMemHostAlloc(reinterpret_cast<void**>(out),
+                                  static_cast<size_t>(size), CU_MEMHOSTALLOC_PORTABLE));
+  stats_.UpdateAllocatedBytes(size);
+  return Status::OK();
+}
+
+Status CudaHostMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  uint8_t* out;
+  RETURN_NOT_OK(Allocate(new_size, &out));
+  std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+  Free(*ptr, old_size);
+  *ptr = out;
+  return Status::OK();
+}
+
+void CudaHostMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  if (buffer == zero_size_area) {
+    return;
+  }
+  CUresult res = cuMemFreeHost(buffer);
+  if (res != CUDA_SUCCESS) {
+    ARROW_LOG(WARNING) << internal::StatusFromCuda(res, "cuMemFreeHost").ToString();
+  }
+  stats_.UpdateAllocatedBytes(-size);
+}
+
+int64_t CudaHostMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t CudaHostMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+std::string CudaHostMemoryPool::backend_name() const { return "cuda_host"; }
+
 // ----------------------------------------------------------------------
 // CudaBufferReader
 
@@ -370,11 +448,19 @@ class CudaBufferWriter::CudaBufferWriterImpl {
     return position_;
   }
 
+  Status CheckOverflow(int64_t nbytes) const {
+    if (nbytes > size_ - position_) {
+      return Status::IOError("Write would overflow CUDA buffer");
+    }
+    return Status::OK();
+  }
+
   Status Write(const void* data, int64_t nbytes) {
     CHECK_CLOSED();
     if (nbytes == 0) {
       return Status::OK();
     }
+    RETURN_NOT_OK(CheckOverflow(nbytes));
 
     if (buffer_size_ > 0) {
       if (nbytes + buffer_position_ >= buffer_size_) {
@@ -394,6 +480,26 @@ class CudaBufferWriter::CudaBufferWriterImpl {
     return Status::OK();
   }
 
+  Status WriteDevice(const CudaBuffer& data) {
+    CHECK_CLOSED();
+    const int64_t nbytes = data.size();
+    if (nbytes == 0) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(CheckOverflow(nbytes));
+    // Buffered bytes go first
+    RETURN_NOT_OK(FlushInternal());
+    if (data.context()->handle() == context_->handle()) {
+      RETURN_NOT_OK(context_->CopyDeviceToDevice(address_ + position_, data.address(),
+                                                 nbytes));
+    } else {
+      RETURN_NOT_OK(data.context()->CopyDeviceToAnotherDevice(
+          context_, address_ + position_, data.address(), nbytes));
+    }
+    position_ += nbytes;
+    return Status::OK();
+  }
+
   Status WriteAt(int64_t position, const void* data, int64_t nbytes) {
     std::lock_guard<std::mutex> guard(lock_);
     CHECK_CLOSED();
@@ -462,6 +568,14 @@ Status CudaBufferWriter::Write(const void* data, int64_t nbytes) {
   return impl_->Write(data, nbytes);
 }
 
+Status CudaBufferWriter::Write(const std::shared_ptr<Buffer>& data) {
+  if (!IsCudaDevice(*data->device())) {
+    return impl_->Write(data->data(), data->size());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto cuda_data, CudaBuffer::FromBuffer(data));
+  return impl_->WriteDevice(*cuda_data);
+}
+
 Status CudaBufferWriter::WriteAt(int64_t position, const void* data, int64_t nbytes) {
   return impl_->WriteAt(position, data, nbytes);
 }
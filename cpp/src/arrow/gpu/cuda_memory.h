@@ -19,9 +19,11 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #include "arrow/buffer.h"
 #include "arrow/io/concurrency.h"
+#include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
 
 namespace arrow {
@@ -81,6 +83,32 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Enqueue a copy from GPU device to CPU host on a CUDA stream
+  /// \param[in] position start position inside buffer to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to
+  /// \param[in] stream the CUstream to enqueue the copy on
+  /// \return Status
+  ///
+  /// The copy only runs asynchronously if the host memory is page-locked,
+  /// e.g. allocated from a CudaHostMemoryPool. It must not be used before the
+  /// stream is synchronized.
+  Status CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                         void* stream) const;
+
+  /// \brief Enqueue a copy to device at position on a CUDA stream
+  /// \param[in] position start position to copy bytes to
+  /// \param[in] data the host data to copy
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the CUstream to enqueue the copy on
+  /// \return Status
+  ///
+  /// The copy only runs asynchronously if the host memory is page-locked,
+  /// e.g. allocated from a CudaHostMemoryPool. It must stay valid and
+  /// unchanged until the stream is synchronized.
+  Status CopyFromHostAsync(const int64_t position, const void* data, int64_t nbytes,
+                           void* stream);
+
   /// \brief Copy memory from device to device at position
   /// \param[in] position start position inside buffer to copy bytes to
   /// \param[in] data start address of the device memory area to copy from
@@ -137,6 +165,39 @@ class ARROW_EXPORT CudaHostBuffer : public MutableBuffer {
   Result<uintptr_t> GetDeviceAddress(const std::shared_ptr<CudaContext>& ctx);
 };
 
+/// \class CudaHostMemoryPool
+/// \brief A MemoryPool allocating page-locked CPU memory with fast access to a
+/// GPU device
+///
+/// Buffers allocated from this pool can be used wherever CPU memory is
+/// expected, e.g. by IPC readers, and copied to and from the device
+/// asynchronously. Page-locked memory is a scarce resource, allocations are
+/// not cached.
+class ARROW_EXPORT CudaHostMemoryPool : public MemoryPool {
+ public:
+  /// \brief Create a pool of host memory for the given device
+  /// \param[in] device_number the CUDA device number
+  /// \return the memory pool or Status
+  static Result<std::shared_ptr<CudaHostMemoryPool>> Make(int device_number);
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  explicit CudaHostMemoryPool(std::shared_ptr<CudaContext> context);
+
+  std::shared_ptr<CudaContext> context_;
+  ::arrow::internal::MemoryPoolStats stats_;
+};
+
 /// \class CudaIpcHandle
 /// \brief A container for a CUDA IPC handle
 class ARROW_EXPORT CudaIpcMemHandle {
@@ -250,6 +311,11 @@ class ARROW_EXPORT CudaBufferWriter : public io::WritableFile {
 
   Status Write(const void* data, int64_t nbytes) override;
 
+  /// \brief Write a buffer, which may be located on a CUDA device
+  ///
+  /// Device buffers are copied device-to-device without going through the host.
+  Status Write(const std::shared_ptr<Buffer>& data) override;
+
   Status WriteAt(int64_t position, const void* data, int64_t nbytes) override;
 
   Result<int64_t> Tell() const override;
@@ -196,6 +196,47 @@ TEST_F(TestCudaDevice, Copy) {
   }
 }
 
+TEST_F(TestCudaDevice, MemoryCache) {
+  // The cache stays enabled for the following tests
+  ASSERT_OK(device_->EnableMemoryCache(/*max_cached_bytes=*/64 << 20));
+  ASSERT_RAISES(Invalid, device_->EnableMemoryCache());
+  auto stats = device_->memory_cache_stats();
+  ASSERT_EQ(0, stats.bytes_allocated);
+  ASSERT_EQ(0, stats.num_allocations);
+
+  uintptr_t small_address, large_address;
+  {
+    ASSERT_OK_AND_ASSIGN(auto small_buffer, context_->Allocate(1000));
+    ASSERT_OK_AND_ASSIGN(auto large_buffer, context_->Allocate(3 << 20));
+    small_address = small_buffer->address();
+    large_address = large_buffer->address();
+    stats = device_->memory_cache_stats();
+    ASSERT_EQ(2, stats.num_allocations);
+    ASSERT_EQ(1024 + (3 << 20), stats.bytes_allocated);
+    // The small block was sub-allocated from a larger one
+    ASSERT_EQ((2 << 20) + (3 << 20), stats.bytes_reserved);
+  }
+  stats = device_->memory_cache_stats();
+  ASSERT_EQ(0, stats.bytes_allocated);
+  ASSERT_EQ(stats.bytes_reserved, stats.bytes_cached);
+
+  // Freed blocks are reused for allocations of the same size class, from
+  // any primary context of the device
+  ASSERT_OK_AND_ASSIGN(auto small_buffer, context_->Allocate(1020));
+  ASSERT_EQ(small_address, small_buffer->address());
+  ASSERT_OK_AND_ASSIGN(auto large_buffer, mm_->AllocateBuffer(3 << 20));
+  ASSERT_EQ(large_address, large_buffer->address());
+  stats = device_->memory_cache_stats();
+  ASSERT_EQ(4, stats.num_allocations);
+  ASSERT_EQ(2, stats.num_cache_hits);
+  ASSERT_EQ((2 << 20) + (3 << 20), stats.bytes_reserved);
+
+  large_buffer.reset();
+  ASSERT_OK(device_->ReleaseCachedMemory());
+  stats = device_->memory_cache_stats();
+  ASSERT_EQ(2 << 20, stats.bytes_reserved);
+}
+
 // ------------------------------------------------------------------------
 // Test CudaContext
 
@@ -379,6 +420,69 @@ TEST_F(TestCudaHostBuffer, ViewOnDevice) {
   ASSERT_EQ(buffer->parent(), device_buffer);
 }
 
+// ------------------------------------------------------------------------
+// Test CudaHostMemoryPool
+
+class TestCudaHostMemoryPool : public TestCudaBase {
+ public:
+  void SetUp() {
+    TestCudaBase::SetUp();
+    ASSERT_OK_AND_ASSIGN(pool_, CudaHostMemoryPool::Make(kGpuNumber));
+  }
+
+ protected:
+  std::shared_ptr<CudaHostMemoryPool> pool_;
+};
+
+TEST_F(TestCudaHostMemoryPool, Allocate) {
+  uint8_t* data;
+  ASSERT_OK(pool_->Allocate(100, &data));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+  ASSERT_EQ(100, pool_->bytes_allocated());
+  std::memset(data, 42, 100);
+
+  // The memory is page-locked, hence reachable from the device
+  ASSERT_OK_AND_ASSIGN(auto device_address, GetDeviceAddress(data, context_));
+  ASSERT_NE(device_address, 0);
+
+  ASSERT_OK(pool_->Reallocate(100, 200, &data));
+  ASSERT_EQ(200, pool_->bytes_allocated());
+  // Both blocks were allocated during the reallocation
+  ASSERT_EQ(300, pool_->max_memory());
+  ASSERT_EQ(42, data[99]);
+  pool_->Free(data, 200);
+  ASSERT_EQ(0, pool_->bytes_allocated());
+
+  ASSERT_OK(pool_->Allocate(0, &data));
+  pool_->Free(data, 0);
+  ASSERT_RAISES(Invalid, pool_->Allocate(-1, &data));
+}
+
+TEST_F(TestCudaHostMemoryPool, AsyncCopies) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<ResizableBuffer> source;
+  ASSERT_OK(MakeRandomByteBuffer(kSize, pool_.get(), &source));
+  std::shared_ptr<Buffer> dest;
+  ASSERT_OK(AllocateBuffer(pool_.get(), kSize, &dest));
+  ASSERT_OK_AND_ASSIGN(auto device_buffer, context_->Allocate(kSize));
+
+  CUstream stream;
+  {
+    internal::ContextSaver set_temporary(*context_);
+    ASSERT_CUDA_OK(cuStreamCreate(&stream, CU_STREAM_NON_BLOCKING));
+  }
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, source->data(), kSize, stream));
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, dest->mutable_data(), stream));
+  ASSERT_RAISES(Invalid,
+                device_buffer->CopyFromHostAsync(1, source->data(), kSize, stream));
+  {
+    internal::ContextSaver set_temporary(*context_);
+    ASSERT_CUDA_OK(cuStreamSynchronize(stream));
+    ASSERT_CUDA_OK(cuStreamDestroy(stream));
+  }
+  AssertBufferEqual(*dest, *source);
+}
+
 // ------------------------------------------------------------------------
 // Test CudaBufferWriter
 
@@ -580,5 +684,80 @@ TEST_F(TestCudaArrowIpc, BasicWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+TEST_F(TestCudaArrowIpc, StreamWriteRead) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batch));
+  const int64_t kBufferSize = 1 << 16;
+
+  // Host batches -> device stream
+  ASSERT_OK_AND_ASSIGN(auto device_stream, context_->Allocate(kBufferSize));
+  auto sink = std::make_shared<CudaBufferWriter>(device_stream);
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       CudaRecordBatchStreamWriter::Open(sink, batch->schema()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto stream_size, sink->Tell());
+  ASSERT_OK(sink->Close());
+
+  // Device stream -> device batches -> other device stream
+  auto source = std::make_shared<CudaBufferReader>(
+      SliceBuffer(device_stream, 0, stream_size));
+  ASSERT_OK_AND_ASSIGN(auto reader, CudaRecordBatchStreamReader::Open(source));
+  AssertSchemaEqual(*batch->schema(), *reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto other_stream, context_->Allocate(kBufferSize));
+  auto other_sink = std::make_shared<CudaBufferWriter>(other_stream);
+  ASSERT_OK_AND_ASSIGN(auto other_writer,
+                       CudaRecordBatchStreamWriter::Open(other_sink, batch->schema()));
+  int num_batches = 0;
+  while (true) {
+    std::shared_ptr<RecordBatch> device_batch;
+    ASSERT_OK(reader->ReadNext(&device_batch));
+    if (device_batch == nullptr) {
+      break;
+    }
+    ++num_batches;
+    ASSERT_EQ(batch->num_rows(), device_batch->num_rows());
+    const auto& values = device_batch->column_data(0)->buffers[1];
+    ASSERT_TRUE(IsCudaDevice(*values->device()));
+    ASSERT_OK(other_writer->WriteRecordBatch(*device_batch));
+  }
+  ASSERT_EQ(2, num_batches);
+  ASSERT_OK(other_writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto other_size, other_sink->Tell());
+  ASSERT_EQ(stream_size, other_size);
+
+  // Check the device-written stream on the host
+  std::shared_ptr<Buffer> host_buffer;
+  ASSERT_OK(AllocateBuffer(pool_, other_size, &host_buffer));
+  ASSERT_OK(other_stream->CopyToHost(0, other_size, host_buffer->mutable_data()));
+  io::BufferReader cpu_reader(host_buffer);
+  std::shared_ptr<RecordBatchReader> cpu_stream_reader;
+  ASSERT_OK(ipc::RecordBatchStreamReader::Open(&cpu_reader, &cpu_stream_reader));
+  for (int i = 0; i < num_batches; ++i) {
+    std::shared_ptr<RecordBatch> cpu_batch;
+    ASSERT_OK(cpu_stream_reader->ReadNext(&cpu_batch));
+    ASSERT_NE(nullptr, cpu_batch);
+    CompareBatch(*batch, *cpu_batch);
+  }
+}
+
+TEST_F(TestCudaArrowIpc, StreamWriterErrors) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batch));
+
+  // The stream doesn't fit in the device buffer
+  ASSERT_OK_AND_ASSIGN(auto device_stream, context_->Allocate(64));
+  auto sink = std::make_shared<CudaBufferWriter>(device_stream);
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       CudaRecordBatchStreamWriter::Open(sink, batch->schema()));
+  ASSERT_RAISES(IOError, writer->WriteRecordBatch(*batch));
+
+  auto options = ipc::IpcOptions::Defaults();
+  options.compression = Compression::LZ4;
+  ASSERT_RAISES(NotImplemented,
+                CudaRecordBatchStreamWriter::Open(sink, batch->schema(), options));
+}
+
 }  // namespace cuda
 }  // namespace arrow
@@ -18,7 +18,9 @@
 #include "arrow/io/buffered.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -29,6 +31,7 @@
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -265,9 +268,12 @@ class BufferedInputStream::Impl : public BufferedBase {
         raw_read_bound_(raw_total_bytes_bound),
         bytes_buffered_(0) {}
 
+  ~Impl() { StopReadahead(); }
+
   Status Close() {
     if (is_open_) {
       is_open_ = false;
+      StopReadahead();
       return raw_->Close();
     }
     return Status::OK();
@@ -276,12 +282,20 @@ class BufferedInputStream::Impl : public BufferedBase {
   Status Abort() {
     if (is_open_) {
       is_open_ = false;
+      StopReadahead();
       return raw_->Abort();
     }
     return Status::OK();
   }
 
   Result<int64_t> Tell() const {
+    if (readahead_) {
+      // The raw stream is ahead by the chunks read in the background
+      if (readahead_start_pos_ == -1) {
+        return Status::IOError("Cannot tell position of the raw stream");
+      }
+      return readahead_start_pos_ + readahead_consumed_ - bytes_buffered_;
+    }
     if (raw_pos_ == -1) {
       ARROW_ASSIGN_OR_RAISE(raw_pos_, raw_->Tell());
       DCHECK_GE(raw_pos_, 0);
@@ -325,8 +339,8 @@ class BufferedInputStream::Impl : public BufferedBase {
       }
       ARROW_ASSIGN_OR_RAISE(
           int64_t bytes_read,
-          raw_->Read(additional_bytes_to_read,
-                     buffer_->mutable_data() + buffer_pos_ + bytes_buffered_));
+          RawRead(additional_bytes_to_read,
+                  buffer_->mutable_data() + buffer_pos_ + bytes_buffered_));
       bytes_buffered_ += bytes_read;
       raw_read_total_ += bytes_read;
       nbytes = bytes_buffered_;
@@ -342,9 +356,41 @@ class BufferedInputStream::Impl : public BufferedBase {
 
   std::shared_ptr<InputStream> Detach() {
     is_open_ = false;
+    StopReadahead();
     return std::move(raw_);
   }
 
+  Status SetReadaheadDepth(int32_t depth) {
+    if (depth < 0) {
+      return Status::Invalid("Readahead depth should be positive or zero");
+    }
+    readahead_depth_ = depth;
+    if (depth == 0) {
+      // Chunks already read ahead are still consumed first
+      StopReadahead();
+      if (readahead_ && readahead_->chunks.empty() && !current_chunk_) {
+        readahead_.reset();
+      }
+    } else if (!readahead_) {
+      // Raw stream reads, hence its position, are not observable once they
+      // happen in the background
+      auto maybe_pos = raw_->Tell();
+      readahead_start_pos_ = maybe_pos.ok() ? *maybe_pos : -1;
+      readahead_consumed_ = 0;
+      readahead_ = std::make_shared<ReadaheadState>();
+      readahead_->bytes_fetched = raw_read_total_;
+      std::lock_guard<std::mutex> lock(readahead_->mutex);
+      ScheduleReadaheadLocked();
+    } else {
+      std::lock_guard<std::mutex> lock(readahead_->mutex);
+      readahead_->stop = false;
+      ScheduleReadaheadLocked();
+    }
+    return Status::OK();
+  }
+
+  int32_t readahead_depth() const { return readahead_depth_; }
+
   void RewindBuffer() {
     // Invalidate buffered data, as with a Seek or large Read
     buffer_pos_ = bytes_buffered_ = 0;
@@ -361,7 +407,7 @@ class BufferedInputStream::Impl : public BufferedBase {
       if (raw_read_bound_ >= 0) {
         bytes_to_buffer = std::min(buffer_size_, raw_read_bound_ - raw_read_total_);
       }
-      ARROW_ASSIGN_OR_RAISE(bytes_buffered_, raw_->Read(bytes_to_buffer, buffer_data_));
+      ARROW_ASSIGN_OR_RAISE(bytes_buffered_, RawRead(bytes_to_buffer, buffer_data_));
       buffer_pos_ = 0;
       raw_read_total_ += bytes_buffered_;
 
@@ -394,7 +440,7 @@ class BufferedInputStream::Impl : public BufferedBase {
       }
       ARROW_ASSIGN_OR_RAISE(
           int64_t bytes_read,
-          raw_->Read(bytes_to_read, reinterpret_cast<uint8_t*>(out) + bytes_buffered_));
+          RawRead(bytes_to_read, reinterpret_cast<uint8_t*>(out) + bytes_buffered_));
       raw_read_total_ += bytes_read;
 
       // Do not make assumptions about the raw stream position
@@ -427,6 +473,166 @@ class BufferedInputStream::Impl : public BufferedBase {
   std::shared_ptr<InputStream> raw() const { return raw_; }
 
  private:
+  // Chunks read ahead from the raw stream.  The raw stream is read by a single
+  // I/O thread pool task at a time, or by the consumer when that task isn't
+  // running, so that the consumer never waits on a task that hasn't started.
+  struct ReadaheadState {
+    enum TaskState { kIdle, kScheduled, kRunning };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::shared_ptr<Buffer>> chunks;
+    TaskState task_state = kIdle;
+    bool stop = false;
+    bool eof = false;
+    Status status;
+    // Bytes read from the raw stream, for enforcing the raw read bound
+    int64_t bytes_fetched = 0;
+  };
+
+  // Read a chunk from the raw stream into the readahead queue
+  static void FetchChunk(ReadaheadState* state, InputStream* raw, int64_t chunk_size,
+                         int64_t raw_read_bound) {
+    if (raw_read_bound >= 0) {
+      chunk_size = std::min(chunk_size, raw_read_bound - state->bytes_fetched);
+    }
+    Result<std::shared_ptr<Buffer>> maybe_chunk =
+        chunk_size > 0 ? raw->Read(chunk_size) : std::make_shared<Buffer>(nullptr, 0);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (!maybe_chunk.ok()) {
+      state->status = maybe_chunk.status();
+    } else if ((*maybe_chunk)->size() == 0) {
+      state->eof = true;
+    } else {
+      state->bytes_fetched += (*maybe_chunk)->size();
+      state->chunks.push_back(std::move(maybe_chunk).ValueOrDie());
+    }
+    state->cv.notify_all();
+  }
+
+  static void RunReadahead(const std::shared_ptr<ReadaheadState>& state,
+                           const std::shared_ptr<InputStream>& raw, int64_t chunk_size,
+                           int64_t raw_read_bound, int32_t depth) {
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (state->task_state != ReadaheadState::kScheduled) {
+        // The consumer read the chunk itself
+        return;
+      }
+      state->task_state = ReadaheadState::kRunning;
+    }
+    while (true) {
+      FetchChunk(state.get(), raw.get(), chunk_size, raw_read_bound);
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (state->stop || state->eof || !state->status.ok() ||
+          state->chunks.size() >= static_cast<size_t>(depth)) {
+        state->task_state = ReadaheadState::kIdle;
+        state->cv.notify_all();
+        return;
+      }
+    }
+  }
+
+  // Must be called with the readahead mutex held
+  void ScheduleReadaheadLocked() {
+    auto state = readahead_;
+    if (readahead_depth_ == 0 || state->stop || state->eof || !state->status.ok() ||
+        state->task_state != ReadaheadState::kIdle ||
+        state->chunks.size() >= static_cast<size_t>(readahead_depth_)) {
+      return;
+    }
+    auto raw = raw_;
+    auto chunk_size = buffer_size_;
+    auto raw_read_bound = raw_read_bound_;
+    auto depth = readahead_depth_;
+    state->task_state = ReadaheadState::kScheduled;
+    Status st = internal::GetIOThreadPool()->Spawn([=] {
+      RunReadahead(state, raw, chunk_size, raw_read_bound, depth);
+    });
+    if (!st.ok()) {
+      // The consumer will read chunks itself
+      state->task_state = ReadaheadState::kIdle;
+    }
+  }
+
+  void StopReadahead() {
+    if (!readahead_) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(readahead_->mutex);
+    readahead_->stop = true;
+    if (readahead_->task_state == ReadaheadState::kScheduled) {
+      readahead_->task_state = ReadaheadState::kIdle;
+    }
+    auto state = readahead_;
+    state->cv.wait(lock,
+                   [&] { return state->task_state != ReadaheadState::kRunning; });
+  }
+
+  // Return the chunk to consume next, or null at end of stream
+  Result<std::shared_ptr<Buffer>> NextChunk() {
+    if (current_chunk_) {
+      return current_chunk_;
+    }
+    auto state = readahead_;
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (state->chunks.empty()) {
+      RETURN_NOT_OK(state->status);
+      if (state->eof) {
+        return nullptr;
+      }
+      if (state->task_state == ReadaheadState::kRunning) {
+        state->cv.wait(lock);
+        continue;
+      }
+      // Rather than wait on a task that may not start soon, read the chunk here
+      state->task_state = ReadaheadState::kIdle;
+      lock.unlock();
+      FetchChunk(state.get(), raw_.get(), buffer_size_, raw_read_bound_);
+      lock.lock();
+    }
+    current_chunk_ = std::move(state->chunks.front());
+    current_chunk_pos_ = 0;
+    state->chunks.pop_front();
+    ScheduleReadaheadLocked();
+    return current_chunk_;
+  }
+
+  // Read from the raw stream, or from the chunks read ahead if enabled
+  Result<int64_t> RawRead(int64_t nbytes, uint8_t* out) {
+    if (!readahead_) {
+      return raw_->Read(nbytes, out);
+    }
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      if (readahead_depth_ == 0 && !current_chunk_) {
+        std::unique_lock<std::mutex> lock(readahead_->mutex);
+        if (readahead_->chunks.empty()) {
+          // Readahead was disabled and its chunks are consumed, read directly
+          lock.unlock();
+          readahead_.reset();
+          raw_pos_ = -1;
+          ARROW_ASSIGN_OR_RAISE(int64_t n,
+                                raw_->Read(nbytes - bytes_read, out + bytes_read));
+          return bytes_read + n;
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(auto chunk, NextChunk());
+      if (!chunk) {
+        break;
+      }
+      const int64_t n = std::min(nbytes - bytes_read, chunk->size() - current_chunk_pos_);
+      std::memcpy(out + bytes_read, chunk->data() + current_chunk_pos_, n);
+      current_chunk_pos_ += n;
+      if (current_chunk_pos_ == chunk->size()) {
+        current_chunk_.reset();
+      }
+      bytes_read += n;
+    }
+    readahead_consumed_ += bytes_read;
+    return bytes_read;
+  }
+
   std::shared_ptr<InputStream> raw_;
   int64_t raw_read_total_;
   int64_t raw_read_bound_;
@@ -434,6 +640,16 @@ class BufferedInputStream::Impl : public BufferedBase {
   // Number of remaining bytes in the buffer, to be reduced on each read from
   // the buffer
   int64_t bytes_buffered_;
+
+  int32_t readahead_depth_ = 0;
+  std::shared_ptr<ReadaheadState> readahead_;
+  // Chunk being consumed
+  std::shared_ptr<Buffer> current_chunk_;
+  int64_t current_chunk_pos_ = 0;
+  // Position of the raw stream when readahead was enabled, -1 if unknown,
+  // and bytes consumed from the readahead chunks since
+  int64_t readahead_start_pos_ = -1;
+  int64_t readahead_consumed_ = 0;
 };
 
 BufferedInputStream::BufferedInputStream(std::shared_ptr<InputStream> raw,
@@ -484,6 +700,12 @@ int64_t BufferedInputStream::bytes_buffered() const { return impl_->bytes_buffer
 
 int64_t BufferedInputStream::buffer_size() const { return impl_->buffer_size(); }
 
+Status BufferedInputStream::SetReadaheadDepth(int32_t depth) {
+  return impl_->SetReadaheadDepth(depth);
+}
+
+int32_t BufferedInputStream::readahead_depth() const { return impl_->readahead_depth(); }
+
 Result<int64_t> BufferedInputStream::DoRead(int64_t nbytes, void* out) {
   return impl_->Read(nbytes, out);
 }
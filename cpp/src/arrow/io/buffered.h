@@ -136,6 +136,19 @@ class ARROW_EXPORT BufferedInputStream
   /// \brief Return the current size of the internal buffer
   int64_t buffer_size() const;
 
+  /// \brief Read ahead from the raw stream on the I/O thread pool
+  ///
+  /// Up to `depth` chunks of buffer_size() bytes are read in the background
+  /// while buffered data is consumed, so that refilling the buffer seldom waits
+  /// on the raw stream.  The raw stream must not be used by others meanwhile.
+  /// 0 (the default) disables readahead.
+  /// \param[in] depth the number of chunks to read ahead
+  /// \return Status
+  Status SetReadaheadDepth(int32_t depth);
+
+  /// \brief Return the number of chunks read ahead, 0 if readahead is disabled
+  int32_t readahead_depth() const;
+
   /// \brief Release the raw InputStream. Any data buffered will be
   /// discarded. Further operations on this object are invalid
   /// \return raw the underlying InputStream
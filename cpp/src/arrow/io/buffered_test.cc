@@ -447,6 +447,43 @@ TEST_F(TestBufferedInputStream, SetBufferSize) {
   ASSERT_OK(buffered_->SetBufferSize(5));
 }
 
+TEST_F(TestBufferedInputStream, Readahead) {
+  MakeExample1(4);
+  ASSERT_EQ(0, buffered_->readahead_depth());
+  ASSERT_RAISES(Invalid, buffered_->SetReadaheadDepth(-1));
+  ASSERT_OK(buffered_->SetReadaheadDepth(3));
+  ASSERT_EQ(3, buffered_->readahead_depth());
+
+  std::vector<char> buf(test_data_.size());
+  ASSERT_OK_AND_EQ(3, buffered_->Read(3, buf.data()));
+  ASSERT_EQ(0, memcmp(buf.data(), test_data_.data(), 3));
+  ASSERT_OK_AND_EQ(3, buffered_->Tell());
+
+  // Peek past buffered bytes
+  ASSERT_OK_AND_ASSIGN(auto peek, buffered_->Peek(6));
+  ASSERT_EQ(test_data_.substr(3, 6), peek.to_string());
+
+  // Read exceeding buffer size
+  ASSERT_OK_AND_ASSIGN(auto buffer, buffered_->Read(10));
+  ASSERT_EQ(test_data_.substr(3, 10), buffer->ToString());
+  ASSERT_OK_AND_EQ(13, buffered_->Tell());
+
+  // Chunks read ahead are consumed after readahead is disabled
+  ASSERT_OK(buffered_->SetReadaheadDepth(0));
+  ASSERT_OK_AND_ASSIGN(buffer, buffered_->Read(2));
+  ASSERT_EQ(test_data_.substr(13, 2), buffer->ToString());
+  ASSERT_OK(buffered_->SetReadaheadDepth(2));
+  ASSERT_OK_AND_ASSIGN(buffer, buffered_->Read(100));
+  ASSERT_EQ(test_data_.substr(15), buffer->ToString());
+  ASSERT_OK_AND_EQ(test_data_.size(), buffered_->Tell());
+
+  ASSERT_OK_AND_ASSIGN(buffer, buffered_->Read(1));
+  ASSERT_EQ(0, buffer->size());
+
+  ASSERT_OK(buffered_->Close());
+  ASSERT_TRUE(buffered_->raw()->closed());
+}
+
 class TestBufferedInputStreamBound : public ::testing::Test {
  public:
   void SetUp() { CreateExample(/*bounded=*/true); }
@@ -611,6 +648,24 @@ TEST_F(TestBufferedInputStreamBound, OneByteReads) {
   ASSERT_EQ(0, buffer->size());
 }
 
+TEST_F(TestBufferedInputStreamBound, Readahead) {
+  stream_size_ = 100;
+  CreateExample(/*bounded=*/true);
+  ASSERT_OK(stream_->SetReadaheadDepth(3));
+
+  for (int i = 0; i < stream_size_; i += 7) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, stream_->Read(7));
+    ASSERT_EQ(std::min<int64_t>(7, stream_size_ - i), buffer->size());
+    for (int j = 0; j < buffer->size(); ++j) {
+      ASSERT_EQ(10 + i + j, (*buffer)[j]) << i + j;
+    }
+  }
+  // Stream exhausted, the source was not read past the bound
+  ASSERT_OK_AND_ASSIGN(auto buffer, stream_->Read(1));
+  ASSERT_EQ(0, buffer->size());
+  ASSERT_OK_AND_EQ(stream_offset_ + stream_size_, source_->Tell());
+}
+
 TEST_F(TestBufferedInputStreamBound, BufferExactlyExhausted) {
   // Test exhausting the buffer exactly then issuing further reads (PARQUET-1571).
   std::shared_ptr<Buffer> buffer;
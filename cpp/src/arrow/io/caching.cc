@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/caching.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+CacheOptions CacheOptions::Defaults() {
+  return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
+                      internal::ReadRangeCache::kDefaultRangeSizeLimit};
+}
+
+namespace internal {
+
+struct RangeCacheEntry {
+  ReadRange range;
+  Future<std::shared_ptr<Buffer>> future;
+
+  friend bool operator<(const RangeCacheEntry& left, const RangeCacheEntry& right) {
+    return left.range.offset < right.range.offset;
+  }
+};
+
+struct ReadRangeCache::Impl {
+  std::shared_ptr<RandomAccessFile> file;
+  CacheOptions options;
+
+  // Ordered by offset (so as to find a matching region by binary search)
+  std::vector<RangeCacheEntry> entries;
+  std::mutex mutex;
+};
+
+ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file,
+                               CacheOptions options)
+    : impl_(new Impl()) {
+  impl_->file = std::move(file);
+  impl_->options = options;
+}
+
+ReadRangeCache::~ReadRangeCache() {
+  // Don't let background reads outlive the file
+  for (auto& entry : impl_->entries) {
+    entry.future.Wait();
+  }
+}
+
+Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
+  for (const auto& range : ranges) {
+    RETURN_NOT_OK(ValidateRegion(range.offset, range.length));
+  }
+  ranges = CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
+                              impl_->options.range_size_limit);
+
+  // Submit all reads at once, so that the file may batch them
+  auto futures = impl_->file->ReadManyAsync(ranges);
+  std::vector<RangeCacheEntry> new_entries;
+  new_entries.reserve(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    new_entries.push_back({ranges[i], std::move(futures[i])});
+  }
+
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  std::sort(new_entries.begin(), new_entries.end());
+  std::vector<RangeCacheEntry> merged(impl_->entries.size() + new_entries.size());
+  std::merge(impl_->entries.begin(), impl_->entries.end(), new_entries.begin(),
+             new_entries.end(), merged.begin());
+  impl_->entries = std::move(merged);
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
+  if (range.length == 0) {
+    return std::make_shared<Buffer>(nullptr, 0);
+  }
+
+  Future<std::shared_ptr<Buffer>> future;
+  ReadRange entry_range;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    // Find the last entry starting at or before the requested offset
+    auto it = std::upper_bound(
+        impl_->entries.begin(), impl_->entries.end(), range.offset,
+        [](int64_t offset, const RangeCacheEntry& entry) {
+          return offset < entry.range.offset;
+        });
+    if (it != impl_->entries.begin()) {
+      --it;
+    }
+    if (it == impl_->entries.end() || it->range.offset > range.offset ||
+        range.offset + range.length > it->range.offset + it->range.length) {
+      return Status::Invalid("ReadRangeCache did not find matching cache entry for (",
+                             range.offset, ", ", range.length, ")");
+    }
+    future = it->future;
+    entry_range = it->range;
+  }
+
+  const auto& result = future.result();
+  RETURN_NOT_OK(result.status());
+  const std::shared_ptr<Buffer>& buffer = result.ValueOrDie();
+  const int64_t slice_offset = range.offset - entry_range.offset;
+  if (slice_offset + range.length > buffer->size()) {
+    return Status::IOError("Read out of bounds (offset = ", range.offset,
+                           ", size = ", range.length, ")");
+  }
+  return SliceBuffer(buffer, slice_offset, range.length);
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
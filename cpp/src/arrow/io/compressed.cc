@@ -18,18 +18,23 @@
 #include "arrow/io/compressed.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
 
 #include "arrow/buffer.h"
+#include "arrow/io/buffered.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -39,15 +44,100 @@ using util::Decompressor;
 
 namespace io {
 
+namespace {
+
+// A frame (de)compressed independently of the others, either by a CPU thread
+// pool task or by the stream itself if the task hasn't started when the frame
+// is needed, so that the stream never waits on a task that may not run soon.
+class FrameTask {
+ public:
+  using Work = std::function<Result<std::shared_ptr<ResizableBuffer>>()>;
+
+  static std::shared_ptr<FrameTask> Spawn(Work work) {
+    auto task = std::make_shared<FrameTask>(std::move(work));
+    // If spawning fails, the frame is processed by Wait()
+    ARROW_UNUSED(::arrow::internal::GetCpuThreadPool()->Spawn([task] { task->Run(); }));
+    return task;
+  }
+
+  explicit FrameTask(Work work) : work_(std::move(work)) {}
+
+  bool done() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return state_ == kDone;
+  }
+
+  // Return the frame's output, processing it here if it hasn't started
+  Result<std::shared_ptr<ResizableBuffer>> Wait() {
+    if (!Run()) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&] { return state_ == kDone; });
+    }
+    RETURN_NOT_OK(status_);
+    return std::move(output_);
+  }
+
+  // Prevent the frame from being processed if it hasn't started
+  void Cancel() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ == kPending) {
+      state_ = kDone;
+      work_ = nullptr;
+    }
+  }
+
+ private:
+  enum State { kPending, kRunning, kDone };
+
+  // Process the frame, unless it was claimed already.  Return whether it ran.
+  bool Run() {
+    Work work;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (state_ != kPending) {
+        return false;
+      }
+      state_ = kRunning;
+      work = std::move(work_);
+    }
+    auto result = work();
+    std::lock_guard<std::mutex> lock(mutex_);
+    status_ = result.status();
+    if (result.ok()) {
+      output_ = std::move(result).ValueOrDie();
+    }
+    state_ = kDone;
+    cv_.notify_all();
+    return true;
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  State state_ = kPending;
+  Work work_;
+  Status status_;
+  std::shared_ptr<ResizableBuffer> output_;
+};
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // CompressedOutputStream implementation
 
+constexpr int64_t CompressedOutputStream::kDefaultFrameSize;
+
 class CompressedOutputStream::Impl {
  public:
   Impl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw)
-      : pool_(pool), raw_(raw), is_open_(false), compressed_pos_(0), total_pos_(0) {}
+      : pool_(pool),
+        codec_(nullptr),
+        raw_(raw),
+        is_open_(false),
+        compressed_pos_(0),
+        total_pos_(0) {}
 
   Status Init(Codec* codec) {
+    codec_ = codec;
     ARROW_ASSIGN_OR_RAISE(compressor_, codec->MakeCompressor());
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, kChunkSize, &compressed_));
     compressed_pos_ = 0;
@@ -62,6 +152,32 @@ class CompressedOutputStream::Impl {
 
   std::shared_ptr<OutputStream> raw() const { return raw_; }
 
+  Status SetMaxConcurrentFrames(int32_t max_concurrent_frames, int64_t frame_size) {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (max_concurrent_frames < 1) {
+      return Status::Invalid("Max concurrent frames should be at least 1");
+    }
+    if (frame_size <= 0) {
+      return Status::Invalid("Frame size should be positive");
+    }
+    if (total_pos_ > 0) {
+      return Status::Invalid("Cannot set max concurrent frames after writing");
+    }
+    if (max_concurrent_frames > 1) {
+      // Only codecs whose streams can be split into frames write streams
+      // that decompress as a whole once concatenated
+      auto maybe_frame_len = codec_->FrameCompressedLength(0, nullptr);
+      if (maybe_frame_len.status().IsNotImplemented()) {
+        return Status::NotImplemented("Codec '", codec_->name(),
+                                      "' doesn't support concurrent frames");
+      }
+    }
+    max_concurrent_frames_ = max_concurrent_frames;
+    frame_size_ = frame_size;
+    return Status::OK();
+  }
+
   Status FlushCompressed() {
     if (compressed_pos_ > 0) {
       RETURN_NOT_OK(raw_->Write(compressed_->data(), compressed_pos_));
@@ -73,6 +189,9 @@ class CompressedOutputStream::Impl {
   Status Write(const void* data, int64_t nbytes) {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (max_concurrent_frames_ > 1) {
+      return WriteFrames(reinterpret_cast<const uint8_t*>(data), nbytes);
+    }
     auto input = reinterpret_cast<const uint8_t*>(data);
     while (nbytes > 0) {
       int64_t input_len = nbytes;
@@ -111,6 +230,9 @@ class CompressedOutputStream::Impl {
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (max_concurrent_frames_ > 1) {
+      return FlushFrames();
+    }
     while (true) {
       // Flush compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -132,6 +254,14 @@ class CompressedOutputStream::Impl {
   }
 
   Status FinalizeCompression() {
+    if (max_concurrent_frames_ > 1) {
+      if (total_pos_ == 0) {
+        // Write an empty frame, so that the output is a valid stream
+        RETURN_NOT_OK(ResetFrameInput());
+        RETURN_NOT_OK(QueueFrame());
+      }
+      return FlushFrames();
+    }
     while (true) {
       // Try to end compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -170,6 +300,7 @@ class CompressedOutputStream::Impl {
 
     if (is_open_) {
       is_open_ = false;
+      CancelFrames();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -182,10 +313,118 @@ class CompressedOutputStream::Impl {
   }
 
  private:
+  static Result<std::shared_ptr<ResizableBuffer>> CompressFrame(MemoryPool* pool,
+                                                                Compressor* compressor,
+                                                                const Buffer& input) {
+    std::shared_ptr<ResizableBuffer> output;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool, input.size() / 2 + kChunkSize, &output));
+    int64_t input_pos = 0;
+    int64_t output_pos = 0;
+    while (input_pos < input.size()) {
+      const int64_t input_len = input.size() - input_pos;
+      const uint8_t* input_data = input.data() + input_pos;
+      const int64_t output_len = output->size() - output_pos;
+      uint8_t* output_data = output->mutable_data() + output_pos;
+      ARROW_ASSIGN_OR_RAISE(auto result, compressor->Compress(input_len, input_data,
+                                                              output_len, output_data));
+      input_pos += result.bytes_read;
+      output_pos += result.bytes_written;
+      if (result.bytes_read == 0 || output_pos == output->size()) {
+        // Need to enlarge output buffer
+        RETURN_NOT_OK(output->Resize(output->size() * 2));
+      }
+    }
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto result,
+                            compressor->End(output->size() - output_pos,
+                                            output->mutable_data() + output_pos));
+      output_pos += result.bytes_written;
+      if (!result.should_retry) {
+        break;
+      }
+      RETURN_NOT_OK(output->Resize(output->size() * 2));
+    }
+    RETURN_NOT_OK(output->Resize(output_pos));
+    return output;
+  }
+
+  Status ResetFrameInput() {
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, frame_size_, &frame_input_));
+    frame_input_pos_ = 0;
+    return Status::OK();
+  }
+
+  Status WriteFrames(const uint8_t* data, int64_t nbytes) {
+    while (nbytes > 0) {
+      if (!frame_input_) {
+        RETURN_NOT_OK(ResetFrameInput());
+      }
+      const int64_t n = std::min(nbytes, frame_size_ - frame_input_pos_);
+      memcpy(frame_input_->mutable_data() + frame_input_pos_, data, n);
+      frame_input_pos_ += n;
+      data += n;
+      nbytes -= n;
+      total_pos_ += n;
+      if (frame_input_pos_ == frame_size_) {
+        RETURN_NOT_OK(QueueFrame());
+      }
+    }
+    return Status::OK();
+  }
+
+  // Schedule compression of the buffered input as a frame
+  Status QueueFrame() {
+    RETURN_NOT_OK(frame_input_->Resize(frame_input_pos_));
+    std::shared_ptr<Buffer> input = std::move(frame_input_);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Compressor> compressor,
+                          codec_->MakeCompressor());
+    auto pool = pool_;
+    frames_.push_back(FrameTask::Spawn([pool, compressor, input] {
+      return CompressFrame(pool, compressor.get(), *input);
+    }));
+
+    // Write the frames that are done, and bound the number of frames in flight
+    while (!frames_.empty() &&
+           (frames_.front()->done() ||
+            frames_.size() > static_cast<size_t>(max_concurrent_frames_))) {
+      RETURN_NOT_OK(WriteFrontFrame());
+    }
+    return Status::OK();
+  }
+
+  // Write the oldest frame, waiting for it to be compressed
+  Status WriteFrontFrame() {
+    auto frame = std::move(frames_.front());
+    frames_.pop_front();
+    ARROW_ASSIGN_OR_RAISE(auto output, frame->Wait());
+    return raw_->Write(output);
+  }
+
+  // End the current frame and write all frames
+  Status FlushFrames() {
+    if (frame_input_ && frame_input_pos_ > 0) {
+      RETURN_NOT_OK(QueueFrame());
+    }
+    while (!frames_.empty()) {
+      RETURN_NOT_OK(WriteFrontFrame());
+    }
+    return Status::OK();
+  }
+
+  // Prevent frames that haven't started from running
+  void CancelFrames() {
+    for (const auto& frame : frames_) {
+      frame->Cancel();
+    }
+    frames_.clear();
+  }
+
   // Write 64 KB compressed data at a time
   static const int64_t kChunkSize = 64 * 1024;
 
   MemoryPool* pool_;
+  // Not owned
+  Codec* codec_;
   std::shared_ptr<OutputStream> raw_;
   bool is_open_;
   std::shared_ptr<Compressor> compressor_;
@@ -194,6 +433,14 @@ class CompressedOutputStream::Impl {
   // Total number of bytes compressed
   int64_t total_pos_;
 
+  int32_t max_concurrent_frames_ = 1;
+  int64_t frame_size_ = kDefaultFrameSize;
+  // Input of the frame being filled
+  std::shared_ptr<ResizableBuffer> frame_input_;
+  int64_t frame_input_pos_ = 0;
+  // Frames being compressed, in stream order
+  std::deque<std::shared_ptr<FrameTask>> frames_;
+
   mutable std::mutex lock_;
 };
 
@@ -234,6 +481,11 @@ Status CompressedOutputStream::Write(const void* data, int64_t nbytes) {
 
 Status CompressedOutputStream::Flush() { return impl_->Flush(); }
 
+Status CompressedOutputStream::SetMaxConcurrentFrames(int32_t max_concurrent_frames,
+                                                      int64_t frame_size) {
+  return impl_->SetMaxConcurrentFrames(max_concurrent_frames, frame_size);
+}
+
 std::shared_ptr<OutputStream> CompressedOutputStream::raw() const { return impl_->raw(); }
 
 // ----------------------------------------------------------------------
@@ -243,6 +495,7 @@ class CompressedInputStream::Impl {
  public:
   Impl(MemoryPool* pool, const std::shared_ptr<InputStream>& raw)
       : pool_(pool),
+        codec_(nullptr),
         raw_(raw),
         is_open_(true),
         compressed_pos_(0),
@@ -250,15 +503,31 @@ class CompressedInputStream::Impl {
         total_pos_(0) {}
 
   Status Init(Codec* codec) {
+    codec_ = codec;
     ARROW_ASSIGN_OR_RAISE(decompressor_, codec->MakeDecompressor());
     fresh_decompressor_ = true;
+    // Read compressed chunks in the background while decompressing
+    ARROW_ASSIGN_OR_RAISE(buffered_raw_,
+                          BufferedInputStream::Create(kChunkSize, pool_, raw_));
+    return buffered_raw_->SetReadaheadDepth(kReadaheadDepth);
+  }
+
+  Status SetMaxConcurrentFrames(int32_t max_concurrent_frames) {
+    if (max_concurrent_frames < 1) {
+      return Status::Invalid("Max concurrent frames should be at least 1");
+    }
+    if (total_pos_ > 0 || compressed_ || unframed_) {
+      return Status::Invalid("Cannot set max concurrent frames after reading");
+    }
+    max_concurrent_frames_ = max_concurrent_frames;
     return Status::OK();
   }
 
   Status Close() {
     if (is_open_) {
       is_open_ = false;
-      return raw_->Close();
+      CancelFrames();
+      return buffered_raw_->Close();
     } else {
       return Status::OK();
     }
@@ -267,7 +536,8 @@ class CompressedInputStream::Impl {
   Status Abort() {
     if (is_open_) {
       is_open_ = false;
-      return raw_->Abort();
+      CancelFrames();
+      return buffered_raw_->Abort();
     } else {
       return Status::OK();
     }
@@ -282,7 +552,7 @@ class CompressedInputStream::Impl {
     int64_t compressed_avail = compressed_ ? compressed_->size() - compressed_pos_ : 0;
     if (compressed_avail == 0) {
       // No compressed data available, read a full chunk
-      ARROW_ASSIGN_OR_RAISE(compressed_, raw_->Read(kChunkSize));
+      ARROW_ASSIGN_OR_RAISE(compressed_, buffered_raw_->Read(kChunkSize));
       compressed_pos_ = 0;
     }
     return Status::OK();
@@ -339,6 +609,17 @@ class CompressedInputStream::Impl {
 
   // Try to feed more data into the decompressed_ buffer.
   Status RefillDecompressed(bool* has_data) {
+    if (max_concurrent_frames_ > 1) {
+      RETURN_NOT_OK(QueueFrames());
+      if (!frames_.empty()) {
+        return RefillFromFrame(has_data);
+      }
+      if (!sequential_tail_) {
+        *has_data = false;
+        return Status::OK();
+      }
+      // The rest of the stream couldn't be split, decompress it sequentially
+    }
     // First try to read data from the decompressor
     if (compressed_) {
       if (decompressor_->IsFinished()) {
@@ -353,7 +634,7 @@ class CompressedInputStream::Impl {
       RETURN_NOT_OK(EnsureCompressedData());
       if (compressed_pos_ == compressed_->size()) {
         // No more data to decompress
-        if (!fresh_decompressor_) {
+        if (!fresh_decompressor_ && !decompressor_->IsFinished()) {
           return Status::IOError("Truncated compressed stream");
         }
         *has_data = false;
@@ -398,13 +679,128 @@ class CompressedInputStream::Impl {
   std::shared_ptr<InputStream> raw() const { return raw_; }
 
  private:
+  static Result<std::shared_ptr<ResizableBuffer>> DecompressFrame(
+      MemoryPool* pool, Decompressor* decompressor, const Buffer& input) {
+    std::shared_ptr<ResizableBuffer> output;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool, kDecompressSize, &output));
+    int64_t input_pos = 0;
+    int64_t output_pos = 0;
+    while (true) {
+      if (output_pos == output->size()) {
+        RETURN_NOT_OK(output->Resize(output->size() * 2));
+      }
+      const int64_t input_len = input.size() - input_pos;
+      const uint8_t* input_data = input.data() + input_pos;
+      const int64_t output_len = output->size() - output_pos;
+      uint8_t* output_data = output->mutable_data() + output_pos;
+      ARROW_ASSIGN_OR_RAISE(
+          auto result,
+          decompressor->Decompress(input_len, input_data, output_len, output_data));
+      input_pos += result.bytes_read;
+      output_pos += result.bytes_written;
+      if (result.need_more_output) {
+        RETURN_NOT_OK(output->Resize(output->size() * 2));
+        continue;
+      }
+      if (decompressor->IsFinished() && input_pos == input.size()) {
+        break;
+      }
+      if (result.bytes_read == 0 && result.bytes_written == 0) {
+        return Status::IOError("Corrupt compressed frame");
+      }
+    }
+    RETURN_NOT_OK(output->Resize(output_pos));
+    return output;
+  }
+
+  // Read more compressed data into unframed_, after the data it already holds
+  Status ReadUnframed(int64_t nbytes) {
+    const int64_t avail = unframed_ ? unframed_->size() : 0;
+    std::shared_ptr<ResizableBuffer> buf;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, avail + nbytes, &buf));
+    if (avail > 0) {
+      memcpy(buf->mutable_data(), unframed_->data(), avail);
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          buffered_raw_->Read(nbytes, buf->mutable_data() + avail));
+    if (bytes_read == 0) {
+      raw_eof_ = true;
+    }
+    RETURN_NOT_OK(buf->Resize(avail + bytes_read));
+    unframed_ = std::move(buf);
+    return Status::OK();
+  }
+
+  // Split compressed data into frames and schedule their decompression
+  Status QueueFrames() {
+    while (!sequential_tail_ &&
+           frames_.size() < static_cast<size_t>(max_concurrent_frames_)) {
+      const int64_t avail = unframed_ ? unframed_->size() : 0;
+      int64_t frame_len = 0;
+      if (avail > 0) {
+        auto maybe_frame_len = codec_->FrameCompressedLength(avail, unframed_->data());
+        if (maybe_frame_len.status().IsNotImplemented()) {
+          // Hand the remaining data over to the sequential decompressor
+          compressed_ = std::move(unframed_);
+          compressed_pos_ = 0;
+          sequential_tail_ = true;
+          break;
+        }
+        ARROW_ASSIGN_OR_RAISE(frame_len, maybe_frame_len);
+      }
+      if (frame_len > 0) {
+        auto input = SliceBuffer(unframed_, 0, frame_len);
+        unframed_ = SliceBuffer(unframed_, frame_len);
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Decompressor> decompressor,
+                              codec_->MakeDecompressor());
+        auto pool = pool_;
+        frames_.push_back(FrameTask::Spawn([pool, decompressor, input] {
+          return DecompressFrame(pool, decompressor.get(), *input);
+        }));
+        continue;
+      }
+      if (raw_eof_) {
+        if (avail > 0) {
+          return Status::IOError("Truncated compressed stream");
+        }
+        break;
+      }
+      // Frames can be larger than a chunk: grow geometrically
+      RETURN_NOT_OK(ReadUnframed(avail > kChunkSize ? avail : kChunkSize));
+    }
+    return Status::OK();
+  }
+
+  // Make the next frame's output the decompressed_ buffer
+  Status RefillFromFrame(bool* has_data) {
+    auto frame = std::move(frames_.front());
+    frames_.pop_front();
+    ARROW_ASSIGN_OR_RAISE(decompressed_, frame->Wait());
+    decompressed_pos_ = 0;
+    *has_data = true;
+    return Status::OK();
+  }
+
+  // Prevent frames that haven't started from running
+  void CancelFrames() {
+    for (const auto& frame : frames_) {
+      frame->Cancel();
+    }
+    frames_.clear();
+  }
+
   // Read 64 KB compressed data at a time
   static const int64_t kChunkSize = 64 * 1024;
+  // Number of compressed chunks read ahead
+  static const int32_t kReadaheadDepth = 2;
   // Decompress 1 MB at a time
   static const int64_t kDecompressSize = 1024 * 1024;
 
   MemoryPool* pool_;
+  // Not owned
+  Codec* codec_;
   std::shared_ptr<InputStream> raw_;
+  std::shared_ptr<BufferedInputStream> buffered_raw_;
   bool is_open_;
   std::shared_ptr<Decompressor> decompressor_;
   std::shared_ptr<Buffer> compressed_;
@@ -417,6 +813,15 @@ class CompressedInputStream::Impl {
   bool fresh_decompressor_;
   // Total number of bytes decompressed
   int64_t total_pos_;
+
+  int32_t max_concurrent_frames_ = 1;
+  // Frames being decompressed, in stream order
+  std::deque<std::shared_ptr<FrameTask>> frames_;
+  // Compressed data not split into frames yet
+  std::shared_ptr<Buffer> unframed_;
+  bool raw_eof_ = false;
+  // Whether the rest of the stream is decompressed sequentially
+  bool sequential_tail_ = false;
 };
 
 Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
@@ -446,6 +851,10 @@ Status CompressedInputStream::DoClose() { return impl_->Close(); }
 
 Status CompressedInputStream::DoAbort() { return impl_->Abort(); }
 
+Status CompressedInputStream::SetMaxConcurrentFrames(int32_t max_concurrent_frames) {
+  return impl_->SetMaxConcurrentFrames(max_concurrent_frames);
+}
+
 bool CompressedInputStream::closed() const { return impl_->closed(); }
 
 Result<int64_t> CompressedInputStream::DoTell() const { return impl_->Tell(); }
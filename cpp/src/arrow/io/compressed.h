@@ -57,6 +57,24 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
                      const std::shared_ptr<OutputStream>& raw,
                      std::shared_ptr<CompressedOutputStream>* out);
 
+  /// \brief Compress independent frames concurrently
+  ///
+  /// Written data is cut into blocks of `frame_size` bytes, which are
+  /// compressed as independent frames on the CPU thread pool, up to
+  /// `max_concurrent_frames` at a time, and written in order.  The output is
+  /// a concatenation of regular compressed streams (zstd and LZ4 frames, gzip
+  /// members), which standard tools decompress as a whole.  Flush() ends the
+  /// current frame early.  1 (the default) disables concurrent compression.
+  ///
+  /// Must be called before writing.  The codec must outlive the stream.
+  /// Codecs whose streams can't be made of independent frames return
+  /// NotImplemented.
+  Status SetMaxConcurrentFrames(int32_t max_concurrent_frames,
+                                int64_t frame_size = kDefaultFrameSize);
+
+  /// Default size of the blocks compressed as independent frames
+  static constexpr int64_t kDefaultFrameSize = 4 * 1024 * 1024;
+
   // OutputStream interface
 
   /// \brief Close the compressed output stream.  This implicitly closes the
@@ -103,6 +121,18 @@ class ARROW_EXPORT CompressedInputStream
                      const std::shared_ptr<InputStream>& raw,
                      std::shared_ptr<CompressedInputStream>* out);
 
+  /// \brief Decompress independent frames concurrently
+  ///
+  /// For streams made of frames that can be decompressed independently
+  /// (zstd and LZ4 frames, BGZF gzip members), up to `max_concurrent_frames`
+  /// frames are decompressed on the CPU thread pool, the output being
+  /// returned in order.  Streams, or trailing parts of streams, that aren't
+  /// framed that way are decompressed sequentially.  1 (the default) disables
+  /// concurrent decompression.
+  ///
+  /// Must be called before reading.  The codec must outlive the stream.
+  Status SetMaxConcurrentFrames(int32_t max_concurrent_frames);
+
   // InputStream interface
 
   bool closed() const override;
@@ -81,10 +81,12 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
 }
 
 Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                int64_t* stream_pos, std::vector<uint8_t>* out) {
+                                int64_t* stream_pos, std::vector<uint8_t>* out,
+                                int32_t max_concurrent_frames = 1) {
   // Create compressed input stream
   auto buffer_reader = std::make_shared<BufferReader>(compressed);
   ARROW_ASSIGN_OR_RAISE(auto stream, CompressedInputStream::Make(codec, buffer_reader));
+  RETURN_NOT_OK(stream->SetMaxConcurrentFrames(max_concurrent_frames));
 
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
@@ -224,6 +226,42 @@ TEST_P(CompressedInputStreamTest, ConcatenatedStreams) {
   ASSERT_EQ(decompressed, expected);
 }
 
+TEST_P(CompressedInputStreamTest, ConcurrentFrames) {
+  // Streams that can't be split into frames are decompressed sequentially
+  auto codec = MakeCodec();
+  std::vector<std::shared_ptr<Buffer>> frames;
+  std::vector<uint8_t> expected;
+  for (int i = 0; i < 10; ++i) {
+    auto data = (i % 2) ? MakeRandomData(100000 + i) : MakeCompressibleData(300000 + i);
+    frames.push_back(CompressDataOneShot(codec.get(), data));
+    std::copy(data.begin(), data.end(), std::back_inserter(expected));
+  }
+  std::shared_ptr<Buffer> concatenated;
+  ASSERT_OK(ConcatenateBuffers(frames, default_memory_pool(), &concatenated));
+
+  for (int32_t max_concurrent_frames : {2, 4, 16}) {
+    std::vector<uint8_t> decompressed;
+    int64_t stream_pos = -1;
+    ASSERT_OK(RunCompressedInputStream(codec.get(), concatenated, &stream_pos,
+                                       &decompressed, max_concurrent_frames));
+    ASSERT_EQ(decompressed.size(), expected.size());
+    ASSERT_EQ(decompressed, expected);
+    ASSERT_EQ(stream_pos, static_cast<int64_t>(expected.size()));
+  }
+
+  auto truncated = SliceBuffer(concatenated, 0, concatenated->size() - 3);
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError, RunCompressedInputStream(codec.get(), truncated, nullptr,
+                                                  &decompressed, 4));
+
+  auto buffer_reader = std::make_shared<BufferReader>(concatenated);
+  ASSERT_OK_AND_ASSIGN(auto stream,
+                       CompressedInputStream::Make(codec.get(), buffer_reader));
+  ASSERT_RAISES(Invalid, stream->SetMaxConcurrentFrames(0));
+  ASSERT_OK(stream->Read(10));
+  ASSERT_RAISES(Invalid, stream->SetMaxConcurrentFrames(4));
+}
+
 TEST_P(CompressedOutputStreamTest, CompressibleData) {
   auto codec = MakeCodec();
   auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
@@ -240,6 +278,57 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, ConcurrentFrames) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+
+  ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto stream,
+                       CompressedOutputStream::Make(codec.get(), buffer_writer));
+  ASSERT_RAISES(Invalid, stream->SetMaxConcurrentFrames(0));
+  ASSERT_RAISES(Invalid, stream->SetMaxConcurrentFrames(2, 0));
+  auto status = stream->SetMaxConcurrentFrames(4, 100000);
+  if (GetCompression() == Compression::BROTLI) {
+    // Brotli streams can't be split into frames
+    ASSERT_RAISES(NotImplemented, status);
+    return;
+  }
+  ASSERT_OK(status);
+
+  const int64_t chunk_size = 77777;
+  for (int64_t pos = 0; pos < static_cast<int64_t>(data.size()); pos += chunk_size) {
+    const int64_t nbytes = std::min<int64_t>(chunk_size, data.size() - pos);
+    ASSERT_OK(stream->Write(data.data() + pos, nbytes));
+    if (pos == 5 * chunk_size) {
+      // Ends a frame early
+      ASSERT_OK(stream->Flush());
+    }
+  }
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()), stream->Tell());
+  ASSERT_RAISES(Invalid, stream->SetMaxConcurrentFrames(2));
+  ASSERT_OK(stream->Close());
+  ASSERT_OK_AND_ASSIGN(auto compressed, buffer_writer->Finish());
+
+  for (int32_t max_concurrent_frames : {1, 4}) {
+    std::vector<uint8_t> decompressed;
+    ASSERT_OK(RunCompressedInputStream(codec.get(), compressed, nullptr, &decompressed,
+                                       max_concurrent_frames));
+    ASSERT_EQ(decompressed.size(), data.size());
+    ASSERT_EQ(decompressed, data);
+  }
+
+  // An empty stream is still a valid compressed stream
+  ASSERT_OK_AND_ASSIGN(buffer_writer, BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(stream, CompressedOutputStream::Make(codec.get(), buffer_writer));
+  ASSERT_OK(stream->SetMaxConcurrentFrames(4));
+  ASSERT_OK(stream->Close());
+  ASSERT_OK_AND_ASSIGN(compressed, buffer_writer->Finish());
+  ASSERT_GT(compressed->size(), 0);
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec.get(), compressed, &decompressed));
+  ASSERT_EQ(decompressed.size(), 0);
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -263,6 +352,57 @@ TEST(TestSnappyOutputStream, NotImplemented) {
 #endif
 
 #ifdef ARROW_WITH_ZLIB
+// Make a BGZF member by adding the member size to a gzip member's header.
+// The compressed data must be smaller than 64 KiB.
+std::shared_ptr<Buffer> CompressBGZFMember(Codec* codec,
+                                           const std::vector<uint8_t>& data) {
+  const uint8_t kExtraFieldFlag = 4;
+  const int64_t kHeaderSize = 10;
+
+  auto member = CompressDataOneShot(codec, data);
+  const int64_t bgzf_size = member->size() + 8;
+  std::string bgzf(reinterpret_cast<const char*>(member->data()), kHeaderSize);
+  bgzf[3] = static_cast<char>(bgzf[3] | kExtraFieldFlag);
+  // 6 bytes of extra field: the "BC" subfield holding the member size minus 1
+  bgzf += std::string("\x06\x00" "BC" "\x02\x00", 6);
+  bgzf += static_cast<char>((bgzf_size - 1) & 0xff);
+  bgzf += static_cast<char>((bgzf_size - 1) >> 8);
+  bgzf.append(reinterpret_cast<const char*>(member->data()) + kHeaderSize,
+              member->size() - kHeaderSize);
+  return Buffer::FromString(std::move(bgzf));
+}
+
+TEST(TestGZipInputStream, BGZFConcurrentFrames) {
+  ASSERT_OK_AND_ASSIGN(auto codec, Codec::Create(Compression::GZIP));
+  std::vector<std::shared_ptr<Buffer>> members;
+  std::vector<uint8_t> expected;
+  for (int i = 0; i < 20; ++i) {
+    auto data = (i % 2) ? MakeRandomData(60000 + i) : MakeCompressibleData(60000 + i);
+    members.push_back(CompressBGZFMember(codec.get(), data));
+    std::copy(data.begin(), data.end(), std::back_inserter(expected));
+  }
+  // An empty member, as bgzip writes at the end of streams
+  members.push_back(CompressBGZFMember(codec.get(), {}));
+  std::shared_ptr<Buffer> concatenated;
+  ASSERT_OK(ConcatenateBuffers(members, default_memory_pool(), &concatenated));
+
+  ASSERT_OK_AND_EQ(members[0]->size(),
+                   codec->FrameCompressedLength(concatenated->size(),
+                                                concatenated->data()));
+  for (int32_t max_concurrent_frames : {1, 3, 8}) {
+    std::vector<uint8_t> decompressed;
+    ASSERT_OK(RunCompressedInputStream(codec.get(), concatenated, nullptr, &decompressed,
+                                       max_concurrent_frames));
+    ASSERT_EQ(decompressed.size(), expected.size());
+    ASSERT_EQ(decompressed, expected);
+  }
+
+  auto truncated = SliceBuffer(concatenated, 0, concatenated->size() - 3);
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError, RunCompressedInputStream(codec.get(), truncated, nullptr,
+                                                  &decompressed, 4));
+}
+
 INSTANTIATE_TEST_CASE_P(TestGZipInputStream, CompressedInputStreamTest,
                         ::testing::Values(Compression::GZIP));
 INSTANTIATE_TEST_CASE_P(TestGZipOutputStream, CompressedOutputStreamTest,
@@ -26,7 +26,10 @@
 #undef Realloc
 #undef Free
 #else
+#include <fcntl.h>
+#include <limits.h>
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>  // IWYU pragma: keep
 #endif
 
@@ -39,17 +42,20 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 
@@ -182,6 +188,55 @@ class OSFile {
                                         length);
   }
 
+  Status Write(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    RETURN_NOT_OK(CheckClosed());
+
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckPositioned());
+#ifdef _WIN32
+    for (const auto& buffer : buffers) {
+      if (buffer && buffer->size() > 0) {
+        RETURN_NOT_OK(::arrow::internal::FileWrite(fd_, buffer->data(), buffer->size()));
+      }
+    }
+    return Status::OK();
+#else
+    std::vector<struct iovec> iov;
+    iov.reserve(buffers.size());
+    for (const auto& buffer : buffers) {
+      if (buffer && buffer->size() > 0) {
+        iov.push_back({const_cast<uint8_t*>(buffer->data()),
+                       static_cast<size_t>(buffer->size())});
+      }
+    }
+
+    size_t i = 0;
+    while (i < iov.size()) {
+      const int count = static_cast<int>(std::min<size_t>(IOV_MAX, iov.size() - i));
+      const ssize_t ret = writev(fd_, iov.data() + i, count);
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return ::arrow::internal::IOErrorFromErrno(errno, "Error writing bytes to file");
+      }
+      // Skip the fully written buffers and advance in the partially written one
+      size_t written = static_cast<size_t>(ret);
+      while (written > 0) {
+        if (written >= iov[i].iov_len) {
+          written -= iov[i].iov_len;
+          ++i;
+        } else {
+          iov[i].iov_base = static_cast<uint8_t*>(iov[i].iov_base) + written;
+          iov[i].iov_len -= written;
+          written = 0;
+        }
+      }
+    }
+    return Status::OK();
+#endif
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -230,14 +285,56 @@ class OSFile {
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
+constexpr int64_t ReadableFileOptions::kDirectIOAlignment;
+
 class ReadableFile::ReadableFileImpl : public OSFile {
  public:
   explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
 
-  Status Open(const std::string& path) { return OpenReadable(path); }
-  Status Open(int fd) { return OpenReadable(fd); }
+  Status Open(const std::string& path, const ReadableFileOptions& options) {
+    RETURN_NOT_OK(SetFileName(path));
+    ARROW_ASSIGN_OR_RAISE(
+        fd_, ::arrow::internal::FileOpenReadable(file_name_, options.direct_io));
+    ARROW_ASSIGN_OR_RAISE(size_, ::arrow::internal::FileGetSize(fd_));
+    is_open_ = true;
+    mode_ = FileMode::READ;
+    direct_io_ = options.direct_io;
+    return Status::OK();
+  }
+
+  Status Open(int fd) {
+    RETURN_NOT_OK(OpenReadable(fd));
+#ifdef O_DIRECT
+    int flags = fcntl(fd, F_GETFL);
+    direct_io_ = flags != -1 && (flags & O_DIRECT) != 0;
+#endif
+    return Status::OK();
+  }
+
+  bool direct_io() const { return direct_io_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    if (!direct_io_) {
+      return OSFile::Read(nbytes, out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DirectRead(nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    if (!direct_io_) {
+      return OSFile::ReadAt(position, nbytes, out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DirectReadAt(position, nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
 
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
+    if (direct_io_) {
+      return DirectRead(nbytes);
+    }
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -250,6 +347,9 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    if (direct_io_) {
+      return DirectReadAt(position, nbytes);
+    }
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -262,18 +362,117 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return buffer;
   }
 
+  MemoryPool* pool() const { return pool_; }
+
+  // Best-effort hint that the given range will be read soon
+  void WillNeed(int64_t position, int64_t nbytes) {
+    if (is_open_ && !direct_io_ && position >= 0 && nbytes > 0) {
+      ARROW_UNUSED(Advise(AccessAdvice::WILL_NEED, position, nbytes));
+    }
+  }
+
+  Status Advise(AccessAdvice::type advice, int64_t offset, int64_t length) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateRegion(offset, length));
+#ifdef POSIX_FADV_WILLNEED
+    int fadvice = POSIX_FADV_NORMAL;
+    switch (advice) {
+      case AccessAdvice::NORMAL:
+        fadvice = POSIX_FADV_NORMAL;
+        break;
+      case AccessAdvice::SEQUENTIAL:
+        fadvice = POSIX_FADV_SEQUENTIAL;
+        break;
+      case AccessAdvice::RANDOM:
+        fadvice = POSIX_FADV_RANDOM;
+        break;
+      case AccessAdvice::WILL_NEED:
+        fadvice = POSIX_FADV_WILLNEED;
+        break;
+      case AccessAdvice::DONT_NEED:
+        fadvice = POSIX_FADV_DONTNEED;
+        break;
+    }
+    // posix_fadvise() returns the error number rather than setting errno
+    int ret = posix_fadvise(fd_, static_cast<off_t>(offset), static_cast<off_t>(length),
+                            fadvice);
+    if (ret != 0) {
+      return ::arrow::internal::IOErrorFromErrno(ret, "posix_fadvise failed");
+    }
+#endif
+    return Status::OK();
+  }
+
  private:
+  static constexpr int64_t kAlignment = ReadableFileOptions::kDirectIOAlignment;
+  // Largest aligned read issued at once, below ARROW_MAX_IO_CHUNKSIZE
+  static constexpr int64_t kMaxDirectReadSize = 1LL << 30;
+
+  // Read the aligned range enclosing the requested one, and return the
+  // requested part of it.  Pool allocations are only 64-byte aligned, so the
+  // read lands at an aligned offset in a slightly larger buffer.
+  Result<std::shared_ptr<Buffer>> DirectReadAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateRegion(position, nbytes));
+    need_seeking_.store(true);
+
+    const int64_t start = BitUtil::RoundDown(position, kAlignment);
+    const int64_t end = BitUtil::RoundUp(position + nbytes, kAlignment);
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, end - start + kAlignment, &buffer));
+    const int64_t misalignment =
+        static_cast<int64_t>(reinterpret_cast<uintptr_t>(buffer->data()) % kAlignment);
+    const int64_t data_offset = misalignment == 0 ? 0 : kAlignment - misalignment;
+
+    int64_t bytes_read = 0;
+    while (start + bytes_read < end) {
+      const int64_t chunk_size = std::min(end - start - bytes_read, kMaxDirectReadSize);
+      ARROW_ASSIGN_OR_RAISE(
+          int64_t chunk_read,
+          ::arrow::internal::FileReadAt(
+              fd_, buffer->mutable_data() + data_offset + bytes_read,
+              start + bytes_read, chunk_size));
+      bytes_read += chunk_read;
+      if (chunk_read < chunk_size) {
+        // EOF
+        break;
+      }
+    }
+    const int64_t available =
+        std::max<int64_t>(0, std::min(bytes_read - (position - start), nbytes));
+    return SliceBuffer(std::move(buffer), data_offset + position - start, available);
+  }
+
+  // Direct reads from the current position, which is then advanced
+  Result<std::shared_ptr<Buffer>> DirectRead(int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPositioned());
+    ARROW_ASSIGN_OR_RAISE(int64_t position, ::arrow::internal::FileTell(fd_));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DirectReadAt(position, nbytes));
+    RETURN_NOT_OK(Seek(position + buffer->size()));
+    return buffer;
+  }
+
   MemoryPool* pool_;
+  bool direct_io_ = false;
 };
 
+constexpr int64_t ReadableFile::ReadableFileImpl::kAlignment;
+constexpr int64_t ReadableFile::ReadableFileImpl::kMaxDirectReadSize;
+
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
 
 ReadableFile::~ReadableFile() { internal::CloseFromDestructor(this); }
 
 Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(const std::string& path,
                                                          MemoryPool* pool) {
+  return Open(path, ReadableFileOptions(), pool);
+}
+
+Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(
+    const std::string& path, const ReadableFileOptions& options, MemoryPool* pool) {
   auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
-  RETURN_NOT_OK(file->impl_->Open(path));
+  RETURN_NOT_OK(file->impl_->Open(path, options));
   return file;
 }
 
@@ -328,6 +527,32 @@ Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+bool ReadableFile::direct_io() const { return impl_->direct_io(); }
+
+Status ReadableFile::Advise(AccessAdvice::type advice, int64_t offset, int64_t length) {
+  return impl_->Advise(advice, offset, length);
+}
+
+Future<std::shared_ptr<Buffer>> ReadableFile::ReadAsync(int64_t position,
+                                                     int64_t nbytes) {
+  // The ring reads into unaligned buffers, which direct I/O rejects
+  auto ring = internal::IoUring::GetInstance();
+  if (ring != nullptr && impl_->is_open() && !impl_->direct_io()) {
+    return ring->ReadMany(impl_->fd(), {{position, nbytes}}, impl_->pool())[0];
+  }
+  impl_->WillNeed(position, nbytes);
+  return RandomAccessFile::ReadAsync(position, nbytes);
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAsync(
+    const std::vector<ReadRange>& ranges) {
+  auto ring = internal::IoUring::GetInstance();
+  if (ring != nullptr && impl_->is_open() && !impl_->direct_io()) {
+    return ring->ReadMany(impl_->fd(), ranges, impl_->pool());
+  }
+  return RandomAccessFile::ReadManyAsync(ranges);
+}
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
@@ -395,6 +620,10 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::Write(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  return impl_->Write(buffers);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -551,6 +780,45 @@ class MemoryMappedFile::MemoryMap
     }
   }
 
+  Status Advise(AccessAdvice::type advice, int64_t offset, int64_t length) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateRegion(offset, length));
+    if (offset >= map_len_) {
+      return Status::OK();
+    }
+    if (length == 0 || length > map_len_ - offset) {
+      length = map_len_ - offset;
+    }
+#ifndef _WIN32
+    int madvice = MADV_NORMAL;
+    switch (advice) {
+      case AccessAdvice::NORMAL:
+        madvice = MADV_NORMAL;
+        break;
+      case AccessAdvice::SEQUENTIAL:
+        madvice = MADV_SEQUENTIAL;
+        break;
+      case AccessAdvice::RANDOM:
+        madvice = MADV_RANDOM;
+        break;
+      case AccessAdvice::WILL_NEED:
+        madvice = MADV_WILLNEED;
+        break;
+      case AccessAdvice::DONT_NEED:
+        madvice = MADV_DONTNEED;
+        break;
+    }
+    // madvise() wants a page-aligned address, the map itself is page-aligned
+    static const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    const int64_t start = BitUtil::RoundDown(offset, page_size);
+    if (madvise(data() + start, static_cast<size_t>(length + offset - start),
+                madvice) != 0) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "madvise failed");
+    }
+#endif
+    return Status::OK();
+  }
+
   // map_len_ == file_size_ if memory mapping on the whole file
   int64_t size() const { return map_len_; }
 
@@ -700,6 +968,12 @@ Result<std::shared_ptr<Buffer>> MemoryMappedFile::ReadAt(int64_t position,
   return memory_map_->Slice(position, nbytes);
 }
 
+Status MemoryMappedFile::Advise(AccessAdvice::type advice, int64_t offset,
+                                int64_t length) {
+  std::lock_guard<std::mutex> guard(memory_map_->resize_lock());
+  return memory_map_->Advise(advice, offset, length);
+}
+
 Result<int64_t> MemoryMappedFile::ReadAt(int64_t position, int64_t nbytes, void* out) {
   RETURN_NOT_OK(memory_map_->CheckClosed());
   auto guard_resize = memory_map_->writable()
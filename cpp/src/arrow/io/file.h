@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
@@ -83,6 +84,8 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
 
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
+  // Write buffers to the stream with gathered writes where supported. Thread-safe
+  Status Write(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
   /// \cond FALSE
   using Writable::Write;
   /// \endcond
@@ -96,6 +99,18 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   std::unique_ptr<FileOutputStreamImpl> impl_;
 };
 
+/// \brief Options for opening a ReadableFile
+struct ARROW_EXPORT ReadableFileOptions {
+  /// Bypass the operating system's page cache (O_DIRECT on Linux).  Reads are
+  /// issued at offsets and sizes aligned to kDirectIOAlignment; unaligned
+  /// requests read the enclosing aligned range into memory from the file's pool.
+  /// This suits large scans, which would otherwise evict the page cache.
+  bool direct_io = false;
+
+  /// Alignment of direct reads, suitable for all common block devices
+  static constexpr int64_t kDirectIOAlignment = 4096;
+};
+
 /// \brief An operating system file open in read-only mode.
 ///
 /// Reads through this implementation are unbuffered.  If many small reads
@@ -113,6 +128,15 @@ class ARROW_EXPORT ReadableFile
   static Result<std::shared_ptr<ReadableFile>> Open(
       const std::string& path, MemoryPool* pool = default_memory_pool());
 
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options open options
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return ReadableFile instance
+  static Result<std::shared_ptr<ReadableFile>> Open(
+      const std::string& path, const ReadableFileOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   ARROW_DEPRECATED("Use Result-returning overload")
   static Status Open(const std::string& path, std::shared_ptr<ReadableFile>* file);
   ARROW_DEPRECATED("Use Result-returning overload")
@@ -138,6 +162,33 @@ class ARROW_EXPORT ReadableFile
 
   int file_descriptor() const;
 
+  /// \brief Whether reads bypass the page cache
+  ///
+  /// This is also true if a file descriptor opened with O_DIRECT was given.
+  bool direct_io() const;
+
+  /// \brief Advise the operating system of how a region will be accessed
+  ///
+  /// This is a best-effort hint (posix_fadvise), ignored on platforms without
+  /// support.  A zero `length` extends the region to the end of the file.
+  Status Advise(AccessAdvice::type advice, int64_t offset = 0, int64_t length = 0);
+
+  /// \brief Read asynchronously
+  ///
+  /// On Linux builds with ARROW_WITH_IO_URING, the read is submitted to the
+  /// kernel through io_uring (unless the ARROW_IO_URING environment variable is
+  /// set to 0, or the kernel lacks support).  Otherwise, the operating system
+  /// is advised that the range will be needed, so that it can start fetching
+  /// it before the read runs on the I/O thread pool.
+  Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes) override;
+
+  /// \brief Read several ranges asynchronously
+  ///
+  /// With io_uring, all reads are submitted in a single system call.  Direct
+  /// reads always run on the I/O thread pool.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const std::vector<ReadRange>& ranges) override;
+
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
 
@@ -232,6 +283,13 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   /// Set the size of the map to new_size.
   Status Resize(int64_t new_size);
 
+  /// \brief Advise the operating system of how a region of the map will be
+  /// accessed
+  ///
+  /// This is a best-effort hint (madvise), ignored on platforms without
+  /// support.  A zero `length` extends the region to the end of the map.
+  Status Advise(AccessAdvice::type advice, int64_t offset = 0, int64_t length = 0);
+
   /// Write data at a particular position in the file. Thread-safe
   Status WriteAt(int64_t position, const void* data, int64_t nbytes) override;
 
@@ -37,6 +37,7 @@
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/test_common.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
@@ -185,6 +186,30 @@ TEST_F(TestFileOutputStream, Tell) {
   ASSERT_OK_AND_EQ(8, file_->Tell());
 }
 
+TEST_F(TestFileOutputStream, WriteBuffers) {
+  OpenFile();
+
+  std::vector<std::shared_ptr<Buffer>> buffers = {
+      Buffer::FromString("test"), nullptr, std::make_shared<Buffer>(""),
+      Buffer::FromString("data")};
+  ASSERT_OK(file_->Write(buffers));
+  ASSERT_OK_AND_EQ(8, file_->Tell());
+
+  // More buffers than a single writev() call accepts
+  std::string expected = "testdata";
+  buffers.clear();
+  for (int i = 0; i < 5000; ++i) {
+    auto data = std::to_string(i);
+    expected += data;
+    buffers.push_back(Buffer::FromString(std::move(data)));
+  }
+  ASSERT_OK(file_->Write(buffers));
+  ASSERT_OK(file_->Close());
+  AssertFileContents(path_, expected);
+
+  ASSERT_RAISES(Invalid, file_->Write(buffers));
+}
+
 TEST_F(TestFileOutputStream, TruncatesNewFile) {
   ASSERT_OK_AND_ASSIGN(file_, FileOutputStream::Open(path_));
 
@@ -364,6 +389,154 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
 }
 
+TEST_F(TestReadableFile, ReadAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  auto fut1 = file_->ReadAsync(1, 10);
+  auto fut2 = file_->ReadAsync(0, 4);
+  ASSERT_OK_AND_ASSIGN(auto buf1, fut1.result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, fut2.result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+
+  ASSERT_RAISES(Invalid, file_->ReadAsync(-1, 1).result());
+}
+
+TEST_F(TestReadableFile, ReadManyAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  auto futures = file_->ReadManyAsync({{1, 10}, {0, 4}, {3, 0}, {-1, 1}});
+  ASSERT_EQ(futures.size(), 4);
+  ASSERT_OK_AND_ASSIGN(auto buf1, futures[0].result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, futures[1].result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, futures[2].result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+  ASSERT_EQ(buf3->size(), 0);
+  ASSERT_RAISES(Invalid, futures[3].result());
+}
+
+TEST_F(TestReadableFile, Advise) {
+  MakeTestFile();
+  OpenFile();
+
+  for (auto advice : {AccessAdvice::SEQUENTIAL, AccessAdvice::RANDOM,
+                      AccessAdvice::WILL_NEED, AccessAdvice::DONT_NEED,
+                      AccessAdvice::NORMAL}) {
+    ASSERT_OK(file_->Advise(advice));
+    ASSERT_OK(file_->Advise(advice, 2, 3));
+  }
+  ASSERT_RAISES(Invalid, file_->Advise(AccessAdvice::RANDOM, -1, 1));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(0, 4));
+  AssertBufferEqual(*buffer, "test");
+
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->Advise(AccessAdvice::NORMAL));
+}
+
+TEST_F(TestReadableFile, DirectIO) {
+  std::string data(3 * ReadableFileOptions::kDirectIOAlignment + 123, '\0');
+  random_bytes(data.size(), 42, reinterpret_cast<uint8_t*>(&data[0]));
+  {
+    std::ofstream stream(path_, std::ios::binary);
+    stream << data;
+  }
+  ReadableFileOptions options;
+  options.direct_io = true;
+  auto maybe_file = ReadableFile::Open(path_, options);
+  if (!maybe_file.ok()) {
+    // SKIP: the filesystem does not support direct I/O (e.g. tmpfs)
+    return;
+  }
+  file_ = *maybe_file;
+  ASSERT_TRUE(file_->direct_io());
+
+  // Unaligned reads, some of them crossing the end of file
+  const std::vector<ReadRange> ranges = {
+      {0, 10}, {5, 5000}, {4096, 4096}, {4000, 8000}, {12000, 1000}, {20000, 5}};
+  for (const auto& range : ranges) {
+    SCOPED_TRACE(std::to_string(range.offset) + ":" + std::to_string(range.length));
+    const std::string expected =
+        range.offset < static_cast<int64_t>(data.size())
+            ? data.substr(range.offset, range.length)
+            : "";
+    ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(range.offset, range.length));
+    ASSERT_EQ(buffer->ToString(), expected);
+    ASSERT_OK_AND_ASSIGN(buffer, file_->ReadAsync(range.offset, range.length).result());
+    ASSERT_EQ(buffer->ToString(), expected);
+    std::string out(range.length, '\0');
+    ASSERT_OK_AND_ASSIGN(int64_t bytes_read,
+                         file_->ReadAt(range.offset, range.length, &out[0]));
+    ASSERT_EQ(out.substr(0, bytes_read), expected);
+  }
+
+  // Sequential reads
+  ASSERT_OK(file_->Seek(0));
+  std::string contents;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, file_->Read(1000));
+    if (buffer->size() == 0) {
+      break;
+    }
+    contents += buffer->ToString();
+    ASSERT_OK_AND_EQ(static_cast<int64_t>(contents.size()), file_->Tell());
+  }
+  ASSERT_EQ(contents, data);
+  ASSERT_OK(file_->Close());
+
+#ifdef O_DIRECT
+  // Direct I/O is detected on a given file descriptor
+  int fd = open(path_.c_str(), O_RDONLY | O_DIRECT);
+  ASSERT_GE(fd, 0);
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(fd));
+  ASSERT_TRUE(file_->direct_io());
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(4100, 20));
+  ASSERT_EQ(buffer->ToString(), data.substr(4100, 20));
+#endif
+}
+
+TEST_F(TestReadableFile, IoUringManyReads) {
+  auto ring = internal::IoUring::GetInstance();
+  if (ring == nullptr) {
+    // SKIP: built without io_uring, or unsupported by the kernel
+    return;
+  }
+  // Large enough for reads bypassing the registered buffers
+  std::string data(1 << 20, '\0');
+  random_bytes(data.size(), 42, reinterpret_cast<uint8_t*>(&data[0]));
+  {
+    std::ofstream stream(path_, std::ios::binary);
+    stream << data;
+  }
+  OpenFile();
+
+  // More ranges than the ring holds, some of them small and others past the
+  // end of file.  All buffers are kept alive, so the registered buffers run out.
+  std::vector<ReadRange> ranges;
+  for (int64_t i = 0; i < 1500; ++i) {
+    int64_t offset = (i * 7919) % static_cast<int64_t>(data.size());
+    int64_t length = (i % 10 == 0) ? 300000 : (i % 500) + 1;
+    ranges.push_back({offset, length});
+  }
+  auto futures = file_->ReadManyAsync(ranges);
+  ASSERT_EQ(futures.size(), ranges.size());
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, futures[i].result());
+    auto expected = data.substr(ranges[i].offset, ranges[i].length);
+    ASSERT_EQ(buffer->ToString(), expected) << "range #" << i;
+    buffers.push_back(std::move(buffer));
+  }
+
+  // Reading through a closed descriptor fails
+  int fd = file_->file_descriptor();
+  ASSERT_OK(file_->Close());
+  auto results = ring->ReadMany(fd, {{0, 10}}, default_memory_pool());
+  ASSERT_RAISES(IOError, results[0].result());
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
@@ -836,6 +1009,30 @@ TEST_F(TestMemoryMappedFile, GetSize) {
   ASSERT_OK_AND_EQ(0, result->Tell());
 }
 
+TEST_F(TestMemoryMappedFile, Advise) {
+  std::string path = "io-memory-map-advise";
+  ASSERT_OK_AND_ASSIGN(auto result, InitMemoryMap(16384, path));
+
+  for (auto advice : {AccessAdvice::SEQUENTIAL, AccessAdvice::RANDOM,
+                      AccessAdvice::WILL_NEED, AccessAdvice::NORMAL}) {
+    ASSERT_OK(result->Advise(advice));
+    // Unaligned regions, and regions past the end of the map
+    ASSERT_OK(result->Advise(advice, 100, 5000));
+    ASSERT_OK(result->Advise(advice, 10000, 100000));
+    ASSERT_OK(result->Advise(advice, 100000, 10));
+  }
+  ASSERT_RAISES(Invalid, result->Advise(AccessAdvice::RANDOM, -1, 10));
+
+  // Dropping pages of a shared map keeps the written data
+  ASSERT_OK(result->WriteAt(5000, "abcd", 4));
+  ASSERT_OK(result->Advise(AccessAdvice::DONT_NEED));
+  ASSERT_OK_AND_ASSIGN(auto buffer, result->ReadAt(5000, 4));
+  AssertBufferEqual(*buffer, "abcd");
+
+  ASSERT_OK(result->Close());
+  ASSERT_RAISES(Invalid, result->Advise(AccessAdvice::NORMAL));
+}
+
 TEST_F(TestMemoryMappedFile, ReadOnly) {
   const int64_t buffer_size = 1024;
   std::vector<uint8_t> buffer(buffer_size);
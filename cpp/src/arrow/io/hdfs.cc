@@ -19,6 +19,7 @@
 #include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -118,7 +119,9 @@ Status GetPathInfoFailed(const std::string& path) {
 }  // namespace
 
 // Private implementation for read-only files
-class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
+class HdfsReadableFile::HdfsReadableFileImpl
+    : public HdfsAnyFileImpl,
+      public std::enable_shared_from_this<HdfsReadableFileImpl> {
  public:
   explicit HdfsReadableFileImpl(MemoryPool* pool) : pool_(pool) {}
 
@@ -129,14 +132,53 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
       // the error doesn't get propagated properly and the second close
       // initiated by the destructor raises a segfault
       is_open_ = false;
-      int ret = driver_->CloseFile(fs_, file_);
-      CHECK_FAILURE(ret, "CloseFile");
+      {
+        std::lock_guard<std::mutex> guard(zero_copy_lock_);
+        if (zero_copy_buffers_ > 0) {
+          // The last zero-copy buffer released closes the stream
+          close_deferred_ = true;
+          return Status::OK();
+        }
+      }
+      return CloseFile();
     }
     return Status::OK();
   }
 
   bool closed() const { return !is_open_; }
 
+  // Enable zero-copy reads if the driver supports them
+  void EnableZeroCopy() {
+    if (!driver_->HasReadZero()) {
+      return;
+    }
+    rz_options_ = driver_->RzOptionsAlloc();
+    if (rz_options_ == nullptr) {
+      return;
+    }
+    // hadoopReadZero refuses to map data whose checksums must be verified,
+    // unless the DataNode has verified and cached it already
+    if (driver_->RzOptionsSetSkipChecksum(rz_options_, 1) != 0) {
+      driver_->RzOptionsFree(rz_options_);
+      rz_options_ = nullptr;
+    }
+  }
+
+  bool zero_copy_enabled() const { return rz_options_ != nullptr; }
+
+  void ReleaseZeroCopy(hadoopRzBuffer* rz_buffer) {
+    std::lock_guard<std::mutex> guard(zero_copy_lock_);
+    driver_->RzBufferFree(file_, rz_buffer);
+    if (--zero_copy_buffers_ == 0 && close_deferred_) {
+      close_deferred_ = false;
+      Status st = CloseFile();
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Closing HDFS file after releasing zero-copy buffers: "
+                           << st.ToString();
+      }
+    }
+  }
+
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* buffer) {
     if (!driver_->HasPread()) {
       std::lock_guard<std::mutex> guard(lock_);
@@ -151,6 +193,19 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) {
+    if (zero_copy_enabled()) {
+      std::lock_guard<std::mutex> guard(lock_);
+      // hadoopReadZero reads at the current position, which ReadAt preserves
+      ARROW_ASSIGN_OR_RAISE(int64_t current, Tell());
+      RETURN_NOT_OK(Seek(position));
+      auto maybe_buffer = ReadZeroCopy(nbytes);
+      RETURN_NOT_OK(Seek(current));
+      ARROW_ASSIGN_OR_RAISE(auto buffer, std::move(maybe_buffer));
+      if (buffer != nullptr) {
+        return buffer;
+      }
+    }
+
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -180,6 +235,14 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) {
+    if (zero_copy_enabled()) {
+      std::lock_guard<std::mutex> guard(lock_);
+      ARROW_ASSIGN_OR_RAISE(auto buffer, ReadZeroCopy(nbytes));
+      if (buffer != nullptr) {
+        return buffer;
+      }
+    }
+
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -206,15 +269,88 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
 
  private:
+  // A Buffer over file data mapped by hadoopReadZero, released on destruction
+  class ZeroCopyBuffer : public Buffer {
+   public:
+    ZeroCopyBuffer(std::shared_ptr<HdfsReadableFileImpl> file, hadoopRzBuffer* rz_buffer,
+                   const uint8_t* data, int64_t size)
+        : Buffer(data, size), file_(std::move(file)), rz_buffer_(rz_buffer) {}
+
+    ~ZeroCopyBuffer() override { file_->ReleaseZeroCopy(rz_buffer_); }
+
+   private:
+    std::shared_ptr<HdfsReadableFileImpl> file_;
+    hadoopRzBuffer* rz_buffer_;
+  };
+
+  Status CloseFile() {
+    if (rz_options_ != nullptr) {
+      driver_->RzOptionsFree(rz_options_);
+      rz_options_ = nullptr;
+    }
+    int ret = driver_->CloseFile(fs_, file_);
+    CHECK_FAILURE(ret, "CloseFile");
+    return Status::OK();
+  }
+
+  // Read up to nbytes at the current position, mapping the data if possible.
+  // Return null if the data can't be mapped, e.g. because it isn't stored on
+  // the local DataNode.
+  Result<std::shared_ptr<Buffer>> ReadZeroCopy(int64_t nbytes) {
+    const auto max_length = static_cast<int32_t>(
+        std::min<int64_t>(nbytes, std::numeric_limits<int32_t>::max()));
+    errno = 0;
+    hadoopRzBuffer* rz_buffer = driver_->ReadZero(file_, rz_options_, max_length);
+    if (rz_buffer == nullptr) {
+      if (errno == EOPNOTSUPP) {
+        return nullptr;
+      }
+      return Status::IOError("HDFS zero-copy read failed, errno: ",
+                             TranslateErrno(errno));
+    }
+    // The data is null at end of file
+    const auto data = reinterpret_cast<const uint8_t*>(driver_->RzBufferGet(rz_buffer));
+    const int64_t length = data == nullptr ? 0 : driver_->RzBufferLength(rz_buffer);
+    {
+      std::lock_guard<std::mutex> guard(zero_copy_lock_);
+      ++zero_copy_buffers_;
+    }
+    std::shared_ptr<Buffer> mapped =
+        std::make_shared<ZeroCopyBuffer>(shared_from_this(), rz_buffer, data, length);
+    if (length == nbytes || length == 0) {
+      return mapped;
+    }
+
+    // The mapping stopped at a block boundary: complete the read with a copy
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    std::memcpy(buffer->mutable_data(), mapped->data(), length);
+    mapped.reset();
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          Read(nbytes - length, buffer->mutable_data() + length));
+    if (length + bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(length + bytes_read));
+    }
+    return buffer;
+  }
+
   MemoryPool* pool_;
   int32_t buffer_size_;
+
+  // Options of zero-copy reads, or null if they are disabled
+  hadoopRzOptions* rz_options_ = nullptr;
+  // Live zero-copy buffers, which keep the stream open
+  std::mutex zero_copy_lock_;
+  int64_t zero_copy_buffers_ = 0;
+  bool close_deferred_ = false;
 };
 
+
 HdfsReadableFile::HdfsReadableFile(MemoryPool* pool) {
   if (pool == nullptr) {
     pool = default_memory_pool();
   }
-  impl_.reset(new HdfsReadableFileImpl(pool));
+  impl_ = std::make_shared<HdfsReadableFileImpl>(pool);
 }
 
 HdfsReadableFile::~HdfsReadableFile() { DCHECK_OK(impl_->Close()); }
@@ -242,6 +378,8 @@ Result<std::shared_ptr<Buffer>> HdfsReadableFile::Read(int64_t nbytes) {
 
 Result<int64_t> HdfsReadableFile::GetSize() { return impl_->GetSize(); }
 
+bool HdfsReadableFile::supports_zero_copy() const { return impl_->zero_copy_enabled(); }
+
 Status HdfsReadableFile::Seek(int64_t position) { return impl_->Seek(position); }
 
 Result<int64_t> HdfsReadableFile::Tell() const { return impl_->Tell(); }
@@ -368,6 +506,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     port_ = config->port;
     user_ = config->user;
     kerb_ticket_ = config->kerb_ticket;
+    zero_copy_reads_ = config->zero_copy_reads;
 
     return Status::OK();
   }
@@ -502,6 +641,9 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile());
     (*file)->impl_->set_members(path, driver_, fs_, handle);
     (*file)->impl_->set_buffer_size(buffer_size);
+    if (zero_copy_reads_) {
+      (*file)->impl_->EnableZeroCopy();
+    }
 
     return Status::OK();
   }
@@ -552,6 +694,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
   std::string user_;
   int port_;
   std::string kerb_ticket_;
+  bool zero_copy_reads_ = false;
 
   hdfsFS fs_;
 };
@@ -66,8 +66,14 @@ struct HdfsConnectionConfig {
   std::string kerb_ticket;
   std::unordered_map<std::string, std::string> extra_conf;
   HdfsDriver driver;
-
-  HdfsConnectionConfig() : driver(HdfsDriver::LIBHDFS) {}
+  // Map file data in memory instead of copying it, where the data is on the
+  // local DataNode and short-circuit local reads are enabled
+  // (dfs.client.read.shortcircuit).  Zero-copy reads skip checksum
+  // verification.  Only supported by the libhdfs driver, other reads are
+  // copied as usual.
+  bool zero_copy_reads;
+
+  HdfsConnectionConfig() : driver(HdfsDriver::LIBHDFS), zero_copy_reads(false) {}
 };
 
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
@@ -215,13 +221,18 @@ class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
   Result<int64_t> Tell() const override;
   Result<int64_t> GetSize() override;
 
+  // Whether the Buffer-returning reads may map file data instead of copying it,
+  // see HdfsConnectionConfig::zero_copy_reads
+  bool supports_zero_copy() const override;
+
   void set_memory_pool(MemoryPool* pool);
 
  private:
   explicit HdfsReadableFile(MemoryPool* pool = NULLPTR);
 
   class ARROW_NO_EXPORT HdfsReadableFileImpl;
-  std::unique_ptr<HdfsReadableFileImpl> impl_;
+  // Shared with the zero-copy buffers, which must be released on their stream
+  std::shared_ptr<HdfsReadableFileImpl> impl_;
 
   friend class HadoopFileSystem::HadoopFileSystemImpl;
 
@@ -371,6 +371,47 @@ TYPED_TEST(TestHadoopFileSystem, ReadableMethods) {
   ASSERT_OK_AND_EQ(60, file->Tell());
 }
 
+TYPED_TEST(TestHadoopFileSystem, ZeroCopyReads) {
+  SKIP_IF_NO_DRIVER();
+
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("test-zero-copy-file");
+  const int size = 1000000;
+
+  std::vector<uint8_t> data = RandomData(size);
+  ASSERT_OK(this->WriteDummyFile(path, data.data(), size));
+
+  HdfsConnectionConfig conf = this->conf_;
+  conf.zero_copy_reads = true;
+  std::shared_ptr<HadoopFileSystem> client;
+  ASSERT_OK(HadoopFileSystem::Connect(&conf, &client));
+
+  std::shared_ptr<HdfsReadableFile> file;
+  ASSERT_OK(client->OpenReadable(path, &file));
+  // Only libhdfs provides zero-copy reads
+  ASSERT_EQ(file->supports_zero_copy(), TypeParam::type == HdfsDriver::LIBHDFS);
+
+  // Whether or not the data is mapped, reads return the right bytes
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->Read(1000));
+  ASSERT_EQ(buffer->size(), 1000);
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data.data(), 1000));
+
+  ASSERT_OK_AND_ASSIGN(auto buffer2, file->ReadAt(size - 500, 1000));
+  ASSERT_EQ(buffer2->size(), 500);
+  ASSERT_EQ(0, std::memcmp(buffer2->data(), data.data() + size - 500, 500));
+  ASSERT_OK_AND_EQ(1000, file->Tell());
+
+  // Buffers stay valid after the file is closed
+  ASSERT_OK(file->Close());
+  ASSERT_TRUE(file->closed());
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data.data(), 1000));
+  buffer.reset();
+  buffer2.reset();
+
+  ASSERT_OK(client->Disconnect());
+}
+
 TYPED_TEST(TestHadoopFileSystem, LargeFile) {
   SKIP_IF_NO_DRIVER();
 
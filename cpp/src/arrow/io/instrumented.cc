@@ -0,0 +1,351 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/instrumented.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace io {
+
+constexpr int IOMethodStats::kNumLatencyBuckets;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+int64_t NanosSince(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+      .count();
+}
+
+int LatencyBucket(int64_t nanos) {
+  const int64_t micros = nanos / 1000;
+  if (micros <= 0) {
+    return 0;
+  }
+  // micros in [2^(i-1), 2^i) => bucket i
+  const int bucket = 64 - BitUtil::CountLeadingZeros(static_cast<uint64_t>(micros));
+  return std::min(bucket, IOMethodStats::kNumLatencyBuckets - 1);
+}
+
+// Time a call and record it to the collector.  `bytes` extracts the number of
+// bytes transferred from a successful result.
+template <typename T, typename Call, typename Bytes>
+Result<T> Timed(IOStatsCollector* collector, IOStatsCollector::Method method,
+                Call&& call, Bytes&& bytes) {
+  const auto start = Clock::now();
+  Result<T> result = call();
+  const int64_t nanos = NanosSince(start);
+  collector->RecordCall(method, result.ok() ? bytes(*result) : 0, nanos);
+  return result;
+}
+
+template <typename Call>
+Status TimedStatus(IOStatsCollector* collector, IOStatsCollector::Method method,
+                   int64_t nbytes, Call&& call) {
+  const auto start = Clock::now();
+  Status st = call();
+  const int64_t nanos = NanosSince(start);
+  collector->RecordCall(method, st.ok() ? nbytes : 0, nanos);
+  return st;
+}
+
+int64_t BufferSize(const std::shared_ptr<Buffer>& buffer) { return buffer->size(); }
+
+int64_t Identity(int64_t nbytes) { return nbytes; }
+
+void AppendMethod(std::ostream& os, const char* name, const IOMethodStats& stats) {
+  os << name << ": " << stats.calls << " calls, " << stats.bytes << " bytes, "
+     << stats.total_nanos / 1000 << " us";
+  if (stats.calls > 0) {
+    os << " (" << stats.total_nanos / stats.calls / 1000 << " us avg)";
+  }
+  os << "\n";
+}
+
+}  // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// IOStats implementation
+
+void IOMethodStats::Merge(const IOMethodStats& other) {
+  calls += other.calls;
+  bytes += other.bytes;
+  total_nanos += other.total_nanos;
+  for (int i = 0; i < kNumLatencyBuckets; ++i) {
+    latency_histogram[i] += other.latency_histogram[i];
+  }
+}
+
+void IOStats::Merge(const IOStats& other) {
+  read.Merge(other.read);
+  read_at.Merge(other.read_at);
+  seek.Merge(other.seek);
+  write.Merge(other.write);
+  sequential_reads += other.sequential_reads;
+  random_reads += other.random_reads;
+}
+
+std::string IOStats::ToString() const {
+  std::stringstream ss;
+  AppendMethod(ss, "Read", read);
+  AppendMethod(ss, "ReadAt", read_at);
+  AppendMethod(ss, "Seek", seek);
+  AppendMethod(ss, "Write", write);
+  ss << "Sequential reads: " << sequential_reads << ", random reads: " << random_reads;
+  return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// IOStatsCollector implementation
+
+struct IOStatsCollector::MethodCounters {
+  std::atomic<int64_t> calls{0};
+  std::atomic<int64_t> bytes{0};
+  std::atomic<int64_t> total_nanos{0};
+  std::atomic<int64_t> latency_histogram[IOMethodStats::kNumLatencyBuckets];
+
+  MethodCounters() { Reset(); }
+
+  void Reset() {
+    calls.store(0);
+    bytes.store(0);
+    total_nanos.store(0);
+    for (auto& bucket : latency_histogram) {
+      bucket.store(0);
+    }
+  }
+
+  void Snapshot(IOMethodStats* out) const {
+    out->calls = calls.load();
+    out->bytes = bytes.load();
+    out->total_nanos = total_nanos.load();
+    for (int i = 0; i < IOMethodStats::kNumLatencyBuckets; ++i) {
+      out->latency_histogram[i] = latency_histogram[i].load();
+    }
+  }
+};
+
+IOStatsCollector::IOStatsCollector()
+    : methods_(new MethodCounters[4]), sequential_reads_(0), random_reads_(0) {}
+
+IOStatsCollector::~IOStatsCollector() {}
+
+IOStats IOStatsCollector::stats() const {
+  IOStats stats;
+  methods_[READ].Snapshot(&stats.read);
+  methods_[READ_AT].Snapshot(&stats.read_at);
+  methods_[SEEK].Snapshot(&stats.seek);
+  methods_[WRITE].Snapshot(&stats.write);
+  stats.sequential_reads = sequential_reads_.load();
+  stats.random_reads = random_reads_.load();
+  return stats;
+}
+
+void IOStatsCollector::Reset() {
+  for (int i = 0; i < 4; ++i) {
+    methods_[i].Reset();
+  }
+  sequential_reads_.store(0);
+  random_reads_.store(0);
+}
+
+void IOStatsCollector::RecordCall(Method method, int64_t bytes, int64_t nanos) {
+  auto& counters = methods_[method];
+  counters.calls.fetch_add(1, std::memory_order_relaxed);
+  counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+  counters.total_nanos.fetch_add(nanos, std::memory_order_relaxed);
+  counters.latency_histogram[LatencyBucket(nanos)].fetch_add(1,
+                                                             std::memory_order_relaxed);
+}
+
+void IOStatsCollector::RecordRead(bool sequential) {
+  auto& counter = sequential ? sequential_reads_ : random_reads_;
+  counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// InstrumentedInputStream implementation
+
+InstrumentedInputStream::InstrumentedInputStream(
+    std::shared_ptr<InputStream> stream, std::shared_ptr<IOStatsCollector> collector)
+    : stream_(std::move(stream)), collector_(std::move(collector)) {}
+
+InstrumentedInputStream::~InstrumentedInputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status InstrumentedInputStream::Close() { return stream_->Close(); }
+
+Status InstrumentedInputStream::Abort() { return stream_->Abort(); }
+
+bool InstrumentedInputStream::closed() const { return stream_->closed(); }
+
+Result<int64_t> InstrumentedInputStream::Read(int64_t nbytes, void* out) {
+  ARROW_ASSIGN_OR_RAISE(auto bytes_read,
+                        Timed<int64_t>(
+                            collector_.get(), IOStatsCollector::READ,
+                            [&]() { return stream_->Read(nbytes, out); }, Identity));
+  // A stream without random access only ever reads sequentially
+  collector_->RecordRead(/*sequential=*/true);
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> InstrumentedInputStream::Read(int64_t nbytes) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto buffer, Timed<std::shared_ptr<Buffer>>(
+                       collector_.get(), IOStatsCollector::READ,
+                       [&]() { return stream_->Read(nbytes); }, BufferSize));
+  collector_->RecordRead(/*sequential=*/true);
+  return buffer;
+}
+
+Result<util::string_view> InstrumentedInputStream::Peek(int64_t nbytes) {
+  return stream_->Peek(nbytes);
+}
+
+bool InstrumentedInputStream::supports_zero_copy() const {
+  return stream_->supports_zero_copy();
+}
+
+Result<int64_t> InstrumentedInputStream::Tell() const { return stream_->Tell(); }
+
+//////////////////////////////////////////////////////////////////////////
+// InstrumentedRandomAccessFile implementation
+
+InstrumentedRandomAccessFile::InstrumentedRandomAccessFile(
+    std::shared_ptr<RandomAccessFile> file, std::shared_ptr<IOStatsCollector> collector)
+    : file_(std::move(file)),
+      collector_(std::move(collector)),
+      position_(0),
+      last_read_end_(0) {}
+
+InstrumentedRandomAccessFile::~InstrumentedRandomAccessFile() {
+  internal::CloseFromDestructor(this);
+}
+
+Status InstrumentedRandomAccessFile::Close() { return file_->Close(); }
+
+Status InstrumentedRandomAccessFile::Abort() { return file_->Abort(); }
+
+bool InstrumentedRandomAccessFile::closed() const { return file_->closed(); }
+
+Result<int64_t> InstrumentedRandomAccessFile::Read(int64_t nbytes, void* out) {
+  ARROW_ASSIGN_OR_RAISE(auto bytes_read,
+                        Timed<int64_t>(
+                            collector_.get(), IOStatsCollector::READ,
+                            [&]() { return file_->Read(nbytes, out); }, Identity));
+  const int64_t start = position_.fetch_add(bytes_read);
+  collector_->RecordRead(last_read_end_.exchange(start + bytes_read) == start);
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> InstrumentedRandomAccessFile::Read(int64_t nbytes) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto buffer, Timed<std::shared_ptr<Buffer>>(
+                       collector_.get(), IOStatsCollector::READ,
+                       [&]() { return file_->Read(nbytes); }, BufferSize));
+  const int64_t start = position_.fetch_add(buffer->size());
+  collector_->RecordRead(last_read_end_.exchange(start + buffer->size()) == start);
+  return buffer;
+}
+
+Result<int64_t> InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                                     void* out) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto bytes_read,
+      Timed<int64_t>(
+          collector_.get(), IOStatsCollector::READ_AT,
+          [&]() { return file_->ReadAt(position, nbytes, out); }, Identity));
+  collector_->RecordRead(last_read_end_.exchange(position + bytes_read) == position);
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> InstrumentedRandomAccessFile::ReadAt(int64_t position,
+                                                                     int64_t nbytes) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto buffer,
+      Timed<std::shared_ptr<Buffer>>(
+          collector_.get(), IOStatsCollector::READ_AT,
+          [&]() { return file_->ReadAt(position, nbytes); }, BufferSize));
+  collector_->RecordRead(last_read_end_.exchange(position + buffer->size()) ==
+                         position);
+  return buffer;
+}
+
+Result<util::string_view> InstrumentedRandomAccessFile::Peek(int64_t nbytes) {
+  return file_->Peek(nbytes);
+}
+
+bool InstrumentedRandomAccessFile::supports_zero_copy() const {
+  return file_->supports_zero_copy();
+}
+
+Result<int64_t> InstrumentedRandomAccessFile::GetSize() { return file_->GetSize(); }
+
+Status InstrumentedRandomAccessFile::Seek(int64_t position) {
+  RETURN_NOT_OK(TimedStatus(collector_.get(), IOStatsCollector::SEEK, /*nbytes=*/0,
+                            [&]() { return file_->Seek(position); }));
+  position_.store(position);
+  return Status::OK();
+}
+
+Result<int64_t> InstrumentedRandomAccessFile::Tell() const { return file_->Tell(); }
+
+//////////////////////////////////////////////////////////////////////////
+// InstrumentedOutputStream implementation
+
+InstrumentedOutputStream::InstrumentedOutputStream(
+    std::shared_ptr<OutputStream> stream, std::shared_ptr<IOStatsCollector> collector)
+    : stream_(std::move(stream)), collector_(std::move(collector)) {}
+
+InstrumentedOutputStream::~InstrumentedOutputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status InstrumentedOutputStream::Close() { return stream_->Close(); }
+
+Status InstrumentedOutputStream::Abort() { return stream_->Abort(); }
+
+bool InstrumentedOutputStream::closed() const { return stream_->closed(); }
+
+Status InstrumentedOutputStream::Write(const void* data, int64_t nbytes) {
+  return TimedStatus(collector_.get(), IOStatsCollector::WRITE, nbytes,
+                     [&]() { return stream_->Write(data, nbytes); });
+}
+
+Status InstrumentedOutputStream::Write(const std::shared_ptr<Buffer>& data) {
+  return TimedStatus(collector_.get(), IOStatsCollector::WRITE, data->size(),
+                     [&]() { return stream_->Write(data); });
+}
+
+Status InstrumentedOutputStream::Flush() { return stream_->Flush(); }
+
+Result<int64_t> InstrumentedOutputStream::Tell() const { return stream_->Tell(); }
+
+}  // namespace io
+}  // namespace arrow
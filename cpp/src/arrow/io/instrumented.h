@@ -0,0 +1,191 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Stream wrappers gathering I/O statistics
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+/// \brief Statistics of the calls to one method of instrumented streams
+struct ARROW_EXPORT IOMethodStats {
+  /// The number of latency histogram buckets
+  static constexpr int kNumLatencyBuckets = 32;
+
+  int64_t calls = 0;
+  /// Bytes read or written
+  int64_t bytes = 0;
+  /// Total time spent in the calls, in nanoseconds
+  int64_t total_nanos = 0;
+
+  /// \brief Histogram of call latencies
+  ///
+  /// Bucket 0 counts calls under one microsecond, bucket i > 0 counts calls
+  /// lasting [2^(i-1), 2^i) microseconds.  The last bucket is open-ended.
+  std::vector<int64_t> latency_histogram = std::vector<int64_t>(kNumLatencyBuckets);
+
+  /// \brief Add the counters of other to these
+  void Merge(const IOMethodStats& other);
+};
+
+/// \brief Statistics gathered by instrumented streams
+struct ARROW_EXPORT IOStats {
+  IOMethodStats read;
+  IOMethodStats read_at;
+  IOMethodStats seek;
+  IOMethodStats write;
+
+  /// Reads (Read or ReadAt) starting where the previous read of the same stream
+  /// ended, and other reads.  The first read of a stream is sequential if it
+  /// starts at offset 0.
+  int64_t sequential_reads = 0;
+  int64_t random_reads = 0;
+
+  /// \brief Add the counters of other to these
+  void Merge(const IOStats& other);
+
+  /// \brief A human-readable summary
+  std::string ToString() const;
+};
+
+/// \brief A thread-safe sink of IOStats, shared by any number of instrumented
+/// streams
+class ARROW_EXPORT IOStatsCollector {
+ public:
+  IOStatsCollector();
+  ~IOStatsCollector();
+
+  /// \brief Return a snapshot of the statistics gathered so far
+  IOStats stats() const;
+
+  /// \brief Reset all counters to zero
+  void Reset();
+
+  /// \cond FALSE
+  enum Method { READ, READ_AT, SEEK, WRITE };
+  void RecordCall(Method method, int64_t bytes, int64_t nanos);
+  void RecordRead(bool sequential);
+  /// \endcond
+
+ private:
+  struct MethodCounters;
+
+  std::unique_ptr<MethodCounters[]> methods_;
+  std::atomic<int64_t> sequential_reads_;
+  std::atomic<int64_t> random_reads_;
+};
+
+/// \brief An InputStream wrapper recording statistics of its calls
+///
+/// Statistics of Read() are recorded to the given collector.  Other calls are
+/// forwarded directly.
+class ARROW_EXPORT InstrumentedInputStream : public InputStream {
+ public:
+  InstrumentedInputStream(std::shared_ptr<InputStream> stream,
+                          std::shared_ptr<IOStatsCollector> collector);
+  ~InstrumentedInputStream() override;
+
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override;
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override;
+  Result<util::string_view> Peek(int64_t nbytes) override;
+  bool supports_zero_copy() const override;
+
+  Result<int64_t> Tell() const override;
+
+ private:
+  std::shared_ptr<InputStream> stream_;
+  std::shared_ptr<IOStatsCollector> collector_;
+};
+
+/// \brief A RandomAccessFile wrapper recording statistics of its calls
+///
+/// Statistics of Read(), ReadAt() and Seek() are recorded to the given
+/// collector.  Other calls are forwarded directly.
+class ARROW_EXPORT InstrumentedRandomAccessFile : public RandomAccessFile {
+ public:
+  InstrumentedRandomAccessFile(std::shared_ptr<RandomAccessFile> file,
+                               std::shared_ptr<IOStatsCollector> collector);
+  ~InstrumentedRandomAccessFile() override;
+
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override;
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override;
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override;
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override;
+  Result<util::string_view> Peek(int64_t nbytes) override;
+  bool supports_zero_copy() const override;
+
+  Result<int64_t> GetSize() override;
+  Status Seek(int64_t position) override;
+  Result<int64_t> Tell() const override;
+
+ private:
+  std::shared_ptr<RandomAccessFile> file_;
+  std::shared_ptr<IOStatsCollector> collector_;
+  // Position of the next Read(), and end of the latest read
+  std::atomic<int64_t> position_;
+  std::atomic<int64_t> last_read_end_;
+};
+
+/// \brief An OutputStream wrapper recording statistics of its calls
+///
+/// Statistics of Write() are recorded to the given collector.  Other calls
+/// are forwarded directly.
+class ARROW_EXPORT InstrumentedOutputStream : public OutputStream {
+ public:
+  InstrumentedOutputStream(std::shared_ptr<OutputStream> stream,
+                           std::shared_ptr<IOStatsCollector> collector);
+  ~InstrumentedOutputStream() override;
+
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  Status Write(const void* data, int64_t nbytes) override;
+  Status Write(const std::shared_ptr<Buffer>& data) override;
+  Status Flush() override;
+
+  Result<int64_t> Tell() const override;
+
+ private:
+  std::shared_ptr<OutputStream> stream_;
+  std::shared_ptr<IOStatsCollector> collector_;
+};
+
+}  // namespace io
+}  // namespace arrow
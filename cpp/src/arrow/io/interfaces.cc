@@ -24,15 +24,18 @@
 #include <sstream>
 #include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/concurrency.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -121,6 +124,26 @@ Result<std::shared_ptr<Buffer>> RandomAccessFile::ReadAt(int64_t position,
   return Read(nbytes);
 }
 
+Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAsync(int64_t position,
+                                                         int64_t nbytes) {
+  auto maybe_future = internal::GetIOThreadPool()->Submit(
+      [this, position, nbytes]() { return ReadAt(position, nbytes); });
+  if (!maybe_future.ok()) {
+    return Future<std::shared_ptr<Buffer>>::MakeFinished(maybe_future.status());
+  }
+  return std::move(maybe_future).ValueOrDie();
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> RandomAccessFile::ReadManyAsync(
+    const std::vector<ReadRange>& ranges) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    futures.push_back(ReadAsync(range.offset, range.length));
+  }
+  return futures;
+}
+
 Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                                 void* out) {
   return ReadAt(position, nbytes, out).Value(bytes_read);
@@ -137,10 +160,67 @@ Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
 
+namespace internal {
+
+namespace {
+
+// Default number of threads for the I/O thread pool.  I/O-bound tasks mostly
+// wait on the kernel or the network, so this is independent of the number
+// of cores.
+constexpr int kDefaultIOThreads = 8;
+
+int DefaultIOThreadPoolCapacity() {
+  auto maybe_env_var = ::arrow::internal::GetEnvVar("ARROW_IO_THREADS");
+  if (maybe_env_var.ok()) {
+    try {
+      int threads = std::stoi(*maybe_env_var);
+      if (threads > 0) {
+        return threads;
+      }
+    } catch (...) {
+    }
+    ARROW_LOG(WARNING) << "ARROW_IO_THREADS does not contain a valid number of threads";
+  }
+  return kDefaultIOThreads;
+}
+
+std::shared_ptr<::arrow::internal::ThreadPool> MakeIOThreadPool() {
+  auto pool =
+      ::arrow::internal::ThreadPool::MakeEternal(DefaultIOThreadPoolCapacity());
+  if (!pool.ok()) {
+    pool.status().Abort("Failed to create global IO thread pool");
+  }
+  return *std::move(pool);
+}
+
+}  // namespace
+
+::arrow::internal::ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<::arrow::internal::ThreadPool> pool = MakeIOThreadPool();
+  return pool.get();
+}
+
+}  // namespace internal
+
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 Status Writable::Write(const std::shared_ptr<Buffer>& data) {
   return Write(data->data(), data->size());
 }
 
+Status Writable::Write(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  for (const auto& buffer : buffers) {
+    if (buffer) {
+      RETURN_NOT_OK(Write(buffer));
+    }
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 class FileSegmentReader
@@ -255,6 +335,43 @@ Status ValidateRegion(int64_t offset, int64_t size) {
   return Status::OK();
 }
 
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit) {
+  DCHECK_GT(range_size_limit, hole_size_limit);
+
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                              [](const ReadRange& range) { return range.length == 0; }),
+               ranges.end());
+  if (ranges.empty()) {
+    return ranges;
+  }
+  std::sort(ranges.begin(), ranges.end(), [](const ReadRange& a, const ReadRange& b) {
+    return a.offset < b.offset;
+  });
+
+  std::vector<ReadRange> coalesced;
+  int64_t coalesced_start = ranges[0].offset;
+  int64_t coalesced_end = ranges[0].offset + ranges[0].length;
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    const int64_t range_start = ranges[i].offset;
+    const int64_t range_end = range_start + ranges[i].length;
+    // Overlapping ranges have a negative hole and are always merged
+    const bool merge = range_start - coalesced_end <= hole_size_limit &&
+                       (range_end - coalesced_start <= range_size_limit ||
+                        range_start < coalesced_end);
+    if (merge) {
+      coalesced_end = std::max(coalesced_end, range_end);
+    } else {
+      coalesced.push_back({coalesced_start, coalesced_end - coalesced_start});
+      coalesced_start = range_start;
+      coalesced_end = range_end;
+    }
+  }
+  coalesced.push_back({coalesced_start, coalesced_end - coalesced_start});
+  return coalesced;
+}
+
 #ifndef NDEBUG
 
 // Debug mode concurrency checking
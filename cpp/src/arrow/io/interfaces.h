@@ -24,6 +24,7 @@
 
 #include "arrow/io/type_fwd.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/visibility.h"
@@ -31,6 +32,39 @@
 namespace arrow {
 namespace io {
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks, such as asynchronous reads.
+/// This is an ideal number, not necessarily the exact number of threads
+/// at a given point in time.
+///
+/// You can change this number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks.  Unlike the CPU thread pool,
+/// it is reasonable to set this number higher than the number of cores,
+/// since its tasks spend most of their time waiting.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
+/// \brief A contiguous byte range in a file
+struct ReadRange {
+  int64_t offset;
+  int64_t length;
+
+  friend bool operator==(const ReadRange& left, const ReadRange& right) {
+    return left.offset == right.offset && left.length == right.length;
+  }
+  friend bool operator!=(const ReadRange& left, const ReadRange& right) {
+    return !(left == right);
+  }
+};
+
 /// DEPRECATED.  Use the FileSystem API in arrow::fs instead.
 struct ObjectType {
   enum type { FILE, DIRECTORY };
@@ -129,6 +163,13 @@ class ARROW_EXPORT Writable {
   /// buffering is required.  See Write(const void*, int64_t) for details.
   virtual Status Write(const std::shared_ptr<Buffer>& data);
 
+  /// \brief Write the given buffers to the stream, one after another
+  ///
+  /// Null buffers are skipped.  The default implementation writes each
+  /// buffer in turn, but subclasses may override it with a more efficient
+  /// implementation, such as a single gathered write.
+  virtual Status Write(const std::vector<std::shared_ptr<Buffer>>& buffers);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -245,6 +286,31 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   /// \return A buffer containing the bytes read, or an error
   virtual Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes);
 
+  /// \brief Read data asynchronously from given file position.
+  ///
+  /// The returned future yields the same result as ReadAt(position, nbytes).
+  /// The file must be kept alive until the future is satisfied.
+  ///
+  /// The default RandomAccessFile-provided implementation runs ReadAt() on
+  /// the global I/O thread pool (see GetIOThreadPoolCapacity()), but
+  /// subclasses may override it with a more efficient implementation.
+  ///
+  /// \param[in] position Where to read bytes from
+  /// \param[in] nbytes The number of bytes to read
+  /// \return A future of the buffer containing the bytes read, or an error
+  virtual Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes);
+
+  /// \brief Read several ranges asynchronously
+  ///
+  /// The returned futures yield the same results as ReadAsync() for each range.
+  /// The default implementation calls ReadAsync() for each range, but
+  /// subclasses may submit the reads together.
+  ///
+  /// \param[in] ranges The ranges to read
+  /// \return A future of the buffer for each range, in the same order
+  virtual std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const std::vector<ReadRange>& ranges);
+
   // Deprecated APIs
 
   ARROW_DEPRECATED("Use Result-returning overload")
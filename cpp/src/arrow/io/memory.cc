@@ -330,6 +330,11 @@ Result<std::shared_ptr<Buffer>> BufferReader::DoReadAt(int64_t position, int64_t
   }
 }
 
+Future<std::shared_ptr<Buffer>> BufferReader::ReadAsync(int64_t position,
+                                                                     int64_t nbytes) {
+  return Future<std::shared_ptr<Buffer>>::MakeFinished(ReadAt(position, nbytes));
+}
+
 Result<int64_t> BufferReader::DoRead(int64_t nbytes, void* out) {
   RETURN_NOT_OK(CheckClosed());
   ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
@@ -163,6 +163,11 @@ class ARROW_EXPORT BufferReader
 
   bool supports_zero_copy() const override;
 
+  /// \brief Read asynchronously
+  ///
+  /// Reads are zero-copy, so the returned future is always satisfied immediately.
+  Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes) override;
+
   std::shared_ptr<Buffer> buffer() const { return buffer_; }
 
  protected:
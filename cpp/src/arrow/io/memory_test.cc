@@ -21,13 +21,18 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/buffer.h"
+#include "arrow/io/caching.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/slow.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -208,6 +213,22 @@ TEST(TestBufferReader, InvalidReads) {
   ASSERT_RAISES(Invalid, reader.ReadAt(1, -1, buffer));
 }
 
+TEST(TestBufferReader, ReadAsync) {
+  std::string data = "data123456";
+  BufferReader reader(std::make_shared<Buffer>(data));
+
+  auto fut1 = reader.ReadAsync(2, 6);
+  auto fut2 = reader.ReadAsync(1, 4);
+  ASSERT_TRUE(fut1.is_finished());
+  ASSERT_OK_AND_ASSIGN(auto buf, fut1.result());
+  AssertBufferEqual(*buf, "ta1234");
+  ASSERT_OK_AND_ASSIGN(buf, fut2.result());
+  AssertBufferEqual(*buf, "ata1");
+
+  ASSERT_RAISES(Invalid, reader.ReadAsync(-1, 1).result());
+  ASSERT_RAISES(Invalid, reader.ReadAsync(1, -1).result());
+}
+
 TEST(TestBufferReader, RetainParentReference) {
   // ARROW-387
   std::string data = "data123456";
@@ -284,6 +305,35 @@ TEST(TestRandomAccessFile, GetStream) {
   ASSERT_RAISES(IOError, stream1->Read(1, buf3));
 }
 
+TEST(TestRandomAccessFile, ReadAsync) {
+  // SlowRandomAccessFile doesn't override ReadAsync(), so this exercises
+  // the default implementation on the I/O thread pool
+  std::string data = "data1data2data3data4data5";
+  auto file = std::make_shared<SlowRandomAccessFile>(
+      std::make_shared<BufferReader>(std::make_shared<Buffer>(data)), 0.001);
+
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  for (int64_t i = 0; i < 5; ++i) {
+    futures.push_back(file->ReadAsync(i * 5, 5));
+  }
+  futures.push_back(file->ReadAsync(20, 10));
+  for (int64_t i = 0; i < 5; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, futures[i].result());
+    AssertBufferEqual(*buf, data.substr(i * 5, 5));
+  }
+  ASSERT_OK_AND_ASSIGN(auto buf, futures[5].result());
+  AssertBufferEqual(*buf, "data5");
+}
+
+TEST(TestIOThreadPool, Capacity) {
+  const int capacity = GetIOThreadPoolCapacity();
+  ASSERT_GT(capacity, 0);
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity + 2));
+  ASSERT_EQ(capacity + 2, GetIOThreadPoolCapacity());
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+  ASSERT_EQ(capacity, GetIOThreadPoolCapacity());
+}
+
 TEST(TestMemcopy, ParallelMemcopy) {
 #if defined(ARROW_VALGRIND)
   // Compensate for Valgrind's slowness
@@ -348,6 +398,96 @@ TEST(TestSlowInputStream, Basics) { TestSlowInputStream<SlowInputStream>(); }
 
 TEST(TestSlowRandomAccessFile, Basics) { TestSlowInputStream<SlowRandomAccessFile>(); }
 
+TEST(TestInstrumentedInputStream, Basics) {
+  auto stream = std::make_shared<BufferReader>(util::string_view("abcdefghijkl"));
+  auto collector = std::make_shared<IOStatsCollector>();
+  auto instrumented = std::make_shared<InstrumentedInputStream>(stream, collector);
+
+  ASSERT_OK_AND_ASSIGN(auto buf, instrumented->Read(6));
+  AssertBufferEqual(*buf, "abcdef");
+  char out[10];
+  ASSERT_OK_AND_ASSIGN(int64_t bytes_read, instrumented->Read(10, out));
+  ASSERT_EQ(bytes_read, 6);
+
+  auto stats = collector->stats();
+  ASSERT_EQ(stats.read.calls, 2);
+  ASSERT_EQ(stats.read.bytes, 12);
+  ASSERT_EQ(stats.read_at.calls, 0);
+  ASSERT_EQ(stats.sequential_reads, 2);
+  ASSERT_EQ(stats.random_reads, 0);
+  int64_t histogram_total = 0;
+  for (int64_t count : stats.read.latency_histogram) {
+    histogram_total += count;
+  }
+  ASSERT_EQ(histogram_total, 2);
+
+  ASSERT_OK(instrumented->Close());
+  ASSERT_TRUE(stream->closed());
+  // Failed calls are counted but transfer no bytes
+  ASSERT_RAISES(Invalid, instrumented->Read(1));
+  stats = collector->stats();
+  ASSERT_EQ(stats.read.calls, 3);
+  ASSERT_EQ(stats.read.bytes, 12);
+  ASSERT_EQ(stats.sequential_reads, 2);
+}
+
+TEST(TestInstrumentedRandomAccessFile, AccessPattern) {
+  auto file = std::make_shared<BufferReader>(util::string_view("abcdefghijkl"));
+  auto collector = std::make_shared<IOStatsCollector>();
+  InstrumentedRandomAccessFile instrumented(file, collector);
+
+  ASSERT_OK_AND_ASSIGN(auto buf, instrumented.ReadAt(0, 4));  // sequential
+  AssertBufferEqual(*buf, "abcd");
+  ASSERT_OK_AND_ASSIGN(buf, instrumented.ReadAt(4, 2));  // sequential
+  AssertBufferEqual(*buf, "ef");
+  ASSERT_OK_AND_ASSIGN(buf, instrumented.ReadAt(10, 2));  // random
+  AssertBufferEqual(*buf, "kl");
+  ASSERT_OK(instrumented.Seek(2));
+  ASSERT_OK_AND_ASSIGN(buf, instrumented.Read(3));  // random
+  AssertBufferEqual(*buf, "cde");
+  ASSERT_OK_AND_ASSIGN(buf, instrumented.Read(3));  // sequential
+  AssertBufferEqual(*buf, "fgh");
+
+  auto stats = collector->stats();
+  ASSERT_EQ(stats.read_at.calls, 3);
+  ASSERT_EQ(stats.read_at.bytes, 8);
+  ASSERT_EQ(stats.read.calls, 2);
+  ASSERT_EQ(stats.read.bytes, 6);
+  ASSERT_EQ(stats.seek.calls, 1);
+  ASSERT_EQ(stats.seek.bytes, 0);
+  ASSERT_EQ(stats.sequential_reads, 3);
+  ASSERT_EQ(stats.random_reads, 2);
+
+  IOStats merged;
+  merged.Merge(stats);
+  merged.Merge(stats);
+  ASSERT_EQ(merged.read_at.calls, 6);
+  ASSERT_EQ(merged.random_reads, 4);
+  ASSERT_NE(merged.ToString().find("ReadAt: 6 calls, 16 bytes"), std::string::npos);
+
+  collector->Reset();
+  stats = collector->stats();
+  ASSERT_EQ(stats.read_at.calls, 0);
+  ASSERT_EQ(stats.sequential_reads, 0);
+}
+
+TEST(TestInstrumentedOutputStream, Basics) {
+  ASSERT_OK_AND_ASSIGN(auto sink, BufferOutputStream::Create());
+  auto collector = std::make_shared<IOStatsCollector>();
+  InstrumentedOutputStream instrumented(sink, collector);
+
+  ASSERT_OK(instrumented.Write("abc", 3));
+  ASSERT_OK(instrumented.Write(Buffer::FromString("defgh")));
+  ASSERT_OK_AND_EQ(8, instrumented.Tell());
+  ASSERT_OK(instrumented.Close());
+  ASSERT_TRUE(sink->closed());
+
+  auto stats = collector->stats();
+  ASSERT_EQ(stats.write.calls, 2);
+  ASSERT_EQ(stats.write.bytes, 8);
+  ASSERT_EQ(stats.read.calls, 0);
+}
+
 TEST(TestInputStreamIterator, Basics) {
   auto reader = std::make_shared<BufferReader>(Buffer::FromString("data123456"));
   ASSERT_OK_AND_ASSIGN(auto it, MakeInputStreamIterator(reader, /*block_size=*/3));
@@ -380,5 +520,80 @@ TEST(TestInputStreamIterator, Closed) {
   ASSERT_RAISES(Invalid, it.Next().status());
 }
 
+TEST(CoalesceReadRanges, Basics) {
+  auto check = [](std::vector<ReadRange> ranges,
+                  std::vector<ReadRange> expected) -> void {
+    const int64_t hole_size_limit = 9;
+    const int64_t range_size_limit = 99;
+    auto coalesced =
+        internal::CoalesceReadRanges(ranges, hole_size_limit, range_size_limit);
+    ASSERT_EQ(coalesced, expected);
+  };
+
+  check({}, {});
+  // Zero sized range that ends up in empty list
+  check({{110, 0}}, {});
+  // Combination on 1 zero sized range and 1 non-zero sized range
+  check({{110, 10}, {120, 0}}, {{110, 10}});
+  // 1 non-zero sized range
+  check({{110, 10}}, {{110, 10}});
+  // No holes + unordered ranges
+  check({{130, 10}, {110, 10}, {120, 10}}, {{110, 30}});
+  // No holes
+  check({{110, 10}, {120, 10}, {130, 10}}, {{110, 30}});
+  // Small holes only
+  check({{110, 11}, {130, 0}, {130, 11}, {145, 0}, {150, 11}, {200, 0}}, {{110, 51}});
+  // Large holes
+  check({{110, 10}, {130, 10}}, {{110, 10}, {130, 10}});
+  check({{110, 11}, {130, 11}, {150, 10}, {170, 11}, {190, 11}}, {{110, 50}, {170, 31}});
+  // With zero-sized ranges
+  check({{110, 11}, {130, 0}, {130, 11}, {145, 0}, {150, 11}, {200, 0}, {200, 0}},
+        {{110, 51}});
+  // Overlapping ranges are merged
+  check({{110, 20}, {115, 5}, {125, 10}}, {{110, 25}});
+  // No holes but large ranges
+  check({{110, 100}, {210, 100}}, {{110, 100}, {210, 100}});
+  // Small holes and large range in the middle (*)
+  check({{110, 10}, {120, 11}, {140, 100}, {240, 11}, {260, 11}},
+        {{110, 21}, {140, 100}, {240, 31}});
+}
+
+TEST(RangeReadCache, Basics) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<BufferReader>(Buffer::FromString(std::move(data)));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  internal::ReadRangeCache cache(file, options);
+
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}, {25, 0}}));
+  ASSERT_OK(cache.Cache({{10, 4}, {14, 0}, {15, 4}}));
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({20, 2}));
+  AssertBufferEqual(*buf, "uv");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({10, 4}));
+  AssertBufferEqual(*buf, "klmn");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({15, 4}));
+  AssertBufferEqual(*buf, "pqrs");
+  // Zero-sized
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({14, 0}));
+  AssertBufferEqual(*buf, "");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({25, 0}));
+  AssertBufferEqual(*buf, "");
+
+  // Non-cached ranges
+  ASSERT_RAISES(Invalid, cache.Read({20, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({19, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({0, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({25, 2}));
+}
+
 }  // namespace io
 }  // namespace arrow
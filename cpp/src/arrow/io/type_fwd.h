@@ -24,6 +24,12 @@ struct FileMode {
   enum type { READ, WRITE, READWRITE };
 };
 
+/// \brief How a file region is going to be accessed, as a hint to the
+/// operating system
+struct AccessAdvice {
+  enum type { NORMAL, SEQUENTIAL, RANDOM, WILL_NEED, DONT_NEED };
+};
+
 class FileInterface;
 class Seekable;
 class Writable;
@@ -0,0 +1,610 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#ifdef ARROW_WITH_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+#ifdef ARROW_WITH_IO_URING
+
+namespace {
+
+// Number of submission queue entries.  The kernel sizes the completion queue
+// at twice this, which bounds the number of reads in flight.
+constexpr unsigned kRingEntries = 256;
+
+// Registered buffers: reads of up to kSlotSize bytes land in one of them
+constexpr int kNumSlots = 32;
+constexpr int64_t kSlotSize = 128 * 1024;
+
+// Largest length of a single read operation, longer reads are resubmitted
+constexpr int64_t kMaxReadLength = 1 << 30;
+
+int RingSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int RingEnter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete,
+                                  flags, nullptr, 0));
+}
+
+int RingRegister(int ring_fd, unsigned opcode, const void* arg, unsigned nr_args) {
+  return static_cast<int>(syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+// The ring indices are shared with the kernel
+unsigned LoadAcquire(const unsigned* p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+
+void StoreRelease(unsigned* p, unsigned value) {
+  __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+Future<std::shared_ptr<Buffer>> ReadOnThreadPool(int fd, ReadRange range,
+                                                 MemoryPool* pool) {
+  auto maybe_future = GetIOThreadPool()->Submit(
+      [fd, range, pool]() -> Result<std::shared_ptr<Buffer>> {
+        std::shared_ptr<ResizableBuffer> buffer;
+        RETURN_NOT_OK(AllocateResizableBuffer(pool, range.length, &buffer));
+        ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                              ::arrow::internal::FileReadAt(fd, buffer->mutable_data(),
+                                                            range.offset, range.length));
+        if (bytes_read < range.length) {
+          RETURN_NOT_OK(buffer->Resize(bytes_read));
+          buffer->ZeroPadding();
+        }
+        return buffer;
+      });
+  if (!maybe_future.ok()) {
+    return Future<std::shared_ptr<Buffer>>::MakeFinished(maybe_future.status());
+  }
+  return std::move(maybe_future).ValueOrDie();
+}
+
+// The buffers registered with the ring
+class SlotPool {
+ public:
+  SlotPool(uint8_t* data, int num_slots) : data_(data), num_slots_(num_slots) {
+    for (int slot = num_slots - 1; slot >= 0; --slot) {
+      free_slots_.push_back(slot);
+    }
+  }
+
+  ~SlotPool() { munmap(data_, num_slots_ * kSlotSize); }
+
+  // Return a free slot, or -1 if all are in use
+  int Acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_slots_.empty()) {
+      return -1;
+    }
+    int slot = free_slots_.back();
+    free_slots_.pop_back();
+    return slot;
+  }
+
+  void Release(int slot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_slots_.push_back(slot);
+  }
+
+  uint8_t* slot_data(int slot) const { return data_ + slot * kSlotSize; }
+
+ private:
+  uint8_t* data_;
+  int num_slots_;
+  std::mutex mutex_;
+  std::vector<int> free_slots_;
+};
+
+// A buffer backed by a registered slot, which is released along with the buffer
+class SlotBuffer : public Buffer {
+ public:
+  SlotBuffer(std::shared_ptr<SlotPool> slots, int slot, int64_t size)
+      : Buffer(slots->slot_data(slot), size), slots_(std::move(slots)), slot_(slot) {}
+
+  ~SlotBuffer() override { slots_->Release(slot_); }
+
+ private:
+  std::shared_ptr<SlotPool> slots_;
+  int slot_;
+};
+
+struct Request {
+  Request(int fd, ReadRange range, std::shared_ptr<SlotPool> slots)
+      : future(Future<std::shared_ptr<Buffer>>::Make()),
+        fd(fd),
+        range(range),
+        slots(std::move(slots)) {}
+
+  ~Request() {
+    if (slot >= 0) {
+      slots->Release(slot);
+    }
+  }
+
+  Future<std::shared_ptr<Buffer>> future;
+  int fd;
+  ReadRange range;
+  int64_t bytes_read = 0;
+  uint8_t* data = NULLPTR;
+  // Either a registered slot or a buffer allocated from the pool
+  std::shared_ptr<SlotPool> slots;
+  int slot = -1;
+  std::shared_ptr<ResizableBuffer> buffer;
+  // Must outlive the submission of vectored reads
+  struct iovec iov;
+};
+
+}  // namespace
+
+class IoUring::Impl {
+ public:
+  Impl() { std::memset(&params_, 0, sizeof(params_)); }
+
+  ~Impl() {
+    if (reaper_.joinable()) {
+      {
+        // A no-op without user data stops the reaper
+        std::lock_guard<std::mutex> lock(mutex_);
+        io_uring_sqe* sqe = NextSqeLocked();
+        while (sqe == NULLPTR) {
+          SubmitLocked(NULLPTR, NULLPTR);
+          sqe = NextSqeLocked();
+        }
+        sqe->opcode = IORING_OP_NOP;
+        CommitSqeLocked();
+        SubmitLocked(NULLPTR, NULLPTR);
+      }
+      reaper_.join();
+    }
+    // Registered buffers are released when the ring is closed
+    if (sqes_ != NULLPTR) {
+      munmap(sqes_, params_.sq_entries * sizeof(io_uring_sqe));
+    }
+    if (cq_ring_ != NULLPTR && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != NULLPTR) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    if (ring_fd_ >= 0) {
+      close(ring_fd_);
+    }
+  }
+
+  Status Init() {
+    ring_fd_ = RingSetup(kRingEntries, &params_);
+    if (ring_fd_ < 0) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    sq_ring_size_ = params_.sq_off.array + params_.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params_.cq_off.cqes + params_.cq_entries * sizeof(io_uring_cqe);
+    if (params_.features & IORING_FEAT_SINGLE_MMAP) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    ARROW_ASSIGN_OR_RAISE(sq_ring_, MapRing(sq_ring_size_, IORING_OFF_SQ_RING));
+    if (params_.features & IORING_FEAT_SINGLE_MMAP) {
+      cq_ring_ = sq_ring_;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(cq_ring_, MapRing(cq_ring_size_, IORING_OFF_CQ_RING));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto sqes,
+        MapRing(params_.sq_entries * sizeof(io_uring_sqe), IORING_OFF_SQES));
+    sqes_ = reinterpret_cast<io_uring_sqe*>(sqes);
+
+    sq_head_ = reinterpret_cast<unsigned*>(sq_ring_ + params_.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq_ring_ + params_.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq_ring_ + params_.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq_ring_ + params_.sq_off.array);
+    cq_head_ = reinterpret_cast<unsigned*>(cq_ring_ + params_.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq_ring_ + params_.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq_ring_ + params_.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq_ring_ + params_.cq_off.cqes);
+
+    RegisterSlots();
+    reaper_ = std::thread([this] { ReapLoop(); });
+    return Status::OK();
+  }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadMany(
+      int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures(ranges.size());
+    std::vector<size_t> overflow;
+    std::vector<Request*> failed;
+    Status submit_status;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (size_t i = 0; i < ranges.size(); ++i) {
+        const ReadRange& range = ranges[i];
+        auto st = ValidateRegion(range.offset, range.length);
+        if (st.ok() && range.length == 0) {
+          std::shared_ptr<ResizableBuffer> empty;
+          st = AllocateResizableBuffer(pool, 0, &empty);
+          if (st.ok()) {
+            futures[i] = Future<std::shared_ptr<Buffer>>::MakeFinished(
+                std::shared_ptr<Buffer>(std::move(empty)));
+            continue;
+          }
+        }
+        if (!st.ok()) {
+          futures[i] = Future<std::shared_ptr<Buffer>>::MakeFinished(st);
+          continue;
+        }
+        if (in_flight_ >= params_.cq_entries) {
+          overflow.push_back(i);
+          continue;
+        }
+        if (NextSqeLocked() == NULLPTR) {
+          SubmitLocked(&failed, &submit_status);
+          if (NextSqeLocked() == NULLPTR) {
+            overflow.push_back(i);
+            continue;
+          }
+        }
+        std::unique_ptr<Request> request(new Request(fd, range, slots_));
+        st = AllocateDestination(request.get(), pool);
+        if (!st.ok()) {
+          futures[i] = Future<std::shared_ptr<Buffer>>::MakeFinished(st);
+          continue;
+        }
+        futures[i] = request->future;
+        PrepareReadLocked(request.release());
+        ++in_flight_;
+      }
+      SubmitLocked(&failed, &submit_status);
+    }
+    for (Request* request : failed) {
+      Finish(request, submit_status);
+    }
+    for (size_t i : overflow) {
+      futures[i] = ReadOnThreadPool(fd, ranges[i], pool);
+    }
+    return futures;
+  }
+
+ private:
+  Result<uint8_t*> MapRing(size_t size, uint64_t offset) {
+    void* ptr = mmap(NULLPTR, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     ring_fd_, static_cast<off_t>(offset));
+    if (ptr == MAP_FAILED) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to map io_uring");
+    }
+    return static_cast<uint8_t*>(ptr);
+  }
+
+  // Registering buffers pins them in memory, which may exceed RLIMIT_MEMLOCK:
+  // all reads then land in pool-allocated buffers.
+  void RegisterSlots() {
+    void* data = mmap(NULLPTR, kNumSlots * kSlotSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+      return;
+    }
+    auto slots = std::make_shared<SlotPool>(static_cast<uint8_t*>(data), kNumSlots);
+    std::vector<struct iovec> iovecs(kNumSlots);
+    for (int slot = 0; slot < kNumSlots; ++slot) {
+      iovecs[slot].iov_base = slots->slot_data(slot);
+      iovecs[slot].iov_len = static_cast<size_t>(kSlotSize);
+    }
+    if (RingRegister(ring_fd_, IORING_REGISTER_BUFFERS, iovecs.data(), kNumSlots) == 0) {
+      slots_ = std::move(slots);
+    }
+  }
+
+  Status AllocateDestination(Request* request, MemoryPool* pool) {
+    if (slots_ && request->range.length <= kSlotSize) {
+      request->slot = slots_->Acquire();
+      if (request->slot >= 0) {
+        request->data = slots_->slot_data(request->slot);
+        return Status::OK();
+      }
+    }
+    RETURN_NOT_OK(AllocateResizableBuffer(pool, request->range.length, &request->buffer));
+    request->data = request->buffer->mutable_data();
+    return Status::OK();
+  }
+
+  // Return the next free submission queue entry, or null if the queue is full
+  io_uring_sqe* NextSqeLocked() {
+    unsigned tail = *sq_tail_;
+    if (tail - LoadAcquire(sq_head_) >= params_.sq_entries) {
+      return NULLPTR;
+    }
+    io_uring_sqe* sqe = &sqes_[tail & sq_mask_];
+    std::memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+  }
+
+  void CommitSqeLocked() {
+    unsigned tail = *sq_tail_;
+    sq_array_[tail & sq_mask_] = tail & sq_mask_;
+    StoreRelease(sq_tail_, tail + 1);
+    ++to_submit_;
+  }
+
+  // Queue a read of the remainder of the request, in a free entry
+  void PrepareReadLocked(Request* request) {
+    io_uring_sqe* sqe = NextSqeLocked();
+    DCHECK_NE(sqe, NULLPTR);
+    int64_t length =
+        std::min(request->range.length - request->bytes_read, kMaxReadLength);
+    uint8_t* data = request->data + request->bytes_read;
+    sqe->fd = request->fd;
+    sqe->off = static_cast<uint64_t>(request->range.offset + request->bytes_read);
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+    if (request->slot >= 0) {
+      sqe->opcode = IORING_OP_READ_FIXED;
+      sqe->addr = reinterpret_cast<uint64_t>(data);
+      sqe->len = static_cast<uint32_t>(length);
+      sqe->buf_index = static_cast<uint16_t>(request->slot);
+    } else {
+      request->iov.iov_base = data;
+      request->iov.iov_len = static_cast<size_t>(length);
+      sqe->opcode = IORING_OP_READV;
+      sqe->addr = reinterpret_cast<uint64_t>(&request->iov);
+      sqe->len = 1;
+    }
+    CommitSqeLocked();
+  }
+
+  // Hand the queued entries to the kernel.  If it is busy, they are retried
+  // once the reaper has made room; on other errors, the queued requests are
+  // taken back and returned in `failed`.
+  void SubmitLocked(std::vector<Request*>* failed, Status* status) {
+    while (to_submit_ > 0) {
+      int ret = RingEnter(ring_fd_, to_submit_, 0, 0);
+      if (ret >= 0) {
+        to_submit_ -= std::min(to_submit_, static_cast<unsigned>(ret));
+        continue;
+      }
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EAGAIN || errno == EBUSY) {
+        return;
+      }
+      Status st = ::arrow::internal::IOErrorFromErrno(errno, "io_uring_enter failed");
+      unsigned head = LoadAcquire(sq_head_);
+      for (unsigned index = head; index != *sq_tail_; ++index) {
+        uint64_t user_data = sqes_[sq_array_[index & sq_mask_]].user_data;
+        if (failed != NULLPTR && user_data != 0) {
+          failed->push_back(reinterpret_cast<Request*>(user_data));
+        }
+      }
+      StoreRelease(sq_tail_, head);
+      to_submit_ = 0;
+      if (status != NULLPTR) {
+        *status = st;
+      }
+    }
+  }
+
+  void ReapLoop() {
+    std::vector<std::pair<Request*, int>> completions;
+    bool stop = false;
+    while (!stop) {
+      if (RingEnter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR &&
+          errno != EAGAIN && errno != EBUSY) {
+        ARROW_LOG(FATAL) << "io_uring_enter failed: " << std::strerror(errno);
+      }
+      unsigned head = *cq_head_;
+      unsigned tail = LoadAcquire(cq_tail_);
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        if (cqe.user_data == 0) {
+          stop = true;
+        } else {
+          completions.emplace_back(reinterpret_cast<Request*>(cqe.user_data), cqe.res);
+        }
+      }
+      StoreRelease(cq_head_, head);
+
+      for (const auto& completion : completions) {
+        Complete(completion.first, completion.second);
+      }
+      completions.clear();
+
+      std::vector<Request*> failed;
+      Status submit_status;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        SubmitLocked(&failed, &submit_status);
+      }
+      for (Request* request : failed) {
+        Finish(request, submit_status);
+      }
+    }
+  }
+
+  void Complete(Request* request, int res) {
+    if (res == -EINTR || res == -EAGAIN) {
+      Resubmit(request);
+    } else if (res < 0) {
+      Finish(request, ::arrow::internal::IOErrorFromErrno(-res, "io_uring read failed"));
+    } else {
+      request->bytes_read += res;
+      if (res > 0 && request->bytes_read < request->range.length) {
+        // Short read before end of file
+        Resubmit(request);
+      } else {
+        Finish(request, Status::OK());
+      }
+    }
+  }
+
+  void Resubmit(Request* request) {
+    std::vector<Request*> failed;
+    Status submit_status;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (NextSqeLocked() == NULLPTR) {
+        SubmitLocked(&failed, &submit_status);
+      }
+      if (NextSqeLocked() != NULLPTR) {
+        PrepareReadLocked(request);
+        request = NULLPTR;
+      }
+      SubmitLocked(&failed, &submit_status);
+    }
+    if (request != NULLPTR) {
+      // The kernel holds on to the queue: finish the read here
+      auto bytes_read = ::arrow::internal::FileReadAt(
+          request->fd, request->data + request->bytes_read,
+          request->range.offset + request->bytes_read,
+          request->range.length - request->bytes_read);
+      if (bytes_read.ok()) {
+        request->bytes_read += *bytes_read;
+      }
+      Finish(request, bytes_read.status());
+    }
+    for (Request* failed_request : failed) {
+      Finish(failed_request, submit_status);
+    }
+  }
+
+  // Satisfy the request's future and release the request
+  void Finish(Request* request, Status status) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --in_flight_;
+    }
+    std::unique_ptr<Request> owned(request);
+    Result<std::shared_ptr<Buffer>> result;
+    if (!status.ok()) {
+      result = std::move(status);
+    } else if (request->slot >= 0) {
+      result = std::shared_ptr<Buffer>(std::make_shared<SlotBuffer>(
+          request->slots, request->slot, request->bytes_read));
+      request->slot = -1;
+    } else {
+      if (request->bytes_read < request->range.length) {
+        status = request->buffer->Resize(request->bytes_read);
+        request->buffer->ZeroPadding();
+      }
+      if (status.ok()) {
+        result = std::shared_ptr<Buffer>(std::move(request->buffer));
+      } else {
+        result = std::move(status);
+      }
+    }
+    auto future = std::move(request->future);
+    owned.reset();
+    future.MarkFinished(std::move(result));
+  }
+
+  int ring_fd_ = -1;
+  io_uring_params params_;
+  uint8_t* sq_ring_ = NULLPTR;
+  size_t sq_ring_size_ = 0;
+  uint8_t* cq_ring_ = NULLPTR;
+  size_t cq_ring_size_ = 0;
+  io_uring_sqe* sqes_ = NULLPTR;
+
+  unsigned* sq_head_ = NULLPTR;
+  unsigned* sq_tail_ = NULLPTR;
+  unsigned sq_mask_ = 0;
+  unsigned* sq_array_ = NULLPTR;
+  unsigned* cq_head_ = NULLPTR;
+  unsigned* cq_tail_ = NULLPTR;
+  unsigned cq_mask_ = 0;
+  io_uring_cqe* cqes_ = NULLPTR;
+
+  std::shared_ptr<SlotPool> slots_;
+
+  // Protects the submission queue and the in-flight count
+  std::mutex mutex_;
+  unsigned to_submit_ = 0;
+  unsigned in_flight_ = 0;
+  std::thread reaper_;
+};
+
+IoUring* IoUring::GetInstance() {
+  static IoUring* instance = []() -> IoUring* {
+    auto env_var = ::arrow::internal::GetEnvVar("ARROW_IO_URING");
+    if (env_var.ok() && *env_var == "0") {
+      return NULLPTR;
+    }
+    std::unique_ptr<Impl> impl(new Impl());
+    Status st = impl->Init();
+    if (!st.ok()) {
+      ARROW_LOG(DEBUG) << "io_uring unavailable, using the I/O thread pool: "
+                       << st.ToString();
+      return NULLPTR;
+    }
+    // Deliberately leaked, like the I/O thread pool, so that the reaper thread
+    // does not race with static destructors at exit
+    return new IoUring(std::move(impl));
+  }();
+  return instance;
+}
+
+#else  // !ARROW_WITH_IO_URING
+
+class IoUring::Impl {
+ public:
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadMany(
+      int, const std::vector<ReadRange>&, MemoryPool*) {
+    return {};
+  }
+};
+
+IoUring* IoUring::GetInstance() { return NULLPTR; }
+
+#endif  // ARROW_WITH_IO_URING
+
+IoUring::IoUring(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+IoUring::~IoUring() = default;
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUring::ReadMany(
+    int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool) {
+  return impl_->ReadMany(fd, ranges, pool);
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
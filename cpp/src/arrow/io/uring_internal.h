@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+// Asynchronous reads of local files through the Linux io_uring interface.
+//
+// A single ring is shared by the process.  Reads are submitted from the calling
+// thread, one system call per batch, and a dedicated thread reaps completions
+// and satisfies the futures.  Small reads land in buffers registered with the
+// kernel once and for all, which saves mapping the destination pages on every
+// read; larger reads, and small reads while all registered buffers are in use,
+// land in buffers allocated from the given pool.
+class ARROW_EXPORT IoUring {
+ public:
+  ~IoUring();
+
+  // Return the process-global ring, or null if io_uring cannot be used: Arrow
+  // was built without ARROW_WITH_IO_URING, the ARROW_IO_URING environment
+  // variable is set to 0, or the kernel does not support it.
+  static IoUring* GetInstance();
+
+  // Read the given ranges of a file descriptor.  Each future yields the bytes
+  // read, which are fewer than requested at end of file.  The descriptor must
+  // stay open until all futures are finished.  Reads beyond the ring's
+  // capacity are run on the I/O thread pool instead.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadMany(
+      int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool);
+
+  class Impl;
+
+ private:
+  explicit IoUring(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
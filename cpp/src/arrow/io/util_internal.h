@@ -17,10 +17,20 @@
 
 #pragma once
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace io {
 namespace internal {
 
@@ -38,6 +48,18 @@ ARROW_EXPORT Status ValidateWriteRegion(int64_t offset, int64_t size, int64_t fi
 // knowing the file size.
 ARROW_EXPORT Status ValidateRegion(int64_t offset, int64_t size);
 
+// Merge the given ranges into fewer, larger ranges.  Two consecutive ranges
+// are merged if the gap between them is at most `hole_size_limit` bytes and the
+// merged range would be at most `range_size_limit` bytes.  Empty ranges are
+// dropped and the result is sorted by offset.
+ARROW_EXPORT
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit);
+
+// Return the process-global thread pool for I/O-bound tasks.
+ARROW_EXPORT ::arrow::internal::ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
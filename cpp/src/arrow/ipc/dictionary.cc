@@ -24,6 +24,7 @@
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -134,6 +135,32 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+Status DictionaryMemo::AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                                          MemoryPool* pool) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("No dictionary with id ", id, " to apply delta to");
+  }
+  if (!it->second->type()->Equals(*delta->type())) {
+    return Status::TypeError("Dictionary delta for id ", id, " has type ",
+                             delta->type()->ToString(), ", expected ",
+                             it->second->type()->ToString());
+  }
+  if (delta->length() == 0) {
+    return Status::OK();
+  }
+  std::shared_ptr<Array> combined;
+  RETURN_NOT_OK(Concatenate({it->second, delta}, pool, &combined));
+  it->second = std::move(combined);
+  return Status::OK();
+}
+
+Status DictionaryMemo::AddOrReplaceDictionary(int64_t id,
+                                              const std::shared_ptr<Array>& dictionary) {
+  id_to_dictionary_[id] = dictionary;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // CollectDictionaries implementation
 
@@ -180,5 +207,50 @@ Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo) {
   return collector.Collect(batch);
 }
 
+// Same as DictionaryCollector, but only looking up the ids
+struct DictionaryIdCollector {
+  const DictionaryMemo& memo_;
+  DictionaryVector* out_;
+
+  Status WalkChildren(const DataType& type, const Array& array) {
+    for (int i = 0; i < type.num_children(); ++i) {
+      auto boxed_child = MakeArray(array.data()->child_data[i]);
+      RETURN_NOT_OK(Visit(*type.child(i), *boxed_child));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const Field& field, const Array& array) {
+    const auto& type = *field.type();
+    if (type.id() == Type::DICTIONARY) {
+      const auto& dict_array = static_cast<const DictionaryArray&>(array);
+      auto dictionary = dict_array.dictionary();
+      int64_t id = -1;
+      RETURN_NOT_OK(memo_.GetId(field, &id));
+      out_->emplace_back(id, dictionary);
+
+      const auto& dict_type = static_cast<const DictionaryType&>(type);
+      RETURN_NOT_OK(WalkChildren(*dict_type.value_type(), *dictionary));
+    } else {
+      RETURN_NOT_OK(WalkChildren(type, array));
+    }
+    return Status::OK();
+  }
+
+  Status Collect(const Schema& schema, const RecordBatch& batch) {
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      RETURN_NOT_OK(Visit(*schema.field(i), *batch.column(i)));
+    }
+    return Status::OK();
+  }
+};
+
+Status CollectDictionaries(const Schema& schema, const RecordBatch& batch,
+                           const DictionaryMemo& memo, DictionaryVector* out) {
+  out->clear();
+  DictionaryIdCollector collector{memo, out};
+  return collector.Collect(schema, batch);
+}
+
 }  // namespace ipc
 }  // namespace arrow
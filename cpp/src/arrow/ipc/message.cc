@@ -45,6 +45,10 @@ class Message::MessageImpl {
                        const std::shared_ptr<Buffer>& body)
       : metadata_(metadata), message_(nullptr), body_(body) {}
 
+  MessageImpl(const std::shared_ptr<Buffer>& metadata,
+              const std::shared_ptr<io::RandomAccessFile>& body_file)
+      : metadata_(metadata), message_(nullptr), body_file_(body_file) {}
+
   Status Open() {
     RETURN_NOT_OK(
         internal::VerifyMessage(metadata_->data(), metadata_->size(), &message_));
@@ -82,7 +86,23 @@ class Message::MessageImpl {
 
   int64_t body_length() const { return message_->bodyLength(); }
 
-  std::shared_ptr<Buffer> body() const { return body_; }
+  std::shared_ptr<Buffer> body() const {
+    if (body_file_) {
+      auto result = body_file_->ReadAt(0, body_length());
+      return result.ok() ? *result : nullptr;
+    }
+    return body_;
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBodyReader() const {
+    if (body_file_) {
+      return body_file_;
+    }
+    if (body_) {
+      return Buffer::GetReader(body_);
+    }
+    return nullptr;
+  }
 
   std::shared_ptr<Buffer> metadata() const { return metadata_; }
 
@@ -91,8 +111,9 @@ class Message::MessageImpl {
   std::shared_ptr<Buffer> metadata_;
   const flatbuf::Message* message_;
 
-  // The message body, if any
+  // The message body, if any, either in memory or in a file
   std::shared_ptr<Buffer> body_;
+  std::shared_ptr<io::RandomAccessFile> body_file_;
 };
 
 Message::Message(const std::shared_ptr<Buffer>& metadata,
@@ -106,10 +127,22 @@ Status Message::Open(const std::shared_ptr<Buffer>& metadata,
   return (*out)->impl_->Open();
 }
 
+Status Message::OpenWithBodyFile(const std::shared_ptr<Buffer>& metadata,
+                                 const std::shared_ptr<io::RandomAccessFile>& body_file,
+                                 std::unique_ptr<Message>* out) {
+  out->reset(new Message(metadata, nullptr));
+  (*out)->impl_.reset(new MessageImpl(metadata, body_file));
+  return (*out)->impl_->Open();
+}
+
 Message::~Message() {}
 
 std::shared_ptr<Buffer> Message::body() const { return impl_->body(); }
 
+Result<std::shared_ptr<io::RandomAccessFile>> Message::GetBodyReader() const {
+  return impl_->GetBodyReader();
+}
+
 int64_t Message::body_length() const { return impl_->body_length(); }
 
 std::shared_ptr<Buffer> Message::metadata() const { return impl_->metadata(); }
@@ -240,8 +273,9 @@ std::string FormatMessageType(Message::Type type) {
   return "unknown";
 }
 
-Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
-                   std::unique_ptr<Message>* message) {
+static Status ReadMetadataAt(int64_t offset, int32_t metadata_length,
+                             io::RandomAccessFile* file,
+                             std::shared_ptr<Buffer>* metadata) {
   if (static_cast<size_t>(metadata_length) < sizeof(int32_t)) {
     return Status::Invalid("metadata_length should be at least 4");
   }
@@ -286,11 +320,25 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
                            ", metadata length: ", metadata_length);
   }
 
-  std::shared_ptr<Buffer> metadata =
-      SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  *metadata = SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  return Status::OK();
+}
+
+Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
+                   std::unique_ptr<Message>* message) {
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(ReadMetadataAt(offset, metadata_length, file, &metadata));
   return Message::ReadFrom(offset + metadata_length, metadata, file, message);
 }
 
+Status ReadMessageMetadata(int64_t offset, int32_t metadata_length,
+                           io::RandomAccessFile* file, std::shared_ptr<Buffer>* metadata,
+                           int64_t* body_length) {
+  RETURN_NOT_OK(ReadMetadataAt(offset, metadata_length, file, metadata));
+  RETURN_NOT_OK(MaybeAlignMetadata(metadata));
+  return CheckMetadataAndGetBodyLength(**metadata, body_length);
+}
+
 Status AlignStream(io::InputStream* stream, int32_t alignment) {
   ARROW_ASSIGN_OR_RAISE(int64_t position, stream->Tell());
   return stream->Advance(PaddedLength(position, alignment) - position);
@@ -317,6 +365,28 @@ Status CheckAligned(io::FileInterface* stream, int32_t alignment) {
 
 namespace {
 
+// Like Message::ReadFrom, but allocate the body from the given pool, so that a
+// recycling pool can serve the bodies of successive messages
+Status ReadMessageBody(std::shared_ptr<Buffer> metadata, io::InputStream* stream,
+                       MemoryPool* pool, std::unique_ptr<Message>* out) {
+  RETURN_NOT_OK(MaybeAlignMetadata(&metadata));
+  int64_t body_length = -1;
+  RETURN_NOT_OK(CheckMetadataAndGetBodyLength(*metadata, &body_length));
+
+  std::shared_ptr<Buffer> body;
+  RETURN_NOT_OK(AllocateBuffer(pool, body_length, &body));
+  if (body_length > 0) {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          stream->Read(body_length, body->mutable_data()));
+    if (bytes_read < body_length) {
+      return Status::IOError("Expected to be able to read ", body_length,
+                             " bytes for message body, got ", bytes_read);
+    }
+  }
+
+  return Message::Open(metadata, std::move(body), out);
+}
+
 Result<std::unique_ptr<Message>> DoReadMessage(io::InputStream* file, MemoryPool* pool) {
   int32_t continuation = 0;
   ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, file->Read(sizeof(int32_t), &continuation));
@@ -354,7 +424,11 @@ Result<std::unique_ptr<Message>> DoReadMessage(io::InputStream* file, MemoryPool
                         Buffer::ViewOrCopy(metadata, CPUDevice::memory_manager(pool)));
 
   std::unique_ptr<Message> message;
-  RETURN_NOT_OK(Message::ReadFrom(metadata, file, &message));
+  if (file->supports_zero_copy()) {
+    RETURN_NOT_OK(Message::ReadFrom(metadata, file, &message));
+  } else {
+    RETURN_NOT_OK(ReadMessageBody(metadata, file, pool, &message));
+  }
   return std::move(message);
 }
 
@@ -406,31 +480,36 @@ Status WriteMessage(const Buffer& message, const IpcOptions& options,
 /// \brief Implementation of MessageReader that reads from InputStream
 class InputStreamMessageReader : public MessageReader {
  public:
-  explicit InputStreamMessageReader(io::InputStream* stream) : stream_(stream) {}
+  InputStreamMessageReader(io::InputStream* stream, MemoryPool* pool)
+      : stream_(stream), pool_(pool) {}
 
-  explicit InputStreamMessageReader(const std::shared_ptr<io::InputStream>& owned_stream)
-      : InputStreamMessageReader(owned_stream.get()) {
+  InputStreamMessageReader(const std::shared_ptr<io::InputStream>& owned_stream,
+                           MemoryPool* pool)
+      : InputStreamMessageReader(owned_stream.get(), pool) {
     owned_stream_ = owned_stream;
   }
 
   ~InputStreamMessageReader() {}
 
   Status ReadNextMessage(std::unique_ptr<Message>* message) {
-    return ReadMessage(stream_, message);
+    return DoReadMessage(stream_, pool_).Value(message);
   }
 
  private:
   io::InputStream* stream_;
+  MemoryPool* pool_;
   std::shared_ptr<io::InputStream> owned_stream_;
 };
 
-std::unique_ptr<MessageReader> MessageReader::Open(io::InputStream* stream) {
-  return std::unique_ptr<MessageReader>(new InputStreamMessageReader(stream));
+std::unique_ptr<MessageReader> MessageReader::Open(io::InputStream* stream,
+                                                   MemoryPool* pool) {
+  return std::unique_ptr<MessageReader>(new InputStreamMessageReader(stream, pool));
 }
 
 std::unique_ptr<MessageReader> MessageReader::Open(
-    const std::shared_ptr<io::InputStream>& owned_stream) {
-  return std::unique_ptr<MessageReader>(new InputStreamMessageReader(owned_stream));
+    const std::shared_ptr<io::InputStream>& owned_stream, MemoryPool* pool) {
+  return std::unique_ptr<MessageReader>(
+      new InputStreamMessageReader(owned_stream, pool));
 }
 
 }  // namespace ipc
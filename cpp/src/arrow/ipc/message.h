@@ -25,6 +25,7 @@
 
 #include "arrow/io/type_fwd.h"
 #include "arrow/ipc/options.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
@@ -73,6 +74,19 @@ class ARROW_EXPORT Message {
   static Status Open(const std::shared_ptr<Buffer>& metadata,
                      const std::shared_ptr<Buffer>& body, std::unique_ptr<Message>* out);
 
+  /// \brief Create and validate a Message instance from its metadata and a
+  /// file containing its body, for bodies which aren't contiguous in memory
+  ///
+  /// The body buffers are read from the file when the message is decoded.
+  ///
+  /// \param[in] metadata a buffer containing the Flatbuffer metadata
+  /// \param[in] body_file a file containing the message body from position 0
+  /// \param[out] out the created message
+  /// \return Status
+  static Status OpenWithBodyFile(const std::shared_ptr<Buffer>& metadata,
+                                 const std::shared_ptr<io::RandomAccessFile>& body_file,
+                                 std::unique_ptr<Message>* out);
+
   /// \brief Read message body and create Message given Flatbuffer metadata
   /// \param[in] metadata containing a serialized Message flatbuffer
   /// \param[in] stream an InputStream
@@ -108,9 +122,18 @@ class ARROW_EXPORT Message {
 
   /// \brief the Message body, if any
   ///
+  /// For messages opened with OpenWithBodyFile, the whole body is read into
+  /// memory on each call, use GetBodyReader to read individual buffers.
+  ///
   /// \return buffer is null if no body
   std::shared_ptr<Buffer> body() const;
 
+  /// \brief Get a file to read the body buffers from, zero-copy if the body is
+  /// in memory
+  ///
+  /// \return file is null if no body
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBodyReader() const;
+
   /// \brief The expected body length according to the metadata, for
   /// verification purposes
   int64_t body_length() const;
@@ -155,11 +178,16 @@ class ARROW_EXPORT MessageReader {
   virtual ~MessageReader() = default;
 
   /// \brief Create MessageReader that reads from InputStream
-  static std::unique_ptr<MessageReader> Open(io::InputStream* stream);
+  ///
+  /// If the stream doesn't support zero-copy reads, message bodies are
+  /// allocated from the given pool.
+  static std::unique_ptr<MessageReader> Open(io::InputStream* stream,
+                                             MemoryPool* pool = default_memory_pool());
 
   /// \brief Create MessageReader that reads from owned InputStream
   static std::unique_ptr<MessageReader> Open(
-      const std::shared_ptr<io::InputStream>& owned_stream);
+      const std::shared_ptr<io::InputStream>& owned_stream,
+      MemoryPool* pool = default_memory_pool());
 
   /// \brief Read next Message from the interface
   ///
@@ -168,6 +196,24 @@ class ARROW_EXPORT MessageReader {
   virtual Status ReadNextMessage(std::unique_ptr<Message>* message) = 0;
 };
 
+/// \brief Read only the metadata of an encapsulated IPC message from
+/// position in file
+///
+/// Like ReadMessage, but the message body, which immediately follows the
+/// metadata in the file, is not read.
+///
+/// \param[in] offset the position in the file where the message starts
+/// \param[in] metadata_length the total number of bytes of the metadata,
+/// including the length prefix
+/// \param[in] file the seekable file interface to read from
+/// \param[out] metadata the flatbuffer metadata
+/// \param[out] body_length the length of the message body
+/// \return Status success or failure
+ARROW_EXPORT
+Status ReadMessageMetadata(const int64_t offset, const int32_t metadata_length,
+                           io::RandomAccessFile* file, std::shared_ptr<Buffer>* metadata,
+                           int64_t* body_length);
+
 /// \brief Read encapsulated RPC message from position in file
 ///
 /// Read a length-prefixed message flatbuffer starting at the indicated file
@@ -222,7 +268,8 @@ Status ReadMessage(io::InputStream* stream, std::unique_ptr<Message>* message);
 /// message length is 0 (e.g. EOS in a stream)
 ///
 /// \param[in] stream an input stream
-/// \param[in] pool an optional MemoryPool to copy metadata on the CPU, if required
+/// \param[in] pool an optional MemoryPool to copy metadata on the CPU, if required,
+/// and to allocate the body if the stream doesn't support zero-copy reads
 /// \return Message
 ARROW_EXPORT
 Result<std::unique_ptr<Message>> ReadMessage(io::InputStream* stream,
@@ -829,12 +829,11 @@ Status SchemaToFlatbuffer(FBB& fbb, const Schema& schema, DictionaryMemo* dictio
   return Status::OK();
 }
 
-Result<std::shared_ptr<Buffer>> WriteFBMessage(FBB& fbb,
-                                               flatbuf::MessageHeader header_type,
-                                               flatbuffers::Offset<void> header,
-                                               int64_t body_length) {
+Result<std::shared_ptr<Buffer>> WriteFBMessage(
+    FBB& fbb, flatbuf::MessageHeader header_type, flatbuffers::Offset<void> header,
+    int64_t body_length, flatbuffers::Offset<KVVector> custom_metadata = 0) {
   auto message = flatbuf::CreateMessage(fbb, kCurrentMetadataVersion, header_type, header,
-                                        body_length);
+                                        body_length, custom_metadata);
   fbb.Finish(message);
   return WriteFlatbufferBuilder(fbb);
 }
@@ -1040,18 +1039,53 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
       .Value(out);
 }
 
+static flatbuffers::Offset<KVVector> CompressionMetadata(
+    FBB& fbb, Compression::type compression) {
+  if (compression == Compression::UNCOMPRESSED) {
+    return 0;
+  }
+  std::vector<KeyValueOffset> key_values = {AppendKeyValue(
+      fbb, kCompressionMetadataKey, util::Codec::GetCodecAsString(compression))};
+  return fbb.CreateVector(key_values);
+}
+
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader::RecordBatch, record_batch.Union(),
-                        body_length)
+                        body_length, CompressionMetadata(fbb, compression))
       .Value(out);
 }
 
+Status GetCompression(const flatbuf::Message* message, Compression::type* out) {
+  *out = Compression::UNCOMPRESSED;
+  const auto fb_metadata = message->custom_metadata();
+  if (fb_metadata == nullptr) {
+    return Status::OK();
+  }
+  for (const auto pair : *fb_metadata) {
+    CHECK_FLATBUFFERS_NOT_NULL(pair->key(), "custom_metadata.key");
+    if (pair->key()->str() != kCompressionMetadataKey) {
+      continue;
+    }
+    CHECK_FLATBUFFERS_NOT_NULL(pair->value(), "custom_metadata.value");
+    const std::string name = pair->value()->str();
+    for (auto compression : {Compression::LZ4, Compression::ZSTD}) {
+      if (name == util::Codec::GetCodecAsString(compression)) {
+        *out = compression;
+        return Status::OK();
+      }
+    }
+    return Status::Invalid("Unsupported IPC body compression: '", name, "'");
+  }
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Buffer>> WriteTensorMessage(const Tensor& tensor,
                                                    int64_t buffer_start_offset) {
   using TensorDimOffset = flatbuffers::Offset<flatbuf::TensorDim>;
@@ -1098,16 +1132,19 @@ Result<std::shared_ptr<Buffer>> WriteSparseTensorMessage(
                         fb_sparse_tensor.Union(), body_length);
 }
 
-Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
+Status WriteDictionaryMessage(int64_t id, bool is_delta, int64_t length,
+                              int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader::DictionaryBatch, dictionary_batch,
-                        body_length)
+                        body_length, CompressionMetadata(fbb, compression))
       .Value(out);
 }
 
@@ -34,6 +34,7 @@
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/macros.h"
 
 #include "generated/Message_generated.h"
@@ -68,6 +69,14 @@ MetadataVersion GetMetadataVersion(flatbuf::MetadataVersion version);
 
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
+// Message custom metadata key flagging compressed body buffers.  The value
+// is the codec name, as returned by util::Codec::GetCodecAsString.
+//
+// Each non-empty compressed buffer starts with its uncompressed length as a
+// little-endian int64, followed by the compressed data.  An uncompressed
+// length of -1 means the data following it was left uncompressed.
+static constexpr const char* kCompressionMetadataKey = "ARROW:experimental_compression";
+
 struct FieldMetadata {
   int64_t length;
   int64_t null_count;
@@ -158,8 +167,13 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out);
 
+// Get the codec used to compress the body buffers of a message, or
+// Compression::UNCOMPRESSED
+Status GetCompression(const flatbuf::Message* message, Compression::type* out);
+
 Result<std::shared_ptr<Buffer>> WriteTensorMessage(const Tensor& tensor,
                                                    const int64_t buffer_start_offset);
 
@@ -171,10 +185,11 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
                        const std::vector<FileBlock>& record_batches,
                        io::OutputStream* out);
 
-Status WriteDictionaryMessage(const int64_t id, const int64_t length,
-                              const int64_t body_length,
+Status WriteDictionaryMessage(const int64_t id, const bool is_delta,
+                              const int64_t length, const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out);
 
 static inline Result<std::shared_ptr<Buffer>> WriteFlatbufferBuilder(
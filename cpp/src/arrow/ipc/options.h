@@ -18,7 +18,10 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
+#include "arrow/memory_pool.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -44,6 +47,49 @@ struct ARROW_EXPORT IpcOptions {
   /// consisting of a 4-byte prefix instead of 8 byte
   bool write_legacy_ipc_format = false;
 
+  /// \brief Emit dictionary deltas
+  ///
+  /// If true, when a dictionary only gained new values at its end since it
+  /// was last written, only the new values are written, in a delta
+  /// dictionary batch.  Otherwise, a changed dictionary is written again in
+  /// full, which is only possible in the stream format.
+  bool emit_dictionary_deltas = false;
+
+  /// \brief Codec used to compress record batch body buffers, per buffer
+  ///
+  /// Only LZ4 and ZSTD are supported.  Compressed messages are flagged with
+  /// custom metadata in the message header and can only be read back by
+  /// readers supporting it.
+  Compression::type compression = Compression::UNCOMPRESSED;
+  int compression_level = util::kUseDefaultCompressionLevel;
+
+  /// \brief Use the global CPU thread pool to compress or decompress buffers
+  /// in parallel
+  bool use_threads = true;
+
+  /// \brief Top-level schema fields to include when reading record batches
+  ///
+  /// If empty (the default), all fields are read.  Otherwise, the read
+  /// record batches only contain the given fields, in schema order, and the
+  /// buffers of the other fields are not read from the source.
+  std::vector<int> included_fields;
+
+  /// \brief Number of record batches to read ahead of the consumer
+  ///
+  /// If 0 (the default), batches are read on demand.  A stream reader
+  /// reads ahead in a background thread; a file reader's
+  /// GetRecordBatchReader() reads and decodes up to this many batches
+  /// concurrently on the CPU thread pool if use_threads is true.
+  int readahead_batches = 0;
+
+  /// \brief Memory pool used when reading
+  ///
+  /// Message bodies read from a stream which doesn't support zero-copy
+  /// reads, and decompressed body buffers, are allocated from this pool.
+  /// A RecyclingMemoryPool may be used here to reuse buffers across
+  /// messages of similar sizes.
+  MemoryPool* memory_pool = default_memory_pool();
+
   static IpcOptions Defaults();
 };
 
@@ -17,11 +17,13 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <sstream>
 #include <string>
 
 #include "arrow/api.h"
+#include "arrow/io/buffered.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/testing/gtest_util.h"
@@ -101,7 +103,53 @@ static void ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const refe
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Read a stream of record batches from a stream without zero-copy reads,
+// optionally recycling the message bodies
+static void ReadStream(benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int64_t kBatchSize = 1 << 16;
+  constexpr int kNumBatches = 64;
+  const bool recycle = state.range(0) != 0;
+
+  auto record_batch = MakeRecordBatch(kBatchSize, 16);
+  auto sink = *io::BufferOutputStream::Create();
+  auto writer = *ipc::RecordBatchStreamWriter::Open(sink.get(), record_batch->schema());
+  for (int i = 0; i < kNumBatches; ++i) {
+    ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  }
+  ABORT_NOT_OK(writer->Close());
+  auto buffer = *sink->Finish();
+
+  ProfilingMemoryPool profiling_pool(default_memory_pool());
+  RecyclingMemoryPool recycling_pool(&profiling_pool);
+  auto options = ipc::IpcOptions::Defaults();
+  options.memory_pool =
+      recycle ? static_cast<MemoryPool*>(&recycling_pool) : &profiling_pool;
+
+  int64_t num_batches = 0;
+  while (state.KeepRunning()) {
+    auto stream = *io::BufferedInputStream::Create(
+        1 << 12, default_memory_pool(), std::make_shared<io::BufferReader>(buffer));
+    auto reader = *ipc::RecordBatchStreamReader::Open(stream, options);
+    std::shared_ptr<RecordBatch> result;
+    while (true) {
+      if (!reader->ReadNext(&result).ok()) {
+        state.SkipWithError("Failed to read!");
+        break;
+      }
+      if (result == nullptr) {
+        break;
+      }
+      ++num_batches;
+    }
+  }
+  state.SetBytesProcessed(num_batches * kBatchSize);
+  state.counters["allocs_per_batch"] =
+      static_cast<double>(profiling_pool.profile().num_allocations) /
+      static_cast<double>(std::max<int64_t>(num_batches, 1));
+}
+
 BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(ReadStream)->ArgName("recycle")->Arg(0)->Arg(1)->UseRealTime();
 
 }  // namespace arrow
@@ -28,6 +28,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/test_common.h"
@@ -47,7 +48,9 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
 
@@ -60,6 +63,9 @@ namespace test {
 
 using BatchVector = std::vector<std::shared_ptr<RecordBatch>>;
 
+static const std::vector<Compression::type> kBodyCompressionCodecs = {
+    Compression::LZ4, Compression::ZSTD};
+
 TEST(TestMessage, Equals) {
   std::string metadata = "foo";
   std::string body = "bar";
@@ -903,6 +909,21 @@ TEST_P(TestFileFormat, RoundTrip) {
   TestZeroLengthRoundTrip(*GetParam(), options);
 }
 
+TEST_P(TestFileFormat, RoundTripCompressed) {
+  for (auto codec : kBodyCompressionCodecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    for (bool use_threads : {false, true}) {
+      IpcOptions options;
+      options.compression = codec;
+      options.use_threads = use_threads;
+      TestRoundTrip(*GetParam(), options);
+      TestZeroLengthRoundTrip(*GetParam(), options);
+    }
+  }
+}
+
 TEST_P(TestStreamFormat, RoundTrip) {
   TestRoundTrip(*GetParam(), IpcOptions::Defaults());
   TestZeroLengthRoundTrip(*GetParam(), IpcOptions::Defaults());
@@ -913,6 +934,21 @@ TEST_P(TestStreamFormat, RoundTrip) {
   TestZeroLengthRoundTrip(*GetParam(), options);
 }
 
+TEST_P(TestStreamFormat, RoundTripCompressed) {
+  for (auto codec : kBodyCompressionCodecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    for (bool use_threads : {false, true}) {
+      IpcOptions options;
+      options.compression = codec;
+      options.use_threads = use_threads;
+      TestRoundTrip(*GetParam(), options);
+      TestZeroLengthRoundTrip(*GetParam(), options);
+    }
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(FileRoundTripTests, TestFileFormat, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(StreamRoundTripTests, TestStreamFormat, BATCH_CASES());
@@ -958,6 +994,417 @@ TEST_F(TestStreamFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
 TEST_F(TestFileFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
+TEST(TestBodyCompression, IncompressibleBuffers) {
+  // Buffers which don't compress are stored as-is
+  random::RandomArrayGenerator rand(0x2e5f);
+  const int64_t length = 1000;
+  auto batch = RecordBatch::Make(
+      schema({field("f0", int64()), field("f1", float64())}), length,
+      {rand.Int64(length, 0, std::numeric_limits<int64_t>::max(), 0.1),
+       rand.Float64(length, -1, 1, 0)});
+  for (auto codec : kBodyCompressionCodecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    IpcOptions options;
+    options.compression = codec;
+    StreamWriterHelper writer_helper;
+    ASSERT_OK(writer_helper.Init(batch->schema(), options));
+    ASSERT_OK(writer_helper.WriteBatch(batch));
+    ASSERT_OK(writer_helper.Finish());
+    BatchVector out_batches;
+    ASSERT_OK(writer_helper.ReadBatches(&out_batches));
+    ASSERT_EQ(out_batches.size(), 1);
+    ASSERT_OK(out_batches[0]->ValidateFull());
+    CompareBatch(*batch, *out_batches[0]);
+  }
+}
+
+TEST(TestBodyCompression, UnsupportedCodec) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  IpcOptions options;
+  options.compression = Compression::SNAPPY;
+  StreamWriterHelper writer_helper;
+  ASSERT_OK(writer_helper.Init(batch->schema(), options));
+  ASSERT_RAISES(Invalid, writer_helper.WriteBatch(batch));
+}
+
+TEST(TestRecordBatchFileReader, IncludedFields) {
+  auto f0 = field("f0", list(int32()));
+  auto f1 = field("f1", utf8());
+  auto f2 = field("f2", struct_({field("a", int64()), field("b", boolean())}));
+  auto f3 = field("f3", float64());
+  auto sch = schema({f0, f1, f2, f3}, key_value_metadata({"key"}, {"value"}));
+  auto batch = RecordBatch::Make(
+      sch, 3,
+      {ArrayFromJSON(f0->type(), "[[1, 2], null, [3]]"),
+       ArrayFromJSON(f1->type(), R"(["foo", "", null])"),
+       ArrayFromJSON(f2->type(),
+                     R"([{"a": 1, "b": true}, {"a": null, "b": false},
+                         {"a": 3, "b": null}])"),
+       ArrayFromJSON(f3->type(), "[1.5, null, -2.0]")});
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ASSERT_OK(AllocateResizableBuffer(0, &buffer));
+  io::BufferOutputStream sink(buffer);
+  ASSERT_OK_AND_ASSIGN(auto writer, RecordBatchFileWriter::Open(&sink, sch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch->Slice(1)));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink.Close());
+
+  auto source = std::make_shared<io::BufferReader>(buffer);
+  auto options = IpcOptions::Defaults();
+  // Fields are read in schema order, whatever the order of the indices
+  options.included_fields = {3, 1};
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(source, options));
+  auto expected_schema = schema({f1, f3}, sch->metadata());
+  AssertSchemaEqual(*expected_schema, *reader->schema());
+  ASSERT_EQ(reader->num_record_batches(), 2);
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    std::shared_ptr<RecordBatch> out;
+    ASSERT_OK(reader->ReadRecordBatch(i, &out));
+    ASSERT_OK(out->ValidateFull());
+    auto expected = i == 0 ? batch : batch->Slice(1);
+    auto expected_projected =
+        RecordBatch::Make(expected_schema, expected->num_rows(),
+                          {expected->column(1), expected->column(3)});
+    CompareBatch(*expected_projected, *out);
+  }
+
+  // A nested field after an excluded one
+  options.included_fields = {2};
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::Open(source, options));
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(reader->ReadRecordBatch(0, &out));
+  ASSERT_OK(out->ValidateFull());
+  CompareBatch(*RecordBatch::Make(schema({f2}, sch->metadata()), 3, {batch->column(2)}),
+               *out);
+
+  // Fields can also be selected when reading a record batch
+  ASSERT_OK_AND_ASSIGN(reader,
+                       RecordBatchFileReader::Open(source, IpcOptions::Defaults()));
+  ASSERT_OK(reader->ReadRecordBatch(1, options, &out));
+  ASSERT_OK(out->ValidateFull());
+  CompareBatch(*RecordBatch::Make(schema({f2}, sch->metadata()), 2,
+                                  {batch->column(2)->Slice(1)}),
+               *out);
+
+  options.included_fields = {4};
+  ASSERT_RAISES(Invalid, RecordBatchFileReader::Open(source, options));
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, options, &out));
+  options.included_fields = {-1};
+  ASSERT_RAISES(Invalid, RecordBatchFileReader::Open(source, options));
+}
+
+// Write `num_batches` random batches with `writer_helper`
+template <typename WriterHelperType>
+void WriteRandomBatches(int num_batches, WriterHelperType* writer_helper,
+                        BatchVector* batches,
+                        const IpcOptions& options = IpcOptions::Defaults()) {
+  random::RandomArrayGenerator rand(0x8a3f);
+  auto sch = schema({field("f0", int32()), field("f1", utf8())});
+  ASSERT_OK(writer_helper->Init(sch, options));
+  for (int i = 0; i < num_batches; ++i) {
+    const int64_t length = 100 + i;
+    auto batch = RecordBatch::Make(sch, length,
+                                   {rand.Int32(length, -100, 100, 0.1),
+                                    rand.String(length, 0, 10, 0.1)});
+    ASSERT_OK(writer_helper->WriteBatch(batch));
+    batches->push_back(batch);
+  }
+  ASSERT_OK(writer_helper->Finish());
+}
+
+TEST(TestRecordBatchFileReader, GetRecordBatchReader) {
+  FileWriterHelper writer_helper;
+  BatchVector batches;
+  ASSERT_NO_FATAL_FAILURE(WriteRandomBatches(20, &writer_helper, &batches));
+  auto source = std::make_shared<io::BufferReader>(writer_helper.buffer_);
+
+  for (bool use_threads : {false, true}) {
+    for (int readahead : {0, 1, 4, 100}) {
+      auto options = IpcOptions::Defaults();
+      options.use_threads = use_threads;
+      options.readahead_batches = readahead;
+      ASSERT_OK_AND_ASSIGN(auto file_reader,
+                           RecordBatchFileReader::Open(source, options));
+      ASSERT_OK_AND_ASSIGN(auto reader, file_reader->GetRecordBatchReader());
+      AssertSchemaEqual(*batches[0]->schema(), *reader->schema());
+      BatchVector out_batches;
+      ASSERT_OK(reader->ReadAll(&out_batches));
+      ASSERT_EQ(batches.size(), out_batches.size());
+      for (size_t i = 0; i < batches.size(); ++i) {
+        CompareBatch(*batches[i], *out_batches[i]);
+      }
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(reader->ReadNext(&batch));
+      ASSERT_EQ(batch, nullptr);
+    }
+  }
+
+  // Destroying the reader with pending reads
+  auto options = IpcOptions::Defaults();
+  options.readahead_batches = 8;
+  ASSERT_OK_AND_ASSIGN(auto file_reader, RecordBatchFileReader::Open(source, options));
+  ASSERT_OK_AND_ASSIGN(auto reader, file_reader->GetRecordBatchReader());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  CompareBatch(*batches[0], *batch);
+  reader.reset();
+
+  options.readahead_batches = -1;
+  ASSERT_OK_AND_ASSIGN(file_reader, RecordBatchFileReader::Open(source, options));
+  ASSERT_RAISES(Invalid, file_reader->GetRecordBatchReader());
+}
+
+TEST(TestRecordBatchFileReader, ReadaheadCompressed) {
+  // Batches read ahead are decompressed without deadlocking, even when the
+  // readahead tasks occupy every thread of the CPU pool
+  const int capacity = GetCpuThreadPoolCapacity();
+  for (auto codec : kBodyCompressionCodecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    auto options = IpcOptions::Defaults();
+    options.compression = codec;
+    FileWriterHelper writer_helper;
+    BatchVector batches;
+    ASSERT_NO_FATAL_FAILURE(
+        WriteRandomBatches(4 * capacity, &writer_helper, &batches, options));
+
+    options.readahead_batches = 2 * capacity;
+    ASSERT_OK_AND_ASSIGN(
+        auto file_reader,
+        RecordBatchFileReader::Open(
+            std::make_shared<io::BufferReader>(writer_helper.buffer_), options));
+    ASSERT_OK_AND_ASSIGN(auto reader, file_reader->GetRecordBatchReader());
+    BatchVector out_batches;
+    ASSERT_OK(reader->ReadAll(&out_batches));
+    ASSERT_EQ(batches.size(), out_batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      CompareBatch(*batches[i], *out_batches[i]);
+    }
+  }
+}
+
+TEST(TestRecordBatchStreamReader, Readahead) {
+  StreamWriterHelper writer_helper;
+  BatchVector batches;
+  ASSERT_NO_FATAL_FAILURE(WriteRandomBatches(20, &writer_helper, &batches));
+
+  for (int readahead : {0, 1, 4, 100}) {
+    auto source = std::make_shared<io::BufferReader>(writer_helper.buffer_);
+    auto options = IpcOptions::Defaults();
+    options.readahead_batches = readahead;
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(source, options));
+    AssertSchemaEqual(*batches[0]->schema(), *reader->schema());
+    BatchVector out_batches;
+    ASSERT_OK(reader->ReadAll(&out_batches));
+    ASSERT_EQ(batches.size(), out_batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      CompareBatch(*batches[i], *out_batches[i]);
+    }
+  }
+
+  // Errors are propagated from the background thread
+  auto truncated =
+      SliceBuffer(writer_helper.buffer_, 0, writer_helper.buffer_->size() / 2);
+  auto options = IpcOptions::Defaults();
+  options.readahead_batches = 4;
+  ASSERT_OK_AND_ASSIGN(
+      auto reader, RecordBatchStreamReader::Open(
+                       std::make_shared<io::BufferReader>(truncated), options));
+  BatchVector out_batches;
+  ASSERT_RAISES(IOError, reader->ReadAll(&out_batches));
+}
+
+TEST(TestRecordBatchStreamReader, MemoryPool) {
+  StreamWriterHelper writer_helper;
+  BatchVector batches;
+  ASSERT_NO_FATAL_FAILURE(WriteRandomBatches(20, &writer_helper, &batches));
+
+  // Message bodies read from a stream without zero-copy reads are allocated
+  // from the given pool
+  ProxyMemoryPool parent(default_memory_pool());
+  RecyclingMemoryPool pool(&parent);
+  auto options = IpcOptions::Defaults();
+  options.memory_pool = &pool;
+  ASSERT_OK_AND_ASSIGN(
+      auto source,
+      io::BufferedInputStream::Create(
+          256, default_memory_pool(),
+          std::make_shared<io::BufferReader>(writer_helper.buffer_)));
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(source, options));
+  for (const auto& batch : batches) {
+    std::shared_ptr<RecordBatch> out_batch;
+    ASSERT_OK(reader->ReadNext(&out_batch));
+    ASSERT_NE(nullptr, out_batch);
+    ASSERT_GT(pool.bytes_allocated(), 0);
+    CompareBatch(*batch, *out_batch);
+  }
+  std::shared_ptr<RecordBatch> out_batch;
+  ASSERT_OK(reader->ReadNext(&out_batch));
+  ASSERT_EQ(nullptr, out_batch);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  pool.ReleaseCached();
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+class TestDictionaryDeltas : public ::testing::Test {
+ public:
+  void SetUp() override {
+    type_ = dictionary(int8(), utf8());
+    schema_ = schema({field("f0", type_), field("f1", int32())});
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::shared_ptr<Array>& dictionary,
+                                         const std::string& indices) {
+    std::shared_ptr<Array> dict_array;
+    ARROW_EXPECT_OK(DictionaryArray::FromArrays(type_, ArrayFromJSON(int8(), indices),
+                                                dictionary, &dict_array));
+    auto length = dict_array->length();
+    auto values = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5]")->Slice(0, length);
+    return RecordBatch::Make(schema_, length, {dict_array, values});
+  }
+
+  // Return whether each written dictionary batch is a delta
+  void GetDictionaryDeltas(const Buffer& stream, std::vector<bool>* out) {
+    out->clear();
+    io::BufferReader reader(std::make_shared<Buffer>(stream.data(), stream.size()));
+    auto message_reader = MessageReader::Open(&reader);
+    std::unique_ptr<Message> message;
+    while (true) {
+      ASSERT_OK(message_reader->ReadNextMessage(&message));
+      if (message == nullptr) {
+        break;
+      }
+      if (message->type() == Message::DICTIONARY_BATCH) {
+        const flatbuf::Message* fb_message;
+        ASSERT_OK(internal::VerifyMessage(message->metadata()->data(),
+                                          message->metadata()->size(), &fb_message));
+        out->push_back(fb_message->header_as_DictionaryBatch()->isDelta());
+      }
+    }
+  }
+
+ protected:
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<Schema> schema_;
+};
+
+TEST_F(TestDictionaryDeltas, StreamFormat) {
+  auto dict1 = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  auto dict2 = ArrayFromJSON(utf8(), R"(["a", "b", "c", "d"])");
+  auto dict3 = ArrayFromJSON(utf8(), R"(["x"])");
+  BatchVector batches = {
+      MakeBatch(dict1, "[0, 1, null]"),
+      // Same dictionary values: nothing written
+      MakeBatch(ArrayFromJSON(utf8(), R"(["a", "b"])"), "[1, 0]"),
+      // Extended dictionary: delta
+      MakeBatch(dict2, "[3, 2, 0, 1]"),
+      // Different dictionary: replacement
+      MakeBatch(dict3, "[0, 0]"),
+      // Extended again after replacement
+      MakeBatch(ArrayFromJSON(utf8(), R"(["x", "y"])"), "[1]")};
+
+  for (bool emit_deltas : {false, true}) {
+    auto options = IpcOptions::Defaults();
+    options.emit_dictionary_deltas = emit_deltas;
+    StreamWriterHelper writer_helper;
+    ASSERT_OK(writer_helper.Init(schema_, options));
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer_helper.WriteBatch(batch));
+    }
+    ASSERT_OK(writer_helper.Finish());
+
+    std::vector<bool> deltas;
+    ASSERT_NO_FATAL_FAILURE(GetDictionaryDeltas(*writer_helper.buffer_, &deltas));
+    if (emit_deltas) {
+      ASSERT_EQ(deltas, (std::vector<bool>{false, true, false, true}));
+    } else {
+      ASSERT_EQ(deltas, (std::vector<bool>{false, false, false, false}));
+    }
+
+    BatchVector out_batches;
+    ASSERT_OK(writer_helper.ReadBatches(&out_batches));
+    ASSERT_EQ(out_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_OK(out_batches[i]->ValidateFull());
+      CompareBatch(*batches[i], *out_batches[i]);
+    }
+  }
+}
+
+TEST_F(TestDictionaryDeltas, FileFormat) {
+  auto dict1 = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  auto dict2 = ArrayFromJSON(utf8(), R"(["a", "b", "c"])");
+  BatchVector batches = {MakeBatch(dict1, "[0, 1, null]"),
+                         MakeBatch(dict2, "[2, 0, 1]")};
+
+  auto options = IpcOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  FileWriterHelper writer_helper;
+  ASSERT_OK(writer_helper.Init(schema_, options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer_helper.WriteBatch(batch));
+  }
+  ASSERT_OK(writer_helper.Finish());
+
+  // All dictionaries are read before the record batches, therefore each batch
+  // is read with the final dictionary
+  BatchVector out_batches;
+  ASSERT_OK(writer_helper.ReadBatches(&out_batches));
+  ASSERT_EQ(out_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_OK(out_batches[i]->ValidateFull());
+    const auto& expected = checked_cast<const DictionaryArray&>(*batches[i]->column(0));
+    const auto& actual = checked_cast<const DictionaryArray&>(*out_batches[i]->column(0));
+    AssertArraysEqual(*expected.indices(), *actual.indices());
+    AssertArraysEqual(*dict2, *actual.dictionary());
+    AssertArraysEqual(*batches[i]->column(1), *out_batches[i]->column(1));
+  }
+
+  // Dictionary replacements are not supported
+  for (bool emit_deltas : {false, true}) {
+    options.emit_dictionary_deltas = emit_deltas;
+    FileWriterHelper replacement_helper;
+    ASSERT_OK(replacement_helper.Init(schema_, options));
+    ASSERT_OK(replacement_helper.WriteBatch(batches[0]));
+    ASSERT_RAISES(Invalid, replacement_helper.WriteBatch(
+                               MakeBatch(ArrayFromJSON(utf8(), R"(["b"])"), "[0]")));
+  }
+  // ... nor deltas when not enabled
+  options.emit_dictionary_deltas = false;
+  FileWriterHelper no_delta_helper;
+  ASSERT_OK(no_delta_helper.Init(schema_, options));
+  ASSERT_OK(no_delta_helper.WriteBatch(batches[0]));
+  ASSERT_RAISES(Invalid, no_delta_helper.WriteBatch(batches[1]));
+}
+
+TEST(TestDictionaryMemo, AddDictionaryDelta) {
+  DictionaryMemo memo;
+  auto f0 = field("f0", dictionary(int32(), utf8()));
+  ASSERT_OK(memo.AddField(0, f0));
+  ASSERT_RAISES(KeyError, memo.AddDictionaryDelta(0, ArrayFromJSON(utf8(), R"(["a"])"),
+                                                  default_memory_pool()));
+
+  ASSERT_OK(memo.AddDictionary(0, ArrayFromJSON(utf8(), R"(["a", "b"])")));
+  ASSERT_OK(memo.AddDictionaryDelta(0, ArrayFromJSON(utf8(), R"(["c"])"),
+                                    default_memory_pool()));
+  std::shared_ptr<Array> dictionary;
+  ASSERT_OK(memo.GetDictionary(0, &dictionary));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "c"])"), *dictionary);
+
+  ASSERT_RAISES(TypeError, memo.AddDictionaryDelta(0, ArrayFromJSON(int32(), "[1]"),
+                                                   default_memory_pool()));
+
+  ASSERT_OK(memo.AddOrReplaceDictionary(0, ArrayFromJSON(utf8(), R"(["d"])")));
+  ASSERT_OK(memo.GetDictionary(0, &dictionary));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["d"])"), *dictionary);
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
@@ -19,6 +19,8 @@
 
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -40,7 +42,13 @@
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
 #include "generated/File_generated.h"  // IWYU pragma: export
@@ -81,6 +89,17 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
     }                                                                 \
   } while (0)
 
+// Get a reader over the body of a message of a type requiring one
+Result<std::shared_ptr<io::RandomAccessFile>> GetMessageBodyReader(
+    const Message& message) {
+  ARROW_ASSIGN_OR_RAISE(auto reader, message.GetBodyReader());
+  if (reader == nullptr) {
+    return Status::IOError("Expected body in IPC message of type ",
+                           FormatMessageType(message.type()));
+  }
+  return reader;
+}
+
 #define CHECK_HAS_NO_BODY(message)                                      \
   do {                                                                  \
     if ((message).body_length() != 0) {                                 \
@@ -97,8 +116,9 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     int64_t body_offset)
+      : metadata_(metadata), file_(file), body_offset_(body_offset) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     auto buffers = metadata_->buffers();
@@ -118,7 +138,8 @@ class IpcComponentSource {
             "Buffer ", buffer_index,
             " did not start on 8-byte aligned offset: ", buffer->offset());
       }
-      return file_->ReadAt(buffer->offset(), buffer->length()).Value(out);
+      return file_->ReadAt(body_offset_ + buffer->offset(), buffer->length())
+          .Value(out);
     }
   }
 
@@ -140,6 +161,8 @@ class IpcComponentSource {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  // Position of the message body in file_
+  int64_t body_offset_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -153,6 +176,8 @@ struct ArrayLoaderContext {
   int buffer_index;
   int field_index;
   int max_recursion_depth;
+  // If true, only walk the field metadata without reading any buffer
+  bool skip_io;
 };
 
 static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayData* out);
@@ -173,6 +198,10 @@ class ArrayLoader {
   }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (context_->skip_io) {
+      out->reset();
+      return Status::OK();
+    }
     return context_->source->GetBuffer(buffer_index, out);
   }
 
@@ -344,6 +373,66 @@ static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayDa
   return loader.Load();
 }
 
+static Status DecompressBuffer(const std::shared_ptr<Buffer>& buffer, util::Codec* codec,
+                               MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  const int64_t prefix_length = sizeof(int64_t);
+  if (buffer->size() < prefix_length) {
+    return Status::IOError("Compressed IPC buffer is too short");
+  }
+  const int64_t uncompressed_length =
+      BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(buffer->data()));
+  if (uncompressed_length == -1) {
+    // Stored uncompressed
+    *out = SliceBuffer(buffer, prefix_length);
+    return Status::OK();
+  }
+  if (uncompressed_length < 0) {
+    return Status::IOError("Invalid uncompressed length for IPC buffer: ",
+                           uncompressed_length);
+  }
+  std::shared_ptr<Buffer> result;
+  RETURN_NOT_OK(AllocateBuffer(pool, uncompressed_length, &result));
+  ARROW_ASSIGN_OR_RAISE(int64_t actual_length,
+                        codec->Decompress(buffer->size() - prefix_length,
+                                          buffer->data() + prefix_length,
+                                          uncompressed_length, result->mutable_data()));
+  if (actual_length != uncompressed_length) {
+    return Status::IOError("Failed to decompress IPC buffer: expected ",
+                           uncompressed_length, " bytes, got ", actual_length);
+  }
+  *out = std::move(result);
+  return Status::OK();
+}
+
+static void CollectBodyBuffers(ArrayData* data,
+                               std::vector<std::shared_ptr<Buffer>*>* out) {
+  for (auto& buffer : data->buffers) {
+    if (buffer != nullptr && buffer->size() > 0) {
+      out->push_back(&buffer);
+    }
+  }
+  for (const auto& child : data->child_data) {
+    CollectBodyBuffers(child.get(), out);
+  }
+}
+
+// Decompress the loaded body buffers in place
+static Status DecompressBuffers(Compression::type compression, const IpcOptions& options,
+                                std::vector<std::shared_ptr<ArrayData>>* arrays) {
+  std::vector<std::shared_ptr<Buffer>*> buffers;
+  for (const auto& array : *arrays) {
+    CollectBodyBuffers(array.get(), &buffers);
+  }
+  auto DecompressOne = [&](int i) {
+    // Not all codecs are safe for concurrent one-shot use, so use one codec
+    // instance per task
+    ARROW_ASSIGN_OR_RAISE(auto codec, util::Codec::Create(compression));
+    return DecompressBuffer(*buffers[i], codec.get(), options.memory_pool, buffers[i]);
+  };
+  return ::arrow::internal::OptionalParallelFor(
+      options.use_threads, static_cast<int>(buffers.size()), DecompressOne);
+}
+
 Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
                        const DictionaryMemo* dictionary_memo, io::RandomAccessFile* file,
                        std::shared_ptr<RecordBatch>* out) {
@@ -355,9 +444,8 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
                        const DictionaryMemo* dictionary_memo,
                        std::shared_ptr<RecordBatch>* out) {
   CHECK_MESSAGE_TYPE(Message::RECORD_BATCH, message.type());
-  CHECK_HAS_BODY(message);
   auto options = IpcOptions::Defaults();
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetMessageBodyReader(message));
   return ReadRecordBatch(*message.metadata(), schema, dictionary_memo, options,
                          reader.get(), out);
 }
@@ -365,43 +453,91 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
 // ----------------------------------------------------------------------
 // Array loading
 
+// Compute which top-level fields of `schema` are read
+static Status GetInclusionMask(const Schema& schema,
+                               const std::vector<int>& included_fields,
+                               std::vector<bool>* inclusion_mask) {
+  inclusion_mask->assign(schema.num_fields(), included_fields.empty());
+  for (int i : included_fields) {
+    if (i < 0 || i >= schema.num_fields()) {
+      return Status::Invalid("Out of bounds field index: ", i, " for schema with ",
+                             schema.num_fields(), " fields");
+    }
+    (*inclusion_mask)[i] = true;
+  }
+  return Status::OK();
+}
+
+static std::shared_ptr<Schema> GetIncludedSchema(
+    const std::shared_ptr<Schema>& schema, const std::vector<bool>& inclusion_mask) {
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if (inclusion_mask[i]) {
+      fields.push_back(schema->field(i));
+    }
+  }
+  if (static_cast<int>(fields.size()) == schema->num_fields()) {
+    return schema;
+  }
+  return ::arrow::schema(std::move(fields), schema->metadata());
+}
+
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
-                                        int64_t num_rows, int max_recursion_depth,
+                                        int64_t num_rows, Compression::type compression,
+                                        const IpcOptions& options,
                                         IpcComponentSource* source,
                                         const DictionaryMemo* dictionary_memo,
                                         std::shared_ptr<RecordBatch>* out) {
   ArrayLoaderContext context{source, dictionary_memo, /*field_index=*/0,
-                             /*buffer_index=*/0, max_recursion_depth};
+                             /*buffer_index=*/0, options.max_recursion_depth,
+                             /*skip_io=*/false};
 
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
+  std::vector<bool> inclusion_mask;
+  RETURN_NOT_OK(GetInclusionMask(*schema, options.included_fields, &inclusion_mask));
+
+  std::vector<std::shared_ptr<ArrayData>> arrays;
   for (int i = 0; i < schema->num_fields(); ++i) {
     auto arr = std::make_shared<ArrayData>();
+    // Excluded fields must still be walked to find where the next field's
+    // nodes and buffers start
+    context.skip_io = !inclusion_mask[i];
     RETURN_NOT_OK(LoadArray(*schema->field(i), &context, arr.get()));
+    if (!inclusion_mask[i]) {
+      continue;
+    }
     if (num_rows != arr->length) {
       return Status::IOError("Array length did not match record batch length");
     }
-    arrays[i] = std::move(arr);
+    arrays.push_back(std::move(arr));
   }
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  if (compression != Compression::UNCOMPRESSED) {
+    RETURN_NOT_OK(DecompressBuffers(compression, options, &arrays));
+  }
+
+  *out = RecordBatch::Make(GetIncludedSchema(schema, inclusion_mask), num_rows,
+                           std::move(arrays));
   return Status::OK();
 }
 
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
                                      const DictionaryMemo* dictionary_memo,
+                                     Compression::type compression,
                                      const IpcOptions& options,
-                                     io::RandomAccessFile* file,
+                                     io::RandomAccessFile* file, int64_t body_offset,
                                      std::shared_ptr<RecordBatch>* out) {
-  IpcComponentSource source(metadata, file);
-  return LoadRecordBatchFromSource(schema, metadata->length(),
-                                   options.max_recursion_depth, &source, dictionary_memo,
-                                   out);
+  IpcComponentSource source(metadata, file, body_offset);
+  return LoadRecordBatchFromSource(schema, metadata->length(), compression, options,
+                                   &source, dictionary_memo, out);
 }
 
-Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-                       const DictionaryMemo* dictionary_memo, const IpcOptions& options,
-                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+// Read a record batch whose body starts at `body_offset` in `file`
+static Status ReadRecordBatchAt(const Buffer& metadata,
+                                const std::shared_ptr<Schema>& schema,
+                                const DictionaryMemo* dictionary_memo,
+                                const IpcOptions& options, io::RandomAccessFile* file,
+                                int64_t body_offset, std::shared_ptr<RecordBatch>* out) {
   const flatbuf::Message* message;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
@@ -409,7 +545,17 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
     return Status::IOError(
         "Header-type of flatbuffer-encoded Message is not RecordBatch.");
   }
-  return ReadRecordBatch(batch, schema, dictionary_memo, options, file, out);
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(message, &compression));
+  return ReadRecordBatch(batch, schema, dictionary_memo, compression, options, file,
+                         body_offset, out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const DictionaryMemo* dictionary_memo, const IpcOptions& options,
+                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatchAt(metadata, schema, dictionary_memo, options, file,
+                           /*body_offset=*/0, out);
 }
 
 Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
@@ -437,13 +583,19 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
   std::shared_ptr<RecordBatch> batch;
   auto batch_meta = dictionary_batch->data();
   CHECK_FLATBUFFERS_NOT_NULL(batch_meta, "DictionaryBatch.data");
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(message, &compression));
   RETURN_NOT_OK(ReadRecordBatch(batch_meta, ::arrow::schema({value_field}),
-                                dictionary_memo, options, file, &batch));
+                                dictionary_memo, compression, options, file,
+                                /*body_offset=*/0, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
   auto dictionary = batch->column(0);
-  return dictionary_memo->AddDictionary(id, dictionary);
+  if (dictionary_batch->isDelta()) {
+    return dictionary_memo->AddDictionaryDelta(id, dictionary, default_memory_pool());
+  }
+  return dictionary_memo->AddOrReplaceDictionary(id, dictionary);
 }
 
 // ----------------------------------------------------------------------
@@ -458,8 +610,9 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
   RecordBatchStreamReaderImpl() {}
   ~RecordBatchStreamReaderImpl() {}
 
-  Status Open(std::unique_ptr<MessageReader> message_reader) {
+  Status Open(std::unique_ptr<MessageReader> message_reader, const IpcOptions& options) {
     message_reader_ = std::move(message_reader);
+    options_ = options;
     return ReadSchema();
   }
 
@@ -471,14 +624,17 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     }
     CHECK_MESSAGE_TYPE(Message::SCHEMA, message->type());
     CHECK_HAS_NO_BODY(*message);
-    return internal::GetSchema(message->header(), &dictionary_memo_, &schema_);
+    RETURN_NOT_OK(internal::GetSchema(message->header(), &dictionary_memo_, &schema_));
+    std::vector<bool> inclusion_mask;
+    RETURN_NOT_OK(GetInclusionMask(*schema_, options_.included_fields, &inclusion_mask));
+    out_schema_ = GetIncludedSchema(schema_, inclusion_mask);
+    return Status::OK();
   }
 
   Status ParseDictionary(const Message& message) {
     // Only invoke this method if we already know we have a dictionary message
     DCHECK_EQ(message.type(), Message::DICTIONARY_BATCH);
-    CHECK_HAS_BODY(message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+    ARROW_ASSIGN_OR_RAISE(auto reader, GetMessageBodyReader(message));
     return ReadDictionary(*message.metadata(), &dictionary_memo_, reader.get());
   }
 
@@ -533,28 +689,31 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     }
 
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
-    if (message == nullptr) {
-      // End of stream
-      *batch = nullptr;
-      return Status::OK();
+    while (true) {
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+      if (message == nullptr) {
+        // End of stream
+        *batch = nullptr;
+        return Status::OK();
+      }
+      if (message->type() != Message::DICTIONARY_BATCH) {
+        break;
+      }
+      // A dictionary delta or replacement, applying to the following batches
+      RETURN_NOT_OK(ParseDictionary(*message));
     }
 
-    if (message->type() == Message::DICTIONARY_BATCH) {
-      // TODO(wesm): implement delta dictionaries
-      return Status::NotImplemented("Delta dictionaries not yet implemented");
-    } else {
-      CHECK_HAS_BODY(*message);
-      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-      return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                             reader.get(), batch);
-    }
+    CHECK_MESSAGE_TYPE(Message::RECORD_BATCH, message->type());
+    ARROW_ASSIGN_OR_RAISE(auto reader, GetMessageBodyReader(*message));
+    return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_, options_,
+                           reader.get(), batch);
   }
 
-  std::shared_ptr<Schema> schema() const { return schema_; }
+  std::shared_ptr<Schema> schema() const { return out_schema_; }
 
  private:
   std::unique_ptr<MessageReader> message_reader_;
+  IpcOptions options_;
 
   bool read_initial_dictionaries_ = false;
 
@@ -564,8 +723,43 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
   DictionaryMemo dictionary_memo_;
   std::shared_ptr<Schema> schema_;
+  // Schema of the read record batches, with only the included fields
+  std::shared_ptr<Schema> out_schema_;
+};
+
+namespace {
+
+// A RecordBatchReader reading batches ahead from another RecordBatchReader
+// in a background thread
+class ReadaheadRecordBatchReader : public RecordBatchReader {
+ public:
+  ReadaheadRecordBatchReader(std::shared_ptr<Schema> schema,
+                             Iterator<std::shared_ptr<RecordBatch>> it)
+      : schema_(std::move(schema)), it_(std::move(it)) {}
+
+  static Result<std::shared_ptr<RecordBatchReader>> Make(
+      std::shared_ptr<RecordBatchReader> reader, int readahead) {
+    auto schema = reader->schema();
+    auto it = MakeFunctionIterator([reader]() { return reader->Next(); });
+    ARROW_ASSIGN_OR_RAISE(auto readahead_it,
+                          MakeReadaheadIterator(std::move(it), readahead));
+    return std::make_shared<ReadaheadRecordBatchReader>(std::move(schema),
+                                                        std::move(readahead_it));
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    return it_.Next().Value(batch);
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  Iterator<std::shared_ptr<RecordBatch>> it_;
 };
 
+}  // namespace
+
 RecordBatchStreamReader::RecordBatchStreamReader() {
   impl_.reset(new RecordBatchStreamReaderImpl());
 }
@@ -576,7 +770,7 @@ Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_read
                                      std::shared_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), IpcOptions::Defaults()));
   *reader = result;
   return Status::OK();
 }
@@ -585,7 +779,7 @@ Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_read
                                      std::unique_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::unique_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), IpcOptions::Defaults()));
   *reader = std::move(result);
   return Status::OK();
 }
@@ -600,6 +794,25 @@ Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& str
   return Open(MessageReader::Open(stream), out);
 }
 
+Result<std::shared_ptr<RecordBatchReader>> RecordBatchStreamReader::Open(
+    std::unique_ptr<MessageReader> message_reader, const IpcOptions& options) {
+  if (options.readahead_batches < 0) {
+    return Status::Invalid("readahead_batches must be positive or zero");
+  }
+  // Private ctor
+  auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), options));
+  if (options.readahead_batches == 0) {
+    return result;
+  }
+  return ReadaheadRecordBatchReader::Make(std::move(result), options.readahead_batches);
+}
+
+Result<std::shared_ptr<RecordBatchReader>> RecordBatchStreamReader::Open(
+    const std::shared_ptr<io::InputStream>& stream, const IpcOptions& options) {
+  return Open(MessageReader::Open(stream, options.memory_pool), options);
+}
+
 std::shared_ptr<Schema> RecordBatchStreamReader::schema() const {
   return impl_->schema();
 }
@@ -676,13 +889,17 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
 
-  Status ReadMessageFromBlock(const FileBlock& block, std::unique_ptr<Message>* out) {
+  Status CheckBlockAligned(const FileBlock& block) {
     if (!BitUtil::IsMultipleOf8(block.offset) ||
         !BitUtil::IsMultipleOf8(block.metadata_length) ||
         !BitUtil::IsMultipleOf8(block.body_length)) {
       return Status::Invalid("Unaligned block in IPC file");
     }
+    return Status::OK();
+  }
 
+  Status ReadMessageFromBlock(const FileBlock& block, std::unique_ptr<Message>* out) {
+    RETURN_NOT_OK(CheckBlockAligned(block));
     RETURN_NOT_OK(ReadMessage(block.offset, block.metadata_length, file_, out));
 
     // TODO(wesm): this breaks integration tests, see ARROW-3256
@@ -696,50 +913,81 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       std::unique_ptr<Message> message;
       RETURN_NOT_OK(ReadMessageFromBlock(GetDictionaryBlock(i), &message));
 
-      CHECK_HAS_BODY(*message);
-      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+      ARROW_ASSIGN_OR_RAISE(auto reader, GetMessageBodyReader(*message));
       RETURN_NOT_OK(
           ReadDictionary(*message->metadata(), &dictionary_memo_, reader.get()));
     }
     return Status::OK();
   }
 
+  Status EnsureDictionariesRead() {
+    if (!read_dictionaries_) {
+      RETURN_NOT_OK(ReadDictionaries());
+      read_dictionaries_ = true;
+    }
+    return Status::OK();
+  }
+
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
+    return ReadRecordBatch(i, options_, batch);
+  }
+
+  // Read a record batch with options overriding those the file was opened with
+  Status ReadRecordBatch(int i, const IpcOptions& options,
+                         std::shared_ptr<RecordBatch>* batch) {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
 
-    if (!read_dictionaries_) {
-      RETURN_NOT_OK(ReadDictionaries());
-      read_dictionaries_ = true;
+    RETURN_NOT_OK(EnsureDictionariesRead());
+
+    const FileBlock block = GetRecordBatchBlock(i);
+    if (!options.included_fields.empty()) {
+      // Only read the metadata, then the buffers of the included fields
+      // directly from the file
+      RETURN_NOT_OK(CheckBlockAligned(block));
+      std::shared_ptr<Buffer> metadata;
+      int64_t body_length = -1;
+      RETURN_NOT_OK(ReadMessageMetadata(block.offset, block.metadata_length, file_,
+                                        &metadata, &body_length));
+      return ReadRecordBatchAt(*metadata, schema_, &dictionary_memo_, options, file_,
+                               block.offset + block.metadata_length, batch);
     }
 
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
+    RETURN_NOT_OK(ReadMessageFromBlock(block, &message));
 
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    ARROW_ASSIGN_OR_RAISE(auto reader, GetMessageBodyReader(*message));
     return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                                         reader.get(), batch);
+                                         options, reader.get(), batch);
   }
 
   Status ReadSchema() {
     // Get the schema and record any observed dictionaries
-    return internal::GetSchema(footer_->schema(), &dictionary_memo_, &schema_);
+    RETURN_NOT_OK(internal::GetSchema(footer_->schema(), &dictionary_memo_, &schema_));
+    std::vector<bool> inclusion_mask;
+    RETURN_NOT_OK(GetInclusionMask(*schema_, options_.included_fields, &inclusion_mask));
+    out_schema_ = GetIncludedSchema(schema_, inclusion_mask);
+    return Status::OK();
   }
 
-  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset) {
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
+              const IpcOptions& options) {
     owned_file_ = file;
-    return Open(file.get(), footer_offset);
+    return Open(file.get(), footer_offset, options);
   }
 
-  Status Open(io::RandomAccessFile* file, int64_t footer_offset) {
+  Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+              const IpcOptions& options) {
     file_ = file;
     footer_offset_ = footer_offset;
+    options_ = options;
     RETURN_NOT_OK(ReadFooter());
     return ReadSchema();
   }
 
-  std::shared_ptr<Schema> schema() const { return schema_; }
+  std::shared_ptr<Schema> schema() const { return out_schema_; }
+
+  const IpcOptions& options() const { return options_; }
 
  private:
   io::RandomAccessFile* file_;
@@ -757,8 +1005,12 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
 
+  IpcOptions options_;
+
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
+  // Schema of the read record batches, with only the included fields
+  std::shared_ptr<Schema> out_schema_;
 };
 
 RecordBatchFileReader::RecordBatchFileReader() {
@@ -775,8 +1027,7 @@ Status RecordBatchFileReader::Open(io::RandomAccessFile* file,
 
 Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
-  *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return Open(file, footer_offset, IpcOptions::Defaults()).Value(reader);
 }
 
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
@@ -788,8 +1039,34 @@ Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>&
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
                                    int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
-  *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return Open(file, footer_offset, IpcOptions::Defaults()).Value(reader);
+}
+
+Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
+    io::RandomAccessFile* file, const IpcOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(int64_t footer_offset, file->GetSize());
+  return Open(file, footer_offset, options);
+}
+
+Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
+    io::RandomAccessFile* file, int64_t footer_offset, const IpcOptions& options) {
+  std::shared_ptr<RecordBatchFileReader> reader(new RecordBatchFileReader());
+  RETURN_NOT_OK(reader->impl_->Open(file, footer_offset, options));
+  return reader;
+}
+
+Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
+    const std::shared_ptr<io::RandomAccessFile>& file, const IpcOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(int64_t footer_offset, file->GetSize());
+  return Open(file, footer_offset, options);
+}
+
+Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
+    const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
+    const IpcOptions& options) {
+  std::shared_ptr<RecordBatchFileReader> reader(new RecordBatchFileReader());
+  RETURN_NOT_OK(reader->impl_->Open(file, footer_offset, options));
+  return reader;
 }
 
 std::shared_ptr<Schema> RecordBatchFileReader::schema() const { return impl_->schema(); }
@@ -805,6 +1082,96 @@ Status RecordBatchFileReader::ReadRecordBatch(int i,
   return impl_->ReadRecordBatch(i, batch);
 }
 
+Status RecordBatchFileReader::ReadRecordBatch(int i, const IpcOptions& options,
+                                              std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadRecordBatch(i, options, batch);
+}
+
+namespace {
+
+// A RecordBatchReader over the record batches of a file, in order.  Up to
+// `readahead` batches are read and decoded concurrently on the CPU thread pool
+// with `read_ahead`; if `readahead` is 0, batches are read on the caller's thread.
+class FileRecordBatchReader : public RecordBatchReader {
+ public:
+  using ReadFunction = std::function<Status(int, std::shared_ptr<RecordBatch>*)>;
+
+  FileRecordBatchReader(RecordBatchFileReader* reader, int readahead,
+                        ReadFunction read_ahead)
+      : reader_(reader), readahead_(readahead), read_ahead_(std::move(read_ahead)) {}
+
+  ~FileRecordBatchReader() override {
+    // The pending tasks reference the file reader
+    for (const auto& fut : pending_) {
+      fut.Wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return reader_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (readahead_ == 0) {
+      if (next_index_ == reader_->num_record_batches()) {
+        batch->reset();
+        return Status::OK();
+      }
+      return reader_->ReadRecordBatch(next_index_++, batch);
+    }
+
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    while (static_cast<int>(pending_.size()) < readahead_ &&
+           next_index_ < reader_->num_record_batches()) {
+      const ReadFunction* read = &read_ahead_;
+      const int i = next_index_++;
+      ARROW_ASSIGN_OR_RAISE(
+          auto fut, pool->Submit([read, i]() -> Result<std::shared_ptr<RecordBatch>> {
+            std::shared_ptr<RecordBatch> batch;
+            RETURN_NOT_OK((*read)(i, &batch));
+            return batch;
+          }));
+      pending_.push_back(std::move(fut));
+    }
+    if (pending_.empty()) {
+      batch->reset();
+      return Status::OK();
+    }
+    auto fut = std::move(pending_.front());
+    pending_.pop_front();
+    return fut.MoveResult().Value(batch);
+  }
+
+ private:
+  RecordBatchFileReader* reader_;
+  const int readahead_;
+  const ReadFunction read_ahead_;
+  int next_index_ = 0;
+  std::deque<Future<std::shared_ptr<RecordBatch>>> pending_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatchReader>> RecordBatchFileReader::GetRecordBatchReader() {
+  const IpcOptions& options = impl_->options();
+  if (options.readahead_batches < 0) {
+    return Status::Invalid("readahead_batches must be positive or zero");
+  }
+  // Dictionaries must be read before record batches are read concurrently
+  RETURN_NOT_OK(impl_->EnsureDictionariesRead());
+  const int readahead = options.use_threads ? options.readahead_batches : 0;
+
+  // Each batch read ahead occupies a CPU pool thread, so its buffers are
+  // decompressed serially: waiting on nested decompression tasks, which may be
+  // queued behind other readahead tasks, could deadlock the pool
+  IpcOptions read_ahead_options = options;
+  read_ahead_options.use_threads = false;
+  RecordBatchFileReaderImpl* impl = impl_.get();
+  auto read_ahead = [impl, read_ahead_options](int i,
+                                               std::shared_ptr<RecordBatch>* batch) {
+    return impl->ReadRecordBatch(i, read_ahead_options, batch);
+  };
+  return std::make_shared<FileRecordBatchReader>(this, readahead, std::move(read_ahead));
+}
+
 static Status ReadContiguousPayload(io::InputStream* file,
                                     std::unique_ptr<Message>* message) {
   RETURN_NOT_OK(ReadMessage(file, message));
@@ -838,8 +1205,7 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
   auto options = IpcOptions::Defaults();
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
-  CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetMessageBodyReader(*message));
   return ReadRecordBatch(*message->metadata(), schema, dictionary_memo, options,
                          reader.get(), out);
 }
@@ -1148,8 +1514,7 @@ Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(const Buffer& metadata,
 }
 
 Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(const Message& message) {
-  CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetMessageBodyReader(message));
   return ReadSparseTensor(*message.metadata(), reader.get());
 }
 
@@ -1157,8 +1522,7 @@ Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(io::InputStream* file) {
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
   CHECK_MESSAGE_TYPE(Message::SPARSE_TENSOR, message->type());
-  CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetMessageBodyReader(*message));
   return ReadSparseTensor(*message->metadata(), reader.get());
 }
 
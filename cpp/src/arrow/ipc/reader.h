@@ -85,6 +85,25 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(const std::shared_ptr<io::InputStream>& stream,
                      std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Create batch reader from generic MessageReader, with options
+  ///
+  /// If options.readahead_batches > 0, the returned reader reads record
+  /// batches in a background thread, up to that many batches ahead.
+  ///
+  /// \param[in] message_reader a MessageReader implementation
+  /// \param[in] options options for reading record batches
+  /// \return the created RecordBatchReader object
+  static Result<std::shared_ptr<RecordBatchReader>> Open(
+      std::unique_ptr<MessageReader> message_reader, const IpcOptions& options);
+
+  /// \brief Open stream with options and retain ownership of stream object
+  ///
+  /// \param[in] stream the input stream
+  /// \param[in] options options for reading record batches
+  /// \return the created RecordBatchReader object
+  static Result<std::shared_ptr<RecordBatchReader>> Open(
+      const std::shared_ptr<io::InputStream>& stream, const IpcOptions& options);
+
   /// \brief Returns the schema read from the stream
   std::shared_ptr<Schema> schema() const override;
 
@@ -143,7 +162,36 @@ class ARROW_EXPORT RecordBatchFileReader {
                      int64_t footer_offset,
                      std::shared_ptr<RecordBatchFileReader>* reader);
 
-  /// \brief The schema read from the file
+  /// \brief Open a RecordBatchFileReader with the given options
+  ///
+  /// If options.included_fields is not empty, only those fields are read,
+  /// and only the body ranges of their buffers are fetched from the file.
+  ///
+  /// \param[in] file the data source
+  /// \param[in] options options for reading record batches
+  /// \return the returned reader
+  static Result<std::shared_ptr<RecordBatchFileReader>> Open(
+      io::RandomAccessFile* file, const IpcOptions& options);
+
+  /// \brief Open a RecordBatchFileReader with the given options
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] options options for reading record batches
+  /// \return the returned reader
+  static Result<std::shared_ptr<RecordBatchFileReader>> Open(
+      io::RandomAccessFile* file, int64_t footer_offset, const IpcOptions& options);
+
+  /// \brief Version of Open with options that retains ownership of file
+  static Result<std::shared_ptr<RecordBatchFileReader>> Open(
+      const std::shared_ptr<io::RandomAccessFile>& file, const IpcOptions& options);
+
+  /// \brief Version of Open with options that retains ownership of file
+  static Result<std::shared_ptr<RecordBatchFileReader>> Open(
+      const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
+      const IpcOptions& options);
+
+  /// \brief The schema read from the file, restricted to the included fields
   std::shared_ptr<Schema> schema() const;
 
   /// \brief Returns the number of record batches in the file
@@ -160,6 +208,30 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Read a particular record batch from the file, with options
+  /// overriding those the reader was opened with
+  ///
+  /// This allows choosing options.included_fields from schema() without
+  /// opening the file again.  The field indices refer to the fields of the
+  /// file, whatever fields the reader was opened with.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] options options for reading the record batch
+  /// \param[out] batch the read batch
+  /// \return Status
+  Status ReadRecordBatch(int i, const IpcOptions& options,
+                         std::shared_ptr<RecordBatch>* batch);
+
+  /// \brief Return a reader over all the record batches in the file, in order
+  ///
+  /// If the file reader was opened with options.use_threads and
+  /// options.readahead_batches > 0, up to that many record batches are read
+  /// and decoded concurrently on the CPU thread pool.  The returned reader
+  /// must not outlive this file reader.
+  ///
+  /// \return the created RecordBatchReader object
+  Result<std::shared_ptr<RecordBatchReader>> GetRecordBatchReader();
+
  private:
   RecordBatchFileReader();
 
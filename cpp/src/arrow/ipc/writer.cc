@@ -44,8 +44,10 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -157,7 +159,55 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, options_.compression, &out_->metadata);
+  }
+
+  Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
+                        std::shared_ptr<Buffer>* out) {
+    // Prefix the compressed data with the uncompressed length
+    const int64_t prefix_length = sizeof(int64_t);
+    const int64_t max_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
+    std::shared_ptr<ResizableBuffer> result;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, prefix_length + max_length, &result));
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t actual_length,
+        codec->Compress(buffer.size(), buffer.data(), max_length,
+                        result->mutable_data() + prefix_length));
+    int64_t uncompressed_length = buffer.size();
+    if (actual_length >= buffer.size()) {
+      // Not worth it: store the data as-is so that the reader doesn't have to
+      // decompress it
+      uncompressed_length = -1;
+      actual_length = buffer.size();
+      std::memcpy(result->mutable_data() + prefix_length, buffer.data(), buffer.size());
+    }
+    uncompressed_length = BitUtil::ToLittleEndian(uncompressed_length);
+    std::memcpy(result->mutable_data(), &uncompressed_length, prefix_length);
+    RETURN_NOT_OK(result->Resize(prefix_length + actual_length, /*shrink_to_fit=*/true));
+    *out = std::move(result);
+    return Status::OK();
+  }
+
+  Status CompressBodyBuffers() {
+    if (options_.compression != Compression::LZ4 &&
+        options_.compression != Compression::ZSTD) {
+      return Status::Invalid("Unsupported IPC body compression: ",
+                             util::Codec::GetCodecAsString(options_.compression));
+    }
+    auto CompressOne = [&](int i) {
+      auto& buffer = out_->body_buffers[i];
+      if (buffer == nullptr || buffer->size() == 0) {
+        return Status::OK();
+      }
+      // Not all codecs are safe for concurrent one-shot use, so use one
+      // codec instance per task
+      ARROW_ASSIGN_OR_RAISE(
+          auto codec,
+          util::Codec::Create(options_.compression, options_.compression_level));
+      return CompressBuffer(*buffer, codec.get(), &buffer);
+    };
+    return ::arrow::internal::OptionalParallelFor(
+        options_.use_threads, static_cast<int>(out_->body_buffers.size()), CompressOne);
   }
 
   Status Assemble(const RecordBatch& batch) {
@@ -172,6 +222,11 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    const bool compressed = options_.compression != Compression::UNCOMPRESSED;
+    if (compressed) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -190,7 +245,8 @@ class RecordBatchSerializer : public ArrayVisitor {
         padding = BitUtil::RoundUpToMultipleOf8(size) - size;
       }
 
-      buffer_meta_.push_back({offset, size + padding});
+      // The decompressor needs the exact size of compressed buffers
+      buffer_meta_.push_back({offset, compressed ? size : size + padding});
       offset += size + padding;
     }
 
@@ -511,14 +567,17 @@ class RecordBatchSerializer : public ArrayVisitor {
 
 class DictionaryWriter : public RecordBatchSerializer {
  public:
-  DictionaryWriter(int64_t dictionary_id, MemoryPool* pool, int64_t buffer_start_offset,
-                   const IpcOptions& options, IpcPayload* out)
+  DictionaryWriter(int64_t dictionary_id, bool is_delta, MemoryPool* pool,
+                   int64_t buffer_start_offset, const IpcOptions& options,
+                   IpcPayload* out)
       : RecordBatchSerializer(pool, buffer_start_offset, options, out),
-        dictionary_id_(dictionary_id) {}
+        dictionary_id_(dictionary_id),
+        is_delta_(is_delta) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+    return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, out_->body_length,
+                                  field_nodes_, buffer_meta_, options_.compression,
+                                  &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -530,6 +589,7 @@ class DictionaryWriter : public RecordBatchSerializer {
 
  private:
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 Status WriteIpcPayload(const IpcPayload& payload, const IpcOptions& options,
@@ -540,26 +600,26 @@ Status WriteIpcPayload(const IpcPayload& payload, const IpcOptions& options,
   RETURN_NOT_OK(CheckAligned(dst));
 #endif
 
-  // Now write the buffers
-  for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
-    const std::shared_ptr<Buffer>& buffer = payload.body_buffers[i];
-    int64_t size = 0;
-    int64_t padding = 0;
-
+  // Now write the buffers and their padding, in a single gathered write
+  static const auto padding_buffer =
+      std::make_shared<Buffer>(kPaddingBytes, sizeof(kPaddingBytes));
+  std::vector<std::shared_ptr<Buffer>> body;
+  body.reserve(payload.body_buffers.size() * 2);
+  for (const std::shared_ptr<Buffer>& buffer : payload.body_buffers) {
     // The buffer might be null if we are handling zero row lengths.
-    if (buffer) {
-      size = buffer->size();
-      padding = BitUtil::RoundUpToMultipleOf8(size) - size;
-    }
-
-    if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer));
+    if (!buffer || buffer->size() == 0) {
+      continue;
     }
-
+    const int64_t size = buffer->size();
+    const int64_t padding = BitUtil::RoundUpToMultipleOf8(size) - size;
+    body.push_back(buffer);
     if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+      body.push_back(SliceBuffer(padding_buffer, 0, padding));
     }
   }
+  if (!body.empty()) {
+    RETURN_NOT_OK(dst->Write(body));
+  }
 
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
@@ -577,9 +637,16 @@ Status GetSchemaPayload(const Schema& schema, const IpcOptions& options,
 Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* out) {
+  return GetDictionaryPayload(id, /*is_delta=*/false, dictionary, options, pool, out);
+}
+
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* out) {
   out->type = Message::DICTIONARY_BATCH;
   // Frame of reference is 0, see ARROW-384
-  DictionaryWriter writer(id, pool, /*buffer_start_offset=*/0, options, out);
+  DictionaryWriter writer(id, is_delta, pool, /*buffer_start_offset=*/0, options, out);
   return writer.Assemble(dictionary);
 }
 
@@ -940,13 +1007,7 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
 
     RETURN_NOT_OK(CheckStarted());
 
-    if (!wrote_dictionaries_) {
-      RETURN_NOT_OK(WriteDictionaries(batch));
-      wrote_dictionaries_ = true;
-    }
-
-    // TODO(wesm): Check for delta dictionaries. Can we scan for
-    // deltas while computing the RecordBatch payload to save time?
+    RETURN_NOT_OK(WriteDictionaries(batch));
 
     internal::IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, pool_, &payload));
@@ -977,17 +1038,44 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Write the dictionaries of the batch that were not written yet or that
+  // changed since they were last written, either in full or as deltas
   Status WriteDictionaries(const RecordBatch& batch) {
-    RETURN_NOT_OK(CollectDictionaries(batch, dictionary_memo_));
+    // The dictionary ids were assigned to the fields of schema_ when writing
+    // the schema
+    DictionaryVector dictionaries;
+    RETURN_NOT_OK(CollectDictionaries(schema_, batch, *dictionary_memo_, &dictionaries));
 
-    for (auto& pair : dictionary_memo_->id_to_dictionary()) {
-      internal::IpcPayload payload;
-      int64_t dictionary_id = pair.first;
+    for (const auto& pair : dictionaries) {
+      const int64_t dictionary_id = pair.first;
       const auto& dictionary = pair.second;
+      bool is_delta = false;
+      std::shared_ptr<Array> to_write = dictionary;
+
+      if (dictionary_memo_->HasDictionary(dictionary_id)) {
+        std::shared_ptr<Array> last;
+        RETURN_NOT_OK(dictionary_memo_->GetDictionary(dictionary_id, &last));
+        if (last.get() == dictionary.get() || last->Equals(*dictionary)) {
+          continue;
+        }
+        const int64_t last_length = last->length();
+        if (options_.emit_dictionary_deltas && dictionary->length() > last_length &&
+            dictionary->Slice(0, last_length)->Equals(*last)) {
+          is_delta = true;
+          to_write = dictionary->Slice(last_length);
+        } else if (is_file_format_) {
+          return Status::Invalid(
+              "Dictionary replacement detected when writing IPC file format. "
+              "Arrow IPC files only support a single dictionary for a given field "
+              "across all batches, possibly extended with deltas.");
+        }
+      }
 
-      RETURN_NOT_OK(
-          GetDictionaryPayload(dictionary_id, dictionary, options_, pool_, &payload));
+      internal::IpcPayload payload;
+      RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, is_delta, to_write, options_,
+                                         pool_, &payload));
       RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+      RETURN_NOT_OK(dictionary_memo_->AddOrReplaceDictionary(dictionary_id, dictionary));
     }
     return Status::OK();
   }
@@ -1000,7 +1088,8 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
   DictionaryMemo* dictionary_memo_;
   DictionaryMemo internal_dict_memo_;
   bool started_ = false;
-  bool wrote_dictionaries_ = false;
+  // Dictionary replacements are not allowed in the file format
+  bool is_file_format_ = false;
   IpcOptions options_;
 };
 
@@ -1175,7 +1264,9 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl : public RecordBatchPaylo
                             const IpcOptions& options)
       : RecordBatchPayloadWriter(std::unique_ptr<internal::IpcPayloadWriter>(
                                      new PayloadFileWriter(options, schema, sink)),
-                                 schema, options) {}
+                                 schema, options) {
+    is_file_format_ = true;
+  }
 
   ~RecordBatchFileWriterImpl() = default;
 };
@@ -1266,6 +1357,15 @@ Result<std::unique_ptr<RecordBatchWriter>> OpenRecordBatchWriter(
       new RecordBatchPayloadWriter(std::move(sink), schema, options));
 }
 
+Result<std::unique_ptr<RecordBatchWriter>> StartRecordBatchWriter(
+    std::unique_ptr<IpcPayloadWriter> sink, const std::shared_ptr<Schema>& schema,
+    const IpcOptions& options) {
+  std::unique_ptr<RecordBatchPayloadWriter> writer(
+      new RecordBatchPayloadWriter(std::move(sink), schema, options));
+  RETURN_NOT_OK(writer->Start());
+  return std::unique_ptr<RecordBatchWriter>(std::move(writer));
+}
+
 }  // namespace internal
 
 // ----------------------------------------------------------------------
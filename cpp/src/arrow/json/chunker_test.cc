@@ -243,6 +243,31 @@ TEST(ChunkerTest, SingleLine) {
   AssertChunking(*chunker, single_line, object_count);
 }
 
+TEST(ChunkerTest, BracesInStrings) {
+  // Braces and brackets inside strings, including after escaped quotes, don't count
+  auto chunker = MakeChunker(true);
+  const std::vector<std::string> objects = {
+      R"({"a": "}{", "b": ["]", {"c": "\"}"}]})",
+      "{\"a\": \"\\\\\",\n \"b\": [[], {}]}",
+      R"({"a": "\\\"{"})",
+  };
+  auto json = join(objects, "\n");
+  std::shared_ptr<Buffer> whole, partial;
+  ASSERT_OK(chunker->Process(json, &whole, &partial));
+  ASSERT_EQ(whole->size(), json->size());
+  ASSERT_EQ(partial->size(), 0);
+
+  // Cut before the last closing brace
+  const auto last_start = json->size() - objects[2].size() - 1;
+  ASSERT_OK(chunker->Process(SliceBuffer(json, 0, json->size() - 2), &whole, &partial));
+  ASSERT_EQ(whole->size(), last_start);
+
+  std::shared_ptr<Buffer> completion, rest;
+  ASSERT_OK(chunker->ProcessWithPartial(SliceBuffer(json, 0, 10), SliceBuffer(json, 10),
+                                        &completion, &rest));
+  ASSERT_EQ(completion->size(), objects[0].size() - 10);
+}
+
 TEST_P(BaseChunkerTest, Straddling) {
   AssertStraddledChunking(*chunker_, join(lines(), "\n"));
 }
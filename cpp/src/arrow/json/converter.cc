@@ -114,6 +114,11 @@ class NumericConverter : public PrimitiveConverter {
     if (in->type_id() == Type::NA) {
       return MakeArrayOfNull(pool_, out_type_, in->length(), out);
     }
+    if (in->type()->Equals(*out_type_)) {
+      // already converted by the parser
+      *out = in;
+      return Status::OK();
+    }
     const auto& dict_array = GetDictionaryArray(in);
 
     using Builder = typename TypeTraits<T>::BuilderType;
@@ -36,7 +36,8 @@ namespace json {
 /// \brief interface for conversion of Arrays
 ///
 /// Converters are not required to be correct for arbitrary input- only
-/// for unconverted arrays emitted by a corresponding parser.
+/// for unconverted arrays emitted by a corresponding parser. Arrays which the
+/// parser already converted to out_type are passed through.
 class ARROW_EXPORT Converter {
  public:
   virtual ~Converter() = default;
@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "arrow/json/rapidjson_defs.h"
+#include "arrow/json/structural_index.h"
 #include "rapidjson/error/en.h"
 #include "rapidjson/reader.h"
 
@@ -35,6 +36,7 @@
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parsing.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/trie.h"
 #include "arrow/visitor_inline.h"
@@ -99,6 +101,7 @@ Status Kind::ForType(const DataType& type, Kind::type* kind) {
     Status Visit(const NumberType&) { return SetKind(Kind::kNumber); }
     Status Visit(const TimeType&) { return SetKind(Kind::kNumber); }
     Status Visit(const DateType&) { return SetKind(Kind::kNumber); }
+    Status Visit(const TimestampType&) { return SetKind(Kind::kString); }
     Status Visit(const BinaryType&) { return SetKind(Kind::kString); }
     Status Visit(const FixedSizeBinaryType&) { return SetKind(Kind::kString); }
     Status Visit(const DictionaryType& dict_type) {
@@ -130,7 +133,8 @@ class RawArrayBuilder;
 /// so those can be accessed before dereferencing the builder.
 struct BuilderPtr {
   BuilderPtr() : BuilderPtr(BuilderPtr::null) {}
-  BuilderPtr(Kind::type k, uint32_t i, bool n) : index(i), kind(k), nullable(n) {}
+  BuilderPtr(Kind::type k, uint32_t i, bool n, bool t = false)
+      : index(i), kind(k), nullable(n), typed(t) {}
 
   BuilderPtr(const BuilderPtr&) = default;
   BuilderPtr& operator=(const BuilderPtr&) = default;
@@ -143,9 +147,12 @@ struct BuilderPtr {
   uint32_t index;
   Kind::type kind;
   bool nullable;
+  // whether this is a TypedScalarBuilder (whose arena is separate from that of
+  // the RawArrayBuilders of the same kind)
+  bool typed;
 
   bool operator==(BuilderPtr other) const {
-    return kind == other.kind && index == other.index;
+    return kind == other.kind && index == other.index && typed == other.typed;
   }
 
   bool operator!=(BuilderPtr other) const { return !(other == *this); }
@@ -260,6 +267,102 @@ class RawArrayBuilder<Kind::kString> : public ScalarBuilder {
   using ScalarBuilder::ScalarBuilder;
 };
 
+/// \brief builder for scalars whose type is given by an explicit schema
+///
+/// Values are converted as they are parsed rather than stored as unconverted
+/// strings, so the Converter for such a column receives an array which already
+/// has its output type.
+class TypedScalarBuilder {
+ public:
+  virtual ~TypedScalarBuilder() = default;
+
+  /// Convert and append a value, setting *converted to false if it could not be
+  /// converted to type()
+  virtual Status Append(string_view repr, bool* converted) = 0;
+
+  virtual Status AppendNull(int64_t count = 1) = 0;
+
+  virtual Status Finish(std::shared_ptr<Array>* out) = 0;
+
+  const std::shared_ptr<DataType>& type() const { return type_; }
+
+  static Status Make(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                     std::unique_ptr<TypedScalarBuilder>* out);
+
+ protected:
+  explicit TypedScalarBuilder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  std::shared_ptr<DataType> type_;
+};
+
+template <typename T>
+class ConvertingScalarBuilder : public TypedScalarBuilder {
+ public:
+  using value_type = typename internal::StringConverter<T>::value_type;
+
+  ConvertingScalarBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type)
+      : TypedScalarBuilder(type),
+        convert_one_(type),
+        data_builder_(pool),
+        null_bitmap_builder_(pool) {}
+
+  Status Append(string_view repr, bool* converted) override {
+    value_type value;
+    *converted = convert_one_(repr.data(), repr.size(), &value);
+    if (ARROW_PREDICT_FALSE(!*converted)) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(data_builder_.Append(value));
+    return null_bitmap_builder_.Append(true);
+  }
+
+  Status AppendNull(int64_t count) override {
+    RETURN_NOT_OK(data_builder_.Append(count, value_type{}));
+    return null_bitmap_builder_.Append(count, false);
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override {
+    auto size = null_bitmap_builder_.length();
+    auto null_count = null_bitmap_builder_.false_count();
+    std::shared_ptr<Buffer> data, null_bitmap;
+    RETURN_NOT_OK(data_builder_.Finish(&data));
+    RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+    *out = MakeArray(ArrayData::Make(type_, size, {null_bitmap, data}, null_count));
+    return Status::OK();
+  }
+
+ private:
+  internal::StringConverter<T> convert_one_;
+  TypedBufferBuilder<value_type> data_builder_;
+  TypedBufferBuilder<bool> null_bitmap_builder_;
+};
+
+Status TypedScalarBuilder::Make(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                                std::unique_ptr<TypedScalarBuilder>* out) {
+  switch (type->id()) {
+#define TYPED_BUILDER_CASE(TYPE_ID, TYPE)                          \
+  case TYPE_ID:                                                    \
+    *out = make_unique<ConvertingScalarBuilder<TYPE>>(pool, type); \
+    return Status::OK()
+    TYPED_BUILDER_CASE(Type::INT8, Int8Type);
+    TYPED_BUILDER_CASE(Type::INT16, Int16Type);
+    TYPED_BUILDER_CASE(Type::INT32, Int32Type);
+    TYPED_BUILDER_CASE(Type::INT64, Int64Type);
+    TYPED_BUILDER_CASE(Type::UINT8, UInt8Type);
+    TYPED_BUILDER_CASE(Type::UINT16, UInt16Type);
+    TYPED_BUILDER_CASE(Type::UINT32, UInt32Type);
+    TYPED_BUILDER_CASE(Type::UINT64, UInt64Type);
+    TYPED_BUILDER_CASE(Type::FLOAT, FloatType);
+    TYPED_BUILDER_CASE(Type::DOUBLE, DoubleType);
+    TYPED_BUILDER_CASE(Type::TIMESTAMP, TimestampType);
+#undef TYPED_BUILDER_CASE
+    default:
+      // left unconverted for the Converter
+      out->reset();
+      return Status::OK();
+  }
+}
+
 template <>
 class RawArrayBuilder<Kind::kArray> {
  public:
@@ -396,23 +499,45 @@ class RawBuilderSet {
   template <Kind::type kind>
   enable_if_t<kind != Kind::kNull, RawArrayBuilder<kind>*> Cast(BuilderPtr builder) {
     DCHECK_EQ(builder.kind, kind);
+    DCHECK(!builder.typed);
     return arena<kind>().data() + builder.index;
   }
 
+  /// Retrieve a pointer to a TypedScalarBuilder from a BuilderPtr
+  TypedScalarBuilder* CastTyped(BuilderPtr builder) {
+    DCHECK(builder.typed);
+    return typed_arena_[builder.index].get();
+  }
+
   /// construct a builder of statically defined kind
   template <Kind::type kind>
   Status MakeBuilder(int64_t leading_nulls, BuilderPtr* builder) {
     builder->index = static_cast<uint32_t>(arena<kind>().size());
     builder->kind = kind;
     builder->nullable = true;
+    builder->typed = false;
     arena<kind>().emplace_back(RawArrayBuilder<kind>(pool_));
     return Cast<kind>(*builder)->AppendNull(leading_nulls);
   }
 
   /// construct a builder of whatever kind corresponds to a DataType
-  Status MakeBuilder(const DataType& t, int64_t leading_nulls, BuilderPtr* builder) {
+  ///
+  /// Scalars of a type which can be converted during parsing get a TypedScalarBuilder
+  Status MakeBuilder(const std::shared_ptr<DataType>& type, int64_t leading_nulls,
+                     BuilderPtr* builder) {
+    const DataType& t = *type;
     Kind::type kind;
     RETURN_NOT_OK(Kind::ForType(t, &kind));
+
+    std::unique_ptr<TypedScalarBuilder> typed_builder;
+    RETURN_NOT_OK(TypedScalarBuilder::Make(pool_, type, &typed_builder));
+    if (typed_builder != nullptr) {
+      *builder = BuilderPtr(kind, static_cast<uint32_t>(typed_arena_.size()), true,
+                            /*typed=*/true);
+      typed_arena_.push_back(std::move(typed_builder));
+      return CastTyped(*builder)->AppendNull(leading_nulls);
+    }
+
     switch (kind) {
       case Kind::kNull:
         *builder = BuilderPtr(Kind::kNull, static_cast<uint32_t>(leading_nulls), true);
@@ -432,7 +557,7 @@ class RawBuilderSet {
         const auto& list_type = static_cast<const ListType&>(t);
 
         BuilderPtr value_builder;
-        RETURN_NOT_OK(MakeBuilder(*list_type.value_type(), 0, &value_builder));
+        RETURN_NOT_OK(MakeBuilder(list_type.value_type(), 0, &value_builder));
         value_builder.nullable = list_type.value_field()->nullable();
 
         Cast<Kind::kArray>(*builder)->value_builder(value_builder);
@@ -444,7 +569,7 @@ class RawBuilderSet {
 
         for (const auto& f : struct_type.children()) {
           BuilderPtr field_builder;
-          RETURN_NOT_OK(MakeBuilder(*f->type(), leading_nulls, &field_builder));
+          RETURN_NOT_OK(MakeBuilder(f->type(), leading_nulls, &field_builder));
           field_builder.nullable = f->nullable();
 
           Cast<Kind::kObject>(*builder)->AddField(f->name(), field_builder);
@@ -462,6 +587,9 @@ class RawBuilderSet {
     if (ARROW_PREDICT_FALSE(!builder.nullable)) {
       return ParseError("a required field was null");
     }
+    if (builder.typed) {
+      return CastTyped(builder)->AppendNull();
+    }
     switch (builder.kind) {
       case Kind::kNull: {
         DCHECK_EQ(builder, parent.kind == Kind::kArray
@@ -512,6 +640,9 @@ class RawBuilderSet {
                                                   std::shared_ptr<Array>* out) {
       return Finish(scalar_values, child, out);
     };
+    if (builder.typed) {
+      return CastTyped(builder)->Finish(out);
+    }
     switch (builder.kind) {
       case Kind::kNull: {
         auto length = static_cast<int64_t>(builder.index);
@@ -562,6 +693,7 @@ class RawBuilderSet {
              std::vector<RawArrayBuilder<Kind::kArray>>,
              std::vector<RawArrayBuilder<Kind::kObject>>>
       arenas_;
+  std::vector<std::unique_ptr<TypedScalarBuilder>> typed_arena_;
 };
 
 /// Three implementations are provided for BlockParser, one for each
@@ -570,8 +702,9 @@ class RawBuilderSet {
 class HandlerBase : public BlockParser,
                     public rj::BaseReaderHandler<rj::UTF8<>, HandlerBase> {
  public:
-  explicit HandlerBase(MemoryPool* pool)
+  HandlerBase(MemoryPool* pool, bool use_structural_index)
       : BlockParser(pool),
+        use_structural_index_(use_structural_index),
         builder_set_(pool),
         field_index_(-1),
         scalar_values_builder_(pool) {}
@@ -643,7 +776,7 @@ class HandlerBase : public BlockParser,
     if (s) {
       type = struct_(s->fields());
     }
-    return builder_set_.MakeBuilder(*type, 0, &builder_);
+    return builder_set_.MakeBuilder(type, 0, &builder_);
   }
 
   Status Finish(std::shared_ptr<Array>* parsed) override {
@@ -703,6 +836,14 @@ class HandlerBase : public BlockParser,
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    if (use_structural_index_) {
+      string_view view(reinterpret_cast<const char*>(json->data()), json->size());
+      structural_indices_.clear();
+      RETURN_NOT_OK(IndexStructuralCharacters(view, &structural_indices_));
+      return StructuralIndexParser<Handler>(view, structural_indices_, &handler,
+                                            &num_rows_)
+          .Parse();
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
@@ -717,6 +858,9 @@ class HandlerBase : public BlockParser,
     if (ARROW_PREDICT_FALSE(builder.kind != kind)) {
       return IllegallyChangedTo(kind);
     }
+    if (builder.typed) {
+      return AppendTyped(builder, scalar);
+    }
     auto index = static_cast<int32_t>(scalar_values_builder_.length());
     auto value_length = static_cast<int32_t>(scalar.size());
     RETURN_NOT_OK(Cast<kind>(builder)->Append(index, value_length));
@@ -725,6 +869,17 @@ class HandlerBase : public BlockParser,
     return Status::OK();
   }
 
+  Status AppendTyped(BuilderPtr builder, string_view scalar) {
+    auto typed_builder = builder_set_.CastTyped(builder);
+    bool converted;
+    RETURN_NOT_OK(typed_builder->Append(scalar, &converted));
+    if (ARROW_PREDICT_FALSE(!converted)) {
+      return ParseError("Column(", Path(), ") couldn't convert ", scalar, " to ",
+                        *typed_builder->type(), " in row ", num_rows_);
+    }
+    return Status::OK();
+  }
+
   /// @}
 
   Status StartObjectImpl() {
@@ -830,6 +985,9 @@ class HandlerBase : public BlockParser,
   }
 
   Status status_;
+  // whether to tokenize with a structural index instead of rj::Reader
+  bool use_structural_index_;
+  std::vector<uint32_t> structural_indices_;
   RawBuilderSet builder_set_;
   BuilderPtr builder_;
   // top of this stack is the parent of builder_
@@ -1068,26 +1226,38 @@ class Handler<UnexpectedFieldBehavior::InferType> : public HandlerBase {
 };
 
 Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
-                         std::unique_ptr<BlockParser>* out) {
+                         BlockParserKind kind, std::unique_ptr<BlockParser>* out) {
   DCHECK(options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType ||
          options.explicit_schema != nullptr);
 
+  const bool use_structural_index =
+      kind == BlockParserKind::StructuralIndex ||
+      (kind == BlockParserKind::Auto && HaveSimdStructuralIndexer());
+
   switch (options.unexpected_field_behavior) {
     case UnexpectedFieldBehavior::Ignore: {
-      *out = make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(pool);
+      *out = make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(pool,
+                                                                   use_structural_index);
       break;
     }
     case UnexpectedFieldBehavior::Error: {
-      *out = make_unique<Handler<UnexpectedFieldBehavior::Error>>(pool);
+      *out = make_unique<Handler<UnexpectedFieldBehavior::Error>>(pool,
+                                                                  use_structural_index);
       break;
     }
     case UnexpectedFieldBehavior::InferType:
-      *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
+      *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(
+          pool, use_structural_index);
       break;
   }
   return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
 }
 
+Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
+                         std::unique_ptr<BlockParser>* out) {
+  return BlockParser::Make(pool, options, BlockParserKind::Auto, out);
+}
+
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
   return BlockParser::Make(default_memory_pool(), options, out);
 }
@@ -50,11 +50,24 @@ struct Kind {
 
 constexpr int32_t kMaxParserNumRows = 100000;
 
+/// \brief How a BlockParser tokenizes JSON
+enum class BlockParserKind : char {
+  /// A structural index if a SIMD kernel for building it is available on this CPU,
+  /// RapidJSON otherwise
+  Auto,
+  /// RapidJSON's SAX reader
+  RapidJSON,
+  /// A structural index of the block, built in a first pass (see structural_index.h)
+  StructuralIndex
+};
+
 /// \class BlockParser
 /// \brief A reusable block-based parser for JSON data
 ///
 /// The parser takes a block of newline delimited JSON data and extracts Arrays
 /// of unconverted strings which can be fed to a Converter to obtain a usable Array.
+/// Numbers and timestamps of a type specified by an explicit schema are converted
+/// during parsing instead, and emitted with that type.
 ///
 /// Note that in addition to parse errors (such as malformed JSON) some conversion
 /// errors are caught at parse time:
@@ -62,6 +75,8 @@ constexpr int32_t kMaxParserNumRows = 100000;
 /// - Change in the JSON kind of a column. For example, if an explicit schema is provided
 ///   which stipulates that field "a" is integral, a row of {"a": "not a number"} will
 ///   result in an error. This also applies to fields outside an explicit schema.
+/// - A number or timestamp which can't be converted to the type specified for it
+///   by an explicit schema
 class ARROW_EXPORT BlockParser {
  public:
   virtual ~BlockParser() = default;
@@ -86,6 +101,10 @@ class ARROW_EXPORT BlockParser {
   static Status Make(MemoryPool* pool, const ParseOptions& options,
                      std::unique_ptr<BlockParser>* out);
 
+  /// \brief Construct a BlockParser with an explicit tokenizer
+  static Status Make(MemoryPool* pool, const ParseOptions& options,
+                     BlockParserKind kind, std::unique_ptr<BlockParser>* out);
+
   static Status Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out);
 
  protected:
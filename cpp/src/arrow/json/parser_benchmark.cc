@@ -18,11 +18,13 @@
 #include "benchmark/benchmark.h"
 
 #include <string>
+#include <vector>
 
 #include "arrow/json/chunker.h"
 #include "arrow/json/options.h"
 #include "arrow/json/parser.h"
 #include "arrow/json/reader.h"
+#include "arrow/json/structural_index.h"
 #include "arrow/json/test_common.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
@@ -90,10 +92,11 @@ static void ChunkJSONLineDelimited(
 
 static void BenchmarkJSONParsing(benchmark::State& state,  // NOLINT non-const reference
                                  const std::shared_ptr<Buffer>& json, int32_t num_rows,
-                                 ParseOptions options) {
+                                 ParseOptions options,
+                                 BlockParserKind kind = BlockParserKind::Auto) {
   for (auto _ : state) {
     std::unique_ptr<BlockParser> parser;
-    ABORT_NOT_OK(BlockParser::Make(options, &parser));
+    ABORT_NOT_OK(BlockParser::Make(default_memory_pool(), options, kind, &parser));
     ABORT_NOT_OK(parser->Parse(json));
 
     std::shared_ptr<Array> parsed;
@@ -102,15 +105,61 @@ static void BenchmarkJSONParsing(benchmark::State& state,  // NOLINT non-const r
   state.SetBytesProcessed(state.iterations() * json->size());
 }
 
-static void ParseJSONBlockWithSchema(
-    benchmark::State& state) {  // NOLINT non-const reference
+static void BenchmarkParseJSONBlockWithSchema(
+    benchmark::State& state, BlockParserKind kind) {  // NOLINT non-const reference
   const int32_t num_rows = 5000;
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
   options.explicit_schema = TestSchema();
 
   auto json = TestJsonData(num_rows);
-  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options, kind);
+}
+
+static void ParseJSONBlockWithSchema(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONBlockWithSchema(state, BlockParserKind::Auto);
+}
+
+static void ParseJSONBlockWithSchemaRapidJSON(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONBlockWithSchema(state, BlockParserKind::RapidJSON);
+}
+
+static void ParseJSONBlockWithSchemaStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONBlockWithSchema(state, BlockParserKind::StructuralIndex);
+}
+
+// Stage 1 of the structural index parser alone
+static void IndexJSONBlock(benchmark::State& state) {  // NOLINT non-const reference
+  auto json = TestJsonData(5000);
+  std::vector<uint32_t> indices;
+  for (auto _ : state) {
+    indices.clear();
+    ABORT_NOT_OK(IndexStructuralCharacters(json, &indices));
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+static void BenchmarkParseJSONPrettyPrinted(
+    benchmark::State& state, BlockParserKind kind) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+
+  auto json = TestJsonData(num_rows, /* pretty */ true);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options, kind);
+}
+
+static void ParseJSONPrettyPrintedRapidJSON(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONPrettyPrinted(state, BlockParserKind::RapidJSON);
+}
+
+static void ParseJSONPrettyPrintedStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONPrettyPrinted(state, BlockParserKind::StructuralIndex);
 }
 
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
@@ -158,6 +207,11 @@ static void ReadJSONBlockWithSchemaMultiThread(
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockWithSchemaRapidJSON);
+BENCHMARK(ParseJSONBlockWithSchemaStructuralIndex);
+BENCHMARK(ParseJSONPrettyPrintedRapidJSON);
+BENCHMARK(ParseJSONPrettyPrintedStructuralIndex);
+BENCHMARK(IndexJSONBlock);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
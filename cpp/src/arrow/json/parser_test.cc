@@ -64,7 +64,8 @@ void AssertUnconvertedArraysEqual(const Array& expected, const Array& actual) {
       return AssertUnconvertedStructArraysEqual(static_cast<const StructArray&>(expected),
                                                 static_cast<const StructArray&>(actual));
     default:
-      FAIL();
+      // converted during parsing, as specified by an explicit schema
+      return AssertArraysEqual(expected, actual);
   }
 }
 
@@ -101,8 +102,8 @@ TEST(BlockParserWithSchema, Basics) {
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
   AssertParseColumns(
       options, scalars_only_src(),
-      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
-      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())},
+      {"[3.5, 3.25, 3.125, 0.0]", "[false, null, null, true]",
        "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
@@ -113,7 +114,7 @@ TEST(BlockParserWithSchema, Empty) {
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
   AssertParseColumns(
       options, "",
-      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())},
       {"[]", "[]", "[]"});
 }
 
@@ -122,8 +123,8 @@ TEST(BlockParserWithSchema, SkipFieldsOutsideSchema) {
   options.explicit_schema = schema({field("hello", float64()), field("yo", utf8())});
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
   AssertParseColumns(options, scalars_only_src(),
-                     {field("hello", utf8()), field("yo", utf8())},
-                     {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]",
+                     {field("hello", float64()), field("yo", utf8())},
+                     {"[3.5, 3.25, 3.125, 0.0]",
                       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
@@ -170,6 +171,23 @@ TEST_P(BlockParserTypeError, FailOnDuplicateKeys) {
       testing::StartsWith("JSON parse error: Column(/a) was specified twice in row 0"));
 }
 
+TEST_P(BlockParserTypeError, FailOnUnconvertible) {
+  std::shared_ptr<Array> parsed;
+  Status error = ParseFromString(Options(schema({field("a", int32())})),
+                                 "{\"a\":0}\n{\"a\":1.5}\n", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(error.message(),
+              testing::StartsWith(
+                  "JSON parse error: Column(/a) couldn't convert 1.5 to int32 in row 1"));
+
+  error = ParseFromString(Options(schema({field("t", timestamp(TimeUnit::SECOND))})),
+                          "{\"t\":\"2018-11-13\"}\n{\"t\":\"yesterday\"}\n", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(error.message(),
+              testing::StartsWith("JSON parse error: Column(/t) couldn't convert "
+                                  "yesterday to timestamp[s] in row 1"));
+}
+
 INSTANTIATE_TEST_CASE_P(BlockParserTypeError, BlockParserTypeError,
                         ::testing::Values(UnexpectedFieldBehavior::Ignore,
                                           UnexpectedFieldBehavior::Error,
@@ -181,11 +199,28 @@ TEST(BlockParserWithSchema, Nested) {
                                     field("nuf", struct_({field("ps", int32())}))});
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
   AssertParseColumns(options, nested_src(),
-                     {field("yo", utf8()), field("arr", list(utf8())),
-                      field("nuf", struct_({field("ps", utf8())}))},
+                     {field("yo", utf8()), field("arr", list(int32())),
+                      field("nuf", struct_({field("ps", int32())}))},
                      {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
-                      R"([["1", "2", "3"], ["2"], [], null])",
-                      R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
+                      R"([[1, 2, 3], [2], [], null])",
+                      R"([{"ps":null}, null, {"ps":78}, {"ps":90}])"});
+}
+
+TEST(BlockParserWithSchema, ConvertsTypedScalars) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("i", int64()), field("u", uint8()), field("f", float32()),
+              field("t", timestamp(TimeUnit::SECOND)), field("b", boolean())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(
+      options, R"({"i": -3, "u": 255, "f": 0.5, "t": "1970-01-02", "b": true}
+{"i": null, "f": 1e3, "t": null}
+{"u": 0, "t": "2018-11-13 17:11:10", "other": 1.5}
+)",
+      {field("i", int64()), field("u", uint8()), field("f", float32()),
+       field("t", timestamp(TimeUnit::SECOND)), field("b", boolean())},
+      {"[-3, null, null]", "[255, null, 0]", "[0.5, 1000, null]",
+       R"(["1970-01-02", null, "2018-11-13 17:11:10"])", "[true, null, null]"});
 }
 
 TEST(BlockParserWithSchema, FailOnIncompleteJson) {
@@ -230,5 +265,39 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+Status ParseFromString(ParseOptions options, BlockParserKind kind,
+                       string_view src_str, std::shared_ptr<Array>* parsed) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(default_memory_pool(), options, kind, &parser));
+  RETURN_NOT_OK(parser->Parse(std::make_shared<Buffer>(src_str)));
+  return parser->Finish(parsed);
+}
+
+TEST(BlockParser, StructuralIndexMatchesRapidJSON) {
+  // Both tokenizers must produce identical arrays and errors
+  auto options = ParseOptions::Defaults();
+  for (const std::string& src :
+       {scalars_only_src(), nested_src(), std::string(R"({"a\"b": "c\\d\n"}
+{"a\"b": "\u00e9\ud83d\ude00", "e": [[1e5, -0.5], [NaN], []], "f": {"g": {}}}
+{"e": null, "f": {"g": {"h": [true, false, null]}}}  {"e": [[-Infinity]]})"),
+        PrettyPrint(R"({"a": [{"b": 1, "c": "x"}, {"b": 2}], "d": {"e": "f"}})"),
+        std::string(R"({"a": 1}
+{"a": 1,}
+)"),
+        std::string(R"({"a": 1}
+{"a": "unterminated
+)")}) {
+    std::shared_ptr<Array> expected, actual;
+    Status expected_status =
+        ParseFromString(options, BlockParserKind::RapidJSON, src, &expected);
+    Status actual_status =
+        ParseFromString(options, BlockParserKind::StructuralIndex, src, &actual);
+    ASSERT_EQ(expected_status.code(), actual_status.code()) << actual_status.ToString();
+    if (expected_status.ok()) {
+      AssertArraysEqual(*expected, *actual);
+    }
+  }
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <deque>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -29,6 +31,8 @@
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
@@ -39,12 +43,79 @@ namespace arrow {
 
 using util::string_view;
 
+using internal::checked_cast;
 using internal::GetCpuThreadPool;
 using internal::TaskGroup;
 using internal::ThreadPool;
 
 namespace json {
 
+namespace {
+
+// Parse a block, with the object straddling the previous block (partial + completion)
+Status ParseBlock(MemoryPool* pool, const ParseOptions& parse_options,
+                  const std::shared_ptr<Buffer>& partial,
+                  const std::shared_ptr<Buffer>& completion,
+                  const std::shared_ptr<Buffer>& whole, std::shared_ptr<Array>* out) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool, &straddling));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  return parser->Finish(out);
+}
+
+const PromotionGraph* GetPromotionGraphFor(const ParseOptions& parse_options) {
+  return parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+             ? GetPromotionGraph()
+             : nullptr;
+}
+
+std::shared_ptr<DataType> GetInitialType(const ParseOptions& parse_options) {
+  return parse_options.explicit_schema ? struct_(parse_options.explicit_schema->fields())
+                                       : struct_({});
+}
+
+// Convert a single parsed block to a record batch
+Result<std::shared_ptr<RecordBatch>> ConvertBlock(MemoryPool* pool,
+                                                  const PromotionGraph* promotion_graph,
+                                                  const std::shared_ptr<DataType>& type,
+                                                  const std::shared_ptr<Array>& parsed) {
+  std::shared_ptr<ChunkedArrayBuilder> builder;
+  RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool, promotion_graph,
+                                        type, &builder));
+
+  builder->Insert(0, field("", parsed->type()), parsed);
+  std::shared_ptr<ChunkedArray> converted_chunked;
+  RETURN_NOT_OK(builder->Finish(&converted_chunked));
+  const auto& converted = checked_cast<const StructArray&>(*converted_chunked->chunk(0));
+
+  std::vector<std::shared_ptr<Array>> columns(converted.num_fields());
+  for (int i = 0; i < converted.num_fields(); ++i) {
+    columns[i] = converted.field(i);
+  }
+  return RecordBatch::Make(schema(converted.type()->children()), converted.length(),
+                           std::move(columns));
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -113,55 +184,196 @@ class TableReaderImpl : public TableReader,
 
  private:
   Status MakeBuilder() {
-    auto type = parse_options_.explicit_schema
-                    ? struct_(parse_options_.explicit_schema->fields())
-                    : struct_({});
-
-    auto promotion_graph =
-        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
-            : nullptr;
-
-    return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
+    return MakeChunkedArrayBuilder(task_group_, pool_,
+                                   GetPromotionGraphFor(parse_options_),
+                                   GetInitialType(parse_options_), &builder_);
   }
 
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool_, &straddling));
-      }
-      RETURN_NOT_OK(parser->Parse(straddling));
+    std::shared_ptr<Array> parsed;
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, partial, completion, whole, &parsed));
+    builder_->Insert(block_index, field("", parsed->type()), parsed);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::unique_ptr<Chunker> chunker_;
+  std::shared_ptr<TaskGroup> task_group_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::shared_ptr<ChunkedArrayBuilder> builder_;
+};
+
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      const ReadOptions& read_options, const ParseOptions& parse_options,
+                      ThreadPool* thread_pool)
+      : pool_(pool),
+        input_(std::move(input)),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        thread_pool_(thread_pool),
+        chunker_(MakeChunker(parse_options_)) {}
+
+  ~StreamingReaderImpl() override {
+    // Pending tasks refer to this object
+    for (auto& fut : pending_batches_) {
+      fut.Wait();
     }
+  }
+
+  Status Init() {
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
 
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
+    // Bound the number of blocks in memory, both read ahead and being converted
+    max_pending_batches_ = thread_pool_ ? thread_pool_->GetCapacity() : 1;
+    ARROW_ASSIGN_OR_RAISE(
+        block_iterator_,
+        MakeReadaheadIterator(std::move(block_iterator_),
+                              static_cast<int32_t>(max_pending_batches_)));
+
+    ARROW_ASSIGN_OR_RAISE(block_, block_iterator_.Next());
+    if (!block_) {
+      return Status::Invalid("Empty JSON file");
     }
+    partial_ = std::make_shared<Buffer>("");
 
+    // The first block is converted with type inference, then its schema
+    // is used for the following blocks
+    ChunkedBlock chunk;
+    ARROW_ASSIGN_OR_RAISE(bool has_chunk, ChunkNextBlock(&chunk));
+    DCHECK(has_chunk);
     std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
-    builder_->Insert(block_index, field("", parsed->type()), parsed);
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, chunk.partial, chunk.completion,
+                             chunk.whole, &parsed));
+    ARROW_ASSIGN_OR_RAISE(first_batch_,
+                          ConvertBlock(pool_, GetPromotionGraphFor(parse_options_),
+                                       GetInitialType(parse_options_), parsed));
+    schema_ = first_batch_->schema();
+
+    fixed_parse_options_ = parse_options_;
+    fixed_parse_options_.explicit_schema = schema_;
+    if (parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      fixed_parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+    fixed_type_ = struct_(schema_->fields());
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (first_batch_) {
+      *batch = std::move(first_batch_);
+      if ((*batch)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+    while (true) {
+      RETURN_NOT_OK(SchedulePendingBatches());
+      if (pending_batches_.empty()) {
+        // EOF
+        batch->reset();
+        return Status::OK();
+      }
+      auto fut = std::move(pending_batches_.front());
+      pending_batches_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(*batch, fut.result());
+      // Skip blocks without any complete object
+      if ((*batch)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+  }
+
+ protected:
+  // A block split at object boundaries, with the object straddling the previous block
+  struct ChunkedBlock {
+    std::shared_ptr<Buffer> partial;
+    std::shared_ptr<Buffer> completion;
+    std::shared_ptr<Buffer> whole;
+  };
+
+  // Split the next block at object boundaries.  Return false at EOF.
+  Result<bool> ChunkNextBlock(ChunkedBlock* out) {
+    if (!block_) {
+      return false;
+    }
+    std::shared_ptr<Buffer> next_block, starts_with_whole, next_partial;
+    ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+    out->partial = partial_;
+
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(
+          chunker_->ProcessFinal(partial_, block_, &out->completion, &out->whole));
+    } else {
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &out->completion,
+                                                 &starts_with_whole));
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &out->whole, &next_partial));
+    }
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return true;
+  }
+
+  // Chunk more blocks and launch their conversion, up to max_pending_batches_
+  Status SchedulePendingBatches() {
+    while (pending_batches_.size() < max_pending_batches_) {
+      ChunkedBlock chunk;
+      ARROW_ASSIGN_OR_RAISE(bool has_chunk, ChunkNextBlock(&chunk));
+      if (!has_chunk) {
+        break;
+      }
+      if (thread_pool_) {
+        ARROW_ASSIGN_OR_RAISE(auto fut, thread_pool_->Submit([this, chunk]() {
+          return ParseAndConvert(chunk);
+        }));
+        pending_batches_.push_back(std::move(fut));
+      } else {
+        pending_batches_.push_back(
+            Future<std::shared_ptr<RecordBatch>>::MakeFinished(ParseAndConvert(chunk)));
+      }
+    }
     return Status::OK();
   }
 
+  // Parse and convert a block to the fixed schema (may be called from any thread)
+  Result<std::shared_ptr<RecordBatch>> ParseAndConvert(const ChunkedBlock& chunk) const {
+    std::shared_ptr<Array> parsed;
+    RETURN_NOT_OK(ParseBlock(pool_, fixed_parse_options_, chunk.partial,
+                             chunk.completion, chunk.whole, &parsed));
+    return ConvertBlock(pool_, /*promotion_graph=*/nullptr, fixed_type_, parsed);
+  }
+
   MemoryPool* pool_;
+  std::shared_ptr<io::InputStream> input_;
   ReadOptions read_options_;
   ParseOptions parse_options_;
+  ThreadPool* thread_pool_;
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> first_batch_;
+  // Options and type to parse and convert blocks after the first one
+  ParseOptions fixed_parse_options_;
+  std::shared_ptr<DataType> fixed_type_;
+
   std::unique_ptr<Chunker> chunker_;
-  std::shared_ptr<TaskGroup> task_group_;
   Iterator<std::shared_ptr<Buffer>> block_iterator_;
-  std::shared_ptr<ChunkedArrayBuilder> builder_;
+  // Next block to be chunked, and leftover of the previous block
+  std::shared_ptr<Buffer> block_;
+  std::shared_ptr<Buffer> partial_;
+
+  // Batches being parsed and converted, in file order
+  std::deque<Future<std::shared_ptr<RecordBatch>>> pending_batches_;
+  size_t max_pending_batches_ = 1;
 };
 
 Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
@@ -181,6 +393,17 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return Status::OK();
 }
 
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto reader = std::make_shared<StreamingReaderImpl>(pool, std::move(input),
+                                                      read_options, parse_options,
+                                                      thread_pool);
+  RETURN_NOT_OK(reader->Init());
+  return reader;
+}
+
 Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                 std::shared_ptr<RecordBatch>* out) {
   std::unique_ptr<BlockParser> parser;
@@ -189,29 +412,9 @@ Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
 
-  auto type =
-      options.explicit_schema ? struct_(options.explicit_schema->fields()) : struct_({});
-  auto promotion_graph =
-      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-          ? GetPromotionGraph()
-          : nullptr;
-  std::shared_ptr<ChunkedArrayBuilder> builder;
-  RETURN_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(),
-                                        default_memory_pool(), promotion_graph, type,
-                                        &builder));
-
-  builder->Insert(0, field("", type), parsed);
-  std::shared_ptr<ChunkedArray> converted_chunked;
-  RETURN_NOT_OK(builder->Finish(&converted_chunked));
-  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
-
-  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
-  for (int i = 0; i < converted->num_fields(); ++i) {
-    columns[i] = converted->field(i);
-  }
-  *out = RecordBatch::Make(schema(converted->type()->children()), converted->length(),
-                           std::move(columns));
-  return Status::OK();
+  return ConvertBlock(default_memory_pool(), GetPromotionGraphFor(options),
+                      GetInitialType(options), parsed)
+      .Value(out);
 }
 
 }  // namespace json
@@ -20,6 +20,8 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -55,6 +57,30 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a JSON file incrementally
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// Each call to ReadNext() yields the record batch for one block of the file.
+///
+/// The schema is inferred from the first block (starting from
+/// `ParseOptions::explicit_schema`, if given) and then fixed for the remainder
+/// of the file.  If a later block has a field missing from that schema, or
+/// a value that cannot be converted to its type, an error is returned.
+///
+/// If `ReadOptions::use_threads` is true, blocks following the current one
+/// are read ahead, parsed and converted in parallel on the CPU thread pool.
+/// At most one block per thread is held in memory at any time.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  /// Create a StreamingReader instance
+  ///
+  /// The first block is read and converted (in order to infer the schema)
+  /// before this function returns.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
+      const ParseOptions&);
+};
+
 ARROW_EXPORT Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                              std::shared_ptr<RecordBatch>* out);
 
@@ -288,5 +288,110 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override { read_options_.use_threads = GetParam(); }
+
+  Result<std::shared_ptr<StreamingReader>> MakeReader(util::string_view json) {
+    std::shared_ptr<io::InputStream> input;
+    RETURN_NOT_OK(MakeStream(json, &input));
+    return StreamingReader::Make(default_memory_pool(), input, read_options_,
+                                 parse_options_);
+  }
+
+  void ReadBatches(util::string_view json,
+                   std::vector<std::shared_ptr<RecordBatch>>* out) {
+    ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(json));
+    out->clear();
+    ASSERT_OK(reader->ReadAll(out));
+    for (const auto& batch : *out) {
+      ASSERT_OK(batch->ValidateFull());
+      AssertSchemaEqual(reader->schema(), batch->schema());
+    }
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+};
+
+INSTANTIATE_TEST_CASE_P(StreamingReaderTest, StreamingReaderTest,
+                        ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Basics) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  auto src = scalars_only_src();
+  read_options_.block_size = static_cast<int>(src.length() / 3);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_NO_FATAL_FAILURE(ReadBatches(src, &batches));
+  // One batch per block, except for the last block which has no object
+  ASSERT_EQ(batches.size(), static_cast<size_t>(3));
+
+  auto schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  std::shared_ptr<Table> expected_table, actual_table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &actual_table));
+  expected_table = Table::Make(
+      schema, {
+                  ArrayFromJSON(schema->field(0)->type(), "[3.5, 3.25, 3.125, 0.0]"),
+                  ArrayFromJSON(schema->field(1)->type(), "[false, null, null, true]"),
+                  ArrayFromJSON(schema->field(2)->type(),
+                                "[\"thing\", null, \"\xe5\xbf\x8d\", null]"),
+              });
+  AssertTablesEqual(*expected_table, *actual_table, /*same_chunk_layout=*/false);
+}
+
+TEST_P(StreamingReaderTest, ManyBlocks) {
+  // Batches are returned in file order
+  const int count = 1 << 10;
+  std::string json;
+  for (int i = 0; i < count; ++i) {
+    json += "{\"a\":" + std::to_string(i) + "}\n";
+  }
+  read_options_.block_size = count / 2;
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_NO_FATAL_FAILURE(ReadBatches(json, &batches));
+  ASSERT_GT(batches.size(), static_cast<size_t>(10));
+  int64_t expected = 0;
+  for (const auto& batch : batches) {
+    ASSERT_EQ(batch->column(0)->type()->id(), Type::INT64);
+    const auto& values = checked_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < values.length(); ++i) {
+      ASSERT_EQ(values.Value(i), expected++);
+    }
+  }
+  ASSERT_EQ(expected, count);
+}
+
+TEST_P(StreamingReaderTest, SchemaFixedByFirstBlock) {
+  // Each line is a block of its own
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  read_options_.block_size = 14;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+
+  // A field first seen after the first block is an error...
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader("{\"a\": 1}     \n{\"b\": 2}     \n"));
+  AssertSchemaEqual(*::arrow::schema({field("a", int64())}), *reader->schema());
+  ASSERT_RAISES(Invalid, reader->ReadAll(&batches));
+
+  // ...as is a value of a different kind
+  ASSERT_OK_AND_ASSIGN(reader, MakeReader("{\"a\": 1}     \n{\"a\": \"x\"}   \n"));
+  ASSERT_RAISES(Invalid, reader->ReadAll(&batches));
+
+  // Unless unexpected fields are ignored
+  parse_options_.explicit_schema = ::arrow::schema({field("a", int64())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  ASSERT_NO_FATAL_FAILURE(
+      ReadBatches("{\"a\": 1}     \n{\"b\": 2}     \n{\"a\": 3}     \n", &batches));
+  std::shared_ptr<Table> actual_table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &actual_table));
+  auto expected_table = Table::Make(parse_options_.explicit_schema,
+                                    {ArrayFromJSON(int64(), "[1, null, 3]")});
+  AssertTablesEqual(*expected_table, *actual_table, /*same_chunk_layout=*/false);
+}
+
+TEST_P(StreamingReaderTest, Empty) { ASSERT_RAISES(Invalid, MakeReader("")); }
+
 }  // namespace json
 }  // namespace arrow
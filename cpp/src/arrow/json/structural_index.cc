@@ -0,0 +1,202 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/structural_index.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "arrow/json/structural_index_internal.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/sse_util.h"
+
+namespace arrow {
+namespace json {
+
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
+using internal::IsDispatchLevelSupported;
+
+namespace {
+
+using detail::BracketMasks;
+using detail::CharacterMasks;
+
+struct ScalarClassifier {
+  static CharacterMasks Classify(const uint8_t* block) {
+    CharacterMasks masks = {0, 0, 0, 0};
+    for (int i = 0; i < 64; ++i) {
+      const uint64_t bit = uint64_t(1) << i;
+      switch (block[i]) {
+        case '"':
+          masks.quote |= bit;
+          break;
+        case '\\':
+          masks.backslash |= bit;
+          break;
+        case '{':
+        case '}':
+        case '[':
+        case ']':
+        case ':':
+        case ',':
+          masks.op |= bit;
+          break;
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+          masks.whitespace |= bit;
+          break;
+        default:
+          break;
+      }
+    }
+    return masks;
+  }
+
+  static BracketMasks ClassifyBrackets(const uint8_t* block) {
+    BracketMasks masks = {0, 0, 0, 0};
+    for (int i = 0; i < 64; ++i) {
+      const uint64_t bit = uint64_t(1) << i;
+      switch (block[i]) {
+        case '"':
+          masks.quote |= bit;
+          break;
+        case '\\':
+          masks.backslash |= bit;
+          break;
+        case '{':
+        case '[':
+          masks.open |= bit;
+          break;
+        case '}':
+        case ']':
+          masks.close |= bit;
+          break;
+        default:
+          break;
+      }
+    }
+    return masks;
+  }
+};
+
+#if defined(ARROW_HAVE_SSE2)
+struct Sse2Classifier {
+  static CharacterMasks Classify(const uint8_t* block) {
+    CharacterMasks masks = {0, 0, 0, 0};
+    for (int i = 0; i < 4; ++i) {
+      const __m128i chars =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+      // '[' and ']' differ from '{' and '}' by 0x20
+      const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+      const __m128i op = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(lower, _mm_set1_epi8('{')),
+                       _mm_cmpeq_epi8(lower, _mm_set1_epi8('}'))),
+          _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(':')),
+                       _mm_cmpeq_epi8(chars, _mm_set1_epi8(','))));
+      const __m128i whitespace = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')),
+                       _mm_cmpeq_epi8(chars, _mm_set1_epi8('\t'))),
+          _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\n')),
+                       _mm_cmpeq_epi8(chars, _mm_set1_epi8('\r'))));
+      const int shift = 16 * i;
+      masks.quote |= Movemask(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"'))) << shift;
+      masks.backslash |= Movemask(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))) << shift;
+      masks.op |= Movemask(op) << shift;
+      masks.whitespace |= Movemask(whitespace) << shift;
+    }
+    return masks;
+  }
+
+  static BracketMasks ClassifyBrackets(const uint8_t* block) {
+    BracketMasks masks = {0, 0, 0, 0};
+    for (int i = 0; i < 4; ++i) {
+      const __m128i chars =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+      const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+      const int shift = 16 * i;
+      masks.quote |= Movemask(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"'))) << shift;
+      masks.backslash |= Movemask(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))) << shift;
+      masks.open |= Movemask(_mm_cmpeq_epi8(lower, _mm_set1_epi8('{'))) << shift;
+      masks.close |= Movemask(_mm_cmpeq_epi8(lower, _mm_set1_epi8('}'))) << shift;
+    }
+    return masks;
+  }
+
+  static uint64_t Movemask(__m128i bytes) {
+    return static_cast<uint16_t>(_mm_movemask_epi8(bytes));
+  }
+};
+
+using DefaultClassifier = Sse2Classifier;
+#else
+using DefaultClassifier = ScalarClassifier;
+#endif
+
+struct IndexerDynamicFunction {
+  using FunctionType = Status (*)(util::string_view, std::vector<uint32_t>*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, detail::IndexStructuralCharactersImpl<DefaultClassifier>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, detail::IndexStructuralCharactersAvx2}
+#endif
+    };
+  }
+};
+
+struct FindObjectEndDynamicFunction {
+  using FunctionType = int64_t (*)(util::string_view, bool, NestingState*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, detail::FindObjectEndImpl<DefaultClassifier>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, detail::FindObjectEndAvx2}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+Status IndexStructuralCharacters(util::string_view json, std::vector<uint32_t>* indices) {
+  static DynamicDispatch<IndexerDynamicFunction> dispatch;
+  return dispatch.func(json, indices);
+}
+
+int64_t FindObjectEnd(util::string_view json, bool find_last, NestingState* state) {
+  static DynamicDispatch<FindObjectEndDynamicFunction> dispatch;
+  return dispatch.func(json, find_last, state);
+}
+
+bool HaveSimdStructuralIndexer() {
+#if defined(ARROW_HAVE_SSE2)
+  return true;
+#elif defined(ARROW_HAVE_RUNTIME_AVX2)
+  return IsDispatchLevelSupported(DispatchLevel::AVX2);
+#else
+  return false;
+#endif
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,460 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/json/parser.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+
+/// \brief Find the structural characters of a block of JSON
+///
+/// This is the first stage of parsing with a structural index: the offset of every
+/// `{}[]:,` outside strings, of every unescaped quote (opening and closing) and of the
+/// first character of every other token (numbers and literals) is appended to
+/// `indices`, in order. A SIMD kernel is selected at runtime when one is available.
+///
+/// Fails if the block ends inside a string.
+ARROW_EXPORT
+Status IndexStructuralCharacters(util::string_view json, std::vector<uint32_t>* indices);
+
+/// \brief Whether IndexStructuralCharacters uses a SIMD kernel on this CPU
+ARROW_EXPORT
+bool HaveSimdStructuralIndexer();
+
+/// \brief Nesting of braces and brackets at some point of a JSON scan
+struct NestingState {
+  /// Number of open objects and arrays
+  int64_t depth = 0;
+  /// Whether the scan is inside a string
+  bool in_string = false;
+  /// Whether the next character is escaped by a backslash
+  bool escaped = false;
+};
+
+/// \brief Find the end of a top-level object or array
+///
+/// Scan `json`, starting from `state`, for closing braces or brackets outside strings
+/// which return to depth 0. Return the position following the first one (or the last
+/// one if `find_last` is true), or -1 if there is none. Unless the first end is
+/// returned, `state` is updated to the end of `json`.
+///
+/// Like IndexStructuralCharacters, this works on bitmasks of 64 characters computed
+/// by a SIMD kernel selected at runtime.
+ARROW_EXPORT
+int64_t FindObjectEnd(util::string_view json, bool find_last, NestingState* state);
+
+/// \brief Parse rows of JSON from a structural index (the second stage)
+///
+/// Tokens are validated and forwarded to a handler implementing the same interface
+/// as the one expected by RapidJSON's SAX reader (with numbers as raw strings), so
+/// that the handlers of BlockParser can be reused. One row is parsed per top-level
+/// value; `num_rows` is incremented after each one.
+template <typename Handler>
+class StructuralIndexParser {
+ public:
+  StructuralIndexParser(util::string_view json, const std::vector<uint32_t>& indices,
+                        Handler* handler, int32_t* num_rows)
+      : data_(json.data()),
+        size_(static_cast<uint32_t>(json.size())),
+        index_(indices.data()),
+        index_end_(indices.data() + indices.size()),
+        handler_(handler),
+        num_rows_(num_rows) {}
+
+  Status Parse() {
+    for (; *num_rows_ < kMaxParserNumRows; ++*num_rows_) {
+      if (index_ == index_end_) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(ParseRow());
+    }
+    return Status::Invalid("Exceeded maximum rows");
+  }
+
+ private:
+  struct Scope {
+    bool is_object;
+    uint32_t size;
+  };
+
+  Status ParseRow() {
+    scopes_.clear();
+    while (true) {
+      // Expecting a value
+      if (ARROW_PREDICT_FALSE(index_ == index_end_)) {
+        return SyntaxError("Invalid value.");
+      }
+      const uint32_t pos = *index_++;
+      switch (data_[pos]) {
+        case '{':
+          if (ARROW_PREDICT_FALSE(!handler_->StartObject())) {
+            return handler_->Error();
+          }
+          if (Peek() == '}') {
+            ++index_;
+            if (ARROW_PREDICT_FALSE(!handler_->EndObject(0))) {
+              return handler_->Error();
+            }
+            break;
+          }
+          scopes_.push_back({true, 0});
+          RETURN_NOT_OK(ParseKey());
+          continue;
+        case '[':
+          if (ARROW_PREDICT_FALSE(!handler_->StartArray())) {
+            return handler_->Error();
+          }
+          if (Peek() == ']') {
+            ++index_;
+            if (ARROW_PREDICT_FALSE(!handler_->EndArray(0))) {
+              return handler_->Error();
+            }
+            break;
+          }
+          scopes_.push_back({false, 0});
+          continue;
+        case '"': {
+          util::string_view value;
+          RETURN_NOT_OK(ParseString(pos, &value));
+          if (ARROW_PREDICT_FALSE(!handler_->String(
+                  value.data(), static_cast<uint32_t>(value.size()), true))) {
+            return handler_->Error();
+          }
+          break;
+        }
+        case 't':
+          RETURN_NOT_OK(ParseLiteral(pos, "true"));
+          if (ARROW_PREDICT_FALSE(!handler_->Bool(true))) {
+            return handler_->Error();
+          }
+          break;
+        case 'f':
+          RETURN_NOT_OK(ParseLiteral(pos, "false"));
+          if (ARROW_PREDICT_FALSE(!handler_->Bool(false))) {
+            return handler_->Error();
+          }
+          break;
+        case 'n':
+          RETURN_NOT_OK(ParseLiteral(pos, "null"));
+          if (ARROW_PREDICT_FALSE(!handler_->Null())) {
+            return handler_->Error();
+          }
+          break;
+        default: {
+          uint32_t end;
+          RETURN_NOT_OK(ParseNumber(pos, &end));
+          if (ARROW_PREDICT_FALSE(!handler_->RawNumber(data_ + pos, end - pos, true))) {
+            return handler_->Error();
+          }
+          break;
+        }
+      }
+
+      // A value was completed: close finished scopes, then continue with the next
+      // member or element
+      while (true) {
+        if (scopes_.empty()) {
+          return Status::OK();
+        }
+        Scope& scope = scopes_.back();
+        ++scope.size;
+        const char next = Peek();
+        if (scope.is_object) {
+          if (next == ',') {
+            ++index_;
+            RETURN_NOT_OK(ParseKey());
+            break;
+          }
+          if (ARROW_PREDICT_FALSE(next != '}')) {
+            return SyntaxError("Missing a comma or '}' after an object member.");
+          }
+          ++index_;
+          if (ARROW_PREDICT_FALSE(!handler_->EndObject(scope.size))) {
+            return handler_->Error();
+          }
+        } else {
+          if (next == ',') {
+            ++index_;
+            break;
+          }
+          if (ARROW_PREDICT_FALSE(next != ']')) {
+            return SyntaxError("Missing a comma or ']' after an array element.");
+          }
+          ++index_;
+          if (ARROW_PREDICT_FALSE(!handler_->EndArray(scope.size))) {
+            return handler_->Error();
+          }
+        }
+        scopes_.pop_back();
+      }
+    }
+  }
+
+  /// The character at the next structural index, or 0 if there is none
+  char Peek() const { return index_ == index_end_ ? '\0' : data_[*index_]; }
+
+  Status ParseKey() {
+    if (ARROW_PREDICT_FALSE(Peek() != '"')) {
+      return SyntaxError("Missing a name for object member.");
+    }
+    util::string_view key;
+    RETURN_NOT_OK(ParseString(*index_++, &key));
+    if (ARROW_PREDICT_FALSE(Peek() != ':')) {
+      return SyntaxError("Missing a colon after a name of object member.");
+    }
+    ++index_;
+    if (ARROW_PREDICT_FALSE(
+            !handler_->Key(key.data(), static_cast<uint32_t>(key.size()), true))) {
+      return handler_->Error();
+    }
+    return Status::OK();
+  }
+
+  /// Parse the string opened at `begin`. Its closing quote is the next structural
+  /// index. Strings without escapes are returned in place.
+  Status ParseString(uint32_t begin, util::string_view* out) {
+    DCHECK_NE(index_, index_end_);
+    const uint32_t end = *index_++;
+    const char* p = data_ + begin + 1;
+    const char* const string_end = data_ + end;
+    for (; p != string_end; ++p) {
+      const auto c = static_cast<uint8_t>(*p);
+      if (ARROW_PREDICT_FALSE(c < 0x20)) {
+        return SyntaxError("Invalid encoding in string.");
+      }
+      if (ARROW_PREDICT_FALSE(c == '\\')) {
+        break;
+      }
+    }
+    if (ARROW_PREDICT_TRUE(p == string_end)) {
+      *out = util::string_view(data_ + begin + 1, end - begin - 1);
+      return Status::OK();
+    }
+
+    unescaped_.assign(data_ + begin + 1, p);
+    while (p != string_end) {
+      const auto c = static_cast<uint8_t>(*p++);
+      if (ARROW_PREDICT_FALSE(c < 0x20)) {
+        return SyntaxError("Invalid encoding in string.");
+      }
+      if (c != '\\') {
+        unescaped_.push_back(static_cast<char>(c));
+        continue;
+      }
+      // Stage 1 guarantees an escape is never the last character of a string
+      switch (*p++) {
+        case '"':
+          unescaped_.push_back('"');
+          break;
+        case '\\':
+          unescaped_.push_back('\\');
+          break;
+        case '/':
+          unescaped_.push_back('/');
+          break;
+        case 'b':
+          unescaped_.push_back('\b');
+          break;
+        case 'f':
+          unescaped_.push_back('\f');
+          break;
+        case 'n':
+          unescaped_.push_back('\n');
+          break;
+        case 'r':
+          unescaped_.push_back('\r');
+          break;
+        case 't':
+          unescaped_.push_back('\t');
+          break;
+        case 'u': {
+          uint32_t codepoint;
+          RETURN_NOT_OK(ParseHex4(&p, string_end, &codepoint));
+          if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+            // High surrogate, which must be followed by a low surrogate
+            uint32_t low;
+            if (ARROW_PREDICT_FALSE(string_end - p < 2 || p[0] != '\\' || p[1] != 'u')) {
+              return SyntaxError("The surrogate pair in string is invalid.");
+            }
+            p += 2;
+            RETURN_NOT_OK(ParseHex4(&p, string_end, &low));
+            if (ARROW_PREDICT_FALSE(low < 0xDC00 || low > 0xDFFF)) {
+              return SyntaxError("The surrogate pair in string is invalid.");
+            }
+            codepoint = (((codepoint - 0xD800) << 10) | (low - 0xDC00)) + 0x10000;
+          }
+          AppendUTF8(codepoint);
+          break;
+        }
+        default:
+          return SyntaxError("Invalid escape character in string.");
+      }
+    }
+    *out = unescaped_;
+    return Status::OK();
+  }
+
+  Status ParseHex4(const char** p, const char* end, uint32_t* out) {
+    if (ARROW_PREDICT_FALSE(end - *p < 4)) {
+      return SyntaxError("Incorrect hex digit after \\u escape in string.");
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+      const char c = (*p)[i];
+      value <<= 4;
+      if (c >= '0' && c <= '9') {
+        value |= c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        value |= c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        value |= c - 'A' + 10;
+      } else {
+        return SyntaxError("Incorrect hex digit after \\u escape in string.");
+      }
+    }
+    *p += 4;
+    *out = value;
+    return Status::OK();
+  }
+
+  void AppendUTF8(uint32_t codepoint) {
+    if (codepoint < 0x80) {
+      unescaped_.push_back(static_cast<char>(codepoint));
+    } else if (codepoint < 0x800) {
+      unescaped_.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+      unescaped_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint < 0x10000) {
+      unescaped_.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+      unescaped_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      unescaped_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else {
+      unescaped_.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+      unescaped_.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+      unescaped_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      unescaped_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+  }
+
+  Status ParseLiteral(uint32_t pos, const char* literal) {
+    const auto length = static_cast<uint32_t>(std::strlen(literal));
+    if (ARROW_PREDICT_FALSE(size_ - pos < length ||
+                            std::memcmp(data_ + pos, literal, length) != 0)) {
+      return SyntaxError("Invalid value.");
+    }
+    return CheckTokenEnd(pos + length);
+  }
+
+  /// Validate a number (or NaN/Infinity) starting at `pos`, as RapidJSON does
+  Status ParseNumber(uint32_t pos, uint32_t* end) {
+    uint32_t i = pos;
+    if (At(i) == '-') {
+      ++i;
+    }
+    if (At(i) == 'N' || At(i) == 'I') {
+      for (const char* special : {"Infinity", "Inf", "NaN"}) {
+        const auto length = static_cast<uint32_t>(std::strlen(special));
+        if (size_ - i >= length && std::memcmp(data_ + i, special, length) == 0) {
+          *end = i + length;
+          return CheckTokenEnd(*end);
+        }
+      }
+      return SyntaxError("Invalid value.");
+    }
+    if (At(i) == '0') {
+      ++i;
+    } else if (IsDigit(At(i))) {
+      while (IsDigit(At(++i))) {
+      }
+    } else {
+      return SyntaxError("Invalid value.");
+    }
+    if (At(i) == '.') {
+      if (ARROW_PREDICT_FALSE(!IsDigit(At(++i)))) {
+        return SyntaxError("Missing fraction part in number.");
+      }
+      while (IsDigit(At(++i))) {
+      }
+    }
+    if (At(i) == 'e' || At(i) == 'E') {
+      ++i;
+      if (At(i) == '+' || At(i) == '-') {
+        ++i;
+      }
+      if (ARROW_PREDICT_FALSE(!IsDigit(At(i)))) {
+        return SyntaxError("Missing exponent in number.");
+      }
+      while (IsDigit(At(++i))) {
+      }
+    }
+    *end = i;
+    return CheckTokenEnd(i);
+  }
+
+  /// Tokens must be followed by whitespace or a structural character
+  Status CheckTokenEnd(uint32_t end) {
+    switch (At(end)) {
+      case '\0':
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+      case ',':
+      case ':':
+      case '[':
+      case ']':
+      case '{':
+      case '}':
+      case '"':
+        return Status::OK();
+      default:
+        return SyntaxError("Invalid value.");
+    }
+  }
+
+  char At(uint32_t i) const { return i < size_ ? data_[i] : '\0'; }
+
+  static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+  Status SyntaxError(const char* message) const {
+    return Status::Invalid("JSON parse error: ", message, " in row ", *num_rows_);
+  }
+
+  const char* data_;
+  uint32_t size_;
+  const uint32_t* index_;
+  const uint32_t* const index_end_;
+  Handler* handler_;
+  int32_t* num_rows_;
+  std::vector<Scope> scopes_;
+  std::string unescaped_;
+};
+
+}  // namespace json
+}  // namespace arrow
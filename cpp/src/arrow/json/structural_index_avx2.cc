@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with AVX2 enabled, its functions must only be called
+// after checking for AVX2 support at runtime.
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/json/structural_index_internal.h"
+
+namespace arrow {
+namespace json {
+namespace detail {
+
+namespace {
+
+struct Avx2Classifier {
+  static CharacterMasks Classify(const uint8_t* block) {
+    CharacterMasks masks = {0, 0, 0, 0};
+    for (int i = 0; i < 2; ++i) {
+      const __m256i chars =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * i));
+      // '[' and ']' differ from '{' and '}' by 0x20
+      const __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+      const __m256i op = _mm256_or_si256(
+          _mm256_or_si256(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('{')),
+                          _mm256_cmpeq_epi8(lower, _mm256_set1_epi8('}'))),
+          _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8(':')),
+                          _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(','))));
+      const __m256i whitespace = _mm256_or_si256(
+          _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8(' ')),
+                          _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\t'))),
+          _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\n')),
+                          _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\r'))));
+      const int shift = 32 * i;
+      masks.quote |= Movemask(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('"'))) << shift;
+      masks.backslash |= Movemask(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\\')))
+                         << shift;
+      masks.op |= Movemask(op) << shift;
+      masks.whitespace |= Movemask(whitespace) << shift;
+    }
+    return masks;
+  }
+
+  static BracketMasks ClassifyBrackets(const uint8_t* block) {
+    BracketMasks masks = {0, 0, 0, 0};
+    for (int i = 0; i < 2; ++i) {
+      const __m256i chars =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * i));
+      const __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+      const int shift = 32 * i;
+      masks.quote |= Movemask(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('"'))) << shift;
+      masks.backslash |= Movemask(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\\')))
+                         << shift;
+      masks.open |= Movemask(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('{'))) << shift;
+      masks.close |= Movemask(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('}'))) << shift;
+    }
+    return masks;
+  }
+
+  static uint64_t Movemask(__m256i bytes) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(bytes));
+  }
+};
+
+}  // namespace
+
+Status IndexStructuralCharactersAvx2(util::string_view json,
+                                     std::vector<uint32_t>* indices) {
+  return IndexStructuralCharactersImpl<Avx2Classifier>(json, indices);
+}
+
+int64_t FindObjectEndAvx2(util::string_view json, bool find_last, NestingState* state) {
+  return FindObjectEndImpl<Avx2Classifier>(json, find_last, state);
+}
+
+}  // namespace detail
+}  // namespace json
+}  // namespace arrow
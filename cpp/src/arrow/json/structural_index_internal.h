@@ -0,0 +1,220 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Stage 1 of JSON parsing with a structural index, shared by the kernels compiled
+// for each instruction set. Only include this from structural_index*.cc.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "arrow/json/structural_index.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace json {
+namespace detail {
+
+/// Bitmasks of the characters of interest in a block of 64 bytes, bit i
+/// corresponding to byte i
+struct CharacterMasks {
+  uint64_t quote;
+  uint64_t backslash;
+  uint64_t op;  // one of {}[]:,
+  uint64_t whitespace;
+};
+
+/// Bitmasks of quotes, backslashes and brackets in a block of 64 bytes
+struct BracketMasks {
+  uint64_t quote;
+  uint64_t backslash;
+  uint64_t open;   // '{' or '['
+  uint64_t close;  // '}' or ']'
+};
+
+/// Set each bit to the XOR of itself and all lower bits, so that bits between an
+/// odd and an even quote are set
+static inline uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+/// Return the characters escaped by a backslash, accounting for runs of backslashes.
+/// `prev_escaped` carries whether the first character of the next block is escaped.
+static inline uint64_t FindEscaped(uint64_t backslash, uint64_t* prev_escaped) {
+  constexpr uint64_t kEvenBits = 0x5555555555555555ULL;
+  backslash &= ~*prev_escaped;
+  const uint64_t follows_escape = (backslash << 1) | *prev_escaped;
+  // Adding the starts of runs at odd positions carries through the runs; the bits
+  // which come out flipped identify runs starting at even positions
+  const uint64_t odd_starts = backslash & ~kEvenBits & ~follows_escape;
+  const uint64_t sum = odd_starts + backslash;
+  *prev_escaped = sum < odd_starts ? 1 : 0;
+  const uint64_t invert = sum << 1;
+  return (kEvenBits ^ invert) & follows_escape;
+}
+
+/// Append the positions of set bits, offset by `base`
+static inline uint32_t* FlattenBits(uint64_t bits, uint32_t base, uint32_t* out) {
+  while (bits != 0) {
+    *out++ = base + static_cast<uint32_t>(BitUtil::CountTrailingZeros(bits));
+    bits &= bits - 1;
+  }
+  return out;
+}
+
+/// Index structural characters, with `Classifier::Classify(const uint8_t* block)`
+/// computing the CharacterMasks of 64 bytes
+template <typename Classifier>
+Status IndexStructuralCharactersImpl(util::string_view json,
+                                     std::vector<uint32_t>* indices) {
+  if (ARROW_PREDICT_FALSE(json.size() >= std::numeric_limits<uint32_t>::max())) {
+    return Status::Invalid("JSON block too large to index: ", json.size(), " bytes");
+  }
+  const auto* data = reinterpret_cast<const uint8_t*>(json.data());
+  const auto size = static_cast<uint32_t>(json.size());
+
+  uint64_t prev_escaped = 0;
+  uint64_t prev_in_string = 0;
+  uint64_t prev_scalar = 0;
+  size_t length = indices->size();
+
+  for (uint32_t base = 0; base < size; base += 64) {
+    CharacterMasks masks;
+    if (ARROW_PREDICT_TRUE(size - base >= 64)) {
+      masks = Classifier::Classify(data + base);
+    } else {
+      // Pad the last block with whitespace, which is never indexed
+      uint8_t last_block[64];
+      std::memset(last_block, ' ', sizeof(last_block));
+      std::memcpy(last_block, data + base, size - base);
+      masks = Classifier::Classify(last_block);
+    }
+
+    const uint64_t escaped = FindEscaped(masks.backslash, &prev_escaped);
+    const uint64_t quotes = masks.quote & ~escaped;
+    // Set for opening quotes and string contents, unset for closing quotes
+    const uint64_t in_string = PrefixXor(quotes) ^ prev_in_string;
+    prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+    // Other tokens start with a non-whitespace, non-structural character following
+    // whitespace or a structural character
+    const uint64_t scalar = ~(masks.op | masks.whitespace | quotes | in_string);
+    const uint64_t scalar_starts = scalar & ~((scalar << 1) | prev_scalar);
+    prev_scalar = scalar >> 63;
+
+    const uint64_t structurals = (masks.op & ~in_string) | quotes | scalar_starts;
+
+    if (indices->size() < length + 64) {
+      indices->resize(std::max(length + 64, 2 * indices->size()));
+    }
+    length = FlattenBits(structurals, base, indices->data() + length) - indices->data();
+  }
+  indices->resize(length);
+
+  if (ARROW_PREDICT_FALSE(prev_in_string != 0)) {
+    return Status::Invalid(
+        "JSON parse error: Missing a closing quotation mark in string.");
+  }
+  return Status::OK();
+}
+
+/// Find object ends, with `Classifier::ClassifyBrackets(const uint8_t* block)`
+/// computing the BracketMasks of 64 bytes
+template <typename Classifier>
+int64_t FindObjectEndImpl(util::string_view json, bool find_last, NestingState* state) {
+  const auto* data = reinterpret_cast<const uint8_t*>(json.data());
+  const auto size = static_cast<int64_t>(json.size());
+
+  uint64_t prev_escaped = state->escaped ? 1 : 0;
+  uint64_t prev_in_string = state->in_string ? ~uint64_t(0) : 0;
+  int64_t depth = state->depth;
+  int64_t last_end = -1;
+
+  for (int64_t base = 0; base < size; base += 64) {
+    BracketMasks masks;
+    const int64_t length = std::min<int64_t>(size - base, 64);
+    if (ARROW_PREDICT_TRUE(length == 64)) {
+      masks = Classifier::ClassifyBrackets(data + base);
+    } else {
+      uint8_t last_block[64];
+      std::memset(last_block, ' ', sizeof(last_block));
+      std::memcpy(last_block, data + base, length);
+      masks = Classifier::ClassifyBrackets(last_block);
+    }
+
+    const uint64_t escaped = FindEscaped(masks.backslash, &prev_escaped);
+    const uint64_t in_string = PrefixXor(masks.quote & ~escaped) ^ prev_in_string;
+    prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+    if (ARROW_PREDICT_FALSE(length < 64)) {
+      // The padding can't be escaped, whether the next character is must be
+      // recomputed from the last character
+      prev_escaped = ((masks.backslash & ~escaped) >> (length - 1)) & 1;
+    }
+
+    const uint64_t open = masks.open & ~in_string;
+    const uint64_t close = masks.close & ~in_string;
+    const int close_count = BitUtil::PopCount(close);
+    if (depth > close_count) {
+      // Depth can't return to 0 in this block
+      depth += BitUtil::PopCount(open) - close_count;
+      continue;
+    }
+    for (uint64_t brackets = open | close; brackets != 0; brackets &= brackets - 1) {
+      const uint64_t bracket = brackets & (~brackets + 1);
+      if (open & bracket) {
+        ++depth;
+      } else if (--depth <= 0) {
+        // Extra closing brackets are invalid JSON, left for the parser to report
+        depth = 0;
+        last_end = base + BitUtil::CountTrailingZeros(bracket) + 1;
+        if (!find_last) {
+          return last_end;
+        }
+      }
+    }
+  }
+
+  state->depth = depth;
+  state->in_string = prev_in_string != 0;
+  state->escaped = prev_escaped != 0;
+  return last_end;
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+/// AVX2 kernels, only callable on CPUs supporting AVX2
+Status IndexStructuralCharactersAvx2(util::string_view json,
+                                     std::vector<uint32_t>* indices);
+
+int64_t FindObjectEndAvx2(util::string_view json, bool find_last, NestingState* state);
+#endif
+
+}  // namespace detail
+}  // namespace json
+}  // namespace arrow
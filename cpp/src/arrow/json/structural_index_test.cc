@@ -0,0 +1,349 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/json/structural_index.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace json {
+
+// Straightforward byte-at-a-time indexing. Like the indexing kernels, this lets
+// backslashes escape quotes outside strings too (which is invalid JSON anyway).
+std::vector<uint32_t> ReferenceIndex(const std::string& json) {
+  std::vector<uint32_t> indices;
+  bool in_string = false, escaped = false, in_token = false;
+  for (uint32_t i = 0; i < json.size(); ++i) {
+    char c = json[i];
+    const bool is_escaped = escaped;
+    escaped = !is_escaped && c == '\\';
+    if (in_string) {
+      if (c == '"' && !is_escaped) {
+        indices.push_back(i);
+        in_string = false;
+      }
+      continue;
+    }
+    if (is_escaped && c == '"') {
+      c = 'x';
+    }
+    switch (c) {
+      case '"':
+        indices.push_back(i);
+        in_string = true;
+        in_token = false;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        indices.push_back(i);
+        in_token = false;
+        break;
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        in_token = false;
+        break;
+      default:
+        if (!in_token) {
+          indices.push_back(i);
+        }
+        in_token = true;
+        break;
+    }
+  }
+  return indices;
+}
+
+void AssertIndex(const std::string& json) {
+  std::vector<uint32_t> indices;
+  ASSERT_OK(IndexStructuralCharacters(json, &indices));
+  ASSERT_EQ(ReferenceIndex(json), indices) << "for " << json;
+}
+
+TEST(StructuralIndex, Basics) {
+  AssertIndex("");
+  AssertIndex("{}");
+  AssertIndex(R"({"a": 1, "b" :[true,null, -2.5e3], "c":{}})");
+  AssertIndex("\n  {\"a\"\t:\r\n\"x y\"}\n{\"a\":\"{[,:]}\"}\n");
+
+  std::vector<uint32_t> indices;
+  ASSERT_OK(IndexStructuralCharacters(R"({"ab":12})", &indices));
+  ASSERT_EQ(indices, std::vector<uint32_t>({0, 1, 4, 5, 6, 8}));
+}
+
+TEST(StructuralIndex, Escapes) {
+  AssertIndex(R"({"a\"b":"\\"})");
+  AssertIndex(R"(["\\\"", "\\\\", "\"\\", "\u005c"])");
+  // Runs of backslashes crossing the 64 byte boundary
+  for (int offset = 50; offset < 70; ++offset) {
+    for (int run = 1; run < 6; ++run) {
+      AssertIndex("[\"" + std::string(offset, 'x') + std::string(run, '\\') +
+                  (run % 2 ? "\"\"" : "\"") + ", 1]");
+    }
+  }
+}
+
+TEST(StructuralIndex, LongStrings) {
+  // Strings and tokens spanning several blocks
+  AssertIndex("{\"" + std::string(200, 'a') + "\":\"" + std::string(130, '{') +
+              "\", \"b\": " + std::string(100, '7') + "}");
+}
+
+TEST(StructuralIndex, Random) {
+  const char alphabet[] = "{}[]:,\"\\ \n1a";
+  std::default_random_engine engine(0x3571);
+  std::uniform_int_distribution<int> char_dist(0, sizeof(alphabet) - 2);
+  std::uniform_int_distribution<int> size_dist(0, 300);
+  for (int i = 0; i < 2000; ++i) {
+    std::string json(size_dist(engine), ' ');
+    for (auto& c : json) {
+      c = alphabet[char_dist(engine)];
+    }
+    std::vector<uint32_t> indices;
+    const Status st = IndexStructuralCharacters(json, &indices);
+    auto expected = ReferenceIndex(json);
+    // The reference doesn't detect unterminated strings
+    if (st.ok()) {
+      ASSERT_EQ(expected, indices) << "for " << json;
+    } else {
+      ASSERT_RAISES(Invalid, st);
+    }
+  }
+}
+
+TEST(StructuralIndex, UnterminatedString) {
+  std::vector<uint32_t> indices;
+  ASSERT_RAISES(Invalid, IndexStructuralCharacters(R"({"a": "b)", &indices));
+  ASSERT_RAISES(Invalid, IndexStructuralCharacters(R"({"a": "b\"})", &indices));
+}
+
+// Straightforward byte-at-a-time search for object ends, continuing from `state`.
+// As in ReferenceIndex, backslashes escape quotes outside strings too.
+void ReferenceObjectEnds(const std::string& json, NestingState* state,
+                         std::vector<int64_t>* ends) {
+  for (size_t i = 0; i < json.size(); ++i) {
+    const char c = json[i];
+    const bool is_escaped = state->escaped;
+    state->escaped = !is_escaped && c == '\\';
+    if (c == '"' && !is_escaped) {
+      state->in_string = !state->in_string;
+    } else if (!state->in_string && (c == '{' || c == '[')) {
+      ++state->depth;
+    } else if (!state->in_string && (c == '}' || c == ']') && --state->depth <= 0) {
+      state->depth = 0;
+      ends->push_back(static_cast<int64_t>(i) + 1);
+    }
+  }
+}
+
+void AssertObjectEnds(const std::string& json) {
+  NestingState expected_state;
+  std::vector<int64_t> ends;
+  ReferenceObjectEnds(json, &expected_state, &ends);
+
+  NestingState state;
+  ASSERT_EQ(ends.empty() ? -1 : ends.front(),
+            FindObjectEnd(json, /*find_last=*/false, &state))
+      << "for " << json;
+  state = NestingState();
+  ASSERT_EQ(ends.empty() ? -1 : ends.back(),
+            FindObjectEnd(json, /*find_last=*/true, &state))
+      << "for " << json;
+  ASSERT_EQ(expected_state.depth, state.depth);
+  ASSERT_EQ(expected_state.in_string, state.in_string);
+  ASSERT_EQ(expected_state.escaped, state.escaped);
+}
+
+TEST(FindObjectEnd, Basics) {
+  AssertObjectEnds("");
+  AssertObjectEnds("{}");
+  AssertObjectEnds("{\"a\": [1, {\"b\": \"}\"}]}\n{\"a\": \"\\\"]\"}\n{\"a\": [");
+  AssertObjectEnds("{\n  \"a\": {\n    \"b\": \"x\\\\\"\n  }\n}\n[]");
+
+  NestingState state;
+  ASSERT_EQ(8, FindObjectEnd(R"({"a":{}}  {"b)", /*find_last=*/true, &state));
+  ASSERT_EQ(1, state.depth);
+  ASSERT_TRUE(state.in_string);
+}
+
+TEST(FindObjectEnd, Random) {
+  // Also exercises continuing a scan from the state at the end of a first part,
+  // as done when completing partial objects
+  const char alphabet[] = "{}[]\"\\ a";
+  std::default_random_engine engine(0x1b3c);
+  std::uniform_int_distribution<int> char_dist(0, sizeof(alphabet) - 2);
+  std::uniform_int_distribution<int> size_dist(0, 300);
+  for (int i = 0; i < 2000; ++i) {
+    std::string json(size_dist(engine), ' ');
+    for (auto& c : json) {
+      c = alphabet[char_dist(engine)];
+    }
+    AssertObjectEnds(json);
+
+    const size_t split = std::uniform_int_distribution<size_t>(0, json.size())(engine);
+    NestingState state, expected_state;
+    std::vector<int64_t> ends;
+    FindObjectEnd(json.substr(0, split), /*find_last=*/true, &state);
+    ReferenceObjectEnds(json.substr(0, split), &expected_state, &ends);
+    ends.clear();
+    ReferenceObjectEnds(json.substr(split), &expected_state, &ends);
+    ASSERT_EQ(ends.empty() ? -1 : ends.back(),
+              FindObjectEnd(json.substr(split), /*find_last=*/true, &state))
+        << "for " << json << " split at " << split;
+  }
+}
+
+// Records the events a parser emits, as a compact string
+class RecordingHandler {
+ public:
+  bool Null() { return Append("null"); }
+  bool Bool(bool value) { return Append(value ? "true" : "false"); }
+  bool RawNumber(const char* data, uint32_t size, bool) {
+    return Append("n:" + std::string(data, size));
+  }
+  bool String(const char* data, uint32_t size, bool) {
+    return Append("s:" + std::string(data, size));
+  }
+  bool Key(const char* data, uint32_t size, bool) {
+    return Append("k:" + std::string(data, size));
+  }
+  bool StartObject() { return Append("{"); }
+  bool EndObject(uint32_t size) { return Append("}" + std::to_string(size)); }
+  bool StartArray() { return Append("["); }
+  bool EndArray(uint32_t size) { return Append("]" + std::to_string(size)); }
+
+  Status Error() { return Status::Invalid("handler stopped"); }
+
+  std::string events;
+  int fail_after = -1;
+
+ private:
+  bool Append(const std::string& event) {
+    if (!events.empty()) {
+      events += " ";
+    }
+    events += event;
+    return fail_after < 0 || --fail_after >= 0;
+  }
+};
+
+Status ParseEvents(const std::string& json, std::string* events, int32_t* num_rows,
+                   int fail_after = -1) {
+  std::vector<uint32_t> indices;
+  RETURN_NOT_OK(IndexStructuralCharacters(json, &indices));
+  RecordingHandler handler;
+  handler.fail_after = fail_after;
+  *num_rows = 0;
+  StructuralIndexParser<RecordingHandler> parser(json, indices, &handler, num_rows);
+  auto st = parser.Parse();
+  *events = handler.events;
+  return st;
+}
+
+void AssertEvents(const std::string& json, const std::string& expected,
+                  int32_t expected_rows) {
+  std::string events;
+  int32_t num_rows;
+  ASSERT_OK(ParseEvents(json, &events, &num_rows));
+  ASSERT_EQ(expected, events);
+  ASSERT_EQ(expected_rows, num_rows);
+}
+
+void AssertParseError(const std::string& json, const std::string& message) {
+  std::string events;
+  int32_t num_rows;
+  Status st = ParseEvents(json, &events, &num_rows);
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_THAT(st.message(), ::testing::StartsWith(message)) << "for " << json;
+}
+
+TEST(StructuralIndexParser, Basics) {
+  AssertEvents("", "", 0);
+  AssertEvents("  \n ", "", 0);
+  AssertEvents("{}\n{}", "{ }0 { }0", 2);
+  AssertEvents(R"({"a": 1, "b": "x", "c": [true, false, null], "d": {"e": []}})",
+               "{ k:a n:1 k:b s:x k:c [ true false null ]3 k:d { k:e [ ]0 }1 }4", 1);
+  // Rows need not be separated by newlines
+  AssertEvents(R"({"a":-0.5e+3}{"a":[[1],[]]})",
+               "{ k:a n:-0.5e+3 }1 { k:a [ [ n:1 ]1 [ ]0 ]2 }1", 2);
+  AssertEvents(R"({"a": NaN, "b": -Infinity, "c": Inf})",
+               "{ k:a n:NaN k:b n:-Infinity k:c n:Inf }3", 1);
+  // Top-level values other than objects are left to the handler
+  AssertEvents("1 \"x\" [] null", "n:1 s:x [ ]0 null", 4);
+}
+
+TEST(StructuralIndexParser, Strings) {
+  AssertEvents(R"({"a\"b": "\\\/\b\f\n\r\t"})", "{ k:a\"b s:\\/\b\f\n\r\t }1", 1);
+  AssertEvents(R"(["\u0041\u00e9\u5fcd\ud83d\ude00"])",
+               "[ s:A\xc3\xa9\xe5\xbf\x8d\xf0\x9f\x98\x80 ]1", 1);
+  AssertEvents("[\"\xe5\xbf\x8d\"]", "[ s:\xe5\xbf\x8d ]1", 1);
+}
+
+TEST(StructuralIndexParser, Errors) {
+  AssertParseError("{\"a\":0, \"b\"", "JSON parse error: Missing a colon");
+  AssertParseError("{\"a\":0}\n{\"a\":}", "JSON parse error: Invalid value. in row 1");
+  AssertParseError("{\"a\":0 \"b\":1}", "JSON parse error: Missing a comma or '}'");
+  AssertParseError("[1 2]", "JSON parse error: Missing a comma or ']'");
+  AssertParseError("[1,]", "JSON parse error: Invalid value.");
+  AssertParseError("{1:2}", "JSON parse error: Missing a name");
+  AssertParseError("{\"a\":tru}", "JSON parse error: Invalid value.");
+  AssertParseError("{\"a\":truex}", "JSON parse error: Invalid value.");
+  AssertParseError("{\"a\":01}", "JSON parse error: Invalid value.");
+  AssertParseError("{\"a\":1.}", "JSON parse error: Missing fraction part");
+  AssertParseError("{\"a\":1e}", "JSON parse error: Missing exponent");
+  AssertParseError("{\"a\":-}", "JSON parse error: Invalid value.");
+  AssertParseError("{\"a\":\"\\x\"}", "JSON parse error: Invalid escape character");
+  AssertParseError("{\"a\":\"\\u12g4\"}", "JSON parse error: Incorrect hex digit");
+  AssertParseError("{\"a\":\"\\ud83d\"}", "JSON parse error: The surrogate pair");
+  AssertParseError("{\"a\":\"x\ty\"}", "JSON parse error: Invalid encoding");
+  AssertParseError("{\"a\":\"x", "JSON parse error: Missing a closing quotation mark");
+  AssertParseError("[[1]", "JSON parse error: Missing a comma or ']'");
+}
+
+TEST(StructuralIndexParser, HandlerError) {
+  std::string events;
+  int32_t num_rows;
+  ASSERT_RAISES(Invalid, ParseEvents(R"({"a": 1})", &events, &num_rows, 2));
+  ASSERT_EQ("{ k:a n:1", events);
+}
+
+TEST(StructuralIndexParser, MaxRows) {
+  std::string json;
+  for (int32_t i = 0; i < kMaxParserNumRows; ++i) {
+    json += "{}\n";
+  }
+  std::string events;
+  int32_t num_rows;
+  ASSERT_RAISES(Invalid, ParseEvents(json, &events, &num_rows));
+  ASSERT_EQ(kMaxParserNumRows, num_rows);
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -17,15 +17,30 @@
 
 #include "arrow/memory_pool.h"
 
+#ifdef ARROW_WITH_BACKTRACE
+#include <execinfo.h>
+#endif
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #include <algorithm>  // IWYU pragma: keep
+#include <atomic>
 #include <cstdlib>    // IWYU pragma: keep
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/numa.h"
 
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
@@ -166,6 +181,28 @@ class SystemAllocator {
 
 #ifdef ARROW_JEMALLOC
 
+// Arenas dedicated to each NUMA node (see jemalloc_set_numa_aware()).
+// They are created once and never change afterwards.
+std::atomic<bool> jemalloc_numa_aware{false};
+std::vector<std::vector<unsigned>> jemalloc_numa_arenas;
+std::atomic<unsigned> jemalloc_next_numa_arena{0};
+// The NUMA node of the arena the current thread is bound to, or -1
+thread_local int jemalloc_thread_node = -1;
+
+// Bind the current thread to an arena of the NUMA node it is running on,
+// if not already done
+void BindThreadToNumaArena() {
+  const int node = internal::GetCurrentNumaNode();
+  if (node < 0 || node == jemalloc_thread_node) {
+    return;
+  }
+  const auto& arenas = jemalloc_numa_arenas[node];
+  unsigned arena = arenas[jemalloc_next_numa_arena++ % arenas.size()];
+  if (mallctl("thread.arena", nullptr, nullptr, &arena, sizeof(arena)) == 0) {
+    jemalloc_thread_node = node;
+  }
+}
+
 // Helper class directing allocations to the jemalloc allocator.
 class JemallocAllocator {
  public:
@@ -174,6 +211,9 @@ class JemallocAllocator {
       *out = zero_size_area;
       return Status::OK();
     }
+    if (jemalloc_numa_aware.load(std::memory_order_acquire)) {
+      BindThreadToNumaArena();
+    }
     *out = reinterpret_cast<uint8_t*>(
         mallocx(static_cast<size_t>(size), MALLOCX_ALIGN(kAlignment)));
     if (*out == NULL) {
@@ -193,6 +233,9 @@ class JemallocAllocator {
       *ptr = zero_size_area;
       return Status::OK();
     }
+    if (jemalloc_numa_aware.load(std::memory_order_acquire)) {
+      BindThreadToNumaArena();
+    }
     *ptr = reinterpret_cast<uint8_t*>(
         rallocx(*ptr, static_cast<size_t>(new_size), MALLOCX_ALIGN(kAlignment)));
     if (*ptr == NULL) {
@@ -442,6 +485,44 @@ Status jemalloc_set_decay_ms(int ms) {
 #endif
 }
 
+#ifdef ARROW_JEMALLOC
+static Status CreateNumaArenas() {
+  const auto& topology = internal::GetNumaTopology();
+  std::vector<std::vector<unsigned>> arenas(topology.num_nodes());
+  for (int node = 0; node < topology.num_nodes(); ++node) {
+    // As many arenas as CPUs, to avoid contention between the node's threads
+    const size_t num_arenas = std::max<size_t>(1, topology.node_cpus[node].size());
+    for (size_t i = 0; i < num_arenas; ++i) {
+      unsigned arena;
+      size_t arena_size = sizeof(arena);
+      int err = mallctl("arenas.create", &arena, &arena_size, nullptr, 0);
+      RETURN_IF_JEMALLOC_ERROR(err);
+      arenas[node].push_back(arena);
+    }
+  }
+  jemalloc_numa_arenas = std::move(arenas);
+  return Status::OK();
+}
+#endif
+
+Status jemalloc_set_numa_aware(bool enabled) {
+#ifdef ARROW_JEMALLOC
+  if (internal::GetNumaTopology().num_nodes() == 1) {
+    return Status::OK();
+  }
+  if (enabled) {
+    static std::once_flag arenas_created;
+    static Status create_status;
+    std::call_once(arenas_created, [] { create_status = CreateNumaArenas(); });
+    RETURN_NOT_OK(create_status);
+  }
+  jemalloc_numa_aware.store(enabled);
+  return Status::OK();
+#else
+  return Status::Invalid("jemalloc support is not built");
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////
 // LoggingMemoryPool implementation
 
@@ -538,4 +619,1061 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+constexpr int64_t ArenaMemoryPool::kDefaultChunkSize;
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  ArenaMemoryPoolImpl(MemoryPool* parent, int64_t chunk_size)
+      : parent_(parent),
+        chunk_size_(BitUtil::RoundUpToMultipleOf64(std::max<int64_t>(chunk_size, 1))) {}
+
+  ~ArenaMemoryPoolImpl() { ReleaseChunks(0); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(AllocateUnlocked(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    if (*ptr == zero_size_area) {
+      DCHECK_EQ(old_size, 0);
+      return Allocate(new_size, ptr);
+    }
+    if (new_size == 0) {
+      Free(*ptr, old_size);
+      *ptr = zero_size_area;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int64_t old_capacity = BitUtil::RoundUpToMultipleOf64(old_size);
+    const int64_t new_capacity = BitUtil::RoundUpToMultipleOf64(new_size);
+    if (IsLatest(*ptr, old_size) && *ptr + new_capacity <= end_) {
+      // Grow or shrink the latest allocation in place
+      position_ = *ptr + new_capacity;
+    } else if (new_capacity > old_capacity) {
+      uint8_t* out;
+      RETURN_NOT_OK(AllocateUnlocked(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(old_size));
+      *ptr = out;
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (buffer == zero_size_area) {
+      DCHECK_EQ(size, 0);
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (IsLatest(buffer, size)) {
+      position_ = buffer;
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Keep the first standard-size chunk, if any
+    size_t kept = 0;
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      if (chunks_[i].second == chunk_size_) {
+        std::swap(chunks_[0], chunks_[i]);
+        kept = 1;
+        break;
+      }
+    }
+    ReleaseChunks(kept);
+    if (kept) {
+      start_ = position_ = chunks_[0].first;
+      end_ = position_ + chunk_size_;
+    } else {
+      start_ = position_ = end_ = nullptr;
+    }
+    stats_.UpdateAllocatedBytes(-stats_.bytes_allocated());
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_reserved() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_reserved_;
+  }
+
+ private:
+  // Whether the buffer is the latest allocation in the current chunk
+  bool IsLatest(uint8_t* buffer, int64_t size) const {
+    return buffer >= start_ && buffer < end_ &&
+           buffer + BitUtil::RoundUpToMultipleOf64(size) == position_;
+  }
+
+  Status AllocateUnlocked(int64_t size, uint8_t** out) {
+    if (size > std::numeric_limits<int64_t>::max() - 63) {
+      return Status::OutOfMemory("malloc size overflows size_t");
+    }
+    const int64_t capacity = BitUtil::RoundUpToMultipleOf64(size);
+    if (capacity > end_ - position_) {
+      if (capacity > chunk_size_) {
+        // Dedicated chunk, keep carving from the current one afterwards
+        return AllocateChunk(capacity, out);
+      }
+      RETURN_NOT_OK(AllocateChunk(chunk_size_, &start_));
+      position_ = start_;
+      end_ = start_ + chunk_size_;
+    }
+    *out = position_;
+    position_ += capacity;
+    return Status::OK();
+  }
+
+  Status AllocateChunk(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(parent_->Allocate(size, out));
+    chunks_.emplace_back(*out, size);
+    bytes_reserved_ += size;
+    return Status::OK();
+  }
+
+  // Return all chunks but the first `keep` ones to the parent pool
+  void ReleaseChunks(size_t keep) {
+    for (size_t i = keep; i < chunks_.size(); ++i) {
+      parent_->Free(chunks_[i].first, chunks_[i].second);
+      bytes_reserved_ -= chunks_[i].second;
+    }
+    chunks_.resize(std::min(keep, chunks_.size()));
+  }
+
+  MemoryPool* parent_;
+  const int64_t chunk_size_;
+  mutable std::mutex mutex_;
+  std::vector<std::pair<uint8_t*, int64_t>> chunks_;
+  int64_t bytes_reserved_ = 0;
+  // The current chunk, free from position_ to end_
+  uint8_t* start_ = nullptr;
+  uint8_t* position_ = nullptr;
+  uint8_t* end_ = nullptr;
+  internal::MemoryPoolStats stats_;
+};
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* parent, int64_t chunk_size)
+    : impl_(new ArenaMemoryPoolImpl(parent, chunk_size)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ArenaMemoryPool::backend_name() const { return "arena"; }
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+///////////////////////////////////////////////////////////////////////
+// LimitingMemoryPool implementation
+
+class LimitingMemoryPool::LimitingMemoryPoolImpl {
+ public:
+  LimitingMemoryPoolImpl(MemoryPool* pool, int64_t limit,
+                         LimitExceededCallback callback)
+      : pool_(pool), limit_(limit), callback_(std::move(callback)), reserved_(0) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(Reserve(size));
+    Status st = pool_->Allocate(size, out);
+    if (!st.ok()) {
+      reserved_ -= size;
+      return st;
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int64_t diff = new_size - old_size;
+    if (diff > 0) {
+      RETURN_NOT_OK(Reserve(diff));
+    }
+    Status st = pool_->Reallocate(old_size, new_size, ptr);
+    if (!st.ok()) {
+      if (diff > 0) {
+        reserved_ -= diff;
+      }
+      return st;
+    }
+    if (diff < 0) {
+      reserved_ += diff;
+    }
+    stats_.UpdateAllocatedBytes(diff);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    reserved_ -= size;
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t limit() const { return limit_; }
+
+ protected:
+  // Reserve `size` bytes against the limit, invoking the callback as long as
+  // it asks for a retry
+  Status Reserve(int64_t size) {
+    while (true) {
+      int64_t current = reserved_.load();
+      while (size <= limit_ - current) {
+        if (reserved_.compare_exchange_weak(current, current + size)) {
+          return Status::OK();
+        }
+      }
+      if (!callback_ || !callback_(size, current)) {
+        return Status::OutOfMemory("Allocation of ", size,
+                                   " bytes exceeds memory limit (", current, " of ",
+                                   limit_, " bytes allocated)");
+      }
+    }
+  }
+
+  MemoryPool* pool_;
+  const int64_t limit_;
+  LimitExceededCallback callback_;
+  // Bytes allocated or about to be allocated, checked against the limit
+  std::atomic<int64_t> reserved_;
+  internal::MemoryPoolStats stats_;
+};
+
+LimitingMemoryPool::LimitingMemoryPool(MemoryPool* pool, int64_t limit,
+                                       LimitExceededCallback callback) {
+  impl_.reset(new LimitingMemoryPoolImpl(pool, limit, std::move(callback)));
+}
+
+LimitingMemoryPool::~LimitingMemoryPool() {}
+
+Status LimitingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status LimitingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void LimitingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t LimitingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t LimitingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string LimitingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t LimitingMemoryPool::limit() const { return impl_->limit(); }
+
+///////////////////////////////////////////////////////////////////////
+// HugePageMemoryPool implementation
+
+constexpr int64_t HugePageMemoryPool::kHugePageSize;
+
+HugePageOptions HugePageOptions::Defaults() { return HugePageOptions(); }
+
+class HugePageMemoryPool::HugePageMemoryPoolImpl {
+ public:
+  HugePageMemoryPoolImpl(MemoryPool* pool, const HugePageOptions& options)
+      : pool_(pool), options_(options), huge_page_bytes_(0) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (IsHuge(size)) {
+      RETURN_NOT_OK(MapHuge(size, out));
+    } else {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (!IsHuge(old_size) && !IsHuge(new_size)) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    } else if (MappedSize(old_size) != MappedSize(new_size) ||
+               IsHuge(old_size) != IsHuge(new_size)) {
+      // Move between mappings, or between a mapping and the other pool
+      uint8_t* out;
+      RETURN_NOT_OK(Allocate(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      Free(*ptr, old_size);
+      *ptr = out;
+      return Status::OK();
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (IsHuge(size)) {
+      UnmapHuge(buffer, size);
+    } else {
+      pool_->Free(buffer, size);
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t huge_page_bytes() const { return huge_page_bytes_.load(); }
+
+ protected:
+  bool IsHuge(int64_t size) const {
+#ifdef __linux__
+    return size >= options_.min_size && size > 0;
+#else
+    return false;
+#endif
+  }
+
+  static int64_t MappedSize(int64_t size) {
+    return BitUtil::RoundUp(size, kHugePageSize);
+  }
+
+#ifdef __linux__
+  Status MapHuge(int64_t size, uint8_t** out) {
+    if (size > std::numeric_limits<int64_t>::max() - 2 * kHugePageSize) {
+      return Status::OutOfMemory("malloc size overflows size_t");
+    }
+    const int64_t mapped_size = MappedSize(size);
+    if (options_.use_hugetlb) {
+      void* data = mmap(nullptr, static_cast<size_t>(mapped_size), PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (data != MAP_FAILED) {
+        *out = static_cast<uint8_t*>(data);
+        huge_page_bytes_ += mapped_size;
+        return Status::OK();
+      }
+      // No reserved huge pages left: fall back to transparent huge pages
+    }
+    // Over-map so as to trim the mapping to a huge page boundary, without
+    // which the kernel cannot use huge pages for it
+    const size_t map_size = static_cast<size_t>(mapped_size + kHugePageSize);
+    void* data = mmap(nullptr, map_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+      return Status::OutOfMemory("mmap of size ", size, " failed");
+    }
+    uint8_t* start = static_cast<uint8_t*>(data);
+    uint8_t* aligned = reinterpret_cast<uint8_t*>(
+        BitUtil::RoundUp(reinterpret_cast<int64_t>(start), kHugePageSize));
+    if (aligned > start) {
+      munmap(start, static_cast<size_t>(aligned - start));
+    }
+    uint8_t* end = start + map_size;
+    if (end > aligned + mapped_size) {
+      munmap(aligned + mapped_size, static_cast<size_t>(end - aligned - mapped_size));
+    }
+#ifdef MADV_HUGEPAGE
+    // Best effort: transparent huge pages may be disabled system-wide
+    ARROW_UNUSED(madvise(aligned, static_cast<size_t>(mapped_size), MADV_HUGEPAGE));
+#endif
+    *out = aligned;
+    huge_page_bytes_ += mapped_size;
+    return Status::OK();
+  }
+
+  void UnmapHuge(uint8_t* buffer, int64_t size) {
+    const int64_t mapped_size = MappedSize(size);
+    int result = munmap(buffer, static_cast<size_t>(mapped_size));
+    ARROW_CHECK_EQ(result, 0) << "munmap failed";
+    huge_page_bytes_ -= mapped_size;
+  }
+#else
+  Status MapHuge(int64_t size, uint8_t** out) {
+    return Status::NotImplemented("Huge pages are not supported on this platform");
+  }
+
+  void UnmapHuge(uint8_t* buffer, int64_t size) {}
+#endif
+
+  MemoryPool* pool_;
+  const HugePageOptions options_;
+  std::atomic<int64_t> huge_page_bytes_;
+  internal::MemoryPoolStats stats_;
+};
+
+HugePageMemoryPool::HugePageMemoryPool(MemoryPool* pool, const HugePageOptions& options) {
+  impl_.reset(new HugePageMemoryPoolImpl(pool, options));
+}
+
+HugePageMemoryPool::~HugePageMemoryPool() {}
+
+Status HugePageMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status HugePageMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void HugePageMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t HugePageMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t HugePageMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string HugePageMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t HugePageMemoryPool::huge_page_bytes() const { return impl_->huge_page_bytes(); }
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+RecyclingOptions RecyclingOptions::Defaults() { return RecyclingOptions(); }
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* pool, const RecyclingOptions& options)
+      : pool_(pool), options_(options) {}
+
+  ~RecyclingMemoryPoolImpl() { ReleaseCached(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (IsRecycled(size)) {
+      RETURN_NOT_OK(AllocateClass(ClassSize(size), out));
+    } else {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const bool old_recycled = IsRecycled(old_size);
+    const bool new_recycled = IsRecycled(new_size);
+    if (!old_recycled && !new_recycled) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    } else if (!old_recycled || !new_recycled ||
+               ClassSize(old_size) != ClassSize(new_size)) {
+      uint8_t* out;
+      RETURN_NOT_OK(Allocate(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      Free(*ptr, old_size);
+      *ptr = out;
+      return Status::OK();
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    stats_.UpdateAllocatedBytes(-size);
+    if (!IsRecycled(size)) {
+      pool_->Free(buffer, size);
+      return;
+    }
+    const int64_t class_size = ClassSize(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cached_bytes_ + class_size <= options_.max_cached_bytes) {
+        free_lists_[class_size].push_back(buffer);
+        cached_bytes_ += class_size;
+        return;
+      }
+    }
+    pool_->Free(buffer, class_size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t cached_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+  }
+
+  int64_t num_recycled() const { return num_recycled_.load(); }
+
+  void ReleaseCached() {
+    std::unordered_map<int64_t, std::vector<uint8_t*>> free_lists;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_lists.swap(free_lists_);
+      cached_bytes_ = 0;
+    }
+    for (const auto& entry : free_lists) {
+      for (uint8_t* buffer : entry.second) {
+        pool_->Free(buffer, entry.first);
+      }
+    }
+  }
+
+ protected:
+  bool IsRecycled(int64_t size) const {
+    return size >= options_.min_size && size <= options_.max_size && size > 0;
+  }
+
+  // Round up to a multiple of a quarter of the power of two below `size`
+  static int64_t ClassSize(int64_t size) {
+    const int64_t step = std::max<int64_t>(BitUtil::NextPower2(size) / 8, 1);
+    return BitUtil::RoundUp(size, step);
+  }
+
+  Status AllocateClass(int64_t class_size, uint8_t** out) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = free_lists_.find(class_size);
+      if (it != free_lists_.end() && !it->second.empty()) {
+        *out = it->second.back();
+        it->second.pop_back();
+        cached_bytes_ -= class_size;
+        ++num_recycled_;
+        return Status::OK();
+      }
+    }
+    Status st = pool_->Allocate(class_size, out);
+    if (st.IsOutOfMemory() && cached_bytes() > 0) {
+      ReleaseCached();
+      st = pool_->Allocate(class_size, out);
+    }
+    return st;
+  }
+
+  MemoryPool* pool_;
+  const RecyclingOptions options_;
+  mutable std::mutex mutex_;
+  // Cached buffers by size class
+  std::unordered_map<int64_t, std::vector<uint8_t*>> free_lists_;
+  int64_t cached_bytes_ = 0;
+  std::atomic<int64_t> num_recycled_{0};
+  internal::MemoryPoolStats stats_;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* pool,
+                                         const RecyclingOptions& options) {
+  impl_.reset(new RecyclingMemoryPoolImpl(pool, options));
+}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t RecyclingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string RecyclingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t RecyclingMemoryPool::cached_bytes() const { return impl_->cached_bytes(); }
+
+int64_t RecyclingMemoryPool::num_recycled() const { return impl_->num_recycled(); }
+
+void RecyclingMemoryPool::ReleaseCached() { impl_->ReleaseCached(); }
+
+///////////////////////////////////////////////////////////////////////
+// ThreadCachingMemoryPool implementation
+
+ThreadCachingOptions ThreadCachingOptions::Defaults() { return ThreadCachingOptions(); }
+
+namespace {
+
+// The small blocks and allocation counter of one thread
+struct ThreadCache {
+  // Protects the free lists.  Only contended when ReleaseCached() or
+  // cached_bytes() are called from another thread.
+  std::mutex mutex;
+  // Cached blocks, by size class
+  std::vector<std::vector<uint8_t*>> free_lists;
+  int64_t cached_bytes = 0;
+  // Only written by the owning thread
+  std::atomic<int64_t> bytes_allocated{0};
+  // The value of bytes_allocated when max_memory was last updated
+  int64_t last_sync = 0;
+};
+
+}  // namespace
+
+class ThreadCachingMemoryPool::ThreadCachingMemoryPoolImpl
+    : public std::enable_shared_from_this<ThreadCachingMemoryPoolImpl> {
+ public:
+  static constexpr int64_t kClassSize = 64;
+
+  ThreadCachingMemoryPoolImpl(MemoryPool* pool, const ThreadCachingOptions& options)
+      : pool_(pool),
+        options_(options),
+        num_classes_(static_cast<size_t>(
+            std::max<int64_t>(options.max_size, 0) / kClassSize)) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    ThreadCache* cache = GetThreadCache();
+    if (IsCached(size)) {
+      RETURN_NOT_OK(AllocateSmall(cache, ClassIndex(size), out));
+    } else {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    }
+    UpdateAllocatedBytes(cache, size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const bool old_cached = IsCached(old_size);
+    const bool new_cached = IsCached(new_size);
+    if (!old_cached && !new_cached) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    } else if (!old_cached || !new_cached ||
+               ClassIndex(old_size) != ClassIndex(new_size)) {
+      uint8_t* out;
+      RETURN_NOT_OK(Allocate(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      Free(*ptr, old_size);
+      *ptr = out;
+      return Status::OK();
+    }
+    UpdateAllocatedBytes(GetThreadCache(), new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    ThreadCache* cache = GetThreadCache();
+    if (IsCached(size)) {
+      FreeSmall(cache, ClassIndex(size), buffer);
+    } else {
+      pool_->Free(buffer, size);
+    }
+    UpdateAllocatedBytes(cache, -size);
+  }
+
+  int64_t bytes_allocated() const {
+    int64_t total;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      total = retired_bytes_;
+      for (const auto& cache : caches_) {
+        total += cache->bytes_allocated.load(std::memory_order_relaxed);
+      }
+    }
+    UpdateMaxMemory(total);
+    return total;
+  }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t cached_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t total = 0;
+    for (const auto& cache : caches_) {
+      std::lock_guard<std::mutex> cache_lock(cache->mutex);
+      total += cache->cached_bytes;
+    }
+    return total;
+  }
+
+  void ReleaseCached() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& cache : caches_) {
+      ReleaseCache(cache.get());
+    }
+  }
+
+  // Release all caches; called when the pool is destroyed
+  void Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& cache : caches_) {
+      ReleaseCache(cache.get());
+    }
+    caches_.clear();
+    closed_ = true;
+  }
+
+ protected:
+  // The caches of the current thread, by pool.  Caches are handed back to
+  // their pool when the thread exits.
+  struct ThreadCaches {
+    struct Entry {
+      const ThreadCachingMemoryPoolImpl* key;
+      std::weak_ptr<ThreadCachingMemoryPoolImpl> pool;
+      std::shared_ptr<ThreadCache> cache;
+    };
+
+    ~ThreadCaches() {
+      for (const auto& entry : entries) {
+        auto pool = entry.pool.lock();
+        if (pool) {
+          pool->RetireCache(entry.cache.get());
+        }
+      }
+    }
+
+    std::vector<Entry> entries;
+  };
+
+  ThreadCache* GetThreadCache() {
+    static thread_local ThreadCaches thread_caches;
+    auto& entries = thread_caches.entries;
+    for (const auto& entry : entries) {
+      if (entry.key == this && !entry.pool.expired()) {
+        return entry.cache.get();
+      }
+    }
+    // Forget the caches of destroyed pools, one of which may have had the
+    // same address
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [](const ThreadCaches::Entry& entry) {
+                                   return entry.pool.expired();
+                                 }),
+                  entries.end());
+    auto cache = std::make_shared<ThreadCache>();
+    cache->free_lists.resize(num_classes_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      caches_.push_back(cache);
+    }
+    entries.push_back({this, shared_from_this(), cache});
+    return cache.get();
+  }
+
+  // Hand back the cache of an exiting thread
+  void RetireCache(ThreadCache* cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      return;
+    }
+    ReleaseCache(cache);
+    retired_bytes_ += cache->bytes_allocated.load(std::memory_order_relaxed);
+    caches_.erase(std::find_if(
+        caches_.begin(), caches_.end(),
+        [&](const std::shared_ptr<ThreadCache>& item) { return item.get() == cache; }));
+  }
+
+  void ReleaseCache(ThreadCache* cache) {
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    for (size_t i = 0; i < cache->free_lists.size(); ++i) {
+      for (uint8_t* buffer : cache->free_lists[i]) {
+        pool_->Free(buffer, ClassSize(i));
+      }
+      cache->free_lists[i].clear();
+    }
+    cache->cached_bytes = 0;
+  }
+
+  bool IsCached(int64_t size) const { return size > 0 && size <= options_.max_size; }
+
+  static size_t ClassIndex(int64_t size) {
+    return static_cast<size_t>((size - 1) / kClassSize);
+  }
+
+  static int64_t ClassSize(size_t index) {
+    return static_cast<int64_t>(index + 1) * kClassSize;
+  }
+
+  Status AllocateSmall(ThreadCache* cache, size_t index, uint8_t** out) {
+    {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      auto& free_list = cache->free_lists[index];
+      if (!free_list.empty()) {
+        *out = free_list.back();
+        free_list.pop_back();
+        cache->cached_bytes -= ClassSize(index);
+        return Status::OK();
+      }
+    }
+    return pool_->Allocate(ClassSize(index), out);
+  }
+
+  void FreeSmall(ThreadCache* cache, size_t index, uint8_t* buffer) {
+    {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      if (cache->cached_bytes + ClassSize(index) <=
+          options_.max_cached_bytes_per_thread) {
+        cache->free_lists[index].push_back(buffer);
+        cache->cached_bytes += ClassSize(index);
+        return;
+      }
+    }
+    pool_->Free(buffer, ClassSize(index));
+  }
+
+  void UpdateAllocatedBytes(ThreadCache* cache, int64_t diff) {
+    const int64_t allocated =
+        cache->bytes_allocated.load(std::memory_order_relaxed) + diff;
+    cache->bytes_allocated.store(allocated, std::memory_order_relaxed);
+    if (allocated < cache->last_sync) {
+      cache->last_sync = allocated;
+    } else if (allocated - cache->last_sync >= options_.stats_batch_bytes) {
+      cache->last_sync = allocated;
+      // Updates max_memory_
+      bytes_allocated();
+    }
+  }
+
+  void UpdateMaxMemory(int64_t allocated) const {
+    int64_t max_memory = max_memory_.load();
+    while (allocated > max_memory &&
+           !max_memory_.compare_exchange_weak(max_memory, allocated)) {
+    }
+  }
+
+  MemoryPool* pool_;
+  const ThreadCachingOptions options_;
+  const size_t num_classes_;
+
+  mutable std::mutex mutex_;
+  // The caches of live threads
+  std::vector<std::shared_ptr<ThreadCache>> caches_;
+  // The bytes allocated by exited threads
+  int64_t retired_bytes_ = 0;
+  bool closed_ = false;
+  mutable std::atomic<int64_t> max_memory_{0};
+};
+
+ThreadCachingMemoryPool::ThreadCachingMemoryPool(MemoryPool* pool,
+                                                 const ThreadCachingOptions& options)
+    : impl_(std::make_shared<ThreadCachingMemoryPoolImpl>(pool, options)) {}
+
+ThreadCachingMemoryPool::~ThreadCachingMemoryPool() { impl_->Close(); }
+
+Status ThreadCachingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ThreadCachingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                           uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ThreadCachingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ThreadCachingMemoryPool::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t ThreadCachingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ThreadCachingMemoryPool::backend_name() const {
+  return impl_->backend_name();
+}
+
+int64_t ThreadCachingMemoryPool::cached_bytes() const { return impl_->cached_bytes(); }
+
+void ThreadCachingMemoryPool::ReleaseCached() { impl_->ReleaseCached(); }
+
+///////////////////////////////////////////////////////////////////////
+// ProfilingMemoryPool implementation
+
+constexpr int MemoryPoolProfile::kNumSizeBuckets;
+
+class ProfilingMemoryPool::ProfilingMemoryPoolImpl {
+ public:
+  ProfilingMemoryPoolImpl(MemoryPool* pool, int64_t stack_sample_interval,
+                          int64_t max_stack_samples)
+      : pool_(pool),
+        stack_sample_interval_(stack_sample_interval),
+        max_stack_samples_(max_stack_samples) {
+    ResetProfile();
+    live_buffers_ = 0;
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    ++num_allocations_;
+    ++live_buffers_;
+    ++allocation_sizes_[SizeBucket(size)];
+    MaybeSampleStack(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    ++num_reallocations_;
+    reallocated_bytes_ += std::min(old_size, new_size);
+    ++reallocation_sizes_[SizeBucket(new_size)];
+    MaybeSampleStack(new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+    ++num_frees_;
+    --live_buffers_;
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  MemoryPoolProfile profile() const {
+    MemoryPoolProfile profile;
+    profile.bytes_allocated = stats_.bytes_allocated();
+    profile.max_memory = stats_.max_memory();
+    profile.num_allocations = num_allocations_.load();
+    profile.num_reallocations = num_reallocations_.load();
+    profile.num_frees = num_frees_.load();
+    profile.live_buffers = live_buffers_.load();
+    profile.reallocated_bytes = reallocated_bytes_.load();
+    for (int i = 0; i < MemoryPoolProfile::kNumSizeBuckets; ++i) {
+      profile.allocation_sizes.push_back(allocation_sizes_[i].load());
+      profile.reallocation_sizes.push_back(reallocation_sizes_[i].load());
+    }
+    std::lock_guard<std::mutex> lock(samples_mutex_);
+    profile.stack_samples = stack_samples_;
+    return profile;
+  }
+
+  void ResetProfile() {
+    num_allocations_ = 0;
+    num_reallocations_ = 0;
+    num_frees_ = 0;
+    reallocated_bytes_ = 0;
+    num_sampling_events_ = 0;
+    for (int i = 0; i < MemoryPoolProfile::kNumSizeBuckets; ++i) {
+      allocation_sizes_[i] = 0;
+      reallocation_sizes_[i] = 0;
+    }
+    std::lock_guard<std::mutex> lock(samples_mutex_);
+    stack_samples_.clear();
+  }
+
+ protected:
+  static int SizeBucket(int64_t size) {
+    return BitUtil::NumRequiredBits(static_cast<uint64_t>(size)) &
+           (MemoryPoolProfile::kNumSizeBuckets - 1);
+  }
+
+  void MaybeSampleStack(int64_t size) {
+    if (stack_sample_interval_ <= 0 ||
+        num_sampling_events_.fetch_add(1) % stack_sample_interval_ != 0) {
+      return;
+    }
+#ifdef ARROW_WITH_BACKTRACE
+    void* buffer[64];
+    const int calls = backtrace(buffer, static_cast<int>(sizeof(buffer) / sizeof(void*)));
+    MemoryPoolProfile::StackSample sample;
+    sample.size = size;
+    char** symbols = backtrace_symbols(buffer, calls);
+    if (symbols != nullptr) {
+      for (int i = 0; i < calls; ++i) {
+        sample.frames.emplace_back(symbols[i]);
+      }
+      free(symbols);
+    }
+    std::lock_guard<std::mutex> lock(samples_mutex_);
+    if (static_cast<int64_t>(stack_samples_.size()) < max_stack_samples_) {
+      stack_samples_.push_back(std::move(sample));
+    }
+#else
+    ARROW_UNUSED(size);
+#endif
+  }
+
+  MemoryPool* pool_;
+  const int64_t stack_sample_interval_;
+  const int64_t max_stack_samples_;
+  internal::MemoryPoolStats stats_;
+
+  std::atomic<int64_t> num_allocations_;
+  std::atomic<int64_t> num_reallocations_;
+  std::atomic<int64_t> num_frees_;
+  std::atomic<int64_t> live_buffers_;
+  std::atomic<int64_t> reallocated_bytes_;
+  std::atomic<int64_t> num_sampling_events_;
+  std::atomic<int64_t> allocation_sizes_[MemoryPoolProfile::kNumSizeBuckets];
+  std::atomic<int64_t> reallocation_sizes_[MemoryPoolProfile::kNumSizeBuckets];
+
+  mutable std::mutex samples_mutex_;
+  std::vector<MemoryPoolProfile::StackSample> stack_samples_;
+};
+
+ProfilingMemoryPool::ProfilingMemoryPool(MemoryPool* pool, int64_t stack_sample_interval,
+                                         int64_t max_stack_samples) {
+  impl_.reset(
+      new ProfilingMemoryPoolImpl(pool, stack_sample_interval, max_stack_samples));
+}
+
+ProfilingMemoryPool::~ProfilingMemoryPool() {}
+
+Status ProfilingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ProfilingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ProfilingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ProfilingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ProfilingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ProfilingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+MemoryPoolProfile ProfilingMemoryPool::profile() const { return impl_->profile(); }
+
+void ProfilingMemoryPool::ResetProfile() { impl_->ResetProfile(); }
+
 }  // namespace arrow
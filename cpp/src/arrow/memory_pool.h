@@ -20,8 +20,10 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -150,6 +152,342 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A memory pool bump-allocating from large chunks, all freed at once
+///
+/// Allocations are carved out of chunks obtained from a parent pool.  Free()
+/// only updates the statistics (and reclaims the space if it was the latest
+/// allocation); the chunks are only returned to the parent pool by Reset() or
+/// on destruction.  This suits short-lived scratch buffers which are dropped
+/// together, e.g. after processing a batch.
+///
+/// Allocations larger than the chunk size get a dedicated chunk.
+/// This class is thread-safe.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultChunkSize = 1 << 20;
+
+  explicit ArenaMemoryPool(MemoryPool* parent = default_memory_pool(),
+                           int64_t chunk_size = kDefaultChunkSize);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief Release all memory allocated from this pool
+  ///
+  /// Any memory allocated from this pool must not be used anymore.  The
+  /// first standard-size chunk is kept for reuse by further allocations.
+  void Reset();
+
+  /// \brief The number of bytes currently obtained from the parent pool
+  int64_t bytes_reserved() const;
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief A memory pool enforcing a limit on the bytes allocated through it
+///
+/// Allocations are forwarded to another pool as long as the total number of
+/// bytes allocated through this pool stays within the limit.  An allocation
+/// exceeding the limit first invokes the optional callback, which is given the
+/// opportunity to make room, for example by waiting for other consumers to
+/// release their memory (thereby applying backpressure) or by spilling data.
+/// If the callback returns true the allocation is retried, otherwise it fails
+/// with Status::OutOfMemory.
+///
+/// The callback is invoked without any internal lock held, so it may block
+/// and it may free memory allocated from this pool.
+/// This class is thread-safe.
+class ARROW_EXPORT LimitingMemoryPool : public MemoryPool {
+ public:
+  /// \brief Callback invoked when an allocation would exceed the limit
+  ///
+  /// It is given the number of extra bytes requested and the number of bytes
+  /// currently allocated.  It should return true to retry the allocation,
+  /// false to make it fail.
+  using LimitExceededCallback =
+      std::function<bool(int64_t requested_bytes, int64_t bytes_allocated)>;
+
+  LimitingMemoryPool(MemoryPool* pool, int64_t limit,
+                     LimitExceededCallback callback = NULLPTR);
+  ~LimitingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief The maximum number of bytes that may be allocated at any time
+  int64_t limit() const;
+
+ private:
+  class LimitingMemoryPoolImpl;
+  std::unique_ptr<LimitingMemoryPoolImpl> impl_;
+};
+
+/// \brief Options for HugePageMemoryPool
+struct ARROW_EXPORT HugePageOptions {
+  /// Allocations of at least this many bytes are backed by huge pages
+  int64_t min_size = 4 * 1024 * 1024;
+
+  /// Map large allocations from the kernel's reserved huge pages (MAP_HUGETLB)
+  /// rather than advising transparent huge pages (MADV_HUGEPAGE).  If no
+  /// reserved huge page is available, transparent huge pages are used instead.
+  bool use_hugetlb = false;
+
+  static HugePageOptions Defaults();
+};
+
+/// \brief A memory pool backing large allocations with huge pages
+///
+/// Allocations of at least HugePageOptions::min_size bytes are given their
+/// own mapping, rounded up to the 2 MiB huge page size, and either advised to
+/// use transparent huge pages or mapped from reserved huge pages.  This
+/// reduces TLB misses when accessing large buffers at random, e.g. in Take or
+/// Filter.  Smaller allocations are forwarded to another pool.
+///
+/// Huge pages are only supported on Linux; elsewhere all allocations are
+/// forwarded.
+/// This class is thread-safe.
+class ARROW_EXPORT HugePageMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kHugePageSize = 2 * 1024 * 1024;
+
+  explicit HugePageMemoryPool(
+      MemoryPool* pool = default_memory_pool(),
+      const HugePageOptions& options = HugePageOptions::Defaults());
+  ~HugePageMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief The number of bytes currently mapped for large allocations
+  int64_t huge_page_bytes() const;
+
+ private:
+  class HugePageMemoryPoolImpl;
+  std::unique_ptr<HugePageMemoryPoolImpl> impl_;
+};
+
+/// \brief Options for RecyclingMemoryPool
+struct ARROW_EXPORT RecyclingOptions {
+  /// Allocations of at least this many bytes are recycled
+  int64_t min_size = 4096;
+  /// Allocations of more than this many bytes are not recycled
+  int64_t max_size = 64 * 1024 * 1024;
+  /// The maximum number of bytes kept for recycling
+  int64_t max_cached_bytes = 256 * 1024 * 1024;
+
+  static RecyclingOptions Defaults();
+};
+
+/// \brief A memory pool recycling freed buffers for later allocations
+///
+/// Allocations with a size between RecyclingOptions::min_size and max_size
+/// are rounded up to a size class, four size classes spanning each power of
+/// two.  When freed, they are kept on a free list per size class, up to
+/// max_cached_bytes in total, and handed out again by later allocations in
+/// the same size class.  This spares the parent pool the churn of repeated
+/// allocations of similar sizes, e.g. message bodies when reading an IPC
+/// stream.  Other allocations are forwarded to the parent pool.
+///
+/// bytes_allocated() and max_memory() don't count the cached buffers.  If the
+/// parent pool runs out of memory, the cached buffers are released and the
+/// allocation is retried.
+/// This class is thread-safe.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  explicit RecyclingMemoryPool(
+      MemoryPool* pool = default_memory_pool(),
+      const RecyclingOptions& options = RecyclingOptions::Defaults());
+  ~RecyclingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief The number of bytes currently cached for recycling
+  int64_t cached_bytes() const;
+
+  /// \brief The number of allocations served by recycling a cached buffer
+  int64_t num_recycled() const;
+
+  /// \brief Return all cached buffers to the parent pool
+  void ReleaseCached();
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// \brief Options for ThreadCachingMemoryPool
+struct ARROW_EXPORT ThreadCachingOptions {
+  /// Allocations of at most this many bytes are cached per thread
+  int64_t max_size = 512;
+  /// The maximum number of bytes cached by each thread
+  int64_t max_cached_bytes_per_thread = 256 * 1024;
+  /// The net growth of a thread's allocations after which max_memory() is
+  /// updated
+  int64_t stats_batch_bytes = 64 * 1024;
+
+  static ThreadCachingOptions Defaults();
+};
+
+/// \brief A memory pool caching small blocks per thread
+///
+/// Small allocations, such as the bitmaps and offsets of builders, are
+/// rounded up to a multiple of 64 bytes and served from a cache owned by the
+/// calling thread.  Freed small blocks go to the cache of the freeing thread,
+/// up to ThreadCachingOptions::max_cached_bytes_per_thread, and are otherwise
+/// returned to the parent pool.  Larger allocations are forwarded to the
+/// parent pool.
+///
+/// Each thread also counts its own allocated bytes, so that allocating
+/// threads don't contend on a shared counter.  bytes_allocated() sums the
+/// counters of all threads and is exact; max_memory() is only updated when a
+/// thread's allocations grew by ThreadCachingOptions::stats_batch_bytes, and
+/// when bytes_allocated() is called.
+///
+/// The cache of a thread is returned to the parent pool when the thread
+/// exits or when the pool is destroyed.
+/// This class is thread-safe.
+class ARROW_EXPORT ThreadCachingMemoryPool : public MemoryPool {
+ public:
+  explicit ThreadCachingMemoryPool(
+      MemoryPool* pool = default_memory_pool(),
+      const ThreadCachingOptions& options = ThreadCachingOptions::Defaults());
+  ~ThreadCachingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief The number of bytes currently cached by all threads
+  int64_t cached_bytes() const;
+
+  /// \brief Return the blocks cached by all threads to the parent pool
+  void ReleaseCached();
+
+ private:
+  class ThreadCachingMemoryPoolImpl;
+  std::shared_ptr<ThreadCachingMemoryPoolImpl> impl_;
+};
+
+/// \brief Allocation statistics gathered by a ProfilingMemoryPool
+struct ARROW_EXPORT MemoryPoolProfile {
+  /// \brief A call stack sampled on allocation
+  struct StackSample {
+    /// The allocation (or reallocation) size
+    int64_t size;
+    /// The symbolized stack frames, innermost first
+    std::vector<std::string> frames;
+  };
+
+  /// The number of size buckets in the histograms
+  static constexpr int kNumSizeBuckets = 64;
+
+  int64_t bytes_allocated = 0;
+  int64_t max_memory = 0;
+
+  int64_t num_allocations = 0;
+  int64_t num_reallocations = 0;
+  int64_t num_frees = 0;
+  /// The number of buffers currently allocated
+  int64_t live_buffers = 0;
+  /// The number of bytes reallocations may have had to copy, i.e. the sum of
+  /// the smaller of the old and new sizes
+  int64_t reallocated_bytes = 0;
+
+  /// \brief Histogram of allocation sizes
+  ///
+  /// Bucket 0 counts zero-sized allocations, bucket i > 0 counts allocations
+  /// with a size in [2^(i-1), 2^i).
+  std::vector<int64_t> allocation_sizes;
+  /// \brief Histogram of reallocation (new) sizes, bucketed as allocation_sizes
+  std::vector<int64_t> reallocation_sizes;
+
+  /// Sampled call stacks, if enabled
+  std::vector<StackSample> stack_samples;
+};
+
+/// \brief A memory pool recording allocation statistics
+///
+/// Allocations are forwarded to another pool, while recording allocation and
+/// reallocation size histograms, reallocation traffic and live buffer counts.
+/// The statistics can be queried at any time with profile().
+///
+/// Optionally, the call stack of one in every `stack_sample_interval`
+/// (re)allocations is recorded as well, up to `max_stack_samples` samples.
+/// Call stacks are only available if Arrow was built with backtrace support.
+/// This class is thread-safe.
+class ARROW_EXPORT ProfilingMemoryPool : public MemoryPool {
+ public:
+  explicit ProfilingMemoryPool(MemoryPool* pool, int64_t stack_sample_interval = 0,
+                               int64_t max_stack_samples = 1000);
+  ~ProfilingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief Return a snapshot of the statistics gathered so far
+  MemoryPoolProfile profile() const;
+
+  /// \brief Reset the counters, histograms and stack samples
+  ///
+  /// bytes_allocated, max_memory and live_buffers are left untouched.
+  void ResetProfile();
+
+ private:
+  class ProfilingMemoryPoolImpl;
+  std::unique_ptr<ProfilingMemoryPoolImpl> impl_;
+};
+
 /// Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -169,6 +507,19 @@ ARROW_EXPORT Status jemalloc_memory_pool(MemoryPool** out);
 ARROW_EXPORT
 Status jemalloc_set_decay_ms(int ms);
 
+/// \brief Enable or disable NUMA-local jemalloc allocations
+///
+/// When enabled, jemalloc allocations are served from arenas dedicated to
+/// the NUMA node of the allocating thread, so that memory freed on one node
+/// isn't handed out again on another.  Together with the operating system's
+/// first-touch page placement, this keeps buffers on the node of the thread
+/// that filled them.  This pays off best with threads pinned to a node (see
+/// ThreadPool::SetNumaAware()).  Disabling doesn't unbind the threads already
+/// bound to a node's arenas.  This is a no-op on machines with a single NUMA
+/// node.
+ARROW_EXPORT
+Status jemalloc_set_numa_aware(bool enabled);
+
 /// Return a process-wide memory pool based on mimalloc.
 ///
 /// May return NotImplemented if mimalloc is not available.
@@ -16,6 +16,10 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -144,6 +148,488 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+// A fresh arena per test, so that its chunks are returned to the default pool
+class TestArenaMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ArenaMemoryPool pool_{default_memory_pool(), /*chunk_size=*/256};
+};
+
+TEST_F(TestArenaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestArenaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestArenaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(ArenaMemoryPool, Basics) {
+  ProxyMemoryPool parent(default_memory_pool());
+  ArenaMemoryPool pool(&parent, /*chunk_size=*/1024);
+  ASSERT_EQ("arena", pool.backend_name());
+
+  uint8_t *data1, *data2, *data3;
+  ASSERT_OK(pool.Allocate(100, &data1));
+  ASSERT_OK(pool.Allocate(200, &data2));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data2) % 64);
+  // Bump allocation from the same chunk
+  ASSERT_EQ(data1 + 128, data2);
+  ASSERT_EQ(300, pool.bytes_allocated());
+  ASSERT_EQ(1024, pool.bytes_reserved());
+  ASSERT_EQ(1024, parent.bytes_allocated());
+
+  // Freeing does not return memory to the parent
+  pool.Free(data1, 100);
+  ASSERT_EQ(200, pool.bytes_allocated());
+  ASSERT_EQ(1024, pool.bytes_reserved());
+
+  // The latest allocation is grown in place
+  data2[0] = 42;
+  uint8_t* old_data2 = data2;
+  ASSERT_OK(pool.Reallocate(200, 500, &data2));
+  ASSERT_EQ(old_data2, data2);
+  ASSERT_EQ(500, pool.bytes_allocated());
+
+  // Other allocations are moved
+  ASSERT_OK(pool.Allocate(10, &data3));
+  ASSERT_OK(pool.Reallocate(500, 600, &data2));
+  ASSERT_NE(old_data2, data2);
+  ASSERT_EQ(42, data2[0]);
+  ASSERT_EQ(610, pool.bytes_allocated());
+  ASSERT_EQ(2048, pool.bytes_reserved());
+
+  // Large allocations get a dedicated chunk
+  uint8_t* large;
+  ASSERT_OK(pool.Allocate(5000, &large));
+  ASSERT_EQ(2048 + 5056, pool.bytes_reserved());
+  ASSERT_EQ(5610, pool.bytes_allocated());
+  ASSERT_EQ(5610, pool.max_memory());
+
+  // Reset keeps a single chunk
+  pool.Reset();
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(5610, pool.max_memory());
+  ASSERT_EQ(1024, pool.bytes_reserved());
+  ASSERT_EQ(1024, parent.bytes_allocated());
+  ASSERT_OK(pool.Allocate(64, &data1));
+  ASSERT_EQ(1024, pool.bytes_reserved());
+
+  ASSERT_RAISES(Invalid, pool.Allocate(-1, &data1));
+}
+
+TEST(ArenaMemoryPool, ReturnsMemoryOnDestruction) {
+  ProxyMemoryPool parent(default_memory_pool());
+  {
+    ArenaMemoryPool pool(&parent, /*chunk_size=*/1024);
+    uint8_t* data;
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_OK(pool.Allocate(100, &data));
+    }
+    ASSERT_GT(parent.bytes_allocated(), 0);
+  }
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(LimitingMemoryPool, Basics) {
+  ProxyMemoryPool parent(default_memory_pool());
+  LimitingMemoryPool pool(&parent, /*limit=*/1000);
+  ASSERT_EQ(1000, pool.limit());
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(600, &data1));
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(500, &data2));
+  ASSERT_EQ(600, pool.bytes_allocated());
+  ASSERT_EQ(600, parent.bytes_allocated());
+
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(600, 1200, &data1));
+  ASSERT_OK(pool.Reallocate(600, 900, &data1));
+  ASSERT_EQ(900, pool.bytes_allocated());
+  ASSERT_OK(pool.Reallocate(900, 100, &data1));
+  ASSERT_OK(pool.Allocate(900, &data2));
+  ASSERT_EQ(1000, pool.bytes_allocated());
+  ASSERT_EQ(1000, pool.max_memory());
+
+  pool.Free(data1, 100);
+  pool.Free(data2, 900);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(LimitingMemoryPool, Callback) {
+  LimitingMemoryPool* pool_ptr = nullptr;
+  uint8_t* spilled = nullptr;
+  int num_calls = 0;
+  // The callback makes room by releasing ("spilling") a previous allocation
+  auto callback = [&](int64_t requested, int64_t allocated) {
+    ++num_calls;
+    EXPECT_EQ(300, requested);
+    if (spilled == nullptr) {
+      return false;
+    }
+    pool_ptr->Free(spilled, allocated);
+    spilled = nullptr;
+    return true;
+  };
+  LimitingMemoryPool pool(default_memory_pool(), /*limit=*/500, callback);
+  pool_ptr = &pool;
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(400, &spilled));
+  ASSERT_OK(pool.Allocate(300, &data));
+  ASSERT_EQ(1, num_calls);
+  ASSERT_EQ(300, pool.bytes_allocated());
+  ASSERT_EQ(nullptr, spilled);
+
+  // Nothing left to spill: the allocation fails
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(300, &data2));
+  ASSERT_EQ(2, num_calls);
+  ASSERT_EQ(300, pool.bytes_allocated());
+  pool.Free(data, 300);
+}
+
+TEST(LimitingMemoryPool, ForwardsParentErrors) {
+  LimitingMemoryPool pool(default_memory_pool(), std::numeric_limits<int64_t>::max());
+  uint8_t* data;
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(std::numeric_limits<int64_t>::max(), &data));
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_OK(pool.Allocate(100, &data));
+  pool.Free(data, 100);
+}
+
+// Most allocations of the generic tests get a dedicated mapping
+class TestHugePageMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  static HugePageOptions Options() {
+    auto options = HugePageOptions::Defaults();
+    options.min_size = 16;
+    return options;
+  }
+
+  HugePageMemoryPool pool_{default_memory_pool(), Options()};
+};
+
+TEST_F(TestHugePageMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestHugePageMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestHugePageMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(HugePageMemoryPool, Basics) {
+  for (bool use_hugetlb : {false, true}) {
+    SCOPED_TRACE(use_hugetlb ? "hugetlb" : "transparent huge pages");
+    ProxyMemoryPool parent(default_memory_pool());
+    auto options = HugePageOptions::Defaults();
+    options.min_size = 1 << 20;
+    options.use_hugetlb = use_hugetlb;
+    HugePageMemoryPool pool(&parent, options);
+    ASSERT_EQ(parent.backend_name(), pool.backend_name());
+
+    // Small allocations are forwarded
+    uint8_t* small;
+    ASSERT_OK(pool.Allocate(1000, &small));
+    ASSERT_EQ(1000, parent.bytes_allocated());
+    ASSERT_EQ(0, pool.huge_page_bytes());
+
+    uint8_t* large;
+    ASSERT_OK(pool.Allocate(3 << 20, &large));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large) % 64);
+    ASSERT_EQ(1000, parent.bytes_allocated());
+#ifdef __linux__
+    ASSERT_EQ(2 * HugePageMemoryPool::kHugePageSize, pool.huge_page_bytes());
+#endif
+    ASSERT_EQ(1000 + (3 << 20), pool.bytes_allocated());
+    std::memset(large, 42, 3 << 20);
+
+    // Growing within the mapping keeps it, growing past it moves the data
+    uint8_t* old_large = large;
+    ASSERT_OK(pool.Reallocate(3 << 20, 4 << 20, &large));
+    ASSERT_EQ(old_large, large);
+    ASSERT_OK(pool.Reallocate(4 << 20, 5 << 20, &large));
+    ASSERT_EQ(42, large[0]);
+    ASSERT_EQ(42, large[(3 << 20) - 1]);
+    ASSERT_EQ(1000 + (5 << 20), pool.bytes_allocated());
+
+    // Crossing the threshold moves to and from the other pool
+    small[0] = 7;
+    ASSERT_OK(pool.Reallocate(1000, 2 << 20, &small));
+    ASSERT_EQ(7, small[0]);
+    ASSERT_EQ(0, parent.bytes_allocated());
+    ASSERT_OK(pool.Reallocate(5 << 20, 100, &large));
+    ASSERT_EQ(42, large[99]);
+    ASSERT_EQ(100, parent.bytes_allocated());
+
+    pool.Free(small, 2 << 20);
+    pool.Free(large, 100);
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(0, pool.huge_page_bytes());
+    ASSERT_EQ(0, parent.bytes_allocated());
+  }
+}
+
+class TestRecyclingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  static RecyclingOptions Options() {
+    auto options = RecyclingOptions::Defaults();
+    options.min_size = 16;
+    return options;
+  }
+
+  RecyclingMemoryPool pool_{default_memory_pool(), Options()};
+};
+
+TEST_F(TestRecyclingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestRecyclingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestRecyclingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(RecyclingMemoryPool, Basics) {
+  ProxyMemoryPool parent(default_memory_pool());
+  auto options = RecyclingOptions::Defaults();
+  options.min_size = 1024;
+  options.max_size = 1 << 20;
+  options.max_cached_bytes = 16384;
+  RecyclingMemoryPool pool(&parent, options);
+  ASSERT_EQ(parent.backend_name(), pool.backend_name());
+
+  // Small and large allocations are forwarded
+  uint8_t* small;
+  uint8_t* large;
+  ASSERT_OK(pool.Allocate(100, &small));
+  ASSERT_OK(pool.Allocate(2 << 20, &large));
+  ASSERT_EQ(100 + (2 << 20), parent.bytes_allocated());
+  pool.Free(small, 100);
+  pool.Free(large, 2 << 20);
+  ASSERT_EQ(0, parent.bytes_allocated());
+  ASSERT_EQ(0, pool.cached_bytes());
+
+  // Sizes are rounded up to their size class, and freed buffers are reused by
+  // allocations of the same size class
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(5000, &data1));
+  ASSERT_EQ(5120, parent.bytes_allocated());
+  ASSERT_EQ(5000, pool.bytes_allocated());
+  pool.Free(data1, 5000);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(5120, pool.cached_bytes());
+  ASSERT_OK(pool.Allocate(5100, &data2));
+  ASSERT_EQ(data1, data2);
+  ASSERT_EQ(1, pool.num_recycled());
+  ASSERT_EQ(0, pool.cached_bytes());
+  ASSERT_EQ(5120, parent.bytes_allocated());
+
+  // Reallocating within the size class keeps the buffer
+  data2[0] = 42;
+  ASSERT_OK(pool.Reallocate(5100, 4200, &data2));
+  ASSERT_EQ(data1, data2);
+  ASSERT_EQ(4200, pool.bytes_allocated());
+  ASSERT_OK(pool.Reallocate(4200, 8000, &data2));
+  ASSERT_EQ(42, data2[0]);
+  ASSERT_EQ(8000, pool.bytes_allocated());
+  ASSERT_EQ(5120, pool.cached_bytes());
+
+  // Buffers beyond max_cached_bytes are returned to the parent
+  uint8_t* data3;
+  ASSERT_OK(pool.Allocate(8000, &data3));
+  pool.Free(data2, 8000);
+  ASSERT_EQ(5120 + 8192 + 8192, parent.bytes_allocated());
+  pool.Free(data3, 8000);
+  ASSERT_EQ(5120 + 8192, parent.bytes_allocated());
+  ASSERT_EQ(5120 + 8192, pool.cached_bytes());
+  ASSERT_EQ(0, pool.bytes_allocated());
+
+  pool.ReleaseCached();
+  ASSERT_EQ(0, pool.cached_bytes());
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+class TestThreadCachingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ThreadCachingMemoryPool pool_;
+};
+
+TEST_F(TestThreadCachingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestThreadCachingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestThreadCachingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(ThreadCachingMemoryPool, Basics) {
+  ProxyMemoryPool parent(default_memory_pool());
+  auto options = ThreadCachingOptions::Defaults();
+  options.max_size = 256;
+  options.max_cached_bytes_per_thread = 256;
+  ThreadCachingMemoryPool pool(&parent, options);
+  ASSERT_EQ(parent.backend_name(), pool.backend_name());
+
+  // Small allocations are rounded up to a multiple of 64 bytes
+  uint8_t* data1;
+  uint8_t* data2;
+  uint8_t* large;
+  ASSERT_OK(pool.Allocate(100, &data1));
+  ASSERT_OK(pool.Allocate(1000, &large));
+  ASSERT_EQ(128 + 1000, parent.bytes_allocated());
+  ASSERT_EQ(100 + 1000, pool.bytes_allocated());
+
+  // Freed small blocks are reused by the same thread
+  pool.Free(data1, 100);
+  ASSERT_EQ(128, pool.cached_bytes());
+  ASSERT_OK(pool.Allocate(128, &data2));
+  ASSERT_EQ(data1, data2);
+  ASSERT_EQ(0, pool.cached_bytes());
+
+  // Reallocating within the size class keeps the block
+  data2[0] = 42;
+  ASSERT_OK(pool.Reallocate(128, 65, &data2));
+  ASSERT_EQ(data1, data2);
+  ASSERT_OK(pool.Reallocate(65, 200, &data2));
+  ASSERT_EQ(42, data2[0]);
+  ASSERT_EQ(128, pool.cached_bytes());
+  ASSERT_EQ(200 + 1000, pool.bytes_allocated());
+
+  // Blocks beyond the per-thread limit are returned to the parent
+  pool.Free(data2, 200);
+  ASSERT_EQ(128, pool.cached_bytes());
+  ASSERT_EQ(128 + 1000, parent.bytes_allocated());
+  pool.Free(large, 1000);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(1200, pool.max_memory());
+
+  pool.ReleaseCached();
+  ASSERT_EQ(0, pool.cached_bytes());
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(ThreadCachingMemoryPool, Threads) {
+  ProxyMemoryPool parent(default_memory_pool());
+  ThreadCachingMemoryPool pool(&parent);
+  constexpr int kNumThreads = 8;
+  constexpr int kNumBuffers = 100;
+
+  // Blocks may be freed by another thread than the allocating one
+  std::vector<std::vector<uint8_t*>> buffers(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i] {
+      for (int j = 0; j < kNumBuffers; ++j) {
+        uint8_t* data;
+        ARROW_EXPECT_OK(pool.Allocate(j + 1, &data));
+        buffers[i].push_back(data);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // The threads exited, their caches were released
+  ASSERT_EQ(kNumThreads * kNumBuffers * (kNumBuffers + 1) / 2, pool.bytes_allocated());
+  ASSERT_EQ(0, pool.cached_bytes());
+
+  threads.clear();
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i] {
+      const auto& to_free = buffers[(i + 1) % kNumThreads];
+      for (int j = 0; j < kNumBuffers; ++j) {
+        pool.Free(to_free[j], j + 1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(0, pool.cached_bytes());
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(ProfilingMemoryPool, Counters) {
+  ProfilingMemoryPool pool(default_memory_pool());
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(100, &data1));
+  ASSERT_OK(pool.Allocate(0, &data2));
+  ASSERT_OK(pool.Reallocate(100, 300, &data1));
+  ASSERT_OK(pool.Reallocate(300, 200, &data1));
+
+  auto profile = pool.profile();
+  ASSERT_EQ(2, profile.num_allocations);
+  ASSERT_EQ(2, profile.num_reallocations);
+  ASSERT_EQ(0, profile.num_frees);
+  ASSERT_EQ(2, profile.live_buffers);
+  ASSERT_EQ(300, profile.reallocated_bytes);
+  ASSERT_EQ(200, profile.bytes_allocated);
+  ASSERT_EQ(300, profile.max_memory);
+  ASSERT_EQ(200, pool.bytes_allocated());
+
+  ASSERT_EQ(MemoryPoolProfile::kNumSizeBuckets, profile.allocation_sizes.size());
+  ASSERT_EQ(MemoryPoolProfile::kNumSizeBuckets, profile.reallocation_sizes.size());
+  ASSERT_EQ(1, profile.allocation_sizes[0]);  // 0
+  ASSERT_EQ(1, profile.allocation_sizes[7]);  // 100 in [64, 128)
+  ASSERT_EQ(1, profile.reallocation_sizes[8]);  // 200 in [128, 256)
+  ASSERT_EQ(1, profile.reallocation_sizes[9]);  // 300 in [256, 512)
+  ASSERT_TRUE(profile.stack_samples.empty());
+
+  pool.Free(data1, 200);
+  pool.Free(data2, 0);
+  profile = pool.profile();
+  ASSERT_EQ(2, profile.num_frees);
+  ASSERT_EQ(0, profile.live_buffers);
+  ASSERT_EQ(0, profile.bytes_allocated);
+
+  pool.ResetProfile();
+  profile = pool.profile();
+  ASSERT_EQ(0, profile.num_allocations);
+  ASSERT_EQ(0, profile.allocation_sizes[7]);
+  ASSERT_EQ(300, profile.max_memory);
+}
+
+TEST(ProfilingMemoryPool, StackSamples) {
+  ProfilingMemoryPool pool(default_memory_pool(), /*stack_sample_interval=*/2,
+                           /*max_stack_samples=*/3);
+  uint8_t* data[10];
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(pool.Allocate(64, &data[i]));
+  }
+  auto profile = pool.profile();
+  // Stack samples are only available with backtrace support
+  ASSERT_LE(profile.stack_samples.size(), 3);
+  for (const auto& sample : profile.stack_samples) {
+    ASSERT_EQ(64, sample.size);
+    ASSERT_GT(sample.frames.size(), 0);
+  }
+  for (int i = 0; i < 10; ++i) {
+    pool.Free(data[i], 64);
+  }
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
@@ -153,4 +639,19 @@ TEST(Jemalloc, SetDirtyPageDecayMillis) {
 #endif
 }
 
+TEST(Jemalloc, NumaAware) {
+#ifdef ARROW_JEMALLOC
+  MemoryPool* pool;
+  ASSERT_OK(jemalloc_memory_pool(&pool));
+  ASSERT_OK(jemalloc_set_numa_aware(true));
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(100, &data));
+  ASSERT_OK(pool->Reallocate(100, 100000, &data));
+  pool->Free(data, 100000);
+  ASSERT_OK(jemalloc_set_numa_aware(false));
+#else
+  ASSERT_RAISES(Invalid, jemalloc_set_numa_aware(true));
+#endif
+}
+
 }  // namespace arrow
@@ -23,6 +23,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -43,6 +44,7 @@
 #include "arrow/util/macros.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 
 #include "arrow/compute/api.h"
@@ -608,6 +610,148 @@ inline Status ConvertAsPyObjects(const PandasOptions& options, const ChunkedArra
   return Status::OK();
 }
 
+// Python str objects of ASCII characters can be created by copying the characters
+// rather than by decoding them as UTF-8
+static inline PyObject* WrapAsciiString(const char* data, int64_t length) {
+  PyObject* out = PyUnicode_New(length, 127);
+  if (out != nullptr) {
+    std::memcpy(PyUnicode_1BYTE_DATA(out), data, static_cast<size_t>(length));
+  }
+  return out;
+}
+
+/// \brief Conversion of a binary-like column to Python objects in two phases
+///
+/// Prepare() hashes the values to deduplicate and finds which strings are pure
+/// ASCII. It doesn't need the GIL, so the object columns of a table converted with
+/// use_threads are prepared concurrently and only Write(), which creates the Python
+/// objects, is serialized by the GIL.
+template <typename Type>
+class BinaryObjectConverter {
+ public:
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  BinaryObjectConverter(const PandasOptions& options, const ChunkedArray& data)
+      : options_(options), data_(data) {}
+
+  Status Prepare() {
+    if (options_.deduplicate_objects) {
+      return PrepareMemoized();
+    }
+    chunk_is_ascii_.resize(data_.num_chunks(), false);
+    if (is_string_like_type<Type>::value) {
+      for (int c = 0; c < data_.num_chunks(); c++) {
+        const auto& arr = checked_cast<const ArrayType&>(*data_.chunk(c));
+        chunk_is_ascii_[c] = IsAsciiChunk(arr);
+      }
+    }
+    return Status::OK();
+  }
+
+  /// Write the objects, must be called with the GIL held
+  Status Write(PyObject** out_values) {
+    if (options_.deduplicate_objects) {
+      return WriteMemoized(out_values);
+    }
+    for (int c = 0; c < data_.num_chunks(); c++) {
+      const auto& arr = checked_cast<const ArrayType&>(*data_.chunk(c));
+      const bool is_ascii = chunk_is_ascii_[c];
+      auto WrapValue = [is_ascii](const util::string_view& view, PyObject** out) {
+        return Wrap(view, is_ascii, out);
+      };
+      RETURN_NOT_OK(WriteArrayObjects(arr, WrapValue, out_values));
+      out_values += arr.length();
+    }
+    return Status::OK();
+  }
+
+ private:
+  template <typename T = Type>
+  static enable_if_base_binary<T, bool> IsAsciiChunk(const ArrayType& arr) {
+    if (arr.length() == 0) {
+      return true;
+    }
+    const int64_t begin = arr.value_offset(0);
+    const int64_t end = arr.value_offset(arr.length());
+    return ::arrow::util::IsAscii(arr.value_data()->data() + begin, end - begin);
+  }
+
+  template <typename T = Type>
+  static enable_if_fixed_size_binary<T, bool> IsAsciiChunk(const ArrayType&) {
+    return false;
+  }
+
+  static Status Wrap(const util::string_view& view, bool is_ascii, PyObject** out) {
+    if (is_string_like_type<Type>::value && is_ascii) {
+      *out = WrapAsciiString(view.data(), view.length());
+    } else {
+      *out = WrapBytes<Type>::Wrap(view.data(), view.length());
+    }
+    if (*out == nullptr) {
+      PyErr_Clear();
+      return Status::UnknownError("Wrapping ", view, " failed");
+    }
+    return Status::OK();
+  }
+
+  Status PrepareMemoized() {
+    ::arrow::internal::ScalarMemoTable<util::string_view> memo_table(options_.pool);
+    memo_indices_.resize(data_.length());
+    int32_t* memo_index = memo_indices_.data();
+    for (int c = 0; c < data_.num_chunks(); c++) {
+      const auto& arr = checked_cast<const ArrayType&>(*data_.chunk(c));
+      for (int64_t i = 0; i < arr.length(); ++i, ++memo_index) {
+        if (arr.IsNull(i)) {
+          *memo_index = -1;
+          continue;
+        }
+        const util::string_view view = arr.GetView(i);
+        RETURN_NOT_OK(memo_table.GetOrInsert(view, memo_index));
+        if (*memo_index == static_cast<int32_t>(unique_values_.size())) {
+          // New entry
+          unique_values_.push_back(view);
+          unique_is_ascii_.push_back(
+              is_string_like_type<Type>::value &&
+              ::arrow::util::IsAscii(reinterpret_cast<const uint8_t*>(view.data()),
+                                     static_cast<int64_t>(view.size())));
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  Status WriteMemoized(PyObject** out_values) {
+    std::vector<PyObject*> unique_objects(unique_values_.size(), nullptr);
+    for (int32_t memo_index : memo_indices_) {
+      if (memo_index < 0) {
+        Py_INCREF(Py_None);
+        *out_values = Py_None;
+      } else if (unique_objects[memo_index] == nullptr) {
+        // New entry
+        RETURN_NOT_OK(
+            Wrap(unique_values_[memo_index], unique_is_ascii_[memo_index], out_values));
+        unique_objects[memo_index] = *out_values;
+      } else {
+        // Duplicate entry
+        Py_INCREF(unique_objects[memo_index]);
+        *out_values = unique_objects[memo_index];
+      }
+      ++out_values;
+    }
+    return Status::OK();
+  }
+
+  const PandasOptions& options_;
+  const ChunkedArray& data_;
+  // only used if !options_.deduplicate_objects
+  std::vector<bool> chunk_is_ascii_;
+  // only used if options_.deduplicate_objects: for each value the index of its
+  // unique value, or -1 for nulls
+  std::vector<int32_t> memo_indices_;
+  std::vector<util::string_view> unique_values_;
+  std::vector<bool> unique_is_ascii_;
+};
+
 inline Status ConvertStruct(const PandasOptions& options, const ChunkedArray& data,
                             PyObject** out_values) {
   if (data.num_chunks() == 0) {
@@ -894,15 +1038,9 @@ struct ObjectWriterVisitor {
   enable_if_t<is_base_binary_type<Type>::value || is_fixed_size_binary_type<Type>::value,
               Status>
   Visit(const Type& type) {
-    auto WrapValue = [](const util::string_view& view, PyObject** out) {
-      *out = WrapBytes<Type>::Wrap(view.data(), view.length());
-      if (*out == nullptr) {
-        PyErr_Clear();
-        return Status::UnknownError("Wrapping ", view, " failed");
-      }
-      return Status::OK();
-    };
-    return ConvertAsPyObjects<Type>(options, data, WrapValue, out_values);
+    BinaryObjectConverter<Type> converter(options, data);
+    RETURN_NOT_OK(converter.Prepare());
+    return converter.Write(out_values);
   }
 
   template <typename Type>
@@ -985,11 +1123,35 @@ class ObjectWriter : public TypedPandasWriter<NPY_OBJECT> {
  public:
   using TypedPandasWriter<NPY_OBJECT>::TypedPandasWriter;
   Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+    switch (data->type()->id()) {
+      case Type::BINARY:
+        return CopyBinaryInto<BinaryType>(*data, rel_placement);
+      case Type::STRING:
+        return CopyBinaryInto<StringType>(*data, rel_placement);
+      case Type::LARGE_BINARY:
+        return CopyBinaryInto<LargeBinaryType>(*data, rel_placement);
+      case Type::LARGE_STRING:
+        return CopyBinaryInto<LargeStringType>(*data, rel_placement);
+      case Type::FIXED_SIZE_BINARY:
+        return CopyBinaryInto<FixedSizeBinaryType>(*data, rel_placement);
+      default:
+        break;
+    }
     PyAcquireGIL lock;
     ObjectWriterVisitor visitor{this->options_, *data,
                                 this->GetBlockColumnStart(rel_placement)};
     return VisitTypeInline(*data->type(), &visitor);
   }
+
+ private:
+  template <typename Type>
+  Status CopyBinaryInto(const ChunkedArray& data, int64_t rel_placement) {
+    BinaryObjectConverter<Type> converter(this->options_, data);
+    // Only acquire the GIL once the values have been hashed and scanned
+    RETURN_NOT_OK(converter.Prepare());
+    PyAcquireGIL lock;
+    return converter.Write(this->GetBlockColumnStart(rel_placement));
+  }
 };
 
 static inline bool IsNonNullContiguous(const ChunkedArray& data) {
@@ -1391,8 +1553,13 @@ class CategoricalWriter
       RETURN_NOT_OK(WriteIndices(*data, &dict));
     }
 
+    // The values of a dictionary are unique, so hashing them to deduplicate the
+    // Python objects would be wasted work
+    PandasOptions dict_options = this->options_;
+    dict_options.deduplicate_objects = false;
+
     PyObject* pydict;
-    RETURN_NOT_OK(ConvertArrayToPandas(this->options_, dict, nullptr, &pydict));
+    RETURN_NOT_OK(ConvertArrayToPandas(dict_options, dict, nullptr, &pydict));
     dictionary_.reset(pydict);
     ordered_ = dict_type.ordered();
     return Status::OK();
@@ -1959,30 +2126,48 @@ class SplitBlockCreator : public PandasBlockCreator {
   }
 
   Status Convert(PyObject** out) override {
+    writers_.resize(num_columns_);
+    RETURN_NOT_OK(WriteColumns());
+
     PyAcquireGIL lock;
 
     PyObject* result = PyList_New(0);
     RETURN_IF_PYERROR();
 
     for (int i = 0; i < num_columns_; ++i) {
-      std::shared_ptr<PandasWriter> writer;
-      RETURN_NOT_OK(GetWriter(i, &writer));
-      // ARROW-3789 Use std::move on the array to permit self-destructing
-      RETURN_NOT_OK(writer->Write(std::move(arrays_[i]), i, /*rel_placement=*/0));
-
       PyObject* item;
-      RETURN_NOT_OK(writer->GetDataFrameResult(&item));
+      RETURN_NOT_OK(writers_[i]->GetDataFrameResult(&item));
       if (PyList_Append(result, item) < 0) {
         RETURN_IF_PYERROR();
       }
       // PyList_Append increments object refcount
       Py_DECREF(item);
+      writers_[i].reset();
     }
 
     *out = result;
     return Status::OK();
   }
 
+  // The columns are written without holding the GIL, like
+  // ConsolidatedBlockCreator does, so that they can be converted in parallel
+  Status WriteColumns() {
+    auto WriteColumn = [this](int i) {
+      RETURN_NOT_OK(GetWriter(i, &writers_[i]));
+      // ARROW-3789 Use std::move on the array to permit self-destructing
+      return writers_[i]->Write(std::move(arrays_[i]), i, /*rel_placement=*/0);
+    };
+
+    if (options_.use_threads) {
+      return ParallelFor(num_columns_, WriteColumn);
+    } else {
+      for (int i = 0; i < num_columns_; ++i) {
+        RETURN_NOT_OK(WriteColumn(i));
+      }
+      return Status::OK();
+    }
+  }
+
  private:
   std::vector<std::shared_ptr<PandasWriter>> writers_;
 };
@@ -203,6 +203,18 @@ Status GetValue(PyObject* context, const Array& arr, int64_t index, int8_t type,
       *result = wrap_buffer(blobs.buffers[ref]);
       return Status::OK();
     }
+    case PythonType::PICKLE_BUFFER: {
+#if PY_VERSION_HEX >= 0x03080000
+      int32_t ref = checked_cast<const Int32Array&>(arr).Value(index);
+      OwnedRef buffer(wrap_buffer(blobs.buffers[ref]));
+      RETURN_IF_PYERROR();
+      *result = PyPickleBuffer_FromObject(buffer.obj());
+      RETURN_IF_PYERROR();
+      return Status::OK();
+#else
+      return Status::NotImplemented("Pickle buffers require Python 3.8 or later");
+#endif
+    }
     default: { ARROW_CHECK(false) << "union tag " << type << "' not recognized"; }
   }
   return Status::OK();
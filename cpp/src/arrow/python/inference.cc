@@ -540,27 +540,26 @@ class TypeInferrer {
     PyObject* key_obj;
     PyObject* value_obj;
     Py_ssize_t pos = 0;
+    size_t i = 0;
 
     while (PyDict_Next(obj, &pos, &key_obj, &value_obj)) {
-      std::string key;
-      if (PyUnicode_Check(key_obj)) {
-        RETURN_NOT_OK(internal::PyUnicode_AsStdString(key_obj, &key));
-      } else if (PyBytes_Check(key_obj)) {
-        key = internal::PyBytes_AsStdString(key_obj);
+      TypeInferrer* visitor;
+      if (i < dict_keys_.size() && dict_keys_[i].obj() == key_obj) {
+        // Same key object at the same position as in the previous dict, as is
+        // usual for dicts created by the same code: skip decoding the key
+        visitor = dict_key_inferrers_[i];
       } else {
-        return Status::TypeError("Expected dict key of type str or bytes, got '",
-                                 Py_TYPE(key_obj)->tp_name, "'");
+        RETURN_NOT_OK(GetStructInferrer(key_obj, &visitor));
+        Py_INCREF(key_obj);
+        if (i < dict_keys_.size()) {
+          dict_keys_[i].reset(key_obj);
+          dict_key_inferrers_[i] = visitor;
+        } else {
+          dict_keys_.emplace_back(key_obj);
+          dict_key_inferrers_.push_back(visitor);
+        }
       }
-      // Get or create visitor for this key
-      auto it = struct_inferrers_.find(key);
-      if (it == struct_inferrers_.end()) {
-        it = struct_inferrers_
-                 .insert(
-                     std::make_pair(key, TypeInferrer(pandas_null_sentinels_,
-                                                      validate_interval_, make_unions_)))
-                 .first;
-      }
-      TypeInferrer* visitor = &it->second;
+      ++i;
 
       // We ignore termination signals from child visitors for now
       //
@@ -576,6 +575,29 @@ class TypeInferrer {
     return Status::OK();
   }
 
+  // Get or create the visitor for a dict key
+  Status GetStructInferrer(PyObject* key_obj, TypeInferrer** out) {
+    std::string key;
+    if (PyUnicode_Check(key_obj)) {
+      RETURN_NOT_OK(internal::PyUnicode_AsStdString(key_obj, &key));
+    } else if (PyBytes_Check(key_obj)) {
+      key = internal::PyBytes_AsStdString(key_obj);
+    } else {
+      return Status::TypeError("Expected dict key of type str or bytes, got '",
+                               Py_TYPE(key_obj)->tp_name, "'");
+    }
+    auto it = struct_inferrers_.find(key);
+    if (it == struct_inferrers_.end()) {
+      it = struct_inferrers_
+               .insert(std::make_pair(
+                   key, TypeInferrer(pandas_null_sentinels_, validate_interval_,
+                                     make_unions_)))
+               .first;
+    }
+    *out = &it->second;
+    return Status::OK();
+  }
+
   Status GetStructType(std::shared_ptr<DataType>* out) {
     std::vector<std::shared_ptr<Field>> fields;
     for (auto&& it : struct_inferrers_) {
@@ -611,6 +633,9 @@ class TypeInferrer {
   int64_t numpy_dtype_count_;
   std::unique_ptr<TypeInferrer> list_inferrer_;
   std::map<std::string, TypeInferrer> struct_inferrers_;
+  // The keys of the last visited dict, in iteration order, and their visitors
+  std::vector<OwnedRefNoGIL> dict_keys_;
+  std::vector<TypeInferrer*> dict_key_inferrers_;
 
   // If we observe a strongly-typed value in e.g. a NumPy array, we can store
   // it here to skip the type counting logic above
@@ -17,12 +17,15 @@
 
 #include "arrow/python/io.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
 
+#include "arrow/buffer.h"
 #include "arrow/io/memory.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
@@ -41,7 +44,10 @@ namespace py {
 // calling any methods
 class PythonFile {
  public:
-  explicit PythonFile(PyObject* file) : file_(file) { Py_INCREF(file); }
+  explicit PythonFile(PyObject* file)
+      : file_(file), has_readinto_(PyObject_HasAttrString(file, "readinto") != 0) {
+    Py_INCREF(file);
+  }
 
   Status CheckClosed() const {
     if (!file_) {
@@ -84,6 +90,24 @@ class PythonFile {
     return ret != 0;
   }
 
+  // Whether the file supports seeking, assuming not if seekable() fails
+  bool seekable() const {
+    if (!file_ || !PyObject_HasAttrString(file_.obj(), "seekable")) {
+      return false;
+    }
+    OwnedRef result(cpp_PyObject_CallMethod(file_.obj(), "seekable", "()"));
+    if (result.obj() == NULL) {
+      PyErr_Clear();
+      return false;
+    }
+    int ret = PyObject_IsTrue(result.obj());
+    if (ret < 0) {
+      PyErr_Clear();
+      return false;
+    }
+    return ret != 0;
+  }
+
   Status Seek(int64_t position, int whence) {
     RETURN_NOT_OK(CheckClosed());
 
@@ -105,6 +129,67 @@ class PythonFile {
     return Status::OK();
   }
 
+  // Read up to `nbytes` into `out`, with readinto() if the file supports it
+  Result<int64_t> ReadInto(int64_t nbytes, uint8_t* out) {
+    if (!has_readinto_) {
+      OwnedRef bytes;
+      RETURN_NOT_OK(Read(nbytes, bytes.ref()));
+      RETURN_NOT_OK(CheckBytes(bytes.obj()));
+      const int64_t bytes_read = PyBytes_GET_SIZE(bytes.obj());
+      if (bytes_read > nbytes) {
+        return Status::IOError("Python file read() returned more bytes than requested");
+      }
+      std::memcpy(out, PyBytes_AS_STRING(bytes.obj()), bytes_read);
+      return bytes_read;
+    }
+
+    RETURN_NOT_OK(CheckClosed());
+    int64_t total = 0;
+    // readinto() may return less than requested before the end of the file
+    while (total < nbytes) {
+      OwnedRef view(PyMemoryView_FromMemory(reinterpret_cast<char*>(out + total),
+                                            static_cast<Py_ssize_t>(nbytes - total),
+                                            PyBUF_WRITE));
+      PY_RETURN_IF_ERROR(StatusCode::IOError);
+      OwnedRef result(
+          cpp_PyObject_CallMethod(file_.obj(), "readinto", "(O)", view.obj()));
+      PY_RETURN_IF_ERROR(StatusCode::IOError);
+      // Don't let the file hold on to our memory
+      OwnedRef released(cpp_PyObject_CallMethod(view.obj(), "release", "()"));
+      PY_RETURN_IF_ERROR(StatusCode::IOError);
+
+      if (result.obj() == Py_None) {
+        // Non-blocking file without data available
+        break;
+      }
+      const int64_t bytes_read = PyLong_AsLongLong(result.obj());
+      PY_RETURN_IF_ERROR(StatusCode::IOError);
+      if (bytes_read < 0 || bytes_read > nbytes - total) {
+        return Status::IOError("Python file readinto() returned an invalid size");
+      }
+      if (bytes_read == 0) {
+        break;
+      }
+      total += bytes_read;
+    }
+    return total;
+  }
+
+  // Read up to `nbytes`, with readinto() if the file supports it, or else
+  // wrapping the object returned by read() without copying it
+  Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
+    if (!has_readinto_) {
+      OwnedRef bytes;
+      RETURN_NOT_OK(Read(nbytes, bytes.ref()));
+      return PyBuffer::FromPyObject(bytes.obj());
+    }
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buffer));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadInto(nbytes, buffer->mutable_data()));
+    RETURN_NOT_OK(buffer->Resize(bytes_read, /*shrink_to_fit=*/false));
+    return buffer;
+  }
+
   Status Write(const void* data, int64_t nbytes) {
     RETURN_NOT_OK(CheckClosed());
 
@@ -150,14 +235,29 @@ class PythonFile {
   std::mutex& lock() { return lock_; }
 
  private:
+  static Status CheckBytes(PyObject* obj) {
+    DCHECK(obj != NULL);
+    if (!PyBytes_Check(obj)) {
+      return Status::TypeError(
+          "Python file read() should have returned a bytes object, got '",
+          Py_TYPE(obj)->tp_name, "' (did you open the file in binary mode?)");
+    }
+    return Status::OK();
+  }
+
   std::mutex lock_;
   OwnedRefNoGIL file_;
+  const bool has_readinto_;
 };
 
 // ----------------------------------------------------------------------
 // Seekable input stream
 
-PyReadableFile::PyReadableFile(PyObject* file) { file_.reset(new PythonFile(file)); }
+PyReadableFile::PyReadableFile(PyObject* file, int64_t readahead_size) {
+  file_.reset(new PythonFile(file));
+  // Reading ahead could block on streams such as sockets
+  readahead_size_ = file_->seekable() ? readahead_size : 0;
+}
 
 // The destructor does not close the underlying Python file object, as
 // there may be multiple references to it.  Instead let the Python
@@ -165,10 +265,14 @@ PyReadableFile::PyReadableFile(PyObject* file) { file_.reset(new PythonFile(file
 PyReadableFile::~PyReadableFile() {}
 
 Status PyReadableFile::Abort() {
+  std::lock_guard<std::mutex> guard(file_->lock());
+  readahead_.reset();
   return SafeCallIntoPython([this]() { return file_->Abort(); });
 }
 
 Status PyReadableFile::Close() {
+  std::lock_guard<std::mutex> guard(file_->lock());
+  readahead_.reset();
   return SafeCallIntoPython([this]() { return file_->Close(); });
 }
 
@@ -181,60 +285,150 @@ bool PyReadableFile::closed() const {
   return res;
 }
 
-Status PyReadableFile::Seek(int64_t position) {
-  return SafeCallIntoPython([=] { return file_->Seek(position, 0); });
+int64_t PyReadableFile::buffered() const {
+  return readahead_ ? readahead_->size() - readahead_offset_ : 0;
 }
 
-Result<int64_t> PyReadableFile::Tell() const {
-  return SafeCallIntoPython([=]() -> Result<int64_t> { return file_->Tell(); });
+Status PyReadableFile::DoSeek(int64_t position) {
+  // Seeking within the readahead doesn't need Python
+  if (readahead_ && readahead_position_ >= 0 && position >= readahead_position_ &&
+      position <= readahead_position_ + readahead_->size()) {
+    readahead_offset_ = position - readahead_position_;
+    return Status::OK();
+  }
+  RETURN_NOT_OK(SafeCallIntoPython([=] { return file_->Seek(position, 0); }));
+  readahead_.reset();
+  readahead_offset_ = 0;
+  readahead_position_ = position;
+  return Status::OK();
 }
 
-Result<int64_t> PyReadableFile::Read(int64_t nbytes, void* out) {
-  return SafeCallIntoPython([=]() -> Result<int64_t> {
-    OwnedRef bytes;
-    RETURN_NOT_OK(file_->Read(nbytes, bytes.ref()));
-    PyObject* bytes_obj = bytes.obj();
-    DCHECK(bytes_obj != NULL);
+Status PyReadableFile::FillReadahead() {
+  const int64_t available = buffered();
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(available + readahead_size_, &buffer));
+  if (available > 0) {
+    std::memcpy(buffer->mutable_data(), readahead_->data() + readahead_offset_,
+                available);
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      int64_t bytes_read,
+      SafeCallIntoPython([&]() -> Result<int64_t> {
+        return file_->ReadInto(readahead_size_, buffer->mutable_data() + available);
+      }));
+  RETURN_NOT_OK(buffer->Resize(available + bytes_read, /*shrink_to_fit=*/false));
+  if (readahead_position_ >= 0) {
+    readahead_position_ += readahead_offset_;
+  }
+  readahead_ = std::move(buffer);
+  readahead_offset_ = 0;
+  return Status::OK();
+}
 
-    if (!PyBytes_Check(bytes_obj)) {
-      return Status::TypeError(
-          "Python file read() should have returned a bytes object, got '",
-          Py_TYPE(bytes_obj)->tp_name, "' (did you open the file in binary mode?)");
+void PyReadableFile::ConsumeReadahead(int64_t nbytes) {
+  if (readahead_position_ >= 0) {
+    readahead_position_ += (readahead_ ? readahead_->size() : 0) + nbytes;
+  }
+  readahead_.reset();
+  readahead_offset_ = 0;
+}
+
+Result<int64_t> PyReadableFile::DoRead(int64_t nbytes, void* out) {
+  auto out_data = reinterpret_cast<uint8_t*>(out);
+  int64_t total = 0;
+  auto read_from_readahead = [&]() {
+    const int64_t n = std::min(nbytes - total, buffered());
+    if (n > 0) {
+      std::memcpy(out_data + total, readahead_->data() + readahead_offset_, n);
+      readahead_offset_ += n;
+      total += n;
     }
+  };
 
-    int64_t bytes_read = PyBytes_GET_SIZE(bytes_obj);
-    std::memcpy(out, PyBytes_AS_STRING(bytes_obj), bytes_read);
-    return bytes_read;
-  });
+  read_from_readahead();
+  const int64_t remaining = nbytes - total;
+  if (remaining == 0) {
+    return total;
+  }
+  if (remaining < readahead_size_) {
+    RETURN_NOT_OK(FillReadahead());
+    read_from_readahead();
+    return total;
+  }
+  // Large reads go straight to the output
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                        SafeCallIntoPython([&]() -> Result<int64_t> {
+                          return file_->ReadInto(remaining, out_data + total);
+                        }));
+  ConsumeReadahead(bytes_read);
+  return total + bytes_read;
 }
 
-Result<std::shared_ptr<Buffer>> PyReadableFile::Read(int64_t nbytes) {
-  return SafeCallIntoPython([=]() -> Result<std::shared_ptr<Buffer>> {
-    OwnedRef bytes_obj;
-    RETURN_NOT_OK(file_->Read(nbytes, bytes_obj.ref()));
-    DCHECK(bytes_obj.obj() != NULL);
+Result<std::shared_ptr<Buffer>> PyReadableFile::DoReadBuffer(int64_t nbytes) {
+  if (nbytes > buffered() && nbytes - buffered() < readahead_size_) {
+    RETURN_NOT_OK(FillReadahead());
+  }
+  if (buffered() > 0 && (nbytes <= buffered() || nbytes - buffered() < readahead_size_)) {
+    // Slice the readahead without copying
+    const int64_t n = std::min(nbytes, buffered());
+    auto out = SliceBuffer(readahead_, readahead_offset_, n);
+    readahead_offset_ += n;
+    return out;
+  }
+  if (buffered() == 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto out,
+        SafeCallIntoPython([&]() { return file_->ReadBuffer(nbytes); }));
+    ConsumeReadahead(out->size());
+    return out;
+  }
+  std::shared_ptr<ResizableBuffer> out;
+  RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &out));
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoRead(nbytes, out->mutable_data()));
+  RETURN_NOT_OK(out->Resize(bytes_read, /*shrink_to_fit=*/false));
+  return out;
+}
 
-    return PyBuffer::FromPyObject(bytes_obj.obj());
-  });
+Status PyReadableFile::Seek(int64_t position) {
+  std::lock_guard<std::mutex> guard(file_->lock());
+  return DoSeek(position);
 }
 
-Result<int64_t> PyReadableFile::ReadAt(int64_t position, int64_t nbytes, void* out) {
+Result<int64_t> PyReadableFile::Tell() const {
   std::lock_guard<std::mutex> guard(file_->lock());
+  if (readahead_position_ >= 0) {
+    return readahead_position_ + readahead_offset_;
+  }
   return SafeCallIntoPython([=]() -> Result<int64_t> {
-    RETURN_NOT_OK(Seek(position));
-    return Read(nbytes, out);
+    ARROW_ASSIGN_OR_RAISE(int64_t position, file_->Tell());
+    return position - buffered();
   });
 }
 
+Result<int64_t> PyReadableFile::Read(int64_t nbytes, void* out) {
+  std::lock_guard<std::mutex> guard(file_->lock());
+  return DoRead(nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> PyReadableFile::Read(int64_t nbytes) {
+  std::lock_guard<std::mutex> guard(file_->lock());
+  return DoReadBuffer(nbytes);
+}
+
+Result<int64_t> PyReadableFile::ReadAt(int64_t position, int64_t nbytes, void* out) {
+  std::lock_guard<std::mutex> guard(file_->lock());
+  RETURN_NOT_OK(DoSeek(position));
+  return DoRead(nbytes, out);
+}
+
 Result<std::shared_ptr<Buffer>> PyReadableFile::ReadAt(int64_t position, int64_t nbytes) {
   std::lock_guard<std::mutex> guard(file_->lock());
-  return SafeCallIntoPython([=]() -> Result<std::shared_ptr<Buffer>> {
-    RETURN_NOT_OK(Seek(position));
-    return Read(nbytes);
-  });
+  RETURN_NOT_OK(DoSeek(position));
+  return DoReadBuffer(nbytes);
 }
 
 Result<int64_t> PyReadableFile::GetSize() {
+  std::lock_guard<std::mutex> guard(file_->lock());
   return SafeCallIntoPython([=]() -> Result<int64_t> {
     ARROW_ASSIGN_OR_RAISE(int64_t current_position, file_->Tell());
     RETURN_NOT_OK(file_->Seek(0, 2));
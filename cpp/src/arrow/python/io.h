@@ -18,6 +18,7 @@
 #ifndef PYARROW_IO_H
 #define PYARROW_IO_H
 
+#include <cstdint>
 #include <memory>
 
 #include "arrow/io/interfaces.h"
@@ -32,9 +33,22 @@ namespace py {
 
 class ARROW_NO_EXPORT PythonFile;
 
+/// \brief A RandomAccessFile reading from a Python file-like object
+///
+/// Calling into Python requires the GIL, so reads smaller than the readahead
+/// size fetch a whole chunk of the file at once and are then served from it
+/// without the GIL.  The position of the Python file can therefore be ahead of
+/// the position of this file.  Non-seekable files are not read ahead.  Reads
+/// are done with readinto() into Arrow memory when the file supports it.
 class ARROW_PYTHON_EXPORT PyReadableFile : public io::RandomAccessFile {
  public:
-  explicit PyReadableFile(PyObject* file);
+  static constexpr int64_t kDefaultReadaheadSize = 256 * 1024;
+
+  /// \param[in] file the Python file-like object
+  /// \param[in] readahead_size the size of the chunks fetched from the Python
+  /// file for small reads, 0 to disable readahead
+  explicit PyReadableFile(PyObject* file,
+                          int64_t readahead_size = kDefaultReadaheadSize);
   ~PyReadableFile() override;
 
   Status Close() override;
@@ -57,7 +71,27 @@ class ARROW_PYTHON_EXPORT PyReadableFile : public io::RandomAccessFile {
   Result<int64_t> Tell() const override;
 
  private:
+  // The methods below must be called with the file lock held
+
+  // The number of bytes read ahead and not consumed yet
+  int64_t buffered() const;
+  Status DoSeek(int64_t position);
+  Result<int64_t> DoRead(int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadBuffer(int64_t nbytes);
+  // Read readahead_size_ more bytes after the unconsumed ones, with the GIL held
+  Status FillReadahead();
+  // Account for `nbytes` read from the Python file bypassing the readahead
+  void ConsumeReadahead(int64_t nbytes);
+
   std::unique_ptr<PythonFile> file_;
+  // 0 if the Python file isn't seekable
+  int64_t readahead_size_;
+  // The bytes read ahead: the Python file is positioned at their end
+  std::shared_ptr<ResizableBuffer> readahead_;
+  // The number of bytes of readahead_ already consumed
+  int64_t readahead_offset_ = 0;
+  // The position in the file of the start of readahead_, -1 if not known yet
+  int64_t readahead_position_ = -1;
 };
 
 class ARROW_PYTHON_EXPORT PyOutputStream : public io::OutputStream {
@@ -225,6 +225,9 @@ class NumPyConverter {
   // NumPy unicode arrays
   Status Visit(const StringType& type);
 
+  // Transcode a NumPy unicode array to UTF8 strings
+  Status ConvertUnicode();
+
   Status Visit(const StructType& type);
 
   Status Visit(const FixedSizeBinaryType& type);
@@ -595,6 +598,12 @@ Status NumPyConverter::Visit(const FixedSizeBinaryType& type) {
                            byte_width, ")");
   }
 
+  if (mask_ == nullptr && !is_strided()) {
+    // Zero-copy, the values have the same layout in NumPy and Arrow
+    auto data = std::make_shared<NumPyBuffer>(reinterpret_cast<PyObject*>(arr_));
+    return PushArray(ArrayData::Make(type_, length_, {nullptr, data}, 0));
+  }
+
   FixedSizeBinaryBuilder builder(::arrow::fixed_size_binary(byte_width), pool_);
   auto data = reinterpret_cast<const uint8_t*>(PyArray_DATA(arr_));
 
@@ -615,31 +624,13 @@ namespace {
 // NumPy unicode is UCS4/UTF32 always
 constexpr int kNumPyUnicodeSize = 4;
 
-Status AppendUTF32(const char* data, int itemsize, int byteorder,
-                   ::arrow::internal::ChunkedStringBuilder* builder) {
-  // The binary \x00\x00\x00\x00 indicates a nul terminator in NumPy unicode,
-  // so we need to detect that here to truncate if necessary. Yep.
-  int actual_length = 0;
-  for (; actual_length < itemsize / kNumPyUnicodeSize; ++actual_length) {
-    const char* code_point = data + actual_length * kNumPyUnicodeSize;
-    if ((*code_point == '\0') && (*(code_point + 1) == '\0') &&
-        (*(code_point + 2) == '\0') && (*(code_point + 3) == '\0')) {
-      break;
-    }
+// The number of code points of a NumPy unicode value, which is padded with NULs
+int64_t UnicodeLength(const uint32_t* code_points, int64_t max_length) {
+  int64_t length = 0;
+  while (length < max_length && code_points[length] != 0) {
+    ++length;
   }
-
-  OwnedRef unicode_obj(PyUnicode_DecodeUTF32(data, actual_length * kNumPyUnicodeSize,
-                                             nullptr, &byteorder));
-  RETURN_IF_PYERROR();
-  OwnedRef utf8_obj(PyUnicode_AsUTF8String(unicode_obj.obj()));
-  if (utf8_obj.obj() == NULL) {
-    PyErr_Clear();
-    return Status::Invalid("failed converting UTF32 to UTF8");
-  }
-
-  const int32_t length = static_cast<int32_t>(PyBytes_GET_SIZE(utf8_obj.obj()));
-  return builder->Append(
-      reinterpret_cast<const uint8_t*>(PyBytes_AS_STRING(utf8_obj.obj())), length);
+  return length;
 }
 
 }  // namespace
@@ -651,17 +642,17 @@ Status NumPyConverter::Visit(const StringType& type) {
 
   auto data = reinterpret_cast<const uint8_t*>(PyArray_DATA(arr_));
 
-  char numpy_byteorder = dtype_->byteorder;
+  const bool is_binary_type = dtype_->type_num == NPY_STRING;
+  const bool is_unicode_type = dtype_->type_num == NPY_UNICODE;
 
-  // For Python C API, -1 is little-endian, 1 is big-endian
-  int byteorder = numpy_byteorder == '>' ? 1 : -1;
+  if (is_unicode_type) {
+    // Transcoded without Python, so without the GIL
+    return ConvertUnicode();
+  }
 
   PyAcquireGIL gil_lock;
 
-  const bool is_binary_type = dtype_->type_num == NPY_STRING;
-  const bool is_unicode_type = dtype_->type_num == NPY_UNICODE;
-
-  if (!is_binary_type && !is_unicode_type) {
+  if (!is_binary_type) {
     const bool is_float_type = dtype_->kind == 'f';
     if (from_pandas_ && is_float_type) {
       // in case of from_pandas=True, accept an all-NaN float array as input
@@ -683,17 +674,11 @@ Status NumPyConverter::Visit(const StringType& type) {
   }
 
   auto AppendNonNullValue = [&](const uint8_t* data) {
-    if (is_binary_type) {
-      if (ARROW_PREDICT_TRUE(util::ValidateUTF8(data, itemsize_))) {
-        return builder.Append(data, itemsize_);
-      } else {
-        return Status::Invalid("Encountered non-UTF8 binary value: ",
-                               HexEncode(data, itemsize_));
-      }
+    if (ARROW_PREDICT_TRUE(util::ValidateUTF8(data, itemsize_))) {
+      return builder.Append(data, itemsize_);
     } else {
-      // is_unicode_type case
-      return AppendUTF32(reinterpret_cast<const char*>(data), itemsize_, byteorder,
-                         &builder);
+      return Status::Invalid("Encountered non-UTF8 binary value: ",
+                             HexEncode(data, itemsize_));
     }
   };
 
@@ -722,6 +707,98 @@ Status NumPyConverter::Visit(const StringType& type) {
   return Status::OK();
 }
 
+Status NumPyConverter::ConvertUnicode() {
+  const int64_t max_length = itemsize_ / kNumPyUnicodeSize;
+  const auto data = reinterpret_cast<const uint8_t*>(PyArray_DATA(arr_));
+
+  // Code points are read in place unless they need to be aligned or byte swapped
+  const bool byte_swapped = PyArray_ISBYTESWAPPED(arr_);
+  const bool copy_values = byte_swapped || !PyArray_ISALIGNED(arr_);
+  std::vector<uint32_t> value_copy(copy_values ? max_length : 0);
+  auto GetCodePoints = [&](int64_t i) {
+    const uint8_t* value = data + i * stride_;
+    if (!copy_values) {
+      return reinterpret_cast<const uint32_t*>(value);
+    }
+    std::memcpy(value_copy.data(), value, max_length * kNumPyUnicodeSize);
+    if (byte_swapped) {
+      for (auto& code_point : value_copy) {
+        code_point = BitUtil::ByteSwap(code_point);
+      }
+    }
+    return static_cast<const uint32_t*>(value_copy.data());
+  };
+
+  if (mask_ != nullptr) {
+    RETURN_NOT_OK(InitNullBitmap());
+    null_count_ = MaskToBitmap(mask_, length_, null_bitmap_data_);
+  }
+  auto IsNull = [this](int64_t i) {
+    return null_bitmap_data_ != nullptr && !BitUtil::GetBit(null_bitmap_data_, i);
+  };
+
+  // First pass: compute the encoded size of each value so that the output
+  // buffers can be allocated to their exact size
+  std::vector<int32_t> value_sizes(length_, 0);
+  for (int64_t i = 0; i < length_; ++i) {
+    if (IsNull(i)) {
+      continue;
+    }
+    const uint32_t* code_points = GetCodePoints(i);
+    const int64_t size =
+        util::UTF32ToUTF8Size(code_points, UnicodeLength(code_points, max_length));
+    if (ARROW_PREDICT_FALSE(size < 0)) {
+      return Status::Invalid("Encountered invalid unicode code point in value ", i);
+    }
+    value_sizes[i] = static_cast<int32_t>(size);
+  }
+
+  // Second pass: encode chunks of at most kBinaryChunksize bytes
+  int64_t chunk_start = 0;
+  do {
+    int64_t chunk_end = chunk_start;
+    int64_t chunk_data_size = 0;
+    while (chunk_end < length_ &&
+           (chunk_end == chunk_start ||
+            chunk_data_size + value_sizes[chunk_end] <= kBinaryChunksize)) {
+      chunk_data_size += value_sizes[chunk_end++];
+    }
+    const int64_t chunk_length = chunk_end - chunk_start;
+
+    std::shared_ptr<Buffer> offsets, values, null_bitmap;
+    RETURN_NOT_OK(AllocateBuffer(pool_, (chunk_length + 1) * sizeof(int32_t), &offsets));
+    RETURN_NOT_OK(AllocateBuffer(pool_, chunk_data_size, &values));
+    if (chunk_length == length_) {
+      null_bitmap = null_bitmap_;
+    } else if (null_bitmap_ != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(null_bitmap, CopyBitmap(pool_, null_bitmap_data_, chunk_start,
+                                                    chunk_length));
+    }
+    int64_t null_count = 0;
+
+    auto out_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    uint8_t* out_values = values->mutable_data();
+    const uint8_t* values_start = out_values;
+    for (int64_t i = chunk_start; i < chunk_end; ++i) {
+      *out_offsets++ = static_cast<int32_t>(out_values - values_start);
+      if (IsNull(i)) {
+        ++null_count;
+        continue;
+      }
+      const uint32_t* code_points = GetCodePoints(i);
+      out_values = util::UTF32ToUTF8(code_points, UnicodeLength(code_points, max_length),
+                                     out_values);
+    }
+    *out_offsets = static_cast<int32_t>(out_values - values_start);
+
+    RETURN_NOT_OK(PushArray(ArrayData::Make(::arrow::utf8(), chunk_length,
+                                            {null_bitmap, offsets, values}, null_count)));
+    chunk_start = chunk_end;
+  } while (chunk_start < length_);
+
+  return Status::OK();
+}
+
 Status NumPyConverter::Visit(const StructType& type) {
   std::vector<NumPyConverter> sub_converters;
   std::vector<OwnedRefNoGIL> sub_arrays;
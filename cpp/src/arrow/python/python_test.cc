@@ -333,6 +333,60 @@ TEST(BuiltinConversionTest, TestMixedTypeFails) {
   ASSERT_RAISES(TypeError, ConvertPySequence(list, {}, &arr));
 }
 
+TEST(BuiltinConversionTest, TestSpeculativeInference) {
+  // Dicts sharing their key objects, with an extra key and a float in the last one
+  OwnedRef key_a(PyUnicode_FromString("a"));
+  OwnedRef key_b(PyUnicode_FromString("b"));
+  OwnedRef key_c(PyUnicode_FromString("c"));
+  const Py_ssize_t length = 10;
+  OwnedRef list_ref(PyList_New(length));
+  PyObject* list = list_ref.obj();
+  ASSERT_NE(list, nullptr);
+  for (Py_ssize_t i = 0; i < length; ++i) {
+    PyObject* dict = PyDict_New();
+    ASSERT_NE(dict, nullptr);
+    ASSERT_EQ(PyList_SetItem(list, i, dict), 0);
+    OwnedRef a(PyLong_FromSsize_t(i));
+    OwnedRef b(PyUnicode_FromString("x"));
+    ASSERT_EQ(PyDict_SetItem(dict, key_b.obj(), b.obj()), 0);
+    ASSERT_EQ(PyDict_SetItem(dict, key_a.obj(), a.obj()), 0);
+    if (i == length - 1) {
+      OwnedRef c(PyFloat_FromDouble(1.5));
+      ASSERT_EQ(PyDict_SetItem(dict, key_c.obj(), c.obj()), 0);
+    }
+  }
+
+  std::shared_ptr<ChunkedArray> expected, arr;
+  PyConversionOptions options;
+  ASSERT_OK(ConvertPySequence(list, options, &expected));
+  ASSERT_EQ(expected->type()->num_children(), 3);
+
+  for (int64_t sample_size : {1, 4, 9, 10}) {
+    options.speculative_inference_size = sample_size;
+    ASSERT_OK(ConvertPySequence(list, options, &arr));
+    AssertChunkedEqual(*expected, *arr);
+  }
+
+  // Integers after a sample of nulls
+  OwnedRef ints_ref(PyList_New(length));
+  PyObject* ints = ints_ref.obj();
+  ASSERT_NE(ints, nullptr);
+  for (Py_ssize_t i = 0; i < length; ++i) {
+    PyObject* value;
+    if (i < 5) {
+      Py_INCREF(Py_None);
+      value = Py_None;
+    } else {
+      value = PyLong_FromSsize_t(i);
+    }
+    ASSERT_EQ(PyList_SetItem(ints, i, value), 0);
+  }
+  options.speculative_inference_size = 2;
+  ASSERT_OK(ConvertPySequence(ints, options, &arr));
+  ASSERT_TRUE(arr->type()->Equals(int64()));
+  ASSERT_EQ(arr->null_count(), 5);
+}
+
 TEST_F(DecimalTest, FromPythonDecimalRescaleNotTruncateable) {
   // We fail when truncating values that would lose data if cast to a decimal type with
   // lower scale
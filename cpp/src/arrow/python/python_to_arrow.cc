@@ -926,7 +926,9 @@ class StructConverter
 
     field_name_bytes_list_.reset(PyList_New(num_fields_));
     field_name_unicode_list_.reset(PyList_New(num_fields_));
+    cached_key_list_.reset(PyList_New(0));
     RETURN_IF_PYERROR();
+    dict_values_.resize(num_fields_);
 
     // Initialize the child converters and field names
     for (int i = 0; i < num_fields_; i++) {
@@ -939,12 +941,15 @@ class StructConverter
       RETURN_NOT_OK(value_converter->Init(this->typed_builder_->field_builder(i)));
       value_converters_.push_back(std::move(value_converter));
 
-      // Store the field name as a PyObject, for dict matching
+      // Store the field name as a PyObject, for dict matching. The unicode name is
+      // interned, so that dict lookups with keys from string literals only compare
+      // pointers
       PyObject* bytesobj =
           PyBytes_FromStringAndSize(field_name.c_str(), field_name.size());
       PyObject* unicodeobj =
           PyUnicode_FromStringAndSize(field_name.c_str(), field_name.size());
       RETURN_IF_PYERROR();
+      PyUnicode_InternInPlace(&unicodeobj);
       PyList_SET_ITEM(field_name_bytes_list_.obj(), i, bytesobj);
       PyList_SET_ITEM(field_name_unicode_list_.obj(), i, unicodeobj);
     }
@@ -1010,6 +1015,7 @@ class StructConverter
       RETURN_IF_PYERROR();
     }
     // If we come here, it means all keys are absent
+    RETURN_NOT_OK(CheckNoExtraKeys(obj, 0));
     for (int i = 0; i < num_fields_; i++) {
       RETURN_NOT_OK(value_converters_[i]->AppendSingleVirtual(Py_None));
     }
@@ -1025,19 +1031,100 @@ class StructConverter
   }
 
   Status AppendDictItem(PyObject* obj, PyObject* field_name_list) {
-    // NOTE we're ignoring any extraneous dict items
-    for (int i = 0; i < num_fields_; i++) {
-      PyObject* nameobj = PyList_GET_ITEM(field_name_list, i);  // borrowed
-      PyObject* valueobj = PyDict_GetItem(obj, nameobj);        // borrowed
-      if (valueobj == NULL) {
-        RETURN_IF_PYERROR();
+    if (MatchCachedKeys(obj)) {
+      key_cache_misses_ = 0;
+    } else {
+      if (key_cache_misses_ < kMaxKeyCacheMisses) {
+        ++key_cache_misses_;
+        RETURN_NOT_OK(CacheKeys(obj, field_name_list));
+      }
+      int num_found = 0;
+      for (int i = 0; i < num_fields_; i++) {
+        PyObject* nameobj = PyList_GET_ITEM(field_name_list, i);  // borrowed
+        PyObject* valueobj = PyDict_GetItem(obj, nameobj);        // borrowed
+        if (valueobj == NULL) {
+          RETURN_IF_PYERROR();
+        } else {
+          ++num_found;
+        }
+        dict_values_[i] = valueobj;
       }
+      RETURN_NOT_OK(CheckNoExtraKeys(obj, num_found));
+    }
+    for (int i = 0; i < num_fields_; i++) {
+      PyObject* valueobj = dict_values_[i];
       RETURN_NOT_OK(
           value_converters_[i]->AppendSingleVirtual(valueobj ? valueobj : Py_None));
     }
     return Status::OK();
   }
 
+  // Dicts created by the same code usually have the same key objects (string
+  // literals, or keys memoized by the json module) in the same order. The keys of
+  // such a dict are cached with their fields, so that the values of the following
+  // dicts are found by iterating over them, without hashing or comparing keys.
+  bool MatchCachedKeys(PyObject* obj) {
+    const Py_ssize_t num_keys = PyList_GET_SIZE(cached_key_list_.obj());
+    if (num_keys == 0 || PyDict_Size(obj) != num_keys) {
+      return false;
+    }
+    PyObject* keyobj;
+    PyObject* valueobj;
+    Py_ssize_t pos = 0;
+    for (Py_ssize_t i = 0; PyDict_Next(obj, &pos, &keyobj, &valueobj); ++i) {
+      if (keyobj != PyList_GET_ITEM(cached_key_list_.obj(), i)) {
+        return false;
+      }
+      dict_values_[cached_key_fields_[i]] = valueobj;
+    }
+    return true;
+  }
+
+  // Cache the keys of the dict if they are the names of all fields
+  Status CacheKeys(PyObject* obj, PyObject* field_name_list) {
+    if (PyDict_Size(obj) != num_fields_) {
+      return Status::OK();
+    }
+    std::vector<int> key_fields;
+    PyObject* keyobj;
+    PyObject* valueobj;
+    Py_ssize_t pos = 0;
+    while (PyDict_Next(obj, &pos, &keyobj, &valueobj)) {
+      int field_index = -1;
+      for (int i = 0; i < num_fields_ && field_index < 0; i++) {
+        PyObject* nameobj = PyList_GET_ITEM(field_name_list, i);
+        if (keyobj == nameobj) {
+          field_index = i;
+        } else if (Py_TYPE(keyobj) == Py_TYPE(nameobj)) {
+          const int equal = PyObject_RichCompareBool(keyobj, nameobj, Py_EQ);
+          RETURN_IF_PYERROR();
+          if (equal) {
+            field_index = i;
+          }
+        }
+      }
+      if (field_index < 0) {
+        return Status::OK();
+      }
+      key_fields.push_back(field_index);
+    }
+    OwnedRef keys(PyDict_Keys(obj));
+    RETURN_IF_PYERROR();
+    cached_key_list_.reset(keys.detach());
+    cached_key_fields_ = std::move(key_fields);
+    return Status::OK();
+  }
+
+  // When converting to an inferred type, the type has a field for every key, unless
+  // it was inferred from the first values only: fail then, so that the conversion is
+  // retried with a type inferred from all values
+  Status CheckNoExtraKeys(PyObject* obj, int num_found) {
+    if (!strict_conversions_ && PyDict_Size(obj) > num_found) {
+      return internal::InvalidValue(obj, "has keys which are not struct fields");
+    }
+    return Status::OK();
+  }
+
   Status AppendTupleItem(PyObject* obj) {
     if (PyTuple_GET_SIZE(obj) != num_fields_) {
       return Status::Invalid("Tuple size must be equal to number of struct fields");
@@ -1053,6 +1140,14 @@ class StructConverter
   OwnedRef field_name_unicode_list_;
   OwnedRef field_name_bytes_list_;
   int num_fields_;
+  // The keys of a previous dict, in iteration order, and the indices of their fields
+  OwnedRef cached_key_list_;
+  std::vector<int> cached_key_fields_;
+  // Stop caching keys after that many consecutive dicts didn't match the cache
+  static constexpr int kMaxKeyCacheMisses = 16;
+  int key_cache_misses_ = 0;
+  // The values of the dict being appended, for each field (borrowed)
+  std::vector<PyObject*> dict_values_;
   // Whether we're converting from a sequence of dicts or tuples
   enum class SourceKind { UNKNOWN, DICTS, TUPLES } source_kind_ = SourceKind::UNKNOWN;
   enum class DictKeyKind {
@@ -1283,44 +1378,23 @@ Status ConvertToSequenceAndInferSize(PyObject* obj, PyObject** seq, int64_t* siz
   return Status::OK();
 }
 
-Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
-                         const PyConversionOptions& options,
-                         std::shared_ptr<ChunkedArray>* out) {
-  PyAcquireGIL lock;
-
-  PyObject* seq;
-  OwnedRef tmp_seq_nanny;
-
-  std::shared_ptr<DataType> real_type;
-
-  int64_t size = options.size;
-  RETURN_NOT_OK(ConvertToSequenceAndInferSize(sequence_source, &seq, &size));
-  tmp_seq_nanny.reset(seq);
-
-  // In some cases, type inference may be "loose", like strings. If the user
-  // passed pa.string(), then we will error if we encounter any non-UTF8
-  // value. If not, then we will allow the result to be a BinaryArray
-  bool strict_conversions = false;
-
-  if (options.type == nullptr) {
-    RETURN_NOT_OK(InferArrowType(seq, mask, options.from_pandas, &real_type));
-  } else {
-    real_type = options.type;
-    strict_conversions = true;
-  }
-  DCHECK_GE(size, 0);
+namespace {
 
+Status ConvertPySequenceToType(PyObject* seq, PyObject* mask, int64_t size,
+                               const std::shared_ptr<DataType>& type,
+                               const PyConversionOptions& options,
+                               bool strict_conversions,
+                               std::shared_ptr<ChunkedArray>* out) {
   // Create the sequence converter, initialize with the builder
   std::unique_ptr<SeqConverter> converter;
-  RETURN_NOT_OK(
-      GetConverter(real_type, options.from_pandas, strict_conversions, &converter));
+  RETURN_NOT_OK(GetConverter(type, options.from_pandas, strict_conversions, &converter));
 
   // Create ArrayBuilder for type, then pass into the SeqConverter
   // instance. The reason this is created here rather than in GetConverter is
   // because of nested types (child SeqConverter objects need the child
   // builders created by MakeBuilder)
   std::unique_ptr<ArrayBuilder> type_builder;
-  RETURN_NOT_OK(MakeBuilder(options.pool, real_type, &type_builder));
+  RETURN_NOT_OK(MakeBuilder(options.pool, type, &type_builder));
   RETURN_NOT_OK(converter->Init(type_builder.get()));
 
   // Convert values
@@ -1334,6 +1408,61 @@ Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
   return converter->GetResult(out);
 }
 
+// Infer the type of the first sample_size values of the sequence
+Status InferArrowTypeFromSample(PyObject* seq, PyObject* mask, int64_t sample_size,
+                                bool from_pandas, std::shared_ptr<DataType>* out) {
+  OwnedRef sample(PySequence_GetSlice(seq, 0, static_cast<Py_ssize_t>(sample_size)));
+  RETURN_IF_PYERROR();
+  OwnedRef mask_sample;
+  if (mask != nullptr && mask != Py_None) {
+    mask_sample.reset(PySequence_GetSlice(mask, 0, static_cast<Py_ssize_t>(sample_size)));
+    RETURN_IF_PYERROR();
+  }
+  return InferArrowType(sample.obj(), mask_sample.obj(), from_pandas, out);
+}
+
+}  // namespace
+
+Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
+                         const PyConversionOptions& options,
+                         std::shared_ptr<ChunkedArray>* out) {
+  PyAcquireGIL lock;
+
+  PyObject* seq;
+  OwnedRef tmp_seq_nanny;
+
+  std::shared_ptr<DataType> real_type;
+
+  int64_t size = options.size;
+  RETURN_NOT_OK(ConvertToSequenceAndInferSize(sequence_source, &seq, &size));
+  tmp_seq_nanny.reset(seq);
+  DCHECK_GE(size, 0);
+
+  // In some cases, type inference may be "loose", like strings. If the user
+  // passed pa.string(), then we will error if we encounter any non-UTF8
+  // value. If not, then we will allow the result to be a BinaryArray
+  if (options.type != nullptr) {
+    return ConvertPySequenceToType(seq, mask, size, options.type, options,
+                                   /*strict_conversions=*/true, out);
+  }
+
+  if (options.speculative_inference_size > 0 &&
+      size > options.speculative_inference_size) {
+    RETURN_NOT_OK(InferArrowTypeFromSample(seq, mask, options.speculative_inference_size,
+                                           options.from_pandas, &real_type));
+    if (ConvertPySequenceToType(seq, mask, size, real_type, options,
+                                /*strict_conversions=*/false, out)
+            .ok()) {
+      return Status::OK();
+    }
+    // Some value doesn't fit the type of the sample, convert again with the type of
+    // all values (which also reports the error if that conversion fails too)
+  }
+  RETURN_NOT_OK(InferArrowType(seq, mask, options.from_pandas, &real_type));
+  return ConvertPySequenceToType(seq, mask, size, real_type, options,
+                                 /*strict_conversions=*/false, out);
+}
+
 Status ConvertPySequence(PyObject* obj, const PyConversionOptions& options,
                          std::shared_ptr<ChunkedArray>* out) {
   return ConvertPySequence(obj, nullptr, options, out);
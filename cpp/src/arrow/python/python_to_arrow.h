@@ -40,11 +40,20 @@ class Status;
 namespace py {
 
 struct PyConversionOptions {
-  PyConversionOptions() : type(NULLPTR), size(-1), pool(NULLPTR), from_pandas(false) {}
+  PyConversionOptions()
+      : type(NULLPTR),
+        size(-1),
+        pool(NULLPTR),
+        from_pandas(false),
+        speculative_inference_size(0) {}
 
   PyConversionOptions(const std::shared_ptr<DataType>& type, int64_t size,
                       MemoryPool* pool, bool from_pandas)
-      : type(type), size(size), pool(default_memory_pool()), from_pandas(from_pandas) {}
+      : type(type),
+        size(size),
+        pool(default_memory_pool()),
+        from_pandas(from_pandas),
+        speculative_inference_size(0) {}
 
   // Set to null if to be inferred
   std::shared_ptr<DataType> type;
@@ -57,6 +66,16 @@ struct PyConversionOptions {
 
   // Default false
   bool from_pandas;
+
+  // If positive and the type is to be inferred, infer it from that many values at
+  // the start of the sequence only, so that the sequence is visited once instead of
+  // twice. If a later value can't be converted to that type, the conversion starts
+  // over with the type inferred from all values. Values that Python can convert to
+  // the speculated type (e.g. floats after integers with some Python versions) are
+  // converted rather than widening the type.
+  //
+  // Default 0: infer the type from all values
+  int64_t speculative_inference_size;
 };
 
 /// \brief Convert sequence (list, generator, NumPy array with dtype object) of
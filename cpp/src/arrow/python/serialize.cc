@@ -23,6 +23,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <numpy/arrayobject.h>
@@ -189,6 +190,15 @@ class SequenceBuilder {
     return buffer_indices_->Append(buffer_index);
   }
 
+  // Appending an out-of-band pickle buffer to the sequence
+  //
+  // \param buffer_index Index of the buffer in the object.
+  Status AppendPickleBuffer(const int32_t buffer_index) {
+    RETURN_NOT_OK(CreateAndUpdate(&pickle_buffer_indices_, PythonType::PICKLE_BUFFER,
+                                  [this]() { return new Int32Builder(pool_); }));
+    return pickle_buffer_indices_->Append(buffer_index);
+  }
+
   Status AppendSequence(PyObject* context, PyObject* sequence, int8_t tag,
                         std::shared_ptr<ListBuilder>& target_sequence,
                         std::unique_ptr<SequenceBuilder>& values, int32_t recursion_depth,
@@ -268,6 +278,7 @@ class SequenceBuilder {
   std::shared_ptr<Int32Builder> sparse_csr_matrix_indices_;
   std::shared_ptr<Int32Builder> ndarray_indices_;
   std::shared_ptr<Int32Builder> buffer_indices_;
+  std::shared_ptr<Int32Builder> pickle_buffer_indices_;
 
   std::shared_ptr<DenseUnionBuilder> builder_;
 };
@@ -429,6 +440,35 @@ Status AppendScalar(PyObject* obj, SequenceBuilder* builder) {
   return Status::NotImplemented("Numpy scalar type not recognized");
 }
 
+#if PY_VERSION_HEX >= 0x03080000
+
+// Serialize an out-of-band buffer of pickle protocol 5 as an Arrow buffer viewing
+// its memory, without copying it. If the memory is exported by a pyarrow.Buffer
+// (e.g. a Plasma object), its Arrow buffer is referenced instead.
+Status AppendPickleBuffer(PyObject* elem, SequenceBuilder* builder,
+                          SerializedPyObject* blobs_out) {
+  const Py_buffer* view = PyPickleBuffer_GetBuffer(elem);
+  if (view == nullptr) {
+    return ConvertPyError();
+  }
+  std::shared_ptr<Buffer> buffer;
+  if (view->obj != nullptr && is_buffer(view->obj)) {
+    RETURN_NOT_OK(unwrap_buffer(view->obj, &buffer));
+    if (buffer->data() != view->buf || buffer->size() != view->len) {
+      buffer.reset();
+    }
+  }
+  if (buffer == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(buffer, PyBuffer::FromPyObject(elem));
+  }
+  RETURN_NOT_OK(
+      builder->AppendPickleBuffer(static_cast<int32_t>(blobs_out->buffers.size())));
+  blobs_out->buffers.push_back(std::move(buffer));
+  return Status::OK();
+}
+
+#endif
+
 Status Append(PyObject* context, PyObject* elem, SequenceBuilder* builder,
               int32_t recursion_depth, SerializedPyObject* blobs_out) {
   // The bool case must precede the int case (PyInt_Check passes for bools)
@@ -503,6 +543,10 @@ Status Append(PyObject* context, PyObject* elem, SequenceBuilder* builder,
     std::shared_ptr<SparseCSRMatrix> sparse_csr_matrix;
     RETURN_NOT_OK(unwrap_sparse_csr_matrix(elem, &sparse_csr_matrix));
     blobs_out->sparse_tensors.push_back(sparse_csr_matrix);
+#if PY_VERSION_HEX >= 0x03080000
+  } else if (PyPickleBuffer_Check(elem)) {
+    RETURN_NOT_OK(AppendPickleBuffer(elem, builder, blobs_out));
+#endif
   } else {
     // Attempt to serialize the object using the custom callback.
     PyObject* serialized_object;
@@ -134,6 +134,7 @@ struct PythonType {
     BUFFER,
     SPARSECOOTENSOR,
     SPARSECSRMATRIX,
+    PICKLE_BUFFER,
     NUM_PYTHON_TYPES
   };
 };
@@ -20,12 +20,15 @@
 #include <algorithm>
 #include <atomic>
 #include <cstdlib>
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/validate.h"
+#include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -332,4 +335,140 @@ Status MakeRecordBatchReader(const std::vector<std::shared_ptr<RecordBatch>>& ba
   return Status::OK();
 }
 
+namespace {
+
+// The size of the buffers referenced by an array, which may be more than
+// what it actually uses if it is a slice
+int64_t ReferencedBufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ReferencedBufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += ReferencedBufferSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+class RebatchingRecordBatchReader : public RecordBatchReader {
+ public:
+  RebatchingRecordBatchReader(std::shared_ptr<RecordBatchReader> source,
+                              const RebatchOptions& options)
+      : source_(std::move(source)), options_(options) {}
+
+  std::shared_ptr<Schema> schema() const override { return source_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (!finished_ && !IsFull(pending_rows_, pending_bytes_)) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(source_->ReadNext(&batch));
+      if (batch == nullptr) {
+        finished_ = true;
+      } else if (batch->num_rows() > 0) {
+        Push(std::move(batch));
+      }
+    }
+    if (pending_.empty()) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    return Pop(out);
+  }
+
+ private:
+  // An input batch, or what remains of it
+  struct Piece {
+    std::shared_ptr<RecordBatch> batch;
+    double bytes_per_row;
+  };
+
+  bool IsFull(int64_t num_rows, double num_bytes) const {
+    return num_rows >= options_.max_rows ||
+           (options_.max_bytes > 0 && num_bytes >= options_.max_bytes);
+  }
+
+  void Push(std::shared_ptr<RecordBatch> batch) {
+    int64_t num_bytes = 0;
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      num_bytes += ReferencedBufferSize(*batch->column_data(i));
+    }
+    pending_rows_ += batch->num_rows();
+    pending_bytes_ += num_bytes;
+    const double bytes_per_row = static_cast<double>(num_bytes) / batch->num_rows();
+    pending_.push_back(Piece{std::move(batch), bytes_per_row});
+  }
+
+  // Take the next output batch from the pending pieces
+  Status Pop(std::shared_ptr<RecordBatch>* out) {
+    std::vector<std::shared_ptr<RecordBatch>> parts;
+    int64_t num_rows = 0;
+    double num_bytes = 0;
+    while (!pending_.empty() && !IsFull(num_rows, num_bytes)) {
+      Piece& piece = pending_.front();
+      const int64_t piece_rows = piece.batch->num_rows();
+      int64_t take = std::min(piece_rows, options_.max_rows - num_rows);
+      if (options_.max_bytes > 0 && piece.bytes_per_row > 0) {
+        const auto fitting_rows =
+            static_cast<int64_t>((options_.max_bytes - num_bytes) / piece.bytes_per_row);
+        take = std::min(take, std::max<int64_t>(fitting_rows, num_rows == 0 ? 1 : 0));
+      }
+      if (take == 0) {
+        break;
+      }
+      num_rows += take;
+      num_bytes += take * piece.bytes_per_row;
+      if (take == piece_rows) {
+        parts.push_back(std::move(piece.batch));
+        pending_.pop_front();
+      } else {
+        parts.push_back(piece.batch->Slice(0, take));
+        piece.batch = piece.batch->Slice(take);
+      }
+    }
+    pending_rows_ -= num_rows;
+    pending_bytes_ = pending_.empty() ? 0 : pending_bytes_ - num_bytes;
+
+    if (parts.size() == 1) {
+      *out = std::move(parts[0]);
+      return Status::OK();
+    }
+    const int num_columns = parts[0]->num_columns();
+    std::vector<std::shared_ptr<Array>> columns(num_columns);
+    ArrayVector chunks(parts.size());
+    for (int i = 0; i < num_columns; ++i) {
+      for (size_t j = 0; j < parts.size(); ++j) {
+        chunks[j] = parts[j]->column(i);
+      }
+      RETURN_NOT_OK(Concatenate(chunks, options_.pool, &columns[i]));
+    }
+    *out = RecordBatch::Make(parts[0]->schema(), num_rows, std::move(columns));
+    return Status::OK();
+  }
+
+  std::shared_ptr<RecordBatchReader> source_;
+  const RebatchOptions options_;
+  std::deque<Piece> pending_;
+  int64_t pending_rows_ = 0;
+  double pending_bytes_ = 0;
+  bool finished_ = false;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatchReader>> MakeRebatchingReader(
+    std::shared_ptr<RecordBatchReader> source, const RebatchOptions& options) {
+  if (options.max_rows <= 0) {
+    return Status::Invalid("RebatchOptions::max_rows must be > 0");
+  }
+  if (options.max_bytes < 0) {
+    return Status::Invalid("RebatchOptions::max_bytes must be >= 0");
+  }
+  return std::make_shared<RebatchingRecordBatchReader>(std::move(source), options);
+}
+
 }  // namespace arrow
@@ -219,4 +219,33 @@ ARROW_EXPORT Status MakeRecordBatchReader(
     const std::vector<std::shared_ptr<RecordBatch>>& batches,
     std::shared_ptr<Schema> schema, std::shared_ptr<RecordBatchReader>* out);
 
+/// \brief Options for MakeRebatchingReader()
+struct ARROW_EXPORT RebatchOptions {
+  /// The maximum number of rows of an output batch
+  int64_t max_rows = 64 * 1024;
+  /// The maximum size of an output batch in bytes, estimated from the sizes
+  /// of the input buffers, or 0 for no limit.  A batch always has at least
+  /// one row, whatever its size.
+  int64_t max_bytes = 0;
+  /// The pool for the buffers of merged batches
+  MemoryPool* pool = default_memory_pool();
+
+  static RebatchOptions Defaults() { return RebatchOptions(); }
+};
+
+/// \brief Create a RecordBatchReader yielding batches of a regular size
+///
+/// The record batches read from `source` are merged or split so that all
+/// output batches, except the last one, reach either `max_rows` rows or
+/// `max_bytes` bytes.  Splitting is zero-copy, while merging concatenates
+/// the buffers of consecutive input batches; an input batch fitting the
+/// output boundaries is passed through unchanged.
+///
+/// \param[in] source the RecordBatchReader to read from
+/// \param[in] options the target batch size
+/// \return the rebatching RecordBatchReader
+ARROW_EXPORT Result<std::shared_ptr<RecordBatchReader>> MakeRebatchingReader(
+    std::shared_ptr<RecordBatchReader> source,
+    const RebatchOptions& options = RebatchOptions::Defaults());
+
 }  // namespace arrow
@@ -27,7 +27,9 @@
 #include "arrow/compare.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/sort.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -89,6 +91,42 @@ inline void IncrementIndex(std::vector<int64_t>& coord, const std::vector<int64_
   }
 }
 
+// ----------------------------------------------------------------------
+// ConversionBlocks
+
+// Tensors with fewer elements are converted on the calling thread
+constexpr int64_t kMinParallelConversionSize = 1 << 16;
+
+// Split the rows (or columns) of a tensor into blocks converted in parallel, if the
+// tensor is large enough
+class ConversionBlocks {
+ public:
+  ConversionBlocks(int64_t length, int64_t tensor_size) : length_(length) {
+    const int capacity = GetCpuThreadPoolCapacity();
+    use_threads_ = tensor_size >= kMinParallelConversionSize && capacity > 1;
+    // A few blocks per thread, to balance the sparsity of the blocks
+    num_blocks_ = static_cast<int>(
+        std::min<int64_t>(length, use_threads_ ? 4 * static_cast<int64_t>(capacity) : 1));
+  }
+
+  int num_blocks() const { return num_blocks_; }
+
+  // Call func(block, begin, end) for each block, where [begin, end) are the rows
+  // of the block
+  template <typename Function>
+  Status Run(Function&& func) const {
+    return internal::OptionalParallelFor(use_threads_, num_blocks_, [&](int block) {
+      func(block, length_ * block / num_blocks_, length_ * (block + 1) / num_blocks_);
+      return Status::OK();
+    });
+  }
+
+ private:
+  int64_t length_;
+  int num_blocks_;
+  bool use_threads_;
+};
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCOOIndex
 
@@ -102,6 +140,13 @@ struct SparseTensorConverterBase {
                             MemoryPool* pool)
       : tensor_(tensor), index_value_type_(index_value_type), pool_(pool) {}
 
+  // Value of a matrix, without building a coordinate vector
+  value_type MatrixValue(int64_t i, int64_t j) const {
+    const auto& strides = tensor_.strides();
+    return *reinterpret_cast<const value_type*>(tensor_.raw_data() + i * strides[0] +
+                                                 j * strides[1]);
+  }
+
   const NumericTensorType& tensor_;
   const std::shared_ptr<DataType>& index_value_type_;
   MemoryPool* pool_;
@@ -126,45 +171,42 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
     const int64_t indices_elsize = sizeof(c_index_value_type);
 
     const int64_t ndim = tensor_.ndim();
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
+    const int64_t nrows = ndim == 0 ? 1 : tensor_.shape()[0];
+
+    // Count the non-zero values of each block of rows, then convert each block at
+    // its offset in the results
+    ConversionBlocks blocks(nrows, tensor_.size());
+    std::vector<int64_t> offsets(blocks.num_blocks() + 1, 0);
+    RETURN_NOT_OK(blocks.Run([&](int block, int64_t begin, int64_t end) {
+      int64_t count = 0;
+      VisitNonZero(begin, end, [&](const std::vector<int64_t>&, value_type) { ++count; });
+      offsets[block + 1] = count;
+    }));
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const int64_t nonzero_count = offsets.back();
 
     std::shared_ptr<Buffer> indices_buffer;
     RETURN_NOT_OK(
         AllocateBuffer(pool_, indices_elsize * ndim * nonzero_count, &indices_buffer));
-    c_index_value_type* indices =
+    auto* indices_data =
         reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
 
     std::shared_ptr<Buffer> values_buffer;
     RETURN_NOT_OK(
         AllocateBuffer(pool_, sizeof(value_type) * nonzero_count, &values_buffer));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
-
-    if (ndim <= 1) {
-      const value_type* data = reinterpret_cast<const value_type*>(tensor_.raw_data());
-      const int64_t count = ndim == 0 ? 1 : tensor_.shape()[0];
-      for (int64_t i = 0; i < count; ++i, ++data) {
-        if (*data != 0) {
-          *indices++ = static_cast<c_index_value_type>(i);
-          *values++ = *data;
+    auto* values_data = reinterpret_cast<value_type*>(values_buffer->mutable_data());
+
+    RETURN_NOT_OK(blocks.Run([&](int block, int64_t begin, int64_t end) {
+      value_type* values = values_data + offsets[block];
+      c_index_value_type* indices = indices_data + offsets[block] * ndim;
+      VisitNonZero(begin, end, [&](const std::vector<int64_t>& coord, value_type x) {
+        *values++ = x;
+        // Write indices in row-major order.
+        for (int64_t i = 0; i < ndim; ++i) {
+          *indices++ = static_cast<c_index_value_type>(coord[i]);
         }
-      }
-    } else {
-      const std::vector<int64_t>& shape = tensor_.shape();
-      std::vector<int64_t> coord(ndim, 0);  // The current logical coordinates
-
-      for (int64_t n = tensor_.size(); n > 0; n--) {
-        const value_type x = tensor_.Value(coord);
-        if (tensor_.Value(coord) != 0) {
-          *values++ = x;
-          // Write indices in row-major order.
-          for (int64_t i = 0; i < ndim; ++i) {
-            *indices++ = static_cast<c_index_value_type>(coord[i]);
-          }
-        }
-        IncrementIndex(coord, shape);
-      }
-    }
+      });
+    }));
 
     // make results
     const std::vector<int64_t> indices_shape = {nonzero_count, ndim};
@@ -199,6 +241,31 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
   using BaseClass::index_value_type_;
   using BaseClass::pool_;
   using BaseClass::tensor_;
+
+  // Call visit(coord, value) for the non-zero values of rows [begin, end), in
+  // row-major order
+  template <typename Visitor>
+  void VisitNonZero(int64_t begin, int64_t end, Visitor&& visit) const {
+    const int64_t ndim = tensor_.ndim();
+    std::vector<int64_t> coord(ndim, 0);
+    if (ndim == 0) {
+      const value_type x = tensor_.Value(coord);
+      if (x != 0) {
+        visit(coord, x);
+      }
+      return;
+    }
+    const std::vector<int64_t>& shape = tensor_.shape();
+    const int64_t row_size = shape[0] == 0 ? 0 : tensor_.size() / shape[0];
+    coord[0] = begin;
+    for (int64_t n = (end - begin) * row_size; n > 0; n--) {
+      const value_type x = tensor_.Value(coord);
+      if (x != 0) {
+        visit(coord, x);
+      }
+      IncrementIndex(coord, shape);
+    }
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -229,45 +296,59 @@ class SparseTensorConverter<TYPE, SparseCSRIndex>
       return Status::Invalid("Invalid tensor dimension");
       // LCOV_EXCL_STOP
     }
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
 
     const int64_t nr = tensor_.shape()[0];
     const int64_t nc = tensor_.shape()[1];
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
+
+    // Count the non-zero values of each row, then convert blocks of rows in
+    // parallel at their offsets in the results
+    ConversionBlocks blocks(nr, tensor_.size());
+    std::vector<int64_t> offsets(nr + 1, 0);
+    RETURN_NOT_OK(blocks.Run([&](int, int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; ++i) {
+        int64_t count = 0;
+        for (int64_t j = 0; j < nc; ++j) {
+          count += MatrixValue(i, j) != 0;
+        }
+        offsets[i + 1] = count;
+      }
+    }));
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const int64_t nonzero_count = offsets.back();
 
     std::shared_ptr<Buffer> indptr_buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, indices_elsize * (nr + 1), &indptr_buffer));
+    auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
+    for (int64_t i = 0; i <= nr; ++i) {
+      indptr[i] = static_cast<c_index_value_type>(offsets[i]);
+    }
+
     std::shared_ptr<Buffer> indices_buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, indices_elsize * nonzero_count, &indices_buffer));
+    auto* indices_data =
+        reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
 
     std::shared_ptr<Buffer> values_buffer;
     RETURN_NOT_OK(
         AllocateBuffer(pool_, sizeof(value_type) * nonzero_count, &values_buffer));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      RETURN_NOT_OK(AllocateBuffer(pool_, indices_elsize * (nr + 1), &indptr_buffer));
-      auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
+    auto* values_data = reinterpret_cast<value_type*>(values_buffer->mutable_data());
 
-      RETURN_NOT_OK(
-          AllocateBuffer(pool_, indices_elsize * nonzero_count, &indices_buffer));
-      auto* indices =
-          reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
-
-      c_index_value_type k = 0;
-      *indptr++ = 0;
-      for (int64_t i = 0; i < nr; ++i) {
+    RETURN_NOT_OK(blocks.Run([&](int, int64_t begin, int64_t end) {
+      value_type* values = values_data + offsets[begin];
+      c_index_value_type* indices = indices_data + offsets[begin];
+      for (int64_t i = begin; i < end; ++i) {
         for (int64_t j = 0; j < nc; ++j) {
-          const value_type x = tensor_.Value({i, j});
+          const value_type x = MatrixValue(i, j);
           if (x != 0) {
             *values++ = x;
             *indices++ = static_cast<c_index_value_type>(j);
-            k++;
           }
         }
-        *indptr++ = k;
       }
-    }
+    }));
 
     std::vector<int64_t> indptr_shape({nr + 1});
     std::shared_ptr<Tensor> indptr_tensor =
@@ -304,6 +385,7 @@ class SparseTensorConverter<TYPE, SparseCSRIndex>
 
  private:
   using BaseClass::index_value_type_;
+  using BaseClass::MatrixValue;
   using BaseClass::pool_;
   using BaseClass::tensor_;
 
@@ -350,45 +432,59 @@ class SparseTensorConverter<TYPE, SparseCSCIndex>
       return Status::Invalid("Invalid tensor dimension");
       // LCOV_EXCL_STOP
     }
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
 
     const int64_t nr = tensor_.shape()[0];
     const int64_t nc = tensor_.shape()[1];
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
+
+    // Count the non-zero values of each column, then convert blocks of columns in
+    // parallel at their offsets in the results
+    ConversionBlocks blocks(nc, tensor_.size());
+    std::vector<int64_t> offsets(nc + 1, 0);
+    RETURN_NOT_OK(blocks.Run([&](int, int64_t begin, int64_t end) {
+      for (int64_t j = begin; j < end; ++j) {
+        int64_t count = 0;
+        for (int64_t i = 0; i < nr; ++i) {
+          count += MatrixValue(i, j) != 0;
+        }
+        offsets[j + 1] = count;
+      }
+    }));
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const int64_t nonzero_count = offsets.back();
 
     std::shared_ptr<Buffer> indptr_buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, indices_elsize * (nc + 1), &indptr_buffer));
+    auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
+    for (int64_t j = 0; j <= nc; ++j) {
+      indptr[j] = static_cast<c_index_value_type>(offsets[j]);
+    }
+
     std::shared_ptr<Buffer> indices_buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, indices_elsize * nonzero_count, &indices_buffer));
+    auto* indices_data =
+        reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
 
     std::shared_ptr<Buffer> values_buffer;
     RETURN_NOT_OK(
         AllocateBuffer(pool_, sizeof(value_type) * nonzero_count, &values_buffer));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      RETURN_NOT_OK(AllocateBuffer(pool_, indices_elsize * (nc + 1), &indptr_buffer));
-      auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
+    auto* values_data = reinterpret_cast<value_type*>(values_buffer->mutable_data());
 
-      RETURN_NOT_OK(
-          AllocateBuffer(pool_, indices_elsize * nonzero_count, &indices_buffer));
-      auto* indices =
-          reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
-
-      c_index_value_type k = 0;
-      *indptr++ = 0;
-      for (int64_t j = 0; j < nc; ++j) {
+    RETURN_NOT_OK(blocks.Run([&](int, int64_t begin, int64_t end) {
+      value_type* values = values_data + offsets[begin];
+      c_index_value_type* indices = indices_data + offsets[begin];
+      for (int64_t j = begin; j < end; ++j) {
         for (int64_t i = 0; i < nr; ++i) {
-          const value_type x = tensor_.Value({i, j});
+          const value_type x = MatrixValue(i, j);
           if (x != 0) {
             *values++ = x;
             *indices++ = static_cast<c_index_value_type>(i);
-            k++;
           }
         }
-        *indptr++ = k;
       }
-    }
+    }));
 
     std::vector<int64_t> indptr_shape({nc + 1});
     std::shared_ptr<Tensor> indptr_tensor =
@@ -425,6 +521,7 @@ class SparseTensorConverter<TYPE, SparseCSCIndex>
 
  private:
   using BaseClass::index_value_type_;
+  using BaseClass::MatrixValue;
   using BaseClass::pool_;
   using BaseClass::tensor_;
 
@@ -31,6 +31,7 @@
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/util/sort.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -911,6 +912,67 @@ TEST_F(TestSparseCSCMatrix, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+class TestLargeSparseTensorConversion : public ::testing::Test {
+ public:
+  void SetUp() {
+    // Convert in parallel even on machines with a single core
+    capacity_ = GetCpuThreadPoolCapacity();
+    ASSERT_OK(SetCpuThreadPoolCapacity(4));
+  }
+
+  void TearDown() { ASSERT_OK(SetCpuThreadPoolCapacity(capacity_)); }
+
+  // A tensor with enough elements to be converted in parallel, whose rows have
+  // different numbers of non-zero values
+  void MakeTensor(const std::vector<int64_t>& shape, std::shared_ptr<Tensor>* out) {
+    int64_t size = 1;
+    for (int64_t dim : shape) {
+      size *= dim;
+    }
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(AllocateBuffer(size * sizeof(int64_t), &buffer));
+    auto values = reinterpret_cast<int64_t*>(buffer->mutable_data());
+    for (int64_t i = 0; i < size; ++i) {
+      values[i] = ((i * i) % 11 == 0 || (i / 1000) % 7 == 0) ? i + 1 : 0;
+    }
+    *out = std::make_shared<Tensor>(int64(), buffer, shape);
+  }
+
+  template <typename SparseTensorType>
+  void CheckRoundTrip(const std::vector<int64_t>& shape) {
+    std::shared_ptr<Tensor> tensor;
+    ASSERT_NO_FATAL_FAILURE(MakeTensor(shape, &tensor));
+    int64_t nonzero_count = 0;
+    ASSERT_OK(tensor->CountNonZero(&nonzero_count));
+
+    std::shared_ptr<SparseTensorType> sparse_tensor;
+    ASSERT_OK_AND_ASSIGN(sparse_tensor, SparseTensorType::Make(*tensor, int32()));
+    ASSERT_EQ(nonzero_count, sparse_tensor->non_zero_length());
+
+    std::shared_ptr<Tensor> dense_tensor;
+    ASSERT_OK(sparse_tensor->ToTensor(&dense_tensor));
+    ASSERT_TRUE(tensor->Equals(*dense_tensor));
+  }
+
+ protected:
+  int capacity_;
+};
+
+TEST_F(TestLargeSparseTensorConversion, COO) {
+  CheckRoundTrip<SparseCOOTensor>({64, 48, 32});
+  CheckRoundTrip<SparseCOOTensor>({100000});
+}
+
+TEST_F(TestLargeSparseTensorConversion, CSR) {
+  CheckRoundTrip<SparseCSRMatrix>({500, 300});
+  CheckRoundTrip<SparseCSRMatrix>({3, 30000});
+}
+
+TEST_F(TestLargeSparseTensorConversion, CSC) {
+  CheckRoundTrip<SparseCSCMatrix>({500, 300});
+  CheckRoundTrip<SparseCSCMatrix>({30000, 3});
+}
+
 template <typename IndexValueType>
 class TestSparseCSFTensorBase : public ::testing::Test {
  public:
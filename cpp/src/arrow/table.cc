@@ -32,6 +32,8 @@
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -686,18 +688,29 @@ bool Table::Equals(const Table& other, bool check_metadata) const {
 }
 
 Status Table::CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const {
+  return CombineChunks(pool, /*use_threads=*/false, out);
+}
+
+Status Table::CombineChunks(MemoryPool* pool, bool use_threads,
+                            std::shared_ptr<Table>* out) const {
   const int ncolumns = num_columns();
+  // Either combine the columns in parallel, or copy the buffers of each column
+  // in parallel, but not both: pool tasks mustn't wait for other pool tasks
+  const bool parallel_columns =
+      use_threads && ncolumns >= internal::GetCpuThreadPool()->GetCapacity();
+  const bool parallel_copies = use_threads && !parallel_columns;
   std::vector<std::shared_ptr<ChunkedArray>> compacted_columns(ncolumns);
-  for (int i = 0; i < ncolumns; ++i) {
+  RETURN_NOT_OK(internal::OptionalParallelFor(parallel_columns, ncolumns, [&](int i) {
     auto col = column(i);
     if (col->num_chunks() <= 1) {
       compacted_columns[i] = col;
     } else {
       std::shared_ptr<Array> compacted;
-      RETURN_NOT_OK(Concatenate(col->chunks(), pool, &compacted));
+      RETURN_NOT_OK(Concatenate(col->chunks(), pool, parallel_copies, &compacted));
       compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
     }
-  }
+    return Status::OK();
+  }));
   *out = Table::Make(schema(), compacted_columns);
   return Status::OK();
 }
@@ -295,6 +295,18 @@ class ARROW_EXPORT Table {
   /// \param[out] out The table with chunks combined
   Status CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const;
 
+  /// \brief Make a new table by combining the chunks this table has.
+  ///
+  /// If use_threads is true, the columns are combined in parallel on the
+  /// global CPU thread pool, or, when there are fewer columns than threads,
+  /// the buffers of each column are copied in parallel.
+  ///
+  /// \param[in] pool The pool for buffer allocations
+  /// \param[in] use_threads Whether to use the global CPU thread pool
+  /// \param[out] out The table with chunks combined
+  Status CombineChunks(MemoryPool* pool, bool use_threads,
+                       std::shared_ptr<Table>* out) const;
+
  protected:
   Table();
 
@@ -406,6 +406,24 @@ TEST_F(TestTable, CombineChunks) {
   }
 }
 
+TEST_F(TestTable, CombineChunksUseThreads) {
+  MakeExample1(1 << 18);
+  auto batch = RecordBatch::Make(schema_, 1 << 18, arrays_);
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch, batch->Slice(5), batch}, &table));
+
+  std::shared_ptr<Table> compacted;
+  ASSERT_OK(table->CombineChunks(default_memory_pool(), /*use_threads=*/true,
+                                 &compacted));
+
+  ASSERT_OK(compacted->ValidateFull());
+  EXPECT_TRUE(compacted->Equals(*table));
+  for (int i = 0; i < compacted->num_columns(); ++i) {
+    EXPECT_EQ(1, compacted->column(i)->num_chunks());
+  }
+}
+
 TEST_F(TestTable, ConcatenateTables) {
   const int64_t length = 10;
 
@@ -1051,4 +1069,137 @@ TEST_F(TestTableBatchReader, Chunksize) {
   ASSERT_EQ(nullptr, batch);
 }
 
+class TestRebatchingReader : public TestBase {
+ protected:
+  std::shared_ptr<RecordBatch> MakeBatch(int64_t length) {
+    return RecordBatch::Make(schema_, length,
+                             {MakeRandomArray<Int32Array>(length),
+                              MakeRandomArray<DoubleArray>(length, length / 4)});
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> Rebatch(
+      const std::vector<std::shared_ptr<RecordBatch>>& batches,
+      const RebatchOptions& options) {
+    std::shared_ptr<RecordBatchReader> source, reader;
+    ARROW_EXPECT_OK(MakeRecordBatchReader(batches, schema_, &source));
+    EXPECT_OK_AND_ASSIGN(reader, MakeRebatchingReader(source, options));
+    std::vector<std::shared_ptr<RecordBatch>> out;
+    ARROW_EXPECT_OK(reader->ReadAll(&out));
+    return out;
+  }
+
+  void AssertSameRows(const std::vector<std::shared_ptr<RecordBatch>>& expected,
+                      const std::vector<std::shared_ptr<RecordBatch>>& actual) {
+    std::shared_ptr<Table> expected_table, actual_table;
+    ASSERT_OK(Table::FromRecordBatches(schema_, expected, &expected_table));
+    ASSERT_OK(Table::FromRecordBatches(schema_, actual, &actual_table));
+    ASSERT_OK(expected_table->CombineChunks(pool_, &expected_table));
+    ASSERT_OK(actual_table->CombineChunks(pool_, &actual_table));
+    ASSERT_TRUE(actual_table->Equals(*expected_table));
+  }
+
+  std::vector<int64_t> Lengths(const std::vector<std::shared_ptr<RecordBatch>>& batches) {
+    std::vector<int64_t> lengths;
+    for (const auto& batch : batches) {
+      ARROW_EXPECT_OK(batch->ValidateFull());
+      lengths.push_back(batch->num_rows());
+    }
+    return lengths;
+  }
+
+  std::shared_ptr<Schema> schema_ =
+      arrow::schema({field("f1", int32()), field("f2", float64())});
+};
+
+TEST_F(TestRebatchingReader, Merge) {
+  std::vector<std::shared_ptr<RecordBatch>> batches = {
+      MakeBatch(10), MakeBatch(0), MakeBatch(10), MakeBatch(10), MakeBatch(5)};
+  RebatchOptions options;
+  options.max_rows = 25;
+  auto out = Rebatch(batches, options);
+  ASSERT_EQ(Lengths(out), std::vector<int64_t>({25, 10}));
+  AssertSameRows(batches, out);
+}
+
+TEST_F(TestRebatchingReader, Split) {
+  std::vector<std::shared_ptr<RecordBatch>> batches = {MakeBatch(100)};
+  RebatchOptions options;
+  options.max_rows = 30;
+  auto out = Rebatch(batches, options);
+  ASSERT_EQ(Lengths(out), std::vector<int64_t>({30, 30, 30, 10}));
+  AssertSameRows(batches, out);
+  // Zero-copy
+  for (const auto& batch : out) {
+    ASSERT_EQ(batches[0]->column_data(0)->buffers[1], batch->column_data(0)->buffers[1]);
+  }
+}
+
+TEST_F(TestRebatchingReader, MergeAndSplit) {
+  std::vector<std::shared_ptr<RecordBatch>> batches = {MakeBatch(7), MakeBatch(50),
+                                                       MakeBatch(3), MakeBatch(16)};
+  RebatchOptions options;
+  options.max_rows = 20;
+  auto out = Rebatch(batches, options);
+  ASSERT_EQ(Lengths(out), std::vector<int64_t>({20, 20, 20, 16}));
+  AssertSameRows(batches, out);
+}
+
+TEST_F(TestRebatchingReader, PassThrough) {
+  std::vector<std::shared_ptr<RecordBatch>> batches = {MakeBatch(20), MakeBatch(20),
+                                                       MakeBatch(5)};
+  RebatchOptions options;
+  options.max_rows = 20;
+  auto out = Rebatch(batches, options);
+  ASSERT_EQ(out.size(), 3);
+  for (size_t i = 0; i < out.size(); ++i) {
+    ASSERT_EQ(batches[i], out[i]);
+  }
+}
+
+TEST_F(TestRebatchingReader, MaxBytes) {
+  // 4 bytes per row, without a null bitmap
+  auto make_batch = [&](int64_t length) {
+    std::shared_ptr<Buffer> data;
+    ARROW_EXPECT_OK(AllocateBuffer(pool_, length * 4, &data));
+    return RecordBatch::Make(arrow::schema({field("f1", int32())}), length,
+                             {std::make_shared<Int32Array>(length, data)});
+  };
+  std::vector<std::shared_ptr<RecordBatch>> batches = {make_batch(10), make_batch(30),
+                                                       make_batch(5)};
+  std::shared_ptr<RecordBatchReader> source;
+  ASSERT_OK(MakeRecordBatchReader(batches, nullptr, &source));
+  RebatchOptions options;
+  options.max_bytes = 100;
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeRebatchingReader(source, options));
+  std::vector<std::shared_ptr<RecordBatch>> out;
+  ASSERT_OK(reader->ReadAll(&out));
+  ASSERT_EQ(Lengths(out), std::vector<int64_t>({25, 20}));
+
+  // A batch always has at least one row
+  ASSERT_OK(MakeRecordBatchReader(batches, nullptr, &source));
+  options.max_bytes = 1;
+  ASSERT_OK_AND_ASSIGN(reader, MakeRebatchingReader(source, options));
+  out.clear();
+  ASSERT_OK(reader->ReadAll(&out));
+  ASSERT_EQ(out.size(), 45);
+}
+
+TEST_F(TestRebatchingReader, Empty) {
+  auto out = Rebatch({}, RebatchOptions::Defaults());
+  ASSERT_EQ(out.size(), 0);
+  out = Rebatch({MakeBatch(0)}, RebatchOptions::Defaults());
+  ASSERT_EQ(out.size(), 0);
+}
+
+TEST_F(TestRebatchingReader, InvalidOptions) {
+  std::shared_ptr<RecordBatchReader> source;
+  ASSERT_OK(MakeRecordBatchReader({}, schema_, &source));
+  RebatchOptions options;
+  options.max_rows = 0;
+  ASSERT_RAISES(Invalid, MakeRebatchingReader(source, options));
+  options = RebatchOptions::Defaults();
+  options.max_bytes = -1;
+  ASSERT_RAISES(Invalid, MakeRebatchingReader(source, options));
+}
+
 }  // namespace arrow
@@ -20,18 +20,26 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -274,4 +282,268 @@ Status Tensor::CountNonZero(int64_t* result) const {
   return VisitTypeInline(*type(), &counter);
 }
 
+// ----------------------------------------------------------------------
+// Conversion of record batches and tables to tensors
+
+namespace {
+
+// A row-major tensor is written in tiles of rows of about this many bytes, so
+// that the strided writes of all the columns to a tile stay in cache
+constexpr int64_t kTileBytes = 64 * 1024;
+constexpr int64_t kMinTileRows = 16;
+
+// The number of values written by each parallel task
+constexpr int64_t kTaskValues = 1 << 20;
+
+// Write `length` values of `data` from `offset` to `out`, every `stride` values
+using SegmentWriter = void (*)(const ArrayData& data, int64_t offset, int64_t length,
+                               bool null_to_nan, uint8_t* out, int64_t stride);
+
+template <typename OutType>
+struct NaNValue {
+  static typename OutType::c_type Get() {
+    return std::numeric_limits<typename OutType::c_type>::quiet_NaN();
+  }
+};
+
+template <>
+struct NaNValue<HalfFloatType> {
+  static uint16_t Get() { return 0x7e00; }
+};
+
+template <typename OutType, typename InType>
+void WriteSegment(const ArrayData& data, int64_t offset, int64_t length,
+                  bool null_to_nan, uint8_t* out, int64_t stride) {
+  using out_type = typename OutType::c_type;
+  using in_type = typename InType::c_type;
+  const in_type* in_values = data.GetValues<in_type>(1) + offset;
+  out_type* out_values = reinterpret_cast<out_type*>(out);
+
+  if (std::is_same<out_type, in_type>::value && stride == 1) {
+    std::memcpy(out_values, in_values, length * sizeof(out_type));
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      out_values[i * stride] = static_cast<out_type>(in_values[i]);
+    }
+  }
+
+  if (null_to_nan && data.GetNullCount() > 0) {
+    internal::BitmapReader valid_reader(data.buffers[0]->data(), data.offset + offset,
+                                        length);
+    for (int64_t i = 0; i < length; ++i, valid_reader.Next()) {
+      if (valid_reader.IsNotSet()) {
+        out_values[i * stride] = NaNValue<OutType>::Get();
+      }
+    }
+  }
+}
+
+template <typename OutType>
+struct SegmentWriterForInput {
+  template <typename InType>
+  enable_if_number<InType, Status> Visit(const InType&) {
+    *out = WriteSegment<OutType, InType>;
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Tensor of ", type.ToString(), " is not implemented");
+  }
+
+  SegmentWriter* out;
+};
+
+struct SegmentWriterForOutput {
+  template <typename OutType>
+  enable_if_number<OutType, Status> Visit(const OutType&) {
+    SegmentWriterForInput<OutType> visitor{out};
+    return VisitTypeInline(in_type, &visitor);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Tensor of ", type.ToString(), " is not implemented");
+  }
+
+  const DataType& in_type;
+  SegmentWriter* out;
+};
+
+std::shared_ptr<DataType> IntegerTypeOfWidth(int bit_width, bool is_signed) {
+  switch (bit_width) {
+    case 8:
+      return is_signed ? int8() : uint8();
+    case 16:
+      return is_signed ? int16() : uint16();
+    case 32:
+      return is_signed ? int32() : uint32();
+    default:
+      return is_signed ? int64() : uint64();
+  }
+}
+
+// Promote the column types to the tensor type, as NumPy does
+Status GetTensorType(const Schema& schema, bool null_to_nan,
+                     std::shared_ptr<DataType>* out) {
+  if (schema.num_fields() == 0) {
+    return Status::Invalid("Cannot convert a table without columns to a Tensor");
+  }
+
+  bool has_half_float = false;
+  bool all_same_type = true;
+  int max_signed_width = 0;
+  int max_unsigned_width = 0;
+  int max_float_width = 0;
+  for (const auto& field : schema.fields()) {
+    const DataType& type = *field->type();
+    if (!is_tensor_supported(type.id())) {
+      return Status::TypeError("Cannot convert column '", field->name(), "' of type ",
+                               type.ToString(), " to a Tensor");
+    }
+    all_same_type &= type.id() == schema.field(0)->type()->id();
+    const int bit_width = checked_cast<const FixedWidthType&>(type).bit_width();
+    if (type.id() == Type::HALF_FLOAT) {
+      has_half_float = true;
+    } else if (is_floating(type.id())) {
+      max_float_width = std::max(max_float_width, bit_width);
+    } else if (checked_cast<const IntegerType&>(type).is_signed()) {
+      max_signed_width = std::max(max_signed_width, bit_width);
+    } else {
+      max_unsigned_width = std::max(max_unsigned_width, bit_width);
+    }
+  }
+
+  if (has_half_float) {
+    if (!all_same_type) {
+      return Status::NotImplemented(
+          "Cannot convert half-float columns mixed with other types to a Tensor");
+    }
+    *out = float16();
+    return Status::OK();
+  }
+
+  // The width of an integer type holding all the integer values: a signed type
+  // must be twice as wide as the unsigned types to hold their values
+  int integer_width = std::max(max_signed_width, max_unsigned_width);
+  if (max_signed_width > 0 && max_unsigned_width > 0) {
+    integer_width = std::max(max_signed_width, 2 * max_unsigned_width);
+  }
+
+  if (max_float_width > 0 || null_to_nan || integer_width > 64) {
+    // float32 holds the values of integers up to 16 bits exactly
+    if (max_float_width == 32 && integer_width <= 16) {
+      *out = float32();
+    } else {
+      *out = float64();
+    }
+  } else {
+    *out = IntegerTypeOfWidth(integer_width, max_signed_width > 0);
+  }
+  return Status::OK();
+}
+
+Status ColumnsToTensor(const Schema& schema, int64_t num_rows,
+                       const std::vector<ArrayVector>& columns,
+                       const TableToTensorOptions& options,
+                       std::shared_ptr<Tensor>* out) {
+  std::shared_ptr<DataType> type;
+  RETURN_NOT_OK(GetTensorType(schema, options.null_to_nan, &type));
+  const int num_columns = static_cast<int>(columns.size());
+  const int64_t byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+
+  // The writer of each column, and the rows at which its chunks start
+  std::vector<SegmentWriter> writers(num_columns);
+  std::vector<std::vector<int64_t>> chunk_starts(num_columns);
+  for (int i = 0; i < num_columns; ++i) {
+    int64_t chunk_start = 0;
+    for (const auto& chunk : columns[i]) {
+      if (!options.null_to_nan && chunk->null_count() > 0) {
+        return Status::Invalid("Cannot convert column '", schema.field(i)->name(),
+                               "' with nulls to a Tensor, unless nulls are "
+                               "converted to NaN");
+      }
+      chunk_starts[i].push_back(chunk_start);
+      chunk_start += chunk->length();
+    }
+    SegmentWriterForOutput visitor{*schema.field(i)->type(), &writers[i]};
+    RETURN_NOT_OK(VisitTypeInline(*type, &visitor));
+  }
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(options.pool, num_rows * num_columns * byte_width, &data));
+  uint8_t* out_data = data->mutable_data();
+
+  // The distances between consecutive rows and columns, in values
+  const int64_t row_stride = options.row_major ? num_columns : 1;
+  const int64_t column_stride = options.row_major ? 1 : num_rows;
+
+  // Write the rows [begin, end) of all the columns
+  auto WriteRows = [&](int64_t begin, int64_t end) {
+    for (int i = 0; i < num_columns; ++i) {
+      const auto& starts = chunk_starts[i];
+      auto chunk_index = static_cast<size_t>(
+          std::upper_bound(starts.begin(), starts.end(), begin) - starts.begin() - 1);
+      for (int64_t row = begin; row < end && chunk_index < starts.size();
+           ++chunk_index) {
+        const ArrayData& chunk = *columns[i][chunk_index]->data();
+        const int64_t length = std::min(end, starts[chunk_index] + chunk.length) - row;
+        if (length > 0) {
+          writers[i](chunk, row - starts[chunk_index], length, options.null_to_nan,
+                     out_data + (row * row_stride + i * column_stride) * byte_width,
+                     row_stride);
+          row += length;
+        }
+      }
+    }
+  };
+
+  // Tiling a column-major tensor doesn't help, as each column is contiguous
+  int64_t tile_rows = std::max<int64_t>(num_rows, 1);
+  if (options.row_major) {
+    tile_rows = std::max(kMinTileRows, kTileBytes / (num_columns * byte_width));
+  }
+  int64_t task_rows = std::max(tile_rows, kTaskValues / num_columns);
+  task_rows = BitUtil::CeilDiv(task_rows, tile_rows) * tile_rows;
+  const int num_tasks = static_cast<int>(BitUtil::CeilDiv(num_rows, task_rows));
+
+  auto WriteTask = [&](int task) {
+    const int64_t task_begin = task * task_rows;
+    const int64_t task_end = std::min(num_rows, task_begin + task_rows);
+    for (int64_t begin = task_begin; begin < task_end; begin += tile_rows) {
+      WriteRows(begin, std::min(task_end, begin + tile_rows));
+    }
+    return Status::OK();
+  };
+  RETURN_NOT_OK(internal::OptionalParallelFor(options.use_threads, num_tasks, WriteTask));
+
+  std::vector<int64_t> shape = {num_rows, num_columns};
+  std::vector<int64_t> strides;
+  if (options.row_major) {
+    ComputeRowMajorStrides(checked_cast<const FixedWidthType&>(*type), shape, &strides);
+  } else {
+    ComputeColumnMajorStrides(checked_cast<const FixedWidthType&>(*type), shape,
+                              &strides);
+  }
+  return Tensor::Make(type, data, shape, strides).Value(out);
+}
+
+}  // namespace
+
+Status RecordBatchToTensor(const RecordBatch& batch, const TableToTensorOptions& options,
+                           std::shared_ptr<Tensor>* out) {
+  std::vector<ArrayVector> columns;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns.push_back({batch.column(i)});
+  }
+  return ColumnsToTensor(*batch.schema(), batch.num_rows(), columns, options, out);
+}
+
+Status TableToTensor(const Table& table, const TableToTensorOptions& options,
+                     std::shared_ptr<Tensor>* out) {
+  std::vector<ArrayVector> columns;
+  for (int i = 0; i < table.num_columns(); ++i) {
+    columns.push_back(table.column(i)->chunks());
+  }
+  return ColumnsToTensor(*table.schema(), table.num_rows(), columns, options, out);
+}
+
 }  // namespace arrow
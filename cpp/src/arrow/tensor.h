@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/compare.h"
+#include "arrow/memory_pool.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
@@ -227,6 +228,46 @@ class NumericTensor : public Tensor {
   }
 };
 
+/// \brief Options for converting a RecordBatch or Table to a Tensor
+struct ARROW_EXPORT TableToTensorOptions {
+  /// Whether the tensor is row-major (one row per record) or column-major
+  /// (one column of the tensor after the other)
+  bool row_major = true;
+
+  /// Whether nulls are converted to NaN.  If true, integer columns are
+  /// converted to float64, unless mixed with float32 columns as below.  If
+  /// false, converting columns with nulls is an error.
+  bool null_to_nan = false;
+
+  /// Whether the columns are written in parallel
+  bool use_threads = true;
+
+  /// The pool the tensor data is allocated from
+  MemoryPool* pool = default_memory_pool();
+
+  static TableToTensorOptions Defaults() { return TableToTensorOptions(); }
+};
+
+/// \brief Convert the numeric columns of a record batch to a 2-dimensional
+/// Tensor of shape (num_rows, num_columns)
+///
+/// The values are copied into a single preallocated buffer.  Columns of
+/// different types are promoted to a common type as NumPy does: integers of
+/// mixed signedness to a wider signed integer (or float64 for uint64), and
+/// integers mixed with floats to float64, or to float32 if all the integers
+/// are at most 16 bits wide.  Half-float columns cannot be mixed with other
+/// types.
+ARROW_EXPORT
+Status RecordBatchToTensor(const RecordBatch& batch, const TableToTensorOptions& options,
+                           std::shared_ptr<Tensor>* out);
+
+/// \brief Convert the numeric columns of a table to a 2-dimensional Tensor
+///
+/// See RecordBatchToTensor.  The columns may be chunked differently.
+ARROW_EXPORT
+Status TableToTensor(const Table& table, const TableToTensorOptions& options,
+                     std::shared_ptr<Tensor>* out);
+
 }  // namespace arrow
 
 #endif  // ARROW_TENSOR_H
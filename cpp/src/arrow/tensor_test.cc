@@ -26,6 +26,8 @@
 #include <gtest/gtest.h>
 
 #include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -611,4 +613,136 @@ TEST(TestNumericTensor, ElementAccessWithNonContiguousStrides) {
   ASSERT_EQ(11.1f, t_f32.Value({2, 2}));
 }
 
+class TestTableToTensor : public ::testing::Test {
+ protected:
+  template <typename T>
+  void AssertTensor(const Tensor& tensor, const std::shared_ptr<DataType>& type,
+                    const std::vector<int64_t>& shape, const std::vector<T>& row_major,
+                    bool row_major_layout = true) {
+    ASSERT_TRUE(tensor.type()->Equals(type)) << tensor.type()->ToString();
+    ASSERT_EQ(tensor.shape(), shape);
+    ASSERT_TRUE(row_major_layout ? tensor.is_row_major() : tensor.is_column_major());
+    ASSERT_OK_AND_ASSIGN(auto expected,
+                         Tensor::Make(type, Buffer::Wrap(row_major), shape));
+    ASSERT_TRUE(tensor.Equals(*expected));
+  }
+
+  std::shared_ptr<Tensor> BatchToTensor(const std::shared_ptr<RecordBatch>& batch) {
+    std::shared_ptr<Tensor> tensor;
+    ABORT_NOT_OK(RecordBatchToTensor(*batch, options_, &tensor));
+    return tensor;
+  }
+
+  TableToTensorOptions options_;
+};
+
+TEST_F(TestTableToTensor, SameType) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", int32())}),
+                                   R"([{"a": 1, "b": 4}, {"a": 2, "b": 5},
+                                       {"a": 3, "b": 6}])");
+  auto tensor = BatchToTensor(batch);
+  AssertTensor<int32_t>(*tensor, int32(), {3, 2}, {1, 4, 2, 5, 3, 6});
+
+  options_.row_major = false;
+  tensor = BatchToTensor(batch);
+  AssertTensor<int32_t>(*tensor, int32(), {3, 2}, {1, 4, 2, 5, 3, 6},
+                        /*row_major_layout=*/false);
+  ASSERT_EQ(tensor->strides(), std::vector<int64_t>({4, 12}));
+}
+
+TEST_F(TestTableToTensor, TypePromotion) {
+  auto check = [&](const std::shared_ptr<DataType>& a, const std::shared_ptr<DataType>& b,
+                   const std::shared_ptr<DataType>& expected) {
+    auto batch = RecordBatchFromJSON(schema({field("a", a), field("b", b)}),
+                                     R"([{"a": 1, "b": 2}, {"a": 3, "b": 4}])");
+    auto tensor = BatchToTensor(batch);
+    ASSERT_TRUE(tensor->type()->Equals(expected))
+        << a->ToString() << " and " << b->ToString() << " gave "
+        << tensor->type()->ToString();
+  };
+  check(int8(), int16(), int16());
+  check(uint8(), uint32(), uint32());
+  check(int8(), uint8(), int16());
+  check(int64(), uint32(), int64());
+  check(int8(), uint64(), float64());
+  check(int16(), float32(), float32());
+  check(int32(), float32(), float64());
+  check(float32(), float64(), float64());
+
+  auto batch = RecordBatchFromJSON(schema({field("a", int8()), field("b", float32())}),
+                                   R"([{"a": -1, "b": 0.5}, {"a": 3, "b": 4}])");
+  AssertTensor<float>(*BatchToTensor(batch), float32(), {2, 2}, {-1, 0.5, 3, 4});
+}
+
+TEST_F(TestTableToTensor, Nulls) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", float32())}),
+                                   R"([{"a": 1, "b": null}, {"a": null, "b": 4}])");
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_RAISES(Invalid, RecordBatchToTensor(*batch, options_, &tensor));
+
+  options_.null_to_nan = true;
+  for (bool row_major : {true, false}) {
+    options_.row_major = row_major;
+    tensor = BatchToTensor(batch);
+    ASSERT_TRUE(tensor->type()->Equals(float64()));
+    ASSERT_EQ(tensor->Value<DoubleType>({0, 0}), 1);
+    ASSERT_TRUE(std::isnan(tensor->Value<DoubleType>({0, 1})));
+    ASSERT_TRUE(std::isnan(tensor->Value<DoubleType>({1, 0})));
+    ASSERT_EQ(tensor->Value<DoubleType>({1, 1}), 4);
+  }
+
+  // Integers are converted to floats even without nulls
+  batch = RecordBatchFromJSON(schema({field("a", int8())}), R"([{"a": 1}])");
+  AssertTensor<double>(*BatchToTensor(batch), float64(), {1, 1}, {1});
+}
+
+TEST_F(TestTableToTensor, ChunkedColumns) {
+  // Enough rows for several tiles and parallel tasks, chunked differently
+  const int64_t length = 300000;
+  std::vector<int64_t> a(length);
+  std::vector<double> b(length);
+  for (int64_t i = 0; i < length; ++i) {
+    a[i] = i;
+    b[i] = -0.5 * static_cast<double>(i);
+  }
+  std::shared_ptr<ChunkedArray> column_a, column_b;
+  ChunkedArrayFromVector<Int64Type, int64_t>(
+      {std::vector<int64_t>(a.begin(), a.begin() + 1000), {},
+       std::vector<int64_t>(a.begin() + 1000, a.end())},
+      &column_a);
+  ChunkedArrayFromVector<DoubleType, double>(
+      {std::vector<double>(b.begin(), b.begin() + 123456),
+       std::vector<double>(b.begin() + 123456, b.end())},
+      &column_b);
+  auto table = Table::Make(schema({field("a", int64()), field("b", float64())}),
+                           {column_a, column_b});
+
+  std::vector<double> row_major;
+  for (int64_t i = 0; i < length; ++i) {
+    row_major.push_back(static_cast<double>(a[i]));
+    row_major.push_back(b[i]);
+  }
+  for (bool use_threads : {false, true}) {
+    for (bool row_major_layout : {true, false}) {
+      options_.use_threads = use_threads;
+      options_.row_major = row_major_layout;
+      std::shared_ptr<Tensor> tensor;
+      ASSERT_OK(TableToTensor(*table, options_, &tensor));
+      AssertTensor<double>(*tensor, float64(), {length, 2}, row_major,
+                           row_major_layout);
+    }
+  }
+}
+
+TEST_F(TestTableToTensor, Errors) {
+  std::shared_ptr<Tensor> tensor;
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", utf8())}),
+                                   R"([{"a": 1, "b": "x"}])");
+  ASSERT_RAISES(TypeError, RecordBatchToTensor(*batch, options_, &tensor));
+
+  batch = RecordBatch::Make(schema(std::vector<std::shared_ptr<Field>>{}), 0,
+                            ArrayVector{});
+  ASSERT_RAISES(Invalid, RecordBatchToTensor(*batch, options_, &tensor));
+}
+
 }  // namespace arrow
@@ -1517,6 +1517,42 @@ TEST(TestDictionaryType, UnifyLarge) {
   ASSERT_TRUE(out_dict->Equals(*expected_dict));
 }
 
+TEST(TestDictionaryType, UnifySharedDictionaries) {
+  // Dictionaries which are shared by several chunks, or which extend the
+  // dictionary of a previous chunk
+  auto dict_ty = utf8();
+  auto d1 = ArrayFromJSON(dict_ty, R"(["a", "b"])");
+  auto d2 = ArrayFromJSON(dict_ty, R"(["a", "b", "c"])");
+  auto d3 = ArrayFromJSON(dict_ty, R"(["a", "c"])");
+  auto d4 = ArrayFromJSON(dict_ty, R"(["a", "b", "c", "d"])");
+  auto d5 = ArrayFromJSON(dict_ty, R"(["b", "a", "e"])");
+
+  std::unique_ptr<DictionaryUnifier> unifier;
+  ASSERT_OK(DictionaryUnifier::Make(default_memory_pool(), dict_ty, &unifier));
+  std::shared_ptr<Buffer> b1, b1_again, b2, b3, b4, b5, b4_slice;
+  ASSERT_OK(unifier->Unify(*d1, &b1));
+  ASSERT_OK(unifier->Unify(*d1, &b1_again));
+  ASSERT_OK(unifier->Unify(*d2, &b2));
+  ASSERT_OK(unifier->Unify(*d3, &b3));
+  ASSERT_OK(unifier->Unify(*d4, &b4));
+  ASSERT_OK(unifier->Unify(*d5, &b5));
+  ASSERT_OK(unifier->Unify(*d4->Slice(1), &b4_slice));
+
+  std::shared_ptr<DataType> out_type;
+  std::shared_ptr<Array> out_dict;
+  ASSERT_OK(unifier->GetResult(&out_type, &out_dict));
+  ASSERT_TRUE(out_type->Equals(*dictionary(int8(), dict_ty)));
+  ASSERT_TRUE(out_dict->Equals(*ArrayFromJSON(dict_ty, R"(["a", "b", "c", "d", "e"])")));
+
+  CheckTransposeMap(*b1, {0, 1});
+  CheckTransposeMap(*b1_again, {0, 1});
+  CheckTransposeMap(*b2, {0, 1, 2});
+  CheckTransposeMap(*b3, {0, 2});
+  CheckTransposeMap(*b4, {0, 1, 2, 3});
+  CheckTransposeMap(*b5, {1, 0, 4});
+  CheckTransposeMap(*b4_slice, {1, 2, 3});
+}
+
 TEST(TypesTest, TestDecimal128Small) {
   Decimal128Type t1(8, 4);
 
@@ -79,11 +79,8 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   int64_t count = 0;
 
   const auto p = BitmapWordAlign<pop_len / 8>(data, bit_offset, length);
-  for (int64_t i = bit_offset; i < bit_offset + p.leading_bits; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
-  }
+  count += BitUtil::PopCount(
+      BitmapWordReader(data, bit_offset, p.leading_bits).TrailingBits());
 
   if (p.aligned_words > 0) {
     // popcount as much as possible with the widest possible count
@@ -96,13 +93,9 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
     }
   }
 
-  // Account for left over bits (in theory we could fall back to smaller
-  // versions of popcount but the code complexity is likely not worth it)
-  for (int64_t i = p.trailing_bit_offset; i < bit_offset + length; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
-  }
+  // Account for left over bits (fewer than 64)
+  count += BitUtil::PopCount(
+      BitmapWordReader(data, p.trailing_bit_offset, p.trailing_bits).TrailingBits());
 
   return count;
 }
@@ -110,74 +103,45 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
 template <bool invert_bits, bool restore_trailing_bits>
 void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
                     int64_t dest_offset, uint8_t* dest) {
-  int64_t byte_offset = offset / 8;
-  int64_t bit_offset = offset % 8;
-  int64_t dest_byte_offset = dest_offset / 8;
-  int64_t dest_bit_offset = dest_offset % 8;
-  int64_t num_bytes = BitUtil::BytesForBits(length);
-  // Shift dest by its byte offset
-  dest += dest_byte_offset;
+  if (offset % 8 != 0 || dest_offset % 8 != 0) {
+    // Unaligned: shift whole words into place (this preserves the bits surrounding
+    // the destination range in any case)
+    BitmapWordReader reader(data, offset, length);
+    BitmapWordWriter writer(dest, dest_offset, length);
+    while (reader.remaining() >= 64) {
+      const uint64_t word = reader.NextWord();
+      writer.PutNextWord(invert_bits ? ~word : word);
+    }
+    const uint64_t word = reader.TrailingBits();
+    writer.PutTrailingBits(invert_bits ? ~word : word);
+    return;
+  }
 
-  if (dest_bit_offset > 0) {
-    internal::BitmapReader valid_reader(data, offset, length);
-    internal::BitmapWriter valid_writer(dest, dest_bit_offset, length);
+  int64_t num_bytes = BitUtil::BytesForBits(length);
+  data += offset / 8;
+  dest += dest_offset / 8;
+
+  // Take care of the trailing bits in the last byte
+  int64_t trailing_bits = num_bytes * 8 - length;
+  uint8_t trail = 0;
+  if (trailing_bits && restore_trailing_bits) {
+    trail = dest[num_bytes - 1];
+  }
 
-    for (int64_t i = 0; i < length; i++) {
-      if (invert_bits ^ valid_reader.IsSet()) {
-        valid_writer.Set();
-      } else {
-        valid_writer.Clear();
-      }
-      valid_reader.Next();
-      valid_writer.Next();
+  if (invert_bits) {
+    for (int64_t i = 0; i < num_bytes; i++) {
+      dest[i] = static_cast<uint8_t>(~(data[i]));
     }
-    valid_writer.Finish();
   } else {
-    // Take care of the trailing bits in the last byte
-    int64_t trailing_bits = num_bytes * 8 - length;
-    uint8_t trail = 0;
-    if (trailing_bits && restore_trailing_bits) {
-      trail = dest[num_bytes - 1];
-    }
-
-    if (bit_offset > 0) {
-      uint8_t carry_mask = BitUtil::kPrecedingBitmask[bit_offset];
-      uint8_t carry_shift = static_cast<uint8_t>(8U - static_cast<uint8_t>(bit_offset));
-
-      uint8_t carry = 0U;
-      if (BitUtil::BytesForBits(length + bit_offset) > num_bytes) {
-        carry = static_cast<uint8_t>((data[byte_offset + num_bytes] & carry_mask)
-                                     << carry_shift);
-      }
+    std::memcpy(dest, data, static_cast<size_t>(num_bytes));
+  }
 
-      int64_t i = num_bytes - 1;
-      while (i + 1 > 0) {
-        uint8_t cur_byte = data[byte_offset + i];
-        if (invert_bits) {
-          dest[i] = static_cast<uint8_t>(~((cur_byte >> bit_offset) | carry));
-        } else {
-          dest[i] = static_cast<uint8_t>((cur_byte >> bit_offset) | carry);
-        }
-        carry = static_cast<uint8_t>((cur_byte & carry_mask) << carry_shift);
-        --i;
-      }
-    } else {
-      if (invert_bits) {
-        for (int64_t i = 0; i < num_bytes; i++) {
-          dest[i] = static_cast<uint8_t>(~(data[byte_offset + i]));
-        }
+  if (restore_trailing_bits) {
+    for (int i = 0; i < trailing_bits; i++) {
+      if (BitUtil::GetBit(&trail, i + 8 - trailing_bits)) {
+        BitUtil::SetBit(dest, length + i);
       } else {
-        std::memcpy(dest, data + byte_offset, static_cast<size_t>(num_bytes));
-      }
-    }
-
-    if (restore_trailing_bits) {
-      for (int i = 0; i < trailing_bits; i++) {
-        if (BitUtil::GetBit(&trail, i + 8 - trailing_bits)) {
-          BitUtil::SetBit(dest, length + i);
-        } else {
-          BitUtil::ClearBit(dest, length + i);
-        }
+        BitUtil::ClearBit(dest, length + i);
       }
     }
   }
@@ -258,59 +222,61 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
 
 namespace {
 
-template <typename Op>
+template <template <typename> class Op>
 void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                      int64_t right_offset, uint8_t* out, int64_t out_offset,
                      int64_t length) {
-  Op op;
+  Op<uint8_t> byte_op;
+  Op<uint64_t> word_op;
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
 
-  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset);
+  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset % 8);
   left += left_offset / 8;
   right += right_offset / 8;
   out += out_offset / 8;
-  for (int64_t i = 0; i < nbytes; ++i) {
-    out[i] = op(left[i], right[i]);
+  // Process whole words first, as memcpy'ed loads so that any pointer alignment works
+  int64_t i = 0;
+  for (; i + 8 <= nbytes; i += 8) {
+    uint64_t left_word, right_word;
+    std::memcpy(&left_word, left + i, sizeof(left_word));
+    std::memcpy(&right_word, right + i, sizeof(right_word));
+    const uint64_t out_word = word_op(left_word, right_word);
+    std::memcpy(out + i, &out_word, sizeof(out_word));
+  }
+  for (; i < nbytes; ++i) {
+    out[i] = byte_op(left[i], right[i]);
   }
 }
 
-template <typename Op>
+template <template <typename> class Op>
 void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                        int64_t right_offset, uint8_t* out, int64_t out_offset,
                        int64_t length) {
-  Op op;
-  auto left_reader = internal::BitmapReader(left, left_offset, length);
-  auto right_reader = internal::BitmapReader(right, right_offset, length);
-  auto writer = internal::BitmapWriter(out, out_offset, length);
-  for (int64_t i = 0; i < length; ++i) {
-    if (op(left_reader.IsSet(), right_reader.IsSet())) {
-      writer.Set();
-    } else {
-      writer.Clear();
-    }
-    left_reader.Next();
-    right_reader.Next();
-    writer.Next();
+  Op<uint64_t> op;
+  BitmapWordReader left_reader(left, left_offset, length);
+  BitmapWordReader right_reader(right, right_offset, length);
+  BitmapWordWriter writer(out, out_offset, length);
+  while (left_reader.remaining() >= 64) {
+    writer.PutNextWord(op(left_reader.NextWord(), right_reader.NextWord()));
   }
-  writer.Finish();
+  writer.PutTrailingBits(op(left_reader.TrailingBits(), right_reader.TrailingBits()));
 }
 
-template <typename BitOp, typename LogicalOp>
+template <template <typename> class Op>
 void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* dest) {
   if ((out_offset % 8 == left_offset % 8) && (out_offset % 8 == right_offset % 8)) {
     // Fast case: can use bytewise AND
-    AlignedBitmapOp<BitOp>(left, left_offset, right, right_offset, dest, out_offset,
-                           length);
+    AlignedBitmapOp<Op>(left, left_offset, right, right_offset, dest, out_offset, length);
   } else {
-    // Unaligned
-    UnalignedBitmapOp<LogicalOp>(left, left_offset, right, right_offset, dest, out_offset,
-                                 length);
+    // Unaligned: shift words into place
+    UnalignedBitmapOp<Op>(left, left_offset, right, right_offset, dest, out_offset,
+                          length);
   }
 }
 
-template <typename BitOp, typename LogicalOp>
+template <template <typename> class Op>
 Result<std::shared_ptr<Buffer>> BitmapOp(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
                                          int64_t right_offset, int64_t length,
@@ -318,8 +284,8 @@ Result<std::shared_ptr<Buffer>> BitmapOp(MemoryPool* pool, const uint8_t* left,
   std::shared_ptr<Buffer> out_buffer;
   const int64_t phys_bits = length + out_offset;
   RETURN_NOT_OK(AllocateEmptyBitmap(pool, phys_bits, &out_buffer));
-  BitmapOp<BitOp, LogicalOp>(left, left_offset, right, right_offset, length, out_offset,
-                             out_buffer->mutable_data());
+  BitmapOp<Op>(left, left_offset, right, right_offset, length, out_offset,
+               out_buffer->mutable_data());
   return out_buffer;
 }
 
@@ -360,42 +326,39 @@ Result<std::shared_ptr<Buffer>> BitmapAnd(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset);
+  return BitmapOp<std::bit_and>(pool, left, left_offset, right, right_offset, length,
+                                out_offset);
 }
 
 void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
-      left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<std::bit_and>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Result<std::shared_ptr<Buffer>> BitmapOr(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
                                          int64_t right_offset, int64_t length,
                                          int64_t out_offset) {
-  return BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset);
+  return BitmapOp<std::bit_or>(pool, left, left_offset, right, right_offset, length,
+                               out_offset);
 }
 
 void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
-      left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<std::bit_or>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Result<std::shared_ptr<Buffer>> BitmapXor(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset);
+  return BitmapOp<std::bit_xor>(pool, left, left_offset, right, right_offset, length,
+                                out_offset);
 }
 
 void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
-      left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<std::bit_xor>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Result<std::shared_ptr<Buffer>> BitmapAllButOne(MemoryPool* pool, int64_t length,
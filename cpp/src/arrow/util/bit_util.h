@@ -207,6 +207,21 @@ static inline uint64_t TrailingBits(uint64_t v, int num_bits) {
   return (v << n) >> n;
 }
 
+/// \brief Count the number of set bits in a 64-bit word.
+static inline int PopCount(uint64_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  return __builtin_popcountll(value);
+#elif defined(_MSC_VER)
+  return static_cast<int>(__popcnt64(value));
+#else
+  int count = 0;
+  for (; value != 0; value &= value - 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
 /// \brief Count the number of leading zeros in an unsigned integer.
 static inline int CountLeadingZeros(uint32_t value) {
 #if defined(__clang__) || defined(__GNUC__)
@@ -642,6 +657,126 @@ class FirstTimeBitmapWriter {
   int64_t byte_offset_;
 };
 
+/// \brief Sequentially read a bitmap 64 bits at a time, from any bit offset
+///
+/// Words are returned in bitmap order (bit i of the word is bit i of the current
+/// position), whatever the alignment of the start offset.  Call NextWord() while at
+/// least 64 bits remain, then TrailingBits() once for the rest.
+class BitmapWordReader {
+ public:
+  BitmapWordReader(const uint8_t* bitmap, int64_t start_offset, int64_t length)
+      : bitmap_(bitmap + start_offset / 8),
+        bit_offset_(static_cast<int>(start_offset % 8)),
+        remaining_(length) {}
+
+  int64_t remaining() const { return remaining_; }
+
+  uint64_t NextWord() {
+    uint64_t word;
+    std::memcpy(&word, bitmap_, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    if (bit_offset_ != 0) {
+      // At least 64 bits remain, so the following byte is part of the bitmap
+      word = (word >> bit_offset_) | (static_cast<uint64_t>(bitmap_[8])
+                                      << (64 - bit_offset_));
+    }
+    bitmap_ += 8;
+    remaining_ -= 64;
+    return word;
+  }
+
+  /// Return the last (fewer than 64) bits, with the unused high bits zeroed
+  uint64_t TrailingBits() {
+    if (remaining_ == 0) {
+      return 0;
+    }
+    const int64_t nbytes = BitUtil::BytesForBits(bit_offset_ + remaining_);
+    uint64_t word = 0;
+    for (int64_t i = 0; i < std::min<int64_t>(nbytes, 8); ++i) {
+      word |= static_cast<uint64_t>(bitmap_[i]) << (8 * i);
+    }
+    word >>= bit_offset_;
+    if (nbytes > 8) {
+      word |= static_cast<uint64_t>(bitmap_[8]) << (64 - bit_offset_);
+    }
+    if (remaining_ < 64) {
+      word &= (uint64_t(1) << remaining_) - 1;
+    }
+    remaining_ = 0;
+    return word;
+  }
+
+ private:
+  const uint8_t* bitmap_;
+  int bit_offset_;
+  int64_t remaining_;
+};
+
+/// \brief Sequentially write a bitmap 64 bits at a time, to any bit offset
+///
+/// The counterpart of BitmapWordReader.  Bits outside the written range are
+/// preserved.
+class BitmapWordWriter {
+ public:
+  BitmapWordWriter(uint8_t* bitmap, int64_t start_offset, int64_t length)
+      : bitmap_(bitmap + start_offset / 8),
+        bit_offset_(static_cast<int>(start_offset % 8)),
+        remaining_(length),
+        carry_(0) {
+    if (length == 0) {
+      // Nothing to write, not even the preceding bits of the first byte
+      bit_offset_ = 0;
+    } else if (bit_offset_ != 0) {
+      carry_ = bitmap_[0] & BitUtil::kPrecedingBitmask[bit_offset_];
+    }
+  }
+
+  int64_t remaining() const { return remaining_; }
+
+  void PutNextWord(uint64_t word) {
+    uint64_t out = word;
+    if (bit_offset_ != 0) {
+      out = carry_ | (word << bit_offset_);
+      carry_ = word >> (64 - bit_offset_);
+    }
+    out = BitUtil::ToLittleEndian(out);
+    std::memcpy(bitmap_, &out, sizeof(out));
+    bitmap_ += 8;
+    remaining_ -= 64;
+  }
+
+  /// Write the last (fewer than 64) bits from the low bits of `word`
+  void PutTrailingBits(uint64_t word) {
+    if (remaining_ < 64) {
+      word &= (uint64_t(1) << remaining_) - 1;
+    }
+    uint64_t low = word;
+    uint64_t high = 0;
+    if (bit_offset_ != 0) {
+      low = carry_ | (word << bit_offset_);
+      high = word >> (64 - bit_offset_);
+    }
+    const int64_t total_bits = bit_offset_ + remaining_;
+    for (int64_t i = 0; i * 8 < total_bits; ++i) {
+      const auto byte = static_cast<uint8_t>(i < 8 ? low >> (8 * i) : high);
+      const int64_t nbits = total_bits - i * 8;
+      if (nbits >= 8) {
+        bitmap_[i] = byte;
+      } else {
+        const uint8_t mask = BitUtil::kPrecedingBitmask[nbits];
+        bitmap_[i] = static_cast<uint8_t>((bitmap_[i] & ~mask) | (byte & mask));
+      }
+    }
+    remaining_ = 0;
+  }
+
+ private:
+  uint8_t* bitmap_;
+  int bit_offset_;
+  int64_t remaining_;
+  uint64_t carry_;
+};
+
 // A std::generate() like function to write sequential bits into a bitmap area.
 // Bits preceding the bitmap area are preserved, bits following the bitmap
 // area may be clobbered.
@@ -325,7 +325,7 @@ static void VisitBitsUnrolled(benchmark::State& state) {
 
 constexpr int64_t kBufferSize = 1024 * 8;
 
-template <int64_t Offset = 0>
+template <int64_t Offset = 0, int64_t DestOffset = 0>
 static void CopyBitmap(benchmark::State& state) {  // NOLINT non-const reference
   const int64_t buffer_size = state.range(0);
   const int64_t bits_size = buffer_size * 8;
@@ -337,10 +337,10 @@ static void CopyBitmap(benchmark::State& state) {  // NOLINT non-const reference
 
   std::shared_ptr<Buffer> copy;
   auto pool = default_memory_pool();
-  ABORT_NOT_OK(AllocateEmptyBitmap(pool, length, &copy));
+  ABORT_NOT_OK(AllocateEmptyBitmap(pool, length + DestOffset, &copy));
 
   for (auto _ : state) {
-    internal::CopyBitmap(src, offset, length, copy->mutable_data(), 0, false);
+    internal::CopyBitmap(src, offset, length, copy->mutable_data(), DestOffset, false);
   }
 
   state.SetBytesProcessed(state.iterations() * buffer_size);
@@ -356,6 +356,24 @@ static void CopyBitmapWithOffset(benchmark::State& state) {  // NOLINT non-const
   CopyBitmap<4>(state);
 }
 
+// Source and destination both unaligned, with different bit offsets.
+static void CopyBitmapWithOffsetBoth(
+    benchmark::State& state) {  // NOLINT non-const reference
+  CopyBitmap<3, 7>(state);
+}
+
+static void CountSetBits(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  const int64_t offset = state.range(1);
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(nbytes);
+
+  for (auto _ : state) {
+    auto total = internal::CountSetBits(buffer->data(), offset, nbytes * 8 - offset);
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes);
+}
+
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 static void ReferenceNaiveBitmapReader(benchmark::State& state) {
   BenchmarkBitmapReader<NaiveBitmapReader>(state, state.range(0));
@@ -383,6 +401,8 @@ BENCHMARK(GenerateBitsUnrolled)->Arg(kBufferSize);
 
 BENCHMARK(CopyBitmapWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffset)->Arg(kBufferSize);
+BENCHMARK(CopyBitmapWithOffsetBoth)->Arg(kBufferSize);
+BENCHMARK(CountSetBits)->Args({kBufferSize, 0})->Args({kBufferSize, 5});
 
 #define AND_BENCHMARK_RANGES                      \
   {                                               \
@@ -256,6 +256,48 @@ TEST(BitmapWriter, DoesNotWriteOutOfBounds) {
   ASSERT_EQ((length - 5), num_values);
 }
 
+TEST(BitmapWordReader, RoundTrip) {
+  const int64_t kBufferSize = 100;
+  std::shared_ptr<Buffer> src, dest;
+  ASSERT_OK(AllocateBuffer(kBufferSize, &src));
+  random_bytes(kBufferSize, 0, src->mutable_data());
+
+  for (int64_t offset : {0, 1, 7, 8, 61}) {
+    for (int64_t dest_offset : {0, 5, 64}) {
+      for (int64_t length : {0, 5, 64, 67, 128, 300}) {
+        ASSERT_OK(AllocateBuffer(kBufferSize, &dest));
+        std::memset(dest->mutable_data(), 0xff, kBufferSize);
+
+        internal::BitmapWordReader reader(src->data(), offset, length);
+        internal::BitmapWordWriter writer(dest->mutable_data(), dest_offset, length);
+        int64_t position = 0;
+        while (reader.remaining() >= 64) {
+          const uint64_t word = reader.NextWord();
+          for (int64_t i = 0; i < 64; ++i) {
+            ASSERT_EQ(BitUtil::GetBit(src->data(), offset + position + i),
+                      ((word >> i) & 1) != 0);
+          }
+          writer.PutNextWord(word);
+          position += 64;
+        }
+        const uint64_t word = reader.TrailingBits();
+        ASSERT_EQ(0, word >> (length - position));
+        writer.PutTrailingBits(word);
+
+        for (int64_t i = 0; i < kBufferSize * 8; ++i) {
+          if (i < dest_offset || i >= dest_offset + length) {
+            // Surrounding bits are preserved
+            ASSERT_TRUE(BitUtil::GetBit(dest->data(), i));
+          } else {
+            ASSERT_EQ(BitUtil::GetBit(src->data(), offset + i - dest_offset),
+                      BitUtil::GetBit(dest->data(), i));
+          }
+        }
+      }
+    }
+  }
+}
+
 TEST(FirstTimeBitmapWriter, NormalOperation) {
   for (const auto fill_byte_int : {0x00, 0xff}) {
     const uint8_t fill_byte = static_cast<uint8_t>(fill_byte_int);
@@ -663,6 +705,39 @@ TEST_F(BitmapOp, Xor) {
   TestUnaligned(op, left, right, result);
 }
 
+TEST_F(BitmapOp, LongRandom) {
+  // Exercise the word-at-a-time paths against a bitwise reference
+  const int64_t kBufferSize = 200;
+  std::shared_ptr<Buffer> left, right, out, expected;
+  ASSERT_OK(AllocateBuffer(kBufferSize, &left));
+  ASSERT_OK(AllocateBuffer(kBufferSize, &right));
+  random_bytes(kBufferSize, 0, left->mutable_data());
+  random_bytes(kBufferSize, 1, right->mutable_data());
+
+  for (int64_t left_offset : {0, 3, 64, 71}) {
+    for (int64_t right_offset : {0, 3, 5, 64}) {
+      for (int64_t out_offset : {0, 3, 13}) {
+        for (int64_t length : {0, 1, 63, 64, 65, 700, 1000}) {
+          ASSERT_OK(AllocateBuffer(kBufferSize, &out));
+          random_bytes(kBufferSize, 2, out->mutable_data());
+          ASSERT_OK(out->Copy(0, kBufferSize, &expected));
+          for (int64_t i = 0; i < length; ++i) {
+            BitUtil::SetBitTo(expected->mutable_data(), out_offset + i,
+                              BitUtil::GetBit(left->data(), left_offset + i) &&
+                                  BitUtil::GetBit(right->data(), right_offset + i));
+          }
+          BitmapAnd(left->data(), left_offset, right->data(), right_offset, length,
+                    out_offset, out->mutable_data());
+          for (int64_t i = out_offset; i < out_offset + length; ++i) {
+            ASSERT_EQ(BitUtil::GetBit(expected->data(), i),
+                      BitUtil::GetBit(out->data(), i));
+          }
+        }
+      }
+    }
+  }
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -1065,6 +1140,28 @@ static void TestZigZag(int32_t v) {
   EXPECT_EQ(v, result);
 }
 
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int32_t>::max());
+  TestZigZag64(std::numeric_limits<int32_t>::min());
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
 TEST(BitStreamUtil, ZigZag) {
   TestZigZag(0);
   TestZigZag(1);
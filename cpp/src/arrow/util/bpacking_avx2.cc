@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with AVX2 enabled, its functions must only be called
+// after checking for AVX2 support at runtime.
+
+#include "arrow/util/bpacking_avx2.h"
+
+#include <immintrin.h>
+
+#include <cstring>
+
+#include "arrow/util/bpacking_default.h"
+
+namespace arrow {
+namespace internal {
+
+// Each group of 32 values spans `num_bits` input words.  Value k of a group
+// starts at bit k * num_bits, i.e. at bit (k * num_bits) % 32 of word
+// (k * num_bits) / 32, and may continue into the following word.  Both words
+// are gathered and realigned with variable shifts, 8 values at a time.
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  const int num_loops = batch_size / 32;
+
+  if (num_bits == 0) {
+    memset(out, 0, batch_size * sizeof(uint32_t));
+    return batch_size;
+  }
+  if (num_bits == 32) {
+    memcpy(out, in, batch_size * sizeof(uint32_t));
+    return batch_size;
+  }
+  if (num_bits > 32) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+
+  // Precompute the word indices and shifts of the 4 vectors of a group
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i last_word = _mm256_set1_epi32(num_bits - 1);
+  const __m256i mask = _mm256_set1_epi32((1U << num_bits) - 1);
+  __m256i lo_index[4], hi_index[4], lo_shift[4], hi_shift[4];
+  for (int j = 0; j < 4; ++j) {
+    const __m256i bit_pos = _mm256_mullo_epi32(
+        _mm256_add_epi32(lanes, _mm256_set1_epi32(8 * j)), _mm256_set1_epi32(num_bits));
+    lo_index[j] = _mm256_srli_epi32(bit_pos, 5);
+    // The following word is only needed if the value straddles a word
+    // boundary, which never happens for the last word of a group: clamp the
+    // index so as not to read past the group.
+    hi_index[j] =
+        _mm256_min_epi32(_mm256_add_epi32(lo_index[j], _mm256_set1_epi32(1)), last_word);
+    lo_shift[j] = _mm256_and_si256(bit_pos, _mm256_set1_epi32(31));
+    // A shift count of 32 yields zero, as needed for word-aligned values
+    hi_shift[j] = _mm256_sub_epi32(_mm256_set1_epi32(32), lo_shift[j]);
+  }
+
+  for (int i = 0; i < num_loops; ++i) {
+    const int* base = reinterpret_cast<const int*>(in);
+    for (int j = 0; j < 4; ++j) {
+      const __m256i lo = _mm256_i32gather_epi32(base, lo_index[j], 4);
+      const __m256i hi = _mm256_i32gather_epi32(base, hi_index[j], 4);
+      const __m256i values = _mm256_and_si256(
+          _mm256_or_si256(_mm256_srlv_epi32(lo, lo_shift[j]),
+                          _mm256_sllv_epi32(hi, hi_shift[j])),
+          mask);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8 * j), values);
+    }
+    in += num_bits;
+    out += 32;
+  }
+  return batch_size;
+}
+
+}  // namespace internal
+}  // namespace arrow
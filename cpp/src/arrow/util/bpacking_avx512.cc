@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with AVX-512 enabled, its functions must only be
+// called after checking for AVX-512 support at runtime.
+
+#include "arrow/util/bpacking_avx512.h"
+
+#include <immintrin.h>
+
+#include <cstring>
+
+#include "arrow/util/bpacking_default.h"
+
+namespace arrow {
+namespace internal {
+
+// Same algorithm as unpack32_avx2(), 16 values at a time.
+int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  const int num_loops = batch_size / 32;
+
+  if (num_bits == 0) {
+    memset(out, 0, batch_size * sizeof(uint32_t));
+    return batch_size;
+  }
+  if (num_bits == 32) {
+    memcpy(out, in, batch_size * sizeof(uint32_t));
+    return batch_size;
+  }
+  if (num_bits > 32) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+
+  const __m512i lanes =
+      _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m512i last_word = _mm512_set1_epi32(num_bits - 1);
+  const __m512i mask = _mm512_set1_epi32((1U << num_bits) - 1);
+  __m512i lo_index[2], hi_index[2], lo_shift[2], hi_shift[2];
+  for (int j = 0; j < 2; ++j) {
+    const __m512i bit_pos = _mm512_mullo_epi32(
+        _mm512_add_epi32(lanes, _mm512_set1_epi32(16 * j)), _mm512_set1_epi32(num_bits));
+    lo_index[j] = _mm512_srli_epi32(bit_pos, 5);
+    hi_index[j] =
+        _mm512_min_epi32(_mm512_add_epi32(lo_index[j], _mm512_set1_epi32(1)), last_word);
+    lo_shift[j] = _mm512_and_si512(bit_pos, _mm512_set1_epi32(31));
+    hi_shift[j] = _mm512_sub_epi32(_mm512_set1_epi32(32), lo_shift[j]);
+  }
+
+  for (int i = 0; i < num_loops; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      const __m512i lo = _mm512_i32gather_epi32(lo_index[j], in, 4);
+      const __m512i hi = _mm512_i32gather_epi32(hi_index[j], in, 4);
+      const __m512i values = _mm512_and_si512(
+          _mm512_or_si512(_mm512_srlv_epi32(lo, lo_shift[j]),
+                          _mm512_sllv_epi32(hi, hi_shift[j])),
+          mask);
+      _mm512_storeu_si512(out + 16 * j, values);
+    }
+    in += num_bits;
+    out += 32;
+  }
+  return batch_size;
+}
+
+}  // namespace internal
+}  // namespace arrow
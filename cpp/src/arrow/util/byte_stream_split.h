@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Scatter and gather of the bytes of fixed-width values into sizeof(T)
+// streams, as done by the Parquet BYTE_STREAM_SPLIT encoding
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/sse_util.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+/// \brief Scatter byte j of each of the num_values values into stream j,
+/// streams being stored one after the other (stream j starts at
+/// out + j * num_values)
+template <typename T>
+void ByteStreamSplitEncodeScalar(const uint8_t* raw_values, const int64_t num_values,
+                                 uint8_t* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  for (int64_t i = 0; i < num_values; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      out[j * num_values + i] = raw_values[i * kNumStreams + j];
+    }
+  }
+}
+
+/// \brief Gather num_values values from streams spaced stride bytes apart,
+/// the first stream starting at data
+template <typename T>
+void ByteStreamSplitDecodeScalar(const uint8_t* data, const int64_t num_values,
+                                 const int64_t stride, T* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  for (int64_t i = 0; i < num_values; ++i) {
+    uint8_t gathered_bytes[kNumStreams];
+    for (int j = 0; j < kNumStreams; ++j) {
+      gathered_bytes[j] = data[j * stride + i];
+    }
+    out[i] = SafeLoadAs<T>(gathered_bytes);
+  }
+}
+
+#if defined(ARROW_HAVE_SSE2)
+
+// The kNumStreams registers form a (kNumStreams * 16)-byte block whose byte
+// index has log2(kNumStreams) register bits followed by 4 in-register bits.
+// Interleaving register j with register j + kNumStreams / 2 rotates that
+// index left by one bit, so log2(kNumStreams) steps turn streams of 16 bytes
+// into 16 consecutive values, and 4 steps do the reverse.
+template <int kNumStreams>
+inline void ByteStreamSplitShuffleStep(const __m128i* in, __m128i* out) {
+  constexpr int kHalf = kNumStreams / 2;
+  for (int j = 0; j < kHalf; ++j) {
+    out[2 * j] = _mm_unpacklo_epi8(in[j], in[kHalf + j]);
+    out[2 * j + 1] = _mm_unpackhi_epi8(in[j], in[kHalf + j]);
+  }
+}
+
+template <typename T>
+void ByteStreamSplitEncodeSse2(const uint8_t* raw_values, const int64_t num_values,
+                               uint8_t* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  constexpr int64_t kValuesPerBlock = static_cast<int64_t>(sizeof(__m128i));
+  const int64_t num_blocks = num_values / kValuesPerBlock;
+
+  __m128i stage[2][kNumStreams];
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    const uint8_t* block_values = raw_values + block * kValuesPerBlock * kNumStreams;
+    for (int j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(block_values + j * sizeof(__m128i)));
+    }
+    ByteStreamSplitShuffleStep<kNumStreams>(stage[0], stage[1]);
+    ByteStreamSplitShuffleStep<kNumStreams>(stage[1], stage[0]);
+    ByteStreamSplitShuffleStep<kNumStreams>(stage[0], stage[1]);
+    ByteStreamSplitShuffleStep<kNumStreams>(stage[1], stage[0]);
+    for (int j = 0; j < kNumStreams; ++j) {
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(out + j * num_values + block * kValuesPerBlock),
+          stage[0][j]);
+    }
+  }
+
+  // Remaining values
+  for (int64_t i = num_blocks * kValuesPerBlock; i < num_values; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      out[j * num_values + i] = raw_values[i * kNumStreams + j];
+    }
+  }
+}
+
+template <typename T>
+void ByteStreamSplitDecodeSse2(const uint8_t* data, const int64_t num_values,
+                               const int64_t stride, T* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  constexpr int kNumSteps = kNumStreams == 8 ? 3 : 2;
+  constexpr int64_t kValuesPerBlock = static_cast<int64_t>(sizeof(__m128i));
+  const int64_t num_blocks = num_values / kValuesPerBlock;
+  uint8_t* out_bytes = reinterpret_cast<uint8_t*>(out);
+
+  __m128i stage[2][kNumStreams];
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(data + j * stride + block * kValuesPerBlock));
+    }
+    for (int step = 0; step < kNumSteps; ++step) {
+      ByteStreamSplitShuffleStep<kNumStreams>(stage[step % 2], stage[(step + 1) % 2]);
+    }
+    uint8_t* block_out = out_bytes + block * kValuesPerBlock * kNumStreams;
+    for (int j = 0; j < kNumStreams; ++j) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(block_out + j * sizeof(__m128i)),
+                       stage[kNumSteps % 2][j]);
+    }
+  }
+
+  const int64_t num_processed = num_blocks * kValuesPerBlock;
+  ByteStreamSplitDecodeScalar<T>(data + num_processed, num_values - num_processed,
+                                 stride, out + num_processed);
+}
+
+#endif  // ARROW_HAVE_SSE2
+
+/// \brief Encode num_values values of type T (4 or 8 bytes wide) given as
+/// raw bytes; out must have room for num_values * sizeof(T) bytes
+template <typename T>
+void ByteStreamSplitEncode(const uint8_t* raw_values, const int64_t num_values,
+                           uint8_t* out) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported value width");
+#if defined(ARROW_HAVE_SSE2)
+  ByteStreamSplitEncodeSse2<T>(raw_values, num_values, out);
+#else
+  ByteStreamSplitEncodeScalar<T>(raw_values, num_values, out);
+#endif
+}
+
+/// \brief Decode num_values values of type T (4 or 8 bytes wide) from streams
+/// spaced stride bytes apart
+template <typename T>
+void ByteStreamSplitDecode(const uint8_t* data, const int64_t num_values,
+                           const int64_t stride, T* out) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported value width");
+#if defined(ARROW_HAVE_SSE2)
+  ByteStreamSplitDecodeSse2<T>(data, num_values, stride, out);
+#else
+  ByteStreamSplitDecodeScalar<T>(data, num_values, stride, out);
+#endif
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
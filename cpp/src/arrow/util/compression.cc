@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #ifdef ARROW_WITH_BROTLI
 #include "arrow/util/compression_brotli.h"
@@ -156,6 +157,46 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
   return std::move(codec);
 }
 
+Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
+                                             std::shared_ptr<Buffer> dictionary,
+                                             int compression_level) {
+  if (dictionary == nullptr) {
+    return Create(codec_type, compression_level);
+  }
+  std::unique_ptr<Codec> codec;
+  switch (codec_type) {
+    case Compression::ZSTD:
+#ifdef ARROW_WITH_ZSTD
+      codec.reset(new ZSTDCodec(compression_level, std::move(dictionary)));
+      break;
+#else
+      return Status::NotImplemented("ZSTD codec support not built");
+#endif
+    default:
+      return Status::NotImplemented(GetCodecAsString(codec_type),
+                                    " codec doesn't support dictionaries");
+  }
+
+  RETURN_NOT_OK(codec->Init());
+  return std::move(codec);
+}
+
+Result<std::shared_ptr<Buffer>> Codec::TrainDictionary(
+    Compression::type codec_type, const std::vector<std::shared_ptr<Buffer>>& samples,
+    int64_t max_dictionary_size) {
+  switch (codec_type) {
+    case Compression::ZSTD:
+#ifdef ARROW_WITH_ZSTD
+      return ZSTDCodec::TrainDictionary(samples, max_dictionary_size);
+#else
+      return Status::NotImplemented("ZSTD codec support not built");
+#endif
+    default:
+      return Status::NotImplemented(GetCodecAsString(codec_type),
+                                    " codec doesn't support dictionaries");
+  }
+}
+
 bool Codec::IsAvailable(Compression::type codec_type) {
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
@@ -222,6 +263,11 @@ Status Codec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
   return MakeDecompressor().Value(out);
 }
 
+Result<int64_t> Codec::FrameCompressedLength(int64_t input_len, const uint8_t* input) {
+  return Status::NotImplemented("Frame boundaries are not known for codec '", name(),
+                                "'");
+}
+
 Status Codec::Compress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
                        uint8_t* output_buffer, int64_t* output_len) {
   return Compress(input_len, input, output_buffer_len, output_buffer).Value(output_len);
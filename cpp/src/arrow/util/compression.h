@@ -21,6 +21,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -128,6 +129,28 @@ class ARROW_EXPORT Codec {
   static Result<std::unique_ptr<Codec>> Create(
       Compression::type codec, int compression_level = kUseDefaultCompressionLevel);
 
+  /// \brief Create a codec for the given compression algorithm, priming it
+  /// with a dictionary
+  ///
+  /// A dictionary holds content typical of the data to compress, which
+  /// considerably improves the compression of small inputs such as data pages
+  /// or messages.  Data compressed with a dictionary can only be decompressed
+  /// with the same dictionary.  Only ZSTD supports dictionaries, see
+  /// TrainDictionary().  A null dictionary creates a regular codec.
+  static Result<std::unique_ptr<Codec>> Create(
+      Compression::type codec, std::shared_ptr<Buffer> dictionary,
+      int compression_level = kUseDefaultCompressionLevel);
+
+  /// \brief Train a dictionary for the given compression algorithm
+  ///
+  /// The samples should be representative of the inputs to compress, e.g.
+  /// a few hundred data pages.  The resulting dictionary is at most
+  /// max_dictionary_size bytes; samples totalling about a hundred times that
+  /// size give the best results.
+  static Result<std::shared_ptr<Buffer>> TrainDictionary(
+      Compression::type codec, const std::vector<std::shared_ptr<Buffer>>& samples,
+      int64_t max_dictionary_size = 112640);
+
   /// \brief Return true if support for indicated codec has been enabled
   static bool IsAvailable(Compression::type codec);
 
@@ -162,6 +185,15 @@ class ARROW_EXPORT Codec {
   /// \brief Create a streaming compressor instance
   virtual Result<std::shared_ptr<Decompressor>> MakeDecompressor() = 0;
 
+  /// \brief Return the compressed length of the frame starting at `input`
+  ///
+  /// Some streams are made of frames that can be decompressed independently
+  /// of each other, e.g. zstd and LZ4 frames or BGZF gzip members.  For those,
+  /// return the length of the first frame in `input`, or 0 if `input` is too
+  /// short to contain it entirely.  Return NotImplemented if the codec, or the
+  /// stream, isn't framed that way.
+  virtual Result<int64_t> FrameCompressedLength(int64_t input_len, const uint8_t* input);
+
   virtual const char* name() const = 0;
 
   // Deprecated APIs
@@ -19,10 +19,12 @@
 
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/compression.h"
@@ -186,6 +188,51 @@ BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::BROTLI);
 #ifdef ARROW_WITH_ZSTD
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::ZSTD);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::ZSTD);
+
+// One-shot compression of small pages, with or without a trained dictionary
+static void ZSTDSmallPages(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t page_size = state.range(0);
+  const bool use_dictionary = state.range(1) != 0;
+  const int64_t num_pages = (1 << 20) / page_size;
+
+  auto data = MakeCompressibleData(static_cast<int>(2 * num_pages * page_size));
+  std::vector<std::shared_ptr<Buffer>> pages;
+  for (int64_t i = 0; i < 2 * num_pages; ++i) {
+    pages.push_back(std::make_shared<Buffer>(data.data() + i * page_size, page_size));
+  }
+  // Train on the first half of the pages, compress the second half
+  std::vector<std::shared_ptr<Buffer>> samples(pages.begin(), pages.begin() + num_pages);
+  pages.erase(pages.begin(), pages.begin() + num_pages);
+
+  std::shared_ptr<Buffer> dictionary;
+  if (use_dictionary) {
+    dictionary = *Codec::TrainDictionary(Compression::ZSTD, samples);
+  }
+  auto codec = *Codec::Create(Compression::ZSTD, dictionary);
+
+  std::vector<uint8_t> output(
+      static_cast<size_t>(codec->MaxCompressedLen(page_size, data.data())));
+  int64_t compressed_size = 0;
+  for (auto _ : state) {
+    compressed_size = 0;
+    for (const auto& page : pages) {
+      compressed_size += *codec->Compress(page->size(), page->data(), output.size(),
+                                          output.data());
+    }
+  }
+  state.counters["ratio"] = static_cast<double>(num_pages * page_size) /
+                            static_cast<double>(compressed_size);
+  state.SetBytesProcessed(state.iterations() * num_pages * page_size);
+}
+
+BENCHMARK(ZSTDSmallPages)
+    ->ArgNames({"page_size", "dictionary"})
+    ->Args({1024, 0})
+    ->Args({1024, 1})
+    ->Args({4096, 0})
+    ->Args({4096, 1})
+    ->Args({16384, 0})
+    ->Args({16384, 1});
 #endif
 
 #ifdef ARROW_WITH_LZ4
@@ -25,8 +25,10 @@
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/ubsan.h"
 
 #ifndef LZ4F_HEADER_SIZE_MAX
 #define LZ4F_HEADER_SIZE_MAX 19
@@ -239,6 +241,63 @@ Result<std::shared_ptr<Decompressor>> Lz4Codec::MakeDecompressor() {
   return ptr;
 }
 
+static uint32_t LoadUInt32(const uint8_t* data) {
+  return BitUtil::FromLittleEndian(SafeLoadAs<uint32_t>(data));
+}
+
+Result<int64_t> Lz4Codec::FrameCompressedLength(int64_t input_len, const uint8_t* input) {
+  // Walk the frame descriptor and block headers of the LZ4 frame format
+  constexpr uint32_t kFrameMagic = 0x184D2204U;
+  // Skippable frames have magic numbers 0x184D2A50 to 0x184D2A5F
+  constexpr uint32_t kSkippableFrameMagic = 0x184D2A50U;
+  constexpr uint32_t kSkippableFrameMagicMask = 0xFFFFFFF0U;
+  constexpr uint32_t kUncompressedBlockFlag = 0x80000000U;
+
+  if (input_len < 4) {
+    return 0;
+  }
+  const uint32_t magic = LoadUInt32(input);
+  if ((magic & kSkippableFrameMagicMask) == kSkippableFrameMagic) {
+    if (input_len < 8) {
+      return 0;
+    }
+    const int64_t frame_len = 8 + static_cast<int64_t>(LoadUInt32(input + 4));
+    return frame_len <= input_len ? frame_len : 0;
+  }
+  if (magic != kFrameMagic) {
+    return Status::IOError("Corrupt Lz4 compressed data: invalid frame magic number");
+  }
+  if (input_len < 5) {
+    return 0;
+  }
+  const uint8_t flags = input[4];
+  if ((flags >> 6) != 1) {
+    return Status::IOError("Corrupt Lz4 compressed data: unsupported frame version");
+  }
+  const bool has_block_checksums = (flags >> 4) & 1;
+  const bool has_content_size = (flags >> 3) & 1;
+  const bool has_content_checksum = (flags >> 2) & 1;
+  const bool has_dictionary_id = flags & 1;
+  // Magic, flags, block descriptor, optional fields and header checksum
+  int64_t pos = 4 + 2 + (has_content_size ? 8 : 0) + (has_dictionary_id ? 4 : 0) + 1;
+  while (true) {
+    if (pos + 4 > input_len) {
+      return 0;
+    }
+    const uint32_t block_size = LoadUInt32(input + pos) & ~kUncompressedBlockFlag;
+    pos += 4;
+    if (block_size == 0) {
+      // End mark
+      break;
+    }
+    pos += block_size + (has_block_checksums ? 4 : 0);
+  }
+  if (has_content_checksum) {
+    pos += 4;
+  }
+  return pos <= input_len ? pos : 0;
+}
+
 Result<int64_t> Lz4Codec::Decompress(int64_t input_len, const uint8_t* input,
                                      int64_t output_buffer_len, uint8_t* output_buffer) {
   int64_t decompressed_size = LZ4_decompress_safe(
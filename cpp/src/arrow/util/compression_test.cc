@@ -22,10 +22,12 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -326,6 +328,12 @@ TEST(TestCodecMisc, GetCodecAsString) {
   ASSERT_EQ("ZSTD", Codec::GetCodecAsString(Compression::ZSTD));
 }
 
+TEST(TestCodecMisc, DictionaryNotSupported) {
+  auto dictionary = Buffer::FromString("some dictionary");
+  ASSERT_RAISES(NotImplemented, Codec::Create(Compression::SNAPPY, dictionary));
+  ASSERT_RAISES(NotImplemented, Codec::TrainDictionary(Compression::GZIP, {dictionary}));
+}
+
 TEST_P(CodecTest, CodecRoundtrip) {
   const auto compression = GetCompression();
   if (compression == Compression::BZ2) {
@@ -500,6 +508,46 @@ TEST_P(CodecTest, StreamingDecompressorReuse) {
   CheckStreamingRoundtrip(compressor, decompressor, data);
 }
 
+TEST_P(CodecTest, FrameCompressedLength) {
+  const auto compression = GetCompression();
+  if (compression != Compression::ZSTD && compression != Compression::LZ4) {
+    // SKIP: streams can't be split into frames
+    return;
+  }
+
+  auto codec = MakeCodec();
+  for (auto data : {MakeRandomData(100000), MakeCompressibleData(100000)}) {
+    ASSERT_OK_AND_ASSIGN(auto compressor, codec->MakeCompressor());
+    std::vector<uint8_t> compressed(data.size() * 2 + 1024);
+    ASSERT_OK_AND_ASSIGN(auto result, compressor->Compress(data.size(), data.data(),
+                                                           compressed.size(),
+                                                           compressed.data()));
+    ASSERT_EQ(result.bytes_read, static_cast<int64_t>(data.size()));
+    int64_t frame_len = result.bytes_written;
+    ASSERT_OK_AND_ASSIGN(auto end_result,
+                         compressor->End(compressed.size() - frame_len,
+                                         compressed.data() + frame_len));
+    ASSERT_FALSE(end_result.should_retry);
+    frame_len += end_result.bytes_written;
+
+    // Trailing data is ignored, truncated frames need more input
+    ASSERT_OK_AND_EQ(frame_len,
+                     codec->FrameCompressedLength(compressed.size(), compressed.data()));
+    const uint8_t* frame = compressed.data();
+    ASSERT_OK_AND_EQ(frame_len, codec->FrameCompressedLength(frame_len, frame));
+    ASSERT_OK_AND_EQ(0, codec->FrameCompressedLength(frame_len - 1, frame));
+    ASSERT_OK_AND_EQ(0, codec->FrameCompressedLength(3, frame));
+  }
+
+  // Skippable frame
+  const uint8_t skippable[] = {0x50, 0x2a, 0x4d, 0x18, 2, 0, 0, 0, 'a', 'b'};
+  ASSERT_OK_AND_EQ(10, codec->FrameCompressedLength(10, skippable));
+  ASSERT_OK_AND_EQ(0, codec->FrameCompressedLength(9, skippable));
+
+  const uint8_t invalid[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+  ASSERT_RAISES(IOError, codec->FrameCompressedLength(8, invalid));
+}
+
 #ifdef ARROW_WITH_ZLIB
 INSTANTIATE_TEST_CASE_P(TestGZip, CodecTest, ::testing::Values(Compression::GZIP));
 #endif
@@ -522,6 +570,89 @@ INSTANTIATE_TEST_CASE_P(TestBZ2, CodecTest, ::testing::Values(Compression::BZ2))
 
 #ifdef ARROW_WITH_ZSTD
 INSTANTIATE_TEST_CASE_P(TestZSTD, CodecTest, ::testing::Values(Compression::ZSTD));
+
+// Small records sharing most of their contents, like data pages of a column
+std::vector<uint8_t> MakeRecord(std::default_random_engine* rng) {
+  std::uniform_int_distribution<int> ids(0, 1000000);
+  std::uniform_int_distribution<int> countries(0, 3);
+  static const char* kCountries[] = {"France", "Japan", "Brazil", "Kenya"};
+  const int id = ids(*rng);
+  std::string record = "{\"id\": " + std::to_string(id) + ", \"name\": \"user_" +
+                       std::to_string(id) + "\", \"country\": \"" +
+                       kCountries[countries(*rng)] +
+                       "\", \"status\": \"active\", \"tags\": [\"arrow\"]}";
+  return std::vector<uint8_t>(record.begin(), record.end());
+}
+
+TEST(TestZSTDCodec, Dictionary) {
+  std::default_random_engine rng(42);
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int i = 0; i < 1000; ++i) {
+    auto record = MakeRecord(&rng);
+    samples.push_back(
+        Buffer::FromString(std::string(record.begin(), record.end())));
+  }
+  ASSERT_OK_AND_ASSIGN(auto dictionary,
+                       Codec::TrainDictionary(Compression::ZSTD, samples, 1024));
+  ASSERT_GT(dictionary->size(), 0);
+  ASSERT_LE(dictionary->size(), 1024);
+
+  ASSERT_OK_AND_ASSIGN(auto dict_codec, Codec::Create(Compression::ZSTD, dictionary));
+  ASSERT_OK_AND_ASSIGN(auto plain_codec, Codec::Create(Compression::ZSTD));
+
+  const auto data = MakeRecord(&rng);
+  CheckCodecRoundtrip(dict_codec, dict_codec, data);
+  CheckStreamingRoundtrip(dict_codec.get(), data);
+
+  // The dictionary compresses small inputs much better
+  std::vector<uint8_t> compressed(
+      static_cast<size_t>(plain_codec->MaxCompressedLen(data.size(), data.data())));
+  ASSERT_OK_AND_ASSIGN(int64_t plain_size,
+                       plain_codec->Compress(data.size(), data.data(), compressed.size(),
+                                             compressed.data()));
+  ASSERT_OK_AND_ASSIGN(int64_t dict_size,
+                       dict_codec->Compress(data.size(), data.data(), compressed.size(),
+                                            compressed.data()));
+  ASSERT_LT(dict_size * 2, plain_size);
+
+  // Decompressing requires the dictionary
+  std::vector<uint8_t> decompressed(data.size());
+  ASSERT_RAISES(IOError, plain_codec->Decompress(dict_size, compressed.data(),
+                                                 decompressed.size(),
+                                                 decompressed.data()));
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()),
+                   dict_codec->Decompress(dict_size, compressed.data(),
+                                          decompressed.size(), decompressed.data()));
+  ASSERT_EQ(data, decompressed);
+
+  // Too few samples to train a dictionary
+  ASSERT_RAISES(Invalid, Codec::TrainDictionary(Compression::ZSTD, {samples[0]}, 1024));
+}
+
+TEST(TestZSTDCodec, ConcurrentOneShot) {
+  // One-shot calls from several threads share the codec's contexts
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Codec> codec, Codec::Create(Compression::ZSTD));
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&, i] {
+      for (int j = 0; j < 20; ++j) {
+        auto data = MakeRandomData(1000 + 100 * i + j);
+        std::vector<uint8_t> compressed(
+            static_cast<size_t>(codec->MaxCompressedLen(data.size(), data.data())));
+        std::vector<uint8_t> decompressed(data.size());
+        auto compressed_size = codec->Compress(data.size(), data.data(),
+                                               compressed.size(), compressed.data());
+        ASSERT_OK(compressed_size);
+        ASSERT_OK(codec->Decompress(*compressed_size, compressed.data(),
+                                    decompressed.size(), decompressed.data()));
+        ASSERT_EQ(data, decompressed);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
 #endif
 
 }  // namespace util
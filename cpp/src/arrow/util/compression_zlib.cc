@@ -319,6 +319,40 @@ class GZipCodec::GZipCodecImpl {
     return ptr;
   }
 
+  Result<int64_t> FrameCompressedLength(int64_t input_len, const uint8_t* input) {
+    // gzip members can only be delimited without decompressing them if they
+    // carry their size in a BGZF extra subfield, as written by bgzip
+    constexpr uint8_t kExtraFieldFlag = 4;
+    constexpr int64_t kHeaderSize = 12;
+
+    if (format_ != GZIP) {
+      return Status::NotImplemented("Frame boundaries are only known for BGZF streams");
+    }
+    if (input_len < kHeaderSize) {
+      return 0;
+    }
+    if (input[0] != 0x1f || input[1] != 0x8b) {
+      return Status::IOError("Corrupt gzip compressed data: invalid header");
+    }
+    if (!(input[3] & kExtraFieldFlag)) {
+      return Status::NotImplemented("gzip member doesn't have a BGZF block size");
+    }
+    const int64_t extra_end = kHeaderSize + (input[10] | (input[11] << 8));
+    if (input_len < extra_end) {
+      return 0;
+    }
+    for (int64_t pos = kHeaderSize; pos + 4 <= extra_end;) {
+      const int64_t subfield_len = input[pos + 2] | (input[pos + 3] << 8);
+      if (input[pos] == 'B' && input[pos + 1] == 'C' && subfield_len == 2 &&
+          pos + 6 <= extra_end) {
+        const int64_t member_len = (input[pos + 4] | (input[pos + 5] << 8)) + 1;
+        return member_len <= input_len ? member_len : 0;
+      }
+      pos += 4 + subfield_len;
+    }
+    return Status::NotImplemented("gzip member doesn't have a BGZF block size");
+  }
+
   Status InitCompressor() {
     EndDecompressor();
     memset(&stream_, 0, sizeof(stream_));
@@ -512,6 +546,11 @@ Result<std::shared_ptr<Decompressor>> GZipCodec::MakeDecompressor() {
   return impl_->MakeDecompressor();
 }
 
+Result<int64_t> GZipCodec::FrameCompressedLength(int64_t input_len,
+                                                 const uint8_t* input) {
+  return impl_->FrameCompressedLength(input_len, input);
+}
+
 const char* GZipCodec::name() const { return "gzip"; }
 
 }  // namespace util
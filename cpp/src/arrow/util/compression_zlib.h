@@ -58,6 +58,8 @@ class ARROW_EXPORT GZipCodec : public Codec {
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override;
 
+  Result<int64_t> FrameCompressedLength(int64_t input_len, const uint8_t* input) override;
+
   const char* name() const override;
 
  private:
@@ -19,13 +19,22 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <utility>
+#include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
 
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/ubsan.h"
 
 using std::size_t;
 
@@ -38,20 +47,43 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
 }
 
+constexpr uint32_t kZSTDFrameMagic = 0xFD2FB528U;
+// Skippable frames have magic numbers 0x184D2A50 to 0x184D2A5F
+constexpr uint32_t kSkippableFrameMagic = 0x184D2A50U;
+constexpr uint32_t kSkippableFrameMagicMask = 0xFFFFFFF0U;
+
+uint32_t LoadUInt32(const uint8_t* data) {
+  return BitUtil::FromLittleEndian(SafeLoadAs<uint32_t>(data));
+}
+
 }  // namespace
 
+struct ZSTDDictionary {
+  ZSTD_CDict* cdict = NULLPTR;
+  ZSTD_DDict* ddict = NULLPTR;
+
+  ~ZSTDDictionary() {
+    ZSTD_freeCDict(cdict);
+    ZSTD_freeDDict(ddict);
+  }
+};
+
 // ----------------------------------------------------------------------
 // ZSTD decompressor implementation
 
 class ZSTDDecompressor : public Decompressor {
  public:
-  ZSTDDecompressor() : stream_(ZSTD_createDStream()) {}
+  explicit ZSTDDecompressor(std::shared_ptr<ZSTDDictionary> dictionary)
+      : stream_(ZSTD_createDStream()), dictionary_(std::move(dictionary)) {}
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
   Status Init() {
     finished_ = false;
     size_t ret = ZSTD_initDStream(stream_);
+    if (!ZSTD_isError(ret) && dictionary_ != NULLPTR) {
+      ret = ZSTD_DCtx_refDDict(stream_, dictionary_->ddict);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -88,6 +120,7 @@ class ZSTDDecompressor : public Decompressor {
 
  protected:
   ZSTD_DStream* stream_;
+  std::shared_ptr<ZSTDDictionary> dictionary_;
   bool finished_;
 };
 
@@ -96,13 +129,24 @@ class ZSTDDecompressor : public Decompressor {
 
 class ZSTDCompressor : public Compressor {
  public:
-  explicit ZSTDCompressor(int compression_level)
-      : stream_(ZSTD_createCStream()), compression_level_(compression_level) {}
+  ZSTDCompressor(int compression_level, std::shared_ptr<ZSTDDictionary> dictionary)
+      : stream_(ZSTD_createCStream()),
+        compression_level_(compression_level),
+        dictionary_(std::move(dictionary)) {}
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
   Status Init() {
-    size_t ret = ZSTD_initCStream(stream_, compression_level_);
+    size_t ret;
+    if (dictionary_ != NULLPTR) {
+      // The compression level is that of the digested dictionary
+      ret = ZSTD_CCtx_reset(stream_, ZSTD_reset_session_and_parameters);
+      if (!ZSTD_isError(ret)) {
+        ret = ZSTD_CCtx_refCDict(stream_, dictionary_->cdict);
+      }
+    } else {
+      ret = ZSTD_initCStream(stream_, compression_level_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -166,29 +210,210 @@ class ZSTDCompressor : public Compressor {
 
  private:
   int compression_level_;
+  std::shared_ptr<ZSTDDictionary> dictionary_;
 };
 
 // ----------------------------------------------------------------------
 // ZSTD codec implementation
 
-ZSTDCodec::ZSTDCodec(int compression_level) {
+// Contexts not currently used by a one-shot call.  A call takes one, or
+// creates one if none is free, and returns it when done.
+class ZSTDCodec::ContextPool {
+ public:
+  ~ContextPool() {
+    for (ZSTD_CCtx* cctx : cctxs_) {
+      ZSTD_freeCCtx(cctx);
+    }
+    for (ZSTD_DCtx* dctx : dctxs_) {
+      ZSTD_freeDCtx(dctx);
+    }
+  }
+
+  // A context taken from the pool, returned to it on destruction
+  template <typename Context>
+  class Lease {
+   public:
+    Lease(ContextPool* pool, Context* context) : pool_(pool), context_(context) {}
+    ~Lease() {
+      if (context_ != NULLPTR) {
+        pool_->Return(context_);
+      }
+    }
+
+    Context* get() const { return context_; }
+
+   private:
+    ContextPool* pool_;
+    Context* context_;
+
+    ARROW_DISALLOW_COPY_AND_ASSIGN(Lease);
+  };
+
+  Result<ZSTD_CCtx*> TakeCCtx() {
+    return Take(&cctxs_, ZSTD_createCCtx, "ZSTD compression context");
+  }
+
+  Result<ZSTD_DCtx*> TakeDCtx() {
+    return Take(&dctxs_, ZSTD_createDCtx, "ZSTD decompression context");
+  }
+
+ private:
+  template <typename Context>
+  Result<Context*> Take(std::vector<Context*>* contexts, Context* (*create)(),
+                        const char* what) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!contexts->empty()) {
+        Context* context = contexts->back();
+        contexts->pop_back();
+        return context;
+      }
+    }
+    Context* context = create();
+    if (context == NULLPTR) {
+      return Status::OutOfMemory("Failed to create ", what);
+    }
+    return context;
+  }
+
+  void Return(ZSTD_CCtx* cctx) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cctxs_.push_back(cctx);
+  }
+
+  void Return(ZSTD_DCtx* dctx) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    dctxs_.push_back(dctx);
+  }
+
+  std::mutex mutex_;
+  std::vector<ZSTD_CCtx*> cctxs_;
+  std::vector<ZSTD_DCtx*> dctxs_;
+};
+
+ZSTDCodec::ZSTDCodec(int compression_level, std::shared_ptr<Buffer> dictionary)
+    : dictionary_(std::move(dictionary)), contexts_(new ContextPool) {
   compression_level_ = compression_level == kUseDefaultCompressionLevel
                            ? kZSTDDefaultCompressionLevel
                            : compression_level;
 }
 
+ZSTDCodec::~ZSTDCodec() {}
+
+Status ZSTDCodec::Init() {
+  if (dictionary_ == NULLPTR) {
+    return Status::OK();
+  }
+  auto digested = std::make_shared<ZSTDDictionary>();
+  const auto dictionary_size = static_cast<size_t>(dictionary_->size());
+  digested->cdict =
+      ZSTD_createCDict(dictionary_->data(), dictionary_size, compression_level_);
+  digested->ddict = ZSTD_createDDict(dictionary_->data(), dictionary_size);
+  if (digested->cdict == NULLPTR || digested->ddict == NULLPTR) {
+    return Status::Invalid("Failed to load ZSTD dictionary");
+  }
+  digested_dictionary_ = std::move(digested);
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Buffer>> ZSTDCodec::TrainDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size) {
+  // ZDICT wants the samples concatenated
+  std::vector<size_t> sample_sizes;
+  int64_t total_size = 0;
+  for (const auto& sample : samples) {
+    sample_sizes.push_back(static_cast<size_t>(sample->size()));
+    total_size += sample->size();
+  }
+  std::shared_ptr<Buffer> concatenated;
+  RETURN_NOT_OK(AllocateBuffer(total_size, &concatenated));
+  uint8_t* out = concatenated->mutable_data();
+  for (const auto& sample : samples) {
+    std::memcpy(out, sample->data(), static_cast<size_t>(sample->size()));
+    out += sample->size();
+  }
+
+  std::shared_ptr<ResizableBuffer> dictionary;
+  RETURN_NOT_OK(AllocateResizableBuffer(max_dictionary_size, &dictionary));
+  size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(max_dictionary_size),
+      concatenated->data(), sample_sizes.data(), static_cast<unsigned>(samples.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ", ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  return dictionary;
+}
+
 Result<std::shared_ptr<Compressor>> ZSTDCodec::MakeCompressor() {
-  auto ptr = std::make_shared<ZSTDCompressor>(compression_level_);
+  auto ptr = std::make_shared<ZSTDCompressor>(compression_level_, digested_dictionary_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
 
 Result<std::shared_ptr<Decompressor>> ZSTDCodec::MakeDecompressor() {
-  auto ptr = std::make_shared<ZSTDDecompressor>();
+  auto ptr = std::make_shared<ZSTDDecompressor>(digested_dictionary_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
 
+Result<int64_t> ZSTDCodec::FrameCompressedLength(int64_t input_len,
+                                                 const uint8_t* input) {
+  // Walk the frame header and block headers, as described in RFC 8878
+  if (input_len < 4) {
+    return 0;
+  }
+  const uint32_t magic = LoadUInt32(input);
+  if ((magic & kSkippableFrameMagicMask) == kSkippableFrameMagic) {
+    if (input_len < 8) {
+      return 0;
+    }
+    const int64_t frame_len = 8 + static_cast<int64_t>(LoadUInt32(input + 4));
+    return frame_len <= input_len ? frame_len : 0;
+  }
+  if (magic != kZSTDFrameMagic) {
+    return Status::IOError("Corrupt ZSTD compressed data: invalid frame magic number");
+  }
+  if (input_len < 5) {
+    return 0;
+  }
+  static const int64_t kDictionaryIdSizes[] = {0, 1, 2, 4};
+  static const int64_t kContentSizeSizes[] = {0, 2, 4, 8};
+  const uint8_t descriptor = input[4];
+  const int content_size_flag = descriptor >> 6;
+  const bool single_segment = (descriptor >> 5) & 1;
+  const bool has_checksum = (descriptor >> 2) & 1;
+  int64_t pos = 5 + (single_segment ? 0 : 1) + kDictionaryIdSizes[descriptor & 3] +
+                ((content_size_flag == 0 && single_segment)
+                     ? 1
+                     : kContentSizeSizes[content_size_flag]);
+  bool last_block = false;
+  while (!last_block) {
+    if (pos + 3 > input_len) {
+      return 0;
+    }
+    const uint32_t block_header = input[pos] | (input[pos + 1] << 8) |
+                                  (static_cast<uint32_t>(input[pos + 2]) << 16);
+    pos += 3;
+    last_block = block_header & 1;
+    switch ((block_header >> 1) & 3) {
+      case 1:
+        // RLE block: a single byte repeated
+        pos += 1;
+        break;
+      case 3:
+        return Status::IOError("Corrupt ZSTD compressed data: reserved block type");
+      default:
+        pos += block_header >> 3;
+        break;
+    }
+  }
+  if (has_checksum) {
+    pos += 4;
+  }
+  return pos <= input_len ? pos : 0;
+}
+
 Result<int64_t> ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input,
                                       int64_t output_buffer_len, uint8_t* output_buffer) {
   if (output_buffer == nullptr) {
@@ -199,8 +424,18 @@ Result<int64_t> ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input,
     output_buffer = empty_buffer;
   }
 
-  size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len));
+  ARROW_ASSIGN_OR_RAISE(ZSTD_DCtx * dctx, contexts_->TakeDCtx());
+  ContextPool::Lease<ZSTD_DCtx> lease(contexts_.get(), dctx);
+  size_t ret;
+  if (digested_dictionary_ != NULLPTR) {
+    ret = ZSTD_decompress_usingDDict(dctx, output_buffer,
+                                     static_cast<size_t>(output_buffer_len), input,
+                                     static_cast<size_t>(input_len),
+                                     digested_dictionary_->ddict);
+  } else {
+    ret = ZSTD_decompressDCtx(dctx, output_buffer, static_cast<size_t>(output_buffer_len),
+                              input, static_cast<size_t>(input_len));
+  }
   if (ZSTD_isError(ret)) {
     return ZSTDError(ret, "ZSTD decompression failed: ");
   }
@@ -218,8 +453,18 @@ int64_t ZSTDCodec::MaxCompressedLen(int64_t input_len,
 
 Result<int64_t> ZSTDCodec::Compress(int64_t input_len, const uint8_t* input,
                                     int64_t output_buffer_len, uint8_t* output_buffer) {
-  size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len), input,
-                             static_cast<size_t>(input_len), compression_level_);
+  ARROW_ASSIGN_OR_RAISE(ZSTD_CCtx * cctx, contexts_->TakeCCtx());
+  ContextPool::Lease<ZSTD_CCtx> lease(contexts_.get(), cctx);
+  size_t ret;
+  if (digested_dictionary_ != NULLPTR) {
+    ret = ZSTD_compress_usingCDict(cctx, output_buffer,
+                                   static_cast<size_t>(output_buffer_len), input,
+                                   static_cast<size_t>(input_len),
+                                   digested_dictionary_->cdict);
+  } else {
+    ret = ZSTD_compressCCtx(cctx, output_buffer, static_cast<size_t>(output_buffer_len),
+                            input, static_cast<size_t>(input_len), compression_level_);
+  }
   if (ZSTD_isError(ret)) {
     return ZSTDError(ret, "ZSTD compression failed: ");
   }
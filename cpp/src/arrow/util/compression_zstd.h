@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
@@ -31,10 +32,22 @@ namespace util {
 // XXX level = 1 probably doesn't compress very much
 constexpr int kZSTDDefaultCompressionLevel = 1;
 
+// A dictionary digested for repeated use, defined in compression_zstd.cc
+struct ZSTDDictionary;
+
 // ZSTD codec.
+//
+// Contexts are pooled and reused by the one-shot Compress() and Decompress(),
+// which otherwise spend most of their time setting them up for small inputs.
 class ARROW_EXPORT ZSTDCodec : public Codec {
  public:
-  explicit ZSTDCodec(int compression_level = kZSTDDefaultCompressionLevel);
+  explicit ZSTDCodec(int compression_level = kZSTDDefaultCompressionLevel,
+                     std::shared_ptr<Buffer> dictionary = NULLPTR);
+  ~ZSTDCodec() override;
+
+  // Train a dictionary of at most max_dictionary_size bytes from samples
+  static Result<std::shared_ptr<Buffer>> TrainDictionary(
+      const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size);
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override;
@@ -48,10 +61,19 @@ class ARROW_EXPORT ZSTDCodec : public Codec {
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override;
 
+  Result<int64_t> FrameCompressedLength(int64_t input_len, const uint8_t* input) override;
+
   const char* name() const override { return "zstd"; }
 
  private:
+  Status Init() override;
+
+  class ContextPool;
+
   int compression_level_;
+  std::shared_ptr<Buffer> dictionary_;
+  std::shared_ptr<ZSTDDictionary> digested_dictionary_;
+  std::unique_ptr<ContextPool> contexts_;
 };
 
 }  // namespace util
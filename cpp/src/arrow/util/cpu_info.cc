@@ -118,13 +118,16 @@ static int64_t GetArm64CacheSize(const char* filename, int64_t default_size = -1
 namespace arrow {
 namespace internal {
 
-static struct {
-  std::string name;
+// Plain C strings, so that the table is initialized before any CpuInfo is
+// created from another translation unit's static initializers.
+static const struct {
+  const char* name;
   int64_t flag;
 } flag_mappings[] = {
 #if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
     {"ssse3", CpuInfo::SSSE3},   {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2}, {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},     {"avx512f", CpuInfo::AVX512},
 #endif
 #if defined(__aarch64__)
     {"asimd", CpuInfo::ASIMD},
@@ -235,6 +238,15 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+
+  // Extended features (AVX2 and AVX-512 Foundation)
+  if (highest_valid_id >= 7) {
+    std::bitset<32> features_EBX;
+    __cpuidex(cpu_info.data(), 7, 0);
+    features_EBX = cpu_info[1];
+    if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+    if (features_EBX[16]) *hardware_flags |= CpuInfo::AVX512;
+  }
   return true;
 }
 #endif
@@ -21,15 +21,14 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
-#include <iomanip>
 #include <limits>
 #include <ostream>
-#include <sstream>
 #include <string>
 
 #include "arrow/status.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -44,46 +43,94 @@ Decimal128::Decimal128(const std::string& str) : Decimal128() {
   *this = Decimal128::FromString(str).ValueOrDie();
 }
 
-static const Decimal128 kTenTo36(static_cast<int64_t>(0xC097CE7BC90715),
-                                 0xB34B9F1000000000);
-static const Decimal128 kTenTo18(0xDE0B6B3A7640000);
+constexpr int32_t Decimal128::kMaxStringLength;
 
-std::string Decimal128::ToIntegerString() const {
-  Decimal128 remainder;
-  std::stringstream buf;
-  bool need_fill = false;
+namespace {
 
-  // get anything above 10 ** 36 and print it
-  Decimal128 top;
-  std::tie(top, remainder) = Divide(kTenTo36).ValueOrDie();
+// Divide the unsigned 128-bit integer (high, low) by 10^9 in place and return the
+// remainder, with 64-bit divisions of its 32-bit limbs
+inline uint32_t DivideByBillion(uint64_t* high, uint64_t* low) {
+  constexpr uint64_t kBillion = 1000000000;
+  const uint32_t limbs[4] = {
+      static_cast<uint32_t>(*high >> 32), static_cast<uint32_t>(*high),
+      static_cast<uint32_t>(*low >> 32), static_cast<uint32_t>(*low)};
+  uint32_t quotient[4];
+  uint64_t remainder = 0;
+  for (int i = 0; i < 4; ++i) {
+    const uint64_t current = (remainder << 32) | limbs[i];
+    quotient[i] = static_cast<uint32_t>(current / kBillion);
+    remainder = current % kBillion;
+  }
+  *high = (static_cast<uint64_t>(quotient[0]) << 32) | quotient[1];
+  *low = (static_cast<uint64_t>(quotient[2]) << 32) | quotient[3];
+  return static_cast<uint32_t>(remainder);
+}
 
-  if (top != 0) {
-    buf << static_cast<int64_t>(top);
-    remainder.Abs();
-    need_fill = true;
+// Write the digits of `value` before `end` and return the first character written
+inline char* FormatUInt64Backwards(uint64_t value, char* end) {
+  while (value >= 100) {
+    const char* digit_pair = internal::detail::FormatTwoDigits(value % 100);
+    *--end = digit_pair[1];
+    *--end = digit_pair[0];
+    value /= 100;
   }
+  if (value < 10) {
+    *--end = internal::detail::FormatDigit(value);
+  } else {
+    const char* digit_pair = internal::detail::FormatTwoDigits(value);
+    *--end = digit_pair[1];
+    *--end = digit_pair[0];
+  }
+  return end;
+}
 
-  // now get anything above 10 ** 18 and print it
-  Decimal128 tail;
-  std::tie(top, tail) = remainder.Divide(kTenTo18).ValueOrDie();
+// Same as FormatUInt64Backwards, but always writing 9 digits
+inline char* FormatNineDigitsBackwards(uint32_t value, char* end) {
+  for (int i = 0; i < 4; ++i) {
+    const char* digit_pair = internal::detail::FormatTwoDigits(value % 100);
+    *--end = digit_pair[1];
+    *--end = digit_pair[0];
+    value /= 100;
+  }
+  *--end = internal::detail::FormatDigit(value);
+  return end;
+}
 
-  if (need_fill || top != 0) {
-    if (need_fill) {
-      buf << std::setw(18) << std::setfill('0');
-    } else {
-      need_fill = true;
-      tail.Abs();
-    }
+}  // namespace
+
+int32_t Decimal128::ToIntegerString(char* out) const {
+  // The magnitude as an unsigned integer, which also holds the magnitude of the
+  // smallest value
+  uint64_t high = static_cast<uint64_t>(high_bits());
+  uint64_t low = low_bits();
+  const bool is_negative = high_bits() < 0;
+  if (is_negative) {
+    high = ~high + (low == 0);
+    low = ~low + 1;
+  }
 
-    buf << static_cast<int64_t>(top);
+  // 39 digits at most
+  char buffer[40];
+  char* end = buffer + sizeof(buffer);
+  char* begin = end;
+  // Peel off groups of 9 digits until the rest fits in 64 bits
+  while (high != 0) {
+    begin = FormatNineDigitsBackwards(DivideByBillion(&high, &low), begin);
   }
+  begin = FormatUInt64Backwards(low, begin);
 
-  // finally print the tail, which is less than 10**18
-  if (need_fill) {
-    buf << std::setw(18) << std::setfill('0');
+  char* pos = out;
+  if (is_negative) {
+    *pos++ = '-';
   }
-  buf << static_cast<int64_t>(tail);
-  return buf.str();
+  std::memcpy(pos, begin, static_cast<size_t>(end - begin));
+  pos += end - begin;
+  return static_cast<int32_t>(pos - out);
+}
+
+std::string Decimal128::ToIntegerString() const {
+  char buffer[kMaxStringLength];
+  return std::string(buffer, static_cast<size_t>(ToIntegerString(buffer)));
 }
 
 Decimal128::operator int64_t() const {
@@ -94,64 +141,59 @@ Decimal128::operator int64_t() const {
   return static_cast<int64_t>(low_bits());
 }
 
-static std::string ToStringNegativeScale(const std::string& str,
-                                         int32_t adjusted_exponent, bool is_negative) {
-  std::stringstream buf;
-
-  size_t offset = 0;
-  buf << str[offset++];
-
-  if (is_negative) {
-    buf << str[offset++];
-  }
-
-  buf << '.' << str.substr(offset, std::string::npos) << 'E' << std::showpos
-      << adjusted_exponent;
-  return buf.str();
-}
-
-std::string Decimal128::ToString(int32_t scale) const {
-  const std::string str(ToIntegerString());
+int32_t Decimal128::ToString(int32_t scale, char* out) const {
+  char buffer[kMaxStringLength];
+  const int32_t len = ToIntegerString(buffer);
 
   if (scale == 0) {
-    return str;
+    std::memcpy(out, buffer, static_cast<size_t>(len));
+    return len;
   }
 
-  const bool is_negative = *this < 0;
-
-  const auto len = static_cast<int32_t>(str.size());
-  const auto is_negative_offset = static_cast<int32_t>(is_negative);
-  const int32_t adjusted_exponent = -scale + (len - 1 - is_negative_offset);
-
-  /// Note that the -6 is taken from the Java BigDecimal documentation.
-  if (scale < 0 || adjusted_exponent < -6) {
-    return ToStringNegativeScale(str, adjusted_exponent, is_negative);
-  }
+  const bool is_negative = buffer[0] == '-';
+  const char* digits = buffer + is_negative;
+  const int32_t num_digits = len - is_negative;
+  const int64_t adjusted_exponent = -static_cast<int64_t>(scale) + (num_digits - 1);
 
+  char* pos = out;
   if (is_negative) {
-    if (len - 1 > scale) {
-      const auto n = static_cast<size_t>(len - scale);
-      return str.substr(0, n) + "." + str.substr(n, static_cast<size_t>(scale));
-    }
-
-    if (len - 1 == scale) {
-      return "-0." + str.substr(1, std::string::npos);
-    }
-
-    std::string result("-0." + std::string(static_cast<size_t>(scale - len + 1), '0'));
-    return result + str.substr(1, std::string::npos);
-  }
-
-  if (len > scale) {
-    const auto n = static_cast<size_t>(len - scale);
-    return str.substr(0, n) + "." + str.substr(n, static_cast<size_t>(scale));
+    *pos++ = '-';
   }
+  auto append = [&pos](const char* data, int32_t size) {
+    std::memcpy(pos, data, static_cast<size_t>(size));
+    pos += size;
+  };
 
-  if (len == scale) {
-    return "0." + str;
+  /// Note that the -6 is taken from the Java BigDecimal documentation.
+  if (scale < 0 || adjusted_exponent < -6) {
+    // Scientific notation, e.g. 1.234E+5
+    append(digits, 1);
+    *pos++ = '.';
+    append(digits + 1, num_digits - 1);
+    *pos++ = 'E';
+    *pos++ = adjusted_exponent < 0 ? '-' : '+';
+    char exponent[20];
+    char* exponent_end = exponent + sizeof(exponent);
+    char* exponent_begin = FormatUInt64Backwards(
+        static_cast<uint64_t>(std::abs(adjusted_exponent)), exponent_end);
+    append(exponent_begin, static_cast<int32_t>(exponent_end - exponent_begin));
+  } else if (num_digits > scale) {
+    append(digits, num_digits - scale);
+    *pos++ = '.';
+    append(digits + num_digits - scale, scale);
+  } else {
+    *pos++ = '0';
+    *pos++ = '.';
+    std::memset(pos, '0', static_cast<size_t>(scale - num_digits));
+    pos += scale - num_digits;
+    append(digits, num_digits);
   }
+  return static_cast<int32_t>(pos - out);
+}
 
-  return "0." + std::string(static_cast<size_t>(scale - len), '0') + str;
+std::string Decimal128::ToString(int32_t scale) const {
+  char buffer[kMaxStringLength];
+  return std::string(buffer, static_cast<size_t>(ToString(scale, buffer)));
 }
 
 static constexpr auto kInt64DecimalDigits =
@@ -176,16 +218,41 @@ static constexpr int64_t kPowersOfTen[kInt64DecimalDigits + 1] = {1LL,
                                                                   100000000000000000LL,
                                                                   1000000000000000000LL};
 
+// Parse 8 digits at once, with the SWAR method of "Fast numeric string to int"
+// (Johnny Lee, 2017)
+static inline uint64_t ParseEightDigits(const char* data) {
+  uint64_t chunk;
+  std::memcpy(&chunk, data, sizeof(chunk));
+  chunk = BitUtil::FromLittleEndian(chunk) - 0x3030303030303030ULL;
+  // Combine pairs of digits in each 16-bit lane, then pairs of those
+  chunk = (chunk * 10) + (chunk >> 8);
+  chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+           (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+          32;
+  return chunk;
+}
+
+// Parse at most kInt64DecimalDigits digits, which were already validated
+static inline uint64_t ParseDigits(const char* data, size_t length) {
+  uint64_t value = 0;
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    value = value * 100000000 + ParseEightDigits(data + i);
+  }
+  for (; i < length; ++i) {
+    value = value * 10 + static_cast<uint64_t>(data[i] - '0');
+  }
+  return value;
+}
+
 // Iterates over data and for each group of kInt64DecimalDigits multiple out by
 // the appropriate power of 10 necessary to add source parsed as uint64 and
 // then adds the parsed value of source.
 static inline void ShiftAndAdd(const char* data, size_t length, Decimal128* out) {
-  internal::StringConverter<Int64Type> converter;
   for (size_t posn = 0; posn < length;) {
     const size_t group_size = std::min(kInt64DecimalDigits, length - posn);
     const int64_t multiple = kPowersOfTen[group_size];
-    int64_t chunk = 0;
-    ARROW_CHECK(converter(data + posn, group_size, &chunk));
+    const auto chunk = static_cast<int64_t>(ParseDigits(data + posn, group_size));
 
     *out *= multiple;
     *out += chunk;
@@ -204,6 +271,15 @@ static void StringToInteger(const util::string_view whole_digits,
   DCHECK_GT(whole_digits.size() + fractional_digits.size(), 0)
       << "length of parsed decimal string should be greater than 0";
 
+  if (whole_digits.size() + fractional_digits.size() <= kInt64DecimalDigits) {
+    // All the digits fit in an int64_t, avoid 128-bit multiplications
+    const uint64_t value =
+        ParseDigits(whole_digits.data(), whole_digits.size()) *
+            kPowersOfTen[fractional_digits.size()] +
+        ParseDigits(fractional_digits.data(), fractional_digits.size());
+    *out = static_cast<int64_t>(value);
+    return;
+  }
   ShiftAndAdd(whole_digits.data(), whole_digits.length(), out);
   ShiftAndAdd(fractional_digits.data(), fractional_digits.length(), out);
 }
@@ -373,6 +449,47 @@ Status Decimal128::FromString(const char* s, Decimal128* out) {
   return FromString(s, out, nullptr, nullptr);
 }
 
+Status Decimal128::FromStrings(const int32_t* offsets, const uint8_t* data,
+                               const uint8_t* null_bitmap, int64_t null_bitmap_offset,
+                               int64_t length, int32_t precision, int32_t scale,
+                               Decimal128* out) {
+  if (precision < 1 || precision > 38) {
+    return Status::Invalid("Decimal precision out of range: ", precision);
+  }
+  // Values must be strictly less than 10^precision in absolute value
+  const Decimal128 bound = GetScaleMultiplier(precision);
+
+  internal::BitmapReader null_reader(null_bitmap, null_bitmap_offset,
+                                     null_bitmap != nullptr ? length : 0);
+  for (int64_t i = 0; i < length; ++i) {
+    if (null_bitmap != nullptr) {
+      const bool is_valid = null_reader.IsSet();
+      null_reader.Next();
+      if (!is_valid) {
+        out[i] = 0;
+        continue;
+      }
+    }
+    const util::string_view s(reinterpret_cast<const char*>(data + offsets[i]),
+                              static_cast<size_t>(offsets[i + 1] - offsets[i]));
+    Decimal128 value;
+    int32_t value_precision, value_scale;
+    RETURN_NOT_OK(FromString(s, &value, &value_precision, &value_scale));
+    if (value_scale != scale) {
+      if (std::abs(scale - value_scale) > 38) {
+        return Status::Invalid("Cannot rescale '", s, "' to scale ", scale);
+      }
+      ARROW_ASSIGN_OR_RAISE(value, value.Rescale(value_scale, scale));
+    }
+    if (value >= bound || value <= -bound) {
+      return Status::Invalid("Decimal value '", s, "' does not fit in precision ",
+                             precision);
+    }
+    out[i] = value;
+  }
+  return Status::OK();
+}
+
 // Helper function used by Decimal128::FromBigEndian
 static inline uint64_t UInt64FromBigEndian(const uint8_t* bytes, int32_t length) {
   // We don't bounds check the length here because this is called by
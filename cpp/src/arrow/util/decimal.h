@@ -100,13 +100,27 @@ class ARROW_EXPORT Decimal128 : public BasicDecimal128 {
     return Status::OK();
   }
 
+  /// \brief The maximum length of the strings written by ToString(int32_t, char*)
+  /// and ToIntegerString(char*).
+  static constexpr int32_t kMaxStringLength = 64;
+
   /// \brief Convert the Decimal128 value to a base 10 decimal string with the given
   /// scale.
   std::string ToString(int32_t scale) const;
 
+  /// \brief Write the base 10 decimal string with the given scale to `out`, which
+  /// must have room for kMaxStringLength characters, without allocating.
+  /// \return the number of characters written (no null terminator is written)
+  int32_t ToString(int32_t scale, char* out) const;
+
   /// \brief Convert the value to an integer string
   std::string ToIntegerString() const;
 
+  /// \brief Write the integer string of the value to `out`, which must have room for
+  /// kMaxStringLength characters, without allocating.
+  /// \return the number of characters written (no null terminator is written)
+  int32_t ToIntegerString(char* out) const;
+
   /// \brief Cast this value to an int64_t.
   explicit operator int64_t() const;
 
@@ -122,6 +136,19 @@ class ARROW_EXPORT Decimal128 : public BasicDecimal128 {
   static Result<Decimal128> FromString(const std::string& s);
   static Result<Decimal128> FromString(const char* s);
 
+  /// \brief Convert the `length` strings of a string array to decimals of the given
+  /// precision and scale, e.g. for a column of type decimal(precision, scale).
+  ///
+  /// String i spans data[offsets[i]:offsets[i + 1]], e.g. for a StringArray,
+  /// `raw_value_offsets()` and `value_data()->data()`, with `null_bitmap_data()` and
+  /// `offset()` as the null bitmap.  Values are rescaled to `scale` and must have at
+  /// most `precision` digits after rescaling.  If `null_bitmap` isn't null, the
+  /// strings of null entries are ignored and their output is set to 0.
+  static Status FromStrings(const int32_t* offsets, const uint8_t* data,
+                            const uint8_t* null_bitmap, int64_t null_bitmap_offset,
+                            int64_t length, int32_t precision, int32_t scale,
+                            Decimal128* out);
+
   ARROW_DEPRECATED("Use Result-returning version")
   static Status FromString(const util::string_view& s, Decimal128* out);
   ARROW_DEPRECATED("Use Result-returning version")
@@ -17,9 +17,12 @@
 
 #include "benchmark/benchmark.h"
 
+#include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "arrow/testing/gtest_util.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/macros.h"
 
@@ -44,6 +47,81 @@ static void FromString(benchmark::State& state) {  // NOLINT non-const reference
   state.SetItemsProcessed(state.iterations() * values.size());
 }
 
+static std::vector<std::string> MakeDecimalStrings(int64_t num_values,
+                                                   int32_t whole_digits,
+                                                   int32_t fractional_digits) {
+  std::mt19937_64 gen(42);
+  std::vector<std::string> values;
+  for (int64_t i = 0; i < num_values; ++i) {
+    std::string value = (i % 3 == 0) ? "-" : "";
+    for (int32_t j = 0; j < whole_digits + fractional_digits; ++j) {
+      if (j == whole_digits) {
+        value += '.';
+      }
+      value += static_cast<char>('0' + gen() % 10);
+    }
+    values.push_back(std::move(value));
+  }
+  return values;
+}
+
+// Parse and format decimals with a short (9, 2) or a long (30, 8) precision, as in
+// typical CSV or Parquet decimal columns
+static void FromStringBatch(benchmark::State& state) {  // NOLINT non-const reference
+  const auto precision = static_cast<int32_t>(state.range(0));
+  const int32_t scale = precision > 18 ? 8 : 2;
+  const auto values = MakeDecimalStrings(1000, precision - scale, scale);
+  std::string data;
+  std::vector<int32_t> offsets = {0};
+  for (const auto& value : values) {
+    data += value;
+    offsets.push_back(static_cast<int32_t>(data.size()));
+  }
+  std::vector<Decimal128> out(values.size());
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Decimal128::FromStrings(
+        offsets.data(), reinterpret_cast<const uint8_t*>(data.data()), nullptr, 0,
+        static_cast<int64_t>(values.size()), precision, scale, out.data()));
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static void ToStringBatch(benchmark::State& state) {  // NOLINT non-const reference
+  const auto precision = static_cast<int32_t>(state.range(0));
+  const int32_t scale = precision > 18 ? 8 : 2;
+  std::vector<Decimal128> values;
+  for (const auto& value : MakeDecimalStrings(1000, precision - scale, scale)) {
+    values.push_back(Decimal128(value));
+  }
+  char buffer[Decimal128::kMaxStringLength];
+
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      benchmark::DoNotOptimize(value.ToString(scale, buffer));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void ToStringAllocating(benchmark::State& state) {  // NOLINT non-const reference
+  const auto precision = static_cast<int32_t>(state.range(0));
+  const int32_t scale = precision > 18 ? 8 : 2;
+  std::vector<Decimal128> values;
+  for (const auto& value : MakeDecimalStrings(1000, precision - scale, scale)) {
+    values.push_back(Decimal128(value));
+  }
+
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      benchmark::DoNotOptimize(value.ToString(scale));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
 constexpr int32_t kValueSize = 10;
 
 static void BinaryCompareOp(benchmark::State& state) {  // NOLINT non-const reference
@@ -158,6 +236,9 @@ static void BinaryBitOp(benchmark::State& state) {  // NOLINT non-const referenc
 }
 
 BENCHMARK(FromString);
+BENCHMARK(FromStringBatch)->Arg(9)->Arg(30);
+BENCHMARK(ToStringBatch)->Arg(9)->Arg(30);
+BENCHMARK(ToStringAllocating)->Arg(9)->Arg(30);
 BENCHMARK(BinaryMathOp);
 BENCHMARK(BinaryMathOpAggregate);
 BENCHMARK(BinaryCompareOp);
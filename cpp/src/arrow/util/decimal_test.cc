@@ -19,6 +19,7 @@
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <random>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -279,6 +280,93 @@ TEST(Decimal128Test, PrintMinValue) {
   ASSERT_EQ(string_value, printed_value);
 }
 
+TEST(Decimal128Test, PrintIntoBuffer) {
+  // Compare against boost with values of all magnitudes
+  std::mt19937_64 gen(42);
+  char buffer[Decimal128::kMaxStringLength];
+  for (int i = 0; i < 2000; ++i) {
+    const int shift = i % 128;
+    const auto high = static_cast<int64_t>(gen());
+    const uint64_t low = gen();
+    Decimal128 value(high, low);
+    value >>= shift;
+    const int128_t expected = static_cast<int128_t>(value.high_bits()) *
+                                  (static_cast<int128_t>(1) << 64) +
+                              value.low_bits();
+    const int32_t size = value.ToIntegerString(buffer);
+    ASSERT_EQ(expected.str(), std::string(buffer, size));
+
+    // Round trip with a scale
+    const int32_t scale = i % 40;
+    const std::string formatted = value.ToString(scale);
+    ASSERT_EQ(formatted, std::string(buffer, value.ToString(scale, buffer)));
+    Decimal128 parsed;
+    int32_t parsed_precision, parsed_scale;
+    ASSERT_OK(
+        Decimal128::FromString(formatted, &parsed, &parsed_precision, &parsed_scale));
+    if (parsed_scale != scale) {
+      ASSERT_OK_AND_ASSIGN(parsed, parsed.Rescale(parsed_scale, scale));
+    }
+    ASSERT_EQ(value, parsed) << formatted;
+  }
+}
+
+TEST(Decimal128Test, ParseAroundInt64Digits) {
+  // Values with up to 18 digits are parsed without 128-bit arithmetic
+  for (const std::string digits :
+       {"12345678901234567", "123456789012345678", "1234567890123456789",
+        "99999999999999999999999"}) {
+    for (size_t dot = 0; dot <= digits.size(); ++dot) {
+      const std::string s = digits.substr(0, dot) + "." + digits.substr(dot);
+      Decimal128 value;
+      int32_t precision, scale;
+      ASSERT_OK(Decimal128::FromString(s, &value, &precision, &scale));
+      ASSERT_EQ(digits, value.ToIntegerString()) << s;
+      ASSERT_EQ(static_cast<int32_t>(digits.size() - dot), scale);
+      ASSERT_OK(Decimal128::FromString("-" + s, &value, &precision, &scale));
+      ASSERT_EQ("-" + digits, value.ToIntegerString()) << s;
+    }
+  }
+}
+
+TEST(Decimal128Test, FromStrings) {
+  const std::vector<std::string> strings = {"1.5", "-2", "", "0.125", "1E2", "xyz"};
+  std::string data;
+  std::vector<int32_t> offsets = {0};
+  for (const auto& s : strings) {
+    data += s;
+    offsets.push_back(static_cast<int32_t>(data.size()));
+  }
+  const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+  // Entries 2 and 5 are null
+  const uint8_t null_bitmap[] = {0x1b};
+  std::vector<Decimal128> out(strings.size(), Decimal128(42));
+
+  ASSERT_OK(Decimal128::FromStrings(offsets.data(), raw_data, null_bitmap, 0,
+                                    strings.size(), 6, 3, out.data()));
+  const std::vector<Decimal128> expected = {1500, -2000, 0, 125, 100000, 0};
+  ASSERT_EQ(expected, out);
+
+  // With an offset into the bitmap
+  const uint8_t shifted_bitmap[] = {0x60};
+  ASSERT_OK(Decimal128::FromStrings(offsets.data() + 3, raw_data, shifted_bitmap, 5, 2,
+                                    6, 3, out.data()));
+  ASSERT_EQ(Decimal128(125), out[0]);
+  ASSERT_EQ(Decimal128(100000), out[1]);
+
+  // Without a null bitmap, the empty string is an error
+  ASSERT_RAISES(Invalid, Decimal128::FromStrings(offsets.data(), raw_data, nullptr, 0,
+                                                 strings.size(), 6, 3, out.data()));
+  // Too many digits for the precision after rescaling
+  ASSERT_RAISES(Invalid, Decimal128::FromStrings(offsets.data(), raw_data, null_bitmap,
+                                                 0, 5, 5, 3, out.data()));
+  // Rescaling would lose data
+  ASSERT_RAISES(Invalid, Decimal128::FromStrings(offsets.data(), raw_data, null_bitmap,
+                                                 0, 4, 6, 2, out.data()));
+  ASSERT_RAISES(Invalid, Decimal128::FromStrings(offsets.data(), raw_data, null_bitmap,
+                                                 0, 1, 39, 0, out.data()));
+}
+
 class Decimal128PrintingTest
     : public ::testing::TestWithParam<std::tuple<int32_t, int32_t, std::string>> {};
 
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/dispatch.h"
+
+#include <string>
+
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// The level set by the ARROW_USER_SIMD_LEVEL environment variable, or MAX
+DispatchLevel UserDispatchLevel() {
+  static const DispatchLevel level = [] {
+    auto maybe_value = GetEnvVar("ARROW_USER_SIMD_LEVEL");
+    if (!maybe_value.ok()) {
+      return DispatchLevel::MAX;
+    }
+    const std::string value = *std::move(maybe_value);
+    if (value == "NONE") {
+      return DispatchLevel::NONE;
+    } else if (value == "SSE4_2") {
+      return DispatchLevel::SSE4_2;
+    } else if (value == "AVX2") {
+      return DispatchLevel::AVX2;
+    } else if (value == "AVX512") {
+      return DispatchLevel::AVX512;
+    } else if (value != "MAX" && !value.empty()) {
+      ARROW_LOG(WARNING) << "Invalid value for ARROW_USER_SIMD_LEVEL: " << value;
+    }
+    return DispatchLevel::MAX;
+  }();
+  return level;
+}
+
+}  // namespace
+
+bool IsDispatchLevelSupported(DispatchLevel level) {
+  if (level == DispatchLevel::NONE) {
+    return true;
+  }
+  const auto user_level = UserDispatchLevel();
+  const auto cpu_info = CpuInfo::GetInstance();
+  switch (level) {
+    case DispatchLevel::SSE4_2:
+      return user_level >= level && cpu_info->IsSupported(CpuInfo::SSE4_2);
+    case DispatchLevel::AVX2:
+      return user_level >= level && cpu_info->IsSupported(CpuInfo::AVX2);
+    case DispatchLevel::AVX512:
+      return user_level >= level && cpu_info->IsSupported(CpuInfo::AVX512);
+    case DispatchLevel::NEON:
+      // Capping to any x86 level disables NEON as well
+      return user_level == DispatchLevel::MAX && cpu_info->IsSupported(CpuInfo::ASIMD);
+    default:
+      return false;
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Runtime selection among implementations compiled for several instruction
+// sets.
+//
+// Translation units suffixed with an instruction set (e.g. bpacking_avx2.cc)
+// are compiled with the corresponding compiler flag when the compiler
+// supports it and the ARROW_RUNTIME_SIMD_LEVEL build option allows it, which
+// defines ARROW_HAVE_RUNTIME_<LEVEL>.  The code calling into them lists the
+// implementations available in the build, and DynamicDispatch picks the most
+// capable one the CPU supports, once.
+//
+// The ARROW_USER_SIMD_LEVEL environment variable (NONE, SSE4_2, AVX2 or
+// AVX512) caps the selected level, e.g. to compare implementations.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Instruction set levels implementations can be compiled for
+///
+/// x86 levels are ordered by capability.  NEON is the only Arm level.
+enum class DispatchLevel : int { NONE = 0, SSE4_2, AVX2, AVX512, NEON, MAX };
+
+/// \brief Return whether implementations of the given level may run
+///
+/// The CPU must support the instruction set, and the level must not exceed
+/// the one set by ARROW_USER_SIMD_LEVEL.  NONE is always supported.
+ARROW_EXPORT
+bool IsDispatchLevelSupported(DispatchLevel level);
+
+/// \brief Select the best implementation of a function for the running CPU
+///
+/// `DynamicFunction` must declare a `FunctionType` (usually a function pointer
+/// type) and a static `implementations()` method returning the available
+/// (DispatchLevel, FunctionType) pairs, including one of level NONE.  For
+/// instance:
+///
+/// \code
+/// struct UnpackDynamicFunction {
+///   using FunctionType = decltype(&unpack32_default);
+///
+///   static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+///     return {{DispatchLevel::NONE, unpack32_default}
+/// #if defined(ARROW_HAVE_RUNTIME_AVX2)
+///             , {DispatchLevel::AVX2, unpack32_avx2}
+/// #endif
+///     };
+///   }
+/// };
+///
+/// int unpack32(...) {
+///   static DynamicDispatch<UnpackDynamicFunction> dispatch;
+///   return dispatch.func(...);
+/// }
+/// \endcode
+template <typename DynamicFunction>
+class DynamicDispatch {
+ public:
+  using FunctionType = typename DynamicFunction::FunctionType;
+  using Implementation = std::pair<DispatchLevel, FunctionType>;
+
+  DynamicDispatch() { Resolve(DynamicFunction::implementations()); }
+
+  /// The selected implementation
+  FunctionType func = {};
+
+  /// The level of the selected implementation
+  DispatchLevel level = DispatchLevel::NONE;
+
+ private:
+  void Resolve(const std::vector<Implementation>& implementations) {
+    bool found = false;
+    for (const auto& impl : implementations) {
+      if ((!found || impl.first >= level) && IsDispatchLevelSupported(impl.first)) {
+        func = impl.second;
+        level = impl.first;
+        found = true;
+      }
+    }
+    if (!found) {
+      Status::Invalid("No implementation of a dynamically dispatched function")
+          .Abort();
+    }
+  }
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+int ReturnNone() { return 0; }
+int ReturnSse42() { return 1; }
+int ReturnAvx2() { return 2; }
+int ReturnAvx512() { return 3; }
+
+struct OnlyNoneFunction {
+  using FunctionType = int (*)();
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, ReturnNone}};
+  }
+};
+
+// Implementations deliberately listed out of order
+struct X86Function {
+  using FunctionType = int (*)();
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::AVX2, ReturnAvx2},
+            {DispatchLevel::NONE, ReturnNone},
+            {DispatchLevel::AVX512, ReturnAvx512},
+            {DispatchLevel::SSE4_2, ReturnSse42}};
+  }
+};
+
+TEST(DynamicDispatch, OnlyNone) {
+  ASSERT_TRUE(IsDispatchLevelSupported(DispatchLevel::NONE));
+  DynamicDispatch<OnlyNoneFunction> dispatch;
+  ASSERT_EQ(dispatch.level, DispatchLevel::NONE);
+  ASSERT_EQ(dispatch.func(), 0);
+}
+
+TEST(DynamicDispatch, BestSupported) {
+  DispatchLevel expected_level = DispatchLevel::NONE;
+  int expected_result = 0;
+  const std::vector<DispatchLevel> levels = {
+      DispatchLevel::SSE4_2, DispatchLevel::AVX2, DispatchLevel::AVX512};
+  for (size_t i = 0; i < levels.size(); ++i) {
+    if (IsDispatchLevelSupported(levels[i])) {
+      expected_level = levels[i];
+      expected_result = static_cast<int>(i) + 1;
+    }
+  }
+
+  DynamicDispatch<X86Function> dispatch;
+  ASSERT_EQ(dispatch.level, expected_level);
+  ASSERT_EQ(dispatch.func(), expected_result);
+}
+
+}  // namespace internal
+}  // namespace arrow
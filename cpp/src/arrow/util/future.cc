@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/future.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+class ConcreteFutureImpl : public FutureImpl {
+ public:
+  void DoMarkFinished() { DoMarkFinishedOrFailed(FutureState::SUCCESS); }
+
+  void DoMarkFailed() { DoMarkFinishedOrFailed(FutureState::FAILURE); }
+
+  void DoAddCallback(Callback callback) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (IsFutureFinished(state_)) {
+      lock.unlock();
+      callback(*this);
+    } else {
+      callbacks_.push_back(std::move(callback));
+    }
+  }
+
+  void DoWait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return IsFutureFinished(state_); });
+  }
+
+  bool DoWait(double seconds) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait_for(lock, std::chrono::duration<double>(seconds),
+                 [this] { return IsFutureFinished(state_); });
+    return IsFutureFinished(state_);
+  }
+
+ protected:
+  void DoMarkFinishedOrFailed(FutureState state) {
+    std::vector<Callback> callbacks;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      DCHECK(!IsFutureFinished(state_)) << "Future already marked finished";
+      state_ = state;
+      callbacks.swap(callbacks_);
+      cv_.notify_all();
+    }
+    // Run callbacks outside of the lock, so that they may add callbacks
+    // or wait on other futures.  Since the state is finished, no other
+    // callbacks can be added to `callbacks_` from now on.
+    for (auto& callback : callbacks) {
+      callback(*this);
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<Callback> callbacks_;
+};
+
+namespace {
+
+ConcreteFutureImpl* GetConcreteFuture(FutureImpl* future) {
+  return static_cast<ConcreteFutureImpl*>(future);
+}
+
+}  // namespace
+
+FutureImpl::FutureImpl() = default;
+
+std::unique_ptr<FutureImpl> FutureImpl::Make() {
+  return std::unique_ptr<FutureImpl>(new ConcreteFutureImpl());
+}
+
+std::unique_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
+  std::unique_ptr<ConcreteFutureImpl> ptr(new ConcreteFutureImpl());
+  ptr->state_ = state;
+  return std::move(ptr);
+}
+
+void FutureImpl::MarkFinished() { GetConcreteFuture(this)->DoMarkFinished(); }
+
+void FutureImpl::MarkFailed() { GetConcreteFuture(this)->DoMarkFailed(); }
+
+void FutureImpl::Wait() { GetConcreteFuture(this)->DoWait(); }
+
+bool FutureImpl::Wait(double seconds) { return GetConcreteFuture(this)->DoWait(seconds); }
+
+void FutureImpl::AddCallback(Callback callback) {
+  GetConcreteFuture(this)->DoAddCallback(std::move(callback));
+}
+
+Future<> AllComplete(const std::vector<Future<>>& futures) {
+  return All(futures).Then([](const std::vector<Result<detail::Empty>>& results) {
+    for (const auto& result : results) {
+      if (!result.ok()) {
+        return result.status();
+      }
+    }
+    return Status::OK();
+  });
+}
+
+}  // namespace arrow
@@ -0,0 +1,468 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+namespace detail {
+
+// Value type of Future<> (a future without a value, only a Status)
+struct Empty {};
+
+}  // namespace detail
+
+template <typename T = detail::Empty>
+class Future;
+
+enum class FutureState : int8_t { PENDING, SUCCESS, FAILURE };
+
+inline bool IsFutureFinished(FutureState state) { return state != FutureState::PENDING; }
+
+// ---------------------------------------------------------------------
+// Type-erased helpers
+
+/// \brief Type-erased state shared by all copies of a Future
+///
+/// Not for direct use, see Future<T>.
+class ARROW_EXPORT FutureImpl {
+ public:
+  using Callback = std::function<void(const FutureImpl&)>;
+
+  virtual ~FutureImpl() = default;
+
+  FutureState state() const { return state_.load(); }
+
+  static std::unique_ptr<FutureImpl> Make();
+  static std::unique_ptr<FutureImpl> MakeFinished(FutureState state);
+
+  // Future API
+  void MarkFinished();
+  void MarkFailed();
+  void Wait();
+  bool Wait(double seconds);
+
+  // Run the callback once the future is finished.  If it has already
+  // finished, the callback is run immediately in the calling thread.
+  // Otherwise, it is run in the thread marking the future finished.
+  void AddCallback(Callback callback);
+
+  // Type-erased storage for the Result<T> of a Future<T>
+  std::unique_ptr<void, void (*)(void*)> result_{NULLPTR, NULLPTR};
+
+ protected:
+  FutureImpl();
+  ARROW_DISALLOW_COPY_AND_ASSIGN(FutureImpl);
+
+  std::atomic<FutureState> state_{FutureState::PENDING};
+};
+
+namespace detail {
+
+template <typename Signature>
+using result_of_t = typename std::result_of<Signature>::type;
+
+template <typename T>
+struct is_future : std::false_type {};
+
+template <typename T>
+struct is_future<Future<T>> : std::true_type {};
+
+// Compute the Future type returned by Then() and ThreadPool::Submit()
+// for a continuation returning `Return`:
+// - void and Status give a Future<>
+// - Result<T> and Future<T> give a Future<T>
+// - any other T gives a Future<T>
+template <typename Return>
+struct ContinuedFutureImpl {
+  using type = Future<Return>;
+};
+
+template <>
+struct ContinuedFutureImpl<void> {
+  using type = Future<>;
+};
+
+template <>
+struct ContinuedFutureImpl<Status> {
+  using type = Future<>;
+};
+
+template <typename T>
+struct ContinuedFutureImpl<Result<T>> {
+  using type = Future<T>;
+};
+
+template <typename T>
+struct ContinuedFutureImpl<Future<T>> {
+  using type = Future<T>;
+};
+
+// Call a function and mark the `next` future finished with its outcome
+struct ContinueFuture {
+  template <typename Return>
+  using ForReturn = typename ContinuedFutureImpl<Return>::type;
+
+  template <typename Signature>
+  using ForSignature = ForReturn<result_of_t<Signature>>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  typename std::enable_if<
+      std::is_void<result_of_t<ContinueFunc && (Args && ...)>>::value>::type
+  operator()(NextFuture next, ContinueFunc&& f, Args&&... a) const {
+    std::forward<ContinueFunc>(f)(std::forward<Args>(a)...);
+    next.MarkFinished();
+  }
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  typename std::enable_if<
+      is_future<result_of_t<ContinueFunc && (Args && ...)>>::value>::type
+  operator()(NextFuture next, ContinueFunc&& f, Args&&... a) const {
+    using InnerFuture = result_of_t<ContinueFunc && (Args && ...)>;
+    using ValueType = typename InnerFuture::ValueType;
+    InnerFuture signal = std::forward<ContinueFunc>(f)(std::forward<Args>(a)...);
+    signal.AddCallback(
+        [next](const Result<ValueType>& result) mutable { next.MarkFinished(result); });
+  }
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  typename std::enable_if<
+      !std::is_void<result_of_t<ContinueFunc && (Args && ...)>>::value &&
+      !is_future<result_of_t<ContinueFunc && (Args && ...)>>::value>::type
+  operator()(NextFuture next, ContinueFunc&& f, Args&&... a) const {
+    next.MarkFinished(std::forward<ContinueFunc>(f)(std::forward<Args>(a)...));
+  }
+};
+
+// How Then() calls its success callback: with the value for a Future<T>,
+// without arguments for a Future<>
+template <typename T>
+struct OnSuccessCaller {
+  template <typename OnSuccess>
+  using ResultOf = result_of_t<OnSuccess && (const T&)>;
+
+  template <typename NextFuture, typename OnSuccess>
+  static void Call(NextFuture next, OnSuccess&& on_success, const Result<T>& result) {
+    ContinueFuture{}(std::move(next), std::forward<OnSuccess>(on_success),
+                     result.ValueUnsafe());
+  }
+};
+
+template <>
+struct OnSuccessCaller<Empty> {
+  template <typename OnSuccess>
+  using ResultOf = result_of_t<OnSuccess && ()>;
+
+  template <typename NextFuture, typename OnSuccess>
+  static void Call(NextFuture next, OnSuccess&& on_success, const Result<Empty>&) {
+    ContinueFuture{}(std::move(next), std::forward<OnSuccess>(on_success));
+  }
+};
+
+// Default failure callback for Then(): forward the error
+template <typename NextFuture>
+struct PassthruOnFailure {
+  Result<typename NextFuture::ValueType> operator()(const Status& status) const {
+    return status;
+  }
+};
+
+}  // namespace detail
+
+// ---------------------------------------------------------------------
+// Public API
+
+/// \brief A Future's execution or completion status
+///
+/// A Future<T> is a handle to a Result<T> that may not be available yet.
+/// All copies of a Future share the same state.  A Future is marked finished
+/// (exactly once) by its producer, e.g. a thread pool task or an I/O
+/// completion.
+///
+/// Consumers can either block with Wait() / result(), or register callbacks
+/// with AddCallback() and Then() so that work is triggered on completion
+/// without parking a thread.
+///
+/// Future<> (i.e. Future<detail::Empty>) carries only a Status.
+template <typename T>
+class Future {
+ public:
+  using ValueType = T;
+
+  // The default constructor creates an invalid Future.  Use Future::Make()
+  // for a valid Future.  This constructor is mostly for the convenience
+  // of being able to presize a vector of Futures.
+  Future() = default;
+
+  /// \brief Whether the Future is valid (i.e. not default-constructed)
+  bool is_valid() const { return impl_ != NULLPTR; }
+
+  /// \brief Return the Future's current state
+  ///
+  /// A return value of PENDING is only indicative, as the Future can complete
+  /// concurrently.  A return value of FAILURE or SUCCESS is definitive, though.
+  FutureState state() const {
+    CheckValid();
+    return impl_->state();
+  }
+
+  /// \brief Whether the Future is finished
+  ///
+  /// A false return value is only indicative, as the Future can complete
+  /// concurrently.  A true return value is definitive, though.
+  bool is_finished() const {
+    CheckValid();
+    return IsFutureFinished(impl_->state());
+  }
+
+  /// \brief Wait for the Future to complete and return its Result
+  const Result<ValueType>& result() const& {
+    Wait();
+    return *GetResult();
+  }
+
+  /// \brief Wait for the Future to complete and move its Result out
+  ///
+  /// The Future's result is left in an unspecified state.
+  Result<ValueType> MoveResult() {
+    Wait();
+    return std::move(*GetResult());
+  }
+
+  /// \brief Wait for the Future to complete and return its Status
+  Status status() const { return result().status(); }
+
+  /// \brief Wait for the Future to complete
+  void Wait() const {
+    CheckValid();
+    if (!IsFutureFinished(impl_->state())) {
+      impl_->Wait();
+    }
+  }
+
+  /// \brief Wait for the Future to complete, or for the timeout to expire
+  ///
+  /// `true` is returned if the Future completed, `false` if the timeout expired.
+  /// Note a `false` value is only indicative, as the Future can complete
+  /// concurrently.
+  bool Wait(double seconds) const {
+    CheckValid();
+    if (IsFutureFinished(impl_->state())) {
+      return true;
+    }
+    return impl_->Wait(seconds);
+  }
+
+  /// \brief Mark the Future finished with the given result
+  ///
+  /// This must be called exactly once per Future.
+  void MarkFinished(Result<ValueType> result) { DoMarkFinished(std::move(result)); }
+
+  /// \brief Mark a Future<> finished with the given status
+  template <typename E = ValueType, typename = typename std::enable_if<
+                                        std::is_same<E, detail::Empty>::value>::type>
+  void MarkFinished(Status status = Status::OK()) {
+    DoMarkFinished(ToResult(std::move(status)));
+  }
+
+  /// \brief Producer API: instantiate a valid, pending Future
+  static Future Make() {
+    Future fut;
+    fut.impl_ = FutureImpl::Make();
+    return fut;
+  }
+
+  /// \brief Producer API: instantiate a finished Future
+  static Future MakeFinished(Result<ValueType> result) {
+    Future fut;
+    fut.InitializeFromResult(std::move(result));
+    return fut;
+  }
+
+  /// \brief Producer API: instantiate a finished Future<>
+  template <typename E = ValueType, typename = typename std::enable_if<
+                                        std::is_same<E, detail::Empty>::value>::type>
+  static Future MakeFinished(Status status = Status::OK()) {
+    return MakeFinished(ToResult(std::move(status)));
+  }
+
+  /// \brief Consumer API: register a callback to run when this Future completes
+  ///
+  /// The callback is called with `const Result<T>&`.  If the Future has already
+  /// completed, it is run immediately in the calling thread; otherwise it is run
+  /// in the thread that marks the Future finished.  Callbacks should therefore
+  /// be cheap, or hand heavy work over to a thread pool.
+  template <typename OnComplete>
+  void AddCallback(OnComplete on_complete) const {
+    CheckValid();
+    impl_->AddCallback([on_complete](const FutureImpl& impl) mutable {
+      on_complete(*static_cast<Result<ValueType>*>(impl.result_.get()));
+    });
+  }
+
+  /// \brief Consumer API: chain a callback on this Future's success
+  ///
+  /// On success, `on_success` is called with `const T&` (or with no argument
+  /// for a Future<>).  On failure, `on_failure` is called with the Status.
+  /// Both must return the same kind of value, which determines the returned
+  /// Future's type:
+  /// - void or Status: Future<>
+  /// - Result<U> or U: Future<U>
+  /// - Future<U>: Future<U>, which completes when the returned Future completes
+  ///
+  /// The returned Future completes with the outcome of the called callback.
+  template <typename OnSuccess, typename OnFailure,
+            typename ContinuedFuture = detail::ContinueFuture::ForReturn<
+                typename detail::OnSuccessCaller<ValueType>::template ResultOf<
+                    OnSuccess>>>
+  ContinuedFuture Then(OnSuccess on_success, OnFailure on_failure) const {
+    auto next = ContinuedFuture::Make();
+    AddCallback([on_success, on_failure, next](const Result<ValueType>& result) mutable {
+      if (ARROW_PREDICT_TRUE(result.ok())) {
+        detail::OnSuccessCaller<ValueType>::Call(std::move(next), std::move(on_success),
+                                                 result);
+      } else {
+        detail::ContinueFuture{}(std::move(next), std::move(on_failure),
+                                 result.status());
+      }
+    });
+    return next;
+  }
+
+  /// \brief Consumer API: chain a callback on this Future's success
+  ///
+  /// Like the two-argument Then(), but any error is forwarded as-is to the
+  /// returned Future, without calling `on_success`.
+  template <typename OnSuccess,
+            typename ContinuedFuture = detail::ContinueFuture::ForReturn<
+                typename detail::OnSuccessCaller<ValueType>::template ResultOf<
+                    OnSuccess>>>
+  ContinuedFuture Then(OnSuccess on_success) const {
+    return Then(std::move(on_success), detail::PassthruOnFailure<ContinuedFuture>{});
+  }
+
+ protected:
+  template <typename E = ValueType>
+  static typename std::enable_if<std::is_same<E, detail::Empty>::value,
+                                 Result<detail::Empty>>::type
+  ToResult(Status status) {
+    if (ARROW_PREDICT_TRUE(status.ok())) {
+      return detail::Empty{};
+    }
+    return status;
+  }
+
+  Result<ValueType>* GetResult() const {
+    return static_cast<Result<ValueType>*>(impl_->result_.get());
+  }
+
+  void SetResult(Result<ValueType> result) {
+    impl_->result_ = {new Result<ValueType>(std::move(result)),
+                      [](void* p) { delete static_cast<Result<ValueType>*>(p); }};
+  }
+
+  void InitializeFromResult(Result<ValueType> result) {
+    if (ARROW_PREDICT_TRUE(result.ok())) {
+      impl_ = FutureImpl::MakeFinished(FutureState::SUCCESS);
+    } else {
+      impl_ = FutureImpl::MakeFinished(FutureState::FAILURE);
+    }
+    SetResult(std::move(result));
+  }
+
+  void DoMarkFinished(Result<ValueType> result) {
+    CheckValid();
+    DCHECK(!IsFutureFinished(impl_->state())) << "Future marked finished twice";
+    SetResult(std::move(result));
+    if (ARROW_PREDICT_TRUE(GetResult()->ok())) {
+      impl_->MarkFinished();
+    } else {
+      impl_->MarkFailed();
+    }
+  }
+
+  void CheckValid() const {
+#ifndef NDEBUG
+    if (!is_valid()) {
+      Status::Invalid("Invalid Future (default-initialized?)").Abort();
+    }
+#endif
+  }
+
+  std::shared_ptr<FutureImpl> impl_;
+};
+
+/// \brief Create a Future which completes when all of `futures` complete
+///
+/// The returned Future's value is a vector of the individual results, in
+/// the same order as the input.  The returned Future always succeeds; errors
+/// are reported in the individual results.
+template <typename T>
+Future<std::vector<Result<T>>> All(std::vector<Future<T>> futures) {
+  struct State {
+    explicit State(std::vector<Future<T>> f)
+        : futures(std::move(f)), n_remaining(futures.size()) {}
+
+    std::vector<Future<T>> futures;
+    std::atomic<size_t> n_remaining;
+  };
+
+  auto out = Future<std::vector<Result<T>>>::Make();
+  if (futures.empty()) {
+    out.MarkFinished(std::vector<Result<T>>{});
+    return out;
+  }
+
+  auto state = std::make_shared<State>(std::move(futures));
+  for (const Future<T>& future : state->futures) {
+    future.AddCallback([state, out](const Result<T>&) mutable {
+      if (state->n_remaining.fetch_sub(1) != 1) {
+        return;
+      }
+      std::vector<Result<T>> results;
+      results.reserve(state->futures.size());
+      for (const Future<T>& future : state->futures) {
+        results.push_back(future.result());
+      }
+      out.MarkFinished(std::move(results));
+    });
+  }
+  return out;
+}
+
+/// \brief Create a Future<> which completes when all of `futures` complete
+///
+/// The returned Future fails with the first error (in input order) if any
+/// of the input Futures failed.
+ARROW_EXPORT
+Future<> AllComplete(const std::vector<Future<>>& futures);
+
+}  // namespace arrow
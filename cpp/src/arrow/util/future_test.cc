@@ -0,0 +1,218 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
+
+namespace arrow {
+
+static void SleepABit() { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+
+TEST(FutureTest, MakeFinished) {
+  auto fut = Future<int>::MakeFinished(42);
+  ASSERT_TRUE(fut.is_valid());
+  ASSERT_TRUE(fut.is_finished());
+  ASSERT_EQ(fut.state(), FutureState::SUCCESS);
+  ASSERT_OK_AND_EQ(42, fut.result());
+
+  fut = Future<int>::MakeFinished(Status::IOError("xxx"));
+  ASSERT_EQ(fut.state(), FutureState::FAILURE);
+  ASSERT_RAISES(IOError, fut.result());
+
+  auto empty = Future<>::MakeFinished();
+  ASSERT_EQ(empty.state(), FutureState::SUCCESS);
+  ASSERT_OK(empty.status());
+  empty = Future<>::MakeFinished(Status::Invalid("xxx"));
+  ASSERT_EQ(empty.state(), FutureState::FAILURE);
+  ASSERT_RAISES(Invalid, empty.status());
+}
+
+TEST(FutureTest, MarkFinished) {
+  auto fut = Future<std::string>::Make();
+  ASSERT_EQ(fut.state(), FutureState::PENDING);
+  ASSERT_FALSE(fut.Wait(0.001));
+
+  std::thread producer([fut]() mutable {
+    SleepABit();
+    fut.MarkFinished(std::string("foo"));
+  });
+  ASSERT_OK_AND_EQ("foo", fut.result());
+  ASSERT_TRUE(fut.Wait(0.001));
+  producer.join();
+
+  auto moved = fut.MoveResult();
+  ASSERT_OK_AND_EQ("foo", moved);
+
+  auto empty = Future<>::Make();
+  empty.MarkFinished(Status::IOError("xxx"));
+  ASSERT_RAISES(IOError, empty.status());
+}
+
+TEST(FutureTest, AddCallback) {
+  std::vector<int> results;
+
+  // Callback added before completion runs at completion
+  auto fut = Future<int>::Make();
+  fut.AddCallback([&](const Result<int>& result) { results.push_back(*result); });
+  ASSERT_TRUE(results.empty());
+  fut.MarkFinished(1);
+  ASSERT_EQ(results, std::vector<int>{1});
+
+  // Callback added after completion runs immediately
+  fut.AddCallback([&](const Result<int>& result) { results.push_back(*result + 1); });
+  ASSERT_EQ(results, (std::vector<int>{1, 2}));
+
+  // Callbacks are called on error as well
+  Status status;
+  auto failed = Future<>::Make();
+  failed.AddCallback(
+      [&](const Result<detail::Empty>& result) { status = result.status(); });
+  failed.MarkFinished(Status::Invalid("xxx"));
+  ASSERT_RAISES(Invalid, status);
+}
+
+TEST(FutureTest, ThenSuccess) {
+  auto fut = Future<int>::Make();
+
+  // Value-returning callback
+  auto plus_one = fut.Then([](const int& x) { return x + 1; });
+  // Result-returning callback
+  auto to_string = plus_one.Then([](const int& x) -> Result<std::string> {
+    return std::to_string(x);
+  });
+  // Status-returning callback gives a Future<>
+  auto check = to_string.Then([](const std::string& s) {
+    return s == "43" ? Status::OK() : Status::Invalid("unexpected value ", s);
+  });
+  // void-returning callback on a Future<>
+  bool called = false;
+  auto end = check.Then([&]() { called = true; });
+
+  ASSERT_EQ(end.state(), FutureState::PENDING);
+  fut.MarkFinished(42);
+  ASSERT_OK_AND_EQ(43, plus_one.result());
+  ASSERT_OK_AND_EQ("43", to_string.result());
+  ASSERT_OK(check.status());
+  ASSERT_OK(end.status());
+  ASSERT_TRUE(called);
+}
+
+TEST(FutureTest, ThenFailure) {
+  auto fut = Future<int>::Make();
+
+  // Errors are forwarded without calling the success callback
+  bool called = false;
+  auto forwarded = fut.Then([&](const int& x) {
+    called = true;
+    return x;
+  });
+  // ... or passed to the failure callback
+  auto recovered = fut.Then([](const int& x) { return x; },
+                            [](const Status& st) -> Result<int> { return -1; });
+
+  fut.MarkFinished(Status::IOError("xxx"));
+  ASSERT_RAISES(IOError, forwarded.result());
+  ASSERT_FALSE(called);
+  ASSERT_OK_AND_EQ(-1, recovered.result());
+
+  // Errors returned by the success callback
+  auto fut2 = Future<int>::MakeFinished(1);
+  auto failing = fut2.Then([](const int&) -> Result<int> { return Status::Invalid(""); });
+  ASSERT_RAISES(Invalid, failing.result());
+}
+
+TEST(FutureTest, ThenFuture) {
+  // A callback returning a Future is chained: the resulting future completes
+  // when the returned future completes
+  auto inner = Future<std::string>::Make();
+  auto fut = Future<>::Make();
+  auto chained = fut.Then([inner]() { return inner; });
+  fut.MarkFinished();
+  ASSERT_EQ(chained.state(), FutureState::PENDING);
+  inner.MarkFinished(std::string("done"));
+  ASSERT_OK_AND_EQ("done", chained.result());
+}
+
+TEST(FutureTest, All) {
+  std::vector<Future<int>> futures;
+  for (int i = 0; i < 4; ++i) {
+    futures.push_back(Future<int>::Make());
+  }
+  auto all = All(futures);
+  ASSERT_EQ(all.state(), FutureState::PENDING);
+
+  futures[2].MarkFinished(2);
+  futures[0].MarkFinished(0);
+  futures[3].MarkFinished(Status::IOError("xxx"));
+  ASSERT_EQ(all.state(), FutureState::PENDING);
+  futures[1].MarkFinished(1);
+
+  ASSERT_OK_AND_ASSIGN(auto results, all.result());
+  ASSERT_EQ(results.size(), 4);
+  ASSERT_OK_AND_EQ(0, results[0]);
+  ASSERT_OK_AND_EQ(1, results[1]);
+  ASSERT_OK_AND_EQ(2, results[2]);
+  ASSERT_RAISES(IOError, results[3]);
+
+  ASSERT_OK_AND_ASSIGN(results, All(std::vector<Future<int>>{}).result());
+  ASSERT_EQ(results.size(), 0);
+}
+
+TEST(FutureTest, AllComplete) {
+  std::vector<Future<>> futures = {Future<>::Make(), Future<>::Make()};
+  auto all = AllComplete(futures);
+  futures[1].MarkFinished();
+  ASSERT_EQ(all.state(), FutureState::PENDING);
+  futures[0].MarkFinished();
+  ASSERT_OK(all.status());
+
+  futures = {Future<>::MakeFinished(), Future<>::MakeFinished(Status::IOError("xxx"))};
+  ASSERT_RAISES(IOError, AllComplete(futures).status());
+}
+
+TEST(FutureTest, StressCallbacks) {
+  // Mark finished while callbacks are being added concurrently
+  for (int rep = 0; rep < 100; ++rep) {
+    auto fut = Future<int>::Make();
+    std::atomic<int> count(0);
+    std::vector<Future<int>> continuations;
+    std::thread producer([fut]() mutable { fut.MarkFinished(1); });
+    for (int i = 0; i < 20; ++i) {
+      continuations.push_back(fut.Then([&](const int& x) {
+        count += x;
+        return x;
+      }));
+    }
+    producer.join();
+    for (const auto& cont : continuations) {
+      ASSERT_OK_AND_EQ(1, cont.result());
+    }
+    ASSERT_EQ(count.load(), 20);
+  }
+}
+
+}  // namespace arrow
@@ -24,8 +24,10 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/hashing.h"
+#include "arrow/util/string_view.h"
 
 namespace arrow {
 namespace internal {
@@ -111,6 +113,38 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// Build a memo table from `values`, then look all of them up
+template <typename MemoTableType, typename Value>
+static void BenchmarkMemoTable(benchmark::State& state,  // NOLINT non-const reference
+                               const std::vector<Value>& values) {
+  while (state.KeepRunning()) {
+    MemoTableType table(default_memory_pool());
+    int32_t memo_index;
+    for (const auto& v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    int64_t total = 0;
+    for (const auto& v : values) {
+      total += table.Get(v);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(2 * state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableInt64(benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = MakeIntegers<int64_t>(static_cast<int32_t>(state.range(0)));
+  BenchmarkMemoTable<ScalarMemoTable<int64_t, HashTableTemplateType>>(state, values);
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableString(benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = MakeStrings(static_cast<int32_t>(state.range(0)), 2, 20);
+  std::vector<util::string_view> views(values.begin(), values.end());
+  BenchmarkMemoTable<BasicBinaryMemoTable<HashTableTemplateType>>(state, views);
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +153,18 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+// From 1M to 16M (mostly distinct) keys, i.e. from tables about the size of
+// the last level cache to tables much larger
+#define MEMO_TABLE_BENCHMARK(NAME, HASH_TABLE) \
+  BENCHMARK_TEMPLATE(NAME, HASH_TABLE)         \
+      ->RangeMultiplier(4)                     \
+      ->Range(1 << 20, 1 << 24)                \
+      ->Unit(benchmark::kMillisecond)
+
+MEMO_TABLE_BENCHMARK(MemoTableInt64, HashTable);
+MEMO_TABLE_BENCHMARK(MemoTableInt64, SwissHashTable);
+MEMO_TABLE_BENCHMARK(MemoTableString, HashTable);
+MEMO_TABLE_BENCHMARK(MemoTableString, SwissHashTable);
+
 }  // namespace internal
 }  // namespace arrow
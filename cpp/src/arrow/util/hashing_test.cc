@@ -374,6 +374,60 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(ScalarMemoTable, SwissHashTable) {
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 500;
+#else
+  const int32_t n_values = 100000;
+#endif
+  const auto distinct = MakeDistinctIntegers<int64_t>(n_values);
+  const std::vector<int64_t> values(distinct.begin(), distinct.end());
+
+  ScalarMemoTable<int64_t, SwissHashTable> table(default_memory_pool(), 0);
+  AssertGet(table, values[0], kKeyNotFound);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGetOrInsert(table, values[i], i);
+  }
+  AssertGetOrInsertNull(table, n_values);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGet(table, values[i], i);
+    AssertGetOrInsert(table, values[i], i);
+  }
+  ASSERT_EQ(table.size(), n_values + 1);
+
+  std::vector<int64_t> copied(n_values + 1);
+  table.CopyValues(copied.data());
+  copied.pop_back();
+  ASSERT_EQ(copied, values);
+}
+
+TEST(SwissHashTable, Collisions) {
+  // Many keys with the same hash (including the sentinel) spill over
+  // several groups and upsizes
+  struct Payload {
+    int32_t value;
+  };
+  for (hash_t h : {hash_t(0), hash_t(12345)}) {
+    SwissHashTable<Payload> table(default_memory_pool(), 0);
+    for (int32_t i = 0; i < 1000; ++i) {
+      auto cmp_func = [i](const Payload* payload) { return payload->value == i; };
+      auto p = table.Lookup(h, cmp_func);
+      ASSERT_FALSE(p.second);
+      ASSERT_OK(table.Insert(p.first, h, {i}));
+    }
+    ASSERT_EQ(table.size(), 1000);
+    for (int32_t i = 0; i < 1000; ++i) {
+      auto cmp_func = [i](const Payload* payload) { return payload->value == i; };
+      auto p = table.Lookup(h, cmp_func);
+      ASSERT_TRUE(p.second);
+      ASSERT_EQ(p.first->payload.value, i);
+    }
+    int64_t visited = 0;
+    table.VisitEntries([&](const SwissHashTable<Payload>::Entry*) { ++visited; });
+    ASSERT_EQ(visited, 1000);
+  }
+}
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
@@ -478,5 +532,33 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, SwissHashTable) {
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 200;
+#else
+  const int32_t n_values = 20000;
+#endif
+  const auto distinct = MakeDistinctStrings(n_values);
+  const std::vector<std::string> values(distinct.begin(), distinct.end());
+
+  BasicBinaryMemoTable<SwissHashTable> table(default_memory_pool(), 0);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGetOrInsert(table, values[i], i);
+  }
+  AssertGetOrInsertNull(table, n_values);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGet(table, values[i], i);
+    AssertGetOrInsert(table, values[i], i);
+  }
+  ASSERT_EQ(table.size(), n_values + 1);
+
+  std::vector<std::string> visited;
+  table.VisitValues(0, [&](const util::string_view& v) {
+    visited.emplace_back(v.data(), v.length());
+  });
+  visited.pop_back();
+  ASSERT_EQ(visited, values);
+}
+
 }  // namespace internal
 }  // namespace arrow
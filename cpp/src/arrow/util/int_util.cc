@@ -20,10 +20,17 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/int_util_avx2.h"
+#endif
+
 namespace arrow {
 namespace internal {
 
@@ -63,7 +70,8 @@ inline uint8_t ExpandedUIntWidth(uint64_t val, uint8_t current_width) {
   }
 }
 
-uint8_t DetectUIntWidth(const uint64_t* values, int64_t length, uint8_t min_width) {
+static uint8_t DetectUIntWidthScalar(const uint64_t* values, int64_t length,
+                                     uint8_t min_width) {
   uint8_t width = min_width;
   if (min_width < 8) {
     auto p = values;
@@ -111,10 +119,10 @@ uint8_t DetectUIntWidth(const uint64_t* values, int64_t length, uint8_t min_widt
   return width;
 }
 
-uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
-                        int64_t length, uint8_t min_width) {
+static uint8_t DetectUIntWidthScalar(const uint64_t* values, const uint8_t* valid_bytes,
+                                     int64_t length, uint8_t min_width) {
   if (valid_bytes == nullptr) {
-    return DetectUIntWidth(values, length, min_width);
+    return DetectUIntWidthScalar(values, length, min_width);
   }
   uint8_t width = min_width;
   if (min_width < 8) {
@@ -158,7 +166,8 @@ uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
 // Signed integer width detection
 //
 
-uint8_t DetectIntWidth(const int64_t* values, int64_t length, uint8_t min_width) {
+static uint8_t DetectIntWidthScalar(const int64_t* values, int64_t length,
+                                    uint8_t min_width) {
   if (min_width == 8) {
     return min_width;
   }
@@ -249,10 +258,10 @@ width8:
   return 8;
 }
 
-uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
-                       uint8_t min_width) {
+static uint8_t DetectIntWidthScalar(const int64_t* values, const uint8_t* valid_bytes,
+                                    int64_t length, uint8_t min_width) {
   if (valid_bytes == nullptr) {
-    return DetectIntWidth(values, length, min_width);
+    return DetectIntWidthScalar(values, length, min_width);
   }
 
   if (min_width == 8) {
@@ -370,16 +379,99 @@ inline void DowncastIntsInternal(const Source* src, Dest* dest, int64_t length)
   }
 }
 
+//
+// Runtime dispatch
+//
+
+struct DetectUIntWidthDynamicFunction {
+  using FunctionType = uint8_t (*)(const uint64_t*, const uint8_t*, int64_t, uint8_t);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, DetectUIntWidthScalar}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, DetectUIntWidthAvx2}
+#endif
+    };
+  }
+};
+
+struct DetectIntWidthDynamicFunction {
+  using FunctionType = uint8_t (*)(const int64_t*, const uint8_t*, int64_t, uint8_t);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, DetectIntWidthScalar}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, DetectIntWidthAvx2}
+#endif
+    };
+  }
+};
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+// Overloads on the source type, for DowncastDynamicFunction
+template <typename Dest>
+void DowncastAvx2(const int64_t* source, Dest* dest, int64_t length) {
+  DowncastIntsAvx2(source, dest, length);
+}
+
+template <typename Dest>
+void DowncastAvx2(const uint64_t* source, Dest* dest, int64_t length) {
+  DowncastUIntsAvx2(source, dest, length);
+}
+#endif
+
+template <typename Source, typename Dest>
+struct DowncastDynamicFunction {
+  using FunctionType = void (*)(const Source*, Dest*, int64_t);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, DowncastIntsInternal<Source, Dest>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, static_cast<FunctionType>(DowncastAvx2<Dest>)}
+#endif
+    };
+  }
+};
+
+template <typename Source, typename Dest>
+void DispatchDowncast(const Source* source, Dest* dest, int64_t length) {
+  static DynamicDispatch<DowncastDynamicFunction<Source, Dest>> dispatch;
+  dispatch.func(source, dest, length);
+}
+
+uint8_t DetectUIntWidth(const uint64_t* values, int64_t length, uint8_t min_width) {
+  return DetectUIntWidth(values, nullptr, length, min_width);
+}
+
+uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
+                        int64_t length, uint8_t min_width) {
+  static DynamicDispatch<DetectUIntWidthDynamicFunction> dispatch;
+  return dispatch.func(values, valid_bytes, length, min_width);
+}
+
+uint8_t DetectIntWidth(const int64_t* values, int64_t length, uint8_t min_width) {
+  return DetectIntWidth(values, nullptr, length, min_width);
+}
+
+uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
+                       uint8_t min_width) {
+  static DynamicDispatch<DetectIntWidthDynamicFunction> dispatch;
+  return dispatch.func(values, valid_bytes, length, min_width);
+}
+
 void DowncastInts(const int64_t* source, int8_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DispatchDowncast(source, dest, length);
 }
 
 void DowncastInts(const int64_t* source, int16_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DispatchDowncast(source, dest, length);
 }
 
 void DowncastInts(const int64_t* source, int32_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DispatchDowncast(source, dest, length);
 }
 
 void DowncastInts(const int64_t* source, int64_t* dest, int64_t length) {
@@ -387,15 +479,15 @@ void DowncastInts(const int64_t* source, int64_t* dest, int64_t length) {
 }
 
 void DowncastUInts(const uint64_t* source, uint8_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DispatchDowncast(source, dest, length);
 }
 
 void DowncastUInts(const uint64_t* source, uint16_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DispatchDowncast(source, dest, length);
 }
 
 void DowncastUInts(const uint64_t* source, uint32_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DispatchDowncast(source, dest, length);
 }
 
 void DowncastUInts(const uint64_t* source, uint64_t* dest, int64_t length) {
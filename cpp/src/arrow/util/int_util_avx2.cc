@@ -0,0 +1,203 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with AVX2 enabled, its functions must only be called
+// after checking for AVX2 support at runtime.
+
+#include "arrow/util/int_util_avx2.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Values are ORed together a block at a time, checking for the widest width
+// between blocks
+constexpr int64_t kBlockSize = 256;
+
+// Load the validity of 4 values as 64-bit masks (all ones if valid)
+inline __m256i LoadValidMask(const uint8_t* valid_bytes) {
+  int32_t bytes;
+  std::memcpy(&bytes, valid_bytes, sizeof(bytes));
+  const __m256i valid = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(bytes));
+  return _mm256_xor_si256(_mm256_cmpeq_epi64(valid, _mm256_setzero_si256()),
+                          _mm256_set1_epi64x(-1));
+}
+
+// Return the OR of all the (valid) values, stopping early once it
+// intersects `stop_mask`.  Signed values are first mapped to x ^ (x >> 63),
+// which fits in N signed bits iff x does.
+template <bool kSigned>
+uint64_t OrValues(const uint64_t* values, const uint8_t* valid_bytes, int64_t length,
+                  uint64_t stop_mask) {
+  const __m256i zero = _mm256_setzero_si256();
+  auto load = [&](int64_t i) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+    if (kSigned) {
+      v = _mm256_xor_si256(v, _mm256_cmpgt_epi64(zero, v));
+    }
+    if (valid_bytes != nullptr) {
+      v = _mm256_and_si256(v, LoadValidMask(valid_bytes + i));
+    }
+    return v;
+  };
+
+  uint64_t result = 0;
+  int64_t i = 0;
+  while (i + 16 <= length) {
+    const int64_t block_end = std::min(length, i + kBlockSize) / 16 * 16;
+    __m256i acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+    for (; i < block_end; i += 16) {
+      acc0 = _mm256_or_si256(acc0, load(i));
+      acc1 = _mm256_or_si256(acc1, load(i + 4));
+      acc2 = _mm256_or_si256(acc2, load(i + 8));
+      acc3 = _mm256_or_si256(acc3, load(i + 12));
+    }
+    const __m256i acc =
+        _mm256_or_si256(_mm256_or_si256(acc0, acc1), _mm256_or_si256(acc2, acc3));
+    const __m128i half =
+        _mm_or_si128(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    result |= static_cast<uint64_t>(_mm_cvtsi128_si64(half)) |
+              static_cast<uint64_t>(_mm_extract_epi64(half, 1));
+    if ((result & stop_mask) != 0) {
+      return result;
+    }
+  }
+  for (; i < length; ++i) {
+    uint64_t v = values[i];
+    if (kSigned) {
+      v ^= static_cast<uint64_t>(static_cast<int64_t>(v) >> 63);
+    }
+    if (valid_bytes == nullptr || valid_bytes[i] != 0) {
+      result |= v;
+    }
+  }
+  return result;
+}
+
+// Truncate 8 64-bit integers to 32 bits
+inline __m256i Truncate64To32(const void* source) {
+  const __m256i index = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  const auto src = reinterpret_cast<const __m256i*>(source);
+  const __m256i a = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(src), index);
+  const __m256i b = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(src + 1), index);
+  return _mm256_permute2x128_si256(a, b, 0x20);
+}
+
+// Gather the low 8 bytes of each 128-bit lane of `a`, then of `b`
+inline __m256i GatherLowHalves(__m256i a, __m256i b) {
+  a = _mm256_permute4x64_epi64(a, 0x08);
+  b = _mm256_permute4x64_epi64(b, 0x08);
+  return _mm256_permute2x128_si256(a, b, 0x20);
+}
+
+// Truncate 16 64-bit integers to 16 bits
+inline __m256i Truncate64To16(const int64_t* source) {
+  const __m256i shuffle =
+      _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1,
+                       4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+  return GatherLowHalves(_mm256_shuffle_epi8(Truncate64To32(source), shuffle),
+                         _mm256_shuffle_epi8(Truncate64To32(source + 8), shuffle));
+}
+
+// Truncate 32 64-bit integers to 8 bits
+inline __m256i Truncate64To8(const int64_t* source) {
+  const __m256i shuffle =
+      _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1, 0, 2,
+                       4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1);
+  return GatherLowHalves(_mm256_shuffle_epi8(Truncate64To16(source), shuffle),
+                         _mm256_shuffle_epi8(Truncate64To16(source + 16), shuffle));
+}
+
+template <typename Dest>
+void Downcast(const int64_t* source, Dest* dest, int64_t length) {
+  // The number of values narrowed into one 256-bit vector
+  constexpr int64_t kBatch = 32 / sizeof(Dest);
+  int64_t i = 0;
+  for (; i + kBatch <= length; i += kBatch) {
+    __m256i narrowed;
+    if (sizeof(Dest) == 1) {
+      narrowed = Truncate64To8(source + i);
+    } else if (sizeof(Dest) == 2) {
+      narrowed = Truncate64To16(source + i);
+    } else {
+      narrowed = Truncate64To32(source + i);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), narrowed);
+  }
+  for (; i < length; ++i) {
+    dest[i] = static_cast<Dest>(source[i]);
+  }
+}
+
+}  // namespace
+
+uint8_t DetectUIntWidthAvx2(const uint64_t* values, const uint8_t* valid_bytes,
+                            int64_t length, uint8_t min_width) {
+  if (min_width == 8) {
+    return min_width;
+  }
+  const uint64_t mask =
+      OrValues<false>(values, valid_bytes, length, ~uint64_t(0xffffffffULL));
+  const uint8_t width = mask <= 0xffULL ? 1 : mask <= 0xffffULL ? 2
+                                        : mask <= 0xffffffffULL ? 4 : 8;
+  return std::max(width, min_width);
+}
+
+uint8_t DetectIntWidthAvx2(const int64_t* values, const uint8_t* valid_bytes,
+                           int64_t length, uint8_t min_width) {
+  if (min_width == 8) {
+    return min_width;
+  }
+  const uint64_t mask = OrValues<true>(reinterpret_cast<const uint64_t*>(values),
+                                       valid_bytes, length, ~uint64_t(0x7fffffffULL));
+  const uint8_t width = mask <= 0x7fULL ? 1 : mask <= 0x7fffULL ? 2
+                                        : mask <= 0x7fffffffULL ? 4 : 8;
+  return std::max(width, min_width);
+}
+
+void DowncastIntsAvx2(const int64_t* source, int8_t* dest, int64_t length) {
+  Downcast(source, dest, length);
+}
+
+void DowncastIntsAvx2(const int64_t* source, int16_t* dest, int64_t length) {
+  Downcast(source, dest, length);
+}
+
+void DowncastIntsAvx2(const int64_t* source, int32_t* dest, int64_t length) {
+  Downcast(source, dest, length);
+}
+
+void DowncastUIntsAvx2(const uint64_t* source, uint8_t* dest, int64_t length) {
+  Downcast(reinterpret_cast<const int64_t*>(source), dest, length);
+}
+
+void DowncastUIntsAvx2(const uint64_t* source, uint16_t* dest, int64_t length) {
+  Downcast(reinterpret_cast<const int64_t*>(source), dest, length);
+}
+
+void DowncastUIntsAvx2(const uint64_t* source, uint32_t* dest, int64_t length) {
+  Downcast(reinterpret_cast<const int64_t*>(source), dest, length);
+}
+
+}  // namespace internal
+}  // namespace arrow
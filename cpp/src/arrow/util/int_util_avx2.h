@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+// AVX2 implementations of the int_util.h width detection and narrowing
+// functions, only callable on CPUs supporting AVX2.  `valid_bytes` may be
+// null.
+
+ARROW_EXPORT
+uint8_t DetectUIntWidthAvx2(const uint64_t* values, const uint8_t* valid_bytes,
+                            int64_t length, uint8_t min_width);
+
+ARROW_EXPORT
+uint8_t DetectIntWidthAvx2(const int64_t* values, const uint8_t* valid_bytes,
+                           int64_t length, uint8_t min_width);
+
+ARROW_EXPORT
+void DowncastIntsAvx2(const int64_t* source, int8_t* dest, int64_t length);
+ARROW_EXPORT
+void DowncastIntsAvx2(const int64_t* source, int16_t* dest, int64_t length);
+ARROW_EXPORT
+void DowncastIntsAvx2(const int64_t* source, int32_t* dest, int64_t length);
+
+ARROW_EXPORT
+void DowncastUIntsAvx2(const uint64_t* source, uint8_t* dest, int64_t length);
+ARROW_EXPORT
+void DowncastUIntsAvx2(const uint64_t* source, uint16_t* dest, int64_t length);
+ARROW_EXPORT
+void DowncastUIntsAvx2(const uint64_t* source, uint32_t* dest, int64_t length);
+
+}  // namespace internal
+}  // namespace arrow
@@ -95,10 +95,40 @@ static void DetectIntWidthNulls(benchmark::State& state) {  // NOLINT non-const
   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(uint64_t));
 }
 
+template <typename Dest>
+static void DowncastIntsTo(benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = GetIntSequence(0x12345, -0x1234);
+  std::vector<Dest> dest(values.size());
+
+  while (state.KeepRunning()) {
+    DowncastInts(values.data(), dest.data(), static_cast<int64_t>(values.size()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+}
+
+template <typename Dest>
+static void DowncastUIntsTo(benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = GetUIntSequence(0x12345);
+  std::vector<Dest> dest(values.size());
+
+  while (state.KeepRunning()) {
+    DowncastUInts(values.data(), dest.data(), static_cast<int64_t>(values.size()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(uint64_t));
+}
+
 BENCHMARK(DetectUIntWidthNoNulls);
 BENCHMARK(DetectUIntWidthNulls);
 BENCHMARK(DetectIntWidthNoNulls);
 BENCHMARK(DetectIntWidthNulls);
+BENCHMARK_TEMPLATE(DowncastIntsTo, int8_t);
+BENCHMARK_TEMPLATE(DowncastIntsTo, int16_t);
+BENCHMARK_TEMPLATE(DowncastIntsTo, int32_t);
+BENCHMARK_TEMPLATE(DowncastUIntsTo, uint8_t);
+BENCHMARK_TEMPLATE(DowncastUIntsTo, uint16_t);
+BENCHMARK_TEMPLATE(DowncastUIntsTo, uint32_t);
 
 }  // namespace internal
 }  // namespace arrow
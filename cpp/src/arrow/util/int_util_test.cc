@@ -17,13 +17,18 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/util/dispatch.h"
 #include "arrow/util/int_util.h"
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/int_util_avx2.h"
+#endif
 
 namespace arrow {
 namespace internal {
@@ -373,6 +378,132 @@ TEST(IntWidth, NullsMany) {
   }
 }
 
+TEST(IntWidth, LongInputs) {
+  // Exercise the blocked and vectorized paths, with the widest value
+  // at various positions
+  constexpr int N = 1000;
+  for (const int position : {0, 1, 255, 256, 257, 517, 996, 999}) {
+    std::vector<uint64_t> uvalues(N, 0x7f);
+    std::vector<int64_t> values(N, -0x80);
+    std::vector<uint8_t> valid_bytes(N, 1);
+    uvalues[position] = 0x10000;
+    values[position] = -0x8001;
+    CheckUIntWidth(uvalues, 4);
+    CheckIntWidth(values, 4);
+    CheckUIntWidth(uvalues, valid_bytes, 4);
+    CheckIntWidth(values, valid_bytes, 4);
+    valid_bytes[position] = 0;
+    CheckUIntWidth(uvalues, valid_bytes, 1);
+    CheckIntWidth(values, valid_bytes, 1);
+  }
+}
+
+template <typename Dest>
+void Downcast(const int64_t* source, Dest* dest, int64_t length) {
+  DowncastInts(source, dest, length);
+}
+
+template <typename Dest>
+void Downcast(const uint64_t* source, Dest* dest, int64_t length) {
+  DowncastUInts(source, dest, length);
+}
+
+template <typename Source, typename Dest>
+void CheckDowncast(const std::vector<Source>& source) {
+  std::vector<Dest> expected(source.size()), actual(source.size());
+  std::transform(source.begin(), source.end(), expected.begin(),
+                 [](Source v) { return static_cast<Dest>(v); });
+  // Various lengths, to exercise the non-vectorized tails
+  for (const size_t length : {source.size(), source.size() - 1, source.size() - 31}) {
+    std::fill(actual.begin(), actual.end(), Dest(0));
+    Downcast(source.data(), actual.data(), static_cast<int64_t>(length));
+    ASSERT_TRUE(std::equal(actual.begin(), actual.begin() + length, expected.begin()));
+    ASSERT_TRUE(std::all_of(actual.begin() + length, actual.end(),
+                            [](Dest v) { return v == 0; }));
+  }
+}
+
+template <typename T>
+std::vector<T> MakeDowncastValues(T min_value, T max_value) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<T> dist(min_value, max_value);
+  std::vector<T> values(200);
+  for (auto& value : values) {
+    value = dist(gen);
+  }
+  return values;
+}
+
+TEST(DowncastInts, Basics) {
+  CheckDowncast<int64_t, int8_t>(MakeDowncastValues<int64_t>(-0x80, 0x7f));
+  CheckDowncast<int64_t, int16_t>(MakeDowncastValues<int64_t>(-0x8000, 0x7fff));
+  CheckDowncast<int64_t, int32_t>(
+      MakeDowncastValues<int64_t>(-0x80000000LL, 0x7fffffffLL));
+  CheckDowncast<int64_t, int64_t>(MakeDowncastValues<int64_t>(
+      std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()));
+}
+
+TEST(DowncastUInts, Basics) {
+  CheckDowncast<uint64_t, uint8_t>(MakeDowncastValues<uint64_t>(0, 0xff));
+  CheckDowncast<uint64_t, uint16_t>(MakeDowncastValues<uint64_t>(0, 0xffff));
+  CheckDowncast<uint64_t, uint32_t>(MakeDowncastValues<uint64_t>(0, 0xffffffffULL));
+  CheckDowncast<uint64_t, uint64_t>(
+      MakeDowncastValues<uint64_t>(0, std::numeric_limits<uint64_t>::max()));
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+uint8_t ExpectedUIntWidth(uint64_t value) {
+  return value <= 0xff ? 1 : value <= 0xffff ? 2 : value <= 0xffffffffULL ? 4 : 8;
+}
+
+uint8_t ExpectedIntWidth(int64_t value) {
+  return ExpectedUIntWidth(static_cast<uint64_t>(value < 0 ? -(value + 1) : value) << 1);
+}
+
+TEST(IntWidth, Avx2) {
+  if (!IsDispatchLevelSupported(DispatchLevel::AVX2)) {
+    return;
+  }
+  // Check the AVX2 implementations whatever the dispatch level selected at
+  // runtime, on random inputs of all widths
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> shift_dist(0, 63);
+  std::bernoulli_distribution valid_dist(0.9);
+  for (const int length : {0, 3, 4, 100, 256, 1001}) {
+    std::vector<uint64_t> uvalues(length);
+    std::vector<int64_t> values(length);
+    std::vector<uint8_t> valid_bytes(length);
+    for (int i = 0; i < length; ++i) {
+      uvalues[i] = gen() >> shift_dist(gen);
+      values[i] = static_cast<int64_t>(gen()) >> shift_dist(gen);
+      valid_bytes[i] = valid_dist(gen);
+    }
+    for (const uint8_t min_width : all_widths) {
+      uint8_t expected_uint = min_width, expected_uint_valid = min_width;
+      uint8_t expected_int = min_width, expected_int_valid = min_width;
+      for (int i = 0; i < length; ++i) {
+        expected_uint = std::max(expected_uint, ExpectedUIntWidth(uvalues[i]));
+        expected_int = std::max(expected_int, ExpectedIntWidth(values[i]));
+        if (valid_bytes[i]) {
+          expected_uint_valid =
+              std::max(expected_uint_valid, ExpectedUIntWidth(uvalues[i]));
+          expected_int_valid = std::max(expected_int_valid, ExpectedIntWidth(values[i]));
+        }
+      }
+      ASSERT_EQ(DetectUIntWidthAvx2(uvalues.data(), nullptr, length, min_width),
+                expected_uint);
+      ASSERT_EQ(DetectIntWidthAvx2(values.data(), nullptr, length, min_width),
+                expected_int);
+      ASSERT_EQ(
+          DetectUIntWidthAvx2(uvalues.data(), valid_bytes.data(), length, min_width),
+          expected_uint_valid);
+      ASSERT_EQ(DetectIntWidthAvx2(values.data(), valid_bytes.data(), length, min_width),
+                expected_int_valid);
+    }
+  }
+}
+#endif
+
 TEST(TransposeInts, Int8ToInt64) {
   std::vector<int8_t> src = {1, 3, 5, 0, 3, 2};
   std::vector<int32_t> transpose_map = {1111, 2222, 3333, 4444, 5555, 6666, 7777};
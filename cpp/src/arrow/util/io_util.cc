@@ -835,16 +835,35 @@ static inline Result<int> CheckFileOpResult(int fd_ret, int errno_actual,
   return fd_ret;
 }
 
-Result<int> FileOpenReadable(const PlatformFilename& file_name) {
+Result<int> FileOpenReadable(const PlatformFilename& file_name, bool direct_io) {
   int fd, errno_actual;
 #if defined(_WIN32)
+  if (direct_io) {
+    return Status::NotImplemented("Direct I/O is not supported on Windows");
+  }
   SetLastError(0);
   errno_actual = _wsopen_s(&fd, file_name.ToNative().c_str(),
                            _O_RDONLY | _O_BINARY | _O_NOINHERIT, _SH_DENYNO, _S_IREAD);
 #else
-  fd = open(file_name.ToNative().c_str(), O_RDONLY);
+  int oflag = O_RDONLY;
+  if (direct_io) {
+#if defined(O_DIRECT)
+    oflag |= O_DIRECT;
+#elif !defined(F_NOCACHE)
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
+  }
+  fd = open(file_name.ToNative().c_str(), oflag);
   errno_actual = errno;
 
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+  if (fd >= 0 && direct_io && fcntl(fd, F_NOCACHE, 1) == -1) {
+    errno_actual = errno;
+    ARROW_UNUSED(FileClose(fd));
+    fd = -1;
+  }
+#endif
+
   if (fd >= 0) {
     // open(O_RDONLY) succeeds on directories, check for it
     struct stat st;
@@ -187,8 +187,12 @@ ARROW_EXPORT
 Result<bool> FileExists(const PlatformFilename& path);
 
 /// Open a file for reading and return a file descriptor.
+///
+/// If `direct_io` is true, the operating system's page cache is bypassed
+/// (O_DIRECT on Linux, F_NOCACHE on macOS).  Reads must then be aligned as
+/// the underlying device requires.
 ARROW_EXPORT
-Result<int> FileOpenReadable(const PlatformFilename& file_name);
+Result<int> FileOpenReadable(const PlatformFilename& file_name, bool direct_io = false);
 
 /// Open a file for writing and return a file descriptor.
 ARROW_EXPORT
@@ -55,7 +55,7 @@ void parallel_memcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes,
   // Each thread gets a "chunk" of k blocks.
 
   // Start all parallel memcpy tasks and handle leftovers while threads run.
-  std::vector<std::future<void*>> futures;
+  std::vector<Future<void*>> futures;
 
   for (int i = 0; i < num_threads; i++) {
     futures.emplace_back(*pool->Submit(wrap_memcpy, dst + prefix + i * chunk_size,
@@ -65,7 +65,7 @@ void parallel_memcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes,
   memcpy(dst + prefix + num_threads * chunk_size, right, suffix);
 
   for (auto& fut : futures) {
-    fut.get();
+    fut.Wait();
   }
 }
 
@@ -0,0 +1,244 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/numa.h"
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace internal {
+
+int NumaTopology::NodeOfCpu(int cpu) const {
+  if (num_nodes() == 1) {
+    return 0;
+  }
+  for (int node = 0; node < num_nodes(); ++node) {
+    for (const int node_cpu : node_cpus[node]) {
+      if (node_cpu == cpu) {
+        return node;
+      }
+    }
+  }
+  return -1;
+}
+
+Result<std::vector<int>> ParseCpuList(util::string_view list) {
+  std::vector<int> cpus;
+  // Parse a non-negative integer at the start of `list`, consuming it
+  auto parse_int = [&](int* out) -> Status {
+    size_t i = 0;
+    int value = 0;
+    while (i < list.size() && list[i] >= '0' && list[i] <= '9') {
+      value = value * 10 + (list[i] - '0');
+      ++i;
+    }
+    if (i == 0) {
+      return Status::Invalid("Invalid CPU list");
+    }
+    list.remove_prefix(i);
+    *out = value;
+    return Status::OK();
+  };
+
+  while (!list.empty() && list.back() == '\n') {
+    list.remove_suffix(1);
+  }
+  while (!list.empty()) {
+    int first, last;
+    RETURN_NOT_OK(parse_int(&first));
+    last = first;
+    if (!list.empty() && list[0] == '-') {
+      list.remove_prefix(1);
+      RETURN_NOT_OK(parse_int(&last));
+      if (last < first) {
+        return Status::Invalid("Invalid CPU range in CPU list");
+      }
+    }
+    for (int cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+    if (!list.empty()) {
+      if (list[0] != ',' || list.size() == 1) {
+        return Status::Invalid("Invalid CPU list");
+      }
+      list.remove_prefix(1);
+    }
+  }
+  return cpus;
+}
+
+namespace {
+
+#ifdef __linux__
+
+// Flags for get_mempolicy(), from <linux/mempolicy.h>
+constexpr unsigned long kMpolFNode = 1 << 0;  // NOLINT runtime/int
+constexpr unsigned long kMpolFAddr = 1 << 1;  // NOLINT runtime/int
+
+Result<std::vector<int>> ReadCpuList(const std::string& path) {
+  std::ifstream stream(path, std::ios::in);
+  if (!stream) {
+    return Status::IOError("Failed to open '", path, "'");
+  }
+  const std::string contents((std::istreambuf_iterator<char>(stream)),
+                             std::istreambuf_iterator<char>());
+  return ParseCpuList(contents);
+}
+
+// The CPUs the process was allowed to run on, when first asked for
+const cpu_set_t& ProcessCpuSet() {
+  static const cpu_set_t cpu_set = [] {
+    cpu_set_t cpus;
+    if (sched_getaffinity(0, sizeof(cpus), &cpus) != 0) {
+      CPU_ZERO(&cpus);
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        CPU_SET(cpu, &cpus);
+      }
+    }
+    return cpus;
+  }();
+  return cpu_set;
+}
+
+NumaTopology ReadNumaTopology() {
+  NumaTopology topology;
+  const std::string base = "/sys/devices/system/node/";
+  auto maybe_nodes = ReadCpuList(base + "online");
+  if (maybe_nodes.ok() && !maybe_nodes.ValueOrDie().empty()) {
+    const auto nodes = *std::move(maybe_nodes);
+    topology.node_cpus.resize(nodes.back() + 1);
+    for (const int node : nodes) {
+      auto maybe_cpus = ReadCpuList(base + "node" + std::to_string(node) + "/cpulist");
+      if (maybe_cpus.ok()) {
+        topology.node_cpus[node] = *std::move(maybe_cpus);
+      }
+    }
+  }
+  return topology;
+}
+
+Status SetCurrentThreadCpus(const cpu_set_t& cpus) {
+  if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+    return IOErrorFromErrno(errno, "Failed to set thread affinity");
+  }
+  return Status::OK();
+}
+
+#else
+
+NumaTopology ReadNumaTopology() { return NumaTopology(); }
+
+#endif
+
+}  // namespace
+
+const NumaTopology& GetNumaTopology() {
+  static const NumaTopology topology = [] {
+#ifdef __linux__
+    // Capture the process affinity before any thread gets pinned
+    ProcessCpuSet();
+#endif
+    auto topology = ReadNumaTopology();
+    if (topology.node_cpus.empty()) {
+      topology.node_cpus.resize(1);
+    }
+    return topology;
+  }();
+  return topology;
+}
+
+int GetCurrentNumaNode() {
+  const auto& topology = GetNumaTopology();
+  if (topology.num_nodes() == 1) {
+    return 0;
+  }
+#ifdef __linux__
+  const int cpu = sched_getcpu();
+  if (cpu >= 0) {
+    return topology.NodeOfCpu(cpu);
+  }
+#endif
+  return -1;
+}
+
+Result<int> GetNumaNodeOfAddress(const void* address) {
+  if (GetNumaTopology().num_nodes() == 1) {
+    return 0;
+  }
+#ifdef __linux__
+  int node = -1;
+  if (syscall(SYS_get_mempolicy, &node, nullptr, 0, const_cast<void*>(address),
+              kMpolFNode | kMpolFAddr) != 0) {
+    return IOErrorFromErrno(errno, "Failed to get the NUMA node of an address");
+  }
+  return node;
+#else
+  return Status::NotImplemented("NUMA information not available on this platform");
+#endif
+}
+
+Status PinCurrentThreadToNumaNode(int node) {
+  const auto& topology = GetNumaTopology();
+  if (node < 0 || node >= topology.num_nodes()) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  if (topology.num_nodes() == 1) {
+    return Status::OK();
+  }
+#ifdef __linux__
+  const cpu_set_t& allowed = ProcessCpuSet();
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  for (const int cpu : topology.node_cpus[node]) {
+    if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+      CPU_SET(cpu, &cpus);
+    }
+  }
+  if (CPU_COUNT(&cpus) == 0) {
+    return Status::Invalid("No usable CPU on NUMA node ", node);
+  }
+  return SetCurrentThreadCpus(cpus);
+#else
+  return Status::OK();
+#endif
+}
+
+Status UnpinCurrentThread() {
+  if (GetNumaTopology().num_nodes() == 1) {
+    return Status::OK();
+  }
+#ifdef __linux__
+  return SetCurrentThreadCpus(ProcessCpuSet());
+#else
+  return Status::OK();
+#endif
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Helpers for NUMA (non-uniform memory access) machines.
+//
+// These only rely on the operating system (sysfs and a couple of system
+// calls on Linux), not on libnuma.  Where NUMA information isn't available,
+// the machine is described as a single node and the helpers are no-ops.
+
+#pragma once
+
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief The NUMA nodes of the machine and their CPUs
+struct ARROW_EXPORT NumaTopology {
+  /// The CPUs of each node, indexed by node number.  Memory-only nodes, and
+  /// the single node of a machine without NUMA information, have no CPUs.
+  std::vector<std::vector<int>> node_cpus;
+
+  int num_nodes() const { return static_cast<int>(node_cpus.size()); }
+
+  /// Return the node of the given CPU, or -1 if unknown
+  int NodeOfCpu(int cpu) const;
+};
+
+/// Return the NUMA topology of the machine (computed once)
+ARROW_EXPORT const NumaTopology& GetNumaTopology();
+
+/// Parse a Linux CPU or node list, such as "0-3,8,10-11"
+ARROW_EXPORT Result<std::vector<int>> ParseCpuList(util::string_view list);
+
+/// \brief Return the NUMA node the current thread is running on
+///
+/// Unless the thread is pinned (see PinCurrentThreadToNumaNode()), the
+/// result may be stale as soon as it is returned.  Returns -1 if unknown.
+ARROW_EXPORT int GetCurrentNumaNode();
+
+/// \brief Return the NUMA node holding the memory page at the given address
+///
+/// Pages are usually placed on the node of the thread first writing to them,
+/// so this should only be called on memory which was already written to.
+ARROW_EXPORT Result<int> GetNumaNodeOfAddress(const void* address);
+
+/// \brief Restrict the current thread to the CPUs of a NUMA node
+///
+/// The CPUs the process wasn't allowed to run on at startup are left out.
+ARROW_EXPORT Status PinCurrentThreadToNumaNode(int node);
+
+/// Let the current thread run on all the CPUs allowed to the process at startup
+ARROW_EXPORT Status UnpinCurrentThread();
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/numa.h"
+
+namespace arrow {
+namespace internal {
+
+TEST(ParseCpuList, Basics) {
+  ASSERT_OK_AND_EQ(std::vector<int>{}, ParseCpuList(""));
+  ASSERT_OK_AND_EQ(std::vector<int>{0}, ParseCpuList("0\n"));
+  ASSERT_OK_AND_EQ((std::vector<int>{0, 1, 2, 3, 8, 10, 11}),
+                   ParseCpuList("0-3,8,10-11"));
+  ASSERT_OK_AND_EQ((std::vector<int>{12, 13}), ParseCpuList("12-13\n"));
+
+  ASSERT_RAISES(Invalid, ParseCpuList("a"));
+  ASSERT_RAISES(Invalid, ParseCpuList("1,"));
+  ASSERT_RAISES(Invalid, ParseCpuList("1-"));
+  ASSERT_RAISES(Invalid, ParseCpuList("3-1"));
+  ASSERT_RAISES(Invalid, ParseCpuList("1;2"));
+}
+
+TEST(NumaTopology, Basics) {
+  const auto& topology = GetNumaTopology();
+  ASSERT_GE(topology.num_nodes(), 1);
+  for (int node = 0; node < topology.num_nodes(); ++node) {
+    for (const int cpu : topology.node_cpus[node]) {
+      ASSERT_EQ(node, topology.NodeOfCpu(cpu));
+    }
+  }
+
+  const int current = GetCurrentNumaNode();
+  ASSERT_GE(current, -1);
+  ASSERT_LT(current, topology.num_nodes());
+}
+
+TEST(NumaTopology, NodeOfAddress) {
+  std::vector<uint8_t> data(4096, 1);
+  auto maybe_node = GetNumaNodeOfAddress(data.data());
+  if (maybe_node.status().IsNotImplemented()) {
+    return;
+  }
+  ASSERT_OK(maybe_node);
+  ASSERT_GE(*maybe_node, 0);
+  ASSERT_LT(*maybe_node, GetNumaTopology().num_nodes());
+}
+
+TEST(NumaTopology, PinThread) {
+  const auto& topology = GetNumaTopology();
+  ASSERT_RAISES(Invalid, PinCurrentThreadToNumaNode(-1));
+  ASSERT_RAISES(Invalid, PinCurrentThreadToNumaNode(topology.num_nodes()));
+  for (int node = 0; node < topology.num_nodes(); ++node) {
+    if (topology.num_nodes() > 1 && topology.node_cpus[node].empty()) {
+      continue;
+    }
+    if (PinCurrentThreadToNumaNode(node).ok() && topology.num_nodes() > 1) {
+      ASSERT_EQ(node, GetCurrentNumaNode());
+    }
+  }
+  ASSERT_OK(UnpinCurrentThread());
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -49,6 +49,19 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   return strings;
 }
 
+// Integers of 8 digits or more, parsed eight digits at a time
+template <typename c_int>
+static std::vector<std::string> MakeLargeIntStrings(int32_t num_items) {
+  std::vector<c_int> values;
+  randint<uint64_t, c_int>(num_items, 10000000, std::numeric_limits<c_int>::max(),
+                           &values);
+  std::vector<std::string> strings;
+  for (const auto value : values) {
+    strings.push_back(std::to_string(value));
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"0.0",         "5",        "-12.3",
                                            "98765430000", "3456.789", "0.0012345",
@@ -117,6 +130,26 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void LargeIntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakeLargeIntStrings<C_TYPE>(1000);
+  StringConverter<ARROW_TYPE> converter;
+
+  while (state.KeepRunning()) {
+    C_TYPE total = 0;
+    for (const auto& s : strings) {
+      C_TYPE value;
+      if (!converter(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total = static_cast<C_TYPE>(total + value);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
 static void FloatParsing(benchmark::State& state) {  // NOLINT non-const reference
   auto strings = MakeFloatStrings(1000);
@@ -212,6 +245,11 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(LargeIntegerParsing, Int32Type);
+BENCHMARK_TEMPLATE(LargeIntegerParsing, Int64Type);
+BENCHMARK_TEMPLATE(LargeIntegerParsing, UInt32Type);
+BENCHMARK_TEMPLATE(LargeIntegerParsing, UInt64Type);
+
 BENCHMARK_TEMPLATE(FloatParsing, FloatType);
 BENCHMARK_TEMPLATE(FloatParsing, DoubleType);
 
@@ -21,6 +21,7 @@
 #include <atomic>
 #include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "arrow/status.h"
@@ -35,18 +36,32 @@ namespace internal {
 template <class FUNCTION>
 Status ParallelFor(int num_tasks, FUNCTION&& func) {
   auto pool = internal::GetCpuThreadPool();
-  std::vector<std::future<Status>> futures(num_tasks);
+  std::vector<Future<>> futures(num_tasks);
 
   for (int i = 0; i < num_tasks; ++i) {
     ARROW_ASSIGN_OR_RAISE(futures[i], pool->Submit(func, i));
   }
   auto st = Status::OK();
   for (auto& fut : futures) {
-    st &= fut.get();
+    st &= fut.status();
   }
   return st;
 }
 
+// A variant of ParallelFor() which only uses the thread pool if
+// `use_threads` is true, and otherwise calls `func` serially.
+
+template <class FUNCTION>
+Status OptionalParallelFor(bool use_threads, int num_tasks, FUNCTION&& func) {
+  if (use_threads) {
+    return ParallelFor(num_tasks, std::forward<FUNCTION>(func));
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    RETURN_NOT_OK(func(i));
+  }
+  return Status::OK();
+}
+
 // A variant of ParallelFor() with an explicit number of dedicated threads.
 // In most cases it's more appropriate to use the 2-argument ParallelFor (above),
 // or directly the global CPU thread pool (arrow/util/thread-pool.h).
@@ -20,8 +20,11 @@
 #ifndef ARROW_UTIL_PARSING_H
 #define ARROW_UTIL_PARSING_H
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -29,6 +32,7 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
 #include "arrow/vendored/datetime.h"
@@ -131,6 +135,68 @@ namespace detail {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// SWAR ("SIMD within a register") helpers, validating and parsing eight ASCII
+// digits at once from a little-endian 64-bit word (first character in the
+// low byte)
+
+inline uint64_t LoadEightChars(const char* s) {
+  uint64_t word;
+  memcpy(&word, s, sizeof(word));
+  return BitUtil::FromLittleEndian(word);
+}
+
+inline bool IsEightDigits(uint64_t word) {
+  // The high nibble of each byte must be 3, and stay 3 once 6 is added
+  return ((word & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+inline uint32_t ParseEightDigitsUnchecked(uint64_t word) {
+  // Combine adjacent digits into 2-digit, then 4-digit, then 8-digit values
+  constexpr uint64_t kMask = 0x000000FF000000FFULL;
+  constexpr uint64_t kMul1 = 100 + (1000000ULL << 32);
+  constexpr uint64_t kMul2 = 1 + (10000ULL << 32);
+  word -= 0x3030303030303030ULL;
+  word = (word * 10) + (word >> 8);
+  return static_cast<uint32_t>(
+      (((word & kMask) * kMul1) + (((word >> 16) & kMask) * kMul2)) >> 32);
+}
+
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  const uint64_t word = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE(!IsEightDigits(word))) {
+    return false;
+  }
+  *out = ParseEightDigitsUnchecked(word);
+  return true;
+}
+
+// Parse the fixed format "dd?dd?dd" (8 characters, where ? is `sep`) into
+// three 2-digit values, as found in ISO-8601 dates and times
+inline bool ParseDigitPairs(const char* s, char sep, uint8_t* first, uint8_t* second,
+                            uint8_t* third) {
+  // The separators are bytes 2 and 5, replaced with '0' before parsing
+  constexpr uint64_t kSepMask = 0x0000FF0000FF0000ULL;
+  constexpr uint64_t kSepOnes = 0x0000010000010000ULL;
+  uint64_t word = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((word & kSepMask) != kSepOnes * static_cast<uint8_t>(sep))) {
+    return false;
+  }
+  word = (word & ~kSepMask) | (kSepOnes * '0');
+  if (ARROW_PREDICT_FALSE(!IsEightDigits(word))) {
+    return false;
+  }
+  // Each byte i now holds 10 * digit[i] + digit[i + 1], the pairs start at
+  // bytes 0, 3 and 6
+  word -= 0x3030303030303030ULL;
+  word = (word * 10) + (word >> 8);
+  *first = static_cast<uint8_t>(word);
+  *second = static_cast<uint8_t>(word >> 24);
+  *third = static_cast<uint8_t>(word >> 48);
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -189,7 +255,56 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
   return true;
 }
 
+// Wider integers are parsed eight digits at a time
+template <typename C_TYPE>
+inline bool ParseUnsignedWide(const char* s, size_t length, C_TYPE* out) {
+  // Values of up to kSafeDigits digits cannot overflow
+  constexpr size_t kSafeDigits = std::numeric_limits<C_TYPE>::digits10;
+  if (ARROW_PREDICT_FALSE(length > kSafeDigits + 1)) {
+    // Too many digits
+    return false;
+  }
+  const size_t safe_length = std::min(length, kSafeDigits);
+  C_TYPE result = 0;
+  size_t i = 0;
+  for (; i + 8 <= safe_length; i += 8) {
+    uint32_t chunk;
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s + i, &chunk))) {
+      return false;
+    }
+    result = static_cast<C_TYPE>(result * 100000000U + chunk);
+  }
+  for (; i < safe_length; ++i) {
+    const uint8_t digit = ParseDecimalDigit(s[i]);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = static_cast<C_TYPE>(result * 10U + digit);
+  }
+  if (length > kSafeDigits) {
+    const uint8_t digit = ParseDecimalDigit(s[kSafeDigits]);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    if (ARROW_PREDICT_FALSE(result > std::numeric_limits<C_TYPE>::max() / 10U)) {
+      // Overflow
+      return false;
+    }
+    const C_TYPE new_result = static_cast<C_TYPE>(result * 10U + digit);
+    if (ARROW_PREDICT_FALSE(new_result < result)) {
+      // Overflow
+      return false;
+    }
+    result = new_result;
+  }
+  *out = result;
+  return true;
+}
+
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  if (length >= 8) {
+    return ParseUnsignedWide(s, length, out);
+  }
   uint32_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -209,6 +324,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (length >= 8) {
+    return ParseUnsignedWide(s, length, out);
+  }
   uint64_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -239,6 +357,7 @@ inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
   return true;
 }
 
+
 #undef PARSE_UNSIGNED_ITERATION
 #undef PARSE_UNSIGNED_ITERATION_LAST
 
@@ -449,22 +568,16 @@ class StringConverter<TimestampType> {
   }
 
   bool ParseYYYY_MM_DD(const char* s, arrow_vendored::date::year_month_day* out) {
-    uint16_t year;
-    uint8_t month, day;
-    if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 4, &year))) {
+    // "YYYY-MM-DD" is the century followed by "YY-MM-DD"
+    uint8_t century, year, month, day;
+    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 2, &century))) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 5, 2, &month))) {
+    if (ARROW_PREDICT_FALSE(!detail::ParseDigitPairs(s + 2, '-', &year, &month, &day))) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 8, 2, &day))) {
-      return false;
-    }
-    *out = {arrow_vendored::date::year{year}, arrow_vendored::date::month{month},
-            arrow_vendored::date::day{day}};
+    *out = {arrow_vendored::date::year{100 * century + year},
+            arrow_vendored::date::month{month}, arrow_vendored::date::day{day}};
     return out->ok();
   }
 
@@ -503,16 +616,8 @@ class StringConverter<TimestampType> {
 
   bool ParseHH_MM_SS(const char* s, std::chrono::duration<value_type>* out) {
     uint8_t hours, minutes, seconds;
-    if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 2, &hours))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 3, 2, &minutes))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 6, 2, &seconds))) {
+    if (ARROW_PREDICT_FALSE(
+            !detail::ParseDigitPairs(s, ':', &hours, &minutes, &seconds))) {
       return false;
     }
     if (ARROW_PREDICT_FALSE(hours >= 24)) {
@@ -240,10 +240,23 @@ TEST(StringConversion, ToUInt64) {
 
   AssertConversion(converter, "0", 0);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
+  AssertConversion(converter, "12345678", 12345678ULL);
+  AssertConversion(converter, "1234567890123456", 1234567890123456ULL);
+  AssertConversion(converter, "9999999999999999999", 9999999999999999999ULL);
+  AssertConversion(converter, "10000000000000000000", 10000000000000000000ULL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
+  AssertConversionFails(converter, "20000000000000000000");
+  AssertConversionFails(converter, "123456789012345678901");
+
+  // Non-digits in each 8-digit chunk and in the trailing digits
+  AssertConversionFails(converter, "1234567/");
+  AssertConversionFails(converter, "1234:678");
+  AssertConversionFails(converter, "12345678123456 8");
+  AssertConversionFails(converter, "1234567812345678123a");
+  AssertConversionFails(converter, "1234567812345678123\x80");
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
@@ -332,6 +345,14 @@ TEST(StringConversion, ToTimestampDateTime) {
     AssertConversionFails(converter, "1970-01-01 00:00:60");
     AssertConversionFails(converter, "1970-01-01 00:00,00");
     AssertConversionFails(converter, "1970-01-01 00,00:00");
+    AssertConversionFails(converter, "1970-01-01 0a:00:00");
+    AssertConversionFails(converter, "1970-01-01 00:0a:00");
+    AssertConversionFails(converter, "1970-01-01 00:00:0 ");
+    AssertConversionFails(converter, "1970-01-01 00:00:00.");
+    // Invalid digits
+    AssertConversionFails(converter, "197a-01-01 00:00:00");
+    AssertConversionFails(converter, "1970-0/-01 00:00:00");
+    AssertConversionFails(converter, "1970-01-0: 00:00:00");
   }
   {
     StringConverter<TimestampType> converter(timestamp(TimeUnit::MILLI));
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -32,7 +33,16 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_default.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/rle_encoding.h"
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bpacking_avx2.h"
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+#include "arrow/util/bpacking_avx512.h"
+#endif
 
 namespace arrow {
 namespace util {
@@ -533,5 +543,52 @@ TEST(RleDecoder, GetBatchSpaced) {
   }
 }
 
+
+typedef int (*UnpackFunc)(const uint32_t*, uint32_t*, int, int);
+
+// Check an unpack32 implementation against the scalar one, for all bit widths
+void CheckUnpack32(UnpackFunc unpack) {
+  const int kNumValues = 32 * 10;
+  std::vector<uint32_t> packed(kNumValues);
+  std::mt19937 gen(42);
+  for (auto& word : packed) {
+    word = static_cast<uint32_t>(gen());
+  }
+  for (int num_bits = 0; num_bits <= 32; ++num_bits) {
+    SCOPED_TRACE("num_bits = " + std::to_string(num_bits));
+    // Only read the packed data for the given width
+    const std::vector<uint32_t> input(packed.begin(),
+                                      packed.begin() + kNumValues * num_bits / 32);
+    std::vector<uint32_t> expected(kNumValues), actual(kNumValues);
+    ASSERT_EQ(kNumValues, ::arrow::internal::unpack32_default(
+                              input.data(), expected.data(), kNumValues, num_bits));
+    // Trailing values not forming a group of 32 are ignored
+    ASSERT_EQ(kNumValues, unpack(input.data(), actual.data(), kNumValues + 5, num_bits));
+    ASSERT_EQ(expected, actual);
+  }
+}
+
+TEST(BitPacking, Unpack32) { CheckUnpack32(::arrow::internal::unpack32); }
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+TEST(BitPacking, Unpack32AVX2) {
+  if (!::arrow::internal::CpuInfo::GetInstance()->IsSupported(
+          ::arrow::internal::CpuInfo::AVX2)) {
+    return;
+  }
+  CheckUnpack32(::arrow::internal::unpack32_avx2);
+}
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+TEST(BitPacking, Unpack32AVX512) {
+  if (!::arrow::internal::CpuInfo::GetInstance()->IsSupported(
+          ::arrow::internal::CpuInfo::AVX512)) {
+    return;
+  }
+  CheckUnpack32(::arrow::internal::unpack32_avx512);
+}
+#endif
+
 }  // namespace util
 }  // namespace arrow
@@ -20,6 +20,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <mutex>
 #include <utility>
 
@@ -85,20 +87,20 @@ class ThreadedTaskGroup : public TaskGroup {
   }
 
   void AppendReal(std::function<Status()> task) override {
-    // The hot path is unlocked thanks to atomics
-    // Only if an error occurs is the lock taken
+    // The task is queued on the group, and the thread pool is only asked to
+    // pick up a queued task.  This way, a thread waiting in Finish() can run
+    // the remaining tasks itself if all the pool threads are busy (or are
+    // themselves waiting in a nested Finish()).
     if (ok_.load(std::memory_order_acquire)) {
       nremaining_.fetch_add(1, std::memory_order_acquire);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(std::move(task));
+        cv_.notify_one();
+      }
 
       auto self = checked_pointer_cast<ThreadedTaskGroup>(shared_from_this());
-      Status st = thread_pool_->Spawn([self, task]() {
-        if (self->ok_.load(std::memory_order_acquire)) {
-          // XXX what about exceptions?
-          Status st = task();
-          self->UpdateStatus(std::move(st));
-        }
-        self->OneTaskDone();
-      });
+      Status st = thread_pool_->Spawn([self]() { self->RunPendingTask(); });
       UpdateStatus(std::move(st));
     }
   }
@@ -113,7 +115,17 @@ class ThreadedTaskGroup : public TaskGroup {
   Status Finish() override {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!finished_) {
-      cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      while (nremaining_.load() != 0) {
+        if (!pending_.empty()) {
+          // Help instead of blocking a thread
+          lock.unlock();
+          RunPendingTask();
+          lock.lock();
+        } else {
+          cv_.wait(lock,
+                   [&]() { return nremaining_.load() == 0 || !pending_.empty(); });
+        }
+      }
       // Current tasks may start other tasks, so only set this when done
       finished_ = true;
       if (parent_) {
@@ -143,6 +155,25 @@ class ThreadedTaskGroup : public TaskGroup {
     }
   }
 
+  // Must be called unlocked.  Queued tasks are run by whichever comes first
+  // of a pool thread or a thread waiting in Finish().
+  void RunPendingTask() {
+    std::function<Status()> task;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (pending_.empty()) {
+        return;
+      }
+      task = std::move(pending_.front());
+      pending_.pop_front();
+    }
+    if (ok_.load(std::memory_order_acquire)) {
+      // XXX what about exceptions?
+      UpdateStatus(task());
+    }
+    OneTaskDone();
+  }
+
   void OneTaskDone() {
     // Can be called unlocked thanks to atomics
     auto nremaining = nremaining_.fetch_sub(1, std::memory_order_release) - 1;
@@ -166,6 +197,7 @@ class ThreadedTaskGroup : public TaskGroup {
   Status status_;
   bool finished_ = false;
   ThreadedTaskGroup* parent_ = nullptr;
+  std::deque<std::function<Status()>> pending_;
 };
 
 std::shared_ptr<TaskGroup> TaskGroup::MakeSerial() {
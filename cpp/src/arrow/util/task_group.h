@@ -53,6 +53,10 @@ class ARROW_EXPORT TaskGroup : public std::enable_shared_from_this<TaskGroup> {
   /// or for at least one task (or subgroup) to error out.
   /// The returned Status propagates the error status of the first failing
   /// task (or subgroup).
+  ///
+  /// While waiting, the calling thread runs tasks of this group which haven't
+  /// been started yet.  It is therefore safe to call Finish() from a task
+  /// running on the same thread pool, e.g. to nest parallel sections.
   virtual Status Finish() = 0;
 
   /// The current aggregate error Status.  Non-blocking, useful for stopping early.
@@ -212,6 +212,46 @@ void TestTasksSpawnTasks(std::shared_ptr<TaskGroup> task_group) {
   ASSERT_EQ(count.load(), (1 << (N + 1)) - 1);
 }
 
+// Check TaskGroup behaviour with tasks waiting on nested task groups
+void TestNestedTaskGroups(std::function<std::shared_ptr<TaskGroup>()> factory) {
+  const int NOUTER = 8;
+  const int NINNER = 16;
+
+  std::atomic<int> count(0);
+  auto outer_group = factory();
+  for (int i = 0; i < NOUTER; ++i) {
+    outer_group->Append([&]() {
+      auto inner_group = factory();
+      for (int j = 0; j < NINNER; ++j) {
+        inner_group->Append([&]() {
+          sleep_for(1e-4);
+          count++;
+          return Status::OK();
+        });
+      }
+      // Waiting here must not starve the inner tasks of threads
+      return inner_group->Finish();
+    });
+  }
+  ASSERT_OK(outer_group->Finish());
+  ASSERT_EQ(count.load(), NOUTER * NINNER);
+
+  // Errors in inner groups propagate to the outer group
+  outer_group = factory();
+  for (int i = 0; i < NOUTER; ++i) {
+    outer_group->Append([&, i]() {
+      auto inner_group = factory();
+      for (int j = 0; j < NINNER; ++j) {
+        inner_group->Append([i, j]() {
+          return (i == 3 && j == 5) ? Status::Invalid("XXX") : Status::OK();
+        });
+      }
+      return inner_group->Finish();
+    });
+  }
+  ASSERT_RAISES(Invalid, outer_group->Finish());
+}
+
 // A task that keeps recursing until a barrier is set.
 // Using a lambda for this doesn't play well with Thread Sanitizer.
 struct BarrierTask {
@@ -287,6 +327,10 @@ TEST(SerialTaskGroup, Errors) { TestTaskGroupErrors(TaskGroup::MakeSerial()); }
 
 TEST(SerialTaskGroup, TasksSpawnTasks) { TestTasksSpawnTasks(TaskGroup::MakeSerial()); }
 
+TEST(SerialTaskGroup, NestedTaskGroups) {
+  TestNestedTaskGroups([] { return TaskGroup::MakeSerial(); });
+}
+
 TEST(SerialTaskGroup, SubGroupsSuccess) {
   TestTaskSubGroupsSuccess(TaskGroup::MakeSerial());
 }
@@ -314,6 +358,17 @@ TEST(ThreadedTaskGroup, TasksSpawnTasks) {
   TestTasksSpawnTasks(task_group);
 }
 
+TEST(ThreadedTaskGroup, NestedTaskGroups) {
+  // With fewer threads than outer tasks, all pool threads end up waiting
+  // on an inner group
+  for (int capacity : {1, 2, 4}) {
+    std::shared_ptr<ThreadPool> thread_pool;
+    ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::Make(capacity));
+
+    TestNestedTaskGroups([&] { return TaskGroup::MakeThreaded(thread_pool.get()); });
+  }
+}
+
 TEST(ThreadedTaskGroup, SubGroupsSuccess) {
   std::shared_ptr<ThreadPool> thread_pool;
   ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::Make(4));
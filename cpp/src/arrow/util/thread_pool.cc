@@ -18,26 +18,180 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <list>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "arrow/util/bit_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/numa.h"
 
 namespace arrow {
 namespace internal {
 
-struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+namespace {
+
+// A task queue with its own lock.  Each worker owns one, which it pops
+// from the back (most recently pushed tasks first, for cache locality),
+// while other workers steal from the front.
+struct TaskQueue {
+  std::mutex mutex_;
+  std::deque<std::function<void()>> tasks_;
+  // Time the owning worker spent running instrumented tasks
+  std::atomic<int64_t> busy_nanos_{0};
+
+  void PushBack(std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+
+  bool PopBack(std::function<void()>* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tasks_.empty()) {
+      return false;
+    }
+    *out = std::move(tasks_.back());
+    tasks_.pop_back();
+    return true;
+  }
+
+  bool PopFront(std::function<void()>* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tasks_.empty()) {
+      return false;
+    }
+    *out = std::move(tasks_.front());
+    tasks_.pop_front();
+    return true;
+  }
+
+  void MoveTo(TaskQueue* other) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> other_lock(other->mutex_);
+    for (auto& task : tasks_) {
+      other->tasks_.push_back(std::move(task));
+    }
+    tasks_.clear();
+  }
+
+  // Return the number of tasks dropped
+  int64_t Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto num_tasks = static_cast<int64_t>(tasks_.size());
+    tasks_.clear();
+    return num_tasks;
+  }
+};
+
+using Clock = std::chrono::steady_clock;
+
+int64_t NanosBetween(Clock::time_point start, Clock::time_point end) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+int LatencyBucket(int64_t nanos) {
+  const int64_t micros = nanos / 1000;
+  if (micros <= 0) {
+    return 0;
+  }
+  // micros in [2^(i-1), 2^i) => bucket i
+  const int bucket = 64 - BitUtil::CountLeadingZeros(static_cast<uint64_t>(micros));
+  return std::min(bucket, ThreadPoolStats::kNumLatencyBuckets - 1);
+}
+
+struct StatsCounters {
+  std::atomic<bool> enabled{false};
+  std::atomic<int64_t> tasks_submitted{0};
+  std::atomic<int64_t> tasks_completed{0};
+  std::atomic<int64_t> total_wait_nanos{0};
+  std::atomic<int64_t> total_run_nanos{0};
+  std::atomic<int64_t> wait_histogram[ThreadPoolStats::kNumLatencyBuckets];
+  std::atomic<int64_t> run_histogram[ThreadPoolStats::kNumLatencyBuckets];
+
+  StatsCounters() { Reset(); }
+
+  void Reset() {
+    tasks_submitted.store(0);
+    tasks_completed.store(0);
+    total_wait_nanos.store(0);
+    total_run_nanos.store(0);
+    for (int i = 0; i < ThreadPoolStats::kNumLatencyBuckets; ++i) {
+      wait_histogram[i].store(0);
+      run_histogram[i].store(0);
+    }
+  }
+
+  void RecordTask(int64_t wait_nanos, int64_t run_nanos) {
+    total_wait_nanos.fetch_add(wait_nanos, std::memory_order_relaxed);
+    total_run_nanos.fetch_add(run_nanos, std::memory_order_relaxed);
+    wait_histogram[LatencyBucket(wait_nanos)].fetch_add(1, std::memory_order_relaxed);
+    run_histogram[LatencyBucket(run_nanos)].fetch_add(1, std::memory_order_relaxed);
+    // Last, so that a reader seeing a task completed also sees its times
+    tasks_completed.fetch_add(1, std::memory_order_release);
+  }
 
-  // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
-  // such as https://github.com/cameron314/concurrentqueue
+  void Snapshot(ThreadPoolStats* out) const {
+    out->tasks_submitted = tasks_submitted.load();
+    out->tasks_completed = tasks_completed.load();
+    out->total_wait_nanos = total_wait_nanos.load();
+    out->total_run_nanos = total_run_nanos.load();
+    for (int i = 0; i < ThreadPoolStats::kNumLatencyBuckets; ++i) {
+      out->wait_histogram[i] = wait_histogram[i].load();
+      out->run_histogram[i] = run_histogram[i].load();
+    }
+  }
+};
 
+}  // namespace
+
+// The queue of a logical executor (see ThreadPool::MakeExecutor)
+struct ThreadPool::Lane {
+  explicit Lane(int weight) : weight_(weight) {}
+
+  const int weight_;
+  TaskQueue queue_;
+  // Tasks in queue_, and tasks either queued or running
+  std::atomic<int64_t> num_queued_{0};
+  std::atomic<int64_t> num_outstanding_{0};
+  // Running time of the lane's tasks, divided by its weight, in nanoseconds
+  std::atomic<int64_t> vtime_{0};
+  std::atomic<bool> closed_{false};
+
+  // For waiting in Shutdown()
+  std::mutex mutex_;
+  std::condition_variable cv_;
+
+  void TasksDone(int64_t num_tasks) {
+    if (num_outstanding_.fetch_sub(num_tasks) == num_tasks) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv_.notify_all();
+    }
+  }
+};
+
+struct ThreadPool::State {
+  State()
+      : desired_capacity_(0),
+        num_workers_(0),
+        num_pending_(0),
+        num_sleeping_(0),
+        queues_version_(0),
+        please_shutdown_(false),
+        quick_shutdown_(false),
+        node_queues_(GetNumaTopology().num_nodes()),
+        workers_per_node_(GetNumaTopology().num_nodes()) {}
+
+  // The mutex protects the list of workers and the registry of worker queues,
+  // and is used for sleeping and waking up workers.  It is *not* taken when
+  // spawning or running tasks, unless a worker needs to be woken up.
   std::mutex mutex_;
   std::condition_variable cv_;
   std::condition_variable cv_shutdown_;
@@ -45,73 +199,350 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<std::function<void()>> pending_tasks_;
+
+  // Tasks spawned from outside the pool
+  TaskQueue global_queue_;
+  // Queues of live workers, for stealing.  Workers keep a snapshot of this
+  // and refresh it when `queues_version_` changes.
+  std::vector<std::shared_ptr<TaskQueue>> worker_queues_;
+  // Lanes of live logical executors, snapshotted by workers likewise
+  std::vector<std::shared_ptr<Lane>> lanes_;
+  // Virtual time of the tasks spawned directly on the pool, and the largest
+  // virtual time at which a task was started (see Worker::FindTask)
+  std::atomic<int64_t> default_vtime_{0};
+  std::atomic<int64_t> vclock_{0};
 
   // Desired number of threads
-  int desired_capacity_;
+  std::atomic<int> desired_capacity_;
+  // Actual number of threads (same as workers_.size())
+  std::atomic<int> num_workers_;
+  // Number of tasks spawned but not yet started
+  std::atomic<int64_t> num_pending_;
+  // Number of workers waiting (or about to wait) on `cv_`
+  std::atomic<int> num_sleeping_;
+  std::atomic<uint64_t> queues_version_;
   // Are we shutting down?
-  bool please_shutdown_;
-  bool quick_shutdown_;
+  std::atomic<bool> please_shutdown_;
+  std::atomic<bool> quick_shutdown_;
+
+  StatsCounters stats_;
+
+  // Tasks spawned for a given NUMA node, indexed by node
+  std::vector<TaskQueue> node_queues_;
+  // Number of tasks in `node_queues_` (a hint for skipping them)
+  std::atomic<int64_t> num_node_tasks_{0};
+  std::atomic<bool> numa_aware_{false};
+  // Number of workers pinned to each NUMA node
+  std::vector<int> workers_per_node_;
 };
 
-// The worker loop is an independent function so that it can keep running
-// after the ThreadPool is destroyed.
-static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
-                       std::list<std::thread>::iterator it) {
-  std::unique_lock<std::mutex> lock(state->mutex_);
-
-  // Since we hold the lock, `it` now points to the correct thread object
-  // (LaunchWorkersUnlocked has exited)
-  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
-
-  // If too many threads, we should secede from the pool
-  const auto should_secede = [&]() -> bool {
-    return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
-  };
-
-  while (true) {
-    // By the time this thread is started, some tasks may have been pushed
-    // or shutdown could even have been requested.  So we only wait on the
-    // condition variable at the end of the loop.
-
-    // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
-      // We check this opportunistically at each loop iteration since
-      // it releases the lock below.
-      if (should_secede()) {
+namespace {
+
+// The worker (if any) running on the current thread, so that tasks spawned
+// from a worker can be pushed to its local queue.
+struct WorkerContext {
+  const ThreadPool::State* state;
+  TaskQueue* queue;
+  // The NUMA node the worker is pinned to, or -1
+  int node;
+};
+
+thread_local WorkerContext* current_worker = nullptr;
+
+// A task wrapper recording the time spent queued and running
+struct InstrumentedTask {
+  std::function<void()> task;
+  // Kept alive by the worker running the task
+  ThreadPool::State* state;
+  Clock::time_point submit_time;
+
+  void operator()() {
+    const auto start = Clock::now();
+    task();
+    const auto end = Clock::now();
+    const int64_t run_nanos = NanosBetween(start, end);
+    if (current_worker != nullptr) {
+      current_worker->queue->busy_nanos_.fetch_add(run_nanos, std::memory_order_relaxed);
+    }
+    state->stats_.RecordTask(NanosBetween(submit_time, start), run_nanos);
+  }
+};
+
+void AtomicMax(std::atomic<int64_t>* target, int64_t value) {
+  int64_t current = target->load();
+  while (current < value && !target->compare_exchange_weak(current, value)) {
+  }
+}
+
+class Worker {
+ public:
+  using Lane = ThreadPool::Lane;
+
+  Worker(std::shared_ptr<ThreadPool::State> state, std::shared_ptr<TaskQueue> queue)
+      : state_(std::move(state)), queue_(std::move(queue)) {}
+
+  void RefreshSnapshots() {
+    if (victims_version_ != state_->queues_version_.load()) {
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      victims_ = state_->worker_queues_;
+      lanes_ = state_->lanes_;
+      victims_version_ = state_->queues_version_.load();
+      if (state_->numa_aware_.load() != (node_ >= 0)) {
+        UpdateNumaNodeUnlocked();
+      }
+    }
+  }
+
+  // Pin or unpin this worker following the pool's NUMA awareness.
+  // The lock must be held.
+  void UpdateNumaNodeUnlocked() {
+    auto& workers_per_node = state_->workers_per_node_;
+    if (node_ >= 0) {
+      --workers_per_node[node_];
+      ARROW_UNUSED(UnpinCurrentThread());
+      node_ = -1;
+    }
+    if (state_->numa_aware_.load()) {
+      // Join the node with the fewest workers
+      const auto& topology = GetNumaTopology();
+      int node = -1;
+      for (int i = 0; i < topology.num_nodes(); ++i) {
+        if (!topology.node_cpus[i].empty() &&
+            (node < 0 || workers_per_node[i] < workers_per_node[node])) {
+          node = i;
+        }
+      }
+      if (node >= 0 && PinCurrentThreadToNumaNode(node).ok()) {
+        ++workers_per_node[node];
+        node_ = node;
+      }
+    }
+    context_->node = node_;
+  }
+
+  // Find a task to run.  Without logical executors, this is FindPoolTask().
+  // Otherwise, pick the lane (the tasks spawned directly on the pool forming
+  // one, of weight 1) furthest behind its weighted fair share, i.e. with the
+  // lowest virtual time.  As in start-time fair queueing, a lane's virtual
+  // time is never considered lower than the virtual time at which the last
+  // task was started, so that idle lanes don't accumulate credit.
+  bool FindTask(std::function<void()>* out, Lane** out_lane) {
+    RefreshSnapshots();
+    *out_lane = nullptr;
+    if (lanes_.empty()) {
+      return FindPoolTask(out);
+    }
+    const int64_t vclock = state_->vclock_.load();
+    Lane* best = nullptr;
+    int64_t best_vtime = 0;
+    for (const auto& lane : lanes_) {
+      if (lane->num_queued_.load() > 0) {
+        const int64_t vtime = std::max(lane->vtime_.load(), vclock);
+        if (best == nullptr || vtime < best_vtime) {
+          best = lane.get();
+          best_vtime = vtime;
+        }
+      }
+    }
+    // Whether there are tasks spawned directly on the pool isn't known
+    // beforehand, so only look for them if they are due
+    const bool pool_tried =
+        best == nullptr || std::max(state_->default_vtime_.load(), vclock) < best_vtime;
+    if (pool_tried && FindPoolTask(out)) {
+      return true;
+    }
+    if (best != nullptr && PopLaneTask(best, out)) {
+      *out_lane = best;
+      return true;
+    }
+    // Lost a race with another worker, take whatever is available
+    if (!pool_tried && FindPoolTask(out)) {
+      return true;
+    }
+    for (const auto& lane : lanes_) {
+      if (PopLaneTask(lane.get(), out)) {
+        *out_lane = lane.get();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool PopLaneTask(Lane* lane, std::function<void()>* out) {
+    if (lane->queue_.PopFront(out)) {
+      --lane->num_queued_;
+      return true;
+    }
+    return false;
+  }
+
+  // Run a task found by FindTask(), charging its running time to its lane
+  void RunTask(std::function<void()>* task, Lane* lane) {
+    if (lanes_.empty() && lane == nullptr) {
+      (*task)();
+      return;
+    }
+    const auto start = Clock::now();
+    (*task)();
+    const int64_t nanos = NanosBetween(start, Clock::now());
+    *task = nullptr;
+
+    auto* vtime = lane != nullptr ? &lane->vtime_ : &state_->default_vtime_;
+    const int64_t start_tag = std::max(vtime->load(), state_->vclock_.load());
+    AtomicMax(vtime, start_tag);
+    vtime->fetch_add(nanos / (lane != nullptr ? lane->weight_ : 1));
+    AtomicMax(&state_->vclock_, start_tag);
+    if (lane != nullptr) {
+      lane->TasksDone(1);
+    }
+  }
+
+  // Find a task spawned directly on the pool, trying in order the local
+  // queue, the queue of our NUMA node, the global queue, the other workers'
+  // queues and the queues of the other NUMA nodes.
+  bool FindPoolTask(std::function<void()>* out) {
+    if (queue_->PopBack(out) || (node_ >= 0 && PopNodeTask(node_, out)) ||
+        state_->global_queue_.PopFront(out)) {
+      return true;
+    }
+    const size_t num_victims = victims_.size();
+    for (size_t i = 0; i < num_victims; ++i) {
+      // Start from a different victim every time to spread the stealing
+      auto& victim = victims_[(next_victim_ + i) % num_victims];
+      if (victim != queue_ && victim->PopFront(out)) {
+        next_victim_ = next_victim_ + i + 1;
+        return true;
+      }
+    }
+    const int num_nodes = static_cast<int>(state_->node_queues_.size());
+    for (int node = 0; node < num_nodes; ++node) {
+      if (PopNodeTask(node, out)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool PopNodeTask(int node, std::function<void()>* out) {
+    if (state_->num_node_tasks_.load() > 0 && state_->node_queues_[node].PopFront(out)) {
+      --state_->num_node_tasks_;
+      return true;
+    }
+    return false;
+  }
+
+  bool ShouldSecede() const {
+    return state_->num_workers_.load() > state_->desired_capacity_.load();
+  }
+
+  // The worker loop is run by an independent object so that it can keep running
+  // after the ThreadPool is destroyed.
+  void Run(std::list<std::thread>::iterator it) {
+    WorkerContext context{state_.get(), queue_.get(), -1};
+    context_ = &context;
+    current_worker = &context;
+
+    {
+      // Since we take the lock, `it` now points to the correct thread object
+      // (LaunchWorkersUnlocked has exited)
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+    }
+
+    std::function<void()> task;
+    Lane* lane;
+    std::unique_lock<std::mutex> lock(state_->mutex_, std::defer_lock);
+    while (true) {
+      // By the time this thread is started, some tasks may have been pushed
+      // or shutdown could even have been requested.  So we only sleep at
+      // the end of the loop.
+
+      // Execute pending tasks if any
+      while (!state_->quick_shutdown_.load() && !ShouldSecede() &&
+             FindTask(&task, &lane)) {
+        --state_->num_pending_;
+        RunTask(&task, lane);
+        // Release any resources held by the task outside of the loop condition
+        task = nullptr;
+      }
+
+      lock.lock();
+      // Check for exit with the lock held, since the number of workers
+      // can only change under the lock
+      if (state_->workers_.size() > static_cast<size_t>(state_->desired_capacity_)) {
+        break;
+      }
+      if (state_->please_shutdown_ &&
+          (state_->quick_shutdown_ || state_->num_pending_.load() == 0)) {
         break;
       }
-      {
-        std::function<void()> task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
+      // Wait for next wakeup.  A spawner increments `num_pending_` before
+      // reading `num_sleeping_`, while we increment `num_sleeping_` before
+      // reading `num_pending_`, so that either we see the new task, or the
+      // spawner sees us sleeping and notifies us (it needs the lock to do so,
+      // so the notification can't happen before we start waiting).
+      ++state_->num_sleeping_;
+      if (state_->num_pending_.load() == 0 && !state_->please_shutdown_) {
+        state_->cv_.wait(lock);
+      } else {
+        // A task was reserved but isn't visible in a queue yet, or shutdown
+        // is in progress while some tasks are still pending
         lock.unlock();
-        task();
+        std::this_thread::yield();
+        lock.lock();
       }
-      lock.lock();
+      --state_->num_sleeping_;
+      lock.unlock();
+    }
+
+    // We're done (the lock is held).  Hand our remaining tasks over to
+    // the other workers.
+    for (auto qit = state_->worker_queues_.begin(); qit != state_->worker_queues_.end();
+         ++qit) {
+      if (*qit == queue_) {
+        state_->worker_queues_.erase(qit);
+        break;
+      }
+    }
+    ++state_->queues_version_;
+    queue_->MoveTo(&state_->global_queue_);
+    if (node_ >= 0) {
+      --state_->workers_per_node_[node_];
     }
-    // Now either the queue is empty *or* a quick shutdown was requested
-    if (state->please_shutdown_ || should_secede()) {
-      break;
+    if (state_->num_pending_.load() > 0) {
+      state_->cv_.notify_one();
+    }
+    current_worker = nullptr;
+
+    // Move our thread object to the trashcan of finished
+    // workers.  This has two motivations:
+    // 1) the thread object doesn't get destroyed before this function finishes
+    //    (but we could call thread::detach() instead)
+    // 2) we can explicitly join() the trashcan threads to make sure all OS threads
+    //    are exited before the ThreadPool is destroyed.  Otherwise subtle
+    //    timing conditions can lead to false positives with Valgrind.
+    DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+    state_->finished_workers_.push_back(std::move(*it));
+    state_->workers_.erase(it);
+    --state_->num_workers_;
+    if (state_->please_shutdown_) {
+      // Notify the function waiting in Shutdown().
+      state_->cv_shutdown_.notify_one();
     }
-    // Wait for next wakeup
-    state->cv_.wait(lock);
   }
 
-  // We're done.  Move our thread object to the trashcan of finished
-  // workers.  This has two motivations:
-  // 1) the thread object doesn't get destroyed before this function finishes
-  //    (but we could call thread::detach() instead)
-  // 2) we can explicitly join() the trashcan threads to make sure all OS threads
-  //    are exited before the ThreadPool is destroyed.  Otherwise subtle
-  //    timing conditions can lead to false positives with Valgrind.
-  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
-  state->finished_workers_.push_back(std::move(*it));
-  state->workers_.erase(it);
-  if (state->please_shutdown_) {
-    // Notify the function waiting in Shutdown().
-    state->cv_shutdown_.notify_one();
-  }
-}
+ private:
+  std::shared_ptr<ThreadPool::State> state_;
+  std::shared_ptr<TaskQueue> queue_;
+  std::vector<std::shared_ptr<TaskQueue>> victims_;
+  std::vector<std::shared_ptr<Lane>> lanes_;
+  uint64_t victims_version_ = static_cast<uint64_t>(-1);
+  size_t next_victim_ = 0;
+  WorkerContext* context_ = nullptr;
+  int node_ = -1;
+};
+
+}  // namespace
 
 ThreadPool::ThreadPool()
     : sp_state_(std::make_shared<ThreadPool::State>()),
@@ -129,6 +560,19 @@ ThreadPool::~ThreadPool() {
 }
 
 void ThreadPool::ProtectAgainstFork() {
+  if (parent_ != nullptr) {
+    // Follow the parent's reinitialization, with a fresh lane
+    parent_->ProtectAgainstFork();
+    if (sp_state_ != parent_->sp_state_) {
+      sp_state_ = parent_->sp_state_;
+      state_ = sp_state_.get();
+      lane_ = std::make_shared<Lane>(lane_->weight_);
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      state_->lanes_.push_back(lane_);
+      ++state_->queues_version_;
+    }
+    return;
+  }
 #ifndef _WIN32
   pid_t current_pid = getpid();
   if (pid_ != current_pid) {
@@ -139,8 +583,10 @@ void ThreadPool::ProtectAgainstFork() {
     int capacity = state_->desired_capacity_;
 
     auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
-    new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->please_shutdown_.store(state_->please_shutdown_.load());
+    new_state->quick_shutdown_.store(state_->quick_shutdown_.load());
+    new_state->stats_.enabled.store(state_->stats_.enabled.load());
+    new_state->numa_aware_.store(state_->numa_aware_.load());
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -156,6 +602,9 @@ void ThreadPool::ProtectAgainstFork() {
 
 Status ThreadPool::SetCapacity(int threads) {
   ProtectAgainstFork();
+  if (lane_ != nullptr) {
+    return Status::Invalid("Cannot change the capacity of a logical executor");
+  }
   std::unique_lock<std::mutex> lock(state_->mutex_);
   if (state_->please_shutdown_) {
     return Status::Invalid("operation forbidden during or after shutdown");
@@ -190,6 +639,9 @@ int ThreadPool::GetActualCapacity() {
 
 Status ThreadPool::Shutdown(bool wait) {
   ProtectAgainstFork();
+  if (lane_ != nullptr) {
+    return ShutdownLane(wait);
+  }
   std::unique_lock<std::mutex> lock(state_->mutex_);
 
   if (state_->please_shutdown_) {
@@ -200,14 +652,123 @@ Status ThreadPool::Shutdown(bool wait) {
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
-    DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->num_pending_.load(), 0);
   } else {
-    state_->pending_tasks_.clear();
+    // All worker queues were handed over to the global queue
+    state_->global_queue_.Clear();
+    for (auto& queue : state_->node_queues_) {
+      queue.Clear();
+    }
+    state_->num_node_tasks_ = 0;
+    for (const auto& lane : state_->lanes_) {
+      const int64_t num_dropped = lane->queue_.Clear();
+      lane->num_queued_ -= num_dropped;
+      lane->TasksDone(num_dropped);
+    }
+    state_->num_pending_ = 0;
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
 }
 
+void ThreadPool::SetInstrumentationEnabled(bool enabled) {
+  ProtectAgainstFork();
+  state_->stats_.enabled.store(enabled);
+}
+
+bool ThreadPool::instrumentation_enabled() const {
+  return state_->stats_.enabled.load();
+}
+
+ThreadPoolStats ThreadPool::GetStats() {
+  ProtectAgainstFork();
+  ThreadPoolStats stats;
+  state_->stats_.Snapshot(&stats);
+  stats.queue_length = std::max<int64_t>(0, state_->num_pending_.load());
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  for (const auto& queue : state_->worker_queues_) {
+    stats.worker_busy_nanos.push_back(queue->busy_nanos_.load());
+  }
+  return stats;
+}
+
+void ThreadPool::ResetStats() {
+  ProtectAgainstFork();
+  state_->stats_.Reset();
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  for (const auto& queue : state_->worker_queues_) {
+    queue->busy_nanos_.store(0);
+  }
+}
+
+Status ThreadPool::SetNumaAware(bool enabled) {
+  ProtectAgainstFork();
+  if (lane_ != nullptr) {
+    return Status::Invalid("Cannot change the NUMA awareness of a logical executor");
+  }
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  if (state_->please_shutdown_) {
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  // Have the workers pick up the change, including the sleeping ones
+  state_->numa_aware_.store(enabled);
+  ++state_->queues_version_;
+  state_->cv_.notify_all();
+  return Status::OK();
+}
+
+bool ThreadPool::numa_aware() const { return state_->numa_aware_.load(); }
+
+int ThreadPool::NumaNodeOf(const void* address) {
+  auto maybe_node = GetNumaNodeOfAddress(address);
+  return maybe_node.ok() ? *maybe_node : -1;
+}
+
+Status ThreadPool::ShutdownLane(bool wait) {
+  if (lane_->closed_.exchange(true)) {
+    return Status::Invalid("Shutdown() already called");
+  }
+  if (!wait) {
+    std::function<void()> task;
+    while (lane_->queue_.PopFront(&task)) {
+      --lane_->num_queued_;
+      --state_->num_pending_;
+      lane_->TasksDone(1);
+    }
+  }
+  {
+    std::unique_lock<std::mutex> lock(lane_->mutex_);
+    lane_->cv_.wait(lock, [this] { return lane_->num_outstanding_.load() == 0; });
+  }
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  auto& lanes = state_->lanes_;
+  lanes.erase(std::remove(lanes.begin(), lanes.end(), lane_), lanes.end());
+  ++state_->queues_version_;
+  return Status::OK();
+}
+
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeExecutor(int weight) {
+  ProtectAgainstFork();
+  if (lane_ != nullptr) {
+    return Status::Invalid("Cannot make an executor of a logical executor");
+  }
+  if (weight <= 0) {
+    return Status::Invalid("Executor weight must be > 0");
+  }
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  if (state_->please_shutdown_) {
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  auto executor = std::shared_ptr<ThreadPool>(new ThreadPool());
+  executor->sp_state_ = sp_state_;
+  executor->state_ = state_;
+  executor->parent_ = this;
+  executor->lane_ = std::make_shared<Lane>(weight);
+  state_->lanes_.push_back(executor->lane_);
+  ++state_->queues_version_;
+  return executor;
+}
+
 void ThreadPool::CollectFinishedWorkersUnlocked() {
   for (auto& thread : state_->finished_workers_) {
     // Make sure OS thread has exited
@@ -220,32 +781,101 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   std::shared_ptr<State> state = sp_state_;
 
   for (int i = 0; i < threads; i++) {
+    auto queue = std::make_shared<TaskQueue>();
+    state_->worker_queues_.push_back(queue);
     state_->workers_.emplace_back();
+    ++state_->num_workers_;
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    *it = std::thread([state, queue, it] { Worker(state, queue).Run(it); });
   }
+  ++state_->queues_version_;
 }
 
-Status ThreadPool::SpawnReal(std::function<void()> task) {
-  {
-    ProtectAgainstFork();
-    std::lock_guard<std::mutex> lock(state_->mutex_);
-    if (state_->please_shutdown_) {
+Status ThreadPool::SpawnReal(std::function<void()> task, int node) {
+  ProtectAgainstFork();
+  // Reserve the task before checking for shutdown, so that workers don't
+  // exit until it has run (see the worker loop)
+  ++state_->num_pending_;
+  if (state_->please_shutdown_) {
+    --state_->num_pending_;
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  if (lane_ != nullptr) {
+    // Same dance as above, against ShutdownLane()
+    ++lane_->num_outstanding_;
+    if (lane_->closed_) {
+      --state_->num_pending_;
+      lane_->TasksDone(1);
       return Status::Invalid("operation forbidden during or after shutdown");
     }
-    CollectFinishedWorkersUnlocked();
-    state_->pending_tasks_.push_back(std::move(task));
   }
-  state_->cv_.notify_one();
+  if (state_->stats_.enabled.load(std::memory_order_relaxed)) {
+    state_->stats_.tasks_submitted.fetch_add(1, std::memory_order_relaxed);
+    task = InstrumentedTask{std::move(task), state_, Clock::now()};
+  }
+  if (lane_ != nullptr) {
+    ++lane_->num_queued_;
+    lane_->queue_.PushBack(std::move(task));
+  } else if (current_worker != nullptr && current_worker->state == state_ &&
+             (node < 0 || node == current_worker->node)) {
+    // Spawned from one of our workers, keep the task local
+    current_worker->queue->PushBack(std::move(task));
+  } else if (node >= 0 && node < static_cast<int>(state_->node_queues_.size())) {
+    // Count the task first, so that it can't be missed by workers
+    ++state_->num_node_tasks_;
+    state_->node_queues_[node].PushBack(std::move(task));
+  } else {
+    state_->global_queue_.PushBack(std::move(task));
+  }
+  if (state_->num_sleeping_.load() > 0) {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    state_->cv_.notify_one();
+  }
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Instrumentation
+
+constexpr int ThreadPoolStats::kNumLatencyBuckets;
+
+std::string ThreadPoolStats::ToString() const {
+  std::stringstream ss;
+  ss << "Tasks: " << tasks_submitted << " submitted, " << tasks_completed
+     << " completed, " << queue_length << " queued\n";
+  ss << "Wait: " << total_wait_nanos / 1000 << " us";
+  if (tasks_completed > 0) {
+    ss << " (" << total_wait_nanos / tasks_completed / 1000 << " us avg)";
+  }
+  ss << "\nRun: " << total_run_nanos / 1000 << " us";
+  if (tasks_completed > 0) {
+    ss << " (" << total_run_nanos / tasks_completed / 1000 << " us avg)";
+  }
+  ss << "\nWorker busy times (us):";
+  for (const auto nanos : worker_busy_nanos) {
+    ss << " " << nanos / 1000;
+  }
+  return ss.str();
+}
+
 Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
   auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
   RETURN_NOT_OK(pool->SetCapacity(threads));
   return pool;
 }
 
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
+  ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
+  // On Windows, the global ThreadPool destructor may be called after
+  // non-main threads have been killed by the OS, and hang in a condition
+  // variable.
+  // On Unix, we want to avoid leak reports by Valgrind.
+#ifdef _WIN32
+  pool->shutdown_on_destroy_ = false;
+#endif
+  return pool;
+}
+
 // ----------------------------------------------------------------------
 // Global thread pool
 
@@ -288,15 +918,7 @@ int ThreadPool::DefaultCapacity() {
 
 // Helper for the singleton pattern
 std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
-  std::shared_ptr<ThreadPool> pool = *ThreadPool::Make(ThreadPool::DefaultCapacity());
-  // On Windows, the global ThreadPool destructor may be called after
-  // non-main threads have been killed by the OS, and hang in a condition
-  // variable.
-  // On Unix, we want to avoid leak reports by Valgrind.
-#ifdef _WIN32
-  pool->shutdown_on_destroy_ = false;
-#endif
-  return pool;
+  return *ThreadPool::MakeEternal(ThreadPool::DefaultCapacity());
 }
 
 ThreadPool* GetCpuThreadPool() {
@@ -24,14 +24,15 @@
 
 #include <cstdlib>
 #include <functional>
-#include <future>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -58,26 +59,65 @@ namespace internal {
 
 namespace detail {
 
-// Needed because std::packaged_task is not copyable and hence not convertible
-// to std::function.
-template <typename R, typename... Args>
-struct packaged_task_wrapper {
-  using PackagedTask = std::packaged_task<R(Args...)>;
+// Needed because std::function requires copyable callables, while tasks
+// (e.g. a bound move-only argument) may be move-only.
+template <typename Fn>
+struct SharedTask {
+  explicit SharedTask(Fn&& fn) : fn_(std::make_shared<Fn>(std::move(fn))) {}
 
-  explicit packaged_task_wrapper(PackagedTask&& task)
-      : task_(std::make_shared<PackagedTask>(std::forward<PackagedTask>(task))) {}
-
-  void operator()(Args&&... args) { return (*task_)(std::forward<Args>(args)...); }
-  std::shared_ptr<PackagedTask> task_;
+  void operator()() { (*fn_)(); }
+  std::shared_ptr<Fn> fn_;
 };
 
 }  // namespace detail
 
+/// \brief Statistics gathered by a ThreadPool with instrumentation enabled
+struct ARROW_EXPORT ThreadPoolStats {
+  /// The number of histogram buckets
+  static constexpr int kNumLatencyBuckets = 32;
+
+  /// Tasks spawned and finished while instrumentation was enabled
+  int64_t tasks_submitted = 0;
+  int64_t tasks_completed = 0;
+  /// Tasks spawned but not yet started, at the time of the snapshot.
+  /// This is tracked even with instrumentation disabled.
+  int64_t queue_length = 0;
+  /// Total time tasks spent queued and running, in nanoseconds
+  int64_t total_wait_nanos = 0;
+  int64_t total_run_nanos = 0;
+
+  /// \brief Histograms of the times tasks spent queued and running
+  ///
+  /// Bucket 0 counts tasks under one microsecond, bucket i > 0 counts tasks
+  /// lasting [2^(i-1), 2^i) microseconds.  The last bucket is open-ended.
+  std::vector<int64_t> wait_histogram = std::vector<int64_t>(kNumLatencyBuckets);
+  std::vector<int64_t> run_histogram = std::vector<int64_t>(kNumLatencyBuckets);
+
+  /// Time each live worker spent running tasks, in nanoseconds
+  std::vector<int64_t> worker_busy_nanos;
+
+  /// \brief A human-readable summary
+  std::string ToString() const;
+};
+
+// A thread pool with work stealing.
+//
+// Each worker has its own task queue.  Tasks spawned from a worker go to that
+// worker's queue, which it runs most-recent first for cache locality; other
+// tasks go to a shared queue.  Idle workers steal from the other workers'
+// queues, oldest tasks first.
+//
+// The workers can be shared between several logical executors, see
+// MakeExecutor().
 class ARROW_EXPORT ThreadPool {
  public:
   // Construct a thread pool with the given number of worker threads
   static Result<std::shared_ptr<ThreadPool>> Make(int threads);
 
+  // Like Make(), but takes care that the returned ThreadPool is compatible
+  // with destruction late at process exit (e.g. for a global singleton).
+  static Result<std::shared_ptr<ThreadPool>> MakeEternal(int threads);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -91,6 +131,20 @@ class ARROW_EXPORT ThreadPool {
   // thread count is fully adjusted.
   Status SetCapacity(int threads);
 
+  // Create a logical executor running its tasks on this pool's workers.
+  //
+  // Each executor has its own task queue.  Idle workers pick tasks so that
+  // every executor, and the tasks spawned directly on this pool (with a
+  // weight of 1), get a share of the workers' running time proportional to
+  // its weight.  Tasks aren't preempted, so the sharing is only as fine as
+  // the tasks are short.
+  //
+  // The returned ThreadPool can be used wherever a ThreadPool is expected.
+  // Its capacity is this pool's and can't be changed; shutting it down
+  // (or destroying it) only affects its own tasks.  It must not outlive
+  // this pool.
+  Result<std::shared_ptr<ThreadPool>> MakeExecutor(int weight);
+
   // Heuristic for the default capacity of a thread pool for CPU-bound tasks.
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
@@ -102,31 +156,67 @@ class ARROW_EXPORT ThreadPool {
   // tasks are finished.
   Status Shutdown(bool wait = true);
 
+  // Enable or disable gathering statistics about the tasks run by the pool.
+  // Instrumentation is disabled by default; when enabled, each task pays
+  // for a couple of clock reads and atomic increments.
+  void SetInstrumentationEnabled(bool enabled);
+  bool instrumentation_enabled() const;
+
+  // Return a snapshot of the statistics gathered so far
+  ThreadPoolStats GetStats();
+
+  // Reset the statistics to zero
+  void ResetStats();
+
+  // Enable or disable NUMA awareness.  When enabled, each worker is pinned
+  // to the CPUs of a NUMA node, the workers being spread evenly across the
+  // nodes, and looks for tasks spawned for its node (see SpawnOnNode())
+  // before any other.  Disabled by default; this is a no-op on machines
+  // with a single NUMA node.
+  Status SetNumaAware(bool enabled);
+  bool numa_aware() const;
+
   // Spawn a fire-and-forget task on one of the workers.
+  // No guarantee is made about the order in which tasks are run.
   template <typename Function>
   Status Spawn(Function&& func) {
     return SpawnReal(std::forward<Function>(func));
   }
 
+  // Spawn a fire-and-forget task, preferably on a worker of the given NUMA
+  // node.  Any idle worker may still run the task, rather than leaving it
+  // waiting.  On a logical executor, this is the same as Spawn().
+  template <typename Function>
+  Status SpawnOnNode(int node, Function&& func) {
+    return SpawnReal(std::forward<Function>(func), node);
+  }
+
+  // Spawn a fire-and-forget task, preferably on a worker of the NUMA node
+  // holding the memory at the given address (e.g. the task's input data).
+  template <typename Function>
+  Status SpawnNear(const void* address, Function&& func) {
+    return SpawnReal(std::forward<Function>(func), NumaNodeOf(address));
+  }
+
   // Submit a callable and arguments for execution.  Return a future that
-  // will return the callable's result value once.
+  // will be marked finished with the callable's result value.
   // The callable's arguments are copied before execution.
+  //
+  // A callable returning void or Status gives a Future<>, one returning
+  // Result<T> or T gives a Future<T>.
   template <typename Function, typename... Args,
-            typename RetType = typename std::result_of<Function && (Args && ...)>::type>
-  Result<std::future<RetType>> Submit(Function&& func, Args&&... args) {
-    // Trying to templatize std::packaged_task with Function doesn't seem
-    // to work, so go through std::bind to simplify the packaged signature
-    using PackagedTask = std::packaged_task<RetType()>;
-    auto task = PackagedTask(
-        std::bind(std::forward<Function>(func), std::forward<Args>(args)...));
-    auto fut = task.get_future();
-
-    ARROW_RETURN_NOT_OK(
-        SpawnReal(detail::packaged_task_wrapper<RetType>(std::move(task))));
-    return std::move(fut);
+            typename FutureType = ::arrow::detail::ContinueFuture::ForSignature<
+                Function && (Args && ...)>>
+  Result<FutureType> Submit(Function&& func, Args&&... args) {
+    auto future = FutureType::Make();
+    auto task = std::bind(::arrow::detail::ContinueFuture{}, future,
+                          std::forward<Function>(func), std::forward<Args>(args)...);
+    ARROW_RETURN_NOT_OK(SpawnReal(detail::SharedTask<decltype(task)>(std::move(task))));
+    return future;
   }
 
   struct State;
+  struct Lane;
 
  protected:
   FRIEND_TEST(TestThreadPool, SetCapacity);
@@ -137,7 +227,9 @@ class ARROW_EXPORT ThreadPool {
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
-  Status SpawnReal(std::function<void()> task);
+  Status SpawnReal(std::function<void()> task, int node = -1);
+  static int NumaNodeOf(const void* address);
+  Status ShutdownLane(bool wait);
   // Collect finished worker threads, making sure the OS threads have exited
   void CollectFinishedWorkersUnlocked();
   // Launch a given number of additional workers
@@ -152,6 +244,9 @@ class ARROW_EXPORT ThreadPool {
   std::shared_ptr<State> sp_state_;
   State* state_;
   bool shutdown_on_destroy_;
+  // For logical executors only
+  ThreadPool* parent_ = NULLPTR;
+  std::shared_ptr<Lane> lane_;
 #ifndef _WIN32
   pid_t pid_;
 #endif
@@ -74,7 +74,7 @@ struct Task {
 };
 
 // Benchmark ThreadPool::Spawn
-static void ThreadPoolSpawn(benchmark::State& state) {
+static void ThreadPoolSpawnImpl(benchmark::State& state, bool instrumented) {
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
 
@@ -83,10 +83,12 @@ static void ThreadPoolSpawn(benchmark::State& state) {
   // Spawn enough tasks to make the pool start up overhead negligible
   const int32_t nspawns = 200000000 / workload_size + 1;
 
+  ThreadPoolStats stats;
   for (auto _ : state) {
     state.PauseTiming();
     std::shared_ptr<ThreadPool> pool;
     pool = *ThreadPool::Make(nthreads);
+    pool->SetInstrumentationEnabled(instrumented);
     state.ResumeTiming();
 
     for (int32_t i = 0; i < nspawns; ++i) {
@@ -97,10 +99,26 @@ static void ThreadPoolSpawn(benchmark::State& state) {
     // Wait for all tasks to finish
     ABORT_NOT_OK(pool->Shutdown(true /* wait */));
     state.PauseTiming();
+    stats = pool->GetStats();
     pool.reset();
     state.ResumeTiming();
   }
   state.SetItemsProcessed(state.iterations() * nspawns);
+  if (instrumented && stats.tasks_completed > 0) {
+    state.counters["avg_wait_us"] =
+        static_cast<double>(stats.total_wait_nanos) / stats.tasks_completed / 1000;
+    state.counters["avg_run_us"] =
+        static_cast<double>(stats.total_run_nanos) / stats.tasks_completed / 1000;
+  }
+}
+
+static void ThreadPoolSpawn(benchmark::State& state) {
+  ThreadPoolSpawnImpl(state, /*instrumented=*/false);
+}
+
+// Same, with instrumentation enabled to measure its overhead
+static void ThreadPoolSpawnInstrumented(benchmark::State& state) {
+  ThreadPoolSpawnImpl(state, /*instrumented=*/true);
 }
 
 // Benchmark serial TaskGroup
@@ -189,6 +207,7 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(ThreadPoolSpawnInstrumented)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 
 }  // namespace internal
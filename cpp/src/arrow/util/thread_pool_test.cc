@@ -21,12 +21,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
-#include <future>
 #include <memory>
 #include <string>
 #include <thread>
@@ -38,6 +38,8 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/numa.h"
+#include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
@@ -264,34 +266,275 @@ TEST_F(TestThreadPool, SetCapacity) {
   ASSERT_OK(pool->Shutdown());
 }
 
+TEST_F(TestThreadPool, SpawnFromWorkers) {
+  // Tasks recursively spawning other tasks (tree fan-out)
+  auto pool = this->MakeThreadPool(4);
+  std::atomic<int> num_run(0);
+  std::function<void(int)> fan_out = [&](int depth) {
+    ++num_run;
+    if (depth > 0) {
+      for (int i = 0; i < 4; ++i) {
+        ASSERT_OK(pool->Spawn([&fan_out, depth] { fan_out(depth - 1); }));
+      }
+    }
+  };
+  const int expected = 1 + 4 + 16 + 64 + 256 + 1024;
+  ASSERT_OK(pool->Spawn([&] { fan_out(5); }));
+  busy_wait(5.0, [&] { return num_run.load() == expected; });
+  ASSERT_EQ(num_run.load(), expected);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, StealWork) {
+  // A worker spawns tasks to its local queue, then blocks until they are
+  // run: the other workers need to steal them.
+  auto pool = this->MakeThreadPool(3);
+  std::atomic<int> num_done(0);
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([&] {
+    for (int i = 0; i < 20; ++i) {
+      ARROW_UNUSED(pool->Spawn([&] {
+        sleep_for(0.001);
+        ++num_done;
+      }));
+    }
+    busy_wait(5.0, [&] { return num_done.load() == 20; });
+    return num_done.load();
+  }));
+  ASSERT_OK_AND_EQ(20, fut.result());
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, NumaAware) {
+  const int num_nodes = GetNumaTopology().num_nodes();
+  auto pool = this->MakeThreadPool(4);
+  ASSERT_FALSE(pool->numa_aware());
+
+  auto spawn_all = [&](std::atomic<int>* num_done) {
+    std::vector<uint8_t> data(4096, 1);
+    for (int i = 0; i < 10; ++i) {
+      for (int node = -1; node <= num_nodes; ++node) {
+        ASSERT_OK(pool->SpawnOnNode(node, [=] { ++*num_done; }));
+      }
+      ASSERT_OK(pool->SpawnNear(data.data(), [=] { ++*num_done; }));
+    }
+  };
+  const int expected = 10 * (num_nodes + 3);
+
+  // Without NUMA awareness, tasks for a node still get run
+  std::atomic<int> num_done(0);
+  spawn_all(&num_done);
+  busy_wait(5.0, [&] { return num_done.load() == expected; });
+  ASSERT_EQ(num_done.load(), expected);
+
+  ASSERT_OK(pool->SetNumaAware(true));
+  ASSERT_TRUE(pool->numa_aware());
+  num_done = 0;
+  spawn_all(&num_done);
+  busy_wait(5.0, [&] { return num_done.load() == expected; });
+  ASSERT_EQ(num_done.load(), expected);
+
+  // Tasks spawned from workers for a node are run as well
+  num_done = 0;
+  for (int node = 0; node < num_nodes; ++node) {
+    ASSERT_OK(pool->SpawnOnNode(node, [&, node] {
+      for (int i = 0; i < 10; ++i) {
+        ARROW_UNUSED(pool->SpawnOnNode((node + i) % num_nodes, [&] { ++num_done; }));
+      }
+    }));
+  }
+  busy_wait(5.0, [&] { return num_done.load() == 10 * num_nodes; });
+  ASSERT_EQ(num_done.load(), 10 * num_nodes);
+
+  ASSERT_OK(pool->SetNumaAware(false));
+  ASSERT_FALSE(pool->numa_aware());
+  ASSERT_OK_AND_ASSIGN(auto executor, pool->MakeExecutor(1));
+  ASSERT_RAISES(Invalid, executor->SetNumaAware(true));
+  ASSERT_OK_AND_ASSIGN(auto fut, executor->Submit([] { return 42; }));
+  ASSERT_OK_AND_EQ(42, fut.result());
+  ASSERT_OK(executor->Shutdown());
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_RAISES(Invalid, pool->SetNumaAware(true));
+}
+
+TEST_F(TestThreadPool, Instrumentation) {
+  auto pool = this->MakeThreadPool(2);
+  ASSERT_FALSE(pool->instrumentation_enabled());
+
+  // Tasks aren't counted while instrumentation is disabled
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(sleep_for, 0.001));
+  ASSERT_OK(fut.status());
+  auto stats = pool->GetStats();
+  ASSERT_EQ(stats.tasks_submitted, 0);
+  ASSERT_EQ(stats.tasks_completed, 0);
+
+  pool->SetInstrumentationEnabled(true);
+  ASSERT_TRUE(pool->instrumentation_enabled());
+  std::atomic<bool> release(false);
+  std::atomic<int> num_done(0);
+  // Block both workers, so that further tasks are queued.  The blocking tasks
+  // may be released before they ran 2 ms, so they sleep as long afterwards.
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      busy_wait(5.0, [&] { return release.load(); });
+      sleep_for(0.002);
+      ++num_done;
+    }));
+  }
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      sleep_for(0.002);
+      ++num_done;
+    }));
+  }
+  busy_wait(5.0, [&] { return pool->GetStats().queue_length == 8; });
+  stats = pool->GetStats();
+  ASSERT_EQ(stats.tasks_submitted, 10);
+  ASSERT_EQ(stats.queue_length, 8);
+
+  release.store(true);
+  busy_wait(5.0, [&] { return pool->GetStats().tasks_completed == 10; });
+  stats = pool->GetStats();
+  ASSERT_EQ(num_done.load(), 10);
+  ASSERT_EQ(stats.tasks_completed, 10);
+  ASSERT_EQ(stats.queue_length, 0);
+  // The queued tasks waited at least for the blocking tasks, and all tasks
+  // ran at least 2 ms
+  ASSERT_GE(stats.total_wait_nanos, 8 * 2000000);
+  ASSERT_GE(stats.total_run_nanos, 10 * 2000000);
+  int64_t total_waits = 0, total_runs = 0;
+  for (int i = 0; i < ThreadPoolStats::kNumLatencyBuckets; ++i) {
+    total_waits += stats.wait_histogram[i];
+    total_runs += stats.run_histogram[i];
+  }
+  ASSERT_EQ(total_waits, 10);
+  ASSERT_EQ(total_runs, 10);
+  // Tasks under 2048 us fall in bucket 11 or lower
+  for (int i = 0; i < 11; ++i) {
+    ASSERT_EQ(stats.run_histogram[i], 0);
+  }
+  ASSERT_EQ(stats.worker_busy_nanos.size(), 2);
+  ASSERT_EQ(stats.worker_busy_nanos[0] + stats.worker_busy_nanos[1],
+            stats.total_run_nanos);
+  ASSERT_NE(stats.ToString().find("10 completed"), std::string::npos);
+
+  pool->ResetStats();
+  stats = pool->GetStats();
+  ASSERT_EQ(stats.tasks_submitted, 0);
+  ASSERT_EQ(stats.tasks_completed, 0);
+  ASSERT_EQ(stats.total_run_nanos, 0);
+  ASSERT_EQ(stats.worker_busy_nanos[0] + stats.worker_busy_nanos[1], 0);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, Executor) {
+  auto pool = this->MakeThreadPool(3);
+  ASSERT_OK_AND_ASSIGN(auto executor, pool->MakeExecutor(2));
+  ASSERT_EQ(executor->GetCapacity(), 3);
+  ASSERT_RAISES(Invalid, executor->SetCapacity(4));
+  ASSERT_RAISES(Invalid, executor->MakeExecutor(1));
+  ASSERT_RAISES(Invalid, pool->MakeExecutor(0));
+
+  ASSERT_OK_AND_ASSIGN(auto fut, executor->Submit(add<int>, 4, 5));
+  ASSERT_OK_AND_EQ(9, fut.result());
+  SpawnAdds(executor.get(), 100, task_add<int>);
+  // Shutting down the executor leaves the pool alone
+  ASSERT_RAISES(Invalid, executor->Spawn([] {}));
+  ASSERT_RAISES(Invalid, executor->Shutdown());
+  ASSERT_OK_AND_ASSIGN(fut, pool->Submit(add<int>, 1, 2));
+  ASSERT_OK_AND_EQ(3, fut.result());
+
+  // Quick shutdown drops the queued tasks, but waits for the running ones
+  ASSERT_OK_AND_ASSIGN(executor, pool->MakeExecutor(1));
+  std::atomic<bool> release(false);
+  std::atomic<int> num_done(0);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(pool->Spawn([&] { busy_wait(5.0, [&] { return release.load(); }); }));
+  }
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(executor->Spawn([&] { ++num_done; }));
+  }
+  ASSERT_OK(executor->Shutdown(false /* wait */));
+  release.store(true);
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(num_done.load(), 0);
+}
+
+TEST_F(TestThreadPool, ExecutorTaskGroup) {
+  auto pool = this->MakeThreadPool(2);
+  ASSERT_OK_AND_ASSIGN(auto executor, pool->MakeExecutor(1));
+  auto task_group = TaskGroup::MakeThreaded(executor.get());
+  std::atomic<int> num_done(0);
+  for (int i = 0; i < 50; ++i) {
+    task_group->Append([&] {
+      ++num_done;
+      return Status::OK();
+    });
+  }
+  ASSERT_OK(task_group->Finish());
+  ASSERT_EQ(num_done.load(), 50);
+}
+
+TEST_F(TestThreadPool, ExecutorWeights) {
+  // With a single worker, executors get running time in proportion to
+  // their weights
+  auto pool = this->MakeThreadPool(1);
+  ASSERT_OK_AND_ASSIGN(auto heavy, pool->MakeExecutor(4));
+  ASSERT_OK_AND_ASSIGN(auto light, pool->MakeExecutor(1));
+
+  const int ntasks = 100;
+  std::atomic<bool> release(false);
+  std::atomic<int> heavy_done(0), light_done(0);
+  std::atomic<int> light_done_when_heavy_finished(-1);
+  ASSERT_OK(pool->Spawn([&] { busy_wait(5.0, [&] { return release.load(); }); }));
+  for (int i = 0; i < ntasks; ++i) {
+    ASSERT_OK(light->Spawn([&] {
+      sleep_for(2e-4);
+      ++light_done;
+    }));
+    ASSERT_OK(heavy->Spawn([&] {
+      sleep_for(2e-4);
+      if (++heavy_done == ntasks) {
+        light_done_when_heavy_finished.store(light_done.load());
+      }
+    }));
+  }
+  release.store(true);
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(heavy_done.load(), ntasks);
+  ASSERT_EQ(light_done.load(), ntasks);
+  // Ideally ntasks / 4
+  ASSERT_GE(light_done_when_heavy_finished.load(), ntasks / 8);
+  ASSERT_LE(light_done_when_heavy_finished.load(), ntasks / 2);
+}
+
 // Test Submit() functionality
 
 TEST_F(TestThreadPool, Submit) {
   auto pool = this->MakeThreadPool(3);
   {
     ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(add<int>, 4, 5));
-    ASSERT_EQ(fut.get(), 9);
+    ASSERT_OK_AND_EQ(9, fut.result());
   }
   {
     ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(add<std::string>, "foo", "bar"));
-    ASSERT_EQ(fut.get(), "foobar");
+    ASSERT_OK_AND_EQ("foobar", fut.result());
   }
   {
     ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(slow_add<int>, 0.01 /* seconds */, 4, 5));
-    ASSERT_EQ(fut.get(), 9);
+    ASSERT_OK_AND_EQ(9, fut.result());
   }
   {
     // Reference passing
     std::string s = "foo";
     ASSERT_OK_AND_ASSIGN(auto fut,
                          pool->Submit(inplace_add<std::string>, std::ref(s), "bar"));
-    ASSERT_EQ(fut.get(), "foobar");
+    ASSERT_OK_AND_EQ("foobar", fut.result());
     ASSERT_EQ(s, "foobar");
   }
   {
     // `void` return type
     ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(sleep_for, 0.001));
-    fut.get();
+    ASSERT_OK(fut.status());
   }
 }
 
@@ -307,13 +550,13 @@ TEST_F(TestThreadPool, ForkSafety) {
     // Fork after task submission
     auto pool = this->MakeThreadPool(3);
     ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(add<int>, 4, 5));
-    ASSERT_EQ(fut.get(), 9);
+    ASSERT_OK_AND_EQ(9, fut.result());
 
     child_pid = fork();
     if (child_pid == 0) {
       // Child: thread pool should be usable
       ASSERT_OK_AND_ASSIGN(fut, pool->Submit(add<int>, 3, 4));
-      if (fut.get() != 7) {
+      if (*fut.result() != 7) {
         std::exit(1);
       }
       // Shutting down shouldn't hang or fail
@@ -17,9 +17,11 @@
 
 #include "arrow/util/trie.h"
 
+#include <algorithm>
 #include <iostream>
 #include <utility>
 
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -207,5 +209,76 @@ Status TrieBuilder::Append(util::string_view s, bool allow_duplicate) {
 
 Trie TrieBuilder::Finish() { return std::move(trie_); }
 
+namespace {
+
+// Larger token sets are matched with a Trie
+constexpr size_t kMaxHashedTokens = 256;
+// Hash multipliers tried per table size
+constexpr int kHashingAttempts = 64;
+
+uint64_t SplitMix64(uint64_t* state) {
+  uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+}  // namespace
+
+constexpr size_t TokenMatcher::kMaxPrefilterLength;
+
+bool TokenMatcher::TryHashing(uint64_t multiplier, int bits) {
+  const int shift = 64 - bits;
+  slots_.assign(static_cast<size_t>(1) << bits, -1);
+  for (size_t i = 0; i < tokens_.size(); ++i) {
+    auto& slot = slots_[Hash(tokens_[i], multiplier) >> shift];
+    if (slot != -1) {
+      return false;
+    }
+    slot = static_cast<int32_t>(i);
+  }
+  multiplier_ = multiplier;
+  shift_ = shift;
+  return true;
+}
+
+Result<TokenMatcher> TokenMatcher::Make(const std::vector<std::string>& tokens) {
+  TokenMatcher matcher;
+  for (const auto& token : tokens) {
+    if (std::find(matcher.tokens_.begin(), matcher.tokens_.end(), token) ==
+        matcher.tokens_.end()) {
+      matcher.tokens_.push_back(token);
+    }
+  }
+
+  if (matcher.tokens_.size() <= kMaxHashedTokens) {
+    uint64_t state = 0;
+    // Start with a table at least 4 times larger than the set, so that a
+    // suitable multiplier is usually found within a few attempts
+    const int min_bits =
+        std::max(4, BitUtil::Log2(static_cast<uint64_t>(matcher.tokens_.size()) * 4));
+    for (int bits = min_bits; bits < min_bits + 4; ++bits) {
+      for (int attempt = 0; attempt < kHashingAttempts; ++attempt) {
+        if (matcher.TryHashing(SplitMix64(&state) | 1, bits)) {
+          for (const auto& token : matcher.tokens_) {
+            const size_t bucket = PrefilterBucket(token);
+            matcher.prefilter_[bucket / 64] |= uint64_t(1) << (bucket % 64);
+          }
+          return std::move(matcher);
+        }
+      }
+    }
+  }
+
+  TrieBuilder builder;
+  for (const auto& token : matcher.tokens_) {
+    RETURN_NOT_OK(builder.Append(token));
+  }
+  matcher.slots_.clear();
+  matcher.trie_ = builder.Finish();
+  matcher.use_trie_ = true;
+  return std::move(matcher);
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -18,6 +18,8 @@
 #ifndef ARROW_UTIL_TRIE_H
 #define ARROW_UTIL_TRIE_H
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstdint>
 #include <cstring>
@@ -26,6 +28,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"
@@ -239,6 +242,90 @@ class ARROW_EXPORT TrieBuilder {
   static constexpr auto kMaxIndex = std::numeric_limits<index_type>::max();
 };
 
+// A matcher for small sets of short byte strings, such as the spellings of
+// nulls and booleans in CSV files.
+//
+// Find() rejects most non-matching inputs with a single bitmap lookup on
+// their (length, first byte) pair.  Candidates are then looked up in an open
+// table without collisions (the hash multiplier is searched for at
+// construction), and verified with one comparison.  Sets too large for this
+// fall back to a Trie.
+class ARROW_EXPORT TokenMatcher {
+ public:
+  TokenMatcher() = default;
+  TokenMatcher(TokenMatcher&&) = default;
+  TokenMatcher& operator=(TokenMatcher&&) = default;
+
+  // Create a matcher of the given tokens.  As with a Trie built with
+  // duplicates allowed, Find() returns the index of a string among the
+  // distinct tokens, in order of first appearance.
+  static Result<TokenMatcher> Make(const std::vector<std::string>& tokens);
+
+  int32_t Find(util::string_view s) const {
+    if (ARROW_PREDICT_FALSE(use_trie_)) {
+      return trie_.Find(s);
+    }
+    const size_t length = s.length();
+    const size_t bucket = PrefilterBucket(s);
+    if ((prefilter_[bucket / 64] & (uint64_t(1) << (bucket % 64))) == 0) {
+      return -1;
+    }
+    const int32_t index = slots_[Hash(s, multiplier_) >> shift_];
+    if (index < 0) {
+      return -1;
+    }
+    const std::string& token = tokens_[index];
+    if (token.length() != length || std::memcmp(token.data(), s.data(), length) != 0) {
+      return -1;
+    }
+    return index;
+  }
+
+ protected:
+  // Find a hash multiplier mapping the tokens to distinct slots of a table
+  // of 2**bits entries
+  bool TryHashing(uint64_t multiplier, int bits);
+
+  // Lengths from this one share a prefilter row
+  static constexpr size_t kMaxPrefilterLength = 31;
+
+  static size_t PrefilterBucket(util::string_view s) {
+    const size_t length = std::min(s.length(), kMaxPrefilterLength);
+    const uint8_t first = s.empty() ? 0 : static_cast<uint8_t>(s[0]);
+    return length * 256 + first;
+  }
+
+  static uint64_t Hash(util::string_view s, uint64_t multiplier) {
+    uint64_t h = s.length();
+    const char* data = s.data();
+    size_t remaining = s.length();
+    while (remaining >= 8) {
+      uint64_t word;
+      std::memcpy(&word, data, 8);
+      h = (h ^ word) * multiplier;
+      data += 8;
+      remaining -= 8;
+    }
+    if (remaining > 0) {
+      uint64_t word = 0;
+      std::memcpy(&word, data, remaining);
+      h = (h ^ word) * multiplier;
+    }
+    return h;
+  }
+
+  // One bit per (length, first byte) pair of the tokens
+  std::array<uint64_t, (kMaxPrefilterLength + 1) * 256 / 64> prefilter_ = {};
+  // Index in tokens_ of the token hashing to each slot, or -1
+  std::vector<int32_t> slots_;
+  std::vector<std::string> tokens_;
+  uint64_t multiplier_ = 0;
+  int shift_ = 63;
+
+  bool use_trie_ = false;
+  Trie trie_;
+};
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -104,7 +104,10 @@ static std::vector<std::string> AllNulls() {
           "1.#QNAN", "N/A",      "NA",  "NULL",    "NaN",      "n/a",  "nan",  "null"};
 }
 
-static void TestTrieContents(const Trie& trie, const std::vector<std::string>& entries) {
+// Check a Trie or TokenMatcher
+template <typename TrieType>
+static void TestTrieContents(const TrieType& trie,
+                             const std::vector<std::string>& entries) {
   std::unordered_map<std::string, int32_t> control;
   auto n_entries = static_cast<int32_t>(entries.size());
 
@@ -279,5 +282,46 @@ TEST(Trie, CapacityError) {
   ASSERT_TRUE(had_capacity_error) << "Should have produced CapacityError";
 }
 
+static void TestTokenMatcherContents(const std::vector<std::string>& entries) {
+  ASSERT_OK_AND_ASSIGN(auto matcher, TokenMatcher::Make(entries));
+  TestTrieContents(matcher, entries);
+}
+
+TEST(TokenMatcher, Empty) {
+  ASSERT_OK_AND_ASSIGN(auto matcher, TokenMatcher::Make({}));
+  ASSERT_EQ(-1, matcher.Find(""));
+  ASSERT_EQ(-1, matcher.Find("x"));
+}
+
+TEST(TokenMatcher, Basics) {
+  TestTokenMatcherContents({""});
+  TestTokenMatcherContents({"", "a", "ab", "abc"});
+  TestTokenMatcherContents({"true", "True", "TRUE", "1"});
+  TestTokenMatcherContents({std::string("a\0b", 3), std::string("a\0c", 3)});
+  TestTokenMatcherContents(
+      {"a rather long token", "a rather long token!", "another long, long token"});
+}
+
+TEST(TokenMatcher, CSVNulls) {
+  auto entries = AllNulls();
+  entries.push_back("");
+  TestTokenMatcherContents(entries);
+}
+
+TEST(TokenMatcher, Duplicates) {
+  ASSERT_OK_AND_ASSIGN(auto matcher,
+                       TokenMatcher::Make({"ab", "abc", "abc", "abcd", "ab", "abcde"}));
+  TestTrieContents(matcher, {"ab", "abc", "abcd", "abcde"});
+}
+
+TEST(TokenMatcher, LargeSet) {
+  // Falls back to a Trie
+  std::vector<std::string> entries;
+  for (int i = 0; i < 1000; ++i) {
+    entries.push_back("token" + std::to_string(i * 7));
+  }
+  TestTokenMatcherContents(entries);
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -20,12 +20,21 @@
 #include <mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/neon_util.h"
+#include "arrow/util/sse_util.h"
 #include "arrow/util/utf8.h"
+#include "arrow/util/utf8_internal.h"
 #include "arrow/vendored/utf8cpp/checked.h"
 
+#ifdef ARROW_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace arrow {
 namespace util {
 namespace internal {
@@ -75,6 +84,99 @@ ARROW_EXPORT void CheckUTF8Initialized() {
       << "InitializeUTF8() must be called before calling UTF8 routines";
 }
 
+namespace {
+
+using ::arrow::internal::DispatchLevel;
+using ::arrow::internal::DynamicDispatch;
+
+#if defined(ARROW_HAVE_SSE4_2)
+struct Sse4Utf8 {
+  using Vec = __m128i;
+  static constexpr int64_t kBlockSize = 16;
+
+  static Vec Load(const uint8_t* data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  }
+
+  static Vec LoadTable(const uint8_t* table) { return Load(table); }
+
+  static Vec Splat(uint8_t byte) { return _mm_set1_epi8(static_cast<char>(byte)); }
+
+  static Vec And(Vec a, Vec b) { return _mm_and_si128(a, b); }
+  static Vec Or(Vec a, Vec b) { return _mm_or_si128(a, b); }
+  static Vec Xor(Vec a, Vec b) { return _mm_xor_si128(a, b); }
+  static Vec SubSaturate(Vec a, Vec b) { return _mm_subs_epu8(a, b); }
+
+  static Vec HighNibble(Vec v) { return And(_mm_srli_epi16(v, 4), Splat(0x0f)); }
+  static Vec LowNibble(Vec v) { return And(v, Splat(0x0f)); }
+  static Vec Lookup(Vec table, Vec nibbles) { return _mm_shuffle_epi8(table, nibbles); }
+
+  template <int N>
+  static Vec Prev(Vec input, Vec prev_input) {
+    return _mm_alignr_epi8(input, prev_input, 16 - N);
+  }
+
+  static bool IsAscii(Vec v) { return _mm_movemask_epi8(v) == 0; }
+  static bool IsZero(Vec v) { return _mm_testz_si128(v, v) != 0; }
+};
+#endif
+
+#if defined(ARROW_HAVE_NEON)
+struct NeonUtf8 {
+  using Vec = uint8x16_t;
+  static constexpr int64_t kBlockSize = 16;
+
+  static Vec Load(const uint8_t* data) { return vld1q_u8(data); }
+  static Vec LoadTable(const uint8_t* table) { return vld1q_u8(table); }
+  static Vec Splat(uint8_t byte) { return vdupq_n_u8(byte); }
+
+  static Vec And(Vec a, Vec b) { return vandq_u8(a, b); }
+  static Vec Or(Vec a, Vec b) { return vorrq_u8(a, b); }
+  static Vec Xor(Vec a, Vec b) { return veorq_u8(a, b); }
+  static Vec SubSaturate(Vec a, Vec b) { return vqsubq_u8(a, b); }
+
+  static Vec HighNibble(Vec v) { return vshrq_n_u8(v, 4); }
+  static Vec LowNibble(Vec v) { return And(v, Splat(0x0f)); }
+  static Vec Lookup(Vec table, Vec nibbles) { return vqtbl1q_u8(table, nibbles); }
+
+  template <int N>
+  static Vec Prev(Vec input, Vec prev_input) {
+    return vextq_u8(prev_input, input, 16 - N);
+  }
+
+  static bool IsAscii(Vec v) { return vmaxvq_u8(v) < 0x80; }
+  static bool IsZero(Vec v) { return vmaxvq_u8(v) == 0; }
+};
+#endif
+
+#if defined(ARROW_HAVE_SSE4_2)
+constexpr auto ValidateUTF8Default = ValidateUTF8Lookup<Sse4Utf8>;
+#elif defined(ARROW_HAVE_NEON)
+constexpr auto ValidateUTF8Default = ValidateUTF8Lookup<NeonUtf8>;
+#else
+constexpr auto ValidateUTF8Default = ValidateUTF8Inline;
+#endif
+
+struct ValidateUTF8DynamicFunction {
+  using FunctionType = bool (*)(const uint8_t*, int64_t);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, ValidateUTF8Default}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, ValidateUTF8Avx2}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+bool ValidateUTF8Simd(const uint8_t* data, int64_t size) {
+  static DynamicDispatch<ValidateUTF8DynamicFunction> dispatch;
+  return dispatch.func(data, size);
+}
+
 }  // namespace internal
 
 static std::once_flag utf8_initialized;
@@ -25,6 +25,7 @@
 #include <string>
 
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/visibility.h"
@@ -85,15 +86,15 @@ ARROW_EXPORT void CheckUTF8Initialized();
 // This function needs to be called before doing UTF8 validation.
 ARROW_EXPORT void InitializeUTF8();
 
-inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+namespace internal {
+
+// Validate UTF8 one byte at a time with the state table, after skipping runs
+// of ASCII 8 bytes at a time.
+inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
   static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
   // For some reason, defining this variable outside the loop helps clang
   uint64_t mask;
 
-#ifndef NDEBUG
-  internal::CheckUTF8Initialized();
-#endif
-
   while (size >= 8) {
     // XXX This is doing an unaligned access.  Contemporary architectures
     // (x86-64, AArch64, PPC64) support it natively and often have good
@@ -165,6 +166,26 @@ inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
   return ARROW_PREDICT_TRUE(state == internal::kUTF8ValidateAccept);
 }
 
+// Validate UTF8 with the SIMD kernel for the best instruction set supported by
+// the CPU (AVX2, SSE4 or NEON), or with ValidateUTF8Inline() if there is none.
+ARROW_EXPORT bool ValidateUTF8Simd(const uint8_t* data, int64_t size);
+
+// Below this size, the function call and the handling of a partial block make
+// the SIMD kernels slower than the inline validation.
+static constexpr int64_t kUTF8SimdMinSize = 64;
+
+}  // namespace internal
+
+inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+#ifndef NDEBUG
+  internal::CheckUTF8Initialized();
+#endif
+  if (size >= internal::kUTF8SimdMinSize) {
+    return internal::ValidateUTF8Simd(data, size);
+  }
+  return internal::ValidateUTF8Inline(data, size);
+}
+
 inline bool ValidateUTF8(const util::string_view& str) {
   const uint8_t* data = reinterpret_cast<const uint8_t*>(str.data());
   const size_t length = str.size();
@@ -172,6 +193,106 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+// Whether all bytes of the data are ASCII.
+inline bool IsAscii(const uint8_t* data, int64_t size) {
+  static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
+  uint64_t word;
+  uint64_t any_high_bits = 0;
+  while (size >= 8) {
+    memcpy(&word, data, 8);
+    any_high_bits |= word;
+    data += 8;
+    size -= 8;
+  }
+  while (size-- > 0) {
+    any_high_bits |= *data++;
+  }
+  return (any_high_bits & high_bits_64) == 0;
+}
+
+// The number of code points of valid UTF8 data, i.e. the number of bytes
+// that are not continuation bytes (0b10xxxxxx).
+inline int64_t UTF8Length(const uint8_t* data, int64_t size) {
+  static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
+  const int64_t total_bytes = size;
+  int64_t continuation_bytes = 0;
+  uint64_t word;
+  while (size >= 8) {
+    memcpy(&word, data, 8);
+    // The high bit of each byte is set in `word & ~(word << 1)` if the byte's
+    // two high bits are 0b10
+    continuation_bytes += BitUtil::PopCount(word & ~(word << 1) & high_bits_64);
+    data += 8;
+    size -= 8;
+  }
+  while (size-- > 0) {
+    continuation_bytes += (*data++ & 0xc0) == 0x80;
+  }
+  return total_bytes - continuation_bytes;
+}
+
+// Advance past `n` code points of valid UTF8 data, but not past `end`.
+inline const uint8_t* UTF8Advance(const uint8_t* data, const uint8_t* end, int64_t n) {
+  for (; n > 0 && data < end; --n) {
+    // Skip the continuation bytes of the code point
+    ++data;
+    while (data < end && (*data & 0xc0) == 0x80) {
+      ++data;
+    }
+  }
+  return data;
+}
+
+// The number of bytes needed to encode UTF32 code points as UTF8, or -1 if one
+// of them isn't a Unicode scalar value (it's a surrogate or above U+10FFFF).
+inline int64_t UTF32ToUTF8Size(const uint32_t* data, int64_t length) {
+  int64_t size = 0;
+  uint32_t invalid = 0;
+  // Branchless so that the loop can be vectorized
+  for (int64_t i = 0; i < length; ++i) {
+    const uint32_t c = data[i];
+    size += 1 + (c >= 0x80) + (c >= 0x800) + (c >= 0x10000);
+    invalid |= (c - 0xd800 < 0x800) | (c > 0x10ffff);
+  }
+  return invalid ? -1 : size;
+}
+
+// Encode UTF32 code points, which must be Unicode scalar values, as UTF8.
+// Returns a pointer past the last byte written, `out` must have room for
+// UTF32ToUTF8Size(data, length) bytes.
+inline uint8_t* UTF32ToUTF8(const uint32_t* data, int64_t length, uint8_t* out) {
+  int64_t i = 0;
+  while (i < length) {
+    // Runs of ASCII are copied four code points at a time
+    if (i + 4 <= length && (data[i] | data[i + 1] | data[i + 2] | data[i + 3]) < 0x80) {
+      out[0] = static_cast<uint8_t>(data[i]);
+      out[1] = static_cast<uint8_t>(data[i + 1]);
+      out[2] = static_cast<uint8_t>(data[i + 2]);
+      out[3] = static_cast<uint8_t>(data[i + 3]);
+      out += 4;
+      i += 4;
+      continue;
+    }
+    const uint32_t c = data[i++];
+    if (c < 0x80) {
+      *out++ = static_cast<uint8_t>(c);
+    } else if (c < 0x800) {
+      *out++ = static_cast<uint8_t>(0xc0 | (c >> 6));
+      *out++ = static_cast<uint8_t>(0x80 | (c & 0x3f));
+    } else if (c < 0x10000) {
+      *out++ = static_cast<uint8_t>(0xe0 | (c >> 12));
+      *out++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3f));
+      *out++ = static_cast<uint8_t>(0x80 | (c & 0x3f));
+    } else {
+      *out++ = static_cast<uint8_t>(0xf0 | (c >> 18));
+      *out++ = static_cast<uint8_t>(0x80 | ((c >> 12) & 0x3f));
+      *out++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3f));
+      *out++ = static_cast<uint8_t>(0x80 | (c & 0x3f));
+    }
+  }
+  return out;
+}
+
 // Skip UTF8 byte order mark, if any.
 ARROW_EXPORT
 Result<const uint8_t*> SkipUTF8BOM(const uint8_t* data, int64_t size);
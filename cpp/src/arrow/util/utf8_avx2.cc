@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with AVX2 enabled, its functions must only be called
+// after checking for AVX2 support at runtime.
+
+#include <immintrin.h>
+
+#include <cstdint>
+
+#include "arrow/util/utf8_internal.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace {
+
+struct Avx2Utf8 {
+  using Vec = __m256i;
+  static constexpr int64_t kBlockSize = 32;
+
+  static Vec Load(const uint8_t* data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  }
+
+  static Vec LoadTable(const uint8_t* table) {
+    return _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+  }
+
+  static Vec Splat(uint8_t byte) { return _mm256_set1_epi8(static_cast<char>(byte)); }
+
+  static Vec And(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+  static Vec Or(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+  static Vec Xor(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+  static Vec SubSaturate(Vec a, Vec b) { return _mm256_subs_epu8(a, b); }
+
+  static Vec HighNibble(Vec v) { return And(_mm256_srli_epi16(v, 4), Splat(0x0f)); }
+  static Vec LowNibble(Vec v) { return And(v, Splat(0x0f)); }
+  static Vec Lookup(Vec table, Vec nibbles) {
+    return _mm256_shuffle_epi8(table, nibbles);
+  }
+
+  template <int N>
+  static Vec Prev(Vec input, Vec prev_input) {
+    // alignr works within 128-bit lanes: pair each lane of `input` with the lane
+    // preceding it, i.e. the high lane of `prev_input` and the low lane of `input`
+    const Vec preceding = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    return _mm256_alignr_epi8(input, preceding, 16 - N);
+  }
+
+  static bool IsAscii(Vec v) { return _mm256_movemask_epi8(v) == 0; }
+  static bool IsZero(Vec v) { return _mm256_testz_si256(v, v) != 0; }
+};
+
+}  // namespace
+
+bool ValidateUTF8Avx2(const uint8_t* data, int64_t size) {
+  return ValidateUTF8Lookup<Avx2Utf8>(data, size);
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// SIMD UTF8 validation, shared by the kernels compiled for each instruction set.
+// Only include this from utf8*.cc.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+// The "lookup" algorithm of John Keiser and Daniel Lemire, "Validating UTF-8 In
+// Less Than One Instruction Per Byte" (2021).  Each byte is checked together with
+// the byte before it: three 16-entry tables, indexed by the high and low nibbles
+// of the previous byte and by the high nibble of the current byte, map to bitsets
+// of the errors that the pair may exhibit.  Their intersection is non-zero for an
+// invalid pair, except for the continuation bytes required by 3- and 4-byte
+// sequences, which are checked against the bytes two and three positions before.
+
+// Error classes, as bits of the lookup tables
+constexpr uint8_t kTooShort = 1 << 0;      // 11______ 0_______ or 11______ 11______
+constexpr uint8_t kTooLong = 1 << 1;       // 0_______ 10______
+constexpr uint8_t kOverlong3 = 1 << 2;     // 11100000 100_____
+constexpr uint8_t kTooLarge = 1 << 3;      // 11110100 1001____ and above
+constexpr uint8_t kSurrogate = 1 << 4;     // 11101101 101_____
+constexpr uint8_t kOverlong2 = 1 << 5;     // 1100000_ 10______
+constexpr uint8_t kTooLarge1000 = 1 << 6;  // 11110101 1000____ and above
+constexpr uint8_t kOverlong4 = 1 << 6;     // 11110000 1000____
+constexpr uint8_t kTwoConts = 1 << 7;      // 10______ 10______
+// The errors which don't depend on the low nibble of the first byte
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// clang-format off
+alignas(16) static const uint8_t kUTF8FirstHighNibble[16] = {
+  // 0_______ ________: ASCII
+  kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+  // 10______ ________: continuation
+  kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+  // 1100____ ________: 2-byte lead
+  kTooShort | kOverlong2,
+  // 1101____ ________: 2-byte lead
+  kTooShort,
+  // 1110____ ________: 3-byte lead
+  kTooShort | kOverlong3 | kSurrogate,
+  // 1111____ ________: 4-byte lead
+  kTooShort | kTooLarge | kTooLarge1000 | kOverlong4
+};
+
+alignas(16) static const uint8_t kUTF8FirstLowNibble[16] = {
+  // ____0000 ________
+  kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+  // ____0001 ________
+  kCarry | kOverlong2,
+  // ____001_ ________
+  kCarry,
+  kCarry,
+  // ____0100 ________
+  kCarry | kTooLarge,
+  // ____0101 ________
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____011_ ________
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1___ ________
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1101 ________
+  kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000
+};
+
+alignas(16) static const uint8_t kUTF8SecondHighNibble[16] = {
+  // ________ 0_______: ASCII
+  kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+  // ________ 1000____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+  // ________ 1001____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+  // ________ 101_____
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  // ________ 11______: lead
+  kTooShort, kTooShort, kTooShort, kTooShort
+};
+
+// A block ending with these bytes (or greater) ends in the middle of a sequence.
+// Kernels load the last 16 or 32 bytes.
+alignas(32) static const uint8_t kUTF8IncompleteMax[32] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1
+};
+// clang-format on
+
+/// Validate UTF8 with the lookup algorithm, `Simd` providing the vector
+/// operations of an instruction set:
+/// - `Vec`, a vector of `kBlockSize` bytes
+/// - `Load(const uint8_t*)` and `LoadTable(const uint8_t*)`, loading
+///   `kBlockSize` bytes or a 16-byte table replicated in each 128-bit lane
+/// - `Splat(uint8_t)`, `And`, `Or`, `Xor` and `SubSaturate` (unsigned)
+/// - `HighNibble`, `LowNibble` and `Lookup(table, nibbles)`
+/// - `Prev<N>(input, prev_input)`, the bytes of `input` shifted by N, the first
+///   N bytes coming from the end of `prev_input`
+/// - `IsAscii(Vec)` and `IsZero(Vec)`
+template <typename Simd>
+bool ValidateUTF8Lookup(const uint8_t* data, int64_t size) {
+  using Vec = typename Simd::Vec;
+  constexpr int64_t kBlockSize = Simd::kBlockSize;
+
+  const Vec first_high_table = Simd::LoadTable(kUTF8FirstHighNibble);
+  const Vec first_low_table = Simd::LoadTable(kUTF8FirstLowNibble);
+  const Vec second_high_table = Simd::LoadTable(kUTF8SecondHighNibble);
+  const Vec incomplete_max = Simd::Load(kUTF8IncompleteMax + 32 - kBlockSize);
+  const Vec third_byte_min = Simd::Splat(0xe0 - 0x80);
+  const Vec fourth_byte_min = Simd::Splat(0xf0 - 0x80);
+  const Vec high_bit = Simd::Splat(0x80);
+
+  Vec prev_input = Simd::Splat(0);
+  Vec prev_incomplete = Simd::Splat(0);
+  Vec error = Simd::Splat(0);
+
+  auto check_block = [&](const Vec& input) {
+    if (Simd::IsAscii(input)) {
+      // Only valid if the previous block didn't end in the middle of a sequence
+      error = Simd::Or(error, prev_incomplete);
+    } else {
+      const Vec prev1 = Simd::template Prev<1>(input, prev_input);
+      const Vec special_cases = Simd::And(
+          Simd::And(Simd::Lookup(first_high_table, Simd::HighNibble(prev1)),
+                    Simd::Lookup(first_low_table, Simd::LowNibble(prev1))),
+          Simd::Lookup(second_high_table, Simd::HighNibble(input)));
+      // The high bit is set where the byte two (three) positions before is a
+      // 3-byte (4-byte) lead, requiring a continuation byte here
+      const Vec prev2 = Simd::template Prev<2>(input, prev_input);
+      const Vec prev3 = Simd::template Prev<3>(input, prev_input);
+      const Vec must_be_continuation =
+          Simd::And(Simd::Or(Simd::SubSaturate(prev2, third_byte_min),
+                             Simd::SubSaturate(prev3, fourth_byte_min)),
+                    high_bit);
+      // Two consecutive continuation bytes are flagged as kTwoConts, which is only
+      // valid where a 3- or 4-byte lead requires a continuation byte
+      error = Simd::Or(error, Simd::Xor(must_be_continuation, special_cases));
+      prev_incomplete = Simd::SubSaturate(input, incomplete_max);
+    }
+    prev_input = input;
+  };
+
+  while (size >= kBlockSize) {
+    check_block(Simd::Load(data));
+    data += kBlockSize;
+    size -= kBlockSize;
+  }
+  if (size > 0) {
+    // Pad the tail with ASCII, which fails any sequence truncated by the end
+    alignas(32) uint8_t tail[kBlockSize];
+    std::memset(tail, 0, kBlockSize);
+    std::memcpy(tail, data, static_cast<size_t>(size));
+    check_block(Simd::Load(tail));
+  }
+  error = Simd::Or(error, prev_incomplete);
+  return Simd::IsZero(error);
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+/// AVX2 kernel, only callable on CPUs supporting AVX2
+bool ValidateUTF8Avx2(const uint8_t* data, int64_t size);
+#endif
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -40,6 +40,24 @@ static const char* valid_non_ascii =
     "UTF-8 はISO/IEC 10646 (UCS) "
     "とUnicodeで使える8ビット符号単位の文字符号化形式及び文字符号化スキーム。 ";
 
+// Realistic multilingual text: Cyrillic, Greek and CJK prose, and short
+// mixed-script values with emoji, as found in CSV or JSON columns
+static const char* valid_cyrillic =
+    "UTF-8 — распространённый стандарт кодирования символов, позволяющий более "
+    "компактно хранить и передавать символы Юникода, используя переменное количество "
+    "байт и обеспечивая полную обратную совместимость с 7-битной кодировкой ASCII.";
+static const char* valid_greek =
+    "Το UTF-8 είναι μια κωδικοποίηση χαρακτήρων μεταβλητού μήκους για το Unicode, "
+    "ικανή να αναπαραστήσει κάθε χαρακτήρα του προτύπου Unicode.";
+static const char* valid_cjk =
+    "UTF-8是一种针对Unicode的可变长度字符编码，也是一种前缀码。它可以用一至四个字节对"
+    "Unicode字符集中的所有有效编码点进行编码，属于Unicode标准的一部分。"
+    "UTF-8（ユーティーエフはち）はISO/IEC 10646とUnicodeで使える文字符号化方式。"
+    "UTF-8은 유니코드를 위한 가변 길이 문자 인코딩 방식 중 하나이다.";
+static const char* valid_mixed =
+    "München, Zürich 🇨🇭; Kraków; Αθήνα; Москва; 東京 🗼; 서울; القاهرة; "
+    "São Paulo ☀️; Reykjavík; Ἀθῆναι; 😀👍🏽 «naïve café» — résumé; ";
+
 static std::string MakeLargeString(const std::string& base, int64_t nbytes) {
   int64_t nrepeats = (nbytes + base.size() - 1) / base.size();
   std::string s;
@@ -109,6 +127,47 @@ static void ValidateLargeNonAscii(
   BenchmarkUTF8Validation(state, s, true);
 }
 
+static void ValidateSmallCyrillic(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8Validation(state, valid_cyrillic, true);
+}
+
+static void ValidateSmallCJK(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8Validation(state, valid_cjk, true);
+}
+
+static void ValidateSmallMixed(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8Validation(state, valid_mixed, true);
+}
+
+static void ValidateLargeCyrillic(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_cyrillic, 100000);
+  BenchmarkUTF8Validation(state, s, true);
+}
+
+static void ValidateLargeGreek(benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_greek, 100000);
+  BenchmarkUTF8Validation(state, s, true);
+}
+
+static void ValidateLargeCJK(benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_cjk, 100000);
+  BenchmarkUTF8Validation(state, s, true);
+}
+
+static void ValidateLargeMixed(benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_mixed, 100000);
+  BenchmarkUTF8Validation(state, s, true);
+}
+
+static void ValidateLargeInvalid(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // A truncated sequence at the very end
+  auto s = MakeLargeString(valid_mixed, 100000) + "\xe2\x82";
+  BenchmarkUTF8Validation(state, s, false);
+}
+
 BENCHMARK(ValidateTinyAscii);
 BENCHMARK(ValidateTinyNonAscii);
 BENCHMARK(ValidateSmallAscii);
@@ -117,6 +176,14 @@ BENCHMARK(ValidateSmallNonAscii);
 BENCHMARK(ValidateLargeAscii);
 BENCHMARK(ValidateLargeAlmostAscii);
 BENCHMARK(ValidateLargeNonAscii);
+BENCHMARK(ValidateSmallCyrillic);
+BENCHMARK(ValidateSmallCJK);
+BENCHMARK(ValidateSmallMixed);
+BENCHMARK(ValidateLargeCyrillic);
+BENCHMARK(ValidateLargeGreek);
+BENCHMARK(ValidateLargeCJK);
+BENCHMARK(ValidateLargeMixed);
+BENCHMARK(ValidateLargeInvalid);
 
 }  // namespace util
 }  // namespace arrow
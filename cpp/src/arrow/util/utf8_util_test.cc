@@ -251,6 +251,42 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST_F(UTF8ValidationTest, SimdBlockBoundaries) {
+  // Place sequences at every offset relative to the blocks of the SIMD kernels,
+  // which are also called directly to cover the strings shorter than
+  // kUTF8SimdMinSize
+  auto validate_simd = [](const std::string& s) {
+    return internal::ValidateUTF8Simd(reinterpret_cast<const uint8_t*>(s.data()),
+                                      static_cast<int64_t>(s.size()));
+  };
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> valid_dist(0, all_valid_sequences.size() - 1);
+
+  for (int pos = 0; pos < 70; ++pos) {
+    const std::string prefix(pos, 'a');
+    std::string suffix;
+    while (suffix.size() < 40) {
+      suffix += all_valid_sequences[valid_dist(gen)];
+    }
+    for (const auto& valid : all_valid_sequences) {
+      ASSERT_TRUE(validate_simd(prefix + valid));
+      ASSERT_TRUE(validate_simd(prefix + valid + suffix));
+      AssertValidUTF8(prefix + valid + suffix);
+      if (valid.size() > 1) {
+        const std::string truncated = valid.substr(0, valid.size() - 1);
+        ASSERT_FALSE(validate_simd(prefix + truncated));
+        ASSERT_FALSE(validate_simd(prefix + truncated + suffix));
+        AssertInvalidUTF8(prefix + truncated + suffix);
+      }
+    }
+    for (const auto& invalid : all_invalid_sequences) {
+      ASSERT_FALSE(validate_simd(prefix + invalid));
+      ASSERT_FALSE(validate_simd(prefix + invalid + suffix));
+      AssertInvalidUTF8(prefix + invalid + suffix);
+    }
+  }
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
@@ -281,6 +317,74 @@ TEST(SkipUTF8BOM, Basics) {
   CheckTruncated("\xef\xbb");
 }
 
+TEST(UTF8Length, Basics) {
+  auto Length = [](const std::string& s) -> int64_t {
+    return UTF8Length(reinterpret_cast<const uint8_t*>(s.data()),
+                      static_cast<int64_t>(s.size()));
+  };
+  auto Ascii = [](const std::string& s) -> bool {
+    return IsAscii(reinterpret_cast<const uint8_t*>(s.data()),
+                   static_cast<int64_t>(s.size()));
+  };
+
+  ASSERT_EQ(0, Length(""));
+  ASSERT_EQ(3, Length("foo"));
+  ASSERT_EQ(4, Length("h\xc3\xa9h\xc3\xa9"));
+  ASSERT_EQ(2, Length("\xf0\x9f\x98\x80\xf4\x8f\xbf\xbf"));
+  // Long enough for the word-at-a-time loop
+  ASSERT_EQ(21, Length("h\xc3\xa9h\xc3\xa9 \xf0\x9f\x98\x80 and some ASCII"));
+
+  ASSERT_TRUE(Ascii(""));
+  ASSERT_TRUE(Ascii("some ASCII text"));
+  ASSERT_FALSE(Ascii("some non-ASCII t\xc3\xa9xt"));
+  ASSERT_FALSE(Ascii("\xc3\xa9"));
+}
+
+TEST(UTF8Advance, Basics) {
+  auto Advance = [](const std::string& s, int64_t n) -> int64_t {
+    auto data = reinterpret_cast<const uint8_t*>(s.data());
+    return UTF8Advance(data, data + s.size(), n) - data;
+  };
+
+  ASSERT_EQ(0, Advance("", 2));
+  ASSERT_EQ(0, Advance("foo", 0));
+  ASSERT_EQ(2, Advance("foo", 2));
+  ASSERT_EQ(3, Advance("foo", 5));
+  ASSERT_EQ(3, Advance("h\xc3\xa9h", 2));
+  ASSERT_EQ(5, Advance("\xf0\x9f\x98\x80h\xc3\xa9", 2));
+  ASSERT_EQ(7, Advance("\xf0\x9f\x98\x80h\xc3\xa9", 3));
+}
+
+TEST(UTF32ToUTF8, Basics) {
+  auto CheckOk = [](const std::vector<uint32_t>& utf32, const std::string& expected) {
+    const auto length = static_cast<int64_t>(utf32.size());
+    ASSERT_EQ(static_cast<int64_t>(expected.size()),
+              UTF32ToUTF8Size(utf32.data(), length));
+    std::string actual(expected.size(), '\0');
+    auto out = reinterpret_cast<uint8_t*>(&actual[0]);
+    ASSERT_EQ(out + expected.size(), UTF32ToUTF8(utf32.data(), length, out));
+    ASSERT_EQ(expected, actual);
+  };
+
+  auto CheckInvalid = [](const std::vector<uint32_t>& utf32) {
+    ASSERT_EQ(-1, UTF32ToUTF8Size(utf32.data(), static_cast<int64_t>(utf32.size())));
+  };
+
+  CheckOk({}, "");
+  CheckOk({'f', 'o', 'o'}, "foo");
+  CheckOk({'s', 'o', 'm', 'e', ' ', 't', 'e', 'x', 't'}, "some text");
+  CheckOk({'h', 0xe9, 'h', 0xe9}, "h\xc3\xa9h\xc3\xa9");
+  CheckOk({'a', 'b', 'c', 0x20ac, 'd', 'e', 'f', 'g'}, "abc\xe2\x82\xac" "defg");
+  CheckOk({0x1f600}, "\xf0\x9f\x98\x80");
+  CheckOk({0x10ffff, 0}, std::string("\xf4\x8f\xbf\xbf\0", 5));
+
+  // Lone surrogates
+  CheckInvalid({'a', 0xd800});
+  CheckInvalid({0xdfff, 'a', 'b', 'c', 'd'});
+  // Beyond U+10FFFF
+  CheckInvalid({0x110000});
+}
+
 TEST(UTF8ToWideString, Basics) {
   auto CheckOk = [](const std::string& s, const std::wstring& expected) -> void {
     ASSERT_OK_AND_ASSIGN(std::wstring ws, UTF8ToWideString(s));
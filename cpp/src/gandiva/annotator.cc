@@ -62,8 +62,9 @@ void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
                                        EvalBatch* eval_batch, bool is_output) {
   int buffer_idx = 0;
 
-  // The validity buffer is optional. Use nullptr if it does not have one.
-  if (array_data.buffers[buffer_idx]) {
+  // The validity buffer is optional. Use nullptr if it does not have one, or if an
+  // input has no nulls : the generated code then uses its loop for valid inputs.
+  if (array_data.buffers[buffer_idx] && (is_output || array_data.GetNullCount() != 0)) {
     uint8_t* validity_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
     eval_batch->SetBuffer(desc.validity_idx(), validity_buf, array_data.offset);
   } else {
@@ -87,6 +88,15 @@ void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
   }
 }
 
+void Annotator::PrepareInputField(const std::string& name,
+                                  const arrow::ArrayData& array_data,
+                                  EvalBatch* eval_batch) {
+  auto found = in_name_to_desc_.find(name);
+  if (found != in_name_to_desc_.end()) {
+    PrepareBuffersForField(*(found->second), array_data, eval_batch, false /*is_output*/);
+  }
+}
+
 EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                          const ArrayDataVector& out_vector) {
   EvalBatchPtr eval_batch = std::make_shared<EvalBatch>(
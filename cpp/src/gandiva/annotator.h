@@ -52,6 +52,11 @@ class GANDIVA_EXPORT Annotator {
   EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                 const ArrayDataVector& out_vector);
 
+  /// Populate the entries of the input field 'name' in 'eval_batch', for a field
+  /// computed by an earlier expression rather than read from the record batch.
+  void PrepareInputField(const std::string& name, const arrow::ArrayData& array_data,
+                         EvalBatch* eval_batch);
+
   int buffer_count() { return buffer_count_; }
 
  private:
@@ -27,16 +27,17 @@ namespace gandiva {
 
 class TestAnnotator : public ::testing::Test {
  protected:
-  ArrayPtr MakeInt32Array(int length);
+  ArrayPtr MakeInt32Array(int length, bool all_valid = false);
 };
 
-ArrayPtr TestAnnotator::MakeInt32Array(int length) {
+ArrayPtr TestAnnotator::MakeInt32Array(int length, bool all_valid) {
   arrow::Status status;
 
   std::shared_ptr<arrow::Buffer> validity;
   status =
       arrow::AllocateBuffer(arrow::default_memory_pool(), (length + 63) / 8, &validity);
   DCHECK_EQ(status.ok(), true);
+  memset(validity->mutable_data(), all_valid ? 0xff : 0, validity->size());
 
   std::shared_ptr<arrow::Buffer> value;
   status = AllocateBuffer(arrow::default_memory_pool(), length * sizeof(int32_t), &value);
@@ -102,4 +103,28 @@ TEST_F(TestAnnotator, TestAdd) {
   EXPECT_EQ(bitmaps, nullptr);
 }
 
+TEST_F(TestAnnotator, TestInputWithoutNulls) {
+  Annotator annotator;
+
+  auto field_a = arrow::field("a", arrow::int32());
+  auto in_schema = arrow::schema({field_a});
+  auto field_out = arrow::field("out", arrow::int32());
+
+  FieldDescriptorPtr desc_a = annotator.CheckAndAddInputFieldDescriptor(field_a);
+  FieldDescriptorPtr desc_out = annotator.AddOutputFieldDescriptor(field_out);
+
+  int num_records = 100;
+  auto arrow_v0 = MakeInt32Array(num_records, true /*all_valid*/);
+  auto record_batch = arrow::RecordBatch::Make(in_schema, num_records, {arrow_v0});
+  auto arrow_out = MakeInt32Array(num_records, true /*all_valid*/);
+  EvalBatchPtr batch = annotator.PrepareEvalBatch(*record_batch, {arrow_out->data()});
+
+  // The validity buffer of an input without nulls isn't passed, but outputs always
+  // have one.
+  auto buffers = batch->GetBufferArray();
+  EXPECT_EQ(buffers[desc_a->validity_idx()], nullptr);
+  EXPECT_EQ(buffers[desc_a->data_idx()], arrow_v0->data()->buffers.at(1)->data());
+  EXPECT_EQ(buffers[desc_out->validity_idx()], arrow_out->data()->buffers.at(0)->data());
+}
+
 }  // namespace gandiva
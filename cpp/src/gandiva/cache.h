@@ -18,34 +18,91 @@
 #ifndef GANDIVA_MODULE_CACHE_H
 #define GANDIVA_MODULE_CACHE_H
 
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
 
+#include "gandiva/configuration.h"
 #include "gandiva/lru_cache.h"
 
 namespace gandiva {
 
+/// Cache of built modules, bounded by the bytes of their compiled code.
+///
+/// Keys are spread over independent shards by hash, each with its own lock and LRU
+/// list, so that concurrent builds of different modules seldom wait for each other.
 template <class KeyType, typename ValueType>
 class Cache {
  public:
-  explicit Cache(size_t capacity = CACHE_SIZE) : cache_(capacity) {}
+  explicit Cache(size_t capacity = kDefaultCapacity) {
+    for (auto& shard : shards_) {
+      shard.reset(new Shard(capacity / kNumShards));
+    }
+  }
+
   ValueType GetModule(KeyType cache_key) {
+    Shard& shard = GetShard(cache_key);
     boost::optional<ValueType> result;
-    mtx_.lock();
-    result = cache_.get(cache_key);
-    mtx_.unlock();
-    return result != boost::none ? *result : nullptr;
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      result = shard.cache.get(cache_key);
+    }
+    if (result == boost::none) {
+      misses_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return *result;
   }
 
-  void PutModule(KeyType cache_key, ValueType module) {
-    mtx_.lock();
-    cache_.insert(cache_key, module);
-    mtx_.unlock();
+  /// \param[in] cache_key the key of the module
+  /// \param[in] module the module
+  /// \param[in] code_size the bytes of compiled code held by the module
+  void PutModule(KeyType cache_key, ValueType module, size_t code_size) {
+    Shard& shard = GetShard(cache_key);
+    size_t num_evicted;
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      num_evicted = shard.cache.insert(cache_key, module, code_size);
+    }
+    if (num_evicted > 0) {
+      evictions_.fetch_add(num_evicted, std::memory_order_relaxed);
+    }
+  }
+
+  CacheStats stats() {
+    CacheStats stats;
+    stats.hits = hits_.load();
+    stats.misses = misses_.load();
+    stats.evictions = evictions_.load();
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      stats.num_entries += static_cast<int64_t>(shard->cache.size());
+      stats.code_size += static_cast<int64_t>(shard->cache.cost());
+    }
+    return stats;
   }
 
  private:
-  LruCache<KeyType, ValueType> cache_;
-  static const int CACHE_SIZE = 250;
-  std::mutex mtx_;
+  static constexpr size_t kNumShards = 16;
+  static constexpr size_t kDefaultCapacity = 256 << 20;
+
+  struct Shard {
+    explicit Shard(size_t capacity) : cache(capacity) {}
+
+    std::mutex mutex;
+    LruCache<KeyType, ValueType> cache;
+  };
+
+  Shard& GetShard(const KeyType& cache_key) {
+    return *shards_[cache_key.Hash() % kNumShards];
+  }
+
+  std::array<std::unique_ptr<Shard>, kNumShards> shards_;
+  std::atomic<int64_t> hits_{0};
+  std::atomic<int64_t> misses_{0};
+  std::atomic<int64_t> evictions_{0};
 };
 }  // namespace gandiva
 #endif  // GANDIVA_MODULE_CACHE_H
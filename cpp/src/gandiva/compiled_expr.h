@@ -63,10 +63,10 @@ class CompiledExpr {
   FieldDescriptorPtr output_;
 
   // IR functions for various modes in the generated code
-  std::array<llvm::Function*, SelectionVector::kNumModes> ir_functions_;
+  std::array<llvm::Function*, SelectionVector::kNumModes> ir_functions_{};
 
   // JIT functions in the generated code (set after the module is optimised and finalized)
-  std::array<EvalFunc, SelectionVector::kNumModes> jit_functions_;
+  std::array<EvalFunc, SelectionVector::kNumModes> jit_functions_{};
 };
 
 }  // namespace gandiva
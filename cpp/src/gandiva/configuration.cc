@@ -25,11 +25,17 @@ const std::shared_ptr<Configuration> ConfigurationBuilder::default_configuration
     InitDefaultConfig();
 
 std::size_t Configuration::Hash() const {
-  return 0;  // dummy for now, no configuration properties yet
+  static constexpr size_t kHashSeed = 0;
+  size_t result = kHashSeed;
+  boost::hash_combine(result, optimize_);
+  boost::hash_combine(result, parallel_chunk_size_);
+  return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return true;  // always true, no configuration properties yet
+  // the object cache directory doesn't change the built modules
+  return optimize_ == other.optimize_ &&
+         parallel_chunk_size_ == other.parallel_chunk_size_;
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "arrow/status.h"
 
@@ -26,6 +28,22 @@
 
 namespace gandiva {
 
+/// \brief statistics of the caches of built projectors or filters
+///
+/// The caches are shared by the whole process, whatever the configuration.
+struct CacheStats {
+  /// Number of builds served from the cache
+  int64_t hits = 0;
+  /// Number of builds which compiled a new module
+  int64_t misses = 0;
+  /// Number of modules evicted to make room for newer ones
+  int64_t evictions = 0;
+  /// Number of modules in the cache
+  int64_t num_entries = 0;
+  /// Bytes of compiled code held by the modules in the cache
+  int64_t code_size = 0;
+};
+
 class ConfigurationBuilder;
 /// \brief runtime config for gandiva
 ///
@@ -42,8 +60,23 @@ class GANDIVA_EXPORT Configuration {
   bool optimize() const { return optimize_; }
   void set_optimize(bool optimize) { optimize_ = optimize; }
 
+  /// Number of records per task when Projector::Evaluate() splits larger record
+  /// batches across the CPU thread pool, rounded up to a multiple of 64. 0 (the
+  /// default) to always evaluate on the calling thread. Projections with a selection
+  /// vector or variable-length outputs are never split.
+  int64_t parallel_chunk_size() const { return parallel_chunk_size_; }
+  void set_parallel_chunk_size(int64_t chunk_size) { parallel_chunk_size_ = chunk_size; }
+
+  /// Directory in which compiled modules are saved to be reused by later builds
+  /// of the same expressions, including by other processes. Empty (the default)
+  /// to always compile them.
+  const std::string& object_cache_dir() const { return object_cache_dir_; }
+  void set_object_cache_dir(std::string dir) { object_cache_dir_ = std::move(dir); }
+
  private:
   bool optimize_ = true;
+  int64_t parallel_chunk_size_ = 0;
+  std::string object_cache_dir_;
 };
 
 /// \brief configuration builder for gandiva
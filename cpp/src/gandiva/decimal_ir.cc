@@ -52,6 +52,7 @@ static const std::unordered_set<std::string> kDecimalIRBuilderFunctions{
     kLTFunction,  kLEFunction,       kGTFunction, kGEFunction};
 
 const char* DecimalIR::kScaleMultipliersName = "gandivaScaleMultipliers";
+const char* DecimalIR::kScaleMultipliers64Name = "gandivaScaleMultipliers64";
 
 /// Populate globals required by decimal IR.
 /// TODO: can this be done just once ?
@@ -77,6 +78,24 @@ void DecimalIR::AddGlobals(Engine* engine) {
       *engine->module(), array_type, true /*constant*/,
       llvm::GlobalValue::LinkOnceAnyLinkage, initializer, kScaleMultipliersName);
   globalScaleMultipliers->setAlignment(16);
+
+  // populate vector : [ 1, 10, 100, 1000, ..] for the precisions that fit in an i64
+  int64_t value64 = 1;
+  std::vector<llvm::Constant*> scale_multipliers64;
+  for (int i = 0; i < DecimalTypeUtil::kMaxDecimal64Precision + 1; ++i) {
+    scale_multipliers64.push_back(types->i64_constant(value64));
+    value64 *= 10;
+  }
+
+  auto array64_type = llvm::ArrayType::get(types->i64_type(),
+                                           DecimalTypeUtil::kMaxDecimal64Precision + 1);
+  auto initializer64 = llvm::ConstantArray::get(
+      array64_type, llvm::ArrayRef<llvm::Constant*>(scale_multipliers64));
+
+  auto globalScaleMultipliers64 = new llvm::GlobalVariable(
+      *engine->module(), array64_type, true /*constant*/,
+      llvm::GlobalValue::LinkOnceAnyLinkage, initializer64, kScaleMultipliers64Name);
+  globalScaleMultipliers64->setAlignment(8);
 }
 
 // Lookup intrinsic functions
@@ -100,6 +119,28 @@ llvm::Value* DecimalIR::GetScaleMultiplier(llvm::Value* scale) {
   return ir_builder()->CreateLoad(ptr);
 }
 
+// CPP:  return kScaleMultipliers64[scale]
+llvm::Value* DecimalIR::GetScaleMultiplier64(llvm::Value* scale) {
+  auto const_array = module()->getGlobalVariable(kScaleMultipliers64Name);
+  auto ptr = ir_builder()->CreateGEP(const_array, {types()->i32_constant(0), scale});
+  return ir_builder()->CreateLoad(ptr);
+}
+
+// CPP:  max(x_precision - x_scale, y_precision - y_scale) + max(x_scale, y_scale)
+//         <= kMaxDecimal64Precision
+//
+// The precisions and scales are constants once the decimal functions are inlined in
+// an expression, so this (and the branches on it) fold away at compile time.
+llvm::Value* DecimalIR::FitsInt64AtHigherScale(const ValueFull& x, const ValueFull& y) {
+  auto x_whole_digits = ir_builder()->CreateSub(x.precision(), x.scale());
+  auto y_whole_digits = ir_builder()->CreateSub(y.precision(), y.scale());
+  auto whole_digits = GetHigherScale(x_whole_digits, y_whole_digits);
+  auto digits =
+      ir_builder()->CreateAdd(whole_digits, GetHigherScale(x.scale(), y.scale()));
+  return ir_builder()->CreateICmpSLE(
+      digits, types()->i32_constant(DecimalTypeUtil::kMaxDecimal64Precision));
+}
+
 // CPP:  x <= y ? y : x
 llvm::Value* DecimalIR::GetHigherScale(llvm::Value* x_scale, llvm::Value* y_scale) {
   llvm::Value* le = ir_builder()->CreateICmpSLE(x_scale, y_scale);
@@ -124,6 +165,24 @@ llvm::Value* DecimalIR::IncreaseScale(llvm::Value* in_value,
   return BuildIfElse(le_zero, types()->i128_type(), then_lambda, else_lambda);
 }
 
+// CPP: return (increase_scale_by <= 0)  ?
+//              in_value : in_value * GetScaleMultiplier64(increase_scale_by)
+llvm::Value* DecimalIR::IncreaseScale64(llvm::Value* in_value,
+                                        llvm::Value* increase_scale_by) {
+  llvm::Value* le_zero =
+      ir_builder()->CreateICmpSLE(increase_scale_by, types()->i32_constant(0));
+  // then block
+  auto then_lambda = [&] { return in_value; };
+
+  // else block
+  auto else_lambda = [&] {
+    llvm::Value* multiplier = GetScaleMultiplier64(increase_scale_by);
+    return ir_builder()->CreateMul(in_value, multiplier);
+  };
+
+  return BuildIfElse(le_zero, types()->i64_type(), then_lambda, else_lambda);
+}
+
 // CPP: return (increase_scale_by <= 0)  ?
 //              {in_value,false} : {in_value * GetScaleMultiplier(increase_scale_by),true}
 //
@@ -190,6 +249,41 @@ llvm::Value* DecimalIR::AddFastPath(const ValueFull& x, const ValueFull& y) {
   return sum;
 }
 
+/// @brief Fast-path for add, in 64-bit arithmetic
+/// Same as AddFastPath, on the low 64-bits of x and y.
+llvm::Value* DecimalIR::AddFastPath64(const ValueFull& x, const ValueFull& y) {
+  auto higher_scale = GetHigherScale(x.scale(), y.scale());
+  ADD_TRACE_32("AddFastPath64 : higher_scale", higher_scale);
+
+  auto x_value = ir_builder()->CreateTrunc(x.value(), types()->i64_type());
+  auto x_delta = ir_builder()->CreateSub(higher_scale, x.scale());
+  auto x_scaled = IncreaseScale64(x_value, x_delta);
+
+  auto y_value = ir_builder()->CreateTrunc(y.value(), types()->i64_type());
+  auto y_delta = ir_builder()->CreateSub(higher_scale, y.scale());
+  auto y_scaled = IncreaseScale64(y_value, y_delta);
+
+  auto sum = ir_builder()->CreateAdd(x_scaled, y_scaled);
+  return ir_builder()->CreateSExt(sum, types()->i128_type());
+}
+
+/// @brief Fast-path for compare, in 64-bit arithmetic
+/// Adjust the low 64-bits of x and y to the same scale, and compare them.
+llvm::Value* DecimalIR::CompareFastPath64(const ValueFull& x, const ValueFull& y,
+                                          llvm::ICmpInst::Predicate cmp_instruction) {
+  auto higher_scale = GetHigherScale(x.scale(), y.scale());
+
+  auto x_value = ir_builder()->CreateTrunc(x.value(), types()->i64_type());
+  auto x_delta = ir_builder()->CreateSub(higher_scale, x.scale());
+  auto x_scaled = IncreaseScale64(x_value, x_delta);
+
+  auto y_value = ir_builder()->CreateTrunc(y.value(), types()->i64_type());
+  auto y_delta = ir_builder()->CreateSub(higher_scale, y.scale());
+  auto y_scaled = IncreaseScale64(y_value, y_delta);
+
+  return ir_builder()->CreateICmp(cmp_instruction, x_scaled, y_scaled);
+}
+
 // @brief Add with overflow check.
 /// Adjust x and y to the same scale, add them, and reduce sum to output scale.
 /// If there is an overflow, the sum is set to 0.
@@ -287,7 +381,9 @@ Status DecimalIR::BuildAdd() {
   ir_builder()->SetInsertPoint(entry);
 
   // CPP :
-  // if (out_precision < 38) {
+  // if (out_precision <= 18) {
+  //   return AddFastPath64(x, y)
+  // } else if (out_precision < 38) {
   //   return AddFastPath(x, y)
   // } else {
   //   ret = AddWithOverflowCheck(x, y)
@@ -315,8 +411,14 @@ Status DecimalIR::BuildAdd() {
       return AddLarge(x, y, out);
     }
   };
-  auto value =
-      BuildIfElse(lt_max_precision, types()->i128_type(), then_lambda, else_lambda);
+  llvm::Value* le_max_precision64 = ir_builder()->CreateICmpSLE(
+      out.precision(), types()->i32_constant(DecimalTypeUtil::kMaxDecimal64Precision));
+  auto value = BuildIfElse(
+      le_max_precision64, types()->i128_type(), [&] { return AddFastPath64(x, y); },
+      [&] {
+        return BuildIfElse(lt_max_precision, types()->i128_type(), then_lambda,
+                           else_lambda);
+      });
 
   // store result to out
   ir_builder()->CreateRet(value);
@@ -394,18 +496,29 @@ Status DecimalIR::BuildCompare(const std::string& function_name,
   auto entry = llvm::BasicBlock::Create(*context(), "entry", function);
   ir_builder()->SetInsertPoint(entry);
 
-  // Make call to pre-compiled IR function.
-  auto x_split = ValueSplit::MakeFromInt128(this, x.value());
-  auto y_split = ValueSplit::MakeFromInt128(this, y.value());
-
-  std::vector<llvm::Value*> args = {
-      x_split.high(), x_split.low(), x.precision(), x.scale(),
-      y_split.high(), y_split.low(), y.precision(), y.scale(),
+  // CPP :
+  // if (FitsInt64AtHigherScale(x, y)) {
+  //   return CompareFastPath64(x, y)
+  // } else {
+  //   return compare_decimal128_decimal128_internal(x, y) <cmp> 0
+  // }
+  auto then_lambda = [&] { return CompareFastPath64(x, y, cmp_instruction); };
+  auto else_lambda = [&] {
+    // Make call to pre-compiled IR function.
+    auto x_split = ValueSplit::MakeFromInt128(this, x.value());
+    auto y_split = ValueSplit::MakeFromInt128(this, y.value());
+
+    std::vector<llvm::Value*> args = {
+        x_split.high(), x_split.low(), x.precision(), x.scale(),
+        y_split.high(), y_split.low(), y.precision(), y.scale(),
+    };
+    auto cmp_value = ir_builder()->CreateCall(
+        module()->getFunction("compare_decimal128_decimal128_internal"), args);
+    return ir_builder()->CreateICmp(cmp_instruction, cmp_value,
+                                    types()->i32_constant(0));
   };
-  auto cmp_value = ir_builder()->CreateCall(
-      module()->getFunction("compare_decimal128_decimal128_internal"), args);
-  auto result =
-      ir_builder()->CreateICmp(cmp_instruction, cmp_value, types()->i32_constant(0));
+  auto result = BuildIfElse(FitsInt64AtHigherScale(x, y), types()->i1_type(),
+                            then_lambda, else_lambda);
   ir_builder()->CreateRet(result);
   return Status::OK();
 }
@@ -116,6 +116,13 @@ class DecimalIR : public FunctionIRBuilder {
   // Get the multiplier for specified scale (i.e 10^scale)
   llvm::Value* GetScaleMultiplier(llvm::Value* scale);
 
+  // Get the 64-bit multiplier for specified scale (i.e 10^scale), for scales up to
+  // kMaxDecimal64Precision
+  llvm::Value* GetScaleMultiplier64(llvm::Value* scale);
+
+  // Whether x and y both fit in 64 bits once adjusted to the higher of their scales.
+  llvm::Value* FitsInt64AtHigherScale(const ValueFull& x, const ValueFull& y);
+
   // Get the higher of the two scales
   llvm::Value* GetHigherScale(llvm::Value* x_scale, llvm::Value* y_scale);
 
@@ -123,6 +130,9 @@ class DecimalIR : public FunctionIRBuilder {
   // - If 'increase_scale_by' is <= 0, does nothing.
   llvm::Value* IncreaseScale(llvm::Value* in_value, llvm::Value* increase_scale_by);
 
+  // Same as IncreaseScale, for i64 values.
+  llvm::Value* IncreaseScale64(llvm::Value* in_value, llvm::Value* increase_scale_by);
+
   // Similar to IncreaseScale. but, also check if there is overflow.
   ValueWithOverflow IncreaseScaleWithOverflowCheck(llvm::Value* in_value,
                                                    llvm::Value* increase_scale_by);
@@ -134,6 +144,14 @@ class DecimalIR : public FunctionIRBuilder {
   // Fast path of add: guaranteed no overflow
   llvm::Value* AddFastPath(const ValueFull& x, const ValueFull& y);
 
+  // Fast path of add in 64-bit arithmetic: the output precision is at most
+  // kMaxDecimal64Precision.
+  llvm::Value* AddFastPath64(const ValueFull& x, const ValueFull& y);
+
+  // Fast path of compare in 64-bit arithmetic: see FitsInt64AtHigherScale.
+  llvm::Value* CompareFastPath64(const ValueFull& x, const ValueFull& y,
+                                 llvm::ICmpInst::Predicate cmp_instruction);
+
   // Similar to AddFastPath, but check if there's an overflow.
   ValueWithOverflow AddWithOverflowCheck(const ValueFull& x, const ValueFull& y,
                                          const ValueFull& out);
@@ -175,6 +193,9 @@ class DecimalIR : public FunctionIRBuilder {
   // name of the global variable having the array of scale multipliers.
   static const char* kScaleMultipliersName;
 
+  // name of the global variable having the array of 64-bit scale multipliers.
+  static const char* kScaleMultipliers64Name;
+
   // Intrinsic functions
   llvm::Function* sadd_with_overflow_fn_;
   llvm::Function* smul_with_overflow_fn_;
@@ -45,6 +45,7 @@
 #include <llvm/Bitcode/BitcodeReader.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
+#include <llvm/ExecutionEngine/SectionMemoryManager.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/LLVMContext.h>
@@ -92,15 +93,45 @@ void Engine::InitOnce() {
   llvm_init = true;
 }
 
+/// Memory manager counting the bytes allocated for the compiled module.
+class SizeTrackingMemoryManager : public llvm::SectionMemoryManager {
+ public:
+  uint8_t* allocateCodeSection(uintptr_t size, unsigned alignment, unsigned section_id,
+                               llvm::StringRef section_name) override {
+    allocated_ += size;
+    return llvm::SectionMemoryManager::allocateCodeSection(size, alignment, section_id,
+                                                           section_name);
+  }
+
+  uint8_t* allocateDataSection(uintptr_t size, unsigned alignment, unsigned section_id,
+                               llvm::StringRef section_name, bool read_only) override {
+    allocated_ += size;
+    return llvm::SectionMemoryManager::allocateDataSection(size, alignment, section_id,
+                                                           section_name, read_only);
+  }
+
+  size_t allocated() const { return allocated_; }
+
+ private:
+  size_t allocated_ = 0;
+};
+
 Engine::Engine(const std::shared_ptr<Configuration>& conf,
                std::unique_ptr<llvm::LLVMContext> ctx,
-               std::unique_ptr<llvm::ExecutionEngine> engine, llvm::Module* module)
+               std::unique_ptr<llvm::ExecutionEngine> engine,
+               SizeTrackingMemoryManager* memory_manager, llvm::Module* module)
     : context_(std::move(ctx)),
       execution_engine_(std::move(engine)),
+      memory_manager_(memory_manager),
       ir_builder_(arrow::internal::make_unique<llvm::IRBuilder<>>(*context_)),
       module_(module),
       types_(*context_),
-      optimize_(conf->optimize()) {}
+      optimize_(conf->optimize()) {
+  if (!conf->object_cache_dir().empty()) {
+    object_cache_ =
+        arrow::internal::make_unique<ObjectCache>(conf->object_cache_dir());
+  }
+}
 
 Status Engine::Init() {
   // Add mappings for functions that can be accessed from LLVM/IR module.
@@ -130,9 +161,12 @@ Status Engine::Make(const std::shared_ptr<Configuration>& conf,
   // ExecutionEngine but only for the lifetime of the builder. Found by
   // inspecting LLVM sources.
   std::string builder_error;
+  auto memory_manager = arrow::internal::make_unique<SizeTrackingMemoryManager>();
+  auto memory_manager_ptr = memory_manager.get();
   std::unique_ptr<llvm::ExecutionEngine> exec_engine{
       llvm::EngineBuilder(std::move(module))
           .setMCPU(llvm::sys::getHostCPUName())
+          .setMCJITMemoryManager(std::move(memory_manager))
           .setEngineKind(llvm::EngineKind::JIT)
           .setOptLevel(opt_level)
           .setErrorStr(&builder_error)
@@ -144,13 +178,19 @@ Status Engine::Make(const std::shared_ptr<Configuration>& conf,
   }
 
   std::unique_ptr<Engine> engine{
-      new Engine(conf, std::move(ctx), std::move(exec_engine), module_ptr)};
+      new Engine(conf, std::move(ctx), std::move(exec_engine), memory_manager_ptr,
+                 module_ptr)};
   ARROW_RETURN_NOT_OK(engine->Init());
   *out = std::move(engine);
   return Status::OK();
 }
 
 // Handling for pre-compiled IR libraries.
+//
+// The module is loaded lazily, only reading its symbol table. Its functions are
+// declared in the main module for the code generator, and only those called by the
+// generated code (and their dependencies) are materialized and linked when the
+// module is finalized.
 Status Engine::LoadPreCompiledIR() {
   auto bitcode = llvm::StringRef(reinterpret_cast<const char*>(kPrecompiledBitcode),
                                  kPrecompiledBitcodeSize);
@@ -176,13 +216,38 @@ Status Engine::LoadPreCompiledIR() {
     stream << module_or_error.takeError();
     return Status::CodeGenError(stream.str());
   }
-  std::unique_ptr<llvm::Module> ir_module = move(module_or_error.get());
+  precompiled_module_ = move(module_or_error.get());
+
+  for (auto& function : *precompiled_module_) {
+    if (function.hasLocalLinkage() || function.isIntrinsic() ||
+        module_->getFunction(function.getName()) != nullptr) {
+      continue;
+    }
+    auto declaration =
+        llvm::Function::Create(function.getFunctionType(),
+                               llvm::GlobalValue::ExternalLinkage, function.getName(),
+                               module_);
+    declaration->setCallingConv(function.getCallingConv());
+    declaration->setAttributes(function.getAttributes());
+  }
+  return Status::OK();
+}
 
-  ARROW_RETURN_IF(llvm::verifyModule(*ir_module, &llvm::errs()),
-                  Status::CodeGenError("verify of IR Module failed"));
-  ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, move(ir_module)),
-                  Status::CodeGenError("failed to link IR Modules"));
+// Link the functions of the pre-compiled module called by the main module.
+Status Engine::LinkPreCompiledIR() {
+  // Drop the declarations left unused once the unused functions are removed, the
+  // linker would import their definitions otherwise.
+  for (auto it = module_->begin(); it != module_->end();) {
+    llvm::Function& function = *it++;
+    if (function.isDeclaration() && function.use_empty() &&
+        precompiled_module_->getFunction(function.getName()) != nullptr) {
+      function.eraseFromParent();
+    }
+  }
 
+  ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, move(precompiled_module_),
+                                            llvm::Linker::Flags::LinkOnlyNeeded),
+                  Status::CodeGenError("failed to link IR Modules"));
   return Status::OK();
 }
 
@@ -213,8 +278,18 @@ Status Engine::RemoveUnusedFunctions() {
 // Optimise and compile the module.
 Status Engine::FinalizeModule() {
   ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
+  ARROW_RETURN_NOT_OK(LinkPreCompiledIR());
+  ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
+
+  // A module compiled before, possibly by another process, is loaded by the
+  // execution engine instead of being optimised and compiled again.
+  bool cached = false;
+  if (object_cache_ != nullptr) {
+    execution_engine_->setObjectCache(object_cache_.get());
+    cached = object_cache_->Lookup(DumpIR(), optimize_);
+  }
 
-  if (optimize_) {
+  if (optimize_ && !cached) {
     // misc passes to allow for inlining, vectorization, ..
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
@@ -239,7 +314,7 @@ Status Engine::FinalizeModule() {
     pass_manager->run(*module_);
   }
 
-  ARROW_RETURN_IF(llvm::verifyModule(*module_, &llvm::errs()),
+  ARROW_RETURN_IF(!cached && llvm::verifyModule(*module_, &llvm::errs()),
                   Status::CodeGenError("Module verification failed after optimizer"));
 
   // do the compilation
@@ -249,6 +324,8 @@ Status Engine::FinalizeModule() {
   return Status::OK();
 }
 
+size_t Engine::code_size() const { return memory_manager_->allocated(); }
+
 void* Engine::CompiledFunction(llvm::Function* irFunction) {
   DCHECK(module_finalized_);
   return execution_engine_->getPointerToFunction(irFunction);
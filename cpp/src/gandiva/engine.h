@@ -29,10 +29,13 @@
 #include "gandiva/llvm_includes.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/logging.h"
+#include "gandiva/object_cache.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
 
+class SizeTrackingMemoryManager;
+
 /// \brief LLVM Execution engine wrapper.
 class GANDIVA_EXPORT Engine {
  public:
@@ -55,9 +58,19 @@ class GANDIVA_EXPORT Engine {
     functions_to_compile_.push_back(fname);
   }
 
-  /// Optimise and compile the module.
+  /// The object cache, null if it's disabled.
+  ObjectCache* object_cache() { return object_cache_.get(); }
+
+  /// Don't save the module in the object cache, e.g. because the generated code
+  /// refers to objects of this process.
+  void DisableObjectCache() { object_cache_.reset(); }
+
+  /// Optimise and compile the module, or load it from the object cache.
   Status FinalizeModule();
 
+  /// Number of bytes allocated for the code and data of the compiled module.
+  size_t code_size() const;
+
   /// Get the compiled function corresponding to the irfunction.
   void* CompiledFunction(llvm::Function* irFunction);
 
@@ -71,7 +84,8 @@ class GANDIVA_EXPORT Engine {
  private:
   Engine(const std::shared_ptr<Configuration>& conf,
          std::unique_ptr<llvm::LLVMContext> ctx,
-         std::unique_ptr<llvm::ExecutionEngine> engine, llvm::Module* module);
+         std::unique_ptr<llvm::ExecutionEngine> engine,
+         SizeTrackingMemoryManager* memory_manager, llvm::Module* module);
 
   // Post construction init. This _must_ be called after the constructor.
   Status Init();
@@ -80,10 +94,13 @@ class GANDIVA_EXPORT Engine {
 
   llvm::ExecutionEngine& execution_engine() { return *execution_engine_; }
 
-  /// load pre-compiled IR modules from precompiled_bitcode.cc and merge them into
-  /// the main module.
+  /// load the pre-compiled IR module from precompiled_bitcode.cc lazily, and declare
+  /// its functions in the main module.
   Status LoadPreCompiledIR();
 
+  /// link the pre-compiled functions used by the main module into it.
+  Status LinkPreCompiledIR();
+
   // Create and add mappings for cpp functions that can be accessed from LLVM.
   void AddGlobalMappings();
 
@@ -91,9 +108,15 @@ class GANDIVA_EXPORT Engine {
   Status RemoveUnusedFunctions();
 
   std::unique_ptr<llvm::LLVMContext> context_;
+  // Must outlive the execution engine, which keeps a pointer to it
+  std::unique_ptr<ObjectCache> object_cache_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
+  // Owned by the execution engine
+  SizeTrackingMemoryManager* memory_manager_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
   llvm::Module* module_;
+  // The pre-compiled module, with the bodies of its functions not materialized yet
+  std::unique_ptr<llvm::Module> precompiled_module_;
   LLVMTypes types_;
 
   std::vector<std::string> functions_to_compile_;
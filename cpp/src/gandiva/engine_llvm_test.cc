@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 #include <functional>
+#include "arrow/util/io_util.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/tests/test_util.h"
 
@@ -128,4 +129,62 @@ TEST_F(TestEngine, TestAddOptimised) {
   EXPECT_EQ(add_func(my_array, 5), 17);
 }
 
+TEST_F(TestEngine, TestObjectCache) {
+  auto dir = arrow::internal::TemporaryDir::Make("gandiva-object-cache-").ValueOrDie();
+  configuration->set_object_cache_dir(dir->path().ToString());
+
+  int64_t my_array[] = {1, 3, -5, 8, 10};
+  std::string object_path;
+  for (int i = 0; i < 2; ++i) {
+    // The second engine loads the object compiled by the first one
+    ASSERT_OK(Engine::Make(configuration, &engine));
+    llvm::Function* ir_func = BuildVecAdd(engine.get());
+    ASSERT_OK(engine->FinalizeModule());
+    auto add_func =
+        reinterpret_cast<add_vector_func_t>(engine->CompiledFunction(ir_func));
+    EXPECT_EQ(add_func(my_array, 5), 17);
+
+    auto object = llvm::MemoryBuffer::getFile(engine->object_cache()->path());
+    ASSERT_TRUE(static_cast<bool>(object));
+    if (i == 0) {
+      object_path = engine->object_cache()->path();
+    } else {
+      ASSERT_EQ(object_path, engine->object_cache()->path());
+    }
+  }
+}
+
+TEST_F(TestEngine, TestLinkUsedPreCompiledFunctions) {
+  configuration->set_optimize(false);
+  BuildEngine();
+  auto types = engine->types();
+  llvm::IRBuilder<>* builder = engine->ir_builder();
+
+  // The pre-compiled functions are declared before the module is finalized.
+  llvm::Module* module = engine->module();
+  ASSERT_NE(module->getFunction("add_int64_int64"), nullptr);
+  ASSERT_NE(module->getFunction("subtract_int64_int64"), nullptr);
+
+  // Create fn : int64_t add_one(int64_t x) { return add_int64_int64(x, 1); }
+  std::string func_name = "add_one";
+  engine->AddFunctionToCompile(func_name);
+  llvm::FunctionType* prototype =
+      llvm::FunctionType::get(types->i64_type(), {types->i64_type()}, false);
+  llvm::Function* fn = llvm::Function::Create(
+      prototype, llvm::GlobalValue::ExternalLinkage, func_name, module);
+  builder->SetInsertPoint(llvm::BasicBlock::Create(*engine->context(), "entry", fn));
+  llvm::Value* sum = builder->CreateCall(module->getFunction("add_int64_int64"),
+                                         {&*fn->arg_begin(), types->i64_constant(1)});
+  builder->CreateRet(sum);
+
+  ASSERT_OK(engine->FinalizeModule());
+  auto add_one = reinterpret_cast<int64_t (*)(int64_t)>(engine->CompiledFunction(fn));
+  EXPECT_EQ(add_one(41), 42);
+
+  // Only the functions called were linked.
+  ASSERT_NE(module->getFunction("add_int64_int64"), nullptr);
+  EXPECT_FALSE(module->getFunction("add_int64_int64")->isDeclaration());
+  EXPECT_EQ(module->getFunction("subtract_int64_int64"), nullptr);
+}
+
 }  // namespace gandiva
@@ -40,9 +40,11 @@ class EvalBatch {
       buffer_offsets_array_.reset(new int64_t[num_buffers]);
     }
     local_bitmaps_holder_.reset(new LocalBitMapsHolder(num_records, num_local_bitmaps));
-    execution_context_.reset(new ExecutionContext());
+    execution_context_ = ExecutionContext::Acquire();
   }
 
+  ~EvalBatch() { ExecutionContext::Release(std::move(execution_context_)); }
+
   int64_t num_records() const { return num_records_; }
 
   uint8_t** GetBufferArray() const { return buffers_array_.get(); }
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include "gandiva/simple_arena.h"
 
 namespace gandiva {
@@ -47,7 +48,31 @@ class ExecutionContext {
     arena_.Reset();
   }
 
+  /// Get a context to evaluate a batch on the current thread. The context released by
+  /// the previous batch is reused, so that its arena stays allocated across batches.
+  static std::unique_ptr<ExecutionContext> Acquire() {
+    auto& cached = CachedContext();
+    if (cached != nullptr) {
+      return std::move(cached);
+    }
+    return std::unique_ptr<ExecutionContext>(new ExecutionContext());
+  }
+
+  /// Release a context obtained with Acquire(), to be reused by the next batch.
+  static void Release(std::unique_ptr<ExecutionContext> context) {
+    context->Reset();
+    auto& cached = CachedContext();
+    if (cached == nullptr) {
+      cached = std::move(context);
+    }
+  }
+
  private:
+  static std::unique_ptr<ExecutionContext>& CachedContext() {
+    static thread_local std::unique_ptr<ExecutionContext> context;
+    return context;
+  }
+
   std::string error_msg_;
   SimpleArena arena_;
 };
@@ -21,6 +21,8 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/util/thread_pool.h"
+
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/cache.h"
 #include "gandiva/condition.h"
@@ -31,23 +33,45 @@
 
 namespace gandiva {
 
+namespace {
+
+Cache<FilterCacheKey, std::shared_ptr<Filter>>& GetCache() {
+  static Cache<FilterCacheKey, std::shared_ptr<Filter>> cache;
+  return cache;
+}
+
+}  // namespace
+
 Filter::Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
       schema_(schema),
-      configuration_(configuration) {}
+      configuration_(configuration),
+      optimized_(arrow::Future<>::MakeFinished()) {}
 
 Filter::~Filter() {}
 
 Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
                     std::shared_ptr<Configuration> configuration,
                     std::shared_ptr<Filter>* filter) {
+  return MakeImpl(schema, condition, configuration, /*async=*/false, filter);
+}
+
+Status Filter::MakeAsync(SchemaPtr schema, ConditionPtr condition,
+                         std::shared_ptr<Configuration> configuration,
+                         std::shared_ptr<Filter>* filter) {
+  return MakeImpl(schema, condition, configuration, /*async=*/true, filter);
+}
+
+Status Filter::MakeImpl(SchemaPtr schema, ConditionPtr condition,
+                        std::shared_ptr<Configuration> configuration, bool async,
+                        std::shared_ptr<Filter>* filter) {
   ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
   ARROW_RETURN_IF(condition == nullptr, Status::Invalid("Condition cannot be null"));
   ARROW_RETURN_IF(configuration == nullptr,
                   Status::Invalid("Configuration cannot be null"));
 
-  static Cache<FilterCacheKey, std::shared_ptr<Filter>> cache;
+  auto& cache = GetCache();
   FilterCacheKey cache_key(schema, configuration, *(condition.get()));
   auto cachedFilter = cache.GetModule(cache_key);
   if (cachedFilter != nullptr) {
@@ -55,6 +79,30 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
     return Status::OK();
   }
 
+  // Without optimisations, the code is compiled much faster.
+  async = async && configuration->optimize();
+  auto build_configuration = configuration;
+  if (async) {
+    build_configuration = std::make_shared<Configuration>(*configuration);
+    build_configuration->set_optimize(false);
+  }
+
+  std::unique_ptr<LLVMGenerator> llvm_gen;
+  ARROW_RETURN_NOT_OK(BuildGenerator(schema, condition, build_configuration, &llvm_gen));
+
+  // Instantiate the filter with the completely built llvm generator
+  *filter = std::make_shared<Filter>(std::move(llvm_gen), schema, configuration);
+  if (async) {
+    ARROW_RETURN_NOT_OK(StartOptimizedBuild(*filter, condition));
+  }
+  cache.PutModule(cache_key, *filter, (*filter)->generator()->code_size());
+
+  return Status::OK();
+}
+
+Status Filter::BuildGenerator(SchemaPtr schema, ConditionPtr condition,
+                              std::shared_ptr<Configuration> configuration,
+                              std::unique_ptr<LLVMGenerator>* llvm_generator) {
   // Build LLVM generator, and generate code for the specified expression
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
@@ -64,12 +112,32 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
   ExprValidator expr_validator(llvm_gen->types(), schema);
   ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
   ARROW_RETURN_NOT_OK(llvm_gen->Build({condition}, SelectionVector::Mode::MODE_NONE));
+  *llvm_generator = std::move(llvm_gen);
+  return Status::OK();
+}
 
-  // Instantiate the filter with the completely built llvm generator
-  *filter = std::make_shared<Filter>(std::move(llvm_gen), schema, configuration);
-  cache.PutModule(cache_key, *filter);
+Status Filter::StartOptimizedBuild(std::shared_ptr<Filter> filter,
+                                   ConditionPtr condition) {
+  auto optimized = arrow::Future<>::Make();
+  filter->optimized_ = optimized;
+  return arrow::internal::GetCpuThreadPool()->Spawn(
+      [filter, condition, optimized]() mutable {
+        std::unique_ptr<LLVMGenerator> llvm_gen;
+        Status status = BuildGenerator(filter->schema_, condition,
+                                       filter->configuration_, &llvm_gen);
+        // On failure, keep using the unoptimised code
+        if (status.ok()) {
+          std::atomic_store(&filter->llvm_generator_,
+                            std::shared_ptr<LLVMGenerator>(std::move(llvm_gen)));
+        }
+        optimized.MarkFinished(status);
+      });
+}
 
-  return Status::OK();
+CacheStats Filter::GetCacheStats() { return GetCache().stats(); }
+
+std::shared_ptr<LLVMGenerator> Filter::generator() const {
+  return std::atomic_load(&llvm_generator_);
 }
 
 Status Filter::Evaluate(const arrow::RecordBatch& batch,
@@ -93,7 +161,7 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  ARROW_RETURN_NOT_OK(generator()->Execute(batch, {array_data}));
 
   // Compute the intersection of the value and validity.
   auto result = bitmaps.GetLocalBitMap(2);
@@ -103,6 +171,6 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   return out_selection->PopulateFromBitMap(result, bitmap_size, num_rows - 1);
 }
 
-std::string Filter::DumpIR() { return llvm_generator_->DumpIR(); }
+std::string Filter::DumpIR() { return generator()->DumpIR(); }
 
 }  // namespace gandiva
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/condition.h"
@@ -68,6 +69,19 @@ class GANDIVA_EXPORT Filter {
                      std::shared_ptr<Configuration> config,
                      std::shared_ptr<Filter>* filter);
 
+  /// \brief Build a filter which can evaluate batches without waiting for the LLVM
+  /// optimisation passes. The condition is first compiled without optimisations,
+  /// then compiled again with the given configuration on the CPU thread pool; the
+  /// optimised code is used by Evaluate() as soon as it's ready.
+  ///
+  /// \param[in] schema schema for the record batches, and the condition.
+  /// \param[in] condition filter conditions.
+  /// \param[in] config run time configuration.
+  /// \param[out] filter the returned filter object
+  static Status MakeAsync(SchemaPtr schema, ConditionPtr condition,
+                          std::shared_ptr<Configuration> config,
+                          std::shared_ptr<Filter>* filter);
+
   /// Evaluate the specified record batch, and populate output selection vector.
   ///
   /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
@@ -78,10 +92,36 @@ class GANDIVA_EXPORT Filter {
 
   std::string DumpIR();
 
+  /// Statistics of the process-wide cache of built filters.
+  static CacheStats GetCacheStats();
+
+  /// Future completed once Evaluate() uses the code compiled with the configuration
+  /// of the filter. It is already completed unless built by MakeAsync().
+  arrow::Future<> optimized() const { return optimized_; }
+
  private:
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  static Status MakeImpl(SchemaPtr schema, ConditionPtr condition,
+                         std::shared_ptr<Configuration> config, bool async,
+                         std::shared_ptr<Filter>* filter);
+
+  /// Validate the condition and generate its code.
+  static Status BuildGenerator(SchemaPtr schema, ConditionPtr condition,
+                               std::shared_ptr<Configuration> configuration,
+                               std::unique_ptr<LLVMGenerator>* llvm_generator);
+
+  /// Compile the condition with the configuration of the filter in the background,
+  /// and replace the generator once done.
+  static Status StartOptimizedBuild(std::shared_ptr<Filter> filter,
+                                    ConditionPtr condition);
+
+  /// The current generator, which may be replaced concurrently.
+  std::shared_ptr<LLVMGenerator> generator() const;
+
+  // Only accessed atomically
+  std::shared_ptr<LLVMGenerator> llvm_generator_;
   SchemaPtr schema_;
   std::shared_ptr<Configuration> configuration_;
+  arrow::Future<> optimized_;
 };
 
 }  // namespace gandiva
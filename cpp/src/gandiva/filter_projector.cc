@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/filter_projector.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gandiva/cache.h"
+#include "gandiva/expr_validator.h"
+#include "gandiva/llvm_generator.h"
+#include "gandiva/projector.h"
+#include "gandiva/projector_cache_key.h"
+#include "gandiva/selection_vector.h"
+
+namespace gandiva {
+
+FilterProjector::FilterProjector(std::unique_ptr<LLVMGenerator> llvm_generator,
+                                 SchemaPtr schema, const FieldVector& output_fields,
+                                 std::shared_ptr<Configuration> configuration)
+    : llvm_generator_(std::move(llvm_generator)),
+      schema_(schema),
+      output_fields_(output_fields),
+      configuration_(configuration) {}
+
+FilterProjector::~FilterProjector() {}
+
+Status FilterProjector::Make(SchemaPtr schema, ConditionPtr condition,
+                             const ExpressionVector& exprs,
+                             std::shared_ptr<Configuration> configuration,
+                             std::shared_ptr<FilterProjector>* filter_projector) {
+  ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
+  ARROW_RETURN_IF(condition == nullptr, Status::Invalid("Condition cannot be null"));
+  ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
+  ARROW_RETURN_IF(configuration == nullptr,
+                  Status::Invalid("Configuration cannot be null"));
+
+  // The condition is keyed as the first expression.
+  ExpressionVector key_exprs;
+  key_exprs.reserve(exprs.size() + 1);
+  key_exprs.push_back(condition);
+  key_exprs.insert(key_exprs.end(), exprs.begin(), exprs.end());
+
+  static Cache<ProjectorCacheKey, std::shared_ptr<FilterProjector>> cache;
+  ProjectorCacheKey cache_key(schema, configuration, key_exprs,
+                              SelectionVector::Mode::MODE_UINT32);
+  auto cached_filter_projector = cache.GetModule(cache_key);
+  if (cached_filter_projector != nullptr) {
+    *filter_projector = cached_filter_projector;
+    return Status::OK();
+  }
+
+  // Build LLVM generator, and generate code for the condition and expressions
+  std::unique_ptr<LLVMGenerator> llvm_gen;
+  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+
+  // Run the validation on the condition and expressions.
+  ExprValidator expr_validator(llvm_gen->types(), schema);
+  for (auto& expr : key_exprs) {
+    ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+  }
+
+  ARROW_RETURN_NOT_OK(
+      llvm_gen->BuildFilterProject(condition, exprs, SelectionVector::MODE_UINT32));
+
+  // save the output field types. Used to allocate the outputs at Evaluate() time.
+  FieldVector output_fields;
+  output_fields.reserve(exprs.size());
+  for (auto& expr : exprs) {
+    output_fields.push_back(expr->result());
+  }
+
+  auto code_size = llvm_gen->code_size();
+  *filter_projector = std::shared_ptr<FilterProjector>(
+      new FilterProjector(std::move(llvm_gen), schema, output_fields, configuration));
+  cache.PutModule(cache_key, *filter_projector, code_size);
+
+  return Status::OK();
+}
+
+Status FilterProjector::Evaluate(const arrow::RecordBatch& batch,
+                                 arrow::MemoryPool* pool, arrow::ArrayVector* output) {
+  const auto num_rows = batch.num_rows();
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("Schema in RecordBatch must match schema in Make()"));
+  ARROW_RETURN_IF(num_rows == 0, Status::Invalid("RecordBatch must be non-empty."));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  ARROW_RETURN_NOT_OK(SelectionVector::MakeInt32(num_rows, pool, &selection_vector));
+
+  // The outputs are allocated for all the records, as the number of matching ones
+  // is only known after evaluating the condition.
+  ArrayDataVector output_data_vecs;
+  for (auto& field : output_fields_) {
+    ArrayDataPtr output_data;
+    ARROW_RETURN_NOT_OK(
+        Projector::AllocArrayData(field->type(), num_rows, pool, &output_data));
+    output_data_vecs.push_back(output_data);
+  }
+
+  ARROW_RETURN_NOT_OK(llvm_generator_->ExecuteFilterProject(
+      batch, selection_vector.get(), output_data_vecs));
+
+  // Create and return the arrays, truncated to the matching records.
+  output->clear();
+  for (auto& array_data : output_data_vecs) {
+    array_data->length = selection_vector->GetNumSlots();
+    output->push_back(arrow::MakeArray(array_data));
+  }
+  return Status::OK();
+}
+
+std::string FilterProjector::DumpIR() { return llvm_generator_->DumpIR(); }
+
+}  // namespace gandiva
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/condition.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+class LLVMGenerator;
+
+/// \brief projection of the records matching a condition.
+///
+/// Equivalent to a Filter followed by a Projector using its selection vector, but
+/// the condition and the expressions are compiled in a single module, and evaluated
+/// in a single call which doesn't return the intermediate selection vector. The
+/// expressions are only computed for the matching records.
+class GANDIVA_EXPORT FilterProjector {
+ public:
+  // Inline dtor will attempt to resolve the destructor for
+  // LLVMGenerator on MSVC, so we compile the dtor in the object code
+  ~FilterProjector();
+
+  /// Build a filter projector for the given schema, to evaluate the vector of
+  /// expressions on the records matching the condition.
+  ///
+  /// \param[in] schema schema for the record batches, the condition and expressions.
+  /// \param[in] condition filter condition.
+  /// \param[in] exprs vector of expressions.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] filter_projector the returned filter projector object
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<FilterProjector>* filter_projector);
+
+  /// Evaluate the specified record batch, and return the allocated and populated output
+  /// arrays, holding the values of the expressions for the records matching the
+  /// condition. The output arrays will be allocated from the memory pool 'pool', and
+  /// added to the vector 'output'.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays.
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output);
+
+  std::string DumpIR();
+
+ private:
+  FilterProjector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+                  const FieldVector& output_fields,
+                  std::shared_ptr<Configuration> configuration);
+
+  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  SchemaPtr schema_;
+  FieldVector output_fields_;
+  std::shared_ptr<Configuration> configuration_;
+};
+
+}  // namespace gandiva
@@ -34,7 +34,7 @@ extern "C" {
 bool gdv_fn_like_utf8_utf8(int64_t ptr, const char* data, int data_len,
                            const char* pattern, int pattern_len) {
   gandiva::LikeHolder* holder = reinterpret_cast<gandiva::LikeHolder*>(ptr);
-  return (*holder)(std::string(data, data_len));
+  return (*holder)(data, data_len);
 }
 
 double gdv_fn_random(int64_t ptr) {
@@ -91,9 +91,17 @@ int32_t gdv_fn_populate_varlen_vector(int64_t context_ptr, int8_t* data_ptr,
                                       const char* entry_buf, int32_t entry_len) {
   auto buffer = reinterpret_cast<arrow::ResizableBuffer*>(data_ptr);
   int32_t offset = static_cast<int32_t>(buffer->size());
+  int64_t new_size = offset + entry_len;
 
-  // This also sets the size in the buffer.
-  auto status = buffer->Resize(offset + entry_len, false /*shrink*/);
+  // Grow the capacity geometrically, so that the reallocations are amortized over the
+  // records. This also sets the size in the buffer.
+  auto status = arrow::Status::OK();
+  if (new_size > buffer->capacity()) {
+    status = buffer->Reserve(std::max(new_size, 2 * buffer->capacity()));
+  }
+  if (status.ok()) {
+    status = buffer->Resize(new_size, false /*shrink*/);
+  }
   if (!status.ok()) {
     gandiva::ExecutionContext* context =
         reinterpret_cast<gandiva::ExecutionContext*>(context_ptr);
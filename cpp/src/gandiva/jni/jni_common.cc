@@ -672,9 +672,7 @@ class JavaResizableBuffer : public arrow::ResizableBuffer {
 
   Status Resize(const int64_t new_size, bool shrink_to_fit) override;
 
-  Status Reserve(const int64_t new_capacity) override {
-    return Status::NotImplemented("reserve not implemented");
-  }
+  Status Reserve(const int64_t new_capacity) override;
 
  private:
   JNIEnv* env_;
@@ -687,15 +685,20 @@ Status JavaResizableBuffer::Resize(const int64_t new_size, bool shrink_to_fit) {
     return Status::NotImplemented("shrink not implemented");
   }
 
-  if (ARROW_PREDICT_TRUE(new_size < capacity())) {
+  ARROW_RETURN_NOT_OK(Reserve(new_size));
+  size_ = new_size;
+  return Status::OK();
+}
+
+Status JavaResizableBuffer::Reserve(const int64_t new_capacity) {
+  if (ARROW_PREDICT_TRUE(new_capacity <= capacity())) {
     // no need to expand.
-    size_ = new_size;
     return Status::OK();
   }
 
   // callback into java to expand the buffer
-  jobject ret =
-      env_->CallObjectMethod(jexpander_, vector_expander_method_, vector_idx_, new_size);
+  jobject ret = env_->CallObjectMethod(jexpander_, vector_expander_method_, vector_idx_,
+                                       new_capacity);
   if (env_->ExceptionCheck()) {
     env_->ExceptionDescribe();
     env_->ExceptionClear();
@@ -704,10 +707,9 @@ Status JavaResizableBuffer::Resize(const int64_t new_size, bool shrink_to_fit) {
 
   jlong ret_address = env_->GetLongField(ret, vector_expander_ret_address_);
   jlong ret_capacity = env_->GetLongField(ret, vector_expander_ret_capacity_);
-  DCHECK_GE(ret_capacity, new_size);
+  DCHECK_GE(ret_capacity, new_capacity);
 
   data_ = mutable_data_ = reinterpret_cast<uint8_t*>(ret_address);
-  size_ = new_size;
   capacity_ = ret_capacity;
   return Status::OK();
 }
@@ -786,8 +788,9 @@ Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjector(
       break;
     }
 
-    auto ret_types = holder->rettypes();
+    const auto& ret_types = holder->rettypes();
     ArrayDataVector output;
+    output.reserve(ret_types.size());
     int buf_idx = 0;
     int sz_idx = 0;
     int output_vector_idx = 0;
@@ -817,8 +820,17 @@ Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjector(
               "null");
           break;
         }
-        buffers.push_back(std::make_shared<JavaResizableBuffer>(
-            env, jexpander, output_vector_idx, value_buf, data_sz));
+        auto data_buffer = std::make_shared<JavaResizableBuffer>(
+            env, jexpander, output_vector_idx, value_buf, data_sz);
+        // Size the buffer from the previous evaluations, rather than growing it
+        // while evaluating. Output vectors reused across batches are only expanded
+        // when the data outgrows them.
+        status = data_buffer->Reserve(holder->data_bytes_per_row(output_vector_idx) *
+                                      output_row_count);
+        if (!status.ok()) {
+          break;
+        }
+        buffers.push_back(data_buffer);
       } else {
         buffers.push_back(std::make_shared<arrow::MutableBuffer>(value_buf, data_sz));
       }
@@ -831,6 +843,16 @@ Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjector(
       break;
     }
     status = holder->projector()->Evaluate(*in_batch, selection_vector.get(), output);
+    if (!status.ok() || output_row_count == 0) {
+      break;
+    }
+    for (size_t i = 0; i < ret_types.size(); ++i) {
+      if (arrow::is_binary_like(ret_types[i]->type()->id())) {
+        auto data_size = output[i]->buffers.back()->size();
+        holder->set_data_bytes_per_row(
+            static_cast<int>(i), (data_size + output_row_count - 1) / output_row_count);
+      }
+    }
   } while (0);
 
   env->ReleaseLongArrayElements(buf_addrs, in_buf_addrs, JNI_ABORT);
@@ -18,8 +18,11 @@
 #ifndef JNI_MODULE_HOLDER_H
 #define JNI_MODULE_HOLDER_H
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "gandiva/arrow.h"
 
@@ -32,16 +35,30 @@ class ProjectorHolder {
  public:
   ProjectorHolder(SchemaPtr schema, FieldVector ret_types,
                   std::shared_ptr<Projector> projector)
-      : schema_(schema), ret_types_(ret_types), projector_(std::move(projector)) {}
+      : schema_(schema),
+        ret_types_(ret_types),
+        projector_(std::move(projector)),
+        data_bytes_per_row_(ret_types_.size()) {}
 
   SchemaPtr schema() { return schema_; }
-  FieldVector rettypes() { return ret_types_; }
+  const FieldVector& rettypes() const { return ret_types_; }
   std::shared_ptr<Projector> projector() { return projector_; }
 
+  /// The number of bytes per row of the data buffer of a variable-length output in
+  /// the last evaluation, used to size it upfront in the next one.
+  int64_t data_bytes_per_row(int output_idx) const {
+    return data_bytes_per_row_[output_idx].load();
+  }
+
+  void set_data_bytes_per_row(int output_idx, int64_t bytes) {
+    data_bytes_per_row_[output_idx].store(bytes);
+  }
+
  private:
   SchemaPtr schema_;
   FieldVector ret_types_;
   std::shared_ptr<Projector> projector_;
+  std::vector<std::atomic<int64_t>> data_bytes_per_row_;
 };
 
 class FilterHolder {
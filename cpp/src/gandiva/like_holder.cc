@@ -17,14 +17,77 @@
 
 #include "gandiva/like_holder.h"
 
-#include <regex>
+#include <cstring>
+
 #include "gandiva/node.h"
 #include "gandiva/regex_util.h"
 
 namespace gandiva {
 
-RE2 LikeHolder::starts_with_regex_(R"((\w|\s)*\.\*)");
-RE2 LikeHolder::ends_with_regex_(R"(\.\*(\w|\s)*)");
+LikeHolder::MatchKind LikeHolder::AnalyzePattern(const std::string& sql_pattern,
+                                                 std::string* literal) {
+  size_t begin = 0;
+  size_t end = sql_pattern.length();
+  while (begin < end && sql_pattern[begin] == '%') {
+    ++begin;
+  }
+  const bool leading_any = begin > 0;
+  while (end > begin && sql_pattern[end - 1] == '%') {
+    --end;
+  }
+  const bool trailing_any = end < sql_pattern.length();
+
+  *literal = sql_pattern.substr(begin, end - begin);
+  if (literal->find_first_of("%_") != std::string::npos) {
+    return MatchKind::kRegex;
+  }
+  if (leading_any) {
+    return trailing_any ? MatchKind::kSubstring : MatchKind::kSuffix;
+  }
+  return trailing_any ? MatchKind::kPrefix : MatchKind::kExact;
+}
+
+// Return true if 'data' contains 'literal'. Candidate positions are found by searching
+// for the first char of the literal with memchr, which is vectorized by the libc.
+static bool ContainsLiteral(const char* data, int32_t data_len,
+                            const std::string& literal) {
+  const auto literal_len = static_cast<int32_t>(literal.length());
+  if (literal_len == 0) {
+    return true;
+  }
+  const char first = literal[0];
+  const char* cur = data;
+  const char* last = data + data_len - literal_len;
+  while (cur <= last) {
+    cur = static_cast<const char*>(memchr(cur, first, last - cur + 1));
+    if (cur == nullptr) {
+      return false;
+    }
+    if (memcmp(cur + 1, literal.data() + 1, literal_len - 1) == 0) {
+      return true;
+    }
+    ++cur;
+  }
+  return false;
+}
+
+bool LikeHolder::operator()(const char* data, int32_t data_len) {
+  const auto literal_len = static_cast<int32_t>(literal_.length());
+  switch (kind_) {
+    case MatchKind::kExact:
+      return data_len == literal_len && memcmp(data, literal_.data(), literal_len) == 0;
+    case MatchKind::kPrefix:
+      return data_len >= literal_len && memcmp(data, literal_.data(), literal_len) == 0;
+    case MatchKind::kSuffix:
+      return data_len >= literal_len &&
+             memcmp(data + data_len - literal_len, literal_.data(), literal_len) == 0;
+    case MatchKind::kSubstring:
+      return ContainsLiteral(data, data_len, literal_);
+    case MatchKind::kRegex:
+      break;
+  }
+  return RE2::FullMatch(re2::StringPiece(data, data_len), regex_);
+}
 
 // Short-circuit pattern matches for the two common sub cases :
 // - starts_with and ends_with.
@@ -32,19 +95,16 @@ const FunctionNode LikeHolder::TryOptimize(const FunctionNode& node) {
   std::shared_ptr<LikeHolder> holder;
   auto status = Make(node, &holder);
   if (status.ok()) {
-    std::string& pattern = holder->pattern_;
     auto literal_type = node.children().at(1)->return_type();
 
-    if (RE2::FullMatch(pattern, starts_with_regex_)) {
-      auto prefix = pattern.substr(0, pattern.length() - 2);  // trim .*
-      auto prefix_node =
-          std::make_shared<LiteralNode>(literal_type, LiteralHolder(prefix), false);
+    if (holder->kind_ == MatchKind::kPrefix) {
+      auto prefix_node = std::make_shared<LiteralNode>(
+          literal_type, LiteralHolder(holder->literal_), false);
       return FunctionNode("starts_with", {node.children().at(0), prefix_node},
                           node.return_type());
-    } else if (RE2::FullMatch(pattern, ends_with_regex_)) {
-      auto suffix = pattern.substr(2);  // skip .*
-      auto suffix_node =
-          std::make_shared<LiteralNode>(literal_type, LiteralHolder(suffix), false);
+    } else if (holder->kind_ == MatchKind::kSuffix) {
+      auto suffix_node = std::make_shared<LiteralNode>(
+          literal_type, LiteralHolder(holder->literal_), false);
       return FunctionNode("ends_with", {node.children().at(0), suffix_node},
                           node.return_type());
     }
@@ -81,7 +141,11 @@ Status LikeHolder::Make(const std::string& sql_pattern,
   std::string pcre_pattern;
   ARROW_RETURN_NOT_OK(RegexUtil::SqlLikePatternToPcre(sql_pattern, pcre_pattern));
 
-  auto lholder = std::shared_ptr<LikeHolder>(new LikeHolder(pcre_pattern));
+  std::string literal;
+  auto kind = AnalyzePattern(sql_pattern, &literal);
+
+  auto lholder =
+      std::shared_ptr<LikeHolder>(new LikeHolder(pcre_pattern, kind, literal));
   ARROW_RETURN_IF(!lholder->regex_.ok(),
                   Status::Invalid("Building RE2 pattern '", pcre_pattern, "' failed"));
 
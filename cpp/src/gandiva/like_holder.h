@@ -18,6 +18,7 @@
 #ifndef GANDIVA_LIKE_HOLDER_H
 #define GANDIVA_LIKE_HOLDER_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -44,16 +45,34 @@ class GANDIVA_EXPORT LikeHolder : public FunctionHolder {
   static const FunctionNode TryOptimize(const FunctionNode& node);
 
   /// Return true if the data matches the pattern.
-  bool operator()(const std::string& data) { return RE2::FullMatch(data, regex_); }
+  bool operator()(const std::string& data) {
+    return (*this)(data.data(), static_cast<int32_t>(data.length()));
+  }
+
+  /// Return true if the data matches the pattern.
+  bool operator()(const char* data, int32_t data_len);
 
  private:
-  explicit LikeHolder(const std::string& pattern) : pattern_(pattern), regex_(pattern) {}
+  /// How a pattern is matched. Patterns made of a literal, optionally preceded
+  /// and/or followed by '%', do not need a regex.
+  enum class MatchKind {
+    kExact,      // literal
+    kPrefix,     // literal%
+    kSuffix,     // %literal
+    kSubstring,  // %literal%
+    kRegex,      // anything else
+  };
+
+  LikeHolder(const std::string& pattern, MatchKind kind, const std::string& literal)
+      : pattern_(pattern), kind_(kind), literal_(literal), regex_(pattern) {}
+
+  // Find the kind of match for a sql pattern, and the literal to match if any.
+  static MatchKind AnalyzePattern(const std::string& sql_pattern, std::string* literal);
 
   std::string pattern_;  // posix pattern string, to help debugging
+  MatchKind kind_;       // how the data is matched
+  std::string literal_;  // literal to match, unless kind_ is kRegex
   RE2 regex_;            // compiled regex for the pattern
-
-  static RE2 starts_with_regex_;  // pre-compiled pattern for matching starts_with
-  static RE2 ends_with_regex_;    // pre-compiled pattern for matching ends_with
 };
 
 }  // namespace gandiva
@@ -94,6 +94,49 @@ TEST_F(TestLikeHolder, TestDot) {
   EXPECT_FALSE(like("abcd"));
 }
 
+TEST_F(TestLikeHolder, TestLiteralPatterns) {
+  // Patterns matched without a regex
+  std::shared_ptr<LikeHolder> like_holder;
+
+  ASSERT_TRUE(LikeHolder::Make("a.c", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("a.c"));
+  EXPECT_FALSE((*like_holder)("abc"));
+  EXPECT_FALSE((*like_holder)("a.cd"));
+
+  ASSERT_TRUE(LikeHolder::Make("a(c%%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("a(c"));
+  EXPECT_TRUE((*like_holder)("a(cd\nef"));
+  EXPECT_FALSE((*like_holder)("a("));
+  EXPECT_FALSE((*like_holder)("xa(c"));
+
+  ASSERT_TRUE(LikeHolder::Make("%[bc]", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("[bc]"));
+  EXPECT_TRUE((*like_holder)("a[bc]"));
+  EXPECT_FALSE((*like_holder)("bc]"));
+  EXPECT_FALSE((*like_holder)("[bc]a"));
+
+  ASSERT_TRUE(LikeHolder::Make("%aab%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("aab"));
+  EXPECT_TRUE((*like_holder)("aaab"));
+  EXPECT_TRUE((*like_holder)("xyaaabz"));
+  EXPECT_FALSE((*like_holder)("aa"));
+  EXPECT_FALSE((*like_holder)("abaa_b"));
+  EXPECT_FALSE((*like_holder)("ab ab"));
+
+  ASSERT_TRUE(LikeHolder::Make("%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)(""));
+  EXPECT_TRUE((*like_holder)("abc"));
+
+  ASSERT_TRUE(LikeHolder::Make("", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)(""));
+  EXPECT_FALSE((*like_holder)("a"));
+
+  // Wildcards in the middle of the pattern need a regex
+  ASSERT_TRUE(LikeHolder::Make("%a%b%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("xaxbx"));
+  EXPECT_FALSE((*like_holder)("xbxax"));
+}
+
 TEST_F(TestLikeHolder, TestOptimise) {
   // optimise for 'starts_with'
   auto fnode = LikeHolder::TryOptimize(BuildLike("xy 123z%"));
@@ -105,6 +148,11 @@ TEST_F(TestLikeHolder, TestOptimise) {
   EXPECT_EQ(fnode.descriptor()->name(), "ends_with");
   EXPECT_EQ(fnode.ToString(), "bool ends_with((string) in, (const string) xyz)");
 
+  // optimise for 'starts_with', with pcre special chars
+  fnode = LikeHolder::TryOptimize(BuildLike("x.y*%"));
+  EXPECT_EQ(fnode.descriptor()->name(), "starts_with");
+  EXPECT_EQ(fnode.ToString(), "bool starts_with((string) in, (const string) x.y*)");
+
   // no optimisation for others.
   fnode = LikeHolder::TryOptimize(BuildLike("xyz_"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
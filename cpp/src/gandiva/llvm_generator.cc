@@ -17,13 +17,19 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/bit_util.h"
+
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/decimal_ir.h"
 #include "gandiva/dex.h"
@@ -31,6 +37,7 @@
 #include "gandiva/expression.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/lvalue.h"
+#include "gandiva/subexpr_eliminator.h"
 
 namespace gandiva {
 
@@ -39,6 +46,39 @@ namespace gandiva {
     AddTrace(__VA_ARGS__); \
   }
 
+namespace {
+
+// Allocate the array holding the result of a shared subtree, for 'num_records'.
+Status AllocIntermediateArrayData(const DataTypePtr& type, int64_t num_records,
+                                  ArrayDataPtr* array_data) {
+  auto pool = arrow::default_memory_pool();
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers(1);
+  ARROW_RETURN_NOT_OK(arrow::AllocateBuffer(
+      pool, arrow::BitUtil::BytesForBits(num_records), &buffers[0]));
+
+  int64_t data_len = 0;
+  if (arrow::is_binary_like(type->id())) {
+    std::shared_ptr<arrow::Buffer> offsets_buffer;
+    ARROW_RETURN_NOT_OK(arrow::AllocateBuffer(
+        pool, (num_records + 1) * sizeof(int32_t), &offsets_buffer));
+    buffers.push_back(offsets_buffer);
+  } else {
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*type);
+    data_len = arrow::BitUtil::BytesForBits(num_records * fw_type.bit_width());
+  }
+  std::shared_ptr<arrow::ResizableBuffer> data_buffer;
+  ARROW_RETURN_NOT_OK(arrow::AllocateResizableBuffer(pool, data_len, &data_buffer));
+  if (type->id() == arrow::Type::BOOL) {
+    memset(data_buffer->mutable_data(), 0, data_len);
+  }
+  buffers.push_back(data_buffer);
+
+  *array_data = arrow::ArrayData::Make(type, num_records, buffers);
+  return Status::OK();
+}
+
+}  // namespace
+
 LLVMGenerator::LLVMGenerator() : enable_ir_traces_(false) {}
 
 Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
@@ -51,7 +91,8 @@ Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
   return Status::OK();
 }
 
-Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr output) {
+Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr output,
+                          SelectionVector::Mode mode) {
   int idx = static_cast<int>(compiled_exprs_.size());
   // decompose the expression to separate out value and validities.
   ExprDecomposer decomposer(function_registry_, annotator_);
@@ -62,8 +103,8 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
   llvm::Function* ir_function = nullptr;
   ARROW_RETURN_NOT_OK(CodeGenExprValue(value_validity->value_expr(),
                                        annotator_.buffer_count(), output, idx,
-                                       &ir_function, selection_vector_mode_));
-  compiled_expr->SetIRFunction(selection_vector_mode_, ir_function);
+                                       &ir_function, mode));
+  compiled_expr->SetIRFunction(mode, ir_function);
 
   compiled_exprs_.push_back(std::move(compiled_expr));
   return Status::OK();
@@ -72,19 +113,62 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
 /// Build and optimise module for projection expression.
 Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode mode) {
   selection_vector_mode_ = mode;
+
+  // With a selection vector, the outputs are only populated for the selected records
+  // so they can't be read back as inputs.
+  ExpressionVector rewritten = exprs;
+  ExpressionVector intermediates;
+  if (mode == SelectionVector::MODE_NONE) {
+    SubexprEliminator eliminator(function_registry_);
+    eliminator.Rewrite(exprs, &rewritten, &intermediates);
+  }
+
+  // The descriptors of the intermediate outputs follow those of the outputs, but the
+  // intermediate expressions are evaluated first.
+  std::vector<FieldDescriptorPtr> outputs;
+  for (auto& expr : rewritten) {
+    outputs.push_back(annotator_.AddOutputFieldDescriptor(expr->result()));
+  }
+  for (auto& intermediate : intermediates) {
+    auto output = annotator_.AddOutputFieldDescriptor(intermediate->result());
+    ARROW_RETURN_NOT_OK(Add(intermediate, output, mode));
+    intermediate_fields_.push_back(intermediate->result());
+  }
+  for (size_t i = 0; i < rewritten.size(); ++i) {
+    ARROW_RETURN_NOT_OK(Add(rewritten[i], outputs[i], mode));
+  }
+  return Finalize();
+}
+
+/// Build and optimise module for a condition followed by projection expressions.
+Status LLVMGenerator::BuildFilterProject(ConditionPtr condition,
+                                         const ExpressionVector& exprs,
+                                         SelectionVector::Mode mode) {
+  DCHECK_NE(mode, SelectionVector::MODE_NONE);
+  selection_vector_mode_ = mode;
+  auto condition_output = annotator_.AddOutputFieldDescriptor(condition->result());
+  ARROW_RETURN_NOT_OK(Add(condition, condition_output, SelectionVector::MODE_NONE));
   for (auto& expr : exprs) {
     auto output = annotator_.AddOutputFieldDescriptor(expr->result());
-    ARROW_RETURN_NOT_OK(Add(expr, output));
+    ARROW_RETURN_NOT_OK(Add(expr, output, mode));
   }
+  return Finalize();
+}
 
+Status LLVMGenerator::Finalize() {
   // Compile and inject into the process' memory the generated function.
   ARROW_RETURN_NOT_OK(engine_->FinalizeModule());
 
-  // setup the jit functions for each expression.
+  // setup the jit functions for each expression, in the modes it was generated for.
   for (auto& compiled_expr : compiled_exprs_) {
-    auto ir_fn = compiled_expr->GetIRFunction(mode);
-    auto jit_fn = reinterpret_cast<EvalFunc>(engine_->CompiledFunction(ir_fn));
-    compiled_expr->SetJITFunction(selection_vector_mode_, jit_fn);
+    for (int i = 0; i < SelectionVector::kNumModes; ++i) {
+      auto mode = static_cast<SelectionVector::Mode>(i);
+      auto ir_fn = compiled_expr->GetIRFunction(mode);
+      if (ir_fn != nullptr) {
+        auto jit_fn = reinterpret_cast<EvalFunc>(engine_->CompiledFunction(ir_fn));
+        compiled_expr->SetJITFunction(mode, jit_fn);
+      }
+    }
   }
 
   return Status::OK();
@@ -103,7 +187,15 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) {
   DCHECK_GT(record_batch.num_rows(), 0);
 
-  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
+  ArrayDataVector all_outputs = output_vector;
+  for (auto& field : intermediate_fields_) {
+    ArrayDataPtr array_data;
+    ARROW_RETURN_NOT_OK(
+        AllocIntermediateArrayData(field->type(), record_batch.num_rows(), &array_data));
+    all_outputs.push_back(std::move(array_data));
+  }
+
+  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, all_outputs);
   DCHECK_GT(eval_batch->GetNumBuffers(), 0);
 
   auto mode = SelectionVector::MODE_NONE;
@@ -115,29 +207,87 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                            selection_vector_mode_, " received vector with mode ", mode);
   }
 
-  for (auto& compiled_expr : compiled_exprs_) {
-    // generate data/offset vectors.
-    const uint8_t* selection_buffer = nullptr;
-    auto num_output_rows = record_batch.num_rows();
-    if (selection_vector != nullptr) {
-      selection_buffer = selection_vector->GetBuffer().data();
-      num_output_rows = selection_vector->GetNumSlots();
+  for (size_t i = 0; i < compiled_exprs_.size(); ++i) {
+    ARROW_RETURN_NOT_OK(
+        Eval(*compiled_exprs_[i], mode, eval_batch.get(), selection_vector));
+    // The data buffer of a variable-length output is only final once evaluated.
+    if (i < intermediate_fields_.size()) {
+      annotator_.PrepareInputField(intermediate_fields_[i]->name(),
+                                   *all_outputs[output_vector.size() + i],
+                                   eval_batch.get());
     }
+  }
 
-    EvalFunc jit_function = compiled_expr->GetJITFunction(mode);
-    jit_function(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
-                 eval_batch->GetLocalBitMapArray(), selection_buffer,
-                 (int64_t)eval_batch->GetExecutionContext(), num_output_rows);
+  return Status::OK();
+}
 
-    // check for execution errors
-    ARROW_RETURN_IF(
-        eval_batch->GetExecutionContext()->has_error(),
-        Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+/// Execute the condition, then the projection expressions on the matching records.
+Status LLVMGenerator::ExecuteFilterProject(const arrow::RecordBatch& record_batch,
+                                           SelectionVector* selection_vector,
+                                           const ArrayDataVector& output_vector) {
+  const auto num_rows = record_batch.num_rows();
+  DCHECK_GT(num_rows, 0);
+  ARROW_RETURN_IF(selection_vector->GetMode() != selection_vector_mode_,
+                  Status::Invalid("llvm expression built for selection vector mode ",
+                                  selection_vector_mode_, " received vector with mode ",
+                                  selection_vector->GetMode()));
+
+  // The condition is evaluated into local bitmaps (one for output, one for validity,
+  // one to compute the intersection), as by Filter.
+  LocalBitMapsHolder bitmaps(num_rows, 3 /*local_bitmaps*/);
+  int64_t bitmap_size = bitmaps.GetLocalBitMapSize();
+  auto validity = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0), bitmap_size);
+  auto value = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(1), bitmap_size);
+
+  ArrayDataVector all_outputs;
+  all_outputs.reserve(output_vector.size() + 1);
+  all_outputs.push_back(
+      arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value}));
+  all_outputs.insert(all_outputs.end(), output_vector.begin(), output_vector.end());
+
+  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, all_outputs);
+  ARROW_RETURN_NOT_OK(Eval(*compiled_exprs_[0], SelectionVector::MODE_NONE,
+                           eval_batch.get(), nullptr));
+
+  auto result = bitmaps.GetLocalBitMap(2);
+  BitMapAccumulator::IntersectBitMaps(
+      result, {bitmaps.GetLocalBitMap(0), bitmaps.GetLocalBitMap(1)}, {0, 0}, num_rows);
+  ARROW_RETURN_NOT_OK(
+      selection_vector->PopulateFromBitMap(result, bitmap_size, num_rows - 1));
+  if (selection_vector->GetNumSlots() == 0) {
+    return Status::OK();
+  }
 
-    // generate validity vectors.
-    ComputeBitMapsForExpr(*compiled_expr, *eval_batch, selection_vector);
+  for (size_t i = 1; i < compiled_exprs_.size(); ++i) {
+    ARROW_RETURN_NOT_OK(Eval(*compiled_exprs_[i], selection_vector_mode_,
+                             eval_batch.get(), selection_vector));
   }
+  return Status::OK();
+}
+
+Status LLVMGenerator::Eval(const CompiledExpr& compiled_expr, SelectionVector::Mode mode,
+                           EvalBatch* eval_batch,
+                           const SelectionVector* selection_vector) {
+  // generate data/offset vectors.
+  const uint8_t* selection_buffer = nullptr;
+  auto num_output_rows = eval_batch->num_records();
+  if (selection_vector != nullptr) {
+    selection_buffer = selection_vector->GetBuffer().data();
+    num_output_rows = selection_vector->GetNumSlots();
+  }
+
+  EvalFunc jit_function = compiled_expr.GetJITFunction(mode);
+  jit_function(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
+               eval_batch->GetLocalBitMapArray(), selection_buffer,
+               (int64_t)eval_batch->GetExecutionContext(), num_output_rows);
 
+  // check for execution errors
+  ARROW_RETURN_IF(
+      eval_batch->GetExecutionContext()->has_error(),
+      Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+
+  // generate validity vectors.
+  ComputeBitMapsForExpr(compiled_expr, *eval_batch, selection_vector);
   return Status::OK();
 }
 
@@ -188,6 +338,12 @@ llvm::Value* LLVMGenerator::GetOffsetsReference(llvm::Value* arg_addrs, int idx,
   return ir_builder()->CreateIntToPtr(load, types()->i32_ptr_type(), name + "_oarray");
 }
 
+llvm::Constant* LLVMGenerator::AddressConstant(const void* address) {
+  // The address is only valid in this process
+  engine_->DisableObjectCache();
+  return types()->i64_constant(reinterpret_cast<int64_t>(address));
+}
+
 /// Get reference to local bitmap array at specified index in the args list.
 llvm::Value* LLVMGenerator::GetLocalBitMapReference(llvm::Value* arg_bitmaps, int idx) {
   llvm::Value* load = LoadVectorAtIndex(arg_bitmaps, idx, "");
@@ -304,15 +460,7 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   llvm::BasicBlock* loop_body = llvm::BasicBlock::Create(*context(), "loop", *fn);
   llvm::BasicBlock* loop_exit = llvm::BasicBlock::Create(*context(), "exit", *fn);
 
-  // Add reference to output vector (in entry block)
   builder->SetInsertPoint(loop_entry);
-  llvm::Value* output_ref =
-      GetDataReference(arg_addrs, output->data_idx(), output->field());
-  llvm::Value* output_buffer_ptr_ref = GetDataBufferPtrReference(
-      arg_addrs, output->data_buffer_ptr_idx(), output->field());
-  llvm::Value* output_offset_ref =
-      GetOffsetsReference(arg_addrs, output->offsets_idx(), output->field());
-
   std::vector<llvm::Value*> slice_offsets;
   for (int idx = 0; idx < buffer_count; idx++) {
     auto offsetAddr = builder->CreateGEP(arg_addr_offsets, types()->i32_constant(idx));
@@ -320,6 +468,65 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
     slice_offsets.push_back(offset);
   }
 
+  // Generate the loop with the validity of the inputs read for each record. If some
+  // are, also generate a dense loop assuming all inputs valid, which is picked when
+  // none of the input validity buffers is set (ie. the inputs have no nulls).
+  std::set<int> validity_idxs;
+  ARROW_RETURN_NOT_OK(CodeGenExprLoop(value_expr, output, *fn, loop_entry, loop_body,
+                                      loop_exit, arg_addrs, arg_local_bitmaps,
+                                      arg_selection_vector, arg_context_ptr,
+                                      arg_nrecords, slice_offsets, selection_vector_mode,
+                                      false /*inputs_valid*/, &validity_idxs));
+
+  builder->SetInsertPoint(loop_entry);
+  if (validity_idxs.empty()) {
+    builder->CreateBr(loop_body);
+  } else {
+    llvm::BasicBlock* dense_loop_body =
+        llvm::BasicBlock::Create(*context(), "dense_loop", *fn, loop_exit);
+    std::set<int> dense_validity_idxs;
+    ARROW_RETURN_NOT_OK(CodeGenExprLoop(
+        value_expr, output, *fn, loop_entry, dense_loop_body, loop_exit, arg_addrs,
+        arg_local_bitmaps, arg_selection_vector, arg_context_ptr, arg_nrecords,
+        slice_offsets, selection_vector_mode, true /*inputs_valid*/,
+        &dense_validity_idxs));
+
+    builder->SetInsertPoint(loop_entry);
+    llvm::Value* inputs_valid = types()->true_constant();
+    for (int idx : validity_idxs) {
+      llvm::Value* validity_addr = LoadVectorAtIndex(arg_addrs, idx, "validity");
+      inputs_valid = builder->CreateAnd(
+          inputs_valid, builder->CreateICmpEQ(validity_addr, types()->i64_constant(0)),
+          "inputs_valid");
+    }
+    builder->CreateCondBr(inputs_valid, dense_loop_body, loop_body);
+  }
+
+  // Loop exit
+  builder->SetInsertPoint(loop_exit);
+  builder->CreateRet(types()->i32_constant(0));
+  return Status::OK();
+}
+
+Status LLVMGenerator::CodeGenExprLoop(
+    DexPtr value_expr, FieldDescriptorPtr output, llvm::Function* fn,
+    llvm::BasicBlock* loop_entry, llvm::BasicBlock* loop_body,
+    llvm::BasicBlock* loop_exit, llvm::Value* arg_addrs, llvm::Value* arg_local_bitmaps,
+    llvm::Value* arg_selection_vector, llvm::Value* arg_context_ptr,
+    llvm::Value* arg_nrecords, const std::vector<llvm::Value*>& slice_offsets,
+    SelectionVector::Mode selection_vector_mode, bool inputs_valid,
+    std::set<int>* validity_idxs) {
+  llvm::IRBuilder<>* builder = ir_builder();
+
+  // The output references are loaded in the entry block.
+  builder->SetInsertPoint(loop_entry);
+  llvm::Value* output_ref =
+      GetDataReference(arg_addrs, output->data_idx(), output->field());
+  llvm::Value* output_buffer_ptr_ref = GetDataBufferPtrReference(
+      arg_addrs, output->data_buffer_ptr_idx(), output->field());
+  llvm::Value* output_offset_ref =
+      GetOffsetsReference(arg_addrs, output->offsets_idx(), output->field());
+
   // Loop body
   builder->SetInsertPoint(loop_body);
 
@@ -335,18 +542,15 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   }
 
   // The visitor can add code to both the entry/loop blocks.
-  Visitor visitor(this, *fn, loop_entry, arg_addrs, arg_local_bitmaps, slice_offsets,
-                  arg_context_ptr, position_var);
+  Visitor visitor(this, fn, loop_entry, arg_addrs, arg_local_bitmaps, slice_offsets,
+                  arg_context_ptr, position_var, inputs_valid);
   value_expr->Accept(visitor);
   LValuePtr output_value = visitor.result();
+  *validity_idxs = visitor.validity_idxs();
 
   // The "current" block may have changed due to code generation in the visitor.
   llvm::BasicBlock* loop_body_tail = builder->GetInsertBlock();
 
-  // add jump to "loop block" at the end of the "setup block".
-  builder->SetInsertPoint(loop_entry);
-  builder->CreateBr(loop_body);
-
   // save the value in the output vector.
   builder->SetInsertPoint(loop_body_tail);
 
@@ -388,10 +592,6 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   llvm::Value* loop_var_check =
       builder->CreateICmpSLT(loop_update, arg_nrecords, "loop_var < nrec");
   builder->CreateCondBr(loop_var_check, loop_body, loop_exit);
-
-  // Loop exit
-  builder->SetInsertPoint(loop_exit);
-  builder->CreateRet(types()->i32_constant(0));
   return Status::OK();
 }
 
@@ -524,7 +724,8 @@ LLVMGenerator::Visitor::Visitor(LLVMGenerator* generator, llvm::Function* functi
                                 llvm::BasicBlock* entry_block, llvm::Value* arg_addrs,
                                 llvm::Value* arg_local_bitmaps,
                                 std::vector<llvm::Value*> slice_offsets,
-                                llvm::Value* arg_context_ptr, llvm::Value* loop_var)
+                                llvm::Value* arg_context_ptr, llvm::Value* loop_var,
+                                bool inputs_valid)
     : generator_(generator),
       function_(function),
       entry_block_(entry_block),
@@ -533,6 +734,7 @@ LLVMGenerator::Visitor::Visitor(LLVMGenerator* generator, llvm::Function* functi
       slice_offsets_(slice_offsets),
       arg_context_ptr_(arg_context_ptr),
       loop_var_(loop_var),
+      inputs_valid_(inputs_valid),
       has_arena_allocs_(false) {
   ADD_VISITOR_TRACE("Iteration %T", loop_var);
 }
@@ -603,6 +805,12 @@ void LLVMGenerator::Visitor::Visit(const VectorReadVarLenValueDex& dex) {
 }
 
 void LLVMGenerator::Visitor::Visit(const VectorReadValidityDex& dex) {
+  validity_idxs_.insert(dex.ValidityIdx());
+  if (inputs_valid_) {
+    result_.reset(new LValue(generator_->types()->true_constant()));
+    return;
+  }
+
   llvm::IRBuilder<>* builder = ir_builder();
   llvm::Value* slot_ref =
       GetBufferReference(dex.ValidityIdx(), kBufferTypeValidity, dex.Field());
@@ -686,7 +894,7 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = arrow::util::get<std::string>(dex.holder());
 
-      llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
+      llvm::Constant* str_int_cast = generator_->AddressConstant(str.c_str());
       value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
       len = types->i32_constant(static_cast<int32_t>(str.length()));
       break;
@@ -1028,7 +1236,7 @@ void LLVMGenerator::Visitor::VisitInExpression(const InExprDexBase<Type>& dex) {
   const InExprDex<Type>& dex_instance = dynamic_cast<const InExprDex<Type>&>(dex);
   /* add the holder at the beginning */
   llvm::Constant* ptr_int_cast =
-      types->i64_constant((int64_t)(dex_instance.in_holder().get()));
+      generator_->AddressConstant(dex_instance.in_holder().get());
   params.push_back(ptr_int_cast);
 
   /* eval expr result */
@@ -1184,7 +1392,6 @@ LValuePtr LLVMGenerator::Visitor::BuildFunctionCall(const NativeFunction* func,
 std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
     FunctionHolder* holder, const ValueValidityPairVector& args, bool with_validity,
     bool with_context) {
-  LLVMTypes* types = generator_->types();
   std::vector<llvm::Value*> params;
 
   // add context if required.
@@ -1194,7 +1401,7 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer.
   if (holder != nullptr) {
-    auto ptr = types->i64_constant((int64_t)holder);
+    auto ptr = generator_->AddressConstant(holder);
     params.push_back(ptr);
   }
 
@@ -1340,7 +1547,7 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
 
   // cast this to an llvm pointer.
   const char* str = trace_strings_.back().c_str();
-  llvm::Constant* str_int_cast = types()->i64_constant((int64_t)str);
+  llvm::Constant* str_int_cast = AddressConstant(str);
   llvm::Constant* str_ptr_cast =
       llvm::ConstantExpr::getIntToPtr(str_int_cast, types()->i8_ptr_type());
 
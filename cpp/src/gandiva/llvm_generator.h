@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -27,6 +28,7 @@
 
 #include "gandiva/annotator.h"
 #include "gandiva/compiled_expr.h"
+#include "gandiva/condition.h"
 #include "gandiva/configuration.h"
 #include "gandiva/dex_visitor.h"
 #include "gandiva/engine.h"
@@ -51,7 +53,8 @@ class GANDIVA_EXPORT LLVMGenerator {
                      std::unique_ptr<LLVMGenerator>* llvm_generator);
 
   /// \brief Build the code for the expression trees for default mode. Each
-  /// element in the vector represents an expression tree
+  /// element in the vector represents an expression tree. In default mode, the
+  /// subtrees shared by the expressions are evaluated once per batch.
   Status Build(const ExpressionVector& exprs, SelectionVector::Mode mode);
 
   /// \brief Build the code for the expression trees for default mode. Each
@@ -60,6 +63,12 @@ class GANDIVA_EXPORT LLVMGenerator {
     return Build(exprs, SelectionVector::Mode::MODE_NONE);
   }
 
+  /// \brief Build the code for a filter condition, and for expression trees evaluated
+  /// only on the records matching it. The condition is evaluated in default mode, the
+  /// expressions with a selection vector of the given mode.
+  Status BuildFilterProject(ConditionPtr condition, const ExpressionVector& exprs,
+                            SelectionVector::Mode mode);
+
   /// \brief Execute the built expression against the provided arguments for
   /// default mode.
   Status Execute(const arrow::RecordBatch& record_batch,
@@ -71,10 +80,18 @@ class GANDIVA_EXPORT LLVMGenerator {
                  const SelectionVector* selection_vector,
                  const ArrayDataVector& output_vector);
 
+  /// \brief Execute the code built by BuildFilterProject(). The records matching the
+  /// condition are stored in 'selection_vector', and the output arrays are populated
+  /// for these records only, at consecutive positions.
+  Status ExecuteFilterProject(const arrow::RecordBatch& record_batch,
+                              SelectionVector* selection_vector,
+                              const ArrayDataVector& output_vector);
+
   SelectionVector::Mode selection_vector_mode() { return selection_vector_mode_; }
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
   std::string DumpIR() { return engine_->DumpIR(); }
+  size_t code_size() const { return engine_->code_size(); }
 
  private:
   LLVMGenerator();
@@ -92,7 +109,7 @@ class GANDIVA_EXPORT LLVMGenerator {
     Visitor(LLVMGenerator* generator, llvm::Function* function,
             llvm::BasicBlock* entry_block, llvm::Value* arg_addrs,
             llvm::Value* arg_local_bitmaps, std::vector<llvm::Value*> slice_offsets,
-            llvm::Value* arg_context_ptr, llvm::Value* loop_var);
+            llvm::Value* arg_context_ptr, llvm::Value* loop_var, bool inputs_valid);
 
     void Visit(const VectorReadValidityDex& dex) override;
     void Visit(const VectorReadFixedLenValueDex& dex) override;
@@ -117,6 +134,9 @@ class GANDIVA_EXPORT LLVMGenerator {
 
     bool has_arena_allocs() { return has_arena_allocs_; }
 
+    /// The indices of the input validity buffers read by the expression.
+    const std::set<int>& validity_idxs() { return validity_idxs_; }
+
    private:
     enum BufferType { kBufferTypeValidity = 0, kBufferTypeData, kBufferTypeOffsets };
 
@@ -165,12 +185,23 @@ class GANDIVA_EXPORT LLVMGenerator {
     std::vector<llvm::Value*> slice_offsets_;
     llvm::Value* arg_context_ptr_;
     llvm::Value* loop_var_;
+    // Whether all inputs are known to be valid, the validity buffers aren't read then.
+    bool inputs_valid_;
+    std::set<int> validity_idxs_;
     bool has_arena_allocs_;
   };
 
-  // Generate the code for one expression for default mode, with the output of
+  // Generate the code for one expression for the given mode, with the output of
   // the expression going to 'output'.
-  Status Add(const ExpressionPtr expr, const FieldDescriptorPtr output);
+  Status Add(const ExpressionPtr expr, const FieldDescriptorPtr output,
+             SelectionVector::Mode mode);
+
+  // Compile the module, and set the jit functions of the expressions.
+  Status Finalize();
+
+  // Execute one expression, and compute the validity bitmap of its output.
+  Status Eval(const CompiledExpr& compiled_expr, SelectionVector::Mode mode,
+              EvalBatch* eval_batch, const SelectionVector* selection_vector);
 
   /// Generate code to load the vector at specified index in the 'arg_addrs' array.
   llvm::Value* LoadVectorAtIndex(llvm::Value* arg_addrs, int idx,
@@ -193,6 +224,23 @@ class GANDIVA_EXPORT LLVMGenerator {
                           int suffix_idx, llvm::Function** fn,
                           SelectionVector::Mode selection_vector_mode);
 
+  /// Generate the loop evaluating the value of one expression for each record, from
+  /// 'loop_body' to 'loop_exit'. If 'inputs_valid', the inputs are assumed to have no
+  /// nulls. The validity buffers read otherwise are returned in 'validity_idxs'.
+  Status CodeGenExprLoop(DexPtr value_expr, FieldDescriptorPtr output,
+                         llvm::Function* fn, llvm::BasicBlock* loop_entry,
+                         llvm::BasicBlock* loop_body, llvm::BasicBlock* loop_exit,
+                         llvm::Value* arg_addrs, llvm::Value* arg_local_bitmaps,
+                         llvm::Value* arg_selection_vector, llvm::Value* arg_context_ptr,
+                         llvm::Value* arg_nrecords,
+                         const std::vector<llvm::Value*>& slice_offsets,
+                         SelectionVector::Mode selection_vector_mode, bool inputs_valid,
+                         std::set<int>* validity_idxs);
+
+  /// Generate a constant holding the address of an object of this process. The
+  /// module can't be saved in the object cache then.
+  llvm::Constant* AddressConstant(const void* address);
+
   /// Generate code to load the local bitmap specified index and cast it as bitmap.
   llvm::Value* GetLocalBitMapReference(llvm::Value* arg_bitmaps, int idx);
 
@@ -243,6 +291,10 @@ class GANDIVA_EXPORT LLVMGenerator {
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
 
+  // The fields holding the results of the shared subtrees, computed by the first
+  // compiled expressions into temporary arrays.
+  FieldVector intermediate_fields_;
+
   // used for debug
   bool enable_ir_traces_;
   std::vector<std::string> trace_strings_;
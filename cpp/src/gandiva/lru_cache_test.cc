@@ -61,4 +61,22 @@ TEST_F(TestLruCache, TestLruBehavior) {
   // should have evicted key 2.
   ASSERT_EQ(*cache_.get(TestCacheKey(1)), "hello");
 }
+
+TEST_F(TestLruCache, TestCost) {
+  LruCache<TestCacheKey, std::string> cache(10);
+  ASSERT_EQ(0, cache.insert(TestCacheKey(1), "hello", 4));
+  ASSERT_EQ(0, cache.insert(TestCacheKey(2), "hello", 4));
+  ASSERT_EQ(8, cache.cost());
+  // should evict key 1 to make room
+  ASSERT_EQ(1, cache.insert(TestCacheKey(3), "hello", 4));
+  ASSERT_EQ(8, cache.cost());
+  ASSERT_EQ(cache.get(TestCacheKey(1)), boost::none);
+  // should evict keys 2 and 3
+  ASSERT_EQ(2, cache.insert(TestCacheKey(4), "hello", 10));
+  ASSERT_EQ(1, cache.size());
+  // larger than the capacity, not cached
+  ASSERT_EQ(0, cache.insert(TestCacheKey(5), "hello", 11));
+  ASSERT_EQ(cache.get(TestCacheKey(5)), boost::none);
+  ASSERT_EQ(*cache.get(TestCacheKey(4)), "hello");
+}
 }  // namespace gandiva
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include "arrow/util/config.h"
+#include "arrow/util/hashing.h"
+
+namespace gandiva {
+
+ObjectCache::ObjectCache(std::string directory) : directory_(std::move(directory)) {}
+
+const std::string& ObjectCache::HostFingerprint() {
+  static const std::string fingerprint = [] {
+    std::stringstream ss;
+    ss << "llvm " << LLVM_VERSION_STRING << "; arrow " << ARROW_VERSION << "; "
+       << llvm::sys::getProcessTriple() << "; " << llvm::sys::getHostCPUName().str();
+
+    // The features are not ordered in the map
+    llvm::StringMap<bool> host_features;
+    std::vector<std::string> features;
+    if (llvm::sys::getHostCPUFeatures(host_features)) {
+      for (auto& feature : host_features) {
+        features.push_back((feature.second ? "+" : "-") + feature.first().str());
+      }
+    }
+    std::sort(features.begin(), features.end());
+    for (auto& feature : features) {
+      ss << " " << feature;
+    }
+    return ss.str();
+  }();
+  return fingerprint;
+}
+
+bool ObjectCache::Lookup(const std::string& module_ir, bool optimize) {
+  std::string key = HostFingerprint();
+  key += optimize ? "; O3\n" : "; O0\n";
+  key += module_ir;
+
+  // Two independent 64-bit hashes make collisions practically impossible
+  char name[64];
+  snprintf(name, sizeof(name), "%016llx%016llx.o",
+           static_cast<unsigned long long>(  // NOLINT
+               arrow::internal::ComputeStringHash<0>(key.data(), key.size())),
+           static_cast<unsigned long long>(  // NOLINT
+               arrow::internal::ComputeStringHash<1>(key.data(), key.size())));
+  llvm::SmallString<256> path(directory_);
+  llvm::sys::path::append(path, name);
+  path_ = path.str().str();
+
+  auto buffer_or_error = llvm::MemoryBuffer::getFile(path_);
+  if (!buffer_or_error) {
+    return false;
+  }
+  object_ = std::move(buffer_or_error.get());
+  return true;
+}
+
+void ObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                       llvm::MemoryBufferRef object) {
+  if (path_.empty()) {
+    return;
+  }
+  if (llvm::sys::fs::create_directories(directory_)) {
+    return;
+  }
+
+  // Write to a temporary file first, so that other processes never see a
+  // partially written object.
+  int fd;
+  llvm::SmallString<256> temp_path;
+  if (llvm::sys::fs::createUniqueFile(path_ + "-%%%%%%%%.tmp", fd, temp_path)) {
+    return;
+  }
+  bool ok;
+  {
+    llvm::raw_fd_ostream stream(fd, /*shouldClose=*/true);
+    stream << object.getBuffer();
+    stream.close();
+    ok = !stream.has_error();
+    stream.clear_error();
+  }
+  if (!ok || llvm::sys::fs::rename(temp_path, path_)) {
+    llvm::sys::fs::remove(temp_path);
+  }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> ObjectCache::getObject(const llvm::Module* module) {
+  // The execution engine takes ownership of the object
+  return std::move(object_);
+}
+
+}  // namespace gandiva
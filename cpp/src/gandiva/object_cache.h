@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "gandiva/llvm_includes.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Persistent cache of the object code compiled for LLVM modules.
+///
+/// Objects are saved as files in a directory shared by all processes, named by a
+/// hash of the module IR, the optimisation level, and a fingerprint of the LLVM
+/// version, the gandiva version and the host CPU. The cache is best effort: objects
+/// that can't be read or written are compiled again.
+class GANDIVA_EXPORT ObjectCache : public llvm::ObjectCache {
+ public:
+  explicit ObjectCache(std::string directory);
+
+  /// Look up the object compiled for a module, given its IR before optimisation.
+  /// Returns true if it was found, in which case the execution engine will load it
+  /// instead of compiling the module. Otherwise, the compiled object is saved under
+  /// this key.
+  bool Lookup(const std::string& module_ir, bool optimize);
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override;
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+  /// The path of the file holding the object looked up last.
+  const std::string& path() const { return path_; }
+
+ private:
+  static const std::string& HostFingerprint();
+
+  std::string directory_;
+  std::string path_;
+  std::unique_ptr<llvm::MemoryBuffer> object_;
+};
+
+}  // namespace gandiva
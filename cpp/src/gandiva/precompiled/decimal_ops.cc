@@ -46,6 +46,28 @@ static BasicDecimal128 CheckAndReduceScale(const BasicDecimal128& in, int32_t de
   return (delta <= 0) ? in : in.ReduceScaleBy(delta);
 }
 
+// Decimals of precision up to kMaxDecimal64Precision fit in the low 64 bits.
+static int64_t ToInt64(const BasicDecimal128& in) {
+  return static_cast<int64_t>(in.low_bits());
+}
+
+static int64_t CheckAndIncreaseScale64(int64_t in, int32_t delta) {
+  return (delta <= 0)
+             ? in
+             : in * static_cast<int64_t>(
+                        BasicDecimal128::GetScaleMultiplier(delta).low_bits());
+}
+
+/// Same as AddFastPath, when both the scaled values and the sum fit in 64 bits.
+static BasicDecimal128 AddFastPath64(const BasicDecimalScalar128& x,
+                                     const BasicDecimalScalar128& y) {
+  auto higher_scale = std::max(x.scale(), y.scale());
+
+  auto x_scaled = CheckAndIncreaseScale64(ToInt64(x.value()), higher_scale - x.scale());
+  auto y_scaled = CheckAndIncreaseScale64(ToInt64(y.value()), higher_scale - y.scale());
+  return BasicDecimal128(x_scaled + y_scaled);
+}
+
 /// Adjust x and y to the same scale, and add them.
 static BasicDecimal128 AddFastPath(const BasicDecimalScalar128& x,
                                    const BasicDecimalScalar128& y, int32_t out_scale) {
@@ -210,7 +232,10 @@ inline int32_t MinLeadingZeros(const BasicDecimalScalar128& x,
 
 BasicDecimal128 Add(const BasicDecimalScalar128& x, const BasicDecimalScalar128& y,
                     int32_t out_precision, int32_t out_scale) {
-  if (out_precision < DecimalTypeUtil::kMaxPrecision) {
+  if (out_precision <= DecimalTypeUtil::kMaxDecimal64Precision) {
+    // fast-path add, in 64-bit arithmetic
+    return AddFastPath64(x, y);
+  } else if (out_precision < DecimalTypeUtil::kMaxPrecision) {
     // fast-path add
     return AddFastPath(x, y, out_scale);
   } else {
@@ -332,7 +357,11 @@ BasicDecimal128 Multiply(const BasicDecimalScalar128& x, const BasicDecimalScala
                          int32_t out_precision, int32_t out_scale, bool* overflow) {
   BasicDecimal128 result;
   *overflow = false;
-  if (out_precision < DecimalTypeUtil::kMaxPrecision) {
+  if (out_precision <= DecimalTypeUtil::kMaxDecimal64Precision) {
+    // fast-path multiply, in 64-bit arithmetic
+    result = BasicDecimal128(ToInt64(x.value()) * ToInt64(y.value()));
+    DCHECK_EQ(x.scale() + y.scale(), out_scale);
+  } else if (out_precision < DecimalTypeUtil::kMaxPrecision) {
     // fast-path multiply
     result = x.value() * y.value();
     DCHECK_EQ(x.scale() + y.scale(), out_scale);
@@ -443,6 +472,15 @@ int32_t Compare(const BasicDecimalScalar128& x, const BasicDecimalScalar128& y)
     return CompareSameScale(x.value(), y.value());
   }
 
+  // fast-path : both fit in 64 bits after adjusting the scale.
+  if (std::max(x.precision() - x.scale(), y.precision() - y.scale()) +
+          std::max(x.scale(), y.scale()) <=
+      DecimalTypeUtil::kMaxDecimal64Precision) {
+    auto x_scaled = CheckAndIncreaseScale64(ToInt64(x.value()), -delta_scale);
+    auto y_scaled = CheckAndIncreaseScale64(ToInt64(y.value()), delta_scale);
+    return (x_scaled == y_scaled) ? 0 : ((x_scaled < y_scaled) ? -1 : 1);
+  }
+
   // Check if we'll need more than 256-bits after adjusting the scale.
   bool need256 =
       (delta_scale < 0 && x.precision() - delta_scale > DecimalTypeUtil::kMaxPrecision) ||
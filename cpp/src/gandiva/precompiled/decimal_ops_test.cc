@@ -196,6 +196,14 @@ TEST_F(TestDecimalSql, Add) {
                DecimalScalar128{"301", 30, 3},   // y
                DecimalScalar128{"502", 31, 3});  // expected
 
+  // fast-path in 64-bit arithmetic : out_precision <= 18
+  AddAndVerify(DecimalScalar128{"-123456789012", 12, 2},        // x
+               DecimalScalar128{"99999999999", 11, 4},          // y
+               DecimalScalar128{"-12245678901201", 15, 4});     // expected
+  AddAndVerify(DecimalScalar128{"99999999999999999", 17, 0},    // x
+               DecimalScalar128{"99999999999999999", 17, 0},    // y
+               DecimalScalar128{"199999999999999998", 18, 0});  // expected
+
   // max precision
   AddAndVerify(DecimalScalar128{"09999999999999999999999999999999000000", 38, 5},  // x
                DecimalScalar128{"100", 38, 7},                                     // y
@@ -218,6 +226,11 @@ TEST_F(TestDecimalSql, Subtract) {
                     DecimalScalar128{"301", 30, 3},    // y
                     DecimalScalar128{"-100", 31, 3});  // expected
 
+  // fast-path in 64-bit arithmetic : out_precision <= 18
+  SubtractAndVerify(DecimalScalar128{"-123456789012", 12, 2},     // x
+                    DecimalScalar128{"99999999999", 11, 4},       // y
+                    DecimalScalar128{"-12445678901199", 15, 4});  // expected
+
   // max precision
   SubtractAndVerify(
       DecimalScalar128{"09999999999999999999999999999999000000", 38, 5},  // x
@@ -243,6 +256,12 @@ TEST_F(TestDecimalSql, Multiply) {
                            DecimalScalar128{"60501", 21, 5},  // expected
                            false);                            // overflow
 
+  // fast-path in 64-bit arithmetic : out_precision <= 18
+  MultiplyAndVerifyAllSign(DecimalScalar128{"12345678", 8, 2},            // x
+                           DecimalScalar128{"987654321", 9, 3},           // y
+                           DecimalScalar128{"12193262222374638", 18, 5},  // expected
+                           false);                                        // overflow
+
   // right 0
   MultiplyAndVerify(DecimalScalar128{"201", 20, 3},  // x
                     DecimalScalar128{"0", 20, 2},    // y
@@ -17,10 +17,14 @@
 
 #include "gandiva/projector.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
@@ -28,13 +32,23 @@
 
 namespace gandiva {
 
+namespace {
+
+Cache<ProjectorCacheKey, std::shared_ptr<Projector>>& GetCache() {
+  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
+  return cache;
+}
+
+}  // namespace
+
 Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                      const FieldVector& output_fields,
                      std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
       schema_(schema),
       output_fields_(output_fields),
-      configuration_(configuration) {}
+      configuration_(configuration),
+      optimized_(arrow::Future<>::MakeFinished()) {}
 
 Projector::~Projector() {}
 
@@ -55,13 +69,30 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
                        SelectionVector::Mode selection_vector_mode,
                        std::shared_ptr<Configuration> configuration,
                        std::shared_ptr<Projector>* projector) {
+  return MakeImpl(schema, exprs, selection_vector_mode, configuration,
+                  /*async=*/false, projector);
+}
+
+Status Projector::MakeAsync(SchemaPtr schema, const ExpressionVector& exprs,
+                            SelectionVector::Mode selection_vector_mode,
+                            std::shared_ptr<Configuration> configuration,
+                            std::shared_ptr<Projector>* projector) {
+  return MakeImpl(schema, exprs, selection_vector_mode, configuration,
+                  /*async=*/true, projector);
+}
+
+Status Projector::MakeImpl(SchemaPtr schema, const ExpressionVector& exprs,
+                           SelectionVector::Mode selection_vector_mode,
+                           std::shared_ptr<Configuration> configuration, bool async,
+                           std::shared_ptr<Projector>* projector) {
   ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
   ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
   ARROW_RETURN_IF(configuration == nullptr,
                   Status::Invalid("Configuration cannot be null"));
 
-  // see if equivalent projector was already built
-  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
+  // see if equivalent projector was already built. It may still be optimising
+  // in the background if built by MakeAsync().
+  auto& cache = GetCache();
   ProjectorCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
   std::shared_ptr<Projector> cached_projector = cache.GetModule(cache_key);
   if (cached_projector != nullptr) {
@@ -69,6 +100,40 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
     return Status::OK();
   }
 
+  // Without optimisations, the code is compiled much faster.
+  async = async && configuration->optimize();
+  auto build_configuration = configuration;
+  if (async) {
+    build_configuration = std::make_shared<Configuration>(*configuration);
+    build_configuration->set_optimize(false);
+  }
+
+  std::unique_ptr<LLVMGenerator> llvm_gen;
+  ARROW_RETURN_NOT_OK(BuildGenerator(schema, exprs, selection_vector_mode,
+                                     build_configuration, &llvm_gen));
+
+  // save the output field types. Used for validation at Evaluate() time.
+  std::vector<FieldPtr> output_fields;
+  output_fields.reserve(exprs.size());
+  for (auto& expr : exprs) {
+    output_fields.push_back(expr->result());
+  }
+
+  // Instantiate the projector with the completely built llvm generator
+  *projector = std::shared_ptr<Projector>(
+      new Projector(std::move(llvm_gen), schema, output_fields, configuration));
+  if (async) {
+    ARROW_RETURN_NOT_OK(StartOptimizedBuild(*projector, exprs, selection_vector_mode));
+  }
+  cache.PutModule(cache_key, *projector, (*projector)->generator()->code_size());
+
+  return Status::OK();
+}
+
+Status Projector::BuildGenerator(SchemaPtr schema, const ExpressionVector& exprs,
+                                 SelectionVector::Mode selection_vector_mode,
+                                 std::shared_ptr<Configuration> configuration,
+                                 std::unique_ptr<LLVMGenerator>* llvm_generator) {
   // Build LLVM generator, and generate code for the specified expressions
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
@@ -82,20 +147,33 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
   }
 
   ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
+  *llvm_generator = std::move(llvm_gen);
+  return Status::OK();
+}
 
-  // save the output field types. Used for validation at Evaluate() time.
-  std::vector<FieldPtr> output_fields;
-  output_fields.reserve(exprs.size());
-  for (auto& expr : exprs) {
-    output_fields.push_back(expr->result());
-  }
+Status Projector::StartOptimizedBuild(std::shared_ptr<Projector> projector,
+                                      const ExpressionVector& exprs,
+                                      SelectionVector::Mode selection_vector_mode) {
+  auto optimized = arrow::Future<>::Make();
+  projector->optimized_ = optimized;
+  return arrow::internal::GetCpuThreadPool()->Spawn(
+      [projector, exprs, selection_vector_mode, optimized]() mutable {
+        std::unique_ptr<LLVMGenerator> llvm_gen;
+        Status status = BuildGenerator(projector->schema_, exprs, selection_vector_mode,
+                                       projector->configuration_, &llvm_gen);
+        // On failure, keep using the unoptimised code
+        if (status.ok()) {
+          std::atomic_store(&projector->llvm_generator_,
+                            std::shared_ptr<LLVMGenerator>(std::move(llvm_gen)));
+        }
+        optimized.MarkFinished(status);
+      });
+}
 
-  // Instantiate the projector with the completely built llvm generator
-  *projector = std::shared_ptr<Projector>(
-      new Projector(std::move(llvm_gen), schema, output_fields, configuration));
-  cache.PutModule(cache_key, *projector);
+CacheStats Projector::GetCacheStats() { return GetCache().stats(); }
 
-  return Status::OK();
+std::shared_ptr<LLVMGenerator> Projector::generator() const {
+  return std::atomic_load(&llvm_generator_);
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch,
@@ -130,7 +208,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
         ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_rows));
     ++idx;
   }
-  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  return Execute(batch, selection_vector, output_data_vecs);
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
@@ -157,8 +235,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   }
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+  ARROW_RETURN_NOT_OK(Execute(batch, selection_vector, output_data_vecs));
 
   // Create and return array arrays.
   output->clear();
@@ -168,6 +245,60 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   return Status::OK();
 }
 
+namespace {
+
+// Slice an output for the records in [offset, offset + length). The generated code
+// writes outputs from the start of their buffers, so the buffers are sliced instead
+// of setting an offset. 'offset' is a multiple of 8, so that the bitmaps of different
+// slices don't share any byte.
+ArrayDataPtr SliceOutput(const arrow::ArrayData& array_data, int64_t offset,
+                         int64_t length) {
+  DCHECK_EQ(offset % 8, 0);
+  const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*array_data.type);
+  auto validity = arrow::SliceBuffer(array_data.buffers[0], offset / 8,
+                                     arrow::BitUtil::BytesForBits(length));
+  auto data = arrow::SliceBuffer(
+      array_data.buffers[1], offset * fw_type.bit_width() / 8,
+      arrow::BitUtil::BytesForBits(length * fw_type.bit_width()));
+  return arrow::ArrayData::Make(array_data.type, length, {validity, data});
+}
+
+}  // namespace
+
+Status Projector::Execute(const arrow::RecordBatch& batch,
+                          const SelectionVector* selection_vector,
+                          const ArrayDataVector& output_data_vecs) {
+  auto llvm_generator = generator();
+  const int64_t num_rows = batch.num_rows();
+  int64_t chunk_size = configuration_->parallel_chunk_size();
+  bool parallel = chunk_size > 0 && num_rows > chunk_size && selection_vector == nullptr;
+  for (auto& field : output_fields_) {
+    parallel = parallel && !arrow::is_binary_like(field->type()->id());
+  }
+  if (!parallel) {
+    return llvm_generator->Execute(batch, selection_vector, output_data_vecs);
+  }
+
+  // The generated code has no state across records, so that each chunk can be
+  // evaluated independently.
+  chunk_size = arrow::BitUtil::RoundUpToMultipleOf64(chunk_size);
+  auto task_group =
+      arrow::internal::TaskGroup::MakeThreaded(arrow::internal::GetCpuThreadPool());
+  for (int64_t offset = 0; offset < num_rows; offset += chunk_size) {
+    const int64_t length = std::min(chunk_size, num_rows - offset);
+    task_group->Append([&, offset, length]() {
+      auto chunk = batch.Slice(offset, length);
+      ArrayDataVector chunk_outputs;
+      chunk_outputs.reserve(output_data_vecs.size());
+      for (auto& array_data : output_data_vecs) {
+        chunk_outputs.push_back(SliceOutput(*array_data, offset, length));
+      }
+      return llvm_generator->Execute(*chunk, nullptr, chunk_outputs);
+    });
+  }
+  return task_group->Finish();
+}
+
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
                                  arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
@@ -267,6 +398,6 @@ Status Projector::ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
   return Status::OK();
 }
 
-std::string Projector::DumpIR() { return llvm_generator_->DumpIR(); }
+std::string Projector::DumpIR() { return generator()->DumpIR(); }
 
 }  // namespace gandiva
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/configuration.h"
@@ -77,6 +78,21 @@ class GANDIVA_EXPORT Projector {
                      std::shared_ptr<Configuration> configuration,
                      std::shared_ptr<Projector>* projector);
 
+  /// Build a projector which can evaluate batches without waiting for the LLVM
+  /// optimisation passes. The expressions are first compiled without optimisations,
+  /// then compiled again with the given configuration on the CPU thread pool; the
+  /// optimised code is used by Evaluate() as soon as it's ready.
+  ///
+  /// \param[in] schema schema for the record batches, and the expressions.
+  /// \param[in] exprs vector of expressions.
+  /// \param[in] selection_vector_mode mode of selection vector
+  /// \param[in] configuration run time configuration.
+  /// \param[out] projector the returned projector object
+  static Status MakeAsync(SchemaPtr schema, const ExpressionVector& exprs,
+                          SelectionVector::Mode selection_vector_mode,
+                          std::shared_ptr<Configuration> configuration,
+                          std::shared_ptr<Projector>* projector);
+
   /// Evaluate the specified record batch, and return the allocated and populated output
   /// arrays. The output arrays will be allocated from the memory pool 'pool', and added
   /// to the vector 'output'.
@@ -119,25 +135,61 @@ class GANDIVA_EXPORT Projector {
 
   std::string DumpIR();
 
+  /// Statistics of the process-wide cache of built projectors.
+  static CacheStats GetCacheStats();
+
+  /// Future completed once Evaluate() uses the code compiled with the configuration
+  /// of the projector. It is already completed unless built by MakeAsync().
+  arrow::Future<> optimized() const { return optimized_; }
+
  private:
   Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
             const FieldVector& output_fields, std::shared_ptr<Configuration>);
 
+  static Status MakeImpl(SchemaPtr schema, const ExpressionVector& exprs,
+                         SelectionVector::Mode selection_vector_mode,
+                         std::shared_ptr<Configuration> configuration, bool async,
+                         std::shared_ptr<Projector>* projector);
+
+  /// Validate the expressions and generate their code.
+  static Status BuildGenerator(SchemaPtr schema, const ExpressionVector& exprs,
+                               SelectionVector::Mode selection_vector_mode,
+                               std::shared_ptr<Configuration> configuration,
+                               std::unique_ptr<LLVMGenerator>* llvm_generator);
+
+  /// Compile the expressions with the configuration of the projector in the
+  /// background, and replace the generator once done.
+  static Status StartOptimizedBuild(std::shared_ptr<Projector> projector,
+                                    const ExpressionVector& exprs,
+                                    SelectionVector::Mode selection_vector_mode);
+
+  /// The current generator, which may be replaced concurrently.
+  std::shared_ptr<LLVMGenerator> generator() const;
+
+  friend class FilterProjector;
+
   /// Allocate an ArrowData of length 'length'.
-  Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                        arrow::MemoryPool* pool, ArrayDataPtr* array_data);
+  static Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
+                               arrow::MemoryPool* pool, ArrayDataPtr* array_data);
 
   /// Validate that the ArrayData has sufficient capacity to accomodate 'num_records'.
   Status ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
                                    const arrow::Field& field, int64_t num_records);
 
+  /// Execute the expressions, splitting the batch across the CPU thread pool if
+  /// configured.
+  Status Execute(const arrow::RecordBatch& batch, const SelectionVector* selection_vector,
+                 const ArrayDataVector& output_data_vecs);
+
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
 
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  // Only accessed atomically
+  std::shared_ptr<LLVMGenerator> llvm_generator_;
   SchemaPtr schema_;
   FieldVector output_fields_;
   std::shared_ptr<Configuration> configuration_;
+  arrow::Future<> optimized_;
 };
 
 }  // namespace gandiva
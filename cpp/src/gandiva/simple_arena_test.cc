@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/memory_pool.h"
+#include "gandiva/execution_context.h"
 
 namespace gandiva {
 
@@ -99,4 +100,27 @@ TEST_F(TestSimpleArena, TestReset2) {
   EXPECT_EQ(arena.avail_bytes(), large_size - small_size);
 }
 
+// the arena of an execution context stays allocated for the next batch
+TEST_F(TestSimpleArena, TestContextReuse) {
+  auto context = ExecutionContext::Acquire();
+  auto p = context->arena()->Allocate(100);
+  EXPECT_NE(p, nullptr);
+  context->set_error_msg("error");
+  int64_t total_bytes = context->arena()->total_bytes();
+  auto address = context.get();
+  ExecutionContext::Release(std::move(context));
+
+  context = ExecutionContext::Acquire();
+  EXPECT_EQ(context.get(), address);
+  EXPECT_FALSE(context->has_error());
+  EXPECT_EQ(context->arena()->total_bytes(), total_bytes);
+  EXPECT_EQ(context->arena()->avail_bytes(), total_bytes);
+
+  // another context is created while this one is in use.
+  auto other = ExecutionContext::Acquire();
+  EXPECT_NE(other.get(), address);
+  ExecutionContext::Release(std::move(other));
+  ExecutionContext::Release(std::move(context));
+}
+
 }  // namespace gandiva
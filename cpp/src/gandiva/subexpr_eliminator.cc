@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/subexpr_eliminator.h"
+
+#include <memory>
+#include <string>
+
+#include "gandiva/function_registry.h"
+#include "gandiva/function_signature.h"
+
+namespace gandiva {
+
+namespace {
+
+// Prefix of the fields holding the result of the shared subtrees.
+const char* kIntermediateFieldPrefix = "__gandiva_cse_";
+
+}  // namespace
+
+void SubexprEliminator::Rewrite(const ExpressionVector& exprs,
+                                ExpressionVector* rewritten,
+                                ExpressionVector* intermediates) {
+  counts_.clear();
+  fields_.clear();
+  for (auto& expr : exprs) {
+    Count(expr->root());
+  }
+
+  rewritten->clear();
+  for (auto& expr : exprs) {
+    auto root = RewriteNode(expr->root(), intermediates);
+    if (root == expr->root()) {
+      rewritten->push_back(expr);
+    } else {
+      rewritten->push_back(std::make_shared<Expression>(root, expr->result()));
+    }
+  }
+}
+
+void SubexprEliminator::Count(const NodePtr& node) {
+  auto function_node = std::dynamic_pointer_cast<FunctionNode>(node);
+  if (function_node == nullptr) {
+    return;
+  }
+  if (++counts_[function_node->ToString()] > 1) {
+    return;
+  }
+  for (auto& child : function_node->children()) {
+    Count(child);
+  }
+}
+
+NodePtr SubexprEliminator::RewriteNode(const NodePtr& node,
+                                       ExpressionVector* intermediates) {
+  auto function_node = std::dynamic_pointer_cast<FunctionNode>(node);
+  if (function_node == nullptr) {
+    return node;
+  }
+
+  const std::string key = function_node->ToString();
+  auto found = fields_.find(key);
+  if (found != fields_.end()) {
+    return std::make_shared<FieldNode>(found->second);
+  }
+
+  // Rewrite the children first, so that the subtrees they share are evaluated before.
+  NodeVector children;
+  bool changed = false;
+  for (auto& child : function_node->children()) {
+    children.push_back(RewriteNode(child, intermediates));
+    changed |= children.back() != child;
+  }
+  NodePtr result = node;
+  if (changed) {
+    result = std::make_shared<FunctionNode>(function_node->descriptor()->name(),
+                                            children, function_node->return_type());
+  }
+
+  if (counts_[key] < 2 || !IsShareable(*function_node)) {
+    return result;
+  }
+  auto field = arrow::field(kIntermediateFieldPrefix + std::to_string(fields_.size()),
+                            function_node->return_type());
+  fields_[key] = field;
+  intermediates->push_back(std::make_shared<Expression>(result, field));
+  return std::make_shared<FieldNode>(field);
+}
+
+bool SubexprEliminator::IsShareable(const FunctionNode& node) const {
+  auto type_id = node.return_type()->id();
+  if (!arrow::is_primitive(type_id) && type_id != arrow::Type::DECIMAL &&
+      !arrow::is_binary_like(type_id)) {
+    return false;
+  }
+  auto desc = node.descriptor();
+  FunctionSignature signature(desc->name(), desc->params(), desc->return_type());
+  const NativeFunction* native_function = registry_.LookupSignature(signature);
+  return native_function != nullptr && !native_function->NeedsFunctionHolder();
+}
+
+}  // namespace gandiva
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_SUBEXPR_ELIMINATOR_H
+#define GANDIVA_SUBEXPR_ELIMINATOR_H
+
+#include <string>
+#include <unordered_map>
+
+#include "gandiva/arrow.h"
+#include "gandiva/expression.h"
+#include "gandiva/node.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+class FunctionRegistry;
+
+/// \brief Eliminates the common subexpressions of a set of expression trees.
+///
+/// Each function subtree which occurs more than once is moved to an intermediate
+/// expression, whose result is read back as an input field wherever the subtree
+/// occurred. Evaluating the intermediate expressions first computes each shared
+/// subtree once per batch.
+///
+/// Only the subtrees which are always evaluated are shared, i.e. not those under an
+/// if-else, a boolean operator or an in-expression, so that evaluating them ahead
+/// can't raise errors the original expressions wouldn't have. Functions using a
+/// holder (eg. random()) are never shared.
+class GANDIVA_EXPORT SubexprEliminator {
+ public:
+  explicit SubexprEliminator(const FunctionRegistry& registry) : registry_(registry) {}
+
+  /// \brief Rewrite 'exprs' into 'rewritten', and append the intermediate expressions
+  /// to 'intermediates', in the order they must be evaluated.
+  void Rewrite(const ExpressionVector& exprs, ExpressionVector* rewritten,
+               ExpressionVector* intermediates);
+
+ private:
+  // Count the occurrences of the subtrees, without descending into the subtrees
+  // already counted.
+  void Count(const NodePtr& node);
+
+  NodePtr RewriteNode(const NodePtr& node, ExpressionVector* intermediates);
+
+  bool IsShareable(const FunctionNode& node) const;
+
+  const FunctionRegistry& registry_;
+
+  // Number of occurrences of each function subtree, by its string representation.
+  std::unordered_map<std::string, int> counts_;
+
+  // The fields holding the result of the shared subtrees.
+  std::unordered_map<std::string, FieldPtr> fields_;
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_SUBEXPR_ELIMINATOR_H
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/subexpr_eliminator.h"
+
+#include <gtest/gtest.h>
+#include "gandiva/function_registry.h"
+#include "gandiva/node.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::int32;
+
+class TestSubexprEliminator : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    field_a_ = TreeExprBuilder::MakeField(arrow::field("a", int32()));
+    field_b_ = TreeExprBuilder::MakeField(arrow::field("b", int32()));
+  }
+
+  NodePtr MakeSum() {
+    return TreeExprBuilder::MakeFunction("add", {field_a_, field_b_}, int32());
+  }
+
+  FunctionRegistry registry_;
+  NodePtr field_a_;
+  NodePtr field_b_;
+};
+
+TEST_F(TestSubexprEliminator, TestShared) {
+  // a + b is used in both expressions, and twice in the first one.
+  auto square =
+      TreeExprBuilder::MakeFunction("multiply", {MakeSum(), MakeSum()}, int32());
+  auto plus_a = TreeExprBuilder::MakeFunction("add", {MakeSum(), field_a_}, int32());
+  ExpressionVector exprs = {
+      TreeExprBuilder::MakeExpression(square, arrow::field("square", int32())),
+      TreeExprBuilder::MakeExpression(plus_a, arrow::field("plus_a", int32()))};
+
+  SubexprEliminator eliminator(registry_);
+  ExpressionVector rewritten;
+  ExpressionVector intermediates;
+  eliminator.Rewrite(exprs, &rewritten, &intermediates);
+
+  ASSERT_EQ(intermediates.size(), 1);
+  EXPECT_EQ(intermediates[0]->root()->ToString(), MakeSum()->ToString());
+  const std::string name = intermediates[0]->result()->name();
+
+  ASSERT_EQ(rewritten.size(), 2);
+  EXPECT_EQ(rewritten[0]->root()->ToString(),
+            "int32 multiply((int32) " + name + ", (int32) " + name + ")");
+  EXPECT_EQ(rewritten[0]->result()->name(), "square");
+  EXPECT_EQ(rewritten[1]->root()->ToString(),
+            "int32 add((int32) " + name + ", (int32) a)");
+}
+
+TEST_F(TestSubexprEliminator, TestNested) {
+  // (a + b) * 2 is shared, and so is a + b within it.
+  auto two = TreeExprBuilder::MakeLiteral(2);
+  auto twice = [&]() {
+    return TreeExprBuilder::MakeFunction("multiply", {MakeSum(), two}, int32());
+  };
+  auto sum = TreeExprBuilder::MakeFunction("add", {twice(), MakeSum()}, int32());
+  ExpressionVector exprs = {
+      TreeExprBuilder::MakeExpression(sum, arrow::field("sum", int32())),
+      TreeExprBuilder::MakeExpression(twice(), arrow::field("twice", int32()))};
+
+  SubexprEliminator eliminator(registry_);
+  ExpressionVector rewritten;
+  ExpressionVector intermediates;
+  eliminator.Rewrite(exprs, &rewritten, &intermediates);
+
+  // a + b is computed before (a + b) * 2.
+  ASSERT_EQ(intermediates.size(), 2);
+  EXPECT_EQ(intermediates[0]->root()->ToString(), MakeSum()->ToString());
+  const std::string sum_name = intermediates[0]->result()->name();
+  const std::string twice_name = intermediates[1]->result()->name();
+  EXPECT_EQ(intermediates[1]->root()->ToString(),
+            "int32 multiply((int32) " + sum_name + ", (const int32) 2)");
+  EXPECT_EQ(rewritten[0]->root()->ToString(),
+            "int32 add((int32) " + twice_name + ", (int32) " + sum_name + ")");
+  EXPECT_EQ(rewritten[1]->root()->ToString(), "(int32) " + twice_name);
+}
+
+TEST_F(TestSubexprEliminator, TestConditional) {
+  // a + b is only evaluated for some of the records in the if-else, so it isn't
+  // shared.
+  auto condition = TreeExprBuilder::MakeFunction("greater_than", {field_a_, field_b_},
+                                                 boolean());
+  auto if_node = TreeExprBuilder::MakeIf(condition, MakeSum(), field_a_, int32());
+  ExpressionVector exprs = {
+      TreeExprBuilder::MakeExpression(if_node, arrow::field("if", int32())),
+      TreeExprBuilder::MakeExpression(MakeSum(), arrow::field("sum", int32()))};
+
+  SubexprEliminator eliminator(registry_);
+  ExpressionVector rewritten;
+  ExpressionVector intermediates;
+  eliminator.Rewrite(exprs, &rewritten, &intermediates);
+
+  EXPECT_TRUE(intermediates.empty());
+  ASSERT_EQ(rewritten.size(), 2);
+  EXPECT_EQ(rewritten[0], exprs[0]);
+  EXPECT_EQ(rewritten[1], exprs[1]);
+}
+
+}  // namespace gandiva
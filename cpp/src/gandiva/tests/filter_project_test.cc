@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
 #include "gandiva/filter.h"
+#include "gandiva/filter_projector.h"
 #include "gandiva/projector.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/tests/test_util.h"
@@ -273,4 +274,50 @@ TEST_F(TestFilterProject, TestSimpleIf) {
   // Validate results
   EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
 }
+TEST_F(TestFilterProject, TestFilterProjector) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto field2 = field("f2", int32());
+  auto resultField = field("result", int32());
+  auto schema = arrow::schema({field0, field1, field2});
+
+  // Build condition f0 < f1
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto less_than_function =
+      TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1}, arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than_function);
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field1, field2}, resultField);
+
+  std::shared_ptr<FilterProjector> filter_projector;
+  ASSERT_OK(FilterProjector::Make(schema, condition, {sum_expr}, TestConfiguration(),
+                                  &filter_projector));
+
+  // Create a row-batch with some sample data
+  int num_records = 5;
+  auto array0 = MakeArrowArrayInt32({1, 2, 6, 40, 3}, {true, true, true, true, true});
+  auto array1 = MakeArrowArrayInt32({5, 9, 3, 17, 6}, {true, true, true, true, true});
+  auto array2 = MakeArrowArrayInt32({1, 2, 6, 40, 3}, {true, true, true, true, false});
+  // expected output
+  auto result = MakeArrowArrayInt32({6, 11, 0}, {true, true, false});
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1, array2});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  ASSERT_OK(filter_projector->Evaluate(*in_batch, pool_, &outputs));
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(result, outputs.at(0));
+
+  // No matching records
+  auto none_array0 = MakeArrowArrayInt32({5, 9}, {true, true});
+  auto none_array1 = MakeArrowArrayInt32({1, 2}, {true, true});
+  auto none_batch =
+      arrow::RecordBatch::Make(schema, 2, {none_array0, none_array1, none_array1});
+  ASSERT_OK(filter_projector->Evaluate(*none_batch, pool_, &outputs));
+  EXPECT_EQ(outputs.at(0)->length(), 0);
+}
+
 }  // namespace gandiva
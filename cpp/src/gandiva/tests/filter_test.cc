@@ -123,6 +123,46 @@ TEST_F(TestFilter, TestSimple) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestMakeAsync) {
+  // schema for input fields
+  auto field0 = field("f0_async", int32());
+  auto field1 = field("f1_async", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // Build condition f0 + f1 < 10
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto sum_func =
+      TreeExprBuilder::MakeFunction("add", {node_f0, node_f1}, arrow::int32());
+  auto literal_10 = TreeExprBuilder::MakeLiteral((int32_t)10);
+  auto less_than_10 = TreeExprBuilder::MakeFunction("less_than", {sum_func, literal_10},
+                                                    arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than_10);
+
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::MakeAsync(schema, condition, TestConfiguration(), &filter));
+
+  // Create a row-batch with some sample data
+  int num_records = 5;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4, 6}, {true, true, true, false, true});
+  auto array1 = MakeArrowArrayInt32({5, 9, 6, 17, 3}, {true, true, false, true, true});
+  // expected output (indices for which condition matches)
+  auto exp = MakeArrowArrayUint16({0, 4});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate with the unoptimised code, then with the optimised one
+  for (int i = 0; i < 2; ++i) {
+    std::shared_ptr<SelectionVector> selection_vector;
+    ASSERT_OK(SelectionVector::MakeInt16(num_records, pool_, &selection_vector));
+    ASSERT_OK(filter->Evaluate(*in_batch, selection_vector));
+    EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+
+    ASSERT_OK(filter->optimized().status());
+  }
+}
+
 TEST_F(TestFilter, TestSimpleCustomConfig) {
   // schema for input fields
   auto field0 = field("f0", int32());
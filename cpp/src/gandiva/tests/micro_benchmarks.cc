@@ -63,6 +63,45 @@ static void TimedTestAdd3(benchmark::State& state) {
   ASSERT_OK(status);
 }
 
+static void DoIfElseMinus(benchmark::State& state, int null_interval) {
+  // schema for input fields
+  auto field0 = field("f0", int64());
+  auto field1 = field("f1", int64());
+  auto schema = arrow::schema({field0, field1});
+  auto pool_ = arrow::default_memory_pool();
+
+  // output field
+  auto field_result = field("res", int64());
+
+  // Build expression : if (f0 > f1) f0 - f1 else f1 - f0, reading the validity of
+  // the inputs in the loop
+  auto node0 = TreeExprBuilder::MakeField(field0);
+  auto node1 = TreeExprBuilder::MakeField(field1);
+  auto condition =
+      TreeExprBuilder::MakeFunction("greater_than", {node0, node1}, boolean());
+  auto if_node = TreeExprBuilder::MakeIf(
+      condition, TreeExprBuilder::MakeFunction("subtract", {node0, node1}, int64()),
+      TreeExprBuilder::MakeFunction("subtract", {node1, node0}, int64()), int64());
+  auto expr = TreeExprBuilder::MakeExpression(if_node, field_result);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {expr}, TestConfiguration(), &projector));
+
+  Int64DataGenerator data_generator;
+  ProjectEvaluator evaluator(projector);
+
+  Status status = TimedEvaluate<arrow::Int64Type, int64_t>(
+      schema, evaluator, data_generator, pool_, 1 * MILLION, 16 * THOUSAND, state,
+      null_interval);
+  ASSERT_OK(status);
+}
+
+static void TimedTestIfElseNoNulls(benchmark::State& state) { DoIfElseMinus(state, 0); }
+
+static void TimedTestIfElseWithNulls(benchmark::State& state) {
+  DoIfElseMinus(state, 10);
+}
+
 static void TimedTestBigNested(benchmark::State& state) {
   // schema for input fields
   auto fielda = field("a", int32());
@@ -392,6 +431,8 @@ static void DecimalAdd3Large(benchmark::State& state) {
 
 BENCHMARK(TimedTestAdd3)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestBigNested)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(TimedTestIfElseNoNulls)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(TimedTestIfElseWithNulls)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestExtractYear)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestFilterAdd2)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestFilterLike)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
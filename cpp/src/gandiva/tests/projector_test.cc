@@ -90,6 +90,26 @@ TEST_F(TestProjector, TestProjectCache) {
   EXPECT_EQ(cached_projector, projector);
 }
 
+TEST_F(TestProjector, TestProjectCacheStats) {
+  auto field0 = field("f0_stats", int32());
+  auto field1 = field("f1_stats", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto field_sum = field("add", int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  auto before = Projector::GetCacheStats();
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, TestConfiguration(), &projector));
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, TestConfiguration(), &projector));
+  auto after = Projector::GetCacheStats();
+
+  // Other tests may build projectors concurrently
+  EXPECT_GE(after.misses - before.misses, 1);
+  EXPECT_GE(after.hits - before.hits, 1);
+  EXPECT_GT(after.num_entries, 0);
+  EXPECT_GT(after.code_size, 0);
+}
+
 TEST_F(TestProjector, TestProjectCacheFieldNames) {
   // schema for input fields
   auto field0 = field("f0", int32());
@@ -330,6 +350,159 @@ static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_lt, outputs.at(5));
 }
 
+TEST_F(TestProjector, TestMakeAsync) {
+  // schema for input fields
+  auto field0 = field("f0_async", int32());
+  auto field1 = field("f1_async", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+  auto field_sub = field("subtract", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  auto sub_expr =
+      TreeExprBuilder::MakeExpression("subtract", {field0, field1}, field_sub);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::MakeAsync(schema, {sum_expr, sub_expr},
+                                 SelectionVector::Mode::MODE_NONE, TestConfiguration(),
+                                 &projector));
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32({12, 15, 0, 0}, {true, true, false, false});
+  auto exp_sub = MakeArrowArrayInt32({-10, -11, 0, 0}, {true, true, false, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate with the unoptimised code, then with the optimised one
+  for (int i = 0; i < 2; ++i) {
+    arrow::ArrayVector outputs;
+    ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+    EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+    EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
+
+    ASSERT_OK(projector->optimized().status());
+  }
+
+  // The same expressions are served from the cache
+  std::shared_ptr<Projector> cached_projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr, sub_expr}, TestConfiguration(),
+                            &cached_projector));
+  EXPECT_EQ(cached_projector, projector);
+}
+
+TEST_F(TestProjector, TestParallelEvaluate) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+  auto field_less = field("less_than", boolean());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  auto less_expr =
+      TreeExprBuilder::MakeExpression("less_than", {field0, field1}, field_less);
+
+  auto configuration = TestConfiguration();
+  configuration->set_parallel_chunk_size(100);
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr, less_expr}, configuration, &projector));
+
+  // Create a row-batch spanning several chunks, with some nulls
+  int num_records = 1000;
+  std::vector<int32_t> values0, values1, exp_sums;
+  std::vector<bool> validity0, exp_sum_validity, exp_less;
+  for (int i = 0; i < num_records; ++i) {
+    values0.push_back(i % 13);
+    values1.push_back(i % 7);
+    validity0.push_back(i % 11 != 0);
+    exp_sums.push_back(i % 11 != 0 ? i % 13 + i % 7 : 0);
+    exp_sum_validity.push_back(i % 11 != 0);
+    exp_less.push_back(i % 11 != 0 && i % 13 < i % 7);
+  }
+  auto array0 = MakeArrowArrayInt32(values0, validity0);
+  auto array1 = MakeArrowArrayInt32(values1, std::vector<bool>(num_records, true));
+  auto exp_sum = MakeArrowArrayInt32(exp_sums, exp_sum_validity);
+  auto exp_less_than = MakeArrowArrayBool(exp_less, exp_sum_validity);
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_less_than, outputs.at(1));
+}
+
+TEST_F(TestProjector, TestCommonSubexpressions) {
+  // schema for input fields
+  auto field0 = field("f0", arrow::utf8());
+  auto field1 = field("f1", arrow::utf8());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_upper = field("upper", arrow::utf8());
+  auto field_concat = field("concat", arrow::utf8());
+  auto field_length = field("length", int32());
+
+  // Build expressions, all using upper(f0)
+  auto make_upper = [&]() {
+    return TreeExprBuilder::MakeFunction("upper", {TreeExprBuilder::MakeField(field0)},
+                                         arrow::utf8());
+  };
+  auto upper_expr = TreeExprBuilder::MakeExpression(make_upper(), field_upper);
+  auto concat_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction(
+          "concat", {make_upper(), TreeExprBuilder::MakeField(field1)},
+          arrow::utf8()),
+      field_concat);
+  auto length_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("char_length", {make_upper()}, int32()),
+      field_length);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {upper_expr, concat_expr, length_expr},
+                            TestConfiguration(), &projector));
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 =
+      MakeArrowArrayUtf8({"ab", "", "xyz", "invalid"}, {true, true, true, false});
+  auto array1 =
+      MakeArrowArrayUtf8({"cd", "e", "invalid", "f"}, {true, true, false, true});
+  // expected output
+  auto exp_upper = MakeArrowArrayUtf8({"AB", "", "XYZ", ""}, {true, true, true, false});
+  auto exp_concat =
+      MakeArrowArrayUtf8({"ABcd", "e", "XYZ", "f"}, {true, true, true, true});
+  auto exp_length = MakeArrowArrayInt32({2, 0, 3, 0}, {true, true, true, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+
+  // Validate results
+  ASSERT_EQ(outputs.size(), 3);
+  EXPECT_ARROW_ARRAY_EQUALS(exp_upper, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_concat, outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_length, outputs.at(2));
+}
+
 TEST_F(TestProjector, TestAllIntTypes) {
   TestArithmeticOpsForType<arrow::UInt8Type, uint8_t>(pool_);
   TestArithmeticOpsForType<arrow::UInt16Type, uint16_t>(pool_);
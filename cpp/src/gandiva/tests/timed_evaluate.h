@@ -83,10 +83,13 @@ class FilterEvaluator : public BaseEvaluator {
   std::shared_ptr<SelectionVector> selection_;
 };
 
+/// Evaluate batches of generated data. If 'null_interval' is set, every
+/// 'null_interval'-th value of each column is null.
 template <typename TYPE, typename C_TYPE>
 Status TimedEvaluate(SchemaPtr schema, BaseEvaluator& evaluator,
                      DataGenerator<C_TYPE>& data_generator, arrow::MemoryPool* pool,
-                     int num_records, int batch_size, benchmark::State& state) {
+                     int num_records, int batch_size, benchmark::State& state,
+                     int null_interval = 0) {
   int num_remaining = num_records;
   int num_fields = schema->num_fields();
   int num_calls = 0;
@@ -100,6 +103,9 @@ Status TimedEvaluate(SchemaPtr schema, BaseEvaluator& evaluator,
     for (int col = 0; col < num_fields; col++) {
       std::vector<C_TYPE> data = GenerateData<C_TYPE>(batch_size, data_generator);
       std::vector<bool> validity(batch_size, true);
+      for (int j = 0; null_interval > 0 && j < batch_size; j += null_interval) {
+        validity[j] = false;
+      }
       ArrayPtr col_data =
           MakeArrowArray<TYPE, C_TYPE>(schema->field(col)->type(), data, validity);
 
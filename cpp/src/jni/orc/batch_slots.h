@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef JNI_BATCH_SLOTS_H
+#define JNI_BATCH_SLOTS_H
+
+#include <jni.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "arrow/buffer.h"
+
+namespace arrow {
+namespace jni {
+
+/**
+ * Slots keeping the buffers of the record batches handed off to Java alive,
+ * until Java has released each of them.
+ *
+ * All the buffers of a batch share the id of their slot, so that handing a
+ * batch off takes a single insertion. Free slots are reused in ring order,
+ * without reallocating their storage. An id combines the slot index with the
+ * generation of the slot, so that releasing with a stale id is ignored.
+ */
+class BatchSlots {
+ public:
+  /// Hold the buffers of a batch, returning the id to release them with
+  jlong Acquire(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    size_t index;
+    if (free_slots_.empty()) {
+      index = slots_.size();
+      slots_.emplace_back();
+    } else {
+      index = free_slots_.front();
+      free_slots_.pop_front();
+    }
+    Slot& slot = slots_[index];
+    slot.buffers.assign(buffers.begin(), buffers.end());
+    slot.remaining = static_cast<int64_t>(buffers.size());
+    // Keep ids positive
+    slot.generation = (slot.generation + 1) & 0x7fffffff;
+    if (slot.remaining == 0) {
+      free_slots_.push_back(index);
+    }
+    return MakeId(index, slot.generation);
+  }
+
+  /// Release one of the buffers held under an id
+  void Release(jlong id) {
+    const size_t index = static_cast<size_t>(id & 0xffffffff);
+    const uint32_t generation = static_cast<uint32_t>(id >> 32);
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (index >= slots_.size()) {
+      return;
+    }
+    Slot& slot = slots_[index];
+    if (slot.generation != generation || slot.remaining == 0) {
+      return;
+    }
+    if (--slot.remaining == 0) {
+      slot.buffers.clear();
+      free_slots_.push_back(index);
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    slots_.clear();
+    free_slots_.clear();
+  }
+
+ private:
+  struct Slot {
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    // The number of buffers not released yet
+    int64_t remaining = 0;
+    uint32_t generation = 0;
+  };
+
+  static jlong MakeId(size_t index, uint32_t generation) {
+    return static_cast<jlong>((static_cast<uint64_t>(generation) << 32) | index);
+  }
+
+  std::mutex mtx_;
+  std::deque<Slot> slots_;
+  std::deque<size_t> free_slots_;
+};
+
+}  // namespace jni
+}  // namespace arrow
+
+#endif  // JNI_BATCH_SLOTS_H
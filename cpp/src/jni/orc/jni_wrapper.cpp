@@ -31,6 +31,7 @@
 #include "org_apache_arrow_adapter_orc_OrcReaderJniWrapper.h"
 #include "org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper.h"
 
+#include "./batch_slots.h"
 #include "./concurrent_map.h"
 
 using ORCFileReader = arrow::adapters::orc::ORCFileReader;
@@ -52,9 +53,10 @@ static jmethodID record_batch_constructor;
 static jint JNI_VERSION = JNI_VERSION_1_6;
 
 using arrow::internal::checked_cast;
+using arrow::jni::BatchSlots;
 using arrow::jni::ConcurrentMap;
 
-static ConcurrentMap<std::shared_ptr<arrow::Buffer>> buffer_holder_;
+static BatchSlots batch_slots_;
 static ConcurrentMap<std::shared_ptr<RecordBatchReader>> orc_stripe_reader_holder_;
 static ConcurrentMap<std::shared_ptr<ORCFileReader>> orc_reader_holder_;
 
@@ -151,7 +153,7 @@ void JNI_OnUnload(JavaVM* vm, void* reserved) {
   env->DeleteGlobalRef(orc_memory_class);
   env->DeleteGlobalRef(record_batch_class);
 
-  buffer_holder_.Clear();
+  batch_slots_.Clear();
   orc_stripe_reader_holder_.Clear();
   orc_reader_holder_.Clear();
 }
@@ -218,6 +220,23 @@ Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_nextStripeReader(JNIEnv* e
   return orc_stripe_reader_holder_.Insert(stripe_reader);
 }
 
+JNIEXPORT jlong JNICALL
+Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_prefetchingReader(
+    JNIEnv* env, jobject this_obj, jlong id, jlong batch_size,
+    jint num_prefetch_stripes) {
+  auto reader = GetFileReader(env, id);
+
+  std::shared_ptr<RecordBatchReader> prefetching_reader;
+  auto status = reader->GetPrefetchingReader(batch_size, num_prefetch_stripes, {},
+                                            &prefetching_reader);
+
+  if (!status.ok()) {
+    return static_cast<jlong>(status.code()) * -1;
+  }
+
+  return orc_stripe_reader_holder_.Insert(prefetching_reader);
+}
+
 JNIEXPORT jbyteArray JNICALL
 Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_getSchema(JNIEnv* env,
                                                                       jclass this_cls,
@@ -271,16 +290,28 @@ Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_next(JNIEnv* env,
     }
   }
 
-  // create OrcMemoryJniWrapper[]
+  // create OrcMemoryJniWrapper[], all released through the same slot
   jobjectArray memory_array =
       env->NewObjectArray(buffers.size(), orc_memory_class, nullptr);
+  jlong slot_id = batch_slots_.Acquire(buffers);
 
   for (size_t j = 0; j < buffers.size(); ++j) {
-    auto buffer = buffers[j];
-    jobject memory = env->NewObject(orc_memory_class, orc_memory_constructor,
-                                    buffer_holder_.Insert(buffer), buffer->data(),
-                                    buffer->size(), buffer->capacity());
+    const auto& buffer = buffers[j];
+    // Absent buffers, such as the validity bitmap of a column without nulls,
+    // are handed off as empty memory
+    jobject memory;
+    if (buffer) {
+      memory = env->NewObject(orc_memory_class, orc_memory_constructor, slot_id,
+                              static_cast<jlong>(buffer->address()),
+                              static_cast<jlong>(buffer->size()),
+                              static_cast<jlong>(buffer->capacity()));
+    } else {
+      const jlong empty = 0;
+      memory = env->NewObject(orc_memory_class, orc_memory_constructor, slot_id, empty,
+                              empty, empty);
+    }
     env->SetObjectArrayElement(memory_array, j, memory);
+    env->DeleteLocalRef(memory);
   }
 
   // create OrcRecordBatch
@@ -297,7 +328,7 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapp
 
 JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_orc_OrcMemoryJniWrapper_release(
     JNIEnv* env, jobject this_obj, jlong id) {
-  buffer_holder_.Erase(id);
+  batch_slots_.Release(id);
 }
 
 #ifdef __cplusplus
@@ -1886,6 +1886,126 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 2, &table));
+
+  // One of the row groups straddles the two chunks
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, 400, arrow_properties, &buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(5, reader->num_row_groups());
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false));
+}
+
+// Writes the table with FileWriter::WriteRecordBatch, in batches of batch_size rows
+void WriteRecordBatchesToBuffer(
+    const std::shared_ptr<Table>& table, int64_t batch_size,
+    const std::shared_ptr<WriterProperties>& properties,
+    const std::shared_ptr<ArrowWriterProperties>& arrow_properties,
+    std::shared_ptr<Buffer>* out) {
+  auto sink = CreateOutputStream();
+  std::unique_ptr<FileWriter> writer;
+  ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), default_memory_pool(), sink,
+                                      properties, arrow_properties, &writer));
+  ::arrow::TableBatchReader batch_reader(*table);
+  batch_reader.set_chunksize(batch_size);
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(batch_reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK_NO_THROW(writer->Close());
+  ASSERT_OK_AND_ASSIGN(*out, sink->Finish());
+}
+
+void CheckRecordBatchesRoundtrip(const std::shared_ptr<Table>& table,
+                                 const std::shared_ptr<Buffer>& buffer,
+                                 const std::vector<int64_t>& row_group_sizes) {
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(static_cast<int>(row_group_sizes.size()), reader->num_row_groups());
+  for (size_t i = 0; i < row_group_sizes.size(); ++i) {
+    ASSERT_EQ(row_group_sizes[i],
+              reader->parquet_reader()->metadata()->RowGroup(static_cast<int>(i))
+                  ->num_rows());
+  }
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false));
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatchRowTarget) {
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(5, 1000, 1, &table));
+
+  auto properties = WriterProperties::Builder().max_row_group_length(300)->build();
+  for (bool use_threads : {false, true}) {
+    auto arrow_properties =
+        ArrowWriterProperties::Builder().set_use_threads(use_threads)->build();
+    std::shared_ptr<Buffer> buffer;
+    // Small batches are accumulated, and a batch straddling the row target is
+    // split across row groups
+    ASSERT_NO_FATAL_FAILURE(
+        WriteRecordBatchesToBuffer(table, 70, properties, arrow_properties, &buffer));
+    ASSERT_NO_FATAL_FAILURE(
+        CheckRecordBatchesRoundtrip(table, buffer, {300, 300, 300, 100}));
+  }
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatchByteTarget) {
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(5, 1000, 1, &table));
+
+  // Data pages are flushed after every batch, so a row group is closed as soon
+  // as it holds more than 10000 bytes
+  auto properties = WriterProperties::Builder()
+                        .disable_dictionary()
+                        ->data_pagesize(1)
+                        ->max_row_group_bytes(10000)
+                        ->build();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteRecordBatchesToBuffer(
+      table, 100, properties, default_arrow_writer_properties(), &buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_GT(reader->num_row_groups(), 1);
+  ASSERT_LT(reader->num_row_groups(), 10);
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false));
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatchSchemaMismatch) {
+  auto sink = CreateOutputStream();
+  std::unique_ptr<FileWriter> writer;
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int32())});
+  ASSERT_OK_NO_THROW(FileWriter::Open(*schema, default_memory_pool(), sink,
+                                      default_writer_properties(), &writer));
+  auto batch = ::arrow::RecordBatchFromJSON(
+      ::arrow::schema({::arrow::field("a", ::arrow::int64())}), "[[1], [2]]");
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch));
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -1921,6 +2041,83 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   ASSERT_TRUE(table->Equals(*concatenated));
 }
 
+TEST(TestArrowReadWrite, ReadRowGroupRanges) {
+  const int64_t num_rows = 1000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64(), false),
+                                 ::arrow::field("b", ::arrow::float64()),
+                                 ::arrow::field("c", ::arrow::utf8())});
+  auto table = Table::Make(schema, {rag.Int64(num_rows, 0, 100, 0),
+                                    rag.Float64(num_rows, 0, 1, 0.2),
+                                    rag.String(num_rows, 0, 10, 0.2)});
+
+  // Ranges starting and ending within data pages, and gaps spanning whole pages
+  const std::vector<RowRange> ranges = {{0, 5}, {10, 1}, {11, 50}, {300, 200}, {990, 10}};
+  std::vector<std::shared_ptr<Table>> slices;
+  for (const auto& range : ranges) {
+    slices.push_back(table->Slice(range.offset, range.length));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(slices));
+
+  for (bool dictionary : {false, true}) {
+    WriterProperties::Builder builder;
+    builder.data_pagesize(256)->write_batch_size(16);
+    if (!dictionary) {
+      builder.disable_dictionary();
+    }
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                  builder.build()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadRowGroupRanges(0, {0, 1, 2}, ranges, &result));
+    ASSERT_NO_FATAL_FAILURE(
+        ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false));
+
+    ASSERT_OK_NO_THROW(reader->ReadRowGroupRanges(0, {2}, {}, &result));
+    ASSERT_EQ(0, result->num_rows());
+
+    ASSERT_RAISES(Invalid,
+                  reader->ReadRowGroupRanges(0, {0}, {{10, 5}, {0, 5}}, &result));
+    ASSERT_RAISES(Invalid, reader->ReadRowGroupRanges(0, {0}, {{990, 20}}, &result));
+  }
+}
+
+TEST(TestArrowReadWrite, FileReaderBuilderMetaDataCache) {
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(5, 100, 1, &table));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, 50, default_arrow_writer_properties(), &buffer));
+
+  FileMetaDataCache cache;
+  const FileMetaDataCache::Key key = {"table.parquet", buffer->size(), 0};
+  std::shared_ptr<FileMetaData> metadata;
+  for (int i = 0; i < 2; ++i) {
+    FileReaderBuilder builder;
+    ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer),
+                                    default_reader_properties(), &cache, key));
+    if (metadata == nullptr) {
+      metadata = builder.raw_reader()->metadata();
+    } else {
+      // The footer was not parsed again
+      ASSERT_EQ(metadata, builder.raw_reader()->metadata());
+    }
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK(builder.Build(&reader));
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(
+        ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false));
+  }
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+}
+
 TEST(TestArrowReadWrite, GetRecordBatchReader) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -1973,6 +2170,80 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_EQ(nullptr, actual_batch);
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchReaderAcrossRowGroups) {
+  const int num_columns = 5;
+  const int num_rows = 1000;
+  const int batch_size = 128;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // Row groups whose size is unrelated to the batch size
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, 300, default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_batch_size(batch_size);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+  ASSERT_EQ(4, reader->num_row_groups());
+
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1, 2, 3}, &rb_reader));
+  std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+  ASSERT_OK(rb_reader->ReadAll(&batches));
+
+  // All batches but the last one are full
+  ASSERT_EQ(8U, batches.size());
+  for (size_t i = 0; i < batches.size() - 1; ++i) {
+    ASSERT_EQ(batch_size, batches[i]->num_rows());
+  }
+  ASSERT_EQ(num_rows % batch_size, batches.back()->num_rows());
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(Table::FromRecordBatches(batches, &result));
+  ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchReaderChunkedColumns) {
+  // Dictionary columns are read in one chunk per row group, so that batches
+  // spanning row groups have chunked columns
+  auto values = ::arrow::ArrayFromJSON(
+      ::arrow::utf8(), R"(["a", "b", null, "a", "c", "c", "b", null, "a", "d"])");
+  auto table = MakeSimpleTable(values, /*nullable=*/true);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, 3, default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_batch_size(4);
+  properties.set_read_dictionary(0, true);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1, 2, 3}, &rb_reader));
+  std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+  ASSERT_OK(rb_reader->ReadAll(&batches));
+
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+    ASSERT_EQ(::arrow::Type::DICTIONARY, batch->column(0)->type_id());
+    ASSERT_LE(batch->num_rows(), 4);
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(values->length(), num_rows);
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2021,6 +2292,54 @@ TEST(TestArrowReadWrite, ReadColumnSubset) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected, *result));
 }
 
+TEST(TestArrowReadWrite, PreBuffer) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_use_threads(use_threads);
+    properties.set_pre_buffer(true);
+    auto cache_options = ::arrow::io::CacheOptions::Defaults();
+    // Small enough that some ranges are not coalesced
+    cache_options.hole_size_limit = 16;
+    cache_options.range_size_limit = 2048;
+    properties.set_cache_options(cache_options);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+    ASSERT_EQ(4, reader->num_row_groups());
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+
+    // Column subset in a subset of row groups
+    std::vector<int> column_subset = {1, 5, 6, 19};
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups({1, 3}, column_subset, &result));
+    ASSERT_EQ(column_subset.size(), result->num_columns());
+    ASSERT_EQ(num_rows / 2, result->num_rows());
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertChunkedEqual(
+        *table->column(5)->Slice(num_rows / 4, num_rows / 4),
+        *result->column(1)->Slice(0, num_rows / 4)));
+
+    // Record batch reader
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({2}, column_subset, &rb_reader));
+    ASSERT_OK(rb_reader->ReadAll(&result));
+    ASSERT_EQ(num_rows / 4, result->num_rows());
+  }
+}
+
 TEST(TestArrowReadWrite, ListLargeRecords) {
   // PARQUET-1308: This test passed on Linux when num_rows was smaller
   const int num_rows = 2000;
@@ -2950,6 +3269,59 @@ INSTANTIATE_TEST_CASE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+void ReadTableWithDictionary(const std::shared_ptr<Table>& table, int64_t row_group_size,
+                             std::shared_ptr<Table>* out) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, row_group_size,
+                                             default_arrow_writer_properties(), &buffer));
+
+  auto properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+  ASSERT_OK_NO_THROW(reader->ReadTable(out));
+}
+
+TEST(TestArrowReadPrimitiveDictionary, ReadWholeFileDict) {
+  auto values = ::arrow::ArrayFromJSON(::arrow::int64(), "[1, 2, null, 1, 3, 2, 1]");
+  auto table = MakeSimpleTable(values, /*nullable=*/true);
+
+  auto indices = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 1, null, 0, 2, 1, 0]");
+  auto dict = ::arrow::ArrayFromJSON(::arrow::int64(), "[1, 2, 3]");
+  std::shared_ptr<Array> dict_values;
+  auto dict_ty = ::arrow::dictionary(::arrow::int32(), ::arrow::int64());
+  ASSERT_OK(::arrow::DictionaryArray::FromArrays(dict_ty, indices, dict, &dict_values));
+  auto expected = MakeSimpleTable(dict_values, /*nullable=*/true);
+
+  std::shared_ptr<Table> actual;
+  ASSERT_NO_FATAL_FAILURE(ReadTableWithDictionary(table, values->length(), &actual));
+  ::arrow::AssertTablesEqual(*expected, *actual);
+}
+
+TEST(TestArrowReadPrimitiveDictionary, NestedUnifiesDictionaries) {
+  // Each row group has its own dictionary, which are unified in the list values
+  auto values = ::arrow::ArrayFromJSON(::arrow::list(::arrow::int32()),
+                                       "[[1, 2], [2], [3], [], [1]]");
+  auto table = MakeSimpleTable(values, /*nullable=*/true);
+
+  auto offsets = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 2, 3, 4, 4, 5]");
+  auto indices = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 1, 1, 2, 0]");
+  auto dict = ::arrow::ArrayFromJSON(::arrow::int32(), "[1, 2, 3]");
+  std::shared_ptr<Array> dict_values, expected_values;
+  auto dict_ty = ::arrow::dictionary(::arrow::int32(), ::arrow::int32());
+  ASSERT_OK(::arrow::DictionaryArray::FromArrays(dict_ty, indices, dict, &dict_values));
+  ASSERT_OK(::arrow::ListArray::FromArrays(*offsets, *dict_values,
+                                           ::arrow::default_memory_pool(),
+                                           &expected_values));
+  auto expected = MakeSimpleTable(expected_values, /*nullable=*/true);
+
+  std::shared_ptr<Table> actual;
+  ASSERT_NO_FATAL_FAILURE(ReadTableWithDictionary(table, /*row_group_size=*/2, &actual));
+  ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
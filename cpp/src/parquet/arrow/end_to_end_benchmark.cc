@@ -0,0 +1,295 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// End-to-end read and write benchmarks of parquet::arrow over generated
+// datasets resembling real-world data: wide strings, lists, dictionaries and
+// mixed schemas, with varying null ratios.
+//
+// Reads go through a local file or through a file with simulated per-read
+// latency, as seen on object stores.  For regression tracking, run with
+// --benchmark_out=<file> --benchmark_out_format=json.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/slow.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/io_util.h"
+
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/properties.h"
+
+namespace parquet {
+
+using arrow::FileReader;
+using arrow::WriteTable;
+
+namespace benchmark {
+
+enum class DatasetKind : int64_t {
+  // Integer and floating-point columns
+  kNumeric = 0,
+  // Strings of a few hundred bytes
+  kWideStrings,
+  // Lists of integers and of short strings
+  kLists,
+  // Dictionary-encoded strings of low cardinality
+  kDictionaries,
+  // A mix of all the above
+  kMixed,
+};
+
+enum class ReadSource : int64_t {
+  kLocalFile = 0,
+  // Every read waits for a simulated latency
+  kHighLatency,
+  // Same, with the column chunks fetched ahead and coalesced
+  kHighLatencyPreBuffered,
+};
+
+struct DatasetOptions {
+  int64_t num_rows = 128 * 1024;
+  // Number of columns of each generated type
+  int num_columns = 4;
+  double null_probability = 0.0;
+  int32_t min_string_length = 64;
+  int32_t max_string_length = 512;
+  int32_t max_list_length = 16;
+  int32_t dictionary_size = 1000;
+};
+
+// Average latency of a read from a ReadSource::kHighLatency file, in seconds
+constexpr double kReadLatency = 1e-3;
+
+std::shared_ptr<::arrow::Array> MakeListArray(
+    ::arrow::random::RandomArrayGenerator* rand,
+    const std::shared_ptr<::arrow::Array>& values, const DatasetOptions& options) {
+  // Spread the values over the lists at random
+  const int64_t num_values = values->length();
+  auto offsets = rand->Offsets(options.num_rows + 1, 0, static_cast<int32_t>(num_values));
+  std::shared_ptr<::arrow::Array> out;
+  ABORT_NOT_OK(::arrow::ListArray::FromArrays(*offsets, *values,
+                                              ::arrow::default_memory_pool(), &out));
+  return out;
+}
+
+std::shared_ptr<::arrow::Table> MakeDataset(DatasetKind kind,
+                                            const DatasetOptions& options) {
+  ::arrow::random::RandomArrayGenerator rand(0x5eed);
+  const int64_t num_rows = options.num_rows;
+  const double null_probability = options.null_probability;
+  const int64_t num_list_values = num_rows * options.max_list_length / 2;
+
+  std::vector<std::shared_ptr<::arrow::Field>> fields;
+  std::vector<std::shared_ptr<::arrow::Array>> columns;
+  auto add_column = [&](const std::string& prefix,
+                        std::shared_ptr<::arrow::Array> column) {
+    const auto name = prefix + std::to_string(fields.size());
+    fields.push_back(::arrow::field(name, column->type()));
+    columns.push_back(std::move(column));
+  };
+
+  for (int i = 0; i < options.num_columns; ++i) {
+    if (kind == DatasetKind::kNumeric || kind == DatasetKind::kMixed) {
+      add_column("int", rand.Int64(num_rows, 0, 1 << 20, null_probability));
+      add_column("double", rand.Float64(num_rows, -1e6, 1e6, null_probability));
+    }
+    if (kind == DatasetKind::kWideStrings || kind == DatasetKind::kMixed) {
+      add_column("string", rand.String(num_rows, options.min_string_length,
+                                       options.max_string_length, null_probability));
+    }
+    if (kind == DatasetKind::kLists || kind == DatasetKind::kMixed) {
+      add_column("int_list",
+                 MakeListArray(&rand,
+                               rand.Int32(num_list_values, 0, 1000, null_probability),
+                               options));
+      add_column("string_list",
+                 MakeListArray(&rand,
+                               rand.String(num_list_values, 0, 16, null_probability),
+                               options));
+    }
+    if (kind == DatasetKind::kDictionaries || kind == DatasetKind::kMixed) {
+      auto dictionary = rand.String(options.dictionary_size, 8, 32, 0);
+      auto indices =
+          rand.Int32(num_rows, 0, options.dictionary_size - 1, null_probability);
+      std::shared_ptr<::arrow::Array> column;
+      ABORT_NOT_OK(::arrow::DictionaryArray::FromArrays(
+          ::arrow::dictionary(::arrow::int32(), ::arrow::utf8()), indices, dictionary,
+          &column));
+      add_column("dict", column);
+    }
+  }
+  return ::arrow::Table::Make(::arrow::schema(fields), columns, num_rows);
+}
+
+// The number of bytes held by the buffers of an array
+int64_t TotalBufferSize(const ::arrow::ArrayData& data) {
+  int64_t total = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      total += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    total += TotalBufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    total += TotalBufferSize(*data.dictionary->data());
+  }
+  return total;
+}
+
+int64_t TotalBufferSize(const ::arrow::Table& table) {
+  int64_t total = 0;
+  for (const auto& column : table.columns()) {
+    for (const auto& chunk : column->chunks()) {
+      total += TotalBufferSize(*chunk->data());
+    }
+  }
+  return total;
+}
+
+DatasetOptions GetDatasetOptions(const ::benchmark::State& state) {
+  DatasetOptions options;
+  options.null_probability = static_cast<double>(state.range(1)) / 100;
+  return options;
+}
+
+void SetThroughput(::benchmark::State& state, const ::arrow::Table& table) {
+  state.SetBytesProcessed(state.iterations() * TotalBufferSize(table));
+  state.SetItemsProcessed(state.iterations() * table.num_rows());
+}
+
+std::shared_ptr<ArrowWriterProperties> GetArrowWriterProperties(bool use_threads) {
+  // Store the Arrow schema so that dictionaries are read back as such
+  return ArrowWriterProperties::Builder()
+      .store_schema()
+      ->set_use_threads(use_threads)
+      ->build();
+}
+
+// Arguments: dataset kind, null percentage, use threads, write to a local file
+static void BM_WriteDataset(::benchmark::State& state) {
+  const auto kind = static_cast<DatasetKind>(state.range(0));
+  const bool use_threads = state.range(2) != 0;
+  const bool to_file = state.range(3) != 0;
+  const auto table = MakeDataset(kind, GetDatasetOptions(state));
+  const auto properties = default_writer_properties();
+  const auto arrow_properties = GetArrowWriterProperties(use_threads);
+
+  std::unique_ptr<::arrow::internal::TemporaryDir> temp_dir;
+  std::string path;
+  if (to_file) {
+    temp_dir = *::arrow::internal::TemporaryDir::Make("parquet-benchmark-");
+    path = (*temp_dir->path().Join("data.parquet")).ToString();
+  }
+
+  for (auto _ : state) {
+    std::shared_ptr<::arrow::io::OutputStream> sink;
+    if (to_file) {
+      sink = *::arrow::io::FileOutputStream::Open(path);
+    } else {
+      sink = *::arrow::io::BufferOutputStream::Create();
+    }
+    ABORT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                            table->num_rows(), properties, arrow_properties));
+    ABORT_NOT_OK(sink->Close());
+  }
+  SetThroughput(state, *table);
+}
+
+// Arguments: dataset kind, null percentage, use threads, read source
+static void BM_ReadDataset(::benchmark::State& state) {
+  const auto kind = static_cast<DatasetKind>(state.range(0));
+  const bool use_threads = state.range(2) != 0;
+  const auto source = static_cast<ReadSource>(state.range(3));
+  const auto table = MakeDataset(kind, GetDatasetOptions(state));
+
+  auto temp_dir = *::arrow::internal::TemporaryDir::Make("parquet-benchmark-");
+  const auto path = (*temp_dir->path().Join("data.parquet")).ToString();
+  {
+    auto sink = *::arrow::io::FileOutputStream::Open(path);
+    // Write several row groups, so that pre-buffering has reads to coalesce
+    ABORT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                            table->num_rows() / 4, default_writer_properties(),
+                            GetArrowWriterProperties(/*use_threads=*/false)));
+    ABORT_NOT_OK(sink->Close());
+  }
+
+  ArrowReaderProperties arrow_properties;
+  arrow_properties.set_use_threads(use_threads);
+  arrow_properties.set_pre_buffer(source == ReadSource::kHighLatencyPreBuffered);
+
+  for (auto _ : state) {
+    std::shared_ptr<::arrow::io::RandomAccessFile> file =
+        *::arrow::io::ReadableFile::Open(path);
+    if (source != ReadSource::kLocalFile) {
+      file = std::make_shared<::arrow::io::SlowRandomAccessFile>(file, kReadLatency,
+                                                                 /*seed=*/42);
+    }
+    std::unique_ptr<FileReader> reader;
+    ABORT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(),
+                                  ParquetFileReader::Open(file), arrow_properties,
+                                  &reader));
+    std::shared_ptr<::arrow::Table> out;
+    ABORT_NOT_OK(reader->ReadTable(&out));
+    ::benchmark::DoNotOptimize(out);
+  }
+  SetThroughput(state, *table);
+}
+
+static void DatasetArguments(::benchmark::internal::Benchmark* bench,
+                             const std::vector<int64_t>& last_args) {
+  for (int64_t kind = 0; kind <= static_cast<int64_t>(DatasetKind::kMixed); ++kind) {
+    for (int64_t null_percent : {0, 10, 50}) {
+      for (int64_t use_threads : {0, 1}) {
+        for (int64_t last_arg : last_args) {
+          bench->Args({kind, null_percent, use_threads, last_arg});
+        }
+      }
+    }
+  }
+}
+
+static void WriteArguments(::benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"kind", "null_percent", "threads", "to_file"});
+  DatasetArguments(bench, {0, 1});
+}
+
+static void ReadArguments(::benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"kind", "null_percent", "threads", "source"});
+  DatasetArguments(bench, {static_cast<int64_t>(ReadSource::kLocalFile),
+                           static_cast<int64_t>(ReadSource::kHighLatency),
+                           static_cast<int64_t>(ReadSource::kHighLatencyPreBuffered)});
+}
+
+BENCHMARK(BM_WriteDataset)->Apply(WriteArguments)->UseRealTime();
+BENCHMARK(BM_ReadDataset)->Apply(ReadArguments)->UseRealTime();
+
+}  // namespace benchmark
+
+}  // namespace parquet
@@ -19,7 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
-#include <future>
+#include <functional>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -30,6 +30,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
 #include "arrow/util/thread_pool.h"
@@ -67,10 +68,10 @@ using ParquetReader = parquet::ParquetFileReader;
 using parquet::internal::RecordReader;
 
 #define BEGIN_PARQUET_CATCH_EXCEPTIONS try {
-#define END_PARQUET_CATCH_EXCEPTIONS             \
-  }                                              \
-  catch (const ::parquet::ParquetException& e) { \
-    return ::arrow::Status::IOError(e.what());   \
+#define END_PARQUET_CATCH_EXCEPTIONS                  \
+  }                                                   \
+  catch (const ::parquet::ParquetException& e) {      \
+    return ::parquet::internal::ExceptionToStatus(e); \
   }
 
 namespace parquet {
@@ -87,6 +88,14 @@ class ColumnReaderImpl : public ColumnReader {
   virtual const ColumnDescriptor* descr() const = 0;
 
   virtual ReaderType type() const = 0;
+
+  /// Read the given ranges of records of a single row group, skipping the
+  /// records in between
+  virtual Status NextRanges(const std::vector<RowRange>& ranges,
+                            std::shared_ptr<ChunkedArray>* out) {
+    return Status::NotImplemented("Reading row ranges of nested field ",
+                                  field()->ToString());
+  }
 };
 
 std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
@@ -260,6 +269,10 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroup(i, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowGroupRanges(int i, const std::vector<int>& indices,
+                            const std::vector<RowRange>& ranges,
+                            std::shared_ptr<Table>* out) override;
+
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               const std::vector<int>& column_indices,
                               std::unique_ptr<RecordBatchReader>* out) override;
@@ -270,6 +283,32 @@ class FileReaderImpl : public FileReader {
                                 Iota(reader_->metadata()->num_columns()), out);
   }
 
+  // Run read_field(i) for each of the num_fields fields, in parallel if
+  // use_threads is set
+  Status ReadFields(int num_fields, const std::function<Status(int)>& read_field) {
+    if (reader_properties_.use_threads()) {
+      std::vector<::arrow::Future<>> futures(num_fields);
+      auto pool = reader_properties_.thread_pool() != nullptr
+                      ? reader_properties_.thread_pool()
+                      : ::arrow::internal::GetCpuThreadPool();
+      for (int i = 0; i < num_fields; i++) {
+        ARROW_ASSIGN_OR_RAISE(futures[i], pool->Submit(read_field, i));
+      }
+      Status final_status = Status::OK();
+      for (auto& fut : futures) {
+        Status st = fut.status();
+        if (!st.ok()) {
+          final_status = std::move(st);
+        }
+      }
+      return final_status;
+    }
+    for (int i = 0; i < num_fields; i++) {
+      RETURN_NOT_OK(read_field(i));
+    }
+    return Status::OK();
+  }
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -332,26 +371,47 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
     // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
     // does not currently honor the use_threads option.
-    std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
-    for (size_t i = 0; i < field_readers_.size(); ++i) {
-      RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
-      if (columns[i]->num_chunks() > 1) {
-        return Status::NotImplemented("This class cannot yet iterate chunked arrays");
+    while (true) {
+      if (pending_batches_ != nullptr) {
+        // Drain the batches of the previous read first
+        RETURN_NOT_OK(pending_batches_->ReadNext(out));
+        if (*out != nullptr) {
+          return Status::OK();
+        }
+        pending_batches_.reset();
+        pending_table_.reset();
+      }
+
+      // Column readers carry on across row group boundaries, so that batches
+      // have batch_size_ rows whatever the row group sizes, and only one batch
+      // of each column is decoded at a time.
+      std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
+      for (size_t i = 0; i < field_readers_.size(); ++i) {
+        RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
       }
-    }
 
-    // Create an intermediate table and use TableBatchReader as an adaptor to a
-    // RecordBatch
-    std::shared_ptr<Table> table = Table::Make(schema_, columns);
-    RETURN_NOT_OK(table->Validate());
-    ::arrow::TableBatchReader table_batch_reader(*table);
-    return table_batch_reader.ReadNext(out);
+      // Columns may come in several chunks (e.g. dictionary-encoded columns,
+      // whose dictionary changes between row groups), so go through a table
+      // to slice them into aligned record batches
+      pending_table_ = Table::Make(schema_, columns);
+      RETURN_NOT_OK(pending_table_->Validate());
+      if (pending_table_->num_rows() == 0) {
+        pending_table_.reset();
+        out->reset();
+        return Status::OK();
+      }
+      pending_batches_.reset(new ::arrow::TableBatchReader(*pending_table_));
+      pending_batches_->set_chunksize(batch_size_);
+    }
   }
 
  private:
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
   std::shared_ptr<::arrow::Schema> schema_;
   int64_t batch_size_;
+  // The table read last, and the reader of its remaining batches
+  std::shared_ptr<Table> pending_table_;
+  std::unique_ptr<::arrow::TableBatchReader> pending_batches_;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -426,15 +486,34 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->Reserve(records_to_read);
 
     record_reader_->Reset();
-    while (records_to_read > 0) {
-      if (!record_reader_->HasMoreData()) {
-        break;
-      }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
-      records_to_read -= records_read;
-      if (records_read == 0) {
-        NextRowGroup();
-      }
+    ReserveValueData(records_to_read);
+    ReadRecords(records_to_read);
+    RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
+                                     ctx_->pool, out));
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  Status NextRanges(const std::vector<RowRange>& ranges,
+                    std::shared_ptr<ChunkedArray>* out) override {
+    if (descr_->max_repetition_level() > 0) {
+      return Status::NotImplemented("Reading row ranges of repeated field ",
+                                    field_->ToString());
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    int64_t records_to_read = 0;
+    for (const auto& range : ranges) {
+      records_to_read += range.length;
+    }
+    record_reader_->Reserve(records_to_read);
+
+    record_reader_->Reset();
+    ReserveValueData(records_to_read);
+    int64_t position = 0;
+    for (const auto& range : ranges) {
+      SkipRecords(range.offset - position);
+      ReadRecords(range.length);
+      position = range.offset + range.length;
     }
     RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
                                      ctx_->pool, out));
@@ -453,6 +532,46 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  // Size the value data of BYTE_ARRAY columns from the column chunk metadata,
+  // sparing the reallocations and copies of growing it page by page
+  void ReserveValueData(int64_t records_to_read) {
+    if (descr_->physical_type() != Type::BYTE_ARRAY ||
+        record_reader_->read_dictionary()) {
+      return;
+    }
+    const int64_t num_bytes = input_->EstimateValueBytes(records_to_read);
+    if (num_bytes > 0) {
+      record_reader_->ReserveData(num_bytes);
+    }
+  }
+
+  // Read records into the record reader, across row groups
+  void ReadRecords(int64_t records_to_read) {
+    while (records_to_read > 0) {
+      if (!record_reader_->HasMoreData()) {
+        break;
+      }
+      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      records_to_read -= records_read;
+      if (records_read == 0) {
+        NextRowGroup();
+      }
+    }
+  }
+
+  void SkipRecords(int64_t records_to_skip) {
+    while (records_to_skip > 0) {
+      if (!record_reader_->HasMoreData()) {
+        break;
+      }
+      int64_t records_skipped = record_reader_->SkipRecords(records_to_skip);
+      records_to_skip -= records_skipped;
+      if (records_skipped == 0) {
+        NextRowGroup();
+      }
+    }
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
@@ -486,11 +605,18 @@ class NestedListReader : public ColumnReaderImpl {
 
     RETURN_NOT_OK(item_reader_->NextBatch(records_to_read, out));
 
-    // ARROW-3762(wesm): If item reader yields a chunked array, we reject as
-    // this is not yet implemented
-    if ((*out)->num_chunks() > 1) {
+    std::shared_ptr<Array> item_values;
+    if ((*out)->type()->id() == ::arrow::Type::DICTIONARY) {
+      // A new dictionary page starts a new chunk; bring the chunks onto a
+      // common dictionary
+      RETURN_NOT_OK(UnifyDictionaryChunks(**out, ctx_->pool, &item_values));
+    } else if ((*out)->num_chunks() > 1) {
+      // ARROW-3762(wesm): If item reader yields a chunked array, we reject as
+      // this is not yet implemented
       return Status::NotImplemented(
           "Nested data conversions not implemented for chunked array outputs");
+    } else {
+      item_values = (*out)->chunk(0);
     }
 
     const int16_t* def_levels;
@@ -499,7 +625,7 @@ class NestedListReader : public ColumnReaderImpl {
     RETURN_NOT_OK(item_reader_->GetDefLevels(&def_levels, &num_levels));
     RETURN_NOT_OK(item_reader_->GetRepLevels(&rep_levels, &num_levels));
     std::shared_ptr<Array> result;
-    RETURN_NOT_OK(ReconstructNestedList((*out)->chunk(0), field_, max_definition_level_,
+    RETURN_NOT_OK(ReconstructNestedList(item_values, field_, max_definition_level_,
                                         max_repetition_level_, def_levels, rep_levels,
                                         num_levels, ctx_->pool, &result));
     *out = std::make_shared<ChunkedArray>(result);
@@ -552,21 +678,18 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
 Status StructReader::DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap_out,
                                           int64_t* null_count_out) {
   std::shared_ptr<Buffer> null_bitmap;
-  auto null_count = 0;
   const int16_t* def_levels_data;
   int64_t def_levels_length;
   RETURN_NOT_OK(GetDefLevels(&def_levels_data, &def_levels_length));
-  RETURN_NOT_OK(AllocateEmptyBitmap(ctx_->pool, def_levels_length, &null_bitmap));
-  uint8_t* null_bitmap_ptr = null_bitmap->mutable_data();
-  for (int64_t i = 0; i < def_levels_length; i++) {
-    if (def_levels_data[i] < struct_def_level_) {
-      // Mark null
-      null_count += 1;
-    } else {
-      DCHECK_EQ(def_levels_data[i], struct_def_level_);
-      ::arrow::BitUtil::SetBit(null_bitmap_ptr, i);
-    }
-  }
+  RETURN_NOT_OK(AllocateBitmap(ctx_->pool, def_levels_length, &null_bitmap));
+  // Fill the bitmap a byte at a time, without branching on each level
+  const int16_t struct_def_level = struct_def_level_;
+  ::arrow::internal::GenerateBitsUnrolled(
+      null_bitmap->mutable_data(), 0, def_levels_length,
+      [&]() { return *def_levels_data++ >= struct_def_level; });
+  const int64_t null_count =
+      def_levels_length -
+      ::arrow::internal::CountSetBits(null_bitmap->data(), 0, def_levels_length);
 
   *null_count_out = null_count;
   *null_bitmap_out = (null_count == 0) ? nullptr : null_bitmap;
@@ -769,6 +892,15 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_in
   for (auto row_group_index : row_group_indices) {
     RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
   }
+  if (reader_properties_.pre_buffer()) {
+    for (auto column_index : column_indices) {
+      RETURN_NOT_OK(BoundsCheckColumn(column_index));
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    reader_->PreBuffer(row_group_indices, column_indices,
+                       reader_properties_.cache_options());
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
   return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this,
                                          reader_properties_.batch_size(), out);
 }
@@ -799,6 +931,14 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     return Status::Invalid("Invalid column index");
   }
 
+  // Pre-buffer the needed column chunks if enabled
+  if (reader_properties_.pre_buffer()) {
+    for (auto row_group_index : row_groups) {
+      RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
+    }
+    parquet_reader()->PreBuffer(row_groups, indices, reader_properties_.cache_options());
+  }
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Field>> fields(num_fields);
   std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
@@ -808,27 +948,57 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     return ReadSchemaField(field_indices[i], included_leaves, row_groups, &fields[i],
                            &columns[i]);
   };
+  RETURN_NOT_OK(ReadFields(num_fields, ReadColumnFunc));
 
-  if (reader_properties_.use_threads()) {
-    std::vector<std::future<Status>> futures(num_fields);
-    auto pool = ::arrow::internal::GetCpuThreadPool();
-    for (int i = 0; i < num_fields; i++) {
-      ARROW_ASSIGN_OR_RAISE(futures[i], pool->Submit(ReadColumnFunc, i));
-    }
-    Status final_status = Status::OK();
-    for (auto& fut : futures) {
-      Status st = fut.get();
-      if (!st.ok()) {
-        final_status = std::move(st);
-      }
-    }
-    RETURN_NOT_OK(final_status);
-  } else {
-    for (int i = 0; i < num_fields; i++) {
-      RETURN_NOT_OK(ReadColumnFunc(i));
+  auto result_schema = ::arrow::schema(fields, manifest_.schema_metadata);
+  *out = Table::Make(result_schema, columns);
+  return (*out)->Validate();
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+Status FileReaderImpl::ReadRowGroupRanges(int row_group,
+                                          const std::vector<int>& indices,
+                                          const std::vector<RowRange>& ranges,
+                                          std::shared_ptr<Table>* out) {
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  RETURN_NOT_OK(BoundsCheckRowGroup(row_group));
+
+  const int64_t num_rows = reader_->metadata()->RowGroup(row_group)->num_rows();
+  int64_t previous_end = 0;
+  for (const auto& range : ranges) {
+    if (range.offset < previous_end || range.length < 0 ||
+        range.offset + range.length > num_rows) {
+      return Status::Invalid("Row ranges must be sorted, must not overlap and must be ",
+                             "within the ", num_rows, " rows of row group ", row_group);
     }
+    previous_end = range.offset + range.length;
+  }
+
+  std::vector<int> field_indices;
+  if (!manifest_.GetFieldIndices(indices, &field_indices)) {
+    return Status::Invalid("Invalid column index");
+  }
+
+  if (reader_properties_.pre_buffer()) {
+    parquet_reader()->PreBuffer({row_group}, indices, reader_properties_.cache_options());
   }
 
+  int num_fields = static_cast<int>(field_indices.size());
+  std::vector<std::shared_ptr<Field>> fields(num_fields);
+  std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
+
+  auto included_leaves = VectorToSharedSet(indices);
+  auto ReadColumnFunc = [&](int i) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    std::unique_ptr<ColumnReaderImpl> reader;
+    RETURN_NOT_OK(
+        GetFieldReader(field_indices[i], included_leaves, {row_group}, &reader));
+    fields[i] = reader->field();
+    return reader->NextRanges(ranges, &columns[i]);
+    END_PARQUET_CATCH_EXCEPTIONS
+  };
+  RETURN_NOT_OK(ReadFields(num_fields, ReadColumnFunc));
+
   auto result_schema = ::arrow::schema(fields, manifest_.schema_metadata);
   *out = Table::Make(result_schema, columns);
   return (*out)->Validate();
@@ -885,6 +1055,19 @@ Status FileReaderBuilder::Open(std::shared_ptr<::arrow::io::RandomAccessFile> fi
   return Status::OK();
 }
 
+Status FileReaderBuilder::Open(std::shared_ptr<::arrow::io::RandomAccessFile> file,
+                               const ReaderProperties& properties,
+                               FileMetaDataCache* cache,
+                               const FileMetaDataCache::Key& key) {
+  std::shared_ptr<FileMetaData> metadata = cache->Get(key);
+  const bool cached = metadata != nullptr;
+  RETURN_NOT_OK(Open(std::move(file), properties, std::move(metadata)));
+  if (!cached) {
+    cache->Put(key, raw_reader_->metadata());
+  }
+  return Status::OK();
+}
+
 FileReaderBuilder* FileReaderBuilder::memory_pool(::arrow::MemoryPool* pool) {
   pool_ = pool;
   return this;
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "parquet/file_reader.h"
+#include "parquet/metadata_cache.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
@@ -49,6 +50,12 @@ class ColumnChunkReader;
 class ColumnReader;
 class RowGroupReader;
 
+/// \brief A contiguous range of rows, counted from the start of a row group
+struct RowRange {
+  int64_t offset;
+  int64_t length;
+};
+
 /// \brief Arrow read adapter class for deserializing Parquet files as Arrow row batches.
 ///
 /// This interfaces caters for different use cases and thus provides different
@@ -152,6 +159,13 @@ class PARQUET_EXPORT FileReader {
 
   /// \brief Return a RecordBatchReader of row groups selected from row_group_indices, the
   ///    ordering in row_group_indices matters.
+  ///
+  /// Batches have ArrowReaderProperties::batch_size() rows and may span row
+  /// groups; only the last one, or those ending where a dictionary-encoded
+  /// column changes chunks, are shorter.  Columns are decoded one batch at a
+  /// time, so decoded data takes O(batch_size * columns) memory.  To also
+  /// bound the raw column chunk data read at once, see
+  /// ReaderProperties::enable_buffered_stream().
   /// \returns error Status if row_group_indices contains invalid index
   virtual ::arrow::Status GetRecordBatchReader(
       const std::vector<int>& row_group_indices,
@@ -187,6 +201,15 @@ class PARQUET_EXPORT FileReader {
 
   virtual ::arrow::Status ReadRowGroup(int i, std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read only the given ranges of rows of row group i
+  ///
+  /// The ranges must be sorted and must not overlap. The rows between them
+  /// are skipped without being materialized. Only columns which are top-level
+  /// non-repeated fields are supported.
+  virtual ::arrow::Status ReadRowGroupRanges(
+      int i, const std::vector<int>& column_indices, const std::vector<RowRange>& ranges,
+      std::shared_ptr<::arrow::Table>* out) = 0;
+
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         const std::vector<int>& column_indices,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
@@ -267,6 +290,12 @@ class PARQUET_EXPORT FileReaderBuilder {
                        const ReaderProperties& properties = default_reader_properties(),
                        std::shared_ptr<FileMetaData> metadata = NULLPTR);
 
+  /// Create FileReaderBuilder from Arrow file, reusing the metadata cached
+  /// under key if any, and caching the metadata read from the file otherwise
+  ::arrow::Status Open(std::shared_ptr<::arrow::io::RandomAccessFile> file,
+                       const ReaderProperties& properties, FileMetaDataCache* cache,
+                       const FileMetaDataCache::Key& key);
+
   ParquetFileReader* raw_reader() { return raw_reader_.get(); }
 
   /// Set Arrow MemoryPool for memory allocation
@@ -30,6 +30,8 @@
 #include <boost/algorithm/string/predicate.hpp>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/extension_type.h"
@@ -40,6 +42,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
@@ -88,6 +91,40 @@ namespace arrow {
 template <typename ArrowType>
 using ArrayType = typename ::arrow::TypeTraits<ArrowType>::ArrayType;
 
+// ----------------------------------------------------------------------
+// FileColumnIterator
+
+int64_t FileColumnIterator::EstimateValueBytes(int64_t num_rows) const {
+  if (current_row_group_ < 0) {
+    return 0;
+  }
+  auto metadata = reader_->metadata();
+  int64_t num_bytes = 0;
+  auto add_chunk = [&](int row_group) {
+    auto row_group_metadata = metadata->RowGroup(row_group);
+    auto column_metadata = row_group_metadata->ColumnChunk(column_index_);
+    if (column_metadata->has_dictionary_page()) {
+      return false;
+    }
+    const int64_t chunk_rows = row_group_metadata->num_rows();
+    const int64_t rows = std::min(num_rows, chunk_rows);
+    if (rows > 0) {
+      num_bytes += column_metadata->total_uncompressed_size() * rows / chunk_rows;
+    }
+    num_rows -= rows;
+    return true;
+  };
+  if (!add_chunk(current_row_group_)) {
+    return -1;
+  }
+  for (auto it = row_groups_.begin(); it != row_groups_.end() && num_rows > 0; ++it) {
+    if (!add_chunk(*it)) {
+      return -1;
+    }
+  }
+  return num_bytes;
+}
+
 // ----------------------------------------------------------------------
 // Schema logic
 
@@ -335,9 +372,29 @@ struct SchemaTreeContext {
   }
 };
 
-bool IsDictionaryReadSupported(const DataType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+// Direct reads to dictionary are supported when the Arrow type is a
+// zero-copy view of the Parquet physical type, so that dictionary pages and
+// indices can be passed through unchanged
+bool IsDictionaryReadSupported(const DataType& type, ParquetType::type physical_type) {
+  switch (physical_type) {
+    case ParquetType::INT32:
+      return type.id() == ::arrow::Type::INT32 || type.id() == ::arrow::Type::UINT32 ||
+             type.id() == ::arrow::Type::DATE32 || type.id() == ::arrow::Type::TIME32;
+    case ParquetType::INT64:
+      return type.id() == ::arrow::Type::INT64 || type.id() == ::arrow::Type::UINT64 ||
+             type.id() == ::arrow::Type::TIME64 || type.id() == ::arrow::Type::TIMESTAMP;
+    case ParquetType::FLOAT:
+      return type.id() == ::arrow::Type::FLOAT;
+    case ParquetType::DOUBLE:
+      return type.id() == ::arrow::Type::DOUBLE;
+    case ParquetType::BYTE_ARRAY:
+      return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+    case ParquetType::FIXED_LEN_BYTE_ARRAY:
+      return type.id() == ::arrow::Type::FIXED_SIZE_BINARY;
+    default:
+      // BOOLEAN and INT96 have no dictionary builder
+      return false;
+  }
 }
 
 Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_node,
@@ -345,7 +402,7 @@ Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_n
   std::shared_ptr<DataType> storage_type;
   RETURN_NOT_OK(GetPrimitiveType(primitive_node, &storage_type));
   if (ctx->properties.read_dictionary(column_index) &&
-      IsDictionaryReadSupported(*storage_type)) {
+      IsDictionaryReadSupported(*storage_type, primitive_node.physical_type())) {
     *out = ::arrow::dictionary(::arrow::int32(), storage_type);
   } else {
     *out = storage_type;
@@ -605,6 +662,7 @@ Status GetOriginSchema(const std::shared_ptr<const KeyValueMetadata>& metadata,
 }
 
 Status ApplyOriginalMetadata(std::shared_ptr<Field> field, const Field& origin_field,
+                             const ColumnDescriptor* descr,
                              std::shared_ptr<Field>* out) {
   auto origin_type = origin_field.type();
   if (field->type()->id() == ::arrow::Type::TIMESTAMP) {
@@ -620,8 +678,8 @@ Status ApplyOriginalMetadata(std::shared_ptr<Field> field, const Field& origin_f
     }
   }
   if (origin_type->id() == ::arrow::Type::DICTIONARY &&
-      field->type()->id() != ::arrow::Type::DICTIONARY &&
-      IsDictionaryReadSupported(*field->type())) {
+      field->type()->id() != ::arrow::Type::DICTIONARY && descr != nullptr &&
+      IsDictionaryReadSupported(*field->type(), descr->physical_type())) {
     const auto& dict_origin_type =
         static_cast<const ::arrow::DictionaryType&>(*origin_type);
     field = field->WithType(
@@ -680,8 +738,10 @@ Status SchemaManifest::Make(const SchemaDescriptor* schema,
       continue;
     }
     auto origin_field = manifest->origin_schema->field(i);
-    RETURN_NOT_OK(
-        ApplyOriginalMetadata(out_field->field, *origin_field, &out_field->field));
+    const ColumnDescriptor* descr =
+        out_field->is_leaf() ? schema->Column(out_field->column_index) : nullptr;
+    RETURN_NOT_OK(ApplyOriginalMetadata(out_field->field, *origin_field, descr,
+                                        &out_field->field));
   }
   return Status::OK();
 }
@@ -1333,6 +1393,75 @@ Status TransferColumnData(RecordReader* reader, std::shared_ptr<DataType> value_
   return Status::OK();
 }
 
+Status UnifyDictionaryChunks(const ChunkedArray& chunked, MemoryPool* pool,
+                             std::shared_ptr<Array>* out) {
+  if (chunked.num_chunks() == 0) {
+    return ::arrow::MakeArrayOfNull(pool, chunked.type(), 0, out);
+  } else if (chunked.num_chunks() == 1) {
+    *out = chunked.chunk(0);
+    return Status::OK();
+  }
+  // Concatenate unifies the dictionaries, keeping the index type of the schema
+  return ::arrow::Concatenate(chunked.chunks(), pool, out);
+}
+
+namespace {
+
+// Reconstruct a single, outermost level of lists from the definition and
+// repetition levels of its leaf, the common case.  The loops are branch-free:
+// each level slot writes a tentative offset and validity bit, which are only
+// kept (by advancing the list count) when the slot starts a new list.
+Status ReconstructListLevel(bool nullable, int16_t null_def_level,
+                            int16_t values_def_level, const int16_t* def_levels,
+                            const int16_t* rep_levels, int64_t total_levels,
+                            ::arrow::MemoryPool* pool, int64_t* length_out,
+                            std::shared_ptr<Buffer>* offsets_out,
+                            std::shared_ptr<Buffer>* valid_bits_out,
+                            int64_t* null_count_out) {
+  std::shared_ptr<ResizableBuffer> offsets;
+  RETURN_NOT_OK(
+      AllocateResizableBuffer(pool, (total_levels + 1) * sizeof(int32_t), &offsets));
+  auto offsets_data = reinterpret_cast<int32_t*>(offsets->mutable_data());
+
+  int64_t length = 0;
+  int32_t values_offset = 0;
+  if (nullable) {
+    std::shared_ptr<Buffer> valid_bits;
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool, total_levels, &valid_bits));
+    uint8_t* valid_bits_data = valid_bits->mutable_data();
+    for (int64_t i = 0; i < total_levels; i++) {
+      const int16_t def_level = def_levels[i];
+      const bool starts_list = rep_levels[i] == 0;
+      const bool valid = starts_list & (def_level != null_def_level);
+      offsets_data[length] = values_offset;
+      valid_bits_data[length >> 3] |= static_cast<uint8_t>(valid << (length & 7));
+      length += starts_list;
+      values_offset += def_level >= values_def_level;
+    }
+    const int64_t null_count =
+        length - ::arrow::internal::CountSetBits(valid_bits_data, 0, length);
+    *valid_bits_out = null_count > 0 ? valid_bits : nullptr;
+    *null_count_out = null_count;
+  } else {
+    for (int64_t i = 0; i < total_levels; i++) {
+      const bool starts_list = rep_levels[i] == 0;
+      offsets_data[length] = values_offset;
+      length += starts_list;
+      values_offset += def_levels[i] >= values_def_level;
+    }
+    *valid_bits_out = nullptr;
+    *null_count_out = 0;
+  }
+  offsets_data[length] = values_offset;
+  RETURN_NOT_OK(offsets->Resize((length + 1) * sizeof(int32_t), /*shrink_to_fit=*/false));
+
+  *length_out = length;
+  *offsets_out = std::move(offsets);
+  return Status::OK();
+}
+
+}  // namespace
+
 Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
                              std::shared_ptr<Field> field, int16_t max_def_level,
                              int16_t max_rep_level, const int16_t* def_levels,
@@ -1341,8 +1470,6 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
   // Walk downwards to extract nullability
   std::vector<std::string> item_names;
   std::vector<bool> nullable;
-  std::vector<std::shared_ptr<::arrow::Int32Builder>> offset_builders;
-  std::vector<std::shared_ptr<::arrow::BooleanBuilder>> valid_bits_builders;
   nullable.push_back(field->nullable());
   while (field->type()->num_children() > 0) {
     if (field->type()->num_children() > 1) {
@@ -1354,14 +1481,10 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
       field = field->type()->child(0);
     }
     item_names.push_back(field->name());
-    offset_builders.emplace_back(
-        std::make_shared<::arrow::Int32Builder>(::arrow::int32(), pool));
-    valid_bits_builders.emplace_back(
-        std::make_shared<::arrow::BooleanBuilder>(::arrow::boolean(), pool));
     nullable.push_back(field->nullable());
   }
 
-  int64_t list_depth = offset_builders.size();
+  const int64_t list_depth = static_cast<int64_t>(item_names.size());
   // This describes the minimal definition that describes a level that
   // reflects a value in the primitive values array.
   int16_t values_def_level = max_def_level;
@@ -1381,55 +1504,73 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
     def_level++;
   }
 
-  int32_t values_offset = 0;
+  std::vector<std::shared_ptr<Buffer>> offsets(list_depth);
+  std::vector<std::shared_ptr<Buffer>> valid_bits(list_depth);
+  std::vector<int64_t> list_lengths(list_depth);
   std::vector<int64_t> null_counts(list_depth, 0);
-  for (int64_t i = 0; i < total_levels; i++) {
-    int16_t rep_level = rep_levels[i];
-    if (rep_level < max_rep_level) {
-      for (int64_t j = rep_level; j < list_depth; j++) {
-        if (j == (list_depth - 1)) {
-          RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-        } else {
-          RETURN_NOT_OK(offset_builders[j]->Append(
-              static_cast<int32_t>(offset_builders[j + 1]->length())));
-        }
 
-        if (((empty_def_level[j] - 1) == def_levels[i]) && (nullable[j])) {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(false));
-          null_counts[j]++;
-          break;
-        } else {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(true));
-          if (empty_def_level[j] == def_levels[i]) {
+  if (list_depth == 1 && max_rep_level == 1) {
+    RETURN_NOT_OK(ReconstructListLevel(
+        nullable[0], static_cast<int16_t>(empty_def_level[0] - 1), values_def_level,
+        def_levels, rep_levels, total_levels, pool, &list_lengths[0], &offsets[0],
+        &valid_bits[0], &null_counts[0]));
+  } else {
+    // Each level slot starts at most one list at each depth, so the builders
+    // are sized upfront
+    std::vector<::arrow::TypedBufferBuilder<int32_t>> offset_builders;
+    std::vector<::arrow::TypedBufferBuilder<bool>> valid_bits_builders;
+    offset_builders.reserve(list_depth);
+    valid_bits_builders.reserve(list_depth);
+    for (int64_t j = 0; j < list_depth; j++) {
+      offset_builders.emplace_back(pool);
+      valid_bits_builders.emplace_back(pool);
+      RETURN_NOT_OK(offset_builders[j].Reserve(total_levels + 1));
+      RETURN_NOT_OK(valid_bits_builders[j].Reserve(total_levels));
+    }
+
+    int32_t values_offset = 0;
+    for (int64_t i = 0; i < total_levels; i++) {
+      int16_t rep_level = rep_levels[i];
+      if (rep_level < max_rep_level) {
+        for (int64_t j = rep_level; j < list_depth; j++) {
+          if (j == (list_depth - 1)) {
+            offset_builders[j].UnsafeAppend(values_offset);
+          } else {
+            offset_builders[j].UnsafeAppend(
+                static_cast<int32_t>(offset_builders[j + 1].length()));
+          }
+
+          if (((empty_def_level[j] - 1) == def_levels[i]) && (nullable[j])) {
+            valid_bits_builders[j].UnsafeAppend(false);
+            null_counts[j]++;
             break;
+          } else {
+            valid_bits_builders[j].UnsafeAppend(true);
+            if (empty_def_level[j] == def_levels[i]) {
+              break;
+            }
           }
         }
       }
+      if (def_levels[i] >= values_def_level) {
+        values_offset++;
+      }
     }
-    if (def_levels[i] >= values_def_level) {
-      values_offset++;
-    }
-  }
-  // Add the final offset to all lists
-  for (int64_t j = 0; j < list_depth; j++) {
-    if (j == (list_depth - 1)) {
-      RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-    } else {
-      RETURN_NOT_OK(offset_builders[j]->Append(
-          static_cast<int32_t>(offset_builders[j + 1]->length())));
+    // Add the final offset to all lists
+    for (int64_t j = 0; j < list_depth; j++) {
+      if (j == (list_depth - 1)) {
+        offset_builders[j].UnsafeAppend(values_offset);
+      } else {
+        offset_builders[j].UnsafeAppend(
+            static_cast<int32_t>(offset_builders[j + 1].length()));
+      }
     }
-  }
 
-  std::vector<std::shared_ptr<Buffer>> offsets;
-  std::vector<std::shared_ptr<Buffer>> valid_bits;
-  std::vector<int64_t> list_lengths;
-  for (int64_t j = 0; j < list_depth; j++) {
-    list_lengths.push_back(offset_builders[j]->length() - 1);
-    std::shared_ptr<Array> array;
-    RETURN_NOT_OK(offset_builders[j]->Finish(&array));
-    offsets.emplace_back(std::static_pointer_cast<Int32Array>(array)->values());
-    RETURN_NOT_OK(valid_bits_builders[j]->Finish(&array));
-    valid_bits.emplace_back(std::static_pointer_cast<BooleanArray>(array)->values());
+    for (int64_t j = 0; j < list_depth; j++) {
+      list_lengths[j] = offset_builders[j].length() - 1;
+      RETURN_NOT_OK(offset_builders[j].Finish(&offsets[j]));
+      RETURN_NOT_OK(valid_bits_builders[j].Finish(&valid_bits[j]));
+    }
   }
 
   *out = arr;
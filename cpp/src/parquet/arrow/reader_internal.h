@@ -76,11 +76,20 @@ class FileColumnIterator {
       return nullptr;
     }
 
-    auto row_group_reader = reader_->RowGroup(row_groups_.front());
+    current_row_group_ = row_groups_.front();
+    auto row_group_reader = reader_->RowGroup(current_row_group_);
     row_groups_.pop_front();
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
+  /// \brief Estimate the number of bytes of the values in the given number of
+  /// rows, starting with the current column chunk, from the uncompressed sizes
+  /// of the column chunks
+  ///
+  /// Returns -1 if the estimate is unreliable because a column chunk has
+  /// dictionary-encoded pages, which decode to more than their size.
+  int64_t EstimateValueBytes(int64_t num_rows) const;
+
   const SchemaDescriptor* schema() const { return schema_; }
 
   const ColumnDescriptor* descr() const { return schema_->Column(column_index_); }
@@ -93,6 +102,7 @@ class FileColumnIterator {
   int column_index_;
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
+  int current_row_group_ = -1;
   std::deque<int> row_groups_;
 };
 
@@ -104,6 +114,12 @@ Status TransferColumnData(::parquet::internal::RecordReader* reader,
                           const ColumnDescriptor* descr, ::arrow::MemoryPool* pool,
                           std::shared_ptr<::arrow::ChunkedArray>* out);
 
+/// \brief Combine the chunks of a dictionary-encoded column into a single
+/// array, unifying the dictionaries of the chunks if there are several
+Status UnifyDictionaryChunks(const ::arrow::ChunkedArray& chunked,
+                             ::arrow::MemoryPool* pool,
+                             std::shared_ptr<::arrow::Array>* out);
+
 Status ReconstructNestedList(const std::shared_ptr<::arrow::Array>& arr,
                              std::shared_ptr<::arrow::Field> field, int16_t max_def_level,
                              int16_t max_rep_level, const int16_t* def_levels,
@@ -18,6 +18,8 @@
 #include "benchmark/benchmark.h"
 
 #include <iostream>
+#include <random>
+#include <string>
 
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
@@ -28,6 +30,7 @@
 #include "parquet/platform.h"
 
 #include "arrow/api.h"
+#include "arrow/util/compression.h"
 
 using arrow::BooleanBuilder;
 using arrow::NumericBuilder;
@@ -164,6 +167,41 @@ BENCHMARK_TEMPLATE2(BM_WriteColumn, true, DoubleType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, false, BooleanType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, true, BooleanType);
 
+static void BM_WriteMultipleColumns(::benchmark::State& state) {
+  const bool use_threads = state.range(0) != 0;
+  const int num_columns = 8;
+  const int64_t num_rows = BENCHMARK_SIZE / num_columns;
+  std::vector<double> values(num_rows);
+  std::default_random_engine gen(42);
+  std::uniform_real_distribution<double> d(0, 1000);
+  std::generate(values.begin(), values.end(), [&] { return d(gen); });
+  auto column = TableFromVector<DoubleType>(values, true)->column(0);
+
+  std::vector<std::shared_ptr<::arrow::Field>> fields;
+  for (int i = 0; i < num_columns; ++i) {
+    fields.push_back(::arrow::field("column" + std::to_string(i), ::arrow::float64()));
+  }
+  auto table = ::arrow::Table::Make(
+      ::arrow::schema(fields),
+      std::vector<std::shared_ptr<::arrow::ChunkedArray>>(num_columns, column));
+  const auto codec = ::arrow::util::Codec::IsAvailable(Compression::SNAPPY)
+                         ? Compression::SNAPPY
+                         : Compression::UNCOMPRESSED;
+  auto properties = WriterProperties::Builder().compression(codec)->build();
+  auto arrow_properties =
+      ArrowWriterProperties::Builder().set_use_threads(use_threads)->build();
+
+  while (state.KeepRunning()) {
+    auto output = CreateOutputStream();
+    EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output, num_rows,
+                           properties, arrow_properties));
+  }
+  state.SetBytesProcessed(state.iterations() * num_rows * num_columns *
+                          (sizeof(double) + sizeof(int16_t)));
+}
+
+BENCHMARK(BM_WriteMultipleColumns)->Arg(0)->Arg(1)->UseRealTime();
+
 template <bool nullable, typename ParquetType>
 static void BM_ReadColumn(::benchmark::State& state) {
   using T = typename ParquetType::c_type;
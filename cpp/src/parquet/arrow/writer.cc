@@ -28,9 +28,11 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/extension_type.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/arrow/schema.h"
@@ -54,6 +56,7 @@ using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
+using arrow::RecordBatch;
 using arrow::ResizableBuffer;
 using arrow::Status;
 using arrow::Table;
@@ -436,6 +439,7 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
+    appending_batches_ = false;
     return Status::OK();
   }
 
@@ -491,7 +495,13 @@ class FileWriterImpl : public FileWriter {
       chunk_size = this->properties().max_row_group_length();
     }
 
+    const bool parallel = arrow_properties_->use_threads() && table.num_columns() > 1 &&
+                          properties().file_encryption_properties() == nullptr;
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (parallel) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        return WriteBufferedColumns(table.columns(), offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -514,6 +524,49 @@ class FileWriterImpl : public FileWriter {
     return Status::OK();
   }
 
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("record batch schema does not match this writer's. batch:'",
+                             batch.schema()->ToString(), "' this:'", schema_->ToString(),
+                             "'");
+    }
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      columns.push_back(std::make_shared<ChunkedArray>(batch.column(i)));
+    }
+
+    const int64_t max_rows = properties().max_row_group_length();
+    if (max_rows <= 0) {
+      return Status::Invalid("max_row_group_length must be greater than 0");
+    }
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (!appending_batches_) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        appending_batches_ = true;
+      }
+      int64_t rows_in_row_group;
+      PARQUET_CATCH_NOT_OK(rows_in_row_group = row_group_writer_->num_rows());
+      const int64_t size =
+          std::min(batch.num_rows() - offset, max_rows - rows_in_row_group);
+      RETURN_NOT_OK(WriteBufferedColumns(columns, offset, size));
+      offset += size;
+
+      // Pages not yet flushed to the in-memory sinks are not accounted for, but
+      // they are bounded by the page and dictionary size limits of each column
+      int64_t buffered_bytes;
+      PARQUET_CATCH_NOT_OK(buffered_bytes = row_group_writer_->total_bytes_written() +
+                                            row_group_writer_->total_compressed_bytes());
+      if (rows_in_row_group + size >= max_rows ||
+          buffered_bytes >= properties().max_row_group_bytes()) {
+        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        row_group_writer_ = nullptr;
+        appending_batches_ = false;
+      }
+    }
+    return Status::OK();
+  }
+
   const WriterProperties& properties() const { return *writer_->properties(); }
 
   ::arrow::MemoryPool* memory_pool() const override {
@@ -527,6 +580,48 @@ class FileWriterImpl : public FileWriter {
  private:
   friend class FileWriter;
 
+  Status NewBufferedRowGroup() {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    appending_batches_ = false;
+    return Status::OK();
+  }
+
+  Status WriteBufferedColumn(ArrowWriteContext* ctx, int i, const ChunkedArray& data,
+                             int64_t offset, int64_t size) {
+    const SchemaField* schema_field = nullptr;
+    RETURN_NOT_OK(schema_manifest_.GetColumnField(i, &schema_field));
+    ArrowColumnWriter arrow_writer(ctx, row_group_writer_->column(i), schema_field,
+                                   &schema_manifest_);
+    Status status;
+    PARQUET_CATCH_NOT_OK(status = arrow_writer.Write(data, offset, size));
+    return status;
+  }
+
+  // Writes a slice of the columns to the current buffered row group. With
+  // use_threads the column chunks are encoded and compressed on the CPU thread
+  // pool; they are written out in schema order when the row group is closed.
+  Status WriteBufferedColumns(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                              int64_t offset, int64_t size) {
+    const int num_columns = static_cast<int>(columns.size());
+    if (!arrow_properties_->use_threads() || num_columns < 2 ||
+        properties().file_encryption_properties() != nullptr) {
+      for (int i = 0; i < num_columns; ++i) {
+        RETURN_NOT_OK(WriteBufferedColumn(&column_write_context_, i, *columns[i],
+                                          offset, size));
+      }
+      return Status::OK();
+    }
+    auto WriteColumn = [&](int i) -> Status {
+      // The scratch buffers of the write context can't be shared between threads
+      ArrowWriteContext ctx(memory_pool(), arrow_properties_.get());
+      return WriteBufferedColumn(&ctx, i, *columns[i], offset, size);
+    };
+    return ::arrow::internal::ParallelFor(num_columns, WriteColumn);
+  }
+
   std::shared_ptr<::arrow::Schema> schema_;
 
   SchemaManifest schema_manifest_;
@@ -535,6 +630,9 @@ class FileWriterImpl : public FileWriter {
   RowGroupWriter* row_group_writer_;
   ArrowWriteContext column_write_context_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
+  // Whether the current row group was started by WriteRecordBatch and can
+  // take more batches
+  bool appending_batches_ = false;
   bool closed_;
 };
 
@@ -28,6 +28,7 @@ namespace arrow {
 
 class Array;
 class ChunkedArray;
+class RecordBatch;
 class Schema;
 class Table;
 
@@ -77,6 +78,17 @@ class PARQUET_EXPORT FileWriter {
 
   virtual ::arrow::Status WriteColumnChunk(
       const std::shared_ptr<::arrow::ChunkedArray>& data) = 0;
+
+  /// \brief Append a RecordBatch to a buffered row group.
+  ///
+  /// Consecutive batches are accumulated in the column encoders of the same
+  /// row group, which is closed once it holds
+  /// WriterProperties::max_row_group_length() rows or about
+  /// WriterProperties::max_row_group_bytes() of encoded data; a batch that
+  /// does not fit is split across row groups. A call to NewRowGroup or
+  /// WriteTable ends the current buffered row group.
+  virtual ::arrow::Status WriteRecordBatch(const ::arrow::RecordBatch& batch) = 0;
+
   virtual ::arrow::Status Close() = 0;
   virtual ~FileWriter();
 
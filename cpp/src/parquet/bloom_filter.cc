@@ -17,11 +17,14 @@
 
 #include <cstdint>
 #include <cstring>
+#include <vector>
 
 #include "arrow/util/logging.h"
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/murmur3.h"
+#include "parquet/properties.h"
+#include "parquet/schema.h"
 
 namespace parquet {
 constexpr uint32_t BlockSplitBloomFilter::SALT[kBitsSetPerBlock];
@@ -158,4 +161,72 @@ void BlockSplitBloomFilter::InsertHash(uint64_t hash) {
   }
 }
 
+namespace {
+
+class BloomFilterBuilderImpl : public BloomFilterBuilder {
+ public:
+  BloomFilterBuilderImpl(const SchemaDescriptor* schema,
+                         const WriterProperties* properties)
+      : schema_(schema), properties_(properties) {}
+
+  void AppendRowGroup() override {
+    const int num_columns = schema_->num_columns();
+    bloom_filters_.emplace_back(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      const ColumnDescriptor* descr = schema_->Column(i);
+      if (descr->physical_type() == Type::BOOLEAN ||
+          !properties_->bloom_filter_enabled(descr->path())) {
+        continue;
+      }
+      const BloomFilterOptions& options =
+          properties_->bloom_filter_options(descr->path());
+      if (options.ndv <= 0 || !(options.fpp > 0.0 && options.fpp < 1.0)) {
+        throw ParquetException("Invalid Bloom filter options for column " +
+                               descr->path()->ToDotString());
+      }
+      std::unique_ptr<BlockSplitBloomFilter> bloom_filter(new BlockSplitBloomFilter());
+      bloom_filter->Init(BlockSplitBloomFilter::OptimalNumOfBits(
+                             static_cast<uint32_t>(options.ndv), options.fpp) /
+                         8);
+      bloom_filters_.back()[i] = std::move(bloom_filter);
+    }
+  }
+
+  BloomFilter* GetBloomFilter(int i) override {
+    if (bloom_filters_.empty()) {
+      return nullptr;
+    }
+    return bloom_filters_.back().at(i).get();
+  }
+
+  void WriteTo(ArrowOutputStream* sink, BloomFilterLocation* location) const override {
+    auto& offsets = location->bloom_filter_offsets;
+    offsets.clear();
+    offsets.resize(bloom_filters_.size());
+    for (size_t row_group = 0; row_group < bloom_filters_.size(); ++row_group) {
+      for (const auto& bloom_filter : bloom_filters_[row_group]) {
+        int64_t offset = -1;
+        if (bloom_filter) {
+          PARQUET_ASSIGN_OR_THROW(offset, sink->Tell());
+          bloom_filter->WriteTo(sink);
+        }
+        offsets[row_group].push_back(offset);
+      }
+    }
+  }
+
+ private:
+  const SchemaDescriptor* schema_;
+  const WriterProperties* properties_;
+  std::vector<std::vector<std::unique_ptr<BlockSplitBloomFilter>>> bloom_filters_;
+};
+
+}  // namespace
+
+std::unique_ptr<BloomFilterBuilder> BloomFilterBuilder::Make(
+    const SchemaDescriptor* schema, const WriterProperties* properties) {
+  return std::unique_ptr<BloomFilterBuilder>(
+      new BloomFilterBuilderImpl(schema, properties));
+}
+
 }  // namespace parquet
@@ -21,6 +21,7 @@
 #include <cmath>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/util/logging.h"
 #include "parquet/hasher.h"
@@ -244,6 +245,35 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   std::unique_ptr<Hasher> hasher_;
 };
 
+class SchemaDescriptor;
+class WriterProperties;
+
+/// \brief File offsets of the Bloom filters written for each column chunk,
+/// indexed by row group then column. Missing filters have a negative offset.
+struct BloomFilterLocation {
+  std::vector<std::vector<int64_t>> bloom_filter_offsets;
+};
+
+/// \brief Collects the Bloom filters of all column chunks of a file, to be
+/// written after the last row group
+class PARQUET_EXPORT BloomFilterBuilder {
+ public:
+  static std::unique_ptr<BloomFilterBuilder> Make(const SchemaDescriptor* schema,
+                                                  const WriterProperties* properties);
+
+  virtual ~BloomFilterBuilder() = default;
+
+  /// \brief Allocate the Bloom filters of a new row group
+  virtual void AppendRowGroup() = 0;
+
+  /// \brief The Bloom filter of column i of the current row group, or nullptr
+  /// if the column has no Bloom filter
+  virtual BloomFilter* GetBloomFilter(int i) = 0;
+
+  /// \brief Serialize all Bloom filters
+  virtual void WriteTo(ArrowOutputStream* sink, BloomFilterLocation* location) const = 0;
+};
+
 }  // namespace parquet
 
 #endif  // PARQUET_BLOOM_FILTER_H
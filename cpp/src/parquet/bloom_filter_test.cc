@@ -26,13 +26,18 @@
 
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 
 #include "parquet/bloom_filter.h"
+#include "parquet/column_writer.h"
 #include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
 #include "parquet/murmur3.h"
 #include "parquet/platform.h"
+#include "parquet/schema.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
 
@@ -242,6 +247,90 @@ TEST(OptimalValueTest, TestBloomFilter) {
       UINT32_C(1073741824));
 }
 
+// Bloom filters enabled in the WriterProperties are written for each column
+// chunk and can be read back through the RowGroupReader
+TEST(ColumnChunkTest, TestBloomFilter) {
+  using schema::GroupNode;
+  using schema::PrimitiveNode;
+
+  auto a = PrimitiveNode::Make("a", Repetition::REQUIRED, Type::INT64);
+  auto b = PrimitiveNode::Make("b", Repetition::OPTIONAL, Type::BYTE_ARRAY,
+                               ConvertedType::UTF8);
+  auto c = PrimitiveNode::Make("c", Repetition::REQUIRED, Type::INT32);
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, {a, b, c}));
+
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("a", BloomFilterOptions(100, 0.01))
+                        ->enable_bloom_filter("b", BloomFilterOptions(100, 0.01))
+                        ->build();
+
+  constexpr int kNumRowGroups = 2;
+  constexpr int kNumRows = 50;
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  std::vector<std::string> strings;
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    std::vector<int64_t> a_values;
+    std::vector<ByteArray> b_values;
+    std::vector<int16_t> b_def_levels;
+    std::vector<int32_t> c_values(kNumRows, 0);
+    for (int i = 0; i < kNumRows; ++i) {
+      a_values.push_back(rg * kNumRows + i);
+      strings.push_back("value" + std::to_string(rg * kNumRows + i));
+    }
+    for (int i = 0; i < kNumRows; ++i) {
+      // Only even rows have a value
+      b_def_levels.push_back(i % 2 == 0 ? 1 : 0);
+      if (i % 2 == 0) {
+        b_values.push_back(ByteArray(strings[rg * kNumRows + i]));
+      }
+    }
+    auto row_group_writer = file_writer->AppendRowGroup();
+    static_cast<Int64Writer*>(row_group_writer->NextColumn())
+        ->WriteBatch(kNumRows, nullptr, nullptr, a_values.data());
+    static_cast<ByteArrayWriter*>(row_group_writer->NextColumn())
+        ->WriteBatch(kNumRows, b_def_levels.data(), nullptr, b_values.data());
+    static_cast<Int32Writer*>(row_group_writer->NextColumn())
+        ->WriteBatch(kNumRows, nullptr, nullptr, c_values.data());
+    row_group_writer->Close();
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    auto row_group = reader->RowGroup(rg);
+    ASSERT_TRUE(row_group->metadata()->ColumnChunk(0)->has_bloom_filter());
+    ASSERT_TRUE(row_group->metadata()->ColumnChunk(1)->has_bloom_filter());
+    ASSERT_FALSE(row_group->metadata()->ColumnChunk(2)->has_bloom_filter());
+    ASSERT_EQ(row_group->GetBloomFilter(2).get(), nullptr);
+
+    auto a_filter = row_group->GetBloomFilter(0);
+    auto b_filter = row_group->GetBloomFilter(1);
+    ASSERT_NE(a_filter.get(), nullptr);
+    ASSERT_NE(b_filter.get(), nullptr);
+
+    int a_false_positives = 0;
+    for (int64_t value = 0; value < kNumRowGroups * kNumRows; ++value) {
+      const bool in_row_group = value / kNumRows == rg;
+      const bool found = a_filter->FindHash(a_filter->Hash(value));
+      if (in_row_group) {
+        ASSERT_TRUE(found) << value;
+      } else if (found) {
+        ++a_false_positives;
+      }
+    }
+    ASSERT_LT(a_false_positives, kNumRows / 5);
+
+    for (int i = 0; i < kNumRows; i += 2) {
+      const ByteArray value(strings[rg * kNumRows + i]);
+      ASSERT_TRUE(b_filter->FindHash(b_filter->Hash(&value))) << strings[i];
+    }
+  }
+}
+
 }  // namespace test
 
 }  // namespace parquet
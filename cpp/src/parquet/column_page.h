@@ -103,15 +103,21 @@ class CompressedDataPage : public DataPageV1 {
   CompressedDataPage(const std::shared_ptr<Buffer>& buffer, int32_t num_values,
                      Encoding::type encoding, Encoding::type definition_level_encoding,
                      Encoding::type repetition_level_encoding, int64_t uncompressed_size,
-                     const EncodedStatistics& statistics = EncodedStatistics())
+                     const EncodedStatistics& statistics = EncodedStatistics(),
+                     int64_t num_rows = 0)
       : DataPageV1(buffer, num_values, encoding, definition_level_encoding,
                    repetition_level_encoding, statistics),
-        uncompressed_size_(uncompressed_size) {}
+        uncompressed_size_(uncompressed_size),
+        num_rows_(num_rows) {}
 
   int64_t uncompressed_size() const { return uncompressed_size_; }
 
+  /// Number of rows starting in this page
+  int64_t num_rows() const { return num_rows_; }
+
  private:
   int64_t uncompressed_size_;
+  int64_t num_rows_;
 };
 
 class DataPageV2 : public DataPage {
@@ -32,6 +32,7 @@
 #include "arrow/builder.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
@@ -143,6 +144,10 @@ class SerializedPageReader : public PageReader {
 
   void InitDecryption();
 
+  // Returns true if the current page is a data page rejected by the data page
+  // filter, in which case it is accounted for as if it had been read
+  bool ShouldSkipPage();
+
   std::shared_ptr<ArrowInputStream> stream_;
 
   format::PageHeader current_page_header_;
@@ -214,6 +219,55 @@ void SerializedPageReader::UpdateDecryption(const std::shared_ptr<Decryptor>& de
   }
 }
 
+namespace {
+
+template <typename H>
+EncodedStatistics ExtractStatsFromHeader(const H& header) {
+  EncodedStatistics page_statistics;
+  if (!header.__isset.statistics) {
+    return page_statistics;
+  }
+  const format::Statistics& stats = header.statistics;
+  if (stats.__isset.max) {
+    page_statistics.set_max(stats.max);
+  }
+  if (stats.__isset.min) {
+    page_statistics.set_min(stats.min);
+  }
+  if (stats.__isset.null_count) {
+    page_statistics.set_null_count(stats.null_count);
+  }
+  if (stats.__isset.distinct_count) {
+    page_statistics.set_distinct_count(stats.distinct_count);
+  }
+  return page_statistics;
+}
+
+}  // namespace
+
+bool SerializedPageReader::ShouldSkipPage() {
+  const format::PageType::type page_type = current_page_header_.type;
+  if (page_type != format::PageType::DATA_PAGE &&
+      page_type != format::PageType::DATA_PAGE_V2) {
+    return false;
+  }
+  EncodedStatistics page_statistics;
+  int32_t num_values;
+  if (page_type == format::PageType::DATA_PAGE) {
+    page_statistics = ExtractStatsFromHeader(current_page_header_.data_page_header);
+    num_values = current_page_header_.data_page_header.num_values;
+  } else {
+    page_statistics = ExtractStatsFromHeader(current_page_header_.data_page_header_v2);
+    num_values = current_page_header_.data_page_header_v2.num_values;
+  }
+  if (!data_page_filter_(DataPageStats(&page_statistics, num_values, page_ordinal_))) {
+    return false;
+  }
+  ++page_ordinal_;
+  seen_num_rows_ += num_values;
+  return true;
+}
+
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
   // Loop here because there may be unhandled page types that we skip until
   // finding a page that we do know what to do with
@@ -257,6 +311,10 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     int compressed_len = current_page_header_.compressed_page_size;
     int uncompressed_len = current_page_header_.uncompressed_page_size;
+    if (data_page_filter_ && ShouldSkipPage()) {
+      PARQUET_THROW_NOT_OK(stream_->Advance(compressed_len));
+      continue;
+    }
     if (crypto_ctx_.data_decryptor != nullptr) {
       UpdateDecryption(crypto_ctx_.data_decryptor, encryption::kDictionaryPage,
                        data_page_aad_);
@@ -304,23 +362,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     } else if (current_page_header_.type == format::PageType::DATA_PAGE) {
       ++page_ordinal_;
       const format::DataPageHeader& header = current_page_header_.data_page_header;
-
-      EncodedStatistics page_statistics;
-      if (header.__isset.statistics) {
-        const format::Statistics& stats = header.statistics;
-        if (stats.__isset.max) {
-          page_statistics.set_max(stats.max);
-        }
-        if (stats.__isset.min) {
-          page_statistics.set_min(stats.min);
-        }
-        if (stats.__isset.null_count) {
-          page_statistics.set_null_count(stats.null_count);
-        }
-        if (stats.__isset.distinct_count) {
-          page_statistics.set_distinct_count(stats.distinct_count);
-        }
-      }
+      EncodedStatistics page_statistics = ExtractStatsFromHeader(header);
 
       seen_num_rows_ += header.num_values;
 
@@ -575,8 +617,11 @@ class ColumnReaderImplBase {
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
         }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -584,11 +629,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -975,6 +1015,62 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (this->max_rep_level_ > 0) {
+      throw ParquetException("Skipping records of repeated columns is not supported");
+    }
+    int64_t records_skipped = 0;
+
+    // First drop the levels decoded ahead by ReadRecords, whose values are
+    // still pending in the current page
+    if (levels_position_ < levels_written_) {
+      const int64_t num_levels =
+          std::min(num_records, levels_written_ - levels_position_);
+      int16_t* def_data = def_levels() + levels_position_;
+      SkipValues(CountDefinedValues(def_data, num_levels));
+      std::copy(def_data + num_levels, def_levels() + levels_written_, def_data);
+      levels_written_ -= num_levels;
+      this->ConsumeBufferedValues(num_levels);
+      records_skipped += num_levels;
+    }
+
+    while (records_skipped < num_records && this->HasNextInternal()) {
+      const int64_t records_to_skip = num_records - records_skipped;
+      const int64_t available = available_values_current_page();
+      if (records_to_skip >= available) {
+        // The rest of the page can be dropped without decoding it
+        this->ConsumeBufferedValues(available);
+        records_skipped += available;
+        continue;
+      }
+
+      int64_t levels_skipped = records_to_skip;
+      int64_t values_to_skip = records_to_skip;
+      if (this->max_def_level_ > 0) {
+        levels_skipped = values_to_skip = 0;
+        while (levels_skipped < records_to_skip) {
+          const int64_t batch_size =
+              std::min(kMinLevelBatchSize, records_to_skip - levels_skipped);
+          int16_t* levels = reinterpret_cast<int16_t*>(SkipScratch());
+          const int64_t levels_read = this->ReadDefinitionLevels(batch_size, levels);
+          if (levels_read == 0) {
+            break;
+          }
+          values_to_skip += CountDefinedValues(levels, levels_read);
+          levels_skipped += levels_read;
+        }
+      }
+      SkipValues(values_to_skip);
+      this->ConsumeBufferedValues(levels_skipped);
+      records_skipped += levels_skipped;
+      if (levels_skipped < records_to_skip) {
+        // Exhausted column chunk
+        break;
+      }
+    }
+    return records_skipped;
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1153,6 +1249,39 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
+  int64_t CountDefinedValues(const int16_t* levels, int64_t num_levels) const {
+    int64_t num_values = 0;
+    for (int64_t i = 0; i < num_levels; ++i) {
+      if (levels[i] == this->max_def_level_) {
+        ++num_values;
+      }
+    }
+    return num_values;
+  }
+
+  // Scratch space for kMinLevelBatchSize levels or values, used when skipping
+  uint8_t* SkipScratch() {
+    if (skip_scratch_ == nullptr) {
+      const int64_t value_size =
+          static_cast<int64_t>(std::max(sizeof(T), sizeof(int16_t)));
+      skip_scratch_ = AllocateBuffer(this->pool_, kMinLevelBatchSize * value_size);
+    }
+    return skip_scratch_->mutable_data();
+  }
+
+  // Decode and discard values of the current page
+  void SkipValues(int64_t num_values) {
+    while (num_values > 0) {
+      const int batch_size = static_cast<int>(std::min(kMinLevelBatchSize, num_values));
+      const int num_decoded = this->current_decoder_->Decode(
+          reinterpret_cast<T*>(SkipScratch()), batch_size);
+      if (num_decoded <= 0) {
+        throw ParquetException("Unexpected end of values while skipping records");
+      }
+      num_values -= num_decoded;
+    }
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(int64_t num_records) {
     // Conservative upper bound
@@ -1247,6 +1376,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   T* ValuesHead() {
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
+
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1322,6 +1453,15 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
     return result;
   }
 
+  void ReserveData(int64_t num_bytes) override {
+    // Allocate no more than estimated, and no more than fits in one chunk
+    auto builder = accumulator_.builder.get();
+    num_bytes = std::min(num_bytes,
+                         ::arrow::kBinaryMemoryLimit - builder->value_data_length());
+    PARQUET_THROW_NOT_OK(
+        builder->ReserveData(num_bytes, builder->value_data_length() + num_bytes));
+  }
+
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = this->current_decoder_->DecodeArrowNonNull(
         static_cast<int>(values_to_read), &accumulator_);
@@ -1342,13 +1482,29 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
+// Arrow value type of the dictionary built from a column of the given
+// physical type
+template <typename DType>
+std::shared_ptr<::arrow::DataType> DictionaryValueType(const ColumnDescriptor* descr) {
+  return ::arrow::TypeTraits<typename EncodingTraits<DType>::ArrowType>::type_singleton();
+}
+
+template <>
+std::shared_ptr<::arrow::DataType> DictionaryValueType<FLBAType>(
+    const ColumnDescriptor* descr) {
+  return ::arrow::fixed_size_binary(descr->type_length());
+}
+
+template <typename DType>
+class DictionaryRecordReaderImpl : public TypedRecordReader<DType>,
+                                   virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, pool), builder_(pool) {
+  DictionaryRecordReaderImpl(const ColumnDescriptor* descr, ::arrow::MemoryPool* pool)
+      : TypedRecordReader<DType>(descr, pool),
+        builder_(DictionaryValueType<DType>(descr), pool) {
     this->read_dictionary_ = true;
+    // Decoded values and indices go straight into the builder
+    this->uses_values_ = false;
   }
 
   std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
@@ -1374,7 +1530,7 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       /// If there is a new dictionary, we may need to flush the builder, then
       /// insert the new dictionary values
       FlushBuilder();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoderType*>(this->current_decoder_);
       decoder->InsertDictionary(&builder_);
       this->new_dictionary_ = false;
     }
@@ -1382,43 +1538,43 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoderType*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoderType*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read - null_count);
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
+  using DictDecoderType = DictDecoder<DType>;
 
-  ::arrow::BinaryDictionary32Builder builder_;
+  typename EncodingTraits<DType>::DictAccumulator builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
@@ -1432,19 +1588,35 @@ void TypedRecordReader<ByteArrayType>::DebugPrintState() {}
 template <>
 void TypedRecordReader<FLBAType>::DebugPrintState() {}
 
-std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor* descr,
-                                                        ::arrow::MemoryPool* pool,
-                                                        bool read_dictionary) {
-  if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool);
-  } else {
-    return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
+std::shared_ptr<RecordReader> MakeDictionaryRecordReader(const ColumnDescriptor* descr,
+                                                         ::arrow::MemoryPool* pool) {
+  switch (descr->physical_type()) {
+    case Type::INT32:
+      return std::make_shared<DictionaryRecordReaderImpl<Int32Type>>(descr, pool);
+    case Type::INT64:
+      return std::make_shared<DictionaryRecordReaderImpl<Int64Type>>(descr, pool);
+    case Type::FLOAT:
+      return std::make_shared<DictionaryRecordReaderImpl<FloatType>>(descr, pool);
+    case Type::DOUBLE:
+      return std::make_shared<DictionaryRecordReaderImpl<DoubleType>>(descr, pool);
+    case Type::BYTE_ARRAY:
+      return std::make_shared<DictionaryRecordReaderImpl<ByteArrayType>>(descr, pool);
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return std::make_shared<DictionaryRecordReaderImpl<FLBAType>>(descr, pool);
+    default:
+      break;
   }
+  throw ParquetException("Cannot read column of physical type " +
+                         TypeToString(descr->physical_type()) +
+                         " directly to dictionary");
 }
 
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  MemoryPool* pool,
                                                  const bool read_dictionary) {
+  if (read_dictionary) {
+    return MakeDictionaryRecordReader(descr, pool);
+  }
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, pool);
@@ -1459,7 +1631,7 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::DOUBLE:
       return std::make_shared<TypedRecordReader<DoubleType>>(descr, pool);
     case Type::BYTE_ARRAY:
-      return MakeByteArrayRecordReader(descr, pool, read_dictionary);
+      return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<FLBARecordReader>(descr, pool);
     default: {
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -91,6 +92,30 @@ struct CryptoContext {
   std::shared_ptr<Decryptor> data_decryptor;
 };
 
+class EncodedStatistics;
+
+// Information about a data page available from its header, before its body is
+// read or decompressed
+struct DataPageStats {
+  DataPageStats(const EncodedStatistics* encoded_statistics, int32_t num_values,
+                int page_ordinal)
+      : encoded_statistics(encoded_statistics),
+        num_values(num_values),
+        page_ordinal(page_ordinal) {}
+
+  // Statistics from the page header; has_min/has_max are false if the writer
+  // did not store them
+  const EncodedStatistics* encoded_statistics;
+  // Number of values (including nulls) in the page
+  int32_t num_values;
+  // Index of the page among the data pages of the column chunk, which is also
+  // its position in the ColumnIndex and OffsetIndex
+  int page_ordinal;
+};
+
+// Returns true if the data page should be skipped
+using DataPageFilter = std::function<bool(const DataPageStats&)>;
+
 // Abstract page iterator interface. This way, we can feed column pages to the
 // ColumnReader through whatever mechanism we choose
 class PARQUET_EXPORT PageReader {
@@ -107,6 +132,17 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  // Skip the data pages for which the filter returns true, without reading or
+  // decompressing them. Skipped values are dropped from the column, so when
+  // reading several columns the caller must skip the same rows in each of them
+  // (e.g. by deciding from a ColumnIndex of a non-repeated column).
+  virtual void set_data_page_filter(DataPageFilter data_page_filter) {
+    data_page_filter_ = std::move(data_page_filter);
+  }
+
+ protected:
+  DataPageFilter data_page_filter_;
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -215,9 +251,19 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Skip the indicated number of records in the column chunk without
+  /// materializing them. Only supported for non-repeated columns
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
+  /// \brief Pre-allocate space for the given number of bytes of variable-length
+  /// value data, e.g. as estimated from column chunk metadata. Does nothing
+  /// for fixed-width values
+  virtual void ReserveData(int64_t num_bytes) {}
+
   /// \brief Clear consumed values and repetition/definition levels as the
   /// result of calling ReadRecords
   virtual void Reset() = 0;
@@ -305,7 +351,7 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Valid for all physical types except BOOLEAN and INT96
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -29,6 +31,7 @@
 #include "arrow/builder.h"
 #include "arrow/stl.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/byte_stream_split.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
@@ -856,18 +859,12 @@ int64_t ByteStreamSplitEncoder<DType>::EstimatedDataEncodedSize() {
 
 template <typename DType>
 std::shared_ptr<Buffer> ByteStreamSplitEncoder<DType>::FlushValues() {
-  constexpr size_t num_streams = sizeof(T);
   std::shared_ptr<ResizableBuffer> output_buffer =
       AllocateBuffer(this->memory_pool(), EstimatedDataEncodedSize());
   uint8_t* output_buffer_raw = output_buffer->mutable_data();
-  const size_t num_values = values_.length();
   const uint8_t* raw_values = reinterpret_cast<const uint8_t*>(values_.data());
-  for (size_t i = 0; i < num_values; ++i) {
-    for (size_t j = 0U; j < num_streams; ++j) {
-      const uint8_t byte_in_value = raw_values[i * num_streams + j];
-      output_buffer_raw[j * num_values + i] = byte_in_value;
-    }
-  }
+  ::arrow::util::internal::ByteStreamSplitEncode<T>(raw_values, values_.length(),
+                                                    output_buffer_raw);
   values_.Reset();
   return std::move(output_buffer);
 }
@@ -914,6 +911,406 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   Put(data, num_valid_values);
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder<T> implementations
+
+// Values are stored as a first value followed by blocks of deltas between
+// consecutive values. Each block starts with the minimum delta of the block
+// and the bit width of each of its miniblocks, followed by the miniblocks
+// themselves, bit-packing the deltas minus the minimum delta.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+  // Block and miniblock sizes recommended by the Parquet specification
+  static constexpr uint32_t kValuesPerBlock = 128;
+  static constexpr uint32_t kMiniBlocksPerBlock = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+  // Upper bound of the size of the header: two uint32 vlqs for the block
+  // layout, one for the total value count and a zigzag encoded first value
+  static constexpr int kMaxHeaderSize = 3 * arrow::BitUtil::BitReader::MAX_VLQ_BYTE_LEN +
+                                        arrow::BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64;
+  // Upper bound of the size of a block
+  static constexpr int kMaxBlockSize = arrow::BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64 +
+                                       kMiniBlocksPerBlock +
+                                       kValuesPerBlock * sizeof(typename DType::c_type);
+
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool),
+        deltas_(kValuesPerBlock),
+        bits_buffer_(AllocateBuffer(pool, kMaxBlockSize)),
+        sink_(pool),
+        bit_writer_(bits_buffer_->mutable_data(),
+                    static_cast<int>(bits_buffer_->size())) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+    // The header is only known once all values were seen, leave room for it
+    PARQUET_THROW_NOT_OK(sink_.Advance(kMaxHeaderSize));
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + values_current_block_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* buffer, int num_values) override;
+  void Put(const arrow::Array& values) override;
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ private:
+  void FlushBlock();
+  void PutDelta(UT delta, int bit_width);
+
+  uint32_t total_value_count_ = 0;
+  uint32_t values_current_block_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  std::vector<UT> deltas_;
+  std::shared_ptr<ResizableBuffer> bits_buffer_;
+  arrow::BufferBuilder sink_;
+  arrow::BitUtil::BitWriter bit_writer_;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = src[0];
+    current_value_ = src[0];
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+  for (; idx < num_values; ++idx) {
+    // Deltas wrap around on overflow, as the decoder undoes them with the same
+    // modular arithmetic
+    const T value = src[idx];
+    deltas_[values_current_block_] =
+        static_cast<UT>(value) - static_cast<UT>(current_value_);
+    current_value_ = value;
+    if (++values_current_block_ == kValuesPerBlock) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::PutDelta(UT delta, int bit_width) {
+  // BitWriter::PutValue handles at most 32 bits at a time; writing the low
+  // and high halves in turn produces the same bit-packed stream
+  bool written;
+  if (bit_width <= 32) {
+    written = bit_writer_.PutValue(delta, bit_width);
+  } else {
+    const uint64_t value = static_cast<uint64_t>(delta);
+    written = bit_writer_.PutValue(value & 0xFFFFFFFFULL, 32) &&
+              bit_writer_.PutValue(value >> 32, bit_width - 32);
+  }
+  if (ARROW_PREDICT_FALSE(!written)) {
+    throw ParquetException("Delta bit pack block buffer is too small");
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (values_current_block_ == 0) {
+    return;
+  }
+  const T min_delta = static_cast<T>(*std::min_element(
+      deltas_.begin(), deltas_.begin() + values_current_block_,
+      [](UT a, UT b) { return static_cast<T>(a) < static_cast<T>(b); }));
+  bit_writer_.PutZigZagVlqInt(min_delta);
+
+  // The bit widths are only known once the deltas of each miniblock are seen
+  uint8_t* bit_widths = bit_writer_.GetNextBytePtr(kMiniBlocksPerBlock);
+  DCHECK(bit_widths != nullptr);
+  const uint32_t num_mini_blocks = static_cast<uint32_t>(
+      BitUtil::CeilDiv(values_current_block_, kValuesPerMiniBlock));
+  for (uint32_t i = 0; i < kMiniBlocksPerBlock; ++i) {
+    if (i >= num_mini_blocks) {
+      // Unused miniblocks of the last block are not written
+      bit_widths[i] = 0;
+      continue;
+    }
+    const uint32_t start = i * kValuesPerMiniBlock;
+    const uint32_t remaining = values_current_block_ - start;
+    const uint32_t length =
+        remaining < kValuesPerMiniBlock ? remaining : kValuesPerMiniBlock;
+    UT max_delta = 0;
+    for (uint32_t j = start; j < start + length; ++j) {
+      deltas_[j] -= static_cast<UT>(min_delta);
+      max_delta = std::max(max_delta, deltas_[j]);
+    }
+    const int bit_width = BitUtil::NumRequiredBits(static_cast<uint64_t>(max_delta));
+    bit_widths[i] = static_cast<uint8_t>(bit_width);
+    for (uint32_t j = start; j < start + length; ++j) {
+      PutDelta(deltas_[j], bit_width);
+    }
+    // A partial miniblock is padded to its full size
+    for (uint32_t j = length; j < kValuesPerMiniBlock; ++j) {
+      PutDelta(0, bit_width);
+    }
+  }
+  bit_writer_.Flush();
+  PARQUET_THROW_NOT_OK(sink_.Append(bit_writer_.buffer(), bit_writer_.bytes_written()));
+  bit_writer_.Clear();
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header_buffer[kMaxHeaderSize];
+  arrow::BitUtil::BitWriter header_writer(header_buffer, kMaxHeaderSize);
+  if (!header_writer.PutVlqInt(kValuesPerBlock) ||
+      !header_writer.PutVlqInt(kMiniBlocksPerBlock) ||
+      !header_writer.PutVlqInt(total_value_count_) ||
+      !header_writer.PutZigZagVlqInt(first_value_)) {
+    throw ParquetException("Delta bit pack header buffer is too small");
+  }
+  header_writer.Flush();
+  const int header_size = header_writer.bytes_written();
+
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_THROW_NOT_OK(sink_.Finish(&buffer, /*shrink_to_fit=*/false));
+  // The header goes right before the first block
+  const int64_t offset = kMaxHeaderSize - header_size;
+  memcpy(buffer->mutable_data() + offset, header_buffer, header_size);
+
+  total_value_count_ = 0;
+  first_value_ = 0;
+  current_value_ = 0;
+  PARQUET_THROW_NOT_OK(sink_.Advance(kMaxHeaderSize));
+  return SliceBuffer(buffer, offset);
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const ::arrow::Array& values) {
+  using ArrowType = typename std::conditional<std::is_same<T, int32_t>::value,
+                                              arrow::Int32Type, arrow::Int64Type>::type;
+  if (values.type_id() != ArrowType::type_id) {
+    throw ParquetException(std::string("direct put to ") + ArrowType::type_name() +
+                           " from " + values.type()->ToString() + " not supported");
+  }
+  const arrow::ArrayData& data = *values.data();
+  if (values.null_count() == 0) {
+    Put(data.GetValues<T>(1), static_cast<int>(data.length));
+  } else {
+    PutSpaced(data.GetValues<T>(1), static_cast<int>(data.length),
+              data.GetValues<uint8_t>(0, 0), data.offset);
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::PutSpaced(const T* src, int num_values,
+                                           const uint8_t* valid_bits,
+                                           int64_t valid_bits_offset) {
+  std::shared_ptr<ResizableBuffer> buffer;
+  PARQUET_THROW_NOT_OK(arrow::AllocateResizableBuffer(this->memory_pool(),
+                                                      num_values * sizeof(T), &buffer));
+  int32_t num_valid_values = 0;
+  arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                  num_values);
+  T* data = reinterpret_cast<T*>(buffer->mutable_data());
+  for (int32_t i = 0; i < num_values; i++) {
+    if (valid_bits_reader.IsSet()) {
+      data[num_valid_values++] = src[i];
+    }
+    valid_bits_reader.Next();
+  }
+  Put(data, num_valid_values);
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder implementation
+
+// The lengths of all values, DELTA_BINARY_PACKED encoded, followed by the
+// concatenated values
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + length_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> encoded_lengths = length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> data;
+    PARQUET_THROW_NOT_OK(sink_.Finish(&data));
+
+    std::shared_ptr<ResizableBuffer> output =
+        AllocateBuffer(this->memory_pool(), encoded_lengths->size() + data->size());
+    memcpy(output->mutable_data(), encoded_lengths->data(), encoded_lengths->size());
+    if (data->size() > 0) {
+      memcpy(output->mutable_data() + encoded_lengths->size(), data->data(),
+             data->size());
+    }
+    return std::move(output);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    if (num_values == 0) {
+      return;
+    }
+    std::vector<int32_t> lengths(num_values);
+    int64_t total_length = 0;
+    for (int i = 0; i < num_values; ++i) {
+      lengths[i] = static_cast<int32_t>(src[i].len);
+      total_length += src[i].len;
+    }
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_length));
+    for (int i = 0; i < num_values; ++i) {
+      sink_.UnsafeAppend(src[i].ptr, src[i].len);
+    }
+    length_encoder_.Put(lengths.data(), num_values);
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    std::vector<ByteArray> byte_arrays;
+    byte_arrays.reserve(data.length() - data.null_count());
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        auto view = data.GetView(i);
+        byte_arrays.emplace_back(static_cast<uint32_t>(view.size()),
+                                 reinterpret_cast<const uint8_t*>(view.data()));
+      }
+    }
+    Put(byte_arrays.data(), static_cast<int>(byte_arrays.size()));
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    std::vector<ByteArray> byte_arrays;
+    byte_arrays.reserve(num_values);
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    for (int i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        byte_arrays.push_back(src[i]);
+      }
+      valid_bits_reader.Next();
+    }
+    Put(byte_arrays.data(), static_cast<int>(byte_arrays.size()));
+  }
+
+ private:
+  arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+};
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder implementation
+
+// The length of the prefix each value shares with the previous one,
+// DELTA_BINARY_PACKED encoded, followed by the remaining suffixes,
+// DELTA_LENGTH_BYTE_ARRAY encoded
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    last_value_.clear();
+
+    std::shared_ptr<ResizableBuffer> output =
+        AllocateBuffer(this->memory_pool(), prefix_lengths->size() + suffixes->size());
+    memcpy(output->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    memcpy(output->mutable_data() + prefix_lengths->size(), suffixes->data(),
+           suffixes->size());
+    return std::move(output);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    if (num_values == 0) {
+      return;
+    }
+    std::vector<int32_t> prefix_lengths(num_values);
+    std::vector<ByteArray> suffixes(num_values);
+    const uint8_t* previous = reinterpret_cast<const uint8_t*>(last_value_.data());
+    uint32_t previous_len = static_cast<uint32_t>(last_value_.size());
+    for (int i = 0; i < num_values; ++i) {
+      const uint32_t max_prefix = std::min(previous_len, src[i].len);
+      uint32_t prefix = 0;
+      while (prefix < max_prefix && previous[prefix] == src[i].ptr[prefix]) {
+        ++prefix;
+      }
+      prefix_lengths[i] = static_cast<int32_t>(prefix);
+      suffixes[i] = ByteArray(src[i].len - prefix, src[i].ptr + prefix);
+      previous = src[i].ptr;
+      previous_len = src[i].len;
+    }
+    // The input may not outlive this call
+    last_value_.assign(reinterpret_cast<const char*>(previous), previous_len);
+    prefix_length_encoder_.Put(prefix_lengths.data(), num_values);
+    suffix_encoder_.Put(suffixes.data(), num_values);
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    std::vector<ByteArray> byte_arrays;
+    byte_arrays.reserve(data.length() - data.null_count());
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        auto view = data.GetView(i);
+        byte_arrays.emplace_back(static_cast<uint32_t>(view.size()),
+                                 reinterpret_cast<const uint8_t*>(view.data()));
+      }
+    }
+    Put(byte_arrays.data(), static_cast<int>(byte_arrays.size()));
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    std::vector<ByteArray> byte_arrays;
+    byte_arrays.reserve(num_values);
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    for (int i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        byte_arrays.push_back(src[i]);
+      }
+      valid_bits_reader.Next();
+    }
+    Put(byte_arrays.data(), static_cast<int>(byte_arrays.size()));
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
 // ----------------------------------------------------------------------
 // Encoder and decoder factory functions
 
@@ -974,6 +1371,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -1538,6 +1955,30 @@ class PlainFLBADecoder : public PlainDecoder<FLBAType>, virtual public FLBADecod
 // ----------------------------------------------------------------------
 // Dictionary encoding and decoding
 
+// Append dictionary indices to the Arrow dictionary builder matching the
+// Parquet physical type
+template <typename Type>
+void AppendDictionaryIndices(arrow::ArrayBuilder* builder, const int32_t* indices,
+                             int64_t length, const uint8_t* valid_bytes = NULLPTR) {
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+  PARQUET_THROW_NOT_OK(dict_builder->AppendIndices(indices, length, valid_bytes));
+}
+
+template <>
+void AppendDictionaryIndices<BooleanType>(arrow::ArrayBuilder* builder,
+                                          const int32_t* indices, int64_t length,
+                                          const uint8_t* valid_bytes) {
+  ParquetException::NYI("Dictionary encoding is not implemented for boolean values");
+}
+
+template <>
+void AppendDictionaryIndices<Int96Type>(arrow::ArrayBuilder* builder,
+                                        const int32_t* indices, int64_t length,
+                                        const uint8_t* valid_bytes) {
+  ParquetException::NYI("Reading INT96 to Arrow dictionary");
+}
+
 template <typename Type>
 class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
  public:
@@ -1626,9 +2067,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       bit_reader.Next();
     }
 
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendDictionaryIndices<Type>(builder, indices_buffer, num_values,
+                                  valid_bytes.data());
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1648,8 +2088,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendDictionaryIndices<Type>(builder, indices_buffer, num_values);
     num_values_ -= num_values;
     return num_values;
   }
@@ -1680,7 +2119,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   std::shared_ptr<ResizableBuffer> byte_array_offsets_;
 
   // Reusable buffer for decoding dictionary indices to be appended to a
-  // BinaryDictionary32Builder
+  // Dictionary32Builder
   std::shared_ptr<ResizableBuffer> indices_scratch_space_;
 
   arrow::util::RleDecoder idx_decoder_;
@@ -1903,7 +2342,34 @@ int DictDecoderImpl<Type>::DecodeArrow(
 
 template <typename Type>
 void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+  using ArrowType = typename EncodingTraits<Type>::ArrowType;
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+
+  // Make an Arrow array referencing the internal dictionary data
+  arrow::NumericArray<ArrowType> arr(dictionary_length_, dictionary_);
+  PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(arr));
+}
+
+template <>
+void DictDecoderImpl<BooleanType>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("Dictionary encoding is not implemented for boolean values");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("Reading INT96 to Arrow dictionary");
+}
+
+template <>
+void DictDecoderImpl<FLBAType>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  auto fixed_builder =
+      checked_cast<typename EncodingTraits<FLBAType>::DictAccumulator*>(builder);
+
+  // Make a FixedSizeBinaryArray referencing the internal dictionary data
+  arrow::FixedSizeBinaryArray arr(arrow::fixed_size_binary(descr_->type_length()),
+                                  dictionary_length_, byte_array_data_);
+  PARQUET_THROW_NOT_OK(fixed_builder->InsertMemoValues(arr));
 }
 
 template <>
@@ -2124,6 +2590,7 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  typedef typename std::make_unsigned<T>::type UT;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
@@ -2133,11 +2600,13 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
     }
   }
 
+  /// The number of values is taken from the header of the data rather than
+  /// from num_values, which also counts nulls
   void SetData(int num_values, const uint8_t* data, int len) override {
-    this->num_values_ = num_values;
+    data_ = data;
+    len_ = len;
     decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    InitHeader();
   }
 
   int Decode(T* buffer, int max_values) override {
@@ -2151,9 +2620,9 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
       ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
     }
     std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
+    values.resize(GetInternal(values.data(), num_values));
     PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    return static_cast<int>(values.size());
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
@@ -2163,63 +2632,132 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
       ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
     }
     std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
+    values.resize(GetInternal(values.data(), num_values));
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
     for (T value : values) {
       PARQUET_THROW_NOT_OK(out->Append(value));
     }
-    return num_values;
+    return static_cast<int>(values.size());
   }
 
+  /// \brief Size of the encoded data up to the end of the miniblock holding
+  /// the last value decoded so far
+  ///
+  /// Once all values are decoded, this is where the data following the
+  /// DELTA_BINARY_PACKED run starts.
+  int bytes_consumed() const { return std::min(mini_block_end_, len_); }
+
  private:
-  void InitBlock() {
-    int32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  int bytes_read() { return len_ - decoder_.bytes_left(); }
+
+  void InitHeader() {
+    uint64_t block_size, num_mini_blocks, total_value_count;
+    int64_t first_value;
+    if (!decoder_.GetVlqInt(&block_size) || !decoder_.GetVlqInt(&num_mini_blocks) ||
+        !decoder_.GetVlqInt(&total_value_count) ||
+        !decoder_.GetZigZagVlqInt(&first_value)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
-
+    if (block_size == 0 || block_size % 128 != 0) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED block size: " +
+                             std::to_string(block_size));
+    }
+    if (num_mini_blocks == 0 || block_size % num_mini_blocks != 0 ||
+        (block_size / num_mini_blocks) % 32 != 0) {
+      throw ParquetException("Invalid number of DELTA_BINARY_PACKED miniblocks: " +
+                             std::to_string(num_mini_blocks));
+    }
+    if (total_value_count > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+      throw ParquetException("Too many values in DELTA_BINARY_PACKED data");
+    }
+    num_mini_blocks_ = static_cast<int>(num_mini_blocks);
+    values_per_mini_block_ = static_cast<int>(block_size / num_mini_blocks);
+    num_values_ = static_cast<int>(total_value_count);
+    last_value_ = static_cast<UT>(first_value);
+    first_value_pending_ = num_values_ > 0;
+    block_initialized_ = false;
+    values_remaining_mini_block_ = 0;
     delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    mini_block_end_ = bytes_read();
+  }
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
+  void InitBlock() {
+    int64_t min_delta;
+    if (!decoder_.GetZigZagVlqInt(&min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<UT>(min_delta);
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
     for (int i = 0; i < num_mini_blocks_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
+    block_initialized_ = true;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
-    values_current_mini_block_ = values_per_mini_block_;
+    InitMiniBlock();
+  }
+
+  void InitMiniBlock() {
+    // Bit widths of the miniblocks past the last value are arbitrary, so they
+    // are only checked once needed
+    const int bit_width = delta_bit_widths_->data()[mini_block_idx_];
+    if (ARROW_PREDICT_FALSE(bit_width > static_cast<int>(sizeof(T) * 8))) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED bit width: " +
+                             std::to_string(bit_width));
+    }
+    delta_bit_width_ = bit_width;
+    values_remaining_mini_block_ = values_per_mini_block_;
+    // Miniblocks hold a multiple of 32 values, so they end on a byte boundary
+    mini_block_end_ = bytes_read() + values_per_mini_block_ / 8 * bit_width;
+  }
+
+  // Unpack the next num_values deltas of the current miniblock as unsigned
+  // integers
+  void UnpackDeltas(UT* out, int num_values) {
+    if (delta_bit_width_ <= 32) {
+      if (decoder_.GetBatch(delta_bit_width_, out, num_values) != num_values) {
+        ParquetException::EofException();
+      }
+      return;
+    }
+    // BitReader handles at most 32 bits at a time: read the low and high
+    // halves of each delta in turn
+    for (int i = 0; i < num_values; ++i) {
+      uint64_t low, high;
+      if (!decoder_.GetValue(32, &low) ||
+          !decoder_.GetValue(delta_bit_width_ - 32, &high)) {
+        ParquetException::EofException();
+      }
+      out[i] = static_cast<UT>(low | (high << 32));
+    }
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
     max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
-      if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
+    int i = 0;
+    if (max_values > 0 && first_value_pending_) {
+      buffer[i++] = static_cast<T>(last_value_);
+      first_value_pending_ = false;
+    }
+    while (i < max_values) {
+      if (values_remaining_mini_block_ == 0) {
+        if (block_initialized_ && mini_block_idx_ + 1 < num_mini_blocks_) {
+          ++mini_block_idx_;
+          InitMiniBlock();
         } else {
           InitBlock();
-          buffer[i] = last_value_;
-          continue;
         }
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      // Whole runs of a miniblock are unpacked at once before being summed up
+      const int batch_size = std::min(max_values - i, values_remaining_mini_block_);
+      UT* out = reinterpret_cast<UT*>(buffer + i);
+      UnpackDeltas(out, batch_size);
+      for (int j = 0; j < batch_size; ++j) {
+        // Modular arithmetic, matching the encoder
+        last_value_ += min_delta_ + out[j];
+        out[j] = last_value_;
+      }
+      values_remaining_mini_block_ -= batch_size;
+      i += batch_size;
     }
     this->num_values_ -= max_values;
     return max_values;
@@ -2227,19 +2765,78 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  int32_t values_current_block_;
-  int32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  int num_mini_blocks_ = 0;
+  int values_per_mini_block_ = 0;
+  int values_remaining_mini_block_ = 0;
+  int mini_block_idx_ = 0;
+  int mini_block_end_ = 0;
+  bool block_initialized_ = false;
+  bool first_value_pending_ = false;
+
+  UT min_delta_ = 0;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
+  int delta_bit_width_ = 0;
 
-  int32_t last_value_;
+  UT last_value_ = 0;
 };
 
+// Decode num_values - null_count byte arrays with decoder->Decode() and
+// append them, interleaved with nulls, to a binary accumulator
+int DecodeByteArraysToArrow(TypedDecoder<ByteArrayType>* decoder, int num_values,
+                            int null_count, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset,
+                            typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int num_decoded = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(num_decoded != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+  int value_index = 0;
+  for (int i = 0; i < num_values; ++i) {
+    if (null_count == 0 || bit_reader.IsSet()) {
+      const ByteArray& value = values[value_index++];
+      const int32_t length = static_cast<int32_t>(value.len);
+      if (ARROW_PREDICT_FALSE(!helper.CanFit(length))) {
+        // This element would exceed the capacity of a chunk
+        PARQUET_THROW_NOT_OK(helper.PushChunk());
+        PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values - i));
+      }
+      PARQUET_THROW_NOT_OK(helper.Append(value.ptr, length));
+    } else {
+      helper.UnsafeAppendNull();
+    }
+    bit_reader.Next();
+  }
+  return num_decoded;
+}
+
+int DecodeByteArraysToArrow(
+    TypedDecoder<ByteArrayType>* decoder, int num_values, int null_count,
+    const uint8_t* valid_bits, int64_t valid_bits_offset,
+    typename EncodingTraits<ByteArrayType>::DictAccumulator* builder) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int num_decoded = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(num_decoded != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+  PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+  arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+  int value_index = 0;
+  for (int i = 0; i < num_values; ++i) {
+    if (null_count == 0 || bit_reader.IsSet()) {
+      const ByteArray& value = values[value_index++];
+      PARQUET_THROW_NOT_OK(builder->Append(value.ptr, static_cast<int32_t>(value.len)));
+    } else {
+      PARQUET_THROW_NOT_OK(builder->AppendNull());
+    }
+    bit_reader.Next();
+  }
+  return num_decoded;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
@@ -2250,29 +2847,40 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        buffered_length_(AllocateBuffer(pool, 0)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
-    num_values_ = num_values;
+    num_values_ = 0;
+    length_idx_ = 0;
     if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // All lengths are decoded up front to find where the values start
+    len_decoder_.SetData(num_values, data, len);
+    const int num_lengths = len_decoder_.values_left();
+    PARQUET_THROW_NOT_OK(buffered_length_->Resize(num_lengths * sizeof(int32_t)));
+    int32_t* lengths = reinterpret_cast<int32_t*>(buffered_length_->mutable_data());
+    if (len_decoder_.Decode(lengths, num_lengths) != num_lengths) {
+      ParquetException::EofException();
+    }
+    const int lengths_size = len_decoder_.bytes_consumed();
+    num_values_ = num_lengths;
+    data_ = data + lengths_size;
+    len_ = len - lengths_size;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
     max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    const int32_t* lengths =
+        reinterpret_cast<const int32_t*>(buffered_length_->data()) + length_idx_;
     for (int i = 0; i < max_values; ++i) {
+      if (ARROW_PREDICT_FALSE(lengths[i] < 0 || lengths[i] > len_)) {
+        throw ParquetException("Invalid DELTA_LENGTH_BYTE_ARRAY value length");
+      }
       buffer[i].len = lengths[i];
       buffer[i].ptr = data_;
       this->data_ += lengths[i];
       this->len_ -= lengths[i];
     }
+    length_idx_ += max_values;
     this->num_values_ -= max_values;
     return max_values;
   }
@@ -2280,18 +2888,21 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysToArrow(this, num_values, null_count, valid_bits,
+                                   valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysToArrow(this, num_values, null_count, valid_bits,
+                                   valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  std::shared_ptr<ResizableBuffer> buffered_length_;
+  int length_idx_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2305,46 +2916,102 @@ class DeltaByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        buffered_prefix_length_(AllocateBuffer(pool, 0)),
+        buffered_data_(AllocateBuffer(pool, 0)) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    num_values_ = 0;
+    prefix_len_idx_ = 0;
+    last_value_.clear();
     if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
+    // All prefix lengths are decoded up front to find where the suffixes start
+    prefix_len_decoder_.SetData(num_values, data, len);
+    const int num_prefixes = prefix_len_decoder_.values_left();
+    PARQUET_THROW_NOT_OK(
+        buffered_prefix_length_->Resize(num_prefixes * sizeof(int32_t)));
+    int32_t* prefix_lengths =
+        reinterpret_cast<int32_t*>(buffered_prefix_length_->mutable_data());
+    if (prefix_len_decoder_.Decode(prefix_lengths, num_prefixes) != num_prefixes) {
+      ParquetException::EofException();
+    }
+    const int prefix_lengths_size = prefix_len_decoder_.bytes_consumed();
+    suffix_decoder_.SetData(num_prefixes, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+    if (suffix_decoder_.values_left() != num_prefixes) {
+      throw ParquetException("DELTA_BYTE_ARRAY has mismatched prefix and suffix counts");
+    }
+    num_values_ = num_prefixes;
+  }
+
+  /// The values remain valid until the next call to Decode or SetData
+  int Decode(ByteArray* buffer, int max_values) override {
     max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+    if (max_values == 0) return 0;
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+    const int32_t* prefix_lengths =
+        reinterpret_cast<const int32_t*>(buffered_prefix_length_->data()) +
+        prefix_len_idx_;
+    int64_t data_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      if (ARROW_PREDICT_FALSE(prefix_lengths[i] < 0)) {
+        throw ParquetException("Invalid DELTA_BYTE_ARRAY prefix length");
+      }
+      data_size += prefix_lengths[i] + buffer[i].len;
+    }
+    PARQUET_THROW_NOT_OK(buffered_data_->Resize(data_size, /*shrink_to_fit=*/false));
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+    // Each value is its predecessor's prefix followed by its suffix
+    uint8_t* out = buffered_data_->mutable_data();
+    const uint8_t* previous = reinterpret_cast<const uint8_t*>(last_value_.data());
+    uint32_t previous_len = static_cast<uint32_t>(last_value_.size());
+    for (int i = 0; i < max_values; ++i) {
+      const uint32_t prefix_len = static_cast<uint32_t>(prefix_lengths[i]);
+      if (ARROW_PREDICT_FALSE(prefix_len > previous_len)) {
+        throw ParquetException("DELTA_BYTE_ARRAY prefix is longer than previous value");
+      }
+      if (prefix_len > 0) {
+        memcpy(out, previous, prefix_len);
+      }
+      if (buffer[i].len > 0) {
+        memcpy(out + prefix_len, buffer[i].ptr, buffer[i].len);
+      }
+      buffer[i].len += prefix_len;
+      buffer[i].ptr = out;
+      previous = out;
+      previous_len = buffer[i].len;
+      out += buffer[i].len;
     }
+    last_value_.assign(reinterpret_cast<const char*>(previous), previous_len);
+
+    prefix_len_idx_ += max_values;
     this->num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeByteArraysToArrow(this, num_values, null_count, valid_bits,
+                                   valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeByteArraysToArrow(this, num_values, null_count, valid_bits,
+                                   valid_bits_offset, out);
+  }
+
  private:
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  std::shared_ptr<ResizableBuffer> buffered_prefix_length_;
+  std::shared_ptr<ResizableBuffer> buffered_data_;
+  int prefix_len_idx_ = 0;
+  std::string last_value_;
 };
 
 // ----------------------------------------------------------------------
@@ -2385,17 +3052,10 @@ void ByteStreamSplitDecoder<DType>::SetData(int num_values, const uint8_t* data,
 
 template <typename DType>
 int ByteStreamSplitDecoder<DType>::Decode(T* buffer, int max_values) {
-  constexpr size_t num_streams = sizeof(T);
   const int values_to_decode = std::min(num_values_, max_values);
   const int num_decoded_previously = num_values_in_buffer - num_values_;
-  for (int i = 0; i < values_to_decode; ++i) {
-    uint8_t gathered_byte_data[num_streams];
-    for (size_t b = 0; b < num_streams; ++b) {
-      const size_t byte_index = b * num_values_in_buffer + num_decoded_previously + i;
-      gathered_byte_data[b] = data_[byte_index];
-    }
-    buffer[i] = arrow::util::SafeLoadAs<T>(&gathered_byte_data[0]);
-  }
+  ::arrow::util::internal::ByteStreamSplitDecode<T>(
+      data_ + num_decoded_previously, values_to_decode, num_values_in_buffer, buffer);
   num_values_ -= values_to_decode;
   len_ -= sizeof(T) * values_to_decode;
   return values_to_decode;
@@ -2450,6 +3110,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
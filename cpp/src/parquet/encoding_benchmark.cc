@@ -24,6 +24,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
+#include "arrow/util/byte_stream_split.h"
 
 #include "parquet/encoding.h"
 #include "parquet/platform.h"
@@ -198,6 +199,120 @@ static void BM_PlainDecodingFloat(benchmark::State& state) {
 
 BENCHMARK(BM_PlainDecodingFloat)->Range(MIN_RANGE, MAX_RANGE);
 
+template <typename DType>
+static void BM_ByteStreamSplitEncode(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values(state.range(0), static_cast<T>(64.0));
+  auto encoder = MakeTypedEncoder<DType>(Encoding::BYTE_STREAM_SPLIT);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename DType>
+static void BM_ByteStreamSplitDecode(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values(state.range(0), static_cast<T>(64.0));
+  auto encoder = MakeTypedEncoder<DType>(Encoding::BYTE_STREAM_SPLIT);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode, FloatType)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode, DoubleType)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode, FloatType)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode, DoubleType)->Range(MIN_RANGE, MAX_RANGE);
+
+// Baselines for the kernels used by the encoder and decoder above
+template <typename T>
+static void BM_ByteStreamSplitEncodeScalar(benchmark::State& state) {
+  std::vector<T> values(state.range(0), static_cast<T>(64.0));
+  std::vector<uint8_t> output(values.size() * sizeof(T));
+  for (auto _ : state) {
+    ::arrow::util::internal::ByteStreamSplitEncodeScalar<T>(
+        reinterpret_cast<const uint8_t*>(values.data()),
+        static_cast<int64_t>(values.size()), output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename T>
+static void BM_ByteStreamSplitDecodeScalar(benchmark::State& state) {
+  std::vector<uint8_t> input(state.range(0) * sizeof(T), 0x40);
+  std::vector<T> values(state.range(0));
+  for (auto _ : state) {
+    ::arrow::util::internal::ByteStreamSplitDecodeScalar<T>(
+        input.data(), state.range(0), state.range(0), values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncodeScalar, float)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncodeScalar, double)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecodeScalar, float)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecodeScalar, double)->Range(MIN_RANGE, MAX_RANGE);
+
+// Monotonic values with small gaps, as in timestamp or ID columns
+template <typename DType>
+static std::vector<typename DType::c_type> MakeSortedValues(int64_t num_values) {
+  using T = typename DType::c_type;
+  std::vector<T> values(num_values);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> gap(0, 100);
+  T current = 1000000;
+  for (auto& value : values) {
+    current += static_cast<T>(gap(gen));
+    value = current;
+  }
+  return values;
+}
+
+template <typename DType>
+static void BM_DeltaBitPackEncode(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values = MakeSortedValues<DType>(state.range(0));
+  auto encoder = MakeTypedEncoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename DType>
+static void BM_DeltaBitPackDecode(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values = MakeSortedValues<DType>(state.range(0));
+  auto encoder = MakeTypedEncoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_DeltaBitPackEncode, Int32Type)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_DeltaBitPackEncode, Int64Type)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_DeltaBitPackDecode, Int32Type)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_DeltaBitPackDecode, Int64Type)->Range(MIN_RANGE, MAX_RANGE);
+
 template <typename Type>
 static void DecodeDict(std::vector<typename Type::c_type>& values,
                        benchmark::State& state) {
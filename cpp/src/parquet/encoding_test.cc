@@ -16,10 +16,12 @@
 // under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -910,6 +912,18 @@ void TestEncodeDecodeWithBigInput() {
   TestByteStreamSplitRoundTrip<DType>(data.data(), nvalues);
 }
 
+// Exercise both the vectorized blocks and the remaining values
+TEST(ByteStreamSplitEncodeDecode, RoundTripSizes) {
+  for (int n : {2, 15, 16, 17, 31, 32, 33, 100, 1025}) {
+    std::vector<float> floats(n);
+    GenerateData<float>(n, floats.data(), nullptr);
+    ASSERT_NO_FATAL_FAILURE(TestByteStreamSplitRoundTrip<FloatType>(floats.data(), n));
+    std::vector<double> doubles(n);
+    GenerateData<double>(n, doubles.data(), nullptr);
+    ASSERT_NO_FATAL_FAILURE(TestByteStreamSplitRoundTrip<DoubleType>(doubles.data(), n));
+  }
+}
+
 // Check that the encoder can handle input with one element.
 TEST(ByteStreamSplitEncodeDecode, EncodeOneLenInput) {
   const float value = 1.0f;
@@ -1049,5 +1063,191 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY tests
+
+template <typename Type>
+void TestDeltaRoundTrip(Encoding::type encoding,
+                        const std::vector<typename Type::c_type>& values,
+                        int batch_size) {
+  using T = typename Type::c_type;
+  auto encoder = MakeTypedEncoder<Type>(encoding);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buffer = encoder->FlushValues();
+
+  const int num_values = static_cast<int>(values.size());
+  auto decoder = MakeTypedDecoder<Type>(encoding);
+  decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+  // Decoded byte arrays may only be valid until the next call to Decode, so
+  // each batch is checked right away
+  std::vector<T> decoded(batch_size);
+  int num_decoded = 0;
+  while (num_decoded < num_values) {
+    int n = decoder->Decode(decoded.data(), batch_size);
+    ASSERT_GT(n, 0);
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(values[num_decoded + i], decoded[i]) << num_decoded + i;
+    }
+    num_decoded += n;
+  }
+  ASSERT_EQ(num_values, num_decoded);
+  ASSERT_EQ(0, decoder->Decode(decoded.data(), batch_size));
+}
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public ::testing::Test {
+ public:
+  using T = typename Type::c_type;
+
+  void CheckRoundTrip(const std::vector<T>& values) {
+    for (int batch_size : {1, 7, 32, 100, 1000}) {
+      TestDeltaRoundTrip<Type>(Encoding::DELTA_BINARY_PACKED, values, batch_size);
+    }
+  }
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+
+TYPED_TEST_CASE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, Random) {
+  using T = typename TypeParam::c_type;
+  // Sizes around the miniblock (32) and block (128) boundaries
+  for (int size : {0, 1, 2, 31, 32, 33, 127, 128, 129, 1000}) {
+    std::vector<T> values(size);
+    GenerateData<T>(size, values.data(), nullptr);
+    this->CheckRoundTrip(values);
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, Sorted) {
+  using T = typename TypeParam::c_type;
+  std::vector<T> values(1000);
+  GenerateData<T>(1000, values.data(), nullptr);
+  std::sort(values.begin(), values.end());
+  this->CheckRoundTrip(values);
+
+  std::vector<T> constant(300, 42);
+  this->CheckRoundTrip(constant);
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, Extremes) {
+  using T = typename TypeParam::c_type;
+  // Deltas between these values overflow T
+  std::vector<T> values;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back(std::numeric_limits<T>::min());
+    values.push_back(std::numeric_limits<T>::max());
+    values.push_back(0);
+  }
+  this->CheckRoundTrip(values);
+}
+
+TEST(DeltaBitPackEncoding, SpecExample) {
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buffer = encoder->FlushValues();
+  // Header: block size 128, 4 miniblocks, 5 values, first value 1, then a
+  // block with min delta 1 and all bit widths 0
+  std::vector<uint8_t> expected = {0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0, 0, 0, 0};
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), buffer->size());
+  ASSERT_EQ(0, memcmp(expected.data(), buffer->data(), expected.size()));
+}
+
+class TestDeltaByteArrayEncoding : public ::testing::TestWithParam<Encoding::type> {};
+
+TEST_P(TestDeltaByteArrayEncoding, RoundTrip) {
+  for (int size : {0, 1, 33, 129, 1000}) {
+    std::vector<ByteArray> values(size);
+    std::vector<uint8_t> heap;
+    GenerateData<ByteArray>(size, values.data(), &heap);
+    for (int batch_size : {1, 17, 1000}) {
+      TestDeltaRoundTrip<ByteArrayType>(GetParam(), values, batch_size);
+    }
+  }
+}
+
+TEST_P(TestDeltaByteArrayEncoding, SharedPrefixes) {
+  std::vector<std::string> strings = {"",      "a",         "apple",  "application",
+                                      "apply", "banana",    "band",   "band",
+                                      "",      "bandwidth", "z",      "zzzzzz"};
+  std::vector<ByteArray> values;
+  for (const auto& s : strings) {
+    values.emplace_back(static_cast<uint32_t>(s.size()),
+                        reinterpret_cast<const uint8_t*>(s.data()));
+  }
+  TestDeltaRoundTrip<ByteArrayType>(GetParam(), values, 5);
+}
+
+TEST_P(TestDeltaByteArrayEncoding, ArrowBinaryDirectPut) {
+  arrow::random::RandomArrayGenerator rag(0);
+  auto values = rag.String(500, 0, 20, 0.25);
+
+  auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam());
+  ASSERT_NO_THROW(encoder->Put(*values));
+  auto buf = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam());
+  int num_values = static_cast<int>(values->length() - values->null_count());
+  decoder->SetData(num_values, buf->data(), static_cast<int>(buf->size()));
+
+  typename EncodingTraits<ByteArrayType>::Accumulator acc;
+  acc.builder.reset(new arrow::StringBuilder);
+  ASSERT_EQ(num_values,
+            decoder->DecodeArrow(static_cast<int>(values->length()),
+                                 static_cast<int>(values->null_count()),
+                                 values->null_bitmap_data(), values->offset(), &acc));
+  std::shared_ptr<::arrow::Array> result;
+  ASSERT_OK(acc.builder->Finish(&result));
+  arrow::AssertArraysEqual(*values, *result);
+}
+
+INSTANTIATE_TEST_CASE_P(DeltaByteArrayEncodings, TestDeltaByteArrayEncoding,
+                        ::testing::Values(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                          Encoding::DELTA_BYTE_ARRAY));
+
+class DeltaByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    ASSERT_NO_THROW(encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_ - null_count_, buffer_->data(),
+                      static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST(DeltaEncoding, InvalidDataTypes) {
+  ASSERT_THROW(MakeTypedEncoder<BooleanType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<FLBAType>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+
+  ASSERT_THROW(MakeTypedDecoder<BooleanType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<Int64Type>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+}
+
 }  // namespace test
 }  // namespace parquet
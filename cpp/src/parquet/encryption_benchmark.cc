@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/memory.h"
+
+#include "parquet/column_reader.h"
+#include "parquet/column_writer.h"
+#include "parquet/encryption.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+#include "parquet/schema.h"
+
+namespace parquet {
+
+using schema::GroupNode;
+using schema::NodeVector;
+using schema::PrimitiveNode;
+
+namespace benchmark {
+
+constexpr int kNumColumns = 8;
+constexpr int64_t kNumRows = 1 << 18;
+const char kFooterKey[] = "0123456789012345";
+
+std::string ColumnName(int i) { return "c" + std::to_string(i); }
+
+// Each column is encrypted with a key of its own
+std::string ColumnKey(int i) {
+  std::string key = "1234567890123450";
+  key[15] = static_cast<char>('a' + i);
+  return key;
+}
+
+std::shared_ptr<GroupNode> Int64Schema() {
+  NodeVector fields;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(
+        PrimitiveNode::Make(ColumnName(i), Repetition::REQUIRED, Type::INT64));
+  }
+  return std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+}
+
+std::shared_ptr<FileEncryptionProperties> EncryptionProperties(
+    ParquetCipher::type cipher) {
+  std::map<std::string, std::shared_ptr<ColumnEncryptionProperties>> columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    ColumnEncryptionProperties::Builder builder(ColumnName(i));
+    columns[ColumnName(i)] = builder.key(ColumnKey(i))->build();
+  }
+  FileEncryptionProperties::Builder builder(kFooterKey);
+  return builder.algorithm(cipher)->encrypted_columns(columns)->build();
+}
+
+std::shared_ptr<FileDecryptionProperties> DecryptionProperties() {
+  ColumnPathToDecryptionPropertiesMap columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    ColumnDecryptionProperties::Builder builder(ColumnName(i));
+    columns[ColumnName(i)] = builder.key(ColumnKey(i))->build();
+  }
+  FileDecryptionProperties::Builder builder;
+  return builder.footer_key(kFooterKey)->column_keys(columns)->build();
+}
+
+std::shared_ptr<Buffer> WriteInt64File(int64_t page_size, bool encrypted,
+                                       ParquetCipher::type cipher) {
+  WriterProperties::Builder builder;
+  builder.disable_dictionary()->encoding(Encoding::PLAIN)->data_pagesize(page_size);
+  if (encrypted) {
+    builder.encryption(EncryptionProperties(cipher));
+  }
+
+  std::vector<int64_t> values(kNumRows);
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    values[i] = i * 7919;
+  }
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, Int64Schema(), builder.build());
+  RowGroupWriter* row_group_writer = file_writer->AppendRowGroup();
+  for (int i = 0; i < kNumColumns; ++i) {
+    auto column_writer = static_cast<Int64Writer*>(row_group_writer->NextColumn());
+    column_writer->WriteBatch(kNumRows, nullptr, nullptr, values.data());
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+// Read all the columns of a file written with pages of state.range(0) bytes
+template <bool encrypted, ParquetCipher::type cipher = ParquetCipher::AES_GCM_V1>
+static void BM_ReadInt64File(::benchmark::State& state) {
+  std::shared_ptr<Buffer> buffer = WriteInt64File(state.range(0), encrypted, cipher);
+  std::vector<int64_t> values_out(kNumRows);
+
+  for (auto _ : state) {
+    // Decryption properties are consumed by the reader, which wipes out the keys
+    ReaderProperties properties = default_reader_properties();
+    if (encrypted) {
+      properties.file_decryption_properties(DecryptionProperties());
+    }
+    auto file_reader = ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer), properties);
+    auto row_group_reader = file_reader->RowGroup(0);
+    for (int i = 0; i < kNumColumns; ++i) {
+      auto column_reader =
+          std::static_pointer_cast<Int64Reader>(row_group_reader->Column(i));
+      int64_t values_read = 0;
+      while (column_reader->HasNext()) {
+        column_reader->ReadBatch(kNumRows, nullptr, nullptr, values_out.data(),
+                                 &values_read);
+      }
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kNumColumns * kNumRows * sizeof(int64_t));
+}
+
+BENCHMARK_TEMPLATE(BM_ReadInt64File, false)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ReadInt64File, true, ParquetCipher::AES_GCM_V1)
+    ->Arg(4 << 10)
+    ->Arg(64 << 10)
+    ->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ReadInt64File, true, ParquetCipher::AES_GCM_CTR_V1)
+    ->Arg(4 << 10)
+    ->Arg(64 << 10)
+    ->Arg(1 << 20);
+
+}  // namespace benchmark
+
+}  // namespace parquet
@@ -321,6 +321,8 @@ class AesDecryptor::AesDecryptorImpl {
       EVP_CIPHER_CTX_free(ctx_);
       ctx_ = nullptr;
     }
+    std::fill(scheduled_key_.begin(), scheduled_key_.end(), '\0');
+    scheduled_key_.clear();
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
@@ -330,6 +332,12 @@ class AesDecryptor::AesDecryptorImpl {
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
+  // The key last expanded into ctx_.  Modules decrypted with the same key
+  // only set a new IV, skipping the AES key schedule (and GHASH table setup).
+  std::string scheduled_key_;
+
+  void SetKeyAndIv(const uint8_t* key, int key_len, const uint8_t* iv);
+
   int GcmDecrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
                  int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
 
@@ -427,6 +435,24 @@ AesDecryptor* AesDecryptor::Make(ParquetCipher::type alg_id, int key_len, bool m
 
 int AesDecryptor::CiphertextSizeDelta() { return impl_->ciphertext_size_delta(); }
 
+void AesDecryptor::AesDecryptorImpl::SetKeyAndIv(const uint8_t* key, int key_len,
+                                                 const uint8_t* iv) {
+  if (nullptr == ctx_) {
+    throw ParquetException("Decryptor was wiped out");
+  }
+  if (static_cast<int>(scheduled_key_.size()) == key_len &&
+      0 == memcmp(scheduled_key_.data(), key, key_len)) {
+    key = nullptr;
+  }
+  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
+    scheduled_key_.clear();
+    throw ParquetException("Couldn't set key and IV");
+  }
+  if (nullptr != key) {
+    scheduled_key_.assign(reinterpret_cast<const char*>(key), key_len);
+  }
+}
+
 int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
                                                int ciphertext_len, const uint8_t* key,
                                                int key_len, const uint8_t* aad,
@@ -457,9 +483,7 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
             tag);
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  SetKeyAndIv(key, key_len, nonce);
 
   // Setting additional authenticated data
   if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
@@ -519,9 +543,7 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  SetKeyAndIv(key, key_len, iv);
 
   // Decryption
   if (!EVP_DecryptUpdate(ctx_, plaintext, &len,
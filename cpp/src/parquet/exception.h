@@ -33,18 +33,18 @@
 
 // Parquet exception to Arrow Status
 
-#define PARQUET_CATCH_NOT_OK(s)                    \
-  try {                                            \
-    (s);                                           \
-  } catch (const ::parquet::ParquetException& e) { \
-    return ::arrow::Status::IOError(e.what());     \
+#define PARQUET_CATCH_NOT_OK(s)                       \
+  try {                                               \
+    (s);                                              \
+  } catch (const ::parquet::ParquetException& e) {    \
+    return ::parquet::internal::ExceptionToStatus(e); \
   }
 
-#define PARQUET_CATCH_AND_RETURN(s)                \
-  try {                                            \
-    return (s);                                    \
-  } catch (const ::parquet::ParquetException& e) { \
-    return ::arrow::Status::IOError(e.what());     \
+#define PARQUET_CATCH_AND_RETURN(s)                   \
+  try {                                               \
+    return (s);                                       \
+  } catch (const ::parquet::ParquetException& e) {    \
+    return ::parquet::internal::ExceptionToStatus(e); \
   }
 
 // Arrow Status to Parquet exception
@@ -124,6 +124,21 @@ class ParquetInvalidOrCorruptedFileException : public ParquetStatusException {
       : ParquetStatusException(::arrow::Status::Invalid(std::forward<Args>(args)...)) {}
 };
 
+namespace internal {
+
+// Convert a caught exception to a Status.  Allocation failures keep their
+// status code so that callers can react to memory pressure, other errors
+// are reported as IOError.
+inline ::arrow::Status ExceptionToStatus(const ParquetException& e) {
+  auto status_exception = dynamic_cast<const ParquetStatusException*>(&e);
+  if (status_exception != NULLPTR && status_exception->status().IsOutOfMemory()) {
+    return status_exception->status();
+  }
+  return ::arrow::Status::IOError(e.what());
+}
+
+}  // namespace internal
+
 template <typename StatusReturnBlock>
 void ThrowNotOk(StatusReturnBlock&& b) {
   PARQUET_THROW_NOT_OK(b());
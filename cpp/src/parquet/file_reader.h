@@ -23,7 +23,9 @@
 #include <string>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/metadata.h"  // IWYU pragma: keep
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
@@ -45,6 +47,9 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i) { return NULLPTR; }
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) { return NULLPTR; }
+    virtual std::unique_ptr<BloomFilter> GetBloomFilter(int i) { return NULLPTR; }
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,6 +63,18 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Read the ColumnIndex of the indicated column, or return nullptr if none was
+  // written for it
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+
+  // Read the OffsetIndex of the indicated column, or return nullptr if none was
+  // written for it
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  // Read the Bloom filter of the indicated column, or return nullptr if none was
+  // written for it
+  std::unique_ptr<BloomFilter> GetBloomFilter(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -118,6 +135,17 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// Pre-buffer the specified column indices in all row groups.
+  ///
+  /// Only has an effect if the file was opened with the default Contents
+  /// implementation. The byte ranges of the selected column chunks are
+  /// coalesced according to the given options and fetched concurrently in the
+  /// background; subsequent column reads are served from memory. Calling
+  /// PreBuffer again replaces the previously buffered column chunks.
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const ::arrow::io::CacheOptions& options);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
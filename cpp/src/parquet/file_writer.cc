@@ -18,16 +18,19 @@
 #include "parquet/file_writer.h"
 
 #include <cstddef>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/deprecated_io.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -83,7 +86,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   RowGroupSerializer(std::shared_ptr<ArrowOutputStream> sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     PageIndexBuilder* page_index_builder = nullptr,
+                     BloomFilterBuilder* bloom_filter_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -93,7 +98,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        page_index_builder_(page_index_builder),
+        bloom_filter_builder_(bloom_filter_builder) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -128,6 +135,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
 
     ++next_column_index_;
 
+    const int column_ordinal = next_column_index_ - 1;
     const auto& path = col_meta->descr()->path();
     auto meta_encryptor =
         file_encryptor_ ? file_encryptor_->GetColumnMetaEncryptor(path->ToDotString())
@@ -137,9 +145,11 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
                         : nullptr;
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
-        col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
-        properties_->memory_pool(), false, meta_encryptor, data_encryptor);
-    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+        col_meta, row_group_ordinal_, static_cast<int16_t>(column_ordinal),
+        properties_->memory_pool(), false, meta_encryptor, data_encryptor,
+        GetColumnIndexBuilder(column_ordinal), GetOffsetIndexBuilder(column_ordinal));
+    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_,
+                                            GetBloomFilter(column_ordinal));
     return column_writers_[0].get();
   }
 
@@ -208,6 +218,20 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  PageIndexBuilder* page_index_builder_;
+  BloomFilterBuilder* bloom_filter_builder_;
+
+  ColumnIndexBuilder* GetColumnIndexBuilder(int i) const {
+    return page_index_builder_ ? page_index_builder_->GetColumnIndexBuilder(i) : nullptr;
+  }
+
+  OffsetIndexBuilder* GetOffsetIndexBuilder(int i) const {
+    return page_index_builder_ ? page_index_builder_->GetOffsetIndexBuilder(i) : nullptr;
+  }
+
+  BloomFilter* GetBloomFilter(int i) const {
+    return bloom_filter_builder_ ? bloom_filter_builder_->GetBloomFilter(i) : nullptr;
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -234,6 +258,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   void InitColumns() {
     for (int i = 0; i < num_columns(); i++) {
       auto col_meta = metadata_->NextColumnChunk();
+      const int column_ordinal = next_column_index_++;
       const auto& path = col_meta->descr()->path();
       auto meta_encryptor =
           file_encryptor_ ? file_encryptor_->GetColumnMetaEncryptor(path->ToDotString())
@@ -244,10 +269,12 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       std::unique_ptr<PageWriter> pager = PageWriter::Open(
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
-          static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
+          static_cast<int16_t>(column_ordinal), properties_->memory_pool(),
+          buffered_row_group_, meta_encryptor, data_encryptor,
+          GetColumnIndexBuilder(column_ordinal), GetOffsetIndexBuilder(column_ordinal));
       column_writers_.push_back(
-          ColumnWriter::Make(col_meta, std::move(pager), properties_));
+          ColumnWriter::Make(col_meta, std::move(pager), properties_,
+                             GetBloomFilter(column_ordinal)));
     }
   }
 
@@ -284,6 +311,19 @@ class FileSerializer : public ParquetFileWriter::Contents {
       }
       row_group_writer_.reset();
 
+      // Bloom filters and page indexes go after the row groups, ahead of the
+      // footer
+      if (bloom_filter_builder_) {
+        BloomFilterLocation location;
+        bloom_filter_builder_->WriteTo(sink_.get(), &location);
+        metadata_->SetBloomFilterLocation(location);
+      }
+      if (page_index_builder_) {
+        PageIndexLocation location;
+        page_index_builder_->WriteTo(sink_.get(), &location);
+        metadata_->SetPageIndexLocation(location);
+      }
+
       // Write magic bytes and metadata
       auto file_encryption_properties = properties_->file_encryption_properties();
 
@@ -312,9 +352,16 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
     num_row_groups_++;
     auto rg_metadata = metadata_->AppendRowGroup();
+    if (page_index_builder_) {
+      page_index_builder_->AppendRowGroup();
+    }
+    if (bloom_filter_builder_) {
+      bloom_filter_builder_->AppendRowGroup();
+    }
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), page_index_builder_.get(),
+        bloom_filter_builder_.get()));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -342,6 +389,16 @@ class FileSerializer : public ParquetFileWriter::Contents {
         num_row_groups_(0),
         num_rows_(0),
         metadata_(FileMetaDataBuilder::Make(&schema_, properties_, key_value_metadata_)) {
+    // Page indexes and Bloom filters of encrypted columns would need to be
+    // encrypted as well, which is not supported
+    if (properties_->file_encryption_properties() == nullptr) {
+      if (properties_->page_index_enabled()) {
+        page_index_builder_ = PageIndexBuilder::Make(&schema_);
+      }
+      if (HasBloomFilters(schema_, *properties_)) {
+        bloom_filter_builder_ = BloomFilterBuilder::Make(&schema_, properties_.get());
+      }
+    }
     if (sink_->Tell().ValueOrDie() == 0) {
       StartFile();
     } else {
@@ -388,6 +445,18 @@ class FileSerializer : public ParquetFileWriter::Contents {
   std::unique_ptr<RowGroupWriter> row_group_writer_;
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
+  std::unique_ptr<PageIndexBuilder> page_index_builder_;
+  std::unique_ptr<BloomFilterBuilder> bloom_filter_builder_;
+
+  static bool HasBloomFilters(const SchemaDescriptor& schema,
+                              const WriterProperties& properties) {
+    for (int i = 0; i < schema.num_columns(); ++i) {
+      if (properties.bloom_filter_enabled(schema.Column(i)->path())) {
+        return true;
+      }
+    }
+    return false;
+  }
 
   void StartFile() {
     auto file_encryption_properties = properties_->file_encryption_properties();
@@ -479,6 +548,30 @@ void WriteMetaDataFile(const FileMetaData& file_metadata, ArrowOutputStream* sin
   return WriteFileMetaData(file_metadata, sink);
 }
 
+void WriteMetaDataFile(const std::vector<std::string>& paths,
+                       const std::vector<std::shared_ptr<FileMetaData>>& footers,
+                       ArrowOutputStream* sink) {
+  if (footers.empty() || paths.size() != footers.size()) {
+    throw ParquetException("WriteMetaDataFile requires one path per footer");
+  }
+
+  std::shared_ptr<FileMetaData> summary;
+  for (size_t i = 0; i < footers.size(); ++i) {
+    // Round trip through Thrift so as not to modify the file paths of the caller's
+    // footers
+    std::string serialized = footers[i]->SerializeToString();
+    uint32_t length = static_cast<uint32_t>(serialized.size());
+    auto footer = FileMetaData::Make(serialized.data(), &length);
+    footer->set_file_path(paths[i]);
+    if (summary == nullptr) {
+      summary = std::move(footer);
+    } else {
+      summary->AppendRowGroups(*footer);
+    }
+  }
+  WriteMetaDataFile(*summary, sink);
+}
+
 void WriteEncryptedFileMetadata(const FileMetaData& file_metadata,
                                 ArrowOutputStream* sink,
                                 const std::shared_ptr<Encryptor>& encryptor,
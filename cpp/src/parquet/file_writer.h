@@ -20,7 +20,9 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "parquet/metadata.h"
 #include "parquet/platform.h"
@@ -109,6 +111,17 @@ PARQUET_EXPORT
 void WriteMetaDataFile(const FileMetaData& file_metadata,
                        ::arrow::io::OutputStream* sink);
 
+/// \brief Write a summary file, such as the _metadata file of a dataset,
+/// holding the row groups of all the given footers, in order
+///
+/// The column chunks of footers[i] are made to point at paths[i], which should
+/// be relative to the directory of the summary file. The footers themselves are
+/// left untouched and must all have the same schema.
+PARQUET_EXPORT
+void WriteMetaDataFile(const std::vector<std::string>& paths,
+                       const std::vector<std::shared_ptr<FileMetaData>>& footers,
+                       ::arrow::io::OutputStream* sink);
+
 PARQUET_EXPORT
 void WriteEncryptedFileMetadata(const FileMetaData& file_metadata,
                                 ArrowOutputStream* sink,
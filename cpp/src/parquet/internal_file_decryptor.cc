@@ -194,9 +194,10 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
   }
 
   // Create both data and metadata decryptors to avoid redundant retrieval of key
-  // using the key_retriever.
-  auto aes_metadata_decryptor = GetMetaAesDecryptor(column_key.size());
-  auto aes_data_decryptor = GetDataAesDecryptor(column_key.size());
+  // using the key_retriever. Each column gets cipher contexts of its own, so that
+  // the key schedule is computed once per column rather than once per page.
+  auto aes_metadata_decryptor = MakeColumnAesDecryptor(column_key.size(), true);
+  auto aes_data_decryptor = MakeColumnAesDecryptor(column_key.size(), false);
 
   column_metadata_map_[column_path] = std::make_shared<Decryptor>(
       aes_metadata_decryptor, column_key, file_aad_, aad, pool_);
@@ -237,4 +238,12 @@ encryption::AesDecryptor* InternalFileDecryptor::GetDataAesDecryptor(size_t key_
   return data_decryptor_[index].get();
 }
 
+encryption::AesDecryptor* InternalFileDecryptor::MakeColumnAesDecryptor(size_t key_size,
+                                                                        bool metadata) {
+  int key_len = static_cast<int>(key_size);
+  column_aes_decryptors_.emplace_back(
+      encryption::AesDecryptor::Make(algorithm_, key_len, metadata, &all_decryptors_));
+  return column_aes_decryptors_.back().get();
+}
+
 }  // namespace parquet
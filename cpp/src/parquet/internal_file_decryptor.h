@@ -104,6 +104,8 @@ class InternalFileDecryptor {
   // types of meta_decryptors and data_decryptors.
   std::unique_ptr<encryption::AesDecryptor> meta_decryptor_[3];
   std::unique_ptr<encryption::AesDecryptor> data_decryptor_[3];
+  // Cipher contexts of the columns encrypted with their own keys
+  std::vector<std::unique_ptr<encryption::AesDecryptor>> column_aes_decryptors_;
 
   ::arrow::MemoryPool* pool_;
 
@@ -115,6 +117,7 @@ class InternalFileDecryptor {
 
   encryption::AesDecryptor* GetMetaAesDecryptor(size_t key_size);
   encryption::AesDecryptor* GetDataAesDecryptor(size_t key_size);
+  encryption::AesDecryptor* MakeColumnAesDecryptor(size_t key_size, bool metadata);
 
   int MapKeyLenToDecryptorArrayIndex(int key_len);
 };
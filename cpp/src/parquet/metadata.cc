@@ -26,9 +26,11 @@
 #include <vector>
 
 #include "arrow/util/logging.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_decryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/schema.h"
 #include "parquet/schema_internal.h"
 #include "parquet/statistics.h"
@@ -281,6 +283,30 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return column_metadata_->total_uncompressed_size;
   }
 
+  inline bool has_column_index() const {
+    return column_->__isset.column_index_offset && column_->__isset.column_index_length;
+  }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const {
+    return column_->__isset.offset_index_offset && column_->__isset.offset_index_length;
+  }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
   inline std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const {
     if (column_->__isset.crypto_metadata) {
       return ColumnCryptoMetaData::Make(
@@ -355,6 +381,32 @@ int64_t ColumnChunkMetaData::index_page_offset() const {
   return impl_->index_page_offset();
 }
 
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
 Compression::type ColumnChunkMetaData::compression() const {
   return impl_->compression();
 }
@@ -614,6 +666,9 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void AppendRowGroups(const std::unique_ptr<FileMetaDataImpl>& other) {
+    if (!schema()->Equals(*other->schema())) {
+      throw ParquetException("AppendRowGroups requires equal schemas.");
+    }
     format::RowGroup other_rg;
     for (int i = 0; i < other->num_row_groups(); i++) {
       other_rg = other->row_group(i);
@@ -1276,6 +1331,42 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  void SetPageIndexLocation(const PageIndexLocation& location) {
+    auto set_locations = [&](const std::vector<std::vector<IndexLocation>>& locations,
+                             bool is_column_index) {
+      for (size_t i = 0; i < locations.size() && i < row_groups_.size(); ++i) {
+        auto& columns = row_groups_[i].columns;
+        for (size_t j = 0; j < locations[i].size() && j < columns.size(); ++j) {
+          const IndexLocation& index_location = locations[i][j];
+          if (index_location.offset < 0) {
+            continue;
+          }
+          if (is_column_index) {
+            columns[j].__set_column_index_offset(index_location.offset);
+            columns[j].__set_column_index_length(index_location.length);
+          } else {
+            columns[j].__set_offset_index_offset(index_location.offset);
+            columns[j].__set_offset_index_length(index_location.length);
+          }
+        }
+      }
+    };
+    set_locations(location.column_index_locations, /*is_column_index=*/true);
+    set_locations(location.offset_index_locations, /*is_column_index=*/false);
+  }
+
+  void SetBloomFilterLocation(const BloomFilterLocation& location) {
+    const auto& offsets = location.bloom_filter_offsets;
+    for (size_t i = 0; i < offsets.size() && i < row_groups_.size(); ++i) {
+      auto& columns = row_groups_[i].columns;
+      for (size_t j = 0; j < offsets[i].size() && j < columns.size(); ++j) {
+        if (offsets[i][j] >= 0) {
+          columns[j].meta_data.__set_bloom_filter_offset(offsets[i][j]);
+        }
+      }
+    }
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -1405,6 +1496,14 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::SetPageIndexLocation(const PageIndexLocation& location) {
+  impl_->SetPageIndexLocation(location);
+}
+
+void FileMetaDataBuilder::SetBloomFilterLocation(const BloomFilterLocation& location) {
+  impl_->SetBloomFilterLocation(location);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 std::unique_ptr<FileCryptoMetaData> FileMetaDataBuilder::GetCryptoMetaData() {
@@ -42,6 +42,8 @@ class InternalFileDecryptor;
 class Decryptor;
 class Encryptor;
 class FooterSigningEncryptor;
+struct BloomFilterLocation;
+struct PageIndexLocation;
 
 namespace schema {
 
@@ -160,6 +162,18 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
 
+  // page index
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
+
+  // bloom filter
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+
  private:
   explicit ColumnChunkMetaData(
       const void* metadata, const ColumnDescriptor* descr, int16_t row_group_ordinal,
@@ -253,7 +267,8 @@ class PARQUET_EXPORT FileMetaData {
   // Set file_path ColumnChunk fields to a particular value
   void set_file_path(const std::string& path);
 
-  // Merge row-group metadata from "other" FileMetaData object
+  // Merge row-group metadata from "other" FileMetaData object, which must have
+  // the same schema
   void AppendRowGroups(const FileMetaData& other);
 
  private:
@@ -378,6 +393,14 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Record where the page indexes of the column chunks were written; must be
+  // called before Finish
+  void SetPageIndexLocation(const PageIndexLocation& location);
+
+  // Record where the Bloom filters of the column chunks were written; must be
+  // called before Finish
+  void SetBloomFilterLocation(const BloomFilterLocation& location);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/metadata_cache.h"
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "parquet/metadata.h"
+
+namespace parquet {
+
+constexpr int64_t FileMetaDataCache::kDefaultCapacity;
+
+class FileMetaDataCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<FileMetaData> Get(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    // Move the entry to the front of the recency list
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+  }
+
+  void Put(const Key& key, std::shared_ptr<FileMetaData> metadata) {
+    const int64_t metadata_size = metadata->size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      Erase(it);
+    }
+    if (metadata_size > capacity_) {
+      return;
+    }
+    while (size_ + metadata_size > capacity_) {
+      Erase(index_.find(entries_.back().first));
+    }
+    entries_.emplace_front(key, std::move(metadata));
+    index_.emplace(key, entries_.begin());
+    size_ += metadata_size;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.clear();
+    entries_.clear();
+    size_ = 0;
+  }
+
+  int64_t capacity() const { return capacity_; }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+
+  int64_t num_entries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(entries_.size());
+  }
+
+  int64_t hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+  }
+
+  int64_t misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+  }
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      size_t h = std::hash<std::string>()(key.path);
+      h = h * 31 + std::hash<int64_t>()(key.size);
+      return h * 31 + std::hash<int64_t>()(key.mtime);
+    }
+  };
+
+  using Entry = std::pair<Key, std::shared_ptr<FileMetaData>>;
+  using Index = std::unordered_map<Key, std::list<Entry>::iterator, KeyHash>;
+
+  void Erase(Index::iterator it) {
+    size_ -= it->second->second->size();
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+
+  mutable std::mutex mutex_;
+  const int64_t capacity_;
+  int64_t size_ = 0;
+  int64_t hits_ = 0;
+  int64_t misses_ = 0;
+  // Most recently used first
+  std::list<Entry> entries_;
+  Index index_;
+};
+
+FileMetaDataCache::FileMetaDataCache(int64_t capacity) : impl_(new Impl(capacity)) {}
+
+FileMetaDataCache::~FileMetaDataCache() = default;
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::Get(const Key& key) {
+  return impl_->Get(key);
+}
+
+void FileMetaDataCache::Put(const Key& key, std::shared_ptr<FileMetaData> metadata) {
+  impl_->Put(key, std::move(metadata));
+}
+
+void FileMetaDataCache::Clear() { impl_->Clear(); }
+
+int64_t FileMetaDataCache::capacity() const { return impl_->capacity(); }
+
+int64_t FileMetaDataCache::size() const { return impl_->size(); }
+
+int64_t FileMetaDataCache::num_entries() const { return impl_->num_entries(); }
+
+int64_t FileMetaDataCache::hits() const { return impl_->hits(); }
+
+int64_t FileMetaDataCache::misses() const { return impl_->misses(); }
+
+}  // namespace parquet
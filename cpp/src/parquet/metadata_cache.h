@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class FileMetaData;
+
+/// \brief A thread-safe cache of parsed file footers, shared by the readers
+/// of files which are opened repeatedly
+///
+/// The cache is bounded by the serialized size of the footers it holds, and
+/// evicts the least recently used footers first.
+class PARQUET_EXPORT FileMetaDataCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = 64 << 20;
+
+  /// \brief Identifies a version of a file: a file which is rewritten gets
+  /// another key as long as its size or modification time change
+  struct Key {
+    std::string path;
+    int64_t size;
+    /// Modification time, in any unit as long as it is used consistently
+    int64_t mtime;
+
+    bool operator==(const Key& other) const {
+      return path == other.path && size == other.size && mtime == other.mtime;
+    }
+  };
+
+  explicit FileMetaDataCache(int64_t capacity = kDefaultCapacity);
+  ~FileMetaDataCache();
+
+  /// \brief Return the metadata cached under key, or null
+  std::shared_ptr<FileMetaData> Get(const Key& key);
+
+  /// \brief Cache metadata under key, evicting other entries if needed.
+  /// Footers larger than the capacity are not cached.
+  void Put(const Key& key, std::shared_ptr<FileMetaData> metadata);
+
+  /// \brief Drop all entries; the counters are kept
+  void Clear();
+
+  int64_t capacity() const;
+
+  /// \brief Serialized size of the cached footers
+  int64_t size() const;
+
+  int64_t num_entries() const;
+
+  /// \brief Number of Get calls which found the key
+  int64_t hits() const;
+
+  /// \brief Number of Get calls which did not find the key
+  int64_t misses() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace parquet
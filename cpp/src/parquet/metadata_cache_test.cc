@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "arrow/io/memory.h"
+#include "arrow/testing/gtest_util.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/metadata.h"
+#include "parquet/metadata_cache.h"
+#include "parquet/schema.h"
+#include "parquet/test_util.h"
+
+namespace parquet {
+
+using schema::GroupNode;
+using schema::NodeVector;
+using schema::PrimitiveNode;
+
+namespace test {
+
+// Footer of an empty file with num_columns columns
+static std::shared_ptr<FileMetaData> MakeMetaData(int num_columns) {
+  NodeVector fields;
+  for (int i = 0; i < num_columns; ++i) {
+    fields.push_back(PrimitiveNode::Make("c" + std::to_string(i), Repetition::REQUIRED,
+                                         Type::INT32));
+  }
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema);
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer))
+      ->metadata();
+}
+
+TEST(TestFileMetaDataCache, HitsAndMisses) {
+  FileMetaDataCache cache;
+  auto metadata = MakeMetaData(3);
+  const FileMetaDataCache::Key key = {"a.parquet", 100, 1};
+
+  ASSERT_EQ(cache.Get(key), nullptr);
+  cache.Put(key, metadata);
+  ASSERT_EQ(cache.Get(key), metadata);
+  ASSERT_EQ(cache.Get(key), metadata);
+  ASSERT_EQ(1, cache.num_entries());
+  ASSERT_EQ(metadata->size(), cache.size());
+
+  // A rewritten file has another size or modification time
+  ASSERT_EQ(cache.Get({"a.parquet", 100, 2}), nullptr);
+  ASSERT_EQ(cache.Get({"a.parquet", 101, 1}), nullptr);
+  ASSERT_EQ(cache.Get({"b.parquet", 100, 1}), nullptr);
+
+  ASSERT_EQ(2, cache.hits());
+  ASSERT_EQ(4, cache.misses());
+
+  cache.Clear();
+  ASSERT_EQ(cache.Get(key), nullptr);
+  ASSERT_EQ(0, cache.num_entries());
+  ASSERT_EQ(0, cache.size());
+}
+
+TEST(TestFileMetaDataCache, EvictLeastRecentlyUsed) {
+  auto metadata = MakeMetaData(10);
+  const int64_t footer_size = metadata->size();
+  FileMetaDataCache cache(footer_size * 5 / 2);
+  const FileMetaDataCache::Key a = {"a", 1, 1}, b = {"b", 1, 1}, c = {"c", 1, 1};
+
+  cache.Put(a, metadata);
+  cache.Put(b, metadata);
+  ASSERT_NE(cache.Get(a), nullptr);
+  cache.Put(c, metadata);
+  ASSERT_EQ(2, cache.num_entries());
+  ASSERT_EQ(2 * footer_size, cache.size());
+  ASSERT_NE(cache.Get(a), nullptr);
+  ASSERT_EQ(cache.Get(b), nullptr);
+  ASSERT_NE(cache.Get(c), nullptr);
+
+  // Replacing an entry does not count it twice
+  cache.Put(c, metadata);
+  ASSERT_EQ(2, cache.num_entries());
+  ASSERT_EQ(2 * footer_size, cache.size());
+}
+
+TEST(TestFileMetaDataCache, FooterLargerThanCapacity) {
+  auto small = MakeMetaData(1);
+  auto large = MakeMetaData(100);
+  FileMetaDataCache cache(small->size());
+
+  cache.Put({"small", 1, 1}, small);
+  cache.Put({"large", 1, 1}, large);
+  ASSERT_EQ(cache.Get({"large", 1, 1}), nullptr);
+  ASSERT_EQ(cache.Get({"small", 1, 1}), small);
+}
+
+}  // namespace test
+}  // namespace parquet
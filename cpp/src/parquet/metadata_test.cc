@@ -19,6 +19,9 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/io/memory.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
 #include "parquet/schema.h"
 #include "parquet/statistics.h"
 #include "parquet/thrift_internal.h"
@@ -204,6 +207,53 @@ TEST(Metadata, TestBuildAccess) {
   ASSERT_EQ(3, f_accessor->num_schema_elements());
 }
 
+TEST(Metadata, TestWriteMetaDataFile) {
+  parquet::schema::NodeVector fields;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  parquet::SchemaDescriptor schema;
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  auto props = WriterProperties::Builder().build();
+
+  const int64_t nrows = 1000;
+  EncodedStatistics stats;
+  std::vector<std::shared_ptr<FileMetaData>> footers;
+  footers.push_back(GenerateTableMetaData(schema, props, nrows, stats, stats));
+  footers.push_back(GenerateTableMetaData(schema, props, nrows, stats, stats));
+  std::vector<std::string> paths = {"a/part-0.parquet", "b/part-1.parquet"};
+
+  auto sink = CreateOutputStream();
+  WriteMetaDataFile(paths, footers, sink.get());
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  auto reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto summary = reader->metadata();
+
+  ASSERT_TRUE(summary->schema()->Equals(schema));
+  ASSERT_EQ(4, summary->num_row_groups());
+  ASSERT_EQ(2 * nrows, summary->num_rows());
+  for (int i = 0; i < summary->num_row_groups(); ++i) {
+    auto row_group = summary->RowGroup(i);
+    for (int j = 0; j < row_group->num_columns(); ++j) {
+      ASSERT_EQ(paths[i / 2], row_group->ColumnChunk(j)->file_path());
+    }
+  }
+  // The footers are left untouched
+  ASSERT_TRUE(footers[0]->RowGroup(0)->ColumnChunk(0)->file_path().empty());
+
+  // Footers of different schemas can't be merged
+  parquet::SchemaDescriptor other_schema;
+  other_schema.Init(parquet::schema::GroupNode::Make(
+      "schema", Repetition::REPEATED,
+      {parquet::schema::Int32("int_col", Repetition::REQUIRED),
+       parquet::schema::Int32("other_col", Repetition::REQUIRED)}));
+  footers[1] = GenerateTableMetaData(other_schema, props, nrows, stats, stats);
+  ASSERT_THROW(WriteMetaDataFile(paths, footers, CreateOutputStream().get()),
+               ParquetException);
+  ASSERT_THROW(WriteMetaDataFile({paths[0]}, footers, CreateOutputStream().get()),
+               ParquetException);
+}
+
 TEST(Metadata, TestV1Version) {
   // PARQUET-839
   parquet::schema::NodeVector fields;
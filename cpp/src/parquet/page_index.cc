@@ -0,0 +1,293 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/logging.h"
+#include "parquet/exception.h"
+#include "parquet/schema.h"
+#include "parquet/thrift_internal.h"  // IWYU pragma: keep
+
+namespace parquet {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Readers
+
+class OffsetIndexImpl : public OffsetIndex {
+ public:
+  explicit OffsetIndexImpl(const format::OffsetIndex& offset_index) {
+    page_locations_.reserve(offset_index.page_locations.size());
+    for (const auto& location : offset_index.page_locations) {
+      page_locations_.push_back(
+          {location.offset, location.compressed_page_size, location.first_row_index});
+    }
+  }
+
+  const std::vector<PageLocation>& page_locations() const override {
+    return page_locations_;
+  }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+class ColumnIndexImpl : public ColumnIndex {
+ public:
+  explicit ColumnIndexImpl(const format::ColumnIndex& column_index)
+      : null_pages_(column_index.null_pages),
+        min_values_(column_index.min_values),
+        max_values_(column_index.max_values),
+        boundary_order_(static_cast<BoundaryOrder::type>(column_index.boundary_order)),
+        has_null_counts_(column_index.__isset.null_counts),
+        null_counts_(column_index.null_counts) {
+    const size_t num_pages = null_pages_.size();
+    if (min_values_.size() != num_pages || max_values_.size() != num_pages ||
+        (has_null_counts_ && null_counts_.size() != num_pages)) {
+      throw ParquetException("Invalid ColumnIndex: lists have different lengths");
+    }
+  }
+
+  const std::vector<bool>& null_pages() const override { return null_pages_; }
+
+  const std::vector<std::string>& encoded_min_values() const override {
+    return min_values_;
+  }
+
+  const std::vector<std::string>& encoded_max_values() const override {
+    return max_values_;
+  }
+
+  BoundaryOrder::type boundary_order() const override { return boundary_order_; }
+
+  bool has_null_counts() const override { return has_null_counts_; }
+
+  const std::vector<int64_t>& null_counts() const override { return null_counts_; }
+
+  EncodedStatistics page_statistics(int page) const override {
+    DCHECK_GE(page, 0);
+    DCHECK_LT(page, num_pages());
+    EncodedStatistics stats;
+    if (!null_pages_[page]) {
+      stats.set_min(min_values_[page]);
+      stats.set_max(max_values_[page]);
+    }
+    if (has_null_counts_) {
+      stats.set_null_count(null_counts_[page]);
+    }
+    return stats;
+  }
+
+ private:
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  BoundaryOrder::type boundary_order_;
+  bool has_null_counts_;
+  std::vector<int64_t> null_counts_;
+};
+
+// ----------------------------------------------------------------------
+// Builders
+
+class ColumnIndexBuilderImpl : public ColumnIndexBuilder {
+ public:
+  void AddPage(const EncodedStatistics& stats, int64_t num_values) override {
+    if (!valid_) {
+      return;
+    }
+    if (stats.has_min && stats.has_max) {
+      null_pages_.push_back(false);
+      min_values_.push_back(stats.min());
+      max_values_.push_back(stats.max());
+    } else if (stats.has_null_count && stats.null_count == num_values) {
+      // Writers must store empty bounds for pages with only nulls
+      null_pages_.push_back(true);
+      min_values_.emplace_back();
+      max_values_.emplace_back();
+    } else {
+      valid_ = false;
+      return;
+    }
+    if (stats.has_null_count) {
+      null_counts_.push_back(stats.null_count);
+    } else {
+      has_null_counts_ = false;
+    }
+  }
+
+  int64_t WriteTo(ArrowOutputStream* sink) const override {
+    if (!valid_ || null_pages_.empty()) {
+      return 0;
+    }
+    format::ColumnIndex column_index;
+    column_index.__set_null_pages(null_pages_);
+    column_index.__set_min_values(min_values_);
+    column_index.__set_max_values(max_values_);
+    // Pages are not checked for being sorted
+    column_index.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+    if (has_null_counts_) {
+      column_index.__set_null_counts(null_counts_);
+    }
+    ThriftSerializer serializer;
+    return serializer.Serialize(&column_index, sink);
+  }
+
+ private:
+  bool valid_ = true;
+  bool has_null_counts_ = true;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  std::vector<int64_t> null_counts_;
+};
+
+class OffsetIndexBuilderImpl : public OffsetIndexBuilder {
+ public:
+  void AddPage(int64_t offset, int32_t compressed_page_size,
+               int64_t first_row_index) override {
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(compressed_page_size);
+    location.__set_first_row_index(first_row_index);
+    page_locations_.push_back(std::move(location));
+  }
+
+  void Finish(int64_t final_position) override {
+    for (auto& location : page_locations_) {
+      location.__set_offset(location.offset + final_position);
+    }
+  }
+
+  int64_t WriteTo(ArrowOutputStream* sink) const override {
+    if (page_locations_.empty()) {
+      return 0;
+    }
+    format::OffsetIndex offset_index;
+    offset_index.__set_page_locations(page_locations_);
+    ThriftSerializer serializer;
+    return serializer.Serialize(&offset_index, sink);
+  }
+
+ private:
+  std::vector<format::PageLocation> page_locations_;
+};
+
+class PageIndexBuilderImpl : public PageIndexBuilder {
+ public:
+  explicit PageIndexBuilderImpl(const SchemaDescriptor* schema) : schema_(schema) {}
+
+  void AppendRowGroup() override {
+    const int num_columns = schema_->num_columns();
+    column_index_builders_.emplace_back(num_columns);
+    offset_index_builders_.emplace_back(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      const ColumnDescriptor* descr = schema_->Column(i);
+      // Pages of repeated columns may start in the middle of a record, so
+      // their first row index is not well defined
+      if (descr->max_repetition_level() > 0) {
+        continue;
+      }
+      offset_index_builders_.back()[i] = OffsetIndexBuilder::Make();
+      if (descr->sort_order() != SortOrder::UNKNOWN) {
+        column_index_builders_.back()[i] = ColumnIndexBuilder::Make();
+      }
+    }
+  }
+
+  ColumnIndexBuilder* GetColumnIndexBuilder(int i) override {
+    if (column_index_builders_.empty()) {
+      return nullptr;
+    }
+    return column_index_builders_.back().at(i).get();
+  }
+
+  OffsetIndexBuilder* GetOffsetIndexBuilder(int i) override {
+    if (offset_index_builders_.empty()) {
+      return nullptr;
+    }
+    return offset_index_builders_.back().at(i).get();
+  }
+
+  void WriteTo(ArrowOutputStream* sink, PageIndexLocation* location) const override {
+    WriteIndexes(column_index_builders_, sink, &location->column_index_locations);
+    WriteIndexes(offset_index_builders_, sink, &location->offset_index_locations);
+  }
+
+ private:
+  template <typename Builder>
+  static void WriteIndexes(
+      const std::vector<std::vector<std::unique_ptr<Builder>>>& builders,
+      ArrowOutputStream* sink, std::vector<std::vector<IndexLocation>>* locations) {
+    locations->clear();
+    locations->resize(builders.size());
+    for (size_t row_group = 0; row_group < builders.size(); ++row_group) {
+      for (const auto& builder : builders[row_group]) {
+        IndexLocation index_location = {-1, 0};
+        if (builder) {
+          PARQUET_ASSIGN_OR_THROW(int64_t position, sink->Tell());
+          int64_t length = builder->WriteTo(sink);
+          if (length > 0) {
+            index_location = {position, static_cast<int32_t>(length)};
+          }
+        }
+        (*locations)[row_group].push_back(index_location);
+      }
+    }
+  }
+
+  const SchemaDescriptor* schema_;
+  std::vector<std::vector<std::unique_ptr<ColumnIndexBuilder>>> column_index_builders_;
+  std::vector<std::vector<std::unique_ptr<OffsetIndexBuilder>>> offset_index_builders_;
+};
+
+}  // namespace
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &offset_index);
+  return std::unique_ptr<OffsetIndex>(new OffsetIndexImpl(offset_index));
+}
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &column_index);
+  return std::unique_ptr<ColumnIndex>(new ColumnIndexImpl(column_index));
+}
+
+std::unique_ptr<ColumnIndexBuilder> ColumnIndexBuilder::Make() {
+  return std::unique_ptr<ColumnIndexBuilder>(new ColumnIndexBuilderImpl());
+}
+
+std::unique_ptr<OffsetIndexBuilder> OffsetIndexBuilder::Make() {
+  return std::unique_ptr<OffsetIndexBuilder>(new OffsetIndexBuilderImpl());
+}
+
+std::unique_ptr<PageIndexBuilder> PageIndexBuilder::Make(const SchemaDescriptor* schema) {
+  return std::unique_ptr<PageIndexBuilder>(new PageIndexBuilderImpl(schema));
+}
+
+}  // namespace parquet
@@ -0,0 +1,172 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/statistics.h"
+
+namespace parquet {
+
+class SchemaDescriptor;
+
+// ----------------------------------------------------------------------
+// Page index: per-page statistics (ColumnIndex) and page locations
+// (OffsetIndex) of a column chunk, stored outside of the column chunk so that
+// readers can select data pages without reading their headers
+
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief Location of a data page, as recorded in the OffsetIndex
+struct PageLocation {
+  /// File offset of the page header
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index within the row group of the first row of the page
+  int64_t first_row_index;
+};
+
+/// \brief Location of a serialized ColumnIndex or OffsetIndex in the file
+struct IndexLocation {
+  int64_t offset;
+  int32_t length;
+};
+
+/// \brief Page locations of a column chunk
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex; throws ParquetException on failure
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  virtual ~OffsetIndex() = default;
+
+  /// Locations of the data pages, ordered by offset
+  virtual const std::vector<PageLocation>& page_locations() const = 0;
+};
+
+/// \brief Statistics of each data page of a column chunk
+///
+/// Entry i of every list refers to the page at OffsetIndex::page_locations()[i].
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a ColumnIndex; throws ParquetException on failure
+  static std::unique_ptr<ColumnIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  virtual ~ColumnIndex() = default;
+
+  /// Whether each page holds only null values, in which case it has no min/max
+  virtual const std::vector<bool>& null_pages() const = 0;
+
+  /// Plain-encoded lower bound of the values of each page
+  virtual const std::vector<std::string>& encoded_min_values() const = 0;
+
+  /// Plain-encoded upper bound of the values of each page
+  virtual const std::vector<std::string>& encoded_max_values() const = 0;
+
+  virtual BoundaryOrder::type boundary_order() const = 0;
+
+  virtual bool has_null_counts() const = 0;
+
+  /// Number of nulls of each page; empty if has_null_counts() is false
+  virtual const std::vector<int64_t>& null_counts() const = 0;
+
+  /// \brief Statistics of a single page in the form used by page headers
+  virtual EncodedStatistics page_statistics(int page) const = 0;
+
+  int num_pages() const { return static_cast<int>(null_pages().size()); }
+};
+
+/// \brief Accumulates the ColumnIndex of a column chunk as its pages are written
+class PARQUET_EXPORT ColumnIndexBuilder {
+ public:
+  static std::unique_ptr<ColumnIndexBuilder> Make();
+
+  virtual ~ColumnIndexBuilder() = default;
+
+  /// \brief Record the statistics of the next data page
+  ///
+  /// A page with values but no min/max (e.g. because they exceed the
+  /// statistics size limit) invalidates the whole index, which is then not
+  /// written.
+  virtual void AddPage(const EncodedStatistics& stats, int64_t num_values) = 0;
+
+  /// \brief Serialize the index, returning the number of bytes written (0 if
+  /// the index is invalid or empty)
+  virtual int64_t WriteTo(ArrowOutputStream* sink) const = 0;
+};
+
+/// \brief Accumulates the OffsetIndex of a column chunk as its pages are written
+class PARQUET_EXPORT OffsetIndexBuilder {
+ public:
+  static std::unique_ptr<OffsetIndexBuilder> Make();
+
+  virtual ~OffsetIndexBuilder() = default;
+
+  /// \brief Record the location of the next data page
+  virtual void AddPage(int64_t offset, int32_t compressed_page_size,
+                       int64_t first_row_index) = 0;
+
+  /// \brief Shift all recorded offsets, for pages that were first written to
+  /// an intermediate buffer
+  virtual void Finish(int64_t final_position) = 0;
+
+  /// \brief Serialize the index, returning the number of bytes written (0 if
+  /// no page was recorded)
+  virtual int64_t WriteTo(ArrowOutputStream* sink) const = 0;
+};
+
+/// \brief Locations of the page indexes written for each column chunk,
+/// indexed by row group then column. Missing indexes have a negative offset.
+struct PageIndexLocation {
+  std::vector<std::vector<IndexLocation>> column_index_locations;
+  std::vector<std::vector<IndexLocation>> offset_index_locations;
+};
+
+/// \brief Collects the page indexes of all column chunks of a file, to be
+/// written after the last row group
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  static std::unique_ptr<PageIndexBuilder> Make(const SchemaDescriptor* schema);
+
+  virtual ~PageIndexBuilder() = default;
+
+  /// \brief Start collecting the page indexes of a new row group
+  virtual void AppendRowGroup() = 0;
+
+  /// \brief The ColumnIndex builder of column i of the current row group, or
+  /// nullptr if no ColumnIndex is kept for the column
+  virtual ColumnIndexBuilder* GetColumnIndexBuilder(int i) = 0;
+
+  /// \brief The OffsetIndex builder of column i of the current row group, or
+  /// nullptr if no OffsetIndex is kept for the column
+  virtual OffsetIndexBuilder* GetOffsetIndexBuilder(int i) = 0;
+
+  /// \brief Serialize all column indexes followed by all offset indexes
+  virtual void WriteTo(ArrowOutputStream* sink, PageIndexLocation* location) const = 0;
+};
+
+}  // namespace parquet
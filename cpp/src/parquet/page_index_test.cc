@@ -0,0 +1,253 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/memory.h"
+#include "arrow/testing/gtest_util.h"
+#include "parquet/column_reader.h"
+#include "parquet/column_writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/page_index.h"
+#include "parquet/schema.h"
+#include "parquet/test_util.h"
+
+namespace parquet {
+
+using schema::GroupNode;
+using schema::NodePtr;
+using schema::PrimitiveNode;
+
+namespace test {
+
+constexpr int kNumRowGroups = 2;
+constexpr int kRowsPerRowGroup = 200;
+
+static int64_t DecodeInt64(const std::string& encoded) {
+  int64_t value;
+  EXPECT_EQ(encoded.size(), sizeof(value));
+  std::memcpy(&value, encoded.data(), sizeof(value));
+  return value;
+}
+
+class TestPageIndex : public ::testing::Test {
+ public:
+  void SetUp() override {
+    NodePtr a = PrimitiveNode::Make("a", Repetition::REQUIRED, Type::INT64);
+    NodePtr b = PrimitiveNode::Make("b", Repetition::OPTIONAL, Type::INT64);
+    NodePtr c = PrimitiveNode::Make("c", Repetition::REPEATED, Type::INT64);
+    schema_ = std::static_pointer_cast<GroupNode>(
+        GroupNode::Make("schema", Repetition::REQUIRED, {a, b, c}));
+  }
+
+  // Column a holds the row number, column b the row number for the first half
+  // of each row group and nulls afterwards, column c one value per row
+  void WriteFile(const std::shared_ptr<WriterProperties>& properties) {
+    auto sink = CreateOutputStream();
+    auto file_writer = ParquetFileWriter::Open(sink, schema_, properties);
+    int64_t row = 0;
+    for (int rg = 0; rg < kNumRowGroups; ++rg) {
+      auto row_group_writer = file_writer->AppendRowGroup();
+      std::vector<int64_t> values(kRowsPerRowGroup);
+      std::vector<int16_t> def_levels(kRowsPerRowGroup);
+      std::vector<int16_t> rep_levels(kRowsPerRowGroup, 0);
+      for (int i = 0; i < kRowsPerRowGroup; ++i) {
+        values[i] = row + i;
+        def_levels[i] = i < kRowsPerRowGroup / 2 ? 1 : 0;
+      }
+      auto a_writer = static_cast<Int64Writer*>(row_group_writer->NextColumn());
+      a_writer->WriteBatch(kRowsPerRowGroup, nullptr, nullptr, values.data());
+      auto b_writer = static_cast<Int64Writer*>(row_group_writer->NextColumn());
+      b_writer->WriteBatch(kRowsPerRowGroup, def_levels.data(), nullptr, values.data());
+      auto c_writer = static_cast<Int64Writer*>(row_group_writer->NextColumn());
+      std::vector<int16_t> c_def_levels(kRowsPerRowGroup, 1);
+      c_writer->WriteBatch(kRowsPerRowGroup, c_def_levels.data(), rep_levels.data(),
+                           values.data());
+      row_group_writer->Close();
+      row += kRowsPerRowGroup;
+    }
+    file_writer->Close();
+    PARQUET_ASSIGN_OR_THROW(buffer_, sink->Finish());
+  }
+
+  std::unique_ptr<ParquetFileReader> OpenFile() {
+    return ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer_));
+  }
+
+  std::shared_ptr<WriterProperties> PageIndexProperties() {
+    return WriterProperties::Builder()
+        .disable_dictionary()
+        ->data_pagesize(128)
+        ->write_batch_size(16)
+        ->enable_write_page_index()
+        ->build();
+  }
+
+ protected:
+  std::shared_ptr<GroupNode> schema_;
+  std::shared_ptr<Buffer> buffer_;
+};
+
+TEST_F(TestPageIndex, NotWrittenByDefault) {
+  WriteFile(default_writer_properties());
+  auto reader = OpenFile();
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    auto row_group = reader->RowGroup(rg);
+    for (int col = 0; col < 3; ++col) {
+      auto col_meta = row_group->metadata()->ColumnChunk(col);
+      ASSERT_FALSE(col_meta->has_column_index());
+      ASSERT_FALSE(col_meta->has_offset_index());
+      ASSERT_EQ(row_group->GetColumnIndex(col).get(), nullptr);
+      ASSERT_EQ(row_group->GetOffsetIndex(col).get(), nullptr);
+    }
+  }
+}
+
+TEST_F(TestPageIndex, RequiredColumn) {
+  WriteFile(PageIndexProperties());
+  auto reader = OpenFile();
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    auto row_group = reader->RowGroup(rg);
+    auto offset_index = row_group->GetOffsetIndex(0);
+    auto column_index = row_group->GetColumnIndex(0);
+    ASSERT_NE(offset_index.get(), nullptr);
+    ASSERT_NE(column_index.get(), nullptr);
+
+    const auto& locations = offset_index->page_locations();
+    ASSERT_GT(locations.size(), 1);
+    ASSERT_EQ(column_index->num_pages(), static_cast<int>(locations.size()));
+    ASSERT_EQ(locations[0].first_row_index, 0);
+    ASSERT_EQ(locations[0].offset,
+              row_group->metadata()->ColumnChunk(0)->data_page_offset());
+    for (size_t i = 0; i < locations.size(); ++i) {
+      const int64_t first_row = rg * kRowsPerRowGroup + locations[i].first_row_index;
+      const int64_t last_row = i + 1 < locations.size()
+                                   ? rg * kRowsPerRowGroup +
+                                         locations[i + 1].first_row_index - 1
+                                   : (rg + 1) * kRowsPerRowGroup - 1;
+      if (i > 0) {
+        ASSERT_EQ(locations[i].offset,
+                  locations[i - 1].offset + locations[i - 1].compressed_page_size);
+        ASSERT_GT(locations[i].first_row_index, locations[i - 1].first_row_index);
+      }
+      ASSERT_FALSE(column_index->null_pages()[i]);
+      ASSERT_EQ(DecodeInt64(column_index->encoded_min_values()[i]), first_row);
+      ASSERT_EQ(DecodeInt64(column_index->encoded_max_values()[i]), last_row);
+      ASSERT_TRUE(column_index->has_null_counts());
+      ASSERT_EQ(column_index->null_counts()[i], 0);
+    }
+  }
+}
+
+TEST_F(TestPageIndex, NullPages) {
+  WriteFile(PageIndexProperties());
+  auto reader = OpenFile();
+  auto row_group = reader->RowGroup(0);
+  auto offset_index = row_group->GetOffsetIndex(1);
+  auto column_index = row_group->GetColumnIndex(1);
+  ASSERT_NE(offset_index.get(), nullptr);
+  ASSERT_NE(column_index.get(), nullptr);
+  ASSERT_EQ(column_index->num_pages(),
+            static_cast<int>(offset_index->page_locations().size()));
+
+  int64_t null_count = 0;
+  for (int i = 0; i < column_index->num_pages(); ++i) {
+    null_count += column_index->null_counts()[i];
+    const EncodedStatistics stats = column_index->page_statistics(i);
+    ASSERT_EQ(stats.has_min, !column_index->null_pages()[i]);
+    if (column_index->null_pages()[i]) {
+      ASSERT_TRUE(column_index->encoded_min_values()[i].empty());
+    }
+  }
+  ASSERT_EQ(null_count, kRowsPerRowGroup / 2);
+  // The last page only holds nulls
+  ASSERT_TRUE(column_index->null_pages().back());
+}
+
+TEST_F(TestPageIndex, RepeatedColumnHasNoIndex) {
+  WriteFile(PageIndexProperties());
+  auto reader = OpenFile();
+  auto row_group = reader->RowGroup(0);
+  ASSERT_FALSE(row_group->metadata()->ColumnChunk(2)->has_column_index());
+  ASSERT_FALSE(row_group->metadata()->ColumnChunk(2)->has_offset_index());
+  ASSERT_EQ(row_group->GetColumnIndex(2).get(), nullptr);
+  ASSERT_EQ(row_group->GetOffsetIndex(2).get(), nullptr);
+}
+
+TEST_F(TestPageIndex, SkipDataPages) {
+  WriteFile(PageIndexProperties());
+  auto reader = OpenFile();
+  auto row_group = reader->RowGroup(1);
+  auto column_index = row_group->GetColumnIndex(0);
+  auto offset_index = row_group->GetOffsetIndex(0);
+  ASSERT_NE(column_index.get(), nullptr);
+  ASSERT_NE(offset_index.get(), nullptr);
+
+  // Select the pages whose values may fall in [250, 300] using the ColumnIndex
+  const int64_t lower = 250, upper = 300;
+  std::vector<bool> skip(column_index->num_pages());
+  int64_t expected_values = 0;
+  int64_t expected_first = -1;
+  const auto& locations = offset_index->page_locations();
+  for (int i = 0; i < column_index->num_pages(); ++i) {
+    skip[i] = DecodeInt64(column_index->encoded_max_values()[i]) < lower ||
+              DecodeInt64(column_index->encoded_min_values()[i]) > upper;
+    if (!skip[i]) {
+      const int64_t end = i + 1 < column_index->num_pages()
+                              ? locations[i + 1].first_row_index
+                              : kRowsPerRowGroup;
+      expected_values += end - locations[i].first_row_index;
+      if (expected_first < 0) {
+        expected_first = kRowsPerRowGroup + locations[i].first_row_index;
+      }
+    }
+  }
+  ASSERT_LT(expected_values, kRowsPerRowGroup);
+
+  std::vector<int> seen_ordinals;
+  auto pager = row_group->GetColumnPageReader(0);
+  pager->set_data_page_filter([&](const DataPageStats& stats) {
+    seen_ordinals.push_back(stats.page_ordinal);
+    return skip[stats.page_ordinal];
+  });
+  auto column_reader = std::static_pointer_cast<Int64Reader>(
+      ColumnReader::Make(reader->metadata()->schema()->Column(0), std::move(pager)));
+
+  std::vector<int64_t> values(kRowsPerRowGroup);
+  int64_t values_read = 0;
+  int64_t total_read = 0;
+  while (column_reader->HasNext()) {
+    column_reader->ReadBatch(kRowsPerRowGroup, nullptr, nullptr,
+                             values.data() + total_read, &values_read);
+    total_read += values_read;
+  }
+  ASSERT_EQ(total_read, expected_values);
+  ASSERT_EQ(static_cast<int>(seen_ordinals.size()), column_index->num_pages());
+  for (int64_t i = 0; i < total_read; ++i) {
+    ASSERT_EQ(values[i], expected_first + i);
+  }
+}
+
+}  // namespace test
+}  // namespace parquet
@@ -943,6 +943,49 @@ void CheckExtremums() {
 TEST(TestStatistic, Int32Extremums) { CheckExtremums<Int32Type>(); }
 TEST(TestStatistic, Int64Extremums) { CheckExtremums<Int64Type>(); }
 
+// Spaced values spanning several bitmap words at an unaligned offset: all-valid,
+// all-null and mixed words
+template <typename ParquetType>
+void CheckMinMaxSpacedWords() {
+  using T = typename ParquetType::c_type;
+
+  NodePtr node = PrimitiveNode::Make("v", Repetition::OPTIONAL, ParquetType::type_num);
+  ColumnDescriptor descr(node, 1, 1);
+
+  constexpr int64_t kNumValues = 300;
+  constexpr int64_t kOffset = 5;
+  std::vector<T> values(kNumValues);
+  std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(kNumValues + kOffset), 0);
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < kNumValues; i++) {
+    const bool valid = i < 70 || (i >= 140 && i % 3 == 0);
+    // Nulls hold values outside of the range of the valid ones
+    const int64_t magnitude = valid ? i : 1000;
+    values[i] = static_cast<T>(i % 2 == 0 ? magnitude : -magnitude);
+    if (valid) {
+      BitUtil::SetBit(valid_bits.data(), kOffset + i);
+    } else {
+      ++null_count;
+    }
+  }
+
+  auto stats = MakeStatistics<ParquetType>(&descr);
+  stats->UpdateSpaced(values.data(), valid_bits.data(), kOffset, kNumValues - null_count,
+                      null_count);
+  ASSERT_TRUE(stats->HasMinMax());
+  ASSERT_EQ(stats->min(), static_cast<T>(-297));
+  ASSERT_EQ(stats->max(), static_cast<T>(294));
+
+  // Dense values in several blocks
+  stats = MakeStatistics<ParquetType>(&descr);
+  AssertMinMaxAre(stats, values, static_cast<T>(-1000), static_cast<T>(1000));
+}
+
+TEST(TestStatistic, Int32MinMaxSpacedWords) { CheckMinMaxSpacedWords<Int32Type>(); }
+TEST(TestStatistic, Int64MinMaxSpacedWords) { CheckMinMaxSpacedWords<Int64Type>(); }
+TEST(TestStatistic, FloatMinMaxSpacedWords) { CheckMinMaxSpacedWords<FloatType>(); }
+TEST(TestStatistic, DoubleMinMaxSpacedWords) { CheckMinMaxSpacedWords<DoubleType>(); }
+
 // PARQUET-1225: Float NaN values may lead to incorrect min-max
 template <typename ParquetType>
 void CheckNaNs() {
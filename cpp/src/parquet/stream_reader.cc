@@ -17,6 +17,7 @@
 
 #include "parquet/stream_reader.h"
 
+#include <algorithm>
 #include <set>
 #include <utility>
 
@@ -355,7 +356,12 @@ void StreamReader::EndRow() {
                            " of " + std::to_string(nodes_.size()) + " columns read");
   }
   column_index_ = 0;
-  ++current_row_;
+  if (batch_rows_ > 0) {
+    current_row_ += batch_rows_;
+    batch_rows_ = 0;
+  } else {
+    ++current_row_;
+  }
 
   if (!column_readers_[0]->HasNext()) {
     NextRowGroup();
@@ -421,6 +427,10 @@ int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
 int64_t StreamReader::SkipColumns(int64_t num_columns_to_skip) {
   int64_t num_columns_skipped = 0;
 
+  if (batch_rows_ > 0) {
+    throw ParquetException("Cannot skip columns in a row batch");
+  }
+
   if (!eof_) {
     for (; (num_columns_to_skip > num_columns_skipped) &&
            static_cast<std::size_t>(column_index_) < nodes_.size();
@@ -473,6 +483,35 @@ void StreamReader::SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_sk
 
 void StreamReader::CheckColumn(Type::type physical_type,
                                ConvertedType::type converted_type, int length) {
+  if (batch_rows_ > 0) {
+    throw ParquetException("Cannot read a single value in a row batch");
+  }
+  CheckColumnType(physical_type, converted_type, length);
+}
+
+int64_t StreamReader::CheckColumnBatch(Type::type physical_type,
+                                       ConvertedType::type converted_type,
+                                       int fixed_length, int64_t num_rows) {
+  CheckColumnType(physical_type, converted_type, fixed_length);
+  if (num_rows <= 0) {
+    throw ParquetException("Invalid number of rows for column batch: " +
+                           std::to_string(num_rows));
+  }
+  if (column_index_ == 0) {
+    const int64_t num_rows_in_row_group = row_group_reader_->metadata()->num_rows();
+    const int64_t num_rows_remaining_in_row_group =
+        num_rows_in_row_group - (current_row_ - row_group_row_offset_);
+    batch_rows_ = std::min(num_rows, num_rows_remaining_in_row_group);
+  } else if (batch_rows_ == 0 || num_rows < batch_rows_) {
+    throw ParquetException("Column batch of " + std::to_string(num_rows) +
+                           " rows does not match the " + std::to_string(batch_rows_) +
+                           " rows of the previous columns");
+  }
+  return batch_rows_;
+}
+
+void StreamReader::CheckColumnType(Type::type physical_type,
+                                   ConvertedType::type converted_type, int length) {
   if (static_cast<std::size_t>(column_index_) >= nodes_.size()) {
     if (eof_) {
       ParquetException::EofException();
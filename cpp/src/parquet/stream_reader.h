@@ -24,6 +24,7 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "arrow/util/optional.h"
@@ -180,6 +181,52 @@ class PARQUET_EXPORT StreamReader {
     return *this;
   }
 
+  /// \brief Column batch input.
+  /// Read the values of the current column for the next rows at once,
+  /// amortizing the per value overhead of the input operators.  At most
+  /// num_rows rows are read, without crossing the end of the current row
+  /// group.  All the columns of a row batch must be read with the same
+  /// number of rows, then EndRow() terminates all the rows of the batch.
+  /// Single values and column batches cannot be mixed in a row.
+  ///
+  /// The types which can be read are given by StreamColumnTraits.  Null
+  /// values of optional columns are read using optional<T>.
+  /// \return Number of rows read.
+  template <typename T>
+  int64_t ReadColumn(T* values, int64_t num_rows) {
+    using Traits = StreamColumnTraits<T>;
+    using ReaderType = TypedColumnReader<typename Traits::ParquetType>;
+
+    num_rows = CheckColumnBatch(Traits::ParquetType::type_num, Traits::converted_type,
+                                Traits::fixed_length, num_rows);
+    ReadPhysicalValues<Traits, ReaderType>(
+        values, num_rows, std::is_same<T, typename Traits::PhysicalType>());
+    return num_rows;
+  }
+
+  template <typename T>
+  int64_t ReadColumn(optional<T>* values, int64_t num_rows) {
+    using Traits = StreamColumnTraits<T>;
+    using ReaderType = TypedColumnReader<typename Traits::ParquetType>;
+
+    num_rows = CheckColumnBatch(Traits::ParquetType::type_num, Traits::converted_type,
+                                Traits::fixed_length, num_rows);
+    std::unique_ptr<typename Traits::PhysicalType[]> physical_values(
+        new typename Traits::PhysicalType[num_rows]);
+    ReadColumnChunks<ReaderType>(
+        num_rows, physical_values.get(),
+        [&](int64_t row, int64_t num_levels, const typename Traits::PhysicalType* chunk) {
+          for (int64_t i = 0; i < num_levels; ++i) {
+            if (def_levels_[row + i] == 0) {
+              values[row + i].reset();
+            } else {
+              values[row + i] = Traits::FromPhysical(*chunk++);
+            }
+          }
+        });
+    return num_rows;
+  }
+
   /// \brief Terminate current row and advance to next one.
   /// \throws ParquetException if all columns in the row were not
   /// read or skipped.
@@ -259,6 +306,56 @@ class PARQUET_EXPORT StreamReader {
     }
   }
 
+  template <typename Traits, typename ReaderType, typename T>
+  void ReadPhysicalValues(T* values, int64_t num_rows,
+                          std::true_type /* is physical type */) {
+    ReadColumnChunks<ReaderType>(num_rows, values,
+                                 [&](int64_t, int64_t, const T*) {}, /*required=*/true);
+  }
+
+  template <typename Traits, typename ReaderType, typename T>
+  void ReadPhysicalValues(T* values, int64_t num_rows,
+                          std::false_type /* is physical type */) {
+    std::unique_ptr<typename Traits::PhysicalType[]> physical_values(
+        new typename Traits::PhysicalType[num_rows]);
+    ReadColumnChunks<ReaderType>(
+        num_rows, physical_values.get(),
+        [&](int64_t row, int64_t num_levels, const typename Traits::PhysicalType* chunk) {
+          for (int64_t i = 0; i < num_levels; ++i) {
+            values[row + i] = Traits::FromPhysical(chunk[i]);
+          }
+        },
+        /*required=*/true);
+  }
+
+  /// \brief Read num_rows rows of the current column into values, the
+  /// definition levels into def_levels_.  Values may point into the
+  /// current data page, so each chunk read from a page is handed over to
+  /// visit(first row, number of rows, first value of the chunk) before the
+  /// next page is read.
+  template <typename ReaderType, typename Visit>
+  void ReadColumnChunks(int64_t num_rows, typename ReaderType::T* values, Visit&& visit,
+                        bool required = false) {
+    const auto& node = nodes_[column_index_];
+    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
+
+    // Required columns have no definition levels
+    def_levels_.assign(static_cast<std::size_t>(num_rows), 1);
+    int64_t row = 0;
+    while (row < num_rows) {
+      int64_t values_read;
+      const int64_t levels_read =
+          reader->ReadBatch(num_rows - row, def_levels_.data() + row, NULLPTR, values,
+                            &values_read);
+      if (levels_read == 0 || (required && values_read != levels_read)) {
+        ThrowReadFailedException(node);
+      }
+      visit(row, levels_read, values);
+      row += levels_read;
+      values += values_read;
+    }
+  }
+
   void ReadFixedLength(char* ptr, int len);
 
   void Read(ByteArray* v);
@@ -274,6 +371,15 @@ class PARQUET_EXPORT StreamReader {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = 0);
 
+  void CheckColumnType(Type::type physical_type, ConvertedType::type converted_type,
+                       int length);
+
+  /// \brief Check the type of the next column and that it is read with
+  /// the same number of rows as the previous columns of the row.
+  /// \return Number of rows of the row batch.
+  int64_t CheckColumnBatch(Type::type physical_type, ConvertedType::type converted_type,
+                           int fixed_length, int64_t num_rows);
+
   void SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip);
 
   void SetEof();
@@ -290,6 +396,9 @@ class PARQUET_EXPORT StreamReader {
   int column_index_{0};
   int64_t current_row_{0};
   int64_t row_group_row_offset_{0};
+  // Number of rows of the current row batch, zero when reading single values
+  int64_t batch_rows_{0};
+  std::vector<int16_t> def_levels_;
 
   static constexpr int64_t kBatchSizeOne = 1;
 };  // namespace parquet
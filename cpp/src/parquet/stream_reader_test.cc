@@ -20,12 +20,15 @@
 #include <fcntl.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <ctime>
 #include <memory>
 #include <utility>
 
 #include "arrow/io/api.h"
+#include "arrow/testing/gtest_util.h"
 #include "parquet/exception.h"
 #include "parquet/test_util.h"
 
@@ -341,6 +344,59 @@ TEST_F(TestStreamReader, ValueChecking) {
   EXPECT_EQ(i, TestData::num_rows);
 }
 
+TEST_F(TestStreamReader, ReadColumnBatches) {
+  constexpr int kBatchSize = 300;
+  std::array<bool, kBatchSize> b;
+  std::array<std::string, kBatchSize> str;
+  std::array<char, kBatchSize> c;
+  std::array<std::array<char, 4>, kBatchSize> char_array;
+  std::array<int8_t, kBatchSize> int8;
+  std::array<uint16_t, kBatchSize> uint16;
+  std::array<int32_t, kBatchSize> int32;
+  std::array<uint64_t, kBatchSize> uint64;
+  std::array<std::chrono::microseconds, kBatchSize> ts_us;
+  std::array<float, kBatchSize> f;
+  std::array<double, kBatchSize> d;
+
+  int row = 0;
+
+  while (!reader_.eof()) {
+    EXPECT_EQ(row, reader_.current_row());
+
+    const int64_t num_rows = reader_.ReadColumn(b.data(), kBatchSize);
+    ASSERT_EQ(num_rows, std::min(kBatchSize, TestData::num_rows - row));
+    ASSERT_EQ(num_rows, reader_.ReadColumn(str.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader_.ReadColumn(c.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader_.ReadColumn(char_array.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader_.ReadColumn(int8.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader_.ReadColumn(uint16.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader_.ReadColumn(int32.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader_.ReadColumn(uint64.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader_.ReadColumn(ts_us.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader_.ReadColumn(f.data(), kBatchSize));
+    // Single values cannot be read in a row batch
+    EXPECT_THROW(reader_ >> d[0], ParquetException);
+    ASSERT_EQ(num_rows, reader_.ReadColumn(d.data(), kBatchSize));
+    reader_ >> EndRow;
+
+    for (int i = 0; i < num_rows; ++i, ++row) {
+      EXPECT_EQ(b[i], TestData::GetBool(row)) << "index: " << row;
+      EXPECT_EQ(str[i], TestData::GetString(row)) << "index: " << row;
+      EXPECT_EQ(c[i], TestData::GetChar(row)) << "index: " << row;
+      EXPECT_EQ(char_array[i], TestData::GetCharArray(row)) << "index: " << row;
+      EXPECT_EQ(int8[i], TestData::GetInt8(row)) << "index: " << row;
+      EXPECT_EQ(uint16[i], TestData::GetUInt16(row)) << "index: " << row;
+      EXPECT_EQ(int32[i], TestData::GetInt32(row)) << "index: " << row;
+      EXPECT_EQ(uint64[i], TestData::GetUInt64(row)) << "index: " << row;
+      EXPECT_EQ(ts_us[i], TestData::GetChronoMicroseconds(row)) << "index: " << row;
+      EXPECT_FLOAT_EQ(f[i], TestData::GetFloat(row)) << "index: " << row;
+      EXPECT_DOUBLE_EQ(d[i], TestData::GetDouble(row)) << "index: " << row;
+    }
+  }
+  EXPECT_EQ(reader_.current_row(), TestData::num_rows);
+  EXPECT_EQ(row, TestData::num_rows);
+}
+
 TEST_F(TestStreamReader, ReadRequiredFieldAsOptionalField) {
   /* Test that required fields can be read using optional types.
 
@@ -827,6 +883,93 @@ TEST_F(TestOptionalFields, ReadOptionalFieldAsRequiredField) {
   }
 }
 
+TEST_F(TestOptionalFields, ColumnBatchesRoundtrip) {
+  constexpr int kBatchSize = 300;
+  std::array<optional<bool>, kBatchSize> opt_bool;
+  std::array<optional<std::string>, kBatchSize> opt_string;
+  std::array<optional<char>, kBatchSize> opt_char;
+  std::array<optional<std::array<char, 4>>, kBatchSize> opt_char_array;
+  std::array<optional<int8_t>, kBatchSize> opt_int8;
+  std::array<optional<uint16_t>, kBatchSize> opt_uint16;
+  std::array<optional<int32_t>, kBatchSize> opt_int32;
+  std::array<optional<uint64_t>, kBatchSize> opt_uint64;
+  std::array<optional<std::chrono::microseconds>, kBatchSize> opt_ts_us;
+  std::array<optional<float>, kBatchSize> opt_float;
+  std::array<optional<double>, kBatchSize> opt_double;
+
+  auto sink = CreateOutputStream();
+  {
+    StreamWriter os{ParquetFileWriter::Open(sink, GetSchema())};
+
+    for (int row = 0; row < TestData::num_rows; row += kBatchSize) {
+      const int num_rows = std::min(kBatchSize, TestData::num_rows - row);
+      for (int i = 0; i < num_rows; ++i) {
+        opt_bool[i] = TestData::GetOptBool(row + i);
+        opt_string[i] = TestData::GetOptString(row + i);
+        opt_char[i] = TestData::GetOptChar(row + i);
+        opt_char_array[i] = TestData::GetOptCharArray(row + i);
+        opt_int8[i] = TestData::GetOptInt8(row + i);
+        opt_uint16[i] = TestData::GetOptUInt16(row + i);
+        opt_int32[i] = TestData::GetOptInt32(row + i);
+        opt_uint64[i] = TestData::GetOptUInt64(row + i);
+        opt_ts_us[i] = TestData::GetOptChronoMicroseconds(row + i);
+        opt_float[i] = TestData::GetOptFloat(row + i);
+        opt_double[i] = TestData::GetOptDouble(row + i);
+      }
+      os.WriteColumn(opt_bool.data(), num_rows);
+      os.WriteColumn(opt_string.data(), num_rows);
+      os.WriteColumn(opt_char.data(), num_rows);
+      os.WriteColumn(opt_char_array.data(), num_rows);
+      os.WriteColumn(opt_int8.data(), num_rows);
+      os.WriteColumn(opt_uint16.data(), num_rows);
+      os.WriteColumn(opt_int32.data(), num_rows);
+      os.WriteColumn(opt_uint64.data(), num_rows);
+      os.WriteColumn(opt_ts_us.data(), num_rows);
+      os.WriteColumn(opt_float.data(), num_rows);
+      os.WriteColumn(opt_double.data(), num_rows);
+      os << EndRow;
+    }
+    EXPECT_EQ(os.current_row(), TestData::num_rows);
+  }
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  StreamReader reader{
+      ParquetFileReader::Open(std::make_shared<arrow::io::BufferReader>(buffer))};
+  int row = 0;
+
+  while (!reader.eof()) {
+    const int64_t num_rows = reader.ReadColumn(opt_bool.data(), kBatchSize);
+    ASSERT_EQ(num_rows, std::min(kBatchSize, TestData::num_rows - row));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_string.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_char.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_char_array.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_int8.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_uint16.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_int32.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_uint64.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_ts_us.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_float.data(), kBatchSize));
+    ASSERT_EQ(num_rows, reader.ReadColumn(opt_double.data(), kBatchSize));
+    reader >> EndRow;
+
+    for (int i = 0; i < num_rows; ++i, ++row) {
+      EXPECT_EQ(opt_bool[i], TestData::GetOptBool(row)) << "index: " << row;
+      EXPECT_EQ(opt_string[i], TestData::GetOptString(row)) << "index: " << row;
+      EXPECT_EQ(opt_char[i], TestData::GetOptChar(row)) << "index: " << row;
+      EXPECT_EQ(opt_char_array[i], TestData::GetOptCharArray(row)) << "index: " << row;
+      EXPECT_EQ(opt_int8[i], TestData::GetOptInt8(row)) << "index: " << row;
+      EXPECT_EQ(opt_uint16[i], TestData::GetOptUInt16(row)) << "index: " << row;
+      EXPECT_EQ(opt_int32[i], TestData::GetOptInt32(row)) << "index: " << row;
+      EXPECT_EQ(opt_uint64[i], TestData::GetOptUInt64(row)) << "index: " << row;
+      EXPECT_EQ(opt_ts_us[i], TestData::GetOptChronoMicroseconds(row))
+          << "index: " << row;
+      EXPECT_EQ(opt_float[i], TestData::GetOptFloat(row)) << "index: " << row;
+      EXPECT_EQ(opt_double[i], TestData::GetOptDouble(row)) << "index: " << row;
+    }
+  }
+  EXPECT_EQ(row, TestData::num_rows);
+}
+
 class TestReadingDataFiles : public ::testing::Test {
  protected:
   std::string GetDataFile(const std::string& filename) const {
@@ -185,6 +185,31 @@ StreamWriter& StreamWriter::WriteFixedLength(const char* data_ptr, std::size_t d
 
 void StreamWriter::CheckColumn(Type::type physical_type,
                                ConvertedType::type converted_type, int length) {
+  if (batch_rows_ > 0) {
+    throw ParquetException("Cannot write a single value in a row batch");
+  }
+  CheckColumnType(physical_type, converted_type, length);
+}
+
+void StreamWriter::CheckColumnBatch(Type::type physical_type,
+                                    ConvertedType::type converted_type,
+                                    int fixed_length, int64_t num_rows) {
+  CheckColumnType(physical_type, converted_type, fixed_length > 0 ? fixed_length : -1);
+  if (num_rows <= 0) {
+    throw ParquetException("Invalid number of rows for column batch: " +
+                           std::to_string(num_rows));
+  }
+  if (column_index_ == 0) {
+    batch_rows_ = num_rows;
+  } else if (num_rows != batch_rows_) {
+    throw ParquetException("Column batch of " + std::to_string(num_rows) +
+                           " rows does not match the " + std::to_string(batch_rows_) +
+                           " rows of the previous columns");
+  }
+}
+
+void StreamWriter::CheckColumnType(Type::type physical_type,
+                                   ConvertedType::type converted_type, int length) {
   if (static_cast<std::size_t>(column_index_) >= nodes_.size()) {
     throw ParquetException("Column index out-of-bounds.  Index " +
                            std::to_string(column_index_) + " is invalid for " +
@@ -217,6 +242,9 @@ void StreamWriter::CheckColumn(Type::type physical_type,
 int64_t StreamWriter::SkipColumns(int num_columns_to_skip) {
   int num_columns_skipped = 0;
 
+  if (batch_rows_ > 0) {
+    throw ParquetException("Cannot skip columns in a row batch");
+  }
   for (; (num_columns_to_skip > num_columns_skipped) &&
          static_cast<std::size_t>(column_index_) < nodes_.size();
        ++num_columns_skipped) {
@@ -286,7 +314,12 @@ void StreamWriter::EndRow() {
                            " of " + std::to_string(nodes_.size()) + " columns written");
   }
   column_index_ = 0;
-  ++current_row_;
+  if (batch_rows_ > 0) {
+    current_row_ += batch_rows_;
+    batch_rows_ = 0;
+  } else {
+    ++current_row_;
+  }
 
   if (max_row_group_size_ > 0) {
     if (row_group_size_ > max_row_group_size_) {
@@ -21,8 +21,10 @@
 #include <array>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "arrow/util/optional.h"
@@ -32,6 +34,105 @@
 
 namespace parquet {
 
+/// \brief Mapping of the C++ types of the column batch functions of
+/// StreamWriter and StreamReader to the Parquet column types.  The
+/// fixed_length of fixed length byte array columns is zero for other types.
+template <typename T>
+struct StreamColumnTraits;
+
+#define PARQUET_STREAM_COLUMN_TRAITS(CTYPE, PARQUET_TYPE, CONVERTED_TYPE)                \
+  template <>                                                                            \
+  struct StreamColumnTraits<CTYPE> {                                                     \
+    using ParquetType = PARQUET_TYPE;                                                    \
+    using PhysicalType = PARQUET_TYPE::c_type;                                           \
+    static constexpr ConvertedType::type converted_type = CONVERTED_TYPE;                \
+    static constexpr int fixed_length = 0;                                               \
+    static PhysicalType ToPhysical(CTYPE v) { return static_cast<PhysicalType>(v); }     \
+    static CTYPE FromPhysical(PhysicalType v) { return static_cast<CTYPE>(v); }          \
+  }
+
+PARQUET_STREAM_COLUMN_TRAITS(bool, BooleanType, ConvertedType::NONE);
+PARQUET_STREAM_COLUMN_TRAITS(int8_t, Int32Type, ConvertedType::INT_8);
+PARQUET_STREAM_COLUMN_TRAITS(uint8_t, Int32Type, ConvertedType::UINT_8);
+PARQUET_STREAM_COLUMN_TRAITS(int16_t, Int32Type, ConvertedType::INT_16);
+PARQUET_STREAM_COLUMN_TRAITS(uint16_t, Int32Type, ConvertedType::UINT_16);
+PARQUET_STREAM_COLUMN_TRAITS(int32_t, Int32Type, ConvertedType::INT_32);
+PARQUET_STREAM_COLUMN_TRAITS(uint32_t, Int32Type, ConvertedType::UINT_32);
+PARQUET_STREAM_COLUMN_TRAITS(int64_t, Int64Type, ConvertedType::INT_64);
+PARQUET_STREAM_COLUMN_TRAITS(uint64_t, Int64Type, ConvertedType::UINT_64);
+PARQUET_STREAM_COLUMN_TRAITS(float, FloatType, ConvertedType::NONE);
+PARQUET_STREAM_COLUMN_TRAITS(double, DoubleType, ConvertedType::NONE);
+
+#undef PARQUET_STREAM_COLUMN_TRAITS
+
+template <typename Duration, ConvertedType::type CONVERTED_TYPE>
+struct StreamTimestampColumnTraits {
+  using ParquetType = Int64Type;
+  using PhysicalType = int64_t;
+  static constexpr ConvertedType::type converted_type = CONVERTED_TYPE;
+  static constexpr int fixed_length = 0;
+  static PhysicalType ToPhysical(const Duration& v) {
+    return static_cast<PhysicalType>(v.count());
+  }
+  static Duration FromPhysical(PhysicalType v) { return Duration{v}; }
+};
+
+template <>
+struct StreamColumnTraits<std::chrono::milliseconds>
+    : public StreamTimestampColumnTraits<std::chrono::milliseconds,
+                                         ConvertedType::TIMESTAMP_MILLIS> {};
+
+template <>
+struct StreamColumnTraits<std::chrono::microseconds>
+    : public StreamTimestampColumnTraits<std::chrono::microseconds,
+                                         ConvertedType::TIMESTAMP_MICROS> {};
+
+/// Fixed and variable length strings are written as values pointing into
+/// the given ones.
+template <>
+struct StreamColumnTraits<char> {
+  using ParquetType = FLBAType;
+  using PhysicalType = FixedLenByteArray;
+  static constexpr ConvertedType::type converted_type = ConvertedType::NONE;
+  static constexpr int fixed_length = 1;
+  static PhysicalType ToPhysical(const char& v) {
+    return FixedLenByteArray(reinterpret_cast<const uint8_t*>(&v));
+  }
+  static char FromPhysical(const PhysicalType& v) { return static_cast<char>(v.ptr[0]); }
+};
+
+template <std::size_t N>
+struct StreamColumnTraits<std::array<char, N>> {
+  using ParquetType = FLBAType;
+  using PhysicalType = FixedLenByteArray;
+  static constexpr ConvertedType::type converted_type = ConvertedType::NONE;
+  static constexpr int fixed_length = static_cast<int>(N);
+  static PhysicalType ToPhysical(const std::array<char, N>& v) {
+    return FixedLenByteArray(reinterpret_cast<const uint8_t*>(v.data()));
+  }
+  static std::array<char, N> FromPhysical(const PhysicalType& v) {
+    std::array<char, N> result;
+    std::memcpy(result.data(), v.ptr, N);
+    return result;
+  }
+};
+
+
+template <>
+struct StreamColumnTraits<std::string> {
+  using ParquetType = ByteArrayType;
+  using PhysicalType = ByteArray;
+  static constexpr ConvertedType::type converted_type = ConvertedType::UTF8;
+  static constexpr int fixed_length = 0;
+  static PhysicalType ToPhysical(const std::string& v) {
+    return ByteArray(static_cast<uint32_t>(v.size()),
+                     reinterpret_cast<const uint8_t*>(v.data()));
+  }
+  static std::string FromPhysical(const PhysicalType& v) {
+    return std::string(reinterpret_cast<const char*>(v.ptr), v.len);
+  }
+};
+
 /// \brief A class for writing Parquet files using an output stream type API.
 ///
 /// The values given must be of the correct type i.e. the type must
@@ -162,6 +263,62 @@ class PARQUET_EXPORT StreamWriter {
     return *this;
   }
 
+  /// \brief Column batch output.
+  /// Write the values of the current column for the next num_rows rows
+  /// at once, amortizing the per value overhead of the output operators.
+  /// All the columns of a row batch must be written with the same number
+  /// of rows, then EndRow() terminates all the rows of the batch.  Single
+  /// values and column batches cannot be mixed in a row.
+  ///
+  /// The types which can be written are given by StreamColumnTraits.
+  /// Null values of optional columns are written using optional<T>.
+  template <typename T>
+  StreamWriter& WriteColumn(const T* values, int64_t num_rows) {
+    using Traits = StreamColumnTraits<T>;
+    using WriterType = TypedColumnWriter<typename Traits::ParquetType>;
+
+    CheckColumnBatch(Traits::ParquetType::type_num, Traits::converted_type,
+                     Traits::fixed_length, num_rows);
+    auto writer = static_cast<WriterType*>(row_group_writer_->column(column_index_));
+
+    def_levels_.assign(static_cast<std::size_t>(num_rows), kDefLevelOne);
+    WritePhysicalValues<Traits>(writer, values, num_rows,
+                                std::is_same<T, typename Traits::PhysicalType>());
+    ++column_index_;
+    return *this;
+  }
+
+  template <typename T>
+  StreamWriter& WriteColumn(const optional<T>* values, int64_t num_rows) {
+    using Traits = StreamColumnTraits<T>;
+    using WriterType = TypedColumnWriter<typename Traits::ParquetType>;
+
+    CheckColumnBatch(Traits::ParquetType::type_num, Traits::converted_type,
+                     Traits::fixed_length, num_rows);
+    const auto& node = nodes_[column_index_];
+    auto writer = static_cast<WriterType*>(row_group_writer_->column(column_index_));
+
+    std::unique_ptr<typename Traits::PhysicalType[]> physical_values(
+        new typename Traits::PhysicalType[num_rows]);
+    def_levels_.resize(static_cast<std::size_t>(num_rows));
+    int64_t num_values = 0;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      if (values[i]) {
+        physical_values[num_values++] = Traits::ToPhysical(*values[i]);
+        def_levels_[i] = kDefLevelOne;
+      } else if (node->is_required()) {
+        throw ParquetException("Cannot write null value to required column '" +
+                               node->name() + "'");
+      } else {
+        def_levels_[i] = kDefLevelZero;
+      }
+    }
+    writer->WriteBatch(num_rows, def_levels_.data(), NULLPTR, physical_values.get());
+    UpdateRowGroupSize(writer);
+    ++column_index_;
+    return *this;
+  }
+
   /// \brief Skip the next N columns of optional data.  If there are
   /// less than N columns remaining then the excess columns are
   /// ignored.
@@ -191,6 +348,32 @@ class PARQUET_EXPORT StreamWriter {
     return *this;
   }
 
+  template <typename Traits, typename WriterType, typename T>
+  void WritePhysicalValues(WriterType* writer, const T* values, int64_t num_rows,
+                           std::true_type /* is physical type */) {
+    writer->WriteBatch(num_rows, def_levels_.data(), NULLPTR, values);
+    UpdateRowGroupSize(writer);
+  }
+
+  template <typename Traits, typename WriterType, typename T>
+  void WritePhysicalValues(WriterType* writer, const T* values, int64_t num_rows,
+                           std::false_type /* is physical type */) {
+    std::unique_ptr<typename Traits::PhysicalType[]> physical_values(
+        new typename Traits::PhysicalType[num_rows]);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      physical_values[i] = Traits::ToPhysical(values[i]);
+    }
+    writer->WriteBatch(num_rows, def_levels_.data(), NULLPTR, physical_values.get());
+    UpdateRowGroupSize(writer);
+  }
+
+  template <typename WriterType>
+  void UpdateRowGroupSize(WriterType* writer) {
+    if (max_row_group_size_ > 0) {
+      row_group_size_ += writer->EstimatedBufferedValueBytes();
+    }
+  }
+
   StreamWriter& WriteVariableLength(const char* data_ptr, std::size_t data_len);
 
   StreamWriter& WriteFixedLength(const char* data_ptr, std::size_t data_len);
@@ -198,6 +381,14 @@ class PARQUET_EXPORT StreamWriter {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = -1);
 
+  void CheckColumnType(Type::type physical_type, ConvertedType::type converted_type,
+                       int length);
+
+  /// \brief Check the type of the next column and that it is written
+  /// with the same number of rows as the previous columns of the row.
+  void CheckColumnBatch(Type::type physical_type, ConvertedType::type converted_type,
+                        int fixed_length, int64_t num_rows);
+
   /// \brief Skip the next column which must be optional.
   /// \throws ParquetException if the next column does not exist or is
   /// not optional.
@@ -216,6 +407,9 @@ class PARQUET_EXPORT StreamWriter {
   int64_t current_row_{0};
   int64_t row_group_size_{0};
   int64_t max_row_group_size_{default_row_group_size_};
+  // Number of rows of the current row batch, zero when writing single values
+  int64_t batch_rows_{0};
+  std::vector<int16_t> def_levels_;
 
   std::unique_ptr<ParquetFileWriter> file_writer_;
   std::unique_ptr<RowGroupWriter, null_deleter> row_group_writer_;
@@ -212,6 +212,48 @@ TEST_F(TestStreamWriter, RequiredFieldChecking) {
   EXPECT_NO_THROW(writer_ << EndRow);
 }
 
+TEST_F(TestStreamWriter, ColumnBatches) {
+  constexpr int kBatchSize = 3;
+  std::array<bool, kBatchSize> b{{true, false, true}};
+  std::array<std::string, kBatchSize> str{{"a", "bc", "def"}};
+  std::array<char, kBatchSize> c{{'x', 'y', 'z'}};
+  std::array<char4_array_type, kBatchSize> char4_array{
+      {{{'T', 'E', 'S', 'T'}}, {{'A', 'B', 'C', 'D'}}, {{'W', 'X', 'Y', 'Z'}}}};
+  std::array<int8_t, kBatchSize> int8{{-1, 0, 1}};
+  std::array<optional<uint16_t>, kBatchSize> uint16{{1, 2, 3}};
+  std::array<int32_t, kBatchSize> int32{{329487, -1, 0}};
+  std::array<uint64_t, kBatchSize> uint64{{(1ull << 60) + 123, 0, 1}};
+  std::array<optional<float>, kBatchSize> f{{5.4f, optional<float>(), 1.0f}};
+  std::array<double, kBatchSize> d{{5.4, 0.0, -1.0}};
+
+  EXPECT_THROW(writer_.WriteColumn(int32.data(), kBatchSize), ParquetException);
+  EXPECT_NO_THROW(writer_.WriteColumn(b.data(), kBatchSize));
+  // All the columns of a row batch have the same number of rows
+  EXPECT_THROW(writer_.WriteColumn(str.data(), kBatchSize - 1), ParquetException);
+  EXPECT_NO_THROW(writer_.WriteColumn(str.data(), kBatchSize));
+  // Single values cannot be written in a row batch
+  EXPECT_THROW(writer_ << 'x', ParquetException);
+  EXPECT_NO_THROW(writer_.WriteColumn(c.data(), kBatchSize));
+  EXPECT_NO_THROW(writer_.WriteColumn(char4_array.data(), kBatchSize));
+  EXPECT_NO_THROW(writer_.WriteColumn(int8.data(), kBatchSize));
+  EXPECT_NO_THROW(writer_.WriteColumn(uint16.data(), kBatchSize));
+  EXPECT_NO_THROW(writer_.WriteColumn(int32.data(), kBatchSize));
+  EXPECT_NO_THROW(writer_.WriteColumn(uint64.data(), kBatchSize));
+  // Required field with a null value
+  EXPECT_THROW(writer_.WriteColumn(f.data(), kBatchSize), ParquetException);
+  f[1] = 2.0f;
+  EXPECT_NO_THROW(writer_.WriteColumn(f.data(), kBatchSize));
+  EXPECT_EQ(9, writer_.current_column());
+  EXPECT_THROW(writer_ << EndRow, ParquetException);
+  EXPECT_NO_THROW(writer_.WriteColumn(d.data(), kBatchSize));
+  EXPECT_NO_THROW(writer_ << EndRow);
+  EXPECT_EQ(kBatchSize, writer_.current_row());
+
+  // Single values can be written again in the next row
+  EXPECT_NO_THROW(writer_ << true);
+  EXPECT_THROW(writer_.WriteColumn(str.data(), kBatchSize), ParquetException);
+}
+
 TEST_F(TestStreamWriter, EndRow) {
   // Attempt #1 to end row prematurely.
   EXPECT_EQ(0, writer_.current_row());
@@ -38,6 +38,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <list>
 #include <mutex>
 #include <tuple>
 #include <unordered_map>
@@ -166,6 +167,8 @@ struct ObjectInUseEntry {
   PlasmaObject object;
   /// A flag representing whether the object has been sealed.
   bool is_sealed;
+  /// The position of the object in the release cache, if count is zero.
+  std::list<ObjectID>::iterator release_cache_position;
 };
 
 class ClientMmapTableEntry {
@@ -224,6 +227,8 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
 
+  Status SetReleaseCacheCapacity(int64_t capacity);
+
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0);
 
@@ -242,14 +247,23 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Release(const ObjectID& object_id);
 
+  Status Release(const std::vector<ObjectID>& object_ids);
+
   Status Contains(const ObjectID& object_id, bool* has_object);
 
+  Status Contains(const std::vector<ObjectID>& object_ids,
+                  std::vector<bool>* has_objects);
+
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   Status List(ObjectTable* objects);
 
   Status Abort(const ObjectID& object_id);
 
   Status Seal(const ObjectID& object_id);
 
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
@@ -290,6 +304,31 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// \return The return status.
   Status MarkObjectUnused(const ObjectID& object_id);
 
+  /// Whether an object whose count dropped to zero can stay in the release
+  /// cache instead of being released.
+  bool CanCacheReleased(const ObjectID& object_id, const ObjectInUseEntry& entry);
+
+  /// Release the least recently cached objects until the release cache holds
+  /// at most the given number of bytes.
+  ///
+  /// \param capacity The number of bytes to keep cached.
+  /// \return The return status.
+  Status ShrinkReleaseCache(int64_t capacity);
+
+  /// Decrement the count of instances of an object used by this client, and
+  /// mark it unused if it drops to zero. The store still has to be told.
+  ///
+  /// \param object_id The object ID to release.
+  /// \param[out] unused Whether the object is no longer used by this client.
+  /// \return The return status.
+  Status DecrementObjectCount(const ObjectID& object_id, bool* unused);
+
+  /// Check that an object can be sealed by this client and mark it sealed.
+  ///
+  /// \param object_id The object ID to seal.
+  /// \return The return status.
+  Status MarkObjectSealed(const ObjectID& object_id);
+
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
                     const std::function<std::shared_ptr<Buffer>(
@@ -326,6 +365,13 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   int64_t store_capacity_;
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
+  /// The released objects this client still holds a reference to, least
+  /// recently released first. Their entries in objects_in_use_ have a count of 0.
+  std::list<ObjectID> release_cache_;
+  /// The number of bytes of the objects in release_cache_.
+  int64_t release_cache_bytes_;
+  /// The maximum value of release_cache_bytes_.
+  int64_t release_cache_capacity_;
   /// A queue of notification
   std::deque<std::tuple<ObjectID, int64_t, int64_t>> pending_notification_;
   /// A mutex which protects this class.
@@ -339,7 +385,11 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
 PlasmaBuffer::~PlasmaBuffer() { ARROW_UNUSED(client_->Release(object_id_)); }
 
-PlasmaClient::Impl::Impl() : store_conn_(0), store_capacity_(0) {
+PlasmaClient::Impl::Impl()
+    : store_conn_(0),
+      store_capacity_(0),
+      release_cache_bytes_(0),
+      release_cache_capacity_(0) {
 #ifdef PLASMA_CUDA
   auto maybe_manager = CudaDeviceManager::Instance();
   DCHECK_OK(maybe_manager.status());
@@ -375,7 +425,7 @@ bool PlasmaClient::Impl::IsInUse(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
   const auto elem = objects_in_use_.find(object_id);
-  return (elem != objects_in_use_.end());
+  return (elem != objects_in_use_.end() && elem->second->count > 0);
 }
 
 int PlasmaClient::Impl::GetStoreFd(int store_fd) {
@@ -406,7 +456,12 @@ void PlasmaClient::Impl::IncrementObjectCount(const ObjectID& object_id,
     object_entry = objects_in_use_[object_id].get();
   } else {
     object_entry = elem->second.get();
-    ARROW_CHECK(object_entry->count > 0);
+    if (object_entry->count == 0) {
+      // The object is used again, take it out of the release cache.
+      release_cache_bytes_ -=
+          object_entry->object.data_size + object_entry->object.metadata_size;
+      release_cache_.erase(object_entry->release_cache_position);
+    }
   }
   // Increment the count of the number of instances of this object that are
   // being used by this client. The corresponding decrement should happen in
@@ -700,13 +755,8 @@ Status PlasmaClient::Impl::MarkObjectUnused(const ObjectID& object_id) {
   return Status::OK();
 }
 
-Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
-  // If the client is already disconnected, ignore release requests.
-  if (store_conn_ < 0) {
-    return Status::OK();
-  }
+Status PlasmaClient::Impl::DecrementObjectCount(const ObjectID& object_id,
+                                                bool* unused) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end());
 
@@ -725,9 +775,58 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   object_entry->second->count -= 1;
   ARROW_CHECK(object_entry->second->count >= 0);
   // Check if the client is no longer using this object.
-  if (object_entry->second->count == 0) {
-    // Tell the store that the client no longer needs the object.
+  *unused = object_entry->second->count == 0;
+  if (*unused && CanCacheReleased(object_id, *object_entry->second)) {
+    // Keep the reference to the object, see SetReleaseCacheCapacity.
+    const PlasmaObject& object = object_entry->second->object;
+    release_cache_bytes_ += object.data_size + object.metadata_size;
+    object_entry->second->release_cache_position =
+        release_cache_.insert(release_cache_.end(), object_id);
+    *unused = false;
+  } else if (*unused) {
+    RETURN_NOT_OK(MarkObjectUnused(object_id));
+  }
+  return Status::OK();
+}
+
+bool PlasmaClient::Impl::CanCacheReleased(const ObjectID& object_id,
+                                          const ObjectInUseEntry& entry) {
+  return release_cache_capacity_ > 0 && entry.is_sealed &&
+         entry.object.device_num == 0 &&
+         entry.object.data_size + entry.object.metadata_size <=
+             release_cache_capacity_ &&
+         deletion_cache_.count(object_id) == 0;
+}
+
+Status PlasmaClient::Impl::ShrinkReleaseCache(int64_t capacity) {
+  std::vector<ObjectID> released_ids;
+  while (release_cache_bytes_ > capacity) {
+    const ObjectID object_id = release_cache_.front();
+    release_cache_.pop_front();
+    auto object_entry = objects_in_use_.find(object_id);
+    ARROW_CHECK(object_entry != objects_in_use_.end());
+    const PlasmaObject& object = object_entry->second->object;
+    release_cache_bytes_ -= object.data_size + object.metadata_size;
     RETURN_NOT_OK(MarkObjectUnused(object_id));
+    released_ids.push_back(object_id);
+  }
+  if (!released_ids.empty()) {
+    RETURN_NOT_OK(SendReleaseBatchRequest(store_conn_, released_ids));
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // If the client is already disconnected, ignore release requests.
+  if (store_conn_ < 0) {
+    return Status::OK();
+  }
+  bool unused;
+  RETURN_NOT_OK(DecrementObjectCount(object_id, &unused));
+  if (unused) {
+    // Tell the store that the client no longer needs the object.
     RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
     auto iter = deletion_cache_.find(object_id);
     if (iter != deletion_cache_.end()) {
@@ -735,7 +834,36 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
       RETURN_NOT_OK(Delete({object_id}));
     }
   }
-  return Status::OK();
+  return ShrinkReleaseCache(release_cache_capacity_);
+}
+
+Status PlasmaClient::Impl::Release(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // If the client is already disconnected, ignore release requests.
+  if (store_conn_ < 0) {
+    return Status::OK();
+  }
+  std::vector<ObjectID> unused_ids;
+  std::vector<ObjectID> deleted_ids;
+  for (const auto& object_id : object_ids) {
+    bool unused;
+    RETURN_NOT_OK(DecrementObjectCount(object_id, &unused));
+    if (unused) {
+      unused_ids.push_back(object_id);
+      if (deletion_cache_.erase(object_id) > 0) {
+        deleted_ids.push_back(object_id);
+      }
+    }
+  }
+  // Tell the store about all the objects that are no longer needed at once.
+  if (!unused_ids.empty()) {
+    RETURN_NOT_OK(SendReleaseBatchRequest(store_conn_, unused_ids));
+  }
+  if (!deleted_ids.empty()) {
+    RETURN_NOT_OK(Delete(deleted_ids));
+  }
+  return ShrinkReleaseCache(release_cache_capacity_);
 }
 
 // This method is used to query whether the plasma store contains an object.
@@ -759,6 +887,40 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::Contains(const std::vector<ObjectID>& object_ids,
+                                    std::vector<bool>* has_objects) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // Only ask the store about the objects we don't already have a reference to.
+  has_objects->assign(object_ids.size(), false);
+  std::vector<ObjectID> unknown_ids;
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    if (objects_in_use_.count(object_ids[i]) > 0) {
+      (*has_objects)[i] = true;
+    } else {
+      unknown_ids.push_back(object_ids[i]);
+    }
+  }
+  if (unknown_ids.empty()) {
+    return Status::OK();
+  }
+
+  RETURN_NOT_OK(SendContainsBatchRequest(store_conn_, unknown_ids));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(
+      PlasmaReceive(store_conn_, MessageType::PlasmaContainsBatchReply, &buffer));
+  DCHECK_GT(buffer.size(), 0);
+  std::vector<ObjectID> contained_ids;
+  RETURN_NOT_OK(ReadContainsBatchReply(buffer.data(), buffer.size(), &contained_ids));
+  std::unordered_set<ObjectID> contained(contained_ids.begin(), contained_ids.end());
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    if (contained.count(object_ids[i]) > 0) {
+      (*has_objects)[i] = true;
+    }
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::List(ObjectTable* objects) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
   RETURN_NOT_OK(SendListRequest(store_conn_));
@@ -792,7 +954,7 @@ bool PlasmaClient::Impl::ComputeObjectHashParallel(XXH64_state_t* hash_state,
   // | num_threads * chunk_size | suffix |, where chunk_size = k * block_size.
   // Each thread gets a "chunk" of k blocks, except the suffix thread.
 
-  std::vector<std::future<void>> futures;
+  std::vector<arrow::Future<>> futures;
   for (int i = 0; i < num_threads; i++) {
     futures.push_back(*pool->Submit(
         ComputeBlockHash, reinterpret_cast<uint8_t*>(data_address) + i * chunk_size,
@@ -802,7 +964,7 @@ bool PlasmaClient::Impl::ComputeObjectHashParallel(XXH64_state_t* hash_state,
                    &threadhash[num_threads]);
 
   for (auto& fut : futures) {
-    fut.get();
+    fut.Wait();
   }
 
   XXH64_update(hash_state, reinterpret_cast<unsigned char*>(threadhash),
@@ -837,9 +999,7 @@ uint64_t PlasmaClient::Impl::ComputeObjectHashCPU(const uint8_t* data, int64_t d
   return XXH64_digest(&hash_state);
 }
 
-Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
+Status PlasmaClient::Impl::MarkObjectSealed(const ObjectID& object_id) {
   // Make sure this client has a reference to the object before sending the
   // request to Plasma.
   auto object_entry = objects_in_use_.find(object_id);
@@ -854,6 +1014,22 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   }
 
   object_entry->second->is_sealed = true;
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::Prefetch(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  if (object_ids.empty()) {
+    return Status::OK();
+  }
+  return SendPrefetchRequest(store_conn_, object_ids);
+}
+
+Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  RETURN_NOT_OK(MarkObjectSealed(object_id));
   /// Send the seal request to Plasma.
   std::vector<uint8_t> digest(kDigestSize);
   RETURN_NOT_OK(Hash(object_id, &digest[0]));
@@ -867,6 +1043,38 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::Seal(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // Check all the objects before sealing any of them.
+  std::unordered_set<ObjectID> unique_ids;
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry == objects_in_use_.end()) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNonexistent,
+                             "Seal() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed || !unique_ids.insert(object_id).second) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectAlreadySealed,
+                             "Seal() called on an already sealed object");
+    }
+  }
+
+  std::vector<std::string> digests;
+  digests.reserve(object_ids.size());
+  for (const auto& object_id : object_ids) {
+    RETURN_NOT_OK(MarkObjectSealed(object_id));
+    std::vector<uint8_t> digest(kDigestSize);
+    RETURN_NOT_OK(Hash(object_id, &digest[0]));
+    digests.emplace_back(digest.begin(), digest.end());
+  }
+  if (!object_ids.empty()) {
+    RETURN_NOT_OK(SendSealBatchRequest(store_conn_, object_ids, digests));
+  }
+  // Drop the references taken in Create, as in the single object Seal.
+  return Release(object_ids);
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
   auto object_entry = objects_in_use_.find(object_id);
@@ -909,6 +1117,22 @@ Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
 Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
+  // Release the cached objects to delete, so that the store can delete them.
+  std::vector<ObjectID> released_ids;
+  for (auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry != objects_in_use_.end() && object_entry->second->count == 0) {
+      const PlasmaObject& object = object_entry->second->object;
+      release_cache_bytes_ -= object.data_size + object.metadata_size;
+      release_cache_.erase(object_entry->second->release_cache_position);
+      RETURN_NOT_OK(MarkObjectUnused(object_id));
+      released_ids.push_back(object_id);
+    }
+  }
+  if (!released_ids.empty()) {
+    RETURN_NOT_OK(SendReleaseBatchRequest(store_conn_, released_ids));
+  }
+
   std::vector<ObjectID> not_in_use_ids;
   for (auto& object_id : object_ids) {
     // If the object is in used, skip it.
@@ -934,6 +1158,9 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
 Status PlasmaClient::Impl::Evict(int64_t num_bytes, int64_t& num_bytes_evicted) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
+  // Release the cached objects, so that the store can evict them.
+  RETURN_NOT_OK(ShrinkReleaseCache(0));
+
   // Send a request to the store to evict objects.
   RETURN_NOT_OK(SendEvictRequest(store_conn_, num_bytes));
   // Wait for a response with the number of bytes actually evicted.
@@ -1075,6 +1302,16 @@ Status PlasmaClient::Impl::SetClientOptions(const std::string& client_name,
   return ReadSetOptionsReply(buffer.data(), buffer.size());
 }
 
+Status PlasmaClient::Impl::SetReleaseCacheCapacity(int64_t capacity) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  if (capacity < 0) {
+    return Status::Invalid("Release cache capacity must be non-negative");
+  }
+  // Leave the store enough memory it can evict.
+  release_cache_capacity_ = std::min(capacity, store_capacity_ / 4);
+  return ShrinkReleaseCache(release_cache_capacity_);
+}
+
 Status PlasmaClient::Impl::Disconnect() {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
@@ -1124,6 +1361,10 @@ Status PlasmaClient::SetClientOptions(const std::string& client_name,
   return impl_->SetClientOptions(client_name, output_memory_quota);
 }
 
+Status PlasmaClient::SetReleaseCacheCapacity(int64_t capacity) {
+  return impl_->SetReleaseCacheCapacity(capacity);
+}
+
 Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
                             const uint8_t* metadata, int64_t metadata_size,
                             std::shared_ptr<Buffer>* data, int device_num) {
@@ -1155,16 +1396,33 @@ Status PlasmaClient::Release(const ObjectID& object_id) {
   return impl_->Release(object_id);
 }
 
+Status PlasmaClient::Release(const std::vector<ObjectID>& object_ids) {
+  return impl_->Release(object_ids);
+}
+
 Status PlasmaClient::Contains(const ObjectID& object_id, bool* has_object) {
   return impl_->Contains(object_id, has_object);
 }
 
+Status PlasmaClient::Contains(const std::vector<ObjectID>& object_ids,
+                              std::vector<bool>* has_objects) {
+  return impl_->Contains(object_ids, has_objects);
+}
+
+Status PlasmaClient::Prefetch(const std::vector<ObjectID>& object_ids) {
+  return impl_->Prefetch(object_ids);
+}
+
 Status PlasmaClient::List(ObjectTable* objects) { return impl_->List(objects); }
 
 Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(object_id); }
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::Seal(const std::vector<ObjectID>& object_ids) {
+  return impl_->Seal(object_ids);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
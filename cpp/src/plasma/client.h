@@ -72,6 +72,22 @@ class ARROW_EXPORT PlasmaClient {
   ///        this client.
   Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
 
+  /// Keep released objects mapped by this client, so that getting them again
+  /// does not need a round trip to the store.
+  ///
+  /// When the last reference of this client to a sealed object is released, the
+  /// client keeps its reference in the store instead of releasing it, up to
+  /// `capacity` bytes of objects. A later Get() of a cached object is resolved
+  /// locally. While cached, an object can be neither evicted nor deleted by the
+  /// store: the least recently released objects are released for real when the
+  /// cache is over capacity, and Delete() and Evict() on this client first
+  /// release the objects they may need. The capacity is capped to a quarter of
+  /// the store capacity, and defaults to 0 (no caching).
+  ///
+  /// \param capacity The maximum number of bytes of released objects to keep.
+  /// \return The return status.
+  Status SetReleaseCacheCapacity(int64_t capacity);
+
   /// Create an object in the Plasma Store. Any metadata for this object must be
   /// be passed in when the object is created.
   ///
@@ -159,6 +175,13 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Release(const ObjectID& object_id);
 
+  /// Release a list of objects, telling Plasma about all the objects that are
+  /// no longer used by this client with a single message.
+  ///
+  /// \param object_ids The IDs of the objects that are no longer needed.
+  /// \return The return status.
+  Status Release(const std::vector<ObjectID>& object_ids);
+
   /// Check if the object store contains a particular object and the object has
   /// been sealed. The result will be stored in has_object.
   ///
@@ -171,6 +194,25 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Contains(const ObjectID& object_id, bool* has_object);
 
+  /// Check if the object store contains each of a list of sealed objects, with
+  /// at most one request to Plasma.
+  ///
+  /// \param object_ids The IDs of the objects whose presence we are checking.
+  /// \param has_objects The function will store whether each object is present
+  ///        in this vector, in the same order as object_ids.
+  /// \return The return status.
+  Status Contains(const std::vector<ObjectID>& object_ids,
+                  std::vector<bool>* has_objects);
+
+  /// Ask Plasma to restore objects that were evicted to the external store,
+  /// so that a later Get() doesn't have to wait for them. This does not wait
+  /// for the objects to be restored, and does nothing for objects that are not
+  /// evicted or without an external store.
+  ///
+  /// \param object_ids The IDs of the objects to restore.
+  /// \return The return status.
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   /// List all the objects in the object store.
   ///
   /// This API is experimental and might change in the future.
@@ -203,6 +245,13 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal a list of objects in the object store with a single message. None of
+  /// the objects are sealed if one of them can't be.
+  ///
+  /// \param object_ids The IDs of the objects to seal.
+  /// \return The return status.
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -292,6 +341,7 @@ class ARROW_EXPORT PlasmaClient {
   FRIEND_TEST(TestPlasmaStore, GetTest);
   FRIEND_TEST(TestPlasmaStore, LegacyGetTest);
   FRIEND_TEST(TestPlasmaStore, AbortTest);
+  FRIEND_TEST(TestPlasmaStore, ReleaseCacheTest);
 
   bool IsInUse(const ObjectID& object_id);
 
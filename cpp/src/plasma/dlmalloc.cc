@@ -26,6 +26,7 @@
 #include <unistd.h>
 
 #include <cerrno>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -105,6 +106,22 @@ int create_buffer(int64_t size) {
   return fd;
 }
 
+// Fault in all the pages of a new mapping and lock them in memory. Writing to
+// each page rather than using MAP_POPULATE also works on systems where the
+// mapping cannot be locked.
+static void prefault_mapping(void* pointer, size_t size) {
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  volatile uint8_t* bytes = static_cast<uint8_t*>(pointer);
+  for (size_t offset = 0; offset < size; offset += page_size) {
+    bytes[offset] = 0;
+  }
+  if (mlock(pointer, size) != 0) {
+    ARROW_LOG(WARNING) << "failed to lock the memory of the store: "
+                       << std::strerror(errno)
+                       << " (the memory lock limit can be raised with ulimit -l)";
+  }
+}
+
 void* fake_mmap(size_t size) {
   // Add kMmapRegionsGap so that the returned pointer is deliberately not
   // page-aligned. This ensures that the segments of memory returned by
@@ -115,7 +132,8 @@ void* fake_mmap(size_t size) {
   ARROW_CHECK(fd >= 0) << "Failed to create buffer during mmap";
   // MAP_POPULATE can be used to pre-populate the page tables for this memory region
   // which avoids work when accessing the pages later. However it causes long pauses
-  // when mmapping the files. Only supported on Linux.
+  // when mmapping the files. Only supported on Linux. The prefault_memory option
+  // takes this pause at startup instead, see prefault_mapping.
   void* pointer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
   if (pointer == MAP_FAILED) {
     ARROW_LOG(ERROR) << "mmap failed with error: " << std::strerror(errno);
@@ -126,6 +144,17 @@ void* fake_mmap(size_t size) {
     return pointer;
   }
 
+#ifdef MADV_HUGEPAGE
+  if (plasma_config->transparent_hugepages &&
+      madvise(pointer, size, MADV_HUGEPAGE) != 0) {
+    ARROW_LOG(WARNING) << "madvise(MADV_HUGEPAGE) failed with error: "
+                       << std::strerror(errno);
+  }
+#endif
+  if (plasma_config->prefault_memory) {
+    prefault_mapping(pointer, size);
+  }
+
   // Increase dlmalloc's allocation granularity directly.
   mparams.granularity *= GRANULARITY_MULTIPLIER;
 
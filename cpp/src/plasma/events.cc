@@ -20,6 +20,10 @@
 #include <utility>
 
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "arrow/util/logging.h"
 
 extern "C" {
 #include "plasma/thirdparty/ae/ae.h"
@@ -45,7 +49,15 @@ int EventLoop::TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* con
 
 constexpr int kInitialEventLoopSize = 1024;
 
-EventLoop::EventLoop() { loop_ = aeCreateEventLoop(kInitialEventLoopSize); }
+EventLoop::EventLoop() : thread_id_(std::this_thread::get_id()) {
+  loop_ = aeCreateEventLoop(kInitialEventLoopSize);
+  ARROW_CHECK(pipe(wakeup_fds_) == 0);
+  for (int fd : wakeup_fds_) {
+    ARROW_CHECK(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == 0);
+  }
+  ARROW_CHECK(AddFileEvent(wakeup_fds_[0], kEventLoopRead,
+                           [this](int events) { RunPosted(); }));
+}
 
 bool EventLoop::AddFileEvent(int fd, int events, const FileCallback& callback) {
   if (file_callbacks_.find(fd) != file_callbacks_.end()) {
@@ -76,12 +88,56 @@ void EventLoop::RemoveFileEvent(int fd) {
   file_callbacks_.erase(fd);
 }
 
-void EventLoop::Start() { aeMain(loop_); }
+void EventLoop::Post(std::function<void()> callback) {
+  {
+    std::lock_guard<std::mutex> lock(posted_mutex_);
+    posted_.push_back(std::move(callback));
+  }
+  // If the pipe is full, the loop has not drained it yet and will see the
+  // callback anyway.
+  const char byte = 0;
+  ssize_t written = write(wakeup_fds_[1], &byte, 1);
+  ARROW_UNUSED(written);
+}
+
+void EventLoop::RunInLoop(std::function<void()> callback) {
+  if (IsLoopThread()) {
+    callback();
+  } else {
+    Post(std::move(callback));
+  }
+}
+
+bool EventLoop::IsLoopThread() const {
+  return thread_id_.load() == std::this_thread::get_id();
+}
+
+void EventLoop::RunPosted() {
+  char buffer[64];
+  while (read(wakeup_fds_[0], buffer, sizeof(buffer)) > 0) {
+  }
+  std::vector<std::function<void()>> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(posted_mutex_);
+    callbacks.swap(posted_);
+  }
+  for (auto& callback : callbacks) {
+    callback();
+  }
+}
+
+void EventLoop::Start() {
+  thread_id_ = std::this_thread::get_id();
+  aeMain(loop_);
+}
 
 void EventLoop::Stop() { aeStop(loop_); }
 
 void EventLoop::Shutdown() {
   if (loop_ != nullptr) {
+    RemoveFileEvent(wakeup_fds_[0]);
+    close(wakeup_fds_[0]);
+    close(wakeup_fds_[1]);
     aeDeleteEventLoop(loop_);
     loop_ = nullptr;
   }
@@ -18,9 +18,13 @@
 #ifndef PLASMA_EVENTS
 #define PLASMA_EVENTS
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 struct aeEventLoop;
 
@@ -88,6 +92,24 @@ class EventLoop {
   /// \return The ae.c error code. TODO(pcm): needs to be standardized
   int RemoveTimer(int64_t timer_id);
 
+  /// \brief Run a callback on the thread running the event loop.
+  ///
+  /// Unlike the other methods, this may be called from any thread while the
+  /// loop is running. Callbacks run in the order they were posted.
+  ///
+  /// \param callback The callback to run.
+  void Post(std::function<void()> callback);
+
+  /// \brief Run a callback immediately if called from the thread running the
+  /// event loop, otherwise post it.
+  ///
+  /// \param callback The callback to run.
+  void RunInLoop(std::function<void()> callback);
+
+  /// \brief Whether the caller is the thread running the event loop, or the
+  /// thread that created it if it was not started yet.
+  bool IsLoopThread() const;
+
   /// \brief Run the event loop.
   void Start();
 
@@ -101,7 +123,14 @@ class EventLoop {
 
   static int TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* context);
 
+  void RunPosted();
+
   aeEventLoop* loop_;
+  std::atomic<std::thread::id> thread_id_;
+  /// Pipe waking up the loop when callbacks are posted.
+  int wakeup_fds_[2];
+  std::mutex posted_mutex_;
+  std::vector<std::function<void()>> posted_;
   std::unordered_map<int, std::unique_ptr<FileCallback>> file_callbacks_;
   std::unordered_map<int64_t, std::unique_ptr<TimerCallback>> timer_callbacks_;
 };
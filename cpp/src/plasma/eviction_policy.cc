@@ -23,6 +23,17 @@
 
 namespace plasma {
 
+std::unique_ptr<ObjectCache> ObjectCache::Make(EvictionAlgorithm algorithm,
+                                               const std::string& name, int64_t size) {
+  switch (algorithm) {
+    case EvictionAlgorithm::GDSF:
+      return std::unique_ptr<ObjectCache>(new GDSFCache(name, size));
+    case EvictionAlgorithm::LRU:
+    default:
+      return std::unique_ptr<ObjectCache>(new LRUCache(name, size));
+  }
+}
+
 void LRUCache::Add(const ObjectID& key, int64_t size) {
   auto it = item_map_.find(key);
   ARROW_CHECK(it == item_map_.end());
@@ -45,18 +56,18 @@ int64_t LRUCache::Remove(const ObjectID& key) {
   return size;
 }
 
-void LRUCache::AdjustCapacity(int64_t delta) {
+void ObjectCache::AdjustCapacity(int64_t delta) {
   ARROW_LOG(INFO) << "adjusting global lru capacity from " << Capacity() << " to "
                   << (Capacity() + delta) << " (max " << OriginalCapacity() << ")";
   capacity_ += delta;
   ARROW_CHECK(used_capacity_ >= 0) << DebugString();
 }
 
-int64_t LRUCache::Capacity() const { return capacity_; }
+int64_t ObjectCache::Capacity() const { return capacity_; }
 
-int64_t LRUCache::OriginalCapacity() const { return original_capacity_; }
+int64_t ObjectCache::OriginalCapacity() const { return original_capacity_; }
 
-int64_t LRUCache::RemainingCapacity() const { return capacity_ - used_capacity_; }
+int64_t ObjectCache::RemainingCapacity() const { return capacity_ - used_capacity_; }
 
 void LRUCache::Foreach(std::function<void(const ObjectID&)> f) {
   for (auto& pair : item_list_) {
@@ -64,13 +75,13 @@ void LRUCache::Foreach(std::function<void(const ObjectID&)> f) {
   }
 }
 
-std::string LRUCache::DebugString() const {
+std::string ObjectCache::DebugString() const {
   std::stringstream result;
   result << "\n(" << name_ << ") capacity: " << Capacity();
   result << "\n(" << name_
          << ") used: " << 100. * (1. - (RemainingCapacity() / (double)OriginalCapacity()))
          << "%";
-  result << "\n(" << name_ << ") num objects: " << item_map_.size();
+  result << "\n(" << name_ << ") num objects: " << num_objects();
   result << "\n(" << name_ << ") num evictions: " << num_evictions_total_;
   result << "\n(" << name_ << ") bytes evicted: " << bytes_evicted_total_;
   return result.str();
@@ -90,23 +101,76 @@ int64_t LRUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
   return bytes_evicted;
 }
 
-EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size)
-    : pinned_memory_bytes_(0), store_info_(store_info), cache_("global lru", max_size) {}
+void GDSFCache::Add(const ObjectID& key, int64_t size) {
+  ARROW_CHECK(item_map_.find(key) == item_map_.end());
+  int64_t frequency = ++frequencies_[key];
+  double priority =
+      inflation_ + static_cast<double>(frequency) / std::max<int64_t>(size, 1);
+  item_map_.emplace(key, item_queue_.emplace(priority, std::make_pair(key, size)));
+  used_capacity_ += size;
+}
+
+int64_t GDSFCache::Remove(const ObjectID& key) {
+  auto it = item_map_.find(key);
+  if (it == item_map_.end()) {
+    return -1;
+  }
+  int64_t size = it->second->second.second;
+  used_capacity_ -= size;
+  item_queue_.erase(it->second);
+  item_map_.erase(it);
+  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
+  return size;
+}
+
+void GDSFCache::Forget(const ObjectID& key) { frequencies_.erase(key); }
+
+int64_t GDSFCache::ChooseObjectsToEvict(int64_t num_bytes_required,
+                                        std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  auto it = item_queue_.begin();
+  while (bytes_evicted < num_bytes_required && it != item_queue_.end()) {
+    const auto& key = it->second.first;
+    objects_to_evict->push_back(key);
+    bytes_evicted += it->second.second;
+    bytes_evicted_total_ += it->second.second;
+    num_evictions_total_ += 1;
+    // The objects are going to leave the store, and the objects added from now
+    // on have to compete with the evicted ones.
+    inflation_ = it->first;
+    frequencies_.erase(key);
+    ++it;
+  }
+  return bytes_evicted;
+}
+
+void GDSFCache::Foreach(std::function<void(const ObjectID&)> f) {
+  for (auto& item : item_queue_) {
+    f(item.second.first);
+  }
+}
+
+EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                               EvictionAlgorithm algorithm)
+    : algorithm_(algorithm),
+      pinned_memory_bytes_(0),
+      store_info_(store_info),
+      cache_(ObjectCache::Make(algorithm, "global lru", max_size)) {}
 
 int64_t EvictionPolicy::ChooseObjectsToEvict(int64_t num_bytes_required,
                                              std::vector<ObjectID>* objects_to_evict) {
   int64_t bytes_evicted =
-      cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
+      cache_->ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
   // Update the LRU cache.
   for (auto& object_id : *objects_to_evict) {
-    cache_.Remove(object_id);
+    cache_->Remove(object_id);
   }
   return bytes_evicted;
 }
 
 void EvictionPolicy::ObjectCreated(const ObjectID& object_id, Client* client,
                                    bool is_create) {
-  cache_.Add(object_id, GetObjectSize(object_id));
+  cache_->Add(object_id, GetObjectSize(object_id));
 }
 
 bool EvictionPolicy::SetClientQuota(Client* client, int64_t output_memory_quota) {
@@ -140,27 +204,28 @@ bool EvictionPolicy::RequireSpace(int64_t size, std::vector<ObjectID>* objects_t
 
 void EvictionPolicy::BeginObjectAccess(const ObjectID& object_id) {
   // If the object is in the LRU cache, remove it.
-  cache_.Remove(object_id);
+  cache_->Remove(object_id);
   pinned_memory_bytes_ += GetObjectSize(object_id);
 }
 
 void EvictionPolicy::EndObjectAccess(const ObjectID& object_id) {
   auto size = GetObjectSize(object_id);
   // Add the object to the LRU cache.
-  cache_.Add(object_id, size);
+  cache_->Add(object_id, size);
   pinned_memory_bytes_ -= size;
 }
 
 void EvictionPolicy::RemoveObject(const ObjectID& object_id) {
   // If the object is in the LRU cache, remove it.
-  cache_.Remove(object_id);
+  cache_->Remove(object_id);
+  cache_->Forget(object_id);
 }
 
 void EvictionPolicy::RefreshObjects(const std::vector<ObjectID>& object_ids) {
   for (const auto& object_id : object_ids) {
-    int64_t size = cache_.Remove(object_id);
+    int64_t size = cache_->Remove(object_id);
     if (size != -1) {
-      cache_.Add(object_id, size);
+      cache_->Add(object_id, size);
     }
   }
 }
@@ -170,6 +235,40 @@ int64_t EvictionPolicy::GetObjectSize(const ObjectID& object_id) const {
   return entry->data_size + entry->metadata_size;
 }
 
-std::string EvictionPolicy::DebugString() const { return cache_.DebugString(); }
+void EvictionPolicy::RecordLookup(bool hit) {
+  if (hit) {
+    metrics_.hits += 1;
+  } else {
+    metrics_.misses += 1;
+  }
+}
+
+void EvictionPolicy::RecordEvictionTime(int64_t nanoseconds) {
+  metrics_.num_eviction_rounds += 1;
+  metrics_.eviction_time_ns += nanoseconds;
+}
+
+EvictionMetrics EvictionPolicy::metrics() const {
+  EvictionMetrics metrics = metrics_;
+  metrics.num_evictions = cache_->num_evictions_total();
+  metrics.bytes_evicted = cache_->bytes_evicted_total();
+  return metrics;
+}
+
+std::string EvictionPolicy::MetricsDebugString() const {
+  EvictionMetrics metrics = this->metrics();
+  std::stringstream result;
+  result << "\nhit rate: " << metrics.hit_rate() << " (" << metrics.hits << " hits, "
+         << metrics.misses << " misses)";
+  result << "\nnum evictions: " << metrics.num_evictions;
+  result << "\nbytes evicted: " << metrics.bytes_evicted;
+  result << "\neviction time: " << metrics.eviction_time_ns / 1000 << " us in "
+         << metrics.num_eviction_rounds << " rounds";
+  return result.str();
+}
+
+std::string EvictionPolicy::DebugString() const {
+  return cache_->DebugString() + MetricsDebugString();
+}
 
 }  // namespace plasma
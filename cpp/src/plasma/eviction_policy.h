@@ -20,6 +20,8 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -38,9 +40,20 @@ namespace plasma {
 //
 // It does not implement memory quotas; see quota_aware_policy for that.
 
-class LRUCache {
+/// The order in which unused objects are evicted.
+enum class EvictionAlgorithm {
+  /// Evict the least recently used objects first.
+  LRU,
+  /// Greedy-Dual-Size-Frequency: evict the objects with the fewest accesses per
+  /// byte first, aged so that objects not accessed for a while are evicted
+  /// eventually. This keeps many small hot objects over a large one.
+  GDSF,
+};
+
+/// A set of unused objects, from which objects are chosen for eviction.
+class ObjectCache {
  public:
-  LRUCache(const std::string& name, int64_t size)
+  ObjectCache(const std::string& name, int64_t size)
       : name_(name),
         original_capacity_(size),
         capacity_(size),
@@ -48,12 +61,28 @@ class LRUCache {
         num_evictions_total_(0),
         bytes_evicted_total_(0) {}
 
-  void Add(const ObjectID& key, int64_t size);
+  virtual ~ObjectCache() = default;
 
-  int64_t Remove(const ObjectID& key);
+  /// Create a cache evicting objects with the given algorithm.
+  static std::unique_ptr<ObjectCache> Make(EvictionAlgorithm algorithm,
+                                           const std::string& name, int64_t size);
 
-  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
-                               std::vector<ObjectID>* objects_to_evict);
+  virtual void Add(const ObjectID& key, int64_t size) = 0;
+
+  /// Remove an object from the cache, returning its size or -1 if it is not
+  /// in the cache.
+  virtual int64_t Remove(const ObjectID& key) = 0;
+
+  /// Forget what the cache knows about an object that left the store.
+  virtual void Forget(const ObjectID& key) {}
+
+  virtual int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                                       std::vector<ObjectID>* objects_to_evict) = 0;
+
+  virtual void Foreach(std::function<void(const ObjectID&)>) = 0;
+
+  /// The number of objects in the cache.
+  virtual int64_t num_objects() const = 0;
 
   int64_t OriginalCapacity() const;
 
@@ -63,19 +92,13 @@ class LRUCache {
 
   void AdjustCapacity(int64_t delta);
 
-  void Foreach(std::function<void(const ObjectID&)>);
+  int64_t num_evictions_total() const { return num_evictions_total_; }
 
-  std::string DebugString() const;
+  int64_t bytes_evicted_total() const { return bytes_evicted_total_; }
 
- private:
-  /// A doubly-linked list containing the items in the cache and
-  /// their sizes in LRU order.
-  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
-  ItemList item_list_;
-  /// A hash table mapping the object ID of an object in the cache to its
-  /// location in the doubly linked list item_list_.
-  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+  std::string DebugString() const;
 
+ protected:
   /// The name of this cache, used for debugging purposes only.
   const std::string name_;
   /// The original (max) capacity of this cache in bytes.
@@ -90,6 +113,91 @@ class LRUCache {
   int64_t bytes_evicted_total_;
 };
 
+class LRUCache : public ObjectCache {
+ public:
+  LRUCache(const std::string& name, int64_t size) : ObjectCache(name, size) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  int64_t Remove(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  int64_t num_objects() const override { return item_map_.size(); }
+
+ private:
+  /// A doubly-linked list containing the items in the cache and
+  /// their sizes in LRU order.
+  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
+  ItemList item_list_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in the doubly linked list item_list_.
+  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+};
+
+/// A cache evicting objects with the Greedy-Dual-Size-Frequency algorithm. The
+/// priority of an object is the priority of the last evicted object plus the
+/// number of times the object was added to the cache, divided by its size.
+class GDSFCache : public ObjectCache {
+ public:
+  GDSFCache(const std::string& name, int64_t size)
+      : ObjectCache(name, size), inflation_(0) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  int64_t Remove(const ObjectID& key) override;
+
+  void Forget(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  int64_t num_objects() const override { return item_map_.size(); }
+
+ private:
+  /// The objects in the cache by increasing priority. Objects with the same
+  /// priority are kept in insertion order.
+  typedef std::multimap<double, std::pair<ObjectID, int64_t>> ItemQueue;
+  ItemQueue item_queue_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in item_queue_.
+  std::unordered_map<ObjectID, ItemQueue::iterator> item_map_;
+  /// The number of accesses of the objects in the store, which are kept while
+  /// the objects are in use.
+  std::unordered_map<ObjectID, int64_t> frequencies_;
+  /// The priority of the last evicted object, added to the priority of newly
+  /// added objects.
+  double inflation_;
+};
+
+/// Metrics of an eviction policy.
+struct EvictionMetrics {
+  /// The number of objects requested by get requests which were in memory.
+  int64_t hits = 0;
+  /// The number of objects requested by get requests which had been evicted to
+  /// the external store. Without an external store, evicted objects are deleted
+  /// and requests for them are not counted.
+  int64_t misses = 0;
+  /// The number of objects chosen for eviction.
+  int64_t num_evictions = 0;
+  /// The number of bytes chosen for eviction.
+  int64_t bytes_evicted = 0;
+  /// The number of times objects were evicted to make room for an allocation.
+  int64_t num_eviction_rounds = 0;
+  /// The total time spent evicting objects to make room, in nanoseconds.
+  int64_t eviction_time_ns = 0;
+
+  /// The fraction of requested objects which were in memory.
+  double hit_rate() const {
+    return hits + misses == 0 ? 1.0 : static_cast<double>(hits) / (hits + misses);
+  }
+};
+
 /// The eviction policy.
 class EvictionPolicy {
  public:
@@ -98,7 +206,9 @@ class EvictionPolicy {
   /// @param store_info Information about the Plasma store that is exposed
   ///        to the eviction policy.
   /// @param max_size Max size in bytes total of objects to store.
-  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size);
+  /// @param algorithm The order in which unused objects are evicted.
+  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                          EvictionAlgorithm algorithm = EvictionAlgorithm::LRU);
 
   /// Destroy an eviction policy.
   virtual ~EvictionPolicy() {}
@@ -194,17 +304,41 @@ class EvictionPolicy {
   /// Returns debugging information for this eviction policy.
   virtual std::string DebugString() const;
 
+  /// Record whether an object requested by a get request was in memory or had
+  /// been evicted to the external store.
+  ///
+  /// @param hit Whether the object was in memory.
+  void RecordLookup(bool hit);
+
+  /// Record the time the store spent evicting objects to make room for an
+  /// allocation.
+  ///
+  /// @param nanoseconds The duration of the eviction.
+  void RecordEvictionTime(int64_t nanoseconds);
+
+  /// Returns the metrics of this eviction policy.
+  virtual EvictionMetrics metrics() const;
+
  protected:
   /// Returns the size of the object
   int64_t GetObjectSize(const ObjectID& object_id) const;
 
+  /// Returns the metrics formatted for DebugString.
+  std::string MetricsDebugString() const;
+
+  /// The order in which unused objects are evicted.
+  EvictionAlgorithm algorithm_;
+
   /// The number of bytes pinned by applications.
   int64_t pinned_memory_bytes_;
 
   /// Pointer to the plasma store info.
   PlasmaStoreInfo* store_info_;
-  /// Datastructure for the LRU cache.
-  LRUCache cache_;
+  /// Datastructure for the global cache of unused objects.
+  std::unique_ptr<ObjectCache> cache_;
+  /// The lookup and eviction time metrics. The eviction counts are kept by the
+  /// caches.
+  EvictionMetrics metrics_;
 };
 
 }  // namespace plasma
@@ -32,6 +32,10 @@ namespace plasma {
 // This file contains declaration for all functions that need to be implemented
 // for an external storage service so that objects evicted from Plasma store
 // can be written to it.
+//
+// Put and Get are called from a pool of background threads, so that the store
+// keeps serving its clients while objects are written or read. They may be
+// called concurrently and must be thread-safe.
 
 class ExternalStore {
  public:
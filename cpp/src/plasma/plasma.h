@@ -46,6 +46,8 @@ using arrow::cuda::CudaIpcMemHandle;
 
 namespace plasma {
 
+class EventLoop;
+
 namespace flatbuf {
 struct ObjectInfoT;
 }  // namespace flatbuf
@@ -77,6 +79,9 @@ struct Client {
   /// The file descriptor used to communicate with the client.
   int fd;
 
+  /// The event loop handling the messages of the client.
+  EventLoop* loop = nullptr;
+
   /// Object ids that are used by this client.
   std::unordered_set<ObjectID> object_ids;
 
@@ -138,6 +143,12 @@ struct PlasmaStoreInfo {
   /// pages (e.g. 2MB or 1GB instead of 4KB) and using them can reduce
   /// bookkeeping overhead from the OS.
   bool hugepages_enabled;
+  /// Whether to fault in and lock the memory of the store when it is mapped,
+  /// so that the first writes of the clients don't pay for page faults.
+  bool prefault_memory = false;
+  /// Whether to ask the kernel to back the memory of the store with
+  /// transparent huge pages, which doesn't require a huge page file system.
+  bool transparent_hugepages = false;
   /// A (platform-dependent) directory where to create the memory-backed file.
   std::string directory;
 };
@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <mutex>
+
 #include <arrow/util/logging.h>
 
 #include "plasma/malloc.h"
@@ -30,7 +32,15 @@ void dlfree(void* mem);
 int64_t PlasmaAllocator::footprint_limit_ = 0;
 int64_t PlasmaAllocator::allocated_ = 0;
 
+namespace {
+
+// dlmalloc is built without locks
+std::mutex allocator_mutex;
+
+}  // namespace
+
 void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes) {
+  std::lock_guard<std::mutex> lock(allocator_mutex);
   if (allocated_ + static_cast<int64_t>(bytes) > footprint_limit_) {
     return nullptr;
   }
@@ -41,6 +51,7 @@ void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes) {
 }
 
 void PlasmaAllocator::Free(void* mem, size_t bytes) {
+  std::lock_guard<std::mutex> lock(allocator_mutex);
   dlfree(mem);
   allocated_ -= bytes;
 }
@@ -51,6 +62,9 @@ void PlasmaAllocator::SetFootprintLimit(size_t bytes) {
 
 int64_t PlasmaAllocator::GetFootprintLimit() { return footprint_limit_; }
 
-int64_t PlasmaAllocator::Allocated() { return allocated_; }
+int64_t PlasmaAllocator::Allocated() {
+  std::lock_guard<std::mutex> lock(allocator_mutex);
+  return allocated_;
+}
 
 }  // namespace plasma
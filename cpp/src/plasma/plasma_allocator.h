@@ -23,6 +23,8 @@
 
 namespace plasma {
 
+/// Allocates objects in the memory mapped files of the store. All methods
+/// are thread-safe.
 class PlasmaAllocator {
  public:
   /// Allocates size bytes and returns a pointer to the allocated memory. The
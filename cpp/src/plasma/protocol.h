@@ -135,6 +135,12 @@ Status SendSealReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests);
+
+Status ReadSealBatchRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests);
+
 /* Plasma Get message functions. */
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
@@ -162,6 +168,17 @@ Status SendReleaseReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadReleaseReply(uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendReleaseBatchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadReleaseBatchRequest(uint8_t* data, size_t size,
+                               std::vector<ObjectID>* object_ids);
+
+/* Plasma Prefetch message functions. */
+
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadPrefetchRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids);
+
 /* Plasma Delete objects message functions. */
 
 Status SendDeleteRequest(int sock, const std::vector<ObjectID>& object_ids);
@@ -185,6 +202,16 @@ Status SendContainsReply(int sock, ObjectID object_id, bool has_object);
 Status ReadContainsReply(uint8_t* data, size_t size, ObjectID* object_id,
                          bool* has_object);
 
+Status SendContainsBatchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadContainsBatchRequest(uint8_t* data, size_t size,
+                                std::vector<ObjectID>* object_ids);
+
+Status SendContainsBatchReply(int sock, const std::vector<ObjectID>& contained_ids);
+
+Status ReadContainsBatchReply(uint8_t* data, size_t size,
+                              std::vector<ObjectID>* contained_ids);
+
 /* Plasma List message functions. */
 
 Status SendListRequest(int sock);
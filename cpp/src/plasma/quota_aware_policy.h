@@ -60,7 +60,10 @@ class QuotaAwarePolicy : public EvictionPolicy {
   /// @param store_info Information about the Plasma store that is exposed
   ///        to the eviction policy.
   /// @param max_size Max size in bytes total of objects to store.
-  explicit QuotaAwarePolicy(PlasmaStoreInfo* store_info, int64_t max_size);
+  /// @param algorithm The order in which unused objects are evicted, from both
+  ///        the global and the per-client queues.
+  explicit QuotaAwarePolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                            EvictionAlgorithm algorithm = EvictionAlgorithm::LRU);
   void ObjectCreated(const ObjectID& object_id, Client* client, bool is_create) override;
   bool SetClientQuota(Client* client, int64_t output_memory_quota) override;
   bool EnforcePerClientQuota(Client* client, int64_t size, bool is_create,
@@ -71,13 +74,14 @@ class QuotaAwarePolicy : public EvictionPolicy {
   void RemoveObject(const ObjectID& object_id) override;
   void RefreshObjects(const std::vector<ObjectID>& object_ids) override;
   std::string DebugString() const override;
+  EvictionMetrics metrics() const override;
 
  private:
   /// Returns whether we are enforcing memory quotas for an operation.
   bool HasQuota(Client* client, bool is_create);
 
-  /// Per-client LRU caches, if quota is enabled.
-  std::unordered_map<Client*, std::unique_ptr<LRUCache>> per_client_cache_;
+  /// Per-client caches, if quota is enabled.
+  std::unordered_map<Client*, std::unique_ptr<ObjectCache>> per_client_cache_;
   /// Tracks which client created which object. This only applies to clients
   /// that have a memory quota set.
   std::unordered_map<ObjectID, Client*> owned_by_client_;
@@ -18,10 +18,10 @@
 // PLASMA STORE: This is a simple object store server process
 //
 // It accepts incoming client connections on a unix domain socket
-// (name passed in via the -s option of the executable) and uses a
-// single thread to serve the clients. Each client establishes a
-// connection and can create objects, wait for objects and seal
-// objects through that connection.
+// (name passed in via the -s option of the executable) and serves the
+// clients from one or more event loop threads (set with the -t option).
+// Each client establishes a connection and can create objects, wait for
+// objects and seal objects through that connection.
 //
 // It keeps a hash table that maps object_ids (which are 20 byte long,
 // just enough to store and SHA1 hash) to memory mapped files.
@@ -43,16 +43,20 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <chrono>
 #include <ctime>
 #include <deque>
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/thread_pool.h"
 
 #include "plasma/common.h"
 #include "plasma/common_generated.h"
@@ -79,10 +83,22 @@ namespace plasma {
 
 void SetMallocGranularity(int value);
 
+// The number of threads writing objects to and reading objects from the
+// external store.
+constexpr int kExternalStoreThreads = 4;
+
+static int64_t ElapsedNanoseconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
 struct GetRequest {
   GetRequest(Client* client, const std::vector<ObjectID>& object_ids);
   /// The client that called get.
   Client* client;
+  /// The ID of the request in timed_get_requests_, if it has a timer.
+  int64_t id;
   /// The ID of the timer that will time out and cause this wait to return to
   ///  the client if it hasn't already returned.
   int64_t timer;
@@ -100,6 +116,7 @@ struct GetRequest {
 
 GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
     : client(client),
+      id(-1),
       timer(-1),
       object_ids(object_ids.begin(), object_ids.end()),
       objects(object_ids.size()),
@@ -110,14 +127,68 @@ GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
 
 Client::Client(int fd) : fd(fd), notification_fd(-1) {}
 
+// Locks the stripes of some objects, or all the stripes. They are locked in
+// index order, so that requests locking several stripes can't deadlock.
+class PlasmaStore::StripeLock {
+ public:
+  explicit StripeLock(PlasmaStore* store) : store_(store), stripes_(~0u) { Lock(); }
+
+  StripeLock(PlasmaStore* store, const std::vector<ObjectID>& object_ids)
+      : store_(store), stripes_(0) {
+    for (const auto& object_id : object_ids) {
+      stripes_ |= 1u << (object_id.hash() % kNumStripes);
+    }
+    Lock();
+  }
+
+  ~StripeLock() {
+    for (int i = kNumStripes - 1; i >= 0; --i) {
+      if (stripes_ & (1u << i)) {
+        store_->stripe_mutexes_[i].unlock();
+      }
+    }
+  }
+
+ private:
+  void Lock() {
+    for (int i = 0; i < kNumStripes; ++i) {
+      if (stripes_ & (1u << i)) {
+        store_->stripe_mutexes_[i].lock();
+      }
+    }
+  }
+
+  PlasmaStore* store_;
+  uint32_t stripes_;
+};
+
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
-                         std::shared_ptr<ExternalStore> external_store)
-    : loop_(loop),
-      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit()),
+                         std::shared_ptr<ExternalStore> external_store,
+                         EvictionAlgorithm eviction_algorithm, bool prefault_memory,
+                         bool transparent_hugepages)
+    : PlasmaStore(std::vector<EventLoop*>{loop}, std::move(directory), hugepages_enabled,
+                  socket_name, std::move(external_store), eviction_algorithm,
+                  prefault_memory, transparent_hugepages) {}
+
+PlasmaStore::PlasmaStore(std::vector<EventLoop*> loops, std::string directory,
+                         bool hugepages_enabled, const std::string& socket_name,
+                         std::shared_ptr<ExternalStore> external_store,
+                         EvictionAlgorithm eviction_algorithm, bool prefault_memory,
+                         bool transparent_hugepages)
+    : loops_(std::move(loops)),
+      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit(),
+                       eviction_algorithm),
       external_store_(external_store) {
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
+  store_info_.prefault_memory = prefault_memory;
+  store_info_.transparent_hugepages = transparent_hugepages;
+  if (external_store_) {
+    auto maybe_pool = arrow::internal::ThreadPool::Make(kExternalStoreThreads);
+    ARROW_CHECK_OK(maybe_pool.status());
+    external_store_pool_ = *maybe_pool;
+  }
 #ifdef PLASMA_CUDA
   auto maybe_manager = CudaDeviceManager::Instance();
   DCHECK_OK(maybe_manager.status());
@@ -126,7 +197,13 @@ PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
-PlasmaStore::~PlasmaStore() {}
+PlasmaStore::~PlasmaStore() {
+  // Wait for the pending external store operations. Their completion callbacks
+  // are posted to the event loops, which are not running anymore.
+  if (external_store_pool_) {
+    ARROW_CHECK_OK(external_store_pool_->Shutdown());
+  }
+}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
@@ -142,6 +219,7 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
   // that the object is being used.
   if (entry->ref_count == 0) {
     // Tell the eviction policy that this object is being used.
+    std::lock_guard<std::mutex> lock(eviction_mutex_);
     eviction_policy_.BeginObjectAccess(object_id);
   }
   // Increase reference count.
@@ -156,12 +234,16 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, int* fd, int64_t* map_size,
                                      ptrdiff_t* offset, Client* client, bool is_create) {
   // First free up space from the client's LRU queue if quota enforcement is on.
   std::vector<ObjectID> client_objects_to_evict;
+  auto start = std::chrono::steady_clock::now();
   bool quota_ok = eviction_policy_.EnforcePerClientQuota(client, size, is_create,
                                                          &client_objects_to_evict);
   if (!quota_ok) {
     return nullptr;
   }
-  EvictObjects(client_objects_to_evict);
+  if (!client_objects_to_evict.empty()) {
+    EvictObjects(client_objects_to_evict);
+    eviction_policy_.RecordEvictionTime(ElapsedNanoseconds(start));
+  }
 
   // Try to evict objects until there is enough space.
   uint8_t* pointer = nullptr;
@@ -179,8 +261,10 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, int* fd, int64_t* map_size,
     }
     // Tell the eviction policy how much space we need to create this object.
     std::vector<ObjectID> objects_to_evict;
+    start = std::chrono::steady_clock::now();
     bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
     EvictObjects(objects_to_evict);
+    eviction_policy_.RecordEvictionTime(ElapsedNanoseconds(start));
     // Return an error to the client if not enough space could be freed to
     // create the object.
     if (!success) {
@@ -326,7 +410,16 @@ void PlasmaStore::RemoveGetRequest(GetRequest* get_request) {
   }
   // Remove the get request.
   if (get_request->timer != -1) {
-    ARROW_CHECK(loop_->RemoveTimer(get_request->timer) == kEventLoopOk);
+    timed_get_requests_.erase(get_request->id);
+    EventLoop* loop = get_request->client->loop;
+    int64_t timer = get_request->timer;
+    if (loop->IsLoopThread()) {
+      ARROW_CHECK(loop->RemoveTimer(timer) == kEventLoopOk);
+    } else {
+      // The timer may fire before it is removed, but it won't find the request
+      // in timed_get_requests_ anymore.
+      loop->Post([loop, timer]() { loop->RemoveTimer(timer); });
+    }
   }
   delete get_request;
 }
@@ -438,11 +531,19 @@ void PlasmaStore::ProcessGetRequest(Client* client,
   // Create a get request for this object.
   auto get_req = new GetRequest(client, object_ids);
   std::vector<ObjectID> evicted_ids;
-  std::vector<ObjectTableEntry*> evicted_entries;
   for (auto object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (entry && entry->state == ObjectState::PLASMA_SEALED) {
+      eviction_policy_.RecordLookup(true);
+    }
+    // An evicted object that is still being written to the external store
+    // can be restored right away.
+    if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
+      eviction_policy_.RecordLookup(false);
+      RestoreFromSpillBuffer(object_id, entry, client);
+    }
     // Check if this object is already present locally. If so, record that the
     // object is being used and mark it as accounted for.
-    auto entry = GetObjectTableEntry(&store_info_, object_id);
     if (entry && entry->state == ObjectState::PLASMA_SEALED) {
       // Update the get request to take into account the present object.
       PlasmaObject_init(&get_req->objects[object_id], entry);
@@ -450,26 +551,13 @@ void PlasmaStore::ProcessGetRequest(Client* client,
       // If necessary, record that this client is using this object. In the case
       // where entry == NULL, this will be called from SealObject.
       AddToClientObjectIds(object_id, entry, client);
-    } else if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
-      // Make sure the object pointer is not already allocated
-      ARROW_CHECK(!entry->pointer);
-
-      entry->pointer = AllocateMemory(entry->data_size + entry->metadata_size, &entry->fd,
-                                      &entry->map_size, &entry->offset, client, false);
-      if (entry->pointer) {
-        entry->state = ObjectState::PLASMA_CREATED;
-        entry->create_time = std::time(nullptr);
-        eviction_policy_.ObjectCreated(object_id, client, false);
-        AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
+    } else {
+      // Other evicted objects are read from the external store in the
+      // background, and the get request waits for them like for objects that
+      // are not sealed yet.
+      if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
         evicted_ids.push_back(object_id);
-        evicted_entries.push_back(entry);
-      } else {
-        // We are out of memory and cannot allocate memory for this object.
-        // Change the state of the object back to PLASMA_EVICTED so some
-        // other request can try again.
-        entry->state = ObjectState::PLASMA_EVICTED;
       }
-    } else {
       // Add a placeholder plasma object to the get request to indicate that the
       // object is not present. This will be parsed by the client. We set the
       // data size to -1 to indicate that the object is not present.
@@ -479,33 +567,6 @@ void PlasmaStore::ProcessGetRequest(Client* client,
     }
   }
 
-  if (!evicted_ids.empty()) {
-    unsigned char digest[kDigestSize];
-    std::vector<std::shared_ptr<Buffer>> buffers;
-    for (size_t i = 0; i < evicted_ids.size(); ++i) {
-      ARROW_CHECK(evicted_entries[i]->pointer != nullptr);
-      buffers.emplace_back(new arrow::MutableBuffer(evicted_entries[i]->pointer,
-                                                    evicted_entries[i]->data_size));
-    }
-    if (external_store_->Get(evicted_ids, buffers).ok()) {
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_SEALED;
-        std::memcpy(&evicted_entries[i]->digest[0], &digest[0], kDigestSize);
-        evicted_entries[i]->construct_duration =
-            std::time(nullptr) - evicted_entries[i]->create_time;
-        PlasmaObject_init(&get_req->objects[evicted_ids[i]], evicted_entries[i]);
-        get_req->num_satisfied += 1;
-      }
-    } else {
-      // We tried to get the objects from the external store, but could not get them.
-      // Set the state of these objects back to PLASMA_EVICTED so some other request
-      // can try again.
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_EVICTED;
-      }
-    }
-  }
-
   // If all of the objects are present already or if the timeout is 0, return to
   // the client.
   if (get_req->num_satisfied == get_req->num_objects_to_wait_for || timeout_ms == 0) {
@@ -513,11 +574,121 @@ void PlasmaStore::ProcessGetRequest(Client* client,
   } else if (timeout_ms != -1) {
     // Set a timer that will cause the get request to return to the client. Note
     // that a timeout of -1 is used to indicate that no timer should be set.
-    get_req->timer = loop_->AddTimer(timeout_ms, [this, get_req](int64_t timer_id) {
-      ReturnFromGet(get_req);
+    // This runs on the loop of the client, which owns the timer.
+    int64_t id = next_get_request_id_++;
+    get_req->id = id;
+    timed_get_requests_[id] = get_req;
+    get_req->timer = client->loop->AddTimer(timeout_ms, [this, id](int64_t timer_id) {
+      StripeLock lock(this);
+      auto it = timed_get_requests_.find(id);
+      if (it != timed_get_requests_.end()) {
+        ReturnFromGet(it->second);
+      }
       return kEventLoopTimerDone;
     });
   }
+
+  // The get request may have returned already, it is not used from here on.
+  RestoreObjects(evicted_ids, client);
+}
+
+bool PlasmaStore::AllocateEvictedObject(const ObjectID& object_id,
+                                        ObjectTableEntry* entry, Client* client) {
+  // Make sure the object pointer is not already allocated
+  ARROW_CHECK(!entry->pointer);
+
+  entry->pointer = AllocateMemory(entry->data_size + entry->metadata_size, &entry->fd,
+                                  &entry->map_size, &entry->offset, client, false);
+  if (!entry->pointer) {
+    // We are out of memory and cannot allocate memory for this object. It stays
+    // evicted so some other request can try again.
+    return false;
+  }
+  entry->state = ObjectState::PLASMA_CREATED;
+  entry->create_time = std::time(nullptr);
+  eviction_policy_.ObjectCreated(object_id, client, false);
+  return true;
+}
+
+bool PlasmaStore::RestoreFromSpillBuffer(const ObjectID& object_id,
+                                         ObjectTableEntry* entry, Client* client) {
+  auto it = spilling_objects_.find(object_id);
+  if (it == spilling_objects_.end()) {
+    return false;
+  }
+  // Allocating memory may evict other objects and invalidate the iterator.
+  std::shared_ptr<Buffer> data = it->second;
+  if (!AllocateEvictedObject(object_id, entry, client)) {
+    return false;
+  }
+  std::memcpy(entry->pointer, data->data(), static_cast<size_t>(data->size()));
+  entry->state = ObjectState::PLASMA_SEALED;
+  entry->construct_duration = std::time(nullptr) - entry->create_time;
+  // The pending write to the external store will find the copy gone.
+  spilling_objects_.erase(object_id);
+  return true;
+}
+
+void PlasmaStore::RestoreObjects(const std::vector<ObjectID>& object_ids,
+                                 Client* client) {
+  std::vector<ObjectID> restored_ids;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (!entry || entry->state != ObjectState::PLASMA_EVICTED) {
+      continue;
+    }
+    if (RestoreFromSpillBuffer(object_id, entry, client)) {
+      UpdateObjectGetRequests(object_id);
+      continue;
+    }
+    if (!AllocateEvictedObject(object_id, entry, client)) {
+      continue;
+    }
+    // The object can't be evicted until it is read back.
+    eviction_policy_.BeginObjectAccess(object_id);
+    restoring_objects_.insert(object_id);
+    restored_ids.push_back(object_id);
+    buffers.emplace_back(new arrow::MutableBuffer(
+        entry->pointer, entry->data_size + entry->metadata_size));
+  }
+  if (restored_ids.empty()) {
+    return;
+  }
+
+  ARROW_CHECK_OK(external_store_pool_->Spawn([this, restored_ids, buffers]() {
+    Status status = external_store_->Get(restored_ids, buffers);
+    loops_[0]->Post([this, restored_ids, status]() {
+      StripeLock lock(this);
+      FinishRestore(restored_ids, status);
+    });
+  }));
+}
+
+void PlasmaStore::FinishRestore(const std::vector<ObjectID>& object_ids,
+                                const Status& status) {
+  if (!status.ok()) {
+    ARROW_LOG(WARNING) << "Failed to read " << object_ids.size()
+                       << " objects from the external store: " << status;
+  }
+  for (const auto& object_id : object_ids) {
+    restoring_objects_.erase(object_id);
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    ARROW_CHECK(entry != nullptr && entry->state == ObjectState::PLASMA_CREATED);
+    eviction_policy_.EndObjectAccess(object_id);
+    if (status.ok()) {
+      entry->state = ObjectState::PLASMA_SEALED;
+      entry->construct_duration = std::time(nullptr) - entry->create_time;
+      UpdateObjectGetRequests(object_id);
+    } else {
+      // Set the state of the object back to PLASMA_EVICTED so some other
+      // request can try again.
+      eviction_policy_.RemoveObject(object_id);
+      PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+      entry->pointer = nullptr;
+      entry->state = ObjectState::PLASMA_EVICTED;
+    }
+  }
 }
 
 int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
@@ -533,11 +704,13 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
     if (entry->ref_count == 0) {
       if (deletion_cache_.count(object_id) == 0) {
         // Tell the eviction policy that this object is no longer being used.
+        std::lock_guard<std::mutex> lock(eviction_mutex_);
         eviction_policy_.EndObjectAccess(object_id);
       } else {
         // Above code does not really delete an object. Instead, it just put an
         // object to LRU cache which will be cleaned when the memory is not enough.
         deletion_cache_.erase(object_id);
+        eviction_policy_.RemoveObject(object_id);
         EvictObjects({object_id});
       }
     }
@@ -573,13 +746,23 @@ void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
 ObjectStatus PlasmaStore::ContainsObject(const ObjectID& object_id) {
   auto entry = GetObjectTableEntry(&store_info_, object_id);
   return entry && (entry->state == ObjectState::PLASMA_SEALED ||
-                   entry->state == ObjectState::PLASMA_EVICTED)
+                   entry->state == ObjectState::PLASMA_EVICTED ||
+                   restoring_objects_.count(object_id) > 0)
              ? ObjectStatus::OBJECT_FOUND
              : ObjectStatus::OBJECT_NOT_FOUND;
 }
 
 void PlasmaStore::SealObjects(const std::vector<ObjectID>& object_ids,
                               const std::vector<std::string>& digests) {
+  SealEntries(object_ids, digests);
+
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    UpdateObjectGetRequests(object_ids[i]);
+  }
+}
+
+void PlasmaStore::SealEntries(const std::vector<ObjectID>& object_ids,
+                              const std::vector<std::string>& digests) {
   std::vector<ObjectInfoT> infos;
 
   ARROW_LOG(DEBUG) << "sealing " << object_ids.size() << " objects";
@@ -603,10 +786,6 @@ void PlasmaStore::SealObjects(const std::vector<ObjectID>& object_ids,
   }
 
   PushNotifications(infos);
-
-  for (size_t i = 0; i < object_ids.size(); ++i) {
-    UpdateObjectGetRequests(object_ids[i]);
-  }
 }
 
 int PlasmaStore::AbortObject(const ObjectID& object_id, Client* client) {
@@ -621,6 +800,7 @@ int PlasmaStore::AbortObject(const ObjectID& object_id, Client* client) {
     return 0;
   } else {
     // The client requesting the abort is the creator. Free the object.
+    eviction_policy_.RemoveObject(object_id);
     EraseFromObjectTable(object_id);
     client->object_ids.erase(it);
     return 1;
@@ -667,8 +847,8 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     return;
   }
 
-  std::vector<std::shared_ptr<arrow::Buffer>> evicted_object_data;
-  std::vector<ObjectTableEntry*> evicted_entries;
+  std::vector<ObjectID> spilled_ids;
+  std::vector<std::shared_ptr<Buffer>> spilled_data;
   for (const auto& object_id : object_ids) {
     ARROW_LOG(DEBUG) << "evicting object " << object_id.hex();
     auto entry = GetObjectTableEntry(&store_info_, object_id);
@@ -681,13 +861,21 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     ARROW_CHECK(entry->ref_count == 0)
         << "To evict an object, there must be no clients currently using it.";
 
-    // If there is a backing external store, then mark object for eviction to
-    // external store, free the object data pointer and keep a placeholder
-    // entry in ObjectTable
+    // If there is a backing external store, then copy the object data out of
+    // the store memory, free the object data pointer and keep a placeholder
+    // entry in ObjectTable. The copy is written to the external store in the
+    // background, without blocking the clients.
     if (external_store_) {
-      evicted_object_data.push_back(std::make_shared<arrow::Buffer>(
-          entry->pointer, entry->data_size + entry->metadata_size));
-      evicted_entries.push_back(entry);
+      int64_t size = entry->data_size + entry->metadata_size;
+      std::shared_ptr<Buffer> data;
+      ARROW_CHECK_OK(arrow::AllocateBuffer(size, &data));
+      std::memcpy(data->mutable_data(), entry->pointer, static_cast<size_t>(size));
+      PlasmaAllocator::Free(entry->pointer, size);
+      entry->pointer = nullptr;
+      entry->state = ObjectState::PLASMA_EVICTED;
+      spilling_objects_[object_id] = data;
+      spilled_ids.push_back(object_id);
+      spilled_data.push_back(std::move(data));
     } else {
       // If there is no backing external store, just erase the object entry
       // and send a deletion notification.
@@ -700,12 +888,32 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     }
   }
 
-  if (external_store_ && !object_ids.empty()) {
-    ARROW_CHECK_OK(external_store_->Put(object_ids, evicted_object_data));
-    for (auto entry : evicted_entries) {
-      PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
-      entry->pointer = nullptr;
-      entry->state = ObjectState::PLASMA_EVICTED;
+  if (!spilled_ids.empty()) {
+    ARROW_CHECK_OK(external_store_pool_->Spawn([this, spilled_ids, spilled_data]() {
+      Status status = external_store_->Put(spilled_ids, spilled_data);
+      loops_[0]->Post([this, spilled_ids, spilled_data, status]() {
+        StripeLock lock(this);
+        FinishSpill(spilled_ids, spilled_data, status);
+      });
+    }));
+  }
+}
+
+void PlasmaStore::FinishSpill(const std::vector<ObjectID>& object_ids,
+                              const std::vector<std::shared_ptr<Buffer>>& data,
+                              const Status& status) {
+  if (!status.ok()) {
+    // Keep the copies, the objects can still be restored from them.
+    ARROW_LOG(WARNING) << "Failed to write " << object_ids.size()
+                       << " objects to the external store, keeping them in memory: "
+                       << status;
+    return;
+  }
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    // The object may have been restored, or evicted again, in the meantime.
+    auto it = spilling_objects_.find(object_ids[i]);
+    if (it != spilling_objects_.end() && it->second == data[i]) {
+      spilling_objects_.erase(it);
     }
   }
 }
@@ -713,16 +921,20 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
 void PlasmaStore::ConnectClient(int listener_sock) {
   int client_fd = AcceptClient(listener_sock);
 
+  StripeLock lock(this);
   Client* client = new Client(client_fd);
+  client->loop = loops_[next_loop_++ % loops_.size()];
   connected_clients_[client_fd] = std::unique_ptr<Client>(client);
 
-  // Add a callback to handle events on this socket.
+  // Add a callback to handle events on this socket, on the loop of the client.
   // TODO(pcm): Check return value.
-  loop_->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
-    Status s = ProcessMessage(client);
-    if (!s.ok()) {
-      ARROW_LOG(FATAL) << "Failed to process file event: " << s;
-    }
+  client->loop->RunInLoop([this, client, client_fd]() {
+    client->loop->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
+      Status s = ProcessMessage(client);
+      if (!s.ok()) {
+        ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+      }
+    });
   });
   ARROW_LOG(DEBUG) << "New connection with fd " << client_fd;
 }
@@ -731,7 +943,8 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   ARROW_CHECK(client_fd > 0);
   auto it = connected_clients_.find(client_fd);
   ARROW_CHECK(it != connected_clients_.end());
-  loop_->RemoveFileEvent(client_fd);
+  // Clients are disconnected from their own loop.
+  it->second->loop->RemoveFileEvent(client_fd);
   // Close the socket.
   close(client_fd);
   ARROW_LOG(INFO) << "Disconnecting client on fd " << client_fd;
@@ -766,10 +979,11 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   if (client->notification_fd > 0) {
     // This client has subscribed for notifications.
     auto notify_fd = client->notification_fd;
-    loop_->RemoveFileEvent(notify_fd);
+    client->loop->RemoveFileEvent(notify_fd);
     // Close socket.
     close(notify_fd);
     // Remove notification queue for this fd from global map.
+    std::lock_guard<std::mutex> lock(notifications_mutex_);
     pending_notifications_.erase(notify_fd);
     // Reset fd.
     client->notification_fd = -1;
@@ -779,61 +993,72 @@ void PlasmaStore::DisconnectClient(int client_fd) {
 }
 
 /// Send notifications about sealed objects to the subscribers. This is called
-/// in SealObject. If the socket's send buffer is full, the notification will
-/// be buffered, and this will be called again when the send buffer has room.
-/// Since we call erase on pending_notifications_, all iterators get
-/// invalidated, which is why we return a valid iterator to the next client to
-/// be used in PushNotification.
+/// when the pending notifications are flushed. If the socket's send buffer is
+/// full, the notifications will be buffered, and this will be called again when
+/// the send buffer has room. Since we call erase on pending_notifications_, all
+/// iterators get invalidated, which is why we return a valid iterator to the
+/// next client.
 ///
 /// @param it Iterator that points to the client to send the notification to.
 /// @return Iterator pointing to the next client.
 PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
     PlasmaStore::NotificationMap::iterator it) {
   int client_fd = it->first;
+  EventLoop* loop = it->second.loop;
   auto& notifications = it->second.object_notifications;
+  int64_t& bytes_sent = it->second.bytes_sent;
 
-  int num_processed = 0;
   bool closed = false;
   // Loop over the array of pending notifications and send as many of them as
   // possible.
-  for (size_t i = 0; i < notifications.size(); ++i) {
-    auto& notification = notifications.at(i);
+  while (!notifications.empty()) {
+    uint8_t* notification = notifications.front().get();
     // Decode the length, which is the first bytes of the message.
-    int64_t size = *(reinterpret_cast<int64_t*>(notification.get()));
+    int64_t size = sizeof(int64_t) + *(reinterpret_cast<int64_t*>(notification));
 
-    // Attempt to send a notification about this object ID.
-    ssize_t nbytes = send(client_fd, notification.get(), sizeof(int64_t) + size, 0);
+    // Attempt to send the rest of this notification. Coalesced notifications
+    // may not fit in the socket's send buffer at once.
+    ssize_t nbytes = send(client_fd, notification + bytes_sent, size - bytes_sent, 0);
     if (nbytes >= 0) {
-      ARROW_CHECK(nbytes == static_cast<ssize_t>(sizeof(int64_t)) + size);
-    } else if (nbytes == -1 &&
-               (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
-      ARROW_LOG(DEBUG) << "The socket's send buffer is full, so we are caching this "
-                          "notification and will send it later.";
-      // Add a callback to the event loop to send queued notifications whenever
-      // there is room in the socket's send buffer. Callbacks can be added
-      // more than once here and will be overwritten. The callback is removed
-      // at the end of the method.
-      // TODO(pcm): Introduce status codes and check in case the file descriptor
-      // is added twice.
-      loop_->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
-        SendNotifications(pending_notifications_.find(client_fd));
-      });
-      break;
-    } else {
+      bytes_sent += nbytes;
+      if (bytes_sent == size) {
+        bytes_sent = 0;
+        notifications.pop_front();
+        continue;
+      }
+    } else if (!(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
       ARROW_LOG(WARNING) << "Failed to send notification to client on fd " << client_fd;
       if (errno == EPIPE) {
         closed = true;
         break;
       }
+      bytes_sent = 0;
+      notifications.pop_front();
+      continue;
     }
-    num_processed += 1;
+    ARROW_LOG(DEBUG) << "The socket's send buffer is full, so we are caching this "
+                        "notification and will send it later.";
+    // Add a callback to the event loop to send queued notifications whenever
+    // there is room in the socket's send buffer. Callbacks can be added
+    // more than once here and will be overwritten. The callback is removed
+    // once all notifications are sent.
+    // TODO(pcm): Introduce status codes and check in case the file descriptor
+    // is added twice.
+    loop->RunInLoop([this, loop, client_fd]() {
+      loop->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
+        std::lock_guard<std::mutex> lock(notifications_mutex_);
+        auto it = pending_notifications_.find(client_fd);
+        if (it != pending_notifications_.end()) {
+          SendNotifications(it);
+        }
+      });
+    });
+    break;
   }
-  // Remove the sent notifications from the array.
-  notifications.erase(notifications.begin(), notifications.begin() + num_processed);
 
   // If we have sent all notifications, remove the fd from the event loop.
   if (notifications.empty()) {
-    loop_->RemoveFileEvent(client_fd);
+    loop->RunInLoop([loop, client_fd]() { loop->RemoveFileEvent(client_fd); });
   }
 
   // Stop sending notifications if the pipe was broken.
@@ -845,34 +1070,61 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   }
 }
 
+void PlasmaStore::QueueNotifications(NotificationMap::iterator it,
+                                     const std::vector<ObjectInfoT>& object_info) {
+  auto& queue = it->second;
+  queue.pending_infos.insert(queue.pending_infos.end(), object_info.begin(),
+                             object_info.end());
+  if (queue.flush_scheduled) {
+    return;
+  }
+  // Serialize everything queued until the loop gets to it into one message,
+  // rather than sending a message for each sealed object.
+  queue.flush_scheduled = true;
+  int client_fd = it->first;
+  queue.loop->Post([this, client_fd]() {
+    std::lock_guard<std::mutex> lock(notifications_mutex_);
+    FlushNotifications(client_fd);
+  });
+}
+
+void PlasmaStore::FlushNotifications(int client_fd) {
+  auto it = pending_notifications_.find(client_fd);
+  if (it == pending_notifications_.end()) {
+    return;
+  }
+  auto& queue = it->second;
+  queue.flush_scheduled = false;
+  if (queue.pending_infos.empty()) {
+    return;
+  }
+  queue.object_notifications.emplace_back(
+      CreatePlasmaNotificationBuffer(queue.pending_infos));
+  queue.pending_infos.clear();
+  SendNotifications(it);
+}
+
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
-  auto it = pending_notifications_.begin();
-  while (it != pending_notifications_.end()) {
-    std::vector<fb::ObjectInfoT> info;
-    info.push_back(*object_info);
-    auto notification = CreatePlasmaNotificationBuffer(info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    it = SendNotifications(it);
+  std::lock_guard<std::mutex> lock(notifications_mutex_);
+  for (auto it = pending_notifications_.begin(); it != pending_notifications_.end();
+       ++it) {
+    QueueNotifications(it, {*object_info});
   }
 }
 
 void PlasmaStore::PushNotifications(std::vector<fb::ObjectInfoT>& object_info) {
-  auto it = pending_notifications_.begin();
-  while (it != pending_notifications_.end()) {
-    auto notifications = CreatePlasmaNotificationBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notifications));
-    it = SendNotifications(it);
+  std::lock_guard<std::mutex> lock(notifications_mutex_);
+  for (auto it = pending_notifications_.begin(); it != pending_notifications_.end();
+       ++it) {
+    QueueNotifications(it, object_info);
   }
 }
 
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info, int client_fd) {
+  std::lock_guard<std::mutex> lock(notifications_mutex_);
   auto it = pending_notifications_.find(client_fd);
   if (it != pending_notifications_.end()) {
-    std::vector<fb::ObjectInfoT> info;
-    info.push_back(*object_info);
-    auto notification = CreatePlasmaNotificationBuffer(info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    SendNotifications(it);
+    QueueNotifications(it, {*object_info});
   }
 }
 
@@ -895,7 +1147,10 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
   }
 
   // Add this fd to global map, which is needed for this client to receive notifications.
-  pending_notifications_[fd];
+  {
+    std::lock_guard<std::mutex> lock(notifications_mutex_);
+    pending_notifications_[fd].loop = client->loop;
+  }
   client->notification_fd = fd;
 
   // Push notifications to the new subscriber about existing sealed objects.
@@ -912,13 +1167,153 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
   }
 }
 
+bool PlasmaStore::TryReleaseObjects(const std::vector<ObjectID>& object_ids,
+                                    Client* client) {
+  // An object deleted while in use is evicted once released, which changes the
+  // object table.
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (entry == nullptr ||
+        (entry->ref_count == 1 && deletion_cache_.count(object_id) > 0)) {
+      return false;
+    }
+  }
+  for (const auto& object_id : object_ids) {
+    ReleaseObject(object_id, client);
+  }
+  return true;
+}
+
+bool PlasmaStore::TrySealObjects(const std::vector<ObjectID>& object_ids,
+                                 const std::vector<std::string>& digests) {
+  // The waiting get requests may be those of clients of other loops.
+  for (const auto& object_id : object_ids) {
+    if (object_get_requests_.count(object_id) > 0) {
+      return false;
+    }
+  }
+  SealEntries(object_ids, digests);
+  return true;
+}
+
+bool PlasmaStore::TryGetSealedObjects(Client* client,
+                                      const std::vector<ObjectID>& object_ids) {
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (entry == nullptr || entry->state != ObjectState::PLASMA_SEALED) {
+      return false;
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(eviction_mutex_);
+    for (size_t i = 0; i < object_ids.size(); ++i) {
+      eviction_policy_.RecordLookup(true);
+    }
+  }
+  auto get_req = new GetRequest(client, object_ids);
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    PlasmaObject_init(&get_req->objects[object_id], entry);
+    get_req->num_satisfied += 1;
+    AddToClientObjectIds(object_id, entry, client);
+  }
+  ReturnFromGet(get_req);
+  return true;
+}
+
+Status PlasmaStore::TryProcessObjectRequest(Client* client, fb::MessageType type,
+                                            uint8_t* input, size_t input_size,
+                                            bool* done) {
+  *done = false;
+  std::vector<ObjectID> object_ids;
+  std::vector<std::string> digests;
+  int64_t timeout_ms;
+  switch (type) {
+    case fb::MessageType::PlasmaReleaseRequest:
+      object_ids.resize(1);
+      RETURN_NOT_OK(ReadReleaseRequest(input, input_size, &object_ids[0]));
+      break;
+    case fb::MessageType::PlasmaReleaseBatchRequest:
+      RETURN_NOT_OK(ReadReleaseBatchRequest(input, input_size, &object_ids));
+      break;
+    case fb::MessageType::PlasmaSealRequest:
+      object_ids.resize(1);
+      digests.resize(1);
+      RETURN_NOT_OK(ReadSealRequest(input, input_size, &object_ids[0], &digests[0]));
+      break;
+    case fb::MessageType::PlasmaSealBatchRequest:
+      RETURN_NOT_OK(ReadSealBatchRequest(input, input_size, &object_ids, &digests));
+      break;
+    case fb::MessageType::PlasmaContainsRequest:
+      object_ids.resize(1);
+      RETURN_NOT_OK(ReadContainsRequest(input, input_size, &object_ids[0]));
+      break;
+    case fb::MessageType::PlasmaContainsBatchRequest:
+      RETURN_NOT_OK(ReadContainsBatchRequest(input, input_size, &object_ids));
+      break;
+    case fb::MessageType::PlasmaGetRequest:
+      RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids, &timeout_ms));
+      break;
+    default:
+      return Status::OK();
+  }
+
+  StripeLock lock(this, object_ids);
+  switch (type) {
+    case fb::MessageType::PlasmaReleaseRequest:
+    case fb::MessageType::PlasmaReleaseBatchRequest:
+      *done = TryReleaseObjects(object_ids, client);
+      break;
+    case fb::MessageType::PlasmaSealRequest:
+    case fb::MessageType::PlasmaSealBatchRequest:
+      *done = TrySealObjects(object_ids, digests);
+      break;
+    case fb::MessageType::PlasmaContainsRequest: {
+      bool has_object = ContainsObject(object_ids[0]) == ObjectStatus::OBJECT_FOUND;
+      HANDLE_SIGPIPE(SendContainsReply(client->fd, object_ids[0], has_object),
+                     client->fd);
+      *done = true;
+    } break;
+    case fb::MessageType::PlasmaContainsBatchRequest: {
+      std::vector<ObjectID> contained_ids;
+      for (const auto& id : object_ids) {
+        if (ContainsObject(id) == ObjectStatus::OBJECT_FOUND) {
+          contained_ids.push_back(id);
+        }
+      }
+      HANDLE_SIGPIPE(SendContainsBatchReply(client->fd, contained_ids), client->fd);
+      *done = true;
+    } break;
+    case fb::MessageType::PlasmaGetRequest:
+      *done = TryGetSealedObjects(client, object_ids);
+      break;
+    default:
+      break;
+  }
+  return Status::OK();
+}
+
 Status PlasmaStore::ProcessMessage(Client* client) {
+  // The input buffer is allocated only once per thread to avoid mallocs for
+  // every message. Messages are read before taking the stripe locks, so that
+  // the loops only wait for each other while requests are processed.
+  static thread_local std::vector<uint8_t> input_buffer;
   fb::MessageType type;
-  Status s = ReadMessage(client->fd, &type, &input_buffer_);
+  Status s = ReadMessage(client->fd, &type, &input_buffer);
   ARROW_CHECK(s.ok() || s.IsIOError());
 
-  uint8_t* input = input_buffer_.data();
-  size_t input_size = input_buffer_.size();
+  uint8_t* input = input_buffer.data();
+  size_t input_size = input_buffer.size();
+  // Requests of one client are still processed in order, since its loop
+  // doesn't read the next one before this one is done.
+  bool done = false;
+  RETURN_NOT_OK(TryProcessObjectRequest(client, type, input, input_size, &done));
+  if (done) {
+    return Status::OK();
+  }
+
+  StripeLock lock(this);
   ObjectID object_id;
   PlasmaObject object = {};
 
@@ -1045,6 +1440,13 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(ReadReleaseRequest(input, input_size, &object_id));
       ReleaseObject(object_id, client);
     } break;
+    case fb::MessageType::PlasmaReleaseBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadReleaseBatchRequest(input, input_size, &object_ids));
+      for (const auto& id : object_ids) {
+        ReleaseObject(id, client);
+      }
+    } break;
     case fb::MessageType::PlasmaDeleteRequest: {
       std::vector<ObjectID> object_ids;
       std::vector<PlasmaError> error_codes;
@@ -1055,14 +1457,6 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       }
       HANDLE_SIGPIPE(SendDeleteReply(client->fd, object_ids, error_codes), client->fd);
     } break;
-    case fb::MessageType::PlasmaContainsRequest: {
-      RETURN_NOT_OK(ReadContainsRequest(input, input_size, &object_id));
-      if (ContainsObject(object_id) == ObjectStatus::OBJECT_FOUND) {
-        HANDLE_SIGPIPE(SendContainsReply(client->fd, object_id, 1), client->fd);
-      } else {
-        HANDLE_SIGPIPE(SendContainsReply(client->fd, object_id, 0), client->fd);
-      }
-    } break;
     case fb::MessageType::PlasmaListRequest: {
       RETURN_NOT_OK(ReadListRequest(input, input_size));
       HANDLE_SIGPIPE(SendListReply(client->fd, store_info_.objects), client->fd);
@@ -1072,6 +1466,17 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(ReadSealRequest(input, input_size, &object_id, &digest));
       SealObjects({object_id}, {digest});
     } break;
+    case fb::MessageType::PlasmaSealBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<std::string> digests;
+      RETURN_NOT_OK(ReadSealBatchRequest(input, input_size, &object_ids, &digests));
+      SealObjects(object_ids, digests);
+    } break;
+    case fb::MessageType::PlasmaPrefetchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadPrefetchRequest(input, input_size, &object_ids));
+      RestoreObjects(object_ids, client);
+    } break;
     case fb::MessageType::PlasmaEvictRequest: {
       // This code path should only be used for testing.
       int64_t num_bytes;
@@ -1126,17 +1531,25 @@ class PlasmaStoreRunner {
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
-             std::shared_ptr<ExternalStore> external_store) {
-    // Create the event loop.
-    loop_.reset(new EventLoop);
-    store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store));
+             std::shared_ptr<ExternalStore> external_store, int num_threads,
+             EvictionAlgorithm eviction_algorithm, bool prefault_memory,
+             bool transparent_hugepages) {
+    // Create the event loops. The first one accepts connections and runs on
+    // this thread, the others run on their own threads.
+    std::vector<EventLoop*> loops;
+    for (int i = 0; i < num_threads; ++i) {
+      loops_.emplace_back(new EventLoop);
+      loops.push_back(loops_.back().get());
+    }
+    store_.reset(new PlasmaStore(loops, directory, hugepages_enabled, socket_name,
+                                 external_store, eviction_algorithm, prefault_memory,
+                                 transparent_hugepages));
     plasma_config = store_->GetPlasmaStoreInfo();
 
     // We are using a single memory-mapped file by mallocing and freeing a single
     // large amount of space up front. According to the documentation,
     // dlmalloc might need up to 128*sizeof(size_t) bytes for internal
-    // bookkeeping.
+    // bookkeeping. This is also when the memory is pre-faulted, if requested.
     void* pointer = plasma::PlasmaAllocator::Memalign(
         kBlockSize, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
     ARROW_CHECK(pointer != nullptr);
@@ -1149,22 +1562,41 @@ class PlasmaStoreRunner {
     // TODO(pcm): Check return value.
     ARROW_CHECK(socket >= 0);
 
-    loop_->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
+    loops_[0]->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
       this->store_->ConnectClient(socket);
     });
-    loop_->Start();
+    for (size_t i = 1; i < loops_.size(); ++i) {
+      EventLoop* loop = loops_[i].get();
+      threads_.emplace_back([loop]() { loop->Start(); });
+    }
+    loops_[0]->Start();
+
+    // The first loop was stopped, stop the others too.
+    for (size_t i = 1; i < loops_.size(); ++i) {
+      EventLoop* loop = loops_[i].get();
+      loop->Post([loop]() { loop->Stop(); });
+    }
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+    threads_.clear();
   }
 
-  void Stop() { loop_->Stop(); }
+  void Stop() { loops_[0]->Stop(); }
 
   void Shutdown() {
-    loop_->Shutdown();
-    loop_ = nullptr;
+    // The store waits for its background operations, which may still post to
+    // the event loops.
     store_ = nullptr;
+    for (auto& loop : loops_) {
+      loop->Shutdown();
+    }
+    loops_.clear();
   }
 
  private:
-  std::unique_ptr<EventLoop> loop_;
+  std::vector<std::unique_ptr<EventLoop>> loops_;
+  std::vector<std::thread> threads_;
   std::unique_ptr<PlasmaStore> store_;
 };
 
@@ -1180,14 +1612,18 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
-                 std::shared_ptr<ExternalStore> external_store) {
+                 std::shared_ptr<ExternalStore> external_store, int num_threads,
+                 EvictionAlgorithm eviction_algorithm, bool prefault_memory,
+                 bool transparent_hugepages) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
 
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
-  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store);
+  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
+                  num_threads, eviction_algorithm, prefault_memory,
+                  transparent_hugepages);
 }
 
 }  // namespace plasma
@@ -1200,9 +1636,13 @@ int main(int argc, char* argv[]) {
   std::string plasma_directory;
   std::string external_store_endpoint;
   bool hugepages_enabled = false;
+  bool prefault_memory = false;
+  bool transparent_hugepages = false;
   int64_t system_memory = -1;
+  int num_threads = 1;
+  plasma::EvictionAlgorithm eviction_algorithm = plasma::EvictionAlgorithm::LRU;
   int c;
-  while ((c = getopt(argc, argv, "s:m:d:e:h")) != -1) {
+  while ((c = getopt(argc, argv, "s:m:d:e:fhp:t:T")) != -1) {
     switch (c) {
       case 'd':
         plasma_directory = std::string(optarg);
@@ -1210,12 +1650,34 @@ int main(int argc, char* argv[]) {
       case 'e':
         external_store_endpoint = std::string(optarg);
         break;
+      case 'f':
+        prefault_memory = true;
+        break;
       case 'h':
         hugepages_enabled = true;
         break;
+      case 'p':
+        if (std::string(optarg) == "lru") {
+          eviction_algorithm = plasma::EvictionAlgorithm::LRU;
+        } else if (std::string(optarg) == "gdsf") {
+          eviction_algorithm = plasma::EvictionAlgorithm::GDSF;
+        } else {
+          ARROW_LOG(FATAL) << "unknown eviction policy \"" << optarg
+                           << "\", expected lru or gdsf";
+        }
+        break;
       case 's':
         socket_name = optarg;
         break;
+      case 't': {
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &num_threads, &extra);
+        ARROW_CHECK(scanned == 1 && num_threads > 0);
+        break;
+      }
+      case 'T':
+        transparent_hugepages = true;
+        break;
       case 'm': {
         char extra;
         int scanned = sscanf(optarg, "%" SCNd64 "%c", &system_memory, &extra);
@@ -1242,6 +1704,10 @@ int main(int argc, char* argv[]) {
     ARROW_LOG(FATAL) << "if you want to use hugepages, please specify path to huge pages "
                         "filesystem with -d";
   }
+  if (hugepages_enabled && transparent_hugepages) {
+    ARROW_LOG(FATAL) << "huge pages (-h) and transparent huge pages (-T) cannot be "
+                        "used together";
+  }
   if (plasma_directory.empty()) {
 #ifdef __linux__
     plasma_directory = "/dev/shm";
@@ -1251,7 +1717,9 @@ int main(int argc, char* argv[]) {
   }
   ARROW_LOG(INFO) << "Starting object store with directory " << plasma_directory
                   << " and huge page support "
-                  << (hugepages_enabled ? "enabled" : "disabled");
+                  << (hugepages_enabled ? "enabled" : "disabled")
+                  << (transparent_hugepages ? ", transparent huge pages enabled" : "")
+                  << (prefault_memory ? ", pre-faulting memory" : "");
 #ifdef __linux__
   if (!hugepages_enabled) {
     // On Linux, check that the amount of memory available in /dev/shm is large
@@ -1294,7 +1762,10 @@ int main(int argc, char* argv[]) {
     ARROW_CHECK_OK(external_store->Connect(external_store_endpoint));
   }
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
-  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store);
+  ARROW_LOG(DEBUG) << "serving clients with " << num_threads << " threads";
+  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
+                      num_threads, eviction_algorithm, prefault_memory,
+                      transparent_hugepages);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -18,8 +18,10 @@
 #ifndef PLASMA_STORE_H
 #define PLASMA_STORE_H
 
+#include <array>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -34,6 +36,9 @@
 
 namespace arrow {
 class Status;
+namespace internal {
+class ThreadPool;
+}  // namespace internal
 }  // namespace arrow
 
 namespace plasma {
@@ -49,9 +54,19 @@ using flatbuf::PlasmaError;
 struct GetRequest;
 
 struct NotificationQueue {
+  /// The event loop of the subscribed client, which waits for the
+  /// notification socket to be writable.
+  EventLoop* loop = nullptr;
   /// The object notifications for clients. We notify the client about the
   /// objects in the order that the objects were sealed or deleted.
   std::deque<std::unique_ptr<uint8_t[]>> object_notifications;
+  /// The number of bytes of the first notification already sent.
+  int64_t bytes_sent = 0;
+  /// The object notifications not serialized yet. They are coalesced into a
+  /// single message once per iteration of the event loop.
+  std::vector<ObjectInfoT> pending_infos;
+  /// Whether the event loop will flush the pending notifications.
+  bool flush_scheduled = false;
 };
 
 class PlasmaStore {
@@ -61,7 +76,20 @@ class PlasmaStore {
   // TODO: PascalCase PlasmaStore methods.
   PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
               const std::string& socket_name,
-              std::shared_ptr<ExternalStore> external_store);
+              std::shared_ptr<ExternalStore> external_store,
+              EvictionAlgorithm eviction_algorithm = EvictionAlgorithm::LRU,
+              bool prefault_memory = false, bool transparent_hugepages = false);
+
+  /// Create a store whose clients are spread over several event loops, which
+  /// may run on different threads. The store state is protected by the locks of
+  /// the object table stripes. ConnectClient, ProcessMessage and the event loop
+  /// callbacks take them; the other methods must be called with all of them
+  /// held.
+  PlasmaStore(std::vector<EventLoop*> loops, std::string directory,
+              bool hugepages_enabled, const std::string& socket_name,
+              std::shared_ptr<ExternalStore> external_store,
+              EvictionAlgorithm eviction_algorithm = EvictionAlgorithm::LRU,
+              bool prefault_memory = false, bool transparent_hugepages = false);
 
   ~PlasmaStore();
 
@@ -111,11 +139,23 @@ class PlasmaStore {
   ///  - PlasmaError::ObjectInUse, if the object is in use.
   PlasmaError DeleteObject(ObjectID& object_id);
 
-  /// Evict objects returned by the eviction policy.
+  /// Evict objects returned by the eviction policy. With an external store,
+  /// the objects are copied out of the store memory and written to the
+  /// external store in the background. They can be read from the copy until
+  /// the write completes.
   ///
   /// @param object_ids Object IDs of the objects to be evicted.
   void EvictObjects(const std::vector<ObjectID>& object_ids);
 
+  /// Start restoring evicted objects from the external store in the
+  /// background. Get requests waiting for the objects return once they are
+  /// restored. Objects that are not evicted, or for which there is not enough
+  /// memory, are skipped.
+  ///
+  /// @param object_ids Object IDs of the objects to be restored.
+  /// @param client The client on whose behalf the objects are restored.
+  void RestoreObjects(const std::vector<ObjectID>& object_ids, Client* client);
+
   /// Process a get request from a client. This method assumes that we will
   /// eventually have these objects sealed. If one of the objects has not yet
   /// been sealed, the client that requested the object will be notified when it
@@ -172,15 +212,61 @@ class PlasmaStore {
   arrow::Status ProcessMessage(Client* client);
 
  private:
+  class StripeLock;
+
+  /// Process a Release, Seal, Contains or Get request holding only the locks of
+  /// the stripes of its objects. Requests which would change the object table
+  /// or wake up get requests are left to ProcessMessage.
+  ///
+  /// @param done Set to whether the request was processed.
+  arrow::Status TryProcessObjectRequest(Client* client, MessageType type,
+                                        uint8_t* input, size_t input_size, bool* done);
+
+  /// Release objects unless this would evict one of them.
+  bool TryReleaseObjects(const std::vector<ObjectID>& object_ids, Client* client);
+
+  /// Seal objects unless a get request is waiting for one of them.
+  bool TrySealObjects(const std::vector<ObjectID>& object_ids,
+                      const std::vector<std::string>& digests);
+
+  /// Reply to a get request if all of its objects are sealed.
+  bool TryGetSealedObjects(Client* client, const std::vector<ObjectID>& object_ids);
+
+  /// Mark created objects as sealed and notify the subscribers.
+  void SealEntries(const std::vector<ObjectID>& object_ids,
+                   const std::vector<std::string>& digests);
+
   void PushNotification(ObjectInfoT* object_notification);
 
   void PushNotifications(std::vector<ObjectInfoT>& object_notifications);
 
   void PushNotification(ObjectInfoT* object_notification, int client_fd);
 
+  void QueueNotifications(NotificationMap::iterator it,
+                          const std::vector<ObjectInfoT>& object_notifications);
+
+  void FlushNotifications(int client_fd);
+
   void AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                             Client* client);
 
+  /// Allocate memory for an evicted object and mark it as being created, with
+  /// the eviction policy told not to evict it.
+  bool AllocateEvictedObject(const ObjectID& object_id, ObjectTableEntry* entry,
+                             Client* client);
+
+  /// Restore an evicted object from the copy made by EvictObjects if it is still
+  /// being written to the external store. Return whether it was restored.
+  bool RestoreFromSpillBuffer(const ObjectID& object_id, ObjectTableEntry* entry,
+                              Client* client);
+
+  void FinishSpill(const std::vector<ObjectID>& object_ids,
+                   const std::vector<std::shared_ptr<Buffer>>& data,
+                   const arrow::Status& status);
+
+  void FinishRestore(const std::vector<ObjectID>& object_ids,
+                     const arrow::Status& status);
+
   /// Remove a GetRequest and clean up the relevant data structures.
   ///
   /// @param get_request The GetRequest to remove.
@@ -209,19 +295,31 @@ class PlasmaStore {
   Status FreeCudaMemory(int device_num, int64_t size, uint8_t* out_pointer);
 #endif
 
-  /// Event loop of the plasma store.
-  EventLoop* loop_;
+  /// Event loops of the plasma store, new clients are assigned to them in turn.
+  std::vector<EventLoop*> loops_;
+  size_t next_loop_ = 0;
+  /// The object table is divided into stripes by object ID. Requests about
+  /// objects the store already has lock the stripes of their objects, the other
+  /// requests lock all the stripes and so protect the whole state below.
+  static constexpr int kNumStripes = 16;
+  std::array<std::mutex, kNumStripes> stripe_mutexes_;
+  /// Protects the eviction policy while only some stripes are locked.
+  std::mutex eviction_mutex_;
+  /// Protects pending_notifications_, which the loops flush without locking any
+  /// stripe.
+  std::mutex notifications_mutex_;
   /// The plasma store information, including the object tables, that is exposed
   /// to the eviction policy.
   PlasmaStoreInfo store_info_;
   /// The state that is managed by the eviction policy.
   QuotaAwarePolicy eviction_policy_;
-  /// Input buffer. This is allocated only once to avoid mallocs for every
-  /// call to process_message.
-  std::vector<uint8_t> input_buffer_;
   /// A hash table mapping object IDs to a vector of the get requests that are
   /// waiting for the object to arrive.
   std::unordered_map<ObjectID, std::vector<GetRequest*>> object_get_requests_;
+  /// The get requests waiting for a timer, by ID. Timers may fire after their
+  /// request was removed from another thread, so they look it up here.
+  std::unordered_map<int64_t, GetRequest*> timed_get_requests_;
+  int64_t next_get_request_id_ = 0;
   /// The pending notifications that have not been sent to subscribers because
   /// the socket send buffers were full. This is a hash table from client file
   /// descriptor to an array of object_ids to send to that client.
@@ -233,9 +331,14 @@ class PlasmaStore {
 
   std::unordered_set<ObjectID> deletion_cache_;
 
+  std::shared_ptr<ExternalStore> external_store_;
   /// Manages worker threads for handling asynchronous/multi-threaded requests
   /// for reading/writing data to/from external store.
-  std::shared_ptr<ExternalStore> external_store_;
+  std::shared_ptr<arrow::internal::ThreadPool> external_store_pool_;
+  /// Copies of the evicted objects still being written to the external store.
+  std::unordered_map<ObjectID, std::shared_ptr<Buffer>> spilling_objects_;
+  /// The evicted objects being read back from the external store.
+  std::unordered_set<ObjectID> restoring_objects_;
 #ifdef PLASMA_CUDA
   arrow::cuda::CudaDeviceManager* manager_;
 #endif
@@ -62,7 +62,8 @@ class TestPlasmaStore : public ::testing::Test {
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command =
         plasma_directory + "/plasma-store-server -m 10000000 -s " + store_socket_name_ +
-        " 1> /dev/null 2> /dev/null & " + "echo $! > " + store_socket_name_ + ".pid";
+        store_options() + " 1> /dev/null 2> /dev/null & " + "echo $! > " +
+        store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
     ARROW_CHECK_OK(client2_.Connect(store_socket_name_, ""));
@@ -100,7 +101,17 @@ class TestPlasmaStore : public ::testing::Test {
     }
   }
 
+  // Seal and Release requests have no reply, so the store may handle later
+  // requests of other clients first. Wait until it has handled them.
+  void WaitForRequests(PlasmaClient& client) {
+    bool has_object;
+    ARROW_CHECK_OK(client.Contains(random_object_id(), &has_object));
+  }
+
  protected:
+  // Additional command line options of the store.
+  virtual std::string store_options() const { return ""; }
+
   PlasmaClient client_;
   PlasmaClient client2_;
   std::unique_ptr<TemporaryDir> temp_dir_;
@@ -191,6 +202,41 @@ TEST_F(TestPlasmaStore, BatchNotificationTest) {
   ARROW_CHECK_OK(local_client.Disconnect());
 }
 
+TEST_F(TestPlasmaStore, ManyNotificationsTest) {
+  PlasmaClient local_client, local_client2;
+
+  ARROW_CHECK_OK(local_client.Connect(store_socket_name_, ""));
+  ARROW_CHECK_OK(local_client2.Connect(store_socket_name_, ""));
+
+  int fd = -1;
+  ARROW_CHECK_OK(local_client2.Subscribe(&fd));
+  ASSERT_GT(fd, 0);
+
+  // Enough notifications to be coalesced into a message larger than the
+  // socket's send buffer.
+  const int num_objects = 5000;
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < num_objects; ++i) {
+    object_ids.push_back(random_object_id());
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(local_client.Create(object_ids.back(), i % 100, NULLPTR, 0, &data));
+  }
+  ARROW_CHECK_OK(local_client.Seal(object_ids));
+
+  for (int i = 0; i < num_objects; ++i) {
+    ObjectID object_id;
+    int64_t data_size = 0;
+    int64_t metadata_size = 0;
+    ARROW_CHECK_OK(
+        local_client2.GetNotification(fd, &object_id, &data_size, &metadata_size));
+    ASSERT_EQ(object_ids[i], object_id);
+    ASSERT_EQ(i % 100, data_size);
+  }
+
+  ARROW_CHECK_OK(local_client2.Disconnect());
+  ARROW_CHECK_OK(local_client.Disconnect());
+}
+
 TEST_F(TestPlasmaStore, SealErrorsTest) {
   ObjectID object_id = random_object_id();
 
@@ -392,6 +438,7 @@ TEST_F(TestPlasmaStore, SetQuotaCleanupObjectMetadata) {
 
   // release id0
   ARROW_CHECK_OK(local_client.Release(id0));
+  WaitForRequests(local_client);
   ASSERT_TRUE(client_.DebugString().find("(global lru) num objects: 1") !=
               std::string::npos);
 
@@ -626,6 +673,48 @@ TEST_F(TestPlasmaStore, GetTest) {
   EXPECT_FALSE(client_.IsInUse(object_id));
 }
 
+TEST_F(TestPlasmaStore, ReleaseCacheTest) {
+  ARROW_CHECK_OK(client_.SetReleaseCacheCapacity(1000));
+  std::vector<uint8_t> data(400, 7);
+  ObjectID object_id1 = random_object_id();
+  ObjectID object_id2 = random_object_id();
+  ObjectID object_id3 = random_object_id();
+
+  // Released objects stay cached by the client
+  CreateObject(client_, object_id1, {42}, data);
+  EXPECT_FALSE(client_.IsInUse(object_id1));
+  {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_id1}, 0, &object_buffers));
+    AssertObjectBufferEqual(object_buffers[0], {42}, data);
+    EXPECT_TRUE(client_.IsInUse(object_id1));
+  }
+  EXPECT_FALSE(client_.IsInUse(object_id1));
+
+  // The least recently released object is released when over capacity
+  CreateObject(client_, object_id2, {42}, data);
+  CreateObject(client_, object_id3, {42}, data);
+  WaitForRequests(client_);
+  bool has_object;
+  ARROW_CHECK_OK(client2_.Delete(object_id1));
+  ARROW_CHECK_OK(client2_.Contains(object_id1, &has_object));
+  ASSERT_FALSE(has_object);
+  ARROW_CHECK_OK(client2_.Delete(object_id2));
+  ARROW_CHECK_OK(client2_.Contains(object_id2, &has_object));
+  ASSERT_TRUE(has_object);
+
+  // Deleting a cached object releases it first
+  ARROW_CHECK_OK(client_.Delete(object_id3));
+  ARROW_CHECK_OK(client_.Contains(object_id3, &has_object));
+  ASSERT_FALSE(has_object);
+
+  // Disabling the cache releases all the objects
+  ARROW_CHECK_OK(client_.SetReleaseCacheCapacity(0));
+  WaitForRequests(client_);
+  ARROW_CHECK_OK(client2_.Contains(object_id2, &has_object));
+  ASSERT_FALSE(has_object);
+}
+
 TEST_F(TestPlasmaStore, LegacyGetTest) {
   // Test for old non-releasing Get() variant
   ObjectID object_id = random_object_id();
@@ -699,6 +788,64 @@ TEST_F(TestPlasmaStore, BatchCreateTest) {
   ASSERT_STREQ(out2.c_str(), "world");
 }
 
+TEST_F(TestPlasmaStore, BatchSealReleaseContainsTest) {
+  std::vector<ObjectID> object_ids = {random_object_id(), random_object_id(),
+                                      random_object_id()};
+  std::vector<bool> has_objects;
+  ARROW_CHECK_OK(client_.Contains(object_ids, &has_objects));
+  ASSERT_EQ(has_objects, std::vector<bool>({false, false, false}));
+
+  // Create the first two objects and seal them together.
+  std::vector<ObjectID> created_ids = {object_ids[0], object_ids[1]};
+  for (const auto& object_id : created_ids) {
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(client_.Create(object_id, 10, NULLPTR, 0, &data));
+  }
+  ARROW_CHECK_OK(client2_.Contains(object_ids, &has_objects));
+  ASSERT_EQ(has_objects, std::vector<bool>({false, false, false}));
+  ARROW_CHECK_OK(client_.Seal(created_ids));
+  WaitForRequests(client_);
+  ARROW_CHECK_OK(client2_.Contains(object_ids, &has_objects));
+  ASSERT_EQ(has_objects, std::vector<bool>({true, true, false}));
+  // Release the ref count of Create function.
+  ARROW_CHECK_OK(client_.Release(created_ids));
+
+  // Release the objects retrieved by the other client together.
+  ObjectBuffer object_buffers[2];
+  ARROW_CHECK_OK(client2_.Get(created_ids.data(), 2, -1, object_buffers));
+  ARROW_CHECK_OK(client2_.Contains(object_ids, &has_objects));
+  ASSERT_EQ(has_objects, std::vector<bool>({true, true, false}));
+  ARROW_CHECK_OK(client2_.Release(created_ids));
+  WaitForRequests(client2_);
+
+  // The objects can be deleted once no client uses them.
+  ARROW_CHECK_OK(client_.Delete(created_ids));
+  ARROW_CHECK_OK(client2_.Contains(object_ids, &has_objects));
+  ASSERT_EQ(has_objects, std::vector<bool>({false, false, false}));
+}
+
+TEST_F(TestPlasmaStore, BatchSealErrorsTest) {
+  ObjectID object_id1 = random_object_id();
+  ObjectID object_id2 = random_object_id();
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client_.Create(object_id1, 10, NULLPTR, 0, &data));
+
+  // None of the objects is sealed if one of them doesn't exist.
+  Status result = client_.Seal({object_id1, object_id2});
+  ASSERT_TRUE(IsPlasmaObjectNonexistent(result));
+  result = client_.Seal({object_id1, object_id1});
+  ASSERT_TRUE(IsPlasmaObjectAlreadySealed(result));
+  ARROW_CHECK_OK(client_.Seal(std::vector<ObjectID>{object_id1}));
+  result = client_.Seal(std::vector<ObjectID>{object_id1});
+  ASSERT_TRUE(IsPlasmaObjectAlreadySealed(result));
+  ARROW_CHECK_OK(client_.Release(object_id1));
+  WaitForRequests(client_);
+
+  bool has_object = false;
+  ARROW_CHECK_OK(client2_.Contains(object_id1, &has_object));
+  ASSERT_TRUE(has_object);
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = random_object_id();
   std::vector<ObjectBuffer> object_buffers;
@@ -864,6 +1011,163 @@ TEST_F(TestPlasmaStore, ManyObjectTest) {
   }
 }
 
+class TestPlasmaStoreThreads : public TestPlasmaStore {
+ protected:
+  std::string store_options() const override { return " -t 4"; }
+};
+
+TEST_F(TestPlasmaStoreThreads, ConcurrentClientsTest) {
+  // Each thread creates objects with its own client, then waits for the
+  // objects of the next thread, which may be sealed from another loop.
+  constexpr int kNumThreads = 8;
+  constexpr int kNumObjects = 50;
+  std::vector<std::vector<ObjectID>> object_ids(kNumThreads);
+  for (auto& ids : object_ids) {
+    for (int i = 0; i < kNumObjects; i++) {
+      ids.push_back(random_object_id());
+    }
+  }
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; t++) {
+    threads.emplace_back([&, t]() {
+      PlasmaClient client;
+      ARROW_CHECK_OK(client.Connect(store_socket_name_, ""));
+      for (int i = 0; i < kNumObjects; i++) {
+        CreateObject(client, object_ids[t][i], {static_cast<uint8_t>(t)},
+                     {static_cast<uint8_t>(i)});
+      }
+      const int next = (t + 1) % kNumThreads;
+      std::vector<ObjectBuffer> object_buffers;
+      ARROW_CHECK_OK(client.Get(object_ids[next], -1, &object_buffers));
+      for (int i = 0; i < kNumObjects; i++) {
+        AssertObjectBufferEqual(object_buffers[i], {static_cast<uint8_t>(next)},
+                                {static_cast<uint8_t>(i)});
+      }
+      ARROW_CHECK_OK(client.Disconnect());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& ids : object_ids) {
+    for (const auto& object_id : ids) {
+      bool has_object;
+      ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+      ASSERT_TRUE(has_object);
+    }
+  }
+}
+
+TEST_F(TestPlasmaStoreThreads, ConcurrentGetReleaseTest) {
+  // Gets of sealed objects and releases only lock the stripes of their objects,
+  // so the loops update the reference counts of the same objects concurrently.
+  constexpr int kNumThreads = 8;
+  constexpr int kNumObjects = 20;
+  constexpr int kNumRounds = 50;
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < kNumObjects; i++) {
+    object_ids.push_back(random_object_id());
+    CreateObject(client_, object_ids.back(), {42}, {static_cast<uint8_t>(i)});
+  }
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; t++) {
+    threads.emplace_back([&]() {
+      PlasmaClient client;
+      ARROW_CHECK_OK(client.Connect(store_socket_name_, ""));
+      for (int round = 0; round < kNumRounds; round++) {
+        std::vector<ObjectBuffer> object_buffers;
+        ARROW_CHECK_OK(client.Get(object_ids, -1, &object_buffers));
+        for (int i = 0; i < kNumObjects; i++) {
+          AssertObjectBufferEqual(object_buffers[i], {42}, {static_cast<uint8_t>(i)});
+        }
+      }
+      WaitForRequests(client);
+      ARROW_CHECK_OK(client.Disconnect());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // The objects can only be deleted if every reference was released.
+  ARROW_CHECK_OK(client_.Delete(object_ids));
+  for (const auto& object_id : object_ids) {
+    bool has_object;
+    ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+    ASSERT_FALSE(has_object);
+  }
+}
+
+TEST_F(TestPlasmaStoreThreads, GetTimeoutTest) {
+  // The two clients are served by different loops.
+  ObjectID object_id = random_object_id();
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get({object_id}, 50, &object_buffers));
+  ASSERT_FALSE(object_buffers[0].data);
+
+  // Seal the object from the loop of the second client while the first one
+  // waits, which cancels the timer of the first loop.
+  std::thread getter(
+      [&]() { ARROW_CHECK_OK(client_.Get({object_id}, 10000, &object_buffers)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  CreateObject(client2_, object_id, {1}, {2});
+  getter.join();
+  AssertObjectBufferEqual(object_buffers[0], {1}, {2});
+}
+
+class TestPlasmaStorePrefault : public TestPlasmaStore {
+ protected:
+  std::string store_options() const override { return " -f -T"; }
+};
+
+TEST_F(TestPlasmaStorePrefault, CreateAndGetTest) {
+  ObjectID object_id = random_object_id();
+  std::vector<uint8_t> data(1000000, 7);
+  CreateObject(client_, object_id, {1}, data);
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get({object_id}, -1, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], {1}, data);
+}
+
+class TestPlasmaStoreGDSF : public TestPlasmaStore {
+ protected:
+  std::string store_options() const override { return " -p gdsf"; }
+};
+
+TEST_F(TestPlasmaStoreGDSF, SmallHotObjectsSurviveTest) {
+  // Small objects accessed several times are worth more than large objects
+  // accessed once, even though the large ones were used more recently.
+  std::vector<ObjectID> small_ids;
+  for (int i = 0; i < 20; i++) {
+    small_ids.push_back(random_object_id());
+    CreateObject(client_, small_ids.back(), {}, std::vector<uint8_t>(10000, 1));
+  }
+  for (int i = 0; i < 3; i++) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get(small_ids, -1, &object_buffers));
+  }
+
+  // The large objects fill the store more than once.
+  std::vector<uint8_t> big_data(2000000, 2);
+  for (int i = 0; i < 10; i++) {
+    CreateObject(client_, random_object_id(), {}, big_data);
+  }
+
+  for (const auto& object_id : small_ids) {
+    bool has_object;
+    ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+    ASSERT_TRUE(has_object);
+  }
+
+  std::string debug_string = client_.DebugString();
+  ASSERT_NE(debug_string.find("hit rate: 1 (60 hits, 0 misses)"), std::string::npos);
+  ASSERT_EQ(debug_string.find("\nnum evictions: 0\n"), std::string::npos);
+}
+
 #ifdef PLASMA_CUDA
 using arrow::cuda::CudaBuffer;
 using arrow::cuda::CudaBufferReader;
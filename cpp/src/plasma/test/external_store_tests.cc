@@ -134,6 +134,38 @@ TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
   ASSERT_EQ(object_buffers[0].metadata, nullptr);
 }
 
+TEST_F(TestPlasmaStoreWithExternal, PrefetchTest) {
+  std::vector<ObjectID> object_ids;
+  std::string data(100 * 1024, 'x');
+  std::string metadata("meta");
+  for (int i = 0; i < 20; i++) {
+    ObjectID object_id = random_object_id();
+    object_ids.push_back(object_id);
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_id, data, metadata));
+  }
+
+  // The first objects have been evicted, but they are still in the store.
+  std::vector<bool> has_objects;
+  ARROW_CHECK_OK(client_.Contains(object_ids, &has_objects));
+  ASSERT_EQ(has_objects, std::vector<bool>(object_ids.size(), true));
+
+  // Restore a few of them in the background before getting them.
+  std::vector<ObjectID> prefetched_ids(object_ids.begin(), object_ids.begin() + 3);
+  ARROW_CHECK_OK(client_.Prefetch(prefetched_ids));
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get(prefetched_ids, -1, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), prefetched_ids.size());
+  for (const auto& object_buffer : object_buffers) {
+    AssertObjectBufferEqual(object_buffer, metadata, data);
+  }
+
+  // Prefetching objects that are not evicted or don't exist does nothing.
+  ARROW_CHECK_OK(client_.Prefetch({object_ids.back(), random_object_id()}));
+  object_buffers.clear();
+  ARROW_CHECK_OK(client_.Get({object_ids.back()}, -1, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], metadata, data);
+}
+
 }  // namespace plasma
 
 int main(int argc, char** argv) {
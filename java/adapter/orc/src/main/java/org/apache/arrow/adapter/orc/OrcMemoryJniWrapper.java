@@ -17,6 +17,8 @@
 
 package org.apache.arrow.adapter.orc;
 
+import java.util.concurrent.atomic.AtomicBoolean;
+
 /**
  * Wrapper for orc memory allocated by native code.
  */
@@ -30,9 +32,11 @@ class OrcMemoryJniWrapper implements AutoCloseable {
 
   private final long capacity;
 
+  private final AtomicBoolean closed = new AtomicBoolean(false);
+
   /**
    * Construct a new instance.
-   * @param nativeInstanceId unique id of the underlying memory.
+   * @param nativeInstanceId id of the underlying memory, shared by the buffers of a batch.
    * @param memoryAddress starting memory address of the underlying memory.
    * @param size size of the valid data.
    * @param capacity allocated memory size.
@@ -70,7 +74,10 @@ class OrcMemoryJniWrapper implements AutoCloseable {
 
   @Override
   public void close() {
-    release(nativeInstanceId);
+    // The buffers of a batch share their native id, so each must release it once
+    if (!closed.getAndSet(true)) {
+      release(nativeInstanceId);
+    }
   }
 
   private native void release(long id);
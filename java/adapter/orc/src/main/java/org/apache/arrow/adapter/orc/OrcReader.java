@@ -74,6 +74,25 @@ public class OrcReader implements AutoCloseable {
     return new OrcStripeReader(stripeReaderId, allocator);
   }
 
+  /**
+   * Get an ArrowReader over the rows from the current row to the end of the file.
+   * Stripes are decoded ahead on native threads, while the batches of previous
+   * stripes are processed. Decoded stripes are held in native memory until loaded.
+   *
+   * @param batchSize the number of rows loaded on each iteration
+   * @param numPrefetchStripes the number of stripes decoded ahead, at least 1
+   * @return ArrowReader that iterate over the remaining rows
+   */
+  public ArrowReader prefetchingReader(long batchSize, int numPrefetchStripes)
+      throws IllegalArgumentException {
+    long stripeReaderId = jniWrapper.prefetchingReader(nativeInstanceId, batchSize, numPrefetchStripes);
+    if (stripeReaderId < 0) {
+      return null;
+    }
+
+    return new OrcStripeReader(stripeReaderId, allocator);
+  }
+
   /**
    * The number of stripes in the file.
    *
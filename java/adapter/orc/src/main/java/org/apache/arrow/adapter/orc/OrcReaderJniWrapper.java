@@ -76,4 +76,14 @@ class OrcReaderJniWrapper {
    * @return id of the stripe reader instance.
    */
   native long nextStripeReader(long readerId, long batchSize);
+
+  /**
+   * Get an ArrowReader over the rows from the current row to the end of the file,
+   * which decodes stripes ahead on native threads.
+   * @param readerId id of the reader instance
+   * @param batchSize the number of rows loaded on each iteration
+   * @param numPrefetchStripes the number of stripes decoded ahead
+   * @return id of the stripe reader instance, or error code * -1.
+   */
+  native long prefetchingReader(long readerId, long batchSize, int numPrefetchStripes);
 }
@@ -20,6 +20,7 @@ package org.apache.arrow.adapter.orc;
 import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertFalse;
 import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
 
 import java.io.File;
 import java.nio.charset.StandardCharsets;
@@ -60,8 +61,7 @@ public class OrcReaderTest {
     allocator = new RootAllocator(MAX_ALLOCATION);
   }
 
-  @Test
-  public void testOrcJniReader() throws Exception {
+  private File writeTestFile() throws Exception {
     TypeDescription schema = TypeDescription.fromString("struct<x:int,y:string>");
     File testFile = new File(testFolder.getRoot(), "test-orc");
 
@@ -78,6 +78,12 @@ public class OrcReaderTest {
     }
     writer.addRowBatch(batch);
     writer.close();
+    return testFile;
+  }
+
+  @Test
+  public void testOrcJniReader() throws Exception {
+    File testFile = writeTestFile();
 
     OrcReader reader = new OrcReader(testFile.getAbsolutePath(), allocator);
     assertEquals(1, reader.getNumberOfStripes());
@@ -102,4 +108,31 @@ public class OrcReaderTest {
     stripeReader.close();
     reader.close();
   }
+
+  @Test
+  public void testOrcJniPrefetchingReader() throws Exception {
+    File testFile = writeTestFile();
+
+    OrcReader reader = new OrcReader(testFile.getAbsolutePath(), allocator);
+    reader.seek(100);
+    ArrowReader prefetchingReader = reader.prefetchingReader(256, 2);
+    VectorSchemaRoot schemaRoot = prefetchingReader.getVectorSchemaRoot();
+
+    int row = 100;
+    while (prefetchingReader.loadNextBatch()) {
+      assertTrue(schemaRoot.getRowCount() <= 256);
+      List<FieldVector> fields = schemaRoot.getFieldVectors();
+      IntVector intVector = (IntVector)fields.get(0);
+      VarCharVector varCharVector = (VarCharVector)fields.get(1);
+      for (int i = 0; i < schemaRoot.getRowCount(); ++i, ++row) {
+        assertEquals(row, intVector.get(i));
+        assertEquals("Last-" + (row * 3), new String(varCharVector.get(i), StandardCharsets.UTF_8));
+      }
+    }
+    assertEquals(1024, row);
+    assertNull(reader.nextStripeReader(1024));
+
+    prefetchingReader.close();
+    reader.close();
+  }
 }
@@ -72,6 +72,47 @@ class ToPandasStrings(object):
         self.arr.to_pandas(deduplicate_objects=False)
 
 
+class ToPandasStringColumns(object):
+    # Object columns are prepared without holding the GIL, so converting
+    # several of them benefits from use_threads
+
+    param_names = ('num_columns', 'use_threads')
+    params = ((1, 8), (False, True))
+    total = 1000000
+    string_length = 25
+
+    def setup(self, num_columns, use_threads):
+        unique_values = [tm.rands(self.string_length) for i in range(1000)]
+        values = unique_values * (self.total // len(unique_values))
+        arr = pa.array(values, type=pa.string())
+        self.table = pa.Table.from_arrays(
+            [arr] * num_columns, ['f{}'.format(i) for i in range(num_columns)])
+
+    def time_to_pandas_dedup(self, num_columns, use_threads):
+        self.table.to_pandas(use_threads=use_threads)
+
+    def time_to_pandas_no_dedup(self, num_columns, use_threads):
+        self.table.to_pandas(use_threads=use_threads, deduplicate_objects=False)
+
+
+class ToPandasDictionary(object):
+
+    param_names = ('uniqueness',)
+    params = ((0.001, 0.1, 0.5),)
+    total = 1000000
+    string_length = 25
+
+    def setup(self, uniqueness):
+        nunique = int(self.total * uniqueness)
+        unique_values = [tm.rands(self.string_length) for i in range(nunique)]
+        indices = np.arange(self.total) % nunique
+        self.arr = pa.DictionaryArray.from_arrays(
+            pa.array(indices, type=pa.int32()), pa.array(unique_values))
+
+    def time_to_pandas(self, *args):
+        self.arr.to_pandas()
+
+
 class ZeroCopyPandasRead(object):
 
     def setup(self):
@@ -316,6 +316,7 @@ class FlightMethod(enum.Enum):
     DO_PUT = 6
     DO_ACTION = 7
     LIST_ACTIONS = 8
+    DO_EXCHANGE = 9
 
 
 cdef wrap_flight_method(CFlightMethod method):
@@ -335,6 +336,8 @@ cdef wrap_flight_method(CFlightMethod method):
         return FlightMethod.DO_ACTION
     elif method == CFlightMethodListActions:
         return FlightMethod.LIST_ACTIONS
+    elif method == CFlightMethodDoExchange:
+        return FlightMethod.DO_EXCHANGE
     return FlightMethod.INVALID
 
 
@@ -538,6 +541,17 @@ cdef class Location:
         check_flight_status(CLocation.ForGrpcUnix(c_path, &result.location))
         return result
 
+    @staticmethod
+    def for_grpc_shm(path):
+        """Create a Location for a gRPC service on the same host, reached
+        through a domain socket, with DoGet data sent through shared memory.
+        """
+        cdef:
+            c_string c_path = tobytes(path)
+            Location result = Location.__new__(Location)
+        check_flight_status(CLocation.ForGrpcShm(c_path, &result.location))
+        return result
+
     @staticmethod
     cdef Location wrap(CLocation location):
         cdef Location result = Location.__new__(Location)
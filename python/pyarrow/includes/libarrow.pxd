@@ -738,6 +738,23 @@ cdef extern from "arrow/api.h" namespace "arrow" nogil:
         Type type_id()
         c_bool Equals(const CTensor& other)
 
+    cdef cppclass CTableToTensorOptions" arrow::TableToTensorOptions":
+        c_bool row_major
+        c_bool null_to_nan
+        c_bool use_threads
+        CMemoryPool* pool
+
+        @staticmethod
+        CTableToTensorOptions Defaults()
+
+    CStatus RecordBatchToTensor(const CRecordBatch& batch,
+                                const CTableToTensorOptions& options,
+                                shared_ptr[CTensor]* out)
+
+    CStatus TableToTensor(const CTable& table,
+                          const CTableToTensorOptions& options,
+                          shared_ptr[CTensor]* out)
+
     cdef cppclass CSparseCOOTensor" arrow::SparseCOOTensor":
         shared_ptr[CDataType] type()
         shared_ptr[CBuffer] data()
@@ -1482,6 +1499,7 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
         int64_t size
         CMemoryPool* pool
         c_bool from_pandas
+        int64_t speculative_inference_size
 
     # TODO Some functions below are not actually "nogil"
 
@@ -96,6 +96,8 @@ cdef extern from "arrow/flight/api.h" namespace "arrow" nogil:
         CStatus ForGrpcTls(c_string& host, int port, CLocation* location)
         @staticmethod
         CStatus ForGrpcUnix(c_string& path, CLocation* location)
+        @staticmethod
+        CStatus ForGrpcShm(c_string& path, CLocation* location)
 
     cdef cppclass CFlightEndpoint" arrow::flight::FlightEndpoint":
         CFlightEndpoint()
@@ -226,6 +228,8 @@ cdef extern from "arrow/flight/api.h" namespace "arrow" nogil:
         " arrow::flight::FlightMethod::DoAction"
     CFlightMethod CFlightMethodListActions\
         " arrow::flight::FlightMethod::ListActions"
+    CFlightMethod CFlightMethodDoExchange\
+        " arrow::flight::FlightMethod::DoExchange"
 
     cdef cppclass CCallInfo" arrow::flight::CallInfo":
         CFlightMethod method
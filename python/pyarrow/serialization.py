@@ -16,6 +16,8 @@
 # under the License.
 
 import collections
+import pickle
+import sys
 
 import numpy as np
 
@@ -118,12 +120,25 @@ def _deserialize_pyarrow_table(buf):
         return reader.read_all()
 
 
+# Out-of-band pickle buffers are serialized without copying from Python 3.8
+_pickle_out_of_band = sys.version_info >= (3, 8)
+
+
 def _pickle_to_buffer(x):
+    if _pickle_out_of_band:
+        # Large buffers (e.g. of NumPy arrays) are collected as PickleBuffer
+        # objects instead of being copied into the pickle
+        buffers = []
+        pickled = pickle.dumps(x, protocol=5, buffer_callback=buffers.append)
+        return {"pickled": py_buffer(pickled), "buffers": buffers}
     pickled = builtin_pickle.dumps(x, protocol=builtin_pickle.HIGHEST_PROTOCOL)
     return py_buffer(pickled)
 
 
 def _load_pickle_from_buffer(data):
+    if isinstance(data, dict):
+        return pickle.loads(memoryview(data["pickled"]),
+                            buffers=data["buffers"])
     as_memoryview = memoryview(data)
     return builtin_pickle.loads(as_memoryview)
 
@@ -728,6 +728,47 @@ cdef class RecordBatch(_PandasConvertible):
             entries.append((name, column))
         return ordered_dict(entries)
 
+    def to_tensor(self, row_major=True, null_to_nan=False, use_threads=True,
+                  MemoryPool memory_pool=None):
+        """
+        Convert the RecordBatch to a 2-dimensional Tensor of shape
+        (num_rows, num_columns).
+
+        All the columns must be numeric.  They are written into a single
+        tensor, promoting their types to a common type as NumPy does.
+
+        Parameters
+        ----------
+        row_major : bool, default True
+            Whether the tensor is row-major (C order) or column-major
+            (Fortran order).
+        null_to_nan : bool, default False
+            Whether nulls are converted to NaN, in which case integer columns
+            are converted to floats.  Otherwise, nulls raise an error.
+        use_threads : bool, default True
+            Whether to write the columns in parallel.
+        memory_pool : MemoryPool, default None
+            For memory allocations, if required, otherwise use default pool
+
+        Returns
+        -------
+        tensor : Tensor
+        """
+        cdef:
+            CTableToTensorOptions options = CTableToTensorOptions.Defaults()
+            shared_ptr[CTensor] result
+
+        options.row_major = row_major
+        options.null_to_nan = null_to_nan
+        options.use_threads = use_threads
+        options.pool = maybe_unbox_memory_pool(memory_pool)
+
+        with nogil:
+            check_status(RecordBatchToTensor(deref(self.batch), options,
+                                             &result))
+
+        return pyarrow_wrap_tensor(result)
+
     def _to_pandas(self, options, **kwargs):
         return Table.from_batches([self])._to_pandas(options, **kwargs)
 
@@ -1363,6 +1404,46 @@ cdef class Table(_PandasConvertible):
 
         return result
 
+    def to_tensor(self, row_major=True, null_to_nan=False, use_threads=True,
+                  MemoryPool memory_pool=None):
+        """
+        Convert the Table to a 2-dimensional Tensor of shape
+        (num_rows, num_columns).
+
+        All the columns must be numeric.  They are written into a single
+        tensor, promoting their types to a common type as NumPy does.
+
+        Parameters
+        ----------
+        row_major : bool, default True
+            Whether the tensor is row-major (C order) or column-major
+            (Fortran order).
+        null_to_nan : bool, default False
+            Whether nulls are converted to NaN, in which case integer columns
+            are converted to floats.  Otherwise, nulls raise an error.
+        use_threads : bool, default True
+            Whether to write the columns in parallel.
+        memory_pool : MemoryPool, default None
+            For memory allocations, if required, otherwise use default pool
+
+        Returns
+        -------
+        tensor : Tensor
+        """
+        cdef:
+            CTableToTensorOptions options = CTableToTensorOptions.Defaults()
+            shared_ptr[CTensor] result
+
+        options.row_major = row_major
+        options.null_to_nan = null_to_nan
+        options.use_threads = use_threads
+        options.pool = maybe_unbox_memory_pool(memory_pool)
+
+        with nogil:
+            check_status(TableToTensor(deref(self.table), options, &result))
+
+        return pyarrow_wrap_tensor(result)
+
     def _to_pandas(self, options, categories=None, ignore_metadata=False,
                    types_mapper=None):
         from pyarrow.pandas_compat import table_to_blockmanager
@@ -1592,6 +1592,20 @@ def test_array_from_numpy_unicode():
     assert arrow_arr.equals(expected)
 
 
+def test_array_from_numpy_unicode_non_ascii():
+    values = ['h\xe9llo', '\u20ac', '', '\U0001F600 smile', 'plain ascii']
+    for dtype in ['<U11', '>U11']:
+        arr = np.array(values, dtype=dtype)
+        arrow_arr = pa.array(arr)
+        assert arrow_arr.equals(pa.array(values, type='utf8'))
+
+        mask = np.array([False, True, False, False, True])
+        arrow_arr = pa.array(arr, mask=mask)
+        expected = pa.array(['h\xe9llo', None, '', '\U0001F600 smile', None],
+                            type='utf8')
+        assert arrow_arr.equals(expected)
+
+
 def test_array_string_from_non_string():
     # ARROW-5682 - when converting to string raise on non string-like dtype
     with pytest.raises(TypeError):
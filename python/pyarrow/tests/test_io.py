@@ -140,6 +140,30 @@ def test_python_file_read_at():
     assert len(w) == 16
 
 
+def test_python_file_readahead():
+    data = bytes(range(256)) * 1000
+
+    class CountingBytesIO(BytesIO):
+        readinto_calls = 0
+
+        def readinto(self, b):
+            self.readinto_calls += 1
+            return super().readinto(b)
+
+    buf = CountingBytesIO(data)
+    with pa.PythonFile(buf, mode='r') as f:
+        # Small reads are served from chunks read ahead
+        for offset in range(0, 10000, 10):
+            assert f.read_at(nbytes=10, offset=offset) == data[offset:offset + 10]
+        assert buf.readinto_calls <= 2
+
+        f.seek(100)
+        assert f.read(5) == data[100:105]
+        assert f.tell() == 105
+        assert f.read() == data[105:]
+        assert f.tell() == len(data)
+
+
 def test_python_file_readall():
     data = b'some sample data'
 
@@ -1606,6 +1606,12 @@ class TestConvertStringLikeTypes:
         converted = pa.array(arr, type=pa.binary(3))
         expected = pa.array(list(arr), type=pa.binary(3))
         assert converted.equals(expected)
+        # Contiguous arrays without a mask are converted without copying
+        assert converted.buffers()[1].address == arr.ctypes.data
+
+        converted = pa.array(arr[::2], type=pa.binary(3))
+        expected = pa.array([b'foo', b'baz'], type=pa.binary(3))
+        assert converted.equals(expected)
 
         mask = np.array([True, False, True])
         converted = pa.array(arr, type=pa.binary(3), mask=mask)
@@ -3090,6 +3096,22 @@ def test_to_pandas_split_blocks():
     _check_to_pandas_memory_unchanged(t, split_blocks=True)
 
 
+def test_to_pandas_split_blocks_use_threads():
+    t = pa.table([
+        pa.array([1, 2, None, 4, 5], type='i8'),
+        pa.array([1, 2, 3, 4, 5], type='f8'),
+        pa.array([True, False, None, True, False]),
+        pa.array(['a', 'b', None, 'd', 'e']),
+        pa.array(['a', 'b', 'a', None, 'b']).dictionary_encode(),
+    ], ['f{}'.format(i) for i in range(5)])
+
+    expected = t.to_pandas()
+    for use_threads in [True, False]:
+        result = t.to_pandas(split_blocks=True, use_threads=use_threads)
+        assert len(result._data.blocks) == 5
+        tm.assert_frame_equal(result, expected)
+
+
 def _check_blocks_created(t, number):
     x = t.to_pandas(split_blocks=True)
     assert len(x._data.blocks) == number
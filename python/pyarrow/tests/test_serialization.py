@@ -381,6 +381,39 @@ def test_numpy_serialization(large_buffer):
         serialization_roundtrip(obj, large_buffer)
 
 
+@pytest.mark.skipif(sys.version_info < (3, 8),
+                    reason="pickle.PickleBuffer requires Python 3.8")
+def test_pickle_buffer_serialization():
+    arr = np.arange(1000, dtype=np.int64)
+    buf = pa.py_buffer(b"some bytes")
+    obj = [pickle.PickleBuffer(arr), pickle.PickleBuffer(buf)]
+
+    components = pa.serialize(obj).to_components()
+    # The memory of the buffers is referenced, not copied
+    data = components['data']
+    assert data[1].address == arr.ctypes.data
+    assert data[2].address == buf.address
+
+    result = pa.deserialize_components(components)
+    assert [type(x) for x in result] == [pickle.PickleBuffer] * 2
+    assert result[0].raw().tobytes() == arr.tobytes()
+    assert result[1].raw().tobytes() == b"some bytes"
+    assert pa.py_buffer(result[1]).address == buf.address
+
+    # Out-of-band buffers of pickled objects aren't copied either (complex
+    # arrays aren't serialized as tensors)
+    arr = np.arange(1000, dtype=np.complex128)
+    context = pa.SerializationContext()
+    context.register_type(
+        np.ndarray, 'np.ndarray',
+        custom_serializer=pa.serialization._pickle_to_buffer,
+        custom_deserializer=pa.serialization._load_pickle_from_buffer)
+    serialized = pa.serialize(arr, context=context)
+    assert serialized.to_components()['data'][-1].address == arr.ctypes.data
+    np.testing.assert_array_equal(serialized.deserialize(context=context),
+                                  arr)
+
+
 def test_datetime_serialization(large_buffer):
     data = [
         #  Principia Mathematica published
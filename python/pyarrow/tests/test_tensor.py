@@ -207,3 +207,43 @@ def test_tensor_memoryview():
         assert np.frombuffer(m, dtype).tolist() == lst
         del tensor, data
         assert np.frombuffer(m, dtype).tolist() == lst
+
+
+@pytest.mark.parametrize('row_major', [True, False])
+def test_record_batch_to_tensor(row_major):
+    batch = pa.record_batch([
+        pa.array([1, 2, 3], type=pa.int8()),
+        pa.array([4, 5, 6], type=pa.int16()),
+        pa.array([7.5, 8.5, 9.5], type=pa.float32()),
+    ], names=['a', 'b', 'c'])
+    expected = np.array([[1, 4, 7.5], [2, 5, 8.5], [3, 6, 9.5]],
+                        dtype=np.float32)
+
+    tensor = batch.to_tensor(row_major=row_major)
+    assert tensor.type == pa.float32()
+    assert tensor.shape == (3, 3)
+    result = tensor.to_numpy()
+    assert result.flags['C_CONTIGUOUS' if row_major else 'F_CONTIGUOUS']
+    np.testing.assert_array_equal(result, expected)
+
+    table = pa.Table.from_batches([batch.slice(0, 1), batch.slice(1)])
+    tensor = table.to_tensor(row_major=row_major, use_threads=False)
+    np.testing.assert_array_equal(tensor.to_numpy(), expected)
+
+
+def test_record_batch_to_tensor_nulls():
+    batch = pa.record_batch([
+        pa.array([1, None, 3], type=pa.int32()),
+        pa.array([4, 5, 6], type=pa.int64()),
+    ], names=['a', 'b'])
+
+    with pytest.raises(pa.ArrowInvalid):
+        batch.to_tensor()
+
+    tensor = batch.to_tensor(null_to_nan=True)
+    assert tensor.type == pa.float64()
+    np.testing.assert_array_equal(
+        tensor.to_numpy(), np.array([[1, 4], [np.nan, 5], [3, 6]]))
+
+    with pytest.raises(TypeError):
+        pa.record_batch([pa.array(['x'])], names=['a']).to_tensor()
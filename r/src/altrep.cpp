@@ -0,0 +1,313 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "./arrow_types.h"
+
+#if defined(ARROW_R_WITH_ARROW) && defined(HAS_ALTREP)
+
+#include <R_ext/Altrep.h>
+
+#include <algorithm>
+
+namespace arrow {
+namespace r {
+namespace altrep {
+
+// ALTREP vectors viewing the memory of an Arrow array instead of copying it.
+//
+// data1 is an external pointer to the std::shared_ptr<Array> keeping the
+// buffers alive.  data2 is R_NilValue until the vector is materialized into a
+// regular R vector, which happens when R asks for a writeable pointer, or for a
+// pointer into an array with nulls (as nulls must become R's NA sentinels).
+// Once materialized, data2 is the source of truth.
+
+using ArrayPointer = Rcpp::XPtr<std::shared_ptr<Array>>;
+
+const std::shared_ptr<Array>& GetArray(SEXP alt) {
+  return *ArrayPointer(R_altrep_data1(alt));
+}
+
+inline bool IsMaterialized(SEXP alt) { return !Rf_isNull(R_altrep_data2(alt)); }
+
+R_xlen_t Length(SEXP alt) { return GetArray(alt)->length(); }
+
+Rboolean Inspect(SEXP alt, int pre, int deep, int pvec,
+                 void (*inspect_subtree)(SEXP, int, int, int)) {
+  const auto& array = GetArray(alt);
+  Rprintf("%s\n", tfm::format("arrow::Array<%s, %d nulls, %s> len=%d",
+                              array->type()->ToString(), array->null_count(),
+                              IsMaterialized(alt) ? "materialized" : "not materialized",
+                              array->length())
+                      .c_str());
+  return TRUE;
+}
+
+template <int RTYPE>
+struct AltrepVectorPrimitive {
+  using c_type = typename Rcpp::Vector<RTYPE>::stored_type;
+
+  static R_altrep_class_t class_t;
+
+  static SEXP Make(const std::shared_ptr<Array>& array) {
+    return R_new_altrep(class_t, ArrayPointer(new std::shared_ptr<Array>(array)),
+                        R_NilValue);
+  }
+
+  static const c_type* Values(SEXP alt) {
+    return GetArray(alt)->data()->template GetValues<c_type>(1);
+  }
+
+  // Copy `n` values from `i` into `buf`, with NA for the nulls
+  static void CopyValues(const Array& array, const c_type* values, R_xlen_t i,
+                         R_xlen_t n, c_type* buf) {
+    std::copy_n(values + i, n, buf);
+    if (array.null_count()) {
+      arrow::internal::BitmapReader null_reader(array.null_bitmap_data(),
+                                                array.offset() + i, n);
+      for (R_xlen_t k = 0; k < n; k++, null_reader.Next()) {
+        if (null_reader.IsNotSet()) {
+          buf[k] = Rcpp::default_value<RTYPE>();
+        }
+      }
+    }
+  }
+
+  static SEXP Materialize(SEXP alt) {
+    if (!IsMaterialized(alt)) {
+      const auto& array = GetArray(alt);
+      R_xlen_t n = array->length();
+      Rcpp::Shield<SEXP> copy(Rf_allocVector(RTYPE, n));
+      CopyValues(*array, Values(alt), 0, n,
+                 Rcpp::internal::r_vector_start<RTYPE>(copy));
+      R_set_altrep_data2(alt, copy);
+    }
+    return R_altrep_data2(alt);
+  }
+
+  static void* Dataptr(SEXP alt, Rboolean writeable) {
+    if (!writeable && !IsMaterialized(alt) && GetArray(alt)->null_count() == 0) {
+      return const_cast<c_type*>(Values(alt));
+    }
+    return STDVEC_DATAPTR(Materialize(alt));
+  }
+
+  static const void* Dataptr_or_null(SEXP alt) {
+    if (IsMaterialized(alt)) {
+      return STDVEC_DATAPTR(R_altrep_data2(alt));
+    }
+    if (GetArray(alt)->null_count() == 0) {
+      return Values(alt);
+    }
+    return nullptr;
+  }
+
+  static c_type Elt(SEXP alt, R_xlen_t i) {
+    if (IsMaterialized(alt)) {
+      return Rcpp::internal::r_vector_start<RTYPE>(R_altrep_data2(alt))[i];
+    }
+    const auto& array = GetArray(alt);
+    return array->IsNull(i) ? Rcpp::default_value<RTYPE>() : Values(alt)[i];
+  }
+
+  static R_xlen_t Get_region(SEXP alt, R_xlen_t i, R_xlen_t n, c_type* buf) {
+    const auto& array = GetArray(alt);
+    n = std::min<R_xlen_t>(n, array->length() - i);
+    if (IsMaterialized(alt)) {
+      std::copy_n(Rcpp::internal::r_vector_start<RTYPE>(R_altrep_data2(alt)) + i, n,
+                  buf);
+    } else {
+      CopyValues(*array, Values(alt), i, n, buf);
+    }
+    return n;
+  }
+
+  // The Arrow memory is immutable, so a duplicate can share it
+  static SEXP Duplicate(SEXP alt, Rboolean deep) {
+    if (IsMaterialized(alt)) {
+      return Rf_duplicate(R_altrep_data2(alt));
+    }
+    return Make(GetArray(alt));
+  }
+
+  static void Init(R_altrep_class_t class_t) {
+    AltrepVectorPrimitive::class_t = class_t;
+    R_set_altrep_Length_method(class_t, Length);
+    R_set_altrep_Inspect_method(class_t, Inspect);
+    R_set_altrep_Duplicate_method(class_t, Duplicate);
+    R_set_altvec_Dataptr_method(class_t, Dataptr);
+    R_set_altvec_Dataptr_or_null_method(class_t, Dataptr_or_null);
+  }
+};
+
+template <int RTYPE>
+R_altrep_class_t AltrepVectorPrimitive<RTYPE>::class_t;
+
+using AltrepVectorReal = AltrepVectorPrimitive<REALSXP>;
+using AltrepVectorInteger = AltrepVectorPrimitive<INTSXP>;
+
+struct AltrepVectorString {
+  static R_altrep_class_t class_t;
+
+  static SEXP Make(const std::shared_ptr<Array>& array) {
+    return R_new_altrep(class_t, ArrayPointer(new std::shared_ptr<Array>(array)),
+                        R_NilValue);
+  }
+
+  static SEXP MakeString(const StringArray& array, R_xlen_t i) {
+    if (array.IsNull(i)) {
+      return NA_STRING;
+    }
+    auto view = array.GetView(i);
+    return Rf_mkCharLenCE(view.data(), static_cast<int>(view.size()), CE_UTF8);
+  }
+
+  static SEXP Materialize(SEXP alt) {
+    if (!IsMaterialized(alt)) {
+      const auto& array = internal::checked_cast<const StringArray&>(*GetArray(alt));
+      R_xlen_t n = array.length();
+      Rcpp::Shield<SEXP> copy(Rf_allocVector(STRSXP, n));
+      for (R_xlen_t i = 0; i < n; i++) {
+        SET_STRING_ELT(copy, i, MakeString(array, i));
+      }
+      R_set_altrep_data2(alt, copy);
+    }
+    return R_altrep_data2(alt);
+  }
+
+  // Strings are made on demand, without keeping them
+  static SEXP Elt(SEXP alt, R_xlen_t i) {
+    if (IsMaterialized(alt)) {
+      return STRING_ELT(R_altrep_data2(alt), i);
+    }
+    return MakeString(internal::checked_cast<const StringArray&>(*GetArray(alt)), i);
+  }
+
+  static void Set_elt(SEXP alt, R_xlen_t i, SEXP value) {
+    SET_STRING_ELT(Materialize(alt), i, value);
+  }
+
+  static void* Dataptr(SEXP alt, Rboolean writeable) {
+    return STDVEC_DATAPTR(Materialize(alt));
+  }
+
+  static const void* Dataptr_or_null(SEXP alt) {
+    if (IsMaterialized(alt)) {
+      return STDVEC_DATAPTR(R_altrep_data2(alt));
+    }
+    return nullptr;
+  }
+
+  static SEXP Duplicate(SEXP alt, Rboolean deep) {
+    if (IsMaterialized(alt)) {
+      return Rf_duplicate(R_altrep_data2(alt));
+    }
+    return Make(GetArray(alt));
+  }
+
+  static void Init(R_altrep_class_t class_t) {
+    AltrepVectorString::class_t = class_t;
+    R_set_altrep_Length_method(class_t, Length);
+    R_set_altrep_Inspect_method(class_t, Inspect);
+    R_set_altrep_Duplicate_method(class_t, Duplicate);
+    R_set_altvec_Dataptr_method(class_t, Dataptr);
+    R_set_altvec_Dataptr_or_null_method(class_t, Dataptr_or_null);
+    R_set_altstring_Elt_method(class_t, Elt);
+    R_set_altstring_Set_elt_method(class_t, Set_elt);
+  }
+};
+
+R_altrep_class_t AltrepVectorString::class_t;
+
+void Init_Altrep_classes(DllInfo* dll) {
+  AltrepVectorReal::Init(R_make_altreal_class("array_dbl_vector", "arrow", dll));
+  R_set_altreal_Elt_method(AltrepVectorReal::class_t, AltrepVectorReal::Elt);
+  R_set_altreal_Get_region_method(AltrepVectorReal::class_t,
+                                  AltrepVectorReal::Get_region);
+
+  AltrepVectorInteger::Init(R_make_altinteger_class("array_int_vector", "arrow", dll));
+  R_set_altinteger_Elt_method(AltrepVectorInteger::class_t, AltrepVectorInteger::Elt);
+  R_set_altinteger_Get_region_method(AltrepVectorInteger::class_t,
+                                     AltrepVectorInteger::Get_region);
+
+  AltrepVectorString::Init(R_make_altstring_class("array_string_vector", "arrow", dll));
+}
+
+// Use ALTREP unless options(arrow.use_altrep = FALSE)
+bool UseAltrep() {
+  SEXP option = Rf_GetOption1(Rf_install("arrow.use_altrep"));
+  return Rf_isNull(option) || Rf_asLogical(option) == TRUE;
+}
+
+SEXP MakeAltrepVector(const ArrayVector& arrays) {
+  // Only single arrays are viewed: chunked arrays are still copied
+  if (arrays.size() != 1 || arrays[0]->length() == 0 || !UseAltrep()) {
+    return R_NilValue;
+  }
+  const auto& array = arrays[0];
+  switch (array->type_id()) {
+    case Type::DOUBLE:
+      return AltrepVectorReal::Make(array);
+    case Type::INT32:
+      return AltrepVectorInteger::Make(array);
+    case Type::STRING:
+      return AltrepVectorString::Make(array);
+    default:
+      return R_NilValue;
+  }
+}
+
+bool IsAltrep(SEXP x) {
+  if (!ALTREP(x)) {
+    return false;
+  }
+  return R_altrep_inherits(x, AltrepVectorReal::class_t) ||
+         R_altrep_inherits(x, AltrepVectorInteger::class_t) ||
+         R_altrep_inherits(x, AltrepVectorString::class_t);
+}
+
+}  // namespace altrep
+}  // namespace r
+}  // namespace arrow
+
+#else
+
+namespace arrow {
+namespace r {
+namespace altrep {
+
+void Init_Altrep_classes(DllInfo* dll) {}
+
+#if defined(ARROW_R_WITH_ARROW)
+
+SEXP MakeAltrepVector(const ArrayVector& arrays) { return R_NilValue; }
+
+bool IsAltrep(SEXP x) { return false; }
+
+#endif
+
+}  // namespace altrep
+}  // namespace r
+}  // namespace arrow
+
+#endif
+
+#if defined(ARROW_R_WITH_ARROW)
+
+// [[arrow::export]]
+bool is_arrow_altrep(SEXP x) { return arrow::r::altrep::IsAltrep(x); }
+
+#endif
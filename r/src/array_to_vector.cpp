@@ -85,6 +85,10 @@ class Converter {
     }
   }
 
+  // A vector viewing the arrays instead of copying them, or R_NilValue
+  // when that is not possible, see altrep.cpp
+  SEXP Altrep() const { return altrep::MakeAltrepVector(arrays_); }
+
   // Converter factory
   static std::shared_ptr<Converter> Make(const ArrayVector& arrays);
 
@@ -133,6 +137,15 @@ SEXP ArrayVector__as_vector(R_xlen_t n, const ArrayVector& arrays) {
   return data;
 }
 
+// Same, avoiding the copy when possible
+SEXP ArrayVector__as_vector_altrep(R_xlen_t n, const ArrayVector& arrays) {
+  SEXP data = altrep::MakeAltrepVector(arrays);
+  if (!Rf_isNull(data)) {
+    return data;
+  }
+  return ArrayVector__as_vector(n, arrays);
+}
+
 template <int RTYPE>
 class Converter_SimpleArray : public Converter {
   using Vector = Rcpp::Vector<RTYPE, Rcpp::NoProtectStorage>;
@@ -574,7 +587,7 @@ class Converter_List : public Converter {
     auto ingest_one = [&](R_xlen_t i) {
       auto slice =
           values_array->Slice(list_array->value_offset(i), list_array->value_length(i));
-      SET_VECTOR_ELT(data, i + start, Array__as_vector(slice));
+      SET_VECTOR_ELT(data, i + start, ArrayVector__as_vector(slice->length(), {slice}));
     };
 
     if (array->null_count()) {
@@ -751,8 +764,11 @@ Rcpp::List to_dataframe_serial(
   Rcpp::List tbl(nc);
 
   for (int i = 0; i < nc; i++) {
-    SEXP column = tbl[i] = converters[i]->Allocate(nr);
-    STOP_IF_NOT_OK(converters[i]->IngestSerial(column));
+    SEXP column = tbl[i] = converters[i]->Altrep();
+    if (Rf_isNull(column)) {
+      column = tbl[i] = converters[i]->Allocate(nr);
+      STOP_IF_NOT_OK(converters[i]->IngestSerial(column));
+    }
   }
   tbl.attr("names") = names;
   tbl.attr("class") = Rcpp::CharacterVector::create("tbl_df", "tbl", "data.frame");
@@ -768,12 +784,21 @@ Rcpp::List to_dataframe_parallel(
   // task group to ingest data in parallel
   auto tg = arrow::internal::TaskGroup::MakeThreaded(arrow::internal::GetCpuThreadPool());
 
+  // columns viewing the arrays directly, that need no ingestion
+  std::vector<bool> altrep(nc);
+
   // allocate and start ingesting immediately the columns that
   // can be ingested in parallel, i.e. when ingestion no longer
   // need to happen on the main thread
   for (int i = 0; i < nc; i++) {
+    SEXP column = tbl[i] = converters[i]->Altrep();
+    altrep[i] = !Rf_isNull(column);
+    if (altrep[i]) {
+      continue;
+    }
+
     // allocate data for column i
-    SEXP column = tbl[i] = converters[i]->Allocate(nr);
+    column = tbl[i] = converters[i]->Allocate(nr);
 
     // add a task to ingest data of that column if that can be done in parallel
     if (converters[i]->Parallel()) {
@@ -785,7 +810,7 @@ Rcpp::List to_dataframe_parallel(
 
   // ingest the columns that cannot be dealt with in parallel
   for (int i = 0; i < nc; i++) {
-    if (!converters[i]->Parallel()) {
+    if (!altrep[i] && !converters[i]->Parallel()) {
       status &= converters[i]->IngestSerial(tbl[i]);
     }
   }
@@ -807,13 +832,13 @@ Rcpp::List to_dataframe_parallel(
 
 // [[arrow::export]]
 SEXP Array__as_vector(const std::shared_ptr<arrow::Array>& array) {
-  return arrow::r::ArrayVector__as_vector(array->length(), {array});
+  return arrow::r::ArrayVector__as_vector_altrep(array->length(), {array});
 }
 
 // [[arrow::export]]
 SEXP ChunkedArray__as_vector(const std::shared_ptr<arrow::ChunkedArray>& chunked_array) {
-  return arrow::r::ArrayVector__as_vector(chunked_array->length(),
-                                          chunked_array->chunks());
+  return arrow::r::ArrayVector__as_vector_altrep(chunked_array->length(),
+                                                 chunked_array->chunks());
 }
 
 // [[arrow::export]]
@@ -183,9 +183,20 @@ inline constexpr Rbyte default_value<RAWSXP>() {
 
 }  // namespace Rcpp
 
+// ALTREP vectors, see altrep.cpp
+#if R_VERSION >= R_Version(3, 6, 0)
+#define HAS_ALTREP
+#endif
+
 namespace arrow {
 namespace r {
 
+namespace altrep {
+
+void Init_Altrep_classes(DllInfo* dll);
+
+}  // namespace altrep
+
 template <typename T>
 inline std::shared_ptr<T> extract(SEXP x) {
   return Rcpp::ConstReferenceSmartPtrInputParameter<std::shared_ptr<T>>(x);
@@ -289,6 +300,16 @@ class RBuffer : public MutableBuffer {
 
 std::shared_ptr<arrow::DataType> InferArrowTypeFromFactor(SEXP);
 
+namespace altrep {
+
+// An R vector viewing the memory of `arrays` without copying, or R_NilValue
+// if their type is not supported or ALTREP is not available
+SEXP MakeAltrepVector(const ArrayVector& arrays);
+
+bool IsAltrep(SEXP x);
+
+}  // namespace altrep
+
 }  // namespace r
 }  // namespace arrow
 